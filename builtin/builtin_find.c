@@ -0,0 +1,212 @@
+/****************************************************************************
+ * apps/builtin/builtin_find.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+#include <errno.h>
+
+#include <nuttx/binfmt/builtin.h>
+
+#include "builtin/builtin.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The POSIX build sorts builtin_list.h by application name so that the
+ * table can be searched with a binary search.  The native Windows build
+ * concatenates the registry files as they are and the table has to be
+ * searched linearly.
+ */
+
+#ifndef CONFIG_WINDOWS_NATIVE
+#  define HAVE_SORTED_BUILTINS 1
+#endif
+
+/* The last entry in g_builtins[] is a NULL terminator */
+
+#define NUM_BUILTINS (g_builtin_count - 1)
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+extern const struct builtin_s g_builtins[];
+extern const int g_builtin_count;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: builtin_lowerbound
+ *
+ * Description:
+ *   Return the index of the first builtin whose first namelen characters
+ *   do not compare less than those of name.  If namelen is zero, the whole
+ *   name is compared.
+ *
+ ****************************************************************************/
+
+#ifdef HAVE_SORTED_BUILTINS
+static int builtin_lowerbound(FAR const char *name, size_t namelen)
+{
+  int lower = 0;
+  int upper = NUM_BUILTINS;
+
+  while (lower < upper)
+    {
+      int mid = (lower + upper) >> 1;
+      int cmp;
+
+      if (namelen > 0)
+        {
+          cmp = strncmp(g_builtins[mid].name, name, namelen);
+        }
+      else
+        {
+          cmp = strcmp(g_builtins[mid].name, name);
+        }
+
+      if (cmp < 0)
+        {
+          lower = mid + 1;
+        }
+      else
+        {
+          upper = mid;
+        }
+    }
+
+  return lower;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: builtin_find
+ *
+ * Description:
+ *   Find the index of the builtin application with the given name.
+ *
+ * Input Parameter:
+ *   name - Name of the builtin application
+ *
+ * Returned Value:
+ *   The index of the builtin application on success; -ENOENT if there is
+ *   no builtin application with that name.
+ *
+ ****************************************************************************/
+
+int builtin_find(FAR const char *name)
+{
+  int index;
+
+#ifdef HAVE_SORTED_BUILTINS
+  index = builtin_lowerbound(name, 0);
+  if (index < NUM_BUILTINS && strcmp(g_builtins[index].name, name) == 0)
+    {
+      return index;
+    }
+#else
+  for (index = 0; index < NUM_BUILTINS; index++)
+    {
+      if (strcmp(g_builtins[index].name, name) == 0)
+        {
+          return index;
+        }
+    }
+#endif
+
+  return -ENOENT;
+}
+
+/****************************************************************************
+ * Name: builtin_nextmatch
+ *
+ * Description:
+ *   Find the next builtin application whose name begins with the first
+ *   namelen characters of name.  This is used by the readline tab-
+ *   completion logic.
+ *
+ * Input Parameter:
+ *   name    - The partial name to be matched
+ *   namelen - The number of characters of name to match (at least one)
+ *   index   - Zero to find the first match; one more than the index of the
+ *             previous match to find the next one.
+ *
+ * Returned Value:
+ *   The index of the matching builtin application; -ENOENT if there are
+ *   no more matches.
+ *
+ ****************************************************************************/
+
+int builtin_nextmatch(FAR const char *name, size_t namelen, int index)
+{
+#ifdef HAVE_SORTED_BUILTINS
+  /* All matching names are adjacent in the sorted table.  Only the first
+   * one has to be searched for.
+   */
+
+  if (index == 0)
+    {
+      index = builtin_lowerbound(name, namelen);
+    }
+
+  if (index < NUM_BUILTINS &&
+      strncmp(g_builtins[index].name, name, namelen) == 0)
+    {
+      return index;
+    }
+#else
+  for (; index < NUM_BUILTINS; index++)
+    {
+      if (strncmp(g_builtins[index].name, name, namelen) == 0)
+        {
+          return index;
+        }
+    }
+#endif
+
+  return -ENOENT;
+}
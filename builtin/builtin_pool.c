@@ -0,0 +1,428 @@
+/****************************************************************************
+ * apps/builtin/builtin_pool.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <errno.h>
+#include <debug.h>
+
+#if CONFIG_TASK_NAME_SIZE > 0
+#  include <sys/prctl.h>
+#endif
+
+#include "builtin/builtin.h"
+
+#ifdef CONFIG_BUILTIN_POOL
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_BUILTIN_POOL_NWORKERS
+#  define CONFIG_BUILTIN_POOL_NWORKERS 2
+#endif
+
+#ifndef CONFIG_BUILTIN_POOL_STACKSIZE
+#  define CONFIG_BUILTIN_POOL_STACKSIZE 2048
+#endif
+
+#ifndef CONFIG_BUILTIN_POOL_PRIORITY
+#  define CONFIG_BUILTIN_POOL_PRIORITY 100
+#endif
+
+#ifndef CONFIG_BUILTIN_POOL_APPS
+#  define CONFIG_BUILTIN_POOL_APPS ""
+#endif
+
+#define WORKER_NAME "builtin worker"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One pre-started worker task.  A worker inherits the file descriptors of
+ * the task that started it, so it only takes work from that task.
+ */
+
+struct builtin_worker_s
+{
+  pid_t pid;                       /* Task ID of the worker, <0 if none */
+  pid_t owner;                     /* Task that started the worker */
+  sem_t start;                     /* Posted when a builtin is assigned */
+  sem_t done;                      /* Posted when the builtin has finished */
+  volatile bool busy;              /* True: Running a builtin */
+
+  /* The builtin to run and its result */
+
+  FAR const struct builtin_s *builtin;
+  FAR char * const *argv;
+  int argc;
+  int status;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct builtin_worker_s g_workers[CONFIG_BUILTIN_POOL_NWORKERS];
+static sem_t g_poollock = SEM_INITIALIZER(1);
+static bool g_poolinit;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: builtin_pooled
+ *
+ * Description:
+ *   Return true if the name appears as a word in CONFIG_BUILTIN_POOL_APPS.
+ *
+ ****************************************************************************/
+
+static bool builtin_pooled(FAR const char *name)
+{
+  FAR const char *ptr = CONFIG_BUILTIN_POOL_APPS;
+  size_t namelen = strlen(name);
+  size_t len;
+
+  while (*ptr != '\0')
+    {
+      ptr += strspn(ptr, " ,");
+      len  = strcspn(ptr, " ,");
+      if (len == namelen && strncmp(ptr, name, len) == 0)
+        {
+          return true;
+        }
+
+      ptr += len;
+    }
+
+  return false;
+}
+
+/****************************************************************************
+ * Name: builtin_workerexit
+ *
+ * Description:
+ *   Called if a builtin ends its worker with exit() instead of returning
+ *   from main().  Completes the builtin; the caller replaces the worker
+ *   when it next needs one.
+ *
+ ****************************************************************************/
+
+static void builtin_workerexit(int status, FAR void *arg)
+{
+  FAR struct builtin_worker_s *worker = (FAR struct builtin_worker_s *)arg;
+
+  worker->pid = -1;
+  if (worker->busy)
+    {
+      worker->status = status;
+      sem_post(&worker->done);
+    }
+}
+
+/****************************************************************************
+ * Name: builtin_worker
+ *
+ * Description:
+ *   The body of one worker task: wait for a builtin, run it with the
+ *   builtin's priority and name, and wait for the next one.
+ *
+ ****************************************************************************/
+
+static int builtin_worker(int argc, char *argv[])
+{
+  FAR struct builtin_worker_s *worker;
+  struct sched_param param;
+  int ret;
+
+  /* argv[1] is the address of the pool entry */
+
+  DEBUGASSERT(argc == 2);
+  worker = (FAR struct builtin_worker_s *)
+           ((uintptr_t)strtoul(argv[1], NULL, 16));
+
+  (void)on_exit(builtin_workerexit, worker);
+
+  for (;;)
+    {
+      do
+        {
+          ret = sem_wait(&worker->start);
+          DEBUGASSERT(ret == OK || errno == EINTR);
+        }
+      while (ret < 0);
+
+      param.sched_priority = worker->builtin->priority;
+      (void)sched_setparam(0, &param);
+#if CONFIG_TASK_NAME_SIZE > 0
+      (void)prctl(PR_SET_NAME, worker->builtin->name, 0);
+#endif
+
+      /* Start each builtin with a fresh getopt() state, as it would have
+       * in a new task.
+       */
+
+      optind = 1;
+      clearerr(stdin);
+      clearerr(stdout);
+
+      worker->status = worker->builtin->main(worker->argc,
+                                             (FAR char **)worker->argv);
+
+      fflush(stdout);
+      fflush(stderr);
+
+      /* Go back to the idle priority and name until the next builtin */
+
+      param.sched_priority = CONFIG_BUILTIN_POOL_PRIORITY;
+      (void)sched_setparam(0, &param);
+#if CONFIG_TASK_NAME_SIZE > 0
+      (void)prctl(PR_SET_NAME, WORKER_NAME, 0);
+#endif
+      sem_post(&worker->done);
+    }
+
+  return OK; /* Not reached */
+}
+
+/****************************************************************************
+ * Name: builtin_startworker
+ ****************************************************************************/
+
+static int builtin_startworker(FAR struct builtin_worker_s *worker)
+{
+  char arg[2 * sizeof(uintptr_t) + 1];
+  FAR char *argv[2];
+
+  worker->busy  = false;
+  worker->owner = getpid();
+  sem_init(&worker->start, 0, 0);
+  sem_init(&worker->done, 0, 0);
+
+  /* Pass the address of the pool entry to the new task */
+
+  snprintf(arg, sizeof(arg), "%lx", (unsigned long)((uintptr_t)worker));
+  argv[0] = arg;
+  argv[1] = NULL;
+
+  worker->pid = task_create(WORKER_NAME, CONFIG_BUILTIN_POOL_PRIORITY,
+                            CONFIG_BUILTIN_POOL_STACKSIZE, builtin_worker,
+                            argv);
+  if (worker->pid < 0)
+    {
+      int errval = errno;
+
+      serr("ERROR: Failed to start a builtin worker: %d\n", errval);
+      sem_destroy(&worker->start);
+      sem_destroy(&worker->done);
+      return -errval;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: builtin_getworker
+ *
+ * Description:
+ *   Get an idle worker started by the calling task, starting one if there
+ *   is none.  Workers that have exited are replaced.  Returns NULL if all
+ *   workers are in use.  Called with g_poollock held.
+ *
+ ****************************************************************************/
+
+static FAR struct builtin_worker_s *builtin_getworker(void)
+{
+  FAR struct builtin_worker_s *worker;
+  struct sched_param param;
+  pid_t me = getpid();
+  int i;
+
+  if (!g_poolinit)
+    {
+      for (i = 0; i < CONFIG_BUILTIN_POOL_NWORKERS; i++)
+        {
+          g_workers[i].pid = -1;
+        }
+
+      g_poolinit = true;
+    }
+
+  for (i = 0; i < CONFIG_BUILTIN_POOL_NWORKERS; i++)
+    {
+      worker = &g_workers[i];
+      if (worker->pid >= 0 && worker->owner == me && !worker->busy)
+        {
+          if (sched_getparam(worker->pid, &param) == 0 || errno != ESRCH)
+            {
+              return worker;
+            }
+
+          /* It has exited */
+
+          worker->pid = -1;
+        }
+    }
+
+  for (i = 0; i < CONFIG_BUILTIN_POOL_NWORKERS; i++)
+    {
+      worker = &g_workers[i];
+      if (worker->pid >= 0 && !worker->busy)
+        {
+          if (sched_getparam(worker->pid, &param) < 0 && errno == ESRCH)
+            {
+              /* The worker has exited */
+
+              worker->pid = -1;
+            }
+          else if (sched_getparam(worker->owner, &param) < 0 &&
+                   errno == ESRCH)
+            {
+              /* The task that started it has exited, and the worker's
+               * stdin, stdout and stderr are those of a session that is
+               * gone.  Retire it.
+               */
+
+              (void)task_delete(worker->pid);
+              worker->pid = -1;
+            }
+        }
+
+      if (worker->pid < 0 && builtin_startworker(worker) == OK)
+        {
+          return worker;
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: builtin_pool_exec
+ *
+ * Description:
+ *   Run a builtin application listed in CONFIG_BUILTIN_POOL_APPS on a warm
+ *   worker task and wait for it to finish.  See include/builtin/builtin.h.
+ *
+ ****************************************************************************/
+
+int builtin_pool_exec(FAR const char *appname, FAR char * const *argv,
+                      FAR int *status)
+{
+  FAR const struct builtin_s *builtin;
+  FAR struct builtin_worker_s *worker;
+  int index;
+  int ret;
+
+  if (!builtin_pooled(appname))
+    {
+      return -ENOENT;
+    }
+
+  index = builtin_find(appname);
+  if (index < 0)
+    {
+      return -ENOENT;
+    }
+
+  builtin = builtin_for_index(index);
+  if (builtin == NULL)
+    {
+      return -ENOENT;
+    }
+
+  if (builtin->stacksize > CONFIG_BUILTIN_POOL_STACKSIZE)
+    {
+      return -E2BIG;
+    }
+
+  while (sem_wait(&g_poollock) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+
+  worker = builtin_getworker();
+  if (worker == NULL)
+    {
+      sem_post(&g_poollock);
+      return -EBUSY;
+    }
+
+  worker->busy    = true;
+  worker->builtin = builtin;
+  worker->argv    = argv;
+  for (worker->argc = 0; argv != NULL && argv[worker->argc] != NULL; )
+    {
+      worker->argc++;
+    }
+
+  sem_post(&g_poollock);
+
+  /* Run it and wait for it to finish */
+
+  sem_post(&worker->start);
+  do
+    {
+      ret = sem_wait(&worker->done);
+      DEBUGASSERT(ret == OK || errno == EINTR);
+    }
+  while (ret < 0);
+
+  *status      = worker->status;
+  worker->busy = false;
+  return OK;
+}
+
+#endif /* CONFIG_BUILTIN_POOL */
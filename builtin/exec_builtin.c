@@ -82,6 +82,22 @@
 
 int exec_builtin(FAR const char *appname, FAR char * const *argv,
                  FAR const char *redirfile, int oflags)
+{
+  return exec_builtin_closefds(appname, argv, redirfile, oflags, NULL, 0);
+}
+
+/****************************************************************************
+ * Name: exec_builtin_closefds
+ *
+ * Description:
+ *   Like exec_builtin(), but the new task does not inherit the nclose file
+ *   descriptors closefds[] of the caller.
+ *
+ ****************************************************************************/
+
+int exec_builtin_closefds(FAR const char *appname, FAR char * const *argv,
+                          FAR const char *redirfile, int oflags,
+                          FAR const int *closefds, int nclose)
 {
   FAR const struct builtin_s *builtin;
   posix_spawnattr_t attr;
@@ -90,10 +106,11 @@ int exec_builtin(FAR const char *appname, FAR char * const *argv,
   pid_t pid;
   int index;
   int ret;
+  int i;
 
   /* Verify that an application with this name exists */
 
-  index = builtin_isavail(appname);
+  index = builtin_find(appname);
   if (index < 0)
     {
       ret = ENOENT;
@@ -166,6 +183,19 @@ int exec_builtin(FAR const char *appname, FAR char * const *argv,
 
 #endif
 
+  /* Keep closefds[] out of the new task */
+
+  for (i = 0; i < nclose; i++)
+    {
+      ret = posix_spawn_file_actions_addclose(&file_actions, closefds[i]);
+      if (ret != 0)
+        {
+          serr("ERROR: posix_spawn_file_actions_addclose failed: %d\n",
+               ret);
+          goto errout_with_actions;
+        }
+    }
+
   /* Is output being redirected? */
 
   if (redirfile)
@@ -0,0 +1,118 @@
+/****************************************************************************
+ * canutils/canlib/canlib_addfilter.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/ioctl.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/can/can.h>
+
+#include "canutils/canlib.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: canlib_addfilter
+ *
+ * Description:
+ *   Wrapper for CANIOC_ADD_STDFILTER and CANIOC_ADD_EXTFILTER.  Accept the
+ *   messages whose ID matches id in every bit that is set in mask.
+ *
+ * Input Parameter:
+ *   fd    - file descriptor of an opened can device
+ *   extid - true for a 29-bit extended ID filter
+ *   id    - the ID to match
+ *   mask  - the ID bits that must match
+ *
+ * Returned Value:
+ *   The non-negative filter ID is returned on success.  Otherwise -1
+ *   (ERROR) is returned with the errno variable set to indicate the
+ *   nature of the error.
+ *
+ ****************************************************************************/
+
+int canlib_addfilter(int fd, bool extid, uint32_t id, uint32_t mask)
+{
+  int ret;
+
+  if (extid)
+    {
+#ifdef CONFIG_CAN_EXTID
+      struct canioc_extfilter_s xfilter;
+
+      xfilter.xf_id1  = id;
+      xfilter.xf_id2  = mask;
+      xfilter.xf_type = CAN_FILTER_MASK;
+      xfilter.xf_prio = CAN_MSGPRIO_HIGH;
+
+      ret = ioctl(fd, CANIOC_ADD_EXTFILTER, (unsigned long)&xfilter);
+      if (ret < 0)
+        {
+          canerr("CANIOC_ADD_EXTFILTER failed, errno=%d\n", errno);
+        }
+#else
+      errno = ENOSYS;
+      ret   = ERROR;
+#endif
+    }
+  else
+    {
+      struct canioc_stdfilter_s sfilter;
+
+      sfilter.sf_id1  = (uint16_t)id;
+      sfilter.sf_id2  = (uint16_t)mask;
+      sfilter.sf_type = CAN_FILTER_MASK;
+      sfilter.sf_prio = CAN_MSGPRIO_HIGH;
+
+      ret = ioctl(fd, CANIOC_ADD_STDFILTER, (unsigned long)&sfilter);
+      if (ret < 0)
+        {
+          canerr("CANIOC_ADD_STDFILTER failed, errno=%d\n", errno);
+        }
+    }
+
+  return ret;
+}
@@ -0,0 +1,133 @@
+/****************************************************************************
+ * canutils/canlib/canlib_readmsgs.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/can/can.h>
+
+#include "canutils/canlib.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: canlib_readmsgs
+ *
+ * Description:
+ *   Receive up to nmsgs CAN messages with a single read() call and unpack
+ *   them into an array of struct can_msg_s.
+ *
+ * Input Parameter:
+ *   fd    - file descriptor of an opened can device
+ *   msgs  - array that receives the messages
+ *   nmsgs - number of entries in msgs
+ *
+ * Returned Value:
+ *   The number of messages received is returned on success.  Otherwise -1
+ *   (ERROR) is returned with the errno variable set to indicate the
+ *   nature of the error.
+ *
+ ****************************************************************************/
+
+int canlib_readmsgs(int fd, FAR struct can_msg_s *msgs, int nmsgs)
+{
+  uint8_t buffer[CONFIG_CANUTILS_CANLIB_BATCH * CAN_MSGLEN(0)];
+  ssize_t nread;
+  size_t buflen;
+  size_t offset;
+  size_t msglen;
+  int count;
+
+  if (nmsgs > CONFIG_CANUTILS_CANLIB_BATCH)
+    {
+      nmsgs = CONFIG_CANUTILS_CANLIB_BATCH;
+    }
+
+  if (nmsgs < (int)CANLIB_MINBATCH)
+    {
+      errno = EINVAL;
+      return ERROR;
+    }
+
+  /* The driver copies out whole messages for as long as they fit, so with
+   * CAN_MSGLEN(0) bytes per entry it can never return more than nmsgs.
+   * CANLIB_MINBATCH guarantees that a full length message still fits.
+   */
+
+  buflen = nmsgs * CAN_MSGLEN(0);
+
+  nread = read(fd, buffer, buflen);
+  if (nread < 0)
+    {
+      if (errno != EAGAIN)
+        {
+          canerr("read failed, errno=%d\n", errno);
+        }
+
+      return ERROR;
+    }
+
+  /* The packed messages may be unaligned, so copy each header out before
+   * looking at its DLC.
+   */
+
+  for (offset = 0, count = 0;
+       offset + CAN_MSGLEN(0) <= (size_t)nread && count < nmsgs;
+       offset += msglen, count++)
+    {
+      memcpy(&msgs[count].cm_hdr, &buffer[offset], CAN_MSGLEN(0));
+      msglen = CAN_MSGLEN(canlib_dlc2bytes(msgs[count].cm_hdr.ch_dlc));
+      if (offset + msglen > (size_t)nread)
+        {
+          break;
+        }
+
+      memcpy(msgs[count].cm_data, &buffer[offset + CAN_MSGLEN(0)],
+             msglen - CAN_MSGLEN(0));
+    }
+
+  return count;
+}
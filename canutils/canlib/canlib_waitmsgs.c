@@ -0,0 +1,112 @@
+/****************************************************************************
+ * canutils/canlib/canlib_waitmsgs.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <poll.h>
+#include <errno.h>
+#include <debug.h>
+
+#include "canutils/canlib.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: canlib_waitmsgs
+ *
+ * Description:
+ *   Wait until at least one of several CAN devices has a message to read.
+ *
+ * Input Parameter:
+ *   fds     - array of file descriptors of opened can devices
+ *   nfds    - number of entries in fds
+ *   timeout - time to wait in milliseconds, or -1 to wait forever
+ *   ready   - set to a bit mask of the ready entries in fds
+ *
+ * Returned Value:
+ *   The number of ready devices is returned on success, or zero if the
+ *   timeout expired.  Otherwise -1 (ERROR) is returned with the errno
+ *   variable set to indicate the nature of the error.
+ *
+ ****************************************************************************/
+
+int canlib_waitmsgs(FAR const int *fds, int nfds, int timeout,
+                    FAR uint32_t *ready)
+{
+  struct pollfd pfds[CONFIG_CANUTILS_CANLIB_MAXFDS];
+  uint32_t set;
+  int ret;
+  int i;
+
+  if (nfds < 1 || nfds > CONFIG_CANUTILS_CANLIB_MAXFDS)
+    {
+      errno = EINVAL;
+      return ERROR;
+    }
+
+  for (i = 0; i < nfds; i++)
+    {
+      pfds[i].fd      = fds[i];
+      pfds[i].events  = POLLIN;
+      pfds[i].revents = 0;
+    }
+
+  ret = poll(pfds, nfds, timeout);
+  if (ret < 0)
+    {
+      canerr("poll failed, errno=%d\n", errno);
+      return ERROR;
+    }
+
+  /* Errors are reported as ready too, so that the next read returns them */
+
+  for (set = 0, i = 0; i < nfds; i++)
+    {
+      if ((pfds[i].revents & (POLLIN | POLLERR | POLLHUP | POLLNVAL)) != 0)
+        {
+          set |= (uint32_t)1 << i;
+        }
+    }
+
+  *ready = set;
+  return ret;
+}
@@ -0,0 +1,130 @@
+/****************************************************************************
+ * canutils/canlib/canlib_writemsgs.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/can/can.h>
+
+#include "canutils/canlib.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: canlib_writemsgs
+ *
+ * Description:
+ *   Queue nmsgs CAN messages for transmission, packing up to
+ *   CONFIG_CANUTILS_CANLIB_BATCH of them at a time into a single write()
+ *   call.
+ *
+ * Input Parameter:
+ *   fd    - file descriptor of an opened can device
+ *   msgs  - array of messages to send
+ *   nmsgs - number of entries in msgs
+ *
+ * Returned Value:
+ *   The number of messages queued is returned on success.  If no message
+ *   could be queued, -1 (ERROR) is returned with the errno variable set to
+ *   indicate the nature of the error.
+ *
+ ****************************************************************************/
+
+int canlib_writemsgs(int fd, FAR const struct can_msg_s *msgs, int nmsgs)
+{
+  uint8_t buffer[CONFIG_CANUTILS_CANLIB_BATCH * sizeof(struct can_msg_s)];
+  uint16_t msglen[CONFIG_CANUTILS_CANLIB_BATCH];
+  ssize_t nwritten;
+  size_t buflen;
+  int nsent = 0;
+  int count;
+  int i;
+
+  while (nsent < nmsgs)
+    {
+      /* Pack the next batch back-to-back, as the driver expects it */
+
+      for (buflen = 0, count = 0;
+           count < CONFIG_CANUTILS_CANLIB_BATCH && nsent + count < nmsgs;
+           count++)
+        {
+          FAR const struct can_msg_s *msg = &msgs[nsent + count];
+
+          msglen[count] = CAN_MSGLEN(canlib_dlc2bytes(msg->cm_hdr.ch_dlc));
+          memcpy(&buffer[buflen], msg, msglen[count]);
+          buflen += msglen[count];
+        }
+
+      nwritten = write(fd, buffer, buflen);
+      if (nwritten < 0)
+        {
+          if (nsent > 0 && errno == EAGAIN)
+            {
+              break;
+            }
+
+          canerr("write failed, errno=%d\n", errno);
+          return nsent > 0 ? nsent : ERROR;
+        }
+
+      /* The driver only accepts whole messages.  A short write means that
+       * a non-blocking TX FIFO is full.
+       */
+
+      for (i = 0; i < count && nwritten >= msglen[i]; i++)
+        {
+          nwritten -= msglen[i];
+        }
+
+      nsent += i;
+      if (i < count)
+        {
+          break;
+        }
+    }
+
+  return nsent;
+}
@@ -0,0 +1,110 @@
+/****************************************************************************
+ * canutils/canstat/canstat.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_CANUTILS_CANSTAT_CANSTAT_H
+#define __APPS_CANUTILS_CANSTAT_CANSTAT_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Configuration ************************************************************/
+
+#ifndef CONFIG_CANUTILS_CANSTAT_DEVPATH
+#  define CONFIG_CANUTILS_CANSTAT_DEVPATH "/dev/can0"
+#endif
+
+#ifndef CONFIG_CANUTILS_CANSTAT_NIDS
+#  define CONFIG_CANUTILS_CANSTAT_NIDS 64
+#endif
+
+/* Binary report format *****************************************************/
+
+/* With -b, each report is written to stdout as one struct canstat_report_s
+ * followed by nids struct canstat_id_s, all fields in the byte order of
+ * the target.
+ */
+
+#define CANSTAT_MAGIC      0x54534e43  /* "CNST" read as little endian */
+#define CANSTAT_VERSION    1
+
+/* Gap histogram bins.  Bin 0 counts back-to-back frames (no measurable
+ * gap), bin n counts gaps of 2^(n-1) up to 2^n - 1 microseconds and the
+ * last bin every longer gap.
+ */
+
+#define CANSTAT_NBINS      16
+
+/* Set in canstat_id_s::id for 29-bit extended IDs */
+
+#define CANSTAT_ID_EXT     (1u << 31)
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+struct canstat_report_s
+{
+  uint32_t magic;                   /* CANSTAT_MAGIC                       */
+  uint16_t version;                 /* CANSTAT_VERSION                     */
+  uint16_t nids;                    /* Number of canstat_id_s that follow  */
+  uint32_t interval;                /* Length of the interval in ms        */
+  uint32_t bitrate;                 /* Nominal bit rate in bits/s          */
+  uint32_t frames;                  /* Frames received                     */
+  uint32_t bits;                    /* Estimated bits on the bus           */
+  uint32_t load;                    /* Bus load in 1/10 %                  */
+  uint32_t untracked;               /* Frames with IDs not in the table    */
+  uint32_t errors;                  /* Error reports from the driver       */
+  uint32_t errclass;                /* OR of the error report class bits   */
+  uint32_t gaps[CANSTAT_NBINS];     /* Inter-frame gap histogram           */
+};
+
+struct canstat_id_s
+{
+  uint32_t id;                      /* Message ID | CANSTAT_ID_EXT         */
+  uint32_t frames;                  /* Frames received in the interval     */
+  uint32_t mingap;                  /* Shortest period in microseconds     */
+  uint32_t maxgap;                  /* Longest period in microseconds      */
+};
+
+#endif /* __APPS_CANUTILS_CANSTAT_CANSTAT_H */
@@ -0,0 +1,601 @@
+/****************************************************************************
+ * canutils/canstat/canstat_main.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <errno.h>
+
+#include <nuttx/can/can.h>
+
+#include "canutils/canlib.h"
+#include "canstat.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define CANSTAT_INTERVAL   1000        /* Default report interval in ms */
+#define CANSTAT_EMPTY      0xffffffff  /* Unused ID table entry */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct canstat_entry_s
+{
+  struct canstat_id_s stat;          /* Reported statistics                 */
+  uint32_t last;                     /* Time of the last frame (us)         */
+};
+
+struct canstat_state_s
+{
+  struct canstat_report_s rpt;       /* Statistics of the whole bus         */
+  uint32_t last;                     /* Time of the last frame (us)         */
+  bool havelast;                     /* last is valid                       */
+  bool stuffing;                     /* Count worst case stuff bits         */
+  struct canstat_entry_s ids[CONFIG_CANUTILS_CANSTAT_NIDS];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct canstat_state_s g_canstat;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: canstat_usage
+ ****************************************************************************/
+
+static void canstat_usage(FAR const char *progname)
+{
+  fprintf(stderr, "USAGE: %s [-d <dev>] [-i <ms>] [-n <count>] "
+          "[-r <bitrate>] [-s] [-b]\n", progname);
+  fprintf(stderr, "  -d <dev>     CAN device (default %s)\n",
+          CONFIG_CANUTILS_CANSTAT_DEVPATH);
+  fprintf(stderr, "  -i <ms>      Report interval (default %d)\n",
+          CANSTAT_INTERVAL);
+  fprintf(stderr, "  -n <count>   Stop after count reports (default: "
+          "never)\n");
+  fprintf(stderr, "  -r <bitrate> Bit rate if the driver cannot report "
+          "it\n");
+  fprintf(stderr, "  -s           Add worst case stuff bits to the bus "
+          "load\n");
+  fprintf(stderr, "  -b           Write binary reports to stdout\n");
+}
+
+/****************************************************************************
+ * Name: canstat_msec and canstat_usec
+ *
+ * Description:
+ *   The monotonic time in milli- and microseconds.  Only differences are
+ *   used so wrapping is harmless.
+ *
+ ****************************************************************************/
+
+static uint32_t canstat_msec(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+#ifndef CONFIG_CAN_TIMESTAMP
+static uint32_t canstat_usec(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+#endif
+
+/****************************************************************************
+ * Name: canstat_bits
+ *
+ * Description:
+ *   Return the number of bits that a data or remote frame occupies on the
+ *   bus, including the inter-frame space.  Stuff bits depend on the data
+ *   and are only estimated, as the worst case, if requested.
+ *
+ ****************************************************************************/
+
+static uint32_t canstat_bits(bool extid, int nbytes)
+{
+  /* Bits from the start of frame to the end of the CRC are subject to
+   * stuffing; the CRC delimiter, ACK, end of frame and intermission add
+   * another 13.
+   */
+
+  uint32_t stuffed = (extid ? 54 : 34) + 8 * nbytes;
+  uint32_t bits    = stuffed + 13;
+
+  if (g_canstat.stuffing)
+    {
+      bits += (stuffed - 1) / 4;
+    }
+
+  return bits;
+}
+
+/****************************************************************************
+ * Name: canstat_lookup
+ *
+ * Description:
+ *   Find or add the ID table entry of a message ID.  Returns NULL if the
+ *   table is full; *added tells whether the entry is new.
+ *
+ ****************************************************************************/
+
+static FAR struct canstat_entry_s *canstat_lookup(uint32_t id,
+                                                   FAR bool *added)
+{
+  FAR struct canstat_entry_s *entry;
+  unsigned int ndx;
+  int i;
+
+  *added = false;
+  ndx    = (id * 2654435761u) % CONFIG_CANUTILS_CANSTAT_NIDS;
+  for (i = 0; i < CONFIG_CANUTILS_CANSTAT_NIDS; i++)
+    {
+      entry = &g_canstat.ids[ndx];
+      if (entry->stat.id == id)
+        {
+          return entry;
+        }
+
+      if (entry->stat.id == CANSTAT_EMPTY)
+        {
+          entry->stat.id     = id;
+          entry->stat.frames = 0;
+          entry->stat.mingap = UINT32_MAX;
+          entry->stat.maxgap = 0;
+          *added             = true;
+          return entry;
+        }
+
+      if (++ndx >= CONFIG_CANUTILS_CANSTAT_NIDS)
+        {
+          ndx = 0;
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: canstat_frame
+ *
+ * Description:
+ *   Account for one received message.
+ *
+ ****************************************************************************/
+
+static void canstat_frame(FAR const struct can_msg_s *msg, uint32_t now)
+{
+  FAR struct canstat_report_s *rpt = &g_canstat.rpt;
+  FAR struct canstat_entry_s *entry;
+  uint32_t frameus;
+  uint32_t bits;
+  uint32_t gap;
+  uint32_t id;
+  bool extid = false;
+  bool added;
+  int nbytes;
+  int bin;
+
+#ifdef CONFIG_CAN_ERRORS
+  if (msg->cm_hdr.ch_error)
+    {
+      /* Error reports are generated by the driver, not received */
+
+      rpt->errors++;
+      rpt->errclass |= msg->cm_hdr.ch_id;
+      return;
+    }
+#endif
+
+#ifdef CONFIG_CAN_EXTID
+  extid  = msg->cm_hdr.ch_extid;
+#endif
+  nbytes = msg->cm_hdr.ch_rtr ? 0 : canlib_dlc2bytes(msg->cm_hdr.ch_dlc);
+  bits   = canstat_bits(extid, nbytes);
+
+  rpt->frames++;
+  rpt->bits += bits;
+
+  /* The receive times mark the end of each frame, so the idle time before
+   * this frame is what is left of the distance to the previous one once
+   * the length of this frame is taken off.
+   */
+
+  if (g_canstat.havelast)
+    {
+      frameus = (uint32_t)((uint64_t)bits * 1000000 / rpt->bitrate);
+      gap     = now - g_canstat.last;
+      gap     = gap > frameus ? gap - frameus : 0;
+
+      for (bin = 0; gap != 0 && bin < CANSTAT_NBINS - 1; bin++)
+        {
+          gap >>= 1;
+        }
+
+      rpt->gaps[bin]++;
+    }
+
+  g_canstat.last     = now;
+  g_canstat.havelast = true;
+
+  /* Per ID the period between frames is what matters */
+
+  id = msg->cm_hdr.ch_id | (extid ? CANSTAT_ID_EXT : 0);
+  entry = canstat_lookup(id, &added);
+  if (entry == NULL)
+    {
+      rpt->untracked++;
+      return;
+    }
+
+  if (!added)
+    {
+      gap = now - entry->last;
+      if (gap < entry->stat.mingap)
+        {
+          entry->stat.mingap = gap;
+        }
+
+      if (gap > entry->stat.maxgap)
+        {
+          entry->stat.maxgap = gap;
+        }
+    }
+
+  entry->stat.frames++;
+  entry->last = now;
+}
+
+/****************************************************************************
+ * Name: canstat_report
+ *
+ * Description:
+ *   Report the statistics of one interval and start the next one.
+ *
+ ****************************************************************************/
+
+static void canstat_report(FAR const char *devpath, uint32_t elapsed,
+                           bool binary)
+{
+  FAR struct canstat_report_s *rpt = &g_canstat.rpt;
+  FAR struct canstat_entry_s *entry;
+  uint32_t fps;
+  int i;
+
+  if (elapsed == 0)
+    {
+      elapsed = 1;
+    }
+
+  rpt->interval = elapsed;
+  rpt->load     = (uint32_t)((uint64_t)rpt->bits * 1000000 /
+                             ((uint64_t)rpt->bitrate * elapsed));
+  rpt->nids     = 0;
+
+  for (i = 0; i < CONFIG_CANUTILS_CANSTAT_NIDS; i++)
+    {
+      entry = &g_canstat.ids[i];
+      if (entry->stat.id != CANSTAT_EMPTY && entry->stat.frames > 0)
+        {
+          if (entry->stat.mingap == UINT32_MAX)
+            {
+              entry->stat.mingap = 0;
+            }
+
+          rpt->nids++;
+        }
+    }
+
+  if (binary)
+    {
+      fwrite(rpt, sizeof(*rpt), 1, stdout);
+    }
+  else
+    {
+      printf("%s: %lu ms, %lu frames, load %lu.%lu%%, %lu untracked, "
+             "%lu errors (class %08lx)\n", devpath,
+             (unsigned long)elapsed, (unsigned long)rpt->frames,
+             (unsigned long)rpt->load / 10, (unsigned long)rpt->load % 10,
+             (unsigned long)rpt->untracked, (unsigned long)rpt->errors,
+             (unsigned long)rpt->errclass);
+
+      for (i = 0; i < CANSTAT_NBINS; i++)
+        {
+          if (rpt->gaps[i] == 0)
+            {
+              continue;
+            }
+
+          if (i == 0)
+            {
+              printf("  gap          0 us: %lu\n",
+                     (unsigned long)rpt->gaps[i]);
+            }
+          else if (i == CANSTAT_NBINS - 1)
+            {
+              printf("  gap >= %7lu us: %lu\n", 1ul << (i - 1),
+                     (unsigned long)rpt->gaps[i]);
+            }
+          else
+            {
+              printf("  gap %5lu-%5lu us: %lu\n", 1ul << (i - 1),
+                     (1ul << i) - 1, (unsigned long)rpt->gaps[i]);
+            }
+        }
+
+      if (rpt->nids > 0)
+        {
+          printf("  %-9s %8s %9s %9s\n", "ID", "fps", "min us", "max us");
+        }
+    }
+
+  for (i = 0; i < CONFIG_CANUTILS_CANSTAT_NIDS; i++)
+    {
+      entry = &g_canstat.ids[i];
+      if (entry->stat.id == CANSTAT_EMPTY || entry->stat.frames == 0)
+        {
+          continue;
+        }
+
+      if (binary)
+        {
+          fwrite(&entry->stat, sizeof(entry->stat), 1, stdout);
+        }
+      else
+        {
+          fps = (uint32_t)((uint64_t)entry->stat.frames * 10000 / elapsed);
+          if ((entry->stat.id & CANSTAT_ID_EXT) != 0)
+            {
+              printf("  %08lx ", (unsigned long)
+                     (entry->stat.id & ~CANSTAT_ID_EXT));
+            }
+          else
+            {
+              printf("  %03lx      ", (unsigned long)entry->stat.id);
+            }
+
+          printf(" %6lu.%lu %9lu %9lu\n", (unsigned long)fps / 10,
+                 (unsigned long)fps % 10,
+                 (unsigned long)entry->stat.mingap,
+                 (unsigned long)entry->stat.maxgap);
+        }
+
+      entry->stat.frames = 0;
+      entry->stat.mingap = UINT32_MAX;
+      entry->stat.maxgap = 0;
+    }
+
+  fflush(stdout);
+
+  rpt->frames    = 0;
+  rpt->bits      = 0;
+  rpt->untracked = 0;
+  rpt->errors    = 0;
+  rpt->errclass  = 0;
+  memset(rpt->gaps, 0, sizeof(rpt->gaps));
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: canstat_main
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int canstat_main(int argc, FAR char *argv[])
+#endif
+{
+  struct can_msg_s msgs[CONFIG_CANUTILS_CANLIB_BATCH];
+  FAR const char *devpath = CONFIG_CANUTILS_CANSTAT_DEVPATH;
+  uint32_t interval = CANSTAT_INTERVAL;
+  uint32_t elapsed = 0;
+  uint32_t start;
+  uint32_t stamp;
+  uint32_t ready;
+  unsigned long count = 0;
+  unsigned long nreports;
+  bool binary = false;
+  bool silent = false;
+  int bitrate = 0;
+  int option;
+  int ret;
+  int fd;
+  int i;
+
+  memset(&g_canstat, 0, sizeof(g_canstat));
+  for (i = 0; i < CONFIG_CANUTILS_CANSTAT_NIDS; i++)
+    {
+      g_canstat.ids[i].stat.id = CANSTAT_EMPTY;
+    }
+
+  while ((option = getopt(argc, argv, "d:i:n:r:sbh")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'd':
+            devpath = optarg;
+            break;
+
+          case 'i':
+            interval = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'n':
+            count = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'r':
+            bitrate = atoi(optarg);
+            break;
+
+          case 's':
+            g_canstat.stuffing = true;
+            break;
+
+          case 'b':
+            binary = true;
+            break;
+
+          case 'h':
+          default:
+            canstat_usage(argv[0]);
+            return option == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+  if (interval == 0)
+    {
+      canstat_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+
+  fd = open(devpath, O_RDONLY | O_NONBLOCK);
+  if (fd < 0)
+    {
+      fprintf(stderr, "canstat: ERROR: Failed to open %s: %d\n",
+              devpath, errno);
+      return EXIT_FAILURE;
+    }
+
+  if (bitrate <= 0 && (canlib_getbaud(fd, &bitrate) < 0 || bitrate <= 0))
+    {
+      fprintf(stderr, "canstat: ERROR: Failed to get the bit rate (%d), "
+              "use -r\n", errno);
+      close(fd);
+      return EXIT_FAILURE;
+    }
+
+  g_canstat.rpt.magic   = CANSTAT_MAGIC;
+  g_canstat.rpt.version = CANSTAT_VERSION;
+  g_canstat.rpt.bitrate = bitrate;
+
+  /* Listen without acknowledging or transmitting anything, so that the
+   * measurement does not disturb the bus.
+   */
+
+  if (canlib_getsilent(fd, &silent) < 0 || canlib_setsilent(fd, true) < 0)
+    {
+      fprintf(stderr, "canstat: WARNING: Silent mode not supported (%d)\n",
+              errno);
+      silent = true;
+    }
+
+  for (nreports = 0; count == 0 || nreports < count; nreports++)
+    {
+      start = canstat_msec();
+
+      while ((elapsed = canstat_msec() - start) < interval)
+        {
+          ret = canlib_waitmsgs(&fd, 1, interval - elapsed, &ready);
+          if (ret <= 0)
+            {
+              if (ret < 0 && errno != EINTR)
+                {
+                  fprintf(stderr, "canstat: ERROR: poll failed: %d\n",
+                          errno);
+                  goto errout;
+                }
+
+              continue;
+            }
+
+          ret = canlib_readmsgs(fd, msgs, CONFIG_CANUTILS_CANLIB_BATCH);
+          if (ret < 0)
+            {
+              if (errno != EAGAIN && errno != EINTR)
+                {
+                  fprintf(stderr, "canstat: ERROR: read failed: %d\n",
+                          errno);
+                  goto errout;
+                }
+
+              continue;
+            }
+
+#ifndef CONFIG_CAN_TIMESTAMP
+          stamp = canstat_usec();
+#endif
+          for (i = 0; i < ret; i++)
+            {
+#ifdef CONFIG_CAN_TIMESTAMP
+              struct timeval tv;
+
+              canlib_gettimestamp(&msgs[i], &tv);
+              stamp = (uint32_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+              canstat_frame(&msgs[i], stamp);
+            }
+        }
+
+      canstat_report(devpath, elapsed, binary);
+    }
+
+errout:
+  if (!silent)
+    {
+      canlib_setsilent(fd, false);
+    }
+
+  close(fd);
+  return nreports > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,603 @@
+/****************************************************************************
+ * canutils/libcanard/canard_node.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/can/can.h>
+
+#include <canard.h>
+#include "canutils/canlib.h"
+#include "canutils/canard_node.h"
+#include "system/perfcount.h"
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Totals over all nodes and interfaces in the performance counter
+ * registry.  rxbatch is the number of frames per read().
+ */
+
+PERF_COUNTER(g_perf_rxframes, "canard.rxframes");
+PERF_COUNTER(g_perf_rxdups, "canard.rxdups");
+PERF_COUNTER(g_perf_txframes, "canard.txframes");
+PERF_COUNTER(g_perf_errors, "canard.errors");
+PERF_HISTOGRAM(g_perf_rxbatch, "canard.rxbatch");
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: canard_node_alive
+ *
+ * Description:
+ *   Return true if at least one interface of the node still works.
+ *
+ ****************************************************************************/
+
+static bool canard_node_alive(FAR struct canard_node_s *node)
+{
+  int i;
+
+  for (i = 0; i < node->niface; i++)
+    {
+      if (!node->iface[i].failed)
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
+
+/****************************************************************************
+ * Name: canard_node_fill
+ *
+ * Description:
+ *   Pop frames from the libcanard TX queue into the packed write buffers
+ *   of all working interfaces, for as long as any of them has room.
+ *
+ ****************************************************************************/
+
+static void canard_node_fill(FAR struct canard_node_s *node)
+{
+  FAR const CanardCANFrame *txf;
+  FAR struct canard_iface_s *iface;
+  struct can_msg_s msg;
+  size_t msglen;
+  bool room;
+  int i;
+
+  while ((txf = canardPeekTxQueue(node->ins)) != NULL)
+    {
+      for (room = false, i = 0; i < node->niface && !room; i++)
+        {
+          iface = &node->iface[i];
+          room  = !iface->failed &&
+                  iface->txlen + CAN_MSGLEN(8) <= sizeof(iface->txbuf);
+        }
+
+      if (!room)
+        {
+          break;
+        }
+
+      memset(&msg.cm_hdr, 0, sizeof(msg.cm_hdr));
+      msg.cm_hdr.ch_id    = txf->id & CANARD_CAN_EXT_ID_MASK;
+      msg.cm_hdr.ch_dlc   = txf->data_len;
+      msg.cm_hdr.ch_rtr   = (txf->id & CANARD_CAN_FRAME_RTR) != 0;
+      msg.cm_hdr.ch_extid = (txf->id & CANARD_CAN_FRAME_EFF) != 0;
+      memcpy(msg.cm_data, txf->data, txf->data_len);
+
+      msglen = CAN_MSGLEN(txf->data_len);
+
+      for (i = 0; i < node->niface; i++)
+        {
+          iface = &node->iface[i];
+          if (iface->failed)
+            {
+              continue;
+            }
+
+          if (iface->txlen + msglen > sizeof(iface->txbuf))
+            {
+              iface->txdropped++;
+              continue;
+            }
+
+          memcpy(&iface->txbuf[iface->txlen], &msg, msglen);
+          iface->txlen += msglen;
+        }
+
+      canardPopTxQueue(node->ins);
+    }
+}
+
+/****************************************************************************
+ * Name: canard_node_write
+ *
+ * Description:
+ *   Hand the pending frames of one interface to its driver.  Returns true
+ *   if the write buffer was emptied.
+ *
+ ****************************************************************************/
+
+static bool canard_node_write(FAR struct canard_iface_s *iface)
+{
+  struct can_hdr_s hdr;
+  ssize_t nwritten;
+  size_t offset;
+
+  nwritten = write(iface->fd, iface->txbuf, iface->txlen);
+  if (nwritten < 0)
+    {
+      if (errno == EAGAIN)
+        {
+          return false;
+        }
+
+      /* Discard the batch; the redundant interfaces still carry it */
+
+      canerr("ERROR: write failed: %d\n", errno);
+      iface->txerrors++;
+      PERF_INC(g_perf_errors);
+      iface->txlen = 0;
+      return true;
+    }
+
+  /* The driver takes whole messages only; count them for statistics and
+   * keep the rest at the start of the buffer.
+   */
+
+  for (offset = 0; offset < (size_t)nwritten; )
+    {
+      memcpy(&hdr, &iface->txbuf[offset], sizeof(hdr));
+      offset += CAN_MSGLEN(canlib_dlc2bytes(hdr.ch_dlc));
+      iface->txframes++;
+      PERF_INC(g_perf_txframes);
+    }
+
+  if (nwritten > 0)
+    {
+      iface->txbatches++;
+    }
+
+  iface->txlen -= nwritten;
+  if (iface->txlen > 0)
+    {
+      memmove(iface->txbuf, &iface->txbuf[nwritten], iface->txlen);
+      return false;
+    }
+
+  return true;
+}
+
+#if CONFIG_LIBCANARD_NIFACES > 1
+/****************************************************************************
+ * Name: canard_node_isdup
+ *
+ * Description:
+ *   Return true if the same frame arrived on another interface within
+ *   CONFIG_LIBCANARD_DEDUP_USEC.  Otherwise remember the frame.
+ *
+ *   The UAVCAN tail byte carries the transfer ID and toggle bit, so
+ *   identical frames on the same bus are distinct frames, while identical
+ *   frames on different buses are copies of one.  The table is direct
+ *   mapped: a collision at worst lets a copy through, which libcanard's
+ *   own transfer ID check then rejects in most cases.
+ *
+ ****************************************************************************/
+
+static bool canard_node_isdup(FAR struct canard_node_s *node, int ndx,
+                              FAR const CanardCANFrame *frame,
+                              uint64_t now)
+{
+  FAR struct canard_dedup_s *entry;
+  uint32_t hash;
+  uint8_t tail;
+
+  tail  = frame->data_len > 0 ? frame->data[frame->data_len - 1] : 0;
+  hash  = (frame->id ^ ((uint32_t)tail << 24)) * 2654435761u;
+  entry = &node->dedup[hash >> (32 - CANARD_NODE_DEDUP_BITS)];
+
+  if (entry->id == frame->id && entry->iface != ndx &&
+      entry->len == frame->data_len &&
+      now - entry->time < CONFIG_LIBCANARD_DEDUP_USEC &&
+      memcmp(entry->data, frame->data, frame->data_len) == 0)
+    {
+      return true;
+    }
+
+  entry->id    = frame->id;
+  entry->iface = ndx;
+  entry->len   = frame->data_len;
+  entry->time  = now;
+  memcpy(entry->data, frame->data, frame->data_len);
+  return false;
+}
+#endif
+
+/****************************************************************************
+ * Name: canard_node_receive
+ *
+ * Description:
+ *   Read every frame one interface holds, a batch per read(), and hand the
+ *   extended data frames that are not redundant copies to libcanard.
+ *
+ ****************************************************************************/
+
+static int canard_node_receive(FAR struct canard_node_s *node, int ndx)
+{
+  FAR struct canard_iface_s *iface = &node->iface[ndx];
+  struct can_msg_s msgs[CONFIG_CANUTILS_CANLIB_BATCH];
+  CanardCANFrame frame;
+  uint64_t timestamp;
+  int nmsgs;
+  int i;
+
+  for (; ; )
+    {
+      nmsgs = canlib_readmsgs(iface->fd, msgs, CONFIG_CANUTILS_CANLIB_BATCH);
+      if (nmsgs < 0)
+        {
+          if (errno == EAGAIN)
+            {
+              return OK;
+            }
+
+          iface->rxerrors++;
+          PERF_INC(g_perf_errors);
+          return ERROR;
+        }
+
+      if (nmsgs == 0)
+        {
+          return OK;
+        }
+
+      PERF_SAMPLE(g_perf_rxbatch, nmsgs);
+
+      /* One timestamp serves the whole batch; libcanard only uses it for
+       * transfer timeouts, which are far coarser than a batch.
+       */
+
+      timestamp = canard_node_now();
+
+      for (i = 0; i < nmsgs; i++)
+        {
+          FAR struct can_msg_s *msg = &msgs[i];
+
+#ifdef CONFIG_CAN_ERRORS
+          if (msg->cm_hdr.ch_error)
+            {
+              iface->rxerrors++;
+              PERF_INC(g_perf_errors);
+              continue;
+            }
+#endif
+
+          if (!msg->cm_hdr.ch_extid || msg->cm_hdr.ch_rtr)
+            {
+              continue;
+            }
+
+          frame.id       = msg->cm_hdr.ch_id | CANARD_CAN_FRAME_EFF;
+          frame.data_len = canlib_dlc2bytes(msg->cm_hdr.ch_dlc);
+          memcpy(frame.data, msg->cm_data, frame.data_len);
+
+#if CONFIG_LIBCANARD_NIFACES > 1
+          if (node->niface > 1 &&
+              canard_node_isdup(node, ndx, &frame, timestamp))
+            {
+              iface->rxdups++;
+              PERF_INC(g_perf_rxdups);
+              continue;
+            }
+#endif
+
+          canardHandleRxFrame(node->ins, &frame, timestamp);
+          iface->rxframes++;
+          PERF_INC(g_perf_rxframes);
+        }
+
+      node->rxseen = true;
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: canard_node_now
+ *
+ * Description:
+ *   Return the monotonic time in microseconds used for deadlines and RX
+ *   timestamps.
+ *
+ ****************************************************************************/
+
+uint64_t canard_node_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000ull + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * Name: canard_node_init
+ *
+ * Description:
+ *   Open one or more redundant CAN devices in non-blocking mode and bind
+ *   them to a libcanard instance.
+ *
+ ****************************************************************************/
+
+int canard_node_init(FAR struct canard_node_s *node,
+                     FAR CanardInstance *ins,
+                     FAR const char * const *devpaths, int ndevs)
+{
+  int errcode;
+  int i;
+
+  memset(node, 0, sizeof(*node));
+
+  PERF_REGISTER(g_perf_rxframes);
+  PERF_REGISTER(g_perf_rxdups);
+  PERF_REGISTER(g_perf_txframes);
+  PERF_REGISTER(g_perf_errors);
+  PERF_REGISTER(g_perf_rxbatch);
+
+  if (ndevs < 1 || ndevs > CONFIG_LIBCANARD_NIFACES)
+    {
+      errno = EINVAL;
+      return ERROR;
+    }
+
+  for (i = 0; i < ndevs; i++)
+    {
+      node->iface[i].fd = open(devpaths[i], O_RDWR | O_NONBLOCK);
+      if (node->iface[i].fd < 0)
+        {
+          errcode = errno;
+          canerr("ERROR: open %s failed: %d\n", devpaths[i], errcode);
+          canard_node_close(node);
+          errno = errcode;
+          return ERROR;
+        }
+
+      node->niface++;
+    }
+
+  node->ins     = ins;
+  node->cleanup = canard_node_now() + CONFIG_LIBCANARD_CLEANUP_USEC;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: canard_node_close
+ *
+ * Description:
+ *   Close the CAN devices of a node.  Frames still queued are discarded.
+ *
+ ****************************************************************************/
+
+void canard_node_close(FAR struct canard_node_s *node)
+{
+  int i;
+
+  for (i = 0; i < node->niface; i++)
+    {
+      close(node->iface[i].fd);
+      node->iface[i].fd    = -1;
+      node->iface[i].txlen = 0;
+    }
+
+  node->niface = 0;
+}
+
+/****************************************************************************
+ * Name: canard_node_flush
+ *
+ * Description:
+ *   Move as much of the libcanard TX queue as the drivers accept, one
+ *   batch per write() and interface.
+ *
+ ****************************************************************************/
+
+int canard_node_flush(FAR struct canard_node_s *node)
+{
+  FAR struct canard_iface_s *iface;
+  bool drained;
+  int pending;
+  int i;
+
+  do
+    {
+      canard_node_fill(node);
+
+      for (pending = 0, drained = false, i = 0; i < node->niface; i++)
+        {
+          iface = &node->iface[i];
+          if (iface->failed || iface->txlen == 0)
+            {
+              continue;
+            }
+
+          if (canard_node_write(iface))
+            {
+              drained = true;
+            }
+          else
+            {
+              pending |= 1 << i;
+            }
+        }
+    }
+  while (drained && canardPeekTxQueue(node->ins) != NULL);
+
+  if (!canard_node_alive(node))
+    {
+      errno = EIO;
+      return ERROR;
+    }
+
+  return pending;
+}
+
+/****************************************************************************
+ * Name: canard_node_spin
+ *
+ * Description:
+ *   Run the node until the given deadline, sleeping on all devices at once
+ *   between events instead of polling them.
+ *
+ ****************************************************************************/
+
+int canard_node_spin(FAR struct canard_node_s *node, uint64_t deadline)
+{
+  struct pollfd pfds[CONFIG_LIBCANARD_NIFACES];
+  FAR struct canard_iface_s *iface;
+  uint64_t now;
+  uint64_t wake;
+  int pending;
+  int ret;
+  int i;
+
+  for (; ; )
+    {
+      pending = canard_node_flush(node);
+      if (pending < 0)
+        {
+          return ERROR;
+        }
+
+      now = canard_node_now();
+      if (node->rxseen && now >= node->cleanup)
+        {
+          canardCleanupStaleTransfers(node->ins, now);
+          node->cleanup = now + CONFIG_LIBCANARD_CLEANUP_USEC;
+          node->rxseen  = false;
+        }
+
+      if (now >= deadline)
+        {
+          return OK;
+        }
+
+      /* Incomplete transfers only go stale, so the cleanup time is a
+       * wake-up reason only while some may be in progress.
+       */
+
+      wake = deadline;
+      if (node->rxseen && node->cleanup < wake)
+        {
+          wake = node->cleanup;
+        }
+
+      /* Failed interfaces get a negative descriptor, which poll() skips */
+
+      for (i = 0; i < node->niface; i++)
+        {
+          iface           = &node->iface[i];
+          pfds[i].fd      = iface->failed ? -1 : iface->fd;
+          pfds[i].events  = (pending & (1 << i)) != 0 ?
+                            POLLIN | POLLOUT : POLLIN;
+          pfds[i].revents = 0;
+        }
+
+      wake = (wake - now + 999) / 1000;
+      ret  = poll(pfds, node->niface,
+                  wake > INT32_MAX ? INT32_MAX : (int)wake);
+      if (ret < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          canerr("ERROR: poll failed: %d\n", errno);
+          return ERROR;
+        }
+
+      for (i = 0; i < node->niface && ret > 0; i++)
+        {
+          iface = &node->iface[i];
+          if (iface->failed)
+            {
+              continue;
+            }
+
+          if ((pfds[i].revents & (POLLERR | POLLHUP | POLLNVAL)) != 0)
+            {
+              canerr("ERROR: interface %d failed: %04x\n",
+                     i, pfds[i].revents);
+              iface->rxerrors++;
+              iface->failed = true;
+              continue;
+            }
+
+          if ((pfds[i].revents & POLLIN) != 0 &&
+              canard_node_receive(node, i) < 0)
+            {
+              canerr("ERROR: read on interface %d failed: %d\n", i, errno);
+              iface->failed = true;
+            }
+        }
+
+      if (!canard_node_alive(node))
+        {
+          errno = EIO;
+          return ERROR;
+        }
+    }
+}
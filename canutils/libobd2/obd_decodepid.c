@@ -39,13 +39,8 @@
 
 #include <nuttx/config.h>
 
-#include <sys/ioctl.h>
-
+#include <stdint.h>
 #include <stdio.h>
-#include <stdlib.h>
-#include <fcntl.h>
-#include <errno.h>
-#include <nuttx/can/can.h>
 
 #include "canutils/obd.h"
 #include "canutils/obd_pid.h"
@@ -79,8 +74,9 @@ static char g_data[MAXDATA];
 
 FAR char *obd_decode_pid(FAR struct obd_dev_s *dev, uint8_t pid)
 {
-  uint32_t pids;
-  int rpm;
+  FAR const struct obd_pidinfo_s *info;
+  int32_t value;
+  int ret;
 
   /* Verify if received data is valid */
 
@@ -90,46 +86,26 @@ FAR char *obd_decode_pid(FAR struct obd_dev_s *dev, uint8_t pid)
       return NULL;
     }
 
-  switch (dev->data[2])
+  ret = obd_decode_value(pid, &dev->data[3], sizeof(dev->data) - 3,
+                         &value);
+  if (ret < 0)
     {
-      case OBD_PID_SUPPORTED:
-        pids = (dev->data[3] << 24) | (dev->data[4] << 16) | \
-               (dev->data[5] << 8) | dev->data[6];
-        snprintf(g_data, MAXDATA, "%08X", pids);
-#ifdef CONFIG_DEBUG_INFO
-        printf("Supported PIDs: %08X\n");
-#endif
-        break;
-
-      case OBD_PID_ENGINE_TEMPERATURE:
-        snprintf(g_data, MAXDATA, "%d", dev->data[3] - 40);
-#ifdef CONFIG_DEBUG_INFO
-        printf("Engine Temperature = %d\n", dev->data[3] - 40);
-#endif
-        break;
-
-      case OBD_PID_RPM:
-        rpm = ((256 * dev->data[3]) + dev->data[4])/4;
-        snprintf(g_data, MAXDATA, "%d", rpm);
-#ifdef CONFIG_DEBUG_INFO
-        printf("RPM = %d\n", rpm);
-#endif
-        break;
+      return NULL;
+    }
 
-      case OBD_PID_SPEED:
-        snprintf(g_data, MAXDATA, "%d", dev->data[3]);
-#ifdef CONFIG_DEBUG_INFO
-        printf("SPEED = %d Km/h\n", dev->data[3]);
-#endif
-        break;
+  info = obd_pid_info(pid);
+  if ((info->flags & OBD_PIDF_RAW) != 0)
+    {
+      snprintf(g_data, MAXDATA, "%0*X", 2 * info->nbytes, value);
+    }
+  else
+    {
+      snprintf(g_data, MAXDATA, "%d", value / OBD_PID_SCALE);
+    }
 
-      case OBD_PID_THROTTLE_POSITION:
-        snprintf(g_data, MAXDATA, "%d", (100 * dev->data[3])/255);
 #ifdef CONFIG_DEBUG_INFO
-        printf("Throttle position = %d\% \n", (100 * dev->data[3])/255);
+  printf("PID %02x = %s %s\n", pid, g_data, info->unit);
 #endif
-        break;
-    }
 
   return g_data;
 }
@@ -0,0 +1,209 @@
+/****************************************************************************
+ * canutils/libobd2/obd_isotp.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <nuttx/can/can.h>
+
+#include "canutils/obd.h"
+#include "canutils/obd_pid.h"
+#include "canutils/obd_frame.h"
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: obd_send_flowctrl
+ *
+ * Description:
+ *   Answer a First Frame from an ECU with a Flow Control frame.  Block
+ *   size and separation time are zero: the ECU may send everything at
+ *   full speed.
+ *
+ ****************************************************************************/
+
+static int obd_send_flowctrl(FAR struct obd_dev_s *dev, uint8_t ecu,
+                             uint8_t status)
+{
+  struct can_msg_s msg;
+  int msgsize;
+
+  memset(&msg, 0, sizeof(msg));
+
+#ifdef CONFIG_CAN_EXTID
+  if (dev->can_mode == CAN_EXT)
+    {
+      msg.cm_hdr.ch_id    = OBD_PID_EXT_PHYS_REQUEST(ecu);
+      msg.cm_hdr.ch_extid = 1;
+    }
+  else
+#endif
+    {
+      msg.cm_hdr.ch_id = OBD_PID_STD_PHYS_REQUEST(ecu);
+    }
+
+  msg.cm_hdr.ch_dlc = 8;
+  msg.cm_data[0]    = OBD_FLWCTRL_FRAME | OBD_FC_FLOW_STATUS(status);
+
+  msgsize = CAN_MSGLEN(8);
+  if (write(dev->can_fd, &msg, msgsize) != msgsize)
+    {
+      return -EAGAIN;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: obd_isotp_receive
+ *
+ * Description:
+ *   Feed one received frame to an ISO-TP reassembly.  A flow control frame
+ *   is sent to the ECU when a multi-frame response starts.
+ *
+ *   It will return the length of the complete message in rx->buf, zero if
+ *   more frames are expected, or a negated errno value if the frame was
+ *   malformed or the message does not fit.
+ *
+ ****************************************************************************/
+
+int obd_isotp_receive(FAR struct obd_dev_s *dev, FAR struct obd_isotp_s *rx,
+                      FAR const struct can_msg_s *msg, uint8_t ecu)
+{
+  FAR const uint8_t *data = msg->cm_data;
+  int dlc = msg->cm_hdr.ch_dlc;
+  int len;
+  int ret;
+
+  if (dlc < 1 || dlc > 8)
+    {
+      return -EBADMSG;
+    }
+
+  switch (OBD_FRAME_TYPE(data[0]))
+    {
+      case OBD_SINGLE_FRAME:
+        len = OBD_SF_DATA_LEN(data[0]);
+        if (len == 0 || len > dlc - 1 || len > rx->size)
+          {
+            return -EBADMSG;
+          }
+
+        memcpy(rx->buf, &data[1], len);
+        rx->active = false;
+        rx->len    = len;
+        return len;
+
+      case OBD_FIRST_FRAME:
+        if (dlc < 8)
+          {
+            return -EBADMSG;
+          }
+
+        len = OBD_FF_DATA_LEN_D0(data[0]) | OBD_FF_DATA_LEN_D1(data[1]);
+        if (len < 8)
+          {
+            return -EBADMSG;
+          }
+
+        if (len > rx->size)
+          {
+            obd_send_flowctrl(dev, ecu, OBD_FC_OVERFLOW);
+            rx->active = false;
+            return -E2BIG;
+          }
+
+        memcpy(rx->buf, &data[2], 6);
+        rx->len      = 6;
+        rx->expected = len;
+        rx->seq      = 1;
+        rx->active   = true;
+
+        ret = obd_send_flowctrl(dev, ecu, OBD_FC_CTS);
+        if (ret < 0)
+          {
+            rx->active = false;
+            return ret;
+          }
+
+        return 0;
+
+      case OBD_CONSEC_FRAME:
+        if (!rx->active)
+          {
+            return 0;
+          }
+
+        if (OBD_CF_SEQ_NUM(data[0]) != rx->seq)
+          {
+            rx->active = false;
+            return -EPROTO;
+          }
+
+        len = rx->expected - rx->len;
+        if (len > dlc - 1)
+          {
+            len = dlc - 1;
+          }
+
+        memcpy(&rx->buf[rx->len], &data[1], len);
+        rx->len += len;
+        rx->seq  = (rx->seq + 1) & 0x0f;
+
+        if (rx->len < rx->expected)
+          {
+            return 0;
+          }
+
+        rx->active = false;
+        return rx->len;
+
+      default:
+        return 0;
+    }
+}
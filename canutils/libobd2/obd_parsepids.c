@@ -0,0 +1,94 @@
+/****************************************************************************
+ * canutils/libobd2/obd_parsepids.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <errno.h>
+
+#include "canutils/obd.h"
+#include "canutils/obd_pid.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: obd_parse_pids
+ *
+ * Description:
+ *   Split a reassembled mode 01 response to a multi-PID request and call
+ *   cb once per PID.
+ *
+ *   It will return the number of PIDs found or a negated errno value if
+ *   the message is not a positive response to opmode.
+ *
+ ****************************************************************************/
+
+int obd_parse_pids(FAR const uint8_t *msg, int len, uint8_t opmode,
+                   uint8_t ecu, obd_pid_cb_t cb, FAR void *arg)
+{
+  int npids = 0;
+  int datalen;
+  int i;
+
+  if (len < 2 || msg[0] != opmode + OBD_RESP_BASE)
+    {
+      return len > 0 && msg[0] == OBD_NEGATIVE_RESPONSE ? -EACCES : -EBADMSG;
+    }
+
+  /* The response repeats each PID followed by its value bytes.  A PID
+   * whose length is not known ends the walk, as nothing after it can be
+   * located.
+   */
+
+  for (i = 1; i < len; i += 1 + datalen)
+    {
+      datalen = obd_pid_datalen(msg[i]);
+      if (datalen == 0 || i + 1 + datalen > len)
+        {
+          break;
+        }
+
+      cb(arg, ecu, msg[i], &msg[i + 1], datalen);
+      npids++;
+    }
+
+  return npids;
+}
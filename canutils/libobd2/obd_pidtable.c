@@ -0,0 +1,250 @@
+/****************************************************************************
+ * canutils/libobd2/obd_pidtable.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <errno.h>
+
+#include "canutils/obd.h"
+#include "canutils/obd_pid.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* A bit-encoded or enumerated PID, returned as is */
+
+#define OBD_PID_RAW(n) { n, n, OBD_PIDF_RAW, 1, 1, 0, "" }
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Mode 01 PIDs 0x00-0x60 (SAE J1979), indexed by PID.  Each row is the
+ * response length, the leading bytes that hold the value, flags, and
+ * mul/div/offset that turn those bytes into OBD_PID_SCALE fixed point.
+ * For PIDs that report two quantities only the first is decoded.
+ */
+
+static const struct obd_pidinfo_s g_pidinfo[0x61] =
+{
+  OBD_PID_RAW(4),                                              /* 0x00 */
+  OBD_PID_RAW(4),                                              /* 0x01 */
+  OBD_PID_RAW(2),                                              /* 0x02 */
+  OBD_PID_RAW(2),                                              /* 0x03 */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x04 */
+  { 1, 1, 0, 1000, 1, -40000, "degC" },                        /* 0x05 */
+  { 1, 1, 0, 100000, 128, -100000, "%" },                      /* 0x06 */
+  { 1, 1, 0, 100000, 128, -100000, "%" },                      /* 0x07 */
+  { 1, 1, 0, 100000, 128, -100000, "%" },                      /* 0x08 */
+  { 1, 1, 0, 100000, 128, -100000, "%" },                      /* 0x09 */
+  { 1, 1, 0, 3000, 1, 0, "kPa" },                              /* 0x0a */
+  { 1, 1, 0, 1000, 1, 0, "kPa" },                              /* 0x0b */
+  { 2, 2, 0, 250, 1, 0, "rpm" },                               /* 0x0c */
+  { 1, 1, 0, 1000, 1, 0, "km/h" },                             /* 0x0d */
+  { 1, 1, 0, 500, 1, -64000, "deg" },                          /* 0x0e */
+  { 1, 1, 0, 1000, 1, -40000, "degC" },                        /* 0x0f */
+  { 2, 2, 0, 10, 1, 0, "g/s" },                                /* 0x10 */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x11 */
+  OBD_PID_RAW(1),                                              /* 0x12 */
+  OBD_PID_RAW(1),                                              /* 0x13 */
+  { 2, 1, 0, 5, 1, 0, "V" },                                   /* 0x14 */
+  { 2, 1, 0, 5, 1, 0, "V" },                                   /* 0x15 */
+  { 2, 1, 0, 5, 1, 0, "V" },                                   /* 0x16 */
+  { 2, 1, 0, 5, 1, 0, "V" },                                   /* 0x17 */
+  { 2, 1, 0, 5, 1, 0, "V" },                                   /* 0x18 */
+  { 2, 1, 0, 5, 1, 0, "V" },                                   /* 0x19 */
+  { 2, 1, 0, 5, 1, 0, "V" },                                   /* 0x1a */
+  { 2, 1, 0, 5, 1, 0, "V" },                                   /* 0x1b */
+  OBD_PID_RAW(1),                                              /* 0x1c */
+  OBD_PID_RAW(1),                                              /* 0x1d */
+  OBD_PID_RAW(1),                                              /* 0x1e */
+  { 2, 2, 0, 1000, 1, 0, "s" },                                /* 0x1f */
+  OBD_PID_RAW(4),                                              /* 0x20 */
+  { 2, 2, 0, 1000, 1, 0, "km" },                               /* 0x21 */
+  { 2, 2, 0, 79, 1, 0, "kPa" },                                /* 0x22 */
+  { 2, 2, 0, 10000, 1, 0, "kPa" },                             /* 0x23 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x24 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x25 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x26 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x27 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x28 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x29 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x2a */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x2b */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x2c */
+  { 1, 1, 0, 100000, 128, -100000, "%" },                      /* 0x2d */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x2e */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x2f */
+  { 1, 1, 0, 1000, 1, 0, "" },                                 /* 0x30 */
+  { 2, 2, 0, 1000, 1, 0, "km" },                               /* 0x31 */
+  { 2, 2, OBD_PIDF_SIGNED, 250, 1, 0, "Pa" },                  /* 0x32 */
+  { 1, 1, 0, 1000, 1, 0, "kPa" },                              /* 0x33 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x34 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x35 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x36 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x37 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x38 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x39 */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x3a */
+  { 4, 2, 0, 2000, 65536, 0, "" },                             /* 0x3b */
+  { 2, 2, 0, 100, 1, -40000, "degC" },                         /* 0x3c */
+  { 2, 2, 0, 100, 1, -40000, "degC" },                         /* 0x3d */
+  { 2, 2, 0, 100, 1, -40000, "degC" },                         /* 0x3e */
+  { 2, 2, 0, 100, 1, -40000, "degC" },                         /* 0x3f */
+  OBD_PID_RAW(4),                                              /* 0x40 */
+  OBD_PID_RAW(4),                                              /* 0x41 */
+  { 2, 2, 0, 1, 1, 0, "V" },                                   /* 0x42 */
+  { 2, 2, 0, 100000, 255, 0, "%" },                            /* 0x43 */
+  { 2, 2, 0, 2000, 65536, 0, "" },                             /* 0x44 */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x45 */
+  { 1, 1, 0, 1000, 1, -40000, "degC" },                        /* 0x46 */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x47 */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x48 */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x49 */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x4a */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x4b */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x4c */
+  { 2, 2, 0, 1000, 1, 0, "min" },                              /* 0x4d */
+  { 2, 2, 0, 1000, 1, 0, "min" },                              /* 0x4e */
+  OBD_PID_RAW(4),                                              /* 0x4f */
+  OBD_PID_RAW(4),                                              /* 0x50 */
+  OBD_PID_RAW(1),                                              /* 0x51 */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x52 */
+  { 2, 2, 0, 5, 1, 0, "kPa" },                                 /* 0x53 */
+  { 2, 2, OBD_PIDF_SIGNED, 1000, 1, 0, "Pa" },                 /* 0x54 */
+  { 2, 1, 0, 100000, 128, -100000, "%" },                      /* 0x55 */
+  { 2, 1, 0, 100000, 128, -100000, "%" },                      /* 0x56 */
+  { 2, 1, 0, 100000, 128, -100000, "%" },                      /* 0x57 */
+  { 2, 1, 0, 100000, 128, -100000, "%" },                      /* 0x58 */
+  { 2, 2, 0, 10000, 1, 0, "kPa" },                             /* 0x59 */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x5a */
+  { 1, 1, 0, 100000, 255, 0, "%" },                            /* 0x5b */
+  { 1, 1, 0, 1000, 1, -40000, "degC" },                        /* 0x5c */
+  { 2, 2, 0, 1000, 128, -210000, "deg" },                      /* 0x5d */
+  { 2, 2, 0, 50, 1, 0, "L/h" },                                /* 0x5e */
+  OBD_PID_RAW(1),                                              /* 0x5f */
+  OBD_PID_RAW(4),                                              /* 0x60 */
+};
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: obd_pid_info
+ *
+ * Description:
+ *   Return the description of a mode 01 PID, or NULL if unknown.
+ *
+ ****************************************************************************/
+
+FAR const struct obd_pidinfo_s *obd_pid_info(uint8_t pid)
+{
+  return pid < sizeof(g_pidinfo) / sizeof(g_pidinfo[0]) ?
+         &g_pidinfo[pid] : NULL;
+}
+
+/****************************************************************************
+ * Name: obd_pid_datalen
+ *
+ * Description:
+ *   Return the number of value bytes of a mode 01 PID, or zero if unknown.
+ *
+ ****************************************************************************/
+
+int obd_pid_datalen(uint8_t pid)
+{
+  FAR const struct obd_pidinfo_s *info = obd_pid_info(pid);
+
+  return info != NULL ? info->len : 0;
+}
+
+/****************************************************************************
+ * Name: obd_decode_value
+ *
+ * Description:
+ *   Decode the value bytes of a mode 01 PID without any formatting.
+ *
+ *   It will return OK with the value in OBD_PID_SCALE fixed point (or the
+ *   raw bytes for OBD_PIDF_RAW PIDs), -ENOENT if the PID is unknown, or
+ *   -EINVAL if len is too short.
+ *
+ ****************************************************************************/
+
+int obd_decode_value(uint8_t pid, FAR const uint8_t *data, int len,
+                     FAR int32_t *value)
+{
+  FAR const struct obd_pidinfo_s *info = obd_pid_info(pid);
+  int32_t raw;
+  int i;
+
+  if (info == NULL)
+    {
+      return -ENOENT;
+    }
+
+  if (len < info->nbytes)
+    {
+      return -EINVAL;
+    }
+
+  for (raw = 0, i = 0; i < info->nbytes; i++)
+    {
+      raw = (raw << 8) | data[i];
+    }
+
+  if ((info->flags & OBD_PIDF_RAW) != 0)
+    {
+      *value = raw;
+      return OK;
+    }
+
+  if ((info->flags & OBD_PIDF_SIGNED) != 0 && info->nbytes < 4)
+    {
+      raw = (int32_t)((uint32_t)raw << (32 - 8 * info->nbytes)) >>
+            (32 - 8 * info->nbytes);
+    }
+
+  /* 16 value bits times a 17-bit multiplier needs a 64-bit product */
+
+  *value = (int32_t)((int64_t)raw * info->mul / info->div) + info->offset;
+  return OK;
+}
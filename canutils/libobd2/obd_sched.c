@@ -0,0 +1,364 @@
+/****************************************************************************
+ * canutils/libobd2/obd_sched.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
+#include <nuttx/can/can.h>
+
+#include "canutils/canlib.h"
+#include "canutils/obd.h"
+#include "canutils/obd_pid.h"
+#include "canutils/obd_frame.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define OBD_CLOCK CLOCK_MONOTONIC
+#else
+#  define OBD_CLOCK CLOCK_REALTIME
+#endif
+
+/* Wrap-safe comparison of millisecond times */
+
+#define OBD_BEFORE(a, b) ((int32_t)((a) - (b)) < 0)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: obd_msec
+ ****************************************************************************/
+
+static uint32_t obd_msec(void)
+{
+  struct timespec ts;
+
+  clock_gettime(OBD_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/****************************************************************************
+ * Name: obd_response_ecu
+ *
+ * Description:
+ *   Return the number of the ECU that sent a message, or -1 if it is not
+ *   a physically addressed response.
+ *
+ ****************************************************************************/
+
+static int obd_response_ecu(FAR struct obd_dev_s *dev,
+                            FAR const struct can_msg_s *msg)
+{
+  uint32_t id = msg->cm_hdr.ch_id;
+
+#ifdef CONFIG_CAN_EXTID
+  if (dev->can_mode == CAN_EXT)
+    {
+      if (msg->cm_hdr.ch_extid &&
+          id >= OBD_PID_EXT_PHYS_RESPONSE(0) &&
+          id < OBD_PID_EXT_PHYS_RESPONSE(OBD_NECUS))
+        {
+          return id - OBD_PID_EXT_PHYS_RESPONSE(0);
+        }
+
+      return -1;
+    }
+
+  if (msg->cm_hdr.ch_extid)
+    {
+      return -1;
+    }
+#endif
+
+  if (id >= OBD_PID_STD_PHYS_RESPONSE(0) &&
+      id < OBD_PID_STD_PHYS_RESPONSE(OBD_NECUS))
+    {
+      return id - OBD_PID_STD_PHYS_RESPONSE(0);
+    }
+
+  return -1;
+}
+
+/****************************************************************************
+ * Name: obd_sched_start
+ *
+ * Description:
+ *   Time out the ECUs that did not answer and send the due jobs of the
+ *   idle ones.  Returns the time of the next event.
+ *
+ ****************************************************************************/
+
+static uint32_t obd_sched_start(FAR struct obd_sched_s *sched, uint32_t now,
+                                uint32_t wake)
+{
+  FAR struct obd_ecu_s *ecu;
+  FAR struct obd_job_s *job;
+  int ndx;
+  int i;
+
+  for (i = 0; i < OBD_NECUS; i++)
+    {
+      ecu = &sched->ecu[i];
+      if (ecu->job >= 0 && !OBD_BEFORE(now, ecu->deadline))
+        {
+          sched->timeouts++;
+          ecu->job       = -1;
+          ecu->rx.active = false;
+        }
+    }
+
+  /* Round-robin over the jobs so that one ECU with many due jobs does not
+   * starve the others of their turn.
+   */
+
+  for (i = 0; i < sched->njobs; i++)
+    {
+      ndx = (sched->next + i) % sched->njobs;
+      job = &sched->jobs[ndx];
+      ecu = &sched->ecu[job->ecu];
+
+      if (ecu->job < 0 && !OBD_BEFORE(now, job->due))
+        {
+          if (obd_send_pids(sched->dev, job->ecu, job->opmode, job->pids,
+                            job->npids) < 0)
+            {
+              sched->errors++;
+            }
+          else
+            {
+              ecu->job      = ndx;
+              ecu->deadline = now + CONFIG_LIBOBD2_TIMEOUT;
+            }
+
+          /* Keep the cadence, but do not try to catch up on missed
+           * samples after a stall.
+           */
+
+          job->due += job->period;
+          if (OBD_BEFORE(job->due, now))
+            {
+              job->due = now + job->period;
+            }
+
+          sched->next = (ndx + 1) % sched->njobs;
+        }
+
+      if (ecu->job >= 0)
+        {
+          if (OBD_BEFORE(ecu->deadline, wake))
+            {
+              wake = ecu->deadline;
+            }
+        }
+      else if (OBD_BEFORE(job->due, wake))
+        {
+          wake = job->due;
+        }
+    }
+
+  return wake;
+}
+
+/****************************************************************************
+ * Name: obd_sched_input
+ *
+ * Description:
+ *   Handle one received frame.
+ *
+ ****************************************************************************/
+
+static void obd_sched_input(FAR struct obd_sched_s *sched,
+                            FAR const struct can_msg_s *msg)
+{
+  FAR struct obd_ecu_s *ecu;
+  FAR struct obd_job_s *job;
+  int ndx;
+  int ret;
+
+  ndx = obd_response_ecu(sched->dev, msg);
+  if (ndx < 0 || sched->ecu[ndx].job < 0)
+    {
+      return;
+    }
+
+  ecu = &sched->ecu[ndx];
+  ret = obd_isotp_receive(sched->dev, &ecu->rx, msg, ndx);
+  if (ret == 0)
+    {
+      return;
+    }
+
+  job      = &sched->jobs[ecu->job];
+  ecu->job = -1;
+
+  if (ret < 0)
+    {
+      sched->errors++;
+      return;
+    }
+
+  ret = obd_parse_pids(ecu->buf, ret, job->opmode, ndx, sched->cb,
+                       sched->arg);
+  if (ret == -EACCES)
+    {
+      sched->negatives++;
+    }
+  else if (ret < 0)
+    {
+      sched->errors++;
+    }
+  else
+    {
+      sched->responses++;
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: obd_sched_init
+ *
+ * Description:
+ *   Prepare a scheduler for an array of jobs.  All jobs are due at once.
+ *
+ ****************************************************************************/
+
+void obd_sched_init(FAR struct obd_sched_s *sched, FAR struct obd_dev_s *dev,
+                    FAR struct obd_job_s *jobs, int njobs, obd_pid_cb_t cb,
+                    FAR void *arg)
+{
+  uint32_t now = obd_msec();
+  int i;
+
+  memset(sched, 0, sizeof(*sched));
+  sched->dev   = dev;
+  sched->jobs  = jobs;
+  sched->njobs = njobs;
+  sched->cb    = cb;
+  sched->arg   = arg;
+
+  for (i = 0; i < OBD_NECUS; i++)
+    {
+      sched->ecu[i].job     = -1;
+      sched->ecu[i].rx.buf  = sched->ecu[i].buf;
+      sched->ecu[i].rx.size = CONFIG_LIBOBD2_MAXPAYLOAD;
+    }
+
+  for (i = 0; i < njobs; i++)
+    {
+      jobs[i].due = now;
+    }
+}
+
+/****************************************************************************
+ * Name: obd_sched_run
+ *
+ * Description:
+ *   Run the jobs for msec milliseconds.
+ *
+ ****************************************************************************/
+
+int obd_sched_run(FAR struct obd_sched_s *sched, int msec)
+{
+  struct can_msg_s msgs[CONFIG_CANUTILS_CANLIB_BATCH];
+  struct pollfd pfd;
+  uint32_t end;
+  uint32_t now;
+  uint32_t wake;
+  int nmsgs;
+  int ret;
+  int i;
+
+  now = obd_msec();
+  end = now + msec;
+
+  for (; ; )
+    {
+      wake = obd_sched_start(sched, now, end);
+      if (!OBD_BEFORE(now, end))
+        {
+          return OK;
+        }
+
+      pfd.fd      = sched->dev->can_fd;
+      pfd.events  = POLLIN;
+      pfd.revents = 0;
+
+      ret = poll(&pfd, 1, OBD_BEFORE(now, wake) ? (int)(wake - now) : 0);
+      if (ret < 0)
+        {
+          if (errno == EINTR)
+            {
+              now = obd_msec();
+              continue;
+            }
+
+          return -errno;
+        }
+
+      if ((pfd.revents & POLLIN) != 0)
+        {
+          /* Take every frame the driver has with one read() */
+
+          nmsgs = canlib_readmsgs(sched->dev->can_fd, msgs,
+                                  CONFIG_CANUTILS_CANLIB_BATCH);
+          if (nmsgs < 0)
+            {
+              return -errno;
+            }
+
+          for (i = 0; i < nmsgs; i++)
+            {
+              obd_sched_input(sched, &msgs[i]);
+            }
+        }
+
+      now = obd_msec();
+    }
+}
@@ -56,26 +56,35 @@
  ****************************************************************************/
 
 /****************************************************************************
- * Name: obd_sent_request
+ * Name: obd_send_pids
  *
  * Description:
- *   Send a "Request Message" to ECUs with requested PID.
+ *   Send one "Request Message" carrying up to OBD_MAX_PIDS PIDs, either
+ *   physically addressed to ECU 0-7 or, with ecu OBD_NECUS, to all ECUs.
  *
  *   It will return an error case the message fails to be sent.
  *
  ****************************************************************************/
 
-int obd_send_request(FAR struct obd_dev_s *dev, uint8_t opmode, uint8_t pid)
+int obd_send_pids(FAR struct obd_dev_s *dev, uint8_t ecu, uint8_t opmode,
+                  FAR const uint8_t *pids, int npids)
 {
   int nbytes;
   int msgdlc;
   int msgsize;
+  int i;
   uint8_t extended;
 
 #ifdef CONFIG_DEBUG_INFO
-  printf("Going SendRequest opmode=%d pid=%d\n", opmode, pid);
+  printf("Going SendRequest opmode=%d pid=%d npids=%d\n",
+         opmode, pids[0], npids);
 #endif
 
+  if (npids < 1 || npids > OBD_MAX_PIDS || ecu > OBD_NECUS)
+    {
+      return -EINVAL;
+    }
+
   /* Verify what is the current mode */
 
   if (dev->can_mode == CAN_EXT)
@@ -95,13 +104,19 @@ int obd_send_request(FAR struct obd_dev_s *dev, uint8_t opmode, uint8_t pid)
 
   if (extended)
     {
-      dev->can_txmsg.cm_hdr.ch_id     = OBD_PID_STD_REQUEST; /* MSG ID for PID Request */
+#ifdef CONFIG_CAN_EXTID
+      dev->can_txmsg.cm_hdr.ch_id = ecu < OBD_NECUS ?
+                                    OBD_PID_EXT_PHYS_REQUEST(ecu) :
+                                    OBD_PID_EXT_REQUEST;
+#else
+      return -ENOSYS;
+#endif
     }
   else
     {
-#ifdef CONFIG_CAN_EXTID
-      dev->can_txmsg.cm_hdr.ch_id     = OBD_PID_EXT_REQUEST; /* MSG ID for PID Request */
-#endif
+      dev->can_txmsg.cm_hdr.ch_id = ecu < OBD_NECUS ?
+                                    OBD_PID_STD_PHYS_REQUEST(ecu) :
+                                    OBD_PID_STD_REQUEST;
     }
 
   dev->can_txmsg.cm_hdr.ch_rtr    = false;               /* Not a Remote Frame     */
@@ -111,25 +126,15 @@ int obd_send_request(FAR struct obd_dev_s *dev, uint8_t opmode, uint8_t pid)
 #endif
   dev->can_txmsg.cm_hdr.ch_unused = 0;                   /* Unused                 */
 
-  /* Single Frame with two bytes data */
-
-  dev->can_txmsg.cm_data[0] = OBD_SINGLE_FRAME | OBD_SF_DATA_LEN(2);
-
-  /* Setup the Operation Mode */
+  /* Single Frame with the mode and the PIDs, then padding */
 
+  dev->can_txmsg.cm_data[0] = OBD_SINGLE_FRAME | OBD_SF_DATA_LEN(1 + npids);
   dev->can_txmsg.cm_data[1] = opmode;
 
-  /* Setup the PID we are requesting */
-
-  dev->can_txmsg.cm_data[2] = pid;
-
-  /* Padding */
-
-  dev->can_txmsg.cm_data[3] = 0;
-  dev->can_txmsg.cm_data[4] = 0;
-  dev->can_txmsg.cm_data[5] = 0;
-  dev->can_txmsg.cm_data[6] = 0;
-  dev->can_txmsg.cm_data[7] = 0;
+  for (i = 0; i < 6; i++)
+    {
+      dev->can_txmsg.cm_data[2 + i] = i < npids ? pids[i] : 0;
+    }
 
   /* Send the TX message */
 
@@ -149,3 +154,18 @@ int obd_send_request(FAR struct obd_dev_s *dev, uint8_t opmode, uint8_t pid)
 
   return OK;
 }
+
+/****************************************************************************
+ * Name: obd_sent_request
+ *
+ * Description:
+ *   Send a "Request Message" to ECUs with requested PID.
+ *
+ *   It will return an error case the message fails to be sent.
+ *
+ ****************************************************************************/
+
+int obd_send_request(FAR struct obd_dev_s *dev, uint8_t opmode, uint8_t pid)
+{
+  return obd_send_pids(dev, OBD_NECUS, opmode, &pid, 1);
+}
@@ -97,6 +97,25 @@ uavcan::ICanDriver &getCanDriver(void)
   return can.driver;
 }
 
+uavcan::uint64_t getCanErrorCount(void)
+{
+  uavcan::ICanDriver &driver = getCanDriver();
+  uavcan::uint64_t count = 0;
+
+  /* The STM32 driver includes RX queue overflows in the error count */
+
+  for (uavcan::uint8_t i = 0; i < driver.getNumIfaces(); i++)
+    {
+      uavcan::ICanIface *iface = driver.getIface(i);
+      if (iface != NULL)
+        {
+          count += iface->getErrorCount();
+        }
+    }
+
+  return count;
+}
+
 uavcan::ISystemClock &getSystemClock(void)
 {
   return uavcan_stm32::SystemClock::instance();
@@ -42,6 +42,9 @@
 
 #include <nuttx/config.h>
 
+#include <stdint.h>
+#include <stdbool.h>
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -56,6 +59,10 @@
  *   indefinitely.
  * CONFIG_EXAMPLES_ADC_GROUPSIZE - The number of samples to read at once.
  *   Default: 4
+ * CONFIG_EXAMPLES_ADC_STREAM - Enable the continuous streaming mode (-S)
+ * CONFIG_EXAMPLES_ADC_STREAM_BLOCKSIZE - Default number of samples in each
+ *   of the two stream buffers.  Default: 512
+ * CONFIG_EXAMPLES_ADC_STREAM_FFT - Enable the FFT stage (-F)
  */
 
 #ifndef CONFIG_ADC
@@ -70,6 +77,22 @@
 #  define CONFIG_EXAMPLES_ADC_GROUPSIZE 4
 #endif
 
+#ifndef CONFIG_EXAMPLES_ADC_STREAM_BLOCKSIZE
+#  define CONFIG_EXAMPLES_ADC_STREAM_BLOCKSIZE 512
+#endif
+
+/* Stream format.  A stream starts with struct adc_stream_hdr_s.  Sample
+ * streams continue with records of 'recsize' bytes, each a struct
+ * adc_msg_s as returned by the driver.  Spectrum streams continue with
+ * frames of a uint32_t channel number followed by fftsize / 2 float power
+ * values, bin 0 (DC, always removed) first.  All values are in the byte
+ * order of the target.
+ */
+
+#define ADC_STREAM_MAXCHAN  16    /* Channels in one scan */
+#define ADC_STREAM_SAMPLES  0     /* Header type: samples */
+#define ADC_STREAM_SPECTRA  1     /* Header type: power spectra */
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -81,6 +104,24 @@ struct adc_state_s
 #if defined(CONFIG_NSH_BUILTIN_APPS) || defined(CONFIG_EXAMPLES_ADC_NSAMPLES)
   int       count;
 #endif
+#ifdef CONFIG_EXAMPLES_ADC_STREAM
+  FAR char *stream;               /* Output file or <ipaddr>:<port>, or NULL */
+  int       blocksize;            /* Samples in each stream buffer */
+  int       decimate;             /* Decimation factor, 1 for none */
+  int       fftsize;              /* FFT points, 0 for none */
+#endif
+};
+
+struct adc_stream_hdr_s
+{
+  uint8_t   magic[4];             /* "ADCS" */
+  uint8_t   type;                 /* ADC_STREAM_SAMPLES or _SPECTRA */
+  uint8_t   recsize;              /* Size of one sample record */
+  uint8_t   nchan;                /* Number of entries in channel[] */
+  uint8_t   reserved;
+  uint16_t  decimate;             /* Decimation factor, 1 if none */
+  uint16_t  fftsize;              /* FFT points, 0 for samples */
+  uint8_t   channel[ADC_STREAM_MAXCHAN]; /* Channels in scan order */
 };
 
 /****************************************************************************
@@ -91,4 +132,17 @@ struct adc_state_s
  * Public Function Prototypes
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: adc_stream
+ *
+ * Description:
+ *   Stream blocks of samples from the open ADC device to adc->stream until
+ *   adc->count blocks have been read (forever if zero) or an error occurs.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_ADC_STREAM
+int adc_stream(FAR struct adc_state_s *adc, int fd);
+#endif
+
 #endif /* __APPS_EXAMPLES_ADC_ADC_H */
@@ -123,6 +123,21 @@ static void adc_help(FAR struct adc_state_s *adc)
          CONFIG_EXAMPLES_ADC_DEVPATH, g_adcstate.devpath ? g_adcstate.devpath : "NONE");
   printf("  [-n count] selects the samples to collect.  "
          "Default: 1 Current: %d\n", adc->count);
+#ifdef CONFIG_EXAMPLES_ADC_STREAM
+  printf("  [-b samples] selects the stream block size.  "
+         "Default: %d Current: %d\n",
+         CONFIG_EXAMPLES_ADC_STREAM_BLOCKSIZE, adc->blocksize);
+  printf("  [-d factor] averages each channel over factor samples "
+         "before storage.  Default: 1 Current: %d\n", adc->decimate);
+#ifdef CONFIG_EXAMPLES_ADC_STREAM_FFT
+  printf("  [-F points] stores power spectra of points samples "
+         "instead of samples, 0 for none.  Current: %d\n", adc->fftsize);
+#endif
+  printf("\nOther OPTIONS include:\n");
+  printf("  [-S path|ipaddr:port] streams binary sample blocks to a file "
+         "or a TCP\n    connection instead of printing them.  -n then "
+         "gives the number of\n    blocks, 0 to stream until an error.\n");
+#endif
   printf("  [-h] shows this message and exits\n");
 }
 #endif
@@ -207,6 +222,34 @@ static void parse_args(FAR struct adc_state_s *adc, int argc, FAR char **argv)
             index += nargs;
             break;
 
+#ifdef CONFIG_EXAMPLES_ADC_STREAM
+          case 'S':
+            nargs = arg_string(&argv[index], &str);
+            adc->stream = str;
+            index += nargs;
+            break;
+
+          case 'b':
+            nargs = arg_decimal(&argv[index], &value);
+            adc->blocksize = (int)value;
+            index += nargs;
+            break;
+
+          case 'd':
+            nargs = arg_decimal(&argv[index], &value);
+            adc->decimate = (int)value;
+            index += nargs;
+            break;
+
+#ifdef CONFIG_EXAMPLES_ADC_STREAM_FFT
+          case 'F':
+            nargs = arg_decimal(&argv[index], &value);
+            adc->fftsize = (int)value;
+            index += nargs;
+            break;
+#endif
+#endif
+
           case 'h':
             adc_help(adc);
             exit(0);
@@ -256,9 +299,20 @@ int adc_main(int argc, char *argv[])
 
       adc_devpath(&g_adcstate, CONFIG_EXAMPLES_ADC_DEVPATH);
 
+#ifdef CONFIG_EXAMPLES_ADC_STREAM
+      g_adcstate.blocksize = CONFIG_EXAMPLES_ADC_STREAM_BLOCKSIZE;
+      g_adcstate.decimate  = 1;
+#endif
+
       g_adcstate.initialized = true;
     }
 
+#ifdef CONFIG_EXAMPLES_ADC_STREAM
+  /* The stream output is not sticky */
+
+  g_adcstate.stream = NULL;
+#endif
+
 #if CONFIG_EXAMPLES_ADC_NSAMPLES > 0
   g_adcstate.count = CONFIG_EXAMPLES_ADC_NSAMPLES;
 #else
@@ -292,6 +346,15 @@ int adc_main(int argc, char *argv[])
       goto errout;
     }
 
+#ifdef CONFIG_EXAMPLES_ADC_STREAM
+  if (g_adcstate.stream != NULL)
+    {
+      errval = adc_stream(&g_adcstate, fd);
+      close(fd);
+      return errval;
+    }
+#endif
+
   /* Now loop the appropriate number of times, displaying the collected
    * ADC samples.
    */
@@ -0,0 +1,791 @@
+/****************************************************************************
+ * apps/examples/adc/adc_stream.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/ioctl.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <time.h>
+#include <errno.h>
+
+#ifdef CONFIG_NET_TCP
+#  include <sys/socket.h>
+#  include <netinet/in.h>
+#  include <arpa/inet.h>
+#endif
+
+#include <nuttx/analog/adc.h>
+#include <nuttx/analog/ioctl.h>
+
+#include "adc.h"
+
+#ifdef CONFIG_EXAMPLES_ADC_STREAM
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_ADC_STREAM_PRIORITY
+#  define CONFIG_EXAMPLES_ADC_STREAM_PRIORITY 100
+#endif
+
+#ifndef CONFIG_EXAMPLES_ADC_STREAM_STACKSIZE
+#  define CONFIG_EXAMPLES_ADC_STREAM_STACKSIZE 2048
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define ADC_STREAM_CLOCK CLOCK_MONOTONIC
+#else
+#  define ADC_STREAM_CLOCK CLOCK_REALTIME
+#endif
+
+#define NOPOS 0xff                /* Channel not part of the scan */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct adc_stream_s
+{
+  FAR struct adc_state_s *adc;
+  int outfd;                         /* Output file or socket */
+  int werrno;                        /* First output error, 0 if none */
+  sem_t full;                        /* Posted when a buffer is filled */
+  sem_t free;                        /* Posted when a buffer is written */
+  FAR struct adc_msg_s *buf[2];      /* The two stream buffers */
+  size_t nsamples[2];                /* Samples in each, 0 ends the stream */
+
+  /* Scan sequence, learned from the first samples */
+
+  bool learned;                      /* The scan order is known */
+  uint8_t nchan;
+  uint8_t expect;                    /* Scan position of the next sample */
+  uint8_t order[ADC_STREAM_MAXCHAN]; /* Channel at each scan position */
+  uint8_t pos[256];                  /* Scan position of each channel */
+
+  /* Decimation and FFT stages */
+
+  FAR int64_t *sum;                  /* Per-channel decimation sums */
+  FAR uint16_t *cnt;                 /* Per-channel decimation counts */
+#ifdef CONFIG_EXAMPLES_ADC_STREAM_FFT
+  FAR float *fftin;                  /* Per-channel FFT input samples */
+  FAR uint16_t *fftcnt;              /* Per-channel FFT input counts */
+  FAR float *re;                     /* FFT work buffers */
+  FAR float *im;
+#endif
+
+  /* Statistics */
+
+  uint32_t blocks;                   /* Blocks read */
+  uint32_t overruns;                 /* Blocks dropped, no free buffer */
+  uint64_t samples;                  /* Samples read */
+  uint64_t dropped;                  /* Samples in dropped blocks */
+  uint64_t gaps;                     /* Samples missing from the scans */
+  uint64_t written;                  /* Bytes written */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_ADC_STREAM_FFT
+/* cos and sin of 2 * pi / 2^s for s = 1..12, so that no libm is needed */
+
+static const float g_twiddle[12][2] =
+{
+  { -1.000000000f, 0.000000000f },
+  {  0.000000000f, 1.000000000f },
+  {  0.707106781f, 0.707106781f },
+  {  0.923879533f, 0.382683432f },
+  {  0.980785280f, 0.195090322f },
+  {  0.995184727f, 0.098017140f },
+  {  0.998795456f, 0.049067674f },
+  {  0.999698819f, 0.024541229f },
+  {  0.999924702f, 0.012271538f },
+  {  0.999981175f, 0.006135885f },
+  {  0.999995294f, 0.003067957f },
+  {  0.999998823f, 0.001533980f }
+};
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: adc_stream_msnow
+ ****************************************************************************/
+
+static uint32_t adc_stream_msnow(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(ADC_STREAM_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/****************************************************************************
+ * Name: adc_stream_open
+ *
+ * Description:
+ *   Open the output: a TCP connection for <ipaddr>:<port>, otherwise a
+ *   file that is created or truncated.
+ *
+ ****************************************************************************/
+
+static int adc_stream_open(FAR const char *name)
+{
+#ifdef CONFIG_NET_TCP
+  FAR const char *colon = strrchr(name, ':');
+
+  if (colon != NULL && strchr(name, '/') == NULL)
+    {
+      struct sockaddr_in addr;
+      char host[16];
+      int sd;
+
+      if (colon - name >= sizeof(host))
+        {
+          errno = EINVAL;
+          return ERROR;
+        }
+
+      memcpy(host, name, colon - name);
+      host[colon - name] = '\0';
+
+      memset(&addr, 0, sizeof(addr));
+      addr.sin_family      = AF_INET;
+      addr.sin_port        = htons(atoi(colon + 1));
+      addr.sin_addr.s_addr = inet_addr(host);
+
+      sd = socket(AF_INET, SOCK_STREAM, 0);
+      if (sd < 0)
+        {
+          return ERROR;
+        }
+
+      if (connect(sd, (FAR struct sockaddr *)&addr, sizeof(addr)) < 0)
+        {
+          int errcode = errno;
+          close(sd);
+          errno = errcode;
+          return ERROR;
+        }
+
+      return sd;
+    }
+#endif
+
+  return open(name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+}
+
+/****************************************************************************
+ * Name: adc_stream_write
+ ****************************************************************************/
+
+static int adc_stream_write(FAR struct adc_stream_s *st, FAR const void *buf,
+                            size_t len)
+{
+  FAR const uint8_t *ptr = (FAR const uint8_t *)buf;
+  ssize_t nwritten;
+
+  if (st->werrno != 0)
+    {
+      return -st->werrno;
+    }
+
+  while (len > 0)
+    {
+      nwritten = write(st->outfd, ptr, len);
+      if (nwritten < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          st->werrno = errno;
+          return -st->werrno;
+        }
+
+      ptr         += nwritten;
+      len         -= nwritten;
+      st->written += nwritten;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: adc_stream_check
+ *
+ * Description:
+ *   Learn the scan order from the first samples, then count the samples
+ *   missing from the expected channel sequence.  A driver FIFO overrun
+ *   shows up as such a gap; whole scans lost cannot be seen this way.
+ *
+ ****************************************************************************/
+
+static void adc_stream_check(FAR struct adc_stream_s *st,
+                             FAR const struct adc_msg_s *msg, size_t n)
+{
+  uint8_t pos;
+
+  for (; n > 0; n--, msg++)
+    {
+      pos = st->pos[msg->am_channel];
+      if (!st->learned)
+        {
+          /* The first scan ends when a channel repeats */
+
+          if (pos == NOPOS && st->nchan < ADC_STREAM_MAXCHAN)
+            {
+              st->pos[msg->am_channel] = st->nchan;
+              st->order[st->nchan++]   = msg->am_channel;
+              continue;
+            }
+
+          st->learned = true;
+          st->expect  = 0;
+        }
+
+      if (pos == NOPOS)
+        {
+          continue;
+        }
+
+      st->gaps  += (pos + st->nchan - st->expect) % st->nchan;
+      st->expect = (pos + 1) % st->nchan;
+    }
+}
+
+/****************************************************************************
+ * Name: adc_fft
+ *
+ * Description:
+ *   In-place radix-2 complex FFT of n points, n a power of two.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_ADC_STREAM_FFT
+static void adc_fft(FAR float *re, FAR float *im, int n)
+{
+  float wr;
+  float wi;
+  float tr;
+  float ti;
+  float tmp;
+  int len;
+  int s;
+  int i;
+  int j;
+  int k;
+
+  /* Bit-reversal permutation */
+
+  for (i = 1, j = 0; i < n; i++)
+    {
+      for (k = n >> 1; j & k; k >>= 1)
+        {
+          j ^= k;
+        }
+
+      j |= k;
+      if (i < j)
+        {
+          tmp = re[i]; re[i] = re[j]; re[j] = tmp;
+          tmp = im[i]; im[i] = im[j]; im[j] = tmp;
+        }
+    }
+
+  /* Butterflies, with the twiddle factor rotated by exp(-2 pi i / len) */
+
+  for (len = 2, s = 0; len <= n; len <<= 1, s++)
+    {
+      for (i = 0; i < n; i += len)
+        {
+          wr = 1.0f;
+          wi = 0.0f;
+
+          for (j = i; j < i + len / 2; j++)
+            {
+              k  = j + len / 2;
+              tr = re[k] * wr - im[k] * wi;
+              ti = re[k] * wi + im[k] * wr;
+
+              re[k]  = re[j] - tr;
+              im[k]  = im[j] - ti;
+              re[j] += tr;
+              im[j] += ti;
+
+              tmp = wr * g_twiddle[s][0] + wi * g_twiddle[s][1];
+              wi  = wi * g_twiddle[s][0] - wr * g_twiddle[s][1];
+              wr  = tmp;
+            }
+        }
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: adc_stream_spectrum
+ *
+ * Description:
+ *   Write the power spectrum of the collected samples of one channel.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_ADC_STREAM_FFT
+static int adc_stream_spectrum(FAR struct adc_stream_s *st, uint8_t pos)
+{
+  FAR const float *in = &st->fftin[pos * st->adc->fftsize];
+  int n = st->adc->fftsize;
+  uint32_t channel = st->order[pos];
+  float mean = 0.0f;
+  int ret;
+  int i;
+
+  for (i = 0; i < n; i++)
+    {
+      mean += in[i];
+    }
+
+  mean /= n;
+  for (i = 0; i < n; i++)
+    {
+      st->re[i] = in[i] - mean;
+      st->im[i] = 0.0f;
+    }
+
+  adc_fft(st->re, st->im, n);
+
+  /* Power of bins 0..n/2-1, normalized to the number of points */
+
+  for (i = 0; i < n / 2; i++)
+    {
+      st->re[i] = (st->re[i] * st->re[i] + st->im[i] * st->im[i]) /
+                  ((float)n * n);
+    }
+
+  ret = adc_stream_write(st, &channel, sizeof(channel));
+  if (ret >= 0)
+    {
+      ret = adc_stream_write(st, st->re, n / 2 * sizeof(float));
+    }
+
+  return ret;
+}
+#endif
+
+/****************************************************************************
+ * Name: adc_stream_process
+ *
+ * Description:
+ *   Pass one block through the decimation and FFT stages and write the
+ *   result.  Decimated samples are compacted in place.
+ *
+ ****************************************************************************/
+
+static int adc_stream_process(FAR struct adc_stream_s *st,
+                              FAR struct adc_msg_s *msg, size_t n)
+{
+  FAR struct adc_state_s *adc = st->adc;
+  size_t nout = 0;
+  uint8_t pos;
+  size_t i;
+
+  if (adc->decimate <= 1 && adc->fftsize == 0)
+    {
+      return adc_stream_write(st, msg, n * sizeof(struct adc_msg_s));
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      pos = st->pos[msg[i].am_channel];
+      if (pos == NOPOS)
+        {
+          continue;
+        }
+
+      /* Average each channel over 'decimate' samples */
+
+      st->sum[pos] += msg[i].am_data;
+      if (++st->cnt[pos] < adc->decimate)
+        {
+          continue;
+        }
+
+      msg[nout].am_channel = msg[i].am_channel;
+      msg[nout].am_data    = st->sum[pos] / adc->decimate;
+      st->sum[pos]         = 0;
+      st->cnt[pos]         = 0;
+
+#ifdef CONFIG_EXAMPLES_ADC_STREAM_FFT
+      if (adc->fftsize > 0)
+        {
+          st->fftin[pos * adc->fftsize + st->fftcnt[pos]] =
+            msg[nout].am_data;
+
+          if (++st->fftcnt[pos] == adc->fftsize)
+            {
+              st->fftcnt[pos] = 0;
+              if (adc_stream_spectrum(st, pos) < 0)
+                {
+                  return -st->werrno;
+                }
+            }
+
+          continue;
+        }
+#endif
+
+      nout++;
+    }
+
+  return nout > 0 ?
+    adc_stream_write(st, msg, nout * sizeof(struct adc_msg_s)) : OK;
+}
+
+/****************************************************************************
+ * Name: adc_stream_writer
+ *
+ * Description:
+ *   Write the filled buffers, leaving the reader free to refill the other.
+ *
+ ****************************************************************************/
+
+static pthread_addr_t adc_stream_writer(pthread_addr_t arg)
+{
+  FAR struct adc_stream_s *st = (FAR struct adc_stream_s *)arg;
+  FAR struct adc_state_s *adc = st->adc;
+  struct adc_stream_hdr_s hdr;
+  bool first = true;
+  int idx = 0;
+
+  for (; ; )
+    {
+      while (sem_wait(&st->full) < 0)
+        {
+        }
+
+      if (st->nsamples[idx] == 0)
+        {
+          break;
+        }
+
+      /* The scan order is known once the first block has been read */
+
+      if (first)
+        {
+          memset(&hdr, 0, sizeof(hdr));
+          memcpy(hdr.magic, "ADCS", 4);
+          hdr.type     = adc->fftsize > 0 ? ADC_STREAM_SPECTRA :
+                                            ADC_STREAM_SAMPLES;
+          hdr.recsize  = sizeof(struct adc_msg_s);
+          hdr.nchan    = st->nchan;
+          hdr.decimate = adc->decimate;
+          hdr.fftsize  = adc->fftsize;
+          memcpy(hdr.channel, st->order, st->nchan);
+
+          (void)adc_stream_write(st, &hdr, sizeof(hdr));
+          first = false;
+        }
+
+      /* After an output error the buffers are only recycled */
+
+      (void)adc_stream_process(st, st->buf[idx], st->nsamples[idx]);
+
+      sem_post(&st->free);
+      idx ^= 1;
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: adc_stream_report
+ ****************************************************************************/
+
+static void adc_stream_report(FAR struct adc_stream_s *st, uint32_t msec)
+{
+  printf("adc_stream: %lu blocks, %llu samples, %u channels in %lu ms\n",
+         (unsigned long)st->blocks, (unsigned long long)st->samples,
+         st->nchan, (unsigned long)msec);
+  printf("  dropped: %llu samples in %lu buffer overruns, "
+         "%llu missing from scans\n",
+         (unsigned long long)st->dropped, (unsigned long)st->overruns,
+         (unsigned long long)st->gaps);
+
+  if (msec > 0)
+    {
+      printf("  %llu samples/s, wrote %llu bytes (%lu KB/s)\n",
+             (unsigned long long)(st->samples * 1000 / msec),
+             (unsigned long long)st->written,
+             (unsigned long)(st->written * 1000 / 1024 / msec));
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: adc_stream
+ ****************************************************************************/
+
+int adc_stream(FAR struct adc_state_s *adc, int fd)
+{
+  FAR struct adc_stream_s *st;
+  struct sched_param param;
+  pthread_attr_t attr;
+  pthread_t writer;
+  uint32_t start;
+  ssize_t nbytes;
+  size_t fill = 0;
+  int errval = 0;
+  int cur = 0;
+  int ret;
+
+  /* A block must hold more than one scan so that the scan order is known
+   * when the first block is written.
+   */
+
+  if (adc->blocksize < 2 * ADC_STREAM_MAXCHAN || adc->decimate <= 0 ||
+      adc->decimate > 65535)
+    {
+      printf("adc_stream: Block size must be at least %d and decimation "
+             "from 1 to 65535\n", 2 * ADC_STREAM_MAXCHAN);
+      return 1;
+    }
+
+#ifdef CONFIG_EXAMPLES_ADC_STREAM_FFT
+  if (adc->fftsize != 0 &&
+      (adc->fftsize < 8 || adc->fftsize > 4096 ||
+       (adc->fftsize & (adc->fftsize - 1)) != 0))
+    {
+      printf("adc_stream: FFT size must be a power of 2 from 8 to 4096\n");
+      return 1;
+    }
+#else
+  adc->fftsize = 0;
+#endif
+
+  st = (FAR struct adc_stream_s *)zalloc(sizeof(struct adc_stream_s));
+  if (st == NULL)
+    {
+      printf("adc_stream: Out of memory\n");
+      return 1;
+    }
+
+  st->adc = adc;
+  memset(st->pos, NOPOS, sizeof(st->pos));
+  sem_init(&st->full, 0, 0);
+  sem_init(&st->free, 0, 1);
+
+  st->buf[0] = (FAR struct adc_msg_s *)
+    malloc(adc->blocksize * sizeof(struct adc_msg_s));
+  st->buf[1] = (FAR struct adc_msg_s *)
+    malloc(adc->blocksize * sizeof(struct adc_msg_s));
+  st->sum    = (FAR int64_t *)zalloc(ADC_STREAM_MAXCHAN * sizeof(int64_t));
+  st->cnt    = (FAR uint16_t *)zalloc(ADC_STREAM_MAXCHAN * sizeof(uint16_t));
+
+  if (st->buf[0] == NULL || st->buf[1] == NULL || st->sum == NULL ||
+      st->cnt == NULL)
+    {
+      printf("adc_stream: Out of memory\n");
+      errval = 1;
+      goto errout_with_mem;
+    }
+
+#ifdef CONFIG_EXAMPLES_ADC_STREAM_FFT
+  if (adc->fftsize > 0)
+    {
+      st->fftin  = (FAR float *)
+        malloc(ADC_STREAM_MAXCHAN * adc->fftsize * sizeof(float));
+      st->fftcnt = (FAR uint16_t *)
+        zalloc(ADC_STREAM_MAXCHAN * sizeof(uint16_t));
+      st->re     = (FAR float *)malloc(adc->fftsize * sizeof(float));
+      st->im     = (FAR float *)malloc(adc->fftsize * sizeof(float));
+
+      if (st->fftin == NULL || st->fftcnt == NULL || st->re == NULL ||
+          st->im == NULL)
+        {
+          printf("adc_stream: Out of memory\n");
+          errval = 1;
+          goto errout_with_mem;
+        }
+    }
+#endif
+
+  st->outfd = adc_stream_open(adc->stream);
+  if (st->outfd < 0)
+    {
+      printf("adc_stream: open %s failed: %d\n", adc->stream, errno);
+      errval = 2;
+      goto errout_with_mem;
+    }
+
+  pthread_attr_init(&attr);
+  param.sched_priority = CONFIG_EXAMPLES_ADC_STREAM_PRIORITY;
+  (void)pthread_attr_setschedparam(&attr, &param);
+  (void)pthread_attr_setstacksize(&attr,
+                                  CONFIG_EXAMPLES_ADC_STREAM_STACKSIZE);
+
+  ret = pthread_create(&writer, &attr, adc_stream_writer, st);
+  pthread_attr_destroy(&attr);
+  if (ret != 0)
+    {
+      printf("adc_stream: pthread_create failed: %d\n", ret);
+      errval = 2;
+      goto errout_with_out;
+    }
+
+  printf("adc_stream: Streaming %d sample blocks to %s\n",
+         adc->blocksize, adc->stream);
+  fflush(stdout);
+
+  start = adc_stream_msnow();
+  while (adc->count == 0 || st->blocks < adc->count)
+    {
+#ifdef CONFIG_EXAMPLES_ADC_SWTRIG
+      ret = ioctl(fd, ANIOC_TRIGGER, 0);
+      if (ret < 0)
+        {
+          printf("adc_stream: ANIOC_TRIGGER ioctl failed: %d\n", errno);
+        }
+#endif
+
+      /* Read into the current buffer as much as the driver has ready */
+
+      nbytes = read(fd, &st->buf[cur][fill],
+                    (adc->blocksize - fill) * sizeof(struct adc_msg_s));
+      if (nbytes < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          printf("adc_stream: read %s failed: %d\n", adc->devpath, errno);
+          errval = 3;
+          break;
+        }
+
+      nbytes /= sizeof(struct adc_msg_s);
+      adc_stream_check(st, &st->buf[cur][fill], nbytes);
+      st->samples += nbytes;
+      fill        += nbytes;
+
+      if (fill < adc->blocksize)
+        {
+          continue;
+        }
+
+      /* Hand the full buffer to the writer if it has finished with the
+       * other one.  Otherwise the writer is too slow: drop the block and
+       * refill the same buffer rather than stall the driver.
+       */
+
+      st->blocks++;
+      st->nsamples[cur] = fill;
+      fill = 0;
+
+      if (sem_trywait(&st->free) == 0)
+        {
+          sem_post(&st->full);
+          cur ^= 1;
+        }
+      else
+        {
+          st->overruns++;
+          st->dropped += adc->blocksize;
+        }
+
+      if (st->werrno != 0)
+        {
+          printf("adc_stream: write %s failed: %d\n", adc->stream,
+                 st->werrno);
+          errval = 4;
+          break;
+        }
+    }
+
+  /* Wait for the writer to finish with the other buffer, then stop it */
+
+  while (sem_wait(&st->free) < 0)
+    {
+    }
+
+  st->nsamples[cur] = 0;
+  sem_post(&st->full);
+  pthread_join(writer, NULL);
+
+  adc_stream_report(st, adc_stream_msnow() - start);
+
+errout_with_out:
+  close(st->outfd);
+
+errout_with_mem:
+#ifdef CONFIG_EXAMPLES_ADC_STREAM_FFT
+  free(st->im);
+  free(st->re);
+  free(st->fftcnt);
+  free(st->fftin);
+#endif
+  free(st->cnt);
+  free(st->sum);
+  free(st->buf[1]);
+  free(st->buf[0]);
+  sem_destroy(&st->free);
+  sem_destroy(&st->full);
+  free(st);
+  return errval;
+}
+
+#endif /* CONFIG_EXAMPLES_ADC_STREAM */
@@ -39,8 +39,9 @@
 
 #include <nuttx/can/can.h>
 #include <canard.h>
-#include <canard_nuttx.h>       /* CAN backend driver for nuttx, distributed
-                                 * with Libcanard */
+#include "canutils/canard_node.h"
+
+#include "uavcan_dsdl.h"
 
 #include <sys/ioctl.h>
 #include <sched.h>
@@ -65,21 +66,12 @@
 
  /* Some useful constants defined by the UAVCAN specification.
   * Data type signature values can be easily obtained with the script
-  * show_data_type_info.py
+  * show_data_type_info.py.  IDs, sizes and the other constants of the
+  * messages under dsdl/ come from the generated uavcan_dsdl.h.
   */
 
-#define UAVCAN_NODE_STATUS_MESSAGE_SIZE          7
-#define UAVCAN_NODE_STATUS_DATA_TYPE_ID          341
 #define UAVCAN_NODE_STATUS_DATA_TYPE_SIGNATURE   0x0f0868d0c1a7c6f1
 
-#define UAVCAN_NODE_HEALTH_OK                    0
-#define UAVCAN_NODE_HEALTH_WARNING               1
-#define UAVCAN_NODE_HEALTH_ERROR                 2
-#define UAVCAN_NODE_HEALTH_CRITICAL              3
-
-#define UAVCAN_NODE_MODE_OPERATIONAL             0
-#define UAVCAN_NODE_MODE_INITIALIZATION          1
-
 #define UAVCAN_GET_NODE_INFO_RESPONSE_MAX_SIZE   ((3015 + 7) / 8)
 #define UAVCAN_GET_NODE_INFO_DATA_TYPE_SIGNATURE 0xee468a8121c46a9e
 #define UAVCAN_GET_NODE_INFO_DATA_TYPE_ID        1
@@ -97,6 +89,10 @@
 
 static CanardInstance canard;
 
+/* The CAN devices serving the library instance */
+
+static struct canard_node_s canard_node;
+
 /* Arena for memory allocation, used by the library */
 
 static uint8_t canard_memory_pool[CONFIG_EXAMPLES_LIBCANARD_NODE_MEM_POOL_SIZE];
@@ -110,8 +106,8 @@ static uint8_t unique_id[UNIQUE_ID_LENGTH_BYTES] =
 
 /* Node status variables */
 
-static uint8_t node_health = UAVCAN_NODE_HEALTH_OK;
-static uint8_t node_mode = UAVCAN_NODE_MODE_INITIALIZATION;
+static uint8_t node_health = UAVCAN_PROTOCOL_NODESTATUS_HEALTH_OK;
+static uint8_t node_mode = UAVCAN_PROTOCOL_NODESTATUS_MODE_INITIALIZATION;
 static bool g_canard_daemon_started;
 
 /****************************************************************************
@@ -127,15 +123,7 @@ static bool g_canard_daemon_started;
 
 uint64_t getMonotonicTimestampUSec(void)
 {
-  struct timespec ts;
-
-  memset(&ts, 0, sizeof(ts));
-  if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
-    {
-      abort();
-    }
-
-  return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000ULL;
+  return canard_node_now();
 }
 
 /****************************************************************************
@@ -145,27 +133,23 @@ uint64_t getMonotonicTimestampUSec(void)
  *
  ****************************************************************************/
 
-void makeNodeStatusMessage(uint8_t buffer[UAVCAN_NODE_STATUS_MESSAGE_SIZE])
+void makeNodeStatusMessage(uint8_t buffer[UAVCAN_PROTOCOL_NODESTATUS_SIZE])
 {
   static uint32_t started_at_sec = 0;
-
-  memset(buffer, 0, UAVCAN_NODE_STATUS_MESSAGE_SIZE);
+  struct uavcan_protocol_nodestatus_s status;
 
   if (started_at_sec == 0)
     {
       started_at_sec = (uint32_t) (getMonotonicTimestampUSec() / 1000000U);
     }
 
-  const uint32_t uptime_sec =
+  memset(&status, 0, sizeof(status));
+  status.uptime_sec =
     (uint32_t) ((getMonotonicTimestampUSec() / 1000000U) - started_at_sec);
+  status.health = node_health;
+  status.mode   = node_mode;
 
-  /* Here we're using the helper for demonstrational purposes; in this
-   * simple case it could be preferred to encode the values manually.
-   */
-
-  canardEncodeScalar(buffer, 0, 32, &uptime_sec);
-  canardEncodeScalar(buffer, 32, 2, &node_health);
-  canardEncodeScalar(buffer, 34, 3, &node_mode);
+  (void)uavcan_protocol_nodestatus_encode(&status, buffer);
 }
 
 /****************************************************************************
@@ -185,6 +169,7 @@ static void onTransferReceived(CanardInstance *ins,
     {
       printf("GetNodeInfo request from %d\n", transfer->source_node_id);
 
+      struct uavcan_protocol_softwareversion_s version;
       uint8_t buffer[UAVCAN_GET_NODE_INFO_RESPONSE_MAX_SIZE];
       memset(buffer, 0, UAVCAN_GET_NODE_INFO_RESPONSE_MAX_SIZE);
 
@@ -194,15 +179,17 @@ static void onTransferReceived(CanardInstance *ins,
 
       /* SoftwareVersion */
 
-      buffer[7] = APP_VERSION_MAJOR;
-      buffer[8] = APP_VERSION_MINOR;
-      buffer[9] = 1;            /* Optional field flags, VCS commit is set */
-
-      /* uint32_t u32 = GIT_HASH;
-       * canardEncodeScalar(buffer, 80, 32, &u32);
-       */
+      memset(&version, 0, sizeof(version));
+      version.major = APP_VERSION_MAJOR;
+      version.minor = APP_VERSION_MINOR;
+      version.optional_field_flags =
+        UAVCAN_PROTOCOL_SOFTWAREVERSION_OPTIONAL_FIELD_FLAG_VCS_COMMIT;
+      version.vcs_commit = GIT_HASH;
 
       /* Image CRC skipped */
+
+      (void)uavcan_protocol_softwareversion_encode(&version, &buffer[7]);
+
       /* HardwareVersion */
       /* Major skipped */
       /* Minor skipped */
@@ -288,11 +275,7 @@ static bool shouldAcceptTransfer(const CanardInstance * ins,
 
 void process1HzTasks(uint64_t timestamp_usec)
 {
-  /* Purging transfers that are no longer transmitted. This will occasionally
-   * free up some memory.
-   */
-
-  canardCleanupStaleTransfers(&canard, timestamp_usec);
+  /* Stale transfers are purged by canard_node_spin() when needed. */
 
   /* Printing the memory usage statistics. */
 
@@ -320,19 +303,41 @@ void process1HzTasks(uint64_t timestamp_usec)
       }
   }
 
+#ifdef CONFIG_DEBUG_CAN
+  /* Printing the per-interface counters. */
+
+  {
+    int i;
+
+    for (i = 0; i < canard_node.niface; i++)
+      {
+        FAR const struct canard_iface_s *iface = &canard_node.iface[i];
+
+        printf("CAN%d: rx %lu dup %lu err %lu, tx %lu drop %lu err %lu%s\n",
+               i, (unsigned long)iface->rxframes,
+               (unsigned long)iface->rxdups,
+               (unsigned long)iface->rxerrors,
+               (unsigned long)iface->txframes,
+               (unsigned long)iface->txdropped,
+               (unsigned long)iface->txerrors,
+               iface->failed ? " FAILED" : "");
+      }
+  }
+#endif
+
   /* Transmitting the node status message periodically. */
 
   {
-    uint8_t buffer[UAVCAN_NODE_STATUS_MESSAGE_SIZE];
+    uint8_t buffer[UAVCAN_PROTOCOL_NODESTATUS_SIZE];
     makeNodeStatusMessage(buffer);
 
     static uint8_t transfer_id;
 
     const int bc_res =
       canardBroadcast(&canard, UAVCAN_NODE_STATUS_DATA_TYPE_SIGNATURE,
-                      UAVCAN_NODE_STATUS_DATA_TYPE_ID, &transfer_id,
+                      UAVCAN_PROTOCOL_NODESTATUS_ID, &transfer_id,
                       CANARD_TRANSFER_PRIORITY_LOW,
-                      buffer, UAVCAN_NODE_STATUS_MESSAGE_SIZE);
+                      buffer, UAVCAN_PROTOCOL_NODESTATUS_SIZE);
     if (bc_res <= 0)
       {
         (void)fprintf(stderr, "Could not broadcast node status; error %d\n",
@@ -357,62 +362,7 @@ void process1HzTasks(uint64_t timestamp_usec)
       }
   }
 
-  node_mode = UAVCAN_NODE_MODE_OPERATIONAL;
-}
-
-/****************************************************************************
- * Name: processTxRxOnce
- *
- * Description:
- *   Transmits all frames from the TX queue, receives up to one frame.
- *
- ****************************************************************************/
-
-void processTxRxOnce(CanardNuttXInstance * nuttxcan, int timeout_msec)
-{
-  const CanardCANFrame *txf;
-
-  /* Transmitting */
-
-  for (txf = NULL; (txf = canardPeekTxQueue(&canard)) != NULL;)
-    {
-      const int tx_res = canardNuttXTransmit(nuttxcan, txf, 0);
-      if (tx_res < 0)           /* Failure - drop the frame and report */
-        {
-          canardPopTxQueue(&canard);
-          (void)fprintf(stderr,
-                        "Transmit error %d, frame dropped, errno '%s'\n",
-                        tx_res, strerror(errno));
-        }
-      else if (tx_res > 0)      /* Success - just drop the frame */
-        {
-          canardPopTxQueue(&canard);
-        }
-      else                      /* Timeout - just exit and try again later */
-        {
-          break;
-        }
-    }
-
-  /* Receiving */
-
-  CanardCANFrame rx_frame;
-  const uint64_t timestamp = getMonotonicTimestampUSec();
-  const int rx_res = canardNuttXReceive(nuttxcan, &rx_frame, timeout_msec);
-
-  if (rx_res < 0)               /* Failure - report */
-    {
-      (void)fprintf(stderr, "Receive error %d, errno '%s'\n", rx_res,
-                    strerror(errno));
-    }
-  else if (rx_res > 0)          /* Success - process the frame */
-    {
-      canardHandleRxFrame(&canard, &rx_frame, timestamp);
-    }
-  else
-    {
-      ;                         /* Timeout - nothing to do */
-    }
+  node_mode = UAVCAN_PROTOCOL_NODESTATUS_MODE_OPERATIONAL;
 }
 
 /****************************************************************************
@@ -424,7 +374,11 @@ void processTxRxOnce(CanardNuttXInstance * nuttxcan, int timeout_msec)
 
 static int canard_daemon(int argc, char *argv[])
 {
-  static CanardNuttXInstance canardnuttx_instance;
+  FAR const char *devpaths[2] =
+  {
+    CONFIG_EXAMPLES_LIBCANARD_DEVPATH
+  };
+  int ndevs = 1;
 #ifdef CONFIG_DEBUG_CAN
   struct canioc_bittiming_s bt;
 #endif
@@ -435,10 +389,16 @@ static int canard_daemon(int argc, char *argv[])
    * specific logic to running this test.
    */
 
-  /* Open the CAN device for reading */
+  /* Open the CAN devices for reading */
+
+#ifdef CONFIG_EXAMPLES_LIBCANARD_DEVPATH2
+  if (CONFIG_EXAMPLES_LIBCANARD_DEVPATH2[0] != '\0')
+    {
+      devpaths[ndevs++] = CONFIG_EXAMPLES_LIBCANARD_DEVPATH2;
+    }
+#endif
 
-  ret = canardNuttXInit(&canardnuttx_instance,
-                        CONFIG_EXAMPLES_LIBCANARD_DEVPATH);
+  ret = canard_node_init(&canard_node, &canard, devpaths, ndevs);
   if (ret < 0)
     {
       printf("canard_daemon: ERROR: open %s failed: %d\n",
@@ -452,9 +412,8 @@ static int canard_daemon(int argc, char *argv[])
    * drivers will support this IOCTL.
    */
 
-  ret =
-    ioctl(canardNuttXGetDeviceFileDescriptor(&canardnuttx_instance),
-          CANIOC_GET_BITTIMING, (unsigned long)((uintptr_t)&bt));
+  ret = ioctl(canard_node.iface[0].fd, CANIOC_GET_BITTIMING,
+              (unsigned long)((uintptr_t)&bt));
   if (ret < 0)
     {
       printf("canard_daemon: Bit timing not available: %d\n", errno);
@@ -479,21 +438,26 @@ static int canard_daemon(int argc, char *argv[])
   g_canard_daemon_started = true;
   uint64_t next_1hz_service_at = getMonotonicTimestampUSec();
 
+  /* The node sleeps until a frame arrives or the next 1 Hz task is due */
+
   for (;;)
     {
-      processTxRxOnce(&canardnuttx_instance, 10);
+      ret = canard_node_spin(&canard_node, next_1hz_service_at);
+      if (ret < 0)
+        {
+          printf("canard_daemon: ERROR: node failed: %d\n", errno);
+          errval = 3;
+          goto errout_with_dev;
+        }
 
       const uint64_t ts = getMonotonicTimestampUSec();
 
-      if (ts >= next_1hz_service_at)
-        {
-          next_1hz_service_at += 1000000;
-          process1HzTasks(ts);
-        }
+      next_1hz_service_at += 1000000;
+      process1HzTasks(ts);
     }
 
 errout_with_dev:
-  canardNuttXClose(&canardnuttx_instance);
+  canard_node_close(&canard_node);
 
   g_canard_daemon_started = false;
   printf("canard_daemon: Terminating!\n");
@@ -0,0 +1,477 @@
+#!/bin/sh
+# apps/examples/canard/mkdsdl.sh
+#
+# Generate C serializers and deserializers for the UAVCAN DSDL message
+# definitions in a directory tree.  The bit offset of every field is a
+# constant in the generated code, so that the helpers in
+# include/canutils/canard_dsdl.h reduce to direct byte stores wherever a
+# field is byte aligned.
+#
+# Only messages with fixed size layouts are supported: primitive fields,
+# void padding, fixed length arrays and nested types.  Services, unions and
+# dynamic arrays are rejected.
+#
+# Usage: mkdsdl.sh <dsdl-dir> > uavcan_dsdl.h
+
+USAGE="$0 <dsdl-dir>"
+
+DSDLDIR=$1
+if [ -z "${DSDLDIR}" ]; then
+    echo "Missing command line argument" 1>&2
+    echo $USAGE 1>&2
+    exit 1
+fi
+
+if [ ! -d "${DSDLDIR}" ]; then
+    echo "Directory ${DSDLDIR} does not exist" 1>&2
+    echo $USAGE 1>&2
+    exit 1
+fi
+
+FILES=`find ${DSDLDIR} -name '*.uavcan' | sort`
+if [ -z "${FILES}" ]; then
+    echo "No DSDL definitions in ${DSDLDIR}" 1>&2
+    exit 1
+fi
+
+awk -v root="${DSDLDIR}" '
+function fail(msg)
+{
+  printf("%s:%d: %s\n", FILENAME, FNR, msg) > "/dev/stderr"
+  failed = 1
+  exit 1
+}
+
+function cname(full,    s)
+{
+  s = tolower(full)
+  gsub(/\./, "_", s)
+  return s
+}
+
+# Resolve a type name used in the definition of type t
+
+function resolve(name, t)
+{
+  if (name ~ /^(u?int[0-9]+|bool|float(16|32|64)|void[0-9]+)$/)
+    {
+      return name
+    }
+
+  if (index(name, ".") == 0)
+    {
+      name = ns[t] "." name
+    }
+
+  if (!(name in nfields))
+    {
+      printf("%s: unknown type %s\n", t, name) > "/dev/stderr"
+      failed = 1
+      exit 1
+    }
+
+  return name
+}
+
+function width(type, t)
+{
+  if (type == "bool")
+    {
+      return 1
+    }
+
+  if (type ~ /^(u?int|float|void)[0-9]+$/)
+    {
+      sub(/^[a-z]+/, "", type)
+      return type + 0
+    }
+
+  return size(type)
+}
+
+function size(t,    i, bits)
+{
+  if (t in bitsof)
+    {
+      return bitsof[t]
+    }
+
+  if (t in sizing)
+    {
+      printf("%s: recursive definition\n", t) > "/dev/stderr"
+      failed = 1
+      exit 1
+    }
+
+  sizing[t] = 1
+  bits = 0
+  for (i = 1; i <= nfields[t]; i++)
+    {
+      ftype[t, i]  = resolve(ftype[t, i], t)
+      foff[t, i]   = bits
+      fwidth[t, i] = width(ftype[t, i], t)
+      bits        += fwidth[t, i] * fcount[t, i]
+    }
+
+  bitsof[t] = bits
+  return bits
+}
+
+function ctype(type, w)
+{
+  if (type == "bool")
+    {
+      return "bool"
+    }
+
+  if (type == "float64")
+    {
+      return "double"
+    }
+
+  if (type ~ /^float/)
+    {
+      return "float"
+    }
+
+  if (type ~ /^u?int/)
+    {
+      w = w <= 8 ? 8 : w <= 16 ? 16 : w <= 32 ? 32 : 64
+      return (type ~ /^u/ ? "uint" : "int") w "_t"
+    }
+
+  return "struct " cname(type) "_s"
+}
+
+# The statements that move one field or array element
+
+function putfield(type, w, off, ref)
+{
+  if (type == "float16")
+    {
+      return "canard_dsdl_put(buffer, " off ", 16,\n" \
+             "                  canardConvertNativeFloatToFloat16(" ref "));"
+    }
+
+  if (type == "float32")
+    {
+      return "canard_dsdl_put(buffer, " off ", 32, " \
+             "canard_dsdl_f32bits(" ref "));"
+    }
+
+  if (type == "float64")
+    {
+      return "canard_dsdl_put(buffer, " off ", 64, " \
+             "canard_dsdl_f64bits(" ref "));"
+    }
+
+  if (type == "bool" || type ~ /^u?int/)
+    {
+      return "canard_dsdl_put(buffer, " off ", " w ", " ref ");"
+    }
+
+  return cname(type) "_encode_bits(&" ref ", buffer, " off ");"
+}
+
+function getfield(type, w, off, ref)
+{
+  if (type == "float16")
+    {
+      return ref " = canardConvertFloat16ToNativeFloat(\n" \
+             "    (uint16_t)canard_dsdl_get(transfer, " off ", 16, false));"
+    }
+
+  if (type == "float32")
+    {
+      return ref " = canard_dsdl_f32(\n" \
+             "    (uint32_t)canard_dsdl_get(transfer, " off ", 32, false));"
+    }
+
+  if (type == "float64")
+    {
+      return ref " = canard_dsdl_f64(canard_dsdl_get(transfer, " off \
+             ", 64, false));"
+    }
+
+  if (type == "bool" || type ~ /^u?int/)
+    {
+      return ref " = (" ctype(type, w) ")canard_dsdl_get(transfer, " off \
+             ", " w ", " (type ~ /^int/ ? "true" : "false") ");"
+    }
+
+  return cname(type) "_decode_bits(transfer, &" ref ", " off ");"
+}
+
+function indent(stmt, pad)
+{
+  gsub(/\n/, "\n" pad, stmt)
+  return pad stmt
+}
+
+# Emit the code that moves every field of type t, with one statement per
+# field or array
+
+function body(t, encode,    i, type, w, off, ref, stmt)
+{
+  for (i = 1; i <= nfields[t]; i++)
+    {
+      type = ftype[t, i]
+      if (type ~ /^void/)
+        {
+          continue
+        }
+
+      w   = fwidth[t, i]
+      off = "bit + " foff[t, i]
+
+      if (fcount[t, i] > 1)
+        {
+          off  = off " + " w " * i"
+          ref  = "msg->" fname[t, i] "[i]"
+          stmt = encode ? putfield(type, w, off, ref) : \
+                          getfield(type, w, off, ref)
+          printf("  for (i = 0; i < %d; i++)\n    {\n%s\n    }\n",
+                 fcount[t, i], indent(stmt, "      "))
+        }
+      else
+        {
+          ref  = "msg->" fname[t, i]
+          stmt = encode ? putfield(type, w, off, ref) : \
+                          getfield(type, w, off, ref)
+          printf("%s\n", indent(stmt, "  "))
+        }
+    }
+}
+
+function emit(t,    i, p, m, hasarray, decl)
+{
+  if (t in emitted)
+    {
+      return
+    }
+
+  emitted[t] = 1
+  hasarray = 0
+  for (i = 1; i <= nfields[t]; i++)
+    {
+      if (ftype[t, i] in nfields)
+        {
+          emit(ftype[t, i])
+        }
+
+      if (fcount[t, i] > 1 && ftype[t, i] !~ /^void/)
+        {
+          hasarray = 1
+        }
+    }
+
+  p = cname(t)
+  m = toupper(p)
+
+  printf("/* %s */\n\n", t)
+  if (dtid[t] != "")
+    {
+      printf("#define %s_ID %s\n", m, dtid[t])
+    }
+
+  printf("#define %s_BITS %d\n", m, bitsof[t])
+  printf("#define %s_SIZE %d\n", m, int((bitsof[t] + 7) / 8))
+  printf("%s\n", consts[t])
+
+  printf("struct %s_s\n{\n", p)
+  for (i = 1; i <= nfields[t]; i++)
+    {
+      if (ftype[t, i] ~ /^void/)
+        {
+          continue
+        }
+
+      decl = ctype(ftype[t, i], fwidth[t, i]) " " fname[t, i]
+      if (fcount[t, i] > 1)
+        {
+          decl = decl "[" fcount[t, i] "]"
+        }
+
+      printf("  %s;\n", decl)
+    }
+
+  printf("};\n\n")
+
+  printf("static inline inline_function void\n")
+  printf("%s_encode_bits(FAR const struct %s_s *msg,\n", p, p)
+  printf("    FAR uint8_t *buffer, uint32_t bit)\n{\n")
+  if (hasarray)
+    {
+      printf("  int i;\n\n")
+    }
+
+  body(t, 1)
+  printf("}\n\n")
+
+  printf("static inline inline_function void\n")
+  printf("%s_decode_bits(FAR CanardRxTransfer *transfer,\n", p)
+  printf("    FAR struct %s_s *msg, uint32_t bit)\n{\n", p)
+  if (hasarray)
+    {
+      printf("  int i;\n\n")
+    }
+
+  body(t, 0)
+  printf("}\n\n")
+
+  printf("static inline uint16_t\n")
+  printf("%s_encode(FAR const struct %s_s *msg, FAR uint8_t *buffer)\n{\n",
+         p, p)
+  printf("  memset(buffer, 0, %s_SIZE);\n", m)
+  printf("  %s_encode_bits(msg, buffer, 0);\n", p)
+  printf("  return %s_SIZE;\n}\n\n", m)
+
+  printf("static inline int\n")
+  printf("%s_decode(FAR CanardRxTransfer *transfer,\n", p)
+  printf("    FAR struct %s_s *msg)\n{\n", p)
+  printf("  if (transfer->payload_len < %s_SIZE)\n", m)
+  printf("    {\n      return -EINVAL;\n    }\n\n")
+  printf("  %s_decode_bits(transfer, msg, 0);\n", p)
+  printf("  return OK;\n}\n\n")
+}
+
+FNR == 1 {
+  path = FILENAME
+  if (substr(path, 1, length(root)) == root)
+    {
+      path = substr(path, length(root) + 1)
+    }
+
+  sub(/^\/+/, "", path)
+  sub(/\.uavcan$/, "", path)
+
+  n = split(path, parts, "/")
+  name = parts[n]
+  id = ""
+  if (name ~ /^[0-9]+\./)
+    {
+      id = name
+      sub(/\..*/, "", id)
+      sub(/^[0-9]+\./, "", name)
+    }
+
+  space = parts[1]
+  for (i = 2; i < n; i++)
+    {
+      space = space "." parts[i]
+    }
+
+  cur = space "." name
+  ns[cur] = space
+  dtid[cur] = id
+  nfields[cur] = 0
+  consts[cur] = ""
+  types[++ntypes] = cur
+}
+
+{
+  line = $0
+  sub(/#.*/, "", line)
+  gsub(/\t/, " ", line)
+  sub(/^ +/, "", line)
+  sub(/ +$/, "", line)
+
+  if (line == "")
+    {
+      next
+    }
+
+  if (line ~ /^---/)
+    {
+      fail("services are not supported")
+    }
+
+  if (line ~ /^@/)
+    {
+      fail("directive not supported: " line)
+    }
+
+  sub(/^(saturated|truncated) +/, "", line)
+
+  if (index(line, "=") > 0)
+    {
+      # Constant: type NAME = value
+
+      value = line
+      sub(/^[^=]*= */, "", value)
+      split(line, tok, /[ =]+/)
+      consts[cur] = consts[cur] sprintf("#define %s_%s %s\n",
+                                        toupper(cname(cur)), tok[2], value)
+      next
+    }
+
+  ntok = split(line, tok, / +/)
+  type = tok[1]
+  count = 1
+
+  if (type ~ /\[/)
+    {
+      if (type !~ /\[[0-9]+\]$/)
+        {
+          fail("dynamic arrays are not supported")
+        }
+
+      count = type
+      sub(/^.*\[/, "", count)
+      sub(/\]$/, "", count)
+      count += 0
+      sub(/\[.*$/, "", type)
+    }
+
+  if (type ~ /^void[0-9]+$/)
+    {
+      fieldname = ""
+    }
+  else if (ntok != 2)
+    {
+      fail("cannot parse: " line)
+    }
+  else
+    {
+      fieldname = tok[2]
+    }
+
+  i = ++nfields[cur]
+  ftype[cur, i]  = type
+  fname[cur, i]  = fieldname
+  fcount[cur, i] = count
+}
+
+END {
+  if (failed)
+    {
+      exit 1
+    }
+
+  for (i = 1; i <= ntypes; i++)
+    {
+      if (nfields[types[i]] == 0)
+        {
+          printf("%s: empty messages are not supported\n",
+                 types[i]) > "/dev/stderr"
+          exit 1
+        }
+
+      size(types[i])
+    }
+
+  printf("/* Auto-generated by mkdsdl.sh from %s.  Do not edit */\n\n", root)
+  printf("#ifndef __UAVCAN_DSDL_H\n#define __UAVCAN_DSDL_H\n\n")
+  printf("#include <nuttx/config.h>\n#include <nuttx/compiler.h>\n\n")
+  printf("#include <stdbool.h>\n#include <stdint.h>\n#include <string.h>\n")
+  printf("#include <errno.h>\n\n")
+  printf("#include <canard.h>\n#include \"canutils/canard_dsdl.h\"\n\n")
+
+  for (i = 1; i <= ntypes; i++)
+    {
+      emit(types[i])
+    }
+
+  printf("#endif /* __UAVCAN_DSDL_H */\n")
+}
+' ${FILES}
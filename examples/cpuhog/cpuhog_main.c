@@ -65,9 +65,14 @@
 
 #include <nuttx/config.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
+#include <sched.h>
+#include <time.h>
 #include <nuttx/clock.h>
 #include <nuttx/arch.h>
 #include <semaphore.h>
@@ -81,6 +86,51 @@
 
 #define CPUHOG_FIFO_FNAME "/dev/cpuhogfifo"
 
+#ifndef CONFIG_EXAMPLES_CPUHOG_BUFSIZE
+#  define CONFIG_EXAMPLES_CPUHOG_BUFSIZE 65536
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define CPUHOG_CLOCK CLOCK_MONOTONIC
+#else
+#  define CPUHOG_CLOCK CLOCK_REALTIME
+#endif
+
+/* The stride of the cache profile, at least one cache line */
+
+#define CPUHOG_LINESIZE 32
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* A load profile does one short unit of its kind of work per call */
+
+struct cpuhog_profile_s
+{
+  FAR const char *name;
+  CODE void (*load)(FAR uint8_t *buffer, size_t size);
+};
+
+struct cpuhog_options_s
+{
+  FAR const struct cpuhog_profile_s *profile;
+  int duty;          /* Percentage of each period spent loading */
+  int period;        /* Milliseconds */
+  int priority;      /* Or 0 to keep the priority of the caller */
+  int cpu;           /* Or -1 to run on any CPU */
+  size_t size;       /* Buffer of the memory and cache profiles */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static void cpuhog_spin(FAR uint8_t *buffer, size_t size);
+static void cpuhog_mem(FAR uint8_t *buffer, size_t size);
+static void cpuhog_syscall(FAR uint8_t *buffer, size_t size);
+static void cpuhog_cache(FAR uint8_t *buffer, size_t size);
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -92,6 +142,243 @@ static struct state_s
   int count;
 } g_state;
 
+static const struct cpuhog_profile_s g_profiles[] =
+{
+  { "spin",    cpuhog_spin    },
+  { "mem",     cpuhog_mem     },
+  { "syscall", cpuhog_syscall },
+  { "cache",   cpuhog_cache   },
+  { NULL,      NULL           }
+};
+
+/* Keeps the compiler from discarding the loads */
+
+static volatile uint32_t g_sink;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: cpuhog_msec
+ ****************************************************************************/
+
+static uint32_t cpuhog_msec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CPUHOG_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/****************************************************************************
+ * Name: cpuhog_spin
+ *
+ * Description:
+ *   Pure CPU load, without memory traffic.
+ *
+ ****************************************************************************/
+
+static void cpuhog_spin(FAR uint8_t *buffer, size_t size)
+{
+  up_udelay(100);
+}
+
+/****************************************************************************
+ * Name: cpuhog_mem
+ *
+ * Description:
+ *   Memory bandwidth load: copy one half of the buffer to the other.
+ *
+ ****************************************************************************/
+
+static void cpuhog_mem(FAR uint8_t *buffer, size_t size)
+{
+  memcpy(&buffer[size / 2], buffer, size / 2);
+  memset(buffer, (int)g_sink++, size / 2);
+}
+
+/****************************************************************************
+ * Name: cpuhog_syscall
+ *
+ * Description:
+ *   System call and scheduler load: short sleeps that go through the timer
+ *   interrupt, yields and semaphore operations.
+ *
+ ****************************************************************************/
+
+static void cpuhog_syscall(FAR uint8_t *buffer, size_t size)
+{
+  int i;
+
+  for (i = 0; i < 16; i++)
+    {
+      sem_wait(&g_state.sem);
+      sem_post(&g_state.sem);
+      g_sink += getpid();
+    }
+
+  sched_yield();
+  usleep(1);
+}
+
+/****************************************************************************
+ * Name: cpuhog_cache
+ *
+ * Description:
+ *   Cache thrashing: touch one word of every cache line of the buffer in
+ *   an order that defeats prefetching.  The buffer should be larger than
+ *   the data cache.
+ *
+ ****************************************************************************/
+
+static void cpuhog_cache(FAR uint8_t *buffer, size_t size)
+{
+  size_t nlines = size / CPUHOG_LINESIZE;
+  size_t line = g_sink % nlines;
+  int i;
+
+  for (i = 0; i < 256; i++)
+    {
+      /* Stepping by a large prime visits every line in a scattered
+       * order, unless the number of lines is a multiple of it.
+       */
+
+      line = (line + 40503) % nlines;
+      buffer[line * CPUHOG_LINESIZE]++;
+    }
+
+  g_sink = line;
+}
+
+/****************************************************************************
+ * Name: cpuhog_run
+ *
+ * Description:
+ *   Load the system with a profile for 'duty' percent of every period and
+ *   sleep for the rest, forever.
+ *
+ ****************************************************************************/
+
+static int cpuhog_run(FAR struct cpuhog_options_s *opts)
+{
+  FAR uint8_t *buffer = NULL;
+  uint32_t start;
+  uint32_t busy;
+  uint32_t now;
+  int ret;
+
+  if (opts->priority > 0)
+    {
+      struct sched_param param;
+
+      param.sched_priority = opts->priority;
+      ret = sched_setparam(0, &param);
+      if (ret < 0)
+        {
+          fprintf(stderr, "ERROR: sched_setparam failed: %d\n", errno);
+          return EXIT_FAILURE;
+        }
+    }
+
+#ifdef CONFIG_SMP
+  if (opts->cpu >= 0)
+    {
+      cpu_set_t cpuset;
+
+      CPU_ZERO(&cpuset);
+      CPU_SET(opts->cpu, &cpuset);
+      ret = sched_setaffinity(0, sizeof(cpu_set_t), &cpuset);
+      if (ret < 0)
+        {
+          fprintf(stderr, "ERROR: sched_setaffinity failed: %d\n", errno);
+          return EXIT_FAILURE;
+        }
+    }
+#endif
+
+  if (opts->profile->load == cpuhog_mem ||
+      opts->profile->load == cpuhog_cache)
+    {
+      buffer = (FAR uint8_t *)malloc(opts->size);
+      if (buffer == NULL)
+        {
+          fprintf(stderr, "ERROR: Failed to allocate %lu bytes\n",
+                  (unsigned long)opts->size);
+          return EXIT_FAILURE;
+        }
+
+      memset(buffer, 0, opts->size);
+    }
+
+  printf("cpuhog: %s load, %d%% of %d ms\n", opts->profile->name,
+         opts->duty, opts->period);
+
+  busy  = (uint32_t)opts->period * opts->duty / 100;
+  start = cpuhog_msec();
+
+  for (; ; )
+    {
+      do
+        {
+          opts->profile->load(buffer, opts->size);
+          now = cpuhog_msec();
+        }
+      while (now - start < busy);
+
+      /* Sleep until the next period, which starts on time even if the
+       * last unit of work overran the busy time.
+       */
+
+      start += opts->period;
+      now    = cpuhog_msec();
+      if ((int32_t)(start - now) > 0)
+        {
+          usleep((start - now) * 1000);
+        }
+      else
+        {
+          start = now;
+        }
+    }
+
+  free(buffer);
+  return EXIT_SUCCESS;
+}
+
+/****************************************************************************
+ * Name: cpuhog_showusage
+ ****************************************************************************/
+
+static void cpuhog_showusage(FAR const char *progname, int exitcode)
+{
+  int i;
+
+  fprintf(stderr, "USAGE: %s [-l <profile>] [-d <duty>] [-t <period>] "
+          "[-p <priority>]\n", progname);
+  fprintf(stderr, "          [-c <cpu>] [-s <size>]\n");
+  fprintf(stderr, "\nWithout options, the pipe and semaphore hog runs.  "
+          "Otherwise:\n");
+  fprintf(stderr, "\t-l <profile>: The load:");
+  for (i = 0; g_profiles[i].name != NULL; i++)
+    {
+      fprintf(stderr, " %s", g_profiles[i].name);
+    }
+
+  fprintf(stderr, ".  Default: spin\n");
+  fprintf(stderr, "\t-d <duty>: Percent of each period loaded.  "
+          "Default: 100\n");
+  fprintf(stderr, "\t-t <period>: Period in milliseconds.  "
+          "Default: 100\n");
+  fprintf(stderr, "\t-p <priority>: Run at this priority\n");
+#ifdef CONFIG_SMP
+  fprintf(stderr, "\t-c <cpu>: Run on this CPU only\n");
+#endif
+  fprintf(stderr, "\t-s <size>: Buffer of the mem and cache loads.  "
+          "Default: %d\n", CONFIG_EXAMPLES_CPUHOG_BUFSIZE);
+  exit(exitcode);
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -102,9 +389,12 @@ int main(int argc, FAR char *argv[])
 int cpuhog_main(int argc, char *argv[])
 #endif
 {
+  struct cpuhog_options_s opts;
   int id = -1;
   char buf[256];
   int fd = -1;
+  int option;
+  int i;
 
   if (!g_state.initialized)
     {
@@ -115,6 +405,76 @@ int cpuhog_main(int argc, char *argv[])
       printf("cpuhog initialized\n");
     }
 
+  /* Any option selects a load profile instead of the pipe hog below */
+
+  if (argc > 1)
+    {
+      opts.profile  = &g_profiles[0];
+      opts.duty     = 100;
+      opts.period   = 100;
+      opts.priority = 0;
+      opts.cpu      = -1;
+      opts.size     = CONFIG_EXAMPLES_CPUHOG_BUFSIZE;
+
+      while ((option = getopt(argc, argv, "l:d:t:p:c:s:h")) != ERROR)
+        {
+          switch (option)
+            {
+              case 'l':
+                for (i = 0; g_profiles[i].name != NULL &&
+                            strcmp(g_profiles[i].name, optarg) != 0; i++)
+                  {
+                  }
+
+                if (g_profiles[i].name == NULL)
+                  {
+                    fprintf(stderr, "ERROR: Unknown profile: %s\n", optarg);
+                    cpuhog_showusage(argv[0], EXIT_FAILURE);
+                  }
+
+                opts.profile = &g_profiles[i];
+                break;
+
+              case 'd':
+                opts.duty = atoi(optarg);
+                break;
+
+              case 't':
+                opts.period = atoi(optarg);
+                break;
+
+              case 'p':
+                opts.priority = atoi(optarg);
+                break;
+
+              case 'c':
+                opts.cpu = atoi(optarg);
+                break;
+
+              case 's':
+                opts.size = strtoul(optarg, NULL, 0);
+                break;
+
+              case 'h':
+                cpuhog_showusage(argv[0], EXIT_SUCCESS);
+                break;
+
+              default:
+                cpuhog_showusage(argv[0], EXIT_FAILURE);
+                break;
+            }
+        }
+
+      if (opts.duty < 1 || opts.duty > 100 || opts.period < 1 ||
+          opts.size < 2 * CPUHOG_LINESIZE)
+        {
+          fprintf(stderr, "ERROR: Bad load parameters\n");
+          cpuhog_showusage(argv[0], EXIT_FAILURE);
+        }
+
+      return cpuhog_run(&opts);
+    }
+
   while(1)
     {
       /* To test semaphore interaction (debugging system crashes...) */
@@ -41,7 +41,9 @@
 #include <nuttx/compiler.h>
 
 #include <sys/mount.h>
+#include <sys/wait.h>
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -49,6 +51,7 @@
 #include <pthread.h>
 #include <debug.h>
 #include <errno.h>
+#include <time.h>
 
 #include <nuttx/symtab.h>
 #include <nuttx/drivers/ramdisk.h>
@@ -101,6 +104,16 @@
 #  define CONFIG_EXAMPLES_ELF_DEVPATH "/dev/ram0"
 #endif
 
+#ifdef CONFIG_EXAMPLES_ELF_BENCH
+#  ifdef CONFIG_CLOCK_MONOTONIC
+#    define BENCH_CLOCK CLOCK_MONOTONIC
+#  else
+#    define BENCH_CLOCK CLOCK_REALTIME
+#  endif
+
+#  define NPROGRAMS ((int)(sizeof(dirlist) / sizeof(dirlist[0])) - 1)
+#endif
+
 /* If CONFIG_DEBUG_FEATURES is enabled, use info/err instead of printf so that the
  * output will be synchronous with the debug output.
  */
@@ -129,6 +142,19 @@
 #  endif
 #endif
 
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_ELF_BENCH
+struct bench_s
+{
+  uint32_t load_us;  /* Time spent in exec() */
+  int running;       /* Heap increase while the program runs */
+  int retained;      /* Heap increase after the program exited */
+};
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -143,6 +169,10 @@ static const char delimiter[] =
 static char fullpath[128];
 #endif
 
+#ifdef CONFIG_EXAMPLES_ELF_BENCH
+static struct bench_s g_bench[NPROGRAMS];
+#endif
+
 /****************************************************************************
  * Symbols from Auto-Generated Code
  ****************************************************************************/
@@ -210,6 +240,67 @@ static inline void testheader(FAR const char *progname)
   message("\n%s\n* Executing %s\n%s\n\n", delimiter, progname, delimiter);
 }
 
+/****************************************************************************
+ * Name: elf_bench_now, elf_bench_heap and elf_bench_report
+ *
+ * Description:
+ *   Record the cost of loading each program:  The time that exec() takes
+ *   to load, relocate and start the ELF program, the heap that is in
+ *   use while it runs and the heap that is still in use after it exits.
+ *   The ELF loader copies all sections, .text included, into RAM.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_ELF_BENCH
+static uint32_t elf_bench_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(BENCH_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int elf_bench_heap(void)
+{
+  struct mallinfo mmcurrent;
+
+#ifdef CONFIG_CAN_PASS_STRUCTS
+  mmcurrent = mallinfo();
+#else
+  (void)mallinfo(&mmcurrent);
+#endif
+
+  return mmcurrent.uordblks;
+}
+
+static void elf_bench_report(void)
+{
+  uint32_t load_us = 0;
+  int running = 0;
+  int retained = 0;
+  int i;
+
+  message("\nELF load benchmark:\n");
+  message("  %-16s %10s %12s %12s\n", "Program", "Load (us)",
+          "RAM running", "RAM retained");
+
+  for (i = 0; i < NPROGRAMS; i++)
+    {
+      message("  %-16s %10lu %12d %12d\n", dirlist[i],
+              (unsigned long)g_bench[i].load_us, g_bench[i].running,
+              g_bench[i].retained);
+
+      load_us  += g_bench[i].load_us;
+      running  += g_bench[i].running;
+      retained += g_bench[i].retained;
+    }
+
+  message("  %-16s %10lu %12d %12d\n", "Average",
+          (unsigned long)(load_us / NPROGRAMS), running / NPROGRAMS,
+          retained / NPROGRAMS);
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -225,6 +316,13 @@ int elf_main(int argc, char *argv[])
 #endif
 {
   FAR char *args[1];
+#ifdef CONFIG_EXAMPLES_ELF_BENCH
+  uint32_t start;
+#  ifdef CONFIG_SCHED_WAITPID
+  int status;
+#  endif
+  int heap;
+#endif
   int ret;
   int i;
 
@@ -311,7 +409,15 @@ int elf_main(int argc, char *argv[])
        */
 
       args[0] = NULL;
+#ifdef CONFIG_EXAMPLES_ELF_BENCH
+      heap  = elf_bench_heap();
+      start = elf_bench_now();
+#endif
       ret = exec(filename, args, exports, nexports);
+#ifdef CONFIG_EXAMPLES_ELF_BENCH
+      g_bench[i].load_us = elf_bench_now() - start;
+      g_bench[i].running = elf_bench_heap() - heap;
+#endif
 
       mm_update(&g_mmstep, "after exec");
 
@@ -321,13 +427,27 @@ int elf_main(int argc, char *argv[])
         }
       else
         {
+#if defined(CONFIG_EXAMPLES_ELF_BENCH) && defined(CONFIG_SCHED_WAITPID)
+          /* Wait for the exit so that the retained memory is accurate */
+
+          message("Wait for test completion\n");
+          (void)waitpid(ret, &status, 0);
+#else
           message("Wait a bit for test completion\n");
           sleep(4);
+#endif
         }
 
+#ifdef CONFIG_EXAMPLES_ELF_BENCH
+      g_bench[i].retained = elf_bench_heap() - heap;
+#endif
+
       mm_update(&g_mmstep, "after program execution");
     }
 
   mm_update(&g_mmstep, "End-of-Test");
+#ifdef CONFIG_EXAMPLES_ELF_BENCH
+  elf_bench_report();
+#endif
   return 0;
 }
@@ -52,6 +52,8 @@
 #include <nuttx/video/fb.h>
 #include <nuttx/video/rgbcolors.h>
 
+#include "graphics/blit.h"
+
 /****************************************************************************
  * Preprocessor Definitions
  ****************************************************************************/
@@ -104,64 +106,34 @@ static const uint8_t g_rgb8[NCOLORS] =
 static void draw_rect32(FAR struct fb_state_s *state,
                         FAR struct nxgl_rect_s *rect, int color)
 {
-  FAR uint32_t *dest;
   FAR uint8_t *row;
-  int x;
-  int y;
-
-  row = (FAR uint8_t *)state->fbmem + state->pinfo.stride * rect->pt1.y;
-  for (y = rect->pt1.y; y <= rect->pt2.y; y++)
-    {
-      dest = ((FAR uint32_t *)row) + rect->pt1.x;
-      for (x = rect->pt1.x; x <= rect->pt2.x; x++)
-        {
-          *dest++ = g_rgb24[color];
-        }
 
-      row += state->pinfo.stride;
-    }
+  row = (FAR uint8_t *)state->fbmem + state->pinfo.stride * rect->pt1.y +
+        rect->pt1.x * sizeof(uint32_t);
+  blit_fill32(row, state->pinfo.stride, rect->pt2.x - rect->pt1.x + 1,
+              rect->pt2.y - rect->pt1.y + 1, g_rgb24[color]);
 }
 
 static void draw_rect16(FAR struct fb_state_s *state,
                         FAR struct nxgl_rect_s *rect, int color)
 {
-  FAR uint16_t *dest;
   FAR uint8_t *row;
-  int x;
-  int y;
-
-  row = (FAR uint8_t *)state->fbmem + state->pinfo.stride * rect->pt1.y;
-  for (y = rect->pt1.y; y <= rect->pt2.y; y++)
-    {
-      dest = ((FAR uint16_t *)row) + rect->pt1.x;
-      for (x = rect->pt1.x; x <= rect->pt2.x; x++)
-        {
-          *dest++ = g_rgb16[color];
-        }
 
-      row += state->pinfo.stride;
-    }
+  row = (FAR uint8_t *)state->fbmem + state->pinfo.stride * rect->pt1.y +
+        rect->pt1.x * sizeof(uint16_t);
+  blit_fill16(row, state->pinfo.stride, rect->pt2.x - rect->pt1.x + 1,
+              rect->pt2.y - rect->pt1.y + 1, g_rgb16[color]);
 }
 
 static void draw_rect8(FAR struct fb_state_s *state,
                        FAR struct nxgl_rect_s *rect, int color)
 {
-  FAR uint8_t *dest;
   FAR uint8_t *row;
-  int x;
-  int y;
 
-  row = (FAR uint8_t *)state->fbmem + state->pinfo.stride * rect->pt1.y;
-  for (y = rect->pt1.y; y <= rect->pt2.y; y++)
-    {
-      dest = row + rect->pt1.x;
-      for (x = rect->pt1.x; x <= rect->pt2.x; x++)
-        {
-          *dest++ = g_rgb8[color];
-        }
-
-      row += state->pinfo.stride;
-    }
+  row = (FAR uint8_t *)state->fbmem + state->pinfo.stride * rect->pt1.y +
+        rect->pt1.x;
+  blit_fill8(row, state->pinfo.stride, rect->pt2.x - rect->pt1.x + 1,
+             rect->pt2.y - rect->pt1.y + 1, g_rgb8[color]);
 }
 
 static void draw_rect1(FAR struct fb_state_s *state,
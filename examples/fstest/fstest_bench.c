@@ -0,0 +1,550 @@
+/****************************************************************************
+ * apps/examples/fstest/fstest_bench.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/stat.h>
+#include <sys/statfs.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <time.h>
+#include <errno.h>
+
+#include "system/benchutil.h"
+
+#include "fstest.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_FSTEST_BENCH_FILESIZE
+#  define CONFIG_EXAMPLES_FSTEST_BENCH_FILESIZE 65536
+#endif
+
+#ifndef CONFIG_EXAMPLES_FSTEST_BENCH_NRANDOM
+#  define CONFIG_EXAMPLES_FSTEST_BENCH_NRANDOM 64
+#endif
+
+#ifndef CONFIG_EXAMPLES_FSTEST_BENCH_NSMALL
+#  define CONFIG_EXAMPLES_FSTEST_BENCH_NSMALL 32
+#endif
+
+#ifndef CONFIG_EXAMPLES_FSTEST_BENCH_SMALLSIZE
+#  define CONFIG_EXAMPLES_FSTEST_BENCH_SMALLSIZE 64
+#endif
+
+#define FSTEST_PATHMAX 128
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct fstest_bench_s
+{
+  FAR const char *mountpt;  /* Where the file system is mounted */
+  FAR uint8_t *buffer;      /* I/O buffer */
+  size_t iosize;            /* Size of each read or write */
+  size_t filesize;          /* Size of the file used for throughput */
+  char path[FSTEST_PATHMAX];
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: fstest_rate
+ *
+ * Description:
+ *   Show the throughput of nbytes transferred in elapsed microseconds.
+ *
+ ****************************************************************************/
+
+static void fstest_rate(FAR const char *what, size_t nbytes,
+                        uint64_t elapsed)
+{
+  if (elapsed == 0)
+    {
+      elapsed = 1;
+    }
+
+  printf("  %-16s %8lu bytes %8lu us %8lu KiB/s\n", what,
+         (unsigned long)nbytes, (unsigned long)elapsed,
+         (unsigned long)(((uint64_t)nbytes * 1000000 / 1024) / elapsed));
+}
+
+/****************************************************************************
+ * Name: fstest_latency
+ *
+ * Description:
+ *   Show the average latency of nops operations in elapsed microseconds.
+ *
+ ****************************************************************************/
+
+static void fstest_latency(FAR const char *what, int nops, uint64_t elapsed)
+{
+  if (nops > 0)
+    {
+      printf("  %-16s %8d ops   %8lu us/op %7lu ops/s\n", what, nops,
+             (unsigned long)(elapsed / nops),
+             (unsigned long)(elapsed > 0 ?
+                             (uint64_t)nops * 1000000 / elapsed : 0));
+    }
+}
+
+/****************************************************************************
+ * Name: fstest_bfree
+ *
+ * Description:
+ *   Return the number of free bytes in the file system, or a negative value
+ *   if the file system does not report it.
+ *
+ ****************************************************************************/
+
+static int64_t fstest_bfree(FAR struct fstest_bench_s *bench)
+{
+  struct statfs buf;
+
+  if (statfs(bench->mountpt, &buf) < 0 || buf.f_bsize == 0)
+    {
+      return -1;
+    }
+
+  return (int64_t)buf.f_bfree * buf.f_bsize;
+}
+
+/****************************************************************************
+ * Name: fstest_seqwrite
+ ****************************************************************************/
+
+static int fstest_seqwrite(FAR struct fstest_bench_s *bench)
+{
+  uint64_t start;
+  int64_t before;
+  int64_t after;
+  size_t nbytes;
+  ssize_t nwritten;
+  int fd;
+
+  before = fstest_bfree(bench);
+
+  start = benchutil_usec();
+  fd = open(bench->path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (fd < 0)
+    {
+      printf("ERROR: Failed to open %s: %d\n", bench->path, errno);
+      return ERROR;
+    }
+
+  for (nbytes = 0; nbytes < bench->filesize; nbytes += nwritten)
+    {
+      nwritten = write(fd, bench->buffer, bench->iosize);
+      if (nwritten <= 0)
+        {
+          printf("ERROR: Failed to write %s: %d\n", bench->path, errno);
+          close(fd);
+          return ERROR;
+        }
+    }
+
+  (void)fsync(fd);
+  close(fd);
+  fstest_rate("seq write", nbytes, benchutil_usec() - start);
+
+  /* The space consumed per byte written is the best measure of write
+   * amplification that is visible above the file system.
+   */
+
+  after = fstest_bfree(bench);
+  if (before >= 0 && after >= 0 && nbytes > 0)
+    {
+      printf("  %-16s %8lu bytes used for %lu written (x%lu.%02lu)\n",
+             "space", (unsigned long)(before - after),
+             (unsigned long)nbytes,
+             (unsigned long)((before - after) / nbytes),
+             (unsigned long)(((before - after) * 100 / nbytes) % 100));
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: fstest_seqread
+ ****************************************************************************/
+
+static int fstest_seqread(FAR struct fstest_bench_s *bench)
+{
+  uint64_t start;
+  size_t nbytes;
+  ssize_t nread;
+  int fd;
+
+  start = benchutil_usec();
+  fd = open(bench->path, O_RDONLY);
+  if (fd < 0)
+    {
+      printf("ERROR: Failed to open %s: %d\n", bench->path, errno);
+      return ERROR;
+    }
+
+  for (nbytes = 0; ; nbytes += nread)
+    {
+      nread = read(fd, bench->buffer, bench->iosize);
+      if (nread < 0)
+        {
+          printf("ERROR: Failed to read %s: %d\n", bench->path, errno);
+          close(fd);
+          return ERROR;
+        }
+
+      if (nread == 0)
+        {
+          break;
+        }
+    }
+
+  close(fd);
+  fstest_rate("seq read", nbytes, benchutil_usec() - start);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: fstest_random
+ *
+ * Description:
+ *   Read or write iosize bytes at random, iosize aligned offsets in the
+ *   file.
+ *
+ ****************************************************************************/
+
+static int fstest_random(FAR struct fstest_bench_s *bench, bool wr)
+{
+  uint64_t start;
+  size_t nslots;
+  size_t nbytes;
+  ssize_t ret;
+  off_t offset;
+  int fd;
+  int i;
+
+  nslots = bench->filesize / bench->iosize;
+  if (nslots == 0)
+    {
+      return OK;
+    }
+
+  start = benchutil_usec();
+  fd = open(bench->path, wr ? O_WRONLY : O_RDONLY);
+  if (fd < 0)
+    {
+      printf("ERROR: Failed to open %s: %d\n", bench->path, errno);
+      return ERROR;
+    }
+
+  nbytes = 0;
+  for (i = 0; i < CONFIG_EXAMPLES_FSTEST_BENCH_NRANDOM; i++)
+    {
+      offset = (off_t)(rand() % nslots) * bench->iosize;
+      if (lseek(fd, offset, SEEK_SET) != offset)
+        {
+          printf("ERROR: Failed to seek %s: %d\n", bench->path, errno);
+          close(fd);
+          return ERROR;
+        }
+
+      if (wr)
+        {
+          ret = write(fd, bench->buffer, bench->iosize);
+        }
+      else
+        {
+          ret = read(fd, bench->buffer, bench->iosize);
+        }
+
+      if (ret <= 0)
+        {
+          /* Some file systems (NXFFS) cannot rewrite existing data */
+
+          printf("  %-16s not supported: %d\n",
+                 wr ? "rand write" : "rand read", errno);
+          close(fd);
+          return OK;
+        }
+
+      nbytes += ret;
+    }
+
+  if (wr)
+    {
+      (void)fsync(fd);
+    }
+
+  close(fd);
+  fstest_rate(wr ? "rand write" : "rand read", nbytes, benchutil_usec() - start);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: fstest_smallfiles
+ *
+ * Description:
+ *   Measure the rate of creating, finding and deleting small files.
+ *
+ ****************************************************************************/
+
+static int fstest_smallfiles(FAR struct fstest_bench_s *bench)
+{
+  struct stat buf;
+  uint64_t tcreate;
+  uint64_t tstat;
+  uint64_t tdir;
+  uint64_t tunlink;
+  uint64_t start;
+  FAR DIR *dirp;
+  size_t size;
+  int ncreated;
+  int nentries;
+  int fd;
+  int i;
+
+  size = CONFIG_EXAMPLES_FSTEST_BENCH_SMALLSIZE;
+  if (size > bench->iosize)
+    {
+      size = bench->iosize;
+    }
+
+  start = benchutil_usec();
+  for (ncreated = 0; ncreated < CONFIG_EXAMPLES_FSTEST_BENCH_NSMALL;
+       ncreated++)
+    {
+      snprintf(bench->path, FSTEST_PATHMAX, "%s/fsb%03d.dat",
+               bench->mountpt, ncreated);
+
+      fd = open(bench->path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+      if (fd < 0)
+        {
+          break;
+        }
+
+      if (write(fd, bench->buffer, size) != size)
+        {
+          close(fd);
+          (void)unlink(bench->path);
+          break;
+        }
+
+      close(fd);
+    }
+
+  tcreate = benchutil_usec() - start;
+
+  start = benchutil_usec();
+  for (i = 0; i < ncreated; i++)
+    {
+      snprintf(bench->path, FSTEST_PATHMAX, "%s/fsb%03d.dat",
+               bench->mountpt, i);
+      (void)stat(bench->path, &buf);
+    }
+
+  tstat = benchutil_usec() - start;
+
+  start    = benchutil_usec();
+  nentries = 0;
+  dirp     = opendir(bench->mountpt);
+  if (dirp != NULL)
+    {
+      while (readdir(dirp) != NULL)
+        {
+          nentries++;
+        }
+
+      closedir(dirp);
+    }
+
+  tdir = benchutil_usec() - start;
+
+  start = benchutil_usec();
+  for (i = 0; i < ncreated; i++)
+    {
+      snprintf(bench->path, FSTEST_PATHMAX, "%s/fsb%03d.dat",
+               bench->mountpt, i);
+      (void)unlink(bench->path);
+    }
+
+  tunlink = benchutil_usec() - start;
+
+  fstest_latency("create", ncreated, tcreate);
+  fstest_latency("stat", ncreated, tstat);
+  fstest_latency("readdir", nentries, tdir);
+  fstest_latency("unlink", ncreated, tunlink);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: fstest_findfile
+ *
+ * Description:
+ *   Select the largest regular file at the mountpoint for the read only
+ *   tests.
+ *
+ ****************************************************************************/
+
+static int fstest_findfile(FAR struct fstest_bench_s *bench)
+{
+  char path[FSTEST_PATHMAX];
+  FAR struct dirent *entry;
+  struct stat buf;
+  FAR DIR *dirp;
+
+  bench->filesize = 0;
+
+  dirp = opendir(bench->mountpt);
+  if (dirp == NULL)
+    {
+      printf("ERROR: Failed to open %s: %d\n", bench->mountpt, errno);
+      return ERROR;
+    }
+
+  while ((entry = readdir(dirp)) != NULL)
+    {
+      snprintf(path, FSTEST_PATHMAX, "%s/%s", bench->mountpt,
+               entry->d_name);
+      if (stat(path, &buf) == 0 && S_ISREG(buf.st_mode) &&
+          buf.st_size > bench->filesize)
+        {
+          strcpy(bench->path, path);
+          bench->filesize = buf.st_size;
+        }
+    }
+
+  closedir(dirp);
+
+  if (bench->filesize == 0)
+    {
+      printf("ERROR: No file to read in %s\n", bench->mountpt);
+      return ERROR;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: fstest_bench
+ ****************************************************************************/
+
+int fstest_bench(FAR const char *mountpt, size_t iosize, bool readonly)
+{
+  struct fstest_bench_s bench;
+  int ret;
+
+  memset(&bench, 0, sizeof(struct fstest_bench_s));
+  bench.mountpt  = mountpt;
+  bench.iosize   = iosize;
+  bench.filesize = CONFIG_EXAMPLES_FSTEST_BENCH_FILESIZE;
+
+  bench.buffer = (FAR uint8_t *)malloc(iosize);
+  if (bench.buffer == NULL)
+    {
+      printf("ERROR: Failed to allocate %lu bytes\n", (unsigned long)iosize);
+      return ERROR;
+    }
+
+  memset(bench.buffer, 0x5a, iosize);
+
+  printf("\n=== BENCHMARK %s, %lu byte I/O ===\n", mountpt,
+         (unsigned long)iosize);
+
+  if (readonly)
+    {
+      ret = fstest_findfile(&bench);
+      if (ret == OK)
+        {
+          printf("  Reading %s\n", bench.path);
+          ret = fstest_seqread(&bench);
+        }
+
+      if (ret == OK)
+        {
+          ret = fstest_random(&bench, false);
+        }
+
+      goto errout_with_buffer;
+    }
+
+  snprintf(bench.path, FSTEST_PATHMAX, "%s/fsbench.dat", mountpt);
+
+  ret = fstest_seqwrite(&bench);
+  if (ret == OK)
+    {
+      ret = fstest_seqread(&bench);
+    }
+
+  if (ret == OK)
+    {
+      ret = fstest_random(&bench, false);
+    }
+
+  if (ret == OK)
+    {
+      ret = fstest_random(&bench, true);
+    }
+
+  (void)unlink(bench.path);
+
+  if (ret == OK)
+    {
+      ret = fstest_smallfiles(&bench);
+    }
+
+errout_with_buffer:
+  free(bench.buffer);
+  return ret;
+}
@@ -52,6 +52,8 @@
 #include <crc32.h>
 #include <debug.h>
 
+#include "fstest.h"
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -90,6 +92,10 @@
 #  define CONFIG_EXAMPLES_FSTEST_VERBOSE 0
 #endif
 
+#ifndef CONFIG_EXAMPLES_FSTEST_BENCH_IOSIZE
+#  define CONFIG_EXAMPLES_FSTEST_BENCH_IOSIZE 512
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -748,6 +754,22 @@ static int fstest_directory(void)
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: fstest_showusage
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_FSTEST_BENCH
+static void fstest_showusage(FAR const char *progname)
+{
+  printf("USAGE: %s [-b [-r] [-s <iosize>]]\n", progname);
+  printf("  -b  Benchmark %s instead of testing it\n",
+         CONFIG_EXAMPLES_FSTEST_MOUNTPT);
+  printf("  -r  Run only the read benchmarks (read-only file systems)\n");
+  printf("  -s  Size of each read or write (default %d)\n",
+         CONFIG_EXAMPLES_FSTEST_BENCH_IOSIZE);
+}
+#endif
+
 /****************************************************************************
  * Name: fstest_main
  ****************************************************************************/
@@ -760,11 +782,53 @@ int fstest_main(int argc, char *argv[])
 {
   unsigned int i;
   int ret;
+#ifdef CONFIG_EXAMPLES_FSTEST_BENCH
+  size_t iosize = CONFIG_EXAMPLES_FSTEST_BENCH_IOSIZE;
+  bool readonly = false;
+  bool bench = false;
+  int option;
+#endif
 
   /* Seed the random number generated */
 
   srand(0x93846);
 
+#ifdef CONFIG_EXAMPLES_FSTEST_BENCH
+  while ((option = getopt(argc, argv, ":brs:")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'b':
+            bench = true;
+            break;
+
+          case 'r':
+            readonly = true;
+            break;
+
+          case 's':
+            iosize = strtoul(optarg, NULL, 0);
+            if (iosize == 0)
+              {
+                fstest_showusage(argv[0]);
+                return EXIT_FAILURE;
+              }
+            break;
+
+          default:
+            fstest_showusage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+  if (bench)
+    {
+      ret = fstest_bench(CONFIG_EXAMPLES_FSTEST_MOUNTPT, iosize, readonly);
+      fflush(stdout);
+      return ret < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+#endif
+
   /* Set up memory monitoring */
 
 #ifdef CONFIG_CAN_PASS_STRUCTS
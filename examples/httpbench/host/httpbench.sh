@@ -0,0 +1,84 @@
+#!/bin/bash
+############################################################################
+# examples/httpbench/host/httpbench.sh
+#
+#   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+#   Author: Gregory Nutt <gnutt@nuttx.org>
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+# 3. Neither the name NuttX nor the names of its contributors may be
+#    used to endorse or promote products derived from this software
+#    without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+# OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+# AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+############################################################################
+
+# Run the host build of httpbench against one or more servers with an
+# increasing number of concurrent keep-alive clients.
+#
+# USAGE: host/httpbench.sh [httpbench options] <url> [<url> ...]
+#
+# Run from the apps/examples/httpbench directory.  The httpbench options
+# (-d, -n) are passed on for every run; see "httpbench -h".  Set CLIENTS
+# to change the client counts swept.  To record the heap high-water marks
+# of the board at the same time, run "httpbench -m -d <secs>" on the
+# target for the duration of the sweep.
+
+if [ ! -f Makefile.host ]; then
+  echo "ERROR: This script must be executed from the apps/examples/httpbench directory"
+  exit 1
+fi
+
+topdir=${TOPDIR:-../../../nuttx}
+appdir=${APPDIR:-$(cd ../.. && pwd)}
+clients=${CLIENTS:-"1 2 4 8 16"}
+
+make="make -f Makefile.host TOPDIR=${topdir} APPDIR=${appdir}"
+
+${make} >/dev/null || exit 1
+
+options=""
+while [ $# -gt 1 ]; do
+  case "$1" in
+    -d|-n)
+      options="${options} $1 $2"
+      shift 2
+      ;;
+    *)
+      break
+      ;;
+  esac
+done
+
+if [ $# -lt 1 ]; then
+  echo "USAGE: $0 [-d <secs>] [-n <requests>] <url> [<url> ...]"
+  exit 1
+fi
+
+./httpbench -H
+for url in "$@"; do
+  for count in ${clients}; do
+    ./httpbench ${options} -c ${count} -t "${url#http://}" "${url}"
+  done
+done
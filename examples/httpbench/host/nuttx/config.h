@@ -0,0 +1,85 @@
+/****************************************************************************
+ * apps/examples/httpbench/host/nuttx/config.h
+ * Host build configuration for httpbench
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_EXAMPLES_HTTPBENCH_HOST_NUTTX_CONFIG_H
+#define __APPS_EXAMPLES_HTTPBENCH_HOST_NUTTX_CONFIG_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#define _GNU_SOURCE 1
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <assert.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Environment stuff */
+
+#define OK 0
+#define ERROR -1
+#define FAR
+#define DEBUGASSERT assert
+
+#define zalloc(s)    calloc(1, s)
+#define set_errno(e) do { errno = (e); } while (0)
+
+typedef void *(*pthread_startroutine_t)(void *);
+
+/* Configuration.  The sizes may be overridden on the compiler command
+ * line (see Makefile.host).
+ */
+
+#define CONFIG_EXAMPLES_HTTPBENCH 1
+#define CONFIG_EXAMPLES_HTTPBENCH_HOST 1
+#ifndef CONFIG_EXAMPLES_HTTPBENCH_MAXCLIENTS
+#  define CONFIG_EXAMPLES_HTTPBENCH_MAXCLIENTS 256
+#endif
+
+#define CONFIG_NETUTILS_WEBCLIENT 1
+#define CONFIG_WEBCLIENT_SESSION 1
+#ifndef CONFIG_WEBCLIENT_BUFSIZE
+#  define CONFIG_WEBCLIENT_BUFSIZE 1024
+#endif
+
+#define CONFIG_CLOCK_MONOTONIC 1
+
+#endif /* __APPS_EXAMPLES_HTTPBENCH_HOST_NUTTX_CONFIG_H */
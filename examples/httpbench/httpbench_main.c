@@ -0,0 +1,618 @@
+/****************************************************************************
+ * apps/examples/httpbench/httpbench_main.c
+ * HTTP client/server throughput benchmark
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include <errno.h>
+
+#ifndef CONFIG_EXAMPLES_HTTPBENCH_HOST
+#  include <malloc.h>
+#endif
+
+#include "netutils/netlib.h"
+#include "netutils/webclient.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_HTTPBENCH_CLIENTS
+#  define CONFIG_EXAMPLES_HTTPBENCH_CLIENTS 4
+#endif
+
+#ifndef CONFIG_EXAMPLES_HTTPBENCH_MAXCLIENTS
+#  define CONFIG_EXAMPLES_HTTPBENCH_MAXCLIENTS 16
+#endif
+
+#ifndef CONFIG_EXAMPLES_HTTPBENCH_CLIENT_STACKSIZE
+#  define CONFIG_EXAMPLES_HTTPBENCH_CLIENT_STACKSIZE 2048
+#endif
+
+#ifndef CONFIG_EXAMPLES_HTTPBENCH_DURATION
+#  define CONFIG_EXAMPLES_HTTPBENCH_DURATION 10
+#endif
+
+#ifndef CONFIG_EXAMPLES_HTTPBENCH_SAMPLEMS
+#  define CONFIG_EXAMPLES_HTTPBENCH_SAMPLEMS 100
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define HTTPBENCH_CLOCK CLOCK_MONOTONIC
+#else
+#  define HTTPBENCH_CLOCK CLOCK_REALTIME
+#endif
+
+/* Latencies are kept in a log-linear histogram: 8 buckets per power of
+ * two, so a reported percentile is within 12.5% of the true value.
+ */
+
+#define HTTPBENCH_SUBBITS  3
+#define HTTPBENCH_NSUB     (1 << HTTPBENCH_SUBBITS)
+#define HTTPBENCH_NBUCKETS ((32 - HTTPBENCH_SUBBITS + 1) * HTTPBENCH_NSUB)
+
+/* Back off after a failed request so that a dead server is not hammered */
+
+#define HTTPBENCH_ERRDELAY 10000
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct httpbench_client_s
+{
+  pthread_t thread;
+  uint32_t nreqs;                    /* Successful requests */
+  uint32_t nerrors;                  /* Failed requests */
+  uint64_t nbytes;                   /* Body bytes received */
+  uint32_t maxus;                    /* Slowest request */
+  uint32_t hist[HTTPBENCH_NBUCKETS]; /* Latency histogram */
+};
+
+struct httpbench_heap_s
+{
+  unsigned long base;                /* Heap in use at the start */
+  unsigned long peak;                /* Highest heap in use */
+  unsigned long minfree;             /* Lowest free heap */
+  unsigned long minchunk;            /* Smallest largest free chunk */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static char g_hostname[CONFIG_WEBCLIENT_MAXHOSTNAME];
+static char g_path[CONFIG_WEBCLIENT_MAXFILENAME];
+static uint16_t g_port;
+static uint32_t g_nrequests;
+static volatile bool g_stop;
+
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+static int g_nactive;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: httpbench_usec
+ ****************************************************************************/
+
+static uint64_t httpbench_usec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(HTTPBENCH_CLOCK, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * Name: httpbench_bucket
+ *
+ * Description:
+ *   Map a latency in microseconds to its histogram bucket.
+ *
+ ****************************************************************************/
+
+static int httpbench_bucket(uint32_t us)
+{
+  int msb;
+
+  if (us < HTTPBENCH_NSUB)
+    {
+      return us;
+    }
+
+  msb = 31;
+  while ((us & (UINT32_C(1) << msb)) == 0)
+    {
+      msb--;
+    }
+
+  return (msb - HTTPBENCH_SUBBITS + 1) * HTTPBENCH_NSUB +
+         ((us >> (msb - HTTPBENCH_SUBBITS)) & (HTTPBENCH_NSUB - 1));
+}
+
+/****************************************************************************
+ * Name: httpbench_bucketmax
+ *
+ * Description:
+ *   Return the largest latency that falls into a histogram bucket.
+ *
+ ****************************************************************************/
+
+static uint32_t httpbench_bucketmax(int bucket)
+{
+  int shift;
+
+  if (bucket < HTTPBENCH_NSUB)
+    {
+      return bucket;
+    }
+
+  shift = bucket / HTTPBENCH_NSUB - 1;
+  return (((uint32_t)(HTTPBENCH_NSUB + bucket % HTTPBENCH_NSUB)) << shift) +
+         (UINT32_C(1) << shift) - 1;
+}
+
+/****************************************************************************
+ * Name: httpbench_percentile
+ ****************************************************************************/
+
+static double httpbench_percentile(FAR const uint32_t *hist, uint32_t total,
+                                   int percent, uint32_t maxus)
+{
+  uint64_t target = ((uint64_t)total * percent + 99) / 100;
+  uint64_t count = 0;
+  uint32_t us;
+  int i;
+
+  for (i = 0; i < HTTPBENCH_NBUCKETS; i++)
+    {
+      count += hist[i];
+      if (count >= target)
+        {
+          us = httpbench_bucketmax(i);
+          return (us < maxus ? us : maxus) / 1000.0;
+        }
+    }
+
+  return maxus / 1000.0;
+}
+
+/****************************************************************************
+ * Name: httpbench_heapsample
+ *
+ * Description:
+ *   Fold the current heap usage into the high-water marks.  The heap is
+ *   shared by every task on the board, so a server running alongside is
+ *   included.
+ *
+ ****************************************************************************/
+
+static void httpbench_heapsample(FAR struct httpbench_heap_s *heap)
+{
+#ifndef CONFIG_EXAMPLES_HTTPBENCH_HOST
+  struct mallinfo mem;
+
+  mem = mallinfo();
+  if ((unsigned long)mem.uordblks > heap->peak)
+    {
+      heap->peak = mem.uordblks;
+    }
+
+  if ((unsigned long)mem.fordblks < heap->minfree)
+    {
+      heap->minfree = mem.fordblks;
+    }
+
+  if ((unsigned long)mem.mxordblk < heap->minchunk)
+    {
+      heap->minchunk = mem.mxordblk;
+    }
+#else
+  (void)heap;
+#endif
+}
+
+/****************************************************************************
+ * Name: httpbench_heapinit
+ ****************************************************************************/
+
+static void httpbench_heapinit(FAR struct httpbench_heap_s *heap)
+{
+#ifndef CONFIG_EXAMPLES_HTTPBENCH_HOST
+  struct mallinfo mem;
+
+  mem = mallinfo();
+  heap->base     = mem.uordblks;
+  heap->peak     = mem.uordblks;
+  heap->minfree  = mem.fordblks;
+  heap->minchunk = mem.mxordblk;
+#else
+  memset(heap, 0, sizeof(struct httpbench_heap_s));
+#endif
+}
+
+/****************************************************************************
+ * Name: httpbench_sink
+ ****************************************************************************/
+
+static int httpbench_sink(FAR const char *data, size_t len, FAR void *arg)
+{
+  FAR struct httpbench_client_s *client = (FAR struct httpbench_client_s *)arg;
+
+  (void)data;
+  client->nbytes += len;
+  return (int)len;
+}
+
+/****************************************************************************
+ * Name: httpbench_client
+ *
+ * Description:
+ *   One client: issue requests back to back on one keep-alive session
+ *   until told to stop or until the request count is reached.
+ *
+ ****************************************************************************/
+
+static FAR void *httpbench_client(FAR void *arg)
+{
+  FAR struct httpbench_client_s *client = (FAR struct httpbench_client_s *)arg;
+  FAR struct webclient_session_s *ws;
+  uint64_t start;
+  uint32_t us;
+  int ret;
+
+  ws = webclient_open(g_hostname, g_port);
+  if (ws != NULL)
+    {
+      while (!g_stop && (g_nrequests == 0 ||
+                         client->nreqs + client->nerrors < g_nrequests))
+        {
+          start = httpbench_usec();
+          ret   = webclient_request(ws, "GET", g_path, NULL, NULL, 0,
+                                    httpbench_sink, client);
+          us    = (uint32_t)(httpbench_usec() - start);
+
+          if (ret >= 200 && ret < 300)
+            {
+              client->nreqs++;
+              client->hist[httpbench_bucket(us)]++;
+              if (us > client->maxus)
+                {
+                  client->maxus = us;
+                }
+            }
+          else
+            {
+              client->nerrors++;
+              usleep(HTTPBENCH_ERRDELAY);
+            }
+        }
+
+      webclient_close(ws);
+    }
+
+  pthread_mutex_lock(&g_lock);
+  g_nactive--;
+  pthread_mutex_unlock(&g_lock);
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: httpbench_heading
+ ****************************************************************************/
+
+static void httpbench_heading(void)
+{
+  printf("%-24s %4s %8s %6s %7s %8s %8s %8s %8s %8s %8s %8s %8s %8s\n",
+         "Label", "Conc", "Requests", "Errors", "Secs", "Req/s", "KB/s",
+         "p50(ms)", "p90(ms)", "p99(ms)", "Max(ms)", "HeapPeak",
+         "MinFree", "MinChunk");
+}
+
+/****************************************************************************
+ * Name: httpbench_showusage
+ ****************************************************************************/
+
+static void httpbench_showusage(FAR const char *progname, int exitcode)
+{
+  fprintf(stderr, "USAGE: %s [OPTIONS] <url>\n", progname);
+  fprintf(stderr, "       %s -m [-d <secs>]\n", progname);
+  fprintf(stderr, "       %s -H\n", progname);
+  fprintf(stderr, "\nWhere OPTIONS include the following:\n");
+  fprintf(stderr, "\t-c <n>: Concurrent keep-alive clients (1-%d).  "
+                  "Default: %d\n",
+          CONFIG_EXAMPLES_HTTPBENCH_MAXCLIENTS,
+          CONFIG_EXAMPLES_HTTPBENCH_CLIENTS);
+  fprintf(stderr, "\t-n <n>: Requests per client.  Default: No limit\n");
+  fprintf(stderr, "\t-d <secs>: Maximum duration of the run; 0 for none "
+                  "with -n.\n");
+  fprintf(stderr, "\t\tDefault: %d\n", CONFIG_EXAMPLES_HTTPBENCH_DURATION);
+  fprintf(stderr, "\t-t <label>: Label of the result line.  "
+                  "Default: <url>\n");
+  fprintf(stderr, "\t-m: Generate no load; only record the heap high-water\n");
+  fprintf(stderr, "\t\tmarks while another machine drives the server\n");
+  fprintf(stderr, "\t-H: Show the heading of the result line and exit\n");
+  fprintf(stderr, "\t-h: Show this text and exit\n");
+  fprintf(stderr, "\nHeap figures are in bytes: the peak increase in use "
+                  "over the start\n");
+  fprintf(stderr, "of the run, the lowest free heap and the smallest "
+                  "largest free chunk\n");
+  fprintf(stderr, "seen.  They are not available in the host build.\n");
+  exit(exitcode);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: httpbench_main
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int httpbench_main(int argc, char *argv[])
+#endif
+{
+  FAR struct httpbench_client_s *clients;
+  struct httpbench_heap_s heap;
+  pthread_attr_t attr;
+  FAR const char *label = NULL;
+  FAR const char *url;
+  uint32_t hist[HTTPBENCH_NBUCKETS];
+  uint64_t nbytes = 0;
+  uint64_t start;
+  uint64_t deadline;
+  uint32_t nreqs = 0;
+  uint32_t nerrors = 0;
+  uint32_t maxus = 0;
+  double secs;
+  bool monitor = false;
+  int nclients = CONFIG_EXAMPLES_HTTPBENCH_CLIENTS;
+  int duration = CONFIG_EXAMPLES_HTTPBENCH_DURATION;
+  int option;
+  int ret;
+  int i;
+  int j;
+
+  g_nrequests = 0;
+  while ((option = getopt(argc, argv, ":c:d:hHmn:t:")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'c':
+            nclients = atoi(optarg);
+            if (nclients < 1 || nclients > CONFIG_EXAMPLES_HTTPBENCH_MAXCLIENTS)
+              {
+                fprintf(stderr, "ERROR: Bad client count: %s\n", optarg);
+                httpbench_showusage(argv[0], EXIT_FAILURE);
+              }
+            break;
+
+          case 'd':
+            duration = atoi(optarg);
+            break;
+
+          case 'h':
+            httpbench_showusage(argv[0], EXIT_SUCCESS);
+            break;
+
+          case 'H':
+            httpbench_heading();
+            return EXIT_SUCCESS;
+
+          case 'm':
+            monitor = true;
+            break;
+
+          case 'n':
+            g_nrequests = strtoul(optarg, NULL, 10);
+            break;
+
+          case 't':
+            label = optarg;
+            break;
+
+          case ':':
+            fprintf(stderr, "ERROR: Missing required argument\n");
+            httpbench_showusage(argv[0], EXIT_FAILURE);
+            break;
+
+          case '?':
+          default:
+            fprintf(stderr, "ERROR: Unrecognized option\n");
+            httpbench_showusage(argv[0], EXIT_FAILURE);
+            break;
+        }
+    }
+
+  if (duration <= 0 && (monitor || g_nrequests == 0))
+    {
+      fprintf(stderr, "ERROR: Nothing limits the run\n");
+      httpbench_showusage(argv[0], EXIT_FAILURE);
+    }
+
+  if (monitor)
+    {
+      nclients = 0;
+      url      = "heap";
+    }
+  else if (optind >= argc)
+    {
+      fprintf(stderr, "ERROR: Missing required 'url' argument\n");
+      httpbench_showusage(argv[0], EXIT_FAILURE);
+    }
+  else
+    {
+      url    = argv[optind];
+      g_port = 80;
+      ret    = netlib_parsehttpurl(url, &g_port,
+                                   g_hostname, sizeof(g_hostname),
+                                   g_path, sizeof(g_path));
+      if (ret < 0)
+        {
+          fprintf(stderr, "ERROR: Malformed URL: %s\n", url);
+          return EXIT_FAILURE;
+        }
+    }
+
+  clients = (FAR struct httpbench_client_s *)
+    calloc(nclients > 0 ? nclients : 1, sizeof(struct httpbench_client_s));
+  if (clients == NULL)
+    {
+      fprintf(stderr, "ERROR: Failed to allocate the clients\n");
+      return EXIT_FAILURE;
+    }
+
+  /* The clients are started after the heap baseline so that their own
+   * sessions count against the high-water mark.
+   */
+
+  httpbench_heapinit(&heap);
+
+  g_stop    = false;
+  g_nactive = nclients;
+  start     = httpbench_usec();
+  deadline  = start + (uint64_t)duration * 1000000;
+
+  (void)pthread_attr_init(&attr);
+  (void)pthread_attr_setstacksize(&attr,
+                                  CONFIG_EXAMPLES_HTTPBENCH_CLIENT_STACKSIZE);
+
+  for (i = 0; i < nclients; i++)
+    {
+      ret = pthread_create(&clients[i].thread, &attr, httpbench_client,
+                           &clients[i]);
+      if (ret != 0)
+        {
+          fprintf(stderr, "ERROR: pthread_create failed: %d\n", ret);
+          g_stop = true;
+          pthread_mutex_lock(&g_lock);
+          g_nactive -= nclients - i;
+          pthread_mutex_unlock(&g_lock);
+          nclients = i;
+          break;
+        }
+    }
+
+  (void)pthread_attr_destroy(&attr);
+
+  /* Sample the heap until the run is over */
+
+  for (; ; )
+    {
+      httpbench_heapsample(&heap);
+      if (g_nactive == 0 ||
+          (duration > 0 && httpbench_usec() >= deadline))
+        {
+          break;
+        }
+
+      usleep(CONFIG_EXAMPLES_HTTPBENCH_SAMPLEMS * 1000);
+    }
+
+  g_stop = true;
+  for (i = 0; i < nclients; i++)
+    {
+      (void)pthread_join(clients[i].thread, NULL);
+    }
+
+  secs = (httpbench_usec() - start) / 1e6;
+  httpbench_heapsample(&heap);
+
+  /* Merge the per-client statistics */
+
+  memset(hist, 0, sizeof(hist));
+  for (i = 0; i < nclients; i++)
+    {
+      nreqs   += clients[i].nreqs;
+      nerrors += clients[i].nerrors;
+      nbytes  += clients[i].nbytes;
+      if (clients[i].maxus > maxus)
+        {
+          maxus = clients[i].maxus;
+        }
+
+      for (j = 0; j < HTTPBENCH_NBUCKETS; j++)
+        {
+          hist[j] += clients[i].hist[j];
+        }
+    }
+
+  free(clients);
+
+  printf("%-24s %4d %8lu %6lu %7.2f %8.1f %8.1f ",
+         label != NULL ? label : url, nclients, (unsigned long)nreqs,
+         (unsigned long)nerrors, secs, nreqs / secs,
+         nbytes / 1024.0 / secs);
+
+  if (nreqs > 0)
+    {
+      printf("%8.2f %8.2f %8.2f %8.2f ",
+             httpbench_percentile(hist, nreqs, 50, maxus),
+             httpbench_percentile(hist, nreqs, 90, maxus),
+             httpbench_percentile(hist, nreqs, 99, maxus),
+             maxus / 1000.0);
+    }
+  else
+    {
+      printf("%8s %8s %8s %8s ", "-", "-", "-", "-");
+    }
+
+#ifndef CONFIG_EXAMPLES_HTTPBENCH_HOST
+  printf("%8lu %8lu %8lu\n", heap.peak - heap.base, heap.minfree,
+         heap.minchunk);
+#else
+  printf("%8s %8s %8s\n", "-", "-", "-");
+#endif
+
+  return nerrors > 0 && nreqs == 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
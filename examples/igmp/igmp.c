@@ -41,6 +41,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <debug.h>
 
@@ -129,6 +130,14 @@ int igmp_main(int argc, char *argv[])
 
   netlib_ifup("eth0");
 
+#ifdef CONFIG_EXAMPLES_IGMP_BENCH
+  if (argc > 1 &&
+      (strcmp(argv[1], "-b") == 0 || strcmp(argv[1], "-s") == 0))
+    {
+      return igmp_bench(argc, argv);
+    }
+#endif
+
   /* Not much of a test for now */
   /* Join the group */
 
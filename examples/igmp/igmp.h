@@ -50,4 +50,8 @@
  * Public Function Prototypes
  ****************************************************************************/
 
+#ifdef CONFIG_EXAMPLES_IGMP_BENCH
+int igmp_bench(int argc, FAR char *argv[]);
+#endif
+
 #endif /* __EXAMPLES_IGMP_H */
@@ -0,0 +1,625 @@
+/****************************************************************************
+ * examples/igmp/igmp_bench.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include "netutils/ipmsfilter.h"
+#include "system/benchutil.h"
+
+#include "igmp.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_IGMP_BENCH_PORT
+#  define CONFIG_EXAMPLES_IGMP_BENCH_PORT 5472
+#endif
+
+#ifndef CONFIG_EXAMPLES_IGMP_BENCH_MAXGROUPS
+#  define CONFIG_EXAMPLES_IGMP_BENCH_MAXGROUPS 64
+#endif
+
+#ifndef CONFIG_EXAMPLES_IGMP_BENCH_GROUPS
+#  define CONFIG_EXAMPLES_IGMP_BENCH_GROUPS 4
+#endif
+
+#ifndef CONFIG_EXAMPLES_IGMP_BENCH_TABLES
+#  define CONFIG_EXAMPLES_IGMP_BENCH_TABLES "1,4,16,64"
+#endif
+
+#ifndef CONFIG_EXAMPLES_IGMP_BENCH_RATE
+#  define CONFIG_EXAMPLES_IGMP_BENCH_RATE 100
+#endif
+
+#ifndef CONFIG_EXAMPLES_IGMP_BENCH_LENGTH
+#  define CONFIG_EXAMPLES_IGMP_BENCH_LENGTH 64
+#endif
+
+#ifndef CONFIG_EXAMPLES_IGMP_BENCH_DURATION
+#  define CONFIG_EXAMPLES_IGMP_BENCH_DURATION 10
+#endif
+
+#define IGMP_BENCH_MAGIC    0x49474d50  /* "IGMP" */
+#define IGMP_BENCH_MAXLEN   1472
+#define IGMP_BENCH_MAXSTEPS 8
+#define IGMP_BENCH_TICK     1000        /* Sender pacing interval (usec) */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The payload header, all fields in network byte order */
+
+struct igmp_bench_hdr_s
+{
+  uint32_t magic;
+  uint32_t group;   /* Index of the destination group */
+  uint32_t seq;     /* Per group sequence number */
+};
+
+struct igmp_bench_group_s
+{
+  uint32_t nrecvd;
+  uint32_t nlost;
+  uint32_t nextseq;
+  bool     seen;
+};
+
+struct igmp_bench_s
+{
+  int ngroups;      /* Sender: Groups streamed to */
+  int rate;         /* Sender: Packets per second per group */
+  int length;       /* Sender: UDP payload length */
+  int duration;     /* Seconds per measurement */
+  int tables[IGMP_BENCH_MAXSTEPS];
+  int ntables;      /* Receiver: Group table sizes swept */
+  struct igmp_bench_group_s group[CONFIG_EXAMPLES_IGMP_BENCH_MAXGROUPS];
+  uint8_t buffer[IGMP_BENCH_MAXLEN];
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void igmp_bench_grpaddr(int index, FAR struct in_addr *addr)
+{
+  addr->s_addr = HTONL(CONFIG_EXAMPLES_IGMP_GRPADDR + index);
+}
+
+static int igmp_bench_parse(FAR const char *str, FAR int *values)
+{
+  FAR char *end;
+  long value;
+  int n = 0;
+
+  while (*str != '\0' && n < IGMP_BENCH_MAXSTEPS)
+    {
+      value = strtol(str, &end, 10);
+      if (end == str || value < 1 ||
+          value > CONFIG_EXAMPLES_IGMP_BENCH_MAXGROUPS)
+        {
+          return -EINVAL;
+        }
+
+      values[n++] = (int)value;
+      str = end;
+      if (*str == ',')
+        {
+          str++;
+        }
+      else if (*str != '\0')
+        {
+          return -EINVAL;
+        }
+    }
+
+  return n > 0 ? n : -EINVAL;
+}
+
+static void igmp_bench_usage(FAR const char *progname)
+{
+  fprintf(stderr, "USAGE:\n");
+  fprintf(stderr, "  %s -b [-m tables] [-t secs]\n", progname);
+  fprintf(stderr, "  %s -s [-g groups] [-r rate] [-l length] [-t secs]\n",
+          progname);
+  fprintf(stderr, "Where:\n");
+  fprintf(stderr, "  -b: Receive, sweeping the joined group table sizes\n");
+  fprintf(stderr, "  -s: Stream to the first 'groups' groups\n");
+  fprintf(stderr, "  -m: Table sizes, comma separated.  Default: %s\n",
+          CONFIG_EXAMPLES_IGMP_BENCH_TABLES);
+  fprintf(stderr, "  -g: Groups streamed to.  Default: %d\n",
+          CONFIG_EXAMPLES_IGMP_BENCH_GROUPS);
+  fprintf(stderr, "  -r: Packets per second per group.  Default: %d\n",
+          CONFIG_EXAMPLES_IGMP_BENCH_RATE);
+  fprintf(stderr, "  -l: UDP payload length.  Default: %d\n",
+          CONFIG_EXAMPLES_IGMP_BENCH_LENGTH);
+  fprintf(stderr, "  -t: Seconds per measurement.  Default: %d\n",
+          CONFIG_EXAMPLES_IGMP_BENCH_DURATION);
+  fprintf(stderr, "Groups are consecutive from 0x%08lx, port %d\n",
+          (unsigned long)CONFIG_EXAMPLES_IGMP_GRPADDR,
+          CONFIG_EXAMPLES_IGMP_BENCH_PORT);
+}
+
+/****************************************************************************
+ * Name: igmp_bench_send
+ *
+ * Description:
+ *   Stream 'rate' packets per second to each of the first 'ngroups' groups
+ *   for 'duration' seconds.
+ *
+ ****************************************************************************/
+
+static int igmp_bench_send(FAR struct igmp_bench_s *bench)
+{
+  FAR struct igmp_bench_hdr_s *hdr =
+    (FAR struct igmp_bench_hdr_s *)bench->buffer;
+  struct sockaddr_in addr;
+  uint32_t seq[CONFIG_EXAMPLES_IGMP_BENCH_MAXGROUPS];
+  uint64_t start;
+  uint64_t elapsed;
+  uint64_t due;
+  uint64_t nsent = 0;
+  uint32_t nerrors = 0;
+  int load;
+  int ret;
+  int sd;
+  int i;
+
+  sd = socket(PF_INET, SOCK_DGRAM, 0);
+  if (sd < 0)
+    {
+      ret = -errno;
+      printf("igmp: socket failed: %d\n", ret);
+      return ret;
+    }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port   = HTONS(CONFIG_EXAMPLES_IGMP_BENCH_PORT);
+
+  memset(bench->buffer, 0x55, bench->length);
+  memset(seq, 0, sizeof(seq));
+
+  printf("Streaming %d packets/s of %d bytes to each of %d groups "
+         "for %d s\n", bench->rate, bench->length, bench->ngroups,
+         bench->duration);
+
+  /* Send round robin over the groups, catching up with the schedule every
+   * tick.
+   */
+
+  (void)benchutil_cpuload();
+  start = benchutil_usec();
+
+  for (; ; )
+    {
+      elapsed = benchutil_usec() - start;
+      if (elapsed >= (uint64_t)bench->duration * 1000000)
+        {
+          break;
+        }
+
+      due = elapsed * bench->rate * bench->ngroups / 1000000;
+      while (nsent < due)
+        {
+          i = (int)(nsent % bench->ngroups);
+
+          hdr->magic = HTONL(IGMP_BENCH_MAGIC);
+          hdr->group = HTONL(i);
+          hdr->seq   = HTONL(seq[i]);
+          igmp_bench_grpaddr(i, &addr.sin_addr);
+
+          if (sendto(sd, bench->buffer, bench->length, 0,
+                     (FAR struct sockaddr *)&addr, sizeof(addr)) < 0)
+            {
+              nerrors++;
+            }
+
+          seq[i]++;
+          nsent++;
+        }
+
+      usleep(IGMP_BENCH_TICK);
+    }
+
+  load = benchutil_cpuload();
+  close(sd);
+
+  printf("Sent %lu packets (%lu errors), %lu packets/s",
+         (unsigned long)nsent, (unsigned long)nerrors,
+         (unsigned long)(nsent * 1000000 / elapsed));
+  if (load >= 0)
+    {
+      printf(", CPU %d.%d%%", load / 10, load % 10);
+    }
+
+  printf("\n");
+  return OK;
+}
+
+/****************************************************************************
+ * Name: igmp_bench_join and igmp_bench_leave
+ *
+ * Description:
+ *   Join or leave the first 'ngroups' groups.  The time taken includes one
+ *   socket and ioctl through ipmsfilter() and the IGMP report per group.
+ *   igmp_bench_join() returns the number of groups actually joined.
+ *
+ ****************************************************************************/
+
+static int igmp_bench_join(int ngroups, FAR uint32_t *usec)
+{
+  struct in_addr grpaddr;
+  uint64_t start;
+  int ret;
+  int i;
+
+  start = benchutil_usec();
+  for (i = 0; i < ngroups; i++)
+    {
+      igmp_bench_grpaddr(i, &grpaddr);
+      ret = ipmsfilter("eth0", &grpaddr, MCAST_INCLUDE);
+      if (ret < 0)
+        {
+          printf("igmp: Join of group %d failed: %d\n", i, ret);
+          break;
+        }
+    }
+
+  *usec = (uint32_t)((benchutil_usec() - start) / (i > 0 ? i : 1));
+  return i;
+}
+
+static void igmp_bench_leave(int ngroups, FAR uint32_t *usec)
+{
+  struct in_addr grpaddr;
+  uint64_t start;
+  int i;
+
+  start = benchutil_usec();
+  for (i = 0; i < ngroups; i++)
+    {
+      igmp_bench_grpaddr(i, &grpaddr);
+      (void)ipmsfilter("eth0", &grpaddr, MCAST_EXCLUDE);
+    }
+
+  *usec = (uint32_t)((benchutil_usec() - start) / (i > 0 ? i : 1));
+}
+
+/****************************************************************************
+ * Name: igmp_bench_collect
+ *
+ * Description:
+ *   Count the benchmark packets of each joined group for the duration of
+ *   one measurement.  Returns the elapsed time in microseconds.
+ *
+ ****************************************************************************/
+
+static uint64_t igmp_bench_collect(FAR struct igmp_bench_s *bench, int sd,
+                                   int ngroups, FAR uint32_t *nstray)
+{
+  FAR struct igmp_bench_hdr_s *hdr =
+    (FAR struct igmp_bench_hdr_s *)bench->buffer;
+  FAR struct igmp_bench_group_s *group;
+  struct pollfd pfd;
+  uint64_t duration = (uint64_t)bench->duration * 1000000;
+  uint64_t start;
+  uint64_t elapsed;
+  ssize_t nrecvd;
+  uint32_t index;
+  uint32_t seq;
+
+  memset(bench->group, 0, sizeof(bench->group));
+  *nstray = 0;
+
+  start = benchutil_usec();
+  while ((elapsed = benchutil_usec() - start) < duration)
+    {
+      pfd.fd      = sd;
+      pfd.events  = POLLIN;
+      pfd.revents = 0;
+
+      if (poll(&pfd, 1, 100) <= 0)
+        {
+          continue;
+        }
+
+      nrecvd = recv(sd, bench->buffer, IGMP_BENCH_MAXLEN, 0);
+      if (nrecvd < (ssize_t)sizeof(*hdr) ||
+          NTOHL(hdr->magic) != IGMP_BENCH_MAGIC)
+        {
+          continue;
+        }
+
+      /* Traffic of a group that is not in the table got through the
+       * multicast filter.
+       */
+
+      index = NTOHL(hdr->group);
+      if (index >= (uint32_t)ngroups)
+        {
+          (*nstray)++;
+          continue;
+        }
+
+      group = &bench->group[index];
+      seq   = NTOHL(hdr->seq);
+      if (group->seen && seq > group->nextseq)
+        {
+          group->nlost += seq - group->nextseq;
+        }
+
+      group->seen    = true;
+      group->nextseq = seq + 1;
+      group->nrecvd++;
+    }
+
+  return elapsed;
+}
+
+/****************************************************************************
+ * Name: igmp_bench_receive
+ *
+ * Description:
+ *   Measure reception with each of the group table sizes in turn.
+ *
+ ****************************************************************************/
+
+static int igmp_bench_receive(FAR struct igmp_bench_s *bench, int ntables)
+{
+  struct sockaddr_in addr;
+  uint64_t elapsed;
+  uint32_t join_us;
+  uint32_t leave_us;
+  uint32_t nstray;
+  uint32_t ntotal;
+  uint32_t nlost;
+  uint32_t minrate;
+  uint32_t maxrate;
+  uint32_t rate;
+  int ngroups;
+  int nactive;
+  int load;
+  int ret;
+  int sd;
+  int i;
+  int j;
+
+  sd = socket(PF_INET, SOCK_DGRAM, 0);
+  if (sd < 0)
+    {
+      ret = -errno;
+      printf("igmp: socket failed: %d\n", ret);
+      return ret;
+    }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family      = AF_INET;
+  addr.sin_port        = HTONS(CONFIG_EXAMPLES_IGMP_BENCH_PORT);
+  addr.sin_addr.s_addr = HTONL(INADDR_ANY);
+
+  if (bind(sd, (FAR struct sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+      ret = -errno;
+      printf("igmp: bind failed: %d\n", ret);
+      close(sd);
+      return ret;
+    }
+
+  printf("%6s %8s %8s %6s %8s %8s %8s %8s %7s %7s %7s\n",
+         "Groups", "Join us", "Leave us", "Active", "Rx pps", "Min pps",
+         "Max pps", "Lost", "Strays", "CPU", "CPU/grp");
+
+  for (i = 0; i < ntables; i++)
+    {
+      ngroups = igmp_bench_join(bench->tables[i], &join_us);
+      if (ngroups < bench->tables[i])
+        {
+          igmp_bench_leave(ngroups, &leave_us);
+          printf("%6d   failed\n", bench->tables[i]);
+          continue;
+        }
+
+      (void)benchutil_cpuload();
+      elapsed = igmp_bench_collect(bench, sd, ngroups, &nstray);
+      load    = benchutil_cpuload();
+
+      igmp_bench_leave(ngroups, &leave_us);
+
+      ntotal  = 0;
+      nlost   = 0;
+      nactive = 0;
+      minrate = UINT32_MAX;
+      maxrate = 0;
+
+      for (j = 0; j < ngroups; j++)
+        {
+          if (!bench->group[j].seen)
+            {
+              continue;
+            }
+
+          rate = (uint32_t)((uint64_t)bench->group[j].nrecvd * 1000000 /
+                            elapsed);
+          minrate = rate < minrate ? rate : minrate;
+          maxrate = rate > maxrate ? rate : maxrate;
+          ntotal += bench->group[j].nrecvd;
+          nlost  += bench->group[j].nlost;
+          nactive++;
+        }
+
+      if (nactive == 0)
+        {
+          minrate = 0;
+        }
+
+      printf("%6d %8lu %8lu %6d %8lu %8lu %8lu %8lu %7lu",
+             ngroups, (unsigned long)join_us, (unsigned long)leave_us,
+             nactive, (unsigned long)((uint64_t)ntotal * 1000000 / elapsed),
+             (unsigned long)minrate, (unsigned long)maxrate,
+             (unsigned long)nlost, (unsigned long)nstray);
+
+      /* The load is shared out over the groups that carried traffic */
+
+      if (load >= 0 && nactive > 0)
+        {
+          printf(" %5d.%d%% %5d.%d%%\n", load / 10, load % 10,
+                 load / nactive / 10, load / nactive % 10);
+        }
+      else if (load >= 0)
+        {
+          printf(" %5d.%d%% %7s\n", load / 10, load % 10, "-");
+        }
+      else
+        {
+          printf(" %7s %7s\n", "-", "-");
+        }
+    }
+
+  close(sd);
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: igmp_bench
+ *
+ * Description:
+ *   Multicast fan-out benchmark.  One board streams to a range of groups
+ *   ('igmp -s') while the board under test joins a growing number of
+ *   groups ('igmp -b') and reports the receive rate, the loss and the CPU
+ *   load for each size of its multicast group table.
+ *
+ ****************************************************************************/
+
+int igmp_bench(int argc, FAR char *argv[])
+{
+  FAR struct igmp_bench_s *bench;
+  bool sender = (argv[1][1] == 's');
+  int ntables;
+  int ret;
+  int i;
+
+  bench = (FAR struct igmp_bench_s *)malloc(sizeof(struct igmp_bench_s));
+  if (bench == NULL)
+    {
+      printf("igmp: Failed to allocate the benchmark state\n");
+      return EXIT_FAILURE;
+    }
+
+  bench->ngroups  = CONFIG_EXAMPLES_IGMP_BENCH_GROUPS;
+  bench->rate     = CONFIG_EXAMPLES_IGMP_BENCH_RATE;
+  bench->length   = CONFIG_EXAMPLES_IGMP_BENCH_LENGTH;
+  bench->duration = CONFIG_EXAMPLES_IGMP_BENCH_DURATION;
+  ntables = igmp_bench_parse(CONFIG_EXAMPLES_IGMP_BENCH_TABLES,
+                             bench->tables);
+
+  for (i = 2; i < argc; i++)
+    {
+      if (i + 1 >= argc || argv[i][0] != '-' || argv[i][2] != '\0')
+        {
+          goto errout_with_usage;
+        }
+
+      switch (argv[i++][1])
+        {
+          case 'm':
+            ntables = igmp_bench_parse(argv[i], bench->tables);
+            break;
+
+          case 'g':
+            bench->ngroups = atoi(argv[i]);
+            break;
+
+          case 'r':
+            bench->rate = atoi(argv[i]);
+            break;
+
+          case 'l':
+            bench->length = atoi(argv[i]);
+            break;
+
+          case 't':
+            bench->duration = atoi(argv[i]);
+            break;
+
+          default:
+            goto errout_with_usage;
+        }
+    }
+
+  if (ntables < 0 || bench->ngroups < 1 ||
+      bench->ngroups > CONFIG_EXAMPLES_IGMP_BENCH_MAXGROUPS ||
+      bench->rate < 1 || bench->duration < 1 ||
+      bench->length < (int)sizeof(struct igmp_bench_hdr_s) ||
+      bench->length > IGMP_BENCH_MAXLEN)
+    {
+      goto errout_with_usage;
+    }
+
+  ret = sender ? igmp_bench_send(bench) : igmp_bench_receive(bench, ntables);
+  free(bench);
+  return ret < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+
+errout_with_usage:
+  igmp_bench_usage(argv[0]);
+  free(bench);
+  return EXIT_FAILURE;
+}
@@ -38,11 +38,485 @@
  ****************************************************************************/
 
 #include <nuttx/config.h>
+
+#include <sys/ioctl.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sched.h>
+#include <signal.h>
+#include <pthread.h>
+#include <time.h>
+#include <errno.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/sched.h>
 #include <nuttx/sensors/ina219.h>
 
+#ifdef CONFIG_EXAMPLES_INA219_TIMER
+#  include <nuttx/timers/timer.h>
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_INA219_DEVNAME
+#  define CONFIG_EXAMPLES_INA219_DEVNAME "/dev/ina219"
+#endif
+
+#ifdef CONFIG_EXAMPLES_INA219_TIMER
+
+#ifndef CONFIG_EXAMPLES_INA219_TIMER_DEVNAME
+#  define CONFIG_EXAMPLES_INA219_TIMER_DEVNAME "/dev/timer0"
+#endif
+
+#ifndef CONFIG_EXAMPLES_INA219_TIMER_SIGNO
+#  define CONFIG_EXAMPLES_INA219_TIMER_SIGNO 17
+#endif
+
+#ifndef CONFIG_EXAMPLES_INA219_SAMPLER_PRIORITY
+#  define CONFIG_EXAMPLES_INA219_SAMPLER_PRIORITY 200
+#endif
+
+#ifndef CONFIG_EXAMPLES_INA219_SAMPLER_STACKSIZE
+#  define CONFIG_EXAMPLES_INA219_SAMPLER_STACKSIZE 1024
+#endif
+
+/* The number of samples buffered between the sampler and the integration,
+ * a power of two.
+ */
+
+#ifndef CONFIG_EXAMPLES_INA219_NSAMPLES
+#  define CONFIG_EXAMPLES_INA219_NSAMPLES 256
+#endif
+
+#if (CONFIG_EXAMPLES_INA219_NSAMPLES & (CONFIG_EXAMPLES_INA219_NSAMPLES - 1)) != 0
+#  error CONFIG_EXAMPLES_INA219_NSAMPLES must be a power of two
+#endif
+
+#define INA219_RINGMASK (CONFIG_EXAMPLES_INA219_NSAMPLES - 1)
+
+#ifndef CONFIG_EXAMPLES_INA219_NTASKS
+#  define CONFIG_EXAMPLES_INA219_NTASKS 16
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define INA219_CLOCK CLOCK_MONOTONIC
+#else
+#  define INA219_CLOCK CLOCK_REALTIME
+#endif
+
+/* The per-task breakdown needs the CPU load counters of every task */
+
+#if defined(CONFIG_SCHED_CPULOAD) && defined(CONFIG_BUILD_FLAT)
+#  define INA219_HAVE_TASKS 1
+#endif
+
+#endif /* CONFIG_EXAMPLES_INA219_TIMER */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_INA219_TIMER
+struct ina219_sample_s
+{
+  uint32_t systime;           /* clock_systimer(), the time base of sched_note */
+  uint32_t usec;              /* Microseconds, for the integration */
+  uint32_t voltage;           /* Microvolts */
+  int32_t  current;           /* Microamperes */
+};
+
+/* The sampler thread is the only writer of 'head' and the integration the
+ * only writer of 'tail', so the ring needs no lock.  A sample is complete
+ * before 'head' moves past it.
+ */
+
+struct ina219_ring_s
+{
+  volatile uint32_t head;
+  volatile uint32_t tail;
+  volatile uint32_t overruns;
+  volatile bool stop;
+  int sensorfd;
+  uint32_t interval;          /* Timer interval in microseconds */
+  int error;                  /* Setup error of the sampler, or 0 */
+  struct ina219_sample_s samples[CONFIG_EXAMPLES_INA219_NSAMPLES];
+};
+
+#ifdef INA219_HAVE_TASKS
+struct ina219_task_s
+{
+  pid_t    pid;
+  uint32_t active;            /* CPU load counters of the task */
+  uint32_t total;
+#if CONFIG_TASK_NAME_SIZE > 0
+  char     name[CONFIG_TASK_NAME_SIZE + 1];
+#endif
+};
+
+struct ina219_tasks_s
+{
+  int ntasks;
+  struct ina219_task_s task[CONFIG_EXAMPLES_INA219_NTASKS];
+};
+#endif
+#endif /* CONFIG_EXAMPLES_INA219_TIMER */
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_INA219_TIMER
+static struct ina219_ring_s g_ring;
+
+#ifdef INA219_HAVE_TASKS
+static struct ina219_tasks_s g_tasks;
+#endif
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_INA219_TIMER
+/****************************************************************************
+ * Name: ina219_usec
+ ****************************************************************************/
+
+static uint32_t ina219_usec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(INA219_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * Name: ina219_sampler
+ *
+ * Description:
+ *   Take one sample on every expiration of the timer.  The timer driver
+ *   signals this thread from its interrupt handler; the sensor is on I2C,
+ *   so it cannot be read from the handler itself.  The thread waits with
+ *   sigwaitinfo() rather than in a signal handler, which keeps the wake-up
+ *   latency to a context switch.
+ *
+ ****************************************************************************/
+
+static FAR void *ina219_sampler(FAR void *arg)
+{
+  FAR struct ina219_ring_s *ring = (FAR struct ina219_ring_s *)arg;
+  FAR struct ina219_sample_s *sample;
+  struct timer_notify_s notify;
+  struct ina219_s value;
+  sigset_t set;
+  int fd;
+  int ret;
+
+  /* The signal must be blocked before the timer can raise it */
+
+  (void)sigemptyset(&set);
+  (void)sigaddset(&set, CONFIG_EXAMPLES_INA219_TIMER_SIGNO);
+  (void)pthread_sigmask(SIG_BLOCK, &set, NULL);
+
+  fd = open(CONFIG_EXAMPLES_INA219_TIMER_DEVNAME, O_RDONLY);
+  if (fd < 0)
+    {
+      ring->error = errno;
+      ring->stop  = true;
+      return NULL;
+    }
+
+  notify.arg   = NULL;
+  notify.pid   = getpid();
+  notify.signo = CONFIG_EXAMPLES_INA219_TIMER_SIGNO;
+
+  ret = ioctl(fd, TCIOC_SETTIMEOUT, ring->interval);
+  if (ret >= 0)
+    {
+      ret = ioctl(fd, TCIOC_NOTIFICATION,
+                  (unsigned long)((uintptr_t)&notify));
+    }
+
+  if (ret >= 0)
+    {
+      ret = ioctl(fd, TCIOC_START, 0);
+    }
+
+  if (ret < 0)
+    {
+      ring->error = errno;
+      ring->stop  = true;
+      close(fd);
+      return NULL;
+    }
+
+  while (!ring->stop)
+    {
+      if (sigwaitinfo(&set, NULL) < 0)
+        {
+          continue;
+        }
+
+      if (read(ring->sensorfd, &value, sizeof(struct ina219_s)) !=
+          sizeof(struct ina219_s))
+        {
+          continue;
+        }
+
+      if (ring->head - ring->tail >= CONFIG_EXAMPLES_INA219_NSAMPLES)
+        {
+          ring->overruns++;
+          continue;
+        }
+
+      sample          = &ring->samples[ring->head & INA219_RINGMASK];
+      sample->systime = clock_systimer();
+      sample->usec    = ina219_usec();
+      sample->voltage = value.voltage;
+      sample->current = value.current;
+      ring->head++;
+    }
+
+  (void)ioctl(fd, TCIOC_STOP, 0);
+  close(fd);
+  return NULL;
+}
+
+#ifdef INA219_HAVE_TASKS
+/****************************************************************************
+ * Name: ina219_gettask
+ *
+ * Description:
+ *   Collect the CPU load counters of one task.  This runs inside
+ *   sched_foreach() with interrupts disabled, so it only copies.
+ *
+ ****************************************************************************/
+
+static void ina219_gettask(FAR struct tcb_s *tcb, FAR void *arg)
+{
+  FAR struct ina219_tasks_s *tasks = (FAR struct ina219_tasks_s *)arg;
+  FAR struct ina219_task_s *task;
+  struct cpuload_s load;
+
+  if (tasks->ntasks >= CONFIG_EXAMPLES_INA219_NTASKS ||
+      clock_cpuload(tcb->pid, &load) < 0)
+    {
+      return;
+    }
+
+  task         = &tasks->task[tasks->ntasks++];
+  task->pid    = tcb->pid;
+  task->active = load.active;
+  task->total  = load.total;
+#if CONFIG_TASK_NAME_SIZE > 0
+  strncpy(task->name, tcb->name, CONFIG_TASK_NAME_SIZE);
+  task->name[CONFIG_TASK_NAME_SIZE] = '\0';
+#endif
+}
+
+/****************************************************************************
+ * Name: ina219_showtasks
+ *
+ * Description:
+ *   Split the energy of a report interval among the tasks in proportion to
+ *   their CPU load.  The load is the scheduler's decaying average, so this
+ *   is an estimate that is best over intervals longer than the CPU load
+ *   time constant.  The idle task (PID 0) takes the share of the idle
+ *   power.
+ *
+ ****************************************************************************/
+
+static void ina219_showtasks(int64_t energy)
+{
+  FAR struct ina219_task_s *task;
+  int64_t share;
+  int i;
+
+  g_tasks.ntasks = 0;
+  sched_foreach(ina219_gettask, &g_tasks);
+
+  for (i = 0; i < g_tasks.ntasks; i++)
+    {
+      task = &g_tasks.task[i];
+      if (task->total == 0 || task->active == 0)
+        {
+          continue;
+        }
+
+      share = energy * task->active / task->total;
+#if CONFIG_TASK_NAME_SIZE > 0
+      printf("  %5d %-16s %10lld uJ\n", task->pid, task->name,
+             (long long)(share / 1000000));
+#else
+      printf("  %5d %10lld uJ\n", task->pid, (long long)(share / 1000000));
+#endif
+    }
+}
+#endif /* INA219_HAVE_TASKS */
+
+/****************************************************************************
+ * Name: ina219_timed
+ *
+ * Description:
+ *   Sample the sensor on every expiration of a hardware timer and
+ *   integrate the energy as the samples arrive.
+ *
+ ****************************************************************************/
+
+static int ina219_timed(int sensorfd, uint32_t interval, uint32_t nsamples,
+                        uint32_t report, bool verbose)
+{
+  FAR struct ina219_ring_s *ring = &g_ring;
+  FAR struct ina219_sample_s *sample;
+  struct ina219_sample_s last;
+  struct sched_param param;
+  pthread_attr_t attr;
+  pthread_t sampler;
+  int64_t power;
+  int64_t prevpower = 0;
+  int64_t energy    = 0;       /* Picojoules in this report interval */
+  int64_t total     = 0;       /* Picojoules since the start */
+  uint32_t jitter   = 0;       /* Worst deviation from the interval */
+  uint32_t taken    = 0;
+  uint32_t count    = 0;       /* Samples in this report interval */
+  uint32_t start    = 0;
+  uint32_t delta;
+  int ret;
+
+  memset(ring, 0, sizeof(struct ina219_ring_s));
+  ring->sensorfd = sensorfd;
+  ring->interval = interval;
+
+  pthread_attr_init(&attr);
+  param.sched_priority = CONFIG_EXAMPLES_INA219_SAMPLER_PRIORITY;
+  (void)pthread_attr_setschedparam(&attr, &param);
+  (void)pthread_attr_setstacksize(&attr,
+                                  CONFIG_EXAMPLES_INA219_SAMPLER_STACKSIZE);
+
+  ret = pthread_create(&sampler, &attr, ina219_sampler, ring);
+  if (ret != 0)
+    {
+      fprintf(stderr, "ERROR: Failed to start the sampler: %d\n", ret);
+      return EXIT_FAILURE;
+    }
+
+  while (nsamples == 0 || taken < nsamples)
+    {
+      if (ring->tail == ring->head)
+        {
+          if (ring->stop)
+            {
+              break;
+            }
+
+          usleep(10000);
+          continue;
+        }
+
+      sample = &ring->samples[ring->tail & INA219_RINGMASK];
+
+      /* Power in microwatts */
+
+      power = (int64_t)sample->voltage * sample->current / 1000000;
+
+      if (taken == 0)
+        {
+          start = sample->usec;
+        }
+      else
+        {
+          /* Trapezoidal integration: uW * us = pJ */
+
+          delta   = sample->usec - last.usec;
+          energy += (power + prevpower) * delta / 2;
+
+          delta   = delta > interval ? delta - interval : interval - delta;
+          if (delta > jitter)
+            {
+              jitter = delta;
+            }
+        }
+
+      if (verbose)
+        {
+          printf("%10lu %10lu U=%12lu uV I=%12ld uA\n",
+                 (unsigned long)sample->systime, (unsigned long)sample->usec,
+                 (unsigned long)sample->voltage, (long)sample->current);
+        }
+
+      last      = *sample;
+      prevpower = power;
+      ring->tail++;
+      taken++;
+      count++;
+
+      /* Report when the interval is complete */
+
+      if (sample->usec - start >= report * 1000)
+        {
+          total += energy;
+          printf("%lu ticks: %lu samples, %lld uW avg, %lld uJ, "
+                 "%lld uJ total, jitter %lu us, %lu overruns\n",
+                 (unsigned long)sample->systime, (unsigned long)count,
+                 (long long)(energy / (sample->usec - start)),
+                 (long long)(energy / 1000000),
+                 (long long)(total / 1000000),
+                 (unsigned long)jitter, (unsigned long)ring->overruns);
+#ifdef INA219_HAVE_TASKS
+          ina219_showtasks(energy);
+#endif
+          start  = sample->usec;
+          energy = 0;
+          jitter = 0;
+          count  = 0;
+        }
+    }
+
+  ring->stop = true;
+  (void)pthread_join(sampler, NULL);
+
+  if (ring->error != 0)
+    {
+      fprintf(stderr, "ERROR: Failed to start %s: %d\n",
+              CONFIG_EXAMPLES_INA219_TIMER_DEVNAME, ring->error);
+      return EXIT_FAILURE;
+    }
+
+  total += energy;
+  printf("%lu samples, %lld uJ total, %lu overruns\n",
+         (unsigned long)taken, (long long)(total / 1000000),
+         (unsigned long)ring->overruns);
+  return EXIT_SUCCESS;
+}
+
+/****************************************************************************
+ * Name: ina219_showusage
+ ****************************************************************************/
+
+static void ina219_showusage(FAR const char *progname, int exitcode)
+{
+  fprintf(stderr, "USAGE: %s [-t <interval> [-n <samples>] [-r <report>] "
+          "[-v]]\n", progname);
+  fprintf(stderr, "\nWithout options, the sensor is read and shown "
+          "continuously.  Otherwise:\n");
+  fprintf(stderr, "\t-t <interval>: Sample every <interval> microseconds "
+          "with %s\n", CONFIG_EXAMPLES_INA219_TIMER_DEVNAME);
+  fprintf(stderr, "\t-n <samples>: Stop after this many samples.  "
+          "Default: 0 (never)\n");
+  fprintf(stderr, "\t-r <report>: Report the energy every <report> "
+          "milliseconds.  Default: 1000\n");
+  fprintf(stderr, "\t-v: Show every sample with its system time\n");
+  exit(exitcode);
+}
+#endif /* CONFIG_EXAMPLES_INA219_TIMER */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -61,7 +535,73 @@ int ina219_main(int argc, char *argv[])
   int fd;
   int ret;
 
-  fd = open("/dev/ina219", O_RDWR);
+  fd = open(CONFIG_EXAMPLES_INA219_DEVNAME, O_RDWR);
+  if (fd < 0)
+    {
+      fprintf(stderr, "ERROR: Failed to open %s: %d\n",
+              CONFIG_EXAMPLES_INA219_DEVNAME, errno);
+      return EXIT_FAILURE;
+    }
+
+#ifdef CONFIG_EXAMPLES_INA219_TIMER
+  if (argc > 1)
+    {
+      uint32_t interval = 0;
+      uint32_t nsamples = 0;
+      uint32_t report   = 1000;
+      bool verbose      = false;
+      int option;
+
+      while ((option = getopt(argc, argv, ":t:n:r:vh")) != ERROR)
+        {
+          switch (option)
+            {
+              case 't':
+                interval = strtoul(optarg, NULL, 0);
+                break;
+
+              case 'n':
+                nsamples = strtoul(optarg, NULL, 0);
+                break;
+
+              case 'r':
+                report = strtoul(optarg, NULL, 0);
+                break;
+
+              case 'v':
+                verbose = true;
+                break;
+
+              case 'h':
+                ina219_showusage(argv[0], EXIT_SUCCESS);
+                break;
+
+              case ':':
+                fprintf(stderr, "ERROR: Missing argument to option -%c\n",
+                        optopt);
+                ina219_showusage(argv[0], EXIT_FAILURE);
+                break;
+
+              case '?':
+              default:
+                fprintf(stderr, "ERROR: Unrecognized option -%c\n", optopt);
+                ina219_showusage(argv[0], EXIT_FAILURE);
+                break;
+            }
+        }
+
+      if (interval == 0 || report == 0)
+        {
+          fprintf(stderr, "ERROR: Missing sample interval\n");
+          ina219_showusage(argv[0], EXIT_FAILURE);
+        }
+
+      ret = ina219_timed(fd, interval, nsamples, report, verbose);
+      close(fd);
+      return ret;
+    }
+#endif
+
   while (1)
     {
       ret = read(fd, &sample, sizeof(sample));
@@ -0,0 +1,464 @@
+/****************************************************************************
+ * apps/examples/intbench/intbench_main.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/mount.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+
+#include <nuttx/drivers/ramdisk.h>
+
+#include "builtin/builtin.h"
+#include "romfs.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Check configuration.  This is not all of the configuration settings that
+ * are required -- only the more obvious.
+ */
+
+#if CONFIG_NFILE_DESCRIPTORS < 1
+#  error "You must provide file descriptors via CONFIG_NFILE_DESCRIPTORS in your configuration file"
+#endif
+
+#ifndef CONFIG_FS_ROMFS
+#  error "You must select CONFIG_FS_ROMFS in your configuration file"
+#endif
+
+#ifdef CONFIG_DISABLE_MOUNTPOINT
+#  error "You must not disable mountpoints via CONFIG_DISABLE_MOUNTPOINT in your configuration file"
+#endif
+
+#ifndef CONFIG_SCHED_WAITPID
+#  error "You must select CONFIG_SCHED_WAITPID in your configuration file"
+#endif
+
+/* Describe the ROMFS file system */
+
+#define SECTORSIZE   512
+#define NSECTORS(b)  (((b)+SECTORSIZE-1)/SECTORSIZE)
+#define MOUNTPT      "/mnt/intbench"
+
+#ifndef CONFIG_EXAMPLES_INTBENCH_DEVMINOR
+#  define CONFIG_EXAMPLES_INTBENCH_DEVMINOR 1
+#endif
+
+#ifndef CONFIG_EXAMPLES_INTBENCH_DEVPATH
+#  define CONFIG_EXAMPLES_INTBENCH_DEVPATH "/dev/ram1"
+#endif
+
+#ifndef CONFIG_EXAMPLES_INTBENCH_SAMPLEMS
+#  define CONFIG_EXAMPLES_INTBENCH_SAMPLEMS 10
+#endif
+
+#ifdef CONFIG_INTERPRETERS_MICROPYTHON_APPNAME
+#  define INTBENCH_PYTHON CONFIG_INTERPRETERS_MICROPYTHON_APPNAME
+#else
+#  define INTBENCH_PYTHON "micropython"
+#endif
+
+/* Use the monotonic clock if it is available */
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define INTBENCH_CLOCK  CLOCK_MONOTONIC
+#else
+#  define INTBENCH_CLOCK  CLOCK_REALTIME
+#endif
+
+/* Script output is discarded so that it does not distort the timing */
+
+#define INTBENCH_OUTPUT "/dev/null"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* An interpreter and where its scripts are kept */
+
+struct intbench_engine_s
+{
+  FAR const char *name;            /* Name shown in the report */
+  FAR const char *appname;         /* Builtin application that runs it */
+  FAR const char *dir;             /* Script directory under MOUNTPT */
+  FAR const char *ext;             /* Script file extension */
+};
+
+/* A benchmark kernel.  The same work is done by the script of every
+ * interpreter, so the operation counts are comparable.
+ */
+
+struct intbench_kernel_s
+{
+  FAR const char *name;            /* Script base name */
+  unsigned long ops;               /* Operations done, 0 for start-up */
+};
+
+/* State shared with the heap sampling thread */
+
+struct intbench_sampler_s
+{
+  volatile bool done;              /* Set when the script has finished */
+  int base;                        /* Heap in use before the script */
+  int peak;                        /* Largest heap in use seen */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct intbench_engine_s g_engines[] =
+{
+  { "bas",         "bas",           "bas",       ".bas" },
+  { "minibasic",   "basic",         "minibasic", ".bas" },
+  { "ficl",        "ficl",          "ficl",      ".fth" },
+  { "micropython", INTBENCH_PYTHON, "python",    ".py"  },
+  { "pcode",       "pexec",         "pcode",     ".pex" },
+};
+
+#define NENGINES (sizeof(g_engines) / sizeof(g_engines[0]))
+
+/* The first kernel does nothing and so measures start-up */
+
+static const struct intbench_kernel_s g_kernels[] =
+{
+  { "empty",   0     },
+  { "loops",   20000 },
+  { "strings", 1000  },
+  { "arrays",  10000 },
+  { "calls",   2000  },
+};
+
+#define NKERNELS (sizeof(g_kernels) / sizeof(g_kernels[0]))
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: intbench_heapused
+ ****************************************************************************/
+
+static int intbench_heapused(void)
+{
+  struct mallinfo mem;
+
+#ifdef CONFIG_CAN_PASS_STRUCTS
+  mem = mallinfo();
+#else
+  (void)mallinfo(&mem);
+#endif
+
+  return mem.uordblks;
+}
+
+/****************************************************************************
+ * Name: intbench_sampler
+ *
+ * Description:
+ *   Sample the heap in use until the script has finished.  The heap is
+ *   shared by all tasks in a flat build, so the peak includes the stack
+ *   and the other start-up allocations of the interpreter task.
+ *
+ ****************************************************************************/
+
+static FAR void *intbench_sampler(FAR void *arg)
+{
+  FAR struct intbench_sampler_s *sampler =
+    (FAR struct intbench_sampler_s *)arg;
+  int used;
+
+  while (!sampler->done)
+    {
+      used = intbench_heapused();
+      if (used > sampler->peak)
+        {
+          sampler->peak = used;
+        }
+
+      usleep(CONFIG_EXAMPLES_INTBENCH_SAMPLEMS * 1000);
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: intbench_elapsed
+ *
+ * Description:
+ *   Return the time in microseconds from start to now.
+ *
+ ****************************************************************************/
+
+static unsigned long intbench_elapsed(FAR const struct timespec *start)
+{
+  struct timespec now;
+
+  clock_gettime(INTBENCH_CLOCK, &now);
+  return (unsigned long)(now.tv_sec - start->tv_sec) * 1000000 +
+         (now.tv_nsec - start->tv_nsec) / 1000;
+}
+
+/****************************************************************************
+ * Name: intbench_run
+ *
+ * Description:
+ *   Run one script to completion and measure it.
+ *
+ * Returned Value:
+ *   Zero (OK) on success with the run time and peak heap use returned;
+ *   a negated errno value if the interpreter could not be run or failed.
+ *
+ ****************************************************************************/
+
+static int intbench_run(FAR const struct intbench_engine_s *engine,
+                        FAR const char *path, FAR unsigned long *usec,
+                        FAR int *heap)
+{
+  struct intbench_sampler_s sampler;
+  struct sched_param param;
+  struct timespec start;
+  pthread_attr_t attr;
+  pthread_t thread;
+  FAR char *argv[3];
+  int status;
+  int errcode = 0;
+  int ret;
+  int pid;
+
+  sampler.done = false;
+  sampler.base = intbench_heapused();
+  sampler.peak = sampler.base;
+
+  /* The sampler must preempt the interpreter to see its use */
+
+  pthread_attr_init(&attr);
+  param.sched_priority = sched_get_priority_max(SCHED_FIFO);
+  pthread_attr_setschedparam(&attr, &param);
+
+  ret = pthread_create(&thread, &attr, intbench_sampler, &sampler);
+  pthread_attr_destroy(&attr);
+  if (ret != 0)
+    {
+      return -ret;
+    }
+
+  argv[0] = (FAR char *)engine->appname;
+  argv[1] = (FAR char *)path;
+  argv[2] = NULL;
+
+  /* Keep the interpreter from running until we are waiting for it */
+
+  sched_lock();
+  clock_gettime(INTBENCH_CLOCK, &start);
+
+  pid = exec_builtin(engine->appname, argv, INTBENCH_OUTPUT,
+                     O_WRONLY | O_CREAT | O_TRUNC);
+  if (pid < 0)
+    {
+      errcode = errno;
+    }
+  else if (waitpid(pid, &status, 0) < 0)
+    {
+      errcode = errno;
+    }
+  else if (status != 0)
+    {
+      errcode = EIO;
+    }
+
+  *usec = intbench_elapsed(&start);
+  sched_unlock();
+
+  sampler.done = true;
+  pthread_join(thread, NULL);
+
+  *heap = sampler.peak - sampler.base;
+  return -errcode;
+}
+
+/****************************************************************************
+ * Name: intbench_engine
+ *
+ * Description:
+ *   Run all of the kernels of one interpreter and report the results.
+ *
+ ****************************************************************************/
+
+static void intbench_engine(FAR const struct intbench_engine_s *engine)
+{
+  FAR const struct intbench_kernel_s *kernel;
+  struct stat buf;
+  char path[64];
+  unsigned long startup = 0;
+  unsigned long usec;
+  unsigned long net;
+  int heap;
+  int ret;
+  int i;
+
+  if (builtin_find(engine->appname) < 0)
+    {
+      printf("%-12s not available\n", engine->name);
+      return;
+    }
+
+  for (i = 0; i < NKERNELS; i++)
+    {
+      kernel = &g_kernels[i];
+      snprintf(path, sizeof(path), "%s/%s/%s%s",
+               MOUNTPT, engine->dir, kernel->name, engine->ext);
+
+      if (stat(path, &buf) < 0)
+        {
+          printf("%-12s %-8s %10s\n", engine->name, kernel->name, "-");
+          continue;
+        }
+
+      ret = intbench_run(engine, path, &usec, &heap);
+      if (ret < 0)
+        {
+          printf("%-12s %-8s failed: %d\n", engine->name, kernel->name, ret);
+          continue;
+        }
+
+      /* The start-up time is taken out of the rate of the other kernels */
+
+      if (kernel->ops == 0)
+        {
+          startup = usec;
+          printf("%-12s %-8s %10lu %10s %10d\n",
+                 engine->name, kernel->name, usec / 1000, "-", heap);
+        }
+      else
+        {
+          net = usec > startup ? usec - startup : 1;
+          printf("%-12s %-8s %10lu %10lu %10d\n",
+                 engine->name, kernel->name, usec / 1000,
+                 (unsigned long)((unsigned long long)kernel->ops * 1000000 /
+                                 net),
+                 heap);
+        }
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * intbench_main
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int intbench_main(int argc, char *argv[])
+#endif
+{
+  struct stat buf;
+  int ret;
+  int i;
+  int j;
+
+  /* Create and mount the ROMFS file system, unless this was done by an
+   * earlier run.
+   */
+
+  if (stat(MOUNTPT, &buf) < 0)
+    {
+      ret = romdisk_register(CONFIG_EXAMPLES_INTBENCH_DEVMINOR,
+                             (FAR uint8_t *)romfs_img,
+                             NSECTORS(romfs_img_len), SECTORSIZE);
+      if (ret < 0)
+        {
+          fprintf(stderr, "ERROR: romdisk_register failed: %d\n", ret);
+          return 1;
+        }
+
+      ret = mount(CONFIG_EXAMPLES_INTBENCH_DEVPATH, MOUNTPT, "romfs",
+                  MS_RDONLY, NULL);
+      if (ret < 0)
+        {
+          fprintf(stderr, "ERROR: mount(%s,%s,romfs) failed: %d\n",
+                  CONFIG_EXAMPLES_INTBENCH_DEVPATH, MOUNTPT, errno);
+          return 1;
+        }
+    }
+
+  printf("%-12s %-8s %10s %10s %10s\n",
+         "Engine", "Kernel", "ms", "ops/sec", "peak heap");
+
+  /* Run the interpreters named on the command line, or all of them */
+
+  for (i = 0; i < NENGINES; i++)
+    {
+      if (argc > 1)
+        {
+          for (j = 1; j < argc; j++)
+            {
+              if (strcmp(argv[j], g_engines[i].name) == 0)
+                {
+                  break;
+                }
+            }
+
+          if (j >= argc)
+            {
+              continue;
+            }
+        }
+
+      intbench_engine(&g_engines[i]);
+    }
+
+  return 0;
+}
@@ -0,0 +1,47 @@
+#!/bin/sh
+# apps/examples/intbench/mkpex.sh
+#
+# Compile the Pascal benchmark kernels into P-Code executables so that they
+# are included in the intbench ROMFS image.  The NuttX Pascal tools are not
+# part of apps/ and must be built separately.
+#
+# Usage: mkpex.sh <pascal-bin-dir>
+
+USAGE="$0 <pascal-bin-dir>"
+
+BINDIR=$1
+if [ -z "${BINDIR}" ]; then
+    echo "Missing command line argument" 1>&2
+    echo $USAGE 1>&2
+    exit 1
+fi
+
+PASCAL=${BINDIR}/pascal
+POPT=${BINDIR}/popt
+PLINK=${BINDIR}/plink
+
+for TOOL in ${PASCAL} ${POPT} ${PLINK}; do
+    if [ ! -x "${TOOL}" ]; then
+        echo "Executable ${TOOL} does not exist" 1>&2
+        exit 1
+    fi
+done
+
+cd `dirname $0`/scripts/pcode || exit 1
+
+for FILE in *.pas; do
+    NAME=`basename ${FILE} .pas`
+
+    rm -f ${NAME}.o1 ${NAME}.o ${NAME}.pex
+    ${PASCAL} ${FILE} 2>&1
+    if [ ! -f ${NAME}.o1 ]; then
+        echo "Compilation of ${FILE} failed" 1>&2
+        if [ -f ${NAME}.err ]; then
+            grep Line ${NAME}.err 1>&2
+        fi
+    else
+        ${POPT} ${NAME}.o1 2>&1 && ${PLINK} ${NAME}.o ${NAME}.pex 2>&1
+    fi
+
+    rm -f ${NAME}.o1 ${NAME}.o ${NAME}.lst ${NAME}.err
+done
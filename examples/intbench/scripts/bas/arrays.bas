@@ -0,0 +1,12 @@
+10 REM Array kernel: 10000 element stores and loads
+20 DIM A(500)
+30 FOR J = 1 TO 10
+40 FOR I = 1 TO 500
+50 A(I) = I * J
+60 NEXT I
+70 S = 0
+80 FOR I = 1 TO 500
+90 S = S + A(I)
+100 NEXT I
+110 NEXT J
+120 PRINT S
@@ -0,0 +1,7 @@
+10 REM Call kernel: 2000 user function calls
+20 DEF FNODD(X) = X * 2 + 1
+30 S = 0
+40 FOR I = 1 TO 2000
+50 S = S + FNODD(I)
+60 NEXT I
+70 PRINT S
@@ -0,0 +1,6 @@
+10 REM Loop kernel: 20000 iterations of integer arithmetic
+20 S = 0
+30 FOR I = 1 TO 20000
+40 S = S + I MOD 7
+50 NEXT I
+60 PRINT S
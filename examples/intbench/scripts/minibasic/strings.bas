@@ -0,0 +1,8 @@
+10 REM String kernel: 1000 single character appends
+20 FOR J = 1 TO 20
+30 LET A$ = ""
+40 FOR I = 1 TO 50
+50 LET A$ = A$ + CHR$(65 + I MOD 26)
+60 NEXT I
+70 NEXT J
+80 PRINT LEN(A$)
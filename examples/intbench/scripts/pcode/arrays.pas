@@ -0,0 +1,17 @@
+{ Array kernel: 10000 element stores and loads.  P-Code integers are
+  16 bits, so the sum is kept modulo 10000. }
+program arrays(output);
+var
+  a : array[1..500] of integer;
+  i, j, s : integer;
+begin
+  for j := 1 to 10 do
+    begin
+      for i := 1 to 500 do
+        a[i] := i * j;
+      s := 0;
+      for i := 1 to 500 do
+        s := (s + a[i]) mod 10000;
+    end;
+  writeln(s);
+end.
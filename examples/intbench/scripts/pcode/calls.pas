@@ -0,0 +1,17 @@
+{ Call kernel: 2000 user function calls.  P-Code integers are 16 bits,
+  so the sum is kept modulo 10000. }
+program calls(output);
+var
+  i, s : integer;
+
+function oddof(x : integer) : integer;
+begin
+  oddof := x * 2 + 1;
+end;
+
+begin
+  s := 0;
+  for i := 1 to 2000 do
+    s := (s + oddof(i)) mod 10000;
+  writeln(s);
+end.
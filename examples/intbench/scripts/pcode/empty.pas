@@ -0,0 +1,3 @@
+program empty(output);
+begin
+end.
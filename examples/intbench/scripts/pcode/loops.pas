@@ -0,0 +1,11 @@
+{ Loop kernel: 20000 iterations of integer arithmetic.  P-Code integers
+  are 16 bits, so the sum is kept modulo 10000. }
+program loops(output);
+var
+  i, s : integer;
+begin
+  s := 0;
+  for i := 1 to 20000 do
+    s := (s + i mod 7) mod 10000;
+  writeln(s);
+end.
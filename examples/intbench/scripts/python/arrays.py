@@ -0,0 +1,9 @@
+# Array kernel: 10000 element stores and loads
+a = [0] * 501
+for j in range(1, 11):
+    for i in range(1, 501):
+        a[i] = i * j
+    s = 0
+    for i in range(1, 501):
+        s += a[i]
+print(s)
@@ -0,0 +1,8 @@
+# Call kernel: 2000 user function calls
+def odd(x):
+    return x * 2 + 1
+
+s = 0
+for i in range(1, 2001):
+    s += odd(i)
+print(s)
@@ -0,0 +1,5 @@
+# Loop kernel: 20000 iterations of integer arithmetic
+s = 0
+for i in range(1, 20001):
+    s += i % 7
+print(s)
@@ -0,0 +1,6 @@
+# String kernel: 1000 single character appends
+for j in range(20):
+    a = ""
+    for i in range(1, 51):
+        a += chr(65 + i % 26)
+print(len(a))
@@ -0,0 +1,164 @@
+/****************************************************************************
+ * apps/examples/iperf/iperf.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_EXAMPLES_IPERF_IPERF_H
+#define __APPS_EXAMPLES_IPERF_IPERF_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <netinet/in.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_IPERF_PORT
+#  define CONFIG_EXAMPLES_IPERF_PORT 5001
+#endif
+
+#ifndef CONFIG_EXAMPLES_IPERF_BUFSIZE
+#  define CONFIG_EXAMPLES_IPERF_BUFSIZE 1470
+#endif
+
+#ifndef CONFIG_EXAMPLES_IPERF_MAXSTREAMS
+#  define CONFIG_EXAMPLES_IPERF_MAXSTREAMS 4
+#endif
+
+#ifndef CONFIG_EXAMPLES_IPERF_STREAMSTACK
+#  define CONFIG_EXAMPLES_IPERF_STREAMSTACK 2048
+#endif
+
+#ifndef CONFIG_EXAMPLES_IPERF_BANDWIDTH
+#  define CONFIG_EXAMPLES_IPERF_BANDWIDTH 1000000
+#endif
+
+/* The iperf 2 wire protocol.  All fields are in network order. */
+
+#define IPERF_HEADER_VERSION1 0x80000000
+
+/* The start of every UDP datagram.  A negative id ends the test. */
+
+struct iperf_udphdr_s
+{
+  int32_t id;
+  uint32_t tv_sec;
+  uint32_t tv_usec;
+};
+
+/* Follows the UDP header, or starts the TCP stream.  All zero flags mean
+ * a plain, unidirectional test.
+ */
+
+struct iperf_clienthdr_s
+{
+  int32_t flags;
+  int32_t nthreads;
+  int32_t port;
+  int32_t bufferlen;
+  int32_t winband;
+  int32_t amount;
+};
+
+/* Follows the UDP header in the reply of the server to the end of a UDP
+ * test.
+ */
+
+struct iperf_serverhdr_s
+{
+  int32_t flags;
+  int32_t total_len1;
+  int32_t total_len2;
+  int32_t stop_sec;
+  int32_t stop_usec;
+  int32_t error_cnt;
+  int32_t outorder_cnt;
+  int32_t datagrams;
+  int32_t jitter1;
+  int32_t jitter2;
+};
+
+#define IPERF_UDPMINLEN \
+  (sizeof(struct iperf_udphdr_s) + sizeof(struct iperf_clienthdr_s))
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Command line options */
+
+struct iperf_args_s
+{
+  bool server;          /* -s: Run as the server */
+  bool udp;             /* -u: UDP instead of TCP */
+  in_addr_t host;       /* -c: Address of the server (network order) */
+  uint16_t port;        /* -p: Port of the server */
+  uint32_t duration;    /* -t: Length of the test (seconds) */
+  uint32_t interval;    /* -i: Seconds between reports, zero for none */
+  size_t len;           /* -l: Size of each read or write */
+  int window;           /* -w: Socket buffer size, zero for the default */
+  uint32_t bandwidth;   /* -b: UDP send rate (bits/second) */
+  int nstreams;         /* -P: Number of parallel client streams */
+};
+
+/* The receive side statistics of UDP */
+
+struct iperf_udpstats_s
+{
+  uint32_t datagrams;   /* Datagrams sent by the client */
+  uint32_t lost;        /* Datagrams missing */
+  uint32_t outoforder;  /* Datagrams that arrived late */
+  uint32_t jitter;      /* Jitter (usec) */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+uint64_t iperf_now(void);
+void iperf_report(int id, uint64_t from, uint64_t to, uint64_t nbytes,
+                  FAR const struct iperf_udpstats_s *udp);
+int iperf_setwindow(int sd, int option, int window);
+
+int iperf_client(FAR const struct iperf_args_s *args);
+int iperf_server(FAR const struct iperf_args_s *args);
+
+#endif /* __APPS_EXAMPLES_IPERF_IPERF_H */
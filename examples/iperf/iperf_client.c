@@ -0,0 +1,484 @@
+/****************************************************************************
+ * apps/examples/iperf/iperf_client.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/socket.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <errno.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include "iperf.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define IPERF_FIN_RETRIES 10   /* Attempts to get the report of the server */
+#define IPERF_FIN_TIMEOUT 250  /* Wait for each attempt (msec) */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct iperf_stream_s
+{
+  FAR const struct iperf_args_s *args;
+  pthread_t thread;
+  int id;                   /* Stream number in reports */
+  int sd;                   /* The socket */
+  FAR uint8_t *buffer;      /* What is sent */
+  uint64_t start;           /* Start of the test (usec) */
+  uint64_t end;             /* End of the test (usec) */
+  uint64_t nbytes;          /* Bytes sent */
+  int result;               /* OK or a negated errno value */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: iperf_fillbuffer
+ *
+ * Description:
+ *   The first bytes are a zeroed client header, meaning a plain test to
+ *   iperf 2 servers.  The rest is the pattern iperf sends.
+ *
+ ****************************************************************************/
+
+static void iperf_fillbuffer(FAR uint8_t *buffer, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; i++)
+    {
+      buffer[i] = '0' + i % 10;
+    }
+
+  i = IPERF_UDPMINLEN < len ? IPERF_UDPMINLEN : len;
+  memset(buffer, 0, i);
+}
+
+/****************************************************************************
+ * Name: iperf_interval
+ *
+ * Description:
+ *   Show an interval report if the next interval boundary has passed.
+ *
+ ****************************************************************************/
+
+static void iperf_interval(FAR struct iperf_stream_s *stream, uint64_t now,
+                           FAR uint64_t *next, FAR uint64_t *lastbytes)
+{
+  uint64_t interval = (uint64_t)stream->args->interval * 1000000;
+
+  if (interval > 0 && now >= *next)
+    {
+      iperf_report(stream->id, *next - interval - stream->start,
+                   *next - stream->start, stream->nbytes - *lastbytes,
+                   NULL);
+
+      *lastbytes = stream->nbytes;
+      *next     += interval;
+    }
+}
+
+/****************************************************************************
+ * Name: iperf_tcpsend
+ ****************************************************************************/
+
+static int iperf_tcpsend(FAR struct iperf_stream_s *stream)
+{
+  FAR const struct iperf_args_s *args = stream->args;
+  uint64_t interval = (uint64_t)args->interval * 1000000;
+  uint64_t end = stream->start + (uint64_t)args->duration * 1000000;
+  uint64_t lastbytes = 0;
+  uint64_t next = stream->start + interval;
+  uint64_t now;
+  ssize_t nsent;
+
+  do
+    {
+      nsent = send(stream->sd, stream->buffer, args->len, 0);
+      if (nsent < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          return -errno;
+        }
+
+      stream->nbytes += nsent;
+
+      now = iperf_now();
+      iperf_interval(stream, now, &next, &lastbytes);
+    }
+  while (now < end);
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: iperf_udpfin
+ *
+ * Description:
+ *   Tell the server that the test is over and show its report.
+ *
+ ****************************************************************************/
+
+static void iperf_udpfin(FAR struct iperf_stream_s *stream, int32_t id)
+{
+  FAR struct iperf_udphdr_s *udp = (FAR struct iperf_udphdr_s *)stream->buffer;
+  FAR struct iperf_serverhdr_s *hdr;
+  struct iperf_udpstats_s stats;
+  struct pollfd pfd;
+  uint64_t nbytes;
+  uint64_t stop;
+  ssize_t nrecvd;
+  int i;
+
+  for (i = 0; i < IPERF_FIN_RETRIES; i++)
+    {
+      uint64_t now = iperf_now();
+
+      udp->id      = htonl(-id);
+      udp->tv_sec  = htonl((uint32_t)(now / 1000000));
+      udp->tv_usec = htonl((uint32_t)(now % 1000000));
+
+      (void)send(stream->sd, stream->buffer, stream->args->len, 0);
+
+      pfd.fd      = stream->sd;
+      pfd.events  = POLLIN;
+      pfd.revents = 0;
+
+      if (poll(&pfd, 1, IPERF_FIN_TIMEOUT) <= 0)
+        {
+          continue;
+        }
+
+      nrecvd = recv(stream->sd, stream->buffer, stream->args->len, 0);
+      if (nrecvd < (ssize_t)(sizeof(struct iperf_udphdr_s) +
+                             sizeof(struct iperf_serverhdr_s)))
+        {
+          continue;
+        }
+
+      hdr = (FAR struct iperf_serverhdr_s *)&udp[1];
+      if ((ntohl(hdr->flags) & IPERF_HEADER_VERSION1) == 0)
+        {
+          continue;
+        }
+
+      nbytes = ((uint64_t)ntohl(hdr->total_len1) << 32) |
+               ntohl(hdr->total_len2);
+      stop   = (uint64_t)ntohl(hdr->stop_sec) * 1000000 +
+               ntohl(hdr->stop_usec);
+
+      stats.datagrams  = ntohl(hdr->datagrams);
+      stats.lost       = ntohl(hdr->error_cnt);
+      stats.outoforder = ntohl(hdr->outorder_cnt);
+      stats.jitter     = ntohl(hdr->jitter1) * 1000000 +
+                         ntohl(hdr->jitter2);
+
+      printf("[%3d] Server Report:\n", stream->id);
+      iperf_report(stream->id, 0, stop, nbytes, &stats);
+      return;
+    }
+
+  printf("[%3d] WARNING: No report from the server\n", stream->id);
+}
+
+/****************************************************************************
+ * Name: iperf_udpsend
+ *
+ * Description:
+ *   Send numbered, time stamped datagrams at the requested rate.  The
+ *   schedule is absolute so that oversleeping is made up for.
+ *
+ ****************************************************************************/
+
+static int iperf_udpsend(FAR struct iperf_stream_s *stream)
+{
+  FAR const struct iperf_args_s *args = stream->args;
+  FAR struct iperf_udphdr_s *udp = (FAR struct iperf_udphdr_s *)stream->buffer;
+  uint64_t interval = (uint64_t)args->interval * 1000000;
+  uint64_t end = stream->start + (uint64_t)args->duration * 1000000;
+  uint64_t gap = (uint64_t)args->len * 8 * 1000000 / args->bandwidth;
+  uint64_t lastbytes = 0;
+  uint64_t next = stream->start + interval;
+  uint64_t due = stream->start;
+  uint64_t now;
+  int32_t id = 0;
+  ssize_t nsent;
+
+  for (now = iperf_now(); now < end; now = iperf_now())
+    {
+      if (now < due)
+        {
+          usleep((useconds_t)(due - now));
+          now = iperf_now();
+        }
+
+      udp->id      = htonl(id);
+      udp->tv_sec  = htonl((uint32_t)(now / 1000000));
+      udp->tv_usec = htonl((uint32_t)(now % 1000000));
+
+      nsent = send(stream->sd, stream->buffer, args->len, 0);
+      if (nsent < 0)
+        {
+          /* Running out of buffers is to be expected at high rates */
+
+          if (errno != EINTR && errno != ENOMEM && errno != EAGAIN)
+            {
+              return -errno;
+            }
+        }
+      else
+        {
+          stream->nbytes += nsent;
+          id++;
+        }
+
+      due += gap;
+      iperf_interval(stream, now, &next, &lastbytes);
+    }
+
+  iperf_report(stream->id, 0, iperf_now() - stream->start, stream->nbytes,
+               NULL);
+  printf("[%3d] Sent %ld datagrams\n", stream->id, (long)id);
+
+  iperf_udpfin(stream, id);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: iperf_stream
+ ****************************************************************************/
+
+static FAR void *iperf_stream(FAR void *arg)
+{
+  FAR struct iperf_stream_s *stream = (FAR struct iperf_stream_s *)arg;
+
+  if (stream->args->udp)
+    {
+      stream->result = iperf_udpsend(stream);
+    }
+  else
+    {
+      stream->result = iperf_tcpsend(stream);
+    }
+
+  stream->end = iperf_now();
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: iperf_connect
+ ****************************************************************************/
+
+static int iperf_connect(FAR const struct iperf_args_s *args,
+                         FAR struct iperf_stream_s *stream)
+{
+  struct sockaddr_in server;
+  int errcode;
+
+  stream->sd = socket(PF_INET, args->udp ? SOCK_DGRAM : SOCK_STREAM, 0);
+  if (stream->sd < 0)
+    {
+      errcode = errno;
+      printf("ERROR: socket() failed: %d\n", errcode);
+      return -errcode;
+    }
+
+  (void)iperf_setwindow(stream->sd, SO_SNDBUF, args->window);
+
+  memset(&server, 0, sizeof(struct sockaddr_in));
+  server.sin_family      = AF_INET;
+  server.sin_port        = htons(args->port);
+  server.sin_addr.s_addr = args->host;
+
+  if (connect(stream->sd, (FAR struct sockaddr *)&server,
+              sizeof(struct sockaddr_in)) < 0)
+    {
+      errcode = errno;
+      printf("ERROR: connect() failed: %d\n", errcode);
+      close(stream->sd);
+      stream->sd = -1;
+      return -errcode;
+    }
+
+  printf("[%3d] connected to %s port %u\n", stream->id,
+         inet_ntoa(server.sin_addr), args->port);
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: iperf_client
+ *
+ * Description:
+ *   Send to an iperf server over nstreams parallel connections.
+ *
+ ****************************************************************************/
+
+int iperf_client(FAR const struct iperf_args_s *args)
+{
+  struct iperf_stream_s streams[CONFIG_EXAMPLES_IPERF_MAXSTREAMS];
+  pthread_attr_t attr;
+  uint64_t nbytes;
+  uint64_t start = 0;
+  uint64_t end = 0;
+  int nstarted;
+  int ret;
+  int i;
+
+  memset(streams, 0, sizeof(streams));
+
+  printf("Client connecting, %s port %u, %lu byte buffers\n",
+         args->udp ? "UDP" : "TCP", args->port, (unsigned long)args->len);
+
+  if (args->udp)
+    {
+      printf("Sending at %lu bits/sec\n", (unsigned long)args->bandwidth);
+    }
+
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, CONFIG_EXAMPLES_IPERF_STREAMSTACK);
+
+  /* All streams are connected first, so that they run at the same time */
+
+  ret = OK;
+  for (i = 0; i < args->nstreams; i++)
+    {
+      streams[i].args = args;
+      streams[i].id   = i + 3;
+      streams[i].sd   = -1;
+
+      streams[i].buffer = (FAR uint8_t *)malloc(args->len);
+      if (streams[i].buffer == NULL)
+        {
+          ret = -ENOMEM;
+          break;
+        }
+
+      iperf_fillbuffer(streams[i].buffer, args->len);
+
+      ret = iperf_connect(args, &streams[i]);
+      if (ret < 0)
+        {
+          break;
+        }
+    }
+
+  nstarted = 0;
+  if (ret == OK)
+    {
+      start = iperf_now();
+      for (; nstarted < args->nstreams; nstarted++)
+        {
+          streams[nstarted].start = start;
+          ret = pthread_create(&streams[nstarted].thread, &attr,
+                               iperf_stream, &streams[nstarted]);
+          if (ret != 0)
+            {
+              printf("ERROR: pthread_create() failed: %d\n", ret);
+              ret = -ret;
+              break;
+            }
+        }
+    }
+
+  nbytes = 0;
+  for (i = 0; i < nstarted; i++)
+    {
+      pthread_join(streams[i].thread, NULL);
+      nbytes += streams[i].nbytes;
+
+      if (streams[i].result < 0)
+        {
+          printf("[%3d] ERROR: Send failed: %d\n", streams[i].id,
+                 -streams[i].result);
+          ret = streams[i].result;
+        }
+      else if (!args->udp)
+        {
+          iperf_report(streams[i].id, 0, streams[i].end - streams[i].start,
+                       streams[i].nbytes, NULL);
+        }
+
+      if (streams[i].end > end)
+        {
+          end = streams[i].end;
+        }
+    }
+
+  if (nstarted > 1)
+    {
+      iperf_report(-1, 0, end - start, nbytes, NULL);
+    }
+
+  for (i = 0; i < args->nstreams; i++)
+    {
+      if (streams[i].sd >= 0)
+        {
+          close(streams[i].sd);
+        }
+
+      free(streams[i].buffer);
+    }
+
+  pthread_attr_destroy(&attr);
+  return ret;
+}
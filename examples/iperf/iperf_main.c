@@ -0,0 +1,334 @@
+/****************************************************************************
+ * apps/examples/iperf/iperf_main.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/socket.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+
+#include <arpa/inet.h>
+
+#include "iperf.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_IPERF_DURATION
+#  define CONFIG_EXAMPLES_IPERF_DURATION 10
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define IPERF_CLOCK CLOCK_MONOTONIC
+#else
+#  define IPERF_CLOCK CLOCK_REALTIME
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: iperf_showusage
+ ****************************************************************************/
+
+static void iperf_showusage(FAR const char *progname)
+{
+  fprintf(stderr, "USAGE: %s -s [-u] [options]\n", progname);
+  fprintf(stderr, "       %s -c <host> [-u] [options]\n", progname);
+  fprintf(stderr, "  -s         Run as the server\n");
+  fprintf(stderr, "  -c <host>  Run as a client of the server at <host>\n");
+  fprintf(stderr, "  -u         Use UDP instead of TCP\n");
+  fprintf(stderr, "  -p <port>  Server port (default %d)\n",
+          CONFIG_EXAMPLES_IPERF_PORT);
+  fprintf(stderr, "  -t <sec>   Length of the test (default %d)\n",
+          CONFIG_EXAMPLES_IPERF_DURATION);
+  fprintf(stderr, "  -i <sec>   Seconds between reports (default none)\n");
+  fprintf(stderr, "  -l <len>   Size of each read or write (default %d)\n",
+          CONFIG_EXAMPLES_IPERF_BUFSIZE);
+  fprintf(stderr, "  -w <size>  Socket buffer size\n");
+  fprintf(stderr, "  -b <rate>  UDP bits per second, K/M/G suffix "
+          "(default %d)\n", CONFIG_EXAMPLES_IPERF_BANDWIDTH);
+  fprintf(stderr, "  -P <n>     Parallel client streams (max %d)\n",
+          CONFIG_EXAMPLES_IPERF_MAXSTREAMS);
+}
+
+/****************************************************************************
+ * Name: iperf_getsize
+ *
+ * Description:
+ *   Convert a number with an optional K, M or G suffix.
+ *
+ ****************************************************************************/
+
+static unsigned long iperf_getsize(FAR const char *str)
+{
+  FAR char *end;
+  unsigned long value;
+
+  value = strtoul(str, &end, 10);
+  switch (*end)
+    {
+      case 'k':
+      case 'K':
+        value *= 1000;
+        break;
+
+      case 'm':
+      case 'M':
+        value *= 1000000;
+        break;
+
+      case 'g':
+      case 'G':
+        value *= 1000000000;
+        break;
+
+      default:
+        break;
+    }
+
+  return value;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: iperf_now
+ *
+ * Description:
+ *   Return the current time in microseconds.
+ *
+ ****************************************************************************/
+
+uint64_t iperf_now(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(IPERF_CLOCK, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * Name: iperf_report
+ *
+ * Description:
+ *   Show the throughput of one stream between from and to (microseconds
+ *   since its start) in the format of iperf.  Integer arithmetic is used
+ *   so that no floating point support is needed.
+ *
+ ****************************************************************************/
+
+void iperf_report(int id, uint64_t from, uint64_t to, uint64_t nbytes,
+                  FAR const struct iperf_udpstats_s *udp)
+{
+  uint64_t elapsed = to > from ? to - from : 1;
+  unsigned long kbits;
+
+  kbits = (unsigned long)(nbytes * 8 * 1000 / elapsed);
+
+  if (id < 0)
+    {
+      printf("[SUM] ");
+    }
+  else
+    {
+      printf("[%3d] ", id);
+    }
+
+  printf("%3lu.%lu-%3lu.%lu sec %8lu KBytes %8lu Kbits/sec",
+         (unsigned long)(from / 1000000),
+         (unsigned long)(from / 100000 % 10),
+         (unsigned long)(to / 1000000),
+         (unsigned long)(to / 100000 % 10),
+         (unsigned long)(nbytes / 1024), kbits);
+
+  if (udp != NULL)
+    {
+      uint32_t total = udp->datagrams > 0 ? udp->datagrams : 1;
+
+      printf(" %3lu.%03lu ms %5lu/%5lu (%lu%%)",
+             (unsigned long)(udp->jitter / 1000),
+             (unsigned long)(udp->jitter % 1000),
+             (unsigned long)udp->lost, (unsigned long)udp->datagrams,
+             (unsigned long)((uint64_t)udp->lost * 100 / total));
+
+      if (udp->outoforder > 0)
+        {
+          printf(" %lu out of order", (unsigned long)udp->outoforder);
+        }
+    }
+
+  printf("\n");
+}
+
+/****************************************************************************
+ * Name: iperf_setwindow
+ *
+ * Description:
+ *   Set the send or receive buffer size of a socket, if requested.  Not
+ *   all network stacks support this, so failures are only reported.
+ *
+ ****************************************************************************/
+
+int iperf_setwindow(int sd, int option, int window)
+{
+  int ret;
+
+  if (window <= 0)
+    {
+      return OK;
+    }
+
+  ret = setsockopt(sd, SOL_SOCKET, option, &window, sizeof(int));
+  if (ret < 0)
+    {
+      printf("WARNING: Cannot set the window size: %d\n", errno);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: iperf_main
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int iperf_main(int argc, char *argv[])
+#endif
+{
+  struct iperf_args_s args;
+  bool client = false;
+  int option;
+  int ret;
+
+  memset(&args, 0, sizeof(struct iperf_args_s));
+  args.port      = CONFIG_EXAMPLES_IPERF_PORT;
+  args.duration  = CONFIG_EXAMPLES_IPERF_DURATION;
+  args.len       = CONFIG_EXAMPLES_IPERF_BUFSIZE;
+  args.bandwidth = CONFIG_EXAMPLES_IPERF_BANDWIDTH;
+  args.nstreams  = 1;
+
+  optind = 0;
+  while ((option = getopt(argc, argv, ":sc:up:t:i:l:w:b:P:")) != ERROR)
+    {
+      switch (option)
+        {
+          case 's':
+            args.server = true;
+            break;
+
+          case 'c':
+            if (inet_pton(AF_INET, optarg, &args.host) != 1)
+              {
+                fprintf(stderr, "ERROR: Bad address: %s\n", optarg);
+                return EXIT_FAILURE;
+              }
+
+            client = true;
+            break;
+
+          case 'u':
+            args.udp = true;
+            break;
+
+          case 'p':
+            args.port = (uint16_t)atoi(optarg);
+            break;
+
+          case 't':
+            args.duration = (uint32_t)atoi(optarg);
+            break;
+
+          case 'i':
+            args.interval = (uint32_t)atoi(optarg);
+            break;
+
+          case 'l':
+            args.len = (size_t)iperf_getsize(optarg);
+            break;
+
+          case 'w':
+            args.window = (int)iperf_getsize(optarg);
+            break;
+
+          case 'b':
+            args.bandwidth = (uint32_t)iperf_getsize(optarg);
+            break;
+
+          case 'P':
+            args.nstreams = atoi(optarg);
+            break;
+
+          default:
+            iperf_showusage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+  if (args.server == client || args.nstreams < 1 ||
+      args.nstreams > CONFIG_EXAMPLES_IPERF_MAXSTREAMS ||
+      args.len == 0 || args.bandwidth == 0 ||
+      (args.udp && args.len < IPERF_UDPMINLEN))
+    {
+      iperf_showusage(argv[0]);
+      return EXIT_FAILURE;
+    }
+
+  if (args.server)
+    {
+      ret = iperf_server(&args);
+    }
+  else
+    {
+      ret = iperf_client(&args);
+    }
+
+  fflush(stdout);
+  return ret < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,590 @@
+/****************************************************************************
+ * apps/examples/iperf/iperf_server.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/socket.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <errno.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include "iperf.h"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One TCP connection or UDP client */
+
+struct iperf_peer_s
+{
+  FAR const struct iperf_args_s *args;
+  volatile bool busy;       /* In use */
+  bool done;                /* UDP: The client ended the test */
+  int id;                   /* Connection number in reports */
+  int sd;                   /* TCP: The connection */
+  struct sockaddr_in addr;  /* Address of the client */
+  FAR uint8_t *buffer;      /* TCP: Receive buffer */
+  uint64_t start;           /* First data received (usec) */
+  uint64_t last;            /* Last data received (usec) */
+  uint64_t next;            /* End of the current interval (usec) */
+  uint64_t nbytes;          /* Bytes received */
+  uint64_t lastbytes;       /* Bytes received at the last report */
+
+  /* UDP receive statistics */
+
+  int32_t expected;         /* Next datagram id expected */
+  int32_t maxid;            /* Highest datagram id received */
+  uint32_t lost;            /* Datagrams missing */
+  uint32_t lastlost;        /* Lost at the last report */
+  uint32_t lastid;          /* Highest id at the last report */
+  uint32_t outoforder;      /* Datagrams that arrived late */
+  uint32_t jitter16;        /* Jitter in usec, times 16 */
+  int64_t transit;          /* Transit time of the last datagram */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct iperf_peer_s g_peers[CONFIG_EXAMPLES_IPERF_MAXSTREAMS];
+static int g_nextid = 3;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: iperf_udpstats
+ ****************************************************************************/
+
+static void iperf_udpstats(FAR struct iperf_peer_s *peer, bool interval,
+                           FAR struct iperf_udpstats_s *stats)
+{
+  stats->datagrams  = peer->maxid + 1;
+  stats->lost       = peer->lost;
+  stats->outoforder = peer->outoforder;
+  stats->jitter     = peer->jitter16 >> 4;
+
+  if (interval)
+    {
+      stats->datagrams -= peer->lastid;
+      stats->lost      -= peer->lastlost;
+      peer->lastid      = peer->maxid + 1;
+      peer->lastlost    = peer->lost;
+    }
+}
+
+/****************************************************************************
+ * Name: iperf_interval
+ *
+ * Description:
+ *   Show the interval reports that are due.
+ *
+ ****************************************************************************/
+
+static void iperf_interval(FAR struct iperf_peer_s *peer, uint64_t now)
+{
+  uint64_t interval = (uint64_t)peer->args->interval * 1000000;
+  struct iperf_udpstats_s stats;
+
+  if (interval == 0)
+    {
+      return;
+    }
+
+  while (now >= peer->next)
+    {
+      if (peer->args->udp)
+        {
+          iperf_udpstats(peer, true, &stats);
+        }
+
+      iperf_report(peer->id, peer->next - interval - peer->start,
+                   peer->next - peer->start, peer->nbytes - peer->lastbytes,
+                   peer->args->udp ? &stats : NULL);
+
+      peer->lastbytes = peer->nbytes;
+      peer->next     += interval;
+    }
+}
+
+/****************************************************************************
+ * Name: iperf_newpeer
+ ****************************************************************************/
+
+static FAR struct iperf_peer_s *
+iperf_newpeer(FAR const struct iperf_args_s *args,
+              FAR const struct sockaddr_in *addr, uint64_t now)
+{
+  FAR struct iperf_peer_s *peer = NULL;
+  int i;
+
+  /* Reuse a UDP peer whose test is over if there is no free one */
+
+  for (i = 0; i < CONFIG_EXAMPLES_IPERF_MAXSTREAMS; i++)
+    {
+      if (!g_peers[i].busy)
+        {
+          peer = &g_peers[i];
+          break;
+        }
+
+      if (g_peers[i].done && peer == NULL)
+        {
+          peer = &g_peers[i];
+        }
+    }
+
+  if (peer == NULL)
+    {
+      return NULL;
+    }
+
+  free(peer->buffer);
+  memset(peer, 0, sizeof(struct iperf_peer_s));
+
+  peer->args  = args;
+  peer->busy  = true;
+  peer->id    = g_nextid++;
+  peer->sd    = -1;
+  peer->start = now;
+  peer->last  = now;
+  peer->next  = now + (uint64_t)args->interval * 1000000;
+  memcpy(&peer->addr, addr, sizeof(struct sockaddr_in));
+
+  printf("[%3d] connected with %s port %u\n", peer->id,
+         inet_ntoa(addr->sin_addr), ntohs(addr->sin_port));
+  return peer;
+}
+
+/****************************************************************************
+ * Name: iperf_tcppeer
+ ****************************************************************************/
+
+static FAR void *iperf_tcppeer(FAR void *arg)
+{
+  FAR struct iperf_peer_s *peer = (FAR struct iperf_peer_s *)arg;
+  ssize_t nrecvd;
+  uint64_t now;
+
+  for (; ; )
+    {
+      nrecvd = recv(peer->sd, peer->buffer, peer->args->len, 0);
+      if (nrecvd < 0 && errno == EINTR)
+        {
+          continue;
+        }
+
+      if (nrecvd <= 0)
+        {
+          break;
+        }
+
+      now           = iperf_now();
+      peer->nbytes += nrecvd;
+      peer->last    = now;
+      iperf_interval(peer, now);
+    }
+
+  iperf_report(peer->id, 0, peer->last - peer->start, peer->nbytes, NULL);
+
+  close(peer->sd);
+  peer->sd   = -1;
+  peer->busy = false;
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: iperf_tcpserver
+ ****************************************************************************/
+
+static int iperf_tcpserver(FAR const struct iperf_args_s *args, int sd)
+{
+  FAR struct iperf_peer_s *peer;
+  struct sockaddr_in addr;
+  pthread_attr_t attr;
+  pthread_t thread;
+  socklen_t addrlen;
+  int acceptsd;
+  int errcode;
+  int ret;
+
+  if (listen(sd, CONFIG_EXAMPLES_IPERF_MAXSTREAMS) < 0)
+    {
+      errcode = errno;
+      printf("ERROR: listen() failed: %d\n", errcode);
+      return -errcode;
+    }
+
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, CONFIG_EXAMPLES_IPERF_STREAMSTACK);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+  for (; ; )
+    {
+      addrlen  = sizeof(struct sockaddr_in);
+      acceptsd = accept(sd, (FAR struct sockaddr *)&addr, &addrlen);
+      if (acceptsd < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          errcode = errno;
+          printf("ERROR: accept() failed: %d\n", errcode);
+          ret = -errcode;
+          break;
+        }
+
+      peer = iperf_newpeer(args, &addr, iperf_now());
+      if (peer != NULL)
+        {
+          peer->buffer = (FAR uint8_t *)malloc(args->len);
+        }
+
+      if (peer == NULL || peer->buffer == NULL)
+        {
+          printf("WARNING: Too many connections\n");
+          if (peer != NULL)
+            {
+              peer->busy = false;
+            }
+
+          close(acceptsd);
+          continue;
+        }
+
+      (void)iperf_setwindow(acceptsd, SO_RCVBUF, args->window);
+      peer->sd = acceptsd;
+
+      ret = pthread_create(&thread, &attr, iperf_tcppeer, peer);
+      if (ret != 0)
+        {
+          printf("ERROR: pthread_create() failed: %d\n", ret);
+          close(acceptsd);
+          peer->sd   = -1;
+          peer->busy = false;
+        }
+    }
+
+  pthread_attr_destroy(&attr);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: iperf_udpdatagram
+ *
+ * Description:
+ *   Account for one datagram.  Loss and jitter follow iperf 2: jitter is
+ *   the smoothed difference of the transit times of successive datagrams
+ *   (RFC 1889), so the offset between the clocks of the hosts cancels.
+ *
+ ****************************************************************************/
+
+static void iperf_udpdatagram(FAR struct iperf_peer_s *peer,
+                              FAR const struct iperf_udphdr_s *udp,
+                              size_t len, uint64_t now)
+{
+  int32_t id = (int32_t)ntohl(udp->id);
+  int64_t sent;
+  int64_t transit;
+  int64_t delta;
+
+  if (id < 0)
+    {
+      id = -id;
+    }
+
+  sent = (int64_t)ntohl(udp->tv_sec) * 1000000 + ntohl(udp->tv_usec);
+  transit = (int64_t)now - sent;
+
+  if (peer->nbytes > 0)
+    {
+      delta = transit - peer->transit;
+      if (delta < 0)
+        {
+          delta = -delta;
+        }
+
+      peer->jitter16 += (uint32_t)delta - ((peer->jitter16 + 8) >> 4);
+    }
+
+  peer->transit = transit;
+  peer->nbytes += len;
+  peer->last    = now;
+
+  if (id >= peer->expected)
+    {
+      peer->lost    += id - peer->expected;
+      peer->expected = id + 1;
+      peer->maxid    = id;
+    }
+  else
+    {
+      peer->outoforder++;
+      if (peer->lost > 0)
+        {
+          peer->lost--;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: iperf_udpreply
+ *
+ * Description:
+ *   Send the report that the client asks for with its final datagram.
+ *
+ ****************************************************************************/
+
+static void iperf_udpreply(FAR struct iperf_peer_s *peer, int sd,
+                           FAR uint8_t *buffer, size_t len)
+{
+  FAR struct iperf_udphdr_s *udp = (FAR struct iperf_udphdr_s *)buffer;
+  FAR struct iperf_serverhdr_s *hdr = (FAR struct iperf_serverhdr_s *)&udp[1];
+  uint64_t stop = peer->last - peer->start;
+  uint32_t jitter = peer->jitter16 >> 4;
+
+  if (len < sizeof(struct iperf_udphdr_s) + sizeof(struct iperf_serverhdr_s))
+    {
+      return;
+    }
+
+  /* The header of the datagram received is returned as it is */
+
+  memset(hdr, 0, sizeof(struct iperf_serverhdr_s));
+  hdr->flags        = htonl(IPERF_HEADER_VERSION1);
+  hdr->total_len1   = htonl((uint32_t)(peer->nbytes >> 32));
+  hdr->total_len2   = htonl((uint32_t)peer->nbytes);
+  hdr->stop_sec     = htonl((uint32_t)(stop / 1000000));
+  hdr->stop_usec    = htonl((uint32_t)(stop % 1000000));
+  hdr->error_cnt    = htonl(peer->lost);
+  hdr->outorder_cnt = htonl(peer->outoforder);
+  hdr->datagrams    = htonl((uint32_t)peer->maxid);
+  hdr->jitter1      = htonl(jitter / 1000000);
+  hdr->jitter2      = htonl(jitter % 1000000);
+
+  (void)sendto(sd, buffer, len, 0, (FAR struct sockaddr *)&peer->addr,
+               sizeof(struct sockaddr_in));
+}
+
+/****************************************************************************
+ * Name: iperf_udpserver
+ ****************************************************************************/
+
+static int iperf_udpserver(FAR const struct iperf_args_s *args, int sd)
+{
+  FAR struct iperf_peer_s *peer;
+  struct iperf_udpstats_s stats;
+  struct sockaddr_in addr;
+  FAR uint8_t *buffer;
+  socklen_t addrlen;
+  ssize_t nrecvd;
+  uint64_t now;
+  int32_t id;
+  int errcode;
+  int ret = OK;
+  int i;
+
+  buffer = (FAR uint8_t *)malloc(args->len);
+  if (buffer == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  (void)iperf_setwindow(sd, SO_RCVBUF, args->window);
+
+  for (; ; )
+    {
+      addrlen = sizeof(struct sockaddr_in);
+      nrecvd  = recvfrom(sd, buffer, args->len, 0,
+                         (FAR struct sockaddr *)&addr, &addrlen);
+      if (nrecvd < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          errcode = errno;
+          printf("ERROR: recvfrom() failed: %d\n", errcode);
+          ret = -errcode;
+          break;
+        }
+
+      if (nrecvd < (ssize_t)sizeof(struct iperf_udphdr_s))
+        {
+          continue;
+        }
+
+      now = iperf_now();
+      id  = (int32_t)ntohl(((FAR struct iperf_udphdr_s *)buffer)->id);
+
+      peer = NULL;
+      for (i = 0; i < CONFIG_EXAMPLES_IPERF_MAXSTREAMS; i++)
+        {
+          if (g_peers[i].busy &&
+              g_peers[i].addr.sin_addr.s_addr == addr.sin_addr.s_addr &&
+              g_peers[i].addr.sin_port == addr.sin_port)
+            {
+              peer = &g_peers[i];
+              break;
+            }
+        }
+
+      if (peer != NULL && peer->done)
+        {
+          /* The client did not get the report.  Send it again. */
+
+          if (id < 0)
+            {
+              iperf_udpreply(peer, sd, buffer, nrecvd);
+              continue;
+            }
+
+          peer = NULL;
+        }
+
+      if (peer == NULL)
+        {
+          if (id < 0)
+            {
+              continue;
+            }
+
+          peer = iperf_newpeer(args, &addr, now);
+          if (peer == NULL)
+            {
+              continue;
+            }
+        }
+
+      iperf_udpdatagram(peer, (FAR struct iperf_udphdr_s *)buffer, nrecvd,
+                        now);
+      iperf_interval(peer, now);
+
+      if (id < 0)
+        {
+          iperf_udpstats(peer, false, &stats);
+          iperf_report(peer->id, 0, peer->last - peer->start, peer->nbytes,
+                       &stats);
+
+          peer->done = true;
+          iperf_udpreply(peer, sd, buffer, nrecvd);
+        }
+    }
+
+  free(buffer);
+  return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: iperf_server
+ *
+ * Description:
+ *   Receive from iperf clients until an error occurs.
+ *
+ ****************************************************************************/
+
+int iperf_server(FAR const struct iperf_args_s *args)
+{
+  struct sockaddr_in addr;
+  int optval;
+  int errcode;
+  int ret;
+  int sd;
+
+  sd = socket(PF_INET, args->udp ? SOCK_DGRAM : SOCK_STREAM, 0);
+  if (sd < 0)
+    {
+      errcode = errno;
+      printf("ERROR: socket() failed: %d\n", errcode);
+      return -errcode;
+    }
+
+#ifdef CONFIG_NET_SOCKOPTS
+  optval = 1;
+  (void)setsockopt(sd, SOL_SOCKET, SO_REUSEADDR, &optval, sizeof(int));
+#else
+  UNUSED(optval);
+#endif
+
+  memset(&addr, 0, sizeof(struct sockaddr_in));
+  addr.sin_family      = AF_INET;
+  addr.sin_port        = htons(args->port);
+  addr.sin_addr.s_addr = INADDR_ANY;
+
+  if (bind(sd, (FAR struct sockaddr *)&addr, sizeof(struct sockaddr_in)) < 0)
+    {
+      errcode = errno;
+      printf("ERROR: bind() failed: %d\n", errcode);
+      ret = -errcode;
+      goto errout_with_socket;
+    }
+
+  printf("Server listening on %s port %u, %lu byte buffers\n",
+         args->udp ? "UDP" : "TCP", args->port, (unsigned long)args->len);
+
+  if (args->udp)
+    {
+      ret = iperf_udpserver(args, sd);
+    }
+  else
+    {
+      ret = iperf_tcpserver(args, sd);
+    }
+
+errout_with_socket:
+  close(sd);
+  return ret;
+}
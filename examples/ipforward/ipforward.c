@@ -40,12 +40,16 @@
 #include <nuttx/config.h>
 
 #include <sys/ioctl.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <stdio.h>
 #include <string.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <pthread.h>
+#include <time.h>
 #include <errno.h>
 
 #include <net/if.h>
@@ -57,6 +61,7 @@
 #include <nuttx/net/tun.h>
 
 #include "netutils/netlib.h"
+#include "system/benchutil.h"
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -75,6 +80,28 @@
 #  define IP_HDRLEN     IPv4_HDRLEN
 #endif
 
+#ifdef CONFIG_EXAMPLES_IPFORWARD_BENCH
+#  ifndef CONFIG_EXAMPLES_IPFORWARD_BENCH_COUNT
+#    define CONFIG_EXAMPLES_IPFORWARD_BENCH_COUNT 1000
+#  endif
+
+#  ifndef CONFIG_EXAMPLES_IPFORWARD_BENCH_SIZE
+#    define CONFIG_EXAMPLES_IPFORWARD_BENCH_SIZE 64
+#  endif
+
+#  ifndef CONFIG_EXAMPLES_IPFORWARD_BENCH_RATE
+#    define CONFIG_EXAMPLES_IPFORWARD_BENCH_RATE 0
+#  endif
+
+#  ifndef CONFIG_EXAMPLES_IPFORWARD_BENCH_DRAIN
+#    define CONFIG_EXAMPLES_IPFORWARD_BENCH_DRAIN 200
+#  endif
+
+#  define IPFWD_BENCH_MAGIC   0x49504657  /* "IPFW" */
+#  define IPFWD_BENCH_POLLMS  50
+#  define IPFWD_BENCH_MAXLIST 8
+#endif
+
 #if defined(CONFIG_NET_ETHERNET)
 #  define MAC_ADDRLEN    6   /* IFHWADDRLEN */
 #elif defined(CONFIG_NET_6LOWPAN)
@@ -113,6 +140,34 @@ struct ipfwd_arg_s
   uint8_t            ia_buffer[IPFWD_BUFSIZE];
 };
 
+#ifdef CONFIG_EXAMPLES_IPFORWARD_BENCH
+/* The start of the TCP payload of a benchmark packet */
+
+struct ipfwd_stamp_s
+{
+  uint32_t           is_magic;     /* IPFWD_BENCH_MAGIC */
+  uint32_t           is_run;       /* Discards stragglers of earlier runs */
+  uint32_t           is_seqno;     /* Packet number within the run */
+  uint32_t           is_usec;      /* Send time, low 32 bits */
+};
+
+/* Results of one run, filled in by the receiver thread */
+
+struct ipfwd_bench_s
+{
+  FAR struct ipfwd_arg_s *ib_rx;
+  volatile bool      ib_stop;
+  uint32_t           ib_run;
+  uint32_t           ib_next;      /* Next sequence number expected */
+  uint32_t           ib_nrecvd;
+  uint32_t           ib_nreorder;
+  uint32_t           ib_latmin;
+  uint32_t           ib_latmax;
+  uint64_t           ib_latsum;
+  uint64_t           ib_last;      /* Time of the last packet */
+};
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -567,12 +622,18 @@ static FAR void *ipfwd_receiver(FAR void *arg)
 }
 
 /****************************************************************************
- * Name: ipfwd_sender
+ * Name: ipfwd_mkpacket
+ *
+ * Description:
+ *   Build a packet from the source to the destination address of fwd in
+ *   its buffer and return the packet length.  The payload is used only for
+ *   TCP.
+ *
  ****************************************************************************/
 
-static FAR void *ipfwd_sender(FAR void *arg)
+static size_t ipfwd_mkpacket(FAR struct ipfwd_arg_s *fwd,
+                             FAR const void *payload, size_t paysize)
 {
-  FAR struct ipfwd_arg_s *fwd = (FAR struct ipfwd_arg_s *)arg;
 #ifdef CONFIG_NET_IPv6
   FAR struct ipv6_hdr_s *ipv6;
 #else
@@ -580,159 +641,181 @@ static FAR void *ipfwd_sender(FAR void *arg)
 #endif
 #ifdef CONFIG_EXAMPLES_IPFORWARD_TCP
   FAR struct tcp_hdr_s *tcp;
-  FAR char *payload;
 #endif
 #ifdef CONFIG_EXAMPLES_IPFORWARD_ICMPv6
   FAR struct icmpv6_neighbor_solicit_s *sol;
 #endif
-  size_t paysize;
   size_t pktlen;
-  ssize_t nwritten;
   uint16_t l3hdrlen;
   uint8_t proto;
-  int errcode;
-  int i;
 
 #ifdef CONFIG_EXAMPLES_IPFORWARD_TCP
   l3hdrlen = TCP_HDRLEN;
-  paysize  = sizeof(g_payload);
   proto    = IP_PROTO_TCP;
 #else
   l3hdrlen = SIZEOF_ICMPV6_NEIGHBOR_SOLICIT_S(MAC_ADDRLEN);
   paysize  = 0;
   proto    = IP_PROTO_ICMP6;
+  UNUSED(payload);
 #endif
 
-  for (i = 0; i < IPFWD_NPACKETS; i++)
-    {
 #ifdef CONFIG_NET_IPv6
-      ipv6 = (FAR struct ipv6_hdr_s *)fwd->ia_buffer;
+  ipv6 = (FAR struct ipv6_hdr_s *)fwd->ia_buffer;
 
-      /* Set up the IPv6 header */
+  /* Set up the IPv6 header */
 
-      ipv6->vtc    = 0x60;                         /* Version/traffic class (MS) */
-      ipv6->tcf    = 0;                            /* Traffic class (LS)/Flow label (MS) */
-      ipv6->flow   = 0;                            /* Flow label (LS) */
+  ipv6->vtc    = 0x60;                         /* Version/traffic class (MS) */
+  ipv6->tcf    = 0;                            /* Traffic class (LS)/Flow label (MS) */
+  ipv6->flow   = 0;                            /* Flow label (LS) */
 
-      /* Length excludes the IPv6 header */
+  /* Length excludes the IPv6 header */
 
-      pktlen       = l3hdrlen + paysize;
-      ipv6->len[0] = (pktlen >> 8);
-      ipv6->len[1] = (pktlen & 0xff);
+  pktlen       = l3hdrlen + paysize;
+  ipv6->len[0] = (pktlen >> 8);
+  ipv6->len[1] = (pktlen & 0xff);
 
-      ipv6->proto  = proto;                 /* Next header */
-      ipv6->ttl    = 255;                          /* Hop limit */
+  ipv6->proto  = proto;                 /* Next header */
+  ipv6->ttl    = 255;                          /* Hop limit */
 
 #ifdef CONFIG_EXAMPLES_IPFORWARD_TCP
-      /* Set the uniicast destination IP address */
+  /* Set the uniicast destination IP address */
 
-      net_ipv6addr_copy(ipv6->destipaddr, fwd->ia_destipaddr);
+  net_ipv6addr_copy(ipv6->destipaddr, fwd->ia_destipaddr);
 #else
-      /* Set the multicast destination IP address */
-
-      ipv6->destipaddr[0] = HTONS(0xff02);
-      ipv6->destipaddr[1] = HTONS(0x0000);
-      ipv6->destipaddr[2] = HTONS(0x0000);
-      ipv6->destipaddr[3] = HTONS(0x0000);
-      ipv6->destipaddr[4] = HTONS(0x0000);
-      ipv6->destipaddr[5] = HTONS(0x0001);
-      ipv6->destipaddr[6] = fwd->ia_destipaddr[6] | HTONS(0xff00);
-      ipv6->destipaddr[7] = fwd->ia_destipaddr[7];
+  /* Set the multicast destination IP address */
+
+  ipv6->destipaddr[0] = HTONS(0xff02);
+  ipv6->destipaddr[1] = HTONS(0x0000);
+  ipv6->destipaddr[2] = HTONS(0x0000);
+  ipv6->destipaddr[3] = HTONS(0x0000);
+  ipv6->destipaddr[4] = HTONS(0x0000);
+  ipv6->destipaddr[5] = HTONS(0x0001);
+  ipv6->destipaddr[6] = fwd->ia_destipaddr[6] | HTONS(0xff00);
+  ipv6->destipaddr[7] = fwd->ia_destipaddr[7];
 #endif
 
-      /* Set source IP address. */
+  /* Set source IP address. */
 
-      net_ipv6addr_copy(ipv6->srcipaddr,  fwd->ia_srcipaddr);
+  net_ipv6addr_copy(ipv6->srcipaddr,  fwd->ia_srcipaddr);
 
-      pktlen       = IPv6_HDRLEN + l3hdrlen + paysize;
+  pktlen       = IPv6_HDRLEN + l3hdrlen + paysize;
 #ifdef CONFIG_EXAMPLES_IPFORWARD_TCP
-      tcp          = (FAR struct tcp_hdr_s *)
-                      &fwd->ia_buffer[IPv6_HDRLEN];
+  tcp          = (FAR struct tcp_hdr_s *)
+                  &fwd->ia_buffer[IPv6_HDRLEN];
 #else
-      sol          = (FAR struct icmpv6_neighbor_solicit_s *)
-                     &fwd->ia_buffer[IPv6_HDRLEN];
+  sol          = (FAR struct icmpv6_neighbor_solicit_s *)
+                 &fwd->ia_buffer[IPv6_HDRLEN];
 #endif
 #else
-      ipv4 = (FAR struct ipv4_hdr_s *)fwd->ia_buffer;
+  ipv4 = (FAR struct ipv4_hdr_s *)fwd->ia_buffer;
 
-      /* Set up the IPv4 header */
+  /* Set up the IPv4 header */
 
-      ipv4->vhl         = 0x45;
-      ipv4->tos         = 0;
+  ipv4->vhl         = 0x45;
+  ipv4->tos         = 0;
 
-      pktlen            = IPv4_HDRLEN + l3hdrlen + paysize;
-      ipv4->len[0]      = (pktlen >> 8);
-      ipv4->len[1]      = (pktlen & 0xff);
+  pktlen            = IPv4_HDRLEN + l3hdrlen + paysize;
+  ipv4->len[0]      = (pktlen >> 8);
+  ipv4->len[1]      = (pktlen & 0xff);
 
-      ++g_ipid;
-      ipv4->ipid[0]     = g_ipid >> 8;
-      ipv4->ipid[1]     = g_ipid & 0xff;
+  ++g_ipid;
+  ipv4->ipid[0]     = g_ipid >> 8;
+  ipv4->ipid[1]     = g_ipid & 0xff;
 
-      ipv4->ipoffset[0] = IP_FLAG_DONTFRAG >> 8;
-      ipv4->ipoffset[1] = IP_FLAG_DONTFRAG & 0xff;
-      ipv4->ttl         = IP_TTL;
-      ipv4->proto       = proto;
+  ipv4->ipoffset[0] = IP_FLAG_DONTFRAG >> 8;
+  ipv4->ipoffset[1] = IP_FLAG_DONTFRAG & 0xff;
+  ipv4->ttl         = IP_TTL;
+  ipv4->proto       = proto;
 
-      net_ipv4addr_hdrcopy(ipv4->srcipaddr,  fwd->ia_srcipaddr);
-      net_ipv4addr_hdrcopy(ipv4->destipaddr, fwd->ia_destipaddr);
+  net_ipv4addr_hdrcopy(ipv4->srcipaddr,  fwd->ia_srcipaddr);
+  net_ipv4addr_hdrcopy(ipv4->destipaddr, fwd->ia_destipaddr);
 
-      /* Calculate IP checksum. */
+  /* Calculate IP checksum. */
 
-      ipv4->ipchksum    = 0;
-      ipv4->ipchksum    = ~(ipv4_chksum(fwd->ia_buffer));
+  ipv4->ipchksum    = 0;
+  ipv4->ipchksum    = ~(ipv4_chksum(fwd->ia_buffer));
 
 #ifdef CONFIG_EXAMPLES_IPFORWARD_TCP
-      tcp               = (FAR struct tcp_hdr_s *)
-                           &fwd->ia_buffer[IPv4_HDRLEN];
+  tcp               = (FAR struct tcp_hdr_s *)
+                       &fwd->ia_buffer[IPv4_HDRLEN];
 #else
-      sol               = (FAR struct icmpv6_neighbor_solicit_s *)
-                           &fwd->ia_buffer[IPv4_HDRLEN];
+  sol               = (FAR struct icmpv6_neighbor_solicit_s *)
+                       &fwd->ia_buffer[IPv4_HDRLEN];
 #endif
 #endif
 
 #ifdef CONFIG_EXAMPLES_IPFORWARD_TCP
-      /* Set up the TCP header.  NOTE:  Most of the elements are irrelevant
-       * in this test. The forwarding is L2 layer only and the L3 header
-       * content is not used in the forwarding.
-       */
+  /* Set up the TCP header.  NOTE:  Most of the elements are irrelevant
+   * in this test. The forwarding is L2 layer only and the L3 header
+   * content is not used in the forwarding.
+   */
 
-      memset(tcp, 0, sizeof(struct tcp_hdr_s));
+  memset(tcp, 0, sizeof(struct tcp_hdr_s));
 
-      tcp->srcport     = HTONS(0x1234);
-      tcp->destport    = HTONS(0xabcd);
-      tcp->tcpoffset   = (TCP_HDRLEN / 4) << 4;
+  tcp->srcport     = HTONS(0x1234);
+  tcp->destport    = HTONS(0xabcd);
+  tcp->tcpoffset   = (TCP_HDRLEN / 4) << 4;
 
-      payload          = (FAR char *)tcp + TCP_HDRLEN;
-      memcpy(payload, g_payload, paysize);
+  memcpy((FAR uint8_t *)tcp + TCP_HDRLEN, payload, paysize);
 
-      tcp->tcpchksum   = ~tcp_chksum(fwd->ia_buffer);
+  tcp->tcpchksum   = ~tcp_chksum(fwd->ia_buffer);
 #else
-      /* Set up the ICMPv6 Neighbor Solicitation message */
+  /* Set up the ICMPv6 Neighbor Solicitation message */
 
-      sol->type     = ICMPv6_NEIGHBOR_SOLICIT; /* Message type */
-      sol->code     = 0;                       /* Message qualifier */
-      sol->flags[0] = 0;                       /* flags */
-      sol->flags[1] = 0;
-      sol->flags[2] = 0;
-      sol->flags[3] = 0;
+  sol->type     = ICMPv6_NEIGHBOR_SOLICIT; /* Message type */
+  sol->code     = 0;                       /* Message qualifier */
+  sol->flags[0] = 0;                       /* flags */
+  sol->flags[1] = 0;
+  sol->flags[2] = 0;
+  sol->flags[3] = 0;
 
-      /* Copy the target address into the Neighbor Solicitation message */
+  /* Copy the target address into the Neighbor Solicitation message */
 
-      net_ipv6addr_copy(sol->tgtaddr, fwd->ia_destipaddr);
+  net_ipv6addr_copy(sol->tgtaddr, fwd->ia_destipaddr);
 
-      /* Set up the options */
+  /* Set up the options */
 
-      sol->opttype  = ICMPv6_OPT_SRCLLADDR;           /* Option type */
-      sol->optlen   = ICMPv6_OPT_OCTECTS(MAC_ADDRLEN); /* Option length in octets */
+  sol->opttype  = ICMPv6_OPT_SRCLLADDR;           /* Option type */
+  sol->optlen   = ICMPv6_OPT_OCTECTS(MAC_ADDRLEN); /* Option length in octets */
 
-      /* Copy our link layer address into the message */
+  /* Copy our link layer address into the message */
 
-      memset(sol->srclladdr, 0x88, MAC_ADDRLEN);
+  memset(sol->srclladdr, 0x88, MAC_ADDRLEN);
 
-      /* Calculate the checksum over both the ICMP header and payload */
+  /* Calculate the checksum over both the ICMP header and payload */
 
-      sol->chksum   = 0;
-      sol->chksum   = ~icmpv6_chksum(fwd->ia_buffer);
+  sol->chksum   = 0;
+  sol->chksum   = ~icmpv6_chksum(fwd->ia_buffer);
+#endif
+
+  return pktlen;
+}
+
+/****************************************************************************
+ * Name: ipfwd_sender
+ ****************************************************************************/
+
+static FAR void *ipfwd_sender(FAR void *arg)
+{
+  FAR struct ipfwd_arg_s *fwd = (FAR struct ipfwd_arg_s *)arg;
+  size_t paysize;
+  size_t pktlen;
+  ssize_t nwritten;
+  int errcode;
+  int i;
+
+#ifdef CONFIG_EXAMPLES_IPFORWARD_TCP
+  paysize = sizeof(g_payload);
+#else
+  paysize = 0;
+#endif
+
+  for (i = 0; i < IPFWD_NPACKETS; i++)
+    {
+#ifdef CONFIG_EXAMPLES_IPFORWARD_TCP
+      pktlen = ipfwd_mkpacket(fwd, g_payload, paysize);
+#else
+      pktlen = ipfwd_mkpacket(fwd, NULL, paysize);
 #endif
 
       printf("Sending packet %d: size=%lu\n", i+1, (unsigned long)pktlen);
@@ -752,6 +835,309 @@ static FAR void *ipfwd_sender(FAR void *arg)
   return NULL;
 }
 
+#ifdef CONFIG_EXAMPLES_IPFORWARD_BENCH
+/****************************************************************************
+ * Name: ipfwd_bench_receiver
+ *
+ * Description:
+ *   Count the benchmark packets of the current run that come out of tun1
+ *   and measure how long each took to be forwarded.
+ *
+ ****************************************************************************/
+
+static FAR void *ipfwd_bench_receiver(FAR void *arg)
+{
+  FAR struct ipfwd_bench_s *bench = (FAR struct ipfwd_bench_s *)arg;
+  FAR struct ipfwd_arg_s *fwd = bench->ib_rx;
+  FAR struct tcp_hdr_s *tcp;
+  struct ipfwd_stamp_s stamp;
+  struct pollfd pfd;
+  ssize_t nread;
+  uint32_t latency;
+  size_t offset;
+  int ret;
+
+  while (!bench->ib_stop)
+    {
+      pfd.fd      = fwd->ia_fd;
+      pfd.events  = POLLIN;
+      pfd.revents = 0;
+
+      ret = poll(&pfd, 1, IPFWD_BENCH_POLLMS);
+      if (ret <= 0)
+        {
+          continue;
+        }
+
+      nread = read(fwd->ia_fd, fwd->ia_buffer, IPFWD_BUFSIZE);
+      if (nread <= 0)
+        {
+          continue;
+        }
+
+#ifdef CONFIG_NET_IPv6
+      offset = IPv6_HDRLEN;
+#else
+      offset = (fwd->ia_buffer[0] & 0x0f) << 2;
+#endif
+
+      if (nread < offset + TCP_HDRLEN + sizeof(struct ipfwd_stamp_s))
+        {
+          continue;
+        }
+
+      tcp     = (FAR struct tcp_hdr_s *)&fwd->ia_buffer[offset];
+      offset += (tcp->tcpoffset >> 4) << 2;
+      if (nread < offset + sizeof(struct ipfwd_stamp_s))
+        {
+          continue;
+        }
+
+      memcpy(&stamp, &fwd->ia_buffer[offset], sizeof(struct ipfwd_stamp_s));
+      if (stamp.is_magic != IPFWD_BENCH_MAGIC ||
+          stamp.is_run != bench->ib_run)
+        {
+          continue;
+        }
+
+      bench->ib_last = benchutil_usec();
+      latency = (uint32_t)bench->ib_last - stamp.is_usec;
+
+      if (stamp.is_seqno != bench->ib_next)
+        {
+          bench->ib_nreorder++;
+        }
+
+      bench->ib_next    = stamp.is_seqno + 1;
+      bench->ib_latsum += latency;
+      if (latency < bench->ib_latmin)
+        {
+          bench->ib_latmin = latency;
+        }
+
+      if (latency > bench->ib_latmax)
+        {
+          bench->ib_latmax = latency;
+        }
+
+      bench->ib_nrecvd++;
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: ipfwd_bench_run
+ *
+ * Description:
+ *   Inject count packets of size bytes into tun0 at rate packets per second
+ *   (zero: as fast as possible) and report what came out of tun1.
+ *
+ ****************************************************************************/
+
+static int ipfwd_bench_run(FAR struct ipfwd_arg_s *tx,
+                           FAR struct ipfwd_arg_s *rx, size_t size,
+                           unsigned long rate, uint32_t count,
+                           uint32_t run)
+{
+  struct ipfwd_bench_s bench;
+  struct ipfwd_stamp_s stamp;
+  uint8_t payload[IPFWD_BUFSIZE];
+  FAR void *value;
+  pthread_t receiver;
+  uint64_t start;
+  uint64_t end;
+  uint64_t now;
+  uint64_t due;
+  ssize_t nwritten;
+  uint32_t nerrors;
+  uint32_t ndropped;
+  uint32_t seqno;
+  size_t paysize;
+  size_t pktlen;
+  int load;
+  int ret;
+  int i;
+
+  paysize = size - IP_HDRLEN - TCP_HDRLEN;
+  for (i = sizeof(struct ipfwd_stamp_s); i < paysize; i++)
+    {
+      payload[i] = (uint8_t)i;
+    }
+
+  memset(&bench, 0, sizeof(struct ipfwd_bench_s));
+  bench.ib_rx     = rx;
+  bench.ib_run    = run;
+  bench.ib_latmin = UINT32_MAX;
+
+  ret = pthread_create(&receiver, NULL, ipfwd_bench_receiver, &bench);
+  if (ret != 0)
+    {
+      fprintf(stderr, "ERROR: pthread_create() failed for receiver: %d\n",
+              ret);
+      return -ret;
+    }
+
+  stamp.is_magic = IPFWD_BENCH_MAGIC;
+  stamp.is_run   = run;
+  nerrors        = 0;
+  start          = benchutil_usec();
+
+  for (seqno = 0; seqno < count; seqno++)
+    {
+      /* Pace against the start time so that a late packet is made up for
+       * by sending the following ones sooner.
+       */
+
+      if (rate > 0)
+        {
+          due = start + (uint64_t)seqno * 1000000 / rate;
+          now = benchutil_usec();
+          if (now < due)
+            {
+              usleep(due - now);
+            }
+        }
+
+      stamp.is_seqno = seqno;
+      stamp.is_usec  = (uint32_t)benchutil_usec();
+      memcpy(payload, &stamp, sizeof(struct ipfwd_stamp_s));
+
+      pktlen   = ipfwd_mkpacket(tx, payload, paysize);
+      nwritten = write(tx->ia_fd, tx->ia_buffer, pktlen);
+      if (nwritten < 0)
+        {
+          nerrors++;
+        }
+    }
+
+  end  = benchutil_usec();
+  load = benchutil_cpuload();
+
+  /* Give the last packets time to come out, then stop the receiver */
+
+  usleep(CONFIG_EXAMPLES_IPFORWARD_BENCH_DRAIN * 1000);
+  bench.ib_stop = true;
+  pthread_join(receiver, &value);
+
+  ndropped = count - nerrors - bench.ib_nrecvd;
+
+  printf("%5lu %7lu %7lu %7lu %6lu %5lu.%lu%% %8lu %8lu",
+         (unsigned long)size, rate,
+         (unsigned long)(count - nerrors), (unsigned long)nerrors,
+         (unsigned long)bench.ib_nrecvd,
+         (unsigned long)(ndropped * 1000 / count / 10),
+         (unsigned long)(ndropped * 1000 / count % 10),
+         (unsigned long)((uint64_t)count * 1000000 /
+                         (end > start ? end - start : 1)),
+         (unsigned long)(bench.ib_last > start ?
+                         (uint64_t)bench.ib_nrecvd * 1000000 /
+                         (bench.ib_last - start) : 0));
+
+  if (bench.ib_nrecvd > 0)
+    {
+      printf(" %5lu/%lu/%lu", (unsigned long)bench.ib_latmin,
+             (unsigned long)(bench.ib_latsum / bench.ib_nrecvd),
+             (unsigned long)bench.ib_latmax);
+    }
+  else
+    {
+      printf(" -/-/-");
+    }
+
+  if (load >= 0)
+    {
+      printf(" %3d.%d%%", load / 10, load % 10);
+    }
+  else
+    {
+      printf(" n/a");
+    }
+
+  if (bench.ib_nreorder > 0)
+    {
+      printf(" (%lu out of order)", (unsigned long)bench.ib_nreorder);
+    }
+
+  printf("\n");
+  return OK;
+}
+
+/****************************************************************************
+ * Name: ipfwd_getlist
+ *
+ * Description:
+ *   Parse a comma separated list of numbers.
+ *
+ ****************************************************************************/
+
+static int ipfwd_getlist(FAR char *arg, FAR unsigned long *list)
+{
+  FAR char *ptr = arg;
+  int n = 0;
+
+  while (*ptr != '\0' && n < IPFWD_BENCH_MAXLIST)
+    {
+      list[n++] = strtoul(ptr, &ptr, 0);
+      if (*ptr == ',')
+        {
+          ptr++;
+        }
+      else if (*ptr != '\0')
+        {
+          return ERROR;
+        }
+    }
+
+  return n > 0 && *ptr == '\0' ? n : ERROR;
+}
+
+/****************************************************************************
+ * Name: ipfwd_bench
+ ****************************************************************************/
+
+static int ipfwd_bench(FAR struct ipfwd_arg_s *tx,
+                       FAR struct ipfwd_arg_s *rx,
+                       FAR const unsigned long *sizes, int nsizes,
+                       FAR const unsigned long *rates, int nrates,
+                       uint32_t count)
+{
+  uint32_t run = 0;
+  int ret;
+  int i;
+  int j;
+
+  printf("%5s %7s %7s %7s %6s %7s %8s %8s %s %s\n", "Size", "Rate",
+         "Sent", "Errors", "Fwd", "Drop", "Tx pps", "Fwd pps",
+         "Latency min/avg/max usec", "CPU");
+
+  for (i = 0; i < nsizes; i++)
+    {
+      if (sizes[i] < IP_HDRLEN + TCP_HDRLEN + sizeof(struct ipfwd_stamp_s) ||
+          sizes[i] > IPFWD_BUFSIZE)
+        {
+          fprintf(stderr, "ERROR: Packet size %lu is not in %lu..%lu\n",
+                  sizes[i],
+                  (unsigned long)(IP_HDRLEN + TCP_HDRLEN +
+                                  sizeof(struct ipfwd_stamp_s)),
+                  (unsigned long)IPFWD_BUFSIZE);
+          return -EINVAL;
+        }
+
+      for (j = 0; j < nrates; j++)
+        {
+          ret = ipfwd_bench_run(tx, rx, sizes[i], rates[j], count, ++run);
+          if (ret < 0)
+            {
+              return ret;
+            }
+        }
+    }
+
+  return OK;
+}
+#endif /* CONFIG_EXAMPLES_IPFORWARD_BENCH */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -770,9 +1156,57 @@ int ipfwd_main(int argc, char *argv[])
   struct ipfwd_arg_s tun0arg;
   struct ipfwd_arg_s tun1arg;
   FAR void *value;
+#ifdef CONFIG_EXAMPLES_IPFORWARD_BENCH
+  unsigned long sizes[IPFWD_BENCH_MAXLIST];
+  unsigned long rates[IPFWD_BENCH_MAXLIST];
+  unsigned long count = CONFIG_EXAMPLES_IPFORWARD_BENCH_COUNT;
+  bool bench = false;
+  int nsizes = 1;
+  int nrates = 1;
+  int option;
+#endif
   int errcode = EXIT_SUCCESS;
   int ret;
 
+#ifdef CONFIG_EXAMPLES_IPFORWARD_BENCH
+  sizes[0] = CONFIG_EXAMPLES_IPFORWARD_BENCH_SIZE;
+  rates[0] = CONFIG_EXAMPLES_IPFORWARD_BENCH_RATE;
+
+  optind = 0;
+  while ((option = getopt(argc, argv, "bn:r:s:")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'b':
+            bench = true;
+            break;
+
+          case 'n':
+            count = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'r':
+            nrates = ipfwd_getlist(optarg, rates);
+            break;
+
+          case 's':
+            nsizes = ipfwd_getlist(optarg, sizes);
+            break;
+
+          default:
+            nsizes = ERROR;
+            break;
+        }
+    }
+
+  if (nsizes < 0 || nrates < 0 || count == 0)
+    {
+      fprintf(stderr, "USAGE: %s [-b [-n <count>] [-s <size>[,<size>...]] "
+              "[-r <pps>[,<pps>...]]]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+#endif
+
   /* Initialize the first TUN device */
 
   ret = ipfwd_tun_configure(&fwd.if_tun0);
@@ -806,12 +1240,34 @@ int ipfwd_main(int argc, char *argv[])
       goto errout_with_tun1;
     }
 
-  /* Start receiver thread on tun1 */
-
   tun1arg.ia_fd         = fwd.if_tun1.it_fd;
   tun1arg.ia_srcipaddr  = g_tun1_raddr;
   tun1arg.ia_destipaddr = g_tun0_raddr;
 
+  tun0arg.ia_fd         = fwd.if_tun0.it_fd;
+  tun0arg.ia_srcipaddr  = g_tun0_raddr;
+  tun0arg.ia_destipaddr = g_tun1_raddr;
+
+#ifdef CONFIG_EXAMPLES_IPFORWARD_BENCH
+  if (bench)
+    {
+      /* Measure forwarding from tun0 to tun1 instead of the functional
+       * test.
+       */
+
+      ret = ipfwd_bench(&tun0arg, &tun1arg, sizes, nsizes, rates, nrates,
+                        count);
+      if (ret < 0)
+        {
+          errcode = EXIT_FAILURE;
+        }
+
+      goto errout_with_tun1;
+    }
+#endif
+
+  /* Start receiver thread on tun1 */
+
   ret = pthread_create(&fwd.if_receiver, NULL, ipfwd_receiver, &tun1arg);
   if (ret != 0)
     {
@@ -822,10 +1278,6 @@ int ipfwd_main(int argc, char *argv[])
 
   /* Start sender thread on tun0 */
 
-  tun0arg.ia_fd         = fwd.if_tun0.it_fd;
-  tun0arg.ia_srcipaddr  = g_tun0_raddr;
-  tun0arg.ia_destipaddr = g_tun1_raddr;
-
   ret = pthread_create(&fwd.if_sender, NULL, ipfwd_sender, &tun0arg);
   if (ret != 0)
     {
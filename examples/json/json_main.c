@@ -36,10 +36,22 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
+#include <time.h>
 
 #include "netutils/cJSON.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_JSON_BENCH_ITERATIONS
+#  define CONFIG_EXAMPLES_JSON_BENCH_ITERATIONS 100
+#endif
+
+#define BENCH_NRECORDS 32
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -225,6 +237,63 @@ static void create_objects(void)
   free(out);
 }
 
+/****************************************************************************
+ * Name: benchmark
+ *
+ * Description:
+ *   Time the rendering of an array of records with numbers and strings, the
+ *   typical content of a REST response.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_JSON_BENCHMARK
+static void benchmark(void)
+{
+  struct timespec start;
+  struct timespec end;
+  cJSON *root;
+  cJSON *fld;
+  char *out;
+  size_t nbytes = 0;
+  long elapsed;
+  int i;
+
+  root = cJSON_CreateArray();
+  for (i = 0; i < BENCH_NRECORDS; i++)
+    {
+      cJSON_AddItemToArray(root, fld = cJSON_CreateObject());
+      cJSON_AddNumberToObject(fld, "id", 1000 + i);
+      cJSON_AddNumberToObject(fld, "Latitude", 37.371991 + i * 0.001);
+      cJSON_AddNumberToObject(fld, "Longitude", -122.02602 - i * 0.25);
+      cJSON_AddNumberToObject(fld, "Temperature", 21.5 + i);
+      cJSON_AddStringToObject(fld, "City", "SUNNYVALE");
+      cJSON_AddStringToObject(fld, "Note", "Escaped \"quotes\"\tand tabs");
+    }
+
+  (void)clock_gettime(CLOCK_REALTIME, &start);
+
+  for (i = 0; i < CONFIG_EXAMPLES_JSON_BENCH_ITERATIONS; i++)
+    {
+      out = cJSON_PrintUnformatted(root);
+      if (out)
+        {
+          nbytes += strlen(out);
+          free(out);
+        }
+    }
+
+  (void)clock_gettime(CLOCK_REALTIME, &end);
+  cJSON_Delete(root);
+
+  elapsed = (end.tv_sec - start.tv_sec) * 1000000 +
+            (end.tv_nsec - start.tv_nsec) / 1000;
+
+  printf("Rendered %d documents (%lu bytes) in %ld usec\n",
+         CONFIG_EXAMPLES_JSON_BENCH_ITERATIONS, (unsigned long)nbytes,
+         elapsed);
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -325,5 +394,12 @@ int json_main(int argc, const char *argv[])
   /* Now some samplecode for building objects concisely: */
 
   create_objects();
+
+#ifdef CONFIG_EXAMPLES_JSON_BENCHMARK
+  /* And time the rendering */
+
+  benchmark();
+#endif
+
   return 0;
 }
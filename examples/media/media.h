@@ -0,0 +1,88 @@
+/****************************************************************************
+ * apps/examples/media/media.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_EXAMPLES_MEDIA_MEDIA_H
+#define __APPS_EXAMPLES_MEDIA_MEDIA_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+struct media_info_s
+{
+  off_t blocksize;           /* Erase block size, or the configured size */
+  off_t nblocks;             /* Number of blocks, 0 if unknown */
+  off_t sectsize;            /* Read/write unit of the device */
+};
+
+/* Options of the benchmark */
+
+struct media_bench_s
+{
+  size_t iosize;             /* Bytes per random I/O, 0 for sectsize */
+  uint32_t nios;             /* I/Os per measurement */
+  int qdepth;                /* Largest queue depth */
+  off_t region;              /* Bytes of the device used, 0 for all */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: media_bench
+ *
+ * Description:
+ *   Measure random read and write IOPS and latency at increasing queue
+ *   depths, and erase block aligned against unaligned writes.  The contents
+ *   of the device are overwritten.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_MEDIA_BENCH
+int media_bench(int fd, FAR const struct media_info_s *info,
+                FAR const struct media_bench_s *opts);
+#endif
+
+#endif /* __APPS_EXAMPLES_MEDIA_MEDIA_H */
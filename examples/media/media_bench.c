@@ -0,0 +1,524 @@
+/****************************************************************************
+ * apps/examples/media/media_bench.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+
+#ifdef CONFIG_FS_AIO
+#  include <aio.h>
+#endif
+
+#include "system/benchutil.h"
+
+#include "media.h"
+
+#ifdef CONFIG_EXAMPLES_MEDIA_BENCH
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Latency histogram: bucket b counts latencies of 2^b up to 2^(b+1)
+ * microseconds (bucket 0 includes 0); the last bucket is open ended.
+ */
+
+#define MEDIA_NBUCKETS 24
+
+/* Largest queue depth.  Each request in flight needs one of the
+ * CONFIG_FS_NAIOC aio containers.
+ */
+
+#define MEDIA_MAXQDEPTH 16
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct media_stats_s
+{
+  uint32_t hist[MEDIA_NBUCKETS];
+  uint32_t count;
+  uint32_t max;
+  uint64_t total;            /* Sum of the latencies */
+  uint64_t elapsed;          /* Duration of the whole run */
+};
+
+/* One measurement: random I/Os of 'size' bytes at offsets that are a
+ * multiple of 'align' plus 'shift'.
+ */
+
+struct media_run_s
+{
+  int fd;
+  bool write;
+  size_t size;
+  off_t align;
+  off_t shift;
+  off_t region;
+  uint32_t nios;
+  int qdepth;
+  FAR uint8_t *buffers;      /* qdepth buffers of size bytes */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static uint32_t g_seed = 0x12345678;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* xorshift32: the same sequence of offsets on every run and target */
+
+static off_t media_offset(FAR const struct media_run_s *run)
+{
+  uint32_t nunits = (run->region - run->shift - run->size) / run->align + 1;
+
+  g_seed ^= g_seed << 13;
+  g_seed ^= g_seed >> 17;
+  g_seed ^= g_seed << 5;
+
+  return (off_t)(g_seed % nunits) * run->align + run->shift;
+}
+
+static void media_record(FAR struct media_stats_s *stats, uint32_t usec)
+{
+  int b = 0;
+
+  while (b < MEDIA_NBUCKETS - 1 && (usec >> (b + 1)) != 0)
+    {
+      b++;
+    }
+
+  stats->hist[b]++;
+  stats->count++;
+  stats->total += usec;
+  if (usec > stats->max)
+    {
+      stats->max = usec;
+    }
+}
+
+/* Upper bound of the bucket that holds the given per mille percentile,
+ * limited to the largest latency seen.
+ */
+
+static uint32_t media_percentile(FAR const struct media_stats_s *stats,
+                                 uint32_t permille)
+{
+  uint32_t sum = 0;
+  int b;
+
+  for (b = 0; b < MEDIA_NBUCKETS - 1; b++)
+    {
+      sum += stats->hist[b];
+      if ((uint64_t)sum * 1000 >= (uint64_t)stats->count * permille)
+        {
+          break;
+        }
+    }
+
+  if (b < MEDIA_NBUCKETS - 1 && ((uint32_t)2 << b) < stats->max)
+    {
+      return (uint32_t)2 << b;
+    }
+
+  return stats->max;
+}
+
+static void media_report(FAR const struct media_run_s *run,
+                         FAR const struct media_stats_s *stats)
+{
+  uint64_t elapsed = stats->elapsed > 0 ? stats->elapsed : 1;
+  int b;
+
+  printf("  %2d %7lu %7lu %8lu %7lu %7lu %8lu\n", run->qdepth,
+         (unsigned long)((uint64_t)stats->count * 1000000 / elapsed),
+         (unsigned long)((uint64_t)stats->count * run->size * 1000000 /
+                         1024 / elapsed),
+         (unsigned long)(stats->total / stats->count),
+         (unsigned long)media_percentile(stats, 500),
+         (unsigned long)media_percentile(stats, 990),
+         (unsigned long)stats->max);
+
+  /* Histogram: <upper bound in usec>:<count> for the buckets in use */
+
+  printf("     hist");
+  for (b = 0; b < MEDIA_NBUCKETS; b++)
+    {
+      if (stats->hist[b] > 0)
+        {
+          if (b < MEDIA_NBUCKETS - 1)
+            {
+              printf(" <%lu:%lu", (unsigned long)2 << b,
+                     (unsigned long)stats->hist[b]);
+            }
+          else
+            {
+              printf(" >=%lu:%lu", (unsigned long)1 << b,
+                     (unsigned long)stats->hist[b]);
+            }
+        }
+    }
+
+  printf("\n");
+}
+
+/* Queue depth 1: plain synchronous positioned I/O */
+
+static int media_runsync(FAR const struct media_run_s *run,
+                         FAR struct media_stats_s *stats)
+{
+  uint64_t start;
+  uint64_t begin;
+  ssize_t nbytes;
+  off_t offset;
+  uint32_t i;
+
+  begin = benchutil_usec();
+  for (i = 0; i < run->nios; i++)
+    {
+      offset = media_offset(run);
+      start  = benchutil_usec();
+      nbytes = run->write ?
+               pwrite(run->fd, run->buffers, run->size, offset) :
+               pread(run->fd, run->buffers, run->size, offset);
+      if (nbytes != (ssize_t)run->size)
+        {
+          fprintf(stderr, "ERROR: %s at %lu failed: %d\n",
+                  run->write ? "pwrite" : "pread", (unsigned long)offset,
+                  nbytes < 0 ? errno : EIO);
+          return ERROR;
+        }
+
+      media_record(stats, (uint32_t)(benchutil_usec() - start));
+    }
+
+  stats->elapsed = benchutil_usec() - begin;
+  return OK;
+}
+
+#ifdef CONFIG_FS_AIO
+static int media_aiostart(FAR const struct media_run_s *run,
+                          FAR struct aiocb *aiocbp, FAR uint8_t *buffer)
+{
+  int ret;
+
+  memset(aiocbp, 0, sizeof(struct aiocb));
+  aiocbp->aio_fildes  = run->fd;
+  aiocbp->aio_buf     = buffer;
+  aiocbp->aio_nbytes  = run->size;
+  aiocbp->aio_offset  = media_offset(run);
+  aiocbp->aio_sigevent.sigev_notify = SIGEV_NONE;
+
+  ret = run->write ? aio_write(aiocbp) : aio_read(aiocbp);
+  if (ret < 0)
+    {
+      fprintf(stderr, "ERROR: %s failed: %d\n",
+              run->write ? "aio_write" : "aio_read", errno);
+    }
+
+  return ret;
+}
+
+/* Queue depth > 1: keep qdepth requests in flight and replace each one as
+ * soon as it completes.  The latency of a request runs from its submission
+ * until its completion is seen after aio_suspend().
+ */
+
+static int media_runaio(FAR const struct media_run_s *run,
+                        FAR struct media_stats_s *stats)
+{
+  struct aiocb aiocbs[MEDIA_MAXQDEPTH];
+  FAR const struct aiocb *list[MEDIA_MAXQDEPTH];
+  uint64_t start[MEDIA_MAXQDEPTH];
+  uint64_t begin;
+  uint64_t now;
+  uint32_t submitted = 0;
+  uint32_t done = 0;
+  ssize_t nbytes;
+  int ret = OK;
+  int i;
+
+  begin = benchutil_usec();
+  for (i = 0; i < run->qdepth; i++)
+    {
+      list[i] = NULL;
+      if (submitted < run->nios)
+        {
+          start[i] = benchutil_usec();
+          if (media_aiostart(run, &aiocbs[i],
+                             &run->buffers[i * run->size]) < 0)
+            {
+              ret = ERROR;
+              goto errout;
+            }
+
+          list[i] = &aiocbs[i];
+          submitted++;
+        }
+    }
+
+  while (done < submitted)
+    {
+      /* aio_suspend() may be interrupted by a signal; just look again */
+
+      (void)aio_suspend(list, run->qdepth, NULL);
+      now = benchutil_usec();
+
+      for (i = 0; i < run->qdepth; i++)
+        {
+          if (list[i] == NULL || aio_error(&aiocbs[i]) == EINPROGRESS)
+            {
+              continue;
+            }
+
+          list[i] = NULL;
+          done++;
+
+          nbytes = aio_return(&aiocbs[i]);
+          if (nbytes != (ssize_t)run->size)
+            {
+              fprintf(stderr, "ERROR: aio at %lu failed: %d\n",
+                      (unsigned long)aiocbs[i].aio_offset,
+                      nbytes < 0 ? errno : EIO);
+              ret = ERROR;
+              goto errout;
+            }
+
+          media_record(stats, (uint32_t)(now - start[i]));
+
+          if (submitted < run->nios)
+            {
+              start[i] = benchutil_usec();
+              if (media_aiostart(run, &aiocbs[i],
+                                 &run->buffers[i * run->size]) < 0)
+                {
+                  ret = ERROR;
+                  goto errout;
+                }
+
+              list[i] = &aiocbs[i];
+              submitted++;
+            }
+        }
+    }
+
+  stats->elapsed = benchutil_usec() - begin;
+  return OK;
+
+errout:
+  (void)aio_cancel(run->fd, NULL);
+  for (i = 0; i < run->qdepth; i++)
+    {
+      if (list[i] != NULL)
+        {
+          while (aio_error(&aiocbs[i]) == EINPROGRESS)
+            {
+              (void)aio_suspend(&list[i], 1, NULL);
+            }
+
+          (void)aio_return(&aiocbs[i]);
+        }
+    }
+
+  return ret;
+}
+#endif
+
+static int media_run(FAR const struct media_run_s *run)
+{
+  struct media_stats_s stats;
+  int ret;
+
+  memset(&stats, 0, sizeof(stats));
+
+#ifdef CONFIG_FS_AIO
+  ret = run->qdepth > 1 ? media_runaio(run, &stats) :
+                          media_runsync(run, &stats);
+#else
+  ret = media_runsync(run, &stats);
+#endif
+
+  if (ret == OK && stats.count > 0)
+    {
+      media_report(run, &stats);
+    }
+
+  return ret;
+}
+
+static void media_header(FAR const char *title,
+                         FAR const struct media_run_s *run)
+{
+  printf("\n%s, %lu bytes at multiples of %lu", title,
+         (unsigned long)run->size, (unsigned long)run->align);
+  if (run->shift != 0)
+    {
+      printf(" + %lu", (unsigned long)run->shift);
+    }
+
+  printf(", %lu I/Os:\n", (unsigned long)run->nios);
+  printf("  qd    IOPS    KB/s   avg us  p50 us  p99 us   max us\n");
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+int media_bench(int fd, FAR const struct media_info_s *info,
+                FAR const struct media_bench_s *opts)
+{
+  struct media_run_s run;
+  size_t bufsize;
+  off_t devsize;
+  int qmax = opts->qdepth;
+  int ret = OK;
+  int qd;
+
+#ifndef CONFIG_FS_AIO
+  if (qmax > 1)
+    {
+      printf("Queue depths above 1 need CONFIG_FS_AIO\n");
+      qmax = 1;
+    }
+#endif
+
+  if (qmax < 1 || qmax > MEDIA_MAXQDEPTH)
+    {
+      fprintf(stderr, "ERROR: The queue depth must be 1 to %d\n",
+              MEDIA_MAXQDEPTH);
+      return 1;
+    }
+
+  /* The region tested: all of the device unless limited with -r */
+
+  devsize = lseek(fd, 0, SEEK_END);
+  if (devsize <= 0 && info->nblocks > 0)
+    {
+      devsize = info->nblocks * info->blocksize;
+    }
+
+  if (opts->region > 0 && (devsize <= 0 || opts->region < devsize))
+    {
+      devsize = opts->region;
+    }
+
+  memset(&run, 0, sizeof(run));
+  run.fd     = fd;
+  run.size   = opts->iosize > 0 ? opts->iosize : info->sectsize;
+  run.align  = run.size;
+  run.region = devsize;
+  run.nios   = opts->nios;
+
+  if (devsize < 2 * info->blocksize || devsize < (off_t)run.size)
+    {
+      fprintf(stderr, "ERROR: Unknown or too small device size, use -r\n");
+      return 1;
+    }
+
+  bufsize     = run.size > info->blocksize ? run.size : info->blocksize;
+  run.buffers = (FAR uint8_t *)malloc(qmax * bufsize);
+  if (run.buffers == NULL)
+    {
+      fprintf(stderr, "ERROR: Failed to allocate %lu bytes\n",
+              (unsigned long)(qmax * bufsize));
+      return 1;
+    }
+
+  memset(run.buffers, 0x5a, qmax * bufsize);
+
+  printf("Benchmark over %lu bytes, sector %lu, erase block %lu\n",
+         (unsigned long)devsize, (unsigned long)info->sectsize,
+         (unsigned long)info->blocksize);
+
+  /* Random reads and writes at each queue depth */
+
+  for (run.write = false; ; run.write = true)
+    {
+      media_header(run.write ? "Random write" : "Random read", &run);
+      for (qd = 1; qd <= qmax && ret == OK; qd <<= 1)
+        {
+          run.qdepth = qd;
+          ret = media_run(&run);
+        }
+
+      if (run.write || ret < 0)
+        {
+          break;
+        }
+    }
+
+  /* Whole erase blocks written at erase block boundaries, then straddling
+   * two erase blocks, which makes the driver or FTL read and rewrite two.
+   */
+
+  run.size   = info->blocksize;
+  run.align  = info->blocksize;
+  run.qdepth = 1;
+
+  if (ret == OK)
+    {
+      media_header("Aligned write", &run);
+      ret = media_run(&run);
+    }
+
+  if (ret == OK)
+    {
+      run.shift = info->blocksize / 2;
+      media_header("Unaligned write", &run);
+      ret = media_run(&run);
+    }
+
+  free(run.buffers);
+  return ret < 0 ? 1 : 0;
+}
+
+#endif /* CONFIG_EXAMPLES_MEDIA_BENCH */
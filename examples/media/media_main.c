@@ -41,14 +41,18 @@
 
 #include <sys/ioctl.h>
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
 
 #include <nuttx/fs/fs.h>
 #include <nuttx/mtd/mtd.h>
 
+#include "media.h"
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -56,15 +60,9 @@
 #define START_VALUE 0x20
 #define END_VALUE   0x7f
 
-/****************************************************************************
- * Private types
- ****************************************************************************/
-
-struct media_info_s
-{
-  off_t blocksize;
-  off_t nblocks;
-};
+#ifndef CONFIG_EXAMPLES_MEDIA_BENCH_NIOS
+#  define CONFIG_EXAMPLES_MEDIA_BENCH_NIOS 1000
+#endif
 
 /****************************************************************************
  * Private Functions
@@ -74,7 +72,7 @@ struct media_info_s
  * get_blocksize
  ****************************************************************************/
 
-static void get_blocksize(int fd, FAR struct media_info_s *info)
+static void get_blocksize(int fd, FAR struct media_info_s *info, bool erase)
 {
   struct mtd_geometry_s mtdgeo;
   int ret;
@@ -95,13 +93,17 @@ static void get_blocksize(int fd, FAR struct media_info_s *info)
 
       info->blocksize = mtdgeo.erasesize;
       info->nblocks   = mtdgeo.neraseblocks;
+      info->sectsize  = mtdgeo.blocksize;
 
       /* Attempt to erase the entire MTD device */
 
-      ret = ioctl(fd, MTDIOC_BULKERASE, 0);
-      if (ret < 0)
+      if (erase)
         {
-          fprintf(stderr, "ERROR: Failed erase the MTD device\n");
+          ret = ioctl(fd, MTDIOC_BULKERASE, 0);
+          if (ret < 0)
+            {
+              fprintf(stderr, "ERROR: Failed erase the MTD device\n");
+            }
         }
     }
 
@@ -113,9 +115,30 @@ static void get_blocksize(int fd, FAR struct media_info_s *info)
     {
       info->blocksize = CONFIG_EXAMPLES_MEDIA_BLOCKSIZE;
       info->nblocks   = 0;
+      info->sectsize  = CONFIG_EXAMPLES_MEDIA_BLOCKSIZE;
     }
 }
 
+#ifdef CONFIG_EXAMPLES_MEDIA_BENCH
+/****************************************************************************
+ * show_usage
+ ****************************************************************************/
+
+static void show_usage(FAR const char *progname)
+{
+  fprintf(stderr, "USAGE: %s [devpath]\n", progname);
+  fprintf(stderr, "       %s -B [-s iosize] [-n nios] [-q qdepth] "
+          "[-r region] [devpath]\n", progname);
+  fprintf(stderr, "  -B  Benchmark random I/O; overwrites the media\n");
+  fprintf(stderr, "  -s  Bytes per I/O (default: sector size)\n");
+  fprintf(stderr, "  -n  I/Os per measurement (default: %d)\n",
+          CONFIG_EXAMPLES_MEDIA_BENCH_NIOS);
+  fprintf(stderr, "  -q  Largest queue depth, 1-16; above 1 needs "
+          "CONFIG_FS_AIO (default: 1)\n");
+  fprintf(stderr, "  -r  Bytes of the media to use (default: all)\n");
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -143,6 +166,55 @@ int media_main(int argc, FAR char *argv[])
   uint32_t nerrors;
   uint8_t value;
   int fd;
+#ifdef CONFIG_EXAMPLES_MEDIA_BENCH
+  struct media_bench_s bench;
+  bool benchmark = false;
+  int option;
+
+  bench.iosize = 0;
+  bench.nios   = CONFIG_EXAMPLES_MEDIA_BENCH_NIOS;
+  bench.qdepth = 1;
+  bench.region = 0;
+
+  while ((option = getopt(argc, argv, "Bs:n:q:r:")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'B':
+            benchmark = true;
+            break;
+
+          case 's':
+            bench.iosize = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'n':
+            bench.nios = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'q':
+            bench.qdepth = atoi(optarg);
+            break;
+
+          case 'r':
+            bench.region = strtoul(optarg, NULL, 0);
+            break;
+
+          default:
+            show_usage(argv[0]);
+            return 1;
+        }
+    }
+
+  if (bench.nios == 0)
+    {
+      show_usage(argv[0]);
+      return 1;
+    }
+
+  argc -= optind - 1;
+  argv += optind - 1;
+#endif
 
   /* Open the character driver that wraps the media */
 
@@ -165,12 +237,26 @@ int media_main(int argc, FAR char *argv[])
     }
   /* Get the block size to use */
 
-  get_blocksize(fd, &info);
+#ifdef CONFIG_EXAMPLES_MEDIA_BENCH
+  get_blocksize(fd, &info, !benchmark);
+#else
+  get_blocksize(fd, &info, true);
+#endif
 
   printf("Using:\n");
   printf("  blocksize:    %lu\n", (unsigned long)info.blocksize);
   printf("  nblocks:      %lu\n", (unsigned long)info.nblocks);
 
+#ifdef CONFIG_EXAMPLES_MEDIA_BENCH
+  if (benchmark)
+    {
+      int ret = media_bench(fd, &info, &bench);
+
+      close(fd);
+      return ret;
+    }
+#endif
+
   /* Allocate I/O buffers of the correct block size */
 
   txbuffer = (FAR uint8_t *)malloc((size_t)info.blocksize);
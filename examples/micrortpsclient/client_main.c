@@ -1,10 +1,32 @@
 #include "HelloWorld.h"
+#include "client_pub.h"
 #include <micrortps/client/xrce_client.h>
 
 #include <stdio.h>
+#include <time.h>
 
 #define HELLO_WORLD_TOPIC 1
 
+#ifndef CONFIG_EXAMPLES_CLIENT_PERIOD_MS
+#  define CONFIG_EXAMPLES_CLIENT_PERIOD_MS 10
+#endif
+
+/* Read back the topic this often */
+
+#define READ_PERIOD_MS 1000
+
+static uint32_t client_msec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static bool serialize_HelloWorld_sample(MicroBuffer* writer, const void* sample)
+{
+    return serialize_HelloWorld_topic(writer, (const HelloWorld*)sample);
+}
+
 void check_and_print_error(Session* session, const char* where)
 {
     if(session->last_status_received)
@@ -100,10 +122,19 @@ int client_main(int args, char *argv[])
     create_participant_sync_by_ref(&my_session, participant_id, "default_participant", false, false);
     check_and_print_error(&my_session, "create participant");
 
+    /* With agent-side profiles the topic, data writer and data reader are
+     * created by reference, so only the profile names cross the link
+     * instead of the full XML descriptions.
+     */
+
     /* Create topic. */
-    const char* topic_xml = {"<dds><topic><name>HelloWorldTopic</name><dataType>HelloWorld</dataType></topic></dds>"};
     ObjectId topic_id = {{0x00, OBJK_TOPIC}};
+#ifdef CONFIG_EXAMPLES_CLIENT_PROFILES
+    create_topic_sync_by_ref(&my_session, topic_id, CONFIG_EXAMPLES_CLIENT_TOPIC_REF, participant_id, false, false);
+#else
+    const char* topic_xml = {"<dds><topic><name>HelloWorldTopic</name><dataType>HelloWorld</dataType></topic></dds>"};
     create_topic_sync_by_xml(&my_session, topic_id, topic_xml, participant_id, false, false);
+#endif
     check_and_print_error(&my_session, "create topic");
 
     /* Create publisher. */
@@ -113,9 +144,13 @@ int client_main(int args, char *argv[])
     check_and_print_error(&my_session, "create publisher");
 
     /* Create data writer. */
-    const char* datawriter_xml = {"<profiles><publisher profile_name=\"default_xrce_publisher_profile\"><topic><kind>NO_KEY</kind><name>HelloWorldTopic</name><dataType>HelloWorld</dataType><historyQos><kind>KEEP_LAST</kind><depth>5</depth></historyQos><durability><kind>TRANSIENT_LOCAL</kind></durability></topic></publisher></profiles>"};
     ObjectId datawriter_id = {{HELLO_WORLD_TOPIC, OBJK_DATAWRITER}};
+#ifdef CONFIG_EXAMPLES_CLIENT_PROFILES
+    create_datawriter_sync_by_ref(&my_session, datawriter_id, CONFIG_EXAMPLES_CLIENT_DATAWRITER_REF, publisher_id, false, false);
+#else
+    const char* datawriter_xml = {"<profiles><publisher profile_name=\"default_xrce_publisher_profile\"><topic><kind>NO_KEY</kind><name>HelloWorldTopic</name><dataType>HelloWorld</dataType><historyQos><kind>KEEP_LAST</kind><depth>5</depth></historyQos><durability><kind>TRANSIENT_LOCAL</kind></durability></topic></publisher></profiles>"};
     create_datawriter_sync_by_xml(&my_session, datawriter_id, datawriter_xml, publisher_id, false, false);
+#endif
     check_and_print_error(&my_session, "create datawriter");
 
     /* Create subscriber. */
@@ -124,29 +159,50 @@ int client_main(int args, char *argv[])
     create_subscriber_sync_by_xml(&my_session, subscriber_id, subscriber_xml, participant_id, false, false);
     check_and_print_error(&my_session, "create subscriber");
 
-    /* Create data writer. */
-    const char* datareader_xml = {"<profiles><subscriber profile_name=\"default_xrce_subscriber_profile\"><topic><kind>NO_KEY</kind><name>HelloWorldTopic</name><dataType>HelloWorld</dataType><historyQos><kind>KEEP_LAST</kind><depth>5</depth></historyQos><durability><kind>TRANSIENT_LOCAL</kind></durability></topic></subscriber></profiles>"};
+    /* Create data reader. */
     ObjectId datareader_id = {{HELLO_WORLD_TOPIC, OBJK_DATAREADER}};
+#ifdef CONFIG_EXAMPLES_CLIENT_PROFILES
+    create_datareader_sync_by_ref(&my_session, datareader_id, CONFIG_EXAMPLES_CLIENT_DATAREADER_REF, subscriber_id, false, false);
+#else
+    const char* datareader_xml = {"<profiles><subscriber profile_name=\"default_xrce_subscriber_profile\"><topic><kind>NO_KEY</kind><name>HelloWorldTopic</name><dataType>HelloWorld</dataType><historyQos><kind>KEEP_LAST</kind><depth>5</depth></historyQos><durability><kind>TRANSIENT_LOCAL</kind></durability></topic></subscriber></profiles>"};
     create_datareader_sync_by_xml(&my_session, datareader_id, datareader_xml, subscriber_id, false, false);
+#endif
     check_and_print_error(&my_session, "create datareader");
 
+    /* Samples go out on the best-effort stream, batched and serialized
+     * straight into the stream buffer.
+     */
+    struct client_pub_s pub;
+    client_pub_init(&pub, &my_session, CONFIG_EXAMPLES_CLIENT_FLUSH_MS,
+                    CONFIG_EXAMPLES_CLIENT_BATCH);
+
     uint32_t counter = 0;
+    uint32_t last_read = client_msec();
     while(true)
     {
         HelloWorld topic;
-	topic.index = counter;
-	topic.message = "Hello DDS World!";
-        if(write_HelloWorld(&my_session, datawriter_id, STREAMID_BUILTIN_RELIABLE, &topic))
+        topic.index = counter;
+        topic.message = "Hello DDS World!";
+        if(client_pub_write(&pub, datawriter_id, (uint16_t)size_of_HelloWorld_topic(&topic),
+                            serialize_HelloWorld_sample, &topic) == OK)
         {
             counter++;
-            printf("Write topic: %s, count: %i\n", topic.message, topic.index);
         }
 
-        read_data_sync(&my_session, datareader_id, STREAMID_BUILTIN_RELIABLE);
-        check_and_print_error(&my_session, "read data");
+        (void)client_pub_poll(&pub);
+
+        if(client_msec() - last_read >= READ_PERIOD_MS)
+        {
+            client_pub_flush(&pub);
+            printf("Written: %u samples in %u messages, %u dropped\n",
+                   (unsigned)pub.samples, (unsigned)pub.flushes, (unsigned)pub.dropped);
+
+            read_data_sync(&my_session, datareader_id, STREAMID_BUILTIN_RELIABLE);
+            check_and_print_error(&my_session, "read data");
+            last_read = client_msec();
+        }
 
-        run_communication(&my_session);
-        ms_sleep(2000);
+        ms_sleep(CONFIG_EXAMPLES_CLIENT_PERIOD_MS);
     }
 
     close_session_sync(&my_session);
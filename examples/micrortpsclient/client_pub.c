@@ -0,0 +1,176 @@
+/****************************************************************************
+ * examples/micrortpsclient/client_pub.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+#include <micrortps/client/xrce_client.h>
+
+#include "client_pub.h"
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: client_pub_msec
+ ****************************************************************************/
+
+static uint32_t client_pub_msec(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: client_pub_init
+ ****************************************************************************/
+
+void client_pub_init(FAR struct client_pub_s *pub, FAR Session *session,
+                     uint32_t interval, uint16_t maxbatch)
+{
+  memset(pub, 0, sizeof(*pub));
+  pub->session  = session;
+  pub->interval = interval;
+  pub->maxbatch = maxbatch > 0 ? maxbatch : 1;
+}
+
+/****************************************************************************
+ * Name: client_pub_write
+ ****************************************************************************/
+
+int client_pub_write(FAR struct client_pub_s *pub, ObjectId datawriter,
+                     uint16_t size, client_serialize_t serialize,
+                     FAR const void *sample)
+{
+  FAR MicroBuffer *writer;
+
+  /* Reserve the WRITE_DATA submessage in the stream buffer.  If the
+   * samples queued so far leave no room, send them and try again.
+   */
+
+  writer = prepare_best_effort_stream_for_topic(
+             &pub->session->output_best_effort_stream, datawriter, size);
+  if (writer == NULL && pub->pending > 0)
+    {
+      client_pub_flush(pub);
+      writer = prepare_best_effort_stream_for_topic(
+                 &pub->session->output_best_effort_stream, datawriter, size);
+    }
+
+  if (writer == NULL)
+    {
+      pub->dropped++;
+      return -ENOSPC;
+    }
+
+  /* Serialize in place, no intermediate copy */
+
+  if (!serialize(writer, sample))
+    {
+      pub->dropped++;
+      return -EINVAL;
+    }
+
+  if (pub->pending++ == 0)
+    {
+      pub->first = client_pub_msec();
+    }
+
+  if (pub->pending >= pub->maxbatch)
+    {
+      client_pub_flush(pub);
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: client_pub_poll
+ ****************************************************************************/
+
+uint32_t client_pub_poll(FAR struct client_pub_s *pub)
+{
+  uint32_t elapsed;
+
+  if (pub->pending == 0)
+    {
+      return pub->interval;
+    }
+
+  elapsed = client_pub_msec() - pub->first;
+  if (elapsed >= pub->interval)
+    {
+      client_pub_flush(pub);
+      return pub->interval;
+    }
+
+  return pub->interval - elapsed;
+}
+
+/****************************************************************************
+ * Name: client_pub_flush
+ ****************************************************************************/
+
+void client_pub_flush(FAR struct client_pub_s *pub)
+{
+  if (pub->pending == 0)
+    {
+      return;
+    }
+
+  /* One run sends everything queued on the output streams */
+
+  run_communication(pub->session);
+
+  pub->samples += pub->pending;
+  pub->flushes++;
+  pub->pending  = 0;
+}
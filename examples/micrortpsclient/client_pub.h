@@ -0,0 +1,149 @@
+/****************************************************************************
+ * examples/micrortpsclient/client_pub.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_EXAMPLES_MICRORTPSCLIENT_CLIENT_PUB_H
+#define __APPS_EXAMPLES_MICRORTPSCLIENT_CLIENT_PUB_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <micrortps/client/xrce_client.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Configuration ************************************************************/
+
+#ifndef CONFIG_EXAMPLES_CLIENT_BATCH
+#  define CONFIG_EXAMPLES_CLIENT_BATCH 8
+#endif
+
+#ifndef CONFIG_EXAMPLES_CLIENT_FLUSH_MS
+#  define CONFIG_EXAMPLES_CLIENT_FLUSH_MS 20
+#endif
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Serialize one sample straight into the output stream */
+
+typedef CODE bool (*client_serialize_t)(FAR MicroBuffer *writer,
+                                        FAR const void *sample);
+
+/* Batching publisher on the best-effort output stream of a session.
+ * Samples are serialized in place into the stream buffer and go out
+ * together, as one XRCE message, when maxbatch samples are queued, when
+ * interval milliseconds have passed since the first of them was queued,
+ * or when the stream buffer is full.
+ */
+
+struct client_pub_s
+{
+  FAR Session *session;              /* Session that owns the stream        */
+  uint32_t interval;                 /* Flush interval in ms                */
+  uint32_t first;                    /* Time the oldest queued sample came  */
+  uint16_t maxbatch;                 /* Samples per message                 */
+  uint16_t pending;                  /* Samples queued in the stream        */
+
+  /* Statistics */
+
+  uint32_t samples;                  /* Samples sent                        */
+  uint32_t flushes;                  /* Messages sent                       */
+  uint32_t dropped;                  /* Samples that did not fit or failed  */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: client_pub_init
+ *
+ * Description:
+ *   Set up a batching publisher on the best-effort stream of an
+ *   initialized session.  A maxbatch of one sends every sample on its own.
+ *
+ ****************************************************************************/
+
+void client_pub_init(FAR struct client_pub_s *pub, FAR Session *session,
+                     uint32_t interval, uint16_t maxbatch);
+
+/****************************************************************************
+ * Name: client_pub_write
+ *
+ * Description:
+ *   Queue one sample of size serialized bytes for a data writer.
+ *
+ *   It will return OK, or -ENOSPC if the sample does not fit in an empty
+ *   stream buffer, or -EINVAL if it failed to serialize.
+ *
+ ****************************************************************************/
+
+int client_pub_write(FAR struct client_pub_s *pub, ObjectId datawriter,
+                     uint16_t size, client_serialize_t serialize,
+                     FAR const void *sample);
+
+/****************************************************************************
+ * Name: client_pub_poll
+ *
+ * Description:
+ *   Send the queued samples if the flush interval has expired.  Returns
+ *   the number of milliseconds until it expires if samples are still
+ *   queued, or the full interval otherwise, so that the caller knows how
+ *   long it may sleep.
+ *
+ ****************************************************************************/
+
+uint32_t client_pub_poll(FAR struct client_pub_s *pub);
+
+/****************************************************************************
+ * Name: client_pub_flush
+ *
+ * Description:
+ *   Send the queued samples now.
+ *
+ ****************************************************************************/
+
+void client_pub_flush(FAR struct client_pub_s *pub);
+
+#endif /* __APPS_EXAMPLES_MICRORTPSCLIENT_CLIENT_PUB_H */
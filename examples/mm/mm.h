@@ -0,0 +1,99 @@
+/****************************************************************************
+ * examples/mm/mm.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_EXAMPLES_MM_MM_H
+#define __APPS_EXAMPLES_MM_MM_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_MM_NSLOTS
+#  define CONFIG_EXAMPLES_MM_NSLOTS 256
+#endif
+
+#ifndef CONFIG_EXAMPLES_MM_CPUMHZ
+#  define CONFIG_EXAMPLES_MM_CPUMHZ 0
+#endif
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Parameters of a benchmark run.  With a trace file the allocations are
+ * replayed from the file, otherwise a random mix is generated from the
+ * other parameters.
+ */
+
+struct mm_bench_s
+{
+  FAR const char *trace;  /* Trace file, or NULL to synthesize the mix */
+  uint32_t seed;          /* Seed of the synthesized mix */
+  unsigned long nops;     /* Operations of the synthesized mix */
+  unsigned long interval; /* Operations between fragmentation samples */
+  int minsize;            /* Smallest allocation of the synthesized mix */
+  int maxsize;            /* Largest allocation of the synthesized mix */
+  int nslots;             /* Slots used by the synthesized mix */
+  int realloc;            /* Percentage of reallocs instead of frees */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_bench
+ *
+ * Description:
+ *   Run the allocation mix, print the latency and fragmentation figures
+ *   and release everything that the mix left allocated.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value if the trace cannot be
+ *   read.
+ *
+ ****************************************************************************/
+
+int mm_bench(FAR const struct mm_bench_s *bench);
+
+#endif /* __APPS_EXAMPLES_MM_MM_H */
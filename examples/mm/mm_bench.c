@@ -0,0 +1,516 @@
+/****************************************************************************
+ * examples/mm/mm_bench.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+#include "mm.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define MM_CLOCK CLOCK_MONOTONIC
+#else
+#  define MM_CLOCK CLOCK_REALTIME
+#endif
+
+#define MM_LINESIZE 80
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum mm_op_e
+{
+  MM_OP_MALLOC = 0,
+  MM_OP_REALLOC,
+  MM_OP_MEMALIGN,
+  MM_OP_FREE,
+  MM_NOPS
+};
+
+struct mm_opstats_s
+{
+  unsigned long count;
+  unsigned long nfailed;
+  uint64_t total;        /* Nanoseconds */
+  uint32_t worst;        /* Nanoseconds */
+};
+
+struct mm_state_s
+{
+  FAR const struct mm_bench_s *bench;
+  unsigned long nops;
+  uint32_t overhead;     /* Nanoseconds of an empty measurement */
+  uint32_t rand;
+  unsigned int worstfrag;
+  struct mm_opstats_s stats[MM_NOPS];
+  FAR void *slots[CONFIG_EXAMPLES_MM_NSLOTS];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static FAR const char *g_opnames[MM_NOPS] =
+{
+  "malloc", "realloc", "memalign", "free"
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_nsec
+ ****************************************************************************/
+
+static uint64_t mm_nsec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(MM_CLOCK, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/****************************************************************************
+ * Name: mm_random
+ *
+ * Description:
+ *   xorshift32, so that a seed gives the same mix on every target.
+ *
+ ****************************************************************************/
+
+static uint32_t mm_random(FAR struct mm_state_s *state)
+{
+  uint32_t x = state->rand;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  state->rand = x;
+  return x;
+}
+
+/****************************************************************************
+ * Name: mm_sample
+ *
+ * Description:
+ *   Print the fragmentation of the heap: the share of the free space that
+ *   is not in the largest free chunk, and so cannot serve one allocation.
+ *   This is outside of the timed sections, since mallinfo() walks the
+ *   heap.
+ *
+ ****************************************************************************/
+
+static void mm_sample(FAR struct mm_state_s *state)
+{
+  struct mallinfo mem = mallinfo();
+  unsigned int frag = 0;
+
+  if (mem.fordblks > 0)
+    {
+      frag = 100 - (unsigned int)((uint64_t)mem.mxordblk * 100 /
+                                  mem.fordblks);
+    }
+
+  if (frag > state->worstfrag)
+    {
+      state->worstfrag = frag;
+    }
+
+  printf("%10lu %10lu %10lu %10lu %6lu %4u%%\n",
+         state->nops, (unsigned long)mem.uordblks,
+         (unsigned long)mem.fordblks, (unsigned long)mem.mxordblk,
+         (unsigned long)mem.ordblks, frag);
+}
+
+/****************************************************************************
+ * Name: mm_account
+ ****************************************************************************/
+
+static void mm_account(FAR struct mm_state_s *state, enum mm_op_e op,
+                       uint64_t start, bool failed)
+{
+  FAR struct mm_opstats_s *stats = &state->stats[op];
+  uint64_t elapsed = mm_nsec() - start;
+  uint32_t nsec;
+
+  nsec = elapsed > state->overhead ? (uint32_t)(elapsed - state->overhead)
+                                   : 0;
+
+  stats->count++;
+  stats->total += nsec;
+  if (nsec > stats->worst)
+    {
+      stats->worst = nsec;
+    }
+
+  if (failed)
+    {
+      stats->nfailed++;
+    }
+
+  state->nops++;
+  if (state->bench->interval > 0 &&
+      state->nops % state->bench->interval == 0)
+    {
+      mm_sample(state);
+    }
+}
+
+/****************************************************************************
+ * Name: mm_run
+ *
+ * Description:
+ *   Perform and time one operation on a slot.
+ *
+ ****************************************************************************/
+
+static void mm_run(FAR struct mm_state_s *state, enum mm_op_e op, int slot,
+                   size_t align, size_t size)
+{
+  FAR void *mem = state->slots[slot];
+  uint64_t start;
+
+  if (op != MM_OP_REALLOC && op != MM_OP_FREE && mem != NULL)
+    {
+      /* A trace that allocates a slot twice leaked the first block */
+
+      free(mem);
+    }
+
+  start = mm_nsec();
+  switch (op)
+    {
+      case MM_OP_MALLOC:
+        mem = malloc(size);
+        break;
+
+      case MM_OP_REALLOC:
+        mem = realloc(mem, size);
+        break;
+
+      case MM_OP_MEMALIGN:
+        mem = memalign(align, size);
+        break;
+
+      default:
+        free(mem);
+        mem = NULL;
+        break;
+    }
+
+  mm_account(state, op, start, op != MM_OP_FREE && mem == NULL);
+
+  /* A failed realloc leaves the old block allocated */
+
+  if (op != MM_OP_REALLOC || mem != NULL)
+    {
+      state->slots[slot] = mem;
+    }
+}
+
+/****************************************************************************
+ * Name: mm_synthesize
+ *
+ * Description:
+ *   Turn slots over at random.  An empty slot is allocated, with a size
+ *   that is uniform on a logarithmic scale, and a full one is freed or
+ *   reallocated, so that about half of the slots are in use.
+ *
+ ****************************************************************************/
+
+static void mm_synthesize(FAR struct mm_state_s *state)
+{
+  FAR const struct mm_bench_s *bench = state->bench;
+  unsigned long i;
+  int minbits;
+  int maxbits;
+  int bits;
+  int slot;
+  size_t size;
+
+  for (minbits = 0; (2 << minbits) <= bench->minsize; minbits++)
+    {
+    }
+
+  for (maxbits = minbits; (2 << maxbits) <= bench->maxsize; maxbits++)
+    {
+    }
+
+  for (i = 0; i < bench->nops; i++)
+    {
+      slot = mm_random(state) % bench->nslots;
+
+      bits = minbits + mm_random(state) % (maxbits - minbits + 1);
+      size = ((size_t)1 << bits) +
+             mm_random(state) % ((size_t)1 << bits);
+
+      if (size < bench->minsize)
+        {
+          size = bench->minsize;
+        }
+      else if (size > bench->maxsize)
+        {
+          size = bench->maxsize;
+        }
+
+      if (state->slots[slot] == NULL)
+        {
+          mm_run(state, MM_OP_MALLOC, slot, 0, size);
+        }
+      else if (mm_random(state) % 100 < bench->realloc)
+        {
+          mm_run(state, MM_OP_REALLOC, slot, 0, size);
+        }
+      else
+        {
+          mm_run(state, MM_OP_FREE, slot, 0, 0);
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: mm_replay
+ *
+ * Description:
+ *   Replay a trace with one operation per line:
+ *
+ *     m <slot> <size>          malloc
+ *     r <slot> <size>          realloc
+ *     a <slot> <align> <size>  memalign
+ *     f <slot>                 free
+ *
+ *   Empty lines and lines starting with '#' are ignored.
+ *
+ ****************************************************************************/
+
+static int mm_replay(FAR struct mm_state_s *state)
+{
+  FAR FILE *stream;
+  char line[MM_LINESIZE];
+  unsigned long lineno = 0;
+  unsigned long align;
+  unsigned long size;
+  enum mm_op_e op;
+  int slot;
+  int nargs;
+  int ret = OK;
+
+  stream = fopen(state->bench->trace, "r");
+  if (stream == NULL)
+    {
+      ret = -errno;
+      fprintf(stderr, "ERROR: Failed to open %s: %d\n",
+              state->bench->trace, ret);
+      return ret;
+    }
+
+  while (fgets(line, MM_LINESIZE, stream) != NULL)
+    {
+      lineno++;
+      align = 0;
+      size  = 0;
+
+      switch (line[0])
+        {
+          case 'm':
+            op    = MM_OP_MALLOC;
+            nargs = sscanf(&line[1], "%d %lu", &slot, &size) - 2;
+            break;
+
+          case 'r':
+            op    = MM_OP_REALLOC;
+            nargs = sscanf(&line[1], "%d %lu", &slot, &size) - 2;
+            break;
+
+          case 'a':
+            op    = MM_OP_MEMALIGN;
+            nargs = sscanf(&line[1], "%d %lu %lu", &slot, &align,
+                           &size) - 3;
+            break;
+
+          case 'f':
+            op    = MM_OP_FREE;
+            nargs = sscanf(&line[1], "%d", &slot) - 1;
+            break;
+
+          case '#':
+          case '\r':
+          case '\n':
+            continue;
+
+          default:
+            nargs = -1;
+            break;
+        }
+
+      if (nargs != 0 || slot < 0 || slot >= CONFIG_EXAMPLES_MM_NSLOTS)
+        {
+          fprintf(stderr, "ERROR: %s:%lu: Bad operation\n",
+                  state->bench->trace, lineno);
+          ret = -EINVAL;
+          break;
+        }
+
+      mm_run(state, op, slot, align, size);
+    }
+
+  fclose(stream);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: mm_report
+ ****************************************************************************/
+
+static void mm_report(FAR struct mm_state_s *state)
+{
+  FAR struct mm_opstats_s *stats;
+  unsigned long avg;
+  int op;
+
+  printf("\n%-10s %10s %8s %10s %10s", "Operation", "Count", "Failed",
+         "Avg(ns)", "Worst(ns)");
+  if (CONFIG_EXAMPLES_MM_CPUMHZ > 0)
+    {
+      printf(" %10s %10s", "Avg(cyc)", "Worst(cyc)");
+    }
+
+  printf("\n");
+
+  for (op = 0; op < MM_NOPS; op++)
+    {
+      stats = &state->stats[op];
+      if (stats->count == 0)
+        {
+          continue;
+        }
+
+      avg = (unsigned long)(stats->total / stats->count);
+      printf("%-10s %10lu %8lu %10lu %10lu", g_opnames[op], stats->count,
+             stats->nfailed, avg, (unsigned long)stats->worst);
+
+      if (CONFIG_EXAMPLES_MM_CPUMHZ > 0)
+        {
+          printf(" %10lu %10lu",
+                 avg * CONFIG_EXAMPLES_MM_CPUMHZ / 1000,
+                 (unsigned long)((uint64_t)stats->worst *
+                                 CONFIG_EXAMPLES_MM_CPUMHZ / 1000));
+        }
+
+      printf("\n");
+    }
+
+  printf("\nWorst fragmentation: %u%%\n", state->worstfrag);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_bench
+ ****************************************************************************/
+
+int mm_bench(FAR const struct mm_bench_s *bench)
+{
+  FAR struct mm_state_s *state;
+  uint64_t start;
+  int ret = OK;
+  int i;
+
+  state = (FAR struct mm_state_s *)calloc(1, sizeof(struct mm_state_s));
+  if (state == NULL)
+    {
+      fprintf(stderr, "ERROR: Failed to allocate the benchmark state\n");
+      return -ENOMEM;
+    }
+
+  state->bench = bench;
+  state->rand  = bench->seed != 0 ? bench->seed : 1;
+
+  /* The cost of reading the clock is subtracted from every operation */
+
+  start = mm_nsec();
+  for (i = 0; i < 16; i++)
+    {
+      (void)mm_nsec();
+    }
+
+  state->overhead = (uint32_t)((mm_nsec() - start) / 17);
+
+  printf("%10s %10s %10s %10s %6s %5s\n", "Ops", "Used", "Free",
+         "Largest", "Chunks", "Frag");
+  mm_sample(state);
+
+  if (bench->trace != NULL)
+    {
+      ret = mm_replay(state);
+    }
+  else
+    {
+      mm_synthesize(state);
+    }
+
+  if (bench->interval == 0 || state->nops % bench->interval != 0)
+    {
+      mm_sample(state);
+    }
+
+  mm_report(state);
+
+  for (i = 0; i < CONFIG_EXAMPLES_MM_NSLOTS; i++)
+    {
+      free(state->slots[i]);
+    }
+
+  free(state);
+  return ret;
+}
@@ -37,9 +37,15 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+
+#include "mm.h"
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -279,6 +285,31 @@ static void do_frees(void **mem, const int *size, const int *seq, int n)
     }
 }
 
+static void mm_showusage(FAR const char *progname, int exitcode)
+{
+  fprintf(stderr, "USAGE: %s [-b] [-t <trace>] [-n <ops>] [-s <seed>] "
+          "[-m <min>] [-M <max>]\n", progname);
+  fprintf(stderr, "          [-l <slots>] [-r <percent>] [-i <ops>]\n");
+  fprintf(stderr, "\nWithout options the allocator test runs.  Otherwise:\n");
+  fprintf(stderr, "\t-b: Benchmark a synthesized allocation mix\n");
+  fprintf(stderr, "\t-t <trace>: Benchmark the allocations of a trace file "
+          "instead\n");
+  fprintf(stderr, "\t-n <ops>: Operations of the mix.  Default: 10000\n");
+  fprintf(stderr, "\t-s <seed>: Random seed of the mix.  Default: 1\n");
+  fprintf(stderr, "\t-m <min>, -M <max>: Allocation sizes of the mix.  "
+          "Default: 8 to 1024\n");
+  fprintf(stderr, "\t-l <slots>: Blocks that are turned over, up to %d.  "
+          "Default: 64\n", CONFIG_EXAMPLES_MM_NSLOTS);
+  fprintf(stderr, "\t-r <percent>: Reallocs instead of frees.  "
+          "Default: 10\n");
+  fprintf(stderr, "\t-i <ops>: Operations between fragmentation samples, "
+          "0 for none.\n\t   Default: 1000\n");
+  fprintf(stderr, "\nA trace has one operation per line: 'm <slot> <size>', "
+          "'r <slot> <size>',\n'a <slot> <align> <size>' or "
+          "'f <slot>', with slots below %d.\n", CONFIG_EXAMPLES_MM_NSLOTS);
+  exit(exitcode);
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -293,6 +324,89 @@ int main(int argc, FAR char *argv[])
 int mm_main(int argc, char *argv[])
 #endif
 {
+  struct mm_bench_s bench;
+  bool benchmark = false;
+  int option;
+
+  memset(&bench, 0, sizeof(struct mm_bench_s));
+  bench.seed     = 1;
+  bench.nops     = 10000;
+  bench.interval = 1000;
+  bench.minsize  = 8;
+  bench.maxsize  = 1024;
+  bench.nslots   = 64;
+  bench.realloc  = 10;
+
+  while ((option = getopt(argc, argv, ":bt:n:s:m:M:l:r:i:h")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'b':
+            break;
+
+          case 't':
+            bench.trace = optarg;
+            break;
+
+          case 'n':
+            bench.nops = strtoul(optarg, NULL, 0);
+            break;
+
+          case 's':
+            bench.seed = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'm':
+            bench.minsize = atoi(optarg);
+            break;
+
+          case 'M':
+            bench.maxsize = atoi(optarg);
+            break;
+
+          case 'l':
+            bench.nslots = atoi(optarg);
+            break;
+
+          case 'r':
+            bench.realloc = atoi(optarg);
+            break;
+
+          case 'i':
+            bench.interval = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'h':
+            mm_showusage(argv[0], EXIT_SUCCESS);
+            break;
+
+          case ':':
+            fprintf(stderr, "ERROR: Missing required argument\n");
+            mm_showusage(argv[0], EXIT_FAILURE);
+            break;
+
+          case '?':
+          default:
+            fprintf(stderr, "ERROR: Unrecognized option\n");
+            mm_showusage(argv[0], EXIT_FAILURE);
+            break;
+        }
+
+      benchmark = true;
+    }
+
+  if (benchmark)
+    {
+      if (bench.minsize < 1 || bench.maxsize < bench.minsize ||
+          bench.nslots < 1 || bench.nslots > CONFIG_EXAMPLES_MM_NSLOTS)
+        {
+          fprintf(stderr, "ERROR: Bad mix parameters\n");
+          mm_showusage(argv[0], EXIT_FAILURE);
+        }
+
+      return mm_bench(&bench) < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
   mm_showmallinfo();
 
   /* Allocate some memory */
@@ -88,6 +88,10 @@
 #  define CONFIG_EXAMPLES_MODBUS_PARITY MB_PAR_EVEN
 #endif
 
+#ifndef CONFIG_EXAMPLES_MODBUS_TCP_PORT
+#  define CONFIG_EXAMPLES_MODBUS_TCP_PORT 502
+#endif
+
 #ifndef CONFIG_EXAMPLES_MODBUS_REG_INPUT_START
 #  define CONFIG_EXAMPLES_MODBUS_REG_INPUT_START 1000
 #endif
@@ -180,6 +184,20 @@ static inline int modbus_initialize(void)
 
   status = ENODEV;
 
+#ifdef CONFIG_EXAMPLES_MODBUS_TCP
+  /* Initialize the FreeModBus library as a Modbus/TCP server.
+   *
+   * CONFIG_EXAMPLES_MODBUS_TCP_PORT = TCP port, default=502
+   */
+
+  mberr = eMBTCPInit(CONFIG_EXAMPLES_MODBUS_TCP_PORT);
+  if (mberr != MB_ENOERR)
+    {
+      fprintf(stderr, "modbus_main: "
+              "ERROR: eMBTCPInit failed: %d\n", mberr);
+      goto errout_with_mutex;
+    }
+#else
   /* Initialize the FreeModBus library.
    *
    * MB_RTU                        = RTU mode
@@ -197,6 +215,7 @@ static inline int modbus_initialize(void)
               "ERROR: eMBInit failed: %d\n", mberr);
       goto errout_with_mutex;
     }
+#endif
 
   /* Set the slave ID
    *
@@ -283,7 +302,9 @@ static void *modbus_pollthread(void *pvarg)
 
       /* Generate some random input */
 
+      (void)pthread_mutex_lock(&g_modbus.lock);
       g_modbus.reginput[0] = (uint16_t)rand();
+      (void)pthread_mutex_unlock(&g_modbus.lock);
     }
   while (g_modbus.threadstate != SHUTDOWN);
 
@@ -456,6 +477,8 @@ eMBErrorCode eMBRegInputCB(uint8_t *buffer, uint16_t address, uint16_t nregs)
       CONFIG_EXAMPLES_MODBUS_REG_INPUT_NREGS))
     {
       index = (int)(address - CONFIG_EXAMPLES_MODBUS_REG_INPUT_START);
+
+      (void)pthread_mutex_lock(&g_modbus.lock);
       while (nregs > 0)
         {
           *buffer++ = (uint8_t)(g_modbus.reginput[index] >> 8);
@@ -463,6 +486,8 @@ eMBErrorCode eMBRegInputCB(uint8_t *buffer, uint16_t address, uint16_t nregs)
           index++;
           nregs--;
         }
+
+      (void)pthread_mutex_unlock(&g_modbus.lock);
     }
   else
     {
@@ -492,6 +517,12 @@ eMBErrorCode eMBRegHoldingCB(uint8_t *buffer, uint16_t address, uint16_t nregs,
        CONFIG_EXAMPLES_MODBUS_REG_HOLDING_NREGS))
     {
       index = (int)(address - CONFIG_EXAMPLES_MODBUS_REG_HOLDING_START);
+
+      /* The register image is shared by all Modbus/TCP clients and by the
+       * application, so a multi-register access must not be torn.
+       */
+
+      (void)pthread_mutex_lock(&g_modbus.lock);
       switch (mode)
         {
           /* Pass current register values to the protocol stack. */
@@ -519,6 +550,8 @@ eMBErrorCode eMBRegHoldingCB(uint8_t *buffer, uint16_t address, uint16_t nregs,
               }
             break;
         }
+
+      (void)pthread_mutex_unlock(&g_modbus.lock);
     }
   else
     {
@@ -20,9 +20,11 @@ if [ ! -d "$dir" ]; then
 fi
 
 # Extract all of the undefined symbols from the MODULE files and create a
-# list of sorted, unique undefined variable names.
+# list of sorted, unique undefined variable names.  The list is sorted in
+# strcmp() order so that the table also works with the binary search of
+# CONFIG_SYMTAB_ORDEREDBYNAME.
 
-varlist=`find ${dir} -executable -type f | xargs nm | fgrep ' U ' | sed -e "s/^[ ]*//g" | cut -d' ' -f2 | sort | uniq`
+varlist=`find ${dir} -executable -type f | xargs nm | fgrep ' U ' | sed -e "s/^[ ]*//g" | cut -d' ' -f2 | LC_ALL=C sort -u`
 
 # Now output the symbol table as a structure in a C source file.  All
 # undefined symbols are declared as void* types.  If the toolchain does
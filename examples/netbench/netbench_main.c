@@ -0,0 +1,885 @@
+/****************************************************************************
+ * apps/examples/netbench/netbench_main.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <malloc.h>
+#include <time.h>
+#include <errno.h>
+
+#ifdef CONFIG_NETUTILS_JSON
+#  include "netutils/cJSON.h"
+#endif
+
+#ifdef CONFIG_GPSUTILS_MINMEA_LIB
+#  include "gpsutils/minmea.h"
+#endif
+
+#ifdef CONFIG_NETUTILS_XMLRPC
+#  include "netutils/xmlrpc.h"
+#endif
+
+#ifdef CONFIG_FSUTILS_INIFILE
+#  include "fsutils/inifile.h"
+#endif
+
+#ifdef CONFIG_CODECS_BASE64
+#  include "netutils/base64.h"
+#endif
+
+#ifdef CONFIG_CODECS_HASH_MD5
+#  include "netutils/md5.h"
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_NETBENCH_ITERATIONS
+#  define CONFIG_EXAMPLES_NETBENCH_ITERATIONS 100
+#endif
+
+#ifndef CONFIG_EXAMPLES_NETBENCH_CPUMHZ
+#  define CONFIG_EXAMPLES_NETBENCH_CPUMHZ 0
+#endif
+
+#ifndef CONFIG_EXAMPLES_NETBENCH_CORPUSSIZE
+#  define CONFIG_EXAMPLES_NETBENCH_CORPUSSIZE 8192
+#endif
+
+#ifndef CONFIG_EXAMPLES_NETBENCH_INIPATH
+#  define CONFIG_EXAMPLES_NETBENCH_INIPATH "/tmp/netbench.ini"
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define NETBENCH_CLOCK CLOCK_MONOTONIC
+#else
+#  define NETBENCH_CLOCK CLOCK_REALTIME
+#endif
+
+/* Room for the largest sentence, record or line a generator appends */
+
+#define NETBENCH_SLACK 256
+
+/* The corpus buffer and the output buffer of the codecs */
+
+#define NETBENCH_BUFSIZE (CONFIG_EXAMPLES_NETBENCH_CORPUSSIZE + NETBENCH_SLACK)
+#define NETBENCH_OUTSIZE ((NETBENCH_BUFSIZE + 2) / 3 * 4 + 1)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct netbench_test_s
+{
+  FAR const char *name;
+  CODE int (*setup)(void);           /* Build the corpus */
+  CODE int (*run)(void);             /* One operation over the corpus */
+  bool hooked;                       /* Allocations are counted */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+#ifdef CONFIG_NETUTILS_JSON
+static int netbench_json_setup(void);
+static int netbench_json_run(void);
+#endif
+#ifdef CONFIG_GPSUTILS_MINMEA_LIB
+static int netbench_nmea_setup(void);
+static int netbench_nmea_run(void);
+#endif
+#ifdef CONFIG_NETUTILS_XMLRPC
+static int netbench_xmlrpc_setup(void);
+static int netbench_xmlrpc_run(void);
+#endif
+#ifdef CONFIG_FSUTILS_INIFILE
+static int netbench_ini_setup(void);
+static int netbench_ini_run(void);
+#endif
+#if defined(CONFIG_CODECS_BASE64) || defined(CONFIG_CODECS_HASH_MD5)
+static int netbench_binary_setup(void);
+#endif
+#ifdef CONFIG_CODECS_BASE64
+static int netbench_base64_run(void);
+#endif
+#ifdef CONFIG_CODECS_HASH_MD5
+static int netbench_md5_run(void);
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct netbench_test_s g_tests[] =
+{
+#ifdef CONFIG_NETUTILS_JSON
+  { "json",    netbench_json_setup,   netbench_json_run,   true  },
+#endif
+#ifdef CONFIG_GPSUTILS_MINMEA_LIB
+  { "nmea",    netbench_nmea_setup,   netbench_nmea_run,   false },
+#endif
+#ifdef CONFIG_NETUTILS_XMLRPC
+  { "xmlrpc",  netbench_xmlrpc_setup, netbench_xmlrpc_run, false },
+#endif
+#ifdef CONFIG_FSUTILS_INIFILE
+  { "inifile", netbench_ini_setup,    netbench_ini_run,    false },
+#endif
+#ifdef CONFIG_CODECS_BASE64
+  { "base64",  netbench_binary_setup, netbench_base64_run, false },
+#endif
+#ifdef CONFIG_CODECS_HASH_MD5
+  { "md5",     netbench_binary_setup, netbench_md5_run,    false },
+#endif
+  { NULL,      NULL,                  NULL,                false }
+};
+
+/* The corpus of the current test and its length in bytes */
+
+static FAR char *g_corpus;
+static size_t g_corpuslen;
+
+/* Output buffer of the codecs */
+
+static FAR char *g_output;
+
+/* Profiling pass: heap in use at its start and the highest seen since */
+
+static bool g_profile;
+static unsigned long g_heapbase;
+static unsigned long g_heappeak;
+
+/* Allocations through the parser hooks, where the parser has hooks */
+
+static uint32_t g_nallocs;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: netbench_nsec
+ ****************************************************************************/
+
+static uint64_t netbench_nsec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(NETBENCH_CLOCK, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/****************************************************************************
+ * Name: netbench_sample
+ *
+ * Description:
+ *   Fold the current heap usage into the peak of the profiling pass.  The
+ *   tests call this where their parser holds the most memory; it does
+ *   nothing in the timed passes, since mallinfo() walks the heap.
+ *
+ ****************************************************************************/
+
+static void netbench_sample(void)
+{
+  struct mallinfo mem;
+
+  if (g_profile)
+    {
+      mem = mallinfo();
+      if ((unsigned long)mem.uordblks > g_heappeak)
+        {
+          g_heappeak = mem.uordblks;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: netbench_append
+ *
+ * Description:
+ *   Append formatted text to the corpus.  Returns false once the corpus
+ *   has reached its configured size.
+ *
+ ****************************************************************************/
+
+static bool netbench_append(FAR const char *fmt, ...)
+{
+  va_list ap;
+  int ret;
+
+  va_start(ap, fmt);
+  ret = vsnprintf(&g_corpus[g_corpuslen], NETBENCH_BUFSIZE - g_corpuslen,
+                  fmt, ap);
+  va_end(ap);
+
+  if (ret > 0 && g_corpuslen + ret < NETBENCH_BUFSIZE)
+    {
+      g_corpuslen += ret;
+    }
+
+  return g_corpuslen < CONFIG_EXAMPLES_NETBENCH_CORPUSSIZE;
+}
+
+#ifdef CONFIG_NETUTILS_JSON
+/****************************************************************************
+ * Name: netbench_json_malloc and netbench_json_free
+ *
+ * Description:
+ *   cJSON hooks that count the allocations of the profiling pass.
+ *
+ ****************************************************************************/
+
+static FAR void *netbench_json_malloc(size_t size)
+{
+  FAR void *mem = malloc(size);
+
+  if (g_profile)
+    {
+      g_nallocs++;
+      netbench_sample();
+    }
+
+  return mem;
+}
+
+static void netbench_json_free(FAR void *mem)
+{
+  free(mem);
+}
+
+/****************************************************************************
+ * Name: netbench_json_setup
+ *
+ * Description:
+ *   A document of records, each mixing numbers, strings, literals and a
+ *   nested array.
+ *
+ ****************************************************************************/
+
+static int netbench_json_setup(void)
+{
+  int i = 0;
+
+  netbench_append("{\"device\":\"netbench\",\"records\":[");
+  while (netbench_append("%s{\"id\":%d,\"name\":\"sensor-%d\","
+                         "\"value\":%d.%03d,\"valid\":%s,"
+                         "\"tags\":[\"temp\",\"zone%d\"],\"limit\":null}",
+                         i > 0 ? "," : "", i, i % 37, 20 + i % 15,
+                         (i * 7919) % 1000, (i & 3) ? "true" : "false",
+                         i % 8))
+    {
+      i++;
+    }
+
+  netbench_append("]}");
+  return OK;
+}
+
+/****************************************************************************
+ * Name: netbench_json_run
+ ****************************************************************************/
+
+static int netbench_json_run(void)
+{
+  FAR cJSON *root;
+  FAR cJSON *records;
+
+  root = cJSON_Parse(g_corpus);
+  if (root == NULL)
+    {
+      return ERROR;
+    }
+
+  records = cJSON_GetObjectItem(root, "records");
+  if (records == NULL || cJSON_GetArraySize(records) <= 0)
+    {
+      cJSON_Delete(root);
+      return ERROR;
+    }
+
+  netbench_sample();
+  cJSON_Delete(root);
+  return OK;
+}
+#endif /* CONFIG_NETUTILS_JSON */
+
+#ifdef CONFIG_GPSUTILS_MINMEA_LIB
+/****************************************************************************
+ * Name: netbench_nmea_sentence
+ *
+ * Description:
+ *   Append one sentence with its checksum.
+ *
+ ****************************************************************************/
+
+static bool netbench_nmea_sentence(FAR const char *fmt, ...)
+{
+  FAR const char *ptr;
+  char sentence[MINMEA_MAX_LENGTH];
+  uint8_t checksum = 0;
+  va_list ap;
+
+  va_start(ap, fmt);
+  vsnprintf(sentence, sizeof(sentence), fmt, ap);
+  va_end(ap);
+
+  for (ptr = sentence; *ptr != '\0'; ptr++)
+    {
+      checksum ^= (uint8_t)*ptr;
+    }
+
+  return netbench_append("$%s*%02X\r\n", sentence, checksum);
+}
+
+/****************************************************************************
+ * Name: netbench_nmea_setup
+ *
+ * Description:
+ *   A receiver log: one RMC, GGA and GSA sentence per second.
+ *
+ ****************************************************************************/
+
+static int netbench_nmea_setup(void)
+{
+  int sec = 0;
+  int hh;
+  int mm;
+  int ss;
+
+  do
+    {
+      hh = (sec / 3600) % 24;
+      mm = (sec / 60) % 60;
+      ss = sec % 60;
+      sec++;
+
+      netbench_nmea_sentence("GPRMC,%02d%02d%02d.00,A,4807.%03d,N,"
+                             "01131.%03d,E,022.4,084.4,230394,003.1,W",
+                             hh, mm, ss, sec % 1000, (sec * 3) % 1000);
+      netbench_nmea_sentence("GPGGA,%02d%02d%02d.00,4807.%03d,N,"
+                             "01131.%03d,E,1,08,0.9,545.4,M,46.9,M,,",
+                             hh, mm, ss, sec % 1000, (sec * 3) % 1000);
+    }
+  while (netbench_nmea_sentence("GPGSA,A,3,04,05,,09,12,,,24,,,,,"
+                                "2.5,1.3,2.1"));
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: netbench_nmea_frame
+ ****************************************************************************/
+
+static void netbench_nmea_frame(FAR void *arg, enum minmea_sentence_id id,
+                                FAR const union minmea_frame *frame,
+                                FAR const char *sentence)
+{
+  if (frame != NULL)
+    {
+      (*(FAR int *)arg)++;
+    }
+}
+
+/****************************************************************************
+ * Name: netbench_nmea_run
+ ****************************************************************************/
+
+static int netbench_nmea_run(void)
+{
+  struct minmea_parser parser;
+  int nframes = 0;
+
+  minmea_parser_init(&parser, MINMEA_MASK_ALL, true, netbench_nmea_frame,
+                     &nframes);
+  minmea_parser_feed(&parser, g_corpus, g_corpuslen);
+  netbench_sample();
+
+  return nframes > 0 && parser.errors == 0 ? OK : ERROR;
+}
+#endif /* CONFIG_GPSUTILS_MINMEA_LIB */
+
+#ifdef CONFIG_NETUTILS_XMLRPC
+/****************************************************************************
+ * Name: netbench_xmlrpc_sum
+ *
+ * Description:
+ *   The method of the benchmark call: sum the integer arguments.
+ *
+ ****************************************************************************/
+
+static int netbench_xmlrpc_sum(FAR struct xmlrpc_s *xmlcall)
+{
+  int sum = 0;
+  int value;
+
+  while (xmlrpc_getinteger(xmlcall, &value) == XMLRPC_NO_ERROR)
+    {
+      sum += value;
+    }
+
+  return xmlrpc_buildresponse(xmlcall, "{i}", "sum", sum);
+}
+
+static struct xmlrpc_entry_s g_xmlrpc_sum =
+{
+  .name = "netbench.sum",
+  .func = netbench_xmlrpc_sum
+};
+
+static int g_xmlrpc_fd = -1;
+
+/****************************************************************************
+ * Name: netbench_xmlrpc_setup
+ *
+ * Description:
+ *   One call with as many integer arguments as a call may carry.  The
+ *   response is written to /dev/null.
+ *
+ ****************************************************************************/
+
+static int netbench_xmlrpc_setup(void)
+{
+  int i;
+
+  if (g_xmlrpc_fd < 0)
+    {
+      g_xmlrpc_fd = open("/dev/null", O_WRONLY);
+      if (g_xmlrpc_fd < 0)
+        {
+          return ERROR;
+        }
+
+      xmlrpc_register(&g_xmlrpc_sum);
+    }
+
+  netbench_append("<?xml version=\"1.0\"?>\n<methodCall>\n"
+                  "<methodName>netbench.sum</methodName>\n<params>\n");
+  for (i = 0; i < MAX_ARGS; i++)
+    {
+      netbench_append("<param><value><int>%d</int></value></param>\n",
+                      i * 1000 + 7);
+    }
+
+  netbench_append("</params>\n</methodCall>\n");
+  return OK;
+}
+
+/****************************************************************************
+ * Name: netbench_xmlrpc_run
+ ****************************************************************************/
+
+static int netbench_xmlrpc_run(void)
+{
+  xmlrpc_parse_begin();
+  if (xmlrpc_parse_push(g_corpus, g_corpuslen) != XMLRPC_NO_ERROR)
+    {
+      return ERROR;
+    }
+
+  netbench_sample();
+  return xmlrpc_parse_end(g_xmlrpc_fd) == XMLRPC_NO_ERROR ? OK : ERROR;
+}
+#endif /* CONFIG_NETUTILS_XMLRPC */
+
+#ifdef CONFIG_FSUTILS_INIFILE
+/* The number of the last section of the INI file */
+
+static int g_ini_last;
+
+/****************************************************************************
+ * Name: netbench_ini_setup
+ *
+ * Description:
+ *   Sections of settings, written to CONFIG_EXAMPLES_NETBENCH_INIPATH.
+ *
+ ****************************************************************************/
+
+static int netbench_ini_setup(void)
+{
+  ssize_t nwritten;
+  bool more;
+  int fd;
+
+  for (g_ini_last = 0; ; g_ini_last++)
+    {
+      more = netbench_append("; Unit %d\n[unit%d]\nname=unit-%d\n"
+                             "address=10.0.%d.%d\nport=%d\ntimeout=%d\n\n",
+                             g_ini_last, g_ini_last, g_ini_last,
+                             g_ini_last / 250, g_ini_last % 250 + 1,
+                             5000 + g_ini_last, 100 * (g_ini_last % 7));
+      if (!more)
+        {
+          break;
+        }
+    }
+
+  fd = open(CONFIG_EXAMPLES_NETBENCH_INIPATH, O_WRONLY | O_CREAT | O_TRUNC,
+            0644);
+  if (fd < 0)
+    {
+      return ERROR;
+    }
+
+  nwritten = write(fd, g_corpus, g_corpuslen);
+  close(fd);
+  return nwritten == (ssize_t)g_corpuslen ? OK : ERROR;
+}
+
+/****************************************************************************
+ * Name: netbench_ini_run
+ *
+ * Description:
+ *   Look up a string and an integer in the last section, so that the
+ *   whole file is read.
+ *
+ ****************************************************************************/
+
+static int netbench_ini_run(void)
+{
+  char section[16];
+  INIHANDLE handle;
+  FAR char *name;
+  long port;
+
+  handle = inifile_initialize(CONFIG_EXAMPLES_NETBENCH_INIPATH);
+  if (handle == NULL)
+    {
+      return ERROR;
+    }
+
+  snprintf(section, sizeof(section), "unit%d", g_ini_last);
+  name = inifile_read_string(handle, section, "name", NULL);
+  port = inifile_read_integer(handle, section, "port", -1);
+  netbench_sample();
+
+  if (name != NULL)
+    {
+      inifile_free_string(name);
+    }
+
+  inifile_uninitialize(handle);
+  return name != NULL && port == 5000 + g_ini_last ? OK : ERROR;
+}
+#endif /* CONFIG_FSUTILS_INIFILE */
+
+#if defined(CONFIG_CODECS_BASE64) || defined(CONFIG_CODECS_HASH_MD5)
+/****************************************************************************
+ * Name: netbench_binary_setup
+ *
+ * Description:
+ *   Pseudo-random binary data.
+ *
+ ****************************************************************************/
+
+static int netbench_binary_setup(void)
+{
+  uint32_t x = 0x12345678;
+
+  for (g_corpuslen = 0; g_corpuslen < CONFIG_EXAMPLES_NETBENCH_CORPUSSIZE;
+       g_corpuslen++)
+    {
+      x = x * 1664525 + 1013904223;
+      g_corpus[g_corpuslen] = (char)(x >> 24);
+    }
+
+  return OK;
+}
+#endif
+
+#ifdef CONFIG_CODECS_BASE64
+/****************************************************************************
+ * Name: netbench_base64_run
+ *
+ * Description:
+ *   Encode the data and decode it again.
+ *
+ ****************************************************************************/
+
+static int netbench_base64_run(void)
+{
+  FAR unsigned char *encoded = (FAR unsigned char *)g_output;
+  size_t enclen;
+  size_t declen;
+
+  base64_encode((FAR const unsigned char *)g_corpus, g_corpuslen, encoded,
+                &enclen);
+  base64_decode(encoded, enclen, encoded, &declen);
+  netbench_sample();
+
+  return declen == g_corpuslen && memcmp(encoded, g_corpus, declen) == 0 ?
+         OK : ERROR;
+}
+#endif
+
+#ifdef CONFIG_CODECS_HASH_MD5
+/****************************************************************************
+ * Name: netbench_md5_run
+ ****************************************************************************/
+
+static int netbench_md5_run(void)
+{
+  uint8_t digest[16];
+
+  md5_sum((FAR const uint8_t *)g_corpus, g_corpuslen, digest);
+  netbench_sample();
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: netbench_runtest
+ *
+ * Description:
+ *   Build the corpus of a test, run one profiling pass and then time the
+ *   requested number of operations.
+ *
+ ****************************************************************************/
+
+static int netbench_runtest(FAR const struct netbench_test_s *test,
+                            int iterations)
+{
+  struct mallinfo mem;
+  uint64_t start;
+  uint64_t nsecs;
+  double nsperbyte;
+  int i;
+
+  g_corpuslen = 0;
+  if (test->setup() < 0 || g_corpuslen == 0)
+    {
+      printf("%-10s setup failed\n", test->name);
+      return ERROR;
+    }
+
+  g_corpus[g_corpuslen] = '\0';
+
+  /* The profiling pass */
+
+  mem        = mallinfo();
+  g_heapbase = mem.uordblks;
+  g_heappeak = mem.uordblks;
+  g_nallocs  = 0;
+  g_profile  = true;
+
+  i = test->run();
+
+  g_profile = false;
+  if (i < 0)
+    {
+      printf("%-10s failed\n", test->name);
+      return ERROR;
+    }
+
+  /* The timed passes */
+
+  start = netbench_nsec();
+  for (i = 0; i < iterations; i++)
+    {
+      if (test->run() < 0)
+        {
+          printf("%-10s failed\n", test->name);
+          return ERROR;
+        }
+    }
+
+  nsecs     = netbench_nsec() - start;
+  nsperbyte = (double)nsecs / ((double)iterations * g_corpuslen);
+
+  printf("%-10s %8lu %6d %10.3f ", test->name, (unsigned long)g_corpuslen,
+         iterations, (double)nsecs / iterations / 1000.0);
+
+  if (CONFIG_EXAMPLES_NETBENCH_CPUMHZ > 0)
+    {
+      printf("%8.2f ", nsperbyte * CONFIG_EXAMPLES_NETBENCH_CPUMHZ / 1000.0);
+    }
+  else
+    {
+      printf("%8s ", "-");
+    }
+
+  printf("%8.2f ", nsperbyte);
+  if (test->hooked)
+    {
+      printf("%8lu ", (unsigned long)g_nallocs);
+    }
+  else
+    {
+      printf("%8s ", "-");
+    }
+
+  printf("%8lu\n", g_heappeak - g_heapbase);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: netbench_showusage
+ ****************************************************************************/
+
+static void netbench_showusage(FAR const char *progname, int exitcode)
+{
+  int i;
+
+  fprintf(stderr, "USAGE: %s [-n <iterations>] [<test> ...]\n", progname);
+  fprintf(stderr, "\nWhere:\n");
+  fprintf(stderr, "\t-n <iterations>: Timed operations per test.  "
+                  "Default: %d\n", CONFIG_EXAMPLES_NETBENCH_ITERATIONS);
+  fprintf(stderr, "\t<test>: Run only the named tests:");
+  for (i = 0; g_tests[i].name != NULL; i++)
+    {
+      fprintf(stderr, " %s", g_tests[i].name);
+    }
+
+  fprintf(stderr, "\n\nEach line shows the corpus size, the time per "
+                  "operation, the cycles\n");
+  fprintf(stderr, "(with CONFIG_EXAMPLES_NETBENCH_CPUMHZ) and "
+                  "nanoseconds per byte, the\n");
+  fprintf(stderr, "allocations per operation where the parser has "
+                  "allocation hooks and\n");
+  fprintf(stderr, "the peak heap use above the start of the "
+                  "operation, in bytes.\n");
+  exit(exitcode);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: netbench_main
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int netbench_main(int argc, char *argv[])
+#endif
+{
+#ifdef CONFIG_NETUTILS_JSON
+  cJSON_Hooks hooks;
+#endif
+  int iterations = CONFIG_EXAMPLES_NETBENCH_ITERATIONS;
+  int nfailed = 0;
+  int option;
+  int i;
+  int j;
+
+  while ((option = getopt(argc, argv, ":hn:")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'h':
+            netbench_showusage(argv[0], EXIT_SUCCESS);
+            break;
+
+          case 'n':
+            iterations = atoi(optarg);
+            if (iterations < 1)
+              {
+                fprintf(stderr, "ERROR: Bad iteration count: %s\n", optarg);
+                netbench_showusage(argv[0], EXIT_FAILURE);
+              }
+            break;
+
+          case ':':
+            fprintf(stderr, "ERROR: Missing required argument\n");
+            netbench_showusage(argv[0], EXIT_FAILURE);
+            break;
+
+          case '?':
+          default:
+            fprintf(stderr, "ERROR: Unrecognized option\n");
+            netbench_showusage(argv[0], EXIT_FAILURE);
+            break;
+        }
+    }
+
+  g_corpus = (FAR char *)malloc(NETBENCH_BUFSIZE);
+  g_output = (FAR char *)malloc(NETBENCH_OUTSIZE);
+  if (g_corpus == NULL || g_output == NULL)
+    {
+      fprintf(stderr, "ERROR: Failed to allocate the corpus\n");
+      free(g_corpus);
+      free(g_output);
+      return EXIT_FAILURE;
+    }
+
+#ifdef CONFIG_NETUTILS_JSON
+  hooks.malloc_fn = netbench_json_malloc;
+  hooks.free_fn   = netbench_json_free;
+  cJSON_InitHooks(&hooks);
+#endif
+
+  printf("%-10s %8s %6s %10s %8s %8s %8s %8s\n", "Test", "Bytes", "Ops",
+         "us/op", "cyc/B", "ns/B", "Allocs", "HeapPeak");
+
+  for (i = 0; g_tests[i].name != NULL; i++)
+    {
+      for (j = optind; j < argc && strcmp(argv[j], g_tests[i].name) != 0;
+           j++)
+        {
+        }
+
+      if (optind < argc && j >= argc)
+        {
+          continue;
+        }
+
+      if (netbench_runtest(&g_tests[i], iterations) < 0)
+        {
+          nfailed++;
+        }
+    }
+
+#ifdef CONFIG_NETUTILS_JSON
+  cJSON_InitHooks(NULL);
+#endif
+
+  free(g_corpus);
+  free(g_output);
+  return nfailed > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,856 @@
+/****************************************************************************
+ * examples/netloop/lo_bench.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include <errno.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include "system/benchutil.h"
+
+#include "netloop.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_NETLOOP_BENCH_CONNS
+#  define CONFIG_EXAMPLES_NETLOOP_BENCH_CONNS 100
+#endif
+
+#ifndef CONFIG_EXAMPLES_NETLOOP_BENCH_COUNT
+#  define CONFIG_EXAMPLES_NETLOOP_BENCH_COUNT 1000
+#endif
+
+#ifndef CONFIG_EXAMPLES_NETLOOP_BENCH_MSGSIZES
+#  define CONFIG_EXAMPLES_NETLOOP_BENCH_MSGSIZES "1,16,64,256"
+#endif
+
+#ifndef CONFIG_EXAMPLES_NETLOOP_BENCH_BULK
+#  define CONFIG_EXAMPLES_NETLOOP_BENCH_BULK 256
+#endif
+
+#ifndef CONFIG_EXAMPLES_NETLOOP_BENCH_IOSIZES
+#  define CONFIG_EXAMPLES_NETLOOP_BENCH_IOSIZES "64,256,1024,4096"
+#endif
+
+#ifndef CONFIG_EXAMPLES_NETLOOP_BENCH_BUFSIZES
+#  define CONFIG_EXAMPLES_NETLOOP_BENCH_BUFSIZES "0,2048,8192"
+#endif
+
+#define BENCH_PORT        (LISTENER_PORT + 1)
+#define BENCH_MAXSIZES    8
+#define BENCH_MAXIOSIZE   4096
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum lo_bench_mode_e
+{
+  BENCH_ACCEPT = 0,  /* Accept and close connections */
+  BENCH_ECHO,        /* Echo everything back on one connection */
+  BENCH_SINK         /* Swallow 'total' bytes, then send a one byte ack */
+};
+
+struct lo_bench_server_s
+{
+  enum lo_bench_mode_e mode;
+  int listensd;
+  int count;         /* BENCH_ACCEPT: Number of connections */
+  int bufsize;       /* BENCH_SINK: SO_RCVBUF of the accepted socket */
+  size_t total;      /* BENCH_SINK: Bytes per transfer */
+  int result;
+  uint8_t buffer[BENCH_MAXIOSIZE];
+
+  /* The client's I/O buffer, kept off the small stack of the main task */
+
+  uint8_t client[BENCH_MAXIOSIZE];
+};
+
+struct lo_bench_rtt_s
+{
+  uint32_t min;
+  uint32_t avg;
+  uint32_t max;
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void lo_bench_addr(FAR struct sockaddr_in *addr)
+{
+  memset(addr, 0, sizeof(*addr));
+  addr->sin_family      = AF_INET;
+  addr->sin_port        = htons(BENCH_PORT);
+  addr->sin_addr.s_addr = htonl(LO_ADDRESS);
+}
+
+static int lo_bench_parse(FAR const char *str, FAR int *values,
+                          int minval)
+{
+  FAR char *end;
+  long value;
+  int n = 0;
+
+  while (*str != '\0' && n < BENCH_MAXSIZES)
+    {
+      value = strtol(str, &end, 10);
+      if (end == str || value < minval || value > INT32_MAX)
+        {
+          return -EINVAL;
+        }
+
+      values[n++] = (int)value;
+      str = end;
+      if (*str == ',')
+        {
+          str++;
+        }
+      else if (*str != '\0')
+        {
+          return -EINVAL;
+        }
+    }
+
+  return n > 0 ? n : -EINVAL;
+}
+
+static int lo_bench_setbuf(int sd, int option, int bufsize)
+{
+  if (bufsize > 0 &&
+      setsockopt(sd, SOL_SOCKET, option, &bufsize, sizeof(int)) < 0)
+    {
+      return -errno;
+    }
+
+  return OK;
+}
+
+static int lo_bench_sendall(int sd, FAR const uint8_t *buf, size_t len)
+{
+  ssize_t nsent;
+  size_t done;
+
+  for (done = 0; done < len; done += nsent)
+    {
+      nsent = send(sd, &buf[done], len - done, 0);
+      if (nsent < 0)
+        {
+          return -errno;
+        }
+    }
+
+  return OK;
+}
+
+static int lo_bench_recvall(int sd, FAR uint8_t *buf, size_t len)
+{
+  ssize_t nrecvd;
+  size_t done;
+
+  for (done = 0; done < len; done += nrecvd)
+    {
+      nrecvd = recv(sd, &buf[done], len - done, 0);
+      if (nrecvd < 0)
+        {
+          return -errno;
+        }
+      else if (nrecvd == 0)
+        {
+          return -ENOTCONN;
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: lo_bench_server
+ *
+ * Description:
+ *   The far end of every TCP measurement.  In BENCH_ECHO and BENCH_SINK
+ *   mode the server handles one connection until the client closes it.
+ *
+ ****************************************************************************/
+
+static FAR void *lo_bench_server(FAR void *arg)
+{
+  FAR struct lo_bench_server_s *server = (FAR struct lo_bench_server_s *)arg;
+  ssize_t nrecvd;
+  size_t total;
+  int sd;
+  int i;
+
+  if (server->mode == BENCH_ACCEPT)
+    {
+      /* Close first and wait for the client's close, so that the client
+       * sees end-of-file before it opens the next connection.
+       */
+
+      for (i = 0; i < server->count; i++)
+        {
+          sd = accept(server->listensd, NULL, NULL);
+          if (sd < 0)
+            {
+              server->result = -errno;
+              return NULL;
+            }
+
+          close(sd);
+        }
+
+      return NULL;
+    }
+
+  sd = accept(server->listensd, NULL, NULL);
+  if (sd < 0)
+    {
+      server->result = -errno;
+      return NULL;
+    }
+
+  server->result = lo_bench_setbuf(sd, SO_RCVBUF, server->bufsize);
+
+  total = 0;
+  while (server->result >= 0)
+    {
+      nrecvd = recv(sd, server->buffer, BENCH_MAXIOSIZE, 0);
+      if (nrecvd < 0)
+        {
+          server->result = -errno;
+        }
+      else if (nrecvd == 0)
+        {
+          break;
+        }
+      else if (server->mode == BENCH_ECHO)
+        {
+          server->result = lo_bench_sendall(sd, server->buffer, nrecvd);
+        }
+      else if ((total += nrecvd) >= server->total)
+        {
+          total -= server->total;
+          server->result = lo_bench_sendall(sd, server->buffer, 1);
+        }
+    }
+
+  close(sd);
+  return NULL;
+}
+
+static int lo_bench_listen(FAR struct lo_bench_server_s *server,
+                           FAR pthread_t *tid)
+{
+  struct sockaddr_in addr;
+  int optval = 1;
+  int ret;
+
+  server->result   = OK;
+  server->listensd = socket(PF_INET, SOCK_STREAM, 0);
+  if (server->listensd < 0)
+    {
+      return -errno;
+    }
+
+  (void)setsockopt(server->listensd, SOL_SOCKET, SO_REUSEADDR, &optval,
+                   sizeof(int));
+
+  lo_bench_addr(&addr);
+  if (bind(server->listensd, (FAR struct sockaddr *)&addr,
+           sizeof(addr)) < 0 ||
+      listen(server->listensd, 5) < 0)
+    {
+      ret = -errno;
+      close(server->listensd);
+      return ret;
+    }
+
+  ret = pthread_create(tid, NULL, lo_bench_server, server);
+  if (ret != 0)
+    {
+      close(server->listensd);
+      return -ret;
+    }
+
+  return OK;
+}
+
+static int lo_bench_connect(int bufsize)
+{
+  struct sockaddr_in addr;
+  int ret;
+  int sd;
+
+  sd = socket(PF_INET, SOCK_STREAM, 0);
+  if (sd < 0)
+    {
+      return -errno;
+    }
+
+  ret = lo_bench_setbuf(sd, SO_SNDBUF, bufsize);
+  if (ret >= 0)
+    {
+      lo_bench_addr(&addr);
+      if (connect(sd, (FAR struct sockaddr *)&addr, sizeof(addr)) < 0)
+        {
+          ret = -errno;
+        }
+    }
+
+  if (ret < 0)
+    {
+      close(sd);
+      return ret;
+    }
+
+  return sd;
+}
+
+/* Wait for the server thread.  If the client failed first, the server may
+ * still be blocked in accept(); a connection attempt releases it.
+ */
+
+static int lo_bench_finish(FAR struct lo_bench_server_s *server,
+                           pthread_t tid, int ret)
+{
+  int sd;
+
+  if (ret < 0)
+    {
+      server->count = 0;
+      sd = lo_bench_connect(0);
+      if (sd >= 0)
+        {
+          close(sd);
+        }
+    }
+
+  pthread_join(tid, NULL);
+  close(server->listensd);
+  return ret < 0 ? ret : server->result;
+}
+
+/****************************************************************************
+ * Name: lo_bench_accept
+ *
+ * Description:
+ *   Measure the cost of a complete TCP connection setup and teardown.
+ *
+ ****************************************************************************/
+
+static int lo_bench_accept(FAR struct lo_bench_server_s *server, int count)
+{
+  pthread_t tid;
+  uint64_t start;
+  uint64_t elapsed;
+  uint8_t ch;
+  int ret;
+  int sd;
+  int i;
+
+  server->mode  = BENCH_ACCEPT;
+  server->count = count;
+
+  ret = lo_bench_listen(server, &tid);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  start = benchutil_usec();
+  for (i = 0; i < count; i++)
+    {
+      sd = lo_bench_connect(0);
+      if (sd < 0)
+        {
+          ret = sd;
+          break;
+        }
+
+      /* Wait for the server to close its end */
+
+      ret = recv(sd, &ch, 1, 0) < 0 ? -errno : OK;
+      close(sd);
+      if (ret < 0)
+        {
+          break;
+        }
+    }
+
+  elapsed = benchutil_usec() - start;
+  ret = lo_bench_finish(server, tid, ret);
+  if (ret < 0)
+    {
+      printf("connect/accept: failed after %d connections: %d\n", i, ret);
+      return ret;
+    }
+
+  printf("connect/accept: %d connections in %lu ms, %lu conn/s, "
+         "%lu us each\n", count, (unsigned long)(elapsed / 1000),
+         (unsigned long)((uint64_t)count * 1000000 / (elapsed + 1)),
+         (unsigned long)(elapsed / count));
+  return OK;
+}
+
+static void lo_bench_rttadd(FAR struct lo_bench_rtt_s *rtt, uint64_t start,
+                            FAR uint64_t *total)
+{
+  uint32_t elapsed = (uint32_t)(benchutil_usec() - start);
+
+  if (elapsed < rtt->min)
+    {
+      rtt->min = elapsed;
+    }
+
+  if (elapsed > rtt->max)
+    {
+      rtt->max = elapsed;
+    }
+
+  *total += elapsed;
+}
+
+/****************************************************************************
+ * Name: lo_bench_tcprtt
+ *
+ * Description:
+ *   Ping-pong small messages over one TCP connection.
+ *
+ ****************************************************************************/
+
+static int lo_bench_tcprtt(FAR struct lo_bench_server_s *server, int size,
+                           int count, FAR struct lo_bench_rtt_s *rtt)
+{
+  FAR uint8_t *buf = server->client;
+  pthread_t tid;
+  uint64_t start;
+  uint64_t total = 0;
+  int ret;
+  int sd;
+  int i;
+
+  server->mode    = BENCH_ECHO;
+  server->bufsize = 0;
+
+  ret = lo_bench_listen(server, &tid);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  sd = lo_bench_connect(0);
+  if (sd < 0)
+    {
+      return lo_bench_finish(server, tid, sd);
+    }
+
+  memset(buf, 0xa5, size);
+  rtt->min = UINT32_MAX;
+  rtt->max = 0;
+
+  for (i = 0; i < count; i++)
+    {
+      start = benchutil_usec();
+      ret = lo_bench_sendall(sd, buf, size);
+      if (ret >= 0)
+        {
+          ret = lo_bench_recvall(sd, buf, size);
+        }
+
+      if (ret < 0)
+        {
+          break;
+        }
+
+      lo_bench_rttadd(rtt, start, &total);
+    }
+
+  close(sd);
+  rtt->avg = (uint32_t)(total / count);
+  return lo_bench_finish(server, tid, ret);
+}
+
+#ifdef CONFIG_NET_UDP
+/****************************************************************************
+ * Name: lo_bench_udprtt
+ *
+ * Description:
+ *   Ping-pong small datagrams between two bound UDP sockets.  The echo
+ *   side is a second socket in the same task, served in the same loop, so
+ *   no thread switch is involved on the application side.
+ *
+ ****************************************************************************/
+
+static int lo_bench_udprtt(FAR struct lo_bench_server_s *server, int size,
+                           int count, FAR struct lo_bench_rtt_s *rtt)
+{
+  FAR uint8_t *buf = server->client;
+  struct sockaddr_in addr[2];
+  uint64_t start;
+  uint64_t total = 0;
+  int sd[2];
+  int ret = OK;
+  int i;
+
+  for (i = 0; i < 2; i++)
+    {
+      lo_bench_addr(&addr[i]);
+      addr[i].sin_port = htons(BENCH_PORT + i);
+
+      sd[i] = socket(PF_INET, SOCK_DGRAM, 0);
+      if (sd[i] < 0 ||
+          bind(sd[i], (FAR struct sockaddr *)&addr[i], sizeof(addr[i])) < 0)
+        {
+          ret = -errno;
+          if (sd[i] >= 0)
+            {
+              close(sd[i]);
+            }
+
+          if (i > 0)
+            {
+              close(sd[0]);
+            }
+
+          return ret;
+        }
+    }
+
+  memset(buf, 0x5a, size);
+  rtt->min = UINT32_MAX;
+  rtt->max = 0;
+
+  for (i = 0; i < count && ret >= 0; i++)
+    {
+      start = benchutil_usec();
+      if (sendto(sd[0], buf, size, 0, (FAR struct sockaddr *)&addr[1],
+                 sizeof(addr[1])) < 0 ||
+          recv(sd[1], buf, size, 0) < 0 ||
+          sendto(sd[1], buf, size, 0, (FAR struct sockaddr *)&addr[0],
+                 sizeof(addr[0])) < 0 ||
+          recv(sd[0], buf, size, 0) < 0)
+        {
+          ret = -errno;
+          break;
+        }
+
+      lo_bench_rttadd(rtt, start, &total);
+    }
+
+  close(sd[0]);
+  close(sd[1]);
+  rtt->avg = (uint32_t)(total / count);
+  return ret;
+}
+#endif
+
+/****************************************************************************
+ * Name: lo_bench_bulk
+ *
+ * Description:
+ *   Send 'total' bytes in 'iosize' writes with the given SO_SNDBUF on the
+ *   client and SO_RCVBUF on the server (zero leaves the defaults).  Returns
+ *   the throughput in Kbytes per second.
+ *
+ ****************************************************************************/
+
+static int lo_bench_bulk(FAR struct lo_bench_server_s *server, int bufsize,
+                         int iosize, size_t total)
+{
+  FAR uint8_t *buf = server->client;
+  pthread_t tid;
+  uint64_t start;
+  uint64_t elapsed;
+  size_t done;
+  size_t len;
+  int ret;
+  int sd;
+
+  server->mode    = BENCH_SINK;
+  server->bufsize = bufsize;
+  server->total   = total;
+
+  ret = lo_bench_listen(server, &tid);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  sd = lo_bench_connect(bufsize);
+  if (sd < 0)
+    {
+      return lo_bench_finish(server, tid, sd);
+    }
+
+  memset(buf, 0x3c, iosize);
+  start = benchutil_usec();
+
+  for (done = 0, ret = OK; done < total && ret >= 0; done += len)
+    {
+      len = total - done < (size_t)iosize ? total - done : (size_t)iosize;
+      ret = lo_bench_sendall(sd, buf, len);
+    }
+
+  if (ret >= 0)
+    {
+      ret = lo_bench_recvall(sd, buf, 1);
+    }
+
+  elapsed = benchutil_usec() - start;
+  close(sd);
+
+  ret = lo_bench_finish(server, tid, ret);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  return (int)((uint64_t)total * 1000000 / ((elapsed + 1) * 1024));
+}
+
+static void lo_bench_usage(FAR const char *progname)
+{
+  fprintf(stderr, "USAGE: %s -b [-c conns] [-n count] [-m sizes] "
+          "[-k kbytes] [-i sizes] [-w bufsizes]\n", progname);
+  fprintf(stderr, "  -c: Connections to set up.  Default: %d\n",
+          CONFIG_EXAMPLES_NETLOOP_BENCH_CONNS);
+  fprintf(stderr, "  -n: Round trips per size.  Default: %d\n",
+          CONFIG_EXAMPLES_NETLOOP_BENCH_COUNT);
+  fprintf(stderr, "  -m: Round trip message sizes.  Default: %s\n",
+          CONFIG_EXAMPLES_NETLOOP_BENCH_MSGSIZES);
+  fprintf(stderr, "  -k: Kbytes per bulk transfer.  Default: %d\n",
+          CONFIG_EXAMPLES_NETLOOP_BENCH_BULK);
+  fprintf(stderr, "  -i: Bulk write sizes.  Default: %s\n",
+          CONFIG_EXAMPLES_NETLOOP_BENCH_IOSIZES);
+  fprintf(stderr, "  -w: SO_SNDBUF/SO_RCVBUF sizes, 0 is the default.  "
+          "Default: %s\n", CONFIG_EXAMPLES_NETLOOP_BENCH_BUFSIZES);
+  fprintf(stderr, "Sizes are comma separated lists of up to %d values "
+          "no larger than %d\n", BENCH_MAXSIZES, BENCH_MAXIOSIZE);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: lo_bench
+ *
+ * Description:
+ *   Measure the overhead of the TCP and UDP layers over the loopback
+ *   device, where no network driver is involved.
+ *
+ ****************************************************************************/
+
+int lo_bench(int argc, FAR char *argv[])
+{
+  FAR struct lo_bench_server_s *server;
+  struct lo_bench_rtt_s rtt;
+  int msgsizes[BENCH_MAXSIZES];
+  int iosizes[BENCH_MAXSIZES];
+  int bufsizes[BENCH_MAXSIZES];
+  int nmsgsizes;
+  int niosizes;
+  int nbufsizes;
+  int conns = CONFIG_EXAMPLES_NETLOOP_BENCH_CONNS;
+  int count = CONFIG_EXAMPLES_NETLOOP_BENCH_COUNT;
+  int bulk = CONFIG_EXAMPLES_NETLOOP_BENCH_BULK;
+  int ret;
+  int i;
+  int j;
+
+  nmsgsizes = lo_bench_parse(CONFIG_EXAMPLES_NETLOOP_BENCH_MSGSIZES,
+                             msgsizes, 1);
+  niosizes  = lo_bench_parse(CONFIG_EXAMPLES_NETLOOP_BENCH_IOSIZES,
+                             iosizes, 1);
+  nbufsizes = lo_bench_parse(CONFIG_EXAMPLES_NETLOOP_BENCH_BUFSIZES,
+                             bufsizes, 0);
+
+  for (i = 2; i < argc; i++)
+    {
+      if (i + 1 >= argc || argv[i][0] != '-' || argv[i][2] != '\0')
+        {
+          lo_bench_usage(argv[0]);
+          return EXIT_FAILURE;
+        }
+
+      switch (argv[i++][1])
+        {
+          case 'c':
+            conns = atoi(argv[i]);
+            break;
+
+          case 'n':
+            count = atoi(argv[i]);
+            break;
+
+          case 'k':
+            bulk = atoi(argv[i]);
+            break;
+
+          case 'm':
+            nmsgsizes = lo_bench_parse(argv[i], msgsizes, 1);
+            break;
+
+          case 'i':
+            niosizes = lo_bench_parse(argv[i], iosizes, 1);
+            break;
+
+          case 'w':
+            nbufsizes = lo_bench_parse(argv[i], bufsizes, 0);
+            break;
+
+          default:
+            lo_bench_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+  for (i = 0; i < nmsgsizes; i++)
+    {
+      if (msgsizes[i] > BENCH_MAXIOSIZE)
+        {
+          nmsgsizes = -EINVAL;
+        }
+    }
+
+  for (i = 0; i < niosizes; i++)
+    {
+      if (iosizes[i] > BENCH_MAXIOSIZE)
+        {
+          niosizes = -EINVAL;
+        }
+    }
+
+  if (nmsgsizes < 0 || niosizes < 0 || nbufsizes < 0 || conns < 1 ||
+      count < 1 || bulk < 1)
+    {
+      lo_bench_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+
+  server = (FAR struct lo_bench_server_s *)malloc(sizeof(*server));
+  if (server == NULL)
+    {
+      printf("lo_bench: Failed to allocate the server state\n");
+      return EXIT_FAILURE;
+    }
+
+  (void)lo_bench_accept(server, conns);
+
+  printf("\n%-6s %6s %10s %10s %10s\n",
+         "RTT", "Size", "min (us)", "avg (us)", "max (us)");
+
+  for (i = 0; i < nmsgsizes; i++)
+    {
+      ret = lo_bench_tcprtt(server, msgsizes[i], count, &rtt);
+      if (ret < 0)
+        {
+          printf("%-6s %6d   failed: %d\n", "tcp", msgsizes[i], ret);
+        }
+      else
+        {
+          printf("%-6s %6d %10lu %10lu %10lu\n", "tcp", msgsizes[i],
+                 (unsigned long)rtt.min, (unsigned long)rtt.avg,
+                 (unsigned long)rtt.max);
+        }
+
+#ifdef CONFIG_NET_UDP
+      ret = lo_bench_udprtt(server, msgsizes[i], count, &rtt);
+      if (ret < 0)
+        {
+          printf("%-6s %6d   failed: %d\n", "udp", msgsizes[i], ret);
+        }
+      else
+        {
+          printf("%-6s %6d %10lu %10lu %10lu\n", "udp", msgsizes[i],
+                 (unsigned long)rtt.min, (unsigned long)rtt.avg,
+                 (unsigned long)rtt.max);
+        }
+#endif
+    }
+
+  printf("\nBulk TCP, %d KB per transfer, KB/s\n%-8s", bulk, "Buffer");
+  for (j = 0; j < niosizes; j++)
+    {
+      printf(" %7dB", iosizes[j]);
+    }
+
+  printf("\n");
+
+  for (i = 0; i < nbufsizes; i++)
+    {
+      if (bufsizes[i] > 0)
+        {
+          printf("%-8d", bufsizes[i]);
+        }
+      else
+        {
+          printf("%-8s", "default");
+        }
+
+      for (j = 0; j < niosizes; j++)
+        {
+          ret = lo_bench_bulk(server, bufsizes[i], iosizes[j],
+                              (size_t)bulk * 1024);
+          /* A failed transfer shows up as a negated errno */
+
+          printf(" %8d", ret);
+        }
+
+      printf("\n");
+    }
+
+  free(server);
+  return EXIT_SUCCESS;
+}
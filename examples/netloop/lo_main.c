@@ -192,6 +192,13 @@ int netloop_main(int argc, char *argv[])
   pthread_t tid;
   int ret;
 
+#ifdef CONFIG_EXAMPLES_NETLOOP_BENCH
+  if (argc > 1 && strcmp(argv[1], "-b") == 0)
+    {
+      return lo_bench(argc, argv);
+    }
+#endif
+
   /* Start the listeners */
 
   printf("netloop_main: Starting lo_listener thread\n");
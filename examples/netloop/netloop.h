@@ -96,4 +96,8 @@
 
 void *lo_listener(pthread_addr_t pvarg);
 
+#ifdef CONFIG_EXAMPLES_NETLOOP_BENCH
+int lo_bench(int argc, FAR char *argv[]);
+#endif
+
 #endif /* __APPS_EXAMPLES_NETLOOP_NETLOOP_H */
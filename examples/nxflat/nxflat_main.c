@@ -41,6 +41,8 @@
 #include <nuttx/compiler.h>
 
 #include <sys/mount.h>
+#include <sys/wait.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -48,6 +50,7 @@
 #include <pthread.h>
 #include <debug.h>
 #include <errno.h>
+#include <time.h>
 
 #include <nuttx/symtab.h>
 #include <nuttx/drivers/ramdisk.h>
@@ -96,6 +99,16 @@
 #define ROMFSDEV     "/dev/ram0"
 #define MOUNTPT      "/mnt/romfs"
 
+#ifdef CONFIG_EXAMPLES_NXFLAT_BENCH
+#  ifdef CONFIG_CLOCK_MONOTONIC
+#    define BENCH_CLOCK CLOCK_MONOTONIC
+#  else
+#    define BENCH_CLOCK CLOCK_REALTIME
+#  endif
+
+#  define NPROGRAMS ((int)(sizeof(dirlist) / sizeof(dirlist[0])) - 1)
+#endif
+
 /* If CONFIG_DEBUG_FEATURES is enabled, use info/err instead of printf so
  * that the output will be synchronous with the debug output.
  */
@@ -124,6 +137,19 @@
 #  endif
 #endif
 
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_NXFLAT_BENCH
+struct bench_s
+{
+  uint32_t load_us;  /* Time spent in exec() */
+  int running;       /* Heap increase while the program runs */
+  int retained;      /* Heap increase after the program exited */
+};
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -135,6 +161,10 @@ static const char delimiter[] =
 static char fullpath[128];
 #endif
 
+#ifdef CONFIG_EXAMPLES_NXFLAT_BENCH
+static struct bench_s g_bench[NPROGRAMS];
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -148,6 +178,68 @@ static inline void testheader(FAR const char *progname)
   message("\n%s\n* Executing %s\n%s\n\n", delimiter, progname, delimiter);
 }
 
+/****************************************************************************
+ * Name: nxflat_bench_now, nxflat_bench_heap and nxflat_bench_report
+ *
+ * Description:
+ *   Record the cost of loading each program:  The time that exec() takes
+ *   to load, relocate and start the NxFLAT program, the heap that is in
+ *   use while it runs and the heap that is still in use after it exits.
+ *   The .text of an NxFLAT program executes in place from ROMFS, so only
+ *   its data, bss and stack show up as RAM.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_EXAMPLES_NXFLAT_BENCH
+static uint32_t nxflat_bench_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(BENCH_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int nxflat_bench_heap(void)
+{
+  struct mallinfo mmcurrent;
+
+#ifdef CONFIG_CAN_PASS_STRUCTS
+  mmcurrent = mallinfo();
+#else
+  (void)mallinfo(&mmcurrent);
+#endif
+
+  return mmcurrent.uordblks;
+}
+
+static void nxflat_bench_report(void)
+{
+  uint32_t load_us = 0;
+  int running = 0;
+  int retained = 0;
+  int i;
+
+  message("\nNxFLAT load benchmark:\n");
+  message("  %-16s %10s %12s %12s\n", "Program", "Load (us)",
+          "RAM running", "RAM retained");
+
+  for (i = 0; i < NPROGRAMS; i++)
+    {
+      message("  %-16s %10lu %12d %12d\n", dirlist[i],
+              (unsigned long)g_bench[i].load_us, g_bench[i].running,
+              g_bench[i].retained);
+
+      load_us  += g_bench[i].load_us;
+      running  += g_bench[i].running;
+      retained += g_bench[i].retained;
+    }
+
+  message("  %-16s %10lu %12d %12d\n", "Average",
+          (unsigned long)(load_us / NPROGRAMS), running / NPROGRAMS,
+          retained / NPROGRAMS);
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -163,6 +255,13 @@ int nxflat_main(int argc, char *argv[])
 #endif
 {
   FAR char *args[1];
+#ifdef CONFIG_EXAMPLES_NXFLAT_BENCH
+  uint32_t start;
+#  ifdef CONFIG_SCHED_WAITPID
+  int status;
+#  endif
+  int heap;
+#endif
   int ret;
   int i;
 
@@ -233,18 +332,41 @@ int nxflat_main(int argc, char *argv[])
        */
 
       args[0] = NULL;
+#ifdef CONFIG_EXAMPLES_NXFLAT_BENCH
+      heap  = nxflat_bench_heap();
+      start = nxflat_bench_now();
+#endif
       ret = exec(filename, args, exports, NEXPORTS);
+#ifdef CONFIG_EXAMPLES_NXFLAT_BENCH
+      g_bench[i].load_us = nxflat_bench_now() - start;
+      g_bench[i].running = nxflat_bench_heap() - heap;
+#endif
       if (ret < 0)
         {
           errmsg("ERROR: exec(%s) failed: %d\n", dirlist[i], errno);
         }
       else
         {
+#if defined(CONFIG_EXAMPLES_NXFLAT_BENCH) && defined(CONFIG_SCHED_WAITPID)
+          /* Wait for the exit so that the retained memory is accurate */
+
+          message("Wait for test completion\n");
+          (void)waitpid(ret, &status, 0);
+#else
           message("Wait a bit for test completion\n");
           sleep(4);
+#endif
         }
+
+#ifdef CONFIG_EXAMPLES_NXFLAT_BENCH
+      g_bench[i].retained = nxflat_bench_heap() - heap;
+#endif
     }
 
+#ifdef CONFIG_EXAMPLES_NXFLAT_BENCH
+  nxflat_bench_report();
+#endif
+
   message("End-of-Test.. Exit-ing\n");
   return 0;
 }
@@ -17,7 +17,10 @@ if [ ! -d "$dir" ]; then
 	exit 1
 fi
 
-varlist=`find $dir -name "*-thunk.S"| xargs grep -h asciz | cut -f3 | sort | uniq`
+# The thunk names are sorted in strcmp() order so that the table also works
+# with the binary search of CONFIG_SYMTAB_ORDEREDBYNAME.
+
+varlist=`find $dir -name "*-thunk.S"| xargs grep -h asciz | cut -f3 | LC_ALL=C sort -u`
 
 echo "#ifndef __EXAMPLES_NXFLAT_TESTS_SYMTAB_H"
 echo "#define __EXAMPLES_NXFLAT_TESTS_SYMTAB_H"
@@ -216,6 +216,8 @@ void nximage_image(NXWINDOW hwnd);
 
 nxgl_mxpixel_t nximage_bgcolor(void);
 nxgl_mxpixel_t nximage_avgcolor(nxgl_mxpixel_t color1, nxgl_mxpixel_t color2);
-void nximage_blitrow(FAR nxgl_mxpixel_t *run, FAR const void **state);
+void nximage_avgrow(FAR nxgl_mxpixel_t *row0, FAR const nxgl_mxpixel_t *row1,
+                    unsigned int npixels);
+void nximage_blitrow(FAR nxgl_mxpixel_t *run, unsigned int row);
 
 #endif /* __APPS_EXAMPLES_NXIMAGE_NXIMAGE_H */
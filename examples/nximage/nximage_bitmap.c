@@ -45,6 +45,7 @@
 #include <nuttx/nx/nx.h>
 #include <nuttx/nx/nxglib.h>
 
+#include "graphics/blit.h"
 #include "nximage.h"
 
 /********************************************************************************************
@@ -79,16 +80,6 @@
 #  error "Unsupported pixel format"
 #endif
 
-/********************************************************************************************
- * Private Types
- ********************************************************************************************/
-
-struct pix_run_s
-{
-  uint8_t npix;  /* Number of pixels */
-  uint8_t code;  /* Pixel RGB code */
-};
-
 /********************************************************************************************
  * Private Data
  ********************************************************************************************/
@@ -185,3275 +176,3035 @@ static const nxgl_mxpixel_t g_lut[IMAGE_NLUTCODES] =
 
 #if CONFIG_EXAMPLES_NXIMAGE_BPP == 24
 
-static const struct pix_run_s g_nuttx[] =
+static const uint8_t g_nuttx_data[] =
 {
-  { 76,   0}, {  1,   1}, {  1,   2}, {  1,   3}, {  4,   4}, {  1,   5}, { 76,   0},              /* Row 0 */
-  { 75,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  2,   7}, {  3,   4}, {  1,   5},  /* Row 1 */
-  { 75,   0},
-  { 74,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,   9}, {  1,  10},  /* Row 2 */
-  {  1,   7}, {  3,   4}, {  1,   5}, { 74,   0},
-  { 73,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  12},  /* Row 3 */
-  {  1,  13}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 73,   0},
-  { 72,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 4 */
-  {  1,   6}, {  1,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 72,   0},
-  { 71,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 5 */
-  {  1,   6}, {  3,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 71,   0},
-  { 70,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 6 */
-  {  1,   6}, {  5,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 70,   0},
-  { 69,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 7 */
-  {  1,   6}, {  7,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 69,   0},
-  { 68,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 8 */
-  {  1,   6}, {  9,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 68,   0},
-  { 67,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 9 */
-  {  1,   6}, { 11,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 67,   0},
-  { 66,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 10 */
-  {  1,   6}, { 13,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 66,   0},
-  { 65,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 11 */
-  {  1,   6}, { 15,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 65,   0},
-  { 64,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 12 */
-  {  1,   6}, { 17,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 64,   0},
-  { 63,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 13 */
-  {  1,   6}, { 19,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 63,   0},
-  { 62,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 14 */
-  {  1,   6}, { 21,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 62,   0},
-  { 61,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 15 */
-  {  1,   6}, { 23,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 61,   0},
-  { 60,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 16 */
-  {  1,   6}, { 25,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 60,   0},
-  { 59,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 17 */
-  {  1,   6}, { 27,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 59,   0},
-  { 58,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 18 */
-  {  1,   6}, { 29,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 26,   0},
-  {  1,  17}, {  5,  18}, {  1,  17}, { 25,   0},
-  { 57,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 19 */
-  {  1,   6}, { 10,   4}, {  5,  19}, { 16,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4},
-  {  1,   5}, { 23,   0}, {  1,  20}, {  1,  18}, {  1,  21}, {  5,  18}, {  1,  21}, {  1,  18},
-  {  1,  20}, { 23,   0},
-  { 56,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},  /* Row 20 */
-  {  1,   6}, {  9,   4}, {  1,  19}, {  1,  22}, {  1,  23}, {  3,  24}, {  1,  23}, {  1,  22},
-  {  1,  25}, { 15,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 22,   0},
-  { 11,  18}, {  1,  20}, { 22,   0},
-  { 23,   0}, {  1,  17}, {  5,  18}, {  1,  26}, { 25,   0}, {  1,   1}, {  1,   2}, {  1,   6},  /* Row 21 */
-  {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  9,   4}, {  1,  19}, {  1,  27},
-  {  1,  21}, {  5,  18}, {  1,  21}, {  1,  23}, {  1,  28}, { 15,   4}, {  1,  16}, {  1,  14},
-  {  1,   7}, {  3,   4}, {  1,   5}, { 20,   0}, {  1,  17}, {  1,  21}, { 11,  18}, {  1,  20},
-  { 21,   0},
-  { 21,   0}, {  1,  20}, {  1,  18}, {  1,  21}, {  5,  18}, {  1,  21}, {  1,  18}, {  1,  20},  /* Row 22 */
-  { 22,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15},
-  {  1,   6}, {  9,   4}, {  1,  19}, {  1,  27}, {  1,  21}, {  8,  18}, {  1,  29}, {  1,  28},
-  {  4,   7}, { 11,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 19,   0},
-  { 14,  18}, { 21,   0},
-  { 21,   0}, { 11,  18}, {  1,  20}, { 20,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4},  /* Row 23 */
-  {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, { 10,   4}, {  1,  22}, {  1,  21}, { 10,  18},
-  {  1,  30}, {  1,  31}, {  1,  32}, {  1,  33}, {  1,  34}, {  1,  35}, {  1,   7}, { 10,   4},
-  {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 17,   0}, {  1,  17}, {  1,  21},
-  {  4,  18}, {  1,  36}, {  2,  37}, {  1,  36}, {  4,  18}, {  1,  21}, {  1,  17}, { 20,   0},
-  { 20,   0}, {  1,  38}, {  1,  21}, { 11,  18}, {  1,  39}, {  4,  40}, {  1,  41}, { 13,   0},  /* Row 24 */
-  {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6},
-  { 10,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  3,  36}, {  5,  18}, {  1,  42}, {  1,  43},
-  {  3,  44}, {  1,  45}, {  1,   7}, { 10,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4},
-  {  1,   5}, { 16,   0}, {  5,  18}, {  1,  37}, {  4,  46}, {  1,  37}, {  4,  18}, {  1,  47},
-  {  1,  48}, {  1,  49}, { 18,   0},
-  { 19,   0}, {  1,  17}, {  1,  21}, { 12,  18}, {  1,  50}, {  1,  48}, {  3,  40}, {  1,  51},  /* Row 25 */
-  {  1,  40}, { 11,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11},
-  {  1,  15}, {  1,   6}, { 11,   4}, {  1,  52}, {  1,  21}, {  3,  18}, {  1,  37}, {  3,  46},
-  {  1,  37}, {  4,  18}, {  1,  21}, {  1,  53}, {  4,  44}, {  1,  45}, {  1,   7}, { 10,   4},
-  {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 14,   0}, {  1,  17}, {  1,  21},
-  {  3,  18}, {  1,  54}, {  6,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  55}, {  1,  40},
-  {  1,  49}, { 17,   0},
-  { 19,   0}, {  5,  18}, {  1,  54}, {  2,  56}, {  1,  37}, {  5,  18}, {  1,  21}, {  1,  57},  /* Row 26 */
-  {  4,  40}, {  1,  51}, {  1,  41}, {  9,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4},
-  {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, { 11,   4}, {  1,  58}, {  1,  59}, {  3,  18},
-  {  1,  21}, {  1,  60}, {  4,  46}, {  1,  37}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44},
-  {  1,  45}, {  1,   7}, { 10,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5},
-  { 13,   0}, {  5,  18}, {  1,  56}, {  6,  46}, {  1,  56}, {  4,  18}, {  1,  57}, {  2,  40},
-  {  1,  49}, { 16,   0},
-  { 18,   0}, {  1,  17}, {  1,  21}, {  3,  18}, {  1,  37}, {  4,  46}, {  1,  37}, {  5,  18},  /* Row 27 */
-  {  1,  50}, {  1,  48}, {  5,  40}, {  8,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4},
-  {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, { 12,   4}, {  1,  19}, {  1,  24}, {  3,  18},
-  {  1,  37}, {  6,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35},
-  { 11,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, { 11,   0}, {  1,  17},
-  {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  57}, {  3,  40},
-  { 16,   0},
-  { 18,   0}, {  4,  18}, {  1,  54}, {  5,  46}, {  1,  60}, {  1,  36}, {  4,  18}, {  1,  21},  /* Row 28 */
-  {  1,  57}, {  4,  40}, {  1,  51}, {  1,  41}, {  6,   0}, {  1,   1}, {  1,   2}, {  1,   6},
-  {  1,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, { 13,   4}, {  1,  19}, {  1,  24},
-  {  3,  18}, {  1,  61}, {  6,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44},
-  {  1,  34}, {  1,  62}, { 11,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5},
-  { 10,   0}, {  5,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  55},
-  {  2,  40}, {  1,  51}, {  1,  41}, { 15,   0},
-  { 18,   0}, {  4,  18}, {  1,  56}, {  6,  46}, {  1,  56}, {  5,  18}, {  1,  50}, {  1,  48},  /* Row 29 */
-  {  5,  40}, {  5,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11},
-  {  1,  15}, {  1,   6}, { 14,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46},
-  {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 12,   4}, {  1,  16},
-  {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, {  8,   0}, {  1,  17}, {  1,  21}, {  3,  18},
-  {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  50}, {  1,  48}, {  4,  40}, { 15,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  57},  /* Row 30 */
-  {  4,  40}, {  1,  51}, {  1,  41}, {  3,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4},
-  {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, { 15,   4}, {  1,  19}, {  1,  24}, {  2,  18},
-  {  1,  36}, {  8,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34},
-  {  1,  62}, { 12,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, {  7,   0},
-  {  5,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  57}, {  5,  40},
-  {  1,  63}, { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  56}, {  5,  18}, {  1,  50}, {  1,  48},  /* Row 31 */
-  {  5,  40}, {  2,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11},
-  {  1,  15}, {  1,   6}, { 16,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  9,  46},
-  {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 13,   4}, {  1,  16},
-  {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, {  5,   0}, {  1,  17}, {  1,  21}, {  3,  18},
-  {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  50}, {  1,  48}, {  5,  40}, {  1,  41},
-  { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  9,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  57},  /* Row 32 */
-  {  4,  40}, {  1,  51}, {  1,  41}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   4}, {  1,   8},
-  {  1,  11}, {  1,  15}, {  1,   6}, { 17,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36},
-  {  9,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62},
-  { 13,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, {  4,   0}, {  5,  18},
-  {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  57}, {  6,  40}, {  1,  63},
-  { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  9,  46}, {  1,  56}, {  5,  18}, {  1,  50}, {  1,  48},  /* Row 33 */
-  {  3,  40}, {  1,  64}, {  1,  65}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   8}, {  1,  11},
-  {  1,  15}, {  1,   6}, { 18,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, { 10,  46},
-  {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 14,   4}, {  1,  16},
-  {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, {  2,   0}, {  1,  17}, {  1,  21}, {  3,  18},
-  {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  50}, {  1,  48}, {  6,  40}, { 15,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, { 10,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  57},  /* Row 34 */
-  {  2,  40}, {  1,  64}, {  1,  66}, {  1,  67}, {  1,  68}, {  1,   4}, {  1,   8}, {  1,  11},
-  {  1,  15}, {  1,   6}, { 19,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, { 10,  46},
-  {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, { 14,   4},
-  {  1,  16}, {  1,  14}, {  1,   7}, {  3,   4}, {  1,   5}, {  1,   0}, {  5,  18}, {  1,  56},
-  {  7,  46}, {  1,  54}, {  3,  18}, {  1,  69}, {  1,  70}, {  5,  40}, {  1,  51}, {  1,  41},
-  { 15,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, { 10,  46}, {  1,  56}, {  5,  18}, {  1,  50}, {  1,  48},  /* Row 35 */
-  {  1,  64}, {  1,  66}, {  1,  67}, {  1,  44}, {  1,  34}, {  1,  71}, {  1,  11}, {  1,  15},
-  {  1,   6}, { 20,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, { 11,  46}, {  1,  54},
-  {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 15,   4}, {  1,  16}, {  1,  14},
-  {  1,   7}, {  3,   4}, {  1,  72}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56},
-  {  4,  18}, {  1,  50}, {  1,  73}, {  6,  40}, { 16,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, { 11,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  57},  /* Row 36 */
-  {  1,  74}, {  1,  67}, {  3,  44}, {  1,  75}, {  1,  76}, {  1,   6}, { 21,   4}, {  1,  19},
-  {  1,  24}, {  2,  18}, {  1,  36}, { 11,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43},
-  {  4,  44}, {  1,  34}, {  1,  62}, { 15,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  1,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  57}, {  5,  40}, {  1,  51}, {  1,  41}, { 16,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, { 11,  46}, {  1,  56}, {  5,  18}, {  1,  77}, {  1,  78},  /* Row 37 */
-  {  4,  44}, {  1,  79}, {  1,  80}, { 22,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36},
-  { 12,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 16,   4},
-  {  1,  16}, {  1,  14}, {  1,   7}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46},
-  {  1,  56}, {  4,  18}, {  1,  50}, {  1,  48}, {  6,  40}, { 17,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, { 12,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53},  /* Row 38 */
-  {  5,  44}, {  1,  81}, { 22,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, { 12,  46},
-  {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, { 16,   4},
-  {  1,  16}, {  1,  82}, {  1,  23}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18},
-  {  1,  21}, {  1,  57}, {  5,  40}, {  1,  51}, {  1,  41}, { 17,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, { 12,  46}, {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43},  /* Row 39 */
-  {  4,  44}, {  1,  34}, {  1,  62}, { 21,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36},
-  { 13,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 17,   4},
-  {  1,  83}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  50},
-  {  1,  48}, {  6,  40}, { 18,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, { 13,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53},  /* Row 40 */
-  {  5,  44}, {  1,  35}, { 21,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, { 13,  46},
-  {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, { 15,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  57}, {  5,  40}, {  1,  51}, {  1,  41}, { 18,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, { 13,  46}, {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43},  /* Row 41 */
-  {  4,  44}, {  1,  34}, {  1,  62}, { 20,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36},
-  { 14,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 15,   4},
-  {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  50},
-  {  1,  48}, {  6,  40}, { 19,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, { 14,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53},  /* Row 42 */
-  {  5,  44}, {  1,  35}, { 20,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, { 14,  46},
-  {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, { 13,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  57}, {  5,  40}, {  1,  51}, {  1,  41}, { 19,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, { 14,  46}, {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43},  /* Row 43 */
-  {  4,  44}, {  1,  34}, {  1,  62}, { 19,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36},
-  {  7,  46}, {  1,  61}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44},
-  {  1,  35}, { 13,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56},
-  {  4,  18}, {  1,  50}, {  1,  48}, {  6,  40}, { 20,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, { 15,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53},  /* Row 44 */
-  {  5,  44}, {  1,  35}, { 19,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46},
-  {  1,  84}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34},
-  {  1,  62}, { 11,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54},
-  {  3,  18}, {  1,  21}, {  1,  57}, {  5,  40}, {  1,  51}, {  1,  41}, { 20,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  61}, {  6,  46}, {  1,  56}, {  5,  18},  /* Row 45 */
-  {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, { 18,   4}, {  1,  19}, {  1,  24},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18},
-  {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 11,   4}, {  1,  22}, {  1,  21}, {  3,  18},
-  {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  50}, {  1,  48}, {  6,  40}, { 21,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  84}, {  7,  46}, {  1,  54}, {  4,  18},  /* Row 46 */
-  {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 18,   4}, {  1,  19}, {  1,  24}, {  2,  18},
-  {  1,  36}, {  7,  46}, {  1,  36}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, {  9,   4}, {  1,  25}, {  1,  23}, {  4,  18},
-  {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  57}, {  5,  40}, {  1,  51},
-  {  1,  41}, { 21,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  1,  56}, {  6,  46}, {  1,  56},  /* Row 47 */
-  {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, { 17,   4}, {  1,  19},
-  {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  1,  18}, {  1,  56}, {  7,  46},
-  {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  9,   4}, {  1,  22},
-  {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  50}, {  1,  48},
-  {  6,  40}, { 22,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  1,  54}, {  7,  46}, {  1,  54},  /* Row 48 */
-  {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 17,   4}, {  1,  19}, {  1,  24},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  1,  18}, {  1,  54}, {  7,  46}, {  1,  56},
-  {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, {  7,   4}, {  1,  25},
-  {  1,  23}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  85},
-  {  1,  51}, {  4,  40}, {  1,  51}, {  1,  41}, { 22,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  1,  18}, {  1,  56}, {  6,  46},  /* Row 49 */
-  {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, { 16,   4},
-  {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  56},
-  {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  7,   4},
-  {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  86}, {  1,  66}, {  1,  64}, {  4,  40}, { 23,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  1,  18}, {  1,  54}, {  7,  46},  /* Row 50 */
-  {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 16,   4}, {  1,  19},
-  {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  54}, {  7,  46},
-  {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, {  5,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  53}, {  1,  44}, {  1,  67}, {  1,  66}, {  1,  64}, {  1,  40}, {  1,  51}, {  1,  41},
-  { 23,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  56}, {  6,  46},  /* Row 51 */
-  {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, { 15,   4},
-  {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  3,  18}, {  1,  56},
-  {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  5,   4},
-  {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  2,  44}, {  1,  67}, {  1,  66}, {  1,  64}, {  1,  40}, { 24,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  54}, {  7,  46},  /* Row 52 */
-  {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 15,   4}, {  1,  19},
-  {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  3,  18}, {  1,  54}, {  7,  46},
-  {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, {  3,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  53}, {  4,  44}, {  1,  67}, {  1,  87}, {  1,  41}, { 24,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  3,  18}, {  1,  56}, {  6,  46},  /* Row 53 */
-  {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, { 14,   4},
-  {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  4,  18}, {  1,  56},
-  {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  3,   4},
-  {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  5,  44}, {  1,  88}, {  1,  89}, { 24,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  3,  18}, {  1,  54}, {  7,  46},  /* Row 54 */
-  {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 14,   4}, {  1,  19},
-  {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  4,  18}, {  1,  54}, {  7,  46},
-  {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, {  1,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  53}, {  6,  44}, {  1,  90}, {  1,  62}, {  1,   5}, { 23,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  4,  18}, {  1,  56}, {  6,  46},  /* Row 55 */
-  {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, { 13,   4},
-  {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  5,  18}, {  1,  56},
-  {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  1,   4},
-  {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  5,  44}, {  1,  33}, {  1,  91}, {  2,   4}, {  1,   5}, { 22,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  4,  18}, {  1,  54}, {  7,  46},  /* Row 56 */
-  {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 13,   4}, {  1,  19},
-  {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  5,  18}, {  1,  54}, {  7,  46},
-  {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  92}, {  1,  23},
-  {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44},
-  {  1,  93}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, { 21,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  5,  18}, {  1,  56}, {  6,  46},  /* Row 57 */
-  {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, { 12,   4},
-  {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  6,  18}, {  1,  56},
-  {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  94}, {  1,  21},
-  {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44},
-  {  1,  34}, {  1,  62}, {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, { 20,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  5,  18}, {  1,  54}, {  7,  46},  /* Row 58 */
-  {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, { 12,   4}, {  1,  19},
-  {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  6,  18}, {  1,  54}, {  7,  46},
-  {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  3,  44}, {  1,  43}, {  1,  42}, {  4,  18},
-  {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  35},
-  {  2,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, { 19,   0},
-  { 17,   0}, {  1,  95}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  6,  18}, {  1,  56},  /* Row 59 */
-  {  6,  46}, {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62},
-  { 11,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  7,  18},
-  {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  3,  44}, {  1,  53},
-  {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43},
-  {  5,  44}, {  1,  34}, {  1,  62}, {  3,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4},
-  {  1,   5}, { 18,   0},
-  { 16,   0}, {  1,   1}, {  1,  96}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36},  /* Row 60 */
-  {  6,  18}, {  1,  54}, {  7,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44},
-  {  1,  35}, { 11,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36},
-  {  2,  18}, {  1,  21}, {  1,  47}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18},
-  {  1,  42}, {  1,  43}, {  1,  44}, {  1,  43}, {  1,  42}, {  4,  18}, {  1,  56}, {  7,  46},
-  {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  35}, {  5,   4}, {  1,  16},
-  {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, { 17,   0},
-  { 15,   0}, {  1,   1}, {  1,   2}, {  1,  97}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46},  /* Row 61 */
-  {  1,  36}, {  7,  18}, {  1,  56}, {  6,  46}, {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43},
-  {  4,  44}, {  1,  34}, {  1,  62}, { 10,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36},
-  {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1,  99}, {  1,  21}, {  3,  18}, {  1,  56},
-  {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  1,  44}, {  1,  53}, {  1,  21},
-  {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44},
-  {  1,  34}, {  1,  62}, {  6,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5},
-  { 16,   0},
-  { 14,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36},  /* Row 62 */
-  {  8,  46}, {  1,  36}, {  7,  18}, {  1,  54}, {  7,  46}, {  1,  54}, {  4,  18}, {  1,  21},
-  {  1,  53}, {  5,  44}, {  1,  35}, { 10,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36},
-  {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 100}, {  1,  42}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1, 101}, {  1,  42}, {  4,  18}, {  1,  56},
-  {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  35}, {  8,   4},
-  {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, { 15,   0},
-  { 13,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 102}, {  1,  98}, {  2,  18},  /* Row 63 */
-  {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  21}, {  1,  47}, {  4,  18}, {  1,  56},
-  {  6,  46}, {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62},
-  {  9,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18},
-  {  1,  98}, {  1, 103}, {  1,  53}, {  1,  21}, {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54},
-  {  3,  18}, {  1,  21}, {  1,  98}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56},
-  {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44}, {  1,  34}, {  1,  62}, {  9,   4}, {  1,  16},
-  {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, { 14,   0},
-  { 12,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 105}, {  1, 106},  /* Row 64 */
-  {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1,  99}, {  1,  21},
-  {  3,  18}, {  1,  54}, {  7,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44},
-  {  1,  35}, {  9,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36},
-  {  2,  18}, {  1,  98}, {  1, 103}, {  1,  43}, {  1,  42}, {  3,  18}, {  1,  54}, {  7,  46},
-  {  1,  56}, {  9,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53},
-  {  6,  44}, {  1,  35}, { 11,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5},
-  { 13,   0},
-  { 11,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 108},  /* Row 65 */
-  {  1,  29}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 100},
-  {  1,  42}, {  4,  18}, {  1,  56}, {  6,  46}, {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43},
-  {  4,  44}, {  1,  34}, {  1,  62}, {  8,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36},
-  {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  1,  44}, {  1,  53}, {  1,  21},
-  {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  7,  18}, {  1,  54}, {  7,  46}, {  1,  56},
-  {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44}, {  1,  34}, {  1,  62}, { 12,   4}, {  1,  16},
-  {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, { 12,   0},
-  { 10,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 109},  /* Row 66 */
-  {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98},
-  {  1, 103}, {  1,  53}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  54}, {  4,  18},
-  {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  8,   4}, {  1,  19}, {  1,  24}, {  2,  18},
-  {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  1,  44}, {  1,  43},
-  {  1,  42}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  7,  18}, {  1,  56}, {  7,  46},
-  {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  35}, { 14,   4}, {  1,  16},
-  {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, { 11,   0},
-  {  9,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 109},  /* Row 67 */
-  {  1,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18},
-  {  1,  98}, {  1, 103}, {  1,  43}, {  1,  42}, {  4,  18}, {  1,  56}, {  6,  46}, {  1,  56},
-  {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, {  7,   4}, {  1,  19},
-  {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  2,  44}, {  1,  53}, {  1,  21}, {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  5,  18},
-  {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44}, {  1,  34},
-  {  1,  62}, { 15,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, { 10,   0},
-  {  8,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 109},  /* Row 68 */
-  {  2,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18},
-  {  1,  98}, {  1, 103}, {  1,  44}, {  1,  53}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46},
-  {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  7,   4}, {  1,  19},
-  {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  2,  44}, {  1,  43}, {  1,  42}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  5,  18},
-  {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  35},
-  { 17,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, {  9,   0},
-  {  7,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 109},  /* Row 69 */
-  {  3,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18},
-  {  1,  98}, {  1, 103}, {  1,  44}, {  1,  43}, {  1,  42}, {  4,  18}, {  1,  56}, {  6,  46},
-  {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, {  6,   4},
-  {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98},
-  {  1, 103}, {  3,  44}, {  1,  53}, {  1,  21}, {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54},
-  {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44},
-  {  1,  34}, {  1,  62}, { 18,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5},
-  {  8,   0},
-  {  6,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 109},  /* Row 70 */
-  {  4,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18},
-  {  1,  98}, {  1, 103}, {  2,  44}, {  1,  53}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46},
-  {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  6,   4}, {  1,  19},
-  {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  3,  44}, {  1,  43}, {  1,  42}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  3,  18},
-  {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  35},
-  { 20,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, {  7,   0},
-  {  5,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 109},  /* Row 71 */
-  {  5,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18},
-  {  1,  98}, {  1, 103}, {  2,  44}, {  1,  43}, {  1,  42}, {  4,  18}, {  1,  56}, {  6,  46},
-  {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, {  5,   4},
-  {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98},
-  {  1, 103}, {  4,  44}, {  1,  53}, {  1,  21}, {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54},
-  {  1,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44},
-  {  1,  34}, {  1,  62}, { 21,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5},
-  {  6,   0},
-  {  4,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 109},  /* Row 72 */
-  {  6,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18},
-  {  1,  98}, {  1, 103}, {  3,  44}, {  1,  53}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46},
-  {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  5,   4}, {  1,  19},
-  {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  4,  44}, {  1,  43}, {  1,  42}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  1,  18},
-  {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  35},
-  { 23,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, {  5,   0},
-  {  3,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 109},  /* Row 73 */
-  {  7,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18},
-  {  1,  98}, {  1, 103}, {  3,  44}, {  1,  43}, {  1,  42}, {  4,  18}, {  1,  56}, {  6,  46},
-  {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, {  4,   4},
-  {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98},
-  {  1, 103}, {  5,  44}, {  1,  53}, {  1,  21}, {  3,  18}, {  1,  56}, {  7,  46}, {  1, 110},
-  {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44}, {  1,  34}, {  1,  62},
-  { 24,   4}, {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, {  4,   0},
-  {  2,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 109},  /* Row 74 */
-  {  8,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18},
-  {  1,  98}, {  1, 103}, {  4,  44}, {  1,  53}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46},
-  {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  4,   4}, {  1,  19},
-  {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  5,  44}, {  1,  43}, {  1, 111}, {  3,  18}, {  1,  54}, { 15,  46}, {  1,  54}, {  3,  18},
-  {  1,  21}, {  1,  53}, {  6,  44}, {  1,  35}, { 26,   4}, {  1,  16}, {  1,  14}, {  1,   7},
-  {  2,   4}, {  1,   5}, {  3,   0},
-  {  1,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 109},  /* Row 75 */
-  {  9,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18},
-  {  1,  98}, {  1, 103}, {  4,  44}, {  1,  43}, {  1,  42}, {  4,  18}, {  1,  56}, {  6,  46},
-  {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, {  3,   4},
-  {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98},
-  {  1, 103}, {  5,  44}, {  1,  32}, {  1,  83}, {  1,  21}, {  3,  18}, {  1,  56}, { 13,  46},
-  {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44}, {  1,  34}, {  1,  62}, { 27,   4},
-  {  1,  16}, {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5}, {  2,   0},
-  {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 109}, { 10,   4},  /* Row 76 */
-  {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98},
-  {  1, 103}, {  5,  44}, {  1,  53}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  54},
-  {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  3,   4}, {  1,  19}, {  1,  24},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44},
-  {  1,  33}, {  1, 112}, {  1,  23}, {  3,  18}, {  1,  54}, { 13,  46}, {  1,  54}, {  3,  18},
-  {  1,  21}, {  1,  53}, {  6,  44}, {  1,  35}, { 29,   4}, {  1,  16}, {  1,  14}, {  1,   7},
-  {  2,   4}, {  1,   5}, {  1,   0},
-  {  1,   2}, {  1,   6}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 109}, { 11,   4}, {  1,  19},  /* Row 77 */
-  {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  5,  44}, {  1,  43}, {  1, 111}, {  4,  18}, {  1,  56}, {  6,  46}, {  1,  56}, {  5,  18},
-  {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, {  2,   4}, {  1,  19}, {  1,  24},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44},
-  {  1,  33}, {  1,   7}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  56}, { 11,  46}, {  1,  56},
-  {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44}, {  1,  34}, {  1,  62}, { 30,   4}, {  1,  16},
-  {  1,  14}, {  1,   7}, {  2,   4}, {  1,   5},
-  {  1,   3}, {  1,   7}, {  1, 104}, {  1, 107}, {  1, 109}, { 12,   4}, {  1,  19}, {  1,  24},  /* Row 78 */
-  {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44},
-  {  1,  32}, {  1,  83}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  54}, {  4,  18},
-  {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  2,   4}, {  1,  19}, {  1,  24}, {  2,  18},
-  {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33},
-  {  1,   7}, {  1,  25}, {  1,  23}, {  3,  18}, {  1,  54}, { 11,  46}, {  1,  54}, {  3,  18},
-  {  1,  21}, {  1,  53}, {  6,  44}, {  1,  35}, { 32,   4}, {  1,  16}, {  1,  14}, {  1,   7},
-  {  2,   4},
-  {  1,   4}, {  1, 113}, {  1, 114}, {  1, 115}, { 13,   4}, {  1,  19}, {  1,  24}, {  2,  18},  /* Row 79 */
-  {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33},
-  {  1, 112}, {  1,  23}, {  4,  18}, {  1,  56}, {  6,  46}, {  1,  56}, {  5,  18}, {  1,  42},
-  {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, {  1,   4}, {  1,  19}, {  1,  24}, {  2,  18},
-  {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33},
-  {  1,   7}, {  1,   4}, {  1, 116}, {  4,  18}, {  1,  56}, {  9,  46}, {  1,  61}, {  4,  18},
-  {  1,  42}, {  1,  43}, {  5,  44}, {  1,  34}, {  1,  62}, { 33,   4}, {  1,  16}, {  1,  14},
-  {  1,  62}, {  1,   4},
-  {  1,   4}, {  1,   7}, {  1, 117}, {  1,   8}, { 13,   4}, {  1,  19}, {  1,  24}, {  2,  18},  /* Row 80 */
-  {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33},
-  {  1,   7}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  54}, {  4,  18},
-  {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  1,   4}, {  1,  19}, {  1,  24}, {  2,  18},
-  {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33},
-  {  1,   7}, {  1,   4}, {  1, 116}, {  4,  18}, {  1,  54}, {  9,  46}, {  1,  37}, {  3,  18},
-  {  1,  21}, {  1,  53}, {  6,  44}, {  1,  35}, { 35,   4}, {  1, 118}, {  1, 119}, {  1,   7},
-  {  2,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 12,   4}, {  1,  19}, {  1,  24}, {  2,  18},  /* Row 81 */
-  {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33},
-  {  1,   7}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  6,  46}, {  1,  56}, {  5,  18},
-  {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1,  62}, {  1,  19}, {  1,  24}, {  2,  18},
-  {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33},
-  {  1,   7}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  8,  46}, {  1,  60}, {  1,  21},
-  {  3,  18}, {  1,  98}, {  1, 120}, {  5,  44}, {  1,  33}, {  1,  62}, { 34,   4}, {  1,   8},
-  {  1,  11}, {  1,  76}, {  1,   3},
-  {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 11,   4}, {  1,  19}, {  1,  24}, {  2,  18},  /* Row 82 */
-  {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33},
-  {  1,   7}, {  1,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  54},
-  {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  35}, {  1, 121}, {  1,  24}, {  2,  18},
-  {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33},
-  {  1,   7}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, { 10,  46}, {  1,  54}, {  3,  18},
-  {  1,  21}, {  1,  53}, {  5,  44}, {  1,  33}, {  1,  62}, { 33,   4}, {  1,   8}, {  1,  11},
-  {  1,  15}, {  1,   6}, {  1,   4},
-  {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 10,   4}, {  1,  19}, {  1,  24},  /* Row 83 */
-  {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44},
-  {  1,  33}, {  1,   7}, {  1,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  6,  46},
-  {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  34}, {  1, 122}, {  1,  24},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44},
-  {  1,  33}, {  1, 112}, {  1,  23}, {  4,  18}, {  1,  56}, { 10,  46}, {  1,  56}, {  4,  18},
-  {  1,  42}, {  1,  43}, {  5,  44}, {  1,  35}, { 32,   4}, {  1,   8}, {  1,  11}, {  1,  15},
-  {  1,   6}, {  1,   4}, {  1,   5},
-  {  1,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  9,   4}, {  1,  19},  /* Row 84 */
-  {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  5,  44}, {  1,  33}, {  1,   7}, {  2,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1, 123}, {  1,  24},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44},
-  {  1,  32}, {  1,  83}, {  1,  21}, {  3,  18}, {  1,  54}, { 12,  46}, {  1,  54}, {  3,  18},
-  {  1,  21}, {  1,  53}, {  5,  44}, {  1,  34}, {  1,  62}, { 30,   4}, {  1,   8}, {  1,  11},
-  {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, {  1,   0},
-  {  2,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  8,   4}, {  1,  19},  /* Row 85 */
-  {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  5,  44}, {  1,  33}, {  1,   7}, {  2,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56},
-  {  6,  46}, {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1, 124}, {  1,  98},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44},
-  {  1,  43}, {  1, 111}, {  4,  18}, {  1,  56}, { 12,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  5,  44}, {  1,  35}, { 29,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6},
-  {  1,   4}, {  1,   5}, {  2,   0},
-  {  3,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  7,   4}, {  1,  19},  /* Row 86 */
-  {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  5,  44}, {  1,  33}, {  1,   7}, {  3,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  4,  44}, {  1, 103}, {  1,  98},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44},
-  {  1,  53}, {  1,  21}, {  3,  18}, {  1,  54}, { 14,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  53}, {  5,  44}, {  1,  34}, {  1,  62}, { 27,   4}, {  1,   8}, {  1,  11}, {  1,  15},
-  {  1,   6}, {  1,   4}, {  1,   5}, {  3,   0},
-  {  4,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  6,   4}, {  1,  19},  /* Row 87 */
-  {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  5,  44}, {  1,  33}, {  1,   7}, {  3,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56},
-  {  6,  46}, {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  3,  44}, {  1, 103}, {  1,  98},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  4,  44},
-  {  1,  43}, {  1,  42}, {  4,  18}, {  1,  56}, { 14,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  5,  44}, {  1,  35}, { 26,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6},
-  {  1,   4}, {  1,   5}, {  4,   0},
-  {  5,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  5,   4}, {  1,  19},  /* Row 88 */
-  {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  5,  44}, {  1,  33}, {  1,   7}, {  4,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  3,  44}, {  1, 103}, {  1,  98},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  4,  44},
-  {  1,  53}, {  1,  21}, {  3,  18}, {  1,  54}, { 16,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  53}, {  5,  44}, {  1,  34}, {  1,  62}, { 24,   4}, {  1,   8}, {  1,  11}, {  1,  15},
-  {  1,   6}, {  1,   4}, {  1,   5}, {  5,   0},
-  {  6,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  4,   4}, {  1,  19},  /* Row 89 */
-  {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  5,  44}, {  1,  33}, {  1,   7}, {  4,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56},
-  {  6,  46}, {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  2,  44}, {  1, 103}, {  1,  98},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  3,  44},
-  {  1,  43}, {  1,  42}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  56}, {  1,  54}, {  7,  46},
-  {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44}, {  1,  35}, { 23,   4}, {  1,   8},
-  {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, {  6,   0},
-  {  7,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  3,   4}, {  1,  19},  /* Row 90 */
-  {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  5,  44}, {  1,  33}, {  1,   7}, {  5,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  2,  44}, {  1, 103}, {  1,  98},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  3,  44},
-  {  1,  53}, {  1,  21}, {  3,  18}, {  1,  54}, {  8,  46}, {  1,  54}, {  1,  18}, {  1,  56},
-  {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  34}, {  1,  62},
-  { 21,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, {  7,   0},
-  {  8,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  2,   4}, {  1,  19},  /* Row 91 */
-  {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  5,  44}, {  1,  33}, {  1,   7}, {  5,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56},
-  {  6,  46}, {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  1,  44}, {  1, 103}, {  1,  98},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  2,  44},
-  {  1,  43}, {  1,  42}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  56}, {  2,  18}, {  1,  54},
-  {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44}, {  1,  35}, { 20,   4},
-  {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, {  8,   0},
-  {  9,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  1,   4}, {  1,  19},  /* Row 92 */
-  {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},
-  {  5,  44}, {  1,  33}, {  1,   7}, {  6,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  54}, {  4,  18}, {  1,  21}, {  1,  53}, {  1,  44}, {  1, 103}, {  1,  98},
-  {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  2,  44},
-  {  1,  53}, {  1,  21}, {  3,  18}, {  1,  54}, {  8,  46}, {  1,  54}, {  3,  18}, {  1,  56},
-  {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  34}, {  1,  62},
-  { 18,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, {  9,   0},
-  { 10,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  1, 121}, {  1,  24},  /* Row 93 */
-  {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44},
-  {  1,  33}, {  1,   7}, {  6,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  6,  46},
-  {  1,  56}, {  5,  18}, {  1,  42}, {  1,  43}, {  1, 103}, {  1,  98}, {  2,  18}, {  1,  36},
-  {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  1,  44}, {  1,  43}, {  1,  42},
-  {  4,  18}, {  1,  56}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  54}, {  7,  46}, {  1,  56},
-  {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44}, {  1,  35}, { 17,   4}, {  1,   8}, {  1,  11},
-  {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 10,   0},
-  { 11,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1, 125}, {  1,  24}, {  2,  18},  /* Row 94 */
-  {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33},
-  {  1,   7}, {  7,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  54},
-  {  4,  18}, {  1,  21}, {  1,  53}, {  1, 103}, {  1,  98}, {  2,  18}, {  1,  36}, {  7,  46},
-  {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  1,  44}, {  1,  53}, {  1,  21}, {  3,  18},
-  {  1,  54}, {  8,  46}, {  1,  54}, {  5,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18},
-  {  1,  21}, {  1,  53}, {  5,  44}, {  1,  34}, {  1,  62}, { 15,   4}, {  1,   8}, {  1,  11},
-  {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 11,   0},
-  { 12,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1, 126}, {  1,  98}, {  2,  18}, {  1,  36},  /* Row 95 */
-  {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33}, {  1,   7},
-  {  7,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  6,  46}, {  1,  56}, {  5,  18},
-  {  1,  42}, {  1, 100}, {  1,  98}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18},
-  {  1,  98}, {  1, 103}, {  1,  43}, {  1,  42}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  56},
-  {  6,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44},
-  {  1,  35}, { 14,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5},
-  { 12,   0},
-  { 13,   0}, {  1,   5}, {  3,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46},  /* Row 96 */
-  {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33}, {  1,   7}, {  8,   4},
-  {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  54}, {  4,  18}, {  1,  21},
-  {  1,  99}, {  1,  98}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98},
-  {  1, 103}, {  1,  53}, {  1,  21}, {  3,  18}, {  1,  54}, {  8,  46}, {  1,  54}, {  7,  18},
-  {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  34},
-  {  1,  62}, { 12,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5},
-  { 13,   0},
-  { 14,   0}, {  1,   5}, {  2,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46},  /* Row 97 */
-  {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33}, {  1,   7}, {  8,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  6,  46}, {  1,  56}, {  5,  18}, {  1,  47},
-  {  1,  21}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 100},
-  {  1,  42}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  47}, {  1,  21},
-  {  2,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44},
-  {  1,  35}, { 11,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5},
-  { 14,   0},
-  { 15,   0}, {  1,   5}, {  1,   4}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46},  /* Row 98 */
-  {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33}, {  1,   7}, {  9,   4},
-  {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  54}, {  8,  18}, {  1,  36},
-  {  7,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1,  99}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  8,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1, 127}, {  1,  42}, {  3,  18}, {  1,  56},
-  {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  34}, {  1,  62},
-  {  9,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 15,   0},
-  { 16,   0}, {  1,   5}, {  1,  19}, {  1,  24}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36},  /* Row 99 */
-  {  2,  18}, {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33}, {  1,   7}, {  9,   4}, {  1,  25},
-  {  1,  23}, {  4,  18}, {  1,  56}, {  6,  46}, {  1,  56}, {  8,  18}, {  1,  36}, {  7,  46},
-  {  1,  36}, {  2,  18}, {  1,  21}, {  1,  47}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  56},
-  {  4,  18}, {  1,  42}, {  1,  43}, {  1,  53}, {  1,  21}, {  2,  18}, {  1,  54}, {  7,  46},
-  {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44}, {  1,  35}, {  8,   4}, {  1,   8},
-  {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 16,   0},
-  { 17,   0}, {  1, 128}, {  1, 129}, {  2,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18},  /* Row 100 */
-  {  1,  98}, {  1, 103}, {  5,  44}, {  1,  33}, {  1,   7}, { 10,   4}, {  1,  22}, {  1,  21},
-  {  3,  18}, {  1,  54}, {  7,  46}, {  1,  54}, {  7,  18}, {  1,  36}, {  7,  46}, {  1,  36},
-  {  7,  18}, {  1,  54}, {  8,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  1,  44},
-  {  1,  43}, {  1,  42}, {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  53}, {  5,  44}, {  1,  34}, {  1,  62}, {  6,   4}, {  1,   8}, {  1,  11}, {  1,  15},
-  {  1,   6}, {  1,   4}, {  1,   5}, { 17,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 101 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 10,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56},
-  {  6,  46}, {  1,  56}, {  7,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  7,  18}, {  1,  56},
-  {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  2,  44}, {  1,  53}, {  1,  21},
-  {  2,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44},
-  {  1,  35}, {  5,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5},
-  { 18,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 102 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 11,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  54}, {  6,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  6,  18}, {  1,  54},
-  {  8,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  3,  44}, {  1,  43}, {  1,  42},
-  {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44},
-  {  1,  34}, {  1,  62}, {  3,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4},
-  {  1,   5}, { 19,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 103 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 11,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56},
-  {  6,  46}, {  1,  56}, {  6,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  6,  18}, {  1,  56},
-  {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  4,  44}, {  1,  53}, {  1,  21},
-  {  2,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44},
-  {  1,  35}, {  2,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5},
-  { 20,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 104 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 12,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  54}, {  5,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  5,  18}, {  1,  54},
-  {  8,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44}, {  1,  43}, {  1,  42},
-  {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  5,  44},
-  {  1,  34}, {  1,  62}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5},
-  { 21,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 105 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 12,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56},
-  {  6,  46}, {  1,  56}, {  5,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  5,  18}, {  1,  56},
-  {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  6,  44}, {  1,  94}, {  1,  21},
-  {  2,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  5,  44},
-  {  1,  93}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 22,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 106 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 13,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  54}, {  4,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  4,  18}, {  1,  54},
-  {  8,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  34}, {  1,  92},
-  {  1,  23}, {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53},
-  {  5,  44}, {  1,  88}, {  1, 130}, {  1,   6}, {  1,   4}, {  1,   5}, { 23,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 107 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 13,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56},
-  {  6,  46}, {  1,  56}, {  4,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  4,  18}, {  1,  56},
-  {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  6,  44}, {  1,  35}, {  1,   4},
-  {  1,  22}, {  1,  21}, {  2,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  5,  44}, {  1, 131}, {  1,   7}, {  1,   5}, { 24,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 108 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 14,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  54}, {  3,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  3,  18}, {  1,  54},
-  {  8,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62},
-  {  1,   4}, {  1,  25}, {  1,  23}, {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18},
-  {  1,  21}, {  1,  53}, {  4,  44}, {  1,  67}, {  1, 132}, {  1, 133}, { 25,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 109 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 14,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56},
-  {  6,  46}, {  1,  56}, {  3,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  3,  18}, {  1,  56},
-  {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  6,  44}, {  1,  35}, {  3,   4},
-  {  1,  22}, {  1,  21}, {  2,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  2,  44}, {  1,  67}, {  1,  66}, {  1,  64}, {  1,  40}, { 25,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 110 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 15,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  54}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  54},
-  {  8,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62},
-  {  3,   4}, {  1,  25}, {  1,  23}, {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18},
-  {  1,  21}, {  1,  53}, {  1,  44}, {  1,  67}, {  1,  66}, {  1,  64}, {  1,  40}, {  1,  51},
-  {  1,  41}, { 24,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 111 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 15,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56},
-  {  6,  46}, {  1,  56}, {  2,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  2,  18}, {  1,  56},
-  {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  6,  44}, {  1,  35}, {  5,   4},
-  {  1,  22}, {  1,  21}, {  2,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  86}, {  1,  66}, {  1,  64}, {  4,  40}, { 24,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 112 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 16,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  54}, {  1,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  1,  18}, {  1,  54},
-  {  8,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62},
-  {  5,   4}, {  1,  25}, {  1,  23}, {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18},
-  {  1,  21}, {  1,  85}, {  1,  51}, {  4,  40}, {  1,  51}, {  1,  41}, { 23,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 113 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 16,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56},
-  {  6,  46}, {  1,  56}, {  1,  18}, {  1,  36}, {  7,  46}, {  1,  36}, {  1,  18}, {  1,  56},
-  {  7,  46}, {  1,  56}, {  4,  18}, {  1,  42}, {  1,  43}, {  6,  44}, {  1,  35}, {  7,   4},
-  {  1,  22}, {  1,  21}, {  2,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  50},
-  {  1,  48}, {  6,  40}, { 23,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 114 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 17,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  54}, {  1,  36}, {  7,  46}, {  1,  36}, {  1,  54}, {  8,  46}, {  1,  54},
-  {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62}, {  7,   4}, {  1,  25},
-  {  1,  23}, {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  57},
-  {  5,  40}, {  1,  51}, {  1,  41}, { 22,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 103},  /* Row 115 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 17,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56},
-  {  6,  46}, {  1,  56}, {  1,  36}, {  7,  46}, {  1,  36}, {  1,  56}, {  7,  46}, {  1,  56},
-  {  4,  18}, {  1,  42}, {  1,  43}, {  6,  44}, {  1,  35}, {  9,   4}, {  1,  22}, {  1,  21},
-  {  2,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  50}, {  1,  48}, {  6,  40},
-  { 22,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  98}, {  1, 134},  /* Row 116 */
-  {  5,  44}, {  1,  33}, {  1,   7}, { 18,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54},
-  {  7,  46}, {  1,  84}, {  7,  46}, {  1,  84}, {  8,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62}, {  9,   4}, {  1,  25}, {  1,  23}, {  3,  18},
-  {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  57}, {  5,  40}, {  1,  51},
-  {  1,  41}, { 21,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1, 135},  /* Row 117 */
-  {  1,  67}, {  4,  44}, {  1,  33}, {  1,   7}, { 18,   4}, {  1,  25}, {  1,  23}, {  4,  18},
-  {  1,  56}, {  6,  46}, {  1,  61}, {  7,  46}, {  1,  61}, {  7,  46}, {  1,  56}, {  4,  18},
-  {  1,  42}, {  1,  43}, {  6,  44}, {  1,  35}, { 11,   4}, {  1,  22}, {  1,  21}, {  2,  18},
-  {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  50}, {  1,  48}, {  6,  40}, { 21,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 118 */
-  {  1,  66}, {  1,  67}, {  3,  44}, {  1,  79}, {  1, 136}, { 19,   4}, {  1,  22}, {  1,  21},
-  {  3,  18}, {  1,  54}, { 22,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44},
-  {  1,  34}, {  1,  62}, { 11,   4}, {  1,  25}, {  1,  23}, {  3,  18}, {  1,  56}, {  7,  46},
-  {  1,  54}, {  3,  18}, {  1,  21}, {  1,  57}, {  5,  40}, {  1,  51}, {  1,  41}, { 20,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 119 */
-  {  1,  64}, {  1,  66}, {  1,  67}, {  2,  44}, {  1,  79}, {  1,  45}, {  1,  16}, { 18,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, { 20,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  6,  44}, {  1,  35}, { 13,   4}, {  1,  22}, {  1,  21}, {  2,  18}, {  1,  54},
-  {  7,  46}, {  1,  56}, {  4,  18}, {  1,  50}, {  1,  48}, {  6,  40}, { 20,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 120 */
-  {  1,  40}, {  1,  64}, {  1,  66}, {  1,  67}, {  1,  44}, {  1,  33}, {  1, 137}, {  1,  14},
-  {  1,  16}, { 18,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, { 20,  46}, {  1,  54},
-  {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62}, { 13,   4}, {  1, 138},
-  {  1, 139}, {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  57},
-  {  5,  40}, {  1,  51}, {  1,  41}, { 19,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 121 */
-  {  2,  40}, {  1,  64}, {  1,  66}, {  1,  67}, {  1,  33}, {  2,   7}, {  1,  14}, {  1,  16},
-  { 17,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, { 18,  46}, {  1,  56}, {  4,  18},
-  {  1,  42}, {  1,  43}, {  6,  44}, {  1,  35}, { 13,   4}, {  1,   8}, {  1, 140}, {  1, 141},
-  {  1,  21}, {  2,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18}, {  1,  50}, {  1,  48},
-  {  6,  40}, { 19,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 122 */
-  {  3,  40}, {  1,  64}, {  1,  66}, {  1, 131}, {  1,   7}, {  1,   4}, {  1,   7}, {  1,  14},
-  {  1,  16}, { 17,   4}, {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, { 18,  46}, {  1,  54},
-  {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62}, { 12,   4}, {  1,   8},
-  {  1,  11}, {  1,  15}, {  1, 142}, {  1,  23}, {  3,  18}, {  1,  56}, {  7,  46}, {  1,  54},
-  {  3,  18}, {  1,  21}, {  1,  57}, {  5,  40}, {  1,  51}, {  1,  41}, { 18,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 123 */
-  {  4,  40}, {  1,  64}, {  1, 143}, {  1, 144}, {  2,   4}, {  1,   7}, {  1,  14}, {  1,  16},
-  { 16,   4}, {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, { 16,  46}, {  1,  56}, {  4,  18},
-  {  1,  42}, {  1,  43}, {  6,  44}, {  1,  35}, { 12,   4}, {  1,   8}, {  1,  11}, {  1,  15},
-  {  1,   6}, {  1,   4}, {  1, 145}, {  3,  18}, {  1,  54}, {  7,  46}, {  1,  56}, {  4,  18},
-  {  1,  50}, {  1,  48}, {  6,  40}, { 18,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 124 */
-  {  5,  40}, {  1,  64}, {  1, 146}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 16,   4},
-  {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, { 16,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62}, { 11,   4}, {  1,   8}, {  1,  11}, {  1,  15},
-  {  1,   6}, {  1,   4}, {  1,   5}, {  1, 147}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54},
-  {  3,  18}, {  1,  21}, {  1,  57}, {  5,  40}, {  1,  51}, {  1,  41}, { 17,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 125 */
-  {  6,  40}, {  1,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 15,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, { 14,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  6,  44}, {  1,  35}, { 11,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6},
-  {  1,   4}, {  1,   5}, {  2,   0}, {  1,  17}, {  1,  21}, {  2,  18}, {  1,  54}, {  7,  46},
-  {  1,  56}, {  4,  18}, {  1,  50}, {  1,  48}, {  6,  40}, { 17,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 126 */
-  {  6,  40}, {  2,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 15,   4},
-  {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, { 14,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62}, { 10,   4}, {  1,   8}, {  1,  11}, {  1,  15},
-  {  1,   6}, {  1,   4}, {  1,   5}, {  4,   0}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54},
-  {  3,  18}, {  1,  21}, {  1,  57}, {  5,  40}, {  1,  51}, {  1,  41}, { 16,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 127 */
-  {  6,  40}, {  3,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 14,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, { 12,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  6,  44}, {  1,  35}, { 10,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6},
-  {  1,   4}, {  1,   5}, {  5,   0}, {  1,  17}, {  1,  21}, {  2,  18}, {  1,  54}, {  7,  46},
-  {  1,  56}, {  4,  18}, {  1,  50}, {  1,  48}, {  6,  40}, { 16,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 128 */
-  {  6,  40}, {  4,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 14,   4},
-  {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, { 12,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62}, {  9,   4}, {  1,   8}, {  1,  11}, {  1,  15},
-  {  1,   6}, {  1,   4}, {  1,   5}, {  7,   0}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54},
-  {  3,  18}, {  1,  21}, {  1,  57}, {  5,  40}, {  1,  51}, {  1,  41}, { 15,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 129 */
-  {  6,  40}, {  5,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 13,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, { 10,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  6,  44}, {  1,  35}, {  9,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6},
-  {  1,   4}, {  1,   5}, {  8,   0}, {  1,  17}, {  1,  21}, {  2,  18}, {  1,  54}, {  7,  46},
-  {  1,  56}, {  4,  18}, {  1,  50}, {  1,  48}, {  6,  40}, { 15,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 130 */
-  {  6,  40}, {  6,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 13,   4},
-  {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, { 10,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62}, {  8,   4}, {  1,   8}, {  1,  11}, {  1,  15},
-  {  1,   6}, {  1,   4}, {  1,   5}, { 10,   0}, {  4,  18}, {  1,  56}, {  7,  46}, {  1,  54},
-  {  3,  18}, {  1,  21}, {  1,  55}, {  5,  40}, {  1,  51}, {  1, 148}, { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 131 */
-  {  6,  40}, {  7,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 12,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  8,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  6,  44}, {  1,  35}, {  8,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6},
-  {  1,   4}, {  1,   5}, { 11,   0}, {  1,  17}, {  1,  21}, {  2,  18}, {  1,  54}, {  7,  46},
-  {  1,  56}, {  4,  18}, {  1,  57}, {  6,  40}, {  1, 149}, { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 132 */
-  {  6,  40}, {  8,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 12,   4},
-  {  1,  22}, {  1,  21}, {  3,  18}, {  1,  54}, {  8,  46}, {  1,  54}, {  3,  18}, {  1,  21},
-  {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62}, {  7,   4}, {  1,   8}, {  1,  11}, {  1,  15},
-  {  1,   6}, {  1,   4}, {  1,   5}, { 13,   0}, {  4,  18}, {  1,  56}, {  6,  46}, {  1,  56},
-  {  4,  18}, {  1,  57}, {  7,  40}, { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 133 */
-  {  6,  40}, {  9,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 11,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  56}, {  6,  46}, {  1,  56}, {  4,  18}, {  1,  42},
-  {  1,  43}, {  6,  44}, {  1,  35}, {  7,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6},
-  {  1,   4}, {  1,   5}, { 14,   0}, {  1,  17}, {  1,  21}, {  2,  18}, {  1,  54}, {  6,  46},
-  {  1,  56}, {  3,  18}, {  1,  69}, {  1, 150}, {  6,  40}, {  1,  51}, {  1, 148}, { 13,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 134 */
-  {  6,  40}, { 10,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 11,   4},
-  {  1,  22}, {  1,  21}, {  3,  18}, {  1,  36}, {  1, 151}, {  4,  46}, {  1, 151}, {  1,  36},
-  {  3,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62}, {  6,   4}, {  1,   8},
-  {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 16,   0}, {  4,  18}, {  1,  56},
-  {  5,  46}, {  1,  54}, {  3,  18}, {  1,  50}, {  1,  73}, {  7,  40}, {  1,  41}, { 13,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 135 */
-  {  6,  40}, { 11,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 10,   4},
-  {  1,  25}, {  1,  23}, {  4,  18}, {  1,  36}, {  1,  56}, {  2,  46}, {  1,  56}, {  1,  36},
-  {  4,  18}, {  1,  42}, {  1,  43}, {  6,  44}, {  1,  35}, {  6,   4}, {  1,   8}, {  1,  11},
-  {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 17,   0}, {  1,  17}, {  1,  21}, {  2,  18},
-  {  1,  36}, {  1,  56}, {  2,  46}, {  1,  56}, {  1,  54}, {  3,  18}, {  1,  21}, {  1,  57},
-  {  8,  40}, {  1,  41}, { 13,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 136 */
-  {  6,  40}, { 12,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 10,   4},
-  {  1,  22}, {  1,  21}, {  5,  18}, {  2,  36}, {  5,  18}, {  1,  21}, {  1,  53}, {  6,  44},
-  {  1,  34}, {  1,  62}, {  5,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4},
-  {  1,   5}, { 19,   0}, {  5,  18}, {  2,  36}, {  5,  18}, {  1,  50}, {  1,  48}, {  8,  40},
-  {  1,  63}, { 13,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 137 */
-  {  6,  40}, { 13,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  9,   4},
-  {  1,  25}, {  1,  23}, { 12,  18}, {  1,  42}, {  1,  43}, {  6,  44}, {  1,  35}, {  5,   4},
-  {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 20,   0}, {  1,  17},
-  {  1,  21}, {  9,  18}, {  1,  47}, {  1,  70}, {  9,  40}, { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  36}, {  2,  18}, {  1,  47}, {  1,  73},  /* Row 138 */
-  {  6,  40}, { 14,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  9,   4},
-  {  1,  22}, {  1,  21}, { 10,  18}, {  1,  21}, {  1,  53}, {  6,  44}, {  1,  34}, {  1,  62},
-  {  4,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 22,   0},
-  {  9,  18}, {  1,  47}, {  1,  70}, {  8,  40}, {  1,  51}, {  1,  41}, { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  36}, {  8,  46}, {  1,  69}, {  2,  47}, {  1, 152}, {  1,  73},  /* Row 139 */
-  {  6,  40}, { 15,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  8,   4},
-  {  1,  19}, {  1,  27}, {  1,  21}, {  8,  18}, {  1,  21}, {  1, 153}, {  1, 103}, {  6,  44},
-  {  1,  35}, {  4,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5},
-  { 23,   0}, {  1, 147}, {  1, 154}, {  1,  18}, {  1,  21}, {  2,  18}, {  1,  21}, {  1,  47},
-  {  1, 155}, {  1, 150}, { 10,  40}, { 15,   0},
-  { 25,   0}, {  5,  48}, {  4,  73}, {  7,  40}, { 16,   0}, {  1,   5}, {  3,   4}, {  1,   7},  /* Row 140 */
-  {  1,  14}, {  1,  16}, {  8,   4}, {  1,  19}, {  1,  22}, {  1,  23}, {  1,  21}, {  4,  18},
-  {  1,  21}, {  1,  42}, {  1,  53}, {  1, 103}, {  6,  44}, {  1,  34}, {  1,  62}, {  3,   4},
-  {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 27,   0}, {  1, 156},
-  {  1,  17}, {  1, 157}, {  1,  55}, {  1,  48}, {  1,  64}, {  9,  40}, {  1,  51}, {  1,  41},
-  { 15,   0},
-  { 25,   0}, { 16,  40}, { 17,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16},  /* Row 141 */
-  {  9,   4}, {  1,  25}, {  1,  22}, {  1, 158}, {  2,  98}, {  1,  77}, {  1,  53}, {  1,  43},
-  {  7,  44}, {  1,  33}, {  1, 136}, {  3,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6},
-  {  1,   4}, {  1,   5}, { 30,   0}, {  1,  63}, { 11,  40}, {  1,  51}, {  1,  40}, { 16,   0},
-  { 25,   0}, { 16,  40}, { 18,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16},  /* Row 142 */
-  { 10,   4}, {  1,  19}, {  1, 159}, {  1, 160}, {  1, 103}, {  7,  44}, {  1,  79}, {  1, 161},
-  {  1, 136}, {  3,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5},
-  { 32,   0}, {  1,  41}, {  1,  51}, {  8,  40}, {  1,  51}, {  1,  40}, { 17,   0},
-  { 25,   0}, { 16,  40}, { 19,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16},  /* Row 143 */
-  { 11,   4}, {  1,  62}, {  1,  35}, {  1,  34}, {  5,  33}, {  1, 161}, {  1, 136}, {  1,   7},
-  {  3,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 34,   0},
-  {  8,  40}, {  1,  51}, {  1,  40}, { 18,   0},
-  { 25,   0}, { 16,  40}, { 20,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16},  /* Row 144 */
-  { 12,   4}, {  7,   7}, {  4,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4},
-  {  1,   5}, { 35,   0}, {  1,  49}, {  7,  40}, {  1,  41}, { 19,   0},
-  { 25,   0}, { 16,  40}, { 21,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16},  /* Row 145 */
-  { 21,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 64,   0},
-  { 25,   0}, { 16,  40}, { 22,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16},  /* Row 146 */
-  { 19,   4}, {  1,   8}, {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 65,   0},
-  { 64,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 17,   4}, {  1,   8},  /* Row 147 */
-  {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 66,   0},
-  { 65,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 15,   4}, {  1,   8},  /* Row 148 */
-  {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 67,   0},
-  { 66,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 13,   4}, {  1,   8},  /* Row 149 */
-  {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 68,   0},
-  { 67,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, { 11,   4}, {  1,   8},  /* Row 150 */
-  {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 69,   0},
-  { 68,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  9,   4}, {  1,   8},  /* Row 151 */
-  {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 70,   0},
-  { 69,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  7,   4}, {  1,   8},  /* Row 152 */
-  {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 71,   0},
-  { 70,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  5,   4}, {  1,   8},  /* Row 153 */
-  {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 72,   0},
-  { 71,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  3,   4}, {  1,   8},  /* Row 154 */
-  {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 73,   0},
-  { 72,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1,  16}, {  1,   4}, {  1,   8},  /* Row 155 */
-  {  1,  11}, {  1,  15}, {  1,   6}, {  1,   4}, {  1,   5}, { 74,   0},
-  { 73,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1,  14}, {  1, 118}, {  1,  11}, {  1,  15},  /* Row 156 */
-  {  1,   6}, {  1,   4}, {  1,   5}, { 75,   0},
-  { 74,   0}, {  1,   5}, {  3,   4}, {  1,   7}, {  1, 162}, {  1,  15}, {  1,   6}, {  1,   4},  /* Row 157 */
-  {  1,   5}, { 76,   0},
-  { 75,   0}, {  1,   5}, {  2,   4}, {  1,   3}, {  1, 163}, {  1,   6}, {  1,   4}, {  1,   5},  /* Row 158 */
-  { 77,   0},
-  { 76,   0}, {  1,   5}, {  4,   4}, {  1,   5}, { 78,   0}                                       /* Row 159 */
+  0xb5, 0x00, 0x02, 0x01, 0x02, 0x03, 0xfd, 0x04, 0x00, 0x05, 0xb5, 0x00,                           /* Row 0 */
+  0xb6, 0x00, 0x03, 0x01, 0x02, 0x06, 0x04, 0xff, 0x07, 0xfe, 0x04, 0x00, 0x05, 0xb6, 0x00,         /* Row 1 */
+  0xb7, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x09, 0x0a, 0x07, 0xfe, 0x04, 0x00, 0x05, 0xb7,   /* Row 2 */
+  0x00,
+  0xb8, 0x00, 0x09, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0c, 0x0d, 0x0e, 0x07, 0xfe, 0x04, 0x00,   /* Row 3 */
+  0x05, 0xb8, 0x00,
+  0xb9, 0x00, 0x0b, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x10, 0x0e, 0x07, 0xfe,   /* Row 4 */
+  0x04, 0x00, 0x05, 0xb9, 0x00,
+  0xba, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xfe, 0x04, 0x02, 0x10, 0x0e,   /* Row 5 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xba, 0x00,
+  0xbb, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xfc, 0x04, 0x02, 0x10, 0x0e,   /* Row 6 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xbb, 0x00,
+  0xbc, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xfa, 0x04, 0x02, 0x10, 0x0e,   /* Row 7 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xbc, 0x00,
+  0xbd, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf8, 0x04, 0x02, 0x10, 0x0e,   /* Row 8 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xbd, 0x00,
+  0xbe, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf6, 0x04, 0x02, 0x10, 0x0e,   /* Row 9 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xbe, 0x00,
+  0xbf, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf4, 0x04, 0x02, 0x10, 0x0e,   /* Row 10 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xbf, 0x00,
+  0xc0, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf2, 0x04, 0x02, 0x10, 0x0e,   /* Row 11 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xc0, 0x00,
+  0xc1, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf0, 0x04, 0x02, 0x10, 0x0e,   /* Row 12 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xc1, 0x00,
+  0xc2, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xee, 0x04, 0x02, 0x10, 0x0e,   /* Row 13 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xc2, 0x00,
+  0xc3, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xec, 0x04, 0x02, 0x10, 0x0e,   /* Row 14 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xc3, 0x00,
+  0xc4, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xea, 0x04, 0x02, 0x10, 0x0e,   /* Row 15 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xc4, 0x00,
+  0xc5, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xe8, 0x04, 0x02, 0x10, 0x0e,   /* Row 16 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xc5, 0x00,
+  0xc6, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xe6, 0x04, 0x02, 0x10, 0x0e,   /* Row 17 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xc6, 0x00,
+  0xc7, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xe4, 0x04, 0x02, 0x10, 0x0e,   /* Row 18 */
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xe7, 0x00, 0x00, 0x11, 0xfc, 0x12, 0x00, 0x11, 0xe8, 0x00,
+  0xc8, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf7, 0x04, 0xfc, 0x13, 0xf1,   /* Row 19 */
+  0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00, 0x05, 0xea, 0x00, 0x02, 0x14, 0x12, 0x15, 0xfc,
+  0x12, 0x02, 0x15, 0x12, 0x14, 0xea, 0x00,
+  0xc9, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf8, 0x04, 0x02, 0x13, 0x16,   /* Row 20 */
+  0x17, 0xfe, 0x18, 0x02, 0x17, 0x16, 0x19, 0xf2, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00,
+  0x05, 0xeb, 0x00, 0xf6, 0x12, 0x00, 0x14, 0xeb, 0x00,
+  0xea, 0x00, 0x00, 0x11, 0xfc, 0x12, 0x00, 0x1a, 0xe8, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08,   /* Row 21 */
+  0x0b, 0x0f, 0x06, 0xf8, 0x04, 0x02, 0x13, 0x1b, 0x15, 0xfc, 0x12, 0x02, 0x15, 0x17, 0x1c, 0xf2,
+  0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00, 0x05, 0xed, 0x00, 0x01, 0x11, 0x15, 0xf6, 0x12,
+  0x00, 0x14, 0xec, 0x00,
+  0xec, 0x00, 0x02, 0x14, 0x12, 0x15, 0xfc, 0x12, 0x02, 0x15, 0x12, 0x14, 0xeb, 0x00, 0x07, 0x01,   /* Row 22 */
+  0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf8, 0x04, 0x02, 0x13, 0x1b, 0x15, 0xf9, 0x12, 0x01,
+  0x1d, 0x1c, 0xfd, 0x07, 0xf6, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00, 0x05, 0xee, 0x00,
+  0xf3, 0x12, 0xec, 0x00,
+  0xec, 0x00, 0xf6, 0x12, 0x00, 0x14, 0xed, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f,   /* Row 23 */
+  0x06, 0xf7, 0x04, 0x01, 0x16, 0x15, 0xf7, 0x12, 0x06, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x07,
+  0xf7, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00, 0x05, 0xf0, 0x00, 0x01, 0x11, 0x15, 0xfd,
+  0x12, 0x00, 0x24, 0xff, 0x25, 0x00, 0x24, 0xfd, 0x12, 0x01, 0x15, 0x11, 0xed, 0x00,
+  0xed, 0x00, 0x01, 0x26, 0x15, 0xf6, 0x12, 0x00, 0x27, 0xfd, 0x28, 0x00, 0x29, 0xf4, 0x00, 0x07,   /* Row 24 */
+  0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf7, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0xfe,
+  0x24, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfe, 0x2c, 0x01, 0x2d, 0x07, 0xf7, 0x04, 0x02, 0x10, 0x0e,
+  0x07, 0xfe, 0x04, 0x00, 0x05, 0xf1, 0x00, 0xfc, 0x12, 0x00, 0x25, 0xfd, 0x2e, 0x00, 0x25, 0xfd,
+  0x12, 0x02, 0x2f, 0x30, 0x31, 0xef, 0x00,
+  0xee, 0x00, 0x01, 0x11, 0x15, 0xf5, 0x12, 0x01, 0x32, 0x30, 0xfe, 0x28, 0x01, 0x33, 0x28, 0xf6,   /* Row 25 */
+  0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf6, 0x04, 0x01, 0x34, 0x15, 0xfe,
+  0x12, 0x00, 0x25, 0xfe, 0x2e, 0x00, 0x25, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfd, 0x2c, 0x01, 0x2d,
+  0x07, 0xf7, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00, 0x05, 0xf3, 0x00, 0x01, 0x11, 0x15,
+  0xfe, 0x12, 0x00, 0x36, 0xfb, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x03, 0x15, 0x37, 0x28, 0x31, 0xf0,
+  0x00,
+  0xee, 0x00, 0xfc, 0x12, 0x00, 0x36, 0xff, 0x38, 0x00, 0x25, 0xfc, 0x12, 0x01, 0x15, 0x39, 0xfd,   /* Row 26 */
+  0x28, 0x01, 0x33, 0x29, 0xf8, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf6,
+  0x04, 0x01, 0x3a, 0x3b, 0xfe, 0x12, 0x01, 0x15, 0x3c, 0xfd, 0x2e, 0x00, 0x25, 0xfd, 0x12, 0x01,
+  0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x2d, 0x07, 0xf7, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00,
+  0x05, 0xf4, 0x00, 0xfc, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x00, 0x39, 0xff,
+  0x28, 0x00, 0x31, 0xf1, 0x00,
+  0xef, 0x00, 0x01, 0x11, 0x15, 0xfe, 0x12, 0x00, 0x25, 0xfd, 0x2e, 0x00, 0x25, 0xfc, 0x12, 0x01,   /* Row 27 */
+  0x32, 0x30, 0xfc, 0x28, 0xf9, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf5,
+  0x04, 0x01, 0x13, 0x18, 0xfe, 0x12, 0x00, 0x25, 0xfb, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15,
+  0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf6, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00, 0x05, 0xf6,
+  0x00, 0x01, 0x11, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x00, 0x39,
+  0xfe, 0x28, 0xf1, 0x00,
+  0xef, 0x00, 0xfd, 0x12, 0x00, 0x36, 0xfc, 0x2e, 0x01, 0x3c, 0x24, 0xfd, 0x12, 0x01, 0x15, 0x39,   /* Row 28 */
+  0xfd, 0x28, 0x01, 0x33, 0x29, 0xfb, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06,
+  0xf4, 0x04, 0x01, 0x13, 0x18, 0xfe, 0x12, 0x00, 0x3d, 0xfb, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01,
+  0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf6, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00,
+  0x05, 0xf7, 0x00, 0xfc, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x37,
+  0xff, 0x28, 0x01, 0x33, 0x29, 0xf2, 0x00,
+  0xef, 0x00, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x32, 0x30, 0xfc,   /* Row 29 */
+  0x28, 0xfc, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf3, 0x04, 0x01, 0x13,
+  0x18, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c,
+  0x00, 0x23, 0xf5, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00, 0x05, 0xf9, 0x00, 0x01, 0x11,
+  0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30, 0xfd, 0x28,
+  0xf2, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x39, 0xfd,   /* Row 30 */
+  0x28, 0x01, 0x33, 0x29, 0xfe, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf2,
+  0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a,
+  0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf5, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00, 0x05,
+  0xfa, 0x00, 0xfc, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x39, 0xfc,
+  0x28, 0x00, 0x3f, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x32, 0x30, 0xfc,   /* Row 31 */
+  0x28, 0xff, 0x00, 0x07, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf1, 0x04, 0x01, 0x13,
+  0x18, 0xff, 0x12, 0x00, 0x24, 0xf8, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c,
+  0x00, 0x23, 0xf4, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00, 0x05, 0xfc, 0x00, 0x01, 0x11,
+  0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30, 0xfc, 0x28,
+  0x00, 0x29, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf8, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x39, 0xfd,   /* Row 32 */
+  0x28, 0x09, 0x33, 0x29, 0x01, 0x02, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xf0, 0x04, 0x01, 0x13,
+  0x18, 0xff, 0x12, 0x00, 0x24, 0xf8, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c,
+  0x01, 0x22, 0x3e, 0xf4, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00, 0x05, 0xfd, 0x00, 0xfc,
+  0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x39, 0xfb, 0x28, 0x00, 0x3f,
+  0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf8, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x32, 0x30, 0xfe,   /* Row 33 */
+  0x28, 0x08, 0x40, 0x41, 0x0f, 0x06, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xef, 0x04, 0x01, 0x13, 0x18,
+  0xff, 0x12, 0x00, 0x24, 0xf7, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00,
+  0x23, 0xf3, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x00, 0x05, 0xff, 0x00, 0x01, 0x11, 0x15,
+  0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb, 0x28, 0xf2,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf7, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x39, 0xff,   /* Row 34 */
+  0x28, 0x08, 0x40, 0x42, 0x43, 0x44, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0xee, 0x04, 0x01, 0x13, 0x18,
+  0xff, 0x12, 0x00, 0x24, 0xf7, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01,
+  0x22, 0x3e, 0xf3, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x01, 0x05, 0x00, 0xfc, 0x12, 0x00,
+  0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x45, 0x46, 0xfc, 0x28, 0x01, 0x33, 0x29, 0xf2,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf7, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x0a, 0x32, 0x30, 0x40,   /* Row 35 */
+  0x42, 0x43, 0x2c, 0x22, 0x47, 0x0b, 0x0f, 0x06, 0xed, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00,
+  0x24, 0xf6, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf2, 0x04,
+  0x02, 0x10, 0x0e, 0x07, 0xfe, 0x04, 0x01, 0x48, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00,
+  0x38, 0xfd, 0x12, 0x01, 0x32, 0x49, 0xfb, 0x28, 0xf1, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf6, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x03, 0x15, 0x39, 0x4a,   /* Row 36 */
+  0x43, 0xfe, 0x2c, 0x02, 0x4b, 0x4c, 0x06, 0xec, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24,
+  0xf6, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf2, 0x04,
+  0x05, 0x10, 0x0e, 0x07, 0x04, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe,
+  0x12, 0x01, 0x15, 0x39, 0xfc, 0x28, 0x01, 0x33, 0x29, 0xf1, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf6, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x4d, 0x4e, 0xfd,   /* Row 37 */
+  0x2c, 0x01, 0x4f, 0x50, 0xeb, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf5, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf1, 0x04, 0x04, 0x10, 0x0e, 0x07,
+  0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb,
+  0x28, 0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf5, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc,   /* Row 38 */
+  0x2c, 0x00, 0x51, 0xeb, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf5, 0x2e, 0x00, 0x38,
+  0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf1, 0x04, 0x02, 0x10, 0x52, 0x17,
+  0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x39, 0xfc, 0x28, 0x01,
+  0x33, 0x29, 0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf5, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd,   /* Row 39 */
+  0x2c, 0x01, 0x22, 0x3e, 0xec, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf4, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf0, 0x04, 0x01, 0x53, 0x15, 0xfe,
+  0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb, 0x28, 0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf4, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc,   /* Row 40 */
+  0x2c, 0x00, 0x23, 0xec, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf4, 0x2e, 0x00, 0x38,
+  0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf2, 0x04, 0x01, 0x19, 0x17, 0xfd,
+  0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x39, 0xfc, 0x28, 0x01, 0x33,
+  0x29, 0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf4, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd,   /* Row 41 */
+  0x2c, 0x01, 0x22, 0x3e, 0xed, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf3, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf2, 0x04, 0x01, 0x16, 0x15, 0xfe,
+  0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb, 0x28, 0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf3, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc,   /* Row 42 */
+  0x2c, 0x00, 0x23, 0xed, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf3, 0x2e, 0x00, 0x38,
+  0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf4, 0x04, 0x01, 0x19, 0x17, 0xfd,
+  0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x39, 0xfc, 0x28, 0x01, 0x33,
+  0x29, 0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf3, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd,   /* Row 43 */
+  0x2c, 0x01, 0x22, 0x3e, 0xee, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00,
+  0x3d, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf4, 0x04,
+  0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30,
+  0xfb, 0x28, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf2, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc,   /* Row 44 */
+  0x2c, 0x00, 0x23, 0xee, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x54,
+  0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf6, 0x04,
+  0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x39,
+  0xfc, 0x28, 0x01, 0x33, 0x29, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x3d, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12,   /* Row 45 */
+  0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xef, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00,
+  0x24, 0xfa, 0x2e, 0x01, 0x24, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc,
+  0x2c, 0x00, 0x23, 0xf6, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38,
+  0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb, 0x28, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x54, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12,   /* Row 46 */
+  0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xef, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24,
+  0xfa, 0x2e, 0x01, 0x24, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c,
+  0x01, 0x22, 0x3e, 0xf8, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36,
+  0xfe, 0x12, 0x01, 0x15, 0x39, 0xfc, 0x28, 0x01, 0x33, 0x29, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x01, 0x24, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc,   /* Row 47 */
+  0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf0, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12,
+  0x00, 0x24, 0xfa, 0x2e, 0x02, 0x24, 0x12, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15,
+  0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf8, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e,
+  0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb, 0x28, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x01, 0x24, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd,   /* Row 48 */
+  0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf0, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00,
+  0x24, 0xfa, 0x2e, 0x02, 0x24, 0x12, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b,
+  0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xfa, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e,
+  0x00, 0x36, 0xfe, 0x12, 0x02, 0x15, 0x55, 0x33, 0xfd, 0x28, 0x01, 0x33, 0x29, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x02, 0x24, 0x12, 0x38, 0xfb, 0x2e, 0x00, 0x38,   /* Row 49 */
+  0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf1, 0x04, 0x01, 0x13, 0x18, 0xff,
+  0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe,
+  0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xfa, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00,
+  0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x03, 0x2a, 0x56, 0x42, 0x40, 0xfd, 0x28, 0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x02, 0x24, 0x12, 0x36, 0xfa, 0x2e, 0x00, 0x36,   /* Row 50 */
+  0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf1, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12,
+  0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12,
+  0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xfc, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00,
+  0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x08, 0x15, 0x35, 0x2c, 0x43, 0x42, 0x40, 0x28, 0x33,
+  0x29, 0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x00, 0x38, 0xfb, 0x2e,   /* Row 51 */
+  0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf2, 0x04, 0x01, 0x13,
+  0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xfc, 0x04, 0x01, 0x16, 0x15, 0xfe,
+  0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xff, 0x2c, 0x03, 0x43,
+  0x42, 0x40, 0x28, 0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x00, 0x36, 0xfa, 0x2e,   /* Row 52 */
+  0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf2, 0x04, 0x01, 0x13, 0x18,
+  0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38,
+  0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xfe, 0x04, 0x01, 0x19, 0x17, 0xfd,
+  0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfd, 0x2c, 0x02, 0x43,
+  0x57, 0x29, 0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xfe, 0x12, 0x00, 0x38, 0xfb, 0x2e,   /* Row 53 */
+  0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf3, 0x04, 0x01, 0x13,
+  0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xfe, 0x04, 0x01, 0x16, 0x15, 0xfe,
+  0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x01, 0x58,
+  0x59, 0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e,   /* Row 54 */
+  0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf3, 0x04, 0x01, 0x13, 0x18,
+  0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfd, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38,
+  0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x04, 0x22, 0x3e, 0x04, 0x19, 0x17, 0xfd, 0x12, 0x00,
+  0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x02, 0x5a, 0x3e, 0x05,
+  0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e,   /* Row 55 */
+  0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf4, 0x04, 0x01, 0x13,
+  0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfc, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x03, 0x23, 0x04, 0x16, 0x15, 0xfe, 0x12, 0x00,
+  0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x01, 0x21, 0x5b, 0xff,
+  0x04, 0x00, 0x05, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xfd, 0x12, 0x00, 0x36, 0xfa, 0x2e,   /* Row 56 */
+  0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf4, 0x04, 0x01, 0x13, 0x18,
+  0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfc, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38,
+  0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x02, 0x22, 0x5c, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfa,
+  0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x02, 0x5d, 0x0e, 0x07, 0xff, 0x04,
+  0x00, 0x05, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xfc, 0x12, 0x00, 0x38, 0xfb, 0x2e,   /* Row 57 */
+  0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf5, 0x04, 0x01, 0x13,
+  0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfb, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x01, 0x5e, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa,
+  0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x04, 0x22, 0x3e, 0x10, 0x0e, 0x07,
+  0xff, 0x04, 0x00, 0x05, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xfc, 0x12, 0x00, 0x36, 0xfa, 0x2e,   /* Row 58 */
+  0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf5, 0x04, 0x01, 0x13, 0x18,
+  0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfb, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38,
+  0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfe, 0x2c, 0x01, 0x2b, 0x2a, 0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e,
+  0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x00, 0x23, 0xff, 0x04, 0x02, 0x10, 0x0e,
+  0x07, 0xff, 0x04, 0x00, 0x05, 0xee, 0x00,
+  0xf0, 0x00, 0x00, 0x5f, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xfb, 0x12, 0x00, 0x38,   /* Row 59 */
+  0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf6, 0x04,
+  0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfa, 0x12, 0x00, 0x38, 0xfa,
+  0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfe, 0x2c, 0x01, 0x35, 0x15, 0xfe, 0x12, 0x00,
+  0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xfe,
+  0x04, 0x02, 0x10, 0x0e, 0x07, 0xff, 0x04, 0x00, 0x05, 0xef, 0x00,
+  0xf1, 0x00, 0x02, 0x01, 0x60, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xfb, 0x12,   /* Row 60 */
+  0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf6,
+  0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x15,
+  0x2f, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x04, 0x2a, 0x2b, 0x2c, 0x2b,
+  0x2a, 0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c,
+  0x00, 0x23, 0xfc, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xff, 0x04, 0x00, 0x05, 0xf0, 0x00,
+  0xf2, 0x00, 0x03, 0x01, 0x02, 0x61, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xfa,   /* Row 61 */
+  0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22,
+  0x3e, 0xf7, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12,
+  0x02, 0x62, 0x63, 0x15, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x04, 0x15,
+  0x35, 0x2c, 0x35, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a,
+  0x2b, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xfb, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xff, 0x04, 0x00, 0x05,
+  0xf1, 0x00,
+  0xf3, 0x00, 0x04, 0x01, 0x02, 0x06, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24,   /* Row 62 */
+  0xfa, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00,
+  0x23, 0xf7, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12,
+  0x02, 0x62, 0x64, 0x2a, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x02, 0x2a,
+  0x65, 0x2a, 0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb,
+  0x2c, 0x00, 0x23, 0xf9, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xff, 0x04, 0x00, 0x05, 0xf2, 0x00,
+  0xf4, 0x00, 0x05, 0x01, 0x02, 0x06, 0x07, 0x66, 0x62, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00,   /* Row 63 */
+  0x24, 0xff, 0x12, 0x01, 0x15, 0x2f, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12,
+  0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf8, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00,
+  0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x03, 0x62, 0x67, 0x35, 0x15, 0xfe, 0x12, 0x00, 0x38,
+  0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x02, 0x15, 0x62, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e,
+  0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xf8, 0x04, 0x02, 0x10,
+  0x0e, 0x07, 0xff, 0x04, 0x00, 0x05, 0xf3, 0x00,
+  0xf5, 0x00, 0x06, 0x01, 0x02, 0x06, 0x07, 0x68, 0x69, 0x6a, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e,   /* Row 64 */
+  0x00, 0x24, 0xff, 0x12, 0x02, 0x62, 0x63, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36,
+  0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf8, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12,
+  0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x03, 0x62, 0x67, 0x2b, 0x2a, 0xfe, 0x12, 0x00,
+  0x36, 0xfa, 0x2e, 0x00, 0x38, 0xf8, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01,
+  0x15, 0x35, 0xfb, 0x2c, 0x00, 0x23, 0xf6, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xff, 0x04, 0x00, 0x05,
+  0xf4, 0x00,
+  0xf6, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x68, 0x6b, 0x6c, 0x1d, 0xff, 0x12, 0x00, 0x24, 0xf9,   /* Row 65 */
+  0x2e, 0x00, 0x24, 0xff, 0x12, 0x02, 0x62, 0x64, 0x2a, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00,
+  0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xf9, 0x04, 0x01, 0x13, 0x18,
+  0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x04, 0x62, 0x67, 0x2c, 0x35, 0x15,
+  0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfa, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38,
+  0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xf5, 0x04, 0x02, 0x10, 0x0e, 0x07,
+  0xff, 0x04, 0x00, 0x05, 0xf5, 0x00,
+  0xf7, 0x00, 0x08, 0x01, 0x02, 0x06, 0x07, 0x68, 0x6b, 0x6d, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24,   /* Row 66 */
+  0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x03, 0x62, 0x67, 0x35, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa,
+  0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xf9, 0x04, 0x01, 0x13,
+  0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x04, 0x62, 0x67, 0x2c, 0x2b,
+  0x2a, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfa, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x00, 0x23, 0xf3, 0x04, 0x02, 0x10, 0x0e, 0x07,
+  0xff, 0x04, 0x00, 0x05, 0xf6, 0x00,
+  0xf8, 0x00, 0x09, 0x01, 0x02, 0x06, 0x07, 0x68, 0x6b, 0x6d, 0x04, 0x13, 0x18, 0xff, 0x12, 0x00,   /* Row 67 */
+  0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x03, 0x62, 0x67, 0x2b, 0x2a, 0xfd, 0x12, 0x00, 0x38,
+  0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e, 0xfa, 0x04,
+  0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67,
+  0xff, 0x2c, 0x01, 0x35, 0x15, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfc, 0x12, 0x00,
+  0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xf2,
+  0x04, 0x02, 0x10, 0x0e, 0x07, 0xff, 0x04, 0x00, 0x05, 0xf7, 0x00,
+  0xf9, 0x00, 0x06, 0x01, 0x02, 0x06, 0x07, 0x68, 0x6b, 0x6d, 0xff, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 68 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x04, 0x62, 0x67, 0x2c, 0x35, 0x15, 0xfe,
+  0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23,
+  0xfa, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01,
+  0x62, 0x67, 0xff, 0x2c, 0x01, 0x2b, 0x2a, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfc,
+  0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x00, 0x23,
+  0xf0, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xff, 0x04, 0x00, 0x05, 0xf8, 0x00,
+  0xfa, 0x00, 0x06, 0x01, 0x02, 0x06, 0x07, 0x68, 0x6b, 0x6d, 0xfe, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 69 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x04, 0x62, 0x67, 0x2c, 0x2b, 0x2a, 0xfd,
+  0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22,
+  0x3e, 0xfb, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12,
+  0x01, 0x62, 0x67, 0xfe, 0x2c, 0x01, 0x35, 0x15, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36,
+  0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x01,
+  0x22, 0x3e, 0xef, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xff, 0x04, 0x00, 0x05, 0xf9, 0x00,
+  0xfb, 0x00, 0x06, 0x01, 0x02, 0x06, 0x07, 0x68, 0x6b, 0x6d, 0xfd, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 70 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xff, 0x2c, 0x01, 0x35,
+  0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c,
+  0x00, 0x23, 0xfb, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff,
+  0x12, 0x01, 0x62, 0x67, 0xfe, 0x2c, 0x01, 0x2b, 0x2a, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00,
+  0x38, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c,
+  0x00, 0x23, 0xed, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xff, 0x04, 0x00, 0x05, 0xfa, 0x00,
+  0xfc, 0x00, 0x06, 0x01, 0x02, 0x06, 0x07, 0x68, 0x6b, 0x6d, 0xfc, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 71 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xff, 0x2c, 0x01, 0x2b,
+  0x2a, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c,
+  0x01, 0x22, 0x3e, 0xfc, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24,
+  0xff, 0x12, 0x01, 0x62, 0x67, 0xfd, 0x2c, 0x01, 0x35, 0x15, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e,
+  0x02, 0x36, 0x12, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x01,
+  0x22, 0x3e, 0xec, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xff, 0x04, 0x00, 0x05, 0xfb, 0x00,
+  0xfd, 0x00, 0x06, 0x01, 0x02, 0x06, 0x07, 0x68, 0x6b, 0x6d, 0xfb, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 72 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfe, 0x2c, 0x01, 0x35,
+  0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c,
+  0x00, 0x23, 0xfc, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff,
+  0x12, 0x01, 0x62, 0x67, 0xfd, 0x2c, 0x01, 0x2b, 0x2a, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x02,
+  0x38, 0x12, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x00, 0x23,
+  0xea, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xff, 0x04, 0x00, 0x05, 0xfc, 0x00,
+  0xfe, 0x00, 0x06, 0x01, 0x02, 0x06, 0x07, 0x68, 0x6b, 0x6d, 0xfa, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 73 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfe, 0x2c, 0x01, 0x2b,
+  0x2a, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c,
+  0x01, 0x22, 0x3e, 0xfd, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24,
+  0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x35, 0x15, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e,
+  0x00, 0x6e, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x01, 0x22, 0x3e,
+  0xe9, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xff, 0x04, 0x00, 0x05, 0xfd, 0x00,
+  0xff, 0x00, 0x06, 0x01, 0x02, 0x06, 0x07, 0x68, 0x6b, 0x6d, 0xf9, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 74 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfd, 0x2c, 0x01, 0x35,
+  0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c,
+  0x00, 0x23, 0xfd, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff,
+  0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x2b, 0x6f, 0xfe, 0x12, 0x00, 0x36, 0xf2, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x00, 0x23, 0xe7, 0x04, 0x02, 0x10, 0x0e, 0x07,
+  0xff, 0x04, 0x00, 0x05, 0xfe, 0x00,
+  0x07, 0x00, 0x01, 0x02, 0x06, 0x07, 0x68, 0x6b, 0x6d, 0xf8, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12,   /* Row 75 */
+  0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfd, 0x2c, 0x01, 0x2b, 0x2a,
+  0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01,
+  0x22, 0x3e, 0xfe, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff,
+  0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x02, 0x20, 0x53, 0x15, 0xfe, 0x12, 0x00, 0x38, 0xf4, 0x2e,
+  0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xe6, 0x04, 0x02, 0x10,
+  0x0e, 0x07, 0xff, 0x04, 0x00, 0x05, 0xff, 0x00,
+  0x06, 0x01, 0x02, 0x06, 0x07, 0x68, 0x6b, 0x6d, 0xf7, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00,   /* Row 76 */
+  0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x35, 0x15, 0xfe,
+  0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23,
+  0xfe, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01,
+  0x62, 0x67, 0xfc, 0x2c, 0x02, 0x21, 0x70, 0x17, 0xfe, 0x12, 0x00, 0x36, 0xf4, 0x2e, 0x00, 0x36,
+  0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x00, 0x23, 0xe4, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xff,
+  0x04, 0x01, 0x05, 0x00,
+  0x05, 0x02, 0x06, 0x07, 0x68, 0x6b, 0x6d, 0xf6, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24,   /* Row 77 */
+  0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x2b, 0x6f, 0xfd, 0x12,
+  0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x22, 0x3e,
+  0xff, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01,
+  0x62, 0x67, 0xfc, 0x2c, 0x03, 0x21, 0x07, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x38, 0xf6, 0x2e, 0x00,
+  0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xe3, 0x04, 0x02, 0x10, 0x0e,
+  0x07, 0xff, 0x04, 0x00, 0x05,
+  0x04, 0x03, 0x07, 0x68, 0x6b, 0x6d, 0xf5, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9,   /* Row 78 */
+  0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x02, 0x20, 0x53, 0x15, 0xfe, 0x12,
+  0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x00, 0x23, 0xff,
+  0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62,
+  0x67, 0xfc, 0x2c, 0x03, 0x21, 0x07, 0x19, 0x17, 0xfe, 0x12, 0x00, 0x36, 0xf6, 0x2e, 0x00, 0x36,
+  0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x00, 0x23, 0xe1, 0x04, 0x02, 0x10, 0x0e, 0x07, 0xff,
+  0x04,
+  0x03, 0x04, 0x71, 0x72, 0x73, 0xf4, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e,   /* Row 79 */
+  0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x02, 0x21, 0x70, 0x17, 0xfd, 0x12, 0x00,
+  0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x04, 0x22, 0x3e, 0x04,
+  0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,
+  0x2c, 0x03, 0x21, 0x07, 0x04, 0x74, 0xfd, 0x12, 0x00, 0x38, 0xf8, 0x2e, 0x00, 0x3d, 0xfd, 0x12,
+  0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xe0, 0x04, 0x03, 0x10, 0x0e, 0x3e, 0x04,
+  0x03, 0x04, 0x07, 0x75, 0x08, 0xf4, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e,   /* Row 80 */
+  0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x03, 0x21, 0x07, 0x16, 0x15, 0xfe, 0x12,
+  0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x03, 0x23, 0x04,
+  0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,
+  0x2c, 0x03, 0x21, 0x07, 0x04, 0x74, 0xfd, 0x12, 0x00, 0x36, 0xf8, 0x2e, 0x00, 0x25, 0xfe, 0x12,
+  0x01, 0x15, 0x35, 0xfb, 0x2c, 0x00, 0x23, 0xde, 0x04, 0x02, 0x76, 0x77, 0x07,
+  0xff, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf5, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9,   /* Row 81 */
+  0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x03, 0x21, 0x07, 0x19, 0x17, 0xfd,
+  0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x03, 0x22,
+  0x3e, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67,
+  0xfc, 0x2c, 0x03, 0x21, 0x07, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xf9, 0x2e, 0x01, 0x3c, 0x15,
+  0xfe, 0x12, 0x01, 0x62, 0x78, 0xfc, 0x2c, 0x01, 0x21, 0x3e, 0xdf, 0x04, 0x03, 0x08, 0x0b, 0x4c,
+  0x03,
+  0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf6, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9,   /* Row 82 */
+  0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x04, 0x21, 0x07, 0x04, 0x16, 0x15,
+  0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x02,
+  0x23, 0x79, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67,
+  0xfc, 0x2c, 0x03, 0x21, 0x07, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xf7, 0x2e, 0x00, 0x36, 0xfe,
+  0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x01, 0x21, 0x3e, 0xe0, 0x04, 0x04, 0x08, 0x0b, 0x0f, 0x06,
+  0x04,
+  0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf7, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00,   /* Row 83 */
+  0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x04, 0x21, 0x07, 0x04,
+  0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2a, 0x2b, 0xfd,
+  0x2c, 0x02, 0x22, 0x7a, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01,
+  0x62, 0x67, 0xfc, 0x2c, 0x02, 0x21, 0x70, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xf7, 0x2e, 0x00, 0x38,
+  0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x00, 0x23, 0xe1, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06,
+  0x04, 0x05,
+  0x01, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf8, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12,   /* Row 84 */
+  0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21, 0x07,
+  0xff, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x01,
+  0x15, 0x35, 0xfc, 0x2c, 0x01, 0x7b, 0x18, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff,
+  0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x02, 0x20, 0x53, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xf5, 0x2e,
+  0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xe3, 0x04, 0x06, 0x08,
+  0x0b, 0x0f, 0x06, 0x04, 0x05, 0x00,
+  0xff, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf9, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 85 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21,
+  0x07, 0xff, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12,
+  0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x7c, 0x62, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24,
+  0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x2b, 0x6f, 0xfd, 0x12, 0x00, 0x38, 0xf5, 0x2e,
+  0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x00, 0x23, 0xe4, 0x04, 0x05, 0x08, 0x0b,
+  0x0f, 0x06, 0x04, 0x05, 0xff, 0x00,
+  0xfe, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xfa, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 86 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21,
+  0x07, 0xfe, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12,
+  0x01, 0x15, 0x35, 0xfd, 0x2c, 0x01, 0x67, 0x62, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24,
+  0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x35, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xf3, 0x2e,
+  0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xe6, 0x04, 0x05, 0x08,
+  0x0b, 0x0f, 0x06, 0x04, 0x05, 0xfe, 0x00,
+  0xfd, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xfb, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 87 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21,
+  0x07, 0xfe, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12,
+  0x01, 0x2a, 0x2b, 0xfe, 0x2c, 0x01, 0x67, 0x62, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24,
+  0xff, 0x12, 0x01, 0x62, 0x67, 0xfd, 0x2c, 0x01, 0x2b, 0x2a, 0xfd, 0x12, 0x00, 0x38, 0xf3, 0x2e,
+  0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x00, 0x23, 0xe7, 0x04, 0x05, 0x08, 0x0b,
+  0x0f, 0x06, 0x04, 0x05, 0xfd, 0x00,
+  0xfc, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xfc, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 88 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21,
+  0x07, 0xfd, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12,
+  0x01, 0x15, 0x35, 0xfe, 0x2c, 0x01, 0x67, 0x62, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24,
+  0xff, 0x12, 0x01, 0x62, 0x67, 0xfd, 0x2c, 0x01, 0x35, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xf1, 0x2e,
+  0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xe9, 0x04, 0x05, 0x08,
+  0x0b, 0x0f, 0x06, 0x04, 0x05, 0xfc, 0x00,
+  0xfb, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xfd, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 89 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21,
+  0x07, 0xfd, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12,
+  0x01, 0x2a, 0x2b, 0xff, 0x2c, 0x01, 0x67, 0x62, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24,
+  0xff, 0x12, 0x01, 0x62, 0x67, 0xfe, 0x2c, 0x01, 0x2b, 0x2a, 0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e,
+  0x01, 0x38, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x00, 0x23,
+  0xea, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xfb, 0x00,
+  0xfa, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xfe, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 90 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21,
+  0x07, 0xfc, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12,
+  0x01, 0x15, 0x35, 0xff, 0x2c, 0x01, 0x67, 0x62, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24,
+  0xff, 0x12, 0x01, 0x62, 0x67, 0xfe, 0x2c, 0x01, 0x35, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xf9, 0x2e,
+  0x02, 0x36, 0x12, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x01,
+  0x22, 0x3e, 0xec, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xfa, 0x00,
+  0xf9, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xff, 0x04, 0x01, 0x13, 0x18, 0xff,   /* Row 91 */
+  0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21,
+  0x07, 0xfc, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12,
+  0x04, 0x2a, 0x2b, 0x2c, 0x67, 0x62, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12,
+  0x01, 0x62, 0x67, 0xff, 0x2c, 0x01, 0x2b, 0x2a, 0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x38,
+  0xff, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x00,
+  0x23, 0xed, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xf9, 0x00,
+  0xf8, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x05, 0x07, 0x0e, 0x10, 0x04, 0x13, 0x18, 0xff, 0x12, 0x00,   /* Row 92 */
+  0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21, 0x07, 0xfb,
+  0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x04, 0x15,
+  0x35, 0x2c, 0x67, 0x62, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62,
+  0x67, 0xff, 0x2c, 0x01, 0x35, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xf9, 0x2e, 0x00, 0x36, 0xfe, 0x12,
+  0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x01, 0x22, 0x3e,
+  0xef, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xf8, 0x00,
+  0xf7, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x04, 0x07, 0x0e, 0x10, 0x79, 0x18, 0xff, 0x12, 0x00, 0x24,   /* Row 93 */
+  0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21, 0x07, 0xfb, 0x04,
+  0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x03, 0x2a, 0x2b,
+  0x67, 0x62, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x04, 0x62, 0x67, 0x2c,
+  0x2b, 0x2a, 0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x00, 0x36, 0xfa, 0x2e,
+  0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x00, 0x23, 0xf0, 0x04, 0x05, 0x08, 0x0b,
+  0x0f, 0x06, 0x04, 0x05, 0xf7, 0x00,
+  0xf6, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x07, 0x0e, 0x7d, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9,   /* Row 94 */
+  0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21, 0x07, 0xfa, 0x04, 0x01,
+  0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x03, 0x15, 0x35, 0x67,
+  0x62, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x04, 0x62, 0x67, 0x2c, 0x35,
+  0x15, 0xfe, 0x12, 0x00, 0x36, 0xf9, 0x2e, 0x00, 0x36, 0xfc, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xf2, 0x04, 0x05, 0x08, 0x0b,
+  0x0f, 0x06, 0x04, 0x05, 0xf6, 0x00,
+  0xf5, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x7e, 0x62, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e,   /* Row 95 */
+  0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21, 0x07, 0xfa, 0x04, 0x01, 0x19,
+  0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x02, 0x2a, 0x64, 0x62, 0xff,
+  0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x03, 0x62, 0x67, 0x2b, 0x2a, 0xfd, 0x12,
+  0x00, 0x38, 0xfa, 0x2e, 0x00, 0x38, 0xfb, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12,
+  0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x00, 0x23, 0xf3, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05,
+  0xf5, 0x00,
+  0xf4, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00,   /* Row 96 */
+  0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21, 0x07, 0xf9, 0x04, 0x01, 0x16, 0x15,
+  0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xfd, 0x12, 0x02, 0x15, 0x63, 0x62, 0xff, 0x12,
+  0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x03, 0x62, 0x67, 0x35, 0x15, 0xfe, 0x12, 0x00,
+  0x36, 0xf9, 0x2e, 0x00, 0x36, 0xfa, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01,
+  0x15, 0x35, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xf5, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05,
+  0xf4, 0x00,
+  0xf3, 0x00, 0x00, 0x05, 0xff, 0x04, 0x01, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00,   /* Row 97 */
+  0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21, 0x07, 0xf9, 0x04, 0x01, 0x19, 0x17,
+  0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfc, 0x12, 0x01, 0x2f, 0x15, 0xff, 0x12, 0x00,
+  0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x02, 0x62, 0x64, 0x2a, 0xfd, 0x12, 0x00, 0x38, 0xfa,
+  0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2f, 0x15, 0xff, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38,
+  0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x00, 0x23, 0xf6, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06,
+  0x04, 0x05, 0xf3, 0x00,
+  0xf2, 0x00, 0x03, 0x05, 0x04, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff,   /* Row 98 */
+  0x12, 0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21, 0x07, 0xf8, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12,
+  0x00, 0x36, 0xfa, 0x2e, 0x00, 0x36, 0xf9, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12,
+  0x02, 0x62, 0x63, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xf9, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x02, 0x15,
+  0x7f, 0x2a, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc,
+  0x2c, 0x01, 0x22, 0x3e, 0xf8, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xf2, 0x00,
+  0xf1, 0x00, 0x02, 0x05, 0x13, 0x18, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12,   /* Row 99 */
+  0x01, 0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21, 0x07, 0xf8, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00,
+  0x38, 0xfb, 0x2e, 0x00, 0x38, 0xf9, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01,
+  0x15, 0x2f, 0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x03, 0x2a, 0x2b, 0x35,
+  0x15, 0xff, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c,
+  0x00, 0x23, 0xf9, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xf1, 0x00,
+  0xf0, 0x00, 0x01, 0x80, 0x81, 0xff, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01,   /* Row 100 */
+  0x62, 0x67, 0xfc, 0x2c, 0x01, 0x21, 0x07, 0xf7, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36,
+  0xfa, 0x2e, 0x00, 0x36, 0xfa, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfa, 0x12, 0x00, 0x36,
+  0xf9, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x04, 0x15, 0x35, 0x2c, 0x2b, 0x2a, 0xfe, 0x12, 0x00, 0x38,
+  0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xfb, 0x04,
+  0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 101 */
+  0x2c, 0x01, 0x21, 0x07, 0xf7, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00,
+  0x38, 0xfa, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfa, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00,
+  0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xff, 0x2c, 0x01, 0x35, 0x15, 0xff, 0x12, 0x00, 0x36, 0xfa,
+  0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x00, 0x23, 0xfc, 0x04, 0x05, 0x08,
+  0x0b, 0x0f, 0x06, 0x04, 0x05, 0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 102 */
+  0x2c, 0x01, 0x21, 0x07, 0xf6, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00,
+  0x36, 0xfb, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfb, 0x12, 0x00, 0x36, 0xf9, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfe, 0x2c, 0x01, 0x2b, 0x2a, 0xfe, 0x12, 0x00, 0x38, 0xfa,
+  0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x01, 0x22, 0x3e, 0xfe, 0x04, 0x05,
+  0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 103 */
+  0x2c, 0x01, 0x21, 0x07, 0xf6, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00,
+  0x38, 0xfb, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfb, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00,
+  0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfd, 0x2c, 0x01, 0x35, 0x15, 0xff, 0x12, 0x00, 0x36, 0xfa,
+  0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x00, 0x23, 0xff, 0x04, 0x05, 0x08,
+  0x0b, 0x0f, 0x06, 0x04, 0x05, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 104 */
+  0x2c, 0x01, 0x21, 0x07, 0xf5, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00,
+  0x36, 0xfc, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfc, 0x12, 0x00, 0x36, 0xf9, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x01, 0x2b, 0x2a, 0xfe, 0x12, 0x00, 0x38, 0xfa,
+  0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x07, 0x22, 0x3e, 0x08, 0x0b, 0x0f,
+  0x06, 0x04, 0x05, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 105 */
+  0x2c, 0x01, 0x21, 0x07, 0xf5, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00,
+  0x38, 0xfc, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfc, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00,
+  0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb, 0x2c, 0x01, 0x5e, 0x15, 0xff, 0x12, 0x00, 0x36, 0xfa,
+  0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x05, 0x5d, 0x0b, 0x0f, 0x06, 0x04,
+  0x05, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 106 */
+  0x2c, 0x01, 0x21, 0x07, 0xf4, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00,
+  0x36, 0xfd, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfd, 0x12, 0x00, 0x36, 0xf9, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x02, 0x22, 0x5c, 0x17, 0xfe, 0x12, 0x00, 0x38,
+  0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfc, 0x2c, 0x04, 0x58, 0x82, 0x06, 0x04,
+  0x05, 0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 107 */
+  0x2c, 0x01, 0x21, 0x07, 0xf4, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00,
+  0x38, 0xfd, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfd, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00,
+  0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb, 0x2c, 0x03, 0x23, 0x04, 0x16, 0x15, 0xff, 0x12, 0x00,
+  0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfc, 0x2c, 0x02, 0x83, 0x07, 0x05,
+  0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 108 */
+  0x2c, 0x01, 0x21, 0x07, 0xf3, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfe, 0x12, 0x00, 0x36, 0xf9, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x04, 0x22, 0x3e, 0x04, 0x19, 0x17, 0xfe, 0x12,
+  0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfd, 0x2c, 0x02, 0x43, 0x84,
+  0x85, 0xe8, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 109 */
+  0x2c, 0x01, 0x21, 0x07, 0xf3, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00,
+  0x38, 0xfe, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00,
+  0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb, 0x2c, 0x00, 0x23, 0xfe, 0x04, 0x01, 0x16, 0x15, 0xff,
+  0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xff, 0x2c, 0x03, 0x43,
+  0x42, 0x40, 0x28, 0xe8, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 110 */
+  0x2c, 0x01, 0x21, 0x07, 0xf2, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00,
+  0x36, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x00, 0x36, 0xf9, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x01, 0x22, 0x3e, 0xfe, 0x04, 0x01, 0x19, 0x17,
+  0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x08, 0x15, 0x35, 0x2c, 0x43, 0x42,
+  0x40, 0x28, 0x33, 0x29, 0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 111 */
+  0x2c, 0x01, 0x21, 0x07, 0xf2, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00,
+  0x38, 0xff, 0x12, 0x00, 0x24, 0xfa, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00,
+  0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb, 0x2c, 0x00, 0x23, 0xfc, 0x04, 0x01, 0x16, 0x15, 0xff,
+  0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x03, 0x2a, 0x56, 0x42, 0x40, 0xfd, 0x28,
+  0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 112 */
+  0x2c, 0x01, 0x21, 0x07, 0xf1, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x02,
+  0x36, 0x12, 0x24, 0xfa, 0x2e, 0x02, 0x24, 0x12, 0x36, 0xf9, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01,
+  0x15, 0x35, 0xfb, 0x2c, 0x01, 0x22, 0x3e, 0xfc, 0x04, 0x01, 0x19, 0x17, 0xfe, 0x12, 0x00, 0x38,
+  0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x02, 0x15, 0x55, 0x33, 0xfd, 0x28, 0x01, 0x33, 0x29, 0xea,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 113 */
+  0x2c, 0x01, 0x21, 0x07, 0xf1, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x02,
+  0x38, 0x12, 0x24, 0xfa, 0x2e, 0x02, 0x24, 0x12, 0x38, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01,
+  0x2a, 0x2b, 0xfb, 0x2c, 0x00, 0x23, 0xfa, 0x04, 0x01, 0x16, 0x15, 0xff, 0x12, 0x00, 0x36, 0xfa,
+  0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb, 0x28, 0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 114 */
+  0x2c, 0x01, 0x21, 0x07, 0xf0, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x01,
+  0x36, 0x24, 0xfa, 0x2e, 0x01, 0x24, 0x36, 0xf9, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35,
+  0xfb, 0x2c, 0x01, 0x22, 0x3e, 0xfa, 0x04, 0x01, 0x19, 0x17, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e,
+  0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x39, 0xfc, 0x28, 0x01, 0x33, 0x29, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x67, 0xfc,   /* Row 115 */
+  0x2c, 0x01, 0x21, 0x07, 0xf0, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x01,
+  0x38, 0x24, 0xfa, 0x2e, 0x01, 0x24, 0x38, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b,
+  0xfb, 0x2c, 0x00, 0x23, 0xf8, 0x04, 0x01, 0x16, 0x15, 0xff, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00,
+  0x38, 0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb, 0x28, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x62, 0x86, 0xfc,   /* Row 116 */
+  0x2c, 0x01, 0x21, 0x07, 0xef, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00,
+  0x54, 0xfa, 0x2e, 0x00, 0x54, 0xf9, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c,
+  0x01, 0x22, 0x3e, 0xf8, 0x04, 0x01, 0x19, 0x17, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36,
+  0xfe, 0x12, 0x01, 0x15, 0x39, 0xfc, 0x28, 0x01, 0x33, 0x29, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x02, 0x2f, 0x87, 0x43,   /* Row 117 */
+  0xfd, 0x2c, 0x01, 0x21, 0x07, 0xef, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e,
+  0x00, 0x3d, 0xfa, 0x2e, 0x00, 0x3d, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb,
+  0x2c, 0x00, 0x23, 0xf6, 0x04, 0x01, 0x16, 0x15, 0xff, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38,
+  0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb, 0x28, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x03, 0x2f, 0x49, 0x42,   /* Row 118 */
+  0x43, 0xfe, 0x2c, 0x01, 0x4f, 0x88, 0xee, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00, 0x36, 0xeb,
+  0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x01, 0x22, 0x3e, 0xf6, 0x04, 0x01,
+  0x19, 0x17, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x39, 0xfc,
+  0x28, 0x01, 0x33, 0x29, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x04, 0x2f, 0x49, 0x40,   /* Row 119 */
+  0x42, 0x43, 0xff, 0x2c, 0x02, 0x4f, 0x2d, 0x10, 0xef, 0x04, 0x01, 0x19, 0x17, 0xfd, 0x12, 0x00,
+  0x38, 0xed, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb, 0x2c, 0x00, 0x23, 0xf4, 0x04,
+  0x01, 0x16, 0x15, 0xff, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30,
+  0xfb, 0x28, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x0a, 0x2f, 0x49, 0x28,   /* Row 120 */
+  0x40, 0x42, 0x43, 0x2c, 0x21, 0x89, 0x0e, 0x10, 0xef, 0x04, 0x01, 0x16, 0x15, 0xfe, 0x12, 0x00,
+  0x36, 0xed, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x01, 0x22, 0x3e, 0xf4,
+  0x04, 0x01, 0x8a, 0x8b, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15,
+  0x39, 0xfc, 0x28, 0x01, 0x33, 0x29, 0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xff,   /* Row 121 */
+  0x28, 0x03, 0x40, 0x42, 0x43, 0x21, 0xff, 0x07, 0x01, 0x0e, 0x10, 0xf0, 0x04, 0x01, 0x19, 0x17,
+  0xfd, 0x12, 0x00, 0x38, 0xef, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb, 0x2c, 0x00,
+  0x23, 0xf4, 0x04, 0x03, 0x08, 0x8c, 0x8d, 0x15, 0xff, 0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38,
+  0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb, 0x28, 0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfe,   /* Row 122 */
+  0x28, 0x07, 0x40, 0x42, 0x83, 0x07, 0x04, 0x07, 0x0e, 0x10, 0xf0, 0x04, 0x01, 0x16, 0x15, 0xfe,
+  0x12, 0x00, 0x36, 0xef, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x01, 0x22,
+  0x3e, 0xf5, 0x04, 0x04, 0x08, 0x0b, 0x0f, 0x8e, 0x17, 0xfe, 0x12, 0x00, 0x38, 0xfa, 0x2e, 0x00,
+  0x36, 0xfe, 0x12, 0x01, 0x15, 0x39, 0xfc, 0x28, 0x01, 0x33, 0x29, 0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfd,   /* Row 123 */
+  0x28, 0x02, 0x40, 0x8f, 0x90, 0xff, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf1, 0x04, 0x01, 0x19, 0x17,
+  0xfd, 0x12, 0x00, 0x38, 0xf1, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb, 0x2c, 0x00,
+  0x23, 0xf5, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x91, 0xfe, 0x12, 0x00, 0x36, 0xfa, 0x2e,
+  0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb, 0x28, 0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfc,   /* Row 124 */
+  0x28, 0x01, 0x40, 0x92, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf1, 0x04, 0x01, 0x16, 0x15, 0xfe,
+  0x12, 0x00, 0x36, 0xf1, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x01, 0x22,
+  0x3e, 0xf6, 0x04, 0x06, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0x93, 0xfd, 0x12, 0x00, 0x38, 0xfa,
+  0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x39, 0xfc, 0x28, 0x01, 0x33, 0x29, 0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 125 */
+  0x28, 0x01, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf2, 0x04, 0x01, 0x19, 0x17, 0xfd,
+  0x12, 0x00, 0x38, 0xf3, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb, 0x2c, 0x00, 0x23,
+  0xf6, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xff, 0x00, 0x01, 0x11, 0x15, 0xff, 0x12,
+  0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb, 0x28, 0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 126 */
+  0x28, 0xff, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf2, 0x04, 0x01, 0x16, 0x15,
+  0xfe, 0x12, 0x00, 0x36, 0xf3, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x01,
+  0x22, 0x3e, 0xf7, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xfd, 0x00, 0xfd, 0x12, 0x00,
+  0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x39, 0xfc, 0x28, 0x01, 0x33, 0x29, 0xf1,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 127 */
+  0x28, 0xfe, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf3, 0x04, 0x01, 0x19, 0x17,
+  0xfd, 0x12, 0x00, 0x38, 0xf5, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb, 0x2c, 0x00,
+  0x23, 0xf7, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xfc, 0x00, 0x01, 0x11, 0x15, 0xff,
+  0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb, 0x28, 0xf1, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 128 */
+  0x28, 0xfd, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf3, 0x04, 0x01, 0x16, 0x15,
+  0xfe, 0x12, 0x00, 0x36, 0xf5, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x01,
+  0x22, 0x3e, 0xf8, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xfa, 0x00, 0xfd, 0x12, 0x00,
+  0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x39, 0xfc, 0x28, 0x01, 0x33, 0x29, 0xf2,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 129 */
+  0x28, 0xfc, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf4, 0x04, 0x01, 0x19, 0x17,
+  0xfd, 0x12, 0x00, 0x38, 0xf7, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb, 0x2c, 0x00,
+  0x23, 0xf8, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xf9, 0x00, 0x01, 0x11, 0x15, 0xff,
+  0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x32, 0x30, 0xfb, 0x28, 0xf2, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 130 */
+  0x28, 0xfb, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf4, 0x04, 0x01, 0x16, 0x15,
+  0xfe, 0x12, 0x00, 0x36, 0xf7, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x01,
+  0x22, 0x3e, 0xf9, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xf7, 0x00, 0xfd, 0x12, 0x00,
+  0x38, 0xfa, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x37, 0xfc, 0x28, 0x01, 0x33, 0x94, 0xf3,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 131 */
+  0x28, 0xfa, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf5, 0x04, 0x01, 0x19, 0x17,
+  0xfd, 0x12, 0x00, 0x38, 0xf9, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb, 0x2c, 0x00,
+  0x23, 0xf9, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xf6, 0x00, 0x01, 0x11, 0x15, 0xff,
+  0x12, 0x00, 0x36, 0xfa, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x00, 0x39, 0xfb, 0x28, 0x00, 0x95, 0xf3,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 132 */
+  0x28, 0xf9, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf5, 0x04, 0x01, 0x16, 0x15,
+  0xfe, 0x12, 0x00, 0x36, 0xf9, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x01,
+  0x22, 0x3e, 0xfa, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xf4, 0x00, 0xfd, 0x12, 0x00,
+  0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x00, 0x39, 0xfa, 0x28, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 133 */
+  0x28, 0xf8, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf6, 0x04, 0x01, 0x19, 0x17,
+  0xfd, 0x12, 0x00, 0x38, 0xfb, 0x2e, 0x00, 0x38, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb, 0x2c, 0x00,
+  0x23, 0xfa, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xf3, 0x00, 0x01, 0x11, 0x15, 0xff,
+  0x12, 0x00, 0x36, 0xfb, 0x2e, 0x00, 0x38, 0xfe, 0x12, 0x01, 0x45, 0x96, 0xfb, 0x28, 0x01, 0x33,
+  0x94, 0xf4, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 134 */
+  0x28, 0xf7, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf6, 0x04, 0x01, 0x16, 0x15,
+  0xfe, 0x12, 0x01, 0x24, 0x97, 0xfd, 0x2e, 0x01, 0x97, 0x24, 0xfe, 0x12, 0x01, 0x15, 0x35, 0xfb,
+  0x2c, 0x01, 0x22, 0x3e, 0xfb, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xf1, 0x00, 0xfd,
+  0x12, 0x00, 0x38, 0xfc, 0x2e, 0x00, 0x36, 0xfe, 0x12, 0x01, 0x32, 0x49, 0xfa, 0x28, 0x00, 0x29,
+  0xf4, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 135 */
+  0x28, 0xf6, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf7, 0x04, 0x01, 0x19, 0x17,
+  0xfd, 0x12, 0x01, 0x24, 0x38, 0xff, 0x2e, 0x01, 0x38, 0x24, 0xfd, 0x12, 0x01, 0x2a, 0x2b, 0xfb,
+  0x2c, 0x00, 0x23, 0xfb, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xf0, 0x00, 0x01, 0x11,
+  0x15, 0xff, 0x12, 0x01, 0x24, 0x38, 0xff, 0x2e, 0x01, 0x38, 0x36, 0xfe, 0x12, 0x01, 0x15, 0x39,
+  0xf9, 0x28, 0x00, 0x29, 0xf4, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 136 */
+  0x28, 0xf5, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf7, 0x04, 0x01, 0x16, 0x15,
+  0xfc, 0x12, 0xff, 0x24, 0xfc, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x01, 0x22, 0x3e, 0xfc, 0x04,
+  0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xee, 0x00, 0xfc, 0x12, 0xff, 0x24, 0xfc, 0x12, 0x01,
+  0x32, 0x30, 0xf9, 0x28, 0x00, 0x3f, 0xf4, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 137 */
+  0x28, 0xf4, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf8, 0x04, 0x01, 0x19, 0x17,
+  0xf5, 0x12, 0x01, 0x2a, 0x2b, 0xfb, 0x2c, 0x00, 0x23, 0xfc, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06,
+  0x04, 0x05, 0xed, 0x00, 0x01, 0x11, 0x15, 0xf8, 0x12, 0x01, 0x2f, 0x46, 0xf8, 0x28, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x24, 0xff, 0x12, 0x01, 0x2f, 0x49, 0xfb,   /* Row 138 */
+  0x28, 0xf3, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf8, 0x04, 0x01, 0x16, 0x15,
+  0xf7, 0x12, 0x01, 0x15, 0x35, 0xfb, 0x2c, 0x01, 0x22, 0x3e, 0xfd, 0x04, 0x05, 0x08, 0x0b, 0x0f,
+  0x06, 0x04, 0x05, 0xeb, 0x00, 0xf8, 0x12, 0x01, 0x2f, 0x46, 0xf9, 0x28, 0x01, 0x33, 0x29, 0xf3,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x24, 0xf9, 0x2e, 0x00, 0x45, 0xff, 0x2f, 0x01, 0x98, 0x49, 0xfb,   /* Row 139 */
+  0x28, 0xf2, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf9, 0x04, 0x02, 0x13, 0x1b,
+  0x15, 0xf9, 0x12, 0x02, 0x15, 0x99, 0x67, 0xfb, 0x2c, 0x00, 0x23, 0xfd, 0x04, 0x05, 0x08, 0x0b,
+  0x0f, 0x06, 0x04, 0x05, 0xea, 0x00, 0x03, 0x93, 0x9a, 0x12, 0x15, 0xff, 0x12, 0x03, 0x15, 0x2f,
+  0x9b, 0x96, 0xf7, 0x28, 0xf2, 0x00,
+  0xe8, 0x00, 0xfc, 0x30, 0xfd, 0x49, 0xfa, 0x28, 0xf1, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07,   /* Row 140 */
+  0x0e, 0x10, 0xf9, 0x04, 0x03, 0x13, 0x16, 0x17, 0x15, 0xfd, 0x12, 0x03, 0x15, 0x2a, 0x35, 0x67,
+  0xfb, 0x2c, 0x01, 0x22, 0x3e, 0xfe, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xe6, 0x00,
+  0x05, 0x9c, 0x11, 0x9d, 0x37, 0x30, 0x40, 0xf8, 0x28, 0x01, 0x33, 0x29, 0xf2, 0x00,
+  0xe8, 0x00, 0xf1, 0x28, 0xf0, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf8, 0x04,   /* Row 141 */
+  0x02, 0x19, 0x16, 0x9e, 0xff, 0x62, 0x02, 0x4d, 0x35, 0x2b, 0xfa, 0x2c, 0x01, 0x21, 0x88, 0xfe,
+  0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xe3, 0x00, 0x00, 0x3f, 0xf6, 0x28, 0x01, 0x33,
+  0x28, 0xf1, 0x00,
+  0xe8, 0x00, 0xf1, 0x28, 0xef, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf7, 0x04,   /* Row 142 */
+  0x03, 0x13, 0x9f, 0xa0, 0x67, 0xfa, 0x2c, 0x02, 0x4f, 0xa1, 0x88, 0xfe, 0x04, 0x05, 0x08, 0x0b,
+  0x0f, 0x06, 0x04, 0x05, 0xe1, 0x00, 0x01, 0x29, 0x33, 0xf9, 0x28, 0x01, 0x33, 0x28, 0xf0, 0x00,
+  0xe8, 0x00, 0xf1, 0x28, 0xee, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf6, 0x04,   /* Row 143 */
+  0x02, 0x3e, 0x23, 0x22, 0xfc, 0x21, 0x02, 0xa1, 0x88, 0x07, 0xfe, 0x04, 0x05, 0x08, 0x0b, 0x0f,
+  0x06, 0x04, 0x05, 0xdf, 0x00, 0xf9, 0x28, 0x01, 0x33, 0x28, 0xef, 0x00,
+  0xe8, 0x00, 0xf1, 0x28, 0xed, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf5, 0x04,   /* Row 144 */
+  0xfa, 0x07, 0xfd, 0x04, 0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xde, 0x00, 0x00, 0x31, 0xfa,
+  0x28, 0x00, 0x29, 0xee, 0x00,
+  0xe8, 0x00, 0xf1, 0x28, 0xec, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xec, 0x04,   /* Row 145 */
+  0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xc1, 0x00,
+  0xe8, 0x00, 0xf1, 0x28, 0xeb, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xee, 0x04,   /* Row 146 */
+  0x05, 0x08, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xc0, 0x00,
+  0xc1, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf0, 0x04, 0x05, 0x08, 0x0b, 0x0f,   /* Row 147 */
+  0x06, 0x04, 0x05, 0xbf, 0x00,
+  0xc0, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf2, 0x04, 0x05, 0x08, 0x0b, 0x0f,   /* Row 148 */
+  0x06, 0x04, 0x05, 0xbe, 0x00,
+  0xbf, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf4, 0x04, 0x05, 0x08, 0x0b, 0x0f,   /* Row 149 */
+  0x06, 0x04, 0x05, 0xbd, 0x00,
+  0xbe, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf6, 0x04, 0x05, 0x08, 0x0b, 0x0f,   /* Row 150 */
+  0x06, 0x04, 0x05, 0xbc, 0x00,
+  0xbd, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xf8, 0x04, 0x05, 0x08, 0x0b, 0x0f,   /* Row 151 */
+  0x06, 0x04, 0x05, 0xbb, 0x00,
+  0xbc, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xfa, 0x04, 0x05, 0x08, 0x0b, 0x0f,   /* Row 152 */
+  0x06, 0x04, 0x05, 0xba, 0x00,
+  0xbb, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xfc, 0x04, 0x05, 0x08, 0x0b, 0x0f,   /* Row 153 */
+  0x06, 0x04, 0x05, 0xb9, 0x00,
+  0xba, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x07, 0x0e, 0x10, 0xfe, 0x04, 0x05, 0x08, 0x0b, 0x0f,   /* Row 154 */
+  0x06, 0x04, 0x05, 0xb8, 0x00,
+  0xb9, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x09, 0x07, 0x0e, 0x10, 0x04, 0x08, 0x0b, 0x0f, 0x06, 0x04,   /* Row 155 */
+  0x05, 0xb7, 0x00,
+  0xb8, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x07, 0x07, 0x0e, 0x76, 0x0b, 0x0f, 0x06, 0x04, 0x05, 0xb6,   /* Row 156 */
+  0x00,
+  0xb7, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x05, 0x07, 0xa2, 0x0f, 0x06, 0x04, 0x05, 0xb5, 0x00,         /* Row 157 */
+  0xb6, 0x00, 0x00, 0x05, 0xff, 0x04, 0x04, 0x03, 0xa3, 0x06, 0x04, 0x05, 0xb4, 0x00,               /* Row 158 */
+  0xb5, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x00, 0x05, 0xb3, 0x00                                        /* Row 159 */
+};
+
+static const uint32_t g_nuttx_rows[IMAGE_HEIGHT] =
+{
+      0,    12,    27,    44,    63,    84,   107,   130,   153,   176,                             /* Rows 0-9 */
+    199,   222,   245,   268,   291,   314,   337,   360,   383,   414,                             /* Rows 10-19 */
+    453,   494,   546,   598,   660,   731,   812,   897,   981,  1068,                             /* Rows 20-29 */
+   1150,  1235,  1319,  1401,  1482,  1563,  1637,  1712,  1779,  1847,                             /* Rows 30-39 */
+   1911,  1978,  2042,  2109,  2177,  2248,  2321,  2397,  2472,  2551,                             /* Rows 40-49 */
+   2631,  2714,  2799,  2883,  2966,  3048,  3133,  3217,  3303,  3390,                             /* Rows 50-59 */
+   3481,  3575,  3673,  3768,  3872,  3970,  4072,  4174,  4281,  4389,                             /* Rows 60-69 */
+   4499,  4609,  4719,  4827,  4935,  5037,  5141,  5241,  5342,  5439,                             /* Rows 70-79 */
+   5534,  5627,  5724,  5821,  5919,  6021,  6123,  6226,  6328,  6431,                             /* Rows 80-89 */
+   6538,  6647,  6755,  6862,  6964,  7066,  7164,  7262,  7362,  7457,                             /* Rows 90-99 */
+   7550,  7639,  7726,  7814,  7901,  7986,  8069,  8152,  8234,  8317,                             /* Rows 100-109 */
+   8402,  8488,  8570,  8651,  8727,  8805,  8879,  8955,  9028,  9098,                             /* Rows 110-119 */
+   9166,  9238,  9311,  9388,  9463,  9542,  9621,  9702,  9782,  9863,                             /* Rows 120-129 */
+   9943, 10024, 10105, 10182, 10265, 10347, 10433, 10505, 10569, 10634,                             /* Rows 130-139 */
+  10704, 10766, 10817, 10865, 10909, 10946, 10971, 10996, 11017, 11038,                             /* Rows 140-149 */
+  11059, 11080, 11101, 11122, 11143, 11164, 11183, 11200, 11215, 11229                              /* Rows 150-159 */
 };
 
 #elif CONFIG_EXAMPLES_NXIMAGE_BPP == 16
 
-static const struct pix_run_s g_nuttx[] =
+static const uint8_t g_nuttx_data[] =
 {
-  { 76,   0}, {  1,   1}, {  1,   2}, {  1,   3}, {  4,   4}, {  1,   5}, { 76,   0},              /* Row 0 */
-  { 75,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  2,   8}, {  3,   4}, {  1,   5},  /* Row 1 */
-  { 75,   0},
-  { 74,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  10}, {  1,  11},  /* Row 2 */
-  {  1,   8}, {  3,   4}, {  1,   5}, { 74,   0},
-  { 73,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 3 */
-  {  1,  14}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5}, { 73,   0},
-  { 72,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 4 */
-  {  1,   6}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5}, { 72,   0},
-  { 71,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 5 */
-  {  1,   6}, {  2,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 71,   0},
-  { 70,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 6 */
-  {  1,   6}, {  4,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 70,   0},
-  { 69,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 7 */
-  {  1,   6}, {  6,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 69,   0},
-  { 68,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 8 */
-  {  1,   6}, {  8,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 68,   0},
-  { 67,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 9 */
-  {  1,   6}, { 10,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 67,   0},
-  { 66,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 10 */
-  {  1,   6}, { 12,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 66,   0},
-  { 65,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 11 */
-  {  1,   6}, { 14,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 65,   0},
-  { 64,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 12 */
-  {  1,   6}, { 16,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 64,   0},
-  { 63,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 13 */
-  {  1,   6}, { 18,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 63,   0},
-  { 62,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 14 */
-  {  1,   6}, { 20,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 62,   0},
-  { 61,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 15 */
-  {  1,   6}, { 22,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 61,   0},
-  { 60,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 16 */
-  {  1,   6}, { 24,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 60,   0},
-  { 59,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 17 */
-  {  1,   6}, { 26,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 59,   0},
-  { 58,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 18 */
-  {  1,   6}, { 28,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 26,   0}, {  1,  17}, {  5,  18}, {  1,  17}, { 25,   0},
-  { 57,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 19 */
-  {  1,   6}, { 10,   4}, {  5,  19}, { 15,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8},
-  {  3,   4}, {  1,   5}, { 23,   0}, {  1,  20}, {  9,  18}, {  1,  20}, { 23,   0},
-  { 56,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},  /* Row 20 */
-  {  1,   6}, {  9,   4}, {  1,  19}, {  1,  21}, {  1,  22}, {  3,  23}, {  1,  22}, {  1,  21},
-  {  1,  24}, { 14,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 22,   0}, { 11,  18}, {  1,  20}, { 22,   0},
-  { 23,   0}, {  1,  17}, {  5,  18}, {  1,  25}, { 25,   0}, {  1,   1}, {  1,   2}, {  1,   6},  /* Row 21 */
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  9,   4}, {  1,  19}, {  1,  26},
-  {  7,  18}, {  1,  22}, {  1,  27}, { 14,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8},
-  {  3,   4}, {  1,   5}, { 20,   0}, {  1,  17}, { 12,  18}, {  1,  20}, { 21,   0},
-  { 21,   0}, {  1,  20}, {  9,  18}, {  1,  20}, { 22,   0}, {  1,   1}, {  1,   2}, {  1,   6},  /* Row 22 */
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  9,   4}, {  1,  19}, {  1,  26},
-  {  9,  18}, {  1,  28}, {  1,  27}, {  4,   8}, {  1,   7}, {  9,   4}, {  1,   7}, {  1,  16},
-  {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5}, { 19,   0}, { 14,  18}, { 21,   0},
-  { 21,   0}, { 11,  18}, {  1,  20}, { 20,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7},  /* Row 23 */
-  {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, { 10,   4}, {  1,  21}, { 11,  18}, {  1,  29},
-  {  1,  30}, {  2,  31}, {  1,  32}, {  1,  33}, {  1,   8}, {  9,   4}, {  1,   7}, {  1,  16},
-  {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5}, { 17,   0}, {  1,  17}, {  5,  18}, {  1,  34},
-  {  2,  35}, {  1,  34}, {  5,  18}, {  1,  17}, { 20,   0},
-  { 20,   0}, {  1,  36}, { 12,  18}, {  1,  37}, {  4,  38}, {  1,  39}, { 13,   0}, {  1,   1},  /* Row 24 */
-  {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, { 10,   4},
-  {  1,  24}, {  1,  22}, {  4,  18}, {  3,  34}, {  5,  18}, {  1,  40}, {  1,  41}, {  3,  31},
-  {  1,  42}, {  1,   8}, {  9,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4},
-  {  1,   5}, { 16,   0}, {  5,  18}, {  1,  43}, {  4,  44}, {  1,  43}, {  4,  18}, {  1,  35},
-  {  1,  45}, {  1,  46}, { 18,   0},
-  { 19,   0}, {  1,  17}, { 13,  18}, {  1,  47}, {  1,  45}, {  3,  38}, {  1,  48}, {  1,  38},  /* Row 25 */
-  { 11,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},
-  {  1,   6}, { 11,   4}, {  1,  49}, {  4,  18}, {  1,  35}, {  3,  44}, {  1,  43}, {  5,  18},
-  {  1,  50}, {  4,  31}, {  1,  42}, {  1,   8}, {  9,   4}, {  1,   7}, {  1,  16}, {  1,  15},
-  {  1,   8}, {  3,   4}, {  1,   5}, { 14,   0}, {  1,  17}, {  4,  18}, {  1,  34}, {  6,  44},
-  {  1,  34}, {  4,  18}, {  1,  51}, {  1,  38}, {  1,  46}, { 17,   0},
-  { 19,   0}, {  5,  18}, {  1,  34}, {  2,  52}, {  1,  35}, {  6,  18}, {  1,  53}, {  4,  38},  /* Row 26 */
-  {  1,  48}, {  1,  39}, {  9,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9},
-  {  1,  12}, {  1,  13}, {  1,   6}, { 11,   4}, {  1,   3}, {  1,  54}, {  4,  18}, {  1,  55},
-  {  4,  44}, {  1,  43}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  42}, {  1,   8},
-  {  9,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5}, { 13,   0},
-  {  5,  18}, {  1,  52}, {  6,  44}, {  1,  52}, {  4,  18}, {  1,  53}, {  2,  38}, {  1,  46},
-  { 16,   0},
-  { 18,   0}, {  1,  17}, {  4,  18}, {  1,  43}, {  4,  44}, {  1,  35}, {  5,  18}, {  1,  47},  /* Row 27 */
-  {  1,  45}, {  5,  38}, {  8,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9},
-  {  1,  12}, {  1,  13}, {  1,   6}, { 12,   4}, {  1,  19}, {  1,  23}, {  3,  18}, {  1,  35},
-  {  6,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, {  9,   4},
-  {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5}, { 11,   0}, {  1,  17},
-  {  4,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  53}, {  3,  38}, { 16,   0},
-  { 18,   0}, {  4,  18}, {  1,  34}, {  5,  44}, {  1,  55}, {  1,  34}, {  5,  18}, {  1,  53},  /* Row 28 */
-  {  4,  38}, {  1,  48}, {  1,  39}, {  6,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7},
-  {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, { 13,   4}, {  1,  19}, {  1,  23}, {  3,  18},
-  {  1,  52}, {  6,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32},
-  {  1,  56}, { 10,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5},
-  { 10,   0}, {  5,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  51}, {  2,  38},
-  {  1,  48}, {  1,  39}, { 15,   0},
-  { 18,   0}, {  4,  18}, {  1,  52}, {  6,  44}, {  1,  52}, {  5,  18}, {  1,  47}, {  1,  45},  /* Row 29 */
-  {  5,  38}, {  5,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12},
-  {  1,  13}, {  1,   6}, { 14,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44},
-  {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 10,   4}, {  1,   7},
-  {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5}, {  8,   0}, {  1,  17}, {  4,  18},
-  {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45}, {  4,  38}, { 15,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  5,  18}, {  1,  53}, {  4,  38},  /* Row 30 */
-  {  1,  48}, {  1,  39}, {  3,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9},
-  {  1,  12}, {  1,  13}, {  1,   6}, { 15,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34},
-  {  8,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56},
-  { 11,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5}, {  7,   0},
-  {  5,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  53}, {  5,  38}, {  1,   1},
-  { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  52}, {  5,  18}, {  1,  47}, {  1,  45},  /* Row 31 */
-  {  5,  38}, {  2,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12},
-  {  1,  13}, {  1,   6}, { 16,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  9,  44},
-  {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 11,   4}, {  1,   7},
-  {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5}, {  5,   0}, {  1,  17}, {  4,  18},
-  {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45}, {  5,  38}, {  1,  39},
-  { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  9,  44}, {  1,  34}, {  5,  18}, {  1,  53}, {  4,  38},  /* Row 32 */
-  {  1,  48}, {  1,  39}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12},
-  {  1,  13}, {  1,   6}, { 17,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  9,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, { 12,   4},
-  {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5}, {  4,   0}, {  5,  18},
-  {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  53}, {  6,  38}, {  1,   1}, { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  9,  44}, {  1,  52}, {  5,  18}, {  1,  47}, {  1,  45},  /* Row 33 */
-  {  3,  38}, {  1,  48}, {  1,  57}, {  1,  13}, {  1,   6}, {  1,   7}, {  1,   9}, {  1,  12},
-  {  1,  13}, {  1,   6}, { 18,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, { 10,  44},
-  {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 12,   4}, {  1,   7},
-  {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5}, {  2,   0}, {  1,  17}, {  4,  18},
-  {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45}, {  6,  38}, { 15,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, { 10,  44}, {  1,  34}, {  5,  18}, {  1,  53}, {  2,  38},  /* Row 34 */
-  {  1,  48}, {  1,  58}, {  1,  59}, {  1,  60}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},
-  {  1,   6}, { 19,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, { 10,  44}, {  1,  52},
-  {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, { 13,   4}, {  1,   7},
-  {  1,  16}, {  1,  15}, {  1,   8}, {  3,   4}, {  1,   5}, {  1,   0}, {  5,  18}, {  1,  52},
-  {  7,  44}, {  1,  34}, {  4,  18}, {  1,  61}, {  5,  38}, {  1,  48}, {  1,  39}, { 15,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, { 10,  44}, {  1,  52}, {  5,  18}, {  1,  47}, {  1,  45},  /* Row 35 */
-  {  1,  48}, {  1,  58}, {  1,  59}, {  1,  31}, {  1,  32}, {  1,  62}, {  1,  12}, {  1,  13},
-  {  1,   6}, { 20,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, { 11,  44}, {  1,  34},
-  {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 13,   4}, {  1,   7}, {  1,  16},
-  {  1,  15}, {  1,   8}, {  3,   4}, {  1,  63}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  52},
-  {  4,  18}, {  1,  47}, {  1,  45}, {  6,  38}, { 16,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, { 11,  44}, {  1,  34}, {  5,  18}, {  1,  64}, {  1,  58},  /* Row 36 */
-  {  1,  59}, {  3,  31}, {  1,  65}, {  1,  66}, {  1,   6}, { 21,   4}, {  1,  19}, {  1,  23},
-  {  2,  18}, {  1,  34}, { 11,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31},
-  {  1,  32}, {  1,  56}, { 14,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  1,   4},
-  {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  53},
-  {  5,  38}, {  1,  48}, {  1,  39}, { 16,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, { 11,  44}, {  1,  52}, {  5,  18}, {  1,  67}, {  1,  68},  /* Row 37 */
-  {  5,  31}, {  1,  69}, { 22,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, { 12,  44},
-  {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 14,   4}, {  1,   7},
-  {  1,  16}, {  1,  15}, {  1,   8}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  52},
-  {  4,  18}, {  1,  47}, {  1,  45}, {  6,  38}, { 17,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, { 12,  44}, {  1,  34}, {  5,  18}, {  1,  50}, {  5,  31},  /* Row 38 */
-  {  1,  70}, {  1,   7}, { 21,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, { 12,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, { 15,   4},
-  {  1,   7}, {  1,  16}, {  1,  71}, {  1,  67}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34},
-  {  4,  18}, {  1,  53}, {  5,  38}, {  1,  48}, {  1,  39}, { 17,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, { 12,  44}, {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41},  /* Row 39 */
-  {  4,  31}, {  1,  32}, {  1,  56}, { 21,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34},
-  { 13,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 16,   4},
-  {  1,  72}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45},
-  {  6,  38}, { 18,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, { 13,  44}, {  1,  34}, {  5,  18}, {  1,  50}, {  5,  31},  /* Row 40 */
-  {  1,  33}, {  1,   7}, { 20,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, { 13,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, { 15,   4},
-  {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  53},
-  {  5,  38}, {  1,  48}, {  1,  39}, { 18,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, { 13,  44}, {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41},  /* Row 41 */
-  {  4,  31}, {  1,  32}, {  1,  56}, { 20,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34},
-  { 14,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 14,   4},
-  {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45},
-  {  6,  38}, { 19,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, { 14,  44}, {  1,  34}, {  5,  18}, {  1,  50}, {  5,  31},  /* Row 42 */
-  {  1,  33}, {  1,   7}, { 19,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, { 14,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, { 13,   4},
-  {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  53},
-  {  5,  38}, {  1,  48}, {  1,  39}, { 19,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, { 14,  44}, {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41},  /* Row 43 */
-  {  4,  31}, {  1,  32}, {  1,  56}, { 19,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34},
-  {  7,  44}, {  1,  73}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33},
-  {  1,   7}, { 12,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18},
-  {  1,  47}, {  1,  45}, {  6,  38}, { 20,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, { 15,  44}, {  1,  34}, {  5,  18}, {  1,  50}, {  5,  31},  /* Row 44 */
-  {  1,  33}, {  1,   7}, { 18,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44},
-  {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32},
-  {  1,  56}, { 11,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34},
-  {  4,  18}, {  1,  53}, {  5,  38}, {  1,  48}, {  1,  39}, { 20,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  73}, {  6,  44}, {  1,  52}, {  5,  18},  /* Row 45 */
-  {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, { 18,   4}, {  1,  19}, {  1,  23},
-  {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18},
-  {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 10,   4}, {  1,  21}, {  4,  18}, {  1,  34},
-  {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45}, {  6,  38}, { 21,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18},  /* Row 46 */
-  {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 17,   4}, {  1,  19}, {  1,  23}, {  2,  18},
-  {  1,  34}, {  7,  44}, {  2,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41},
-  {  4,  31}, {  1,  32}, {  1,  56}, {  9,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52},
-  {  7,  44}, {  1,  34}, {  4,  18}, {  1,  53}, {  5,  38}, {  1,  48}, {  1,  39}, { 21,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  1,  52}, {  6,  44}, {  1,  52},  /* Row 47 */
-  {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, { 17,   4}, {  1,  19},
-  {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  1,  18}, {  1,  52}, {  7,  44},
-  {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, {  8,   4}, {  1,  21},
-  {  4,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45}, {  6,  38},
-  { 22,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  2,  34}, {  7,  44}, {  1,  34}, {  5,  18},  /* Row 48 */
-  {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 16,   4}, {  1,  19}, {  1,  23}, {  2,  18},
-  {  1,  34}, {  7,  44}, {  1,  34}, {  1,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18},
-  {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, {  7,   4}, {  1,  24}, {  1,  22},
-  {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  74}, {  1,  48}, {  4,  38},
-  {  1,  48}, {  1,  39}, { 22,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  1,  18}, {  1,  52}, {  6,  44},  /* Row 49 */
-  {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, { 16,   4},
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  52},
-  {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, {  6,   4},
-  {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  75},
-  {  1,  58}, {  1,  48}, {  4,  38}, { 23,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  1,  18}, {  1,  34}, {  7,  44},  /* Row 50 */
-  {  1,  34}, {  5,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 15,   4}, {  1,  19},
-  {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  34}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, {  5,   4},
-  {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50},
-  {  1,  31}, {  1,  59}, {  1,  58}, {  1,  48}, {  1,  38}, {  1,  48}, {  1,  39}, { 23,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  52}, {  6,  44},  /* Row 51 */
-  {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, { 15,   4},
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  3,  18}, {  1,  52},
-  {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, {  4,   4},
-  {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41},
-  {  2,  31}, {  1,  59}, {  1,  58}, {  1,  48}, {  1,  38}, { 24,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  34}, {  7,  44},  /* Row 52 */
-  {  1,  34}, {  5,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 14,   4}, {  1,  19},
-  {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  3,  18}, {  1,  34}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, {  3,   4},
-  {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50},
-  {  4,  31}, {  1,  59}, {  1,  76}, {  1,  39}, { 24,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  3,  18}, {  1,  52}, {  6,  44},  /* Row 53 */
-  {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, { 14,   4},
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  52},
-  {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, {  2,   4},
-  {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41},
-  {  5,  31}, {  1,  77}, {  1,  78}, { 24,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  3,  18}, {  1,  34}, {  7,  44},  /* Row 54 */
-  {  1,  34}, {  5,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 13,   4}, {  1,  19},
-  {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  34}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, {  1,   4},
-  {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50},
-  {  6,  31}, {  1,  32}, {  1,  56}, {  1,   5}, { 23,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  4,  18}, {  1,  52}, {  6,  44},  /* Row 55 */
-  {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, { 13,   4},
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18}, {  1,  52},
-  {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   4}, {  1,  21},
-  {  4,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  6,  31},
-  {  1,  79}, {  1,   7}, {  1,   4}, {  1,   5}, { 22,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  4,  18}, {  1,  34}, {  7,  44},  /* Row 56 */
-  {  1,  34}, {  5,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 12,   4}, {  1,  19},
-  {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18}, {  1,  34}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  80}, {  1,  22},
-  {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  6,  31}, {  1,  81},
-  {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, { 21,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  5,  18}, {  1,  52}, {  6,  44},  /* Row 57 */
-  {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, { 12,   4},
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  6,  18}, {  1,  52},
-  {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  82}, {  4,  18}, {  1,  34},
-  {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  32}, {  1,  56},
-  {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, { 20,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  5,  18}, {  1,  34}, {  7,  44},  /* Row 58 */
-  {  1,  34}, {  5,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, { 11,   4}, {  1,  19},
-  {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  6,  18}, {  1,  34}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  3,  31}, {  1,  41}, {  1,  40}, {  4,  18},
-  {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  6,  31}, {  1,  33}, {  2,   7},
-  {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, { 19,   0},
-  { 17,   0}, {  1,  83}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  6,  18}, {  1,  52},  /* Row 59 */
-  {  6,  44}, {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56},
-  { 11,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  7,  18},
-  {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  3,  31}, {  1,  50}, {  4,  18},
-  {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  32},
-  {  1,  56}, {  2,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5},
-  { 18,   0},
-  { 16,   0}, {  1,   1}, {  1,  84}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34},  /* Row 60 */
-  {  6,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18}, {  1,  50}, {  5,  31}, {  1,  33},
-  {  1,   7}, { 10,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  3,  18}, {  1,  85}, {  3,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40},
-  {  1,  41}, {  1,  31}, {  1,  41}, {  1,  40}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34},
-  {  4,  18}, {  1,  50}, {  6,  31}, {  1,  33}, {  1,   7}, {  3,   4}, {  1,   7}, {  1,  16},
-  {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, { 17,   0},
-  { 15,   0}, {  1,   1}, {  1,   2}, {  1,  86}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44},  /* Row 61 */
-  {  1,  34}, {  7,  18}, {  1,  52}, {  6,  44}, {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41},
-  {  4,  31}, {  1,  32}, {  1,  56}, { 10,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34},
-  {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  87}, {  4,  18}, {  1,  52}, {  7,  44},
-  {  1,  34}, {  4,  18}, {  1,  50}, {  1,  88}, {  1,  50}, {  4,  18}, {  1,  34}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  32}, {  1,  56}, {  5,   4},
-  {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, { 16,   0},
-  { 14,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,  89}, {  1,  23}, {  2,  18}, {  1,  34},  /* Row 62 */
-  {  8,  44}, {  1,  34}, {  7,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18}, {  1,  50},
-  {  5,  31}, {  1,  33}, {  1,   7}, {  9,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34},
-  {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  90}, {  1,  40}, {  3,  18}, {  1,  34},
-  {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  91}, {  1,  40}, {  4,  18}, {  1,  52},
-  {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  6,  31}, {  1,  33}, {  1,   7}, {  6,   4},
-  {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, { 15,   0},
-  { 13,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  71}, {  1,  29}, {  2,  18},  /* Row 63 */
-  {  1,  34}, {  8,  44}, {  1,  34}, {  3,  18}, {  1,  85}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, {  9,   4},
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  1,  50}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  29},
-  {  4,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31},
-  {  1,  32}, {  1,  56}, {  8,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4},
-  {  1,   5}, { 14,   0},
-  { 12,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  94}, {  1,  95},  /* Row 64 */
-  {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  87}, {  4,  18},
-  {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7},
-  {  8,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18},
-  {  1,  29}, {  1,  92}, {  1,  41}, {  1,  40}, {  3,  18}, {  1,  34}, {  7,  44}, {  1,  52},
-  {  9,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  6,  31}, {  1,  33},
-  {  1,   7}, {  9,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5},
-  { 13,   0},
-  { 11,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  97},  /* Row 65 */
-  {  1,  28}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  90},
-  {  1,  40}, {  4,  18}, {  1,  52}, {  6,  44}, {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41},
-  {  4,  31}, {  1,  32}, {  1,  56}, {  8,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34},
-  {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  1,  31}, {  1,  50}, {  4,  18},
-  {  1,  52}, {  7,  44}, {  1,  34}, {  7,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18},
-  {  1,  40}, {  1,  41}, {  5,  31}, {  1,  32}, {  1,  56}, { 11,   4}, {  1,   7}, {  1,  16},
-  {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, { 12,   0},
-  { 10,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  98},  /* Row 66 */
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  1,  50}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18}, {  1,  50},
-  {  5,  31}, {  1,  33}, {  1,   7}, {  7,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34},
-  {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  1,  31}, {  1,  41}, {  1,  40},
-  {  3,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  7,  18}, {  1,  52}, {  7,  44}, {  1,  34},
-  {  4,  18}, {  1,  50}, {  6,  31}, {  1,  33}, {  1,   7}, { 12,   4}, {  1,   7}, {  1,  16},
-  {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, { 11,   0},
-  {  9,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  98},  /* Row 67 */
-  {  1,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18},
-  {  1,  29}, {  1,  92}, {  1,  41}, {  1,  40}, {  4,  18}, {  1,  52}, {  6,  44}, {  1,  52},
-  {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, {  7,   4}, {  1,  19},
-  {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},
-  {  2,  31}, {  1,  50}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  5,  18}, {  1,  34},
-  {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  32}, {  1,  56},
-  { 14,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, { 10,   0},
-  {  8,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  98},  /* Row 68 */
-  {  2,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18},
-  {  1,  29}, {  1,  92}, {  1,  31}, {  1,  50}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  5,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, {  6,   4}, {  1,  19}, {  1,  23},
-  {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  2,  31},
-  {  1,  41}, {  1,  40}, {  3,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  5,  18}, {  1,  52},
-  {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  6,  31}, {  1,  33}, {  1,   7}, { 15,   4},
-  {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, {  9,   0},
-  {  7,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  98},  /* Row 69 */
-  {  3,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18},
-  {  1,  29}, {  1,  92}, {  1,  31}, {  1,  41}, {  1,  40}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, {  6,   4},
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  3,  31}, {  1,  50}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  3,  18},
-  {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  32},
-  {  1,  56}, { 17,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5},
-  {  8,   0},
-  {  6,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  98},  /* Row 70 */
-  {  4,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18},
-  {  1,  29}, {  1,  92}, {  2,  31}, {  1,  50}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  5,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, {  5,   4}, {  1,  19}, {  1,  23},
-  {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  3,  31},
-  {  1,  41}, {  1,  40}, {  3,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  3,  18}, {  1,  52},
-  {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  6,  31}, {  1,  33}, {  1,   7}, { 18,   4},
-  {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, {  7,   0},
-  {  5,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  98},  /* Row 71 */
-  {  5,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18},
-  {  1,  29}, {  1,  92}, {  2,  31}, {  1,  41}, {  1,  40}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, {  5,   4},
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  4,  31}, {  1,  50}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  1,  18},
-  {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  32},
-  {  1,  56}, { 20,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5},
-  {  6,   0},
-  {  4,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  98},  /* Row 72 */
-  {  6,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18},
-  {  1,  29}, {  1,  92}, {  3,  31}, {  1,  50}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  5,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, {  4,   4}, {  1,  19}, {  1,  23},
-  {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  4,  31},
-  {  1,  41}, {  1,  40}, {  3,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  1,  18}, {  1,  52},
-  {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  6,  31}, {  1,  33}, {  1,   7}, { 21,   4},
-  {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, {  5,   0},
-  {  3,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  98},  /* Row 73 */
-  {  7,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18},
-  {  1,  29}, {  1,  92}, {  3,  31}, {  1,  41}, {  1,  40}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, {  4,   4},
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  5,  31}, {  1,  50}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  99}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  32}, {  1,  56}, { 23,   4},
-  {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, {  4,   0},
-  {  2,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  98},  /* Row 74 */
-  {  8,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18},
-  {  1,  29}, {  1,  92}, {  4,  31}, {  1,  50}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  5,  18}, {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, {  3,   4}, {  1,  19}, {  1,  23},
-  {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  5,  31},
-  {  1,  41}, {  1,  67}, {  3,  18}, {  1,  34}, { 15,  44}, {  1,  34}, {  4,  18}, {  1,  50},
-  {  6,  31}, {  1,  33}, {  1,   7}, { 24,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8},
-  {  2,   4}, {  1,   5}, {  3,   0},
-  {  1,   0}, {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  98},  /* Row 75 */
-  {  9,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18},
-  {  1,  29}, {  1,  92}, {  4,  31}, {  1,  41}, {  1,  40}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, {  3,   4},
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  6,  31}, {  1,  72}, {  4,  18}, {  1,  52}, { 13,  44}, {  1,  52}, {  4,  18},
-  {  1,  40}, {  1,  41}, {  5,  31}, {  1,  32}, {  1,  56}, { 26,   4}, {  1,   7}, {  1,  16},
-  {  1,  15}, {  1,   8}, {  2,   4}, {  1,   5}, {  2,   0},
-  {  1,   1}, {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  98}, { 10,   4},  /* Row 76 */
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  5,  31}, {  1,  50}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18},
-  {  1,  50}, {  5,  31}, {  1,  33}, {  1,   7}, {  2,   4}, {  1,  19}, {  1,  23}, {  2,  18},
-  {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,  80},
-  {  1,  22}, {  3,  18}, {  1,  34}, { 13,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  6,  31},
-  {  1,  33}, {  1,   7}, { 27,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4},
-  {  1,   5}, {  1,   0},
-  {  1,   2}, {  1,   6}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  98}, { 11,   4}, {  1,  19},  /* Row 77 */
-  {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},
-  {  5,  31}, {  1,  41}, {  1,  67}, {  4,  18}, {  1,  52}, {  6,  44}, {  1,  52}, {  5,  18},
-  {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, {  2,   4}, {  1,  19}, {  1,  23},
-  {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31},
-  {  1,   8}, {  1,  21}, {  4,  18}, {  1,  52}, { 11,  44}, {  1,  52}, {  4,  18}, {  1,  40},
-  {  1,  41}, {  5,  31}, {  1,  32}, {  1,  56}, { 29,   4}, {  1,   7}, {  1,  16}, {  1,  15},
-  {  1,   8}, {  2,   4}, {  1,   5},
-  {  1,   3}, {  1,   8}, {  1,  93}, {  1,  96}, {  1,  98}, { 12,   4}, {  1,  19}, {  1,  23},  /* Row 78 */
-  {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31},
-  {  1,  72}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18}, {  1,  50}, {  5,  31},
-  {  1,  33}, {  1,   7}, {  1,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44},
-  {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,   8}, {  1,  24}, {  1,  22},
-  {  3,  18}, {  1,  34}, { 11,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  6,  31}, {  1,  33},
-  {  1,   7}, { 30,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,   8}, {  2,   4},
-  {  1,   4}, {  1,  33}, {  1, 100}, {  1,  98}, { 13,   4}, {  1,  19}, {  1,  23}, {  2,  18},  /* Row 79 */
-  {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,  80},
-  {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44}, {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41},
-  {  4,  31}, {  1,  32}, {  1,  56}, {  1,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34},
-  {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,   8}, {  1,   4},
-  {  1, 101}, {  4,  18}, {  1,  52}, {  9,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41},
-  {  5,  31}, {  1,  32}, {  1,  56}, { 32,   4}, {  1,   7}, {  1,  16}, {  1,  15}, {  1,  56},
-  {  1,   7},
-  {  1,   4}, {  1,   8}, {  1, 102}, {  1,   9}, {  1,   7}, { 12,   4}, {  1,  19}, {  1,  23},  /* Row 80 */
-  {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31},
-  {  1,   8}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18}, {  1,  50},
-  {  5,  31}, {  1,  33}, {  1,   7}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44},
-  {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,   8}, {  1,   4}, {  1, 101},
-  {  4,  18}, {  1,  34}, {  9,  44}, {  1,  35}, {  4,  18}, {  1,  50}, {  6,  31}, {  1,  33},
-  {  1,   7}, { 33,   4}, {  1,   7}, {  1, 103}, {  1,  10}, {  1,   8},
-  {  2,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, { 11,   4}, {  1,  19}, {  1,  23},  /* Row 81 */
-  {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31},
-  {  1,   8}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44}, {  1,  52}, {  5,  18},
-  {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1,  56}, {  1,  19}, {  1,  23}, {  2,  18},
-  {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,   8},
-  {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  8,  44}, {  1, 104}, {  4,  18}, {  1,  29},
-  {  1,  68}, {  6,  31}, {  1,  56}, { 33,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  66},
-  {  1,   3},
-  {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, { 10,   4}, {  1,  19}, {  1,  23},  /* Row 82 */
-  {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31},
-  {  1,   8}, {  1,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18},
-  {  1,  50}, {  5,  31}, {  1,  33}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  7,  44},
-  {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,   8}, {  1,  21}, {  4,  18},
-  {  1,  34}, { 10,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  6,  31}, {  1,  56}, { 32,   4},
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4},
-  {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  9,   4}, {  1,  19},  /* Row 83 */
-  {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},
-  {  6,  31}, {  1,   8}, {  1,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  32}, {  1, 105}, {  1,  23},
-  {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31},
-  {  1,  80}, {  1,  22}, {  4,  18}, {  1,  52}, { 10,  44}, {  1,  52}, {  4,  18}, {  1,  40},
-  {  1,  41}, {  5,  31}, {  1,  33}, {  1,   7}, { 30,   4}, {  1,   7}, {  1,   9}, {  1,  12},
-  {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5},
-  {  1,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  8,   4},  /* Row 84 */
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  6,  31}, {  1,   8}, {  2,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44},
-  {  1,  34}, {  5,  18}, {  1,  50}, {  5,  31}, {  1, 106}, {  1,  23}, {  2,  18}, {  1,  34},
-  {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,  72}, {  4,  18},
-  {  1,  34}, { 12,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  32}, {  1,  56},
-  { 29,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5},
-  {  1,   0},
-  {  2,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  7,   4},  /* Row 85 */
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  6,  31}, {  1,   8}, {  2,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52},
-  {  6,  44}, {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1, 107}, {  1,  29},
-  {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  5,  31},
-  {  1,  41}, {  1,  67}, {  4,  18}, {  1,  52}, { 12,  44}, {  1,  52}, {  4,  18}, {  1,  40},
-  {  1,  41}, {  5,  31}, {  1,  33}, {  1,   7}, { 27,   4}, {  1,   7}, {  1,   9}, {  1,  12},
-  {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, {  2,   0},
-  {  3,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  6,   4},  /* Row 86 */
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  6,  31}, {  1,   8}, {  3,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44},
-  {  1,  34}, {  5,  18}, {  1,  50}, {  4,  31}, {  1,  92}, {  1,  29}, {  2,  18}, {  1,  34},
-  {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  5,  31}, {  1,  50}, {  4,  18},
-  {  1,  34}, { 14,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  32}, {  1,  56},
-  { 26,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5},
-  {  3,   0},
-  {  4,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  5,   4},  /* Row 87 */
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  6,  31}, {  1,   8}, {  3,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52},
-  {  6,  44}, {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  3,  31}, {  1,  92}, {  1,  29},
-  {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  4,  31},
-  {  1,  41}, {  1,  40}, {  4,  18}, {  1,  52}, { 14,  44}, {  1,  52}, {  4,  18}, {  1,  40},
-  {  1,  41}, {  5,  31}, {  1,  33}, {  1,   7}, { 24,   4}, {  1,   7}, {  1,   9}, {  1,  12},
-  {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, {  4,   0},
-  {  5,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  4,   4},  /* Row 88 */
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  6,  31}, {  1,   8}, {  4,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44},
-  {  1,  34}, {  5,  18}, {  1,  50}, {  3,  31}, {  1,  92}, {  1,  29}, {  2,  18}, {  1,  34},
-  {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  4,  31}, {  1,  50}, {  4,  18},
-  {  1,  34}, { 16,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  32}, {  1,  56},
-  { 23,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5},
-  {  5,   0},
-  {  6,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  3,   4},  /* Row 89 */
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  6,  31}, {  1,   8}, {  4,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52},
-  {  6,  44}, {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  2,  31}, {  1,  92}, {  1,  29},
-  {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  3,  31},
-  {  1,  41}, {  1,  40}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  52}, {  1,  34}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  33}, {  1,   7}, { 21,   4},
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, {  6,   0},
-  {  7,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  2,   4},  /* Row 90 */
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  6,  31}, {  1,   8}, {  5,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44},
-  {  1,  34}, {  5,  18}, {  1,  50}, {  2,  31}, {  1,  92}, {  1,  29}, {  2,  18}, {  1,  34},
-  {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  3,  31}, {  1,  50}, {  4,  18},
-  {  1,  34}, {  8,  44}, {  1,  34}, {  1,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18},
-  {  1,  50}, {  5,  31}, {  1,  32}, {  1,  56}, { 20,   4}, {  1,   7}, {  1,   9}, {  1,  12},
-  {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, {  7,   0},
-  {  8,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  1,   4},  /* Row 91 */
-  {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  6,  31}, {  1,   8}, {  5,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52},
-  {  6,  44}, {  1,  52}, {  5,  18}, {  1,  40}, {  1,  41}, {  1,  31}, {  1,  92}, {  1,  29},
-  {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  2,  31},
-  {  1,  41}, {  1,  40}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  52}, {  2,  18}, {  1,  34},
-  {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  33}, {  1,   7},
-  { 18,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5},
-  {  8,   0},
-  {  9,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  1,  19},  /* Row 92 */
-  {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},
-  {  6,  31}, {  1,   8}, {  6,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  5,  18}, {  1,  50}, {  1,  31}, {  1,  92}, {  1,  29}, {  2,  18}, {  1,  34}, {  7,  44},
-  {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  2,  31}, {  1,  50}, {  4,  18}, {  1,  34},
-  {  8,  44}, {  1,  34}, {  3,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50},
-  {  5,  31}, {  1,  32}, {  1,  56}, { 17,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},
-  {  1,   6}, {  1,   4}, {  1,   5}, {  9,   0},
-  { 10,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,  19}, {  1,  23},  /* Row 93 */
-  {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31},
-  {  1,   8}, {  6,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44}, {  1,  52},
-  {  5,  18}, {  1,  40}, {  1,  41}, {  1,  92}, {  1,  29}, {  2,  18}, {  1,  34}, {  7,  44},
-  {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  1,  31}, {  1,  41}, {  1,  40}, {  4,  18},
-  {  1,  52}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18},
-  {  1,  40}, {  1,  41}, {  5,  31}, {  1,  33}, {  1,   7}, { 15,   4}, {  1,   7}, {  1,   9},
-  {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 10,   0},
-  { 11,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1, 108}, {  1,  23}, {  2,  18},  /* Row 94 */
-  {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,   8},
-  {  7,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18}, {  1,  50},
-  {  1,  92}, {  1,  29}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  1,  31}, {  1,  50}, {  4,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  5,  18},
-  {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  32}, {  1,  56},
-  { 14,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5},
-  { 11,   0},
-  { 12,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1, 109}, {  1,  29}, {  2,  18}, {  1,  34},  /* Row 95 */
-  {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,   8}, {  7,   4},
-  {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44}, {  1,  52}, {  5,  18}, {  1,  40},
-  {  1,  90}, {  1,  29}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29},
-  {  1,  92}, {  1,  41}, {  1,  40}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  52}, {  6,  18},
-  {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  33},
-  {  1,   7}, { 12,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4},
-  {  1,   5}, { 12,   0},
-  { 13,   0}, {  1,   5}, {  3,   4}, {  1,  89}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44},  /* Row 96 */
-  {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,   8}, {  8,   4}, {  1,  21},
-  {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18}, {  1,  87}, {  1,  29}, {  2,  18},
-  {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  1,  50}, {  4,  18},
-  {  1,  34}, {  8,  44}, {  1,  34}, {  7,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18},
-  {  1,  50}, {  5,  31}, {  1,  32}, {  1,  56}, { 11,   4}, {  1,   7}, {  1,   9}, {  1,  12},
-  {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 13,   0},
-  { 14,   0}, {  1,   5}, {  2,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44},  /* Row 97 */
-  {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,   8}, {  8,   4}, {  1,  24},
-  {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44}, {  1,  52}, {  5,  18}, {  1,  85}, {  3,  18},
-  {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  90}, {  1,  40}, {  4,  18},
-  {  1,  52}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  85}, {  3,  18}, {  1,  34}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  33}, {  1,   7}, {  9,   4},
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 14,   0},
-  { 15,   0}, {  1,   5}, {  1,   4}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44},  /* Row 98 */
-  {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,   8}, {  9,   4}, {  1,  21},
-  {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  8,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  2,  18}, {  1,  29}, {  1,  87}, {  4,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  4,  18},
-  {  1,  87}, {  1,  40}, {  3,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50},
-  {  5,  31}, {  1,  32}, {  1,  56}, {  8,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},
-  {  1,   6}, {  1,   4}, {  1,   5}, { 15,   0},
-  { 16,   0}, {  1,   5}, {  1,  19}, {  1,  23}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34},  /* Row 99 */
-  {  2,  18}, {  1,  29}, {  1,  92}, {  6,  31}, {  1,   8}, {  9,   4}, {  1,  24}, {  1,  22},
-  {  4,  18}, {  1,  52}, {  6,  44}, {  1,  52}, {  8,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  3,  18}, {  1,  85}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40},
-  {  1,  41}, {  1,  50}, {  3,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40},
-  {  1,  41}, {  5,  31}, {  1,  33}, {  1,   7}, {  6,   4}, {  1,   7}, {  1,   9}, {  1,  12},
-  {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 16,   0},
-  { 17,   0}, {  1, 110}, {  1, 111}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18},  /* Row 100 */
-  {  1,  29}, {  1,  92}, {  6,  31}, {  1,   8}, { 10,   4}, {  1,  21}, {  4,  18}, {  1,  34},
-  {  7,  44}, {  1,  34}, {  7,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  7,  18}, {  1,  34},
-  {  8,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  1,  31}, {  1,  41}, {  1,  40}, {  3,  18},
-  {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  32}, {  1,  56},
-  {  5,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5},
-  { 17,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 101 */
-  {  6,  31}, {  1,   8}, { 10,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  7,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  7,  18}, {  1,  52}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  2,  31}, {  1,  50}, {  3,  18}, {  1,  34},
-  {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  33}, {  1,   7},
-  {  3,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5},
-  { 18,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 102 */
-  {  6,  31}, {  1,   8}, { 11,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  6,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  6,  18}, {  1,  34}, {  8,  44}, {  1,  34},
-  {  4,  18}, {  1,  50}, {  3,  31}, {  1,  41}, {  1,  40}, {  3,  18}, {  1,  52}, {  7,  44},
-  {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  32}, {  1,  56}, {  2,   4}, {  1,   7},
-  {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 19,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 103 */
-  {  6,  31}, {  1,   8}, { 11,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  6,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  6,  18}, {  1,  52}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  4,  31}, {  1,  50}, {  3,  18}, {  1,  34},
-  {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  33}, {  2,   7},
-  {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 20,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 104 */
-  {  6,  31}, {  1,   8}, { 12,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  5,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18}, {  1,  34}, {  8,  44}, {  1,  34},
-  {  4,  18}, {  1,  50}, {  5,  31}, {  1,  41}, {  1,  40}, {  3,  18}, {  1,  52}, {  7,  44},
-  {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  32}, {  1,  56}, {  1,   9}, {  1,  12},
-  {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 21,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 105 */
-  {  6,  31}, {  1,   8}, { 12,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  5,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  5,  18}, {  1,  52}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  6,  31}, {  1,  82}, {  3,  18}, {  1,  34},
-  {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31}, {  1,  81}, {  1,  12},
-  {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 22,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 106 */
-  {  6,  31}, {  1,   8}, { 13,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  34}, {  8,  44}, {  1,  34},
-  {  4,  18}, {  1,  50}, {  6,  31}, {  1,  32}, {  1,  80}, {  1,  22}, {  3,  18}, {  1,  52},
-  {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  5,  31}, {  1,  77}, {  1, 112}, {  1,   6},
-  {  1,   4}, {  1,   5}, { 23,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 107 */
-  {  6,  31}, {  1,   8}, { 13,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  52}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33}, {  1,   4}, {  1,  21},
-  {  3,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  5,  31},
-  {  1, 113}, {  1,   8}, {  1,   5}, { 24,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 108 */
-  {  6,  31}, {  1,   8}, { 14,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  3,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34},
-  {  4,  18}, {  1,  50}, {  6,  31}, {  1,  32}, {  1,  56}, {  1,   4}, {  1,  24}, {  1,  22},
-  {  3,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  4,  31}, {  1,  59},
-  {  1,  58}, {  1, 114}, { 25,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 109 */
-  {  6,  31}, {  1,   8}, { 14,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  3,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  3,  18}, {  1,  52}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, {  2,   4},
-  {  1,  21}, {  3,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41},
-  {  2,  31}, {  1,  59}, {  1,  58}, {  1,  48}, {  1,  38}, { 25,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 110 */
-  {  6,  31}, {  1,   8}, { 15,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  34}, {  8,  44}, {  1,  34},
-  {  4,  18}, {  1,  50}, {  6,  31}, {  1,  32}, {  1,  56}, {  3,   4}, {  1,  24}, {  1,  22},
-  {  3,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  1,  31}, {  1,  59},
-  {  1,  58}, {  1,  48}, {  1,  38}, {  1,  48}, {  1,  39}, { 24,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 111 */
-  {  6,  31}, {  1,   8}, { 15,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  2,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  2,  18}, {  1,  52}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, {  4,   4},
-  {  1,  21}, {  3,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40}, {  1,  75},
-  {  1,  58}, {  1,  48}, {  4,  38}, { 24,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 112 */
-  {  6,  31}, {  1,   8}, { 16,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  1,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  1,  18}, {  1,  34}, {  8,  44}, {  1,  34},
-  {  4,  18}, {  1,  50}, {  6,  31}, {  1,  32}, {  1,  56}, {  5,   4}, {  1,  24}, {  1,  22},
-  {  3,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  74}, {  1,  48}, {  4,  38},
-  {  1,  48}, {  1,  39}, { 23,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 113 */
-  {  6,  31}, {  1,   8}, { 16,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  1,  18}, {  1,  34}, {  7,  44}, {  1,  34}, {  1,  18}, {  1,  52}, {  7,  44},
-  {  1,  52}, {  4,  18}, {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, {  6,   4},
-  {  1,  21}, {  3,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45},
-  {  6,  38}, { 23,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 114 */
-  {  6,  31}, {  1,   8}, { 17,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  2,  34},
-  {  7,  44}, {  2,  34}, {  8,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  6,  31}, {  1,  32},
-  {  1,  56}, {  7,   4}, {  1,  24}, {  1,  22}, {  3,  18}, {  1,  52}, {  7,  44}, {  1,  34},
-  {  4,  18}, {  1,  53}, {  5,  38}, {  1,  48}, {  1,  39}, { 22,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1,  92},  /* Row 115 */
-  {  6,  31}, {  1,   8}, { 17,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44},
-  {  1,  52}, {  1,  34}, {  7,  44}, {  1,  34}, {  1,  52}, {  7,  44}, {  1,  52}, {  4,  18},
-  {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, {  8,   4}, {  1,  21}, {  3,  18},
-  {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45}, {  6,  38}, { 22,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  29}, {  1, 115},  /* Row 116 */
-  {  6,  31}, {  1,   8}, { 18,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  7,  44}, {  1,  34},
-  {  7,  44}, {  1,  34}, {  8,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  6,  31}, {  1,  32},
-  {  1,  56}, {  9,   4}, {  1,  24}, {  1,  22}, {  3,  18}, {  1,  52}, {  7,  44}, {  1,  34},
-  {  4,  18}, {  1,  53}, {  5,  38}, {  1,  48}, {  1,  39}, { 21,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1, 116},  /* Row 117 */
-  {  1,  59}, {  5,  31}, {  1,   8}, { 18,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52},
-  {  6,  44}, {  1,  73}, {  7,  44}, {  1,  73}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  40},
-  {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, { 10,   4}, {  1,  21}, {  3,  18}, {  1,  34},
-  {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45}, {  6,  38}, { 21,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 118 */
-  {  1,  58}, {  1,  59}, {  4,  31}, {  1,  16}, {  1,   7}, { 18,   4}, {  1,  21}, {  4,  18},
-  {  1,  34}, { 22,  44}, {  1,  34}, {  4,  18}, {  1,  50}, {  6,  31}, {  1,  32}, {  1,  56},
-  { 11,   4}, {  1,  24}, {  1,  22}, {  3,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18},
-  {  1,  53}, {  5,  38}, {  1,  48}, {  1,  39}, { 20,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 119 */
-  {  1,  48}, {  1,  58}, {  1,  59}, {  3,  31}, {  1,  42}, {  1,  16}, {  1,   7}, { 17,   4},
-  {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, { 20,  44}, {  1,  52}, {  4,  18}, {  1,  40},
-  {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, { 12,   4}, {  1,  21}, {  3,  18}, {  1,  34},
-  {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45}, {  6,  38}, { 20,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 120 */
-  {  1,  38}, {  1,  48}, {  1,  58}, {  1,  59}, {  2,  31}, {  1,  56}, {  1,  15}, {  1,  16},
-  {  1,   7}, { 17,   4}, {  1,  21}, {  4,  18}, {  1,  34}, { 20,  44}, {  1,  34}, {  4,  18},
-  {  1,  50}, {  6,  31}, {  1,  32}, {  1,  56}, { 12,   4}, {  1,   7}, {  1, 117}, {  1,  73},
-  {  3,  18}, {  1,  52}, {  7,  44}, {  1,  34}, {  4,  18}, {  1,  53}, {  5,  38}, {  1,  48},
-  {  1,  39}, { 19,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 121 */
-  {  2,  38}, {  1,  48}, {  1,  58}, {  1,  59}, {  1,  31}, {  2,   8}, {  1,  15}, {  1,  16},
-  {  1,   7}, { 16,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, { 18,  44}, {  1,  52},
-  {  4,  18}, {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, { 11,   4}, {  1,   7},
-  {  1,   9}, {  1, 118}, {  1, 119}, {  3,  18}, {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18},
-  {  1,  47}, {  1,  45}, {  6,  38}, { 19,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 122 */
-  {  3,  38}, {  1,  48}, {  1,  58}, {  1, 113}, {  1,   8}, {  1,   4}, {  1,   8}, {  1,  15},
-  {  1,  16}, {  1,   7}, { 16,   4}, {  1,  21}, {  4,  18}, {  1,  34}, { 18,  44}, {  1,  34},
-  {  4,  18}, {  1,  50}, {  6,  31}, {  1,  32}, {  1,  56}, { 11,   4}, {  1,   7}, {  1,   9},
-  {  1,  12}, {  1,  13}, {  1, 120}, {  1,  22}, {  3,  18}, {  1,  52}, {  7,  44}, {  1,  34},
-  {  4,  18}, {  1,  53}, {  5,  38}, {  1,  48}, {  1,  39}, { 18,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 123 */
-  {  4,  38}, {  1,  48}, {  1, 121}, {  1, 122}, {  2,   4}, {  1,   8}, {  1,  15}, {  1,  16},
-  {  1,   7}, { 15,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, { 16,  44}, {  1,  52},
-  {  4,  18}, {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, { 10,   4}, {  1,   7},
-  {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1, 123}, {  3,  18}, {  1,  34},
-  {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45}, {  6,  38}, { 18,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 124 */
-  {  5,  38}, {  1,  48}, {  1, 124}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  { 15,   4}, {  1,  21}, {  4,  18}, {  1,  34}, { 16,  44}, {  1,  34}, {  4,  18}, {  1,  50},
-  {  6,  31}, {  1,  32}, {  1,  56}, { 10,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},
-  {  1,   6}, {  1,   4}, {  1,   5}, {  1, 125}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34},
-  {  4,  18}, {  1,  53}, {  5,  38}, {  1,  48}, {  1,  39}, { 17,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 125 */
-  {  6,  38}, {  1,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  { 14,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, { 14,  44}, {  1,  52}, {  4,  18},
-  {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, {  9,   4}, {  1,   7}, {  1,   9},
-  {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, {  2,   0}, {  1,  17}, {  3,  18},
-  {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45}, {  6,  38}, { 17,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 126 */
-  {  6,  38}, {  2,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  { 14,   4}, {  1,  21}, {  4,  18}, {  1,  34}, { 14,  44}, {  1,  34}, {  4,  18}, {  1,  50},
-  {  6,  31}, {  1,  32}, {  1,  56}, {  9,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},
-  {  1,   6}, {  1,   4}, {  1,   5}, {  4,   0}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34},
-  {  4,  18}, {  1,  53}, {  5,  38}, {  1,  48}, {  1,  39}, { 16,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 127 */
-  {  6,  38}, {  3,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  { 13,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, { 12,  44}, {  1,  52}, {  4,  18},
-  {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, {  8,   4}, {  1,   7}, {  1,   9},
-  {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, {  5,   0}, {  1,  17}, {  3,  18},
-  {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45}, {  6,  38}, { 16,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 128 */
-  {  6,  38}, {  4,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  { 13,   4}, {  1,  21}, {  4,  18}, {  1,  34}, { 12,  44}, {  1,  34}, {  4,  18}, {  1,  50},
-  {  6,  31}, {  1,  32}, {  1,  56}, {  8,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},
-  {  1,   6}, {  1,   4}, {  1,   5}, {  7,   0}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34},
-  {  4,  18}, {  1,  53}, {  5,  38}, {  1,  48}, {  1,  39}, { 15,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 129 */
-  {  6,  38}, {  5,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  { 12,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, { 10,  44}, {  1,  52}, {  4,  18},
-  {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, {  7,   4}, {  1,   7}, {  1,   9},
-  {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, {  8,   0}, {  1,  17}, {  3,  18},
-  {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  47}, {  1,  45}, {  6,  38}, { 15,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 130 */
-  {  6,  38}, {  6,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  { 12,   4}, {  1,  21}, {  4,  18}, {  1,  34}, { 10,  44}, {  1,  34}, {  4,  18}, {  1,  50},
-  {  6,  31}, {  1,  32}, {  1,  56}, {  7,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},
-  {  1,   6}, {  1,   4}, {  1,   5}, { 10,   0}, {  4,  18}, {  1,  52}, {  7,  44}, {  1,  34},
-  {  4,  18}, {  1,  51}, {  5,  38}, {  1,  48}, {  1, 126}, { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 131 */
-  {  6,  38}, {  7,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  { 11,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  8,  44}, {  1,  52}, {  4,  18},
-  {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, {  6,   4}, {  1,   7}, {  1,   9},
-  {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 11,   0}, {  1,  17}, {  3,  18},
-  {  1,  34}, {  7,  44}, {  1,  52}, {  4,  18}, {  1,  53}, {  6,  38}, {  1, 127}, { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 132 */
-  {  6,  38}, {  8,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  { 11,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  4,  18}, {  1,  50},
-  {  6,  31}, {  1,  32}, {  1,  56}, {  6,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13},
-  {  1,   6}, {  1,   4}, {  1,   5}, { 13,   0}, {  4,  18}, {  1,  52}, {  6,  44}, {  1,  52},
-  {  4,  18}, {  1,  53}, {  7,  38}, { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 133 */
-  {  6,  38}, {  9,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  { 10,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  52}, {  6,  44}, {  1,  52}, {  4,  18},
-  {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, {  5,   4}, {  1,   7}, {  1,   9},
-  {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 14,   0}, {  1,  17}, {  3,  18},
-  {  1,  34}, {  6,  44}, {  1,  52}, {  4,  18}, {  1, 128}, {  6,  38}, {  1,  48}, {  1, 126},
-  { 13,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 134 */
-  {  6,  38}, { 10,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  { 10,   4}, {  1,  21}, {  4,  18}, {  1,  34}, {  1,  55}, {  4,  44}, {  1,  55}, {  1,  34},
-  {  4,  18}, {  1,  50}, {  6,  31}, {  1,  32}, {  1,  56}, {  5,   4}, {  1,   7}, {  1,   9},
-  {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 16,   0}, {  4,  18}, {  1,  52},
-  {  5,  44}, {  1,  34}, {  3,  18}, {  1,  47}, {  1,  45}, {  7,  38}, {  1,  39}, { 13,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 135 */
-  {  6,  38}, { 11,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  {  9,   4}, {  1,  24}, {  1,  22}, {  4,  18}, {  1,  34}, {  1,  52}, {  2,  44}, {  1,  52},
-  {  1,  34}, {  4,  18}, {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33}, {  1,   7}, {  4,   4},
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 17,   0},
-  {  1,  17}, {  3,  18}, {  1,  34}, {  1,  52}, {  2,  44}, {  1,  52}, {  1,  34}, {  4,  18},
-  {  1,  53}, {  8,  38}, {  1,  39}, { 13,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 136 */
-  {  6,  38}, { 12,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  {  9,   4}, {  1,  21}, {  6,  18}, {  2,  34}, {  6,  18}, {  1,  50}, {  6,  31}, {  1,  32},
-  {  1,  56}, {  4,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4},
-  {  1,   5}, { 19,   0}, {  5,  18}, {  2,  34}, {  5,  18}, {  1,  47}, {  1,  45}, {  8,  38},
-  {  1,   1}, { 13,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 137 */
-  {  6,  38}, { 13,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  {  8,   4}, {  1,  24}, {  1,  22}, { 12,  18}, {  1,  40}, {  1,  41}, {  6,  31}, {  1,  33},
-  {  1,   7}, {  3,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4},
-  {  1,   5}, { 20,   0}, {  1,  17}, { 10,  18}, {  1,  35}, {  1,  61}, {  9,  38}, { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  34}, {  2,  18}, {  1,  35}, {  1,  45},  /* Row 138 */
-  {  6,  38}, { 14,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  {  8,   4}, {  1,  21}, { 12,  18}, {  1,  50}, {  6,  31}, {  1,  32}, {  1,  56}, {  3,   4},
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 22,   0},
-  {  9,  18}, {  1,  35}, {  1,  61}, {  8,  38}, {  1,  48}, {  1,  39}, { 14,   0},
-  { 18,   0}, {  3,  18}, {  1,  34}, {  8,  44}, {  1,  18}, {  2,  35}, {  1, 129}, {  1,  45},  /* Row 139 */
-  {  6,  38}, { 15,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7},
-  {  7,   4}, {  1,  19}, {  1,  26}, { 10,  18}, {  1, 130}, {  1, 107}, {  6,  31}, {  1,  33},
-  {  1,   7}, {  2,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4},
-  {  1,   5}, { 23,   0}, {  1, 131}, {  1, 132}, {  5,  18}, {  1,  35}, {  1, 133}, {  1, 128},
-  { 10,  38}, { 15,   0},
-  { 25,   0}, {  9,  45}, {  7,  38}, { 16,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15},  /* Row 140 */
-  {  1,  16}, {  1,   7}, {  7,   4}, {  1,  19}, {  1,  21}, {  1,  22}, {  6,  18}, {  1,  40},
-  {  1,  50}, {  1, 107}, {  6,  31}, {  1,  32}, {  1,  56}, {  2,   4}, {  1,   7}, {  1,   9},
-  {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 27,   0}, {  1, 134}, {  1,  17},
-  {  1, 135}, {  1,  51}, {  1,  45}, {  1, 136}, {  9,  38}, {  1,  48}, {  1,  39}, { 15,   0},
-  { 25,   0}, { 16,  38}, { 17,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16},  /* Row 141 */
-  {  1,   7}, {  8,   4}, {  1,  24}, {  1,  21}, {  1,  22}, {  2,  29}, {  1,  67}, {  1,  50},
-  {  1,  41}, {  8,  31}, {  1,  16}, {  1,   7}, {  1,   4}, {  1,   7}, {  1,   9}, {  1,  12},
-  {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 30,   0}, {  1,   1}, { 11,  38}, {  1,  48},
-  {  1,  38}, { 16,   0},
-  { 25,   0}, { 16,  38}, { 18,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16},  /* Row 142 */
-  {  1,   7}, {  9,   4}, {  1,  89}, {  1, 137}, {  1, 138}, {  1,  92}, {  8,  31}, {  1,  42},
-  {  1,  16}, {  1,   7}, {  1,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6},
-  {  1,   4}, {  1,   5}, { 32,   0}, {  1,  39}, {  1,  48}, {  8,  38}, {  1,  48}, {  1,  38},
-  { 17,   0},
-  { 25,   0}, { 16,  38}, { 19,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16},  /* Row 143 */
-  {  1,   7}, {  9,   4}, {  1,   7}, {  1,  56}, {  1,  33}, {  1,  32}, {  5,  31}, {  1,  42},
-  {  1,  16}, {  1,   8}, {  2,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6},
-  {  1,   4}, {  1,   5}, { 34,   0}, {  8,  38}, {  1,  48}, {  1,  38}, { 18,   0},
-  { 25,   0}, { 16,  38}, { 20,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16},  /* Row 144 */
-  {  1,   7}, { 10,   4}, {  1,   7}, {  7,   8}, {  3,   4}, {  1,   7}, {  1,   9}, {  1,  12},
-  {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 35,   0}, {  1,  46}, {  7,  38}, {  1,  39},
-  { 19,   0},
-  { 25,   0}, { 16,  38}, { 21,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16},  /* Row 145 */
-  {  1,   7}, { 19,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4},
-  {  1,   5}, { 64,   0},
-  { 25,   0}, { 16,  38}, { 22,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16},  /* Row 146 */
-  {  1,   7}, { 17,   4}, {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4},
-  {  1,   5}, { 65,   0},
-  { 64,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, { 15,   4},  /* Row 147 */
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 66,   0},
-  { 65,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, { 13,   4},  /* Row 148 */
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 67,   0},
-  { 66,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, { 11,   4},  /* Row 149 */
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 68,   0},
-  { 67,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  9,   4},  /* Row 150 */
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 69,   0},
-  { 68,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  7,   4},  /* Row 151 */
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 70,   0},
-  { 69,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  5,   4},  /* Row 152 */
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 71,   0},
-  { 70,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  3,   4},  /* Row 153 */
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 72,   0},
-  { 71,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  1,   4},  /* Row 154 */
-  {  1,   7}, {  1,   9}, {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 73,   0},
-  { 72,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1,  16}, {  1,   7}, {  1,   9},  /* Row 155 */
-  {  1,  12}, {  1,  13}, {  1,   6}, {  1,   4}, {  1,   5}, { 74,   0},
-  { 73,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1,  15}, {  1, 103}, {  1,  12}, {  1,  13},  /* Row 156 */
-  {  1,   6}, {  1,   4}, {  1,   5}, { 75,   0},
-  { 74,   0}, {  1,   5}, {  3,   4}, {  1,   8}, {  1, 139}, {  1,  13}, {  1,   6}, {  1,   4},  /* Row 157 */
-  {  1,   5}, { 76,   0},
-  { 75,   0}, {  1,   5}, {  2,   4}, {  1,   3}, {  1, 140}, {  1,   6}, {  1,   4}, {  1,   5},  /* Row 158 */
-  { 77,   0},
-  { 76,   0}, {  1,   5}, {  4,   4}, {  1,   5}, { 78,   0}                                       /* Row 159 */
+  0xb5, 0x00, 0x02, 0x01, 0x02, 0x03, 0xfd, 0x04, 0x00, 0x05, 0xb5, 0x00,                           /* Row 0 */
+  0xb6, 0x00, 0x03, 0x01, 0x02, 0x06, 0x07, 0xff, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xb6, 0x00,         /* Row 1 */
+  0xb7, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0a, 0x0b, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xb7,   /* Row 2 */
+  0x00,
+  0xb8, 0x00, 0x09, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x0e, 0x0f, 0x08, 0xfe, 0x04, 0x00,   /* Row 3 */
+  0x05, 0xb8, 0x00,
+  0xb9, 0x00, 0x0b, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x07, 0x10, 0x0f, 0x08, 0xfe,   /* Row 4 */
+  0x04, 0x00, 0x05, 0xb9, 0x00,
+  0xba, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xff, 0x04, 0x03, 0x07, 0x10,   /* Row 5 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xba, 0x00,
+  0xbb, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xfd, 0x04, 0x03, 0x07, 0x10,   /* Row 6 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xbb, 0x00,
+  0xbc, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xfb, 0x04, 0x03, 0x07, 0x10,   /* Row 7 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xbc, 0x00,
+  0xbd, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf9, 0x04, 0x03, 0x07, 0x10,   /* Row 8 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xbd, 0x00,
+  0xbe, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf7, 0x04, 0x03, 0x07, 0x10,   /* Row 9 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xbe, 0x00,
+  0xbf, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf5, 0x04, 0x03, 0x07, 0x10,   /* Row 10 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xbf, 0x00,
+  0xc0, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf3, 0x04, 0x03, 0x07, 0x10,   /* Row 11 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xc0, 0x00,
+  0xc1, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf1, 0x04, 0x03, 0x07, 0x10,   /* Row 12 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xc1, 0x00,
+  0xc2, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xef, 0x04, 0x03, 0x07, 0x10,   /* Row 13 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xc2, 0x00,
+  0xc3, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xed, 0x04, 0x03, 0x07, 0x10,   /* Row 14 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xc3, 0x00,
+  0xc4, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xeb, 0x04, 0x03, 0x07, 0x10,   /* Row 15 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xc4, 0x00,
+  0xc5, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xe9, 0x04, 0x03, 0x07, 0x10,   /* Row 16 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xc5, 0x00,
+  0xc6, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xe7, 0x04, 0x03, 0x07, 0x10,   /* Row 17 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xc6, 0x00,
+  0xc7, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xe5, 0x04, 0x03, 0x07, 0x10,   /* Row 18 */
+  0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xe7, 0x00, 0x00, 0x11, 0xfc, 0x12, 0x00, 0x11, 0xe8, 0x00,
+  0xc8, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf7, 0x04, 0xfc, 0x13, 0xf2,   /* Row 19 */
+  0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xea, 0x00, 0x00, 0x14, 0xf8, 0x12,
+  0x00, 0x14, 0xea, 0x00,
+  0xc9, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf8, 0x04, 0x02, 0x13, 0x15,   /* Row 20 */
+  0x16, 0xfe, 0x17, 0x02, 0x16, 0x15, 0x18, 0xf3, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04,
+  0x00, 0x05, 0xeb, 0x00, 0xf6, 0x12, 0x00, 0x14, 0xeb, 0x00,
+  0xea, 0x00, 0x00, 0x11, 0xfc, 0x12, 0x00, 0x19, 0xe8, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09,   /* Row 21 */
+  0x0c, 0x0d, 0x06, 0xf8, 0x04, 0x01, 0x13, 0x1a, 0xfa, 0x12, 0x01, 0x16, 0x1b, 0xf3, 0x04, 0x03,
+  0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xed, 0x00, 0x00, 0x11, 0xf5, 0x12, 0x00, 0x14,
+  0xec, 0x00,
+  0xec, 0x00, 0x00, 0x14, 0xf8, 0x12, 0x00, 0x14, 0xeb, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09,   /* Row 22 */
+  0x0c, 0x0d, 0x06, 0xf8, 0x04, 0x01, 0x13, 0x1a, 0xf8, 0x12, 0x01, 0x1c, 0x1b, 0xfd, 0x08, 0x00,
+  0x07, 0xf8, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xee, 0x00, 0xf3, 0x12,
+  0xec, 0x00,
+  0xec, 0x00, 0xf6, 0x12, 0x00, 0x14, 0xed, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d,   /* Row 23 */
+  0x06, 0xf7, 0x04, 0x00, 0x15, 0xf6, 0x12, 0x01, 0x1d, 0x1e, 0xff, 0x1f, 0x02, 0x20, 0x21, 0x08,
+  0xf8, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xf0, 0x00, 0x00, 0x11, 0xfc,
+  0x12, 0x00, 0x22, 0xff, 0x23, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x11, 0xed, 0x00,
+  0xed, 0x00, 0x00, 0x24, 0xf5, 0x12, 0x00, 0x25, 0xfd, 0x26, 0x00, 0x27, 0xf4, 0x00, 0x07, 0x01,   /* Row 24 */
+  0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf7, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0xfe, 0x22,
+  0xfc, 0x12, 0x01, 0x28, 0x29, 0xfe, 0x1f, 0x01, 0x2a, 0x08, 0xf8, 0x04, 0x03, 0x07, 0x10, 0x0f,
+  0x08, 0xfe, 0x04, 0x00, 0x05, 0xf1, 0x00, 0xfc, 0x12, 0x00, 0x2b, 0xfd, 0x2c, 0x00, 0x2b, 0xfd,
+  0x12, 0x02, 0x23, 0x2d, 0x2e, 0xef, 0x00,
+  0xee, 0x00, 0x00, 0x11, 0xf4, 0x12, 0x01, 0x2f, 0x2d, 0xfe, 0x26, 0x01, 0x30, 0x26, 0xf6, 0x00,   /* Row 25 */
+  0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf6, 0x04, 0x00, 0x31, 0xfd, 0x12, 0x00,
+  0x23, 0xfe, 0x2c, 0x00, 0x2b, 0xfc, 0x12, 0x00, 0x32, 0xfd, 0x1f, 0x01, 0x2a, 0x08, 0xf8, 0x04,
+  0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xf3, 0x00, 0x00, 0x11, 0xfd, 0x12, 0x00,
+  0x22, 0xfb, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x02, 0x33, 0x26, 0x2e, 0xf0, 0x00,
+  0xee, 0x00, 0xfc, 0x12, 0x00, 0x22, 0xff, 0x34, 0x00, 0x23, 0xfb, 0x12, 0x00, 0x35, 0xfd, 0x26,   /* Row 26 */
+  0x01, 0x30, 0x27, 0xf8, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf6, 0x04,
+  0x01, 0x03, 0x36, 0xfd, 0x12, 0x00, 0x37, 0xfd, 0x2c, 0x00, 0x2b, 0xfd, 0x12, 0x01, 0x28, 0x29,
+  0xfd, 0x1f, 0x01, 0x2a, 0x08, 0xf8, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05,
+  0xf4, 0x00, 0xfc, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x00, 0x35, 0xff, 0x26,
+  0x00, 0x2e, 0xf1, 0x00,
+  0xef, 0x00, 0x00, 0x11, 0xfd, 0x12, 0x00, 0x2b, 0xfd, 0x2c, 0x00, 0x23, 0xfc, 0x12, 0x01, 0x2f,   /* Row 27 */
+  0x2d, 0xfc, 0x26, 0xf9, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf5, 0x04,
+  0x01, 0x13, 0x17, 0xfe, 0x12, 0x00, 0x23, 0xfb, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc,
+  0x1f, 0x01, 0x21, 0x07, 0xf8, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xf6,
+  0x00, 0x00, 0x11, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x00, 0x35, 0xfe,
+  0x26, 0xf1, 0x00,
+  0xef, 0x00, 0xfd, 0x12, 0x00, 0x22, 0xfc, 0x2c, 0x01, 0x37, 0x22, 0xfc, 0x12, 0x00, 0x35, 0xfd,   /* Row 28 */
+  0x26, 0x01, 0x30, 0x27, 0xfb, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf4,
+  0x04, 0x01, 0x13, 0x17, 0xfe, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28,
+  0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf7, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00,
+  0x05, 0xf7, 0x00, 0xfc, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x33, 0xff,
+  0x26, 0x01, 0x30, 0x27, 0xf2, 0x00,
+  0xef, 0x00, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x2f, 0x2d, 0xfc,   /* Row 29 */
+  0x26, 0xfc, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf3, 0x04, 0x01, 0x13,
+  0x17, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01,
+  0x21, 0x07, 0xf7, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xf9, 0x00, 0x00,
+  0x11, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfd, 0x26,
+  0xf2, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x35, 0xfd, 0x26,   /* Row 30 */
+  0x01, 0x30, 0x27, 0xfe, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf2, 0x04,
+  0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29,
+  0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf6, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05,
+  0xfa, 0x00, 0xfc, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x35, 0xfc, 0x26,
+  0x00, 0x01, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x2f, 0x2d, 0xfc,   /* Row 31 */
+  0x26, 0xff, 0x00, 0x07, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf1, 0x04, 0x01, 0x13,
+  0x17, 0xff, 0x12, 0x00, 0x22, 0xf8, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01,
+  0x21, 0x07, 0xf6, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xfc, 0x00, 0x00,
+  0x11, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfc, 0x26,
+  0x00, 0x27, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf8, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x35, 0xfd, 0x26,   /* Row 32 */
+  0x09, 0x30, 0x27, 0x01, 0x02, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xf0, 0x04, 0x01, 0x13, 0x17,
+  0xff, 0x12, 0x00, 0x22, 0xf8, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01,
+  0x20, 0x38, 0xf5, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xfd, 0x00, 0xfc,
+  0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x35, 0xfb, 0x26, 0x00, 0x01, 0xf3,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf8, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x2f, 0x2d, 0xfe,   /* Row 33 */
+  0x26, 0x08, 0x30, 0x39, 0x0d, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xef, 0x04, 0x01, 0x13, 0x17,
+  0xff, 0x12, 0x00, 0x22, 0xf7, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21,
+  0x07, 0xf5, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00, 0x05, 0xff, 0x00, 0x00, 0x11,
+  0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26, 0xf2,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf7, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x35, 0xff, 0x26,   /* Row 34 */
+  0x08, 0x30, 0x3a, 0x3b, 0x3c, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0xee, 0x04, 0x01, 0x13, 0x17, 0xff,
+  0x12, 0x00, 0x22, 0xf7, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20,
+  0x38, 0xf4, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x01, 0x05, 0x00, 0xfc, 0x12, 0x00,
+  0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x3d, 0xfc, 0x26, 0x01, 0x30, 0x27, 0xf2, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf7, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x0a, 0x2f, 0x2d, 0x30,   /* Row 35 */
+  0x3a, 0x3b, 0x1f, 0x20, 0x3e, 0x0c, 0x0d, 0x06, 0xed, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00,
+  0x22, 0xf6, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf4, 0x04,
+  0x03, 0x07, 0x10, 0x0f, 0x08, 0xfe, 0x04, 0x00, 0x3f, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00,
+  0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26, 0xf1, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf6, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x02, 0x40, 0x3a, 0x3b,   /* Row 36 */
+  0xfe, 0x1f, 0x02, 0x41, 0x42, 0x06, 0xec, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf6,
+  0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf3, 0x04, 0x06,
+  0x07, 0x10, 0x0f, 0x08, 0x04, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd,
+  0x12, 0x00, 0x35, 0xfc, 0x26, 0x01, 0x30, 0x27, 0xf1, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf6, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x43, 0x44, 0xfc,   /* Row 37 */
+  0x1f, 0x00, 0x45, 0xeb, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf5, 0x2c, 0x00, 0x22,
+  0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf3, 0x04, 0x04, 0x07, 0x10, 0x0f, 0x08,
+  0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26,
+  0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf5, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f,   /* Row 38 */
+  0x01, 0x46, 0x07, 0xec, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf5, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf2, 0x04, 0x03, 0x07, 0x10, 0x47,
+  0x43, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x35, 0xfc, 0x26, 0x01,
+  0x30, 0x27, 0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf5, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd,   /* Row 39 */
+  0x1f, 0x01, 0x20, 0x38, 0xec, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf4, 0x2c, 0x00,
+  0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf1, 0x04, 0x00, 0x48, 0xfd, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26, 0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf4, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f,   /* Row 40 */
+  0x01, 0x21, 0x07, 0xed, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf4, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf2, 0x04, 0x01, 0x18, 0x16, 0xfd,
+  0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x35, 0xfc, 0x26, 0x01, 0x30, 0x27,
+  0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf4, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd,   /* Row 41 */
+  0x1f, 0x01, 0x20, 0x38, 0xed, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf3, 0x2c, 0x00,
+  0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf3, 0x04, 0x00, 0x15, 0xfd, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26, 0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf3, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f,   /* Row 42 */
+  0x01, 0x21, 0x07, 0xee, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf3, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf4, 0x04, 0x01, 0x18, 0x16, 0xfd,
+  0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x35, 0xfc, 0x26, 0x01, 0x30, 0x27,
+  0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf3, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd,   /* Row 43 */
+  0x1f, 0x01, 0x20, 0x38, 0xee, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00,
+  0x49, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf5, 0x04,
+  0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb,
+  0x26, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf2, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f,   /* Row 44 */
+  0x01, 0x21, 0x07, 0xef, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22,
+  0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf6, 0x04,
+  0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x35, 0xfc,
+  0x26, 0x01, 0x30, 0x27, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x49, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12,   /* Row 45 */
+  0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xef, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00,
+  0x22, 0xfa, 0x2c, 0x01, 0x22, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f,
+  0x01, 0x21, 0x07, 0xf7, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd,
+  0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12,   /* Row 46 */
+  0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf0, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22,
+  0xfa, 0x2c, 0xff, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01,
+  0x20, 0x38, 0xf8, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd,
+  0x12, 0x00, 0x35, 0xfc, 0x26, 0x01, 0x30, 0x27, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x01, 0x22, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc,   /* Row 47 */
+  0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf0, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x02, 0x22, 0x12, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32,
+  0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf9, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00,
+  0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0xff, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12,   /* Row 48 */
+  0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf1, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22,
+  0xfa, 0x2c, 0x02, 0x22, 0x12, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfd,
+  0x1f, 0x01, 0x20, 0x38, 0xfa, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00,
+  0x22, 0xfd, 0x12, 0x01, 0x4a, 0x30, 0xfd, 0x26, 0x01, 0x30, 0x27, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x02, 0x22, 0x12, 0x34, 0xfb, 0x2c, 0x00, 0x34,   /* Row 49 */
+  0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf1, 0x04, 0x01, 0x13, 0x17, 0xff,
+  0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd,
+  0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xfb, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22,
+  0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x03, 0x28, 0x4b, 0x3a, 0x30, 0xfd, 0x26, 0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x02, 0x22, 0x12, 0x22, 0xfa, 0x2c, 0x00, 0x22,   /* Row 50 */
+  0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf2, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12,
+  0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xfc, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00,
+  0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x07, 0x32, 0x1f, 0x3b, 0x3a, 0x30, 0x26, 0x30, 0x27,
+  0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x00, 0x34, 0xfb, 0x2c,   /* Row 51 */
+  0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf2, 0x04, 0x01, 0x13,
+  0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00,
+  0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xfd, 0x04, 0x00, 0x15, 0xfd, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xff, 0x1f, 0x03, 0x3b, 0x3a,
+  0x30, 0x26, 0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c,   /* Row 52 */
+  0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf3, 0x04, 0x01, 0x13, 0x17,
+  0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xfe, 0x04, 0x01, 0x18, 0x16, 0xfd,
+  0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfd, 0x1f, 0x02, 0x3b, 0x4c,
+  0x27, 0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfe, 0x12, 0x00, 0x34, 0xfb, 0x2c,   /* Row 53 */
+  0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf3, 0x04, 0x01, 0x13,
+  0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00,
+  0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xff, 0x04, 0x00, 0x15, 0xfd, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x4d, 0x4e,
+  0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c,   /* Row 54 */
+  0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf4, 0x04, 0x01, 0x13, 0x17,
+  0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x04, 0x20, 0x38, 0x04, 0x18, 0x16, 0xfd, 0x12, 0x00,
+  0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x02, 0x20, 0x38, 0x05, 0xea,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c,   /* Row 55 */
+  0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf4, 0x04, 0x01, 0x13,
+  0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00,
+  0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x02, 0x21, 0x04, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa,
+  0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f, 0x03, 0x4f, 0x07, 0x04, 0x05, 0xeb,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c,   /* Row 56 */
+  0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf5, 0x04, 0x01, 0x13, 0x17,
+  0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x02, 0x20, 0x50, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfa,
+  0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x02, 0x51, 0x0f, 0x08, 0xff, 0x04, 0x00,
+  0x05, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x34, 0xfb, 0x2c,   /* Row 57 */
+  0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf5, 0x04, 0x01, 0x13,
+  0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfb, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00,
+  0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x00, 0x52, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00,
+  0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x04, 0x20, 0x38, 0x10, 0x0f, 0x08, 0xff, 0x04,
+  0x00, 0x05, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x22, 0xfa, 0x2c,   /* Row 58 */
+  0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf6, 0x04, 0x01, 0x13, 0x17,
+  0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfb, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xfe, 0x1f, 0x01, 0x29, 0x28, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c,
+  0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x00, 0x21, 0xff, 0x07, 0x02, 0x10, 0x0f, 0x08,
+  0xff, 0x04, 0x00, 0x05, 0xee, 0x00,
+  0xf0, 0x00, 0x00, 0x53, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfb, 0x12, 0x00, 0x34,   /* Row 59 */
+  0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf6, 0x04,
+  0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfa, 0x12, 0x00, 0x34, 0xfa,
+  0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfe, 0x1f, 0x00, 0x32, 0xfd, 0x12, 0x00, 0x22, 0xfa,
+  0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xff, 0x04, 0x03,
+  0x07, 0x10, 0x0f, 0x08, 0xff, 0x04, 0x00, 0x05, 0xef, 0x00,
+  0xf1, 0x00, 0x02, 0x01, 0x54, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfb, 0x12,   /* Row 60 */
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf7,
+  0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfe, 0x12, 0x00, 0x55,
+  0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x04, 0x28, 0x29, 0x1f, 0x29, 0x28,
+  0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x21,
+  0x07, 0xfe, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xff, 0x04, 0x00, 0x05, 0xf0, 0x00,
+  0xf2, 0x00, 0x03, 0x01, 0x02, 0x56, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfa,   /* Row 61 */
+  0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20,
+  0x38, 0xf7, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12,
+  0x01, 0x1d, 0x57, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x02, 0x32, 0x58,
+  0x32, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f,
+  0x01, 0x20, 0x38, 0xfc, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xff, 0x04, 0x00, 0x05, 0xf1, 0x00,
+  0xf3, 0x00, 0x04, 0x01, 0x02, 0x06, 0x59, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22,   /* Row 62 */
+  0xfa, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21,
+  0x07, 0xf8, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12,
+  0x02, 0x1d, 0x5a, 0x28, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x02, 0x28,
+  0x5b, 0x28, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f,
+  0x01, 0x21, 0x07, 0xfb, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xff, 0x04, 0x00, 0x05, 0xf2, 0x00,
+  0xf4, 0x00, 0x05, 0x01, 0x02, 0x06, 0x08, 0x47, 0x1d, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00,   /* Row 63 */
+  0x22, 0xfe, 0x12, 0x00, 0x55, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01,
+  0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf8, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22,
+  0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x02, 0x1d, 0x5c, 0x32, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c,
+  0x00, 0x22, 0xfd, 0x12, 0x00, 0x1d, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12,
+  0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xf9, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xff,
+  0x04, 0x00, 0x05, 0xf3, 0x00,
+  0xf5, 0x00, 0x06, 0x01, 0x02, 0x06, 0x08, 0x5d, 0x5e, 0x5f, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c,   /* Row 64 */
+  0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x57, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc,
+  0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf9, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00,
+  0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x03, 0x1d, 0x5c, 0x29, 0x28, 0xfe, 0x12, 0x00, 0x22,
+  0xfa, 0x2c, 0x00, 0x34, 0xf8, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32,
+  0xfb, 0x1f, 0x01, 0x21, 0x07, 0xf8, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xff, 0x04, 0x00, 0x05,
+  0xf4, 0x00,
+  0xf6, 0x00, 0x07, 0x01, 0x02, 0x06, 0x08, 0x5d, 0x60, 0x61, 0x1c, 0xff, 0x12, 0x00, 0x22, 0xf9,   /* Row 65 */
+  0x2c, 0x00, 0x22, 0xff, 0x12, 0x02, 0x1d, 0x5a, 0x28, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00,
+  0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xf9, 0x04, 0x01, 0x13, 0x17,
+  0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x03, 0x1d, 0x5c, 0x1f, 0x32, 0xfd,
+  0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfa, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd,
+  0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xf6, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08,
+  0xff, 0x04, 0x00, 0x05, 0xf5, 0x00,
+  0xf7, 0x00, 0x08, 0x01, 0x02, 0x06, 0x08, 0x5d, 0x60, 0x62, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22,   /* Row 66 */
+  0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x02, 0x1d, 0x5c, 0x32, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c,
+  0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xfa, 0x04, 0x01, 0x13, 0x17,
+  0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x04, 0x1d, 0x5c, 0x1f, 0x29, 0x28,
+  0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfa, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22,
+  0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x21, 0x07, 0xf5, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08,
+  0xff, 0x04, 0x00, 0x05, 0xf6, 0x00,
+  0xf8, 0x00, 0x09, 0x01, 0x02, 0x06, 0x08, 0x5d, 0x60, 0x62, 0x04, 0x13, 0x17, 0xff, 0x12, 0x00,   /* Row 67 */
+  0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x03, 0x1d, 0x5c, 0x29, 0x28, 0xfd, 0x12, 0x00, 0x34,
+  0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38, 0xfa, 0x04,
+  0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c,
+  0xff, 0x1f, 0x00, 0x32, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x22,
+  0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xf3, 0x04,
+  0x03, 0x07, 0x10, 0x0f, 0x08, 0xff, 0x04, 0x00, 0x05, 0xf7, 0x00,
+  0xf9, 0x00, 0x06, 0x01, 0x02, 0x06, 0x08, 0x5d, 0x60, 0x62, 0xff, 0x04, 0x01, 0x13, 0x17, 0xff,   /* Row 68 */
+  0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x03, 0x1d, 0x5c, 0x1f, 0x32, 0xfd, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xfb,
+  0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d,
+  0x5c, 0xff, 0x1f, 0x01, 0x29, 0x28, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfc, 0x12,
+  0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x21, 0x07, 0xf2,
+  0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xff, 0x04, 0x00, 0x05, 0xf8, 0x00,
+  0xfa, 0x00, 0x06, 0x01, 0x02, 0x06, 0x08, 0x5d, 0x60, 0x62, 0xfe, 0x04, 0x01, 0x13, 0x17, 0xff,   /* Row 69 */
+  0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x04, 0x1d, 0x5c, 0x1f, 0x29, 0x28, 0xfd,
+  0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20,
+  0x38, 0xfb, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12,
+  0x01, 0x1d, 0x5c, 0xfe, 0x1f, 0x00, 0x32, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfe,
+  0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x20,
+  0x38, 0xf0, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xff, 0x04, 0x00, 0x05, 0xf9, 0x00,
+  0xfb, 0x00, 0x06, 0x01, 0x02, 0x06, 0x08, 0x5d, 0x60, 0x62, 0xfd, 0x04, 0x01, 0x13, 0x17, 0xff,   /* Row 70 */
+  0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xff, 0x1f, 0x00, 0x32,
+  0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21,
+  0x07, 0xfc, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12,
+  0x01, 0x1d, 0x5c, 0xfe, 0x1f, 0x01, 0x29, 0x28, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34,
+  0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x21,
+  0x07, 0xef, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xff, 0x04, 0x00, 0x05, 0xfa, 0x00,
+  0xfc, 0x00, 0x06, 0x01, 0x02, 0x06, 0x08, 0x5d, 0x60, 0x62, 0xfc, 0x04, 0x01, 0x13, 0x17, 0xff,   /* Row 71 */
+  0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xff, 0x1f, 0x01, 0x29,
+  0x28, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f,
+  0x01, 0x20, 0x38, 0xfc, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22,
+  0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfd, 0x1f, 0x00, 0x32, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x02,
+  0x22, 0x12, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x20,
+  0x38, 0xed, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xff, 0x04, 0x00, 0x05, 0xfb, 0x00,
+  0xfd, 0x00, 0x06, 0x01, 0x02, 0x06, 0x08, 0x5d, 0x60, 0x62, 0xfb, 0x04, 0x01, 0x13, 0x17, 0xff,   /* Row 72 */
+  0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfe, 0x1f, 0x00, 0x32,
+  0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21,
+  0x07, 0xfd, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12,
+  0x01, 0x1d, 0x5c, 0xfd, 0x1f, 0x01, 0x29, 0x28, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x02, 0x34,
+  0x12, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x21, 0x07, 0xec,
+  0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xff, 0x04, 0x00, 0x05, 0xfc, 0x00,
+  0xfe, 0x00, 0x06, 0x01, 0x02, 0x06, 0x08, 0x5d, 0x60, 0x62, 0xfa, 0x04, 0x01, 0x13, 0x17, 0xff,   /* Row 73 */
+  0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfe, 0x1f, 0x01, 0x29,
+  0x28, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f,
+  0x01, 0x20, 0x38, 0xfd, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22,
+  0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfc, 0x1f, 0x00, 0x32, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00,
+  0x63, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xea,
+  0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xff, 0x04, 0x00, 0x05, 0xfd, 0x00,
+  0xff, 0x00, 0x06, 0x01, 0x02, 0x06, 0x08, 0x5d, 0x60, 0x62, 0xf9, 0x04, 0x01, 0x13, 0x17, 0xff,   /* Row 74 */
+  0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfd, 0x1f, 0x00, 0x32,
+  0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21,
+  0x07, 0xfe, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12,
+  0x01, 0x1d, 0x5c, 0xfc, 0x1f, 0x01, 0x29, 0x43, 0xfe, 0x12, 0x00, 0x22, 0xf2, 0x2c, 0x00, 0x22,
+  0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x21, 0x07, 0xe9, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08,
+  0xff, 0x04, 0x00, 0x05, 0xfe, 0x00,
+  0x07, 0x00, 0x01, 0x02, 0x06, 0x08, 0x5d, 0x60, 0x62, 0xf8, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12,   /* Row 75 */
+  0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfd, 0x1f, 0x01, 0x29, 0x28,
+  0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01,
+  0x20, 0x38, 0xfe, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff,
+  0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x48, 0xfd, 0x12, 0x00, 0x34, 0xf4, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xe7, 0x04, 0x03, 0x07, 0x10, 0x0f,
+  0x08, 0xff, 0x04, 0x00, 0x05, 0xff, 0x00,
+  0x06, 0x01, 0x02, 0x06, 0x08, 0x5d, 0x60, 0x62, 0xf7, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00,   /* Row 76 */
+  0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfc, 0x1f, 0x00, 0x32, 0xfd, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xff,
+  0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d,
+  0x5c, 0xfb, 0x1f, 0x01, 0x50, 0x16, 0xfe, 0x12, 0x00, 0x22, 0xf4, 0x2c, 0x00, 0x22, 0xfd, 0x12,
+  0x00, 0x32, 0xfb, 0x1f, 0x01, 0x21, 0x07, 0xe6, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xff, 0x04,
+  0x01, 0x05, 0x00,
+  0x05, 0x02, 0x06, 0x08, 0x5d, 0x60, 0x62, 0xf6, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22,   /* Row 77 */
+  0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfc, 0x1f, 0x01, 0x29, 0x43, 0xfd, 0x12,
+  0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x20, 0x38,
+  0xff, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01,
+  0x1d, 0x5c, 0xfb, 0x1f, 0x01, 0x08, 0x15, 0xfd, 0x12, 0x00, 0x34, 0xf6, 0x2c, 0x00, 0x34, 0xfd,
+  0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xe4, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08,
+  0xff, 0x04, 0x00, 0x05,
+  0x04, 0x03, 0x08, 0x5d, 0x60, 0x62, 0xf5, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf9,   /* Row 78 */
+  0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x48, 0xfd, 0x12, 0x00, 0x22,
+  0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x04, 0x21, 0x07, 0x04, 0x13, 0x17,
+  0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x02,
+  0x08, 0x18, 0x16, 0xfe, 0x12, 0x00, 0x22, 0xf6, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb,
+  0x1f, 0x01, 0x21, 0x07, 0xe3, 0x04, 0x03, 0x07, 0x10, 0x0f, 0x08, 0xff, 0x04,
+  0x03, 0x04, 0x21, 0x64, 0x62, 0xf4, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c,   /* Row 79 */
+  0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x01, 0x50, 0x16, 0xfd, 0x12, 0x00, 0x34,
+  0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x04, 0x20, 0x38, 0x04, 0x13,
+  0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f,
+  0x02, 0x08, 0x04, 0x65, 0xfd, 0x12, 0x00, 0x34, 0xf8, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28,
+  0x29, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xe1, 0x04, 0x04, 0x07, 0x10, 0x0f, 0x38, 0x07,
+  0x04, 0x04, 0x08, 0x66, 0x09, 0x07, 0xf5, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf9,   /* Row 80 */
+  0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x01, 0x08, 0x15, 0xfd, 0x12, 0x00,
+  0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x03, 0x21, 0x07, 0x13, 0x17,
+  0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x02,
+  0x08, 0x04, 0x65, 0xfd, 0x12, 0x00, 0x22, 0xf8, 0x2c, 0x00, 0x23, 0xfd, 0x12, 0x00, 0x32, 0xfb,
+  0x1f, 0x01, 0x21, 0x07, 0xe0, 0x04, 0x03, 0x07, 0x67, 0x0a, 0x08,
+  0xff, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf6, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22,   /* Row 81 */
+  0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x02, 0x08, 0x18, 0x16, 0xfd,
+  0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x03, 0x20,
+  0x38, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c,
+  0xfb, 0x1f, 0x02, 0x08, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xf9, 0x2c, 0x00, 0x68, 0xfd, 0x12,
+  0x01, 0x1d, 0x44, 0xfb, 0x1f, 0x00, 0x38, 0xe0, 0x04, 0x04, 0x07, 0x09, 0x0c, 0x42, 0x03,
+  0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf7, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22,   /* Row 82 */
+  0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x02, 0x08, 0x04, 0x15, 0xfd,
+  0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x02, 0x21, 0x13,
+  0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f,
+  0x01, 0x08, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xf7, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb,
+  0x1f, 0x00, 0x38, 0xe1, 0x04, 0x05, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04,
+  0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf8, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12,   /* Row 83 */
+  0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x03, 0x08, 0x04,
+  0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x01, 0x28, 0x29, 0xfd,
+  0x1f, 0x02, 0x20, 0x69, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01,
+  0x1d, 0x5c, 0xfb, 0x1f, 0x01, 0x50, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xf7, 0x2c, 0x00, 0x34, 0xfd,
+  0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xe3, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d,
+  0x06, 0x04, 0x05,
+  0x01, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf9, 0x04, 0x01, 0x13, 0x17, 0xff,   /* Row 84 */
+  0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x08,
+  0xff, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x32,
+  0xfc, 0x1f, 0x01, 0x6a, 0x17, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01,
+  0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x48, 0xfd, 0x12, 0x00, 0x22, 0xf5, 0x2c, 0x00, 0x22, 0xfd, 0x12,
+  0x00, 0x32, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xe4, 0x04, 0x07, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04,
+  0x05, 0x00,
+  0xff, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xfa, 0x04, 0x01, 0x13, 0x17,   /* Row 85 */
+  0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00,
+  0x08, 0xff, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12,
+  0x01, 0x28, 0x29, 0xfd, 0x1f, 0x01, 0x6b, 0x1d, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22,
+  0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfc, 0x1f, 0x01, 0x29, 0x43, 0xfd, 0x12, 0x00, 0x34, 0xf5, 0x2c,
+  0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xe6, 0x04, 0x06, 0x07,
+  0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xff, 0x00,
+  0xfe, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xfb, 0x04, 0x01, 0x13, 0x17,   /* Row 86 */
+  0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00,
+  0x08, 0xfe, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00,
+  0x32, 0xfd, 0x1f, 0x01, 0x5c, 0x1d, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12,
+  0x01, 0x1d, 0x5c, 0xfc, 0x1f, 0x00, 0x32, 0xfd, 0x12, 0x00, 0x22, 0xf3, 0x2c, 0x00, 0x22, 0xfd,
+  0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xe7, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06,
+  0x04, 0x05, 0xfe, 0x00,
+  0xfd, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xfc, 0x04, 0x01, 0x13, 0x17,   /* Row 87 */
+  0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00,
+  0x08, 0xfe, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12,
+  0x01, 0x28, 0x29, 0xfe, 0x1f, 0x01, 0x5c, 0x1d, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22,
+  0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfd, 0x1f, 0x01, 0x29, 0x28, 0xfd, 0x12, 0x00, 0x34, 0xf3, 0x2c,
+  0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xe9, 0x04, 0x06, 0x07,
+  0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xfd, 0x00,
+  0xfc, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xfd, 0x04, 0x01, 0x13, 0x17,   /* Row 88 */
+  0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00,
+  0x08, 0xfd, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00,
+  0x32, 0xfe, 0x1f, 0x01, 0x5c, 0x1d, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12,
+  0x01, 0x1d, 0x5c, 0xfd, 0x1f, 0x00, 0x32, 0xfd, 0x12, 0x00, 0x22, 0xf1, 0x2c, 0x00, 0x22, 0xfd,
+  0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xea, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06,
+  0x04, 0x05, 0xfc, 0x00,
+  0xfb, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xfe, 0x04, 0x01, 0x13, 0x17,   /* Row 89 */
+  0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00,
+  0x08, 0xfd, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12,
+  0x01, 0x28, 0x29, 0xff, 0x1f, 0x01, 0x5c, 0x1d, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22,
+  0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfe, 0x1f, 0x01, 0x29, 0x28, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c,
+  0x01, 0x34, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x21,
+  0x07, 0xec, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xfb, 0x00,
+  0xfa, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xff, 0x04, 0x01, 0x13, 0x17,   /* Row 90 */
+  0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00,
+  0x08, 0xfc, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00,
+  0x32, 0xff, 0x1f, 0x01, 0x5c, 0x1d, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12,
+  0x01, 0x1d, 0x5c, 0xfe, 0x1f, 0x00, 0x32, 0xfd, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x02, 0x22, 0x12,
+  0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xed, 0x04,
+  0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xfa, 0x00,
+  0xf9, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x06, 0x08, 0x0f, 0x10, 0x07, 0x04, 0x13, 0x17, 0xff, 0x12,   /* Row 91 */
+  0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x08, 0xfc,
+  0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x04, 0x28,
+  0x29, 0x1f, 0x5c, 0x1d, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d,
+  0x5c, 0xff, 0x1f, 0x01, 0x29, 0x28, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x34, 0xff, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x21, 0x07,
+  0xef, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xf9, 0x00,
+  0xf8, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x05, 0x08, 0x0f, 0x10, 0x07, 0x13, 0x17, 0xff, 0x12, 0x00,   /* Row 92 */
+  0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x08, 0xfb, 0x04,
+  0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x03, 0x32, 0x1f, 0x5c,
+  0x1d, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xff, 0x1f,
+  0x00, 0x32, 0xfd, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c,
+  0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xf0, 0x04, 0x06, 0x07, 0x09,
+  0x0c, 0x0d, 0x06, 0x04, 0x05, 0xf8, 0x00,
+  0xf7, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x04, 0x08, 0x0f, 0x10, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22,   /* Row 93 */
+  0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x08, 0xfb, 0x04, 0x01,
+  0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x03, 0x28, 0x29, 0x5c,
+  0x1d, 0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x04, 0x1d, 0x5c, 0x1f, 0x29,
+  0x28, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00,
+  0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf2, 0x04, 0x06, 0x07, 0x09,
+  0x0c, 0x0d, 0x06, 0x04, 0x05, 0xf7, 0x00,
+  0xf6, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x6c, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf9,   /* Row 94 */
+  0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x08, 0xfa, 0x04, 0x00, 0x15,
+  0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x02, 0x32, 0x5c, 0x1d, 0xff, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x03, 0x1d, 0x5c, 0x1f, 0x32, 0xfd, 0x12, 0x00,
+  0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00,
+  0x32, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xf3, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05,
+  0xf6, 0x00,
+  0xf5, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x02, 0x08, 0x6d, 0x1d, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c,   /* Row 95 */
+  0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x08, 0xfa, 0x04, 0x01, 0x18, 0x16,
+  0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x02, 0x28, 0x5a, 0x1d, 0xff, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x03, 0x1d, 0x5c, 0x29, 0x28, 0xfd, 0x12, 0x00,
+  0x34, 0xfa, 0x2c, 0x00, 0x34, 0xfb, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01,
+  0x28, 0x29, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf5, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04,
+  0x05, 0xf5, 0x00,
+  0xf4, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x01, 0x59, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00,   /* Row 96 */
+  0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x08, 0xf9, 0x04, 0x00, 0x15, 0xfd, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x01, 0x57, 0x1d, 0xff, 0x12, 0x00, 0x22, 0xfa,
+  0x2c, 0x00, 0x22, 0xff, 0x12, 0x02, 0x1d, 0x5c, 0x32, 0xfd, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00,
+  0x22, 0xfa, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01,
+  0x20, 0x38, 0xf6, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xf4, 0x00,
+  0xf3, 0x00, 0x00, 0x05, 0xff, 0x04, 0x01, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00,   /* Row 97 */
+  0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x08, 0xf9, 0x04, 0x01, 0x18, 0x16, 0xfd,
+  0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfc, 0x12, 0x00, 0x55, 0xfe, 0x12, 0x00, 0x22, 0xfa,
+  0x2c, 0x00, 0x22, 0xff, 0x12, 0x02, 0x1d, 0x5a, 0x28, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00,
+  0x34, 0xfd, 0x12, 0x00, 0x55, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01,
+  0x28, 0x29, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xf8, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04,
+  0x05, 0xf3, 0x00,
+  0xf2, 0x00, 0x03, 0x05, 0x04, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff,   /* Row 98 */
+  0x12, 0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x08, 0xf8, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22,
+  0xfa, 0x2c, 0x00, 0x22, 0xf9, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d,
+  0x57, 0xfd, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x01, 0x57, 0x28, 0xfe, 0x12,
+  0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xf9,
+  0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xf2, 0x00,
+  0xf1, 0x00, 0x02, 0x05, 0x13, 0x17, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12,   /* Row 99 */
+  0x01, 0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x08, 0xf8, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34,
+  0xfb, 0x2c, 0x00, 0x34, 0xf9, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfe, 0x12, 0x00, 0x55,
+  0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x02, 0x28, 0x29, 0x32, 0xfe, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x21, 0x07,
+  0xfb, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xf1, 0x00,
+  0xf0, 0x00, 0x01, 0x6e, 0x6f, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01,   /* Row 100 */
+  0x1d, 0x5c, 0xfb, 0x1f, 0x00, 0x08, 0xf7, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c,
+  0x00, 0x22, 0xfa, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfa, 0x12, 0x00, 0x22, 0xf9, 0x2c,
+  0x00, 0x22, 0xfd, 0x12, 0x03, 0x32, 0x1f, 0x29, 0x28, 0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00,
+  0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xfc, 0x04, 0x06, 0x07, 0x09, 0x0c,
+  0x0d, 0x06, 0x04, 0x05, 0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 101 */
+  0x1f, 0x00, 0x08, 0xf7, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34,
+  0xfa, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfa, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xff, 0x1f, 0x00, 0x32, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00,
+  0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x01, 0x21, 0x07, 0xfe, 0x04, 0x06, 0x07, 0x09,
+  0x0c, 0x0d, 0x06, 0x04, 0x05, 0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 102 */
+  0x1f, 0x00, 0x08, 0xf6, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfb,
+  0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfb, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfd,
+  0x12, 0x00, 0x32, 0xfe, 0x1f, 0x01, 0x29, 0x28, 0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22,
+  0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x20, 0x38, 0xff, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d,
+  0x06, 0x04, 0x05, 0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 103 */
+  0x1f, 0x00, 0x08, 0xf6, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34,
+  0xfb, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfb, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xfd, 0x1f, 0x00, 0x32, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00,
+  0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x00, 0x21, 0xff, 0x07, 0x05, 0x09, 0x0c, 0x0d,
+  0x06, 0x04, 0x05, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 104 */
+  0x1f, 0x00, 0x08, 0xf5, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc,
+  0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfd,
+  0x12, 0x00, 0x32, 0xfc, 0x1f, 0x01, 0x29, 0x28, 0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22,
+  0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x07, 0x20, 0x38, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xec,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 105 */
+  0x1f, 0x00, 0x08, 0xf5, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34,
+  0xfc, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfc, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f, 0x00, 0x52, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00,
+  0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x05, 0x51, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xeb,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 106 */
+  0x1f, 0x00, 0x08, 0xf4, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfd,
+  0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfd,
+  0x12, 0x00, 0x32, 0xfb, 0x1f, 0x02, 0x20, 0x50, 0x16, 0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00,
+  0x22, 0xfd, 0x12, 0x00, 0x32, 0xfc, 0x1f, 0x04, 0x4d, 0x70, 0x06, 0x04, 0x05, 0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 107 */
+  0x1f, 0x00, 0x08, 0xf4, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f, 0x02, 0x21, 0x04, 0x15, 0xfe, 0x12, 0x00, 0x22, 0xfa,
+  0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfc, 0x1f, 0x02, 0x71, 0x08, 0x05, 0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 108 */
+  0x1f, 0x00, 0x08, 0xf3, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfe,
+  0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfd,
+  0x12, 0x00, 0x32, 0xfb, 0x1f, 0x04, 0x20, 0x38, 0x04, 0x18, 0x16, 0xfe, 0x12, 0x00, 0x34, 0xfa,
+  0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfd, 0x1f, 0x02, 0x3b, 0x3a, 0x72, 0xe8, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 109 */
+  0x1f, 0x00, 0x08, 0xf3, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34,
+  0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f, 0x01, 0x21, 0x07, 0xff, 0x04, 0x00, 0x15, 0xfe, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xff, 0x1f, 0x03, 0x3b, 0x3a,
+  0x30, 0x26, 0xe8, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 110 */
+  0x1f, 0x00, 0x08, 0xf2, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff,
+  0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfd,
+  0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x20, 0x38, 0xfe, 0x04, 0x01, 0x18, 0x16, 0xfe, 0x12, 0x00,
+  0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x07, 0x32, 0x1f, 0x3b, 0x3a, 0x30, 0x26, 0x30, 0x27,
+  0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 111 */
+  0x1f, 0x00, 0x08, 0xf2, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34,
+  0xff, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f, 0x01, 0x21, 0x07, 0xfd, 0x04, 0x00, 0x15, 0xfe, 0x12,
+  0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x03, 0x28, 0x4b, 0x3a, 0x30, 0xfd, 0x26, 0xe9,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 112 */
+  0x1f, 0x00, 0x08, 0xf1, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x02, 0x22, 0x12,
+  0x22, 0xfa, 0x2c, 0x02, 0x22, 0x12, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb,
+  0x1f, 0x01, 0x20, 0x38, 0xfc, 0x04, 0x01, 0x18, 0x16, 0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00,
+  0x22, 0xfd, 0x12, 0x01, 0x4a, 0x30, 0xfd, 0x26, 0x01, 0x30, 0x27, 0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 113 */
+  0x1f, 0x00, 0x08, 0xf1, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x02, 0x34,
+  0x12, 0x22, 0xfa, 0x2c, 0x02, 0x22, 0x12, 0x34, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28,
+  0x29, 0xfb, 0x1f, 0x01, 0x21, 0x07, 0xfb, 0x04, 0x00, 0x15, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c,
+  0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26, 0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 114 */
+  0x1f, 0x00, 0x08, 0xf0, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0xff, 0x22, 0xfa,
+  0x2c, 0xff, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x20, 0x38,
+  0xfa, 0x04, 0x01, 0x18, 0x16, 0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00,
+  0x35, 0xfc, 0x26, 0x01, 0x30, 0x27, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x5c, 0xfb,   /* Row 115 */
+  0x1f, 0x00, 0x08, 0xf0, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x01, 0x34,
+  0x22, 0xfa, 0x2c, 0x01, 0x22, 0x34, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb,
+  0x1f, 0x01, 0x21, 0x07, 0xf9, 0x04, 0x00, 0x15, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34,
+  0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x1d, 0x73, 0xfb,   /* Row 116 */
+  0x1f, 0x00, 0x08, 0xef, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x22, 0xfa,
+  0x2c, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x20, 0x38,
+  0xf8, 0x04, 0x01, 0x18, 0x16, 0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00,
+  0x35, 0xfc, 0x26, 0x01, 0x30, 0x27, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x02, 0x23, 0x74, 0x3b,   /* Row 117 */
+  0xfc, 0x1f, 0x00, 0x08, 0xef, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00,
+  0x49, 0xfa, 0x2c, 0x00, 0x49, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f,
+  0x01, 0x21, 0x07, 0xf7, 0x04, 0x00, 0x15, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd,
+  0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x03, 0x23, 0x2d, 0x3a,   /* Row 118 */
+  0x3b, 0xfd, 0x1f, 0x01, 0x10, 0x07, 0xef, 0x04, 0x00, 0x15, 0xfd, 0x12, 0x00, 0x22, 0xeb, 0x2c,
+  0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x20, 0x38, 0xf6, 0x04, 0x01, 0x18, 0x16,
+  0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x35, 0xfc, 0x26, 0x01, 0x30,
+  0x27, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x04, 0x23, 0x2d, 0x30,   /* Row 119 */
+  0x3a, 0x3b, 0xfe, 0x1f, 0x02, 0x2a, 0x10, 0x07, 0xf0, 0x04, 0x01, 0x18, 0x16, 0xfd, 0x12, 0x00,
+  0x34, 0xed, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f, 0x01, 0x21, 0x07, 0xf5,
+  0x04, 0x00, 0x15, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d,
+  0xfb, 0x26, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x05, 0x23, 0x2d, 0x26,   /* Row 120 */
+  0x30, 0x3a, 0x3b, 0xff, 0x1f, 0x03, 0x38, 0x0f, 0x10, 0x07, 0xf0, 0x04, 0x00, 0x15, 0xfd, 0x12,
+  0x00, 0x22, 0xed, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x20, 0x38, 0xf5,
+  0x04, 0x02, 0x07, 0x75, 0x49, 0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00,
+  0x35, 0xfc, 0x26, 0x01, 0x30, 0x27, 0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xff,   /* Row 121 */
+  0x26, 0x03, 0x30, 0x3a, 0x3b, 0x1f, 0xff, 0x08, 0x02, 0x0f, 0x10, 0x07, 0xf1, 0x04, 0x01, 0x18,
+  0x16, 0xfd, 0x12, 0x00, 0x34, 0xef, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f,
+  0x01, 0x21, 0x07, 0xf6, 0x04, 0x03, 0x07, 0x09, 0x76, 0x77, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c,
+  0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26, 0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfe,   /* Row 122 */
+  0x26, 0x08, 0x30, 0x3a, 0x71, 0x08, 0x04, 0x08, 0x0f, 0x10, 0x07, 0xf1, 0x04, 0x00, 0x15, 0xfd,
+  0x12, 0x00, 0x22, 0xef, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x20, 0x38,
+  0xf6, 0x04, 0x05, 0x07, 0x09, 0x0c, 0x0d, 0x78, 0x16, 0xfe, 0x12, 0x00, 0x34, 0xfa, 0x2c, 0x00,
+  0x22, 0xfd, 0x12, 0x00, 0x35, 0xfc, 0x26, 0x01, 0x30, 0x27, 0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfd,   /* Row 123 */
+  0x26, 0x02, 0x30, 0x79, 0x7a, 0xff, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf2, 0x04, 0x01, 0x18,
+  0x16, 0xfd, 0x12, 0x00, 0x34, 0xf1, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f,
+  0x01, 0x21, 0x07, 0xf7, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x7b, 0xfe, 0x12, 0x00,
+  0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26, 0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfc,   /* Row 124 */
+  0x26, 0x01, 0x30, 0x7c, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf2, 0x04, 0x00, 0x15, 0xfd,
+  0x12, 0x00, 0x22, 0xf1, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x20, 0x38,
+  0xf7, 0x04, 0x07, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0x7d, 0xfd, 0x12, 0x00, 0x34, 0xfa,
+  0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x35, 0xfc, 0x26, 0x01, 0x30, 0x27, 0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 125 */
+  0x26, 0x01, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf3, 0x04, 0x01, 0x18, 0x16,
+  0xfd, 0x12, 0x00, 0x34, 0xf3, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f, 0x01,
+  0x21, 0x07, 0xf8, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xff, 0x00, 0x00, 0x11,
+  0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26, 0xf0,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 126 */
+  0x26, 0xff, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf3, 0x04, 0x00, 0x15,
+  0xfd, 0x12, 0x00, 0x22, 0xf3, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x20,
+  0x38, 0xf8, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xfd, 0x00, 0xfd, 0x12, 0x00,
+  0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x35, 0xfc, 0x26, 0x01, 0x30, 0x27, 0xf1, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 127 */
+  0x26, 0xfe, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf4, 0x04, 0x01, 0x18,
+  0x16, 0xfd, 0x12, 0x00, 0x34, 0xf5, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f,
+  0x01, 0x21, 0x07, 0xf9, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xfc, 0x00, 0x00,
+  0x11, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26,
+  0xf1, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 128 */
+  0x26, 0xfd, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf4, 0x04, 0x00, 0x15,
+  0xfd, 0x12, 0x00, 0x22, 0xf5, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x20,
+  0x38, 0xf9, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xfa, 0x00, 0xfd, 0x12, 0x00,
+  0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x35, 0xfc, 0x26, 0x01, 0x30, 0x27, 0xf2, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 129 */
+  0x26, 0xfc, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf5, 0x04, 0x01, 0x18,
+  0x16, 0xfd, 0x12, 0x00, 0x34, 0xf7, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f,
+  0x01, 0x21, 0x07, 0xfa, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xf9, 0x00, 0x00,
+  0x11, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x2f, 0x2d, 0xfb, 0x26,
+  0xf2, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 130 */
+  0x26, 0xfb, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf5, 0x04, 0x00, 0x15,
+  0xfd, 0x12, 0x00, 0x22, 0xf7, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x20,
+  0x38, 0xfa, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xf7, 0x00, 0xfd, 0x12, 0x00,
+  0x34, 0xfa, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x33, 0xfc, 0x26, 0x01, 0x30, 0x7e, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 131 */
+  0x26, 0xfa, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf6, 0x04, 0x01, 0x18,
+  0x16, 0xfd, 0x12, 0x00, 0x34, 0xf9, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f,
+  0x01, 0x21, 0x07, 0xfb, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xf6, 0x00, 0x00,
+  0x11, 0xfe, 0x12, 0x00, 0x22, 0xfa, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x00, 0x35, 0xfb, 0x26, 0x00,
+  0x7f, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 132 */
+  0x26, 0xf9, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf6, 0x04, 0x00, 0x15,
+  0xfd, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x20,
+  0x38, 0xfb, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xf4, 0x00, 0xfd, 0x12, 0x00,
+  0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x00, 0x35, 0xfa, 0x26, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 133 */
+  0x26, 0xf8, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf7, 0x04, 0x01, 0x18,
+  0x16, 0xfd, 0x12, 0x00, 0x34, 0xfb, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f,
+  0x01, 0x21, 0x07, 0xfc, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xf3, 0x00, 0x00,
+  0x11, 0xfe, 0x12, 0x00, 0x22, 0xfb, 0x2c, 0x00, 0x34, 0xfd, 0x12, 0x00, 0x80, 0xfb, 0x26, 0x01,
+  0x30, 0x7e, 0xf4, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 134 */
+  0x26, 0xf7, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf7, 0x04, 0x00, 0x15,
+  0xfd, 0x12, 0x01, 0x22, 0x37, 0xfd, 0x2c, 0x01, 0x37, 0x22, 0xfd, 0x12, 0x00, 0x32, 0xfb, 0x1f,
+  0x01, 0x20, 0x38, 0xfc, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xf1, 0x00, 0xfd,
+  0x12, 0x00, 0x34, 0xfc, 0x2c, 0x00, 0x22, 0xfe, 0x12, 0x01, 0x2f, 0x2d, 0xfa, 0x26, 0x00, 0x27,
+  0xf4, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 135 */
+  0x26, 0xf6, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf8, 0x04, 0x01, 0x18,
+  0x16, 0xfd, 0x12, 0x01, 0x22, 0x34, 0xff, 0x2c, 0x01, 0x34, 0x22, 0xfd, 0x12, 0x01, 0x28, 0x29,
+  0xfb, 0x1f, 0x01, 0x21, 0x07, 0xfd, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xf0,
+  0x00, 0x00, 0x11, 0xfe, 0x12, 0x01, 0x22, 0x34, 0xff, 0x2c, 0x01, 0x34, 0x22, 0xfd, 0x12, 0x00,
+  0x35, 0xf9, 0x26, 0x00, 0x27, 0xf4, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 136 */
+  0x26, 0xf5, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf8, 0x04, 0x00, 0x15,
+  0xfb, 0x12, 0xff, 0x22, 0xfb, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x20, 0x38, 0xfd, 0x04, 0x06,
+  0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xee, 0x00, 0xfc, 0x12, 0xff, 0x22, 0xfc, 0x12, 0x01,
+  0x2f, 0x2d, 0xf9, 0x26, 0x00, 0x01, 0xf4, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 137 */
+  0x26, 0xf4, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf9, 0x04, 0x01, 0x18,
+  0x16, 0xf5, 0x12, 0x01, 0x28, 0x29, 0xfb, 0x1f, 0x01, 0x21, 0x07, 0xfe, 0x04, 0x06, 0x07, 0x09,
+  0x0c, 0x0d, 0x06, 0x04, 0x05, 0xed, 0x00, 0x00, 0x11, 0xf7, 0x12, 0x01, 0x23, 0x3d, 0xf8, 0x26,
+  0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x22, 0xff, 0x12, 0x01, 0x23, 0x2d, 0xfb,   /* Row 138 */
+  0x26, 0xf3, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf9, 0x04, 0x00, 0x15,
+  0xf5, 0x12, 0x00, 0x32, 0xfb, 0x1f, 0x01, 0x20, 0x38, 0xfe, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d,
+  0x06, 0x04, 0x05, 0xeb, 0x00, 0xf8, 0x12, 0x01, 0x23, 0x3d, 0xf9, 0x26, 0x01, 0x30, 0x27, 0xf3,
+  0x00,
+  0xef, 0x00, 0xfe, 0x12, 0x00, 0x22, 0xf9, 0x2c, 0x00, 0x12, 0xff, 0x23, 0x01, 0x81, 0x2d, 0xfb,   /* Row 139 */
+  0x26, 0xf2, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xfa, 0x04, 0x01, 0x13,
+  0x1a, 0xf7, 0x12, 0x01, 0x82, 0x6b, 0xfb, 0x1f, 0x01, 0x21, 0x07, 0xff, 0x04, 0x06, 0x07, 0x09,
+  0x0c, 0x0d, 0x06, 0x04, 0x05, 0xea, 0x00, 0x01, 0x83, 0x84, 0xfc, 0x12, 0x02, 0x23, 0x85, 0x80,
+  0xf7, 0x26, 0xf2, 0x00,
+  0xe8, 0x00, 0xf8, 0x2d, 0xfa, 0x26, 0xf1, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10,   /* Row 140 */
+  0x07, 0xfa, 0x04, 0x02, 0x13, 0x15, 0x16, 0xfb, 0x12, 0x02, 0x28, 0x32, 0x6b, 0xfb, 0x1f, 0x01,
+  0x20, 0x38, 0xff, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xe6, 0x00, 0x05, 0x86,
+  0x11, 0x87, 0x33, 0x2d, 0x88, 0xf8, 0x26, 0x01, 0x30, 0x27, 0xf2, 0x00,
+  0xe8, 0x00, 0xf1, 0x26, 0xf0, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf9,   /* Row 141 */
+  0x04, 0x02, 0x18, 0x15, 0x16, 0xff, 0x1d, 0x02, 0x43, 0x32, 0x29, 0xf9, 0x1f, 0x09, 0x10, 0x07,
+  0x04, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xe3, 0x00, 0x00, 0x01, 0xf6, 0x26, 0x01, 0x30,
+  0x26, 0xf1, 0x00,
+  0xe8, 0x00, 0xf1, 0x26, 0xef, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf8,   /* Row 142 */
+  0x04, 0x03, 0x59, 0x89, 0x8a, 0x5c, 0xf9, 0x1f, 0x0a, 0x2a, 0x10, 0x07, 0x04, 0x07, 0x09, 0x0c,
+  0x0d, 0x06, 0x04, 0x05, 0xe1, 0x00, 0x01, 0x27, 0x30, 0xf9, 0x26, 0x01, 0x30, 0x26, 0xf0, 0x00,
+  0xe8, 0x00, 0xf1, 0x26, 0xee, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf8,   /* Row 143 */
+  0x04, 0x03, 0x07, 0x38, 0x21, 0x20, 0xfc, 0x1f, 0x02, 0x2a, 0x10, 0x08, 0xff, 0x04, 0x06, 0x07,
+  0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xdf, 0x00, 0xf9, 0x26, 0x01, 0x30, 0x26, 0xef, 0x00,
+  0xe8, 0x00, 0xf1, 0x26, 0xed, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf7,   /* Row 144 */
+  0x04, 0x00, 0x07, 0xfa, 0x08, 0xfe, 0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xde,
+  0x00, 0x00, 0x2e, 0xfa, 0x26, 0x00, 0x27, 0xee, 0x00,
+  0xe8, 0x00, 0xf1, 0x26, 0xec, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xee,   /* Row 145 */
+  0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xc1, 0x00,
+  0xe8, 0x00, 0xf1, 0x26, 0xeb, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf0,   /* Row 146 */
+  0x04, 0x06, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xc0, 0x00,
+  0xc1, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf2, 0x04, 0x06, 0x07, 0x09,   /* Row 147 */
+  0x0c, 0x0d, 0x06, 0x04, 0x05, 0xbf, 0x00,
+  0xc0, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf4, 0x04, 0x06, 0x07, 0x09,   /* Row 148 */
+  0x0c, 0x0d, 0x06, 0x04, 0x05, 0xbe, 0x00,
+  0xbf, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf6, 0x04, 0x06, 0x07, 0x09,   /* Row 149 */
+  0x0c, 0x0d, 0x06, 0x04, 0x05, 0xbd, 0x00,
+  0xbe, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xf8, 0x04, 0x06, 0x07, 0x09,   /* Row 150 */
+  0x0c, 0x0d, 0x06, 0x04, 0x05, 0xbc, 0x00,
+  0xbd, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xfa, 0x04, 0x06, 0x07, 0x09,   /* Row 151 */
+  0x0c, 0x0d, 0x06, 0x04, 0x05, 0xbb, 0x00,
+  0xbc, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xfc, 0x04, 0x06, 0x07, 0x09,   /* Row 152 */
+  0x0c, 0x0d, 0x06, 0x04, 0x05, 0xba, 0x00,
+  0xbb, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x03, 0x08, 0x0f, 0x10, 0x07, 0xfe, 0x04, 0x06, 0x07, 0x09,   /* Row 153 */
+  0x0c, 0x0d, 0x06, 0x04, 0x05, 0xb9, 0x00,
+  0xba, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x0b, 0x08, 0x0f, 0x10, 0x07, 0x04, 0x07, 0x09, 0x0c, 0x0d,   /* Row 154 */
+  0x06, 0x04, 0x05, 0xb8, 0x00,
+  0xb9, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x09, 0x08, 0x0f, 0x10, 0x07, 0x09, 0x0c, 0x0d, 0x06, 0x04,   /* Row 155 */
+  0x05, 0xb7, 0x00,
+  0xb8, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x07, 0x08, 0x0f, 0x67, 0x0c, 0x0d, 0x06, 0x04, 0x05, 0xb6,   /* Row 156 */
+  0x00,
+  0xb7, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x05, 0x08, 0x8b, 0x0d, 0x06, 0x04, 0x05, 0xb5, 0x00,         /* Row 157 */
+  0xb6, 0x00, 0x00, 0x05, 0xff, 0x04, 0x04, 0x03, 0x8c, 0x06, 0x04, 0x05, 0xb4, 0x00,               /* Row 158 */
+  0xb5, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x00, 0x05, 0xb3, 0x00                                        /* Row 159 */
+};
+
+static const uint32_t g_nuttx_rows[IMAGE_HEIGHT] =
+{
+      0,    12,    27,    44,    63,    84,   108,   132,   156,   180,                             /* Rows 0-9 */
+    204,   228,   252,   276,   300,   324,   348,   372,   396,   428,                             /* Rows 10-19 */
+    464,   506,   556,   606,   667,   738,   815,   899,   982,  1068,                             /* Rows 20-29 */
+   1150,  1234,  1318,  1399,  1480,  1560,  1634,  1708,  1774,  1842,                             /* Rows 30-39 */
+   1905,  1971,  2034,  2100,  2167,  2237,  2309,  2383,  2457,  2534,                             /* Rows 40-49 */
+   2613,  2695,  2779,  2862,  2944,  3025,  3106,  3189,  3273,  3359,                             /* Rows 50-59 */
+   3449,  3543,  3639,  3735,  3836,  3934,  4036,  4138,  4245,  4353,                             /* Rows 60-69 */
+   4463,  4573,  4683,  4791,  4899,  5001,  5104,  5203,  5303,  5396,                             /* Rows 70-79 */
+   5490,  5581,  5676,  5768,  5867,  5965,  6069,  6169,  6273,  6373,                             /* Rows 80-89 */
+   6482,  6588,  6696,  6799,  6902,  7000,  7099,  7193,  7292,  7383,                             /* Rows 90-99 */
+   7475,  7561,  7648,  7733,  7818,  7899,  7980,  8059,  8139,  8218,                             /* Rows 100-109 */
+   8302,  8384,  8465,  8542,  8617,  8689,  8762,  8834,  8906,  8973,                             /* Rows 110-119 */
+   9041,  9113,  9188,  9264,  9342,  9420,  9501,  9581,  9663,  9743,                             /* Rows 120-129 */
+   9825,  9905,  9988, 10065, 10149, 10231, 10318, 10390, 10456, 10521,                             /* Rows 130-139 */
+  10589, 10649, 10700, 10748, 10795, 10836, 10863, 10890, 10913, 10936,                             /* Rows 140-149 */
+  10959, 10982, 11005, 11028, 11051, 11072, 11091, 11108, 11123, 11137                              /* Rows 150-159 */
 };
 
 #elif CONFIG_EXAMPLES_NXIMAGE_BPP == 8
 #  ifdef CONFIG_EXAMPLES_NXIMAGE_GREYSCALE
 
-  { 76,   0}, {  1,   1}, {  1,   2}, {  1,   3}, {  4,   4}, {  1,   5}, { 76,   0},              /* Row 0 */
-  { 75,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  5,   4}, {  1,   5}, { 75,   0},  /* Row 1 */
-  { 74,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   9}, {  1,  10},  /* Row 2 */
-  {  4,   4}, {  1,   5}, { 74,   0},
-  { 73,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 3 */
-  {  1,  12}, {  1,  13}, {  4,   4}, {  1,   5}, { 73,   0},
-  { 72,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 4 */
-  {  1,   7}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 72,   0},
-  { 71,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 5 */
-  {  1,   7}, {  2,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 71,   0},
-  { 70,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 6 */
-  {  1,   7}, {  4,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 70,   0},
-  { 69,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 7 */
-  {  1,   7}, {  6,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 69,   0},
-  { 68,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 8 */
-  {  1,   7}, {  8,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 68,   0},
-  { 67,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 9 */
-  {  1,   7}, { 10,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 67,   0},
-  { 66,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 10 */
-  {  1,   7}, { 12,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 66,   0},
-  { 65,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 11 */
-  {  1,   7}, { 14,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 65,   0},
-  { 64,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 12 */
-  {  1,   7}, { 16,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 64,   0},
-  { 63,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 13 */
-  {  1,   7}, { 18,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 63,   0},
-  { 62,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 14 */
-  {  1,   7}, { 20,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 62,   0},
-  { 61,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 15 */
-  {  1,   7}, { 22,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 61,   0},
-  { 60,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 16 */
-  {  1,   7}, { 24,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 60,   0},
-  { 59,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 17 */
-  {  1,   7}, { 26,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 59,   0},
-  { 58,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 18 */
-  {  1,   7}, { 28,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 26,   0},
-  {  1,  14}, {  5,  15}, {  1,  14}, { 25,   0},
-  { 57,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 19 */
-  {  1,   7}, { 10,   4}, {  5,  16}, { 15,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4},
-  {  1,   5}, { 23,   0}, {  1,  17}, {  9,  15}, {  1,  17}, { 23,   0},
-  { 56,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},  /* Row 20 */
-  {  1,   7}, {  9,   4}, {  1,  16}, {  1,  18}, {  1,  19}, {  3,  20}, {  1,  19}, {  1,  18},
-  {  1,  21}, { 14,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 22,   0},
-  { 11,  15}, {  1,  17}, { 22,   0},
-  { 23,   0}, {  1,  14}, {  5,  15}, {  1,  22}, { 25,   0}, {  1,   1}, {  1,   6}, {  1,   7},  /* Row 21 */
-  {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  9,   4}, {  1,  16}, {  1,  23},
-  {  7,  15}, {  1,  19}, {  1,  24}, { 14,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4},
-  {  1,   5}, { 20,   0}, {  1,  14}, { 12,  15}, {  1,  17}, { 21,   0},
-  { 21,   0}, {  1,  17}, {  9,  15}, {  1,  17}, { 22,   0}, {  1,   1}, {  1,   6}, {  1,   7},  /* Row 22 */
-  {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  9,   4}, {  1,  16}, {  1,  23},
-  {  9,  15}, {  1,  20}, {  1,  24}, {  4,   4}, {  1,   3}, {  9,   4}, {  1,   3}, {  1,   8},
-  {  1,  13}, {  4,   4}, {  1,   5}, { 19,   0}, { 14,  15}, { 21,   0},
-  { 21,   0}, { 11,  15}, {  1,  17}, { 20,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3},  /* Row 23 */
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, { 10,   4}, {  1,  18}, { 11,  15}, {  1,  25},
-  {  1,  26}, {  2,  27}, {  1,  28}, {  1,  29}, { 10,   4}, {  1,   3}, {  1,   8}, {  1,  13},
-  {  4,   4}, {  1,   5}, { 17,   0}, {  1,  14}, {  5,  15}, {  1,  30}, {  2,  31}, {  1,  30},
-  {  5,  15}, {  1,  14}, { 20,   0},
-  { 20,   0}, {  1,  22}, { 12,  15}, {  1,  32}, {  4,  33}, {  1,   7}, { 13,   0}, {  1,   1},  /* Row 24 */
-  {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, { 10,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  3,  30}, {  5,  15}, {  1,  34}, {  1,  35}, {  3,  27},
-  {  1,  36}, { 10,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 16,   0},
-  {  5,  15}, {  1,  37}, {  4,  38}, {  1,  37}, {  4,  15}, {  1,  39}, {  1,  40}, {  1,  41},
-  { 18,   0},
-  { 19,   0}, {  1,  14}, { 13,  15}, {  1,  31}, {  1,  40}, {  5,  33}, { 11,   0}, {  1,   1},  /* Row 25 */
-  {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, { 11,   4},
-  {  1,  42}, {  4,  15}, {  1,  31}, {  3,  38}, {  1,  37}, {  5,  15}, {  1,  43}, {  4,  27},
-  {  1,  36}, { 10,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 14,   0},
-  {  1,  14}, {  4,  15}, {  1,  30}, {  6,  38}, {  1,  30}, {  4,  15}, {  1,  22}, {  1,  33},
-  {  1,  41}, { 17,   0},
-  { 19,   0}, {  5,  15}, {  1,  30}, {  1,  44}, {  1,  34}, {  1,  31}, {  6,  15}, {  1,  45},  /* Row 26 */
-  {  5,  33}, {  1,   7}, {  9,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8},
-  {  1,   7}, {  1,  11}, {  1,   7}, { 11,   4}, {  1,  46}, {  1,  47}, {  4,  15}, {  1,  48},
-  {  4,  38}, {  1,  37}, {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  36}, { 10,   4},
-  {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 13,   0}, {  5,  15}, {  1,  34},
-  {  6,  38}, {  1,  44}, {  4,  15}, {  1,  45}, {  2,  33}, {  1,  41}, { 16,   0},
-  { 18,   0}, {  1,  14}, {  4,  15}, {  1,  37}, {  4,  38}, {  1,  31}, {  5,  15}, {  1,  31},  /* Row 27 */
-  {  1,  40}, {  5,  33}, {  8,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8},
-  {  1,   7}, {  1,  11}, {  1,   7}, { 12,   4}, {  1,  16}, {  1,  20}, {  3,  15}, {  1,  31},
-  {  6,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, {  9,   4},
-  {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 11,   0}, {  1,  14}, {  4,  15},
-  {  1,  30}, {  7,  38}, {  1,  44}, {  4,  15}, {  1,  45}, {  3,  33}, { 16,   0},
-  { 18,   0}, {  4,  15}, {  1,  30}, {  5,  38}, {  1,  48}, {  1,  30}, {  5,  15}, {  1,  45},  /* Row 28 */
-  {  5,  33}, {  1,   7}, {  6,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8},
-  {  1,   7}, {  1,  11}, {  1,   7}, { 13,   4}, {  1,  16}, {  1,  20}, {  3,  15}, {  1,  19},
-  {  6,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49},
-  { 10,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, { 10,   0}, {  5,  15},
-  {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  22}, {  3,  33}, {  1,   7}, { 15,   0},
-  { 18,   0}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34}, {  5,  15}, {  1,  31}, {  1,  40},  /* Row 29 */
-  {  5,  33}, {  5,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7},
-  {  1,  11}, {  1,   7}, { 14,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38},
-  {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 10,   4}, {  1,   3},
-  {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, {  8,   0}, {  1,  14}, {  4,  15}, {  1,  30},
-  {  7,  38}, {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40}, {  4,  33}, { 15,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  5,  15}, {  1,  45}, {  5,  33},  /* Row 30 */
-  {  1,   7}, {  3,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7},
-  {  1,  11}, {  1,   7}, { 15,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, { 11,   4},
-  {  1,   3}, {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, {  7,   0}, {  5,  15}, {  1,  34},
-  {  7,  38}, {  1,  30}, {  4,  15}, {  1,  45}, {  5,  33}, {  1,  50}, { 14,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  34}, {  5,  15}, {  1,  31}, {  1,  40},  /* Row 31 */
-  {  5,  33}, {  2,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7},
-  {  1,  11}, {  1,   7}, { 16,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  9,  38},
-  {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 11,   4}, {  1,   3},
-  {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, {  5,   0}, {  1,  14}, {  4,  15}, {  1,  30},
-  {  7,  38}, {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40}, {  5,  33}, {  1,   7}, { 14,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  9,  38}, {  1,  30}, {  5,  15}, {  1,  45}, {  5,  33},  /* Row 32 */
-  {  1,   7}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},
-  {  1,   7}, { 17,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  9,  38}, {  1,  34},
-  {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, { 12,   4}, {  1,   3},
-  {  1,   8}, {  1,  13}, {  4,   4}, {  1,   5}, {  4,   0}, {  5,  15}, {  1,  34}, {  7,  38},
-  {  1,  30}, {  4,  15}, {  1,  45}, {  6,  33}, {  1,  50}, { 14,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  9,  38}, {  1,  34}, {  5,  15}, {  1,  31}, {  1,  40},  /* Row 33 */
-  {  4,  33}, {  1,  51}, {  1,  52}, {  1,   7}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},
-  {  1,   7}, { 18,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, { 10,  38}, {  1,  30},
-  {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 12,   4}, {  1,   3}, {  1,   8},
-  {  1,  13}, {  4,   4}, {  1,   5}, {  2,   0}, {  1,  14}, {  4,  15}, {  1,  30}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40}, {  6,  33}, { 15,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, { 10,  38}, {  1,  30}, {  5,  15}, {  1,  45}, {  3,  33},  /* Row 34 */
-  {  1,  53}, {  1,  54}, {  1,  21}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7},
-  { 19,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, { 10,  38}, {  1,  34}, {  4,  15},
-  {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, { 13,   4}, {  1,   3}, {  1,   8},
-  {  1,  13}, {  4,   4}, {  1,   5}, {  1,   0}, {  5,  15}, {  1,  34}, {  7,  38}, {  1,  30},
-  {  3,  15}, {  1,  55}, {  1,  56}, {  6,  33}, {  1,   7}, { 15,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, { 10,  38}, {  1,  34}, {  5,  15}, {  1,  31}, {  1,  40},  /* Row 35 */
-  {  1,  33}, {  1,  53}, {  1,  57}, {  1,  27}, {  1,  28}, {  1,  58}, {  1,   7}, {  1,  11},
-  {  1,   7}, { 20,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, { 11,  38}, {  1,  30},
-  {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 13,   4}, {  1,   3}, {  1,   8},
-  {  1,  13}, {  4,   4}, {  1,  59}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15},
-  {  1,  31}, {  1,  60}, {  6,  33}, { 16,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, { 11,  38}, {  1,  30}, {  5,  15}, {  1,  61}, {  1,  53},  /* Row 36 */
-  {  1,  57}, {  3,  27}, {  1,  62}, {  1,  56}, {  1,   7}, { 21,   4}, {  1,  16}, {  1,  20},
-  {  2,  15}, {  1,  30}, { 11,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27},
-  {  1,  28}, {  1,  49}, { 14,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  2,   4}, {  1,  21},
-  {  1,  19}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  45}, {  6,  33},
-  {  1,   7}, { 16,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, { 11,  38}, {  1,  34}, {  5,  15}, {  1,  63}, {  1,  35},  /* Row 37 */
-  {  5,  27}, {  1,  64}, { 22,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, { 12,  38},
-  {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 14,   4}, {  1,   3},
-  {  1,   8}, {  1,  13}, {  1,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  34},
-  {  4,  15}, {  1,  31}, {  1,  40}, {  6,  33}, { 17,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, { 12,  38}, {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27},  /* Row 38 */
-  {  1,  65}, {  1,   3}, { 21,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, { 12,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, { 15,   4},
-  {  1,   3}, {  1,   8}, {  1,  66}, {  1,  19}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30},
-  {  4,  15}, {  1,  45}, {  6,  33}, {  1,   7}, { 17,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, { 12,  38}, {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35},  /* Row 39 */
-  {  4,  27}, {  1,  28}, {  1,  49}, { 21,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30},
-  { 13,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 16,   4},
-  {  1,  67}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40},
-  {  6,  33}, { 18,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, { 13,  38}, {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27},  /* Row 40 */
-  {  1,  29}, {  1,   3}, { 20,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, { 13,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, { 15,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  45},
-  {  6,  33}, {  1,   7}, { 18,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, { 13,  38}, {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35},  /* Row 41 */
-  {  4,  27}, {  1,  28}, {  1,  49}, { 20,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30},
-  { 14,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 14,   4},
-  {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40},
-  {  6,  33}, { 19,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, { 14,  38}, {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27},  /* Row 42 */
-  {  1,  29}, {  1,   3}, { 19,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, { 14,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, { 13,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  45},
-  {  6,  33}, {  1,   7}, { 19,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, { 14,  38}, {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35},  /* Row 43 */
-  {  4,  27}, {  1,  28}, {  1,  49}, { 19,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30},
-  {  7,  38}, {  1,  68}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29},
-  {  1,   3}, { 12,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15},
-  {  1,  31}, {  1,  40}, {  6,  33}, { 20,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, { 15,  38}, {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27},  /* Row 44 */
-  {  1,  29}, {  1,   3}, { 18,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38},
-  {  1,  69}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28},
-  {  1,  49}, { 11,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30},
-  {  4,  15}, {  1,  45}, {  6,  33}, {  1,   7}, { 20,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  68}, {  6,  38}, {  1,  34}, {  5,  15},  /* Row 45 */
-  {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, { 18,   4}, {  1,  16}, {  1,  20},
-  {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15},
-  {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 10,   4}, {  1,  18}, {  4,  15}, {  1,  30},
-  {  7,  38}, {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40}, {  6,  33}, { 21,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  69}, {  7,  38}, {  1,  30}, {  5,  15},  /* Row 46 */
-  {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 17,   4}, {  1,  16}, {  1,  20}, {  2,  15},
-  {  1,  30}, {  7,  38}, {  2,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35},
-  {  4,  27}, {  1,  28}, {  1,  49}, {  9,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34},
-  {  7,  38}, {  1,  30}, {  4,  15}, {  1,  45}, {  6,  33}, {  1,   7}, { 21,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  1,  34}, {  6,  38}, {  1,  34},  /* Row 47 */
-  {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, { 17,   4}, {  1,  16},
-  {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  1,  15}, {  1,  34}, {  7,  38},
-  {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, {  8,   4}, {  1,  18},
-  {  4,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40}, {  6,  33},
-  { 22,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  2,  30}, {  7,  38}, {  1,  30}, {  5,  15},  /* Row 48 */
-  {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 16,   4}, {  1,  16}, {  1,  20}, {  2,  15},
-  {  1,  30}, {  7,  38}, {  1,  30}, {  1,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15},
-  {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, {  7,   4}, {  1,  21}, {  1,  19},
-  {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  70}, {  6,  33}, {  1,   7},
-  { 22,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  1,  15}, {  1,  34}, {  6,  38},  /* Row 49 */
-  {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, { 16,   4},
-  {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  34},
-  {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, {  6,   4},
-  {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,   1},
-  {  1,  53}, {  5,  33}, { 23,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  1,  15}, {  1,  30}, {  7,  38},  /* Row 50 */
-  {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 15,   4}, {  1,  16},
-  {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  30}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, {  5,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43},
-  {  1,  27}, {  1,  57}, {  1,  53}, {  3,  33}, {  1,   7}, { 23,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  34}, {  6,  38},  /* Row 51 */
-  {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, { 15,   4},
-  {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  3,  15}, {  1,  34},
-  {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, {  4,   4},
-  {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35},
-  {  2,  27}, {  1,  57}, {  1,  53}, {  2,  33}, { 24,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  30}, {  7,  38},  /* Row 52 */
-  {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 14,   4}, {  1,  16},
-  {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  3,  15}, {  1,  30}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, {  3,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43},
-  {  4,  27}, {  1,  57}, {  1,  53}, {  1,   7}, { 24,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  3,  15}, {  1,  34}, {  6,  38},  /* Row 53 */
-  {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, { 14,   4},
-  {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  34},
-  {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, {  2,   4},
-  {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35},
-  {  5,  27}, {  1,  71}, {  1,  72}, { 24,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  3,  15}, {  1,  30}, {  7,  38},  /* Row 54 */
-  {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 13,   4}, {  1,  16},
-  {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  30}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, {  1,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43},
-  {  6,  27}, {  1,  28}, {  1,  49}, {  1,   5}, { 23,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  4,  15}, {  1,  34}, {  6,  38},  /* Row 55 */
-  {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, { 13,   4},
-  {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  34},
-  {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   4}, {  1,  18},
-  {  4,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  6,  27},
-  {  1,  49}, {  1,   3}, {  1,   4}, {  1,   5}, { 22,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  4,  15}, {  1,  30}, {  7,  38},  /* Row 56 */
-  {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 12,   4}, {  1,  16},
-  {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  30}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  73}, {  1,  19},
-  {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  36},
-  {  1,  13}, {  3,   4}, {  1,   5}, { 21,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  5,  15}, {  1,  34}, {  6,  38},  /* Row 57 */
-  {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, { 12,   4},
-  {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  6,  15}, {  1,  34},
-  {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  74}, {  4,  15}, {  1,  30},
-  {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27}, {  1,  28}, {  1,  49},
-  {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5}, { 20,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  5,  15}, {  1,  30}, {  7,  38},  /* Row 58 */
-  {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, { 11,   4}, {  1,  16},
-  {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  6,  15}, {  1,  30}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  3,  27}, {  1,  35}, {  1,  34}, {  4,  15},
-  {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  29}, {  2,   3},
-  {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5}, { 19,   0},
-  { 17,   0}, {  1,  75}, {  1,  55}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  6,  15},  /* Row 59 */
-  {  1,  34}, {  6,  38}, {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28},
-  {  1,  49}, { 11,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30},
-  {  7,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  3,  27}, {  1,  43},
-  {  4,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27},
-  {  1,  28}, {  1,  49}, {  2,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5},
-  { 18,   0},
-  { 16,   0}, {  1,   1}, {  1,  76}, {  1,  37}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30},  /* Row 60 */
-  {  6,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27}, {  1,  29},
-  {  1,   3}, { 10,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30},
-  {  3,  15}, {  1,  37}, {  3,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34},
-  {  1,  35}, {  1,  27}, {  1,  35}, {  1,  34}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30},
-  {  4,  15}, {  1,  43}, {  6,  27}, {  1,  29}, {  1,   3}, {  3,   4}, {  1,   3}, {  1,   8},
-  {  1,  13}, {  3,   4}, {  1,   5}, { 17,   0},
-  { 15,   0}, {  1,   1}, {  1,   6}, {  1,  73}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38},  /* Row 61 */
-  {  1,  30}, {  7,  15}, {  1,  34}, {  6,  38}, {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35},
-  {  4,  27}, {  1,  28}, {  1,  49}, { 10,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30},
-  {  7,  38}, {  1,  30}, {  2,  15}, {  1,  77}, {  1,  78}, {  4,  15}, {  1,  34}, {  7,  38},
-  {  1,  30}, {  4,  15}, {  1,  43}, {  1,  79}, {  1,  43}, {  4,  15}, {  1,  30}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27}, {  1,  28}, {  1,  49}, {  5,   4},
-  {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5}, { 16,   0},
-  { 14,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30},  /* Row 62 */
-  {  8,  38}, {  1,  30}, {  7,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  43},
-  {  5,  27}, {  1,  29}, {  1,   3}, {  9,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30},
-  {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  41}, {  1,  34}, {  3,  15}, {  1,  30},
-  {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  80}, {  1,  34}, {  4,  15}, {  1,  34},
-  {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  29}, {  1,   3}, {  6,   4},
-  {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5}, { 15,   0},
-  { 13,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,   9}, {  1,  77}, {  2,  15},  /* Row 63 */
-  {  1,  30}, {  8,  38}, {  1,  30}, {  3,  15}, {  1,  37}, {  4,  15}, {  1,  34}, {  6,  38},
-  {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, {  9,   4},
-  {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25},
-  {  1,  81}, {  1,  43}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  68},
-  {  4,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27},
-  {  1,  28}, {  1,  49}, {  8,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5},
-  { 14,   0},
-  { 12,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  82}, {  1,  83},  /* Row 64 */
-  {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  77}, {  1,  78}, {  4,  15},
-  {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3},
-  {  8,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15},
-  {  1,  25}, {  1,  81}, {  1,  35}, {  1,  34}, {  3,  15}, {  1,  30}, {  7,  38}, {  1,  34},
-  {  9,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  29},
-  {  1,   3}, {  9,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5}, { 13,   0},
-  { 11,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  85},  /* Row 65 */
-  {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  41},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35},
-  {  4,  27}, {  1,  28}, {  1,  49}, {  8,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30},
-  {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  1,  27}, {  1,  43}, {  4,  15},
-  {  1,  34}, {  7,  38}, {  1,  30}, {  7,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15},
-  {  1,  34}, {  1,  35}, {  5,  27}, {  1,  28}, {  1,  49}, { 11,   4}, {  1,   3}, {  1,   8},
-  {  1,  13}, {  3,   4}, {  1,   5}, { 12,   0},
-  { 10,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  86},  /* Row 66 */
-  {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25},
-  {  1,  81}, {  1,  43}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  43},
-  {  5,  27}, {  1,  29}, {  1,   3}, {  7,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30},
-  {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  1,  27}, {  1,  35}, {  1,  34},
-  {  3,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  7,  15}, {  1,  34}, {  7,  38}, {  1,  30},
-  {  4,  15}, {  1,  43}, {  6,  27}, {  1,  29}, {  1,   3}, { 12,   4}, {  1,   3}, {  1,   8},
-  {  1,  13}, {  3,   4}, {  1,   5}, { 11,   0},
-  {  9,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  86},  /* Row 67 */
-  {  1,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15},
-  {  1,  25}, {  1,  81}, {  1,  35}, {  1,  34}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34},
-  {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, {  7,   4}, {  1,  16},
-  {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},
-  {  2,  27}, {  1,  43}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  30},
-  {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27}, {  1,  28}, {  1,  49},
-  { 14,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5}, { 10,   0},
-  {  8,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  86},  /* Row 68 */
-  {  2,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15},
-  {  1,  25}, {  1,  81}, {  1,  27}, {  1,  43}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30},
-  {  5,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, {  6,   4}, {  1,  16}, {  1,  20},
-  {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  2,  27},
-  {  1,  35}, {  1,  34}, {  3,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  5,  15}, {  1,  34},
-  {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  29}, {  1,   3}, { 15,   4},
-  {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5}, {  9,   0},
-  {  7,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  86},  /* Row 69 */
-  {  3,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15},
-  {  1,  25}, {  1,  81}, {  1,  27}, {  1,  35}, {  1,  34}, {  4,  15}, {  1,  34}, {  6,  38},
-  {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, {  6,   4},
-  {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25},
-  {  1,  81}, {  3,  27}, {  1,  43}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  3,  15},
-  {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27}, {  1,  28},
-  {  1,  49}, { 17,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5}, {  8,   0},
-  {  6,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  86},  /* Row 70 */
-  {  4,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15},
-  {  1,  25}, {  1,  81}, {  2,  27}, {  1,  43}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30},
-  {  5,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, {  5,   4}, {  1,  16}, {  1,  20},
-  {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  3,  27},
-  {  1,  35}, {  1,  34}, {  3,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  3,  15}, {  1,  34},
-  {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  29}, {  1,   3}, { 18,   4},
-  {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5}, {  7,   0},
-  {  5,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  86},  /* Row 71 */
-  {  5,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15},
-  {  1,  25}, {  1,  81}, {  2,  27}, {  1,  35}, {  1,  34}, {  4,  15}, {  1,  34}, {  6,  38},
-  {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, {  5,   4},
-  {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25},
-  {  1,  81}, {  4,  27}, {  1,  43}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  1,  15},
-  {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27}, {  1,  28},
-  {  1,  49}, { 20,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5}, {  6,   0},
-  {  4,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  86},  /* Row 72 */
-  {  6,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15},
-  {  1,  25}, {  1,  81}, {  3,  27}, {  1,  43}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30},
-  {  5,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, {  4,   4}, {  1,  16}, {  1,  20},
-  {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  4,  27},
-  {  1,  35}, {  1,  34}, {  3,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  1,  15}, {  1,  34},
-  {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  29}, {  1,   3}, { 21,   4},
-  {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5}, {  5,   0},
-  {  3,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  86},  /* Row 73 */
-  {  7,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15},
-  {  1,  25}, {  1,  81}, {  3,  27}, {  1,  35}, {  1,  34}, {  4,  15}, {  1,  34}, {  6,  38},
-  {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, {  4,   4},
-  {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25},
-  {  1,  81}, {  5,  27}, {  1,  43}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  69}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27}, {  1,  28}, {  1,  49}, { 23,   4},
-  {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5}, {  4,   0},
-  {  2,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  86},  /* Row 74 */
-  {  8,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15},
-  {  1,  25}, {  1,  81}, {  4,  27}, {  1,  43}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30},
-  {  5,  15}, {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, {  3,   4}, {  1,  16}, {  1,  20},
-  {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  5,  27},
-  {  1,  87}, {  1,  34}, {  3,  15}, {  1,  30}, { 15,  38}, {  1,  30}, {  4,  15}, {  1,  43},
-  {  6,  27}, {  1,  29}, {  1,   3}, { 24,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4},
-  {  1,   5}, {  3,   0},
-  {  1,   0}, {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  86},  /* Row 75 */
-  {  9,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15},
-  {  1,  25}, {  1,  81}, {  4,  27}, {  1,  35}, {  1,  34}, {  4,  15}, {  1,  34}, {  6,  38},
-  {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, {  3,   4},
-  {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25},
-  {  1,  81}, {  6,  27}, {  1,  67}, {  4,  15}, {  1,  34}, { 13,  38}, {  1,  34}, {  4,  15},
-  {  1,  34}, {  1,  35}, {  5,  27}, {  1,  28}, {  1,  49}, { 26,   4}, {  1,   3}, {  1,   8},
-  {  1,  13}, {  3,   4}, {  1,   5}, {  2,   0},
-  {  1,   1}, {  1,   6}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  86}, { 10,   4},  /* Row 76 */
-  {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25},
-  {  1,  81}, {  5,  27}, {  1,  43}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15},
-  {  1,  43}, {  5,  27}, {  1,  29}, {  1,   3}, {  2,   4}, {  1,  16}, {  1,  20}, {  2,  15},
-  {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  1,  21},
-  {  1,  19}, {  3,  15}, {  1,  30}, { 13,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27},
-  {  1,  29}, {  1,   3}, { 27,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4}, {  1,   5},
-  {  1,   0},
-  {  1,   2}, {  1,   7}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  86}, { 11,   4}, {  1,  16},  /* Row 77 */
-  {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},
-  {  5,  27}, {  1,  87}, {  1,  34}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34}, {  5,  15},
-  {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, {  2,   4}, {  1,  16}, {  1,  20},
-  {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27},
-  {  1,   4}, {  1,  18}, {  4,  15}, {  1,  34}, { 11,  38}, {  1,  34}, {  4,  15}, {  1,  34},
-  {  1,  35}, {  5,  27}, {  1,  28}, {  1,  49}, { 29,   4}, {  1,   3}, {  1,   8}, {  1,  13},
-  {  3,   4}, {  1,   5},
-  {  1,   3}, {  1,   4}, {  1,  28}, {  1,  84}, {  1,  86}, { 12,   4}, {  1,  16}, {  1,  20},  /* Row 78 */
-  {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27},
-  {  1,  67}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27},
-  {  1,  29}, {  1,   3}, {  1,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38},
-  {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  1,   4}, {  1,  21}, {  1,  19},
-  {  3,  15}, {  1,  30}, { 11,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  29},
-  {  1,   3}, { 30,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  3,   4},
-  {  1,   4}, {  1,  88}, {  1,  89}, {  1,  86}, { 13,   4}, {  1,  16}, {  1,  20}, {  2,  15},  /* Row 79 */
-  {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  1,  21},
-  {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34}, {  5,  15}, {  1,  34}, {  1,  35},
-  {  4,  27}, {  1,  28}, {  1,  49}, {  1,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30},
-  {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  2,   4}, {  1,   6},
-  {  4,  15}, {  1,  34}, {  9,  38}, {  1,  19}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27},
-  {  1,  28}, {  1,  49}, { 32,   4}, {  1,   3}, {  1,   8}, {  1,  13}, {  1,  49}, {  1,   3},
-  {  2,   4}, {  1,  90}, {  1,   8}, {  1,   3}, { 12,   4}, {  1,  16}, {  1,  20}, {  2,  15},  /* Row 80 */
-  {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  1,   4},
-  {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27},
-  {  1,  29}, {  1,   3}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30},
-  {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  2,   4}, {  1,   6}, {  4,  15}, {  1,  69},
-  {  9,  38}, {  1,  31}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  29}, {  1,   3}, { 33,   4},
-  {  1,   3}, {  1,  91}, {  1,  81}, {  1,   4},
-  {  3,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 11,   4}, {  1,  16}, {  1,  20}, {  2,  15},  /* Row 81 */
-  {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  1,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34}, {  5,  15}, {  1,  34},
-  {  1,  35}, {  4,  27}, {  1,  28}, {  1,  49}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30},
-  {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  1,   4}, {  1,  21},
-  {  1,  19}, {  4,  15}, {  1,  34}, {  8,  38}, {  1,  92}, {  4,  15}, {  1,  68}, {  1,  93},
-  {  6,  27}, {  1,  49}, { 33,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  56}, {  1,   8},
-  {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 10,   4}, {  1,  16}, {  1,  20}, {  2,  15},  /* Row 82 */
-  {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  2,   4},
-  {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  43}, {  5,  27},
-  {  1,  29}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15},
-  {  1,  25}, {  1,  81}, {  6,  27}, {  1,   4}, {  1,  18}, {  4,  15}, {  1,  30}, { 10,  38},
-  {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  49}, { 32,   4}, {  1,   3}, {  1,   8},
-  {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4},
-  {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  9,   4}, {  1,  16}, {  1,  20},  /* Row 83 */
-  {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27},
-  {  2,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34}, {  5,  15},
-  {  1,  34}, {  1,  35}, {  4,  27}, {  1,  28}, {  1,   7}, {  1,  20}, {  2,  15}, {  1,  30},
-  {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  1,  21}, {  1,  19},
-  {  4,  15}, {  1,  34}, { 10,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27},
-  {  1,  29}, {  1,   3}, { 30,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7},
-  {  1,   4}, {  1,   5},
-  {  1,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  8,   4}, {  1,  16},  /* Row 84 */
-  {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},
-  {  6,  27}, {  3,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15},
-  {  1,  43}, {  5,  27}, {  1,  10}, {  1,  20}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30},
-  {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  1,  67}, {  4,  15}, {  1,  30}, { 12,  38},
-  {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  28}, {  1,  49}, { 29,   4}, {  1,   3},
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, {  1,   0},
-  {  2,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  7,   4}, {  1,  16},  /* Row 85 */
-  {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},
-  {  6,  27}, {  3,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34},
-  {  5,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  81}, {  1,  77}, {  2,  15}, {  1,  30},
-  {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  5,  27}, {  1,  87}, {  1,  34},
-  {  4,  15}, {  1,  34}, { 12,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27},
-  {  1,  29}, {  1,   3}, { 27,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7},
-  {  1,   4}, {  1,   5}, {  2,   0},
-  {  3,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  6,   4}, {  1,  16},  /* Row 86 */
-  {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},
-  {  6,  27}, {  4,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15},
-  {  1,  43}, {  4,  27}, {  1,  81}, {  1,  25}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30},
-  {  2,  15}, {  1,  25}, {  1,  81}, {  5,  27}, {  1,  43}, {  4,  15}, {  1,  30}, { 14,  38},
-  {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  28}, {  1,  49}, { 26,   4}, {  1,   3},
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, {  3,   0},
-  {  4,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  5,   4}, {  1,  16},  /* Row 87 */
-  {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},
-  {  6,  27}, {  4,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34},
-  {  5,  15}, {  1,  34}, {  1,  35}, {  3,  27}, {  1,  81}, {  1,  25}, {  2,  15}, {  1,  30},
-  {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  4,  27}, {  1,  35}, {  1,  34},
-  {  4,  15}, {  1,  34}, { 14,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27},
-  {  1,  29}, {  1,   3}, { 24,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7},
-  {  1,   4}, {  1,   5}, {  4,   0},
-  {  5,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  4,   4}, {  1,  16},  /* Row 88 */
-  {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},
-  {  6,  27}, {  5,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15},
-  {  1,  43}, {  3,  27}, {  1,  81}, {  1,  25}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30},
-  {  2,  15}, {  1,  25}, {  1,  81}, {  4,  27}, {  1,  43}, {  4,  15}, {  1,  30}, { 16,  38},
-  {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  28}, {  1,  49}, { 23,   4}, {  1,   3},
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, {  5,   0},
-  {  6,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  3,   4}, {  1,  16},  /* Row 89 */
-  {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},
-  {  6,  27}, {  5,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34},
-  {  5,  15}, {  1,  34}, {  1,  35}, {  2,  27}, {  1,  81}, {  1,  25}, {  2,  15}, {  1,  30},
-  {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  3,  27}, {  1,  35}, {  1,  34},
-  {  4,  15}, {  1,  34}, {  7,  38}, {  1,  34}, {  1,  69}, {  7,  38}, {  1,  34}, {  4,  15},
-  {  1,  34}, {  1,  35}, {  5,  27}, {  1,  29}, {  1,   3}, { 21,   4}, {  1,   3}, {  1,   8},
-  {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, {  6,   0},
-  {  7,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  2,   4}, {  1,  16},  /* Row 90 */
-  {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},
-  {  6,  27}, {  6,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15},
-  {  1,  43}, {  2,  27}, {  1,  81}, {  1,  25}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30},
-  {  2,  15}, {  1,  25}, {  1,  81}, {  3,  27}, {  1,  43}, {  4,  15}, {  1,  30}, {  8,  38},
-  {  1,  30}, {  1,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27},
-  {  1,  28}, {  1,  49}, { 20,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7},
-  {  1,   4}, {  1,   5}, {  7,   0},
-  {  8,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  1,   4}, {  1,  16},  /* Row 91 */
-  {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},
-  {  6,  27}, {  6,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34},
-  {  5,  15}, {  1,  34}, {  1,  35}, {  1,  27}, {  1,  81}, {  1,  25}, {  2,  15}, {  1,  30},
-  {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  2,  27}, {  1,  35}, {  1,  34},
-  {  4,  15}, {  1,  34}, {  7,  38}, {  1,  34}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  34},
-  {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27}, {  1,  29}, {  1,   3}, { 18,   4}, {  1,   3},
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, {  8,   0},
-  {  9,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  1,  16}, {  1,  20},  /* Row 92 */
-  {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27},
-  {  7,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  43},
-  {  1,  27}, {  1,  81}, {  1,  25}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15},
-  {  1,  25}, {  1,  81}, {  2,  27}, {  1,  43}, {  4,  15}, {  1,  30}, {  8,  38}, {  1,  30},
-  {  3,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  28},
-  {  1,  49}, { 17,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4},
-  {  1,   5}, {  9,   0},
-  { 10,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,  16}, {  1,  20}, {  2,  15},  /* Row 93 */
-  {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  7,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34}, {  5,  15}, {  1,  34},
-  {  1,  35}, {  1,  81}, {  1,  25}, {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15},
-  {  1,  25}, {  1,  81}, {  1,  27}, {  1,  35}, {  1,  34}, {  4,  15}, {  1,  34}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35},
-  {  5,  27}, {  1,  29}, {  1,   3}, { 15,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},
-  {  1,   7}, {  1,   4}, {  1,   5}, { 10,   0},
-  { 11,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,  73}, {  1,  20}, {  2,  15}, {  1,  30},  /* Row 94 */
-  {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  8,   4}, {  1,  18},
-  {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  43}, {  1,  81}, {  1,  25},
-  {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  1,  27},
-  {  1,  43}, {  4,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  5,  15}, {  1,  34}, {  7,  38},
-  {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  28}, {  1,  49}, { 14,   4}, {  1,   3},
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 11,   0},
-  { 12,   0}, {  1,   5}, {  4,   4}, {  1,  57}, {  1,  77}, {  2,  15}, {  1,  30}, {  8,  38},  /* Row 95 */
-  {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  8,   4}, {  1,  21}, {  1,  19},
-  {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34}, {  5,  15}, {  1,  34}, {  1,  41}, {  1,  25},
-  {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  1,  35},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  34}, {  6,  15}, {  1,  30}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27}, {  1,  29}, {  1,   3}, { 12,   4},
-  {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 12,   0},
-  { 13,   0}, {  1,   5}, {  3,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38},  /* Row 96 */
-  {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  9,   4}, {  1,  18}, {  4,  15},
-  {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  78}, {  1,  77}, {  2,  15}, {  1,  30},
-  {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  1,  43}, {  4,  15}, {  1,  30},
-  {  8,  38}, {  1,  30}, {  7,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43},
-  {  5,  27}, {  1,  28}, {  1,  49}, { 11,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},
-  {  1,   7}, {  1,   4}, {  1,   5}, { 13,   0},
-  { 14,   0}, {  1,   5}, {  2,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38},  /* Row 97 */
-  {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, {  9,   4}, {  1,  21}, {  1,  19},
-  {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34}, {  5,  15}, {  1,  37}, {  3,  15}, {  1,  30},
-  {  7,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  41}, {  1,  34}, {  4,  15}, {  1,  34},
-  {  7,  38}, {  1,  34}, {  4,  15}, {  1,  37}, {  3,  15}, {  1,  30}, {  7,  38}, {  1,  34},
-  {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27}, {  1,  29}, {  1,   3}, {  9,   4}, {  1,   3},
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 14,   0},
-  { 15,   0}, {  1,   5}, {  1,   4}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38},  /* Row 98 */
-  {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, { 10,   4}, {  1,  18}, {  4,  15},
-  {  1,  30}, {  7,  38}, {  1,  30}, {  8,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15},
-  {  1,  77}, {  1,  78}, {  4,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  4,  15}, {  1,  78},
-  {  1,  34}, {  3,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27},
-  {  1,  28}, {  1,  49}, {  8,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7},
-  {  1,   4}, {  1,   5}, { 15,   0},
-  { 16,   0}, {  1,   5}, {  1,  16}, {  1,  20}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30},  /* Row 99 */
-  {  2,  15}, {  1,  25}, {  1,  81}, {  6,  27}, { 10,   4}, {  1,  21}, {  1,  19}, {  4,  15},
-  {  1,  34}, {  6,  38}, {  1,  34}, {  8,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  3,  15},
-  {  1,  37}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  94},
-  {  1,  43}, {  3,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35},
-  {  5,  27}, {  1,  29}, {  1,   3}, {  6,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11},
-  {  1,   7}, {  1,   4}, {  1,   5}, { 16,   0},
-  { 17,   0}, {  1,  95}, {  1,  96}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15},  /* Row 100 */
-  {  1,  25}, {  1,  81}, {  6,  27}, { 11,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38},
-  {  1,  30}, {  7,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  7,  15}, {  1,  30}, {  8,  38},
-  {  1,  30}, {  4,  15}, {  1,  43}, {  1,  27}, {  1,  35}, {  1,  34}, {  3,  15}, {  1,  34},
-  {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  28}, {  1,  49}, {  5,   4},
-  {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 17,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 101 */
-  {  6,  27}, { 11,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34},
-  {  7,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  7,  15}, {  1,  34}, {  7,  38}, {  1,  34},
-  {  4,  15}, {  1,  34}, {  1,  35}, {  2,  27}, {  1,  43}, {  3,  15}, {  1,  30}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27}, {  1,  29}, {  1,   3}, {  3,   4},
-  {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 18,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 102 */
-  {  6,  27}, { 12,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  6,  15},
-  {  1,  30}, {  7,  38}, {  1,  30}, {  6,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  4,  15},
-  {  1,  43}, {  3,  27}, {  1,  35}, {  1,  34}, {  3,  15}, {  1,  34}, {  7,  38}, {  1,  30},
-  {  4,  15}, {  1,  43}, {  5,  27}, {  1,  28}, {  1,  49}, {  2,   4}, {  1,   3}, {  1,   8},
-  {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 19,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 103 */
-  {  6,  27}, { 12,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34},
-  {  6,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  6,  15}, {  1,  34}, {  7,  38}, {  1,  34},
-  {  4,  15}, {  1,  34}, {  1,  35}, {  4,  27}, {  1,  43}, {  3,  15}, {  1,  30}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27}, {  1,  29}, {  2,   3}, {  1,   8},
-  {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 20,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 104 */
-  {  6,  27}, { 13,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15},
-  {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  4,  15},
-  {  1,  43}, {  5,  27}, {  1,  35}, {  1,  34}, {  3,  15}, {  1,  34}, {  7,  38}, {  1,  30},
-  {  4,  15}, {  1,  43}, {  5,  27}, {  1,  28}, {  1,  49}, {  1,   8}, {  1,   7}, {  1,  11},
-  {  1,   7}, {  1,   4}, {  1,   5}, { 21,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 105 */
-  {  6,  27}, { 13,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34},
-  {  5,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  5,  15}, {  1,  34}, {  7,  38}, {  1,  34},
-  {  4,  15}, {  1,  34}, {  1,  35}, {  6,  27}, {  1,  74}, {  3,  15}, {  1,  30}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27}, {  1,  36}, {  1,   7}, {  1,  11},
-  {  1,   7}, {  1,   4}, {  1,   5}, { 22,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 106 */
-  {  6,  27}, { 14,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  4,  15},
-  {  1,  30}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  4,  15},
-  {  1,  43}, {  6,  27}, {  1,  28}, {  1,  73}, {  1,  19}, {  3,  15}, {  1,  34}, {  7,  38},
-  {  1,  30}, {  4,  15}, {  1,  43}, {  5,  27}, {  1,  54}, {  1,  97}, {  1,   7}, {  1,   4},
-  {  1,   5}, { 23,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 107 */
-  {  6,  27}, { 14,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34},
-  {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  34},
-  {  4,  15}, {  1,  34}, {  1,  35}, {  6,  27}, {  1,  29}, {  1,   4}, {  1,  18}, {  3,  15},
-  {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  5,  27}, {  1,  98},
-  {  1,   4}, {  1,   5}, { 24,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 108 */
-  {  6,  27}, { 15,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  3,  15},
-  {  1,  30}, {  7,  38}, {  1,  30}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  4,  15},
-  {  1,  43}, {  6,  27}, {  1,  28}, {  1,  49}, {  1,   4}, {  1,  21}, {  1,  19}, {  3,  15},
-  {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  4,  27}, {  1,  57}, {  1,  99},
-  {  1,   9}, { 25,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 109 */
-  {  6,  27}, { 15,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34},
-  {  3,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  3,  15}, {  1,  34}, {  7,  38}, {  1,  34},
-  {  4,  15}, {  1,  34}, {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3}, {  2,   4}, {  1,  18},
-  {  3,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35}, {  2,  27},
-  {  1,  57}, {  1,  53}, {  2,  33}, { 25,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 110 */
-  {  6,  27}, { 16,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15},
-  {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  4,  15},
-  {  1,  43}, {  6,  27}, {  1,  28}, {  1,  49}, {  3,   4}, {  1,  21}, {  1,  19}, {  3,  15},
-  {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  1,  27}, {  1,  57}, {  1,  53},
-  {  3,  33}, {  1,   7}, { 24,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 111 */
-  {  6,  27}, { 16,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34},
-  {  2,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  2,  15}, {  1,  34}, {  7,  38}, {  1,  34},
-  {  4,  15}, {  1,  34}, {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3}, {  4,   4}, {  1,  18},
-  {  3,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,   1}, {  1,  53},
-  {  5,  33}, { 24,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 112 */
-  {  6,  27}, { 17,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  1,  15},
-  {  1,  30}, {  7,  38}, {  1,  30}, {  1,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  4,  15},
-  {  1,  43}, {  6,  27}, {  1,  28}, {  1,  49}, {  5,   4}, {  1,  21}, {  1,  19}, {  3,  15},
-  {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  70}, {  6,  33}, {  1,   7}, { 23,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 113 */
-  {  6,  27}, { 17,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34},
-  {  1,  15}, {  1,  30}, {  7,  38}, {  1,  30}, {  1,  15}, {  1,  34}, {  7,  38}, {  1,  34},
-  {  4,  15}, {  1,  34}, {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3}, {  6,   4}, {  1,  18},
-  {  3,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40}, {  6,  33},
-  { 23,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 114 */
-  {  6,  27}, { 18,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  2,  30}, {  7,  38},
-  {  2,  30}, {  8,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  28}, {  1,  49},
-  {  7,   4}, {  1,  21}, {  1,  19}, {  3,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15},
-  {  1,  45}, {  6,  33}, {  1,   7}, { 22,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  25}, {  1,  81},  /* Row 115 */
-  {  6,  27}, { 18,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34},
-  {  1,  30}, {  7,  38}, {  1,  30}, {  1,  34}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34},
-  {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3}, {  8,   4}, {  1,  18}, {  3,  15}, {  1,  30},
-  {  7,  38}, {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40}, {  6,  33}, { 22,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  77}, {  1, 100},  /* Row 116 */
-  {  6,  27}, { 19,   4}, {  1,  18}, {  4,  15}, {  1,  30}, {  7,  38}, {  1,  69}, {  7,  38},
-  {  1,  69}, {  8,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  28}, {  1,  49},
-  {  9,   4}, {  1,  21}, {  1,  19}, {  3,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15},
-  {  1,  45}, {  6,  33}, {  1,   7}, { 21,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1, 101},  /* Row 117 */
-  {  1,  57}, {  5,  27}, { 19,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38},
-  {  1,  68}, {  7,  38}, {  1,  68}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  34}, {  1,  35},
-  {  6,  27}, {  1,  29}, {  1,   3}, { 10,   4}, {  1,  18}, {  3,  15}, {  1,  30}, {  7,  38},
-  {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40}, {  6,  33}, { 21,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 118 */
-  {  1,  53}, {  1,  57}, {  4,  27}, {  1,   8}, {  1,   3}, { 18,   4}, {  1,  18}, {  4,  15},
-  {  1,  30}, { 22,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  28}, {  1,  49},
-  { 11,   4}, {  1,  21}, {  1,  19}, {  3,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15},
-  {  1,  45}, {  6,  33}, {  1,   7}, { 20,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 119 */
-  {  1,  33}, {  1,  53}, {  1,  57}, {  3,  27}, {  1,  36}, {  1,   8}, {  1,   3}, { 17,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, { 20,  38}, {  1,  34}, {  4,  15}, {  1,  34},
-  {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3}, { 12,   4}, {  1,  18}, {  3,  15}, {  1,  30},
-  {  7,  38}, {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40}, {  6,  33}, { 20,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 120 */
-  {  2,  33}, {  1,  53}, {  1,  57}, {  2,  27}, {  1,  49}, {  1,  13}, {  1,   8}, {  1,   3},
-  { 17,   4}, {  1,  18}, {  4,  15}, {  1,  30}, { 20,  38}, {  1,  30}, {  4,  15}, {  1,  43},
-  {  6,  27}, {  1,  28}, {  1,  49}, { 12,   4}, {  1,   3}, {  1,  79}, {  1,  63}, {  3,  15},
-  {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  45}, {  6,  33}, {  1,   7}, { 19,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 121 */
-  {  3,  33}, {  1,  53}, {  1,  57}, {  1,  27}, {  2,   4}, {  1,  13}, {  1,   8}, {  1,   3},
-  { 16,   4}, {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, { 18,  38}, {  1,  34}, {  4,  15},
-  {  1,  34}, {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3}, { 11,   4}, {  1,   3}, {  1,   8},
-  {  1,   7}, {  1, 102}, {  3,  15}, {  1,  30}, {  7,  38}, {  1,  34}, {  4,  15}, {  1,  31},
-  {  1,  40}, {  6,  33}, { 19,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 122 */
-  {  4,  33}, {  1,  53}, {  1,  62}, {  3,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 16,   4},
-  {  1,  18}, {  4,  15}, {  1,  30}, { 18,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27},
-  {  1,  28}, {  1,  49}, { 11,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,  79},
-  {  1,  19}, {  3,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  45}, {  6,  33},
-  {  1,   7}, { 18,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 123 */
-  {  5,  33}, {  1, 103}, {  1,   3}, {  3,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 15,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, { 16,  38}, {  1,  34}, {  4,  15}, {  1,  34},
-  {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3}, { 10,   4}, {  1,   3}, {  1,   8}, {  1,   7},
-  {  1,  11}, {  1,   7}, {  1,   4}, {  1,  53}, {  3,  15}, {  1,  30}, {  7,  38}, {  1,  34},
-  {  4,  15}, {  1,  31}, {  1,  40}, {  6,  33}, { 18,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 124 */
-  {  6,  33}, {  1,  95}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 15,   4}, {  1,  18},
-  {  4,  15}, {  1,  30}, { 16,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27}, {  1,  28},
-  {  1,  49}, { 10,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4},
-  {  1,   5}, {  1,  27}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15}, {  1,  45},
-  {  6,  33}, {  1,   7}, { 17,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 125 */
-  {  6,  33}, {  1,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 14,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, { 14,  38}, {  1,  34}, {  4,  15}, {  1,  34},
-  {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3}, {  9,   4}, {  1,   3}, {  1,   8}, {  1,   7},
-  {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, {  2,   0}, {  1,  14}, {  3,  15}, {  1,  30},
-  {  7,  38}, {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40}, {  6,  33}, { 17,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 126 */
-  {  6,  33}, {  2,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 14,   4},
-  {  1,  18}, {  4,  15}, {  1,  30}, { 14,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27},
-  {  1,  28}, {  1,  49}, {  9,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7},
-  {  1,   4}, {  1,   5}, {  4,   0}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15},
-  {  1,  45}, {  6,  33}, {  1,   7}, { 16,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 127 */
-  {  6,  33}, {  3,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 13,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, { 12,  38}, {  1,  34}, {  4,  15}, {  1,  34},
-  {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3}, {  8,   4}, {  1,   3}, {  1,   8}, {  1,   7},
-  {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, {  5,   0}, {  1,  14}, {  3,  15}, {  1,  30},
-  {  7,  38}, {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40}, {  6,  33}, { 16,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 128 */
-  {  6,  33}, {  4,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 13,   4},
-  {  1,  18}, {  4,  15}, {  1,  30}, { 12,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27},
-  {  1,  28}, {  1,  49}, {  8,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7},
-  {  1,   4}, {  1,   5}, {  7,   0}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15},
-  {  1,  45}, {  6,  33}, {  1,   7}, { 15,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 129 */
-  {  6,  33}, {  5,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 12,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, { 10,  38}, {  1,  34}, {  4,  15}, {  1,  34},
-  {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3}, {  7,   4}, {  1,   3}, {  1,   8}, {  1,   7},
-  {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, {  8,   0}, {  1,  14}, {  3,  15}, {  1,  30},
-  {  7,  38}, {  1,  34}, {  4,  15}, {  1,  31}, {  1,  40}, {  6,  33}, { 15,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 130 */
-  {  6,  33}, {  6,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 12,   4},
-  {  1,  18}, {  4,  15}, {  1,  30}, { 10,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27},
-  {  1,  28}, {  1,  49}, {  7,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7},
-  {  1,   4}, {  1,   5}, { 10,   0}, {  4,  15}, {  1,  34}, {  7,  38}, {  1,  30}, {  4,  15},
-  {  1,  22}, {  6,  33}, {  1, 104}, { 14,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 131 */
-  {  6,  33}, {  7,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 11,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  8,  38}, {  1,  34}, {  4,  15}, {  1,  34},
-  {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3}, {  6,   4}, {  1,   3}, {  1,   8}, {  1,   7},
-  {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 11,   0}, {  1,  14}, {  3,  15}, {  1,  30},
-  {  7,  38}, {  1,  44}, {  4,  15}, {  1,  45}, {  6,  33}, {  1,  65}, { 14,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 132 */
-  {  6,  33}, {  8,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 11,   4},
-  {  1,  18}, {  4,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  4,  15}, {  1,  43}, {  6,  27},
-  {  1,  28}, {  1,  49}, {  6,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7},
-  {  1,   4}, {  1,   5}, { 13,   0}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34}, {  4,  15},
-  {  1,  45}, {  7,  33}, { 14,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 133 */
-  {  6,  33}, {  9,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 10,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  34}, {  6,  38}, {  1,  34}, {  4,  15}, {  1,  34},
-  {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3}, {  5,   4}, {  1,   3}, {  1,   8}, {  1,   7},
-  {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 14,   0}, {  1,  14}, {  3,  15}, {  1,  30},
-  {  6,  38}, {  1,  44}, {  3,  15}, {  1,  55}, {  1, 105}, {  7,  33}, {  1, 104}, { 13,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 134 */
-  {  6,  33}, { 10,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 10,   4},
-  {  1,  18}, {  4,  15}, {  1,  30}, {  1, 106}, {  4,  38}, {  1, 106}, {  1,  30}, {  4,  15},
-  {  1,  43}, {  6,  27}, {  1,  28}, {  1,  49}, {  5,   4}, {  1,   3}, {  1,   8}, {  1,   7},
-  {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 16,   0}, {  4,  15}, {  1,  34}, {  5,  38},
-  {  1,  30}, {  3,  15}, {  1,  31}, {  1,  60}, {  7,  33}, {  1,   7}, { 13,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 135 */
-  {  6,  33}, { 11,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  9,   4},
-  {  1,  21}, {  1,  19}, {  4,  15}, {  1,  30}, {  1,  34}, {  2,  38}, {  1,  34}, {  1,  30},
-  {  4,  15}, {  1,  34}, {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3}, {  4,   4}, {  1,   3},
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 17,   0}, {  1,  14},
-  {  3,  15}, {  1,  30}, {  1,  34}, {  2,  38}, {  1,  34}, {  1,  30}, {  4,  15}, {  1,  45},
-  {  8,  33}, {  1,   7}, { 13,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 136 */
-  {  6,  33}, { 12,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  9,   4},
-  {  1,  18}, {  6,  15}, {  2,  30}, {  6,  15}, {  1,  43}, {  6,  27}, {  1,  28}, {  1,  49},
-  {  4,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5},
-  { 19,   0}, {  5,  15}, {  2,  30}, {  5,  15}, {  1,  31}, {  1,  40}, {  8,  33}, {  1,  50},
-  { 13,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 137 */
-  {  6,  33}, { 13,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  8,   4},
-  {  1,  21}, {  1,  19}, { 12,  15}, {  1,  34}, {  1,  35}, {  6,  27}, {  1,  29}, {  1,   3},
-  {  3,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5},
-  { 20,   0}, {  1,  14}, { 10,  15}, {  1,  39}, {  1, 107}, {  9,  33}, { 14,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  30}, {  2,  15}, {  1,  96}, {  1,  60},  /* Row 138 */
-  {  6,  33}, { 14,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  8,   4},
-  {  1,  18}, { 12,  15}, {  1,  43}, {  6,  27}, {  1,  28}, {  1,  49}, {  3,   4}, {  1,   3},
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 22,   0}, {  9,  15},
-  {  1,  39}, {  1, 107}, {  9,  33}, {  1,   7}, { 14,   0},
-  { 18,   0}, {  3,  15}, {  1,  30}, {  8,  38}, {  1,  55}, {  2,  96}, {  1, 108}, {  1,  60},  /* Row 139 */
-  {  6,  33}, { 15,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  7,   4},
-  {  1,  16}, {  1,  23}, { 10,  15}, {  1, 109}, {  1,  81}, {  6,  27}, {  1,  29}, {  1,   3},
-  {  2,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5},
-  { 23,   0}, {  1,  28}, {  1, 110}, {  5,  15}, {  1,  39}, {  1, 111}, {  1, 105}, { 10,  33},
-  { 15,   0},
-  { 25,   0}, {  1,  59}, {  4,  40}, {  4,  60}, {  7,  33}, { 16,   0}, {  1,   5}, {  4,   4},  /* Row 140 */
-  {  1,  13}, {  1,   8}, {  1,   3}, {  7,   4}, {  1,  16}, {  1,  18}, {  1,  19}, {  6,  15},
-  {  1,  34}, {  1,  43}, {  1,  81}, {  6,  27}, {  1,  28}, {  1,  49}, {  2,   4}, {  1,   3},
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 27,   0}, {  1, 112},
-  {  1,  14}, {  1, 113}, {  1,  22}, {  1,  40}, {  1,  76}, { 10,  33}, {  1,   7}, { 15,   0},
-  { 25,   0}, { 16,  33}, { 17,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3},  /* Row 141 */
-  {  8,   4}, {  1,  21}, {  1,  18}, {  1,  19}, {  1,  77}, {  1,  25}, {  1,  34}, {  1,  43},
-  {  1,  35}, {  8,  27}, {  1,   8}, {  1,   3}, {  1,   4}, {  1,   3}, {  1,   8}, {  1,   7},
-  {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 30,   0}, {  1,  50}, { 13,  33}, { 16,   0},
-  { 25,   0}, { 16,  33}, { 18,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3},  /* Row 142 */
-  {  9,   4}, {  1,  16}, {  1,  10}, {  1,  66}, {  1,  81}, {  8,  27}, {  1,  36}, {  1,   8},
-  {  1,   3}, {  1,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4},
-  {  1,   5}, { 32,   0}, {  1,   7}, { 11,  33}, { 17,   0},
-  { 25,   0}, { 16,  33}, { 19,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3},  /* Row 143 */
-  {  9,   4}, {  1,   3}, {  1,  49}, {  1,  29}, {  1,  28}, {  5,  27}, {  1,  36}, {  1,   8},
-  {  3,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5},
-  { 34,   0}, { 10,  33}, { 18,   0},
-  { 25,   0}, { 16,  33}, { 20,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3},  /* Row 144 */
-  { 10,   4}, {  1,   3}, { 10,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7},
-  {  1,   4}, {  1,   5}, { 35,   0}, {  1,  41}, {  7,  33}, {  1,   7}, { 19,   0},
-  { 25,   0}, { 16,  33}, { 21,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3},  /* Row 145 */
-  { 19,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5},
-  { 64,   0},
-  { 25,   0}, { 16,  33}, { 22,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3},  /* Row 146 */
-  { 17,   4}, {  1,   3}, {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5},
-  { 65,   0},
-  { 64,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 15,   4}, {  1,   3},  /* Row 147 */
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 66,   0},
-  { 65,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 13,   4}, {  1,   3},  /* Row 148 */
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 67,   0},
-  { 66,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, { 11,   4}, {  1,   3},  /* Row 149 */
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 68,   0},
-  { 67,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  9,   4}, {  1,   3},  /* Row 150 */
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 69,   0},
-  { 68,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  7,   4}, {  1,   3},  /* Row 151 */
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 70,   0},
-  { 69,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  5,   4}, {  1,   3},  /* Row 152 */
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 71,   0},
-  { 70,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  3,   4}, {  1,   3},  /* Row 153 */
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 72,   0},
-  { 71,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  1,   4}, {  1,   3},  /* Row 154 */
-  {  1,   8}, {  1,   7}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 73,   0},
-  { 72,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,   8}, {  1,   3}, {  1,   8}, {  1,   7},  /* Row 155 */
-  {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5}, { 74,   0},
-  { 73,   0}, {  1,   5}, {  4,   4}, {  1,  13}, {  1,  91}, {  1,   7}, {  1,  11}, {  1,   7},  /* Row 156 */
-  {  1,   4}, {  1,   5}, { 75,   0},
-  { 74,   0}, {  1,   5}, {  4,   4}, {  1, 114}, {  1,  11}, {  1,   7}, {  1,   4}, {  1,   5},  /* Row 157 */
-  { 76,   0},
-  { 75,   0}, {  1,   5}, {  2,   4}, {  1,   8}, {  1, 115}, {  1,   7}, {  1,   4}, {  1,   5},  /* Row 158 */
-  { 77,   0},
-  { 76,   0}, {  1,   5}, {  4,   4}, {  1,   5}, { 78,   0}                                       /* Row 159 */
+static const uint8_t g_nuttx_data[] =
+{
+  0xb5, 0x00, 0x02, 0x01, 0x02, 0x03, 0xfd, 0x04, 0x00, 0x05, 0xb5, 0x00,                           /* Row 0 */
+  0xb6, 0x00, 0x03, 0x01, 0x06, 0x07, 0x03, 0xfc, 0x04, 0x00, 0x05, 0xb6, 0x00,                     /* Row 1 */
+  0xb7, 0x00, 0x06, 0x01, 0x06, 0x07, 0x03, 0x08, 0x09, 0x0a, 0xfd, 0x04, 0x00, 0x05, 0xb7, 0x00,   /* Row 2 */
+  0xb8, 0x00, 0x08, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x0c, 0x0d, 0xfd, 0x04, 0x00, 0x05,   /* Row 3 */
+  0xb8, 0x00,
+  0xb9, 0x00, 0x0a, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x03, 0x08, 0x0d, 0xfd, 0x04,   /* Row 4 */
+  0x00, 0x05, 0xb9, 0x00,
+  0xba, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xff, 0x04, 0x02, 0x03, 0x08,   /* Row 5 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xba, 0x00,
+  0xbb, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xfd, 0x04, 0x02, 0x03, 0x08,   /* Row 6 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xbb, 0x00,
+  0xbc, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xfb, 0x04, 0x02, 0x03, 0x08,   /* Row 7 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xbc, 0x00,
+  0xbd, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf9, 0x04, 0x02, 0x03, 0x08,   /* Row 8 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xbd, 0x00,
+  0xbe, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf7, 0x04, 0x02, 0x03, 0x08,   /* Row 9 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xbe, 0x00,
+  0xbf, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf5, 0x04, 0x02, 0x03, 0x08,   /* Row 10 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xbf, 0x00,
+  0xc0, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf3, 0x04, 0x02, 0x03, 0x08,   /* Row 11 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xc0, 0x00,
+  0xc1, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf1, 0x04, 0x02, 0x03, 0x08,   /* Row 12 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xc1, 0x00,
+  0xc2, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xef, 0x04, 0x02, 0x03, 0x08,   /* Row 13 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xc2, 0x00,
+  0xc3, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xed, 0x04, 0x02, 0x03, 0x08,   /* Row 14 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xc3, 0x00,
+  0xc4, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xeb, 0x04, 0x02, 0x03, 0x08,   /* Row 15 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xc4, 0x00,
+  0xc5, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xe9, 0x04, 0x02, 0x03, 0x08,   /* Row 16 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xc5, 0x00,
+  0xc6, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xe7, 0x04, 0x02, 0x03, 0x08,   /* Row 17 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xc6, 0x00,
+  0xc7, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xe5, 0x04, 0x02, 0x03, 0x08,   /* Row 18 */
+  0x0d, 0xfd, 0x04, 0x00, 0x05, 0xe7, 0x00, 0x00, 0x0e, 0xfc, 0x0f, 0x00, 0x0e, 0xe8, 0x00,
+  0xc8, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf7, 0x04, 0xfc, 0x10, 0xf2,   /* Row 19 */
+  0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00, 0x05, 0xea, 0x00, 0x00, 0x11, 0xf8, 0x0f, 0x00,
+  0x11, 0xea, 0x00,
+  0xc9, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf8, 0x04, 0x02, 0x10, 0x12,   /* Row 20 */
+  0x13, 0xfe, 0x14, 0x02, 0x13, 0x12, 0x15, 0xf3, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00,
+  0x05, 0xeb, 0x00, 0xf6, 0x0f, 0x00, 0x11, 0xeb, 0x00,
+  0xea, 0x00, 0x00, 0x0e, 0xfc, 0x0f, 0x00, 0x16, 0xe8, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08,   /* Row 21 */
+  0x07, 0x0b, 0x07, 0xf8, 0x04, 0x01, 0x10, 0x17, 0xfa, 0x0f, 0x01, 0x13, 0x18, 0xf3, 0x04, 0x02,
+  0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00, 0x05, 0xed, 0x00, 0x00, 0x0e, 0xf5, 0x0f, 0x00, 0x11, 0xec,
+  0x00,
+  0xec, 0x00, 0x00, 0x11, 0xf8, 0x0f, 0x00, 0x11, 0xeb, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08,   /* Row 22 */
+  0x07, 0x0b, 0x07, 0xf8, 0x04, 0x01, 0x10, 0x17, 0xf8, 0x0f, 0x01, 0x14, 0x18, 0xfd, 0x04, 0x00,
+  0x03, 0xf8, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00, 0x05, 0xee, 0x00, 0xf3, 0x0f, 0xec,
+  0x00,
+  0xec, 0x00, 0xf6, 0x0f, 0x00, 0x11, 0xed, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b,   /* Row 23 */
+  0x07, 0xf7, 0x04, 0x00, 0x12, 0xf6, 0x0f, 0x01, 0x19, 0x1a, 0xff, 0x1b, 0x01, 0x1c, 0x1d, 0xf7,
+  0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00, 0x05, 0xf0, 0x00, 0x00, 0x0e, 0xfc, 0x0f, 0x00,
+  0x1e, 0xff, 0x1f, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x0e, 0xed, 0x00,
+  0xed, 0x00, 0x00, 0x16, 0xf5, 0x0f, 0x00, 0x20, 0xfd, 0x21, 0x00, 0x07, 0xf4, 0x00, 0x07, 0x01,   /* Row 24 */
+  0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf7, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0xfe, 0x1e,
+  0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfe, 0x1b, 0x00, 0x24, 0xf7, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd,
+  0x04, 0x00, 0x05, 0xf1, 0x00, 0xfc, 0x0f, 0x00, 0x25, 0xfd, 0x26, 0x00, 0x25, 0xfd, 0x0f, 0x02,
+  0x27, 0x28, 0x29, 0xef, 0x00,
+  0xee, 0x00, 0x00, 0x0e, 0xf4, 0x0f, 0x01, 0x1f, 0x28, 0xfc, 0x21, 0xf6, 0x00, 0x07, 0x01, 0x06,   /* Row 25 */
+  0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf6, 0x04, 0x00, 0x2a, 0xfd, 0x0f, 0x00, 0x1f, 0xfe, 0x26,
+  0x00, 0x25, 0xfc, 0x0f, 0x00, 0x2b, 0xfd, 0x1b, 0x00, 0x24, 0xf7, 0x04, 0x02, 0x03, 0x08, 0x0d,
+  0xfd, 0x04, 0x00, 0x05, 0xf3, 0x00, 0x00, 0x0e, 0xfd, 0x0f, 0x00, 0x1e, 0xfb, 0x26, 0x00, 0x1e,
+  0xfd, 0x0f, 0x02, 0x16, 0x21, 0x29, 0xf0, 0x00,
+  0xee, 0x00, 0xfc, 0x0f, 0x03, 0x1e, 0x2c, 0x22, 0x1f, 0xfb, 0x0f, 0x00, 0x2d, 0xfc, 0x21, 0x00,   /* Row 26 */
+  0x07, 0xf8, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf6, 0x04, 0x01, 0x2e,
+  0x2f, 0xfd, 0x0f, 0x00, 0x30, 0xfd, 0x26, 0x00, 0x25, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b,
+  0x00, 0x24, 0xf7, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00, 0x05, 0xf4, 0x00, 0xfc, 0x0f,
+  0x00, 0x22, 0xfb, 0x26, 0x00, 0x2c, 0xfd, 0x0f, 0x00, 0x2d, 0xff, 0x21, 0x00, 0x29, 0xf1, 0x00,
+  0xef, 0x00, 0x00, 0x0e, 0xfd, 0x0f, 0x00, 0x25, 0xfd, 0x26, 0x00, 0x1f, 0xfc, 0x0f, 0x01, 0x1f,   /* Row 27 */
+  0x28, 0xfc, 0x21, 0xf9, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf5, 0x04,
+  0x01, 0x10, 0x14, 0xfe, 0x0f, 0x00, 0x1f, 0xfb, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc,
+  0x1b, 0x01, 0x1d, 0x03, 0xf8, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00, 0x05, 0xf6, 0x00,
+  0x00, 0x0e, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x2c, 0xfd, 0x0f, 0x00, 0x2d, 0xfe, 0x21,
+  0xf1, 0x00,
+  0xef, 0x00, 0xfd, 0x0f, 0x00, 0x1e, 0xfc, 0x26, 0x01, 0x30, 0x1e, 0xfc, 0x0f, 0x00, 0x2d, 0xfc,   /* Row 28 */
+  0x21, 0x00, 0x07, 0xfb, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf4, 0x04,
+  0x01, 0x10, 0x14, 0xfe, 0x0f, 0x00, 0x13, 0xfb, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23,
+  0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf7, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00, 0x05, 0xf7,
+  0x00, 0xfc, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x16, 0xfe, 0x21, 0x00,
+  0x07, 0xf2, 0x00,
+  0xef, 0x00, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x1f, 0x28, 0xfc,   /* Row 29 */
+  0x21, 0xfc, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf3, 0x04, 0x01, 0x10,
+  0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01,
+  0x1d, 0x03, 0xf7, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00, 0x05, 0xf9, 0x00, 0x00, 0x0e,
+  0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfd, 0x21, 0xf2,
+  0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2d, 0xfc, 0x21,   /* Row 30 */
+  0x00, 0x07, 0xfe, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf2, 0x04, 0x01,
+  0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd,
+  0x1b, 0x01, 0x1c, 0x31, 0xf6, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00, 0x05, 0xfa, 0x00,
+  0xfc, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2d, 0xfc, 0x21, 0x00, 0x32,
+  0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x1f, 0x28, 0xfc,   /* Row 31 */
+  0x21, 0xff, 0x00, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf1, 0x04, 0x01, 0x10,
+  0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf8, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01,
+  0x1d, 0x03, 0xf6, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00, 0x05, 0xfc, 0x00, 0x00, 0x0e,
+  0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfc, 0x21, 0x00,
+  0x07, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf8, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2d, 0xfc, 0x21,   /* Row 32 */
+  0x08, 0x07, 0x01, 0x06, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xf0, 0x04, 0x01, 0x10, 0x14, 0xff,
+  0x0f, 0x00, 0x1e, 0xf8, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c,
+  0x31, 0xf5, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00, 0x05, 0xfd, 0x00, 0xfc, 0x0f, 0x00,
+  0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2d, 0xfb, 0x21, 0x00, 0x32, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf8, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x1f, 0x28, 0xfd,   /* Row 33 */
+  0x21, 0x07, 0x33, 0x34, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xef, 0x04, 0x01, 0x10, 0x14, 0xff,
+  0x0f, 0x00, 0x1e, 0xf7, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03,
+  0xf5, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00, 0x05, 0xff, 0x00, 0x00, 0x0e, 0xfd, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfb, 0x21, 0xf2, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf7, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2d, 0xfe, 0x21,   /* Row 34 */
+  0x07, 0x35, 0x36, 0x15, 0x03, 0x08, 0x07, 0x0b, 0x07, 0xee, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f,
+  0x00, 0x1e, 0xf7, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31,
+  0xf4, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x01, 0x05, 0x00, 0xfc, 0x0f, 0x00, 0x22, 0xfa,
+  0x26, 0x00, 0x1e, 0xfe, 0x0f, 0x01, 0x37, 0x38, 0xfb, 0x21, 0x00, 0x07, 0xf2, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf7, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x0a, 0x1f, 0x28, 0x21,   /* Row 35 */
+  0x35, 0x39, 0x1b, 0x1c, 0x3a, 0x07, 0x0b, 0x07, 0xed, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00,
+  0x1e, 0xf6, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf4, 0x04,
+  0x02, 0x03, 0x08, 0x0d, 0xfd, 0x04, 0x00, 0x3b, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22,
+  0xfd, 0x0f, 0x01, 0x1f, 0x3c, 0xfb, 0x21, 0xf1, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf6, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x02, 0x3d, 0x35, 0x39,   /* Row 36 */
+  0xfe, 0x1b, 0x02, 0x3e, 0x38, 0x07, 0xec, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf6,
+  0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf3, 0x04, 0x02,
+  0x03, 0x08, 0x0d, 0xff, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e,
+  0xfd, 0x0f, 0x00, 0x2d, 0xfb, 0x21, 0x00, 0x07, 0xf1, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf6, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x3f, 0x23, 0xfc,   /* Row 37 */
+  0x1b, 0x00, 0x40, 0xeb, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf5, 0x26, 0x00, 0x1e,
+  0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf3, 0x04, 0x04, 0x03, 0x08, 0x0d, 0x04,
+  0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfb, 0x21,
+  0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf5, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b,   /* Row 38 */
+  0x01, 0x41, 0x03, 0xec, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf5, 0x26, 0x00, 0x22,
+  0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf2, 0x04, 0x03, 0x03, 0x08, 0x42,
+  0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2d, 0xfb, 0x21, 0x00,
+  0x07, 0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf5, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd,   /* Row 39 */
+  0x1b, 0x01, 0x1c, 0x31, 0xec, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf4, 0x26, 0x00,
+  0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf1, 0x04, 0x00, 0x43, 0xfd, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfb, 0x21, 0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf4, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b,   /* Row 40 */
+  0x01, 0x1d, 0x03, 0xed, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf4, 0x26, 0x00, 0x22,
+  0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf2, 0x04, 0x01, 0x15, 0x13, 0xfd,
+  0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2d, 0xfb, 0x21, 0x00, 0x07, 0xef,
+  0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf4, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd,   /* Row 41 */
+  0x1b, 0x01, 0x1c, 0x31, 0xed, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf3, 0x26, 0x00,
+  0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf3, 0x04, 0x00, 0x12, 0xfd, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfb, 0x21, 0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf3, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b,   /* Row 42 */
+  0x01, 0x1d, 0x03, 0xee, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf3, 0x26, 0x00, 0x22,
+  0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf4, 0x04, 0x01, 0x15, 0x13, 0xfd,
+  0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2d, 0xfb, 0x21, 0x00, 0x07, 0xee,
+  0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf3, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd,   /* Row 43 */
+  0x1b, 0x01, 0x1c, 0x31, 0xee, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00,
+  0x44, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf5, 0x04,
+  0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfb,
+  0x21, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf2, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b,   /* Row 44 */
+  0x01, 0x1d, 0x03, 0xef, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x45,
+  0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf6, 0x04,
+  0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2d, 0xfb,
+  0x21, 0x00, 0x07, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x44, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f,   /* Row 45 */
+  0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xef, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00,
+  0x1e, 0xfa, 0x26, 0x01, 0x1e, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b,
+  0x01, 0x1d, 0x03, 0xf7, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd,
+  0x0f, 0x01, 0x1f, 0x28, 0xfb, 0x21, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x45, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f,   /* Row 46 */
+  0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf0, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e,
+  0xfa, 0x26, 0xff, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01,
+  0x1c, 0x31, 0xf8, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd,
+  0x0f, 0x00, 0x2d, 0xfb, 0x21, 0x00, 0x07, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x01, 0x1e, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc,   /* Row 47 */
+  0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf0, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x02, 0x1e, 0x0f, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b,
+  0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf9, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00,
+  0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfb, 0x21, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0xff, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f,   /* Row 48 */
+  0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf1, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e,
+  0xfa, 0x26, 0x02, 0x1e, 0x0f, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd,
+  0x1b, 0x01, 0x1c, 0x31, 0xfa, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00,
+  0x1e, 0xfd, 0x0f, 0x00, 0x46, 0xfb, 0x21, 0x00, 0x07, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x02, 0x1e, 0x0f, 0x22, 0xfb, 0x26, 0x00, 0x22,   /* Row 49 */
+  0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf1, 0x04, 0x01, 0x10, 0x14, 0xff,
+  0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd,
+  0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xfb, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e,
+  0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x02, 0x22, 0x01, 0x35, 0xfc, 0x21, 0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x02, 0x1e, 0x0f, 0x1e, 0xfa, 0x26, 0x00, 0x1e,   /* Row 50 */
+  0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf2, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f,
+  0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xfc, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00,
+  0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x03, 0x2b, 0x1b, 0x39, 0x35, 0xfe, 0x21, 0x00, 0x07,
+  0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x00, 0x22, 0xfb, 0x26,   /* Row 51 */
+  0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf2, 0x04, 0x01, 0x10,
+  0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00,
+  0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xfd, 0x04, 0x00, 0x12, 0xfd, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xff, 0x1b, 0x01, 0x39, 0x35,
+  0xff, 0x21, 0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26,   /* Row 52 */
+  0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf3, 0x04, 0x01, 0x10, 0x14,
+  0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22,
+  0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xfe, 0x04, 0x01, 0x15, 0x13, 0xfd,
+  0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfd, 0x1b, 0x02, 0x39, 0x35,
+  0x07, 0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfe, 0x0f, 0x00, 0x22, 0xfb, 0x26,   /* Row 53 */
+  0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf3, 0x04, 0x01, 0x10,
+  0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00,
+  0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xff, 0x04, 0x00, 0x12, 0xfd, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x47, 0x48,
+  0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26,   /* Row 54 */
+  0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf4, 0x04, 0x01, 0x10, 0x14,
+  0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22,
+  0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x04, 0x1c, 0x31, 0x04, 0x15, 0x13, 0xfd, 0x0f, 0x00,
+  0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x02, 0x1c, 0x31, 0x05, 0xea,
+  0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26,   /* Row 55 */
+  0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf4, 0x04, 0x01, 0x10,
+  0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00,
+  0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x02, 0x1d, 0x04, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa,
+  0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfb, 0x1b, 0x03, 0x31, 0x03, 0x04, 0x05, 0xeb,
+  0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26,   /* Row 56 */
+  0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf5, 0x04, 0x01, 0x10, 0x14,
+  0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22,
+  0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x02, 0x1c, 0x49, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfa,
+  0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x24, 0x0d, 0xfe, 0x04, 0x00, 0x05,
+  0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x22, 0xfb, 0x26,   /* Row 57 */
+  0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf5, 0x04, 0x01, 0x10,
+  0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfb, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00,
+  0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x00, 0x4a, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00,
+  0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x03, 0x1c, 0x31, 0x08, 0x0d, 0xfe, 0x04, 0x00,
+  0x05, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x1e, 0xfa, 0x26,   /* Row 58 */
+  0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf6, 0x04, 0x01, 0x10, 0x14,
+  0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfb, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22,
+  0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfe, 0x1b, 0x01, 0x23, 0x22, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26,
+  0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x00, 0x1d, 0xff, 0x03, 0x01, 0x08, 0x0d, 0xfe,
+  0x04, 0x00, 0x05, 0xee, 0x00,
+  0xf0, 0x00, 0x01, 0x4b, 0x37, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfb, 0x0f, 0x00,   /* Row 59 */
+  0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf6,
+  0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfa, 0x0f, 0x00, 0x22,
+  0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfe, 0x1b, 0x00, 0x2b, 0xfd, 0x0f, 0x00, 0x1e,
+  0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xff, 0x04,
+  0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04, 0x00, 0x05, 0xef, 0x00,
+  0xf1, 0x00, 0x02, 0x01, 0x4c, 0x25, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfb, 0x0f,   /* Row 60 */
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf7,
+  0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfe, 0x0f, 0x00, 0x25,
+  0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x04, 0x22, 0x23, 0x1b, 0x23, 0x22,
+  0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1d,
+  0x03, 0xfe, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04, 0x00, 0x05, 0xf0, 0x00,
+  0xf2, 0x00, 0x03, 0x01, 0x06, 0x49, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfa,   /* Row 61 */
+  0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c,
+  0x31, 0xf7, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f,
+  0x01, 0x4d, 0x4e, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x02, 0x2b, 0x4f,
+  0x2b, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b,
+  0x01, 0x1c, 0x31, 0xfc, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04, 0x00, 0x05, 0xf1, 0x00,
+  0xf3, 0x00, 0x04, 0x01, 0x06, 0x07, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e,   /* Row 62 */
+  0xfa, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d,
+  0x03, 0xf8, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f,
+  0x02, 0x19, 0x29, 0x22, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x02, 0x22,
+  0x50, 0x22, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b,
+  0x01, 0x1d, 0x03, 0xfb, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04, 0x00, 0x05, 0xf2, 0x00,
+  0xf4, 0x00, 0x05, 0x01, 0x06, 0x07, 0x04, 0x09, 0x4d, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00,   /* Row 63 */
+  0x1e, 0xfe, 0x0f, 0x00, 0x25, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01,
+  0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf8, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e,
+  0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x02, 0x19, 0x51, 0x2b, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26,
+  0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x44, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f,
+  0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xf9, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04,
+  0x00, 0x05, 0xf3, 0x00,
+  0xf5, 0x00, 0x06, 0x01, 0x06, 0x07, 0x04, 0x1c, 0x52, 0x53, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26,   /* Row 64 */
+  0x00, 0x1e, 0xff, 0x0f, 0x01, 0x4d, 0x4e, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc,
+  0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf9, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00,
+  0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x03, 0x19, 0x51, 0x23, 0x22, 0xfe, 0x0f, 0x00, 0x1e,
+  0xfa, 0x26, 0x00, 0x22, 0xf8, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b,
+  0xfb, 0x1b, 0x01, 0x1d, 0x03, 0xf8, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04, 0x00, 0x05, 0xf4,
+  0x00,
+  0xf6, 0x00, 0x07, 0x01, 0x06, 0x07, 0x04, 0x1c, 0x54, 0x55, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9,   /* Row 65 */
+  0x26, 0x00, 0x1e, 0xff, 0x0f, 0x02, 0x19, 0x29, 0x22, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00,
+  0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xf9, 0x04, 0x01, 0x10, 0x14,
+  0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x03, 0x19, 0x51, 0x1b, 0x2b, 0xfd,
+  0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfa, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd,
+  0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xf6, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe,
+  0x04, 0x00, 0x05, 0xf5, 0x00,
+  0xf7, 0x00, 0x08, 0x01, 0x06, 0x07, 0x04, 0x1c, 0x54, 0x56, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e,   /* Row 66 */
+  0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x02, 0x19, 0x51, 0x2b, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26,
+  0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xfa, 0x04, 0x01, 0x10, 0x14,
+  0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x04, 0x19, 0x51, 0x1b, 0x23, 0x22,
+  0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfa, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e,
+  0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1d, 0x03, 0xf5, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe,
+  0x04, 0x00, 0x05, 0xf6, 0x00,
+  0xf8, 0x00, 0x09, 0x01, 0x06, 0x07, 0x04, 0x1c, 0x54, 0x56, 0x04, 0x10, 0x14, 0xff, 0x0f, 0x00,   /* Row 67 */
+  0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x03, 0x19, 0x51, 0x23, 0x22, 0xfd, 0x0f, 0x00, 0x22,
+  0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31, 0xfa, 0x04,
+  0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51,
+  0xff, 0x1b, 0x00, 0x2b, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x1e,
+  0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xf3, 0x04,
+  0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04, 0x00, 0x05, 0xf7, 0x00,
+  0xf9, 0x00, 0x06, 0x01, 0x06, 0x07, 0x04, 0x1c, 0x54, 0x56, 0xff, 0x04, 0x01, 0x10, 0x14, 0xff,   /* Row 68 */
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x03, 0x19, 0x51, 0x1b, 0x2b, 0xfd, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xfb,
+  0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19,
+  0x51, 0xff, 0x1b, 0x01, 0x23, 0x22, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfc, 0x0f,
+  0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1d, 0x03, 0xf2,
+  0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04, 0x00, 0x05, 0xf8, 0x00,
+  0xfa, 0x00, 0x06, 0x01, 0x06, 0x07, 0x04, 0x1c, 0x54, 0x56, 0xfe, 0x04, 0x01, 0x10, 0x14, 0xff,   /* Row 69 */
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x04, 0x19, 0x51, 0x1b, 0x23, 0x22, 0xfd,
+  0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c,
+  0x31, 0xfb, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f,
+  0x01, 0x19, 0x51, 0xfe, 0x1b, 0x00, 0x2b, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfe,
+  0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1c,
+  0x31, 0xf0, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04, 0x00, 0x05, 0xf9, 0x00,
+  0xfb, 0x00, 0x06, 0x01, 0x06, 0x07, 0x04, 0x1c, 0x54, 0x56, 0xfd, 0x04, 0x01, 0x10, 0x14, 0xff,   /* Row 70 */
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xff, 0x1b, 0x00, 0x2b,
+  0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d,
+  0x03, 0xfc, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f,
+  0x01, 0x19, 0x51, 0xfe, 0x1b, 0x01, 0x23, 0x22, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22,
+  0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1d,
+  0x03, 0xef, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04, 0x00, 0x05, 0xfa, 0x00,
+  0xfc, 0x00, 0x06, 0x01, 0x06, 0x07, 0x04, 0x1c, 0x54, 0x56, 0xfc, 0x04, 0x01, 0x10, 0x14, 0xff,   /* Row 71 */
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xff, 0x1b, 0x01, 0x23,
+  0x22, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b,
+  0x01, 0x1c, 0x31, 0xfc, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e,
+  0xff, 0x0f, 0x01, 0x19, 0x51, 0xfd, 0x1b, 0x00, 0x2b, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x02,
+  0x1e, 0x0f, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1c,
+  0x31, 0xed, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04, 0x00, 0x05, 0xfb, 0x00,
+  0xfd, 0x00, 0x06, 0x01, 0x06, 0x07, 0x04, 0x1c, 0x54, 0x56, 0xfb, 0x04, 0x01, 0x10, 0x14, 0xff,   /* Row 72 */
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfe, 0x1b, 0x00, 0x2b,
+  0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d,
+  0x03, 0xfd, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f,
+  0x01, 0x19, 0x51, 0xfd, 0x1b, 0x01, 0x23, 0x22, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x02, 0x22,
+  0x0f, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1d, 0x03, 0xec,
+  0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04, 0x00, 0x05, 0xfc, 0x00,
+  0xfe, 0x00, 0x06, 0x01, 0x06, 0x07, 0x04, 0x1c, 0x54, 0x56, 0xfa, 0x04, 0x01, 0x10, 0x14, 0xff,   /* Row 73 */
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfe, 0x1b, 0x01, 0x23,
+  0x22, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b,
+  0x01, 0x1c, 0x31, 0xfd, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e,
+  0xff, 0x0f, 0x01, 0x19, 0x51, 0xfc, 0x1b, 0x00, 0x2b, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00,
+  0x45, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xea,
+  0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04, 0x00, 0x05, 0xfd, 0x00,
+  0xff, 0x00, 0x06, 0x01, 0x06, 0x07, 0x04, 0x1c, 0x54, 0x56, 0xf9, 0x04, 0x01, 0x10, 0x14, 0xff,   /* Row 74 */
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfd, 0x1b, 0x00, 0x2b,
+  0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d,
+  0x03, 0xfe, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f,
+  0x01, 0x19, 0x51, 0xfc, 0x1b, 0x01, 0x57, 0x22, 0xfe, 0x0f, 0x00, 0x1e, 0xf2, 0x26, 0x00, 0x1e,
+  0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1d, 0x03, 0xe9, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe,
+  0x04, 0x00, 0x05, 0xfe, 0x00,
+  0x07, 0x00, 0x01, 0x06, 0x07, 0x04, 0x1c, 0x54, 0x56, 0xf8, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f,   /* Row 75 */
+  0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfd, 0x1b, 0x01, 0x23, 0x22,
+  0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01,
+  0x1c, 0x31, 0xfe, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff,
+  0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0x00, 0x43, 0xfd, 0x0f, 0x00, 0x22, 0xf4, 0x26, 0x00, 0x22,
+  0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xe7, 0x04, 0x02, 0x03, 0x08, 0x0d,
+  0xfe, 0x04, 0x00, 0x05, 0xff, 0x00,
+  0x06, 0x01, 0x06, 0x07, 0x04, 0x1c, 0x54, 0x56, 0xf7, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00,   /* Row 76 */
+  0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfc, 0x1b, 0x00, 0x2b, 0xfd, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xff,
+  0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19,
+  0x51, 0xfb, 0x1b, 0x01, 0x15, 0x13, 0xfe, 0x0f, 0x00, 0x1e, 0xf4, 0x26, 0x00, 0x1e, 0xfd, 0x0f,
+  0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1d, 0x03, 0xe6, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04, 0x01,
+  0x05, 0x00,
+  0x05, 0x02, 0x07, 0x04, 0x1c, 0x54, 0x56, 0xf6, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e,   /* Row 77 */
+  0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfc, 0x1b, 0x01, 0x57, 0x22, 0xfd, 0x0f,
+  0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x01, 0x1c, 0x31,
+  0xff, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01,
+  0x19, 0x51, 0xfb, 0x1b, 0x01, 0x04, 0x12, 0xfd, 0x0f, 0x00, 0x22, 0xf6, 0x26, 0x00, 0x22, 0xfd,
+  0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xe4, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe,
+  0x04, 0x00, 0x05,
+  0x04, 0x03, 0x04, 0x1c, 0x54, 0x56, 0xf5, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9,   /* Row 78 */
+  0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0x00, 0x43, 0xfd, 0x0f, 0x00, 0x1e,
+  0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x04, 0x1d, 0x03, 0x04, 0x10, 0x14,
+  0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0x02,
+  0x04, 0x15, 0x13, 0xfe, 0x0f, 0x00, 0x1e, 0xf6, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb,
+  0x1b, 0x01, 0x1d, 0x03, 0xe3, 0x04, 0x02, 0x03, 0x08, 0x0d, 0xfe, 0x04,
+  0x03, 0x04, 0x58, 0x59, 0x56, 0xf4, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26,   /* Row 79 */
+  0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22,
+  0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x04, 0x1c, 0x31, 0x04, 0x10,
+  0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b,
+  0xff, 0x04, 0x00, 0x06, 0xfd, 0x0f, 0x00, 0x22, 0xf8, 0x26, 0x00, 0x13, 0xfd, 0x0f, 0x01, 0x22,
+  0x23, 0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xe1, 0x04, 0x04, 0x03, 0x08, 0x0d, 0x31, 0x03,
+  0xff, 0x04, 0x02, 0x5a, 0x08, 0x03, 0xf5, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9,   /* Row 80 */
+  0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0x01, 0x04, 0x12, 0xfd, 0x0f, 0x00,
+  0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x03, 0x1d, 0x03, 0x10, 0x14,
+  0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xff,
+  0x04, 0x00, 0x06, 0xfd, 0x0f, 0x00, 0x45, 0xf8, 0x26, 0x00, 0x1f, 0xfd, 0x0f, 0x00, 0x2b, 0xfb,
+  0x1b, 0x01, 0x1d, 0x03, 0xe0, 0x04, 0x03, 0x03, 0x5b, 0x51, 0x04,
+  0xfe, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf6, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9,   /* Row 81 */
+  0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0x02, 0x04, 0x15, 0x13, 0xfd, 0x0f,
+  0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b, 0x03, 0x1c, 0x31,
+  0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,
+  0x1b, 0x02, 0x04, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xf9, 0x26, 0x00, 0x5c, 0xfd, 0x0f, 0x01,
+  0x44, 0x5d, 0xfb, 0x1b, 0x00, 0x31, 0xe0, 0x04, 0x04, 0x03, 0x08, 0x07, 0x38, 0x08,
+  0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf7, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9,   /* Row 82 */
+  0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xff, 0x04, 0x00, 0x12, 0xfd, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x02, 0x1d, 0x10, 0x14,
+  0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0x01,
+  0x04, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xf7, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b,
+  0x00, 0x31, 0xe1, 0x04, 0x05, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04,
+  0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf8, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00,   /* Row 83 */
+  0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xff, 0x04, 0x01, 0x15,
+  0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23, 0xfd, 0x1b,
+  0x02, 0x1c, 0x07, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19,
+  0x51, 0xfb, 0x1b, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xf7, 0x26, 0x00, 0x22, 0xfd, 0x0f,
+  0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xe3, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07,
+  0x04, 0x05,
+  0x01, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf9, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f,   /* Row 84 */
+  0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xfe, 0x04, 0x00,
+  0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01,
+  0x0a, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,
+  0x1b, 0x00, 0x43, 0xfd, 0x0f, 0x00, 0x1e, 0xf5, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc,
+  0x1b, 0x01, 0x1c, 0x31, 0xe4, 0x04, 0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0x00,
+  0xff, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xfa, 0x04, 0x01, 0x10, 0x14, 0xff,   /* Row 85 */
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xfe, 0x04,
+  0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23,
+  0xfd, 0x1b, 0x01, 0x51, 0x4d, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01,
+  0x19, 0x51, 0xfc, 0x1b, 0x01, 0x57, 0x22, 0xfd, 0x0f, 0x00, 0x22, 0xf5, 0x26, 0x00, 0x22, 0xfd,
+  0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xe6, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b,
+  0x07, 0x04, 0x05, 0xff, 0x00,
+  0xfe, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xfb, 0x04, 0x01, 0x10, 0x14, 0xff,   /* Row 86 */
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xfd, 0x04,
+  0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfd, 0x1b,
+  0x01, 0x51, 0x19, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51,
+  0xfc, 0x1b, 0x00, 0x2b, 0xfd, 0x0f, 0x00, 0x1e, 0xf3, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b,
+  0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xe7, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xfe,
+  0x00,
+  0xfd, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xfc, 0x04, 0x01, 0x10, 0x14, 0xff,   /* Row 87 */
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xfd, 0x04,
+  0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23,
+  0xfe, 0x1b, 0x01, 0x51, 0x19, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01,
+  0x19, 0x51, 0xfd, 0x1b, 0x01, 0x23, 0x22, 0xfd, 0x0f, 0x00, 0x22, 0xf3, 0x26, 0x00, 0x22, 0xfd,
+  0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xe9, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b,
+  0x07, 0x04, 0x05, 0xfd, 0x00,
+  0xfc, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xfd, 0x04, 0x01, 0x10, 0x14, 0xff,   /* Row 88 */
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xfc, 0x04,
+  0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xfe, 0x1b,
+  0x01, 0x51, 0x19, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51,
+  0xfd, 0x1b, 0x00, 0x2b, 0xfd, 0x0f, 0x00, 0x1e, 0xf1, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b,
+  0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xea, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xfc,
+  0x00,
+  0xfb, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xfe, 0x04, 0x01, 0x10, 0x14, 0xff,   /* Row 89 */
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xfc, 0x04,
+  0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x01, 0x22, 0x23,
+  0xff, 0x1b, 0x01, 0x51, 0x19, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01,
+  0x19, 0x51, 0xfe, 0x1b, 0x01, 0x23, 0x22, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x01, 0x22, 0x45,
+  0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xec, 0x04,
+  0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xfb, 0x00,
+  0xfa, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xff, 0x04, 0x01, 0x10, 0x14, 0xff,   /* Row 90 */
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xfb, 0x04,
+  0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x2b, 0xff, 0x1b,
+  0x01, 0x51, 0x19, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51,
+  0xfe, 0x1b, 0x00, 0x2b, 0xfd, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x02, 0x1e, 0x0f, 0x22, 0xfa, 0x26,
+  0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xed, 0x04, 0x06, 0x03, 0x08,
+  0x07, 0x0b, 0x07, 0x04, 0x05, 0xfa, 0x00,
+  0xf9, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x05, 0x0d, 0x08, 0x03, 0x04, 0x10, 0x14, 0xff, 0x0f, 0x00,   /* Row 91 */
+  0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xfb, 0x04, 0x01, 0x15,
+  0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x04, 0x22, 0x23, 0x1b, 0x51,
+  0x19, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xff, 0x1b,
+  0x01, 0x23, 0x22, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x22, 0xff, 0x0f, 0x00, 0x1e, 0xfa,
+  0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xef, 0x04, 0x06,
+  0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf9, 0x00,
+  0xf8, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x04, 0x0d, 0x08, 0x03, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e,   /* Row 92 */
+  0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xfa, 0x04, 0x00, 0x12, 0xfd,
+  0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x03, 0x2b, 0x1b, 0x51, 0x19, 0xff, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xff, 0x1b, 0x00, 0x2b, 0xfd,
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd,
+  0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xf0, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07,
+  0x04, 0x05, 0xf8, 0x00,
+  0xf7, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x03, 0x0d, 0x08, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9,   /* Row 93 */
+  0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xfa, 0x04, 0x01, 0x15, 0x13, 0xfd,
+  0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x03, 0x22, 0x23, 0x51, 0x19, 0xff, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x04, 0x19, 0x51, 0x1b, 0x23, 0x22, 0xfd, 0x0f,
+  0x00, 0x22, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f,
+  0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf2, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07,
+  0x04, 0x05, 0xf7, 0x00,
+  0xf6, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x49, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26,   /* Row 94 */
+  0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xf9, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00,
+  0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x02, 0x2b, 0x51, 0x19, 0xff, 0x0f, 0x00, 0x1e, 0xfa,
+  0x26, 0x00, 0x1e, 0xff, 0x0f, 0x03, 0x19, 0x51, 0x1b, 0x2b, 0xfd, 0x0f, 0x00, 0x1e, 0xf9, 0x26,
+  0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b,
+  0x01, 0x1c, 0x31, 0xf3, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf6, 0x00,
+  0xf5, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x01, 0x39, 0x4d, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00,   /* Row 95 */
+  0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xf9, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00,
+  0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x02, 0x22, 0x29, 0x19, 0xff, 0x0f, 0x00, 0x1e, 0xfa,
+  0x26, 0x00, 0x1e, 0xff, 0x0f, 0x03, 0x19, 0x51, 0x23, 0x22, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26,
+  0x00, 0x22, 0xfb, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc,
+  0x1b, 0x01, 0x1d, 0x03, 0xf5, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf5, 0x00,
+  0xf4, 0x00, 0x00, 0x05, 0xfe, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00,   /* Row 96 */
+  0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xf8, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e,
+  0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x01, 0x4e, 0x4d, 0xff, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00,
+  0x1e, 0xff, 0x0f, 0x02, 0x19, 0x51, 0x2b, 0xfd, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfa,
+  0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1c, 0x31,
+  0xf6, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf4, 0x00,
+  0xf3, 0x00, 0x00, 0x05, 0xff, 0x04, 0x01, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00,   /* Row 97 */
+  0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xf8, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00,
+  0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f, 0x00, 0x25, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00,
+  0x1e, 0xff, 0x0f, 0x02, 0x19, 0x29, 0x22, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x22, 0xfd,
+  0x0f, 0x00, 0x25, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23,
+  0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xf8, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf3,
+  0x00,
+  0xf2, 0x00, 0x03, 0x05, 0x04, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff,   /* Row 98 */
+  0x0f, 0x01, 0x19, 0x51, 0xfb, 0x1b, 0xf7, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26,
+  0x00, 0x1e, 0xf9, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x4d, 0x4e, 0xfd,
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x01, 0x4e, 0x22, 0xfe, 0x0f, 0x00, 0x22,
+  0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xf9, 0x04, 0x06,
+  0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf2, 0x00,
+  0xf1, 0x00, 0x02, 0x05, 0x10, 0x14, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f,   /* Row 99 */
+  0x01, 0x19, 0x51, 0xfb, 0x1b, 0xf7, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26,
+  0x00, 0x22, 0xf9, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfe, 0x0f, 0x00, 0x25, 0xfd, 0x0f,
+  0x00, 0x22, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x02, 0x22, 0x5e, 0x2b, 0xfe, 0x0f, 0x00, 0x1e,
+  0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xfb, 0x04,
+  0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf1, 0x00,
+  0xf0, 0x00, 0x01, 0x5f, 0x60, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01,   /* Row 100 */
+  0x19, 0x51, 0xfb, 0x1b, 0xf6, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e,
+  0xfa, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfa, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e,
+  0xfd, 0x0f, 0x03, 0x2b, 0x1b, 0x23, 0x22, 0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd,
+  0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xfc, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07,
+  0x04, 0x05, 0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 101 */
+  0x1b, 0xf6, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfa, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfa, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f,
+  0x01, 0x22, 0x23, 0xff, 0x1b, 0x00, 0x2b, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd,
+  0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x01, 0x1d, 0x03, 0xfe, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b,
+  0x07, 0x04, 0x05, 0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 102 */
+  0x1b, 0xf5, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfb, 0x0f, 0x00,
+  0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfb, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00,
+  0x2b, 0xfe, 0x1b, 0x01, 0x23, 0x22, 0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f,
+  0x00, 0x2b, 0xfc, 0x1b, 0x01, 0x1c, 0x31, 0xff, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04,
+  0x05, 0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 103 */
+  0x1b, 0xf5, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfb, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfb, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f,
+  0x01, 0x22, 0x23, 0xfd, 0x1b, 0x00, 0x2b, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd,
+  0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x00, 0x1d, 0xff, 0x03, 0x05, 0x08, 0x07, 0x0b, 0x07, 0x04,
+  0x05, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 104 */
+  0x1b, 0xf4, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00,
+  0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00,
+  0x2b, 0xfc, 0x1b, 0x01, 0x23, 0x22, 0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f,
+  0x00, 0x2b, 0xfc, 0x1b, 0x07, 0x1c, 0x31, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 105 */
+  0x1b, 0xf4, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfc, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfc, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f,
+  0x01, 0x22, 0x23, 0xfb, 0x1b, 0x00, 0x4a, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd,
+  0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x05, 0x24, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 106 */
+  0x1b, 0xf3, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00,
+  0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00,
+  0x2b, 0xfb, 0x1b, 0x02, 0x1c, 0x49, 0x13, 0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd,
+  0x0f, 0x00, 0x2b, 0xfc, 0x1b, 0x04, 0x36, 0x61, 0x07, 0x04, 0x05, 0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 107 */
+  0x1b, 0xf3, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfd, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f,
+  0x01, 0x22, 0x23, 0xfb, 0x1b, 0x02, 0x1d, 0x04, 0x12, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00,
+  0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfc, 0x1b, 0x02, 0x62, 0x04, 0x05, 0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 108 */
+  0x1b, 0xf2, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfe, 0x0f, 0x00,
+  0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00,
+  0x2b, 0xfb, 0x1b, 0x04, 0x1c, 0x31, 0x04, 0x15, 0x13, 0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00,
+  0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfd, 0x1b, 0x02, 0x39, 0x63, 0x09, 0xe8, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 109 */
+  0x1b, 0xf2, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfe, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f,
+  0x01, 0x22, 0x23, 0xfb, 0x1b, 0x01, 0x1d, 0x03, 0xff, 0x04, 0x00, 0x12, 0xfe, 0x0f, 0x00, 0x1e,
+  0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xff, 0x1b, 0x01, 0x39, 0x35, 0xff, 0x21,
+  0xe8, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 110 */
+  0x1b, 0xf1, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x00,
+  0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00,
+  0x2b, 0xfb, 0x1b, 0x01, 0x1c, 0x31, 0xfe, 0x04, 0x01, 0x15, 0x13, 0xfe, 0x0f, 0x00, 0x22, 0xfa,
+  0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x03, 0x2b, 0x1b, 0x39, 0x35, 0xfe, 0x21, 0x00, 0x07, 0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 111 */
+  0x1b, 0xf1, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xff, 0x0f,
+  0x00, 0x1e, 0xfa, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f,
+  0x01, 0x22, 0x23, 0xfb, 0x1b, 0x01, 0x1d, 0x03, 0xfd, 0x04, 0x00, 0x12, 0xfe, 0x0f, 0x00, 0x1e,
+  0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x02, 0x22, 0x01, 0x35, 0xfc, 0x21, 0xe9, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 112 */
+  0x1b, 0xf0, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x02, 0x1e, 0x0f, 0x1e, 0xfa,
+  0x26, 0x02, 0x1e, 0x0f, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01,
+  0x1c, 0x31, 0xfc, 0x04, 0x01, 0x15, 0x13, 0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd,
+  0x0f, 0x00, 0x46, 0xfb, 0x21, 0x00, 0x07, 0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 113 */
+  0x1b, 0xf0, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x02, 0x22, 0x0f, 0x1e,
+  0xfa, 0x26, 0x02, 0x1e, 0x0f, 0x22, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfb,
+  0x1b, 0x01, 0x1d, 0x03, 0xfb, 0x04, 0x00, 0x12, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22,
+  0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfb, 0x21, 0xea, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 114 */
+  0x1b, 0xef, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0xff, 0x1e, 0xfa, 0x26, 0xff,
+  0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1c, 0x31, 0xfa, 0x04,
+  0x01, 0x15, 0x13, 0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2d, 0xfb,
+  0x21, 0x00, 0x07, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x19, 0x51, 0xfb,   /* Row 115 */
+  0x1b, 0xef, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x01, 0x22, 0x1e, 0xfa,
+  0x26, 0x01, 0x1e, 0x22, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfb, 0x1b, 0x01,
+  0x1d, 0x03, 0xf9, 0x04, 0x00, 0x12, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f,
+  0x01, 0x1f, 0x28, 0xfb, 0x21, 0xeb, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x4d, 0x64, 0xfb,   /* Row 116 */
+  0x1b, 0xee, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x45, 0xfa, 0x26, 0x00,
+  0x45, 0xf9, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1c, 0x31, 0xf8, 0x04,
+  0x01, 0x15, 0x13, 0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2d, 0xfb,
+  0x21, 0x00, 0x07, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x02, 0x60, 0x65, 0x39,   /* Row 117 */
+  0xfc, 0x1b, 0xee, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x44, 0xfa,
+  0x26, 0x00, 0x44, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfb, 0x1b, 0x01, 0x1d,
+  0x03, 0xf7, 0x04, 0x00, 0x12, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01,
+  0x1f, 0x28, 0xfb, 0x21, 0xec, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x03, 0x60, 0x3c, 0x35,   /* Row 118 */
+  0x39, 0xfd, 0x1b, 0x01, 0x08, 0x03, 0xef, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00, 0x1e, 0xeb, 0x26,
+  0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1c, 0x31, 0xf6, 0x04, 0x01, 0x15, 0x13,
+  0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2d, 0xfb, 0x21, 0x00, 0x07,
+  0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x04, 0x60, 0x3c, 0x21,   /* Row 119 */
+  0x35, 0x39, 0xfe, 0x1b, 0x02, 0x24, 0x08, 0x03, 0xf0, 0x04, 0x01, 0x15, 0x13, 0xfd, 0x0f, 0x00,
+  0x22, 0xed, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfb, 0x1b, 0x01, 0x1d, 0x03, 0xf5,
+  0x04, 0x00, 0x12, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28,
+  0xfb, 0x21, 0xed, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xff,   /* Row 120 */
+  0x21, 0x01, 0x35, 0x39, 0xff, 0x1b, 0x03, 0x31, 0x0d, 0x08, 0x03, 0xf0, 0x04, 0x00, 0x12, 0xfd,
+  0x0f, 0x00, 0x1e, 0xed, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1c, 0x31,
+  0xf5, 0x04, 0x02, 0x03, 0x4f, 0x3f, 0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f,
+  0x00, 0x2d, 0xfb, 0x21, 0x00, 0x07, 0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfe,   /* Row 121 */
+  0x21, 0x02, 0x35, 0x39, 0x1b, 0xff, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf1, 0x04, 0x01, 0x15, 0x13,
+  0xfd, 0x0f, 0x00, 0x22, 0xef, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfb, 0x1b, 0x01,
+  0x1d, 0x03, 0xf6, 0x04, 0x03, 0x03, 0x08, 0x07, 0x66, 0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00,
+  0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfb, 0x21, 0xee, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfd,   /* Row 122 */
+  0x21, 0x01, 0x35, 0x3e, 0xfe, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf1, 0x04, 0x00, 0x12, 0xfd, 0x0f,
+  0x00, 0x1e, 0xef, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1c, 0x31, 0xf6,
+  0x04, 0x05, 0x03, 0x08, 0x07, 0x0b, 0x4f, 0x13, 0xfe, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00, 0x1e,
+  0xfd, 0x0f, 0x00, 0x2d, 0xfb, 0x21, 0x00, 0x07, 0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfc,   /* Row 123 */
+  0x21, 0x01, 0x67, 0x03, 0xfe, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf2, 0x04, 0x01, 0x15, 0x13, 0xfd,
+  0x0f, 0x00, 0x22, 0xf1, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfb, 0x1b, 0x01, 0x1d,
+  0x03, 0xf7, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x35, 0xfe, 0x0f, 0x00, 0x1e, 0xfa,
+  0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfb, 0x21, 0xef, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 124 */
+  0x21, 0x00, 0x5f, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf2, 0x04, 0x00, 0x12, 0xfd, 0x0f, 0x00,
+  0x1e, 0xf1, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1c, 0x31, 0xf7, 0x04,
+  0x07, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0x1b, 0xfd, 0x0f, 0x00, 0x22, 0xfa, 0x26, 0x00,
+  0x1e, 0xfd, 0x0f, 0x00, 0x2d, 0xfb, 0x21, 0x00, 0x07, 0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 125 */
+  0x21, 0x01, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf3, 0x04, 0x01, 0x15, 0x13, 0xfd,
+  0x0f, 0x00, 0x22, 0xf3, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfb, 0x1b, 0x01, 0x1d,
+  0x03, 0xf8, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xff, 0x00, 0x00, 0x0e, 0xfe,
+  0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfb, 0x21, 0xf0, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 126 */
+  0x21, 0xff, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf3, 0x04, 0x00, 0x12, 0xfd,
+  0x0f, 0x00, 0x1e, 0xf3, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1c, 0x31,
+  0xf8, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xfd, 0x00, 0xfd, 0x0f, 0x00, 0x22,
+  0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2d, 0xfb, 0x21, 0x00, 0x07, 0xf1, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 127 */
+  0x21, 0xfe, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf4, 0x04, 0x01, 0x15, 0x13,
+  0xfd, 0x0f, 0x00, 0x22, 0xf5, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfb, 0x1b, 0x01,
+  0x1d, 0x03, 0xf9, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xfc, 0x00, 0x00, 0x0e,
+  0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfb, 0x21, 0xf1,
+  0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 128 */
+  0x21, 0xfd, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf4, 0x04, 0x00, 0x12, 0xfd,
+  0x0f, 0x00, 0x1e, 0xf5, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1c, 0x31,
+  0xf9, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xfa, 0x00, 0xfd, 0x0f, 0x00, 0x22,
+  0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2d, 0xfb, 0x21, 0x00, 0x07, 0xf2, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 129 */
+  0x21, 0xfc, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf5, 0x04, 0x01, 0x15, 0x13,
+  0xfd, 0x0f, 0x00, 0x22, 0xf7, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfb, 0x1b, 0x01,
+  0x1d, 0x03, 0xfa, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf9, 0x00, 0x00, 0x0e,
+  0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x1f, 0x28, 0xfb, 0x21, 0xf2,
+  0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 130 */
+  0x21, 0xfb, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf5, 0x04, 0x00, 0x12, 0xfd,
+  0x0f, 0x00, 0x1e, 0xf7, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1c, 0x31,
+  0xfa, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf7, 0x00, 0xfd, 0x0f, 0x00, 0x22,
+  0xfa, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x16, 0xfb, 0x21, 0x00, 0x68, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 131 */
+  0x21, 0xfa, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf6, 0x04, 0x01, 0x15, 0x13,
+  0xfd, 0x0f, 0x00, 0x22, 0xf9, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfb, 0x1b, 0x01,
+  0x1d, 0x03, 0xfb, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf6, 0x00, 0x00, 0x0e,
+  0xfe, 0x0f, 0x00, 0x1e, 0xfa, 0x26, 0x00, 0x2c, 0xfd, 0x0f, 0x00, 0x2d, 0xfb, 0x21, 0x00, 0x41,
+  0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 132 */
+  0x21, 0xf9, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf6, 0x04, 0x00, 0x12, 0xfd,
+  0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1c, 0x31,
+  0xfb, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf4, 0x00, 0xfd, 0x0f, 0x00, 0x22,
+  0xfb, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x00, 0x2d, 0xfa, 0x21, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 133 */
+  0x21, 0xf8, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf7, 0x04, 0x01, 0x15, 0x13,
+  0xfd, 0x0f, 0x00, 0x22, 0xfb, 0x26, 0x00, 0x22, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfb, 0x1b, 0x01,
+  0x1d, 0x03, 0xfc, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf3, 0x00, 0x00, 0x0e,
+  0xfe, 0x0f, 0x00, 0x1e, 0xfb, 0x26, 0x00, 0x2c, 0xfe, 0x0f, 0x01, 0x37, 0x69, 0xfa, 0x21, 0x00,
+  0x68, 0xf4, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 134 */
+  0x21, 0xf7, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf7, 0x04, 0x00, 0x12, 0xfd,
+  0x0f, 0x01, 0x1e, 0x6a, 0xfd, 0x26, 0x01, 0x6a, 0x1e, 0xfd, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01,
+  0x1c, 0x31, 0xfc, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf1, 0x00, 0xfd, 0x0f,
+  0x00, 0x22, 0xfc, 0x26, 0x00, 0x1e, 0xfe, 0x0f, 0x01, 0x1f, 0x3c, 0xfa, 0x21, 0x00, 0x07, 0xf4,
+  0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 135 */
+  0x21, 0xf6, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf8, 0x04, 0x01, 0x15, 0x13,
+  0xfd, 0x0f, 0x01, 0x1e, 0x22, 0xff, 0x26, 0x01, 0x22, 0x1e, 0xfd, 0x0f, 0x01, 0x22, 0x23, 0xfb,
+  0x1b, 0x01, 0x1d, 0x03, 0xfd, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xf0, 0x00,
+  0x00, 0x0e, 0xfe, 0x0f, 0x01, 0x1e, 0x22, 0xff, 0x26, 0x01, 0x22, 0x1e, 0xfd, 0x0f, 0x00, 0x2d,
+  0xf9, 0x21, 0x00, 0x07, 0xf4, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 136 */
+  0x21, 0xf5, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf8, 0x04, 0x00, 0x12, 0xfb,
+  0x0f, 0xff, 0x1e, 0xfb, 0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1c, 0x31, 0xfd, 0x04, 0x06, 0x03,
+  0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xee, 0x00, 0xfc, 0x0f, 0xff, 0x1e, 0xfc, 0x0f, 0x01, 0x1f,
+  0x28, 0xf9, 0x21, 0x00, 0x32, 0xf4, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 137 */
+  0x21, 0xf4, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf9, 0x04, 0x01, 0x15, 0x13,
+  0xf5, 0x0f, 0x01, 0x22, 0x23, 0xfb, 0x1b, 0x01, 0x1d, 0x03, 0xfe, 0x04, 0x06, 0x03, 0x08, 0x07,
+  0x0b, 0x07, 0x04, 0x05, 0xed, 0x00, 0x00, 0x0e, 0xf7, 0x0f, 0x01, 0x27, 0x6b, 0xf8, 0x21, 0xf3,
+  0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x1e, 0xff, 0x0f, 0x01, 0x60, 0x3c, 0xfb,   /* Row 138 */
+  0x21, 0xf3, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf9, 0x04, 0x00, 0x12, 0xf5,
+  0x0f, 0x00, 0x2b, 0xfb, 0x1b, 0x01, 0x1c, 0x31, 0xfe, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07,
+  0x04, 0x05, 0xeb, 0x00, 0xf8, 0x0f, 0x01, 0x27, 0x6b, 0xf8, 0x21, 0x00, 0x07, 0xf3, 0x00,
+  0xef, 0x00, 0xfe, 0x0f, 0x00, 0x1e, 0xf9, 0x26, 0x00, 0x37, 0xff, 0x60, 0x01, 0x6c, 0x3c, 0xfb,   /* Row 139 */
+  0x21, 0xf2, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xfa, 0x04, 0x01, 0x10, 0x17,
+  0xf7, 0x0f, 0x01, 0x6d, 0x51, 0xfb, 0x1b, 0x01, 0x1d, 0x03, 0xff, 0x04, 0x06, 0x03, 0x08, 0x07,
+  0x0b, 0x07, 0x04, 0x05, 0xea, 0x00, 0x01, 0x1c, 0x6e, 0xfc, 0x0f, 0x02, 0x27, 0x6f, 0x69, 0xf7,
+  0x21, 0xf2, 0x00,
+  0xe8, 0x00, 0x00, 0x3b, 0xfd, 0x28, 0xfd, 0x3c, 0xfa, 0x21, 0xf1, 0x00, 0x00, 0x05, 0xfd, 0x04,   /* Row 140 */
+  0x02, 0x0d, 0x08, 0x03, 0xfa, 0x04, 0x02, 0x10, 0x12, 0x13, 0xfb, 0x0f, 0x02, 0x22, 0x2b, 0x51,
+  0xfb, 0x1b, 0x01, 0x1c, 0x31, 0xff, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xe6,
+  0x00, 0x05, 0x70, 0x0e, 0x71, 0x16, 0x28, 0x4c, 0xf7, 0x21, 0x00, 0x07, 0xf2, 0x00,
+  0xe8, 0x00, 0xf1, 0x21, 0xf0, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf9, 0x04,   /* Row 141 */
+  0x07, 0x15, 0x12, 0x13, 0x4d, 0x19, 0x22, 0x2b, 0x23, 0xf9, 0x1b, 0x09, 0x08, 0x03, 0x04, 0x03,
+  0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xe3, 0x00, 0x00, 0x32, 0xf4, 0x21, 0xf1, 0x00,
+  0xe8, 0x00, 0xf1, 0x21, 0xef, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf8, 0x04,   /* Row 142 */
+  0x03, 0x10, 0x0a, 0x42, 0x51, 0xf9, 0x1b, 0x0a, 0x24, 0x08, 0x03, 0x04, 0x03, 0x08, 0x07, 0x0b,
+  0x07, 0x04, 0x05, 0xe1, 0x00, 0x00, 0x07, 0xf6, 0x21, 0xf0, 0x00,
+  0xe8, 0x00, 0xf1, 0x21, 0xee, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf8, 0x04,   /* Row 143 */
+  0x03, 0x03, 0x31, 0x1d, 0x1c, 0xfc, 0x1b, 0x01, 0x24, 0x08, 0xfe, 0x04, 0x06, 0x03, 0x08, 0x07,
+  0x0b, 0x07, 0x04, 0x05, 0xdf, 0x00, 0xf7, 0x21, 0xef, 0x00,
+  0xe8, 0x00, 0xf1, 0x21, 0xed, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf7, 0x04,   /* Row 144 */
+  0x00, 0x03, 0xf7, 0x04, 0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xde, 0x00, 0x00, 0x29,
+  0xfa, 0x21, 0x00, 0x07, 0xee, 0x00,
+  0xe8, 0x00, 0xf1, 0x21, 0xec, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xee, 0x04,   /* Row 145 */
+  0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xc1, 0x00,
+  0xe8, 0x00, 0xf1, 0x21, 0xeb, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf0, 0x04,   /* Row 146 */
+  0x06, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xc0, 0x00,
+  0xc1, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf2, 0x04, 0x06, 0x03, 0x08, 0x07,   /* Row 147 */
+  0x0b, 0x07, 0x04, 0x05, 0xbf, 0x00,
+  0xc0, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf4, 0x04, 0x06, 0x03, 0x08, 0x07,   /* Row 148 */
+  0x0b, 0x07, 0x04, 0x05, 0xbe, 0x00,
+  0xbf, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf6, 0x04, 0x06, 0x03, 0x08, 0x07,   /* Row 149 */
+  0x0b, 0x07, 0x04, 0x05, 0xbd, 0x00,
+  0xbe, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xf8, 0x04, 0x06, 0x03, 0x08, 0x07,   /* Row 150 */
+  0x0b, 0x07, 0x04, 0x05, 0xbc, 0x00,
+  0xbd, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xfa, 0x04, 0x06, 0x03, 0x08, 0x07,   /* Row 151 */
+  0x0b, 0x07, 0x04, 0x05, 0xbb, 0x00,
+  0xbc, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xfc, 0x04, 0x06, 0x03, 0x08, 0x07,   /* Row 152 */
+  0x0b, 0x07, 0x04, 0x05, 0xba, 0x00,
+  0xbb, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x02, 0x0d, 0x08, 0x03, 0xfe, 0x04, 0x06, 0x03, 0x08, 0x07,   /* Row 153 */
+  0x0b, 0x07, 0x04, 0x05, 0xb9, 0x00,
+  0xba, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x0a, 0x0d, 0x08, 0x03, 0x04, 0x03, 0x08, 0x07, 0x0b, 0x07,   /* Row 154 */
+  0x04, 0x05, 0xb8, 0x00,
+  0xb9, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x08, 0x0d, 0x08, 0x03, 0x08, 0x07, 0x0b, 0x07, 0x04, 0x05,   /* Row 155 */
+  0xb7, 0x00,
+  0xb8, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x06, 0x0d, 0x5b, 0x07, 0x0b, 0x07, 0x04, 0x05, 0xb6, 0x00,   /* Row 156 */
+  0xb7, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x04, 0x72, 0x0b, 0x07, 0x04, 0x05, 0xb5, 0x00,               /* Row 157 */
+  0xb6, 0x00, 0x00, 0x05, 0xff, 0x04, 0x04, 0x08, 0x73, 0x07, 0x04, 0x05, 0xb4, 0x00,               /* Row 158 */
+  0xb5, 0x00, 0x00, 0x05, 0xfd, 0x04, 0x00, 0x05, 0xb3, 0x00                                        /* Row 159 */
+};
+
+static const uint32_t g_nuttx_rows[IMAGE_HEIGHT] =
+{
+      0,    12,    25,    41,    59,    79,   102,   125,   148,   171,                             /* Rows 0-9 */
+    194,   217,   240,   263,   286,   309,   332,   355,   378,   409,                             /* Rows 10-19 */
+    444,   485,   534,   583,   642,   711,   783,   863,   945,  1028,                             /* Rows 20-29 */
+   1109,  1191,  1274,  1353,  1432,  1510,  1583,  1657,  1723,  1790,                             /* Rows 30-39 */
+   1853,  1918,  1981,  2046,  2113,  2182,  2254,  2327,  2401,  2476,                             /* Rows 40-49 */
+   2554,  2636,  2720,  2803,  2885,  2966,  3047,  3129,  3212,  3297,                             /* Rows 50-59 */
+   3387,  3480,  3575,  3670,  3770,  3867,  3968,  4069,  4175,  4282,                             /* Rows 60-69 */
+   4391,  4500,  4609,  4716,  4823,  4924,  5026,  5124,  5223,  5315,                             /* Rows 70-79 */
+   5409,  5500,  5594,  5685,  5783,  5878,  5979,  6076,  6177,  6274,                             /* Rows 80-89 */
+   6380,  6483,  6588,  6688,  6788,  6883,  6979,  7071,  7168,  7257,                             /* Rows 90-99 */
+   7347,  7431,  7516,  7599,  7682,  7761,  7840,  7917,  7995,  8072,                             /* Rows 100-109 */
+   8154,  8234,  8312,  8385,  8458,  8527,  8598,  8667,  8737,  8803,                             /* Rows 110-119 */
+   8871,  8943,  9017,  9091,  9167,  9242,  9322,  9400,  9481,  9559,                             /* Rows 120-129 */
+   9640,  9718,  9800,  9876,  9959, 10040, 10126, 10197, 10262, 10325,                             /* Rows 130-139 */
+  10392, 10454, 10500, 10543, 10585, 10623, 10649, 10675, 10697, 10719,                             /* Rows 140-149 */
+  10741, 10763, 10785, 10807, 10829, 10849, 10867, 10883, 10897, 10911                              /* Rows 150-159 */
+};
 
 #  else /* CONFIG_EXAMPLES_NXIMAGE_GREYSCALE */
 
-static const struct pix_run_s g_nuttx[] =
+static const uint8_t g_nuttx_data[] =
+{
+  0xb5, 0x00, 0x01, 0x01, 0x02, 0xfc, 0x03, 0x00, 0x04, 0xb5, 0x00,                                 /* Row 0 */
+  0xb6, 0x00, 0x02, 0x01, 0x02, 0x05, 0xfb, 0x03, 0x00, 0x04, 0xb6, 0x00,                           /* Row 1 */
+  0xb7, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0xff, 0x06, 0xfd, 0x03, 0x00, 0x04, 0xb7, 0x00,   /* Row 2 */
+  0xb8, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x03, 0x07, 0x02, 0x08, 0x06, 0xfd, 0x03, 0x00,   /* Row 3 */
+  0x04, 0xb8, 0x00,
+  0xb9, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xff, 0x03, 0x00, 0x06,   /* Row 4 */
+  0xfd, 0x03, 0x00, 0x04, 0xb9, 0x00,
+  0xba, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xfd, 0x03, 0x00, 0x06,   /* Row 5 */
+  0xfd, 0x03, 0x00, 0x04, 0xba, 0x00,
+  0xbb, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xfb, 0x03, 0x00, 0x06,   /* Row 6 */
+  0xfd, 0x03, 0x00, 0x04, 0xbb, 0x00,
+  0xbc, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf9, 0x03, 0x00, 0x06,   /* Row 7 */
+  0xfd, 0x03, 0x00, 0x04, 0xbc, 0x00,
+  0xbd, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf7, 0x03, 0x00, 0x06,   /* Row 8 */
+  0xfd, 0x03, 0x00, 0x04, 0xbd, 0x00,
+  0xbe, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf5, 0x03, 0x00, 0x06,   /* Row 9 */
+  0xfd, 0x03, 0x00, 0x04, 0xbe, 0x00,
+  0xbf, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf3, 0x03, 0x00, 0x06,   /* Row 10 */
+  0xfd, 0x03, 0x00, 0x04, 0xbf, 0x00,
+  0xc0, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf1, 0x03, 0x00, 0x06,   /* Row 11 */
+  0xfd, 0x03, 0x00, 0x04, 0xc0, 0x00,
+  0xc1, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xef, 0x03, 0x00, 0x06,   /* Row 12 */
+  0xfd, 0x03, 0x00, 0x04, 0xc1, 0x00,
+  0xc2, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xed, 0x03, 0x00, 0x06,   /* Row 13 */
+  0xfd, 0x03, 0x00, 0x04, 0xc2, 0x00,
+  0xc3, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xeb, 0x03, 0x00, 0x06,   /* Row 14 */
+  0xfd, 0x03, 0x00, 0x04, 0xc3, 0x00,
+  0xc4, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xe9, 0x03, 0x00, 0x06,   /* Row 15 */
+  0xfd, 0x03, 0x00, 0x04, 0xc4, 0x00,
+  0xc5, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xe7, 0x03, 0x00, 0x06,   /* Row 16 */
+  0xfd, 0x03, 0x00, 0x04, 0xc5, 0x00,
+  0xc6, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xe5, 0x03, 0x00, 0x06,   /* Row 17 */
+  0xfd, 0x03, 0x00, 0x04, 0xc6, 0x00,
+  0xc7, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xe3, 0x03, 0x00, 0x06,   /* Row 18 */
+  0xfd, 0x03, 0x00, 0x04, 0xe7, 0x00, 0x00, 0x09, 0xfc, 0x0a, 0x00, 0x09, 0xe8, 0x00,
+  0xc8, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf7, 0x03, 0xfc, 0x05,   /* Row 19 */
+  0xf0, 0x03, 0x00, 0x06, 0xfd, 0x03, 0x00, 0x04, 0xea, 0x00, 0x00, 0x01, 0xf8, 0x0a, 0x00, 0x01,
+  0xea, 0x00,
+  0xc9, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf8, 0x03, 0x01, 0x05,   /* Row 20 */
+  0x0b, 0xfc, 0x0c, 0x01, 0x0b, 0x0d, 0xf1, 0x03, 0x00, 0x06, 0xfd, 0x03, 0x00, 0x04, 0xeb, 0x00,
+  0xf6, 0x0a, 0x00, 0x01, 0xeb, 0x00,
+  0xea, 0x00, 0x00, 0x09, 0xfc, 0x0a, 0x00, 0x0e, 0xe8, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03,   /* Row 21 */
+  0x02, 0x07, 0x02, 0x05, 0xf8, 0x03, 0x01, 0x05, 0x0f, 0xfa, 0x0a, 0x01, 0x0c, 0x10, 0xf1, 0x03,
+  0x00, 0x06, 0xfd, 0x03, 0x00, 0x04, 0xed, 0x00, 0x00, 0x09, 0xf5, 0x0a, 0x00, 0x01, 0xec, 0x00,
+  0xec, 0x00, 0x00, 0x01, 0xf8, 0x0a, 0x00, 0x01, 0xeb, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03,   /* Row 22 */
+  0x02, 0x07, 0x02, 0x05, 0xf8, 0x03, 0x01, 0x05, 0x0f, 0xf8, 0x0a, 0x01, 0x0c, 0x10, 0xf1, 0x03,
+  0x00, 0x06, 0xfd, 0x03, 0x00, 0x04, 0xee, 0x00, 0xf3, 0x0a, 0xec, 0x00,
+  0xec, 0x00, 0xf6, 0x0a, 0x00, 0x01, 0xed, 0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07,   /* Row 23 */
+  0x02, 0x05, 0xf7, 0x03, 0x00, 0x0b, 0xf6, 0x0a, 0x01, 0x0c, 0x07, 0xfe, 0x06, 0x00, 0x05, 0xf5,
+  0x03, 0x00, 0x06, 0xfd, 0x03, 0x00, 0x04, 0xf0, 0x00, 0x00, 0x09, 0xfb, 0x0a, 0xff, 0x0c, 0xfb,
+  0x0a, 0x00, 0x09, 0xed, 0x00,
+  0xed, 0x00, 0x00, 0x0e, 0xf5, 0x0a, 0x00, 0x09, 0xfd, 0x02, 0x00, 0x11, 0xf4, 0x00, 0x02, 0x01,   /* Row 24 */
+  0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf7, 0x03, 0x01, 0x0d, 0x0c, 0xf5, 0x0a, 0x00,
+  0x0c, 0xfc, 0x06, 0xf5, 0x03, 0x00, 0x06, 0xfd, 0x03, 0x00, 0x04, 0xf1, 0x00, 0xfc, 0x0a, 0xfb,
+  0x0c, 0xfd, 0x0a, 0x02, 0x0c, 0x12, 0x01, 0xef, 0x00,
+  0xee, 0x00, 0x00, 0x09, 0xf4, 0x0a, 0x01, 0x0c, 0x12, 0xfc, 0x02, 0xf6, 0x00, 0x02, 0x01, 0x02,   /* Row 25 */
+  0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf6, 0x03, 0x00, 0x13, 0xfd, 0x0a, 0xfc, 0x0c, 0xfc,
+  0x0a, 0x00, 0x0b, 0xfc, 0x06, 0xf5, 0x03, 0x00, 0x06, 0xfd, 0x03, 0x00, 0x04, 0xf3, 0x00, 0x00,
+  0x09, 0xfc, 0x0a, 0xfb, 0x0c, 0xfc, 0x0a, 0x02, 0x0e, 0x02, 0x01, 0xf0, 0x00,
+  0xee, 0x00, 0xfb, 0x0a, 0xfe, 0x0c, 0xfb, 0x0a, 0x00, 0x0e, 0xfc, 0x02, 0x00, 0x11, 0xf8, 0x00,   /* Row 26 */
+  0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf6, 0x03, 0x01, 0x05, 0x0e, 0xfd,
+  0x0a, 0xfb, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xf5, 0x03, 0x00, 0x06, 0xfd, 0x03, 0x00,
+  0x04, 0xf4, 0x00, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0e, 0xff, 0x02, 0x00, 0x01, 0xf1,
+  0x00,
+  0xef, 0x00, 0x00, 0x09, 0xfd, 0x0a, 0xfb, 0x0c, 0xfc, 0x0a, 0x01, 0x0c, 0x12, 0xfc, 0x02, 0xf9,   /* Row 27 */
+  0x00, 0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf5, 0x03, 0x01, 0x05, 0x0c,
+  0xfe, 0x0a, 0xfa, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xf5, 0x03, 0x00, 0x06,
+  0xfd, 0x03, 0x00, 0x04, 0xf6, 0x00, 0x00, 0x09, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0e,
+  0xfe, 0x02, 0xf1, 0x00,
+  0xef, 0x00, 0xfc, 0x0a, 0xfb, 0x0c, 0xfb, 0x0a, 0x00, 0x0e, 0xfc, 0x02, 0x00, 0x11, 0xfb, 0x00,   /* Row 28 */
+  0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf4, 0x03, 0x01, 0x05, 0x0c, 0xfe,
+  0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xf4, 0x03, 0x00, 0x06, 0xfd, 0x03, 0x00,
+  0x04, 0xf7, 0x00, 0xfc, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e, 0xfe, 0x02, 0x00, 0x11, 0xf2,
+  0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x01, 0x0c, 0x12, 0xfc, 0x02, 0xfc, 0x00, 0x02,   /* Row 29 */
+  0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf3, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a,
+  0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xf4, 0x03, 0x00, 0x06, 0xfd, 0x03,
+  0x00, 0x04, 0xf9, 0x00, 0x00, 0x09, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x12, 0xfd,
+  0x02, 0xf2, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfb, 0x0a, 0x00, 0x0e, 0xfc, 0x02, 0x00, 0x11, 0xfe, 0x00,   /* Row 30 */
+  0x02, 0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf2, 0x03, 0x01, 0x05, 0x0c, 0xfe,
+  0x0a, 0xf8, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xf3, 0x03, 0x00, 0x06, 0xfd, 0x03, 0x00,
+  0x04, 0xfa, 0x00, 0xfc, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e, 0xfc, 0x02, 0x00, 0x01, 0xf3,
+  0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf8, 0x0c, 0xfc, 0x0a, 0x01, 0x0c, 0x12, 0xfc, 0x02, 0xff, 0x00, 0x02,   /* Row 31 */
+  0x01, 0x02, 0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf1, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a,
+  0xf8, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xf3, 0x03, 0x00, 0x06, 0xfd, 0x03,
+  0x00, 0x04, 0xfc, 0x00, 0x00, 0x09, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x12, 0xfc,
+  0x02, 0x00, 0x11, 0xf3, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf8, 0x0c, 0xfb, 0x0a, 0x00, 0x0e, 0xfc, 0x02, 0x03, 0x11, 0x01, 0x02,   /* Row 32 */
+  0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xf0, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf7, 0x0c,
+  0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xf2, 0x03, 0x00, 0x06, 0xfd, 0x03, 0x00, 0x04, 0xfd, 0x00,
+  0xfc, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e, 0xfb, 0x02, 0x00, 0x01, 0xf3, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf7, 0x0c, 0xfc, 0x0a, 0x01, 0x0c, 0x12, 0xfd, 0x02, 0x02, 0x12, 0x02,   /* Row 33 */
+  0x05, 0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xef, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf7, 0x0c,
+  0xfc, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xf2, 0x03, 0x00, 0x06, 0xfd, 0x03, 0x00, 0x04,
+  0xff, 0x00, 0x00, 0x09, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x12, 0xfb, 0x02, 0xf2,
+  0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf7, 0x0c, 0xfb, 0x0a, 0x00, 0x0e, 0xfe, 0x02, 0x02, 0x14, 0x06, 0x05,   /* Row 34 */
+  0xff, 0x03, 0x02, 0x07, 0x02, 0x05, 0xee, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf6, 0x0c, 0xfd,
+  0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xf1, 0x03, 0x00, 0x06, 0xfd, 0x03, 0x01, 0x04, 0x00, 0xfc, 0x0a,
+  0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0x00, 0x11, 0xf2, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf6, 0x0c, 0xfc, 0x0a, 0x03, 0x0c, 0x12, 0x02, 0x14, 0xfe, 0x06, 0x03,   /* Row 35 */
+  0x03, 0x07, 0x02, 0x05, 0xed, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf6, 0x0c, 0xfc, 0x0a, 0x00,
+  0x0b, 0xfc, 0x06, 0x00, 0x05, 0xf1, 0x03, 0x00, 0x06, 0xfd, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xf9,
+  0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xf1, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf6, 0x0c, 0xfb, 0x0a, 0x01, 0x0e, 0x14, 0xfc, 0x06, 0x01, 0x02, 0x05,   /* Row 36 */
+  0xec, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf5, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xf0,
+  0x03, 0x00, 0x06, 0xff, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e,
+  0xfb, 0x02, 0x00, 0x11, 0xf1, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf5, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x00, 0x05, 0xeb, 0x03,   /* Row 37 */
+  0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf5, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xf0,
+  0x03, 0x02, 0x06, 0x03, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x12, 0xfb, 0x02,
+  0xf0, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf5, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xeb, 0x03,   /* Row 38 */
+  0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf4, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xef, 0x03, 0x01,
+  0x06, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e, 0xfb, 0x02, 0x00, 0x11, 0xf0, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf4, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xeb, 0x03, 0x01, 0x05,   /* Row 39 */
+  0x0c, 0xfe, 0x0a, 0xf4, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xf0, 0x03, 0x00,
+  0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x12, 0xfb, 0x02, 0xef, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf4, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xec, 0x03,   /* Row 40 */
+  0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf3, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xf1, 0x03, 0x01,
+  0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e, 0xfb, 0x02, 0x00, 0x11, 0xef, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf3, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xec, 0x03, 0x01, 0x05,   /* Row 41 */
+  0x0c, 0xfe, 0x0a, 0xf3, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xf2, 0x03, 0x00,
+  0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x12, 0xfb, 0x02, 0xee, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf3, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xed, 0x03,   /* Row 42 */
+  0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf2, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xf3, 0x03, 0x01,
+  0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e, 0xfb, 0x02, 0x00, 0x11, 0xee, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf2, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xed, 0x03, 0x01, 0x05,   /* Row 43 */
+  0x0c, 0xfe, 0x0a, 0xf2, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xf4, 0x03, 0x00,
+  0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x12, 0xfb, 0x02, 0xed, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf2, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xee, 0x03,   /* Row 44 */
+  0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0x00, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb,
+  0x06, 0xf5, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e, 0xfb, 0x02,
+  0x00, 0x11, 0xed, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf1, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xee, 0x03, 0x01, 0x05,   /* Row 45 */
+  0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0x00, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00,
+  0x05, 0xf6, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x12, 0xfb, 0x02,
+  0xec, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0x00, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06,   /* Row 46 */
+  0x00, 0x05, 0xef, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xff, 0x0a, 0xf9, 0x0c, 0xfd,
+  0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xf7, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a,
+  0x00, 0x0e, 0xfb, 0x02, 0x00, 0x11, 0xec, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0x00, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06,   /* Row 47 */
+  0xef, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xff, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00,
+  0x0b, 0xfc, 0x06, 0x00, 0x05, 0xf8, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01,
+  0x0c, 0x12, 0xfb, 0x02, 0xeb, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xff, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06,   /* Row 48 */
+  0x00, 0x05, 0xf0, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfd,
+  0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xf9, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a,
+  0x00, 0x0e, 0xfb, 0x02, 0x00, 0x11, 0xeb, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xff, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06,   /* Row 49 */
+  0xf0, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00,
+  0x0b, 0xfc, 0x06, 0x00, 0x05, 0xfa, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x02,
+  0x0c, 0x15, 0x14, 0xfc, 0x02, 0xea, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06,   /* Row 50 */
+  0x00, 0x05, 0xf1, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd,
+  0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xfb, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a,
+  0x00, 0x0b, 0xff, 0x06, 0x00, 0x14, 0xfe, 0x02, 0x00, 0x11, 0xea, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06,   /* Row 51 */
+  0xf1, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00,
+  0x0b, 0xfc, 0x06, 0x00, 0x05, 0xfc, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfd, 0x06, 0x00, 0x14, 0xff, 0x02, 0xe9, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06,   /* Row 52 */
+  0x00, 0x05, 0xf2, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd,
+  0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xfd, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a,
+  0x00, 0x0b, 0xfc, 0x06, 0x01, 0x14, 0x11, 0xe9, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06,   /* Row 53 */
+  0xf2, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfc, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00,
+  0x0b, 0xfc, 0x06, 0x00, 0x05, 0xfe, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0xe8, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06,   /* Row 54 */
+  0x00, 0x05, 0xf3, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0xf9, 0x0c, 0xfd,
+  0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xff, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a,
+  0x00, 0x0b, 0xfa, 0x06, 0x01, 0x03, 0x04, 0xea, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06,   /* Row 55 */
+  0xf3, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00,
+  0x0b, 0xfc, 0x06, 0x02, 0x05, 0x03, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa,
+  0x06, 0xfe, 0x03, 0x00, 0x04, 0xeb, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfb, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06,   /* Row 56 */
+  0x00, 0x05, 0xf4, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfa, 0x0a, 0xf9, 0x0c, 0xfd,
+  0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xf9, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xec, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfb, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06,   /* Row 57 */
+  0xf4, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfa, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00,
+  0x0b, 0xfc, 0x06, 0x00, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xff,
+  0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xed, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfa, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06,   /* Row 58 */
+  0x00, 0x05, 0xf5, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xf9, 0x0a, 0xf9, 0x0c, 0xfd,
+  0x0a, 0x00, 0x0c, 0xfc, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb,
+  0x06, 0x00, 0x05, 0xfe, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xee, 0x00,
+  0xf0, 0x00, 0x01, 0x16, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfa, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00,   /* Row 59 */
+  0x0c, 0xfb, 0x06, 0xf5, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xf9, 0x0a, 0xf9, 0x0c,
+  0xfc, 0x0a, 0x00, 0x0b, 0xfe, 0x06, 0x00, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c,
+  0xfa, 0x06, 0xfc, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xef, 0x00,
+  0xf1, 0x00, 0x02, 0x01, 0x12, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xf9, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a,   /* Row 60 */
+  0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xf6, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfd,
+  0x0a, 0x00, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfe, 0x06, 0x00, 0x0c, 0xfd,
+  0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0x00, 0x05, 0xfb, 0x03, 0x00, 0x06, 0xfe,
+  0x03, 0x00, 0x04, 0xf0, 0x00,
+  0xf2, 0x00, 0x03, 0x01, 0x02, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xf9, 0x0a, 0xf9, 0x0c, 0xfc,   /* Row 61 */
+  0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xf6, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a,
+  0x01, 0x0c, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x02, 0x0b, 0x06, 0x0b, 0xfc, 0x0a, 0xf9,
+  0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf9, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xf1,
+  0x00,
+  0xf3, 0x00, 0x01, 0x01, 0x02, 0xff, 0x05, 0x00, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xf8, 0x0a, 0xfa,   /* Row 62 */
+  0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xf7, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a,
+  0xfa, 0x0c, 0xfe, 0x0a, 0x02, 0x0c, 0x15, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x02, 0x0c,
+  0x17, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0x00, 0x05, 0xf8, 0x03,
+  0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xf2, 0x00,
+  0xf4, 0x00, 0x05, 0x01, 0x02, 0x05, 0x03, 0x06, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00,   /* Row 63 */
+  0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xf7, 0x03, 0x01, 0x05, 0x0c,
+  0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x02, 0x0c, 0x06, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a,
+  0x00, 0x0c, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf6, 0x03, 0x00, 0x06,
+  0xfe, 0x03, 0x00, 0x04, 0xf3, 0x00,
+  0xf5, 0x00, 0x06, 0x01, 0x02, 0x05, 0x03, 0x06, 0x18, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a,   /* Row 64 */
+  0x01, 0x0c, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xf8,
+  0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xff, 0x06, 0x00, 0x0c,
+  0xfd, 0x0a, 0xf9, 0x0c, 0xf8, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0x00, 0x05,
+  0xf5, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xf4, 0x00,
+  0xf6, 0x00, 0x07, 0x01, 0x02, 0x05, 0x03, 0x06, 0x02, 0x03, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe,   /* Row 65 */
+  0x0a, 0x02, 0x0c, 0x15, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0xf8,
+  0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xff, 0x06, 0x00, 0x0b,
+  0xfd, 0x0a, 0xf9, 0x0c, 0xf8, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf3, 0x03,
+  0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xf5, 0x00,
+  0xf7, 0x00, 0x08, 0x01, 0x02, 0x05, 0x03, 0x06, 0x02, 0x03, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c,   /* Row 66 */
+  0xfe, 0x0a, 0x02, 0x0c, 0x06, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06,
+  0x00, 0x05, 0xf9, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfe,
+  0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfa, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb,
+  0x06, 0x00, 0x05, 0xf2, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xf6, 0x00,
+  0xf8, 0x00, 0x05, 0x01, 0x02, 0x05, 0x03, 0x06, 0x02, 0xff, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a,   /* Row 67 */
+  0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xff, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a,
+  0x00, 0x0c, 0xfb, 0x06, 0xf9, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00,
+  0x0c, 0xfe, 0x06, 0x00, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfa, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0xf0, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xf7, 0x00,
+  0xf9, 0x00, 0x05, 0x01, 0x02, 0x05, 0x03, 0x06, 0x02, 0xfe, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a,   /* Row 68 */
+  0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xff, 0x06, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a,
+  0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xfa, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe,
+  0x0a, 0x00, 0x0c, 0xfd, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0xf9, 0x0c, 0xfc,
+  0x0a, 0x00, 0x0b, 0xfb, 0x06, 0x00, 0x05, 0xef, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xf8,
+  0x00,
+  0xfa, 0x00, 0x05, 0x01, 0x02, 0x05, 0x03, 0x06, 0x02, 0xfd, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a,   /* Row 69 */
+  0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfe, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a,
+  0x00, 0x0c, 0xfb, 0x06, 0xfa, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00,
+  0x0c, 0xfd, 0x06, 0x00, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0xed, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xf9, 0x00,
+  0xfb, 0x00, 0x05, 0x01, 0x02, 0x05, 0x03, 0x06, 0x02, 0xfc, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a,   /* Row 70 */
+  0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfe, 0x06, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a,
+  0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xfb, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe,
+  0x0a, 0x00, 0x0c, 0xfc, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc,
+  0x0a, 0x00, 0x0b, 0xfb, 0x06, 0x00, 0x05, 0xec, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xfa,
+  0x00,
+  0xfc, 0x00, 0x05, 0x01, 0x02, 0x05, 0x03, 0x06, 0x02, 0xfb, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a,   /* Row 71 */
+  0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfd, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a,
+  0x00, 0x0c, 0xfb, 0x06, 0xfb, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00,
+  0x0c, 0xfc, 0x06, 0x00, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0xea, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xfb, 0x00,
+  0xfd, 0x00, 0x05, 0x01, 0x02, 0x05, 0x03, 0x06, 0x02, 0xfa, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a,   /* Row 72 */
+  0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfd, 0x06, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a,
+  0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xfc, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe,
+  0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0x00, 0x0a, 0xf9, 0x0c, 0xfc,
+  0x0a, 0x00, 0x0b, 0xfb, 0x06, 0x00, 0x05, 0xe9, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xfc,
+  0x00,
+  0xfe, 0x00, 0x05, 0x01, 0x02, 0x05, 0x03, 0x06, 0x02, 0xf9, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a,   /* Row 73 */
+  0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfc, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a,
+  0x00, 0x0c, 0xfb, 0x06, 0xfc, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00,
+  0x0c, 0xfb, 0x06, 0x00, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0x00, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0xe7, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xfd, 0x00,
+  0xff, 0x00, 0x05, 0x01, 0x02, 0x05, 0x03, 0x06, 0x02, 0xf8, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a,   /* Row 74 */
+  0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfc, 0x06, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a,
+  0x00, 0x0b, 0xfc, 0x06, 0x00, 0x05, 0xfd, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe,
+  0x0a, 0x00, 0x0c, 0xfa, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf2, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb,
+  0x06, 0x00, 0x05, 0xe6, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xfe, 0x00,
+  0x06, 0x00, 0x01, 0x02, 0x05, 0x03, 0x06, 0x02, 0xf7, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9,   /* Row 75 */
+  0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00,
+  0x0c, 0xfb, 0x06, 0xfd, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c,
+  0xfa, 0x06, 0x00, 0x0b, 0xfd, 0x0a, 0xf2, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xe4, 0x03,
+  0x00, 0x06, 0xfe, 0x03, 0x00, 0x04, 0xff, 0x00,
+  0x05, 0x01, 0x02, 0x05, 0x03, 0x06, 0x02, 0xf6, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c,   /* Row 76 */
+  0xfe, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x00, 0x0b,
+  0xfc, 0x06, 0x00, 0x05, 0xfe, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf4, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06,
+  0x00, 0x05, 0xe3, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x01, 0x04, 0x00,
+  0x04, 0x02, 0x05, 0x03, 0x06, 0x02, 0xf5, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe,   /* Row 77 */
+  0x0a, 0x00, 0x0c, 0xfa, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb,
+  0x06, 0xfe, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06,
+  0x01, 0x03, 0x0b, 0xfd, 0x0a, 0xf4, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xe1, 0x03, 0x00,
+  0x06, 0xfe, 0x03, 0x00, 0x04,
+  0xff, 0x03, 0x01, 0x06, 0x02, 0xf4, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a,   /* Row 78 */
+  0x00, 0x0c, 0xfa, 0x06, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06,
+  0x00, 0x05, 0xff, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa,
+  0x06, 0x02, 0x03, 0x0d, 0x0c, 0xfd, 0x0a, 0xf6, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0x00,
+  0x05, 0xe0, 0x03, 0x00, 0x06, 0xfe, 0x03,
+  0x02, 0x03, 0x05, 0x12, 0xf3, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00,   /* Row 79 */
+  0x0c, 0xfa, 0x06, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06,
+  0xff, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xff,
+  0x03, 0x00, 0x0b, 0xfd, 0x0a, 0xf6, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xde, 0x03, 0x00,
+  0x06, 0xff, 0x03,
+  0xff, 0x03, 0x00, 0x06, 0xf3, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00,   /* Row 80 */
+  0x0c, 0xfa, 0x06, 0x01, 0x03, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc, 0x06,
+  0x03, 0x05, 0x03, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xff,
+  0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xf7, 0x0c, 0xfd, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0x00, 0x05, 0xde,
+  0x03, 0x02, 0x05, 0x06, 0x03,
+  0xfe, 0x03, 0x00, 0x06, 0xf4, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00,   /* Row 81 */
+  0x0c, 0xfa, 0x06, 0x02, 0x03, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0c, 0xfb,
+  0x06, 0x02, 0x03, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0x02,
+  0x03, 0x0d, 0x0c, 0xfd, 0x0a, 0xf7, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x15, 0xfb, 0x06, 0xdd, 0x03,
+  0x02, 0x07, 0x02, 0x05,
+  0xfd, 0x03, 0x00, 0x06, 0xf5, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00,   /* Row 82 */
+  0x0c, 0xfa, 0x06, 0xff, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x00, 0x0b, 0xfc,
+  0x06, 0xff, 0x05, 0x00, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0x01,
+  0x03, 0x0b, 0xfc, 0x0a, 0xf7, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0xde, 0x03, 0x03, 0x07,
+  0x02, 0x05, 0x03,
+  0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xf6, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe,   /* Row 83 */
+  0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xff, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a,
+  0x00, 0x0c, 0xfb, 0x06, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa,
+  0x06, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf5, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x00, 0x05,
+  0xe0, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04,
+  0x01, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xf7, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c,   /* Row 84 */
+  0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xfe, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a,
+  0x00, 0x0b, 0xfc, 0x06, 0x01, 0x0d, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa,
+  0x06, 0x00, 0x0b, 0xfc, 0x0a, 0xf5, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0xe1, 0x03, 0x05,
+  0x07, 0x02, 0x05, 0x03, 0x04, 0x00,
+  0xff, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xf8, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9,   /* Row 85 */
+  0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xfe, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c,
+  0xfc, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x00, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c,
+  0xfa, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf3, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x00, 0x05,
+  0xe3, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xff, 0x00,
+  0xfe, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xf9, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9,   /* Row 86 */
+  0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xfd, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb,
+  0x0a, 0x00, 0x0b, 0xfc, 0x06, 0x00, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfb,
+  0x06, 0x00, 0x0b, 0xfc, 0x0a, 0xf3, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0xe4, 0x03, 0x04,
+  0x07, 0x02, 0x05, 0x03, 0x04, 0xfe, 0x00,
+  0xfd, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xfa, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9,   /* Row 87 */
+  0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xfd, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c,
+  0xfc, 0x0a, 0x00, 0x0c, 0xfc, 0x06, 0x00, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c,
+  0xfb, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf1, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x00, 0x05,
+  0xe6, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xfd, 0x00,
+  0xfc, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xfb, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9,   /* Row 88 */
+  0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xfc, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb,
+  0x0a, 0x00, 0x0b, 0xfd, 0x06, 0x00, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfc,
+  0x06, 0x00, 0x0b, 0xfc, 0x0a, 0xf1, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0xe7, 0x03, 0x04,
+  0x07, 0x02, 0x05, 0x03, 0x04, 0xfc, 0x00,
+  0xfb, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xfc, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9,   /* Row 89 */
+  0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xfc, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c,
+  0xfc, 0x0a, 0x00, 0x0c, 0xfd, 0x06, 0x00, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c,
+  0xfc, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf8, 0x0c, 0x00, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c,
+  0xfb, 0x06, 0x00, 0x05, 0xe9, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xfb, 0x00,
+  0xfa, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xfd, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9,   /* Row 90 */
+  0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xfb, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb,
+  0x0a, 0x00, 0x0b, 0xfe, 0x06, 0x00, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfd,
+  0x06, 0x00, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xff, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb,
+  0x06, 0xea, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xfa, 0x00,
+  0xf9, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9,   /* Row 91 */
+  0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xfb, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c,
+  0xfc, 0x0a, 0x00, 0x0c, 0xfe, 0x06, 0x00, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c,
+  0xfd, 0x06, 0x00, 0x0c, 0xfd, 0x0a, 0xf8, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c,
+  0xfb, 0x06, 0x00, 0x05, 0xec, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf9, 0x00,
+  0xf8, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xff, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9,   /* Row 92 */
+  0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xfa, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb,
+  0x0a, 0x00, 0x0b, 0xff, 0x06, 0x00, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfe,
+  0x06, 0x00, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb,
+  0x06, 0xed, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf8, 0x00,
+  0xf7, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x03, 0x06, 0x03, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe,   /* Row 93 */
+  0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xfa, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a,
+  0x00, 0x0c, 0xff, 0x06, 0x00, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfe, 0x06,
+  0x00, 0x0c, 0xfd, 0x0a, 0xf8, 0x0c, 0xfc, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06,
+  0x00, 0x05, 0xef, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf7, 0x00,
+  0xf6, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x02, 0x06, 0x0d, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a,   /* Row 94 */
+  0x00, 0x0c, 0xfa, 0x06, 0xf9, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x02, 0x0b,
+  0x06, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xff, 0x06, 0x00, 0x0b, 0xfc, 0x0a,
+  0xf9, 0x0c, 0xfb, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0xf0, 0x03, 0x04, 0x07,
+  0x02, 0x05, 0x03, 0x04, 0xf6, 0x00,
+  0xf5, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x01, 0x06, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00,   /* Row 95 */
+  0x0c, 0xfa, 0x06, 0xf9, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x02, 0x0c,
+  0x15, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xff, 0x06, 0x00, 0x0c, 0xfd, 0x0a,
+  0xf8, 0x0c, 0xfa, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x00, 0x05, 0xf2, 0x03,
+  0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf5, 0x00,
+  0xf4, 0x00, 0x00, 0x04, 0xfe, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00,   /* Row 96 */
+  0x0c, 0xfa, 0x06, 0xf8, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0x01, 0x0b, 0x0c,
+  0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x02, 0x0c, 0x06, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xf9, 0x0a,
+  0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0xf3, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04,
+  0xf4, 0x00,
+  0xf3, 0x00, 0x00, 0x04, 0xff, 0x03, 0x01, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00,   /* Row 97 */
+  0x0c, 0xfa, 0x06, 0xf8, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0c,
+  0xfd, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x02, 0x0c, 0x15, 0x0c, 0xfd, 0x0a, 0xf8, 0x0c, 0xfd, 0x0a,
+  0x00, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x00, 0x05, 0xf5, 0x03,
+  0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf3, 0x00,
+  0xf2, 0x00, 0x03, 0x04, 0x03, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa,   /* Row 98 */
+  0x06, 0xf7, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xf7, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x01,
+  0x0c, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x01, 0x0b, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc,
+  0x0a, 0x00, 0x0b, 0xfb, 0x06, 0xf6, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf2, 0x00,
+  0xf1, 0x00, 0x02, 0x04, 0x05, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06,   /* Row 99 */
+  0xf7, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xf8, 0x0a, 0xfa, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfd, 0x0a, 0xf8, 0x0c, 0xfd, 0x0a, 0x02, 0x0c, 0x06, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd,
+  0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x00, 0x05, 0xf8, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf1,
+  0x00,
+  0xf0, 0x00, 0x01, 0x04, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf6,   /* Row 100 */
+  0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xfa, 0x0c, 0xf8, 0x0a, 0xfa, 0x0c, 0xf8, 0x0a, 0xf9, 0x0c, 0xfc,
+  0x0a, 0x00, 0x0b, 0xff, 0x06, 0x00, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb,
+  0x06, 0xf9, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf0, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf6, 0x03, 0x01, 0x0d,   /* Row 101 */
+  0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xf9, 0x0a, 0xfa, 0x0c, 0xf9, 0x0a, 0xf8, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfe, 0x06, 0x00, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x00,
+  0x05, 0xfb, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xef, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf5, 0x03, 0x00, 0x0b,   /* Row 102 */
+  0xfc, 0x0a, 0xfa, 0x0c, 0xf9, 0x0a, 0xfa, 0x0c, 0xf9, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xfd, 0x06, 0x00, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0xfc, 0x03,
+  0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xee, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf5, 0x03, 0x01, 0x0d,   /* Row 103 */
+  0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfa, 0x0a, 0xfa, 0x0c, 0xfa, 0x0a, 0xf8, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfc, 0x06, 0x00, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfb, 0x06, 0x00,
+  0x05, 0xfe, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xed, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf4, 0x03, 0x00, 0x0b,   /* Row 104 */
+  0xfc, 0x0a, 0xfa, 0x0c, 0xfa, 0x0a, 0xfa, 0x0c, 0xfa, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xfb, 0x06, 0x00, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0xff, 0x03,
+  0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xec, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf4, 0x03, 0x01, 0x0d,   /* Row 105 */
+  0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfb, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0xf8, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0x00, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0x04,
+  0x07, 0x02, 0x05, 0x03, 0x04, 0xeb, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf3, 0x03, 0x00, 0x0b,   /* Row 106 */
+  0xfc, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0xfa, 0x0c, 0xfb, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xfa, 0x06, 0x01, 0x0d, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfb, 0x06, 0x03,
+  0x12, 0x05, 0x03, 0x04, 0xea, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf3, 0x03, 0x01, 0x0d,   /* Row 107 */
+  0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0xfa, 0x0c, 0xfc, 0x0a, 0xf8, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0x02, 0x05, 0x03, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa,
+  0x06, 0x01, 0x03, 0x04, 0xe9, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf2, 0x03, 0x00, 0x0b,   /* Row 108 */
+  0xfc, 0x0a, 0xfa, 0x0c, 0xfc, 0x0a, 0xfa, 0x0c, 0xfc, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xfa, 0x06, 0xff, 0x03, 0x01, 0x0d, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfc,
+  0x06, 0x01, 0x14, 0x01, 0xe8, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf2, 0x03, 0x01, 0x0d,   /* Row 109 */
+  0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0xfa, 0x0c, 0xfd, 0x0a, 0xf8, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0x00, 0x05, 0xfe, 0x03, 0x00, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfd, 0x06, 0x00, 0x14, 0xff, 0x02, 0xe8, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf1, 0x03, 0x00, 0x0b,   /* Row 110 */
+  0xfc, 0x0a, 0xfa, 0x0c, 0xfd, 0x0a, 0xfa, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xfa, 0x06, 0xfd, 0x03, 0x01, 0x0d, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xff,
+  0x06, 0x00, 0x14, 0xfe, 0x02, 0x00, 0x11, 0xe9, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf1, 0x03, 0x01, 0x0d,   /* Row 111 */
+  0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0xf8, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0x00, 0x05, 0xfc, 0x03, 0x00, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x02,
+  0x0c, 0x15, 0x14, 0xfc, 0x02, 0xe9, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf0, 0x03, 0x00, 0x0b,   /* Row 112 */
+  0xfc, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xfa, 0x06, 0xfb, 0x03, 0x01, 0x0d, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e, 0xfb,
+  0x02, 0x00, 0x11, 0xea, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xf0, 0x03, 0x01, 0x0d,   /* Row 113 */
+  0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xff, 0x0a, 0xfa, 0x0c, 0xff, 0x0a, 0xf8, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0x00, 0x05, 0xfa, 0x03, 0x00, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01,
+  0x0c, 0x12, 0xfb, 0x02, 0xea, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xef, 0x03, 0x00, 0x0b,   /* Row 114 */
+  0xfc, 0x0a, 0xfa, 0x0c, 0xff, 0x0a, 0xfa, 0x0c, 0xff, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xfa, 0x06, 0xf9, 0x03, 0x01, 0x0d, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e, 0xfb,
+  0x02, 0x00, 0x11, 0xeb, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xef, 0x03, 0x01, 0x0d,   /* Row 115 */
+  0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0x00, 0x0a, 0xfa, 0x0c, 0x00, 0x0a, 0xf8, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0x00, 0x05, 0xf8, 0x03, 0x00, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01,
+  0x0c, 0x12, 0xfb, 0x02, 0xeb, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0xee, 0x03, 0x00, 0x0b,   /* Row 116 */
+  0xfc, 0x0a, 0xfa, 0x0c, 0x00, 0x0a, 0xfa, 0x0c, 0x00, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xfa, 0x06, 0xf7, 0x03, 0x01, 0x0d, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e, 0xfb,
+  0x02, 0x00, 0x11, 0xec, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x01, 0x0c, 0x12, 0xfb, 0x06, 0xee, 0x03, 0x01,   /* Row 117 */
+  0x0d, 0x0c, 0xfd, 0x0a, 0xe9, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0x00, 0x05, 0xf6, 0x03,
+  0x00, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x12, 0xfb, 0x02, 0xec, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x02, 0x0c, 0x02, 0x14, 0xfc, 0x06, 0xed, 0x03,   /* Row 118 */
+  0x00, 0x0b, 0xfc, 0x0a, 0xeb, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfa, 0x06, 0xf5, 0x03, 0x01, 0x0d,
+  0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e, 0xfb, 0x02, 0x00, 0x11, 0xed, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xff, 0x02, 0x00, 0x14, 0xfc, 0x06,   /* Row 119 */
+  0xee, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xeb, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0x00,
+  0x05, 0xf4, 0x03, 0x00, 0x0b, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x12, 0xfb, 0x02,
+  0xed, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfe, 0x02, 0x00, 0x14, 0xfe, 0x06,   /* Row 120 */
+  0x01, 0x03, 0x06, 0xee, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xed, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfa,
+  0x06, 0xf3, 0x03, 0x01, 0x0d, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e, 0xfb, 0x02,
+  0x00, 0x11, 0xee, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfd, 0x02, 0x00, 0x14, 0xff, 0x06,   /* Row 121 */
+  0xff, 0x03, 0x00, 0x06, 0xef, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xed, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0x00, 0x05, 0xf3, 0x03, 0x01, 0x07, 0x19, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a,
+  0x01, 0x0c, 0x12, 0xfb, 0x02, 0xee, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfc, 0x02, 0x01, 0x14, 0x06, 0xfe,   /* Row 122 */
+  0x03, 0x00, 0x06, 0xef, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xef, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfa,
+  0x06, 0xf3, 0x03, 0x03, 0x07, 0x02, 0x0d, 0x0c, 0xfe, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0e,
+  0xfb, 0x02, 0x00, 0x11, 0xef, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfb, 0x02, 0x00, 0x14, 0xfd, 0x03,   /* Row 123 */
+  0x00, 0x06, 0xf0, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xef, 0x0c, 0xfd, 0x0a, 0x00, 0x0c, 0xfa,
+  0x06, 0x00, 0x05, 0xf4, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x14, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd,
+  0x0a, 0x01, 0x0c, 0x12, 0xfb, 0x02, 0xef, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0x00, 0x00, 0xfd, 0x03,   /* Row 124 */
+  0x00, 0x06, 0xf0, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xf1, 0x0c, 0xfc, 0x0a, 0x00, 0x0b, 0xfa, 0x06,
+  0xf4, 0x03, 0x05, 0x07, 0x02, 0x05, 0x03, 0x04, 0x11, 0xfd, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00,
+  0x0e, 0xfb, 0x02, 0x00, 0x11, 0xf0, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0x01, 0x00, 0x04, 0xfd,   /* Row 125 */
+  0x03, 0x00, 0x06, 0xf1, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf1, 0x0c, 0xfd, 0x0a, 0x00, 0x0c,
+  0xfa, 0x06, 0x00, 0x05, 0xf5, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xff, 0x00, 0x00, 0x09,
+  0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x12, 0xfb, 0x02, 0xf0, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xff, 0x00, 0x00, 0x04,   /* Row 126 */
+  0xfd, 0x03, 0x00, 0x06, 0xf1, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xf3, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xfa, 0x06, 0xf5, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xfd, 0x00, 0xfd, 0x0a, 0xf9, 0x0c,
+  0xfc, 0x0a, 0x00, 0x0e, 0xfb, 0x02, 0x00, 0x11, 0xf1, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xfe, 0x00, 0x00, 0x04,   /* Row 127 */
+  0xfd, 0x03, 0x00, 0x06, 0xf2, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf3, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0x00, 0x05, 0xf6, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xfc, 0x00, 0x00,
+  0x09, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x12, 0xfb, 0x02, 0xf1, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xfd, 0x00, 0x00, 0x04,   /* Row 128 */
+  0xfd, 0x03, 0x00, 0x06, 0xf2, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xf5, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xfa, 0x06, 0xf6, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xfa, 0x00, 0xfd, 0x0a, 0xf9, 0x0c,
+  0xfc, 0x0a, 0x00, 0x0e, 0xfb, 0x02, 0x00, 0x11, 0xf2, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xfc, 0x00, 0x00, 0x04,   /* Row 129 */
+  0xfd, 0x03, 0x00, 0x06, 0xf3, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf5, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0x00, 0x05, 0xf7, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf9, 0x00, 0x00,
+  0x09, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x01, 0x0c, 0x12, 0xfb, 0x02, 0xf2, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xfb, 0x00, 0x00, 0x04,   /* Row 130 */
+  0xfd, 0x03, 0x00, 0x06, 0xf3, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xf7, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xfa, 0x06, 0xf7, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf7, 0x00, 0xfd, 0x0a, 0xf9, 0x0c,
+  0xfc, 0x0a, 0x00, 0x0e, 0xfb, 0x02, 0x00, 0x1a, 0xf3, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xfa, 0x00, 0x00, 0x04,   /* Row 131 */
+  0xfd, 0x03, 0x00, 0x06, 0xf4, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf7, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0x00, 0x05, 0xf8, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf6, 0x00, 0x00,
+  0x09, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00, 0x0e, 0xfb, 0x02, 0x00, 0x11, 0xf3, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xf9, 0x00, 0x00, 0x04,   /* Row 132 */
+  0xfd, 0x03, 0x00, 0x06, 0xf4, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xf9, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xfa, 0x06, 0xf8, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf4, 0x00, 0xfd, 0x0a, 0xf9, 0x0c,
+  0xfd, 0x0a, 0x00, 0x0e, 0xfa, 0x02, 0xf3, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xf8, 0x00, 0x00, 0x04,   /* Row 133 */
+  0xfd, 0x03, 0x00, 0x06, 0xf5, 0x03, 0x01, 0x0d, 0x0c, 0xfd, 0x0a, 0xf9, 0x0c, 0xfd, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0x00, 0x05, 0xf9, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf3, 0x00, 0x00,
+  0x09, 0xfd, 0x0a, 0xfa, 0x0c, 0xfe, 0x0a, 0x01, 0x0c, 0x13, 0xfa, 0x02, 0x00, 0x1a, 0xf4, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xf7, 0x00, 0x00, 0x04,   /* Row 134 */
+  0xfd, 0x03, 0x00, 0x06, 0xf5, 0x03, 0x00, 0x0b, 0xfc, 0x0a, 0xfb, 0x0c, 0xfc, 0x0a, 0x00, 0x0b,
+  0xfa, 0x06, 0xf9, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf1, 0x00, 0xfd, 0x0a, 0xfb, 0x0c,
+  0xfd, 0x0a, 0x00, 0x0c, 0xf9, 0x02, 0x00, 0x11, 0xf4, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xf6, 0x00, 0x00, 0x04,   /* Row 135 */
+  0xfd, 0x03, 0x00, 0x06, 0xf6, 0x03, 0x01, 0x0d, 0x0c, 0xfc, 0x0a, 0xfd, 0x0c, 0xfc, 0x0a, 0x00,
+  0x0c, 0xfa, 0x06, 0x00, 0x05, 0xfa, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xf0, 0x00, 0x00,
+  0x09, 0xfd, 0x0a, 0xfd, 0x0c, 0xfc, 0x0a, 0x00, 0x0e, 0xf9, 0x02, 0x00, 0x11, 0xf4, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xf5, 0x00, 0x00, 0x04,   /* Row 136 */
+  0xfd, 0x03, 0x00, 0x06, 0xf6, 0x03, 0x00, 0x0b, 0xf3, 0x0a, 0x00, 0x0b, 0xfa, 0x06, 0xfa, 0x03,
+  0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xee, 0x00, 0xf5, 0x0a, 0x01, 0x0c, 0x12, 0xf9, 0x02, 0x00,
+  0x01, 0xf4, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xf4, 0x00, 0x00, 0x04,   /* Row 137 */
+  0xfd, 0x03, 0x00, 0x06, 0xf7, 0x03, 0x01, 0x0d, 0x0c, 0xf5, 0x0a, 0x00, 0x0c, 0xfa, 0x06, 0x00,
+  0x05, 0xfb, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xed, 0x00, 0x00, 0x09, 0xf7, 0x0a, 0x00,
+  0x0c, 0xf7, 0x02, 0xf3, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf9, 0x0c, 0xfe, 0x0a, 0x00, 0x0c, 0xfa, 0x02, 0xf3, 0x00, 0x00, 0x04,   /* Row 138 */
+  0xfd, 0x03, 0x00, 0x06, 0xf7, 0x03, 0x00, 0x0b, 0xf5, 0x0a, 0x00, 0x0b, 0xfa, 0x06, 0xfb, 0x03,
+  0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xeb, 0x00, 0xf8, 0x0a, 0x00, 0x0c, 0xf7, 0x02, 0x00, 0x11,
+  0xf3, 0x00,
+  0xef, 0x00, 0xfd, 0x0a, 0xf5, 0x0c, 0xfa, 0x02, 0xf2, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06,   /* Row 139 */
+  0xf8, 0x03, 0x01, 0x05, 0x0f, 0xf7, 0x0a, 0x00, 0x0f, 0xfa, 0x06, 0x00, 0x05, 0xfc, 0x03, 0x04,
+  0x07, 0x02, 0x05, 0x03, 0x04, 0xea, 0x00, 0x01, 0x11, 0x0e, 0xfc, 0x0a, 0x02, 0x0c, 0x0a, 0x13,
+  0xf7, 0x02, 0xf2, 0x00,
+  0xe8, 0x00, 0x00, 0x14, 0xfd, 0x12, 0xf6, 0x02, 0xf1, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06,   /* Row 140 */
+  0xf8, 0x03, 0x02, 0x05, 0x0b, 0x0c, 0xfb, 0x0a, 0x01, 0x0c, 0x0b, 0xf9, 0x06, 0xfc, 0x03, 0x04,
+  0x07, 0x02, 0x05, 0x03, 0x04, 0xe6, 0x00, 0xff, 0x09, 0x02, 0x13, 0x0e, 0x12, 0xf6, 0x02, 0x00,
+  0x11, 0xf2, 0x00,
+  0xe8, 0x00, 0xf1, 0x02, 0xf0, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xf7, 0x03, 0x01, 0x0d,   /* Row 141 */
+  0x0b, 0xfd, 0x0c, 0x00, 0x0b, 0xf8, 0x06, 0xfc, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xe3,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0xf1, 0x00,
+  0xe8, 0x00, 0xf1, 0x02, 0xef, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xf6, 0x03, 0x01, 0x05,   /* Row 142 */
+  0x0d, 0xf6, 0x06, 0xfc, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xe1, 0x00, 0x00, 0x11, 0xf6,
+  0x02, 0xf0, 0x00,
+  0xe8, 0x00, 0xf1, 0x02, 0xee, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xf4, 0x03, 0x00, 0x05,   /* Row 143 */
+  0xfa, 0x06, 0xfb, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04, 0xdf, 0x00, 0xf7, 0x02, 0xef, 0x00,
+  0xe8, 0x00, 0xf1, 0x02, 0xed, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xe8, 0x03, 0x04, 0x07,   /* Row 144 */
+  0x02, 0x05, 0x03, 0x04, 0xde, 0x00, 0x00, 0x01, 0xfa, 0x02, 0x00, 0x11, 0xee, 0x00,
+  0xe8, 0x00, 0xf1, 0x02, 0xec, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xea, 0x03, 0x04, 0x07,   /* Row 145 */
+  0x02, 0x05, 0x03, 0x04, 0xc1, 0x00,
+  0xe8, 0x00, 0xf1, 0x02, 0xeb, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xec, 0x03, 0x04, 0x07,   /* Row 146 */
+  0x02, 0x05, 0x03, 0x04, 0xc0, 0x00,
+  0xc1, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xee, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04,   /* Row 147 */
+  0xbf, 0x00,
+  0xc0, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xf0, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04,   /* Row 148 */
+  0xbe, 0x00,
+  0xbf, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xf2, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04,   /* Row 149 */
+  0xbd, 0x00,
+  0xbe, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xf4, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04,   /* Row 150 */
+  0xbc, 0x00,
+  0xbd, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xf6, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04,   /* Row 151 */
+  0xbb, 0x00,
+  0xbc, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xf8, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04,   /* Row 152 */
+  0xba, 0x00,
+  0xbb, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xfa, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04,   /* Row 153 */
+  0xb9, 0x00,
+  0xba, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xfc, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04,   /* Row 154 */
+  0xb8, 0x00,
+  0xb9, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x06, 0xfe, 0x03, 0x04, 0x07, 0x02, 0x05, 0x03, 0x04,   /* Row 155 */
+  0xb7, 0x00,
+  0xb8, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x06, 0x06, 0x05, 0x07, 0x02, 0x05, 0x03, 0x04, 0xb6, 0x00,   /* Row 156 */
+  0xb7, 0x00, 0x00, 0x04, 0xfc, 0x03, 0x03, 0x02, 0x05, 0x03, 0x04, 0xb5, 0x00,                     /* Row 157 */
+  0xb6, 0x00, 0x00, 0x04, 0xff, 0x03, 0x04, 0x05, 0x14, 0x05, 0x03, 0x04, 0xb4, 0x00,               /* Row 158 */
+  0xb5, 0x00, 0x00, 0x04, 0xfd, 0x03, 0x00, 0x04, 0xb3, 0x00                                        /* Row 159 */
+};
+
+static const uint32_t g_nuttx_rows[IMAGE_HEIGHT] =
 {
-  { 76,   0}, {  1,   1}, {  1,   2}, {  5,   3}, {  1,   4}, { 76,   0},                          /* Row 0 */
-  { 75,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  6,   3}, {  1,   4}, { 75,   0},              /* Row 1 */
-  { 74,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  2,   6}, {  4,   3}, {  1,   4},  /* Row 2 */
-  { 74,   0},
-  { 73,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   8},  /* Row 3 */
-  {  1,   6}, {  4,   3}, {  1,   4}, { 73,   0},
-  { 72,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 4 */
-  {  2,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 72,   0},
-  { 71,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 5 */
-  {  4,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 71,   0},
-  { 70,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 6 */
-  {  6,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 70,   0},
-  { 69,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 7 */
-  {  8,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 69,   0},
-  { 68,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 8 */
-  { 10,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 68,   0},
-  { 67,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 9 */
-  { 12,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 67,   0},
-  { 66,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 10 */
-  { 14,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 66,   0},
-  { 65,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 11 */
-  { 16,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 65,   0},
-  { 64,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 12 */
-  { 18,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 64,   0},
-  { 63,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 13 */
-  { 20,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 63,   0},
-  { 62,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 14 */
-  { 22,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 62,   0},
-  { 61,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 15 */
-  { 24,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 61,   0},
-  { 60,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 16 */
-  { 26,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 60,   0},
-  { 59,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 17 */
-  { 28,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 59,   0},
-  { 58,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 18 */
-  { 30,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 26,   0}, {  1,   9}, {  5,  10}, {  1,   9},
-  { 25,   0},
-  { 57,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 19 */
-  { 10,   3}, {  5,   5}, { 17,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 23,   0}, {  1,   1},
-  {  9,  10}, {  1,   1}, { 23,   0},
-  { 56,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 20 */
-  {  9,   3}, {  1,   5}, {  1,  11}, {  5,  12}, {  1,  11}, {  1,  13}, { 16,   3}, {  1,   6},
-  {  4,   3}, {  1,   4}, { 22,   0}, { 11,  10}, {  1,   1}, { 22,   0},
-  { 23,   0}, {  1,   9}, {  5,  10}, {  1,  14}, { 25,   0}, {  1,   1}, {  1,   2}, {  1,   5},  /* Row 21 */
-  {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  9,   3}, {  1,   5}, {  1,  15}, {  7,  10},
-  {  1,  12}, {  1,  16}, { 16,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 20,   0}, {  1,   9},
-  { 12,  10}, {  1,   1}, { 21,   0},
-  { 21,   0}, {  1,   1}, {  9,  10}, {  1,   1}, { 22,   0}, {  1,   1}, {  1,   2}, {  1,   5},  /* Row 22 */
-  {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  9,   3}, {  1,   5}, {  1,  15}, {  9,  10},
-  {  1,  12}, {  1,  16}, { 16,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 19,   0}, { 14,  10},
-  { 21,   0},
-  { 21,   0}, { 11,  10}, {  1,   1}, { 20,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3},  /* Row 23 */
-  {  1,   7}, {  1,   2}, {  1,   5}, { 10,   3}, {  1,  11}, { 11,  10}, {  1,  12}, {  1,   7},
-  {  3,   6}, {  1,   5}, { 12,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 17,   0}, {  1,   9},
-  {  6,  10}, {  2,  12}, {  6,  10}, {  1,   9}, { 20,   0},
-  { 20,   0}, {  1,  14}, { 12,  10}, {  1,   9}, {  4,   2}, {  1,  17}, { 13,   0}, {  1,   1},  /* Row 24 */
-  {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5}, { 10,   3}, {  1,  13},
-  {  1,  12}, { 12,  10}, {  1,  12}, {  5,   6}, { 12,   3}, {  1,   6}, {  4,   3}, {  1,   4},
-  { 16,   0}, {  5,  10}, {  6,  12}, {  4,  10}, {  1,  12}, {  1,  18}, {  1,   1}, { 18,   0},
-  { 19,   0}, {  1,   9}, { 13,  10}, {  1,  12}, {  1,  18}, {  5,   2}, { 11,   0}, {  1,   1},  /* Row 25 */
-  {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5}, { 11,   3}, {  1,  19},
-  {  4,  10}, {  5,  12}, {  5,  10}, {  1,  11}, {  5,   6}, { 12,   3}, {  1,   6}, {  4,   3},
-  {  1,   4}, { 14,   0}, {  1,   9}, {  5,  10}, {  6,  12}, {  5,  10}, {  1,  14}, {  1,   2},
-  {  1,   1}, { 17,   0},
-  { 19,   0}, {  6,  10}, {  3,  12}, {  6,  10}, {  1,  14}, {  5,   2}, {  1,  17}, {  9,   0},  /* Row 26 */
-  {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5}, { 11,   3},
-  {  1,   5}, {  1,  14}, {  4,  10}, {  6,  12}, {  4,  10}, {  1,  12}, {  6,   6}, { 12,   3},
-  {  1,   6}, {  4,   3}, {  1,   4}, { 13,   0}, {  5,  10}, {  8,  12}, {  4,  10}, {  1,  14},
-  {  2,   2}, {  1,   1}, { 16,   0},
-  { 18,   0}, {  1,   9}, {  4,  10}, {  6,  12}, {  5,  10}, {  1,  12}, {  1,  18}, {  5,   2},  /* Row 27 */
-  {  8,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5},
-  { 12,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  5,  10}, {  1,  11}, {  5,   6},
-  {  1,   5}, { 12,   3}, {  1,   6}, {  4,   3}, {  1,   4}, { 11,   0}, {  1,   9}, {  5,  10},
-  {  8,  12}, {  4,  10}, {  1,  14}, {  3,   2}, { 16,   0},
-  { 18,   0}, {  5,  10}, {  6,  12}, {  6,  10}, {  1,  14}, {  5,   2}, {  1,  17}, {  6,   0},  /* Row 28 */
-  {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5}, { 13,   3},
-  {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  6,   6}, { 13,   3},
-  {  1,   6}, {  4,   3}, {  1,   4}, { 10,   0}, {  5,  10}, {  8,  12}, {  5,  10}, {  1,  14},
-  {  3,   2}, {  1,  17}, { 15,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  1,  18}, {  5,   2}, {  5,   0},  /* Row 29 */
-  {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5}, { 14,   3},
-  {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  5,   6}, {  1,   5},
-  { 13,   3}, {  1,   6}, {  4,   3}, {  1,   4}, {  8,   0}, {  1,   9}, {  5,  10}, {  8,  12},
-  {  4,  10}, {  1,  12}, {  1,  18}, {  4,   2}, { 15,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  6,  10}, {  1,  14}, {  5,   2}, {  1,  17}, {  3,   0},  /* Row 30 */
-  {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5}, { 15,   3},
-  {  1,   5}, {  1,  12}, {  3,  10}, {  9,  12}, {  4,  10}, {  1,  12}, {  6,   6}, { 14,   3},
-  {  1,   6}, {  4,   3}, {  1,   4}, {  7,   0}, {  5,  10}, {  8,  12}, {  5,  10}, {  1,  14},
-  {  5,   2}, {  1,   1}, { 14,   0},
-  { 18,   0}, {  4,  10}, {  9,  12}, {  5,  10}, {  1,  12}, {  1,  18}, {  5,   2}, {  2,   0},  /* Row 31 */
-  {  1,   1}, {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5}, { 16,   3},
-  {  1,   5}, {  1,  12}, {  3,  10}, {  9,  12}, {  5,  10}, {  1,  11}, {  5,   6}, {  1,   5},
-  { 14,   3}, {  1,   6}, {  4,   3}, {  1,   4}, {  5,   0}, {  1,   9}, {  5,  10}, {  8,  12},
-  {  4,  10}, {  1,  12}, {  1,  18}, {  5,   2}, {  1,  17}, { 14,   0},
-  { 18,   0}, {  4,  10}, {  9,  12}, {  6,  10}, {  1,  14}, {  5,   2}, {  1,  17}, {  1,   1},  /* Row 32 */
-  {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5}, { 17,   3}, {  1,   5},
-  {  1,  12}, {  3,  10}, { 10,  12}, {  4,  10}, {  1,  12}, {  6,   6}, { 15,   3}, {  1,   6},
-  {  4,   3}, {  1,   4}, {  4,   0}, {  5,  10}, {  8,  12}, {  5,  10}, {  1,  14}, {  6,   2},
-  {  1,   1}, { 14,   0},
-  { 18,   0}, {  4,  10}, { 10,  12}, {  5,  10}, {  1,  12}, {  1,  18}, {  4,   2}, {  1,  18},  /* Row 33 */
-  {  1,   2}, {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5}, { 18,   3}, {  1,   5},
-  {  1,  12}, {  3,  10}, { 10,  12}, {  5,  10}, {  1,  11}, {  5,   6}, {  1,   5}, { 15,   3},
-  {  1,   6}, {  4,   3}, {  1,   4}, {  2,   0}, {  1,   9}, {  5,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  1,  18}, {  6,   2}, { 15,   0},
-  { 18,   0}, {  4,  10}, { 10,  12}, {  6,  10}, {  1,  14}, {  3,   2}, {  1,  20}, {  1,   6},  /* Row 34 */
-  {  1,   5}, {  2,   3}, {  1,   7}, {  1,   2}, {  1,   5}, { 19,   3}, {  1,   5}, {  1,  12},
-  {  3,  10}, { 11,  12}, {  4,  10}, {  1,  12}, {  6,   6}, { 16,   3}, {  1,   6}, {  4,   3},
-  {  1,   4}, {  1,   0}, {  5,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  7,   2}, {  1,  17},
-  { 15,   0},
-  { 18,   0}, {  4,  10}, { 11,  12}, {  5,  10}, {  1,  12}, {  1,  18}, {  1,   2}, {  1,  20},  /* Row 35 */
-  {  3,   6}, {  1,   3}, {  1,   7}, {  1,   2}, {  1,   5}, { 20,   3}, {  1,   5}, {  1,  12},
-  {  3,  10}, { 11,  12}, {  5,  10}, {  1,  11}, {  5,   6}, {  1,   5}, { 16,   3}, {  1,   6},
-  {  4,   3}, {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  7,   2}, { 16,   0},
-  { 18,   0}, {  4,  10}, { 11,  12}, {  6,  10}, {  1,  14}, {  1,  20}, {  5,   6}, {  1,   2},  /* Row 36 */
-  {  1,   5}, { 21,   3}, {  1,   5}, {  1,  12}, {  3,  10}, { 12,  12}, {  4,  10}, {  1,  12},
-  {  6,   6}, { 17,   3}, {  1,   6}, {  2,   3}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12},
-  {  5,  10}, {  1,  14}, {  6,   2}, {  1,  17}, { 16,   0},
-  { 18,   0}, {  4,  10}, { 12,  12}, {  5,  10}, {  1,  12}, {  6,   6}, {  1,   5}, { 22,   3},  /* Row 37 */
-  {  1,   5}, {  1,  12}, {  3,  10}, { 12,  12}, {  5,  10}, {  1,  11}, {  5,   6}, {  1,   5},
-  { 17,   3}, {  1,   6}, {  1,   3}, {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10}, {  1,  12},
-  {  1,  18}, {  6,   2}, { 17,   0},
-  { 18,   0}, {  4,  10}, { 12,  12}, {  6,  10}, {  1,  11}, {  5,   6}, {  1,   5}, { 22,   3},  /* Row 38 */
-  {  1,   5}, {  1,  12}, {  3,  10}, { 13,  12}, {  4,  10}, {  1,  12}, {  6,   6}, { 18,   3},
-  {  1,   6}, {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  14}, {  6,   2}, {  1,  17},
-  { 17,   0},
-  { 18,   0}, {  4,  10}, { 13,  12}, {  5,  10}, {  1,  12}, {  6,   6}, { 22,   3}, {  1,   5},  /* Row 39 */
-  {  1,  12}, {  3,  10}, { 13,  12}, {  5,  10}, {  1,  11}, {  5,   6}, {  1,   5}, { 17,   3},
-  {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  1,  18}, {  6,   2}, { 18,   0},
-  { 18,   0}, {  4,  10}, { 13,  12}, {  6,  10}, {  1,  11}, {  5,   6}, {  1,   5}, { 21,   3},  /* Row 40 */
-  {  1,   5}, {  1,  12}, {  3,  10}, { 14,  12}, {  4,  10}, {  1,  12}, {  6,   6}, { 16,   3},
-  {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  14}, {  6,   2}, {  1,  17},
-  { 18,   0},
-  { 18,   0}, {  4,  10}, { 14,  12}, {  5,  10}, {  1,  12}, {  6,   6}, { 21,   3}, {  1,   5},  /* Row 41 */
-  {  1,  12}, {  3,  10}, { 14,  12}, {  5,  10}, {  1,  11}, {  5,   6}, {  1,   5}, { 15,   3},
-  {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  1,  18}, {  6,   2}, { 19,   0},
-  { 18,   0}, {  4,  10}, { 14,  12}, {  6,  10}, {  1,  11}, {  5,   6}, {  1,   5}, { 20,   3},  /* Row 42 */
-  {  1,   5}, {  1,  12}, {  3,  10}, { 15,  12}, {  4,  10}, {  1,  12}, {  6,   6}, { 14,   3},
-  {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  14}, {  6,   2}, {  1,  17},
-  { 19,   0},
-  { 18,   0}, {  4,  10}, { 15,  12}, {  5,  10}, {  1,  12}, {  6,   6}, { 20,   3}, {  1,   5},  /* Row 43 */
-  {  1,  12}, {  3,  10}, { 15,  12}, {  5,  10}, {  1,  11}, {  5,   6}, {  1,   5}, { 13,   3},
-  {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  1,  18}, {  6,   2}, { 20,   0},
-  { 18,   0}, {  4,  10}, { 15,  12}, {  6,  10}, {  1,  11}, {  5,   6}, {  1,   5}, { 19,   3},  /* Row 44 */
-  {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  1,  10}, {  8,  12}, {  4,  10}, {  1,  12},
-  {  6,   6}, { 12,   3}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  14},
-  {  6,   2}, {  1,  17}, { 20,   0},
-  { 18,   0}, {  4,  10}, { 16,  12}, {  5,  10}, {  1,  12}, {  6,   6}, { 19,   3}, {  1,   5},  /* Row 45 */
-  {  1,  12}, {  3,  10}, {  7,  12}, {  1,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  5,   6},
-  {  1,   5}, { 11,   3}, {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  1,  18},
-  {  6,   2}, { 21,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  1,  10}, {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6},  /* Row 46 */
-  {  1,   5}, { 18,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  2,  10}, {  8,  12},
-  {  4,  10}, {  1,  12}, {  6,   6}, { 10,   3}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12},
-  {  5,  10}, {  1,  14}, {  6,   2}, {  1,  17}, { 21,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  1,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6},  /* Row 47 */
-  { 18,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  2,  10}, {  8,  12}, {  5,  10},
-  {  1,  11}, {  5,   6}, {  1,   5}, {  9,   3}, {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  1,  18}, {  6,   2}, { 22,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  2,  10}, {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6},  /* Row 48 */
-  {  1,   5}, { 17,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  8,  12},
-  {  4,  10}, {  1,  12}, {  6,   6}, {  8,   3}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12},
-  {  5,  10}, {  1,  14}, {  6,   2}, {  1,  17}, { 22,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  2,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6},  /* Row 49 */
-  { 17,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  8,  12}, {  5,  10},
-  {  1,  11}, {  5,   6}, {  1,   5}, {  7,   3}, {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  1,  21}, {  1,  20}, {  5,   2}, { 23,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6},  /* Row 50 */
-  {  1,   5}, { 16,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  4,  10}, {  8,  12},
-  {  4,  10}, {  1,  12}, {  6,   6}, {  6,   3}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12},
-  {  5,  10}, {  1,  11}, {  2,   6}, {  1,  20}, {  3,   2}, {  1,  17}, { 23,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6},  /* Row 51 */
-  { 16,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  4,  10}, {  8,  12}, {  5,  10},
-  {  1,  11}, {  5,   6}, {  1,   5}, {  5,   3}, {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  4,   6}, {  1,  20}, {  2,   2}, { 24,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  4,  10}, {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6},  /* Row 52 */
-  {  1,   5}, { 15,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  5,  10}, {  8,  12},
-  {  4,  10}, {  1,  12}, {  6,   6}, {  4,   3}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12},
-  {  5,  10}, {  1,  11}, {  5,   6}, {  1,  20}, {  1,  17}, { 24,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6},  /* Row 53 */
-  { 15,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  5,  10}, {  8,  12}, {  5,  10},
-  {  1,  11}, {  5,   6}, {  1,   5}, {  3,   3}, {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, { 25,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  5,  10}, {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6},  /* Row 54 */
-  {  1,   5}, { 14,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  6,  10}, {  8,  12},
-  {  4,  10}, {  1,  12}, {  6,   6}, {  2,   3}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12},
-  {  5,  10}, {  1,  11}, {  7,   6}, {  1,   3}, {  1,   4}, { 23,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  5,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6},  /* Row 55 */
-  { 14,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  6,  10}, {  8,  12}, {  5,  10},
-  {  1,  11}, {  5,   6}, {  1,   5}, {  1,   3}, {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  3,   3}, {  1,   4}, { 22,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  6,  10}, {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6},  /* Row 56 */
-  {  1,   5}, { 13,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  7,  10}, {  8,  12},
-  {  4,  10}, {  1,  12}, {  6,   6}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10},
-  {  1,  11}, {  8,   6}, {  3,   3}, {  1,   4}, { 21,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  6,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6},  /* Row 57 */
-  { 13,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  7,  10}, {  8,  12}, {  5,  10},
-  {  1,  11}, {  5,   6}, {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  7,   6},
-  {  2,   3}, {  1,   6}, {  3,   3}, {  1,   4}, { 20,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  7,  10}, {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6},  /* Row 58 */
-  {  1,   5}, { 12,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  8,  10}, {  8,  12},
-  {  4,  10}, {  1,  12}, {  5,   6}, {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  6,   6}, {  1,   5}, {  3,   3}, {  1,   6}, {  3,   3}, {  1,   4}, { 19,   0},
-  { 17,   0}, {  1,  22}, {  1,  12}, {  3,  10}, {  8,  12}, {  7,  10}, {  8,  12}, {  5,  10},  /* Row 59 */
-  {  1,  12}, {  6,   6}, { 12,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  8,  10},
-  {  8,  12}, {  5,  10}, {  1,  11}, {  3,   6}, {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  5,   3}, {  1,   6}, {  3,   3}, {  1,   4}, { 18,   0},
-  { 16,   0}, {  1,   1}, {  1,  18}, {  1,  12}, {  3,  10}, {  8,  12}, {  8,  10}, {  7,  12},  /* Row 60 */
-  {  6,  10}, {  1,  11}, {  5,   6}, {  1,   5}, { 11,   3}, {  1,   5}, {  1,  12}, {  3,  10},
-  {  7,  12}, {  4,  10}, {  1,  12}, {  4,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  3,   6},
-  {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  6,   6}, {  1,   5}, {  6,   3},
-  {  1,   6}, {  3,   3}, {  1,   4}, { 17,   0},
-  { 15,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  8,  10},  /* Row 61 */
-  {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6}, { 11,   3}, {  1,   5}, {  1,  12}, {  3,  10},
-  {  7,  12}, {  3,  10}, {  1,  12}, {  1,  11}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  1,   6}, {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  7,   6}, {  8,   3},
-  {  1,   6}, {  3,   3}, {  1,   4}, { 16,   0},
-  { 14,   0}, {  1,   1}, {  1,   2}, {  2,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  9,  10},  /* Row 62 */
-  {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6}, {  1,   5}, { 10,   3}, {  1,   5}, {  1,  12},
-  {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  1,  21}, {  1,  12}, {  4,  10}, {  8,  12},
-  {  4,  10}, {  1,  12}, {  1,  23}, {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  6,   6}, {  1,   5}, {  9,   3}, {  1,   6}, {  3,   3}, {  1,   4}, { 15,   0},
-  { 13,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,  12}, {  3,  10},  /* Row 63 */
-  {  8,  12}, {  4,  10}, {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6},
-  { 10,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  1,   6},
-  {  1,  11}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  5,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, { 11,   3}, {  1,   6}, {  3,   3}, {  1,   4}, { 14,   0},
-  { 12,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,  24}, {  1,  12},  /* Row 64 */
-  {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  1,  11}, {  5,  10}, {  7,  12}, {  6,  10},
-  {  1,  11}, {  5,   6}, {  1,   5}, {  9,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12},
-  {  3,  10}, {  1,  12}, {  2,   6}, {  1,  12}, {  4,  10}, {  8,  12}, {  9,  10}, {  8,  12},
-  {  5,  10}, {  1,  11}, {  6,   6}, {  1,   5}, { 12,   3}, {  1,   6}, {  3,   3}, {  1,   4},
-  { 13,   0},
-  { 11,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,   2}, {  1,   3},  /* Row 65 */
-  {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  1,  21}, {  1,  12}, {  4,  10},
-  {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6}, {  9,   3}, {  1,   5}, {  1,  12}, {  3,  10},
-  {  7,  12}, {  3,  10}, {  1,  12}, {  2,   6}, {  1,  11}, {  4,  10}, {  8,  12}, {  9,  10},
-  {  8,  12}, {  4,  10}, {  1,  12}, {  7,   6}, { 14,   3}, {  1,   6}, {  3,   3}, {  1,   4},
-  { 12,   0},
-  { 10,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,   2}, {  1,   3},  /* Row 66 */
-  {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  1,   6}, {  1,  11},
-  {  5,  10}, {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6}, {  1,   5}, {  8,   3}, {  1,   5},
-  {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  3,   6}, {  1,  12}, {  4,  10},
-  {  8,  12}, {  7,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  6,   6}, {  1,   5}, { 15,   3},
-  {  1,   6}, {  3,   3}, {  1,   4}, { 11,   0},
-  {  9,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,   2}, {  2,   3},  /* Row 67 */
-  {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  2,   6}, {  1,  12},
-  {  4,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6}, {  8,   3}, {  1,   5}, {  1,  12},
-  {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  3,   6}, {  1,  11}, {  4,  10}, {  8,  12},
-  {  7,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  7,   6}, { 17,   3}, {  1,   6}, {  3,   3},
-  {  1,   4}, { 10,   0},
-  {  8,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,   2}, {  3,   3},  /* Row 68 */
-  {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  2,   6}, {  1,  11},
-  {  5,  10}, {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6}, {  1,   5}, {  7,   3}, {  1,   5},
-  {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  4,   6}, {  1,  12}, {  4,  10},
-  {  8,  12}, {  5,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  6,   6}, {  1,   5}, { 18,   3},
-  {  1,   6}, {  3,   3}, {  1,   4}, {  9,   0},
-  {  7,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,   2}, {  4,   3},  /* Row 69 */
-  {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  3,   6}, {  1,  12},
-  {  4,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6}, {  7,   3}, {  1,   5}, {  1,  12},
-  {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  4,   6}, {  1,  11}, {  4,  10}, {  8,  12},
-  {  5,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  7,   6}, { 20,   3}, {  1,   6}, {  3,   3},
-  {  1,   4}, {  8,   0},
-  {  6,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,   2}, {  5,   3},  /* Row 70 */
-  {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  3,   6}, {  1,  11},
-  {  5,  10}, {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6}, {  1,   5}, {  6,   3}, {  1,   5},
-  {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  5,   6}, {  1,  12}, {  4,  10},
-  {  8,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  6,   6}, {  1,   5}, { 21,   3},
-  {  1,   6}, {  3,   3}, {  1,   4}, {  7,   0},
-  {  5,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,   2}, {  6,   3},  /* Row 71 */
-  {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  4,   6}, {  1,  12},
-  {  4,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6}, {  6,   3}, {  1,   5}, {  1,  12},
-  {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  5,   6}, {  1,  11}, {  4,  10}, {  8,  12},
-  {  3,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  7,   6}, { 23,   3}, {  1,   6}, {  3,   3},
-  {  1,   4}, {  6,   0},
-  {  4,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,   2}, {  7,   3},  /* Row 72 */
-  {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  4,   6}, {  1,  11},
-  {  5,  10}, {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6}, {  1,   5}, {  5,   3}, {  1,   5},
-  {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  6,   6}, {  1,  12}, {  4,  10},
-  {  8,  12}, {  1,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  6,   6}, {  1,   5}, { 24,   3},
-  {  1,   6}, {  3,   3}, {  1,   4}, {  5,   0},
-  {  3,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,   2}, {  8,   3},  /* Row 73 */
-  {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  5,   6}, {  1,  12},
-  {  4,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6}, {  5,   3}, {  1,   5}, {  1,  12},
-  {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  6,   6}, {  1,  11}, {  4,  10}, {  8,  12},
-  {  1,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  7,   6}, { 26,   3}, {  1,   6}, {  3,   3},
-  {  1,   4}, {  4,   0},
-  {  2,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,   2}, {  9,   3},  /* Row 74 */
-  {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  5,   6}, {  1,  11},
-  {  5,  10}, {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6}, {  1,   5}, {  4,   3}, {  1,   5},
-  {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  1,  12}, {  4,  10},
-  { 15,  12}, {  5,  10}, {  1,  11}, {  6,   6}, {  1,   5}, { 27,   3}, {  1,   6}, {  3,   3},
-  {  1,   4}, {  3,   0},
-  {  1,   0}, {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,   2}, { 10,   3},  /* Row 75 */
-  {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  6,   6}, {  1,  12},
-  {  4,  10}, {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6}, {  4,   3}, {  1,   5}, {  1,  12},
-  {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  1,  11}, {  4,  10}, { 15,  12},
-  {  4,  10}, {  1,  12}, {  7,   6}, { 29,   3}, {  1,   6}, {  3,   3}, {  1,   4}, {  2,   0},
-  {  1,   1}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,   2}, { 11,   3}, {  1,   5},  /* Row 76 */
-  {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  6,   6}, {  1,  11}, {  5,  10},
-  {  7,  12}, {  6,  10}, {  1,  11}, {  5,   6}, {  1,   5}, {  3,   3}, {  1,   5}, {  1,  12},
-  {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  1,  13}, {  1,  12}, {  4,  10},
-  { 13,  12}, {  5,  10}, {  1,  11}, {  6,   6}, {  1,   5}, { 30,   3}, {  1,   6}, {  3,   3},
-  {  1,   4}, {  1,   0},
-  {  1,   2}, {  1,   5}, {  1,   3}, {  1,   6}, {  1,   2}, { 12,   3}, {  1,   5}, {  1,  12},  /* Row 77 */
-  {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  1,  12}, {  4,  10}, {  8,  12},
-  {  5,  10}, {  1,  12}, {  6,   6}, {  3,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12},
-  {  3,  10}, {  1,  12}, {  7,   6}, {  1,   3}, {  1,  11}, {  4,  10}, { 13,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, { 32,   3}, {  1,   6}, {  3,   3}, {  1,   4},
-  {  2,   3}, {  1,   6}, {  1,   2}, { 13,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12},  /* Row 78 */
-  {  3,  10}, {  1,  12}, {  7,   6}, {  1,  11}, {  5,  10}, {  7,  12}, {  6,  10}, {  1,  11},
-  {  5,   6}, {  1,   5}, {  2,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10},
-  {  1,  12}, {  7,   6}, {  1,   3}, {  1,  13}, {  1,  12}, {  4,  10}, { 11,  12}, {  5,  10},
-  {  1,  11}, {  6,   6}, {  1,   5}, { 33,   3}, {  1,   6}, {  3,   3},
-  {  1,   3}, {  1,   5}, {  1,  18}, { 14,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12},  /* Row 79 */
-  {  3,  10}, {  1,  12}, {  7,   6}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10},
-  {  1,  12}, {  6,   6}, {  2,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10},
-  {  1,  12}, {  7,   6}, {  2,   3}, {  1,  11}, {  4,  10}, { 11,  12}, {  4,  10}, {  1,  12},
-  {  7,   6}, { 35,   3}, {  1,   6}, {  2,   3},
-  {  2,   3}, {  1,   6}, { 14,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10},  /* Row 80 */
-  {  1,  12}, {  7,   6}, {  1,   3}, {  1,  11}, {  5,  10}, {  7,  12}, {  6,  10}, {  1,  11},
-  {  5,   6}, {  1,   5}, {  1,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10},
-  {  1,  12}, {  7,   6}, {  2,   3}, {  1,  11}, {  5,  10}, { 10,  12}, {  4,  10}, {  1,  11},
-  {  6,   6}, {  1,   5}, { 35,   3}, {  1,   5}, {  1,   6}, {  1,   3},
-  {  3,   3}, {  1,   6}, { 13,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10},  /* Row 81 */
-  {  1,  12}, {  7,   6}, {  1,   3}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10},
-  {  1,  12}, {  6,   6}, {  1,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10},
-  {  1,  12}, {  7,   6}, {  1,   3}, {  1,  13}, {  1,  12}, {  4,  10}, { 10,  12}, {  4,  10},
-  {  1,  12}, {  1,  21}, {  6,   6}, { 36,   3}, {  1,   7}, {  1,   2}, {  1,   5},
-  {  4,   3}, {  1,   6}, { 12,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10},  /* Row 82 */
-  {  1,  12}, {  7,   6}, {  2,   3}, {  1,  11}, {  5,  10}, {  7,  12}, {  6,  10}, {  1,  11},
-  {  5,   6}, {  2,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  7,   6},
-  {  1,   3}, {  1,  11}, {  5,  10}, { 10,  12}, {  5,  10}, {  1,  11}, {  6,   6}, { 35,   3},
-  {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3},
-  {  1,   4}, {  4,   3}, {  1,   6}, { 11,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12},  /* Row 83 */
-  {  3,  10}, {  1,  12}, {  7,   6}, {  2,   3}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12},
-  {  5,  10}, {  1,  12}, {  6,   6}, {  1,   5}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10},
-  {  1,  12}, {  7,   6}, {  1,  13}, {  1,  12}, {  4,  10}, { 12,  12}, {  4,  10}, {  1,  12},
-  {  6,   6}, {  1,   5}, { 33,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4},
-  {  1,   0}, {  1,   4}, {  4,   3}, {  1,   6}, { 10,   3}, {  1,   5}, {  1,  12}, {  3,  10},  /* Row 84 */
-  {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  3,   3}, {  1,  11}, {  5,  10}, {  7,  12},
-  {  6,  10}, {  1,  11}, {  5,   6}, {  1,  13}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10},
-  {  1,  12}, {  7,   6}, {  1,  11}, {  5,  10}, { 12,  12}, {  5,  10}, {  1,  11}, {  6,   6},
-  { 32,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, {  1,   0},
-  {  2,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  9,   3}, {  1,   5}, {  1,  12}, {  3,  10},  /* Row 85 */
-  {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  3,   3}, {  1,  13}, {  1,  12}, {  4,  10},
-  {  8,  12}, {  5,  10}, {  1,  12}, {  6,   6}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10},
-  {  1,  12}, {  7,   6}, {  1,  12}, {  4,  10}, { 14,  12}, {  4,  10}, {  1,  12}, {  6,   6},
-  {  1,   5}, { 30,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, {  2,   0},
-  {  3,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  8,   3}, {  1,   5}, {  1,  12}, {  3,  10},  /* Row 86 */
-  {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  4,   3}, {  1,  11}, {  5,  10}, {  7,  12},
-  {  6,  10}, {  1,  11}, {  5,   6}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12},
-  {  6,   6}, {  1,  11}, {  5,  10}, { 14,  12}, {  5,  10}, {  1,  11}, {  6,   6}, { 29,   3},
-  {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, {  3,   0},
-  {  4,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  7,   3}, {  1,   5}, {  1,  12}, {  3,  10},  /* Row 87 */
-  {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  4,   3}, {  1,  13}, {  1,  12}, {  4,  10},
-  {  8,  12}, {  5,  10}, {  1,  12}, {  5,   6}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10},
-  {  1,  12}, {  6,   6}, {  1,  12}, {  4,  10}, { 16,  12}, {  4,  10}, {  1,  12}, {  6,   6},
-  {  1,   5}, { 27,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, {  4,   0},
-  {  5,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  6,   3}, {  1,   5}, {  1,  12}, {  3,  10},  /* Row 88 */
-  {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  5,   3}, {  1,  11}, {  5,  10}, {  7,  12},
-  {  6,  10}, {  1,  11}, {  4,   6}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12},
-  {  5,   6}, {  1,  11}, {  5,  10}, { 16,  12}, {  5,  10}, {  1,  11}, {  6,   6}, { 26,   3},
-  {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, {  5,   0},
-  {  6,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  5,   3}, {  1,   5}, {  1,  12}, {  3,  10},  /* Row 89 */
-  {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  5,   3}, {  1,  13}, {  1,  12}, {  4,  10},
-  {  8,  12}, {  5,  10}, {  1,  12}, {  4,   6}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10},
-  {  1,  12}, {  5,   6}, {  1,  12}, {  4,  10}, {  9,  12}, {  1,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  6,   6}, {  1,   5}, { 24,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3},
-  {  1,   4}, {  6,   0},
-  {  7,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  4,   3}, {  1,   5}, {  1,  12}, {  3,  10},  /* Row 90 */
-  {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  6,   3}, {  1,  11}, {  5,  10}, {  7,  12},
-  {  6,  10}, {  1,  11}, {  3,   6}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12},
-  {  4,   6}, {  1,  11}, {  5,  10}, {  8,  12}, {  2,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  6,   6}, { 23,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, {  7,   0},
-  {  8,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  3,   3}, {  1,   5}, {  1,  12}, {  3,  10},  /* Row 91 */
-  {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  6,   3}, {  1,  13}, {  1,  12}, {  4,  10},
-  {  8,  12}, {  5,  10}, {  1,  12}, {  3,   6}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10},
-  {  1,  12}, {  4,   6}, {  1,  12}, {  4,  10}, {  9,  12}, {  3,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  6,   6}, {  1,   5}, { 21,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3},
-  {  1,   4}, {  8,   0},
-  {  9,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  2,   3}, {  1,   5}, {  1,  12}, {  3,  10},  /* Row 92 */
-  {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  7,   3}, {  1,  11}, {  5,  10}, {  7,  12},
-  {  6,  10}, {  1,  11}, {  2,   6}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12},
-  {  3,   6}, {  1,  11}, {  5,  10}, {  8,  12}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  6,   6}, { 20,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, {  9,   0},
-  { 10,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  1,   3}, {  1,   5}, {  1,  12}, {  3,  10},  /* Row 93 */
-  {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, {  7,   3}, {  1,  13}, {  1,  12}, {  4,  10},
-  {  8,  12}, {  5,  10}, {  1,  12}, {  2,   6}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10},
-  {  1,  12}, {  3,   6}, {  1,  12}, {  4,  10}, {  9,  12}, {  5,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  6,   6}, {  1,   5}, { 18,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3},
-  {  1,   4}, { 10,   0},
-  { 11,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  1,  13}, {  1,  12}, {  3,  10}, {  8,  12},  /* Row 94 */
-  {  3,  10}, {  1,  12}, {  7,   6}, {  8,   3}, {  1,  11}, {  5,  10}, {  7,  12}, {  6,  10},
-  {  1,  11}, {  1,   6}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  2,   6},
-  {  1,  11}, {  5,  10}, {  8,  12}, {  6,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  6,   6},
-  { 17,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 11,   0},
-  { 12,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10},  /* Row 95 */
-  {  1,  12}, {  7,   6}, {  8,   3}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10},
-  {  1,  12}, {  1,  21}, {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  2,   6},
-  {  1,  12}, {  4,  10}, {  9,  12}, {  7,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  6,   6},
-  {  1,   5}, { 15,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 12,   0},
-  { 13,   0}, {  1,   4}, {  3,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10},  /* Row 96 */
-  {  1,  12}, {  7,   6}, {  9,   3}, {  1,  11}, {  5,  10}, {  7,  12}, {  6,  10}, {  1,  11},
-  {  1,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  1,   6}, {  1,  11}, {  5,  10},
-  {  8,  12}, {  8,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  6,   6}, { 14,   3}, {  1,   7},
-  {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 13,   0},
-  { 14,   0}, {  1,   4}, {  2,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10},  /* Row 97 */
-  {  1,  12}, {  7,   6}, {  9,   3}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10},
-  {  1,  12}, {  4,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  1,  21}, {  1,  12}, {  4,  10},
-  {  9,  12}, {  4,  10}, {  1,  12}, {  4,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  6,   6},
-  {  1,   5}, { 12,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 14,   0},
-  { 15,   0}, {  1,   4}, {  1,   3}, {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10},  /* Row 98 */
-  {  1,  12}, {  7,   6}, { 10,   3}, {  1,  11}, {  5,  10}, {  7,  12}, { 10,  10}, {  7,  12},
-  {  3,  10}, {  1,  12}, {  1,  11}, {  5,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  1,  12},
-  {  3,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  6,   6}, { 11,   3}, {  1,   7}, {  1,   2},
-  {  1,   5}, {  1,   3}, {  1,   4}, { 15,   0},
-  { 16,   0}, {  1,   4}, {  1,   5}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12},  /* Row 99 */
-  {  7,   6}, { 10,   3}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12}, {  9,  10}, {  7,  12},
-  {  4,  10}, {  1,  12}, {  4,  10}, {  9,  12}, {  4,  10}, {  1,  12}, {  1,   6}, {  1,  11},
-  {  4,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  6,   6}, {  1,   5}, {  9,   3}, {  1,   7},
-  {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 16,   0},
-  { 17,   0}, {  1,   4}, {  1,  12}, {  3,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6},  /* Row 100 */
-  { 11,   3}, {  1,  11}, {  5,  10}, {  7,  12}, {  9,  10}, {  7,  12}, {  9,  10}, {  8,  12},
-  {  5,  10}, {  1,  11}, {  2,   6}, {  1,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  6,   6}, {  8,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 17,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 11,   3}, {  1,  13},  /* Row 101 */
-  {  1,  12}, {  4,  10}, {  8,  12}, {  8,  10}, {  7,  12}, {  8,  10}, {  9,  12}, {  4,  10},
-  {  1,  12}, {  3,   6}, {  1,  11}, {  4,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  6,   6},
-  {  1,   5}, {  6,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 18,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 12,   3}, {  1,  11},  /* Row 102 */
-  {  5,  10}, {  7,  12}, {  8,  10}, {  7,  12}, {  8,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  4,   6}, {  1,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  6,   6}, {  5,   3},
-  {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 19,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 12,   3}, {  1,  13},  /* Row 103 */
-  {  1,  12}, {  4,  10}, {  8,  12}, {  7,  10}, {  7,  12}, {  7,  10}, {  9,  12}, {  4,  10},
-  {  1,  12}, {  5,   6}, {  1,  11}, {  4,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  6,   6},
-  {  1,   5}, {  3,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 20,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 13,   3}, {  1,  11},  /* Row 104 */
-  {  5,  10}, {  7,  12}, {  7,  10}, {  7,  12}, {  7,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  6,   6}, {  1,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  6,   6}, {  2,   3},
-  {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 21,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 13,   3}, {  1,  13},  /* Row 105 */
-  {  1,  12}, {  4,  10}, {  8,  12}, {  6,  10}, {  7,  12}, {  6,  10}, {  9,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  1,  11}, {  4,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  7,   6},
-  {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 22,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 14,   3}, {  1,  11},  /* Row 106 */
-  {  5,  10}, {  7,  12}, {  6,  10}, {  7,  12}, {  6,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  7,   6}, {  1,  13}, {  1,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  11}, {  6,   6},
-  {  1,  18}, {  1,   5}, {  1,   3}, {  1,   4}, { 23,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 14,   3}, {  1,  13},  /* Row 107 */
-  {  1,  12}, {  4,  10}, {  8,  12}, {  5,  10}, {  7,  12}, {  5,  10}, {  9,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  1,   5}, {  1,   3}, {  1,  11}, {  4,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  1,   3}, {  1,   4}, { 24,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 15,   3}, {  1,  11},  /* Row 108 */
-  {  5,  10}, {  7,  12}, {  5,  10}, {  7,  12}, {  5,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  7,   6}, {  2,   3}, {  1,  13}, {  1,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  5,   6}, {  1,  20}, {  1,   1}, { 25,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 15,   3}, {  1,  13},  /* Row 109 */
-  {  1,  12}, {  4,  10}, {  8,  12}, {  4,  10}, {  7,  12}, {  4,  10}, {  9,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  1,   5}, {  3,   3}, {  1,  11}, {  4,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  4,   6}, {  1,  20}, {  2,   2}, { 25,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 16,   3}, {  1,  11},  /* Row 110 */
-  {  5,  10}, {  7,  12}, {  4,  10}, {  7,  12}, {  4,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  7,   6}, {  4,   3}, {  1,  13}, {  1,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  2,   6}, {  1,  20}, {  3,   2}, {  1,  17}, { 24,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 16,   3}, {  1,  13},  /* Row 111 */
-  {  1,  12}, {  4,  10}, {  8,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  9,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  1,   5}, {  5,   3}, {  1,  11}, {  4,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  1,  21}, {  1,  20}, {  5,   2}, { 24,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 17,   3}, {  1,  11},  /* Row 112 */
-  {  5,  10}, {  7,  12}, {  3,  10}, {  7,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  7,   6}, {  6,   3}, {  1,  13}, {  1,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  14},
-  {  6,   2}, {  1,  17}, { 23,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 17,   3}, {  1,  13},  /* Row 113 */
-  {  1,  12}, {  4,  10}, {  8,  12}, {  2,  10}, {  7,  12}, {  2,  10}, {  9,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  1,   5}, {  7,   3}, {  1,  11}, {  4,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  1,  18}, {  6,   2}, { 23,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 18,   3}, {  1,  11},  /* Row 114 */
-  {  5,  10}, {  7,  12}, {  2,  10}, {  7,  12}, {  2,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  7,   6}, {  8,   3}, {  1,  13}, {  1,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  14},
-  {  6,   2}, {  1,  17}, { 22,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 18,   3}, {  1,  13},  /* Row 115 */
-  {  1,  12}, {  4,  10}, {  8,  12}, {  1,  10}, {  7,  12}, {  1,  10}, {  9,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  1,   5}, {  9,   3}, {  1,  11}, {  4,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  1,  18}, {  6,   2}, { 22,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   6}, { 19,   3}, {  1,  11},  /* Row 116 */
-  {  5,  10}, {  7,  12}, {  1,  10}, {  7,  12}, {  1,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  7,   6}, { 10,   3}, {  1,  13}, {  1,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  14},
-  {  6,   2}, {  1,  17}, { 21,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  1,  18}, {  6,   6}, { 19,   3},  /* Row 117 */
-  {  1,  13}, {  1,  12}, {  4,  10}, { 24,  12}, {  4,  10}, {  1,  12}, {  7,   6}, {  1,   5},
-  { 11,   3}, {  1,  11}, {  4,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  1,  18}, {  6,   2},
-  { 21,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  1,   2}, {  1,  20}, {  5,   6},  /* Row 118 */
-  { 20,   3}, {  1,  11}, {  5,  10}, { 22,  12}, {  5,  10}, {  1,  11}, {  7,   6}, { 12,   3},
-  {  1,  13}, {  1,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  14}, {  6,   2}, {  1,  17},
-  { 20,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  2,   2}, {  1,  20}, {  5,   6},  /* Row 119 */
-  { 19,   3}, {  1,  13}, {  1,  12}, {  4,  10}, { 22,  12}, {  4,  10}, {  1,  12}, {  7,   6},
-  {  1,   5}, { 13,   3}, {  1,  11}, {  4,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  1,  18},
-  {  6,   2}, { 20,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  3,   2}, {  1,  20}, {  3,   6},  /* Row 120 */
-  {  1,   3}, {  1,   6}, { 19,   3}, {  1,  11}, {  5,  10}, { 20,  12}, {  5,  10}, {  1,  11},
-  {  7,   6}, { 14,   3}, {  1,  13}, {  1,  12}, {  3,  10}, {  8,  12}, {  5,  10}, {  1,  14},
-  {  6,   2}, {  1,  17}, { 19,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  4,   2}, {  1,  20}, {  2,   6},  /* Row 121 */
-  {  2,   3}, {  1,   6}, { 18,   3}, {  1,  13}, {  1,  12}, {  4,  10}, { 20,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  1,   5}, { 14,   3}, {  1,   7}, {  1,  25}, {  4,  10}, {  8,  12},
-  {  4,  10}, {  1,  12}, {  1,  18}, {  6,   2}, { 19,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  5,   2}, {  1,  20}, {  1,   6},  /* Row 122 */
-  {  3,   3}, {  1,   6}, { 18,   3}, {  1,  11}, {  5,  10}, { 18,  12}, {  5,  10}, {  1,  11},
-  {  7,   6}, { 14,   3}, {  1,   7}, {  1,   2}, {  1,  13}, {  1,  12}, {  3,  10}, {  8,  12},
-  {  5,  10}, {  1,  14}, {  6,   2}, {  1,  17}, { 18,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  6,   2}, {  1,  20}, {  4,   3},  /* Row 123 */
-  {  1,   6}, { 17,   3}, {  1,  13}, {  1,  12}, {  4,  10}, { 18,  12}, {  4,  10}, {  1,  12},
-  {  7,   6}, {  1,   5}, { 13,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,  20},
-  {  4,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  1,  18}, {  6,   2}, { 18,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, {  1,   0}, {  4,   3},  /* Row 124 */
-  {  1,   6}, { 17,   3}, {  1,  11}, {  5,  10}, { 16,  12}, {  5,  10}, {  1,  11}, {  7,   6},
-  { 13,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, {  1,  17}, {  4,  10},
-  {  8,  12}, {  5,  10}, {  1,  14}, {  6,   2}, {  1,  17}, { 17,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, {  1,   0}, {  1,   4},  /* Row 125 */
-  {  4,   3}, {  1,   6}, { 16,   3}, {  1,  13}, {  1,  12}, {  4,  10}, { 16,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  1,   5}, { 12,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3},
-  {  1,   4}, {  2,   0}, {  1,   9}, {  4,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  1,  18},
-  {  6,   2}, { 17,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, {  2,   0}, {  1,   4},  /* Row 126 */
-  {  4,   3}, {  1,   6}, { 16,   3}, {  1,  11}, {  5,  10}, { 14,  12}, {  5,  10}, {  1,  11},
-  {  7,   6}, { 12,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, {  4,   0},
-  {  4,  10}, {  8,  12}, {  5,  10}, {  1,  14}, {  6,   2}, {  1,  17}, { 16,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, {  3,   0}, {  1,   4},  /* Row 127 */
-  {  4,   3}, {  1,   6}, { 15,   3}, {  1,  13}, {  1,  12}, {  4,  10}, { 14,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  1,   5}, { 11,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3},
-  {  1,   4}, {  5,   0}, {  1,   9}, {  4,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  1,  18},
-  {  6,   2}, { 16,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, {  4,   0}, {  1,   4},  /* Row 128 */
-  {  4,   3}, {  1,   6}, { 15,   3}, {  1,  11}, {  5,  10}, { 12,  12}, {  5,  10}, {  1,  11},
-  {  7,   6}, { 11,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, {  7,   0},
-  {  4,  10}, {  8,  12}, {  5,  10}, {  1,  14}, {  6,   2}, {  1,  17}, { 15,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, {  5,   0}, {  1,   4},  /* Row 129 */
-  {  4,   3}, {  1,   6}, { 14,   3}, {  1,  13}, {  1,  12}, {  4,  10}, { 12,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  1,   5}, { 10,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3},
-  {  1,   4}, {  8,   0}, {  1,   9}, {  4,  10}, {  8,  12}, {  4,  10}, {  1,  12}, {  1,  18},
-  {  6,   2}, { 15,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, {  6,   0}, {  1,   4},  /* Row 130 */
-  {  4,   3}, {  1,   6}, { 14,   3}, {  1,  11}, {  5,  10}, { 10,  12}, {  5,  10}, {  1,  11},
-  {  7,   6}, { 10,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 10,   0},
-  {  4,  10}, {  8,  12}, {  5,  10}, {  1,  14}, {  6,   2}, {  1,  26}, { 14,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, {  7,   0}, {  1,   4},  /* Row 131 */
-  {  4,   3}, {  1,   6}, { 13,   3}, {  1,  13}, {  1,  12}, {  4,  10}, { 10,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  1,   5}, {  9,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3},
-  {  1,   4}, { 11,   0}, {  1,   9}, {  4,  10}, {  8,  12}, {  4,  10}, {  1,  14}, {  6,   2},
-  {  1,  17}, { 14,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, {  8,   0}, {  1,   4},  /* Row 132 */
-  {  4,   3}, {  1,   6}, { 13,   3}, {  1,  11}, {  5,  10}, {  8,  12}, {  5,  10}, {  1,  11},
-  {  7,   6}, {  9,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 13,   0},
-  {  4,  10}, {  8,  12}, {  4,  10}, {  1,  14}, {  7,   2}, { 14,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, {  9,   0}, {  1,   4},  /* Row 133 */
-  {  4,   3}, {  1,   6}, { 12,   3}, {  1,  13}, {  1,  12}, {  4,  10}, {  8,  12}, {  4,  10},
-  {  1,  12}, {  7,   6}, {  1,   5}, {  8,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3},
-  {  1,   4}, { 14,   0}, {  1,   9}, {  4,  10}, {  7,  12}, {  3,  10}, {  1,  12}, {  1,  19},
-  {  7,   2}, {  1,  26}, { 13,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, { 10,   0}, {  1,   4},  /* Row 134 */
-  {  4,   3}, {  1,   6}, { 12,   3}, {  1,  11}, {  5,  10}, {  6,  12}, {  5,  10}, {  1,  11},
-  {  7,   6}, {  8,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 16,   0},
-  {  4,  10}, {  6,  12}, {  4,  10}, {  1,  12}, {  8,   2}, {  1,  17}, { 13,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, { 11,   0}, {  1,   4},  /* Row 135 */
-  {  4,   3}, {  1,   6}, { 11,   3}, {  1,  13}, {  1,  12}, {  5,  10}, {  4,  12}, {  5,  10},
-  {  1,  12}, {  7,   6}, {  1,   5}, {  7,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3},
-  {  1,   4}, { 17,   0}, {  1,   9}, {  4,  10}, {  4,  12}, {  5,  10}, {  1,  14}, {  8,   2},
-  {  1,  17}, { 13,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, { 12,   0}, {  1,   4},  /* Row 136 */
-  {  4,   3}, {  1,   6}, { 11,   3}, {  1,  11}, { 14,  10}, {  1,  11}, {  7,   6}, {  7,   3},
-  {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 19,   0}, { 12,  10}, {  1,  12},
-  {  1,  18}, {  8,   2}, {  1,   1}, { 13,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, { 13,   0}, {  1,   4},  /* Row 137 */
-  {  4,   3}, {  1,   6}, { 10,   3}, {  1,  13}, {  1,  12}, { 12,  10}, {  1,  12}, {  7,   6},
-  {  1,   5}, {  6,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 20,   0},
-  {  1,   9}, { 10,  10}, {  1,  12}, { 10,   2}, { 14,   0},
-  { 18,   0}, {  4,  10}, {  8,  12}, {  3,  10}, {  1,  12}, {  7,   2}, { 14,   0}, {  1,   4},  /* Row 138 */
-  {  4,   3}, {  1,   6}, { 10,   3}, {  1,  11}, { 12,  10}, {  1,  11}, {  7,   6}, {  6,   3},
-  {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 22,   0}, {  9,  10}, {  1,  12},
-  { 10,   2}, {  1,  17}, { 14,   0},
-  { 18,   0}, {  4,  10}, { 12,  12}, {  7,   2}, { 15,   0}, {  1,   4}, {  4,   3}, {  1,   6},  /* Row 139 */
-  {  9,   3}, {  1,   5}, {  1,  15}, { 10,  10}, {  1,  15}, {  7,   6}, {  1,   5}, {  5,   3},
-  {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 23,   0}, {  1,  17}, {  1,  14},
-  {  5,  10}, {  1,  12}, {  1,  10}, {  1,  19}, { 10,   2}, { 15,   0},
-  { 25,   0}, {  1,  20}, {  4,  18}, { 11,   2}, { 16,   0}, {  1,   4}, {  4,   3}, {  1,   6},  /* Row 140 */
-  {  9,   3}, {  1,   5}, {  1,  11}, {  1,  12}, {  6,  10}, {  1,  12}, {  1,  11}, {  8,   6},
-  {  5,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 27,   0}, {  2,   9},
-  {  1,  19}, {  1,  14}, {  1,  18}, { 11,   2}, {  1,  17}, { 15,   0},
-  { 25,   0}, { 16,   2}, { 17,   0}, {  1,   4}, {  4,   3}, {  1,   6}, { 10,   3}, {  1,  13},  /* Row 141 */
-  {  1,  11}, {  4,  12}, {  1,  11}, {  9,   6}, {  5,   3}, {  1,   7}, {  1,   2}, {  1,   5},
-  {  1,   3}, {  1,   4}, { 30,   0}, {  1,   1}, { 13,   2}, { 16,   0},
-  { 25,   0}, { 16,   2}, { 18,   0}, {  1,   4}, {  4,   3}, {  1,   6}, { 11,   3}, {  1,   5},  /* Row 142 */
-  {  1,  13}, { 11,   6}, {  5,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4},
-  { 32,   0}, {  1,  17}, { 11,   2}, { 17,   0},
-  { 25,   0}, { 16,   2}, { 19,   0}, {  1,   4}, {  4,   3}, {  1,   6}, { 13,   3}, {  1,   5},  /* Row 143 */
-  {  7,   6}, {  6,   3}, {  1,   7}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 34,   0},
-  { 10,   2}, { 18,   0},
-  { 25,   0}, { 16,   2}, { 20,   0}, {  1,   4}, {  4,   3}, {  1,   6}, { 25,   3}, {  1,   7},  /* Row 144 */
-  {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 35,   0}, {  1,   1}, {  7,   2}, {  1,  17},
-  { 19,   0},
-  { 25,   0}, { 16,   2}, { 21,   0}, {  1,   4}, {  4,   3}, {  1,   6}, { 23,   3}, {  1,   7},  /* Row 145 */
-  {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 64,   0},
-  { 25,   0}, { 16,   2}, { 22,   0}, {  1,   4}, {  4,   3}, {  1,   6}, { 21,   3}, {  1,   7},  /* Row 146 */
-  {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 65,   0},
-  { 64,   0}, {  1,   4}, {  4,   3}, {  1,   6}, { 19,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 147 */
-  {  1,   3}, {  1,   4}, { 66,   0},
-  { 65,   0}, {  1,   4}, {  4,   3}, {  1,   6}, { 17,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 148 */
-  {  1,   3}, {  1,   4}, { 67,   0},
-  { 66,   0}, {  1,   4}, {  4,   3}, {  1,   6}, { 15,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 149 */
-  {  1,   3}, {  1,   4}, { 68,   0},
-  { 67,   0}, {  1,   4}, {  4,   3}, {  1,   6}, { 13,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 150 */
-  {  1,   3}, {  1,   4}, { 69,   0},
-  { 68,   0}, {  1,   4}, {  4,   3}, {  1,   6}, { 11,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 151 */
-  {  1,   3}, {  1,   4}, { 70,   0},
-  { 69,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  9,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 152 */
-  {  1,   3}, {  1,   4}, { 71,   0},
-  { 70,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  7,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 153 */
-  {  1,   3}, {  1,   4}, { 72,   0},
-  { 71,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  5,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 154 */
-  {  1,   3}, {  1,   4}, { 73,   0},
-  { 72,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  3,   3}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 155 */
-  {  1,   3}, {  1,   4}, { 74,   0},
-  { 73,   0}, {  1,   4}, {  4,   3}, {  1,   6}, {  1,   5}, {  1,   7}, {  1,   2}, {  1,   5},  /* Row 156 */
-  {  1,   3}, {  1,   4}, { 75,   0},
-  { 74,   0}, {  1,   4}, {  5,   3}, {  1,   2}, {  1,   5}, {  1,   3}, {  1,   4}, { 76,   0},  /* Row 157 */
-  { 75,   0}, {  1,   4}, {  2,   3}, {  1,   5}, {  1,  20}, {  1,   5}, {  1,   3}, {  1,   4},  /* Row 158 */
-  { 77,   0},
-  { 76,   0}, {  1,   4}, {  4,   3}, {  1,   4}, { 78,   0}                                       /* Row 159 */
+      0,    11,    23,    39,    58,    80,   102,   124,   146,   168,                             /* Rows 0-9 */
+    190,   212,   234,   256,   278,   300,   322,   344,   366,   396,                             /* Rows 10-19 */
+    430,   468,   516,   560,   613,   670,   731,   796,   864,   929,                             /* Rows 20-29 */
+    996,  1061,  1130,  1192,  1257,  1317,  1374,  1428,  1478,  1526,                             /* Rows 30-39 */
+   1572,  1620,  1666,  1714,  1760,  1812,  1862,  1918,  1972,  2028,                             /* Rows 40-49 */
+   2083,  2143,  2200,  2257,  2310,  2367,  2422,  2478,  2535,  2596,                             /* Rows 50-59 */
+   2656,  2725,  2790,  2862,  2932,  3006,  3078,  3155,  3232,  3313,                             /* Rows 60-69 */
+   3390,  3471,  3548,  3629,  3706,  3783,  3855,  3930,  3999,  4070,                             /* Rows 70-79 */
+   4137,  4206,  4274,  4341,  4413,  4483,  4557,  4628,  4702,  4773,                             /* Rows 80-89 */
+   4851,  4926,  5004,  5079,  5155,  5225,  5297,  5363,  5435,  5498,                             /* Rows 90-99 */
+   5563,  5622,  5681,  5737,  5796,  5852,  5907,  5961,  6015,  6069,                             /* Rows 100-109 */
+   6126,  6183,  6238,  6291,  6345,  6398,  6452,  6505,  6552,  6599,                             /* Rows 110-119 */
+   6649,  6701,  6756,  6810,  6866,  6921,  6982,  7040,  7102,  7160,                             /* Rows 120-129 */
+   7222,  7280,  7343,  7399,  7463,  7521,  7584,  7635,  7688,  7738,                             /* Rows 130-139 */
+   7790,  7841,  7880,  7915,  7947,  7977,  7999,  8021,  8039,  8057,                             /* Rows 140-149 */
+   8075,  8093,  8111,  8129,  8147,  8165,  8183,  8199,  8212,  8226                              /* Rows 150-159 */
 };
 
 #  endif
@@ -3461,6 +3212,17 @@ static const struct pix_run_s g_nuttx[] =
 # error "Unsupported pixel format"
 #endif
 
+/* The image is run-length encoded one row at a time */
+
+static const struct blit_rleimage_s g_nuttx =
+{
+  IMAGE_WIDTH, IMAGE_HEIGHT, g_nuttx_rows, g_nuttx_data
+};
+
+/* The pixel codes of the row being scaled */
+
+static uint8_t g_codes[IMAGE_WIDTH];
+
 /********************************************************************************************
  * Public Data
  ********************************************************************************************/
@@ -3469,6 +3231,31 @@ static const struct pix_run_s g_nuttx[] =
  * Private Functions
  ********************************************************************************************/
 
+/********************************************************************************************
+ * Name: nximage_fillrun
+ *
+ * Description:
+ *   Fill a run of pixels with one color.
+ *
+ ********************************************************************************************/
+
+static inline void nximage_fillrun(FAR nxgl_mxpixel_t *run, unsigned int nrun,
+                                   nxgl_mxpixel_t color)
+{
+  if (sizeof(nxgl_mxpixel_t) == sizeof(uint32_t))
+    {
+      blit_fill32(run, 0, nrun, 1, (uint32_t)color);
+    }
+  else if (sizeof(nxgl_mxpixel_t) == sizeof(uint16_t))
+    {
+      blit_fill16(run, 0, nrun, 1, (uint16_t)color);
+    }
+  else
+    {
+      blit_fill8(run, 0, nrun, 1, (uint8_t)color);
+    }
+}
+
 /********************************************************************************************
  * Public Functions
  ********************************************************************************************/
@@ -3642,43 +3429,109 @@ nxgl_mxpixel_t nximage_avgcolor(nxgl_mxpixel_t color1, nxgl_mxpixel_t color2)
 #endif /* CONFIG_EXAMPLES_NXIMAGE_GREYSCALE */
 }
 
+/********************************************************************************************
+ * Name: nximage_avgrow
+ *
+ * Description:
+ *   Average two rows of pixels, leaving the result in the first row.  RGB565 and RGB888
+ *   rows are averaged a word at a time.
+ *
+ ********************************************************************************************/
+
+void nximage_avgrow(FAR nxgl_mxpixel_t *row0, FAR const nxgl_mxpixel_t *row1,
+                    unsigned int npixels)
+{
+  unsigned int i;
+
+#ifndef CONFIG_EXAMPLES_NXIMAGE_GREYSCALE
+#if CONFIG_EXAMPLES_NXIMAGE_BPP == 16
+  if (sizeof(nxgl_mxpixel_t) == sizeof(uint16_t))
+    {
+      blit_average16((FAR uint16_t *)row0, (FAR const uint16_t *)row1, npixels);
+      return;
+    }
+#elif CONFIG_EXAMPLES_NXIMAGE_BPP == 24
+  if (sizeof(nxgl_mxpixel_t) == sizeof(uint32_t))
+    {
+      blit_average32((FAR uint32_t *)row0, (FAR const uint32_t *)row1, npixels);
+      return;
+    }
+#endif
+#endif
+
+  for (i = 0; i < npixels; i++)
+    {
+      /* Only average if the corresponding pixels in each row differ */
+
+      if (row0[i] != row1[i])
+        {
+          row0[i] = nximage_avgcolor(row0[i], row1[i]);
+        }
+    }
+}
+
 /********************************************************************************************
  * Name: nximage_blitrow
  *
  * Description:
- *   Return the next properly scaled row from the image.
+ *   Return one properly scaled row of the image.
  *
  ********************************************************************************************/
 
-void nximage_blitrow(FAR nxgl_mxpixel_t *run, FAR const void **state)
+void nximage_blitrow(FAR nxgl_mxpixel_t *run, unsigned int row)
 {
-  FAR const struct pix_run_s *pos = *(FAR const struct pix_run_s **)state;
   unsigned int width;
 #if defined(CONFIG_EXAMPLES_NXIMAGE_XSCALEp5) || defined(CONFIG_EXAMPLES_NXIMAGE_XSCALE1p5)
   unsigned int nhalfpixels;
   nxgl_mxpixel_t last;
 #endif
   unsigned int   nrun;
+  unsigned int   x;
   nxgl_mxpixel_t color;
+  uint8_t        code;
+  int            ret;
 
-  /* NULL positional data means to start over */
+#if defined(CONFIG_EXAMPLES_NXIMAGE_XSCALE1p0) && !defined(CONFIG_EXAMPLES_NXIMAGE_GREYSCALE)
+  /* Unscaled RGB565 and RGB888 rows are decoded straight into the run */
 
-  if (!pos)
+#if CONFIG_EXAMPLES_NXIMAGE_BPP == 16
+  if (sizeof(nxgl_mxpixel_t) == sizeof(uint16_t))
+    {
+      ret = blit_rleexpand16(&g_nuttx, row, (FAR uint16_t *)run,
+                             (FAR const uint16_t *)g_lut);
+      ASSERT(ret == OK);
+      return;
+    }
+#elif CONFIG_EXAMPLES_NXIMAGE_BPP == 24
+  if (sizeof(nxgl_mxpixel_t) == sizeof(uint32_t))
     {
-      pos = g_nuttx;
+      ret = blit_rleexpand32(&g_nuttx, row, (FAR uint32_t *)run,
+                             (FAR const uint32_t *)g_lut);
+      ASSERT(ret == OK);
+      return;
     }
+#endif
+#endif
+
+  /* Otherwise, decode the pixel codes of the row */
+
+  ret = blit_rledecode(&g_nuttx, row, g_codes);
+  ASSERT(ret == OK);
 
-  /* Process each run-length encoded pixel in the image */
+  /* Process each run of identical pixels in the row */
 
 #if defined(CONFIG_EXAMPLES_NXIMAGE_XSCALEp5) || defined(CONFIG_EXAMPLES_NXIMAGE_XSCALE1p5)
   nhalfpixels = 0;
   last        = nximage_bgcolor();
 #endif
 
-  for (width = 0; width < SCALED_WIDTH; pos++)
+  for (x = 0, width = 0; x < IMAGE_WIDTH; )
     {
-      nrun  = (unsigned int)pos->npix;
-      color = g_lut[pos->code];
+      code = g_codes[x];
+      for (nrun = 1; x + nrun < IMAGE_WIDTH && g_codes[x + nrun] == code; nrun++);
+
+      x    += nrun;
+      color = g_lut[code];
 
 #if defined(CONFIG_EXAMPLES_NXIMAGE_XSCALEp5) || defined(CONFIG_EXAMPLES_NXIMAGE_XSCALE1p5)
       nhalfpixels += nrun & 1;
@@ -3698,14 +3551,9 @@ void nximage_blitrow(FAR nxgl_mxpixel_t *run, FAR const void **state)
       nrun <<= 1;
 #endif
       width += nrun;
-      while (nrun-- > 0)
-        {
-          *run++ = color;
-        }
+      nximage_fillrun(run, nrun, color);
+      run   += nrun;
     }
-  ASSERT(width == SCALED_WIDTH);
 
-  /* Save the start of the next row and return success */
-
-  *state = (FAR const void *)pos;
+  ASSERT(width == SCALED_WIDTH);
 }
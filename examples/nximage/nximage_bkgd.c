@@ -274,15 +274,11 @@ static void nximage_kbdin(NXWINDOW hwnd, uint8_t nch, FAR const uint8_t *ch,
 
 void nximage_image(NXWINDOW hwnd)
 {
-  FAR const void *state = NULL;
   FAR struct nxgl_point_s pos;
   FAR struct nxgl_rect_s dest;
   FAR const void *src[CONFIG_NX_NPLANES];
   nxgl_coord_t row;
   int ret;
-#if defined(CONFIG_EXAMPLES_NXIMAGE_YSCALEp5) || defined(CONFIG_EXAMPLES_NXIMAGE_YSCALE1p5)
-  int i;
-#endif
 
   /* Center the image.  Note: these may extend off the display. */
 
@@ -300,9 +296,9 @@ void nximage_image(NXWINDOW hwnd)
     {
       /* Read input row(s) */
 
-     nximage_blitrow(g_runs[0].run, &state);
+     nximage_blitrow(g_runs[0].run, row);
 #if NINPUT_ROWS > 1
-     nximage_blitrow(g_runs[1].run, &state);
+     nximage_blitrow(g_runs[1].run, row + 1);
 #endif
 
       /* Output rows before averaging */
@@ -335,17 +331,7 @@ void nximage_image(NXWINDOW hwnd)
 
       /* Average row[0] and row[1], output results in row[0] */
 
-      for (i = 0; i < SCALED_WIDTH; i++)
-        {
-          /* Only average if the corresponding pixels in each row differ */
-
-          nxgl_mxpixel_t pix0 = g_runs[0].run[i];
-          nxgl_mxpixel_t pix1 = g_runs[1].run[i];
-          if (pix0 != pix1)
-            {
-              g_runs[0].run[i] = nximage_avgcolor(pix0, pix1);
-            }
-        }
+      nximage_avgrow(g_runs[0].run, g_runs[1].run, SCALED_WIDTH);
 
 #endif
 
@@ -40,9 +40,11 @@
 #include <nuttx/config.h>
 
 #include <sys/ioctl.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include <signal.h>
 #include <fcntl.h>
 #include <time.h>
@@ -77,6 +79,24 @@
 
 #define FUDGE_FACTOR 10
 
+/* Number of most recent latencies kept for the percentiles of -n */
+
+#ifndef CONFIG_EXAMPLES_ONESHOT_JITTER_RING
+#  define CONFIG_EXAMPLES_ONESHOT_JITTER_RING 256
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define ONESHOT_CLOCK CLOCK_MONOTONIC
+#else
+#  define ONESHOT_CLOCK CLOCK_REALTIME
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static int32_t g_latency[CONFIG_EXAMPLES_ONESHOT_JITTER_RING];
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -87,17 +107,142 @@
 
 static void show_usage(FAR const char *progname)
 {
-  fprintf(stderr, "USAGE: %s [-d <usecs>] [<devname>]\n", progname);
+  fprintf(stderr, "USAGE: %s [-d <usecs>] [-n <count>] [<devname>]\n",
+          progname);
   fprintf(stderr, "Where:\n");
   fprintf(stderr, "\t-d <usecs>:\n");
   fprintf(stderr, "\tSpecifies the oneshot delay in microseconds.  Default %ld\n",
           (unsigned long)CONFIG_EXAMPLES_ONESHOT_DELAY);
+  fprintf(stderr, "\t-n <count>:\n");
+  fprintf(stderr, "\tStart the oneshot <count> times and report the "
+          "latency statistics\n");
   fprintf(stderr, "\t<devname>:\n");
   fprintf(stderr, "\tSpecifies the path to the oneshot driver.  Default %s\n",
           CONFIG_EXAMPLES_ONESHOT_DEVNAME);
   exit(EXIT_FAILURE);
 }
 
+/****************************************************************************
+ * Name: oneshot_usec
+ ****************************************************************************/
+
+static int64_t oneshot_usec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(ONESHOT_CLOCK, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * Name: oneshot_compare
+ ****************************************************************************/
+
+static int oneshot_compare(FAR const void *a, FAR const void *b)
+{
+  int32_t x = *(FAR const int32_t *)a;
+  int32_t y = *(FAR const int32_t *)b;
+
+  return x < y ? -1 : x > y ? 1 : 0;
+}
+
+/****************************************************************************
+ * Name: oneshot_jitter
+ *
+ * Description:
+ *   Start the oneshot 'count' times and measure how late each expiry is
+ *   seen: the time sigwaitinfo() returns less the time of OSIOC_START plus
+ *   the delay.  This includes the interrupt, signal and context switch
+ *   latency; a negative value means the timer expired early.
+ *
+ ****************************************************************************/
+
+static int oneshot_jitter(int fd, unsigned long usecs, unsigned long count)
+{
+  struct oneshot_start_s start;
+  struct timespec res;
+  sigset_t set;
+  int64_t total = 0;
+  int64_t due;
+  int32_t lat;
+  int32_t min = INT32_MAX;
+  int32_t max = INT32_MIN;
+  unsigned long i;
+  size_t n;
+  int ret;
+
+  sigemptyset(&set);
+  sigaddset(&set, CONFIG_EXAMPLES_ONESHOT_SIGNO);
+  (void)sigprocmask(SIG_BLOCK, &set, NULL);
+
+  start.pid        = 0;
+  start.signo      = CONFIG_EXAMPLES_ONESHOT_SIGNO;
+  start.arg        = NULL;
+  start.ts.tv_sec  = usecs / 1000000;
+  start.ts.tv_nsec = (usecs % 1000000) * 1000;
+
+  (void)clock_getres(ONESHOT_CLOCK, &res);
+  printf("Measuring %lu oneshots of %lu us, clock resolution %lu ns\n",
+         count, usecs, (unsigned long)res.tv_nsec);
+
+  for (i = 0; i < count; i++)
+    {
+      due = oneshot_usec() + usecs;
+      ret = ioctl(fd, OSIOC_START, (unsigned long)((uintptr_t)&start));
+      if (ret < 0)
+        {
+          fprintf(stderr, "ERROR: Failed to start the oneshot: %d\n",
+                  errno);
+          break;
+        }
+
+      while ((ret = sigwaitinfo(&set, NULL)) < 0 && errno == EINTR)
+        {
+        }
+
+      lat = (int32_t)(oneshot_usec() - due);
+      if (ret < 0)
+        {
+          fprintf(stderr, "ERROR: sigwaitinfo failed: %d\n", errno);
+          break;
+        }
+
+      g_latency[i % CONFIG_EXAMPLES_ONESHOT_JITTER_RING] = lat;
+      total += lat;
+
+      if (lat < min)
+        {
+          min = lat;
+        }
+
+      if (lat > max)
+        {
+          max = lat;
+        }
+    }
+
+  (void)sigprocmask(SIG_UNBLOCK, &set, NULL);
+
+  if (i == 0)
+    {
+      return EXIT_FAILURE;
+    }
+
+  n = i < CONFIG_EXAMPLES_ONESHOT_JITTER_RING ?
+      i : CONFIG_EXAMPLES_ONESHOT_JITTER_RING;
+  qsort(g_latency, n, sizeof(int32_t), oneshot_compare);
+
+  printf("Latency over %lu oneshots: min %ld max %ld mean %ld us\n",
+         i, (long)min, (long)max, (long)(total / (int64_t)i));
+  printf("Last %lu oneshots: p50 %ld p90 %ld p99 %ld p99.9 %ld us\n",
+         (unsigned long)n, (long)g_latency[(n - 1) * 50 / 100],
+         (long)g_latency[(n - 1) * 90 / 100],
+         (long)g_latency[(n - 1) * 99 / 100],
+         (long)g_latency[(n - 1) * 999 / 1000]);
+
+  return i < count ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -114,48 +259,45 @@ int oneshot_main(int argc, char *argv[])
 {
   FAR const char *devname = CONFIG_EXAMPLES_ONESHOT_DEVNAME;
   unsigned long usecs = CONFIG_EXAMPLES_ONESHOT_DELAY;
+  unsigned long count = 0;
   unsigned long secs;
   struct oneshot_start_s start;
   struct timespec ts;
   uint64_t maxus;
   sigset_t set;
+  int option;
   int ret;
   int fd;
 
-  /* USAGE: nsh> oneshot [-d <usecs>] [<devname>] */
+  /* USAGE: nsh> oneshot [-d <usecs>] [-n <count>] [<devname>] */
 
-  if (argc > 1)
+  while ((option = getopt(argc, argv, "d:n:")) != ERROR)
     {
-      if (argc == 2)
+      switch (option)
         {
-          /* FORM: nsh> oneshot [<devname>] */
-
-          devname = argv[1];
+          case 'd':
+            usecs = strtoul(optarg, NULL, 10);
+            break;
+
+          case 'n':
+            count = strtoul(optarg, NULL, 10);
+            break;
+
+          default:
+            fprintf(stderr, "ERROR: Unrecognized option\n");
+            show_usage(argv[0]);
+            break;
         }
-      else if (argc < 5)
-        {
-          /* FORM: nsh> oneshot [-d <usecs>] */
-
-          if (strcmp(argv[1], "-d") != 0)
-            {
-              fprintf(stderr, "ERROR: Unrecognized option: %s\n", argv[1]);
-              show_usage(argv[0]);
-            }
-
-          usecs = strtoul(argv[2], NULL, 10);
+    }
 
-          if (argc == 4)
-            {
-              /* FORM: nsh> oneshot [-d <usecs>] [<devname>] */
-          
-              devname = argv[3];
-            }
-        }
-      else
-        {
-          fprintf(stderr, "ERROR: Unsupported number of arguments: %d\n", argc);
-          show_usage(argv[0]);
-        }
+  if (optind < argc - 1)
+    {
+      fprintf(stderr, "ERROR: Unsupported number of arguments: %d\n", argc);
+      show_usage(argv[0]);
+    }
+  else if (optind == argc - 1)
+    {
+      devname = argv[optind];
     }
 
   /* Open the oneshot device */
@@ -181,10 +323,26 @@ int oneshot_main(int argc, char *argv[])
       return EXIT_FAILURE;
     }
 
-  maxus = (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000;
+  maxus = (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
 
   printf("Maximum delay is %llu\n", maxus);
 
+  if (count > 0)
+    {
+      if (usecs >= maxus)
+        {
+          fprintf(stderr, "ERROR: -n needs a delay below the maximum\n");
+          ret = EXIT_FAILURE;
+        }
+      else
+        {
+          ret = oneshot_jitter(fd, usecs, count);
+        }
+
+      close(fd);
+      return ret;
+    }
+
   /* Loop waiting until the full delay expires */
 
   while (usecs > 0)
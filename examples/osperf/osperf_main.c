@@ -0,0 +1,847 @@
+/****************************************************************************
+ * apps/examples/osperf/osperf_main.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include <errno.h>
+
+#ifndef CONFIG_DISABLE_MQUEUE
+#  include <mqueue.h>
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_OSPERF_ITERATIONS
+#  define CONFIG_EXAMPLES_OSPERF_ITERATIONS 1000
+#endif
+
+#ifndef CONFIG_EXAMPLES_OSPERF_CPUMHZ
+#  define CONFIG_EXAMPLES_OSPERF_CPUMHZ 0
+#endif
+
+#ifndef CONFIG_EXAMPLES_OSPERF_MSGSIZE
+#  define CONFIG_EXAMPLES_OSPERF_MSGSIZE 16
+#endif
+
+#ifndef CONFIG_EXAMPLES_OSPERF_TIMERPERIOD
+#  define CONFIG_EXAMPLES_OSPERF_TIMERPERIOD 10000
+#endif
+
+#ifndef CONFIG_EXAMPLES_OSPERF_STACKSIZE
+#  define CONFIG_EXAMPLES_OSPERF_STACKSIZE 2048
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define OSPERF_CLOCK CLOCK_MONOTONIC
+#else
+#  define OSPERF_CLOCK CLOCK_REALTIME
+#endif
+
+#define OSPERF_MQNAME    "osperf"
+#define OSPERF_MQDEPTH   8
+#define OSPERF_SIGPING   SIGUSR1
+#define OSPERF_SIGPONG   SIGUSR2
+#define OSPERF_SIGTIMER  17
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct osperf_test_s
+{
+  FAR const char *name;
+  FAR const char *unit;              /* What one operation is */
+  CODE int (*run)(int iterations);   /* Returns the operations done */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int osperf_sem_run(int iterations);
+static int osperf_mutex_run(int iterations);
+static int osperf_rwlock_run(int iterations);
+static int osperf_sempp_run(int iterations);
+static int osperf_mutexc_run(int iterations);
+static int osperf_cond_run(int iterations);
+#ifndef CONFIG_DISABLE_MQUEUE
+static int osperf_mqueue_run(int iterations);
+#endif
+#ifndef CONFIG_DISABLE_SIGNALS
+static int osperf_signal_run(int iterations);
+#endif
+#if !defined(CONFIG_DISABLE_SIGNALS) && !defined(CONFIG_DISABLE_POSIX_TIMERS)
+static int osperf_timer_run(int iterations);
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The uncontended tests come first, the ones that switch contexts follow.
+ * They mirror the scenarios of the corresponding examples/ostest tests.
+ */
+
+static const struct osperf_test_s g_tests[] =
+{
+  { "sem",     "wait+post",   osperf_sem_run    },
+  { "mutex",   "lock+unlock", osperf_mutex_run  },
+  { "rwlock",  "rd+wr lock",  osperf_rwlock_run },
+  { "sempp",   "switch",      osperf_sempp_run  },
+  { "mutexc",  "handoff",     osperf_mutexc_run },
+  { "cond",    "round trip",  osperf_cond_run   },
+#ifndef CONFIG_DISABLE_MQUEUE
+  { "mqueue",  "message",     osperf_mqueue_run },
+#endif
+#ifndef CONFIG_DISABLE_SIGNALS
+  { "signal",  "round trip",  osperf_signal_run },
+#endif
+#if !defined(CONFIG_DISABLE_SIGNALS) && !defined(CONFIG_DISABLE_POSIX_TIMERS)
+  { "timer",   "expiration",  osperf_timer_run  },
+#endif
+  { NULL,      NULL,          NULL              }
+};
+
+/* State shared with the partner thread of a test */
+
+static int g_iterations;
+static sem_t g_ping;
+static sem_t g_pong;
+static pthread_mutex_t g_mutex;
+static pthread_cond_t g_cond;
+static volatile int g_turn;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: osperf_nsec
+ ****************************************************************************/
+
+static uint64_t osperf_nsec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(OSPERF_CLOCK, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/****************************************************************************
+ * Name: osperf_partner
+ *
+ * Description:
+ *   Start the partner thread of a test, one priority level above the
+ *   caller so that it runs as soon as it is ready.
+ *
+ ****************************************************************************/
+
+static int osperf_partner(FAR pthread_t *thread,
+                          CODE pthread_startroutine_t entry)
+{
+  struct sched_param sparam;
+  pthread_attr_t attr;
+  int ret;
+
+  (void)sched_getparam(0, &sparam);
+  sparam.sched_priority++;
+
+  pthread_attr_init(&attr);
+  pthread_attr_setschedparam(&attr, &sparam);
+  pthread_attr_setstacksize(&attr, CONFIG_EXAMPLES_OSPERF_STACKSIZE);
+
+  ret = pthread_create(thread, &attr, entry, NULL);
+  pthread_attr_destroy(&attr);
+
+  if (ret != 0)
+    {
+      printf("ERROR: pthread_create failed: %d\n", ret);
+      return -ret;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: osperf_sem_run
+ ****************************************************************************/
+
+static int osperf_sem_run(int iterations)
+{
+  sem_t sem;
+  int i;
+
+  sem_init(&sem, 0, 0);
+  for (i = 0; i < iterations; i++)
+    {
+      sem_post(&sem);
+      sem_wait(&sem);
+    }
+
+  sem_destroy(&sem);
+  return iterations;
+}
+
+/****************************************************************************
+ * Name: osperf_mutex_run
+ ****************************************************************************/
+
+static int osperf_mutex_run(int iterations)
+{
+  int i;
+
+  for (i = 0; i < iterations; i++)
+    {
+      pthread_mutex_lock(&g_mutex);
+      pthread_mutex_unlock(&g_mutex);
+    }
+
+  return iterations;
+}
+
+/****************************************************************************
+ * Name: osperf_rwlock_run
+ ****************************************************************************/
+
+static int osperf_rwlock_run(int iterations)
+{
+  pthread_rwlock_t rwlock;
+  int i;
+
+  pthread_rwlock_init(&rwlock, NULL);
+  for (i = 0; i < iterations; i++)
+    {
+      pthread_rwlock_rdlock(&rwlock);
+      pthread_rwlock_unlock(&rwlock);
+      pthread_rwlock_wrlock(&rwlock);
+      pthread_rwlock_unlock(&rwlock);
+    }
+
+  pthread_rwlock_destroy(&rwlock);
+  return iterations;
+}
+
+/****************************************************************************
+ * Name: osperf_sempp_run
+ *
+ * Description:
+ *   Ping-pong between two threads on two semaphores.  Every round trip
+ *   makes two context switches.
+ *
+ ****************************************************************************/
+
+static FAR void *osperf_sempp_partner(FAR void *arg)
+{
+  int i;
+
+  for (i = 0; i < g_iterations; i++)
+    {
+      sem_wait(&g_ping);
+      sem_post(&g_pong);
+    }
+
+  return NULL;
+}
+
+static int osperf_sempp_run(int iterations)
+{
+  pthread_t thread;
+  int ret;
+  int i;
+
+  sem_init(&g_ping, 0, 0);
+  sem_init(&g_pong, 0, 0);
+
+  ret = osperf_partner(&thread, osperf_sempp_partner);
+  if (ret >= 0)
+    {
+      for (i = 0; i < iterations; i++)
+        {
+          sem_post(&g_ping);
+          sem_wait(&g_pong);
+        }
+
+      pthread_join(thread, NULL);
+      ret = 2 * iterations;
+    }
+
+  sem_destroy(&g_ping);
+  sem_destroy(&g_pong);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: osperf_mutexc_run
+ *
+ * Description:
+ *   The partner blocks on the mutex that this thread holds, and gets it
+ *   when it is unlocked.  Each handoff includes the contended lock and
+ *   unlock paths (and priority inheritance, if enabled) and four context
+ *   switches.
+ *
+ ****************************************************************************/
+
+static FAR void *osperf_mutexc_partner(FAR void *arg)
+{
+  int i;
+
+  for (i = 0; i < g_iterations; i++)
+    {
+      sem_wait(&g_ping);
+      pthread_mutex_lock(&g_mutex);
+      pthread_mutex_unlock(&g_mutex);
+    }
+
+  return NULL;
+}
+
+static int osperf_mutexc_run(int iterations)
+{
+  pthread_t thread;
+  int ret;
+  int i;
+
+  sem_init(&g_ping, 0, 0);
+
+  ret = osperf_partner(&thread, osperf_mutexc_partner);
+  if (ret >= 0)
+    {
+      for (i = 0; i < iterations; i++)
+        {
+          pthread_mutex_lock(&g_mutex);
+          sem_post(&g_ping);
+          pthread_mutex_unlock(&g_mutex);
+        }
+
+      pthread_join(thread, NULL);
+      ret = iterations;
+    }
+
+  sem_destroy(&g_ping);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: osperf_cond_run
+ *
+ * Description:
+ *   Ping-pong between two threads on a condition variable.
+ *
+ ****************************************************************************/
+
+static FAR void *osperf_cond_partner(FAR void *arg)
+{
+  int i;
+
+  pthread_mutex_lock(&g_mutex);
+  for (i = 0; i < g_iterations; i++)
+    {
+      while (g_turn == 0)
+        {
+          pthread_cond_wait(&g_cond, &g_mutex);
+        }
+
+      g_turn = 0;
+      pthread_cond_signal(&g_cond);
+    }
+
+  pthread_mutex_unlock(&g_mutex);
+  return NULL;
+}
+
+static int osperf_cond_run(int iterations)
+{
+  pthread_t thread;
+  int ret;
+  int i;
+
+  g_turn = 0;
+  pthread_cond_init(&g_cond, NULL);
+
+  ret = osperf_partner(&thread, osperf_cond_partner);
+  if (ret >= 0)
+    {
+      pthread_mutex_lock(&g_mutex);
+      for (i = 0; i < iterations; i++)
+        {
+          g_turn = 1;
+          pthread_cond_signal(&g_cond);
+          while (g_turn != 0)
+            {
+              pthread_cond_wait(&g_cond, &g_mutex);
+            }
+        }
+
+      pthread_mutex_unlock(&g_mutex);
+      pthread_join(thread, NULL);
+      ret = iterations;
+    }
+
+  pthread_cond_destroy(&g_cond);
+  return ret;
+}
+
+#ifndef CONFIG_DISABLE_MQUEUE
+/****************************************************************************
+ * Name: osperf_mqueue_run
+ *
+ * Description:
+ *   Stream messages to a receiver of the same priority, so that the
+ *   sender fills the queue before the receiver drains it, and the cost of
+ *   the context switches is shared by OSPERF_MQDEPTH messages.
+ *
+ ****************************************************************************/
+
+static FAR void *osperf_mqueue_partner(FAR void *arg)
+{
+  char buffer[CONFIG_EXAMPLES_OSPERF_MSGSIZE];
+  mqd_t mqd = (mqd_t)arg;
+  int i;
+
+  for (i = 0; i < g_iterations; i++)
+    {
+      if (mq_receive(mqd, buffer, CONFIG_EXAMPLES_OSPERF_MSGSIZE, NULL) < 0)
+        {
+          break;
+        }
+    }
+
+  return NULL;
+}
+
+static int osperf_mqueue_run(int iterations)
+{
+  char buffer[CONFIG_EXAMPLES_OSPERF_MSGSIZE];
+  struct sched_param sparam;
+  struct mq_attr attr;
+  pthread_attr_t pattr;
+  pthread_t thread;
+  mqd_t mqd;
+  int ret;
+  int i;
+
+  attr.mq_maxmsg  = OSPERF_MQDEPTH;
+  attr.mq_msgsize = CONFIG_EXAMPLES_OSPERF_MSGSIZE;
+  attr.mq_flags   = 0;
+
+  mqd = mq_open(OSPERF_MQNAME, O_RDWR | O_CREAT, 0666, &attr);
+  if (mqd == (mqd_t)-1)
+    {
+      printf("ERROR: mq_open failed: %d\n", errno);
+      return -errno;
+    }
+
+  (void)sched_getparam(0, &sparam);
+  pthread_attr_init(&pattr);
+  pthread_attr_setschedparam(&pattr, &sparam);
+  pthread_attr_setstacksize(&pattr, CONFIG_EXAMPLES_OSPERF_STACKSIZE);
+
+  ret = pthread_create(&thread, &pattr, osperf_mqueue_partner,
+                       (pthread_addr_t)mqd);
+  pthread_attr_destroy(&pattr);
+
+  if (ret != 0)
+    {
+      printf("ERROR: pthread_create failed: %d\n", ret);
+      ret = -ret;
+    }
+  else
+    {
+      memset(buffer, 0xa5, CONFIG_EXAMPLES_OSPERF_MSGSIZE);
+      for (i = 0; i < iterations; i++)
+        {
+          if (mq_send(mqd, buffer, CONFIG_EXAMPLES_OSPERF_MSGSIZE, 0) < 0)
+            {
+              break;
+            }
+        }
+
+      pthread_join(thread, NULL);
+      ret = i;
+    }
+
+  mq_close(mqd);
+  mq_unlink(OSPERF_MQNAME);
+  return ret;
+}
+#endif
+
+#ifndef CONFIG_DISABLE_SIGNALS
+/****************************************************************************
+ * Name: osperf_signal_run
+ *
+ * Description:
+ *   Ping-pong between two threads that wait for blocked signals with
+ *   sigwaitinfo().
+ *
+ ****************************************************************************/
+
+static pthread_t g_mainthread;
+
+static FAR void *osperf_signal_partner(FAR void *arg)
+{
+  sigset_t set;
+  int i;
+
+  sigemptyset(&set);
+  sigaddset(&set, OSPERF_SIGPING);
+  (void)sigprocmask(SIG_BLOCK, &set, NULL);
+  sem_post(&g_pong);
+
+  for (i = 0; i < g_iterations; i++)
+    {
+      if (sigwaitinfo(&set, NULL) < 0)
+        {
+          break;
+        }
+
+      pthread_kill(g_mainthread, OSPERF_SIGPONG);
+    }
+
+  return NULL;
+}
+
+static int osperf_signal_run(int iterations)
+{
+  pthread_t thread;
+  sigset_t oset;
+  sigset_t set;
+  int ret;
+  int i;
+
+  sigemptyset(&set);
+  sigaddset(&set, OSPERF_SIGPONG);
+  (void)sigprocmask(SIG_BLOCK, &set, &oset);
+
+  g_mainthread = pthread_self();
+  sem_init(&g_pong, 0, 0);
+
+  ret = osperf_partner(&thread, osperf_signal_partner);
+  if (ret >= 0)
+    {
+      /* Wait until the partner has blocked its signal */
+
+      sem_wait(&g_pong);
+
+      for (i = 0; i < iterations; i++)
+        {
+          pthread_kill(thread, OSPERF_SIGPING);
+          if (sigwaitinfo(&set, NULL) < 0)
+            {
+              break;
+            }
+        }
+
+      pthread_join(thread, NULL);
+      ret = i;
+    }
+
+  sem_destroy(&g_pong);
+  (void)sigprocmask(SIG_SETMASK, &oset, NULL);
+  return ret;
+}
+#endif
+
+#if !defined(CONFIG_DISABLE_SIGNALS) && !defined(CONFIG_DISABLE_POSIX_TIMERS)
+/****************************************************************************
+ * Name: osperf_timer_run
+ *
+ * Description:
+ *   Wait for the expirations of a periodic timer, as posixtimer.c in
+ *   ostest does, and print how far the intervals between the wakeups
+ *   stray from the period.  The time per expiration is the period itself;
+ *   the jitter is the result.
+ *
+ ****************************************************************************/
+
+static int osperf_timer_run(int iterations)
+{
+  struct itimerspec its;
+  struct sigevent sigev;
+  sigset_t oset;
+  sigset_t set;
+  timer_t timerid;
+  uint64_t period = CONFIG_EXAMPLES_OSPERF_TIMERPERIOD * 1000ull;
+  uint64_t last;
+  uint64_t now;
+  int64_t dev;
+  int64_t mindev = INT64_MAX;
+  int64_t maxdev = INT64_MIN;
+  uint64_t sumdev = 0;
+  int ret;
+  int i;
+
+  sigemptyset(&set);
+  sigaddset(&set, OSPERF_SIGTIMER);
+  (void)sigprocmask(SIG_BLOCK, &set, &oset);
+
+  memset(&sigev, 0, sizeof(struct sigevent));
+  sigev.sigev_notify          = SIGEV_SIGNAL;
+  sigev.sigev_signo           = OSPERF_SIGTIMER;
+  sigev.sigev_value.sival_int = 0;
+
+  ret = timer_create(CLOCK_REALTIME, &sigev, &timerid);
+  if (ret < 0)
+    {
+      ret = -errno;
+      printf("ERROR: timer_create failed: %d\n", ret);
+      goto errout;
+    }
+
+  its.it_value.tv_sec     = CONFIG_EXAMPLES_OSPERF_TIMERPERIOD / 1000000;
+  its.it_value.tv_nsec    = (CONFIG_EXAMPLES_OSPERF_TIMERPERIOD % 1000000) *
+                            1000;
+  its.it_interval.tv_sec  = its.it_value.tv_sec;
+  its.it_interval.tv_nsec = its.it_value.tv_nsec;
+
+  ret = timer_settime(timerid, 0, &its, NULL);
+  if (ret < 0)
+    {
+      ret = -errno;
+      printf("ERROR: timer_settime failed: %d\n", ret);
+      goto errout_with_timer;
+    }
+
+  /* The first expiration only starts the measurement */
+
+  if (sigwaitinfo(&set, NULL) < 0)
+    {
+      ret = -errno;
+      goto errout_with_timer;
+    }
+
+  last = osperf_nsec();
+  for (i = 0; i < iterations; i++)
+    {
+      if (sigwaitinfo(&set, NULL) < 0)
+        {
+          break;
+        }
+
+      now  = osperf_nsec();
+      dev  = (int64_t)(now - last) - (int64_t)period;
+      last = now;
+
+      if (dev < mindev)
+        {
+          mindev = dev;
+        }
+
+      if (dev > maxdev)
+        {
+          maxdev = dev;
+        }
+
+      sumdev += dev < 0 ? -dev : dev;
+    }
+
+  ret = i;
+  if (i > 0)
+    {
+      printf("%-10s period %lu us, interval error min %ld us max %ld us "
+             "mean |error| %lu us\n", "timer",
+             (unsigned long)CONFIG_EXAMPLES_OSPERF_TIMERPERIOD,
+             (long)(mindev / 1000), (long)(maxdev / 1000),
+             (unsigned long)(sumdev / i / 1000));
+    }
+
+errout_with_timer:
+  timer_delete(timerid);
+
+errout:
+  (void)sigprocmask(SIG_SETMASK, &oset, NULL);
+  return ret;
+}
+#endif
+
+/****************************************************************************
+ * Name: osperf_runtest
+ ****************************************************************************/
+
+static int osperf_runtest(FAR const struct osperf_test_s *test,
+                          int iterations)
+{
+  uint64_t start;
+  uint64_t nsecs;
+  unsigned long nsperop;
+  int nops;
+
+  g_iterations = iterations;
+
+  start = osperf_nsec();
+  nops  = test->run(iterations);
+  nsecs = osperf_nsec() - start;
+
+  if (nops <= 0)
+    {
+      printf("%-10s failed\n", test->name);
+      return ERROR;
+    }
+
+  nsperop = (unsigned long)(nsecs / nops);
+  printf("%-10s %-12s %8d %10lu ", test->name, test->unit, nops, nsperop);
+
+  if (CONFIG_EXAMPLES_OSPERF_CPUMHZ > 0)
+    {
+      printf("%10lu\n", nsperop * CONFIG_EXAMPLES_OSPERF_CPUMHZ / 1000);
+    }
+  else
+    {
+      printf("%10s\n", "-");
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: osperf_showusage
+ ****************************************************************************/
+
+static void osperf_showusage(FAR const char *progname, int exitcode)
+{
+  int i;
+
+  fprintf(stderr, "USAGE: %s [-n <iterations>] [<test> ...]\n", progname);
+  fprintf(stderr, "\nWhere:\n");
+  fprintf(stderr, "\t-n <iterations>: Operations per test.  "
+                  "Default: %d\n", CONFIG_EXAMPLES_OSPERF_ITERATIONS);
+  fprintf(stderr, "\t<test>: Run only the named tests:");
+  for (i = 0; g_tests[i].name != NULL; i++)
+    {
+      fprintf(stderr, " %s", g_tests[i].name);
+    }
+
+  fprintf(stderr, "\n\nEach line shows the time of one operation, and the "
+                  "cycles with\nCONFIG_EXAMPLES_OSPERF_CPUMHZ.  The timer "
+                  "test runs <iterations> periods\nand prints the error "
+                  "of the intervals between its expirations.\n");
+  exit(exitcode);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: osperf_main
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int osperf_main(int argc, char *argv[])
+#endif
+{
+  int iterations = CONFIG_EXAMPLES_OSPERF_ITERATIONS;
+  int nfailed = 0;
+  int option;
+  int i;
+  int j;
+
+  while ((option = getopt(argc, argv, ":hn:")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'h':
+            osperf_showusage(argv[0], EXIT_SUCCESS);
+            break;
+
+          case 'n':
+            iterations = atoi(optarg);
+            if (iterations < 1)
+              {
+                fprintf(stderr, "ERROR: Bad iteration count: %s\n", optarg);
+                osperf_showusage(argv[0], EXIT_FAILURE);
+              }
+            break;
+
+          case ':':
+            fprintf(stderr, "ERROR: Missing required argument\n");
+            osperf_showusage(argv[0], EXIT_FAILURE);
+            break;
+
+          case '?':
+          default:
+            fprintf(stderr, "ERROR: Unrecognized option\n");
+            osperf_showusage(argv[0], EXIT_FAILURE);
+            break;
+        }
+    }
+
+  pthread_mutex_init(&g_mutex, NULL);
+
+  printf("%-10s %-12s %8s %10s %10s\n", "Test", "Operation", "Ops",
+         "ns/op", "cyc/op");
+
+  for (i = 0; g_tests[i].name != NULL; i++)
+    {
+      for (j = optind; j < argc && strcmp(argv[j], g_tests[i].name) != 0;
+           j++)
+        {
+        }
+
+      if (optind < argc && j >= argc)
+        {
+          continue;
+        }
+
+      if (osperf_runtest(&g_tests[i], iterations) < 0)
+        {
+          nfailed++;
+        }
+    }
+
+  pthread_mutex_destroy(&g_mutex);
+  return nfailed > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
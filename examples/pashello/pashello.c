@@ -41,9 +41,10 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 #include <debug.h>
 
-#include "interpreters/prun.h"
+#include "system/prun.h"
 
 #include "pashello.h"
 
@@ -59,6 +60,10 @@
 # define CONFIG_EXAMPLES_PASHELLO_STRSTACKSIZE 128
 #endif
 
+#ifndef CONFIG_EXAMPLES_PASHELLO_ITERATIONS
+# define CONFIG_EXAMPLES_PASHELLO_ITERATIONS 1
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -81,21 +86,41 @@ int main(int argc, FAR char *argv[])
 int pashello_main(int argc, FAR char *argv[])
 #endif
 {
+  struct timespec start;
+  struct timespec end;
+  unsigned long usec;
   int exitcode = EXIT_SUCCESS;
   int ret;
+  int i;
 
   /* Register the /dev/hello driver */
 
   hello_register();
 
-  /* Execute the POFF file */
+  /* Execute the POFF file.  Running it more than once times the load and
+   * execution by the P-Code interpreter.
+   */
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (i = 0; i < CONFIG_EXAMPLES_PASHELLO_ITERATIONS; i++)
+    {
+      ret = prun("/dev/hello", CONFIG_EXAMPLES_PASHELLO_VARSTACKSIZE,
+                 CONFIG_EXAMPLES_PASHELLO_STRSTACKSIZE);
+      if (ret < 0)
+        {
+          fprintf(stderr, "pashello_main: ERROR: Execution failed\n");
+          exitcode = EXIT_FAILURE;
+          break;
+        }
+    }
 
-  ret = prun("/dev/hello", CONFIG_EXAMPLES_PASHELLO_VARSTACKSIZE,
-             CONFIG_EXAMPLES_PASHELLO_STRSTACKSIZE);
-  if (ret < 0)
+  if (CONFIG_EXAMPLES_PASHELLO_ITERATIONS > 1 && i > 0)
     {
-      fprintf(stderr, "pashello_main: ERROR: Execution failed\n");
-      exitcode = EXIT_FAILURE;
+      clock_gettime(CLOCK_MONOTONIC, &end);
+      usec = (end.tv_sec - start.tv_sec) * 1000000 +
+             (end.tv_nsec - start.tv_nsec) / 1000;
+      printf("pashello_main: %d runs in %lu us, %lu us per run\n",
+             i, usec, usec / i);
     }
 
   printf("pashello_main: Interpreter terminated");
@@ -0,0 +1,185 @@
+/****************************************************************************
+ * examples/pipe/nshpipe_test.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <poll.h>
+#include <errno.h>
+
+#include "pipe.h"
+
+#ifdef HAVE_NSHPIPE_TEST
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The NSH command line of the test.  echo is an NSH command and "pipe -c"
+ * is this example started again as a builtin that counts its input.
+ */
+
+#define NSHPIPE_TEXT    "0123456789"
+#define NSHPIPE_CMDLINE "echo " NSHPIPE_TEXT " | pipe -c"
+#define NSHPIPE_NBYTES  (sizeof(NSHPIPE_TEXT))   /* The text and a newline */
+
+/* The reader gives up if there is neither data nor the end of file for
+ * this many milliseconds.
+ */
+
+#define NSHPIPE_TIMEOUT 5000
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nshpipe_reader
+ *
+ * Description:
+ *   The second stage of the pipeline:  Count the bytes on standard input
+ *   up to the end of file and save the count in NSHPIPE_RESULT, or -1 if
+ *   the end of file never came.
+ *
+ ****************************************************************************/
+
+int nshpipe_reader(void)
+{
+  struct pollfd fds;
+  char buffer[32];
+  ssize_t nread;
+  FILE *stream;
+  int nbytes = 0;
+  int ret;
+
+  for (; ; )
+    {
+      fds.fd      = 0;
+      fds.events  = POLLIN;
+      fds.revents = 0;
+
+      ret = poll(&fds, 1, NSHPIPE_TIMEOUT);
+      if (ret == 0)
+        {
+          fprintf(stderr, "nshpipe_reader: No end of file after %d bytes\n",
+                  nbytes);
+          nbytes = -1;
+          break;
+        }
+
+      nread = read(0, buffer, sizeof(buffer));
+      if (nread < 0 && errno != EINTR)
+        {
+          fprintf(stderr, "nshpipe_reader: read failed: %d\n", errno);
+          nbytes = -1;
+          break;
+        }
+      else if (nread == 0)
+        {
+          break;
+        }
+      else if (nread > 0)
+        {
+          nbytes += nread;
+        }
+    }
+
+  stream = fopen(NSHPIPE_RESULT, "w");
+  if (stream == NULL)
+    {
+      fprintf(stderr, "nshpipe_reader: Failed to open %s: %d\n",
+              NSHPIPE_RESULT, errno);
+      return 1;
+    }
+
+  fprintf(stream, "%d\n", nbytes);
+  fclose(stream);
+  return nbytes < 0 ? 1 : 0;
+}
+
+/****************************************************************************
+ * Name: nshpipe_test
+ *
+ * Description:
+ *   Pipe the output of an NSH command into a builtin application and check
+ *   that the builtin receives all of it followed by the end of file.
+ *
+ ****************************************************************************/
+
+int nshpipe_test(void)
+{
+  FILE *stream;
+  int nbytes;
+
+  (void)unlink(NSHPIPE_RESULT);
+
+  printf("nshpipe_test: Running \"%s\"\n", NSHPIPE_CMDLINE);
+  (void)system(NSHPIPE_CMDLINE);
+
+  stream = fopen(NSHPIPE_RESULT, "r");
+  if (stream == NULL)
+    {
+      fprintf(stderr, "nshpipe_test: The reader left no result: %d\n",
+              errno);
+      return 1;
+    }
+
+  if (fscanf(stream, "%d", &nbytes) != 1)
+    {
+      nbytes = -1;
+    }
+
+  fclose(stream);
+  (void)unlink(NSHPIPE_RESULT);
+
+  if (nbytes != (int)NSHPIPE_NBYTES)
+    {
+      fprintf(stderr, "nshpipe_test: The reader got %d bytes, expected %d\n",
+              nbytes, (int)NSHPIPE_NBYTES);
+      return 2;
+    }
+
+  printf("nshpipe_test: The reader got %d bytes and the end of file\n",
+         nbytes);
+  return 0;
+}
+
+#endif /* HAVE_NSHPIPE_TEST */
@@ -51,6 +51,16 @@
 #define FIFO_PATH1 "/tmp/testfifo-1"
 #define FIFO_PATH2 "/tmp/testfifo-2"
 
+/* The NSH pipeline test runs NSH through system() and needs this example
+ * to be a builtin application.
+ */
+
+#if defined(CONFIG_NSH_PIPES) && defined(CONFIG_NSH_BUILTIN_APPS) && \
+    defined(CONFIG_SYSTEM_SYSTEM)
+#  define HAVE_NSHPIPE_TEST 1
+#  define NSHPIPE_RESULT "/tmp/nshpipe-result"
+#endif
+
 #ifndef CONFIG_EXAMPLES_PIPE_STACKSIZE
 #  define CONFIG_EXAMPLES_PIPE_STACKSIZE 1024
 #endif
@@ -70,5 +80,9 @@
 extern int transfer_test(int fdin, int fdout);
 extern int interlock_test(void);
 extern int redirection_test(void);
+#ifdef HAVE_NSHPIPE_TEST
+extern int nshpipe_reader(void);
+extern int nshpipe_test(void);
+#endif
 
 #endif /* __EXAMPLES_PIPE_PIPE_H */
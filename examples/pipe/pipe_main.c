@@ -41,6 +41,7 @@
 
 #include <sys/stat.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <sched.h>
 #include <fcntl.h>
@@ -67,6 +68,15 @@ int pipe_main(int argc, char *argv[])
   int ret;
 #endif
 
+#ifdef HAVE_NSHPIPE_TEST
+  /* "pipe -c" is the reader of the NSH pipeline test */
+
+  if (argc > 1 && strcmp(argv[1], "-c") == 0)
+    {
+      return nshpipe_reader();
+    }
+#endif
+
 #if CONFIG_DEV_FIFO_SIZE > 0
   /* Test FIFO logic */
 
@@ -197,6 +207,19 @@ int pipe_main(int argc, char *argv[])
 
 #endif /* CONFIG_DEV_PIPE_SIZE > 0 */
 
+#ifdef HAVE_NSHPIPE_TEST
+  /* Pipe an NSH command into a builtin application */
+
+  printf("\npipe_main: Performing NSH pipeline test\n");
+  if (nshpipe_test() != 0)
+    {
+      fprintf(stderr, "pipe_main: NSH pipeline test FAILED\n");
+      return 8;
+    }
+
+  printf("pipe_main: NSH pipeline test PASSED\n");
+#endif
+
   fflush(stdout);
   return 0;
 }
@@ -0,0 +1,560 @@
+/****************************************************************************
+ * examples/poll/poll_bench.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/select.h>
+#include <sys/time.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <time.h>
+#include <errno.h>
+
+#include "system/benchutil.h"
+
+#include "poll_internal.h"
+
+#ifdef POLL_BENCH_SOCKETS
+#  include <sys/socket.h>
+#  include <netinet/in.h>
+#  include <arpa/inet.h>
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define POLL_BENCH_TIMEOUT 1000  /* msec without an event ends a run */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum poll_bench_method_e
+{
+  POLL_BENCH_POLL = 0,
+  POLL_BENCH_SELECT
+};
+
+/* The event stream of one run.  Descriptor i is read through rdfd[i] and
+ * written through wrfd[i].
+ */
+
+struct poll_bench_s
+{
+  int nfds;
+  int rate;                    /* Events per second */
+  int nevents;                 /* Events per run */
+  FAR int *rdfd;
+  FAR int *wrfd;
+  FAR struct pollfd *pfd;      /* Used by the poll run only */
+};
+
+/* Results of one run */
+
+struct poll_bench_result_s
+{
+  uint32_t nevents;            /* Events received */
+  uint32_t nwakeups;           /* Returns from poll() or select() */
+  uint32_t latmin;             /* Write to read, usec */
+  uint32_t latmax;
+  uint64_t latsum;
+  uint64_t dispatch;           /* Time spent finding and reading events */
+  uint64_t elapsed;
+  int cpuload;                 /* Tenths of a percent, or -1 */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: poll_bench_socketpair
+ *
+ * Description:
+ *   Create a connected pair of TCP sockets over the loopback device.
+ *
+ ****************************************************************************/
+
+#ifdef POLL_BENCH_SOCKETS
+static int poll_bench_socketpair(FAR int *fds)
+{
+  struct sockaddr_in addr;
+  socklen_t addrlen;
+  int listensd;
+  int errcode;
+
+  fds[0] = -1;
+  fds[1] = -1;
+
+  listensd = socket(PF_INET, SOCK_STREAM, 0);
+  if (listensd < 0)
+    {
+      return -errno;
+    }
+
+  memset(&addr, 0, sizeof(struct sockaddr_in));
+  addr.sin_family      = AF_INET;
+  addr.sin_port        = 0;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addrlen              = sizeof(struct sockaddr_in);
+
+  if (bind(listensd, (FAR struct sockaddr *)&addr, addrlen) < 0 ||
+      getsockname(listensd, (FAR struct sockaddr *)&addr, &addrlen) < 0 ||
+      listen(listensd, 1) < 0)
+    {
+      goto errout;
+    }
+
+  fds[1] = socket(PF_INET, SOCK_STREAM, 0);
+  if (fds[1] < 0 ||
+      connect(fds[1], (FAR struct sockaddr *)&addr, addrlen) < 0)
+    {
+      goto errout;
+    }
+
+  fds[0] = accept(listensd, NULL, NULL);
+  if (fds[0] < 0)
+    {
+      goto errout;
+    }
+
+  close(listensd);
+  return OK;
+
+errout:
+  errcode = errno;
+  if (fds[1] >= 0)
+    {
+      close(fds[1]);
+    }
+
+  close(listensd);
+  return -errcode;
+}
+#endif
+
+/****************************************************************************
+ * Name: poll_bench_open
+ *
+ * Description:
+ *   Open nfds event sources.  With network support every other one is a
+ *   TCP connection, the rest are pipes.
+ *
+ ****************************************************************************/
+
+static int poll_bench_open(FAR struct poll_bench_s *bench, int nfds)
+{
+  int fds[2];
+  int ret;
+  int i;
+
+  bench->rdfd = (FAR int *)malloc(2 * nfds * sizeof(int));
+  bench->pfd  = (FAR struct pollfd *)malloc(nfds * sizeof(struct pollfd));
+  if (bench->rdfd == NULL || bench->pfd == NULL)
+    {
+      free(bench->rdfd);
+      free(bench->pfd);
+      return -ENOMEM;
+    }
+
+  bench->wrfd = &bench->rdfd[nfds];
+  bench->nfds = 0;
+
+  for (i = 0; i < nfds; i++)
+    {
+#ifdef POLL_BENCH_SOCKETS
+      if ((i & 1) != 0)
+        {
+          ret = poll_bench_socketpair(fds);
+        }
+      else
+#endif
+        {
+          ret = pipe(fds) < 0 ? -errno : OK;
+        }
+
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      bench->rdfd[i]       = fds[0];
+      bench->wrfd[i]       = fds[1];
+      bench->pfd[i].fd     = fds[0];
+      bench->pfd[i].events = POLLIN;
+      bench->nfds++;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: poll_bench_close
+ ****************************************************************************/
+
+static void poll_bench_close(FAR struct poll_bench_s *bench)
+{
+  int i;
+
+  for (i = 0; i < bench->nfds; i++)
+    {
+      close(bench->rdfd[i]);
+      close(bench->wrfd[i]);
+    }
+
+  free(bench->rdfd);
+  free(bench->pfd);
+  bench->nfds = 0;
+}
+
+/****************************************************************************
+ * Name: poll_bench_maxfd
+ ****************************************************************************/
+
+static int poll_bench_maxfd(FAR struct poll_bench_s *bench)
+{
+  int maxfd = 0;
+  int i;
+
+  for (i = 0; i < bench->nfds; i++)
+    {
+      if (bench->rdfd[i] > maxfd)
+        {
+          maxfd = bench->rdfd[i];
+        }
+    }
+
+  return maxfd;
+}
+
+/****************************************************************************
+ * Name: poll_bench_writer
+ *
+ * Description:
+ *   Write a time stamp to a pseudo-randomly chosen descriptor at the
+ *   requested rate.  Each write is one event.
+ *
+ ****************************************************************************/
+
+static FAR void *poll_bench_writer(pthread_addr_t pvarg)
+{
+  FAR struct poll_bench_s *bench = (FAR struct poll_bench_s *)pvarg;
+  uint64_t start;
+  uint64_t stamp;
+  uint64_t due;
+  uint32_t seed = 1;
+  int i;
+
+  start = benchutil_usec();
+  for (i = 0; i < bench->nevents; i++)
+    {
+      /* Pace against the start time so that late events are made up */
+
+      due   = start + (uint64_t)i * 1000000 / bench->rate;
+      stamp = benchutil_usec();
+      if (stamp < due)
+        {
+          usleep(due - stamp);
+        }
+
+      seed  = seed * 1103515245 + 12345;
+      stamp = benchutil_usec();
+      (void)write(bench->wrfd[(seed >> 16) % bench->nfds], &stamp,
+                  sizeof(stamp));
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: poll_bench_event
+ *
+ * Description:
+ *   Read the time stamps available on a descriptor and account for them.
+ *
+ ****************************************************************************/
+
+static void poll_bench_event(FAR struct poll_bench_result_s *result,
+                             int fd, uint64_t now)
+{
+  uint64_t stamps[8];
+  uint32_t latency;
+  ssize_t nread;
+  int i;
+
+  nread = read(fd, stamps, sizeof(stamps));
+  for (i = 0; i < nread / (ssize_t)sizeof(uint64_t); i++)
+    {
+      latency = (uint32_t)(now - stamps[i]);
+      result->latsum += latency;
+      if (latency < result->latmin)
+        {
+          result->latmin = latency;
+        }
+
+      if (latency > result->latmax)
+        {
+          result->latmax = latency;
+        }
+
+      result->nevents++;
+    }
+}
+
+/****************************************************************************
+ * Name: poll_bench_run
+ *
+ * Description:
+ *   Wait for the events of one run with the given method.  Like a reactor,
+ *   every wakeup scans all descriptors for the ready ones; select() also
+ *   has to rebuild its set each time.
+ *
+ ****************************************************************************/
+
+static int poll_bench_run(FAR struct poll_bench_s *bench,
+                          enum poll_bench_method_e method,
+                          FAR struct poll_bench_result_s *result)
+{
+  struct timeval tv;
+  pthread_t writer;
+  fd_set rdset;
+  uint64_t start;
+  uint64_t woken;
+  FAR void *value;
+  int maxfd;
+  int nready;
+  int ret;
+  int i;
+
+  memset(result, 0, sizeof(struct poll_bench_result_s));
+  result->latmin = UINT32_MAX;
+  maxfd          = poll_bench_maxfd(bench);
+
+  ret = pthread_create(&writer, NULL, poll_bench_writer, bench);
+  if (ret != 0)
+    {
+      return -ret;
+    }
+
+  start = benchutil_usec();
+  while (result->nevents < (uint32_t)bench->nevents)
+    {
+      if (method == POLL_BENCH_POLL)
+        {
+          nready = poll(bench->pfd, bench->nfds, POLL_BENCH_TIMEOUT);
+        }
+      else
+        {
+          FD_ZERO(&rdset);
+          for (i = 0; i < bench->nfds; i++)
+            {
+              FD_SET(bench->rdfd[i], &rdset);
+            }
+
+          tv.tv_sec  = POLL_BENCH_TIMEOUT / 1000;
+          tv.tv_usec = 0;
+          nready     = select(maxfd + 1, &rdset, NULL, NULL, &tv);
+        }
+
+      woken = benchutil_usec();
+      if (nready < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          ret = -errno;
+          break;
+        }
+
+      if (nready == 0)
+        {
+          /* Events were lost */
+
+          break;
+        }
+
+      result->nwakeups++;
+      for (i = 0; i < bench->nfds && nready > 0; i++)
+        {
+          if (method == POLL_BENCH_POLL ?
+              (bench->pfd[i].revents & POLLIN) != 0 :
+              FD_ISSET(bench->rdfd[i], &rdset))
+            {
+              poll_bench_event(result, bench->rdfd[i], woken);
+              nready--;
+            }
+        }
+
+      result->dispatch += benchutil_usec() - woken;
+    }
+
+  result->elapsed = benchutil_usec() - start;
+  result->cpuload = benchutil_cpuload();
+
+  pthread_join(writer, &value);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: poll_bench_report
+ ****************************************************************************/
+
+static void poll_bench_report(int nfds, FAR const char *name,
+                              FAR const struct poll_bench_result_s *result)
+{
+  uint32_t nevents = result->nevents > 0 ? result->nevents : 1;
+  char latency[32];
+
+  snprintf(latency, sizeof(latency), "%lu/%lu/%lu",
+           (unsigned long)(result->nevents > 0 ? result->latmin : 0),
+           (unsigned long)(result->latsum / nevents),
+           (unsigned long)result->latmax);
+
+  printf("%5d %-6s %7lu %7lu %19s %10lu", nfds, name,
+         (unsigned long)result->nevents, (unsigned long)result->nwakeups,
+         latency, (unsigned long)(result->dispatch / nevents));
+
+  /* The CPU load covers the whole system for the length of the run */
+
+  if (result->cpuload >= 0)
+    {
+      printf(" %10lu\n",
+             (unsigned long)(result->elapsed * result->cpuload / 1000 /
+                             nevents));
+    }
+  else
+    {
+      printf(" %10s\n", "n/a");
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: poll_bench
+ *
+ * Description:
+ *   Measure poll() and select() with 1, 2, 4, ... maxfds descriptors and
+ *   nevents events, written at rate events per second.
+ *
+ ****************************************************************************/
+
+int poll_bench(int maxfds, int rate, int nevents)
+{
+  struct poll_bench_result_s result;
+  struct poll_bench_s bench;
+  int nfds;
+  int ret = OK;
+
+  if (maxfds <= 0 || rate <= 0 || nevents <= 0)
+    {
+      return -EINVAL;
+    }
+
+  memset(&bench, 0, sizeof(struct poll_bench_s));
+  bench.rate    = rate;
+  bench.nevents = nevents;
+
+  printf("poll_bench: %d events at %d/sec per run\n", nevents, rate);
+  printf("%5s %-6s %7s %7s %s %10s %10s\n", "Fds", "Method", "Events",
+         "Wakeups", "Latency min/avg/max", "Dispatch", "CPU/event");
+
+  for (nfds = 1; ; nfds <<= 1)
+    {
+      if (nfds > maxfds)
+        {
+          nfds = maxfds;
+        }
+
+      ret = poll_bench_open(&bench, nfds);
+      if (ret < 0)
+        {
+          fprintf(stderr, "poll_bench: Failed to open %d descriptors: %d\n",
+                  nfds, ret);
+          poll_bench_close(&bench);
+          break;
+        }
+
+      ret = poll_bench_run(&bench, POLL_BENCH_POLL, &result);
+      if (ret < 0)
+        {
+          fprintf(stderr, "poll_bench: poll() failed: %d\n", ret);
+        }
+
+      poll_bench_report(nfds, "poll", &result);
+
+      if (poll_bench_maxfd(&bench) >= FD_SETSIZE)
+        {
+          printf("%5d %-6s descriptors exceed FD_SETSIZE\n", nfds, "select");
+        }
+      else
+        {
+          ret = poll_bench_run(&bench, POLL_BENCH_SELECT, &result);
+          if (ret < 0)
+            {
+              fprintf(stderr, "poll_bench: select() failed: %d\n", ret);
+            }
+
+          poll_bench_report(nfds, "select", &result);
+        }
+
+      poll_bench_close(&bench);
+      fflush(stdout);
+
+      if (ret < 0 || nfds >= maxfds)
+        {
+          break;
+        }
+    }
+
+  return ret;
+}
@@ -71,6 +71,28 @@
 #  undef HAVE_NETPOLL
 #endif
 
+/* The benchmark mixes TCP connections over the loopback device in with its
+ * pipes if it can.
+ */
+
+#if defined(HAVE_NETPOLL) && defined(CONFIG_NET_LOOPBACK)
+#  define POLL_BENCH_SOCKETS 1
+#endif
+
+#ifdef CONFIG_EXAMPLES_POLL_BENCH
+#  ifndef CONFIG_EXAMPLES_POLL_BENCH_MAXFDS
+#    define CONFIG_EXAMPLES_POLL_BENCH_MAXFDS 16
+#  endif
+
+#  ifndef CONFIG_EXAMPLES_POLL_BENCH_RATE
+#    define CONFIG_EXAMPLES_POLL_BENCH_RATE 200
+#  endif
+
+#  ifndef CONFIG_EXAMPLES_POLL_BENCH_NEVENTS
+#    define CONFIG_EXAMPLES_POLL_BENCH_NEVENTS 400
+#  endif
+#endif
+
 #define FIFO_PATH1 "/dev/fifo0"
 #define FIFO_PATH2 "/dev/fifo1"
 
@@ -96,6 +118,10 @@
 extern void *poll_listener(pthread_addr_t pvarg);
 extern void *select_listener(pthread_addr_t pvarg);
 
+#ifdef CONFIG_EXAMPLES_POLL_BENCH
+int poll_bench(int maxfds, int rate, int nevents);
+#endif
+
 #ifdef HAVE_NETPOLL
 extern void *net_listener(pthread_addr_t pvarg);
 extern void *net_reader(pthread_addr_t pvarg);
@@ -43,6 +43,7 @@
 #include <sys/stat.h>
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <unistd.h>
 #include <string.h>
 #include <pthread.h>
@@ -96,6 +97,20 @@ int poll_main(int argc, char *argv[])
   int ret;
   int exitcode = 0;
 
+#ifdef CONFIG_EXAMPLES_POLL_BENCH
+  /* Measure poll() and select() instead of the functional test.  The
+   * settings may be overridden by the arguments, if there are any.
+   */
+
+  ret = poll_bench(argc > 1 ? atoi(argv[1]) :
+                              CONFIG_EXAMPLES_POLL_BENCH_MAXFDS,
+                   argc > 2 ? atoi(argv[2]) :
+                              CONFIG_EXAMPLES_POLL_BENCH_RATE,
+                   argc > 3 ? atoi(argv[3]) :
+                              CONFIG_EXAMPLES_POLL_BENCH_NEVENTS);
+  return ret < 0 ? 1 : 0;
+#endif
+
   /* Open FIFOs */
 
   printf("\npoll_main: Creating FIFO %s\n", FIFO_PATH1);
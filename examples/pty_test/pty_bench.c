@@ -0,0 +1,626 @@
+/****************************************************************************
+ * apps/examples/pty_test/pty_bench.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <termios.h>
+#include <time.h>
+#include <errno.h>
+
+#include "system/benchutil.h"
+
+#include "pty_test.h"
+
+#ifdef CONFIG_EXAMPLES_PTYTEST_BENCH
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_DEV_PIPE_SIZE
+#  define CONFIG_DEV_PIPE_SIZE 0
+#endif
+
+/* A transfer that makes no progress for this long has stalled */
+
+#define BENCH_STALL_MSEC  1000
+
+/* Once all data has arrived, wait this long for bytes added by output
+ * processing (e.g. ONLCR).
+ */
+
+#define BENCH_DRAIN_MSEC  50
+
+/* Throughput data is sent as lines of this many bytes, the last one '\n' */
+
+#define BENCH_LINELEN     64
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* A bidirectional path between a "terminal" (the telnet daemon or the
+ * remote console bridge) and a "shell" (NSH) side.  For a pty the terminal
+ * side is the master and the shell side the slave.
+ */
+
+struct bench_path_s
+{
+  FAR const char *name;
+  int twfd;                  /* Terminal side, write */
+  int trfd;                  /* Terminal side, read */
+  int swfd;                  /* Shell side, write */
+  int srfd;                  /* Shell side, read */
+};
+
+struct bench_writer_s
+{
+  int fd;
+  size_t nbytes;
+  size_t wrsize;
+  int errcode;
+};
+
+struct bench_echo_s
+{
+  int rfd;
+  int wfd;
+  volatile bool stop;
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static int bench_compare(FAR const void *a, FAR const void *b)
+{
+  uint32_t x = *(FAR const uint32_t *)a;
+  uint32_t y = *(FAR const uint32_t *)b;
+
+  return x < y ? -1 : x > y;
+}
+
+/****************************************************************************
+ * Name: bench_setmode
+ *
+ * Description:
+ *   Put the slave of a pty in raw mode (no processing at all) or in cooked
+ *   mode: line buffered input with CR to NL mapping and NL to CR-NL output
+ *   mapping, as a telnet session to NSH uses it.  Echo is off in both
+ *   modes; NSH's readline echoes by itself, which the echo thread models.
+ *
+ ****************************************************************************/
+
+static int bench_setmode(int fd, bool cooked)
+{
+#ifdef CONFIG_SERIAL_TERMIOS
+  struct termios tio;
+
+  if (tcgetattr(fd, &tio) < 0)
+    {
+      return -errno;
+    }
+
+  tio.c_iflag &= ~(ICRNL | INLCR | IGNCR | IXON | IXOFF);
+  tio.c_oflag &= ~(OPOST | ONLCR);
+  tio.c_lflag &= ~(ICANON | ECHO | ECHONL | ISIG);
+#ifdef VMIN
+  tio.c_cc[VMIN]  = 1;
+  tio.c_cc[VTIME] = 0;
+#endif
+
+  if (cooked)
+    {
+      tio.c_iflag |= ICRNL;
+      tio.c_oflag |= OPOST | ONLCR;
+      tio.c_lflag |= ICANON;
+    }
+
+  if (tcsetattr(fd, TCSANOW, &tio) < 0)
+    {
+      return -errno;
+    }
+
+  return OK;
+#else
+  /* Without termios a pty does no processing: it is always raw */
+
+  return cooked ? -ENOSYS : OK;
+#endif
+}
+
+/****************************************************************************
+ * Name: bench_writer
+ *
+ * Description:
+ *   Thread that writes the throughput data.
+ *
+ ****************************************************************************/
+
+static FAR void *bench_writer(FAR void *arg)
+{
+  FAR struct bench_writer_s *wr = (FAR struct bench_writer_s *)arg;
+  FAR char *buffer;
+  size_t remaining = wr->nbytes;
+  size_t pos = 0;
+  size_t chunk;
+  size_t i;
+  ssize_t nwritten;
+
+  buffer = (FAR char *)malloc(wr->wrsize);
+  if (buffer == NULL)
+    {
+      wr->errcode = ENOMEM;
+      return NULL;
+    }
+
+  while (remaining > 0)
+    {
+      chunk = remaining < wr->wrsize ? remaining : wr->wrsize;
+      for (i = 0; i < chunk; i++, pos++)
+        {
+          buffer[i] = (pos % BENCH_LINELEN) == BENCH_LINELEN - 1 ? '\n' :
+                      'a' + pos % 26;
+        }
+
+      nwritten = write(wr->fd, buffer, chunk);
+      if (nwritten < 0)
+        {
+          if (errno == EINTR)
+            {
+              pos -= chunk;
+              continue;
+            }
+
+          wr->errcode = errno;
+          break;
+        }
+
+      /* Regenerate the part of the chunk that was not written */
+
+      pos       -= chunk - nwritten;
+      remaining -= nwritten;
+    }
+
+  free(buffer);
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: bench_echo
+ *
+ * Description:
+ *   Thread standing in for the shell: whatever it reads, it writes back.
+ *
+ ****************************************************************************/
+
+static FAR void *bench_echo(FAR void *arg)
+{
+  FAR struct bench_echo_s *echo = (FAR struct bench_echo_s *)arg;
+  struct pollfd fds;
+  char buffer[64];
+  ssize_t nread;
+
+  fds.fd     = echo->rfd;
+  fds.events = POLLIN;
+
+  while (!echo->stop)
+    {
+      fds.revents = 0;
+      if (poll(&fds, 1, BENCH_DRAIN_MSEC) <= 0)
+        {
+          continue;
+        }
+
+      nread = read(echo->rfd, buffer, sizeof(buffer));
+      if (nread > 0)
+        {
+          (void)write(echo->wfd, buffer, nread);
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: bench_throughput
+ *
+ * Description:
+ *   Send opts->nbytes from wfd and receive it on rfd.  The time runs from
+ *   the start of the writer until the last byte arrives.
+ *
+ ****************************************************************************/
+
+static int bench_throughput(FAR const char *title, int wfd, int rfd,
+                            FAR const struct pty_bench_s *opts)
+{
+  struct bench_writer_s wr;
+  struct pollfd fds;
+  pthread_t writer;
+  FAR char *buffer;
+  uint64_t start;
+  uint64_t last;
+  uint64_t elapsed;
+  size_t received = 0;
+  uint32_t nreads = 0;
+  ssize_t nread;
+  int ret;
+
+  buffer = (FAR char *)malloc(opts->wrsize);
+  if (buffer == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  wr.fd      = wfd;
+  wr.nbytes  = opts->nbytes;
+  wr.wrsize  = opts->wrsize;
+  wr.errcode = 0;
+
+  start = benchutil_usec();
+  last  = start;
+
+  ret = pthread_create(&writer, NULL, bench_writer, &wr);
+  if (ret != 0)
+    {
+      free(buffer);
+      return -ret;
+    }
+
+  fds.fd     = rfd;
+  fds.events = POLLIN;
+
+  for (; ; )
+    {
+      /* Until everything has arrived, a timeout is a stall.  After that,
+       * only collect what output processing may still add.
+       */
+
+      fds.revents = 0;
+      ret = poll(&fds, 1, received < opts->nbytes ? BENCH_STALL_MSEC :
+                                                         BENCH_DRAIN_MSEC);
+      if (ret < 0 && errno == EINTR)
+        {
+          continue;
+        }
+
+      if (ret <= 0)
+        {
+          break;
+        }
+
+      nread = read(rfd, buffer, opts->wrsize);
+      if (nread <= 0)
+        {
+          break;
+        }
+
+      received += nread;
+      nreads++;
+      last      = benchutil_usec();
+    }
+
+  (void)pthread_join(writer, NULL);
+  free(buffer);
+
+  if (wr.errcode != 0)
+    {
+      printf("  %-10s write failed: %d\n", title, wr.errcode);
+      return -wr.errcode;
+    }
+
+  if (received < opts->nbytes)
+    {
+      printf("  %-10s stalled after %lu of %lu bytes\n", title,
+             (unsigned long)received, (unsigned long)opts->nbytes);
+      return -ETIMEDOUT;
+    }
+
+  elapsed = last > start ? last - start : 1;
+  printf("  %-10s %9lu KB/s  %8lu us  %6lu reads of %lu bytes avg\n",
+         title,
+         (unsigned long)((uint64_t)opts->nbytes * 1000000 / 1024 / elapsed),
+         (unsigned long)elapsed, (unsigned long)nreads,
+         (unsigned long)(received / nreads));
+
+  if (received != opts->nbytes)
+    {
+      printf("  %-10s %lu bytes delivered for %lu sent\n", "",
+             (unsigned long)received, (unsigned long)opts->nbytes);
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: bench_latency
+ *
+ * Description:
+ *   Time 'nechoes' round trips of a keystroke from the terminal side to the
+ *   echo thread and back.  In cooked mode a keystroke is a key and Enter,
+ *   since the shell side sees nothing before the end of the line; it is
+ *   complete when the echoed newline arrives.
+ *
+ ****************************************************************************/
+
+static int bench_latency(FAR const struct bench_path_s *path, bool cooked,
+                         FAR const struct pty_bench_s *opts)
+{
+  struct bench_echo_s echo;
+  struct pollfd fds;
+  pthread_t thread;
+  FAR uint32_t *samples;
+  FAR const char *key = cooked ? "k\r" : "k";
+  char last = cooked ? '\n' : 'k';
+  char buffer[16];
+  uint64_t total = 0;
+  uint64_t start;
+  ssize_t nread;
+  uint32_t i;
+  int ret = OK;
+
+  samples = (FAR uint32_t *)malloc(opts->nechoes * sizeof(uint32_t));
+  if (samples == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  echo.rfd  = path->srfd;
+  echo.wfd  = path->swfd;
+  echo.stop = false;
+
+  ret = pthread_create(&thread, NULL, bench_echo, &echo);
+  if (ret != 0)
+    {
+      free(samples);
+      return -ret;
+    }
+
+  fds.fd     = path->trfd;
+  fds.events = POLLIN;
+
+  for (i = 0; i < opts->nechoes && ret == OK; i++)
+    {
+      start = benchutil_usec();
+      if (write(path->twfd, key, strlen(key)) < 0)
+        {
+          ret = -errno;
+          break;
+        }
+
+      /* Read until the last byte of the echo */
+
+      for (; ; )
+        {
+          fds.revents = 0;
+          if (poll(&fds, 1, BENCH_STALL_MSEC) <= 0)
+            {
+              printf("  %-10s no echo after %lu round trips\n", "echo",
+                     (unsigned long)i);
+              ret = -ETIMEDOUT;
+              break;
+            }
+
+          nread = read(path->trfd, buffer, sizeof(buffer));
+          if (nread <= 0)
+            {
+              ret = nread < 0 ? -errno : -EIO;
+              break;
+            }
+
+          if (buffer[nread - 1] == last)
+            {
+              break;
+            }
+        }
+
+      samples[i] = (uint32_t)(benchutil_usec() - start);
+      total     += samples[i];
+    }
+
+  echo.stop = true;
+  (void)pthread_join(thread, NULL);
+
+  if (ret == OK)
+    {
+      qsort(samples, opts->nechoes, sizeof(uint32_t), bench_compare);
+      printf("  %-10s min %lu avg %lu p50 %lu p99 %lu max %lu us\n", "echo",
+             (unsigned long)samples[0],
+             (unsigned long)(total / opts->nechoes),
+             (unsigned long)samples[opts->nechoes / 2],
+             (unsigned long)samples[(opts->nechoes * 99) / 100],
+             (unsigned long)samples[opts->nechoes - 1]);
+    }
+
+  free(samples);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: bench_path
+ *
+ * Description:
+ *   All measurements over one path: output (shell to terminal, e.g. command
+ *   output), input (terminal to shell, e.g. a paste) and echo latency.
+ *
+ ****************************************************************************/
+
+static void bench_path(FAR const struct bench_path_s *path, bool cooked,
+                       FAR const struct pty_bench_s *opts)
+{
+  printf("\n%s%s:\n", path->name,
+         path->twfd == path->trfd ? (cooked ? ", cooked" : ", raw") : "");
+
+  (void)bench_throughput("output", path->swfd, path->trfd, opts);
+  (void)bench_throughput("input", path->twfd, path->srfd, opts);
+  (void)bench_latency(path, cooked, opts);
+}
+
+static int bench_pty(FAR const struct pty_bench_s *opts)
+{
+  struct bench_path_s path;
+  char devname[16];
+  int master;
+  int slave;
+  int ret;
+
+  master = open("/dev/ptmx", O_RDWR | O_NOCTTY);
+  if (master < 0)
+    {
+      fprintf(stderr, "ERROR: Failed to open /dev/ptmx: %d\n", errno);
+      return -errno;
+    }
+
+  if (grantpt(master) < 0 || unlockpt(master) < 0 ||
+      ptsname_r(master, devname, sizeof(devname)) != 0)
+    {
+      ret = -errno;
+      fprintf(stderr, "ERROR: Failed to set up the pty: %d\n", errno);
+      close(master);
+      return ret;
+    }
+
+  slave = open(devname, O_RDWR | O_NOCTTY);
+  if (slave < 0)
+    {
+      ret = -errno;
+      fprintf(stderr, "ERROR: Failed to open %s: %d\n", devname, errno);
+      close(master);
+      return ret;
+    }
+
+  path.name = "pty";
+  path.twfd = master;
+  path.trfd = master;
+  path.swfd = slave;
+  path.srfd = slave;
+
+  ret = bench_setmode(slave, false);
+  if (ret < 0)
+    {
+      fprintf(stderr, "ERROR: Failed to select raw mode: %d\n", ret);
+    }
+  else
+    {
+      bench_path(&path, false, opts);
+    }
+
+  ret = bench_setmode(slave, true);
+  if (ret < 0)
+    {
+      printf("\npty, cooked: not available: %d\n", ret);
+    }
+  else
+    {
+      bench_path(&path, true, opts);
+    }
+
+  close(slave);
+  close(master);
+  return OK;
+}
+
+#if CONFIG_DEV_PIPE_SIZE > 0
+static int bench_pipe(FAR const struct pty_bench_s *opts)
+{
+  struct bench_path_s path;
+  int tosh[2];
+  int toterm[2];
+
+  if (pipe(tosh) < 0)
+    {
+      fprintf(stderr, "ERROR: pipe() failed: %d\n", errno);
+      return -errno;
+    }
+
+  if (pipe(toterm) < 0)
+    {
+      fprintf(stderr, "ERROR: pipe() failed: %d\n", errno);
+      close(tosh[0]);
+      close(tosh[1]);
+      return -errno;
+    }
+
+  path.name = "pipe";
+  path.twfd = tosh[1];
+  path.srfd = tosh[0];
+  path.swfd = toterm[1];
+  path.trfd = toterm[0];
+
+  bench_path(&path, false, opts);
+
+  close(tosh[0]);
+  close(tosh[1]);
+  close(toterm[0]);
+  close(toterm[1]);
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+int pty_bench(FAR const struct pty_bench_s *opts)
+{
+  printf("%lu bytes in writes of %lu, %lu echo round trips\n",
+         (unsigned long)opts->nbytes, (unsigned long)opts->wrsize,
+         (unsigned long)opts->nechoes);
+
+  (void)bench_pty(opts);
+#if CONFIG_DEV_PIPE_SIZE > 0
+  (void)bench_pipe(opts);
+#else
+  printf("\npipe: not available, CONFIG_DEV_PIPE_SIZE is 0\n");
+#endif
+
+  return OK;
+}
+
+#endif /* CONFIG_EXAMPLES_PTYTEST_BENCH */
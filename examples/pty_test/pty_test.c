@@ -38,6 +38,7 @@
  ****************************************************************************/
 
 #include <nuttx/config.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -54,6 +55,8 @@
 
 #include "nshlib/nshlib.h"
 
+#include "pty_test.h"
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -70,6 +73,14 @@
 #  define CONFIG_EXAMPLES_PTYTEST_STACKSIZE 2048
 #endif
 
+#ifndef CONFIG_EXAMPLES_PTYTEST_BENCH_BYTES
+#  define CONFIG_EXAMPLES_PTYTEST_BENCH_BYTES 65536
+#endif
+
+#ifndef CONFIG_EXAMPLES_PTYTEST_BENCH_ECHOES
+#  define CONFIG_EXAMPLES_PTYTEST_BENCH_ECHOES 1000
+#endif
+
 #define POLL_TIMEOUT  200
 
 /****************************************************************************
@@ -244,6 +255,25 @@ static void serial_out(struct term_pair_s *tp)
     }
 }
 
+#ifdef CONFIG_EXAMPLES_PTYTEST_BENCH
+/****************************************************************************
+ * Name: show_usage
+ ****************************************************************************/
+
+static void show_usage(FAR const char *progname)
+{
+  fprintf(stderr, "USAGE: %s [-B [-s bytes] [-w wrsize] [-n echoes]]\n",
+          progname);
+  fprintf(stderr, "  -B  Benchmark the pty and pipes instead of starting "
+          "a console\n");
+  fprintf(stderr, "  -s  Bytes per throughput test (default: %d)\n",
+          CONFIG_EXAMPLES_PTYTEST_BENCH_BYTES);
+  fprintf(stderr, "  -w  Bytes per write (default: 64)\n");
+  fprintf(stderr, "  -n  Echo round trips (default: %d)\n",
+          CONFIG_EXAMPLES_PTYTEST_BENCH_ECHOES);
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -266,6 +296,52 @@ int pty_test_main(int argc, char *argv[])
   pid_t pid;
   int fd_pts;
   int ret;
+#ifdef CONFIG_EXAMPLES_PTYTEST_BENCH
+  struct pty_bench_s bench;
+  bool benchmark = false;
+  int option;
+
+  bench.nbytes  = CONFIG_EXAMPLES_PTYTEST_BENCH_BYTES;
+  bench.wrsize  = 64;
+  bench.nechoes = CONFIG_EXAMPLES_PTYTEST_BENCH_ECHOES;
+
+  while ((option = getopt(argc, argv, "Bs:w:n:")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'B':
+            benchmark = true;
+            break;
+
+          case 's':
+            bench.nbytes = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'w':
+            bench.wrsize = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'n':
+            bench.nechoes = strtoul(optarg, NULL, 0);
+            break;
+
+          default:
+            show_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+  if (bench.nbytes == 0 || bench.wrsize == 0 || bench.nechoes == 0)
+    {
+      show_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+
+  if (benchmark)
+    {
+      return pty_bench(&bench) == OK ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+#endif
 
   printf("Create pseudo-terminal\n");
 
@@ -0,0 +1,908 @@
+/****************************************************************************
+ * apps/examples/serialbench/serialbench_main.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
+#include <crc32.h>
+
+#ifdef CONFIG_SERIAL_TERMIOS
+#  include <termios.h>
+#endif
+
+#include "system/benchutil.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_SERIALBENCH_DEVPATH
+#  define CONFIG_EXAMPLES_SERIALBENCH_DEVPATH "/dev/ttyS1"
+#endif
+
+#ifndef CONFIG_EXAMPLES_SERIALBENCH_BUFSIZE
+#  define CONFIG_EXAMPLES_SERIALBENCH_BUFSIZE 1024
+#endif
+
+#ifndef CONFIG_EXAMPLES_SERIALBENCH_COUNT
+#  define CONFIG_EXAMPLES_SERIALBENCH_COUNT 100
+#endif
+
+#ifndef CONFIG_EXAMPLES_SERIALBENCH_DURATION
+#  define CONFIG_EXAMPLES_SERIALBENCH_DURATION 10
+#endif
+
+#ifndef CONFIG_EXAMPLES_SERIALBENCH_TIMEOUT
+#  define CONFIG_EXAMPLES_SERIALBENCH_TIMEOUT 1000
+#endif
+
+/* Frames of the throughput test:
+ *
+ *   0xa5 0x5a seqno(2, LE) len(2, LE) payload(len) crc32(4, LE)
+ *
+ * The CRC covers the sequence number, the length and the payload.
+ */
+
+#define SERIALBENCH_SYNC1    0xa5
+#define SERIALBENCH_SYNC2    0x5a
+#define SERIALBENCH_HDRLEN   6
+#define SERIALBENCH_CRCLEN   4
+#define SERIALBENCH_OVERHEAD (SERIALBENCH_HDRLEN + SERIALBENCH_CRCLEN)
+
+#define SERIALBENCH_NBUCKETS 12
+
+#define SERIALBENCH_MAXBAUDS 8
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum serialbench_mode_e
+{
+  SERIALBENCH_ECHO = 0,     /* Return everything received */
+  SERIALBENCH_LATENCY,      /* Round trip latency histogram */
+  SERIALBENCH_TX,           /* Send verified frames */
+  SERIALBENCH_RX,           /* Receive and verify frames */
+  SERIALBENCH_SWEEP         /* Latency and throughput per block size */
+};
+
+struct serialbench_s
+{
+  enum serialbench_mode_e mode;
+  FAR const char *devpath;
+  int fd;
+  size_t size;              /* Block or payload size */
+  int count;                /* Round trips per test */
+  int duration;             /* Seconds of the throughput test */
+  int nbauds;               /* Number of baud rates to test */
+  unsigned long bauds[SERIALBENCH_MAXBAUDS];
+  FAR uint8_t *txbuf;
+  FAR uint8_t *rxbuf;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Upper bounds (usec) of the latency histogram buckets.  The last bucket
+ * holds everything slower.
+ */
+
+static const uint32_t g_buckets[SERIALBENCH_NBUCKETS - 1] =
+{
+  100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000
+};
+
+static const size_t g_sweepsizes[] =
+{
+  1, 4, 16, 64, 256, 1024, 4096
+};
+
+#define SERIALBENCH_NSWEEP (sizeof(g_sweepsizes) / sizeof(g_sweepsizes[0]))
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: serialbench_showusage
+ ****************************************************************************/
+
+static void serialbench_showusage(FAR const char *progname)
+{
+  fprintf(stderr, "USAGE: %s [-m <mode>] [-d <devpath>] [-s <size>] "
+          "[-n <count>] [-t <sec>]", progname);
+#ifdef CONFIG_SERIAL_TERMIOS
+  fprintf(stderr, " [-b <baud>[,<baud>...]]");
+#endif
+  fprintf(stderr, "\n");
+  fprintf(stderr, "  -m echo     Return everything received (the peer)\n");
+  fprintf(stderr, "  -m latency  Round trip latency histogram (default)\n");
+  fprintf(stderr, "  -m tx       Send CRC protected frames for -t seconds\n");
+  fprintf(stderr, "  -m rx       Receive and verify frames\n");
+  fprintf(stderr, "  -m sweep    Latency and throughput per block size\n");
+  fprintf(stderr, "  Defaults: -d %s -s %d -n %d -t %d\n",
+          CONFIG_EXAMPLES_SERIALBENCH_DEVPATH,
+          CONFIG_EXAMPLES_SERIALBENCH_BUFSIZE,
+          CONFIG_EXAMPLES_SERIALBENCH_COUNT,
+          CONFIG_EXAMPLES_SERIALBENCH_DURATION);
+}
+
+/****************************************************************************
+ * Name: serialbench_setbaud
+ *
+ * Description:
+ *   Put the device in raw mode and, if baud is not zero, set its speed.
+ *   Devices without termios support (e.g. some USB devices) are used as
+ *   they are.
+ *
+ ****************************************************************************/
+
+static int serialbench_setbaud(FAR struct serialbench_s *priv,
+                               unsigned long baud)
+{
+#ifdef CONFIG_SERIAL_TERMIOS
+  struct termios tio;
+
+  if (tcgetattr(priv->fd, &tio) < 0)
+    {
+      return OK;
+    }
+
+  tio.c_iflag &= ~(ICRNL | INLCR | IGNCR | IXON | IXOFF);
+  tio.c_oflag &= ~OPOST;
+  tio.c_lflag &= ~(ECHO | ECHONL | ICANON | ISIG);
+
+  if (baud > 0 && cfsetspeed(&tio, baud) < 0)
+    {
+      fprintf(stderr, "ERROR: Bad baud rate: %lu\n", baud);
+      return ERROR;
+    }
+
+  if (tcsetattr(priv->fd, TCSANOW, &tio) < 0)
+    {
+      fprintf(stderr, "ERROR: tcsetattr() failed: %d\n", errno);
+      return ERROR;
+    }
+#endif
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: serialbench_write
+ ****************************************************************************/
+
+static int serialbench_write(int fd, FAR const uint8_t *buffer, size_t len)
+{
+  ssize_t nwritten;
+
+  while (len > 0)
+    {
+      nwritten = write(fd, buffer, len);
+      if (nwritten < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          return -errno;
+        }
+
+      buffer += nwritten;
+      len    -= nwritten;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: serialbench_read
+ *
+ * Description:
+ *   Read exactly len bytes, giving up if nothing arrives for the timeout.
+ *
+ ****************************************************************************/
+
+static int serialbench_read(int fd, FAR uint8_t *buffer, size_t len)
+{
+  struct pollfd pfd;
+  ssize_t nread;
+  int ret;
+
+  while (len > 0)
+    {
+      pfd.fd      = fd;
+      pfd.events  = POLLIN;
+      pfd.revents = 0;
+
+      ret = poll(&pfd, 1, CONFIG_EXAMPLES_SERIALBENCH_TIMEOUT);
+      if (ret < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          return -errno;
+        }
+
+      if (ret == 0)
+        {
+          return -ETIMEDOUT;
+        }
+
+      nread = read(fd, buffer, len);
+      if (nread < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          return -errno;
+        }
+
+      if (nread == 0)
+        {
+          return -EPIPE;
+        }
+
+      buffer += nread;
+      len    -= nread;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: serialbench_echo
+ ****************************************************************************/
+
+static int serialbench_echo(FAR struct serialbench_s *priv)
+{
+  ssize_t nread;
+  int ret;
+
+  printf("Echoing %s\n", priv->devpath);
+  fflush(stdout);
+
+  for (; ; )
+    {
+      nread = read(priv->fd, priv->rxbuf, priv->size);
+      if (nread < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          fprintf(stderr, "ERROR: read() failed: %d\n", errno);
+          return ERROR;
+        }
+
+      if (nread == 0)
+        {
+          return OK;
+        }
+
+      ret = serialbench_write(priv->fd, priv->rxbuf, nread);
+      if (ret < 0)
+        {
+          fprintf(stderr, "ERROR: write() failed: %d\n", -ret);
+          return ERROR;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: serialbench_roundtrips
+ *
+ * Description:
+ *   Send count blocks of size bytes, one at a time, and wait for each to
+ *   come back from the echo peer or a loopback plug.  The round trip times
+ *   are added to the histogram, if one is given.
+ *
+ ****************************************************************************/
+
+static int serialbench_roundtrips(FAR struct serialbench_s *priv,
+                                  size_t size, FAR uint32_t *histogram,
+                                  FAR uint64_t *total, FAR uint32_t *minrtt,
+                                  FAR uint32_t *maxrtt)
+{
+  uint64_t start;
+  uint32_t rtt;
+  size_t i;
+  int ret;
+  int n;
+  int b;
+
+  *total  = 0;
+  *minrtt = UINT32_MAX;
+  *maxrtt = 0;
+
+  for (n = 0; n < priv->count; n++)
+    {
+      for (i = 0; i < size; i++)
+        {
+          priv->txbuf[i] = (uint8_t)(n + i);
+        }
+
+      start = benchutil_usec();
+      ret   = serialbench_write(priv->fd, priv->txbuf, size);
+      if (ret >= 0)
+        {
+          ret = serialbench_read(priv->fd, priv->rxbuf, size);
+        }
+
+      if (ret < 0)
+        {
+          fprintf(stderr, "ERROR: Round trip %d failed: %d\n", n, -ret);
+          return ret;
+        }
+
+      rtt = (uint32_t)(benchutil_usec() - start);
+
+      if (memcmp(priv->txbuf, priv->rxbuf, size) != 0)
+        {
+          fprintf(stderr, "ERROR: Round trip %d returned bad data\n", n);
+          return -EIO;
+        }
+
+      *total += rtt;
+      if (rtt < *minrtt)
+        {
+          *minrtt = rtt;
+        }
+
+      if (rtt > *maxrtt)
+        {
+          *maxrtt = rtt;
+        }
+
+      if (histogram != NULL)
+        {
+          for (b = 0; b < SERIALBENCH_NBUCKETS - 1 && rtt >= g_buckets[b];
+               b++);
+
+          histogram[b]++;
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: serialbench_latency
+ ****************************************************************************/
+
+static int serialbench_latency(FAR struct serialbench_s *priv)
+{
+  uint32_t histogram[SERIALBENCH_NBUCKETS];
+  uint64_t total;
+  uint32_t minrtt;
+  uint32_t maxrtt;
+  int ret;
+  int b;
+
+  memset(histogram, 0, sizeof(histogram));
+
+  printf("%d round trips of %lu bytes on %s\n", priv->count,
+         (unsigned long)priv->size, priv->devpath);
+
+  ret = serialbench_roundtrips(priv, priv->size, histogram, &total,
+                               &minrtt, &maxrtt);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  printf("RTT min/avg/max: %lu/%lu/%lu usec\n", (unsigned long)minrtt,
+         (unsigned long)(total / priv->count), (unsigned long)maxrtt);
+
+  for (b = 0; b < SERIALBENCH_NBUCKETS; b++)
+    {
+      if (histogram[b] == 0)
+        {
+          continue;
+        }
+
+      if (b < SERIALBENCH_NBUCKETS - 1)
+        {
+          printf("  < %6lu usec: %6lu (%3lu%%)\n",
+                 (unsigned long)g_buckets[b], (unsigned long)histogram[b],
+                 (unsigned long)histogram[b] * 100 / priv->count);
+        }
+      else
+        {
+          printf("  >=%6lu usec: %6lu (%3lu%%)\n",
+                 (unsigned long)g_buckets[b - 1],
+                 (unsigned long)histogram[b],
+                 (unsigned long)histogram[b] * 100 / priv->count);
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: serialbench_frame
+ *
+ * Description:
+ *   Build the frame with sequence number seqno in txbuf and return its
+ *   length.
+ *
+ ****************************************************************************/
+
+static size_t serialbench_frame(FAR struct serialbench_s *priv,
+                                uint16_t seqno)
+{
+  FAR uint8_t *frame = priv->txbuf;
+  size_t len = priv->size;
+  uint32_t crc;
+  size_t i;
+
+  frame[0] = SERIALBENCH_SYNC1;
+  frame[1] = SERIALBENCH_SYNC2;
+  frame[2] = (uint8_t)seqno;
+  frame[3] = (uint8_t)(seqno >> 8);
+  frame[4] = (uint8_t)len;
+  frame[5] = (uint8_t)(len >> 8);
+
+  for (i = 0; i < len; i++)
+    {
+      frame[SERIALBENCH_HDRLEN + i] = (uint8_t)(seqno + i);
+    }
+
+  crc = crc32(&frame[2], len + SERIALBENCH_HDRLEN - 2);
+  frame += SERIALBENCH_HDRLEN + len;
+  frame[0] = (uint8_t)crc;
+  frame[1] = (uint8_t)(crc >> 8);
+  frame[2] = (uint8_t)(crc >> 16);
+  frame[3] = (uint8_t)(crc >> 24);
+
+  return len + SERIALBENCH_OVERHEAD;
+}
+
+/****************************************************************************
+ * Name: serialbench_tx
+ ****************************************************************************/
+
+static int serialbench_tx(FAR struct serialbench_s *priv)
+{
+  uint64_t start;
+  uint64_t end;
+  uint64_t now;
+  uint64_t nbytes;
+  unsigned long nframes;
+  size_t len;
+  int ret;
+
+  printf("Sending %lu byte frames on %s for %d sec\n",
+         (unsigned long)priv->size, priv->devpath, priv->duration);
+
+  start  = benchutil_usec();
+  end    = start + (uint64_t)priv->duration * 1000000;
+  nbytes  = 0;
+  nframes = 0;
+
+  do
+    {
+      len = serialbench_frame(priv, (uint16_t)nframes++);
+      ret = serialbench_write(priv->fd, priv->txbuf, len);
+      if (ret < 0)
+        {
+          fprintf(stderr, "ERROR: write() failed: %d\n", -ret);
+          return ret;
+        }
+
+      nbytes += len;
+      now     = benchutil_usec();
+    }
+  while (now < end);
+
+  printf("Sent %lu frames, %lu bytes/sec\n", nframes,
+         (unsigned long)(nbytes * 1000000 / (now - start)));
+  return OK;
+}
+
+/****************************************************************************
+ * Name: serialbench_rx
+ *
+ * Description:
+ *   Receive frames until nothing arrives for the timeout, reporting every
+ *   second.  A bad CRC or a gap in the sequence numbers is an error; the
+ *   receiver then resynchronizes on the next sync bytes.  Frames dropped
+ *   for a bad CRC are counted as lost too.
+ *
+ ****************************************************************************/
+
+static int serialbench_rx(FAR struct serialbench_s *priv)
+{
+  FAR uint8_t *frame = priv->rxbuf;
+  unsigned long nframes = 0;
+  unsigned long nbad = 0;
+  unsigned long nlost = 0;
+  uint64_t nbytes = 0;
+  uint64_t start = 0;
+  uint64_t report = 0;
+  uint64_t last = 0;
+  uint16_t expected = 0;
+  uint16_t seqno;
+  uint32_t crc;
+  size_t len;
+  int ret;
+
+  printf("Receiving frames on %s\n", priv->devpath);
+  fflush(stdout);
+
+  for (; ; )
+    {
+      /* Find the sync bytes */
+
+      ret = serialbench_read(priv->fd, frame, 1);
+      if (ret < 0)
+        {
+          break;
+        }
+
+      if (frame[0] != SERIALBENCH_SYNC1)
+        {
+          continue;
+        }
+
+      ret = serialbench_read(priv->fd, &frame[1], SERIALBENCH_HDRLEN - 1);
+      if (ret < 0)
+        {
+          break;
+        }
+
+      if (frame[1] != SERIALBENCH_SYNC2)
+        {
+          continue;
+        }
+
+      seqno = frame[2] | (uint16_t)frame[3] << 8;
+      len   = frame[4] | (size_t)frame[5] << 8;
+      if (len > priv->size)
+        {
+          nbad++;
+          continue;
+        }
+
+      ret = serialbench_read(priv->fd, &frame[SERIALBENCH_HDRLEN],
+                             len + SERIALBENCH_CRCLEN);
+      if (ret < 0)
+        {
+          break;
+        }
+
+      last = benchutil_usec();
+      if (nframes + nbad == 0)
+        {
+          start    = last;
+          report   = last + 1000000;
+          expected = seqno;
+        }
+
+      crc = crc32(&frame[2], len + SERIALBENCH_HDRLEN - 2);
+      if (frame[SERIALBENCH_HDRLEN + len]     != (uint8_t)crc ||
+          frame[SERIALBENCH_HDRLEN + len + 1] != (uint8_t)(crc >> 8) ||
+          frame[SERIALBENCH_HDRLEN + len + 2] != (uint8_t)(crc >> 16) ||
+          frame[SERIALBENCH_HDRLEN + len + 3] != (uint8_t)(crc >> 24))
+        {
+          nbad++;
+          continue;
+        }
+
+      nlost   += (uint16_t)(seqno - expected);
+      expected = seqno + 1;
+      nbytes  += len + SERIALBENCH_OVERHEAD;
+      nframes++;
+
+      if (last >= report)
+        {
+          printf("%6lu bytes/sec, %lu frames, %lu bad, %lu lost\n",
+                 (unsigned long)(nbytes * 1000000 / (last - start)),
+                 nframes, nbad, nlost);
+          fflush(stdout);
+          report += 1000000;
+        }
+    }
+
+  if (nframes > 0 && last > start)
+    {
+      printf("Total: %lu bytes/sec, %lu frames, %lu bad, %lu lost\n",
+             (unsigned long)(nbytes * 1000000 / (last - start)),
+             nframes, nbad, nlost);
+    }
+
+  return nbad + nlost > 0 ? -EIO : OK;
+}
+
+/****************************************************************************
+ * Name: serialbench_sweep
+ ****************************************************************************/
+
+static int serialbench_sweep(FAR struct serialbench_s *priv)
+{
+  uint64_t total;
+  uint32_t minrtt;
+  uint32_t maxrtt;
+  unsigned int i;
+  int b;
+  int ret;
+
+  for (b = 0; b < priv->nbauds || b == 0; b++)
+    {
+      if (priv->nbauds > 0)
+        {
+          ret = serialbench_setbaud(priv, priv->bauds[b]);
+          if (ret < 0)
+            {
+              return ret;
+            }
+
+          printf("\n%lu baud:\n", priv->bauds[b]);
+        }
+
+      printf("%6s %10s %10s %10s %12s\n", "Size", "Min usec", "Avg usec",
+             "Max usec", "Bytes/sec");
+
+      for (i = 0; i < SERIALBENCH_NSWEEP && g_sweepsizes[i] <= priv->size;
+           i++)
+        {
+          ret = serialbench_roundtrips(priv, g_sweepsizes[i], NULL, &total,
+                                       &minrtt, &maxrtt);
+          if (ret < 0)
+            {
+              return ret;
+            }
+
+          printf("%6lu %10lu %10lu %10lu %12lu\n",
+                 (unsigned long)g_sweepsizes[i], (unsigned long)minrtt,
+                 (unsigned long)(total / priv->count),
+                 (unsigned long)maxrtt,
+                 (unsigned long)((uint64_t)g_sweepsizes[i] * priv->count *
+                                 1000000 / (total > 0 ? total : 1)));
+          fflush(stdout);
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: serialbench_getbauds
+ ****************************************************************************/
+
+#ifdef CONFIG_SERIAL_TERMIOS
+static int serialbench_getbauds(FAR struct serialbench_s *priv,
+                                FAR char *arg)
+{
+  FAR char *ptr = arg;
+
+  priv->nbauds = 0;
+  while (*ptr != '\0' && priv->nbauds < SERIALBENCH_MAXBAUDS)
+    {
+      priv->bauds[priv->nbauds] = strtoul(ptr, &ptr, 10);
+      if (priv->bauds[priv->nbauds] == 0)
+        {
+          return ERROR;
+        }
+
+      priv->nbauds++;
+      if (*ptr == ',')
+        {
+          ptr++;
+        }
+    }
+
+  return priv->nbauds > 0 && *ptr == '\0' ? OK : ERROR;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * serialbench_main
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int serialbench_main(int argc, char *argv[])
+#endif
+{
+  struct serialbench_s priv;
+  size_t bufsize;
+  int option;
+  int ret;
+
+  memset(&priv, 0, sizeof(struct serialbench_s));
+  priv.mode     = SERIALBENCH_LATENCY;
+  priv.devpath  = CONFIG_EXAMPLES_SERIALBENCH_DEVPATH;
+  priv.size     = CONFIG_EXAMPLES_SERIALBENCH_BUFSIZE;
+  priv.count    = CONFIG_EXAMPLES_SERIALBENCH_COUNT;
+  priv.duration = CONFIG_EXAMPLES_SERIALBENCH_DURATION;
+  priv.fd       = -1;
+
+  optind = 0;
+  while ((option = getopt(argc, argv, ":m:d:s:n:t:b:")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'm':
+            if (strcmp(optarg, "echo") == 0)
+              {
+                priv.mode = SERIALBENCH_ECHO;
+              }
+            else if (strcmp(optarg, "latency") == 0)
+              {
+                priv.mode = SERIALBENCH_LATENCY;
+              }
+            else if (strcmp(optarg, "tx") == 0)
+              {
+                priv.mode = SERIALBENCH_TX;
+              }
+            else if (strcmp(optarg, "rx") == 0)
+              {
+                priv.mode = SERIALBENCH_RX;
+              }
+            else if (strcmp(optarg, "sweep") == 0)
+              {
+                priv.mode = SERIALBENCH_SWEEP;
+              }
+            else
+              {
+                serialbench_showusage(argv[0]);
+                return EXIT_FAILURE;
+              }
+            break;
+
+          case 'd':
+            priv.devpath = optarg;
+            break;
+
+          case 's':
+            priv.size = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'n':
+            priv.count = atoi(optarg);
+            break;
+
+          case 't':
+            priv.duration = atoi(optarg);
+            break;
+
+#ifdef CONFIG_SERIAL_TERMIOS
+          case 'b':
+            if (serialbench_getbauds(&priv, optarg) < 0)
+              {
+                serialbench_showusage(argv[0]);
+                return EXIT_FAILURE;
+              }
+            break;
+#endif
+
+          default:
+            serialbench_showusage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+  if (priv.size == 0 || priv.size > 0xffff || priv.count <= 0 ||
+      priv.duration <= 0)
+    {
+      serialbench_showusage(argv[0]);
+      return EXIT_FAILURE;
+    }
+
+  bufsize    = priv.size + SERIALBENCH_OVERHEAD;
+  priv.txbuf = (FAR uint8_t *)malloc(bufsize);
+  priv.rxbuf = (FAR uint8_t *)malloc(bufsize);
+  if (priv.txbuf == NULL || priv.rxbuf == NULL)
+    {
+      fprintf(stderr, "ERROR: Failed to allocate buffers\n");
+      ret = ERROR;
+      goto errout_with_buffers;
+    }
+
+  priv.fd = open(priv.devpath, O_RDWR);
+  if (priv.fd < 0)
+    {
+      fprintf(stderr, "ERROR: Failed to open %s: %d\n", priv.devpath, errno);
+      ret = ERROR;
+      goto errout_with_buffers;
+    }
+
+  /* The sweep sets each baud rate itself */
+
+  ret = serialbench_setbaud(&priv, priv.mode != SERIALBENCH_SWEEP &&
+                                   priv.nbauds > 0 ? priv.bauds[0] : 0);
+  if (ret < 0)
+    {
+      goto errout_with_fd;
+    }
+
+  switch (priv.mode)
+    {
+      case SERIALBENCH_ECHO:
+        ret = serialbench_echo(&priv);
+        break;
+
+      case SERIALBENCH_LATENCY:
+        ret = serialbench_latency(&priv);
+        break;
+
+      case SERIALBENCH_TX:
+        ret = serialbench_tx(&priv);
+        break;
+
+      case SERIALBENCH_RX:
+        ret = serialbench_rx(&priv);
+        break;
+
+      case SERIALBENCH_SWEEP:
+        ret = serialbench_sweep(&priv);
+        break;
+    }
+
+errout_with_fd:
+  close(priv.fd);
+
+errout_with_buffers:
+  free(priv.txbuf);
+  free(priv.rxbuf);
+  fflush(stdout);
+  return ret < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
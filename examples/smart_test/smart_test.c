@@ -46,12 +46,19 @@
 #include <stdlib.h>
 #include <string.h>
 #include <fcntl.h>
+#include <time.h>
 #include <errno.h>
 
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
 
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define SMART_CLOCK CLOCK_MONOTONIC
+#else
+#  define SMART_CLOCK CLOCK_REALTIME
+#endif
+
 /****************************************************************************
  * Private data
  ****************************************************************************/
@@ -530,6 +537,33 @@ static int smart_circular_log_test(char *filename)
   return OK;
 }
 
+/****************************************************************************
+ * Name: smart_timed
+ *
+ * Description: Runs one of the tests and shows how long it took, so that
+ *              the performance of file systems and geometries can be
+ *              compared.
+ *
+ ****************************************************************************/
+
+static int smart_timed(FAR const char *name, int (*test)(char *filename),
+                       char *filename)
+{
+  struct timespec start;
+  struct timespec end;
+  unsigned long elapsed;
+  int ret;
+
+  (void)clock_gettime(SMART_CLOCK, &start);
+  ret = test(filename);
+  (void)clock_gettime(SMART_CLOCK, &end);
+
+  elapsed = (end.tv_sec - start.tv_sec) * 1000 +
+            (end.tv_nsec - start.tv_nsec) / 1000000;
+  printf("%s: %lu ms\n", name, elapsed);
+  return ret;
+}
+
 /****************************************************************************
  * Name: smart_usage
  *
@@ -661,7 +695,8 @@ int smart_test_main(int argc, char *argv[])
     {
       /* Create a test file */
 
-      if ((ret = smart_create_test_file(argv[optind])) < 0)
+      if ((ret = smart_timed("Create", smart_create_test_file,
+                             argv[optind])) < 0)
         {
           goto err_out_with_mem;
         }
@@ -670,7 +705,8 @@ int smart_test_main(int argc, char *argv[])
 
       if (g_seekCount > 0 )
         {
-          if ((ret = smart_seek_test(argv[optind])) < 0)
+          if ((ret = smart_timed("Seek test", smart_seek_test,
+                                 argv[optind])) < 0)
             {
               goto err_out_with_mem;
             }
@@ -678,7 +714,8 @@ int smart_test_main(int argc, char *argv[])
 
       /* Conduct an append test */
 
-      if ((ret = smart_append_test(argv[optind])) < 0)
+      if ((ret = smart_timed("Append test", smart_append_test,
+                             argv[optind])) < 0)
         {
           goto err_out_with_mem;
         }
@@ -687,7 +724,9 @@ int smart_test_main(int argc, char *argv[])
 
       if (g_writeCount > 0)
         {
-          if ((ret = smart_seek_with_write_test(argv[optind])) < 0)
+          if ((ret = smart_timed("Seek with write test",
+                                 smart_seek_with_write_test,
+                                 argv[optind])) < 0)
             {
               goto err_out_with_mem;
             }
@@ -696,7 +735,8 @@ int smart_test_main(int argc, char *argv[])
 
   /* Perform a "circular log" test */
 
-  if ((ret = smart_circular_log_test(argv[optind])) < 0)
+  if ((ret = smart_timed("Circular log test", smart_circular_log_test,
+                         argv[optind])) < 0)
     {
       goto err_out_with_mem;
     }
@@ -0,0 +1,707 @@
+/****************************************************************************
+ * examples/smp/smp_bench.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <errno.h>
+
+#include "smp.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_SMP_BENCH_WORDS
+#  define CONFIG_EXAMPLES_SMP_BENCH_WORDS 16384
+#endif
+
+#ifndef CONFIG_EXAMPLES_SMP_BENCH_ITEMS
+#  define CONFIG_EXAMPLES_SMP_BENCH_ITEMS 20000
+#endif
+
+#ifndef CONFIG_EXAMPLES_SMP_BENCH_TASKSIZE
+#  define CONFIG_EXAMPLES_SMP_BENCH_TASKSIZE 18
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define SMP_CLOCK CLOCK_MONOTONIC
+#else
+#  define SMP_CLOCK CLOCK_REALTIME
+#endif
+
+/* Passes over the array in the reduction */
+
+#define SMP_REDUCE_PASSES 16
+
+/* Depth of the producer/consumer queue */
+
+#define SMP_QUEUE_DEPTH   16
+
+/* Tasks of this size or less are leaves: they do the work instead of
+ * splitting into tasks of sizes n-1 and n-2.  The deques hold at most two
+ * tasks per level of the splitting.
+ */
+
+#define SMP_TASK_LEAF     2
+#define SMP_DEQUE_DEPTH   (2 * CONFIG_EXAMPLES_SMP_BENCH_TASKSIZE + 2)
+
+/* Loop iterations of the work of a leaf task */
+
+#define SMP_LEAF_WORK     2000
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* A mutex that counts how often it was found taken */
+
+struct smp_lock_s
+{
+  pthread_mutex_t mutex;
+  unsigned long nlocks;
+  unsigned long ncontended;
+};
+
+/* A work-stealing deque: the owner pushes and pops at the bottom, thieves
+ * take from the top.
+ */
+
+struct smp_deque_s
+{
+  struct smp_lock_s lock;
+  int top;
+  int bottom;
+  uint8_t tasks[SMP_DEQUE_DEPTH];
+};
+
+struct smp_worker_s
+{
+  pthread_t thread;
+  int index;
+  unsigned long nsteals;
+  unsigned long nleaves;
+  uint32_t result;
+};
+
+struct smp_bench_s
+{
+  FAR const char *name;
+  CODE void *(*worker)(FAR void *arg);
+  CODE void (*setup)(int nthreads);
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static FAR void *smp_reduce_worker(FAR void *arg);
+static FAR void *smp_queue_worker(FAR void *arg);
+static FAR void *smp_steal_worker(FAR void *arg);
+static void smp_reduce_setup(int nthreads);
+static void smp_queue_setup(int nthreads);
+static void smp_steal_setup(int nthreads);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct smp_bench_s g_benches[] =
+{
+  { "reduce", smp_reduce_worker, smp_reduce_setup },
+  { "queue",  smp_queue_worker,  smp_queue_setup  },
+  { "steal",  smp_steal_worker,  smp_steal_setup  },
+  { NULL,     NULL,              NULL             }
+};
+
+static int g_nthreads;
+static struct smp_worker_s g_workers[CONFIG_EXAMPLES_SMP_BENCH_THREADS];
+static pthread_barrier_t g_start;
+
+/* Parallel reduction */
+
+static FAR uint32_t *g_array;
+static struct smp_lock_s g_sumlock;
+static uint32_t g_sum;
+
+/* Producer/consumer queue */
+
+static struct smp_lock_s g_qlock;
+static pthread_cond_t g_qnotempty;
+static pthread_cond_t g_qnotfull;
+static uint32_t g_queue[SMP_QUEUE_DEPTH];
+static int g_qhead;
+static int g_qcount;
+static int g_qproduced;
+static unsigned long g_qwaits;
+
+/* Work-stealing task pool */
+
+static struct smp_deque_s g_deques[CONFIG_EXAMPLES_SMP_BENCH_THREADS];
+static struct smp_lock_s g_donelock;
+static unsigned long g_leavesdone;
+static unsigned long g_leavestotal;
+static volatile bool g_done;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: smp_nsec
+ ****************************************************************************/
+
+static uint64_t smp_nsec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(SMP_CLOCK, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/****************************************************************************
+ * Name: smp_lock_init, smp_lock, smp_unlock
+ ****************************************************************************/
+
+static void smp_lock_init(FAR struct smp_lock_s *lock)
+{
+  pthread_mutex_init(&lock->mutex, NULL);
+  lock->nlocks     = 0;
+  lock->ncontended = 0;
+}
+
+static void smp_lock(FAR struct smp_lock_s *lock)
+{
+  if (pthread_mutex_trylock(&lock->mutex) != 0)
+    {
+      pthread_mutex_lock(&lock->mutex);
+      lock->ncontended++;
+    }
+
+  lock->nlocks++;
+}
+
+static void smp_unlock(FAR struct smp_lock_s *lock)
+{
+  pthread_mutex_unlock(&lock->mutex);
+}
+
+/****************************************************************************
+ * Name: smp_reduce_setup, smp_reduce_worker
+ *
+ * Description:
+ *   Each worker sums its slice of an array and adds the partial sum to the
+ *   total under a lock.
+ *
+ ****************************************************************************/
+
+static void smp_reduce_setup(int nthreads)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_EXAMPLES_SMP_BENCH_WORDS; i++)
+    {
+      g_array[i] = (uint32_t)i * 2654435761u;
+    }
+
+  smp_lock_init(&g_sumlock);
+  g_sum = 0;
+}
+
+static FAR void *smp_reduce_worker(FAR void *arg)
+{
+  FAR struct smp_worker_s *worker = (FAR struct smp_worker_s *)arg;
+  int slice = CONFIG_EXAMPLES_SMP_BENCH_WORDS / g_nthreads;
+  int first = worker->index * slice;
+  int last = worker->index == g_nthreads - 1 ?
+             CONFIG_EXAMPLES_SMP_BENCH_WORDS : first + slice;
+  uint32_t sum;
+  int pass;
+  int i;
+
+  pthread_barrier_wait(&g_start);
+
+  for (pass = 0; pass < SMP_REDUCE_PASSES; pass++)
+    {
+      sum = 0;
+      for (i = first; i < last; i++)
+        {
+          sum += g_array[i] ^ (g_array[i] >> 7);
+        }
+
+      smp_lock(&g_sumlock);
+      g_sum += sum;
+      smp_unlock(&g_sumlock);
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: smp_queue_setup, smp_queue_worker
+ *
+ * Description:
+ *   Even workers produce items into a bounded queue and odd workers
+ *   consume them.  A single worker does both in turn.
+ *
+ ****************************************************************************/
+
+static void smp_queue_setup(int nthreads)
+{
+  smp_lock_init(&g_qlock);
+  pthread_cond_init(&g_qnotempty, NULL);
+  pthread_cond_init(&g_qnotfull, NULL);
+  g_qhead     = 0;
+  g_qcount    = 0;
+  g_qproduced = 0;
+  g_qwaits    = 0;
+}
+
+static bool smp_queue_put(void)
+{
+  smp_lock(&g_qlock);
+  while (g_qcount >= SMP_QUEUE_DEPTH &&
+         g_qproduced < CONFIG_EXAMPLES_SMP_BENCH_ITEMS)
+    {
+      g_qwaits++;
+      pthread_cond_wait(&g_qnotfull, &g_qlock.mutex);
+    }
+
+  if (g_qproduced >= CONFIG_EXAMPLES_SMP_BENCH_ITEMS)
+    {
+      smp_unlock(&g_qlock);
+      return false;
+    }
+
+  g_queue[(g_qhead + g_qcount) % SMP_QUEUE_DEPTH] = g_qproduced++;
+  g_qcount++;
+  pthread_cond_signal(&g_qnotempty);
+  smp_unlock(&g_qlock);
+  return true;
+}
+
+static bool smp_queue_get(FAR uint32_t *item, bool wait)
+{
+  smp_lock(&g_qlock);
+  while (g_qcount == 0)
+    {
+      if (!wait || g_qproduced >= CONFIG_EXAMPLES_SMP_BENCH_ITEMS)
+        {
+          smp_unlock(&g_qlock);
+          return false;
+        }
+
+      g_qwaits++;
+      pthread_cond_wait(&g_qnotempty, &g_qlock.mutex);
+    }
+
+  *item   = g_queue[g_qhead];
+  g_qhead = (g_qhead + 1) % SMP_QUEUE_DEPTH;
+  g_qcount--;
+
+  /* The last item also wakes the consumers that are waiting for more */
+
+  if (g_qproduced >= CONFIG_EXAMPLES_SMP_BENCH_ITEMS && g_qcount == 0)
+    {
+      pthread_cond_broadcast(&g_qnotempty);
+    }
+
+  pthread_cond_signal(&g_qnotfull);
+  smp_unlock(&g_qlock);
+  return true;
+}
+
+static FAR void *smp_queue_worker(FAR void *arg)
+{
+  FAR struct smp_worker_s *worker = (FAR struct smp_worker_s *)arg;
+  uint32_t item;
+  uint32_t sum = 0;
+
+  pthread_barrier_wait(&g_start);
+
+  if (g_nthreads == 1)
+    {
+      while (smp_queue_put())
+        {
+          if (g_qcount >= SMP_QUEUE_DEPTH)
+            {
+              while (smp_queue_get(&item, false))
+                {
+                  sum += item;
+                }
+            }
+        }
+
+      while (smp_queue_get(&item, false))
+        {
+          sum += item;
+        }
+    }
+  else if ((worker->index & 1) == 0)
+    {
+      while (smp_queue_put())
+        {
+        }
+
+      /* Producers are done: release the other producers and the
+       * consumers
+       */
+
+      smp_lock(&g_qlock);
+      pthread_cond_broadcast(&g_qnotfull);
+      pthread_cond_broadcast(&g_qnotempty);
+      smp_unlock(&g_qlock);
+    }
+  else
+    {
+      while (smp_queue_get(&item, true))
+        {
+          sum += item;
+        }
+    }
+
+  worker->result = sum;
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: smp_steal_setup, smp_steal_worker
+ *
+ * Description:
+ *   A pool of tasks that split into two smaller tasks down to the leaves,
+ *   an unbalanced tree like that of recursive image or control
+ *   decompositions.  Each worker runs the tasks of its own deque, most
+ *   recent first, and steals the oldest task of another worker when its
+ *   deque is empty.
+ *
+ ****************************************************************************/
+
+static unsigned long smp_leaves(int size)
+{
+  return size <= SMP_TASK_LEAF ? 1 : smp_leaves(size - 1) +
+                                     smp_leaves(size - 2);
+}
+
+static void smp_steal_setup(int nthreads)
+{
+  int i;
+
+  for (i = 0; i < nthreads; i++)
+    {
+      smp_lock_init(&g_deques[i].lock);
+      g_deques[i].top    = 0;
+      g_deques[i].bottom = 0;
+    }
+
+  /* The whole tree starts as one task of the first worker */
+
+  g_deques[0].tasks[0] = CONFIG_EXAMPLES_SMP_BENCH_TASKSIZE;
+  g_deques[0].bottom   = 1;
+
+  smp_lock_init(&g_donelock);
+  g_leavesdone  = 0;
+  g_leavestotal = smp_leaves(CONFIG_EXAMPLES_SMP_BENCH_TASKSIZE);
+  g_done        = false;
+}
+
+static void smp_deque_push(FAR struct smp_deque_s *deque, int size)
+{
+  smp_lock(&deque->lock);
+
+  /* Reclaim the space that the thieves freed at the top */
+
+  if (deque->bottom >= SMP_DEQUE_DEPTH)
+    {
+      memmove(deque->tasks, &deque->tasks[deque->top],
+              deque->bottom - deque->top);
+      deque->bottom -= deque->top;
+      deque->top     = 0;
+    }
+
+  deque->tasks[deque->bottom++] = size;
+  smp_unlock(&deque->lock);
+}
+
+static int smp_deque_pop(FAR struct smp_deque_s *deque, bool steal)
+{
+  int size = 0;
+
+  smp_lock(&deque->lock);
+  if (deque->bottom > deque->top)
+    {
+      size = steal ? deque->tasks[deque->top++] :
+                     deque->tasks[--deque->bottom];
+
+      /* Reuse the space of an empty deque */
+
+      if (deque->bottom == deque->top)
+        {
+          deque->bottom = 0;
+          deque->top    = 0;
+        }
+    }
+
+  smp_unlock(&deque->lock);
+  return size;
+}
+
+static FAR void *smp_steal_worker(FAR void *arg)
+{
+  FAR struct smp_worker_s *worker = (FAR struct smp_worker_s *)arg;
+  FAR struct smp_deque_s *own = &g_deques[worker->index];
+  volatile uint32_t acc = 0;
+  int size;
+  int i;
+
+  pthread_barrier_wait(&g_start);
+
+  while (!g_done)
+    {
+      size = smp_deque_pop(own, false);
+      for (i = 1; size == 0 && i < g_nthreads; i++)
+        {
+          size = smp_deque_pop(&g_deques[(worker->index + i) % g_nthreads],
+                               true);
+          if (size != 0)
+            {
+              worker->nsteals++;
+            }
+        }
+
+      if (size == 0)
+        {
+          /* Nothing to do: account the leaves done so far */
+
+          smp_lock(&g_donelock);
+          g_leavesdone   += worker->nleaves;
+          worker->result += worker->nleaves;
+          worker->nleaves = 0;
+          if (g_leavesdone >= g_leavestotal)
+            {
+              g_done = true;
+            }
+
+          smp_unlock(&g_donelock);
+          sched_yield();
+          continue;
+        }
+
+      if (size <= SMP_TASK_LEAF)
+        {
+          for (i = 0; i < SMP_LEAF_WORK; i++)
+            {
+              acc += i ^ size;
+            }
+
+          worker->nleaves++;
+        }
+      else
+        {
+          /* The owner pushes the smaller half last and runs it next */
+
+          smp_deque_push(own, size - 1);
+          smp_deque_push(own, size - 2);
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: smp_contention
+ *
+ * Description:
+ *   Sum the lock statistics of the benchmark, in permille of the lock
+ *   operations that found the lock taken.
+ *
+ ****************************************************************************/
+
+static unsigned int smp_contention(FAR const struct smp_bench_s *bench,
+                                   int nthreads)
+{
+  unsigned long nlocks = 0;
+  unsigned long ncontended = 0;
+  int i;
+
+  if (bench->worker == smp_reduce_worker)
+    {
+      nlocks     = g_sumlock.nlocks;
+      ncontended = g_sumlock.ncontended;
+    }
+  else if (bench->worker == smp_queue_worker)
+    {
+      nlocks     = g_qlock.nlocks;
+      ncontended = g_qlock.ncontended;
+    }
+  else
+    {
+      for (i = 0; i < nthreads; i++)
+        {
+          nlocks     += g_deques[i].lock.nlocks;
+          ncontended += g_deques[i].lock.ncontended;
+        }
+
+      nlocks     += g_donelock.nlocks;
+      ncontended += g_donelock.ncontended;
+    }
+
+  return nlocks > 0 ? (unsigned int)(ncontended * 1000 / nlocks) : 0;
+}
+
+/****************************************************************************
+ * Name: smp_run
+ *
+ * Description:
+ *   Run one benchmark with 'nthreads' workers and return the elapsed time
+ *   in nanoseconds, or zero on failure.
+ *
+ ****************************************************************************/
+
+static uint64_t smp_run(FAR const struct smp_bench_s *bench, int nthreads)
+{
+  uint64_t start;
+  int ret;
+  int i;
+
+  g_nthreads = nthreads;
+  bench->setup(nthreads);
+  pthread_barrier_init(&g_start, NULL, nthreads + 1);
+
+  for (i = 0; i < nthreads; i++)
+    {
+      memset(&g_workers[i], 0, sizeof(struct smp_worker_s));
+      g_workers[i].index = i;
+
+      ret = pthread_create(&g_workers[i].thread, NULL, bench->worker,
+                           &g_workers[i]);
+      if (ret != 0)
+        {
+          printf("ERROR: Failed to create worker %d: %d\n", i, ret);
+
+          /* The barrier never opens for the workers already created */
+
+          exit(EXIT_FAILURE);
+        }
+    }
+
+  start = smp_nsec();
+  pthread_barrier_wait(&g_start);
+
+  for (i = 0; i < nthreads; i++)
+    {
+      pthread_join(g_workers[i].thread, NULL);
+    }
+
+  start = smp_nsec() - start;
+  pthread_barrier_destroy(&g_start);
+  return start;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: smp_bench
+ ****************************************************************************/
+
+int smp_bench(int nthreads)
+{
+  FAR const struct smp_bench_s *bench;
+  unsigned long nsteals;
+  uint64_t base;
+  uint64_t nsecs;
+  unsigned int speedup;
+  unsigned int contention;
+  int n;
+  int i;
+
+  if (nthreads < 1 || nthreads > CONFIG_EXAMPLES_SMP_BENCH_THREADS)
+    {
+      printf("ERROR: 1 to %d threads\n", CONFIG_EXAMPLES_SMP_BENCH_THREADS);
+      return -EINVAL;
+    }
+
+  g_array = (FAR uint32_t *)malloc(CONFIG_EXAMPLES_SMP_BENCH_WORDS *
+                                   sizeof(uint32_t));
+  if (g_array == NULL)
+    {
+      printf("ERROR: Failed to allocate the array\n");
+      return -ENOMEM;
+    }
+
+  printf("%-8s %7s %10s %8s %10s %8s\n", "Bench", "Threads", "Time(us)",
+         "Speedup", "Contended", "Steals");
+
+  for (bench = g_benches; bench->name != NULL; bench++)
+    {
+      base = 0;
+      for (n = 1; n <= nthreads; n++)
+        {
+          nsecs = smp_run(bench, n);
+          if (n == 1)
+            {
+              base = nsecs;
+            }
+
+          speedup    = nsecs > 0 ? (unsigned int)(base * 100 / nsecs) : 0;
+          contention = smp_contention(bench, n);
+
+          nsteals = 0;
+          for (i = 0; i < n; i++)
+            {
+              nsteals += g_workers[i].nsteals;
+            }
+
+          printf("%-8s %7d %10lu %5u.%02u %8u.%u%% %8lu\n", bench->name, n,
+                 (unsigned long)(nsecs / 1000), speedup / 100,
+                 speedup % 100, contention / 10, contention % 10, nsteals);
+        }
+    }
+
+  free(g_array);
+  return OK;
+}
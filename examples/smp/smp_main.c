@@ -37,12 +37,15 @@
  * Included Files
  ****************************************************************************/
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <pthread.h>
 #include <string.h>
 
+#include "smp.h"
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -94,8 +97,8 @@ static void show_cpu_conditional(FAR const char *caller, int threadno)
     }
 }
 #else
-#  define show_cpu(c)
-#  define show_cpu_conditional(c)
+#  define show_cpu(c,t)
+#  define show_cpu_conditional(c,t)
 #endif
 
 /****************************************************************************
@@ -228,9 +231,42 @@ int smp_main(int argc, char *argv[])
   pthread_attr_t attr;
   pthread_barrierattr_t barrierattr;
   int errcode = EXIT_SUCCESS;
+  int nthreads = CONFIG_EXAMPLES_SMP_BENCH_THREADS;
+  bool bench = false;
+  int option;
   int ret;
   int i;
 
+  /* -b runs the scaling benchmarks instead of the barrier test */
+
+  while ((option = getopt(argc, argv, "bn:h")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'b':
+            bench = true;
+            break;
+
+          case 'n':
+            nthreads = atoi(optarg);
+            break;
+
+          case 'h':
+          default:
+            fprintf(stderr, "USAGE: %s [-b [-n <threads>]]\n", argv[0]);
+            fprintf(stderr, "  -b  Run the scaling benchmarks with 1 to "
+                    "<threads> workers\n");
+            fprintf(stderr, "      (default %d)\n",
+                    CONFIG_EXAMPLES_SMP_BENCH_THREADS);
+            return option == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+  if (bench)
+    {
+      return smp_bench(nthreads) < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
   /* Initialize data */
 
   memset(threadid, 0, sizeof(pthread_t) * CONFIG_EXAMPLES_SMP_NBARRIER_THREADS);
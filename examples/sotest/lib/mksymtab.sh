@@ -21,9 +21,11 @@ if [ ! -d "$dir" ]; then
 fi
 
 # Extract all of the undefined symbols from the SOTEST files and create a
-# list of sorted, unique undefined variable names.
+# list of sorted, unique undefined variable names.  The list is sorted in
+# strcmp() order so that the table also works with the binary search of
+# CONFIG_SYMTAB_ORDEREDBYNAME.
 
-tmplist=`find ${dir} -executable -type f | xargs nm | fgrep ' U ' | sed -e "s/^[ ]*//g" | cut -d' ' -f2 | sort | uniq`
+tmplist=`find ${dir} -executable -type f | xargs nm | fgrep ' U ' | sed -e "s/^[ ]*//g" | cut -d' ' -f2 | LC_ALL=C sort -u`
 
 # Remove the special symbol 'modprint'.  It it is not exported by the
 # base firmware, but rather in this test from one shared library to another.
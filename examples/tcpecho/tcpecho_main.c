@@ -43,8 +43,11 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
 #include <debug.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <poll.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -78,13 +81,63 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
-#define TCPECHO_MAXLINE 64
+#ifndef CONFIG_EXAMPLES_TCPECHO_NCONN
+#  define CONFIG_EXAMPLES_TCPECHO_NCONN 8
+#endif
+
+#ifndef CONFIG_EXAMPLES_TCPECHO_BUFSIZE
+#  define CONFIG_EXAMPLES_TCPECHO_BUFSIZE 1024
+#endif
+
+#ifndef CONFIG_EXAMPLES_TCPECHO_REPORT
+#  define CONFIG_EXAMPLES_TCPECHO_REPORT 10
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define TCPECHO_CLOCK CLOCK_MONOTONIC
+#else
+#  define TCPECHO_CLOCK CLOCK_REALTIME
+#endif
+
+#define TCPECHO_BUFSIZE CONFIG_EXAMPLES_TCPECHO_BUFSIZE
 #define TCPECHO_POLLTIMEOUT 10000
 
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One client connection.  buf[head..tail) is received data that has not
+ * been echoed yet because the socket would not take it.
+ */
+
+struct tcpecho_conn_s
+{
+  int fd;
+  uint16_t head;
+  uint16_t tail;
+  uint8_t buf[TCPECHO_BUFSIZE];
+};
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
 
+/* g_pollfd[0] is the listening socket and g_pollfd[i + 1] belongs to
+ * g_conn[i].  The first g_nconn connections are in use.
+ */
+
+static struct pollfd g_pollfd[CONFIG_EXAMPLES_TCPECHO_NCONN + 1];
+static struct tcpecho_conn_s g_conn[CONFIG_EXAMPLES_TCPECHO_NCONN];
+static int g_nconn;
+
+/* Statistics */
+
+static uint32_t g_naccepted;
+static uint32_t g_nrefused;
+static uint32_t g_rxbytes;
+static uint32_t g_txbytes;
+static uint32_t g_lastreport;
+
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
@@ -198,17 +251,243 @@ static int tcpecho_netsetup()
   return OK;
 }
 
+static uint32_t tcpecho_now(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(TCPECHO_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static int tcpecho_nonblock(int sockfd)
+{
+  int flags;
+
+  flags = fcntl(sockfd, F_GETFL, 0);
+  if (flags < 0)
+    {
+      return ERROR;
+    }
+
+  return fcntl(sockfd, F_SETFL, flags | O_NONBLOCK);
+}
+
+/* Write as much of the output queue as the socket accepts now.  Returns
+ * OK when the queue is empty or the socket is full, ERROR if the
+ * connection has failed.
+ */
+
+static int tcpecho_flush(FAR struct tcpecho_conn_s *conn)
+{
+  ssize_t n;
+
+  while (conn->head < conn->tail)
+    {
+      n = write(conn->fd, &conn->buf[conn->head], conn->tail - conn->head);
+      if (n < 0)
+        {
+          if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+              return OK;
+            }
+
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          return ERROR;
+        }
+
+      conn->head += n;
+      g_txbytes  += n;
+    }
+
+  conn->head = 0;
+  conn->tail = 0;
+  return OK;
+}
+
+/* Read until the socket has no more data or the output queue is full,
+ * echoing as we go.  Returns OK if the connection stays open, ERROR if it
+ * was closed or failed.
+ */
+
+static int tcpecho_receive(FAR struct tcpecho_conn_s *conn)
+{
+  ssize_t n;
+
+  for (; ; )
+    {
+      if (tcpecho_flush(conn) < 0)
+        {
+          return ERROR;
+        }
+
+      /* Make room at the end of a partly written queue */
+
+      if (conn->tail == TCPECHO_BUFSIZE && conn->head > 0)
+        {
+          memmove(conn->buf, &conn->buf[conn->head],
+                  conn->tail - conn->head);
+          conn->tail -= conn->head;
+          conn->head  = 0;
+        }
+
+      if (conn->tail == TCPECHO_BUFSIZE)
+        {
+          /* The peer is not reading.  Stop reading from it until the queue
+           * drains.
+           */
+
+          return OK;
+        }
+
+      n = read(conn->fd, &conn->buf[conn->tail],
+               TCPECHO_BUFSIZE - conn->tail);
+      if (n < 0)
+        {
+          if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+              return OK;
+            }
+
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          if (errno == ECONNRESET)
+            {
+              nwarn("WARNING: client %d aborted connection\n", conn->fd);
+            }
+          else
+            {
+              perror("ERROR: read error\n");
+            }
+
+          return ERROR;
+        }
+
+      if (n == 0)
+        {
+          nwarn("WARNING: client %d closed connection\n", conn->fd);
+          return ERROR;
+        }
+
+      if (n == 6 && conn->tail == 0 && memcmp(conn->buf, "exit\r\n", 6) == 0)
+        {
+          nwarn("WARNING: client %d closed connection\n", conn->fd);
+          return ERROR;
+        }
+
+      conn->tail += n;
+      g_rxbytes  += n;
+    }
+}
+
+static void tcpecho_report(uint32_t now)
+{
+  uint32_t elapsed = now - g_lastreport;
+
+  if (elapsed > 0)
+    {
+      printf("tcpecho: %d connections (%lu accepted, %lu refused), "
+             "rx %lu B/s, tx %lu B/s\n",
+             g_nconn, (unsigned long)g_naccepted, (unsigned long)g_nrefused,
+             (unsigned long)((uint64_t)g_rxbytes * 1000 / elapsed),
+             (unsigned long)((uint64_t)g_txbytes * 1000 / elapsed));
+    }
+
+  g_rxbytes    = 0;
+  g_txbytes    = 0;
+  g_lastreport = now;
+}
+
+static void tcpecho_accept(int listenfd)
+{
+  struct sockaddr_in cliaddr;
+  socklen_t clilen;
+  int connfd;
+
+  /* Accept every pending connection */
+
+  for (; ; )
+    {
+      clilen = sizeof(cliaddr);
+      connfd = accept(listenfd, (struct sockaddr *)&cliaddr, &clilen);
+      if (connfd < 0)
+        {
+          if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+              perror("ERROR: accept failed\n");
+            }
+
+          return;
+        }
+
+      if (g_nconn >= CONFIG_EXAMPLES_TCPECHO_NCONN ||
+          tcpecho_nonblock(connfd) < 0)
+        {
+          nwarn("WARNING: refusing client %s\n", inet_ntoa(cliaddr.sin_addr));
+          close(connfd);
+          g_nrefused++;
+          continue;
+        }
+
+      ninfo("new client: %s\n", inet_ntoa(cliaddr.sin_addr));
+
+      g_conn[g_nconn].fd   = connfd;
+      g_conn[g_nconn].head = 0;
+      g_conn[g_nconn].tail = 0;
+
+      g_pollfd[g_nconn + 1].fd      = connfd;
+      g_pollfd[g_nconn + 1].events  = POLLIN;
+      g_pollfd[g_nconn + 1].revents = 0;
+
+      g_nconn++;
+      g_naccepted++;
+    }
+}
+
+/* Close connection i and move the last connection into its slot, so the
+ * active part of the arrays stays packed.
+ */
+
+static void tcpecho_close(int i)
+{
+  FAR struct tcpecho_conn_s *conn = &g_conn[i];
+
+  close(conn->fd);
+
+  g_nconn--;
+  if (i != g_nconn)
+    {
+      /* Swap the connections: the record is big, but only the fd and the
+       * queued bytes are live.
+       */
+
+      conn->fd   = g_conn[g_nconn].fd;
+      conn->head = 0;
+      conn->tail = g_conn[g_nconn].tail - g_conn[g_nconn].head;
+      memcpy(conn->buf, &g_conn[g_nconn].buf[g_conn[g_nconn].head],
+             conn->tail);
+
+      g_pollfd[i + 1] = g_pollfd[g_nconn + 1];
+    }
+}
+
 static int tcpecho_server(void)
 {
-  int i, maxi, listenfd, connfd, sockfd;
+  struct sockaddr_in servaddr;
+  FAR struct tcpecho_conn_s *conn;
+  uint32_t now;
+  short revents;
+  int listenfd;
+  int timeout;
   int nready;
   int ret;
-  ssize_t n;
-  char buf[TCPECHO_MAXLINE];
-  socklen_t clilen;
-  bool stop = false;
-  struct pollfd client[CONFIG_EXAMPLES_TCPECHO_NCONN];
-  struct sockaddr_in cliaddr, servaddr;
+  int i;
 
   listenfd = socket(AF_INET, SOCK_STREAM, 0);
 
@@ -227,137 +506,109 @@ static int tcpecho_server(void)
   if (ret < 0)
     {
       perror("ERROR: failed to bind socket.\n");
+      close(listenfd);
       return ERROR;
     }
 
   ninfo("start listening on port: %d\n", CONFIG_EXAMPLES_TCPECHO_PORT);
 
   ret = listen(listenfd, CONFIG_EXAMPLES_TCPECHO_BACKLOG);
-  if (ret < 0)
+  if (ret < 0 || tcpecho_nonblock(listenfd) < 0)
     {
       perror("ERROR: failed to start listening\n");
+      close(listenfd);
       return ERROR;
     }
 
-  client[0].fd = listenfd;
-  client[0].events = POLLRDNORM;
-  for (i = 1; i < CONFIG_EXAMPLES_TCPECHO_NCONN; i++)
-    {
-      client[i].fd = -1;        /* -1 indicates available entry */
-    }
+  g_pollfd[0].fd     = listenfd;
+  g_pollfd[0].events = POLLIN;
+  g_nconn            = 0;
+  g_lastreport       = tcpecho_now();
 
-  maxi = 0;                     /* max index into client[] array */
+#if CONFIG_EXAMPLES_TCPECHO_REPORT > 0
+  timeout = CONFIG_EXAMPLES_TCPECHO_REPORT * 1000;
+#else
+  timeout = TCPECHO_POLLTIMEOUT;
+#endif
 
-  while (!stop)
+  for (; ; )
     {
-      nready = poll(client, maxi+1, TCPECHO_POLLTIMEOUT);
+      /* Only the connections in use are polled */
 
-      if (client[0].revents & POLLRDNORM)
+      nready = poll(g_pollfd, g_nconn + 1, timeout);
+      if (nready < 0 && errno != EINTR)
         {
-          /* new client connection */
+          perror("ERROR: poll failed\n");
+          ret = ERROR;
+          break;
+        }
 
-          clilen = sizeof(cliaddr);
-          connfd = accept(listenfd, (struct sockaddr*)&cliaddr, &clilen);
+#if CONFIG_EXAMPLES_TCPECHO_REPORT > 0
+      now = tcpecho_now();
+      if (now - g_lastreport >= CONFIG_EXAMPLES_TCPECHO_REPORT * 1000)
+        {
+          tcpecho_report(now);
+        }
+#else
+      UNUSED(now);
+#endif
 
-          ninfo("new client: %s\n", inet_ntoa(cliaddr.sin_addr));
+      if (nready <= 0)
+        {
+          continue;
+        }
 
-          for (i = 1; i < CONFIG_EXAMPLES_TCPECHO_NCONN; i++)
-            {
-              if (client[i].fd < 0)
-                {
-                  client[i].fd = connfd;  /* save descriptor */
-                  break;
-                }
-            }
+      /* Walk down so that a closed slot is refilled from one already
+       * visited.  Connections accepted below are polled next time.
+       */
 
-          if (i == CONFIG_EXAMPLES_TCPECHO_NCONN)
+      for (i = g_nconn - 1; i >= 0 && nready > 0; i--)
+        {
+          revents = g_pollfd[i + 1].revents;
+          if (revents == 0)
             {
-              perror("ERROR: too many clients");
-              return ERROR;
+              continue;
             }
 
-          client[i].events = POLLRDNORM;
-          if (i > maxi)
+          nready--;
+          conn = &g_conn[i];
+
+          if ((revents & (POLLIN | POLLERR | POLLHUP)) != 0)
             {
-              maxi = i;    /* max index in client[] array */
+              ret = tcpecho_receive(conn);
             }
-
-          if (--nready <= 0)
+          else
             {
-              continue;    /* no more readable descriptors */
+              ret = tcpecho_flush(conn);
             }
-        }
 
-      for (i = 1; i <= maxi; i++)
-        {
-          /* check all clients for data */
-
-          if ((sockfd = client[i].fd) < 0)
+          if (ret < 0 || (revents & POLLNVAL) != 0)
             {
+              tcpecho_close(i);
               continue;
             }
 
-          if (client[i].revents & (POLLRDNORM | POLLERR))
-            {
-              if ( (n = read(sockfd, buf, TCPECHO_MAXLINE)) < 0)
-                {
-                  if (errno == ECONNRESET)
-                    {
-                      /* connection reset by client */
-
-                      nwarn("WARNING: client[%d] aborted connection\n", i);
-
-                      close(sockfd);
-                      client[i].fd = -1;
-                    }
-                  else
-                    {
-                      perror("ERROR: readline error\n");
-                      close(sockfd);
-                      client[i].fd = -1;
-                    }
-                }
-              else if (n == 0)
-                {
-                  /* connection closed by client */
-
-                  nwarn("WARNING: client[%d] closed connection\n", i);
-
-                  close(sockfd);
-                  client[i].fd = -1;
-                }
-              else
-                {
-                  if (strcmp(buf, "exit\r\n") == 0)
-                    {
-                      nwarn("WARNING: client[%d] closed connection\n", i);
-                      close(sockfd);
-                      client[i].fd = -1;
-                    }
-                  else
-                    {
-                      write(sockfd, buf, n);
-                    }
-                }
-
-              if (--nready <= 0)
-                {
-                  break;  /* no more readable descriptors */
-                }
-            }
+          /* Wait for room to write while anything is queued, and stop
+           * reading while the queue is full.
+           */
+
+          g_pollfd[i + 1].events =
+            (conn->tail < TCPECHO_BUFSIZE ? POLLIN : 0) |
+            (conn->head < conn->tail ? POLLOUT : 0);
         }
-    }
 
-  for (i = 0; i <= maxi; i++)
-    {
-      if (client[i].fd < 0)
+      if ((g_pollfd[0].revents & POLLIN) != 0)
         {
-          continue;
+          tcpecho_accept(listenfd);
         }
+    }
 
-      close(client[i].fd);
+  while (g_nconn > 0)
+    {
+      tcpecho_close(g_nconn - 1);
     }
 
+  close(listenfd);
   return ret;
 }
 
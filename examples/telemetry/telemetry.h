@@ -0,0 +1,96 @@
+/****************************************************************************
+ * examples/telemetry/telemetry.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_EXAMPLES_TELEMETRY_TELEMETRY_H
+#define __APPS_EXAMPLES_TELEMETRY_TELEMETRY_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stdint.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_TELEMETRY_BLOCKSIZE
+#  define CONFIG_EXAMPLES_TELEMETRY_BLOCKSIZE 512
+#endif
+
+#define TELEMETRY_MAGIC    0x4d4c4554  /* "TELM", little endian */
+
+/* The number of records that fit in one block after its header */
+
+#define TELEMETRY_NRECORDS \
+  ((CONFIG_EXAMPLES_TELEMETRY_BLOCKSIZE - \
+    sizeof(struct telemetry_header_s)) / sizeof(struct telemetry_record_s))
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* The log file is a sequence of fixed size blocks in the byte order of the
+ * target.  Each block starts with this header; the records follow, and the
+ * remainder of the block is padding.  Only the last block of a log may
+ * hold fewer than TELEMETRY_NRECORDS records.
+ */
+
+struct telemetry_header_s
+{
+  uint32_t magic;         /* TELEMETRY_MAGIC */
+  uint32_t seqno;         /* Block number, starting at zero */
+  uint16_t nrecords;      /* Number of valid records in the block */
+  uint16_t decimation;    /* Number of samples aggregated into a record */
+  uint32_t dropped;       /* Records lost to a full ring since the start */
+};
+
+/* One record.  With decimation, 'voltage', 'current', 'cpuload' and
+ * 'memused' are the means of the aggregated samples and 'peak' is the
+ * largest current among them.
+ */
+
+struct telemetry_record_s
+{
+  uint32_t time;          /* Milliseconds since the start of the log */
+  uint32_t voltage;       /* Bus voltage from the INA219 */
+  int32_t  current;       /* Current from the INA219 */
+  int32_t  peak;          /* Largest current sample */
+  uint32_t memused;       /* Bytes of heap in use */
+  uint16_t cpuload;       /* CPU load in tenths of a percent */
+  uint16_t nsamples;      /* Samples aggregated into this record */
+};
+
+#endif /* __APPS_EXAMPLES_TELEMETRY_TELEMETRY_H */
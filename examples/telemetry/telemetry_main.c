@@ -33,166 +33,604 @@
  *
  ****************************************************************************/
 
- /****************************************************************************
-  * Included Files
-  ****************************************************************************/
-
- #include <nuttx/config.h>
- #include <stdio.h>
- #include <stdlib.h>
- #include <fcntl.h>
- #include <unistd.h>
- #include <nuttx/sensors/ina219.h>
- #include <string.h>
-
- /****************************************************************************
-  * Public Functions
-  ****************************************************************************/
-
-  /****************************************************************************
-   * Variables
-   ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sched.h>
+#include <malloc.h>
+#include <time.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/sensors/ina219.h>
+
+#include "telemetry.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_TELEMETRY_NBLOCKS
+#  define CONFIG_EXAMPLES_TELEMETRY_NBLOCKS 4
+#endif
+
+#ifndef CONFIG_EXAMPLES_TELEMETRY_PERIOD
+#  define CONFIG_EXAMPLES_TELEMETRY_PERIOD 10
+#endif
+
+#ifndef CONFIG_EXAMPLES_TELEMETRY_WRITER_PRIORITY
+#  define CONFIG_EXAMPLES_TELEMETRY_WRITER_PRIORITY 50
+#endif
+
+#ifndef CONFIG_EXAMPLES_TELEMETRY_WRITER_STACKSIZE
+#  define CONFIG_EXAMPLES_TELEMETRY_WRITER_STACKSIZE 1024
+#endif
+
+#ifndef CONFIG_EXAMPLES_TELEMETRY_SENSOR
+#  define CONFIG_EXAMPLES_TELEMETRY_SENSOR "/dev/ina219"
+#endif
+
+#ifndef CONFIG_EXAMPLES_TELEMETRY_LOGFILE
+#  define CONFIG_EXAMPLES_TELEMETRY_LOGFILE "/mnt/telemetry.dat"
+#endif
+
+#if CONFIG_EXAMPLES_TELEMETRY_NBLOCKS < 2
+#  error CONFIG_EXAMPLES_TELEMETRY_NBLOCKS must be at least 2
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define TELEMETRY_CLOCK CLOCK_MONOTONIC
+#else
+#  define TELEMETRY_CLOCK CLOCK_REALTIME
+#endif
+
+/* The CPU load counters of the idle task can be read directly only in a
+ * flat, single CPU build.  Otherwise /proc/cpuload is read.
+ */
+
+#if defined(CONFIG_SCHED_CPULOAD) && !defined(CONFIG_SMP) && \
+    !defined(CONFIG_BUILD_PROTECTED) && !defined(CONFIG_BUILD_KERNEL)
+#  define TELEMETRY_HAVE_CPULOAD 1
+#endif
+
+#define TELEMETRY_BLOCK(t,n) \
+  ((FAR struct telemetry_header_s *) \
+   &(t)->ring[(n) * CONFIG_EXAMPLES_TELEMETRY_BLOCKSIZE])
+
+#define TELEMETRY_RECORDS(h) \
+  ((FAR struct telemetry_record_s *)((FAR uint8_t *)(h) + sizeof(*(h))))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The sampler fills the block at 'head' while the writer thread writes the
+ * blocks from 'tail' up to it.  'full' counts the blocks that are ready to
+ * be written.  The ring is full when the sampler cannot advance 'head'
+ * without reaching 'tail'; records are then dropped until a block is free.
+ */
+
+struct telemetry_s
+{
+  FAR uint8_t *ring;           /* CONFIG_EXAMPLES_TELEMETRY_NBLOCKS blocks */
+  volatile unsigned int head;  /* Block being filled by the sampler */
+  volatile unsigned int tail;  /* Next block to be written */
+  sem_t full;                  /* Number of blocks ready to write */
+  int logfd;                   /* Log file or -1 */
+#ifndef TELEMETRY_HAVE_CPULOAD
+  int loadfd;                  /* /proc/cpuload or -1 */
+#endif
+  int error;                   /* First write error of the writer */
+  uint32_t seqno;              /* Sequence number of the head block */
+  uint32_t dropped;            /* Records lost to a full ring */
+  uint32_t written;            /* Blocks written */
+};
+
+/* The sums of the samples aggregated into the next record */
+
+struct telemetry_accum_s
+{
+  uint64_t voltage;
+  int64_t  current;
+  int32_t  peak;
+  uint64_t memused;
+  uint32_t cpuload;
+  uint16_t nsamples;
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: telemetry_msec
+ ****************************************************************************/
+
+static uint32_t telemetry_msec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(TELEMETRY_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/****************************************************************************
+ * Name: telemetry_cpuload
+ *
+ * Description:
+ *   Return the CPU load in tenths of a percent.
+ *
+ ****************************************************************************/
+
+static uint16_t telemetry_cpuload(FAR struct telemetry_s *t)
+{
+#ifdef TELEMETRY_HAVE_CPULOAD
+  struct cpuload_s idle;
+
+  if (clock_cpuload(0, &idle) < 0 || idle.total == 0)
+    {
+      return 0;
+    }
+
+  return 1000 - (uint16_t)(((uint64_t)idle.active * 1000) / idle.total);
+#else
+  FAR char *ptr;
+  char buffer[16];
+  ssize_t nread;
+  uint16_t load;
+
+  /* The file stays open; rewind it rather than reopening it each time.
+   * It holds a single line like "  12.3%".
+   */
+
+  if (t->loadfd < 0 || lseek(t->loadfd, 0, SEEK_SET) < 0)
+    {
+      return 0;
+    }
+
+  nread = read(t->loadfd, buffer, sizeof(buffer) - 1);
+  if (nread <= 0)
+    {
+      return 0;
+    }
+
+  buffer[nread] = '\0';
+  load = (uint16_t)strtoul(buffer, &ptr, 10) * 10;
+  if (*ptr == '.' && ptr[1] >= '0' && ptr[1] <= '9')
+    {
+      load += ptr[1] - '0';
+    }
+
+  return load;
+#endif
+}
+
+/****************************************************************************
+ * Name: telemetry_memused
+ ****************************************************************************/
+
+static uint32_t telemetry_memused(void)
+{
+  struct mallinfo mem;
+
+#ifdef CONFIG_CAN_PASS_STRUCTS
+  mem = mallinfo();
+#else
+  (void)mallinfo(&mem);
+#endif
+
+  return mem.uordblks;
+}
+
+/****************************************************************************
+ * Name: telemetry_writer
+ *
+ * Description:
+ *   Write the filled blocks of the ring to the log file.  This runs at a
+ *   lower priority than the sampler, so a slow write delays only itself.
+ *
+ ****************************************************************************/
+
+static FAR void *telemetry_writer(FAR void *arg)
+{
+  FAR struct telemetry_s *t = (FAR struct telemetry_s *)arg;
+  FAR uint8_t *block;
+  ssize_t nwritten;
+  size_t remaining;
+
+  for (; ; )
+    {
+      while (sem_wait(&t->full) < 0)
+        {
+          DEBUGASSERT(errno == EINTR);
+        }
+
+      /* A post without a block to write is the request to stop */
+
+      if (t->tail == t->head)
+        {
+          break;
+        }
+
+      block     = (FAR uint8_t *)TELEMETRY_BLOCK(t, t->tail);
+      remaining = CONFIG_EXAMPLES_TELEMETRY_BLOCKSIZE;
+
+      while (remaining > 0 && t->error == 0)
+        {
+          nwritten = write(t->logfd, block, remaining);
+          if (nwritten < 0)
+            {
+              if (errno != EINTR)
+                {
+                  t->error = errno;
+                }
+            }
+          else
+            {
+              block     += nwritten;
+              remaining -= nwritten;
+            }
+        }
+
+      if (t->error == 0)
+        {
+          t->written++;
+        }
+
+      t->tail = (t->tail + 1) % CONFIG_EXAMPLES_TELEMETRY_NBLOCKS;
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: telemetry_advance
+ *
+ * Description:
+ *   Hand the head block to the writer and start the next one.  Returns
+ *   false if the ring is full.
+ *
+ ****************************************************************************/
+
+static bool telemetry_advance(FAR struct telemetry_s *t,
+                              uint16_t decimation)
+{
+  FAR struct telemetry_header_s *hdr;
+  unsigned int next;
+
+  next = (t->head + 1) % CONFIG_EXAMPLES_TELEMETRY_NBLOCKS;
+  if (next == t->tail)
+    {
+      return false;
+    }
+
+  hdr          = TELEMETRY_BLOCK(t, t->head);
+  hdr->dropped = t->dropped;
+  t->head      = next;
+  sem_post(&t->full);
+
+  /* Prepare the new head block */
+
+  hdr             = TELEMETRY_BLOCK(t, next);
+  memset(hdr, 0, CONFIG_EXAMPLES_TELEMETRY_BLOCKSIZE);
+  hdr->magic      = TELEMETRY_MAGIC;
+  hdr->seqno      = ++t->seqno;
+  hdr->decimation = decimation;
+  return true;
+}
+
+/****************************************************************************
+ * Name: telemetry_store
+ *
+ * Description:
+ *   Append a record to the head block of the ring.
+ *
+ ****************************************************************************/
+
+static void telemetry_store(FAR struct telemetry_s *t,
+                            FAR const struct telemetry_record_s *rec,
+                            uint16_t decimation)
+{
+  FAR struct telemetry_header_s *hdr = TELEMETRY_BLOCK(t, t->head);
+
+  if (hdr->nrecords >= TELEMETRY_NRECORDS &&
+      !telemetry_advance(t, decimation))
+    {
+      t->dropped++;
+      return;
+    }
+
+  hdr = TELEMETRY_BLOCK(t, t->head);
+  TELEMETRY_RECORDS(hdr)[hdr->nrecords++] = *rec;
+}
+
+/****************************************************************************
+ * Name: telemetry_showusage
+ ****************************************************************************/
+
+static void telemetry_showusage(FAR const char *progname, int exitcode)
+{
+  fprintf(stderr, "USAGE: %s [-o <file>] [-n <count>] [-p <period>] "
+          "[-a <decimation>] [-v]\n", progname);
+  fprintf(stderr, "\nWhere:\n");
+  fprintf(stderr, "\t-o <file>: Binary log file.  Default: %s\n",
+          CONFIG_EXAMPLES_TELEMETRY_LOGFILE);
+  fprintf(stderr, "\t-n <count>: Number of records, or 0 to run until "
+          "stopped.  Default: 0\n");
+  fprintf(stderr, "\t-p <period>: Sample period in milliseconds.  "
+          "Default: %d\n", CONFIG_EXAMPLES_TELEMETRY_PERIOD);
+  fprintf(stderr, "\t-a <decimation>: Aggregate this many samples into "
+          "each record.  Default: 1\n");
+  fprintf(stderr, "\t-v: Also show every record on the console\n");
+  exit(exitcode);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * telemetry_main
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int telemetry_main(int argc, char *argv[])
+#endif
+{
+  FAR const char *logfile = CONFIG_EXAMPLES_TELEMETRY_LOGFILE;
+  FAR struct telemetry_header_s *hdr;
+  struct telemetry_accum_s acc;
+  struct telemetry_record_s rec;
+  struct telemetry_s t;
   struct ina219_s sample;
+  struct sched_param param;
+  pthread_attr_t attr;
+  pthread_t writer;
+  uint32_t period = CONFIG_EXAMPLES_TELEMETRY_PERIOD;
+  uint32_t decimation = 1;
+  uint32_t count = 0;
+  uint32_t nrecords;
+  uint32_t start;
+  uint32_t next;
+  uint32_t now;
+  bool verbose = false;
+  int sensorfd;
+  int option;
+  int ret = EXIT_FAILURE;
+
+  while ((option = getopt(argc, argv, ":o:n:p:a:vh")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'o':
+            logfile = optarg;
+            break;
+
+          case 'n':
+            count = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'p':
+            period = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'a':
+            decimation = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'v':
+            verbose = true;
+            break;
+
+          case 'h':
+            telemetry_showusage(argv[0], EXIT_SUCCESS);
+            break;
+
+          case ':':
+            fprintf(stderr, "ERROR: Missing argument to option -%c\n",
+                    optopt);
+            telemetry_showusage(argv[0], EXIT_FAILURE);
+            break;
+
+          case '?':
+          default:
+            fprintf(stderr, "ERROR: Unrecognized option -%c\n", optopt);
+            telemetry_showusage(argv[0], EXIT_FAILURE);
+            break;
+        }
+    }
+
+  if (period == 0 || decimation == 0 || decimation > UINT16_MAX)
+    {
+      fprintf(stderr, "ERROR: Bad period or decimation\n");
+      telemetry_showusage(argv[0], EXIT_FAILURE);
+    }
+
+  memset(&t, 0, sizeof(struct telemetry_s));
+
+  sensorfd = open(CONFIG_EXAMPLES_TELEMETRY_SENSOR, O_RDONLY);
+  if (sensorfd < 0)
+    {
+      fprintf(stderr, "ERROR: Failed to open %s: %d\n",
+              CONFIG_EXAMPLES_TELEMETRY_SENSOR, errno);
+      return EXIT_FAILURE;
+    }
+
+#ifndef TELEMETRY_HAVE_CPULOAD
+  t.loadfd = open("/proc/cpuload", O_RDONLY);
+  if (t.loadfd < 0)
+    {
+      fprintf(stderr, "WARNING: No CPU load, is procfs mounted?\n");
+    }
+#endif
+
+  t.logfd = open(logfile, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (t.logfd < 0)
+    {
+      fprintf(stderr, "ERROR: Failed to open %s: %d\n", logfile, errno);
+      goto errout_with_fds;
+    }
+
+  t.ring = (FAR uint8_t *)malloc(CONFIG_EXAMPLES_TELEMETRY_NBLOCKS *
+                                 CONFIG_EXAMPLES_TELEMETRY_BLOCKSIZE);
+  if (t.ring == NULL)
+    {
+      fprintf(stderr, "ERROR: Failed to allocate the ring\n");
+      goto errout_with_fds;
+    }
+
+  hdr = TELEMETRY_BLOCK(&t, 0);
+  memset(hdr, 0, CONFIG_EXAMPLES_TELEMETRY_BLOCKSIZE);
+  hdr->magic      = TELEMETRY_MAGIC;
+  hdr->decimation = decimation;
+
+  sem_init(&t.full, 0, 0);
+
+  /* The writer runs below the sampler, so that the card never delays the
+   * sampling.
+   */
+
+  pthread_attr_init(&attr);
+  param.sched_priority = CONFIG_EXAMPLES_TELEMETRY_WRITER_PRIORITY;
+  (void)pthread_attr_setschedparam(&attr, &param);
+  (void)pthread_attr_setstacksize(&attr,
+                                  CONFIG_EXAMPLES_TELEMETRY_WRITER_STACKSIZE);
+
+  ret = pthread_create(&writer, &attr, telemetry_writer, &t);
+  if (ret != 0)
+    {
+      fprintf(stderr, "ERROR: Failed to start the writer: %d\n", ret);
+      ret = EXIT_FAILURE;
+      goto errout_with_sem;
+    }
+
+  printf("telemetry: %lu records of %lu samples every %lu ms to %s\n",
+         (unsigned long)count, (unsigned long)decimation,
+         (unsigned long)period, logfile);
+
+  memset(&acc, 0, sizeof(struct telemetry_accum_s));
+  start    = telemetry_msec();
+  next     = start;
+  nrecords = 0;
+
+  while (count == 0 || nrecords < count)
+    {
+      if (read(sensorfd, &sample, sizeof(struct ina219_s)) !=
+          sizeof(struct ina219_s))
+        {
+          memset(&sample, 0, sizeof(struct ina219_s));
+        }
+
+      if (acc.nsamples == 0 || (int32_t)sample.current > acc.peak)
+        {
+          acc.peak = sample.current;
+        }
+
+      acc.voltage += sample.voltage;
+      acc.current += (int32_t)sample.current;
+      acc.memused += telemetry_memused();
+      acc.cpuload += telemetry_cpuload(&t);
+
+      if (++acc.nsamples >= decimation)
+        {
+          rec.time     = telemetry_msec() - start;
+          rec.voltage  = (uint32_t)(acc.voltage / acc.nsamples);
+          rec.current  = (int32_t)(acc.current / acc.nsamples);
+          rec.peak     = acc.peak;
+          rec.memused  = (uint32_t)(acc.memused / acc.nsamples);
+          rec.cpuload  = (uint16_t)(acc.cpuload / acc.nsamples);
+          rec.nsamples = acc.nsamples;
+
+          telemetry_store(&t, &rec, decimation);
+          memset(&acc, 0, sizeof(struct telemetry_accum_s));
+          nrecords++;
+
+          if (verbose)
+            {
+              printf("%8lu ms V: %lu I: %ld (peak %ld) CPU: %u.%u%% "
+                     "Heap: %lu\n",
+                     (unsigned long)rec.time, (unsigned long)rec.voltage,
+                     (long)rec.current, (long)rec.peak,
+                     rec.cpuload / 10, rec.cpuload % 10,
+                     (unsigned long)rec.memused);
+            }
+        }
+
+      /* Sleep until the next sample is due */
+
+      next += period;
+      now   = telemetry_msec();
+      if ((int32_t)(next - now) > 0)
+        {
+          usleep((next - now) * 1000);
+        }
+      else
+        {
+          next = now;
+        }
+    }
+
+  /* Hand over the last, partial block, wait for the writer to drain the
+   * ring and stop it.
+   */
+
+  hdr = TELEMETRY_BLOCK(&t, t.head);
+  while (hdr->nrecords > 0 && !telemetry_advance(&t, decimation))
+    {
+      usleep(period * 1000);
+    }
+
+  sem_post(&t.full);
+  (void)pthread_join(writer, NULL);
+
+  if (t.error != 0)
+    {
+      fprintf(stderr, "ERROR: Write to %s failed: %d\n", logfile, t.error);
+      ret = EXIT_FAILURE;
+    }
+  else
+    {
+      (void)fsync(t.logfd);
+      ret = EXIT_SUCCESS;
+    }
+
+  printf("telemetry: %lu records, %lu blocks written, %lu dropped\n",
+         (unsigned long)nrecords, (unsigned long)t.written,
+         (unsigned long)t.dropped);
+
+errout_with_sem:
+  sem_destroy(&t.full);
+  free(t.ring);
+
+errout_with_fds:
+  if (t.logfd >= 0)
+    {
+      close(t.logfd);
+    }
+
+#ifndef TELEMETRY_HAVE_CPULOAD
+  if (t.loadfd >= 0)
+    {
+      close(t.loadfd);
+    }
+#endif
 
- /****************************************************************************
-  * hello_main
-  ****************************************************************************/
-
- #ifdef CONFIG_BUILD_KERNEL
- int main(int argc, FAR char *argv[])
- #else
- int telemetry_main(int argc, char *argv[])
- #endif
- {
-   //File descriptors
-   FILE *fd_save;
-   FILE *fd_sensor;
-   FILE *fd_cpu;
-   FILE *fd_mem;
-
-   //Buffers
-   char cpuload_buf[6];
-   char meminfo_buf[256];
-   char buffer[256];
-   char buffer_2[256];
-
-   //Auxilary Variables
-   int i=0;
-   char aux_c;
-   int n=0;
-   char aux[10];
-   int iterations=0;
-   int iterations_counter=0;
-
-   //Checking the arguments of the function.
-   if(argc<4){
-     //It's neccesary almost the name of the file
-     printf("Correct: telemetry file.txt number_measures show_option\n");
-     printf("If you want a continue measure, write i as argument \n");
-     printf("The available options are:\n s (to save in the sd card)\n");
-     printf("c (to see the data in the console) \n b (both modes)\n");
-     return -1;
-   }
-   else if(argc==4){
-     //This is to check the name of the file
-     sprintf(buffer,"/mnt/%s",argv[1]);
-     sprintf(buffer_2,"%s",argv[2]);
-
-     int num=atoi(argv[2]);
-     //To set the number of iterations
-     if(num>1 && num<=500){
-       iterations=num;
-     }
-     else if(strcmp(buffer_2,"i")==0){
-       iterations=-1;
-     }
-     else{
-       printf("Error, must be 1 to 500 iterations or i to continue measurement\n");
-       return -1;
-     }
-
-   }
-   else{
-     printf("Too much arguments\n");
-     printf("Correct: telemetry file.txt number_measures show_option\n");
-     printf("If you want a continue measure, write i as argument \n");
-     printf("The available options are:\n s (to save in the sd card)\n");
-     printf("c (to see the data in the console) \n b (both modes)\n");
-     return -1;
-   }
-
-
-
-   //Commands to mount the file system of the SD card and the data of the board
-   system("mount -t vfat /dev/mmcsd0 /mnt");
-   system("mount -t procfs /proc");
-
-   //Opening the Files
-   fd_save = fopen( buffer , "w" );
-   fd_cpu = fopen("/proc/cpuload", "r");
-   fd_mem = fopen("/proc/meminfo", "r");
-   fd_sensor = open("/dev/ina219", O_RDWR);
-
-   if(fd_save < 0 || fd_cpu < 0 || fd_mem < 0|| fd_sensor < 0){
-     printf("Error opening file\n");
-     return -1;
-   }
-
-   //This loop gets the data from the sensor and from the files, then it
-   //construct the message, and finally it save in the file
-   printf("Starting telemetry SD\n");
-   /*buffer="New Measure\n";//This is just in case we use the same file
-   fwrite(aux_buffer , 1 , n , fd_save );*/
-
-   while(iterations!=iterations_counter){
-     //Reading the value of sensor
-     read(fd_sensor, &sample, sizeof(sample));
-     //getting the data from the CPU
-     while(1){
-       aux_c = fgetc(fd_cpu);
-       if( feof(fd_cpu) ) break;
-       cpuload_buf[i]=aux_c;
-       i++;
-     }
-     i=0;
-     //getting the data from the CPU
-     while(1){
-       aux_c = fgetc(fd_mem);
-       if( feof(fd_mem) ) break;
-       meminfo_buf[i]=aux_c;
-       i++;
-     }
-     //With this loop, we look for the value of used SRAM
-     for(i=0;i<10;i++){
-       aux[i]=meminfo_buf[76+i];
-     }
-     i=127072 - atoi(aux);
-     //Creating the message
-     n=sprintf(buffer,"V: %4u mV I: %4u mA CPU: %s Free SRAM: %d Bytes\n",
-     sample.voltage,sample.current,cpuload_buf,i);
-     //Writing to the file
-     sprintf(buffer_2,"%s",argv[3]);
-     if(strcmp(buffer_2,"s")==0){
-       //Save in the SD
-       fwrite(buffer , 1 , n , fd_save );
-     }
-     else if(strcmp(buffer_2,"c")==0){
-       //Show in the console
-       printf(buffer);
-     }
-     else{
-       fwrite(buffer , 1 , n , fd_save );
-       printf(buffer);
-     }
-
-     usleep(200);
-     iterations_counter++;
-   }
-
-   //Closing the files
-   fclose(fd_save);
-   fclose(fd_cpu);
-   fclose(fd_mem);
-   close(fd_sensor);
-   return 0;
- }
+  close(sensorfd);
+  return ret;
+}
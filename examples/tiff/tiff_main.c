@@ -60,21 +60,13 @@
  * Other configuration options:
  *
  *  CONFIG_EXAMPLES_TIFF_OUTFILE - Name of the resulting TIFF file
- *  CONFIG_EXAMPLES_TIFF_TMPFILE1/2 - Names of two temporaries files that
- *    will be used in the file creation.
  */
 
 #ifndef CONFIG_EXAMPLES_TIFF_OUTFILE
 #  define CONFIG_EXAMPLES_TIFF_OUTFILE "/tmp/result.tif"
 #endif
 
-#ifndef CONFIG_EXAMPLES_TIFF_TMPFILE1
-#  define CONFIG_EXAMPLES_TIFF_TMPFILE1 "/tmp/tmpfile1.dat"
-#endif
-
-#ifndef CONFIG_EXAMPLES_TIFF_TMPFILE2
-#  define CONFIG_EXAMPLES_TIFF_TMPFILE2 "/tmp/tmpfile2.dat"
-#endif
+#define TIFF_IOSIZE 4096
 
 /****************************************************************************
  * Private Types
@@ -121,14 +113,12 @@ int tiff_main(int argc, char *argv[])
 
   memset(&info, 0, sizeof(struct tiff_info_s));
   info.outfile   = CONFIG_EXAMPLES_TIFF_OUTFILE;
-  info.tmpfile1  = CONFIG_EXAMPLES_TIFF_TMPFILE1;
-  info.tmpfile2  = CONFIG_EXAMPLES_TIFF_TMPFILE2;
   info.colorfmt  = FB_FMT_RGB24;
   info.rps       = 1;
   info.imgwidth  = 256;
   info.imgheight = 256;
-  info.iobuffer  = (uint8_t *)malloc(300);
-  info.iosize    = 300;
+  info.iobuffer  = (uint8_t *)malloc(TIFF_IOSIZE);
+  info.iosize    = TIFF_IOSIZE;
 
   /* Initialize the TIFF library */
 
@@ -40,10 +40,14 @@
 #include <nuttx/config.h>
 
 #include <sys/ioctl.h>
+#include <stdint.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 #include <fcntl.h>
 #include <signal.h>
+#include <time.h>
 #include <errno.h>
 
 #include <nuttx/timers/timer.h>
@@ -72,6 +76,16 @@
 #  define CONFIG_EXAMPLES_TIMER_SIGNO 17
 #endif
 
+#ifndef CONFIG_EXAMPLES_TIMER_JITTER_RING
+#  define CONFIG_EXAMPLES_TIMER_JITTER_RING 256
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define TIMER_CLOCK CLOCK_MONOTONIC
+#else
+#  define TIMER_CLOCK CLOCK_REALTIME
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -82,6 +96,10 @@
 
 static volatile unsigned long g_nsignals;
 
+/* Expiry errors of the most recent periods, in microseconds */
+
+static int32_t g_jitter[CONFIG_EXAMPLES_TIMER_JITTER_RING];
+
 /****************************************************************************
  * timer_sighandler
  ****************************************************************************/
@@ -127,6 +145,180 @@ static void timer_status(int fd)
          (unsigned long)status.timeleft, g_nsignals);
 }
 
+/****************************************************************************
+ * timer_usec
+ ****************************************************************************/
+
+static int64_t timer_usec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(TIMER_CLOCK, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * timer_compare
+ ****************************************************************************/
+
+static int timer_compare(FAR const void *a, FAR const void *b)
+{
+  int32_t x = *(FAR const int32_t *)a;
+  int32_t y = *(FAR const int32_t *)b;
+
+  return x < y ? -1 : x > y ? 1 : 0;
+}
+
+/****************************************************************************
+ * timer_jitter
+ *
+ * Description:
+ *   Wait for nperiods timer expirations with sigwaitinfo() and compare the
+ *   time of each with the time it was due.  Expiry k is due k + 1 intervals
+ *   after the timer was started, so the error does not accumulate from
+ *   period to period; a timer clock that drifts from the system clock shows
+ *   up as a steadily growing error.
+ *
+ *   A timer signal that is still pending when the next expiry occurs is not
+ *   queued twice, so a late task loses expiries.  Each signal is therefore
+ *   taken for the latest period already due (allowing it to be an eighth
+ *   of an interval early) and the periods skipped are counted as missed.
+ *
+ ****************************************************************************/
+
+static int timer_jitter(int fd, unsigned long interval,
+                        unsigned long nperiods)
+{
+  struct timer_notify_s notify;
+  struct timespec res;
+  sigset_t set;
+  int64_t first;
+  int64_t total = 0;
+  int64_t now;
+  int32_t err;
+  int32_t min = INT32_MAX;
+  int32_t max = INT32_MIN;
+  unsigned long missed = 0;
+  unsigned long count = 0;
+  long period = -1;
+  long k;
+  size_t n;
+  int ret;
+
+  /* The signal is taken synchronously, without a handler */
+
+  sigemptyset(&set);
+  sigaddset(&set, CONFIG_EXAMPLES_TIMER_SIGNO);
+  (void)sigprocmask(SIG_BLOCK, &set, NULL);
+
+  notify.arg   = NULL;
+  notify.pid   = getpid();
+  notify.signo = CONFIG_EXAMPLES_TIMER_SIGNO;
+
+  ret = ioctl(fd, TCIOC_NOTIFICATION, (unsigned long)((uintptr_t)&notify));
+  if (ret < 0)
+    {
+      fprintf(stderr, "ERROR: Failed to set the timer handler: %d\n", errno);
+      goto errout;
+    }
+
+  (void)clock_getres(TIMER_CLOCK, &res);
+  printf("Measuring %lu periods of %lu us, clock resolution %lu ns\n",
+         nperiods, interval, (unsigned long)res.tv_nsec);
+
+  first = timer_usec() + interval;
+  ret   = ioctl(fd, TCIOC_START, 0);
+  if (ret < 0)
+    {
+      fprintf(stderr, "ERROR: Failed to start the timer: %d\n", errno);
+      goto errout;
+    }
+
+  while (count < nperiods)
+    {
+      ret = sigwaitinfo(&set, NULL);
+      now = timer_usec();
+      if (ret < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          fprintf(stderr, "ERROR: sigwaitinfo failed: %d\n", errno);
+          break;
+        }
+
+      k = (long)((now - first + (int64_t)interval / 8) /
+                 (int64_t)interval);
+      if (k <= period)
+        {
+          k = period + 1;
+        }
+
+      missed += k - period - 1;
+
+      err    = (int32_t)(now - first - (int64_t)k * interval);
+      period = k;
+
+      g_jitter[count % CONFIG_EXAMPLES_TIMER_JITTER_RING] = err;
+      total += err;
+      count++;
+
+      if (err < min)
+        {
+          min = err;
+        }
+
+      if (err > max)
+        {
+          max = err;
+        }
+    }
+
+  (void)ioctl(fd, TCIOC_STOP, 0);
+
+  if (count == 0)
+    {
+      goto errout;
+    }
+
+  /* Percentiles of the periods still in the ring */
+
+  n = count < CONFIG_EXAMPLES_TIMER_JITTER_RING ?
+      count : CONFIG_EXAMPLES_TIMER_JITTER_RING;
+  qsort(g_jitter, n, sizeof(int32_t), timer_compare);
+
+  printf("Expiry error over %lu periods: min %ld max %ld mean %ld us, "
+         "%lu missed\n", count, (long)min, (long)max,
+         (long)(total / (int64_t)count), missed);
+  printf("Last %lu periods: p50 %ld p90 %ld p99 %ld p99.9 %ld us\n",
+         (unsigned long)n, (long)g_jitter[(n - 1) * 50 / 100],
+         (long)g_jitter[(n - 1) * 90 / 100],
+         (long)g_jitter[(n - 1) * 99 / 100],
+         (long)g_jitter[(n - 1) * 999 / 1000]);
+
+  ret = OK;
+
+errout:
+  (void)sigprocmask(SIG_UNBLOCK, &set, NULL);
+  return ret < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/****************************************************************************
+ * timer_showusage
+ ****************************************************************************/
+
+static void timer_showusage(FAR const char *progname, int exitcode)
+{
+  fprintf(stderr, "USAGE: %s [-i <usec>] [-j [-n <periods>]]\n", progname);
+  fprintf(stderr, "\t-i <usec>: Timer interval.  Default: %lu\n",
+          (unsigned long)CONFIG_EXAMPLES_TIMER_INTERVAL);
+  fprintf(stderr, "\t-j: Measure the expiry error of each period\n");
+  fprintf(stderr, "\t-n <periods>: Periods to measure.  Default: 1000\n");
+  exit(exitcode);
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -143,10 +335,45 @@ int timer_main(int argc, char *argv[])
 {
   struct timer_notify_s notify;
   struct sigaction act;
+  unsigned long interval = CONFIG_EXAMPLES_TIMER_INTERVAL;
+  unsigned long nperiods = 1000;
+  bool jitter = false;
+  int option;
   int ret;
   int fd;
   int i;
 
+  while ((option = getopt(argc, argv, "i:jn:h")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'i':
+            interval = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'j':
+            jitter = true;
+            break;
+
+          case 'n':
+            nperiods = strtoul(optarg, NULL, 0);
+            break;
+
+          case 'h':
+            timer_showusage(argv[0], EXIT_SUCCESS);
+            break;
+
+          default:
+            timer_showusage(argv[0], EXIT_FAILURE);
+            break;
+        }
+    }
+
+  if (interval == 0)
+    {
+      timer_showusage(argv[0], EXIT_FAILURE);
+    }
+
   /* Open the timer device */
 
   printf("Open %s\n", CONFIG_EXAMPLES_TIMER_DEVNAME);
@@ -165,10 +392,9 @@ int timer_main(int argc, char *argv[])
 
   /* Set the timer interval */
 
-  printf("Set timer interval to %lu\n",
-         (unsigned long)CONFIG_EXAMPLES_TIMER_INTERVAL);
+  printf("Set timer interval to %lu\n", interval);
 
-  ret = ioctl(fd, TCIOC_SETTIMEOUT, CONFIG_EXAMPLES_TIMER_INTERVAL);
+  ret = ioctl(fd, TCIOC_SETTIMEOUT, interval);
   if (ret < 0)
     {
       fprintf(stderr, "ERROR: Failed to set the timer interval: %d\n", errno);
@@ -176,6 +402,13 @@ int timer_main(int argc, char *argv[])
       return EXIT_FAILURE;
     }
 
+  if (jitter)
+    {
+      ret = timer_jitter(fd, interval, nperiods);
+      close(fd);
+      return ret;
+    }
+
   /* Show the timer status before attaching the timer handler */
 
   timer_status(fd);
@@ -52,6 +52,7 @@
 
 extern uavcan::ICanDriver &getCanDriver(void);
 extern uavcan::ISystemClock &getSystemClock(void);
+extern uavcan::uint64_t getCanErrorCount(void);
 
 /****************************************************************************
  * Public Functions
@@ -84,6 +85,8 @@ extern "C" int uavcan_main(int argc, FAR char *argv[])
 
   node.setModeOperational();
 
+  uavcan::uint64_t errors = getCanErrorCount();
+
   for (;;)
     {
       ret = node.spin(uavcan::MonotonicDuration::fromMSec(100));
@@ -91,6 +94,18 @@ extern "C" int uavcan_main(int argc, FAR char *argv[])
         {
           std::fprintf(stderr, "ERROR: node.spin failed: %d\n", ret);
         }
+
+      /* Report lost frames, e.g. when CONFIG_LIBUAVCAN_RX_QUEUE_CAPACITY
+       * is too small for the bus load.
+       */
+
+      uavcan::uint64_t count = getCanErrorCount();
+      if (count != errors)
+        {
+          std::fprintf(stderr, "WARNING: %lu new CAN errors\n",
+                       (unsigned long)(count - errors));
+          errors = count;
+        }
     }
 
   return EXIT_SUCCESS;
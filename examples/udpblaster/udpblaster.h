@@ -42,6 +42,7 @@
 
 #include "config.h"
 
+#include <stdint.h>
 #include <arpa/inet.h>
 
 /****************************************************************************
@@ -121,6 +122,24 @@
 
 #define UDPBLASTER_SENDSIZE MIN(UDPBLASTER_MSS, g_udpblaster_strlen)
 
+/* In the paced mode, each packet starts with a header giving its sequence
+ * number and the time (CLOCK_REALTIME) when it was sent, in network order.
+ */
+
+#define UDPBLASTER_MAGIC    0x55424c53
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+struct udpblaster_hdr_s
+{
+  uint32_t magic;
+  uint32_t seqno;
+  uint32_t tv_sec;
+  uint32_t tv_usec;
+};
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
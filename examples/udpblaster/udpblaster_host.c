@@ -39,8 +39,14 @@
 
 #include "config.h"
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
+#include <poll.h>
+#include <sys/time.h>
 #include <errno.h>
 
 #include <sys/socket.h>
@@ -48,6 +54,232 @@
 
 #include "udpblaster.h"
 
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Receive statistics of one interval */
+
+struct udpblaster_rxstats_s
+{
+  unsigned long npackets;   /* Packets received */
+  unsigned long nlost;      /* Sequence numbers skipped */
+  unsigned long nreordered; /* Packets that arrived late */
+  int64_t minlat;           /* Smallest receive - send time (usec) */
+  int64_t maxlat;           /* Largest receive - send time (usec) */
+  int64_t totlat;           /* Sum of receive - send times (usec) */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * udpblaster_rxreport
+ ****************************************************************************/
+
+static void udpblaster_rxreport(struct udpblaster_rxstats_s *stats,
+                                unsigned long interval)
+{
+  if (stats->npackets == 0)
+    {
+      printf("%6lu/sec: no packets\n", 0ul);
+      return;
+    }
+
+  printf("%6lu/sec: lost %lu reordered %lu latency %lld/%lld/%lld usec\n",
+         stats->npackets / interval, stats->nlost, stats->nreordered,
+         (long long)stats->minlat,
+         (long long)(stats->totlat / (int64_t)stats->npackets),
+         (long long)stats->maxlat);
+}
+
+/****************************************************************************
+ * udpblaster_receive
+ *
+ * Description:
+ *   Receive the packets of a target running in the paced mode and show,
+ *   for every interval, the packets per second received, the sequence
+ *   numbers lost, the packets reordered and the min/avg/max one-way
+ *   latency.  The latency is only absolute if the clocks of the host and
+ *   the target are synchronized; otherwise its changes are still
+ *   meaningful.  A report is shown at the end of every interval, also
+ *   when no packets arrived.
+ *
+ ****************************************************************************/
+
+static int udpblaster_receive(unsigned long interval)
+{
+#ifdef CONFIG_EXAMPLES_UDPBLASTER_IPv4
+  struct sockaddr_in host;
+#else
+  struct sockaddr_in6 host;
+#endif
+  static char packet[UDPBLASTER_MTU];
+  struct udpblaster_hdr_s *hdr = (struct udpblaster_hdr_s *)packet;
+  struct udpblaster_rxstats_s stats;
+  struct pollfd fds[1];
+  struct timeval tv;
+  uint32_t expected;
+  uint32_t first;
+  bool started;
+  uint32_t seqno;
+  int64_t latency;
+  int64_t now;
+  int64_t next;
+  ssize_t nrecvd;
+  int timeout;
+  int sockfd;
+  int ret;
+
+  memset(&host, 0, sizeof(host));
+#ifdef CONFIG_EXAMPLES_UDPBLASTER_IPv4
+  host.sin_family   = AF_INET;
+  host.sin_port     = HTONS(UDPBLASTER_HOST_PORTNO);
+  sockfd            = socket(PF_INET, SOCK_DGRAM, 0);
+#else
+  host.sin6_family  = AF_INET6;
+  host.sin6_port    = HTONS(UDPBLASTER_HOST_PORTNO);
+  sockfd            = socket(PF_INET6, SOCK_DGRAM, 0);
+#endif
+
+  if (sockfd < 0)
+    {
+      fprintf(stderr, "ERROR: socket() failed: %d\n", errno);
+      return 1;
+    }
+
+  if (bind(sockfd, (struct sockaddr *)&host, sizeof(host)) < 0)
+    {
+      fprintf(stderr, "ERROR: bind() failed: %d\n", errno);
+      return 1;
+    }
+
+  if (interval == 0)
+    {
+      interval = 1;
+    }
+
+  memset(&stats, 0, sizeof(stats));
+  expected = 0;
+  first    = 0;
+  started  = false;
+
+  gettimeofday(&tv, NULL);
+  next = ((int64_t)tv.tv_sec + interval) * 1000000 + tv.tv_usec;
+
+  fds[0].fd     = sockfd;
+  fds[0].events = POLLIN;
+
+  for (;;)
+    {
+      /* Report at the end of each interval whether or not packets arrive.
+       * Only the sequence numbers from first on were counted as lost in
+       * this interval.
+       */
+
+      gettimeofday(&tv, NULL);
+      now = (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+      if (now >= next)
+        {
+          udpblaster_rxreport(&stats, interval);
+          memset(&stats, 0, sizeof(stats));
+          first = expected;
+
+          next += (int64_t)interval * 1000000;
+          if (next <= now)
+            {
+              next = now + (int64_t)interval * 1000000;
+            }
+        }
+
+      timeout = (int)((next - now + 999) / 1000);
+      ret     = poll(fds, 1, timeout);
+      if (ret < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          fprintf(stderr, "ERROR: poll() failed: %d\n", errno);
+          return 1;
+        }
+      else if (ret == 0)
+        {
+          continue;
+        }
+
+      nrecvd = recv(sockfd, packet, sizeof(packet), 0);
+      if (nrecvd < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          fprintf(stderr, "ERROR: recv() failed: %d\n", errno);
+          return 1;
+        }
+
+      if (nrecvd < (ssize_t)sizeof(struct udpblaster_hdr_s) ||
+          ntohl(hdr->magic) != UDPBLASTER_MAGIC)
+        {
+          continue;
+        }
+
+      gettimeofday(&tv, NULL);
+
+      /* A jump back by a large amount means that the target restarted.  A
+       * late packet is taken back from the losses only if it was counted
+       * as lost in this interval.
+       */
+
+      seqno = ntohl(hdr->seqno);
+      if (started && seqno < expected && expected - seqno <= 0x10000)
+        {
+          stats.nreordered++;
+          if (seqno - first < expected - first && stats.nlost > 0)
+            {
+              stats.nlost--;
+            }
+        }
+      else
+        {
+          if (started && seqno > expected)
+            {
+              stats.nlost += seqno - expected;
+            }
+
+          else if (!started || seqno < expected)
+            {
+              first = seqno;
+            }
+
+          expected = seqno + 1;
+          started  = true;
+        }
+
+      latency = ((int64_t)tv.tv_sec - (int64_t)ntohl(hdr->tv_sec)) * 1000000 +
+                ((int64_t)tv.tv_usec - (int64_t)ntohl(hdr->tv_usec));
+
+      if (stats.npackets == 0 || latency < stats.minlat)
+        {
+          stats.minlat = latency;
+        }
+
+      if (stats.npackets == 0 || latency > stats.maxlat)
+        {
+          stats.maxlat = latency;
+        }
+
+      stats.totlat += latency;
+      stats.npackets++;
+    }
+
+  return 0; /* Won't get here */
+}
+
 /****************************************************************************
  * main
  ****************************************************************************/
@@ -67,6 +299,13 @@ int main(int argc, char **argv, char **envp)
   int sockfd;
   int ret;
 
+  /* host -r [<interval>] receives from a target in the paced mode */
+
+  if (argc > 1 && strcmp(argv[1], "-r") == 0)
+    {
+      return udpblaster_receive(argc > 2 ? strtoul(argv[2], NULL, 0) : 1);
+    }
+
 #ifdef CONFIG_EXAMPLES_UDPBLASTER_IPv4
   target.sin_family             = AF_INET;
   target.sin_port               = HTONS(UDPBLASTER_TARGET_PORTNO);
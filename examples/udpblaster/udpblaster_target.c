@@ -39,7 +39,12 @@
 
 #include "config.h"
 
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
 #include <errno.h>
 #include <debug.h>
 
@@ -48,6 +53,7 @@
 #include <netinet/in.h>
 
 #include "netutils/netlib.h"
+#include "system/benchutil.h"
 
 #include "udpblaster.h"
 
@@ -55,6 +61,22 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+#ifndef CONFIG_EXAMPLES_UDPBLASTER_RATE
+#  define CONFIG_EXAMPLES_UDPBLASTER_RATE 100
+#endif
+
+#ifndef CONFIG_EXAMPLES_UDPBLASTER_BURST
+#  define CONFIG_EXAMPLES_UDPBLASTER_BURST 4
+#endif
+
+#ifndef CONFIG_EXAMPLES_UDPBLASTER_STEP
+#  define CONFIG_EXAMPLES_UDPBLASTER_STEP 0
+#endif
+
+#ifndef CONFIG_EXAMPLES_UDPBLASTER_INTERVAL
+#  define CONFIG_EXAMPLES_UDPBLASTER_INTERVAL 1
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -183,6 +205,118 @@ static void netest_initialize(void)
 }
 #endif /*CONFIG_EXAMPLES_UDPBLASTER_INIT */
 
+#ifdef CONFIG_EXAMPLES_UDPBLASTER_PACED
+/****************************************************************************
+ * Name: udpblaster_paced
+ *
+ * Description:
+ *   Send sequence numbered, time stamped packets at a controlled rate.  A
+ *   token bucket holding up to CONFIG_EXAMPLES_UDPBLASTER_BURST packets is
+ *   refilled at the current rate, and the rate is raised by step packets
+ *   per second after every interval.  The packets per second sent and the
+ *   packets that the stack refused are shown for each interval.
+ *
+ ****************************************************************************/
+
+static int udpblaster_paced(int sockfd, FAR struct sockaddr *host,
+                            socklen_t addrlen, unsigned long rate,
+                            unsigned long step, unsigned long interval)
+{
+  static char packet[UDPBLASTER_MSS];
+  FAR struct udpblaster_hdr_s *hdr = (FAR struct udpblaster_hdr_s *)packet;
+  struct timespec ts;
+  uint64_t tokens;
+  uint64_t depth;
+  uint64_t last;
+  uint64_t next;
+  uint64_t now;
+  unsigned long nsent;
+  unsigned long nfailed;
+  uint32_t seqno;
+  size_t sendsize;
+  int ret;
+
+  sendsize = UDPBLASTER_SENDSIZE;
+  if (sendsize < sizeof(struct udpblaster_hdr_s))
+    {
+      sendsize = sizeof(struct udpblaster_hdr_s);
+    }
+
+  memcpy(packet, g_udpblaster_text, UDPBLASTER_SENDSIZE);
+  hdr->magic = HTONL(UDPBLASTER_MAGIC);
+
+  printf("Pacing %lu byte packets from %lu/sec, step %lu every %lu sec\n",
+         (unsigned long)sendsize, rate, step, interval);
+
+  /* Tokens are in millionths of a packet so that the refill is exact */
+
+  depth   = (uint64_t)CONFIG_EXAMPLES_UDPBLASTER_BURST * 1000000;
+  tokens  = depth;
+  last    = benchutil_usec();
+  next    = last + (uint64_t)interval * 1000000;
+  nsent   = 0;
+  nfailed = 0;
+  seqno   = 0;
+
+  for (; ; )
+    {
+      now     = benchutil_usec();
+      tokens += (now - last) * rate;
+      last    = now;
+
+      if (tokens > depth)
+        {
+          tokens = depth;
+        }
+
+      if (tokens < 1000000)
+        {
+          usleep((useconds_t)((1000000 - tokens) / rate) + 1);
+          continue;
+        }
+
+      tokens -= 1000000;
+
+      (void)clock_gettime(CLOCK_REALTIME, &ts);
+      hdr->seqno   = HTONL(seqno);
+      hdr->tv_sec  = HTONL((uint32_t)ts.tv_sec);
+      hdr->tv_usec = HTONL((uint32_t)(ts.tv_nsec / 1000));
+      seqno++;
+
+      ret = sendto(sockfd, packet, sendsize, 0, host, addrlen);
+      if (ret < 0)
+        {
+          /* Running out of buffers is what is being measured */
+
+          if (errno != ENOMEM && errno != EAGAIN)
+            {
+              fprintf(stderr, "ERROR: sendto() failed: %d\n", errno);
+              return 1;
+            }
+
+          nfailed++;
+        }
+      else
+        {
+          nsent++;
+        }
+
+      if (now >= next)
+        {
+          printf("rate %6lu/sec: sent %6lu/sec, refused %lu\n", rate,
+                 nsent / interval, nfailed);
+
+          nsent    = 0;
+          nfailed  = 0;
+          rate    += step;
+          next    += (uint64_t)interval * 1000000;
+        }
+    }
+
+  return 0; /* Won't get here */
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -209,6 +343,35 @@ int udpblaster_main(int argc, char *argv[])
   int ndots;
   int sockfd;
   int ret;
+#ifdef CONFIG_EXAMPLES_UDPBLASTER_PACED
+  unsigned long rate = CONFIG_EXAMPLES_UDPBLASTER_RATE;
+  unsigned long step = CONFIG_EXAMPLES_UDPBLASTER_STEP;
+  unsigned long interval = CONFIG_EXAMPLES_UDPBLASTER_INTERVAL;
+
+  /* udpblaster [<rate> [<step> [<interval>]]] */
+
+  if (argc > 1)
+    {
+      rate = strtoul(argv[1], NULL, 0);
+    }
+
+  if (argc > 2)
+    {
+      step = strtoul(argv[2], NULL, 0);
+    }
+
+  if (argc > 3)
+    {
+      interval = strtoul(argv[3], NULL, 0);
+    }
+
+  if (rate == 0 || interval == 0)
+    {
+      fprintf(stderr, "USAGE: %s [<rate> [<step> [<interval>]]]\n",
+              argv[0]);
+      return 1;
+    }
+#endif
 
 #ifdef CONFIG_EXAMPLES_UDPBLASTER_INIT
   /* Initialize the network */
@@ -277,6 +440,11 @@ int udpblaster_main(int argc, char *argv[])
     }
 #endif
 
+#ifdef CONFIG_EXAMPLES_UDPBLASTER_PACED
+  return udpblaster_paced(sockfd, (FAR struct sockaddr *)&host, addrlen,
+                          rate, step, interval);
+#endif
+
   npackets = 0;
   ndots    = 0;
 
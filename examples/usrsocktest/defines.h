@@ -69,6 +69,7 @@
     .endpoint_block_send = false, \
     .endpoint_recv_avail_from_start = true, \
     .endpoint_recv_avail = 4, \
+    .endpoint_bulk = false, \
   }
 
 /* Test case macros */
@@ -146,6 +147,7 @@ struct usrsocktest_daemon_conf_s
   bool endpoint_block_connect:1;
   bool endpoint_block_send:1;
   bool endpoint_recv_avail_from_start:1;
+  bool endpoint_bulk:1;
   uint8_t endpoint_recv_avail:8;
   const char *endpoint_addr;
   uint16_t endpoint_port;
@@ -209,4 +211,10 @@ bool usrsocktest_send_delayed_command(char cmd, unsigned int delay_msec);
 
 int usrsocktest_daemon_pause_usrsock_handling(bool pause);
 
+int usrsocktest_daemon_get_num_requests(void);
+
+int usrsocktest_daemon_get_num_wakeups(void);
+
+int usrsocktest_bench(void);
+
 #endif /* __EXAMPLES_USRSOCKTEST_DEFINES_H */
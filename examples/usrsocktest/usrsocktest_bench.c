@@ -0,0 +1,394 @@
+/****************************************************************************
+ * examples/usrsocktest/usrsocktest_bench.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/socket.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "defines.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_USRSOCKTEST_BENCH_DURATION
+#  define CONFIG_EXAMPLES_USRSOCKTEST_BENCH_DURATION 1000
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define BENCH_CLOCK CLOCK_MONOTONIC
+#else
+#  define BENCH_CLOCK CLOCK_REALTIME
+#endif
+
+#define BENCH_MAXSIZE 4096
+#define BENCH_NTHREADS 4
+
+#ifndef ARRAY_SIZE
+#  define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum bench_op_e
+{
+  BENCH_GETSOCKNAME = 0,
+  BENCH_SEND,
+  BENCH_RECV
+};
+
+struct bench_result_s
+{
+  unsigned long nops;
+  unsigned long nbytes;
+  int error;
+};
+
+struct bench_thread_s
+{
+  pthread_t tid;
+  int sd;
+  FAR uint8_t *buf;
+  size_t size;
+  struct bench_result_s result;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const size_t sizes[] =
+{
+  16, 256, 1024, BENCH_MAXSIZE
+};
+
+static uint8_t buffers[BENCH_NTHREADS][BENCH_MAXSIZE];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t bench_msec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(BENCH_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static int bench_connect(void)
+{
+  struct sockaddr_in addr;
+  int sd;
+
+  sd = socket(AF_INET, SOCK_STREAM, 0);
+  if (sd < 0)
+    return -errno;
+
+  inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr.s_addr);
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(255);
+  if (connect(sd, (FAR const struct sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+      int err = errno;
+
+      close(sd);
+      return -err;
+    }
+
+  return sd;
+}
+
+/* Repeat one operation for the benchmark duration */
+
+static void bench_loop(int sd, enum bench_op_e op, FAR uint8_t *buf,
+                       size_t size, FAR struct bench_result_s *result)
+{
+  struct sockaddr_in addr;
+  socklen_t addrlen;
+  uint32_t start;
+  ssize_t ret;
+
+  memset(result, 0, sizeof(*result));
+  start = bench_msec();
+
+  do
+    {
+      switch (op)
+        {
+        case BENCH_GETSOCKNAME:
+          addrlen = sizeof(addr);
+          ret = getsockname(sd, (FAR struct sockaddr *)&addr, &addrlen);
+          break;
+
+        case BENCH_SEND:
+          ret = send(sd, buf, size, 0);
+          break;
+
+        case BENCH_RECV:
+        default:
+          ret = recv(sd, buf, size, 0);
+          break;
+        }
+
+      if (ret < 0)
+        {
+          result->error = errno;
+          return;
+        }
+
+      result->nops++;
+      if (op != BENCH_GETSOCKNAME)
+        result->nbytes += ret;
+    }
+  while (bench_msec() - start < CONFIG_EXAMPLES_USRSOCKTEST_BENCH_DURATION);
+}
+
+static void bench_report(FAR const char *name, size_t size,
+                         FAR const struct bench_result_s *result,
+                         int nrequests, int nwakeups)
+{
+  unsigned long msec = CONFIG_EXAMPLES_USRSOCKTEST_BENCH_DURATION;
+
+  printf("  %-12s %5lu %9lu %10lu %8lu.%02lu",
+         name, (unsigned long)size, result->nops * 1000 / msec,
+         result->nbytes * 1000 / msec,
+         nwakeups > 0 ? (unsigned long)nrequests / nwakeups : 0,
+         nwakeups > 0 ? (unsigned long)(nrequests * 100 / nwakeups) % 100 : 0);
+
+  if (result->error != 0)
+    printf("  (error %d)", result->error);
+
+  printf("\n");
+  fflush(stdout);
+}
+
+/* Run one operation and report it with the daemon's request and wakeup
+ * counts for the same time.
+ */
+
+static void bench_run(int sd, FAR const char *name, enum bench_op_e op,
+                      size_t size)
+{
+  struct bench_result_s result;
+  int nrequests;
+  int nwakeups;
+
+  nrequests = usrsocktest_daemon_get_num_requests();
+  nwakeups = usrsocktest_daemon_get_num_wakeups();
+
+  bench_loop(sd, op, buffers[0], size, &result);
+
+  nrequests = usrsocktest_daemon_get_num_requests() - nrequests;
+  nwakeups = usrsocktest_daemon_get_num_wakeups() - nwakeups;
+
+  bench_report(name, size, &result, nrequests, nwakeups);
+}
+
+static FAR void *bench_thread(FAR void *param)
+{
+  FAR struct bench_thread_s *thread = param;
+
+  bench_loop(thread->sd, BENCH_SEND, thread->buf, thread->size,
+             &thread->result);
+  return NULL;
+}
+
+/* Send on BENCH_NTHREADS sockets at once, so that requests queue up in the
+ * daemon.
+ */
+
+static void bench_parallel(size_t size)
+{
+  struct bench_thread_s threads[BENCH_NTHREADS];
+  struct bench_result_s total;
+  int nrequests;
+  int nwakeups;
+  int i;
+
+  memset(&total, 0, sizeof(total));
+  memset(threads, 0, sizeof(threads));
+  for (i = 0; i < BENCH_NTHREADS; i++)
+    {
+      threads[i].sd = -1;
+    }
+
+  for (i = 0; i < BENCH_NTHREADS; i++)
+    {
+      threads[i].sd = bench_connect();
+      threads[i].buf = buffers[i];
+      threads[i].size = size;
+      if (threads[i].sd < 0)
+        {
+          total.error = -threads[i].sd;
+          goto errout;
+        }
+    }
+
+  nrequests = usrsocktest_daemon_get_num_requests();
+  nwakeups = usrsocktest_daemon_get_num_wakeups();
+
+  for (i = 0; i < BENCH_NTHREADS; i++)
+    {
+      if (pthread_create(&threads[i].tid, NULL, bench_thread,
+                         &threads[i]) != 0)
+        {
+          threads[i].tid = 0;
+        }
+    }
+
+  for (i = 0; i < BENCH_NTHREADS; i++)
+    {
+      if (threads[i].tid != 0)
+        {
+          pthread_join(threads[i].tid, NULL);
+        }
+
+      total.nops += threads[i].result.nops;
+      total.nbytes += threads[i].result.nbytes;
+      if (threads[i].result.error != 0)
+        total.error = threads[i].result.error;
+    }
+
+  nrequests = usrsocktest_daemon_get_num_requests() - nrequests;
+  nwakeups = usrsocktest_daemon_get_num_wakeups() - nwakeups;
+
+  bench_report("send x4", size, &total, nrequests, nwakeups);
+
+errout:
+  for (i = 0; i < BENCH_NTHREADS; i++)
+    {
+      if (threads[i].sd >= 0)
+        close(threads[i].sd);
+    }
+}
+
+static int bench_mode(bool bulk)
+{
+  struct usrsocktest_daemon_conf_s dconf = usrsocktest_daemon_defconf;
+  int sd;
+  int i;
+  int ret;
+
+  dconf.endpoint_bulk = bulk;
+  ret = usrsocktest_daemon_start(&dconf);
+  if (ret < 0)
+    {
+      printf("Failed to start the daemon: %d\n", ret);
+      return ret;
+    }
+
+  printf("\n%s daemon:\n", bulk ? "Bulk" : "Default");
+  printf("  %-12s %5s %9s %10s %11s\n", "Operation", "Size", "Ops/sec",
+         "Bytes/sec", "Reqs/wakeup");
+
+  sd = bench_connect();
+  if (sd < 0)
+    {
+      printf("Failed to connect: %d\n", sd);
+      ret = sd;
+      goto out;
+    }
+
+  bench_run(sd, "getsockname", BENCH_GETSOCKNAME, 0);
+
+  for (i = 0; i < ARRAY_SIZE(sizes); i++)
+    {
+      bench_run(sd, "send", BENCH_SEND, sizes[i]);
+    }
+
+  /* The default daemon has only a few bytes to receive, after which recv()
+   * blocks.
+   */
+
+  if (bulk)
+    {
+      for (i = 0; i < ARRAY_SIZE(sizes); i++)
+        {
+          bench_run(sd, "recv", BENCH_RECV, sizes[i]);
+        }
+    }
+
+  close(sd);
+
+  bench_parallel(1024);
+
+out:
+  usrsocktest_daemon_stop();
+  return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: usrsocktest_bench
+ *
+ * Description:
+ *   Measure operations and bytes per second through /dev/usrsock, with the
+ *   test daemon in its default mode and in bulk mode.  Bulk mode takes and
+ *   returns whole buffers, does not yield between requests and handles all
+ *   queued requests on each wakeup.
+ *
+ ****************************************************************************/
+
+int usrsocktest_bench(void)
+{
+  int ret;
+
+  printf("usrsock benchmark, %d msec per test\n",
+         CONFIG_EXAMPLES_USRSOCKTEST_BENCH_DURATION);
+
+  ret = bench_mode(false);
+  if (ret >= 0)
+    {
+      ret = bench_mode(true);
+    }
+
+  return ret;
+}
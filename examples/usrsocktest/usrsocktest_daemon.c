@@ -70,6 +70,13 @@
 #define TEST_SOCKET_SOCKID_BASE 10000U
 #define TEST_SOCKET_COUNT 8
 
+/* In bulk mode, data moves through this buffer in chunks of its size and
+ * at most this many queued requests are handled per wakeup.
+ */
+
+#define BULK_BUFSIZE 512
+#define BULK_MAX_BATCH 16
+
 #ifndef ARRAY_SIZE
 #  define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
 #endif
@@ -123,6 +130,8 @@ static struct daemon_priv_s
   unsigned int sockets_remote_disconnected;
   size_t total_send_bytes;
   size_t total_recv_bytes;
+  unsigned int total_requests;
+  unsigned int total_wakeups;
   bool do_not_poll_usrsock;
 
   struct test_socket_s test_sockets[TEST_SOCKET_COUNT];
@@ -135,6 +144,8 @@ static struct daemon_priv_s
 
 static pthread_mutex_t daemon_mutex = PTHREAD_MUTEX_INITIALIZER;
 
+static uint8_t bulkbuf[BULK_BUFSIZE];
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -649,7 +660,27 @@ static int sendto_request(int fd, FAR struct daemon_priv_s *priv,
 
   /* Can send? */
 
-  if (!tsock->block_send)
+  if (!tsock->block_send && priv->conf->endpoint_bulk)
+    {
+      /* Take all of the data, a buffer full at a time. */
+
+      while (sendbuflen < req->buflen)
+        {
+          rlen = req->buflen - sendbuflen;
+          if (rlen > sizeof(bulkbuf))
+            rlen = sizeof(bulkbuf);
+
+          rlen = read(fd, bulkbuf, rlen);
+          if (rlen <= 0)
+            {
+              ret = -EFAULT;
+              goto prepare;
+            }
+
+          sendbuflen += rlen;
+        }
+    }
+  else if (!tsock->block_send)
     {
       /* Check if request has data. */
 
@@ -784,9 +815,13 @@ static int recvfrom_request(int fd, FAR struct daemon_priv_s *priv,
 
   get_endpoint_sockaddr(tsock->endp, &endpointaddr);
 
-  /* Do we have recv data available? */
+  /* Do we have recv data available?  There is no end to it in bulk mode. */
 
-  if (tsock->recv_avail_bytes > 0)
+  if (priv->conf->endpoint_bulk)
+    {
+      outbuflen = req->max_buflen;
+    }
+  else if (tsock->recv_avail_bytes > 0)
     {
       outbuflen = req->max_buflen;
 
@@ -871,7 +906,24 @@ prepare:
         return -ENOSPC;
     }
 
-  if (resp.reqack.result > 0)
+  if (resp.reqack.result > 0 && priv->conf->endpoint_bulk)
+    {
+      /* Send buffer, a chunk at a time */
+
+      for (i = 0; i < resp.reqack.result; i += wlen)
+        {
+          outbuflen = resp.reqack.result - i;
+          if (outbuflen > sizeof(bulkbuf))
+            outbuflen = sizeof(bulkbuf);
+
+          wlen = write(fd, bulkbuf, outbuflen);
+          if (wlen < 0)
+            return -errno;
+          if (wlen == 0)
+            return -ENOSPC;
+        }
+    }
+  else if (resp.reqack.result > 0)
     {
       /* Send buffer */
 
@@ -892,7 +944,7 @@ prepare:
         priv->sockets_recv_empty++;
     }
 
-  if (tsock->recv_avail_bytes > 0)
+  if (tsock->recv_avail_bytes > 0 || priv->conf->endpoint_bulk)
     {
       /* Let kernel-side know that there is more recv data. */
 
@@ -1493,8 +1545,31 @@ static FAR void *usrsocktest_daemon(FAR void *param)
 
       if (usrsock_pfdpos >= 0 && (pfd[usrsock_pfdpos].revents & POLLIN))
         {
+          int nbatch = 0;
+
           pthread_mutex_lock(&daemon_mutex);
-          ret = handle_usrsock_request(fd, priv);
+          priv->total_wakeups++;
+
+          do
+            {
+              ret = handle_usrsock_request(fd, priv);
+              if (ret < 0)
+                break;
+
+              priv->total_requests++;
+
+              /* In bulk mode, handle the requests that have queued up
+               * meanwhile before polling again.
+               */
+
+              pfd[usrsock_pfdpos].revents = 0;
+              if (priv->conf->endpoint_bulk && ++nbatch < BULK_MAX_BATCH)
+                {
+                  (void)poll(&pfd[usrsock_pfdpos], 1, 0);
+                }
+            }
+          while (pfd[usrsock_pfdpos].revents & POLLIN);
+
           pthread_mutex_unlock(&daemon_mutex);
           if (ret < 0)
             goto errout;
@@ -1558,7 +1633,12 @@ static FAR void *usrsocktest_daemon(FAR void *param)
             }
         }
 
-      usleep(1);
+      /* Yield between requests, unless going for throughput: this sleeps
+       * for at least one tick.
+       */
+
+      if (!priv->conf->endpoint_bulk)
+        usleep(1);
     }
   while (!stopped);
 
@@ -1863,6 +1943,30 @@ int usrsocktest_daemon_get_num_remote_disconnected_sockets(void)
   return ret;
 }
 
+int usrsocktest_daemon_get_num_requests(void)
+{
+  FAR struct daemon_priv_s *priv = &daemon;
+  int ret, err;
+
+  err = get_daemon_value(priv, &ret, &priv->total_requests, sizeof(ret));
+  if (err < 0)
+    return err;
+
+  return ret;
+}
+
+int usrsocktest_daemon_get_num_wakeups(void)
+{
+  FAR struct daemon_priv_s *priv = &daemon;
+  int ret, err;
+
+  err = get_daemon_value(priv, &ret, &priv->total_wakeups, sizeof(ret));
+  if (err < 0)
+    return err;
+
+  return ret;
+}
+
 int usrsocktest_daemon_pause_usrsock_handling(bool pause)
 {
   FAR struct daemon_priv_s *priv = &daemon;
@@ -254,6 +254,13 @@ int usrsocktest_main(int argc, char *argv[])
 {
   struct mallinfo mem_before, mem_after;
 
+  if (argc > 1 && strcmp(argv[1], "-b") == 0)
+    {
+      /* Benchmark instead of unit-tests */
+
+      return usrsocktest_bench() < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
   memset(&overall, 0, sizeof(overall));
 
   printf("Starting unit-tests...\n");
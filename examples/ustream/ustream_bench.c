@@ -0,0 +1,742 @@
+/****************************************************************************
+ * examples/ustream/ustream_bench.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <mqueue.h>
+#include <time.h>
+#include <errno.h>
+
+#include "system/benchutil.h"
+
+#include "ustream.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_EXAMPLES_USTREAM_BENCH_SIZES
+#  define CONFIG_EXAMPLES_USTREAM_BENCH_SIZES "16,64,256,1024"
+#endif
+
+#ifndef CONFIG_EXAMPLES_USTREAM_BENCH_COUNT
+#  define CONFIG_EXAMPLES_USTREAM_BENCH_COUNT 1000
+#endif
+
+#define BENCH_MAXSIZES 16
+#define BENCH_MQNAME   "ipcbench%d"
+#define BENCH_MQDEPTH  8
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum bench_kind_e
+{
+  BENCH_PIPE = 0,  /* A pair of pipes */
+  BENCH_MQUEUE,    /* A pair of message queues */
+  BENCH_STREAM,    /* A connected pair of SOCK_STREAM local sockets */
+  BENCH_DGRAM,     /* A pair of bound SOCK_DGRAM local sockets */
+  BENCH_NKINDS
+};
+
+/* One end of the IPC channel.  The main thread owns end 0 and the peer
+ * thread owns end 1.
+ */
+
+struct bench_end_s
+{
+  int txfd;
+  int rxfd;
+#ifndef CONFIG_DISABLE_MQUEUE
+  mqd_t txmq;
+  mqd_t rxmq;
+#endif
+  struct sockaddr_un peer;
+  socklen_t peerlen;
+};
+
+struct bench_s
+{
+  enum bench_kind_e kind;
+  size_t size;
+  int count;
+  int listensd;
+  struct bench_end_s end[2];
+  FAR uint8_t *buffer[2];
+};
+
+struct bench_result_s
+{
+  uint32_t lat_avg;   /* Average round trip time (usec) */
+  uint32_t lat_max;   /* Worst round trip time (usec) */
+  uint32_t msgs;      /* One-way messages per second */
+  uint32_t kbps;      /* One-way throughput (Kbytes per second) */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char *g_kindname[BENCH_NKINDS] =
+{
+  "pipe", "mqueue", "stream", "dgram"
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void bench_mkaddr(FAR struct sockaddr_un *addr, FAR socklen_t *len,
+                         int end)
+{
+  memset(addr, 0, sizeof(*addr));
+  addr->sun_family = AF_LOCAL;
+  snprintf(addr->sun_path, UNIX_PATH_MAX, "%s.b%d",
+           CONFIG_EXAMPLES_USTREAM_ADDR, end);
+  *len = sizeof(sa_family_t) + strlen(addr->sun_path) + 1;
+}
+
+static int bench_send(FAR struct bench_s *bench, int end,
+                      FAR const uint8_t *buf, size_t len)
+{
+  FAR struct bench_end_s *ep = &bench->end[end];
+  ssize_t nsent;
+  size_t done;
+
+  switch (bench->kind)
+    {
+#ifndef CONFIG_DISABLE_MQUEUE
+      case BENCH_MQUEUE:
+        return mq_send(ep->txmq, (FAR const char *)buf, len, 0) < 0 ?
+               -errno : OK;
+#endif
+
+      case BENCH_DGRAM:
+        nsent = sendto(ep->txfd, buf, len, 0,
+                       (FAR struct sockaddr *)&ep->peer, ep->peerlen);
+        if (nsent < 0)
+          {
+            return -errno;
+          }
+
+        return (size_t)nsent == len ? OK : -EMSGSIZE;
+
+      default:
+        for (done = 0; done < len; done += nsent)
+          {
+            nsent = write(ep->txfd, &buf[done], len - done);
+            if (nsent < 0)
+              {
+                if (errno == EINTR)
+                  {
+                    nsent = 0;
+                    continue;
+                  }
+
+                return -errno;
+              }
+          }
+
+        return OK;
+    }
+}
+
+static int bench_recv(FAR struct bench_s *bench, int end,
+                      FAR uint8_t *buf, size_t len)
+{
+  FAR struct bench_end_s *ep = &bench->end[end];
+  ssize_t nrecvd;
+  size_t done;
+
+  switch (bench->kind)
+    {
+#ifndef CONFIG_DISABLE_MQUEUE
+      case BENCH_MQUEUE:
+        nrecvd = mq_receive(ep->rxmq, (FAR char *)buf, bench->size, NULL);
+        return nrecvd < 0 ? -errno : OK;
+#endif
+
+      case BENCH_DGRAM:
+        nrecvd = recv(ep->rxfd, buf, len, 0);
+        return nrecvd < 0 ? -errno : OK;
+
+      default:
+        for (done = 0; done < len; done += nrecvd)
+          {
+            nrecvd = read(ep->rxfd, &buf[done], len - done);
+            if (nrecvd < 0)
+              {
+                if (errno == EINTR)
+                  {
+                    nrecvd = 0;
+                    continue;
+                  }
+
+                return -errno;
+              }
+            else if (nrecvd == 0)
+              {
+                return -ECONNRESET;
+              }
+          }
+
+        return OK;
+    }
+}
+
+/* The peer echoes every message of the latency phase and then swallows the
+ * messages of the throughput phase, answering with a one byte ack.
+ */
+
+static FAR void *bench_peer(FAR void *arg)
+{
+  FAR struct bench_s *bench = (FAR struct bench_s *)arg;
+  FAR uint8_t *buf = bench->buffer[1];
+  int ret = OK;
+  int i;
+
+  if (bench->kind == BENCH_STREAM)
+    {
+      struct sockaddr_un addr;
+      socklen_t addrlen;
+
+      bench_mkaddr(&addr, &addrlen, 0);
+      if (connect(bench->end[1].txfd, (FAR struct sockaddr *)&addr,
+                  addrlen) < 0)
+        {
+          return (FAR void *)(intptr_t)-errno;
+        }
+    }
+
+  for (i = 0; i < bench->count && ret >= 0; i++)
+    {
+      ret = bench_recv(bench, 1, buf, bench->size);
+      if (ret >= 0)
+        {
+          ret = bench_send(bench, 1, buf, bench->size);
+        }
+    }
+
+  for (i = 0; i < bench->count && ret >= 0; i++)
+    {
+      ret = bench_recv(bench, 1, buf, bench->size);
+    }
+
+  if (ret >= 0)
+    {
+      ret = bench_send(bench, 1, buf, 1);
+    }
+
+  return (FAR void *)(intptr_t)ret;
+}
+
+static void bench_close(FAR struct bench_s *bench)
+{
+  struct sockaddr_un addr;
+  socklen_t addrlen;
+  int i;
+
+  for (i = 0; i < 2; i++)
+    {
+      FAR struct bench_end_s *ep = &bench->end[i];
+
+#ifndef CONFIG_DISABLE_MQUEUE
+      if (bench->kind == BENCH_MQUEUE)
+        {
+          char name[16];
+
+          if (ep->txmq != (mqd_t)-1)
+            {
+              mq_close(ep->txmq);
+            }
+
+          if (ep->rxmq != (mqd_t)-1)
+            {
+              mq_close(ep->rxmq);
+            }
+
+          snprintf(name, sizeof(name), BENCH_MQNAME, i);
+          mq_unlink(name);
+          continue;
+        }
+#endif
+
+      if (ep->rxfd >= 0 && ep->rxfd != ep->txfd)
+        {
+          close(ep->rxfd);
+        }
+
+      if (ep->txfd >= 0)
+        {
+          close(ep->txfd);
+        }
+    }
+
+  if (bench->listensd >= 0)
+    {
+      close(bench->listensd);
+    }
+
+  if (bench->kind == BENCH_STREAM || bench->kind == BENCH_DGRAM)
+    {
+      for (i = 0; i < 2; i++)
+        {
+          bench_mkaddr(&addr, &addrlen, i);
+          unlink(addr.sun_path);
+        }
+    }
+}
+
+/* Create both ends of the channel.  The client end of a stream connection
+ * is connected later by the peer thread.
+ */
+
+static int bench_open(FAR struct bench_s *bench)
+{
+  struct sockaddr_un addr;
+  socklen_t addrlen;
+  int i;
+
+  bench->listensd = -1;
+  for (i = 0; i < 2; i++)
+    {
+      bench->end[i].txfd = -1;
+      bench->end[i].rxfd = -1;
+#ifndef CONFIG_DISABLE_MQUEUE
+      bench->end[i].txmq = (mqd_t)-1;
+      bench->end[i].rxmq = (mqd_t)-1;
+#endif
+    }
+
+  switch (bench->kind)
+    {
+#ifdef CONFIG_PIPES
+      case BENCH_PIPE:
+        {
+          int fd[2];
+
+          for (i = 0; i < 2; i++)
+            {
+              if (pipe(fd) < 0)
+                {
+                  return -errno;
+                }
+
+              bench->end[i].txfd     = fd[1];
+              bench->end[i ^ 1].rxfd = fd[0];
+            }
+        }
+
+        return OK;
+#endif
+
+#ifndef CONFIG_DISABLE_MQUEUE
+      case BENCH_MQUEUE:
+        {
+          struct mq_attr attr;
+          char name[16];
+
+          memset(&attr, 0, sizeof(attr));
+          attr.mq_maxmsg  = BENCH_MQDEPTH;
+          attr.mq_msgsize = bench->size;
+
+          /* Queue i carries the messages towards end i */
+
+          for (i = 0; i < 2; i++)
+            {
+              snprintf(name, sizeof(name), BENCH_MQNAME, i);
+              mq_unlink(name);
+
+              bench->end[i].rxmq = mq_open(name, O_RDONLY | O_CREAT, 0666,
+                                           &attr);
+              if (bench->end[i].rxmq == (mqd_t)-1)
+                {
+                  return -errno;
+                }
+
+              bench->end[i ^ 1].txmq = mq_open(name, O_WRONLY);
+              if (bench->end[i ^ 1].txmq == (mqd_t)-1)
+                {
+                  return -errno;
+                }
+            }
+        }
+
+        return OK;
+#endif
+
+      case BENCH_STREAM:
+        bench->listensd = socket(PF_LOCAL, SOCK_STREAM, 0);
+        if (bench->listensd < 0)
+          {
+            return -errno;
+          }
+
+        bench_mkaddr(&addr, &addrlen, 0);
+        unlink(addr.sun_path);
+        if (bind(bench->listensd, (FAR struct sockaddr *)&addr,
+                 addrlen) < 0 || listen(bench->listensd, 1) < 0)
+          {
+            return -errno;
+          }
+
+        bench->end[1].txfd = socket(PF_LOCAL, SOCK_STREAM, 0);
+        if (bench->end[1].txfd < 0)
+          {
+            return -errno;
+          }
+
+        bench->end[1].rxfd = bench->end[1].txfd;
+        return OK;
+
+      case BENCH_DGRAM:
+        for (i = 0; i < 2; i++)
+          {
+            FAR struct bench_end_s *ep = &bench->end[i];
+
+            ep->txfd = socket(PF_LOCAL, SOCK_DGRAM, 0);
+            if (ep->txfd < 0)
+              {
+                return -errno;
+              }
+
+            ep->rxfd = ep->txfd;
+            bench_mkaddr(&addr, &addrlen, i);
+            unlink(addr.sun_path);
+            if (bind(ep->txfd, (FAR struct sockaddr *)&addr, addrlen) < 0)
+              {
+                return -errno;
+              }
+
+            bench_mkaddr(&ep->peer, &ep->peerlen, i ^ 1);
+          }
+
+        return OK;
+
+      default:
+        return -ENOSYS;
+    }
+}
+
+static int bench_run(enum bench_kind_e kind, size_t size, int count,
+                     FAR struct bench_result_s *result)
+{
+  struct bench_s bench;
+  FAR uint8_t *buf;
+  pthread_t peer;
+  FAR void *value;
+  uint64_t total;
+  uint64_t start;
+  uint64_t rtt;
+  int ret;
+  int i;
+
+  memset(&bench, 0, sizeof(bench));
+  bench.kind  = kind;
+  bench.size  = size;
+  bench.count = count;
+
+  bench.buffer[0] = (FAR uint8_t *)malloc(2 * size);
+  if (bench.buffer[0] == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  bench.buffer[1] = bench.buffer[0] + size;
+  buf = bench.buffer[0];
+  memset(buf, 0x5a, size);
+
+  ret = bench_open(&bench);
+  if (ret < 0)
+    {
+      goto errout;
+    }
+
+  ret = pthread_create(&peer, NULL, bench_peer, &bench);
+  if (ret != 0)
+    {
+      ret = -ret;
+      goto errout;
+    }
+
+  if (kind == BENCH_STREAM)
+    {
+      bench.end[0].txfd = accept(bench.listensd, NULL, NULL);
+      if (bench.end[0].txfd < 0)
+        {
+          ret = -errno;
+          goto errout_with_peer;
+        }
+
+      bench.end[0].rxfd = bench.end[0].txfd;
+    }
+
+  /* Latency: ping-pong one message at a time */
+
+  total = 0;
+  result->lat_max = 0;
+  for (i = 0; i < count; i++)
+    {
+      start = benchutil_usec();
+      ret = bench_send(&bench, 0, buf, size);
+      if (ret >= 0)
+        {
+          ret = bench_recv(&bench, 0, buf, size);
+        }
+
+      if (ret < 0)
+        {
+          break;
+        }
+
+      rtt    = benchutil_usec() - start;
+      total += rtt;
+      if (rtt > result->lat_max)
+        {
+          result->lat_max = (uint32_t)rtt;
+        }
+    }
+
+  /* Throughput: stream messages one way until the peer acknowledges the
+   * last one.
+   */
+
+  start = benchutil_usec();
+  for (i = 0; i < count && ret >= 0; i++)
+    {
+      ret = bench_send(&bench, 0, buf, size);
+    }
+
+  if (ret >= 0)
+    {
+      ret = bench_recv(&bench, 0, buf, 1);
+    }
+
+  if (ret < 0)
+    {
+      goto errout_with_peer;
+    }
+
+  pthread_join(peer, &value);
+  result->lat_avg = (uint32_t)(total / count);
+
+  total = benchutil_usec() - start;
+  if (total == 0)
+    {
+      total = 1;
+    }
+
+  result->msgs = (uint32_t)((uint64_t)count * 1000000 / total);
+  result->kbps = (uint32_t)((uint64_t)count * size * 1000000 /
+                            (total * 1024));
+  ret = (int)(intptr_t)value;
+  goto errout;
+
+errout_with_peer:
+
+  /* The peer may be blocked waiting for a message that will never come */
+
+  pthread_cancel(peer);
+  pthread_join(peer, NULL);
+
+errout:
+  bench_close(&bench);
+  free(bench.buffer[0]);
+  return ret;
+}
+
+static int bench_parsesizes(FAR const char *str, FAR size_t *sizes)
+{
+  FAR char *end;
+  unsigned long value;
+  int n = 0;
+
+  while (*str != '\0' && n < BENCH_MAXSIZES)
+    {
+      value = strtoul(str, &end, 10);
+      if (end == str || value < 1)
+        {
+          return -EINVAL;
+        }
+
+      sizes[n++] = value;
+      str = end;
+      if (*str == ',')
+        {
+          str++;
+        }
+      else if (*str != '\0')
+        {
+          return -EINVAL;
+        }
+    }
+
+  return n > 0 ? n : -EINVAL;
+}
+
+static void bench_usage(FAR const char *progname)
+{
+  fprintf(stderr, "USAGE: %s [-n count] [-s size[,size...]] "
+          "[pipe|mqueue|stream|dgram ...]\n", progname);
+  fprintf(stderr, "  -n: Messages per measurement.  Default: %d\n",
+          CONFIG_EXAMPLES_USTREAM_BENCH_COUNT);
+  fprintf(stderr, "  -s: Message sizes in bytes.  Default: %s\n",
+          CONFIG_EXAMPLES_USTREAM_BENCH_SIZES);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int ipcbench_main(int argc, char *argv[])
+#endif
+{
+  struct bench_result_s result;
+  size_t sizes[BENCH_MAXSIZES];
+  bool enabled[BENCH_NKINDS];
+  bool any = false;
+  int nsizes;
+  int count = CONFIG_EXAMPLES_USTREAM_BENCH_COUNT;
+  int kind;
+  int ret;
+  int i;
+  int j;
+
+  nsizes = bench_parsesizes(CONFIG_EXAMPLES_USTREAM_BENCH_SIZES, sizes);
+  memset(enabled, 0, sizeof(enabled));
+
+  for (i = 1; i < argc; i++)
+    {
+      if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+        {
+          count = atoi(argv[++i]);
+        }
+      else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+        {
+          nsizes = bench_parsesizes(argv[++i], sizes);
+        }
+      else
+        {
+          for (kind = 0; kind < BENCH_NKINDS; kind++)
+            {
+              if (strcmp(argv[i], g_kindname[kind]) == 0)
+                {
+                  enabled[kind] = true;
+                  any = true;
+                  break;
+                }
+            }
+
+          if (kind >= BENCH_NKINDS)
+            {
+              bench_usage(argv[0]);
+              return EXIT_FAILURE;
+            }
+        }
+    }
+
+  if (nsizes < 0 || count < 1)
+    {
+      bench_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+
+  printf("%-8s %6s %10s %10s %10s %10s\n", "IPC", "Size",
+         "RTT avg", "RTT max", "Msgs/s", "KB/s");
+
+  for (kind = 0; kind < BENCH_NKINDS; kind++)
+    {
+      if (any && !enabled[kind])
+        {
+          continue;
+        }
+
+      for (j = 0; j < nsizes; j++)
+        {
+#ifndef CONFIG_DISABLE_MQUEUE
+          if (kind == BENCH_MQUEUE && sizes[j] > CONFIG_MQ_MAXMSGSIZE)
+            {
+              printf("%-8s %6lu   skipped: exceeds CONFIG_MQ_MAXMSGSIZE\n",
+                     g_kindname[kind], (unsigned long)sizes[j]);
+              continue;
+            }
+#endif
+
+          ret = bench_run((enum bench_kind_e)kind, sizes[j], count,
+                          &result);
+          if (ret < 0)
+            {
+              printf("%-8s %6lu   failed: %d\n", g_kindname[kind],
+                     (unsigned long)sizes[j], ret);
+
+              /* An unsupported transport fails the same way at any size */
+
+              if (ret == -ENOSYS)
+                {
+                  break;
+                }
+
+              continue;
+            }
+
+          printf("%-8s %6lu %8luus %8luus %10lu %10lu\n", g_kindname[kind],
+                 (unsigned long)sizes[j], (unsigned long)result.lat_avg,
+                 (unsigned long)result.lat_max, (unsigned long)result.msgs,
+                 (unsigned long)result.kbps);
+        }
+    }
+
+  return EXIT_SUCCESS;
+}
@@ -71,10 +71,31 @@
 
 #define MULTI_POST_NDATA 3
 
+/* Streaming, concurrent fetches need both the asynchronous web client and
+ * the streaming JSON reader.
+ */
+
+#if defined(CONFIG_WEBCLIENT_ASYNC) && defined(CONFIG_NETUTILS_JSON_STREAM)
+#  define WGETJSON_ASYNC 1
+#  define WGETJSON_TOKENSIZE 128
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
+#ifdef WGETJSON_ASYNC
+/* One concurrent fetch: the request and the reader its body is fed to */
+
+struct wgetjson_fetch_s
+{
+  struct webclient_req_s req;
+  cJSON_Reader reader;
+  char token[WGETJSON_TOKENSIZE];
+  int result;
+};
+#endif
+
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
@@ -291,6 +312,140 @@ static int wgetjson_json_parse(char *text)
  * Public Functions
  ****************************************************************************/
 
+#ifdef WGETJSON_ASYNC
+/****************************************************************************
+ * Name: wgetjson_stream_event
+ ****************************************************************************/
+
+static int wgetjson_stream_event(void *arg, int type, const char *name,
+                                 const char *valuestring,
+                                 double valuedouble)
+{
+  FAR struct wgetjson_fetch_s *fetch = (FAR struct wgetjson_fetch_s *)arg;
+
+  if (name == NULL)
+    {
+      return 0;
+    }
+
+  switch (type)
+    {
+      case cJSON_String:
+      case cJSON_Number:
+        printf("%s: %s:\t%s\n", fetch->req.url, name, valuestring);
+        break;
+
+      case cJSON_True:
+      case cJSON_False:
+        printf("%s: %s:\t%s\n", fetch->req.url, name,
+               type == cJSON_True ? "true" : "false");
+        break;
+
+      default:
+        break;
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Name: wgetjson_stream_sink
+ *
+ * Description:
+ *   Feed each piece of the response body straight into the JSON reader so
+ *   that the document is never held in memory.
+ *
+ ****************************************************************************/
+
+static int wgetjson_stream_sink(FAR const char *data, size_t len,
+                                FAR void *arg)
+{
+  FAR struct wgetjson_fetch_s *fetch = (FAR struct wgetjson_fetch_s *)arg;
+
+  if (cJSON_ReaderFeed(&fetch->reader, data, len) < 0)
+    {
+      return -EINVAL;
+    }
+
+  return (int)len;
+}
+
+/****************************************************************************
+ * Name: wgetjson_stream_done
+ ****************************************************************************/
+
+static void wgetjson_stream_done(FAR struct webclient_req_s *req, int result)
+{
+  FAR struct wgetjson_fetch_s *fetch = (FAR struct wgetjson_fetch_s *)req;
+
+  if (result >= 0 && cJSON_ReaderFinish(&fetch->reader) < 0)
+    {
+      result = -EINVAL;
+    }
+
+  fetch->result = result;
+}
+
+/****************************************************************************
+ * Name: wgetjson_stream
+ *
+ * Description:
+ *   Fetch several JSON documents at once, parsing each as it arrives.
+ *
+ ****************************************************************************/
+
+static int wgetjson_stream(FAR char **urls, int nurls)
+{
+  FAR struct wgetjson_fetch_s *fetches;
+  struct webclient_async_s engine;
+  int ret;
+  int i;
+
+  fetches = (FAR struct wgetjson_fetch_s *)
+    calloc(nurls, sizeof(struct wgetjson_fetch_s));
+  if (fetches == NULL)
+    {
+      return ERROR;
+    }
+
+  webclient_async_init(&engine);
+
+  for (i = 0; i < nurls; i++)
+    {
+      cJSON_ReaderInit(&fetches[i].reader, fetches[i].token,
+                       WGETJSON_TOKENSIZE, wgetjson_stream_event,
+                       &fetches[i]);
+
+      fetches[i].req.url  = urls[i];
+      fetches[i].req.sink = wgetjson_stream_sink;
+      fetches[i].req.done = wgetjson_stream_done;
+      fetches[i].req.arg  = &fetches[i];
+
+      ret = webclient_async_start(&engine, &fetches[i].req);
+      if (ret < 0)
+        {
+          fetches[i].result = ret;
+        }
+    }
+
+  do
+    {
+      ret = webclient_async_poll(&engine, -1);
+    }
+  while (ret > 0);
+
+  for (i = 0; i < nurls; i++)
+    {
+      printf("%s: %s (%d)\n", urls[i],
+             fetches[i].result == 200 ? "Parse OK" : "Failed",
+             fetches[i].result);
+    }
+
+  free(fetches);
+  return ret < 0 ? ERROR : OK;
+}
+#endif
+
 /****************************************************************************
  * Name: wgetjson_main
  ****************************************************************************/
@@ -310,18 +465,29 @@ int wgetjson_main(int argc, char *argv[])
   bool is_post_multi = false;
   bool badarg=false;
   bool is_debug=false;
+#ifdef WGETJSON_ASYNC
+  bool is_async = false;
+#endif
   char *post_buff = NULL;
   int post_buff_len = 0;
   char *post_single_name  = "type";
   char *post_single_value = "string";
-  char *post_multi_names[MULTI_POST_NDATA]  = {"name", "gender", "country"};
-  char *post_multi_values[MULTI_POST_NDATA] = {"darcy", "man", "china"};
+  struct urlencode_field_s post_multi_fields[MULTI_POST_NDATA] =
+  {
+    {"name", "darcy"}, {"gender", "man"}, {"country", "china"}
+  };
   wget_callback_t wget_cb = wgetjson_callback;
 
-  while ((option = getopt(argc, argv, ":pPD")) != ERROR)
+  while ((option = getopt(argc, argv, ":pPDa")) != ERROR)
     {
       switch (option)
         {
+#ifdef WGETJSON_ASYNC
+          case 'a':
+            is_async = true;
+            break;
+
+#endif
           case 'p':
             is_post = true;
             break;
@@ -349,9 +515,25 @@ int wgetjson_main(int argc, char *argv[])
   if (badarg)
     {
       printf("usage: wgetjson -p(single post) -P(multi post) -D(debug wget callback)\n");
+#ifdef WGETJSON_ASYNC
+      printf("       wgetjson -a [url ...] (stream up to %d URLs at once)\n",
+             CONFIG_WEBCLIENT_ASYNC_MAXREQS);
+#endif
       return -1;
     }
 
+#ifdef WGETJSON_ASYNC
+  if (is_async)
+    {
+      if (optind >= argc)
+        {
+          return wgetjson_stream(&url, 1);
+        }
+
+      return wgetjson_stream(&argv[optind], argc - optind);
+    }
+#endif
+
   if (is_debug)
     {
       wget_cb = wgetjson_postdebug_callback;
@@ -372,9 +554,10 @@ int wgetjson_main(int argc, char *argv[])
       url = CONFIG_EXAMPLES_WGETPOST_URL;
       if (is_post_multi)
         {
-          post_buff_len = web_posts_strlen(post_multi_names, post_multi_values, MULTI_POST_NDATA);
-          post_buff = malloc(post_buff_len);
-          web_posts_str(post_buff, &post_buff_len, post_multi_names, post_multi_values, MULTI_POST_NDATA);
+          /* The fields are encoded straight into the request buffer */
+
+          ret = wget_postfields(url, post_multi_fields, MULTI_POST_NDATA,
+                                buffer, buffer_len, wget_cb, NULL);
         }
       else
         {
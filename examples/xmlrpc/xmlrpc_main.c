@@ -166,6 +166,43 @@ static int xmlrpc_getheader(char *buffer, char *header, char *value, int size)
   return -1;
 }
 
+/****************************************************************************
+ * Name: xmlrpc_recv
+ *
+ * Description:
+ *    Receive the next part of the request, waiting at most one second.
+ *
+ ****************************************************************************/
+
+static int xmlrpc_recv(int fd, char *buffer, int size)
+{
+  fd_set rfds;
+  struct timeval tv;
+  int ret;
+
+  FD_ZERO(&rfds);
+  FD_SET(fd, &rfds);
+
+  tv.tv_sec = 1;
+  tv.tv_usec = 0;
+
+  ninfo("[%d] select...\n", fd);
+  ret = select(fd + 1, &rfds, NULL, NULL, &tv);
+  if (ret <= 0 || !FD_ISSET(fd, &rfds))
+    {
+      /* Timeout... */
+
+      nerr("ERROR: [%d] timeout\n", fd);
+      return -1;
+    }
+
+  ninfo("[%d] data ready\n", fd);
+  ret = recv(fd, buffer, size, 0);
+  ninfo("[%d] %d bytes received\n", fd, ret);
+
+  return ret > 0 ? ret : -1;
+}
+
 /****************************************************************************
  * Name: xmlrpc_handler
  *
@@ -176,8 +213,6 @@ static int xmlrpc_getheader(char *buffer, char *header, char *value, int size)
 
 static void xmlrpc_handler(int fd)
 {
-  fd_set rfds;
-  struct timeval tv;
   int ret, len, max = 0, loadlen = -1;
   char buffer[CONFIG_EXAMPLES_XMLRPC_BUFFERSIZE] = { 0 };
   char value[CONFIG_XMLRPC_STRINGSIZE + 1];
@@ -187,71 +222,66 @@ static void xmlrpc_handler(int fd)
 
   do
     {
-      FD_ZERO(&rfds);
-      FD_SET(fd, &rfds);
-
-      tv.tv_sec = 1;
-      tv.tv_usec = 0;
-
-      ninfo("[%d] select...\n", fd);
-      ret = select(fd + 1, &rfds, NULL, NULL, &tv);
-      ninfo("[%d] data ready\n", fd);
-
-      if (ret > 0)
+      len = xmlrpc_recv(fd, &buffer[max], sizeof(buffer) - max - 1);
+      if (len < 0)
         {
-          if (FD_ISSET(fd, &rfds))
-            {
-              len = recv(fd, &buffer[max], 1024, 0);
-              ninfo("[%d] %d bytes received\n", fd, len);
-
-              if (len > 0)
-                {
-                  max += len;
-                  buffer[max] = 0;
-
-                  ret = xmlrpc_getheader(buffer, "Content-Length:", value,
-                                         CONFIG_EXAMPLES_XMLRPC_BUFFERSIZE);
-                  if (ret > 0)
-                    loadlen = atoi(value);
-                }
-              else
-                {
-                  ret = -1;
-                  break;
-                }
-            }
-        }
-      else
-        {
-          /* Timeout... */
-
-          nerr("ERROR: [%d] timeout\n", fd);
-          ret = -1;
-          break;
+          return;
         }
 
-      temp = strstr(buffer, separator);
+      max += len;
+      buffer[max] = 0;
 
-      if (temp)
+      temp = xmlrpc_findbody(buffer);
+      if (temp == NULL && max >= sizeof(buffer) - 1)
         {
-          if (strlen(temp) - 4 == loadlen)
-            break;
+          nerr("ERROR: [%d] header too long\n", fd);
+          return;
         }
+    }
+  while (temp == NULL);
 
+  ret = xmlrpc_getheader(buffer, "Content-Length:", value,
+                         CONFIG_XMLRPC_STRINGSIZE);
+  if (ret > 0)
+    {
+      loadlen = atoi(value);
     }
-  while (1);
 
   /* Determine request */
 
-  if (!strncmp(buffer, "POST", 4))
+  if (strncmp(buffer, "POST", 4) != 0 || loadlen < 0)
     {
-      temp = xmlrpc_findbody(buffer);
-      xmlrpc_parse(fd, temp);
+      write(fd, notimplemented, strlen(notimplemented));
+      return;
     }
-  else
+
+  /* Parse the body as it is received: it does not need to fit in buffer */
+
+  xmlrpc_parse_begin();
+
+  len = max - (temp - buffer);
+  if (len > loadlen)
     {
-      write(fd, notimplemented, strlen(notimplemented));
+      len = loadlen;
     }
+
+  xmlrpc_parse_push(temp, len);
+  loadlen -= len;
+
+  while (loadlen > 0)
+    {
+      len = xmlrpc_recv(fd, buffer, loadlen < sizeof(buffer) ?
+                        loadlen : sizeof(buffer));
+      if (len < 0)
+        {
+          break;
+        }
+
+      xmlrpc_parse_push(buffer, len);
+      loadlen -= len;
+    }
+
+  xmlrpc_parse_end(fd);
 }
 
 /****************************************************************************
@@ -0,0 +1,324 @@
+/****************************************************************************
+ * apps/fsutils/flash_eraseall/flash_eraseblocks.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/mtd/mtd.h>
+#include "fsutils/flash_eraseall.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_FSUTILS_FLASH_ERASEBLOCKS_BUFSIZE
+#  define CONFIG_FSUTILS_FLASH_ERASEBLOCKS_BUFSIZE 512
+#endif
+
+#ifndef CONFIG_FSUTILS_FLASH_ERASEBLOCKS_MAXRUN
+#  define CONFIG_FSUTILS_FLASH_ERASEBLOCKS_MAXRUN 16
+#endif
+
+#ifndef CONFIG_FSUTILS_FLASH_ERASEBLOCKS_ERASEDSTATE
+#  define CONFIG_FSUTILS_FLASH_ERASEBLOCKS_ERASEDSTATE 0xff
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define FLASH_ERASE_CLOCK CLOCK_MONOTONIC
+#else
+#  define FLASH_ERASE_CLOCK CLOCK_REALTIME
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct flash_erase_s
+{
+  FAR struct mtd_dev_s *mtd;        /* The MTD device */
+  FAR uint8_t *buffer;              /* Buffer used to check for blank */
+  size_t blocksize;                 /* Size of one read block */
+  size_t nbufblocks;                /* Number of read blocks in buffer */
+  size_t blkper;                    /* Read blocks per erase block */
+  struct timespec start;            /* Time when the erase started */
+  flash_erase_progress_t callback;  /* Progress callback */
+  FAR void *arg;                    /* Argument of the callback */
+  struct flash_erase_progress_s progress;
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: flash_erase_report
+ ****************************************************************************/
+
+static void flash_erase_report(FAR struct flash_erase_s *priv)
+{
+  struct timespec now;
+
+  if (priv->callback != NULL)
+    {
+      (void)clock_gettime(FLASH_ERASE_CLOCK, &now);
+      priv->progress.elapsed =
+        (uint32_t)(now.tv_sec - priv->start.tv_sec) * 1000 +
+        (now.tv_nsec - priv->start.tv_nsec) / 1000000;
+
+      priv->callback(&priv->progress, priv->arg);
+    }
+}
+
+/****************************************************************************
+ * Name: flash_erase_isblank
+ *
+ * Description:
+ *   Return 1 if the erase block is blank, 0 if it is not, or a negated
+ *   errno value if it could not be read.
+ *
+ ****************************************************************************/
+
+static int flash_erase_isblank(FAR struct flash_erase_s *priv,
+                               size_t eblock)
+{
+  off_t startblock = (off_t)eblock * priv->blkper;
+  size_t remaining = priv->blkper;
+  size_t nblocks;
+  size_t nbytes;
+  ssize_t nread;
+  size_t i;
+
+  while (remaining > 0)
+    {
+      nblocks = remaining < priv->nbufblocks ? remaining : priv->nbufblocks;
+      nread   = MTD_BREAD(priv->mtd, startblock, nblocks, priv->buffer);
+      if (nread < 0)
+        {
+          ferr("ERROR: MTD_BREAD(%ld) failed: %d\n",
+               (long)startblock, (int)nread);
+          return (int)nread;
+        }
+
+      if (nread != nblocks)
+        {
+          return -EIO;
+        }
+
+      nbytes = nblocks * priv->blocksize;
+      for (i = 0; i < nbytes; i++)
+        {
+          if (priv->buffer[i] != CONFIG_FSUTILS_FLASH_ERASEBLOCKS_ERASEDSTATE)
+            {
+              return 0;
+            }
+        }
+
+      startblock += nblocks;
+      remaining  -= nblocks;
+    }
+
+  return 1;
+}
+
+/****************************************************************************
+ * Name: flash_erase_run
+ ****************************************************************************/
+
+static int flash_erase_run(FAR struct flash_erase_s *priv, size_t first,
+                           size_t nblocks)
+{
+  int ret;
+
+  if (nblocks == 0)
+    {
+      return OK;
+    }
+
+  ret = MTD_ERASE(priv->mtd, first, nblocks);
+  if (ret < 0)
+    {
+      ferr("ERROR: MTD_ERASE(%lu, %lu) failed: %d\n",
+           (unsigned long)first, (unsigned long)nblocks, ret);
+      return ret;
+    }
+
+  priv->progress.nerased += nblocks;
+  priv->progress.ndone    = first + nblocks;
+  flash_erase_report(priv);
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: flash_eraseblocks
+ *
+ * Description:
+ *   Erase all of an MTD device.  Runs of erase blocks are erased with one
+ *   MTD_ERASE() call each.  With FLASH_ERASE_SKIPBLANK, each erase block is
+ *   read first and is not erased if it is already blank.
+ *
+ ****************************************************************************/
+
+int flash_eraseblocks(FAR struct mtd_dev_s *mtd, int flags,
+                      flash_erase_progress_t progress, FAR void *arg)
+{
+  struct flash_erase_s priv;
+  struct mtd_geometry_s geo;
+  size_t first;
+  size_t nrun;
+  size_t eblock;
+  int ret;
+
+  DEBUGASSERT(mtd != NULL);
+
+  ret = MTD_IOCTL(mtd, MTDIOC_GEOMETRY, (unsigned long)((uintptr_t)&geo));
+  if (ret < 0)
+    {
+      ferr("ERROR: MTDIOC_GEOMETRY failed: %d\n", ret);
+      return ret;
+    }
+
+  if (geo.blocksize == 0 || geo.erasesize < geo.blocksize)
+    {
+      return -EINVAL;
+    }
+
+  memset(&priv, 0, sizeof(struct flash_erase_s));
+  priv.mtd                   = mtd;
+  priv.blocksize             = geo.blocksize;
+  priv.blkper                = geo.erasesize / geo.blocksize;
+  priv.callback              = progress;
+  priv.arg                   = arg;
+  priv.progress.erasesize    = geo.erasesize;
+  priv.progress.neraseblocks = geo.neraseblocks;
+
+  if ((flags & FLASH_ERASE_SKIPBLANK) != 0)
+    {
+      priv.nbufblocks = CONFIG_FSUTILS_FLASH_ERASEBLOCKS_BUFSIZE /
+                        geo.blocksize;
+      if (priv.nbufblocks == 0)
+        {
+          priv.nbufblocks = 1;
+        }
+
+      priv.buffer = (FAR uint8_t *)malloc(priv.nbufblocks * geo.blocksize);
+      if (priv.buffer == NULL)
+        {
+          return -ENOMEM;
+        }
+    }
+
+  (void)clock_gettime(FLASH_ERASE_CLOCK, &priv.start);
+
+  /* Collect runs of erase blocks that need erasing.  A blank block or the
+   * maximum length ends a run.
+   */
+
+  first = 0;
+  nrun  = 0;
+
+  for (eblock = 0; eblock < geo.neraseblocks; eblock++)
+    {
+      if (priv.buffer != NULL)
+        {
+          ret = flash_erase_isblank(&priv, eblock);
+          if (ret < 0)
+            {
+              goto errout_with_buffer;
+            }
+
+          if (ret > 0)
+            {
+              ret = flash_erase_run(&priv, first, nrun);
+              if (ret < 0)
+                {
+                  goto errout_with_buffer;
+                }
+
+              priv.progress.nskipped++;
+              priv.progress.ndone = eblock + 1;
+              nrun = 0;
+              continue;
+            }
+        }
+
+      if (nrun == 0)
+        {
+          first = eblock;
+        }
+
+      if (++nrun >= CONFIG_FSUTILS_FLASH_ERASEBLOCKS_MAXRUN)
+        {
+          ret = flash_erase_run(&priv, first, nrun);
+          if (ret < 0)
+            {
+              goto errout_with_buffer;
+            }
+
+          nrun = 0;
+        }
+    }
+
+  ret = flash_erase_run(&priv, first, nrun);
+  if (ret >= 0)
+    {
+      priv.progress.ndone = geo.neraseblocks;
+      flash_erase_report(&priv);
+      ret = OK;
+    }
+
+errout_with_buffer:
+  if (priv.buffer != NULL)
+    {
+      free(priv.buffer);
+    }
+
+  return ret;
+}
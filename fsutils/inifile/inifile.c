@@ -39,9 +39,13 @@
 
 #include <nuttx/config.h>
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <strings.h>
+#include <ctype.h>
+#include <errno.h>
 #include <debug.h>
 
 #include "fsutils/inifile.h"
@@ -56,6 +60,12 @@
 #  define CONFIG_FSUTILS_INIFILE_MAXLINE 256
 #endif
 
+/* The number of hash buckets of a memory resident INI file */
+
+#ifndef CONFIG_FSUTILS_INIFILE_HASHSIZE
+#  define CONFIG_FSUTILS_INIFILE_HASHSIZE 64
+#endif
+
 #ifndef CONFIG_FSUTILS_INIFILE_DEBUGLEVEL
 #  define CONFIG_FSUTILS_INIFILE_DEBUGLEVEL 0
 #endif
@@ -100,6 +110,26 @@ struct inifile_var_s
   FAR char *value;
 };
 
+#ifdef CONFIG_FSUTILS_INIFILE_CACHE
+/* A section of a memory resident INI file */
+
+struct inifile_section_s
+{
+  FAR struct inifile_section_s *flink;
+  char name[1];                 /* Section name, allocated with the node */
+};
+
+/* A variable of a memory resident INI file, kept in a hash chain */
+
+struct inifile_entry_s
+{
+  FAR struct inifile_entry_s *flink;
+  FAR struct inifile_section_s *section;
+  FAR char *value;              /* Points into variable[] */
+  char variable[1];             /* Variable name, then its value */
+};
+#endif
+
 /* This structure describes the state of one instance of the INI file parser */
 
 struct inifile_state_s
@@ -107,6 +137,10 @@ struct inifile_state_s
   FILE *instream;
   int   nextch;
   char  line[CONFIG_FSUTILS_INIFILE_MAXLINE+1];
+#ifdef CONFIG_FSUTILS_INIFILE_CACHE
+  FAR struct inifile_section_s *sections;
+  FAR struct inifile_entry_s *hash[CONFIG_FSUTILS_INIFILE_HASHSIZE];
+#endif
 };
 
 /****************************************************************************
@@ -130,6 +164,12 @@ static FAR char *
 static FAR char *
             inifile_find_variable(FAR struct inifile_state_s *priv,
               FAR const char *section, FAR const char *variable);
+#ifdef CONFIG_FSUTILS_INIFILE_CACHE
+static unsigned int inifile_hash(FAR const char *section,
+              FAR const char *variable);
+static int  inifile_load(FAR struct inifile_state_s *priv);
+static void inifile_unload(FAR struct inifile_state_s *priv);
+#endif
 
 /****************************************************************************
  * Private Functions
@@ -464,6 +504,30 @@ static FAR char *inifile_find_variable(FAR struct inifile_state_s *priv,
 
   iniinfo("section=\"%s\" variable=\"%s\"\n", section, variable);
 
+#ifdef CONFIG_FSUTILS_INIFILE_CACHE
+  /* The whole file was loaded by inifile_initialize() */
+
+  if (priv)
+    {
+      FAR struct inifile_entry_s *entry;
+
+      entry = priv->hash[inifile_hash(section, variable)];
+      for (; entry; entry = entry->flink)
+        {
+          if (strcasecmp(entry->variable, variable) == 0 &&
+              strcasecmp(entry->section->name, section) == 0)
+            {
+              if (*entry->value)
+                {
+                  ret = entry->value;
+                }
+
+              break;
+            }
+        }
+    }
+
+#else
   /* Seek to the first variable in the specified section of the INI file */
 
   if (priv->instream && inifile_seek_to_section(priv, section))
@@ -482,12 +546,190 @@ static FAR char *inifile_find_variable(FAR struct inifile_state_s *priv,
         }
     }
 
+#endif
   /* Return the string that we found. */
 
   iniinfo("Returning 0x%p\n", ret);
   return ret;
 }
 
+#ifdef CONFIG_FSUTILS_INIFILE_CACHE
+/****************************************************************************
+ * Name:  inifile_hash
+ *
+ * Description:
+ *   Return the hash bucket of a variable.  Names are case insensitive.
+ *
+ ****************************************************************************/
+
+static unsigned int inifile_hash(FAR const char *section,
+                                 FAR const char *variable)
+{
+  unsigned int hash = 5381;
+
+  while (*section)
+    {
+      hash = hash * 33 + tolower(*section++);
+    }
+
+  hash = hash * 33;
+  while (*variable)
+    {
+      hash = hash * 33 + tolower(*variable++);
+    }
+
+  return hash % CONFIG_FSUTILS_INIFILE_HASHSIZE;
+}
+
+/****************************************************************************
+ * Name:  inifile_load
+ *
+ * Description:
+ *   Parse the whole INI file into the hash table.  The lookups then find the
+ *   same value as a search of the file would: only the first section with a
+ *   given name and the first assignment of a variable are kept, and a blank
+ *   line ends a section.
+ *
+ ****************************************************************************/
+
+static int inifile_load(FAR struct inifile_state_s *priv)
+{
+  FAR struct inifile_section_s *section = NULL;
+  FAR struct inifile_entry_s *entry;
+  FAR char *ptr;
+  size_t varlen;
+  size_t vallen;
+  unsigned int ndx;
+  int nbytes;
+
+  do
+    {
+      nbytes = inifile_read_noncomment_line(priv);
+
+      /* A blank line or a new section header ends the current section */
+
+      if (nbytes == 0 || priv->line[0] == '[')
+        {
+          section = NULL;
+          if (nbytes < 3)
+            {
+              continue;
+            }
+
+          ptr = strchr(&priv->line[1], ']');
+          if (ptr)
+            {
+              *ptr = '\0';
+            }
+
+          /* Ignore the variables of a section seen before */
+
+          for (section = priv->sections; section; section = section->flink)
+            {
+              if (strcasecmp(section->name, &priv->line[1]) == 0)
+                {
+                  break;
+                }
+            }
+
+          if (section)
+            {
+              section = NULL;
+              continue;
+            }
+
+          section = (FAR struct inifile_section_s *)
+            malloc(sizeof(struct inifile_section_s) + strlen(&priv->line[1]));
+          if (!section)
+            {
+              return -ENOMEM;
+            }
+
+          strcpy(section->name, &priv->line[1]);
+          section->flink = priv->sections;
+          priv->sections = section;
+          continue;
+        }
+
+      /* Variables outside of a section are never found */
+
+      ptr = strchr(&priv->line[1], '=');
+      if (!section || !ptr)
+        {
+          continue;
+        }
+
+      *ptr++ = '\0';
+
+      ndx = inifile_hash(section->name, priv->line);
+      for (entry = priv->hash[ndx]; entry; entry = entry->flink)
+        {
+          if (entry->section == section &&
+              strcasecmp(entry->variable, priv->line) == 0)
+            {
+              break;
+            }
+        }
+
+      if (entry)
+        {
+          continue;
+        }
+
+      varlen = strlen(priv->line);
+      vallen = strlen(ptr);
+
+      entry = (FAR struct inifile_entry_s *)
+        malloc(sizeof(struct inifile_entry_s) + varlen + vallen + 1);
+      if (!entry)
+        {
+          return -ENOMEM;
+        }
+
+      entry->section = section;
+      entry->value   = &entry->variable[varlen + 1];
+      strcpy(entry->variable, priv->line);
+      strcpy(entry->value, ptr);
+
+      entry->flink    = priv->hash[ndx];
+      priv->hash[ndx] = entry;
+    }
+  while (priv->nextch != EOF);
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name:  inifile_unload
+ *
+ * Description:
+ *   Free the memory resident copy of the INI file.
+ *
+ ****************************************************************************/
+
+static void inifile_unload(FAR struct inifile_state_s *priv)
+{
+  FAR struct inifile_section_s *section;
+  FAR struct inifile_entry_s *entry;
+  int i;
+
+  for (i = 0; i < CONFIG_FSUTILS_INIFILE_HASHSIZE; i++)
+    {
+      while ((entry = priv->hash[i]) != NULL)
+        {
+          priv->hash[i] = entry->flink;
+          free(entry);
+        }
+    }
+
+  while ((section = priv->sections) != NULL)
+    {
+      priv->sections = section->flink;
+      free(section);
+    }
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -522,11 +764,32 @@ INIHANDLE inifile_initialize(FAR const char *inifile_name)
   if (priv->instream)
     {
       priv->nextch = getc(priv->instream);
+
+#ifdef CONFIG_FSUTILS_INIFILE_CACHE
+      /* Parse the file once.  It is not needed after that. */
+
+      priv->sections = NULL;
+      memset(priv->hash, 0, sizeof(priv->hash));
+
+      if (inifile_load(priv) < 0)
+        {
+          inidbg("ERROR: Failed to load \"%s\"\n", inifile_name);
+          inifile_unload(priv);
+          fclose(priv->instream);
+          free(priv);
+          return (INIHANDLE)NULL;
+        }
+
+      fclose(priv->instream);
+      priv->instream = NULL;
+#endif
+
       return (INIHANDLE)priv;
     }
   else
     {
       inidbg("ERROR: Could not open \"%s\"\n", inifile_name);
+      free(priv);
       return (INIHANDLE)NULL;
     }
 }
@@ -552,6 +815,12 @@ void inifile_uninitialize(INIHANDLE handle)
           fclose(priv->instream);
         }
 
+#ifdef CONFIG_FSUTILS_INIFILE_CACHE
+      /* Free the memory resident copy */
+
+      inifile_unload(priv);
+#endif
+
       /* Release the state structure */
 
       free(priv);
@@ -0,0 +1,582 @@
+/****************************************************************************
+ * apps/fsutils/logfile/logfile.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/statfs.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <semaphore.h>
+#include <time.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include "fsutils/logfile.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_FSUTILS_LOGFILE_NFILES
+#  define CONFIG_FSUTILS_LOGFILE_NFILES 2
+#endif
+
+#define LOGFILE_MAXFILES   10  /* So that the suffix is one digit */
+#define LOGFILE_CHUNKSIZE  512 /* If statfs() does not help */
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define LOGFILE_CLOCK CLOCK_MONOTONIC
+#else
+#  define LOGFILE_CLOCK CLOCK_REALTIME
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct logfile_s
+{
+  sem_t exclsem;             /* Serializes access to the log */
+  int fd;                    /* The current file */
+  FAR char *path;            /* Path of the current file */
+  FAR char *oldpath;         /* Room to build the names of older files */
+  FAR uint8_t *buffer;       /* Collects one chunk */
+  size_t chunksize;          /* Size of a chunk */
+  size_t maxsize;            /* Rotate when the file reaches this size */
+  size_t fill;               /* Bytes in buffer */
+  size_t togo;               /* Size of the current chunk */
+  off_t filesize;            /* Size of the current file */
+  uint32_t budget;           /* Bytes per second, zero if unlimited */
+  uint32_t spent;            /* Bytes written in the current second */
+  uint64_t window;           /* Start of the current second (usec) */
+  uint8_t nfiles;            /* Files kept including the current one */
+  struct logfile_stats_s stats;
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: logfile_now
+ *
+ * Description:
+ *   Return the current time in microseconds.
+ *
+ ****************************************************************************/
+
+static uint64_t logfile_now(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(LOGFILE_CLOCK, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * Name: logfile_lock and logfile_unlock
+ ****************************************************************************/
+
+static void logfile_lock(FAR struct logfile_s *priv)
+{
+  while (sem_wait(&priv->exclsem) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+}
+
+static inline void logfile_unlock(FAR struct logfile_s *priv)
+{
+  sem_post(&priv->exclsem);
+}
+
+/****************************************************************************
+ * Name: logfile_open_current
+ *
+ * Description:
+ *   Open the current file and set up the first chunk so that later chunks
+ *   start on chunk boundaries of the file.
+ *
+ ****************************************************************************/
+
+static int logfile_open_current(FAR struct logfile_s *priv, int oflags)
+{
+  struct stat buf;
+  int errcode;
+
+  priv->fd = open(priv->path, O_WRONLY | O_CREAT | O_APPEND | oflags, 0666);
+  if (priv->fd < 0)
+    {
+      errcode = errno;
+      ferr("ERROR: Failed to open %s: %d\n", priv->path, errcode);
+      return -errcode;
+    }
+
+  priv->filesize = 0;
+  if (fstat(priv->fd, &buf) == 0)
+    {
+      priv->filesize = buf.st_size;
+    }
+
+  priv->togo = priv->chunksize - priv->filesize % priv->chunksize;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: logfile_rotate
+ *
+ * Description:
+ *   Rename path.N-2 to path.N-1, ..., path to path.1 and start a new,
+ *   empty current file.
+ *
+ ****************************************************************************/
+
+static int logfile_rotate(FAR struct logfile_s *priv)
+{
+  size_t len = strlen(priv->path);
+  FAR char *to = priv->oldpath;
+  FAR char *from = &priv->oldpath[len + 3];
+  int i;
+
+  (void)close(priv->fd);
+  priv->fd = -1;
+
+  strcpy(to, priv->path);
+  strcpy(from, priv->path);
+  to[len]       = '.';
+  to[len + 2]   = '\0';
+  from[len]     = '.';
+  from[len + 2] = '\0';
+
+  /* Some file systems do not rename onto an existing file */
+
+  to[len + 1] = '0' + priv->nfiles - 1;
+  (void)unlink(priv->nfiles > 1 ? to : priv->path);
+
+  for (i = priv->nfiles - 1; i > 0; i--)
+    {
+      to[len + 1] = '0' + i;
+      if (i > 1)
+        {
+          from[len + 1] = '0' + i - 1;
+          (void)rename(from, to);
+        }
+      else
+        {
+          (void)rename(priv->path, to);
+        }
+    }
+
+  priv->stats.nrotations++;
+  return logfile_open_current(priv, O_TRUNC);
+}
+
+/****************************************************************************
+ * Name: logfile_throttle
+ *
+ * Description:
+ *   Delay the caller until nbytes more can be written within the budget.
+ *   A chunk that is larger than the budget is still written once per
+ *   second.
+ *
+ ****************************************************************************/
+
+static void logfile_throttle(FAR struct logfile_s *priv, size_t nbytes)
+{
+  uint64_t now = logfile_now();
+  uint64_t elapsed = now - priv->window;
+
+  if (elapsed >= 1000000)
+    {
+      priv->window = now;
+      priv->spent  = 0;
+    }
+  else if (priv->spent > 0 && priv->spent + nbytes > priv->budget)
+    {
+      priv->stats.nthrottled++;
+      usleep((useconds_t)(1000000 - elapsed));
+
+      priv->window = logfile_now();
+      priv->spent  = 0;
+    }
+
+  priv->spent += nbytes;
+}
+
+/****************************************************************************
+ * Name: logfile_writechunk
+ *
+ * Description:
+ *   Write the buffered data and rotate the file if it is full.
+ *
+ ****************************************************************************/
+
+static int logfile_writechunk(FAR struct logfile_s *priv)
+{
+  FAR const uint8_t *ptr = priv->buffer;
+  size_t remaining = priv->fill;
+  uint64_t start;
+  uint32_t latency;
+  ssize_t nwritten;
+  int errcode;
+  int ret;
+
+  if (remaining == 0)
+    {
+      return OK;
+    }
+
+  if (priv->fd < 0)
+    {
+      ret = logfile_open_current(priv, 0);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  if (priv->budget > 0)
+    {
+      logfile_throttle(priv, remaining);
+    }
+
+  start = logfile_now();
+  while (remaining > 0)
+    {
+      nwritten = write(priv->fd, ptr, remaining);
+      if (nwritten < 0)
+        {
+          errcode = errno;
+          if (errcode == EINTR)
+            {
+              continue;
+            }
+
+          ferr("ERROR: Failed to write %s: %d\n", priv->path, errcode);
+
+          /* Keep what was not written for the next attempt */
+
+          priv->togo -= priv->fill - remaining;
+          priv->fill  = remaining;
+          memmove(priv->buffer, ptr, remaining);
+          return -errcode;
+        }
+
+      ptr       += nwritten;
+      remaining -= nwritten;
+      priv->filesize += nwritten;
+    }
+
+  latency = (uint32_t)(logfile_now() - start);
+  if (latency > priv->stats.maxlatency)
+    {
+      priv->stats.maxlatency = latency;
+    }
+
+  priv->stats.totlatency += latency;
+  priv->stats.nbytes     += priv->fill;
+  priv->stats.nchunks++;
+
+  priv->togo = priv->chunksize - priv->filesize % priv->chunksize;
+  priv->fill = 0;
+
+  if (priv->maxsize > 0 && priv->filesize >= priv->maxsize)
+    {
+      return logfile_rotate(priv);
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: logfile_open
+ *
+ * Description:
+ *   Open the log file described by config for appending.  Returns NULL and
+ *   sets errno on failure.
+ *
+ ****************************************************************************/
+
+LOGHANDLE logfile_open(FAR const struct logfile_config_s *config)
+{
+  FAR struct logfile_s *priv;
+  struct statfs fsbuf;
+  size_t len;
+  int errcode;
+  int ret;
+
+  DEBUGASSERT(config != NULL && config->path != NULL);
+
+  priv = (FAR struct logfile_s *)zalloc(sizeof(struct logfile_s));
+  if (priv == NULL)
+    {
+      errcode = ENOMEM;
+      goto errout;
+    }
+
+  priv->chunksize = config->chunksize;
+  if (priv->chunksize == 0)
+    {
+      if (statfs(config->path, &fsbuf) == 0 && fsbuf.f_bsize > 0)
+        {
+          priv->chunksize = fsbuf.f_bsize;
+        }
+      else
+        {
+          priv->chunksize = LOGFILE_CHUNKSIZE;
+        }
+    }
+
+  /* Rotate on a chunk boundary, but never before the first chunk */
+
+  priv->maxsize = config->maxsize - config->maxsize % priv->chunksize;
+  if (config->maxsize > 0 && priv->maxsize == 0)
+    {
+      priv->maxsize = priv->chunksize;
+    }
+
+  priv->nfiles = config->nfiles;
+  if (priv->nfiles == 0)
+    {
+      priv->nfiles = CONFIG_FSUTILS_LOGFILE_NFILES;
+    }
+
+  if (priv->nfiles > LOGFILE_MAXFILES)
+    {
+      priv->nfiles = LOGFILE_MAXFILES;
+    }
+
+  priv->budget = config->budget;
+  priv->window = logfile_now();
+  priv->fd     = -1;
+
+  /* The names path.N of two older files are built after the path */
+
+  len = strlen(config->path);
+  priv->path    = (FAR char *)malloc(3 * len + 7);
+  priv->buffer  = (FAR uint8_t *)malloc(priv->chunksize);
+  if (priv->path == NULL || priv->buffer == NULL)
+    {
+      errcode = ENOMEM;
+      goto errout_with_priv;
+    }
+
+  strcpy(priv->path, config->path);
+  priv->oldpath = &priv->path[len + 1];
+
+  ret = logfile_open_current(priv, 0);
+  if (ret < 0)
+    {
+      errcode = -ret;
+      goto errout_with_priv;
+    }
+
+  if (priv->maxsize > 0 && priv->filesize >= priv->maxsize)
+    {
+      ret = logfile_rotate(priv);
+      if (ret < 0)
+        {
+          errcode = -ret;
+          goto errout_with_priv;
+        }
+    }
+
+  sem_init(&priv->exclsem, 0, 1);
+  return (LOGHANDLE)priv;
+
+errout_with_priv:
+  if (priv->fd >= 0)
+    {
+      (void)close(priv->fd);
+    }
+
+  free(priv->buffer);
+  free(priv->path);
+  free(priv);
+
+errout:
+  set_errno(errcode);
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: logfile_write
+ *
+ * Description:
+ *   Append data to the log.  The data is written to the file system only
+ *   when a whole chunk has been collected.
+ *
+ ****************************************************************************/
+
+ssize_t logfile_write(LOGHANDLE handle, FAR const void *buffer, size_t len)
+{
+  FAR struct logfile_s *priv = (FAR struct logfile_s *)handle;
+  FAR const uint8_t *src = (FAR const uint8_t *)buffer;
+  size_t remaining = len;
+  size_t ncopy;
+  int ret = OK;
+
+  DEBUGASSERT(priv != NULL && (buffer != NULL || len == 0));
+
+  logfile_lock(priv);
+  priv->stats.nappends++;
+
+  while (remaining > 0)
+    {
+      ncopy = priv->togo - priv->fill;
+      if (ncopy > remaining)
+        {
+          ncopy = remaining;
+        }
+
+      memcpy(&priv->buffer[priv->fill], src, ncopy);
+      priv->fill += ncopy;
+      src        += ncopy;
+      remaining  -= ncopy;
+
+      if (priv->fill >= priv->togo)
+        {
+          ret = logfile_writechunk(priv);
+          if (ret < 0)
+            {
+              break;
+            }
+        }
+    }
+
+  logfile_unlock(priv);
+
+  /* Report an error only if nothing at all could be appended */
+
+  if (ret < 0 && remaining == len)
+    {
+      return ret;
+    }
+
+  return len - remaining;
+}
+
+/****************************************************************************
+ * Name: logfile_flush
+ *
+ * Description:
+ *   Write a partial chunk now, ignoring the write budget.
+ *
+ ****************************************************************************/
+
+int logfile_flush(LOGHANDLE handle)
+{
+  FAR struct logfile_s *priv = (FAR struct logfile_s *)handle;
+  uint32_t budget;
+  int ret;
+
+  DEBUGASSERT(priv != NULL);
+
+  logfile_lock(priv);
+
+  budget       = priv->budget;
+  priv->budget = 0;
+  ret          = logfile_writechunk(priv);
+  priv->budget = budget;
+
+  if (ret >= 0 && priv->fd >= 0)
+    {
+      (void)fsync(priv->fd);
+    }
+
+  logfile_unlock(priv);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: logfile_stats
+ *
+ * Description:
+ *   Return the write statistics of the log.
+ *
+ ****************************************************************************/
+
+void logfile_stats(LOGHANDLE handle, FAR struct logfile_stats_s *stats)
+{
+  FAR struct logfile_s *priv = (FAR struct logfile_s *)handle;
+
+  DEBUGASSERT(priv != NULL && stats != NULL);
+
+  logfile_lock(priv);
+  memcpy(stats, &priv->stats, sizeof(struct logfile_stats_s));
+  logfile_unlock(priv);
+}
+
+/****************************************************************************
+ * Name: logfile_close
+ *
+ * Description:
+ *   Flush and close the log and free its resources.
+ *
+ ****************************************************************************/
+
+int logfile_close(LOGHANDLE handle)
+{
+  FAR struct logfile_s *priv = (FAR struct logfile_s *)handle;
+  int ret;
+
+  ret = logfile_flush(handle);
+  if (priv->fd >= 0)
+    {
+      (void)close(priv->fd);
+    }
+
+  sem_destroy(&priv->exclsem);
+  free(priv->buffer);
+  free(priv->path);
+  free(priv);
+  return ret;
+}
@@ -848,6 +848,88 @@ mkfatfs_clustersearch(FAR struct fat_format_s *fmt, FAR struct fat_var_s *var)
   return -ENFILE;
 }
 
+/****************************************************************************
+ * Name:  mkfatfs_alignfat
+ *
+ * Description:
+ *   Align the file system to the erase blocks of the media.  The reserved
+ *   sectors are extended so that the data region starts on an erase block
+ *   boundary.  On FAT32, each FAT is also padded to a whole number of
+ *   erase blocks so that the FATs start on a boundary as well.  The
+ *   alignment is skipped if the fewer clusters that remain would change
+ *   the FAT type.
+ *
+ * Input:
+ *   fmt - Caller specified format parameters
+ *   var - Other format parameters that are not caller specifiable. (Most
+ *     set by mkfatfs_configfatfs()).
+ *
+ * Return:
+ *    None
+ *
+ ****************************************************************************/
+
+static inline void
+mkfatfs_alignfat(FAR struct fat_format_s *fmt, FAR struct fat_var_s *var)
+{
+  uint32_t align = fmt->ff_alignsects;
+  uint32_t nrootdirsects;
+  uint32_t nfatsects;
+  uint32_t nclusters;
+  uint32_t rsvdseccount;
+  uint32_t datastart;
+  uint32_t used;
+
+  if (align <= 1)
+    {
+      return;
+    }
+
+  /* The root directory is a cluster in the data region on FAT32 */
+
+  nfatsects = var->fv_nfatsects;
+  if (var->fv_fattype == 32)
+    {
+      nrootdirsects = 1 << fmt->ff_clustshift;
+      nfatsects     = (nfatsects + align - 1) / align * align;
+      datastart     = fmt->ff_hidsec + fmt->ff_rsvdseccount +
+                      fmt->ff_nfats * nfatsects;
+    }
+  else
+    {
+      nrootdirsects = var->fv_nrootdirsects;
+      datastart     = fmt->ff_hidsec + fmt->ff_rsvdseccount +
+                      fmt->ff_nfats * nfatsects + nrootdirsects;
+    }
+
+  rsvdseccount = fmt->ff_rsvdseccount +
+                 (align - datastart % align) % align;
+
+  used = rsvdseccount + fmt->ff_nfats * nfatsects + nrootdirsects;
+  if (rsvdseccount > 0xffff || used >= fmt->ff_nsectors)
+    {
+      fwarn("WARNING:  Cannot align to %u sectors\n", align);
+      return;
+    }
+
+  /* Check that the FAT type is still determined by the cluster count */
+
+  nclusters = (fmt->ff_nsectors - used) >> fmt->ff_clustshift;
+  if ((var->fv_fattype == 16 && nclusters < FAT_MINCLUST16) ||
+      (var->fv_fattype == 32 && nclusters < FAT_MINCLUST32))
+    {
+      fwarn("WARNING:  Too few clusters to align to %u sectors\n", align);
+      return;
+    }
+
+  finfo("Aligned to %u sectors: %u reserved sectors, %u sectors per FAT\n",
+        align, rsvdseccount, nfatsects);
+
+  fmt->ff_rsvdseccount = rsvdseccount;
+  var->fv_nfatsects    = nfatsects;
+  var->fv_nclusters    = nclusters;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -897,6 +979,10 @@ int mkfatfs_configfatfs(FAR struct fat_format_s *fmt,
        return ret;
     }
 
+  /* Move the FATs and the data region to erase block boundaries */
+
+  mkfatfs_alignfat(fmt, var);
+
   /* Perform FAT specific initialization */
 
   /* Set up boot jump assuming FAT 12/16 offset to bootcode */
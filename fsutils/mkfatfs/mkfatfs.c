@@ -356,9 +356,28 @@ int mkfatfs(FAR const char *pathname, FAR struct fat_format_s *fmt)
   if (!var.fv_sect)
     {
       ferr("ERROR: Failed to allocate working buffers\n");
+      ret = -ENOMEM;
       goto errout_with_driver;
     }
 
+  /* Allocate a buffer of zeroed sectors so that the empty parts of the
+   * reserved area, the FATs and the root directory are written with a few
+   * large transfers.  Settle for a smaller buffer if memory is short.
+   */
+
+  var.fv_nzerosects = CONFIG_FSUTILS_MKFATFS_BUFSECTORS;
+  while (var.fv_nzerosects > 1)
+    {
+      var.fv_zero =
+        (FAR uint8_t *)zalloc(var.fv_nzerosects << var.fv_sectshift);
+      if (var.fv_zero)
+        {
+          break;
+        }
+
+      var.fv_nzerosects >>= 1;
+    }
+
   /* Write the filesystem to media */
 
   ret = mkfatfs_writefatfs(fmt, &var);
@@ -376,6 +395,11 @@ errout:
       free(var.fv_sect);
     }
 
+  if (var.fv_zero)
+    {
+      free(var.fv_zero);
+    }
+
   /* Return any reported errors */
 
   if (ret < 0)
@@ -64,6 +64,12 @@
 
 #define FAT32_DEFAULT_ROOT_CLUSTER     2
 
+/* The number of zeroed sectors written at a time */
+
+#ifndef CONFIG_FSUTILS_MKFATFS_BUFSECTORS
+#  define CONFIG_FSUTILS_MKFATFS_BUFSECTORS 16
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -86,7 +92,9 @@ struct fat_var_s
   uint32_t       fv_sectorsize;     /* Size of one hardware sector */
   uint32_t       fv_nfatsects;      /* Number of sectors in each FAT */
   uint32_t       fv_nclusters;      /* Number of clusters */
+  uint32_t       fv_nzerosects;     /* Number of sectors at fv_zero */
   uint8_t       *fv_sect;           /* Allocated working sector buffer */
+  uint8_t       *fv_zero;           /* Allocated buffer of zeroed sectors */
   const uint8_t *fv_bootcode;       /* Points to boot code to put into MBR */
 };
 
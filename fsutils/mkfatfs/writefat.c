@@ -56,31 +56,37 @@
  ****************************************************************************/
 
 /****************************************************************************
- * Name: mkfatfs_devwrite
+ * Name: mkfatfs_devwritebuf
  *
  * Description:
- *   Write the content of the dedicate sector buffer beginning to the specified sector
+ *   Write a buffer of one or more sectors beginning at the specified sector
  *
  * Input:
- *    fmt  - User specified format parameters
- *    var  - Other format parameters that are not user specifiable
+ *    fmt      - User specified format parameters
+ *    var      - Other format parameters that are not user specifiable
+ *    buffer   - The sectors to write
+ *    sector   - The first sector to write
+ *    nsectors - The number of sectors in buffer
  *
  * Return:
- *    None; caller is responsible for providing valid parameters.
+ *    Zero on success; negated errno on failure
  *
  ****************************************************************************/
 
-static int mkfatfs_devwrite(FAR const struct fat_format_s *fmt,
-                            FAR const struct fat_var_s *var, off_t sector)
+static int mkfatfs_devwritebuf(FAR const struct fat_format_s *fmt,
+                               FAR const struct fat_var_s *var,
+                               FAR const uint8_t *buffer, off_t sector,
+                               uint32_t nsectors)
 {
   ssize_t nwritten;
+  size_t nbytes;
   off_t seekpos;
   off_t fpos;
   int ret;
 
   /* Convert the sector number to a byte offset */
 
-  if (sector < 0 || sector >= fmt->ff_nsectors)
+  if (sector < 0 || sector + nsectors > fmt->ff_nsectors)
     {
       ferr("sector out of range: %lu\n", (unsigned long)sector);
       return -ESPIPE;
@@ -104,26 +110,105 @@ static int mkfatfs_devwrite(FAR const struct fat_format_s *fmt,
       return -EINVAL;
     }
 
-  /* Write the sector to that offset.  Partial writes are not expected. */
+  /* Write the sectors to that offset.  Partial writes are not expected. */
 
-  nwritten = write(var->fv_fd, var->fv_sect, var->fv_sectorsize);
+  nbytes   = (size_t)nsectors << var->fv_sectshift;
+  nwritten = write(var->fv_fd, buffer, nbytes);
   if (nwritten < 0)
     {
       ret = -errno;
       ferr("ERROR:  write failed: size=%lu pos=%lu error=%d\n",
-           (unsigned)var->fv_sectorsize, (unsigned long)fpos, ret);
+           (unsigned long)nbytes, (unsigned long)fpos, ret);
       return ret;
     }
-  else if (nwritten != (ssize_t)var->fv_sectorsize)
+  else if (nwritten != (ssize_t)nbytes)
     {
       ferr("ERROR:  Partial write: size=%lu written=%lu\n",
-           (unsigned)var->fv_sectorsize, (unsigned long)nwritten);
+           (unsigned long)nbytes, (unsigned long)nwritten);
       return -ENODATA;
     }
 
   return OK;
 }
 
+/****************************************************************************
+ * Name: mkfatfs_devwrite
+ *
+ * Description:
+ *   Write the content of the dedicate sector buffer beginning to the specified sector
+ *
+ * Input:
+ *    fmt  - User specified format parameters
+ *    var  - Other format parameters that are not user specifiable
+ *
+ * Return:
+ *    Zero on success; negated errno on failure
+ *
+ ****************************************************************************/
+
+static int mkfatfs_devwrite(FAR const struct fat_format_s *fmt,
+                            FAR const struct fat_var_s *var, off_t sector)
+{
+  return mkfatfs_devwritebuf(fmt, var, var->fv_sect, sector, 1);
+}
+
+/****************************************************************************
+ * Name: mkfatfs_devzero
+ *
+ * Description:
+ *   Clear a range of sectors, writing as many sectors at a time as the
+ *   zeroed sector buffer holds.
+ *
+ * Input:
+ *    fmt      - User specified format parameters
+ *    var      - Other format parameters that are not user specifiable
+ *    sector   - The first sector to clear
+ *    nsectors - The number of sectors to clear
+ *
+ * Return:
+ *    Zero on success; negated errno on failure
+ *
+ ****************************************************************************/
+
+static int mkfatfs_devzero(FAR const struct fat_format_s *fmt,
+                           FAR const struct fat_var_s *var, off_t sector,
+                           uint32_t nsectors)
+{
+  FAR const uint8_t *buffer;
+  uint32_t maxsects;
+  uint32_t nwrite;
+  int ret;
+
+  /* Without the zeroed buffer, fall back to the working sector */
+
+  if (var->fv_zero)
+    {
+      buffer   = var->fv_zero;
+      maxsects = var->fv_nzerosects;
+    }
+  else
+    {
+      memset(var->fv_sect, 0, var->fv_sectorsize);
+      buffer   = var->fv_sect;
+      maxsects = 1;
+    }
+
+  while (nsectors > 0)
+    {
+      nwrite = nsectors > maxsects ? maxsects : nsectors;
+      ret    = mkfatfs_devwritebuf(fmt, var, buffer, sector, nwrite);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      sector   += nwrite;
+      nsectors -= nwrite;
+    }
+
+  return OK;
+}
+
 /****************************************************************************
  * Name: mkfatfs_initmbr
  *
@@ -390,7 +475,6 @@ static inline void mkfatfs_initrootdir(FAR struct fat_format_s *fmt,
 static inline int mkfatfs_writembr(FAR struct fat_format_s *fmt,
                                    FAR struct fat_var_s *var)
 {
-  int sectno;
   int ret;
 
   /* Create an image of the configured master boot record */
@@ -403,10 +487,9 @@ static inline int mkfatfs_writembr(FAR struct fat_format_s *fmt,
 
   /* Write all of the reserved sectors */
 
-  memset(var->fv_sect, 0, var->fv_sectorsize);
-  for (sectno = 1; sectno < fmt->ff_rsvdseccount && ret >= 0; sectno++)
+  if (ret >= 0 && fmt->ff_rsvdseccount > 1)
     {
-      ret = mkfatfs_devwrite(fmt, var, sectno);
+      ret = mkfatfs_devzero(fmt, var, 1, fmt->ff_rsvdseccount - 1);
     }
 
   /* Write FAT32-specific sectors */
@@ -461,67 +544,66 @@ static inline int mkfatfs_writefat(FAR struct fat_format_s *fmt,
 {
   off_t offset = fmt->ff_rsvdseccount;
   int fatno;
-  int sectno;
   int ret;
 
   /* Loop for each FAT copy */
 
   for (fatno = 0; fatno < fmt->ff_nfats; fatno++)
     {
-      /* Loop for each sector in the FAT */
+      /* Mark cluster allocations in sector one of each FAT */
 
-       for (sectno = 0; sectno < var->fv_nfatsects; sectno++)
-         {
-           memset(var->fv_sect, 0, var->fv_sectorsize);
+      memset(var->fv_sect, 0, var->fv_sectorsize);
+      switch (fmt->ff_fattype)
+        {
+          case 12:
+            /* Mark the first two full FAT entries -- 24 bits, 3 bytes total */
 
-          /* Mark cluster allocations in sector one of each FAT */
+            memset(var->fv_sect, 0xff, 3);
+            break;
 
-           if (sectno == 0)
-             {
-               memset(var->fv_sect, 0, var->fv_sectorsize);
-               switch (fmt->ff_fattype)
-                 {
-                   case 12:
-                     /* Mark the first two full FAT entries -- 24 bits, 3 bytes total */
+          case 16:
+            /* Mark the first two full FAT entries -- 32 bits, 4 bytes total */
 
-                     memset(var->fv_sect, 0xff, 3);
-                     break;
+            memset(var->fv_sect, 0xff, 4);
+            break;
 
-                   case 16:
-                     /* Mark the first two full FAT entries -- 32 bits, 4 bytes total */
+          case 32:
+          default: /* Shouldn't happen */
+            /* Mark the first two full FAT entries -- 64 bits, 8 bytes total */
 
-                     memset(var->fv_sect, 0xff, 4);
-                     break;
+            memset(var->fv_sect, 0xff, 8);
 
-                   case 32:
-                   default: /* Shouldn't happen */
-                     /* Mark the first two full FAT entries -- 64 bits, 8 bytes total */
+            /* Cluster 2 is used as the root directory.  Mark as EOF */
 
-                     memset(var->fv_sect, 0xff, 8);
+            var->fv_sect[8] =  0xf8;
+            memset(&var->fv_sect[9], 0xff, 3);
+            break;
+        }
 
-                     /* Cluster 2 is used as the root directory.  Mark as EOF */
+      /* Save the media type in the first byte of the FAT */
 
-                     var->fv_sect[8] =  0xf8;
-                     memset(&var->fv_sect[9], 0xff, 3);
-                     break;
-                 }
+      var->fv_sect[0] = FAT_DEFAULT_MEDIA_TYPE;
 
-               /* Save the media type in the first byte of the FAT */
+      /* Write the first FAT sector */
 
-               var->fv_sect[0] = FAT_DEFAULT_MEDIA_TYPE;
-            }
+      ret = mkfatfs_devwrite(fmt, var, offset);
+      if (ret < 0)
+        {
+          return ret;
+        }
 
-           /* Write the FAT sector */
+      /* The rest of the FAT is cleared with large writes */
 
-           ret = mkfatfs_devwrite(fmt, var, offset);
-           if (ret < 0)
-             {
-               return ret;
-             }
-           offset++;
-         }
-     }
-   return OK;
+      ret = mkfatfs_devzero(fmt, var, offset + 1, var->fv_nfatsects - 1);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      offset += var->fv_nfatsects;
+    }
+
+  return OK;
 }
 
 /****************************************************************************
@@ -544,28 +626,20 @@ static inline int mkfatfs_writerootdir(FAR struct fat_format_s *fmt,
 {
   off_t offset = fmt->ff_rsvdseccount + fmt->ff_nfats * var->fv_nfatsects;
   int ret;
-  int i;
 
   /* Write the root directory after the last FAT. This is the root directory
-   * area for FAT12/16, and the first cluster on FAT32.
+   * area for FAT12/16, and the first cluster on FAT32.  Only the first
+   * sector holds data, the others are cleared with large writes.
    */
 
-  for (i = 0; i < var->fv_nrootdirsects; i++)
+  mkfatfs_initrootdir(fmt, var, 0);
+  ret = mkfatfs_devwrite(fmt, var, offset);
+  if (ret < 0)
     {
-      /* Format the next sector of the root directory */
-
-      mkfatfs_initrootdir(fmt, var, i);
-
-      /* Write the next sector of the root directory */
-
-      ret = mkfatfs_devwrite(fmt, var, offset);
-      if (ret < 0)
-        {
-          return ret;
-        }
-      offset++;
+      return ret;
     }
-  return 0;
+
+  return mkfatfs_devzero(fmt, var, offset + 1, var->fv_nrootdirsects - 1);
 }
 
 /****************************************************************************
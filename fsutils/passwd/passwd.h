@@ -68,6 +68,7 @@
 struct passwd_s
 {
   off_t offset;                      /* File offset (start of record) */
+  off_t encoffset;                   /* File offset of the encrypted password */
   char encrypted[MAX_ENCRYPTED + 1]; /* Encrtyped password in file */
 };
 
@@ -168,4 +169,51 @@ int passwd_delete(off_t offset);
 
 int passwd_find(FAR const char *username, FAR struct passwd_s *passwd);
 
+/****************************************************************************
+ * Name: passwd_parse
+ *
+ * Description:
+ *   Split one line of the password file into the username and the
+ *   encrypted password.  Both are NUL terminated in place.
+ *
+ * Input Parameters:
+ *   line      - The line read from the password file
+ *   username  - The location to return the username
+ *   encrypted - The location to return the encrypted password
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success; -ENOENT if the line is not a record;
+ *   -EINVAL if the record has no password; -E2BIG if the password is too
+ *   long.  The username is valid in the last two cases.
+ *
+ ****************************************************************************/
+
+int passwd_parse(FAR char *line, FAR char **username,
+                 FAR char **encrypted);
+
+/****************************************************************************
+ * Name: passwd_cache_find and passwd_cache_invalidate
+ *
+ * Description:
+ *   passwd_cache_find() looks a user up in a memory resident, hashed copy
+ *   of the password file.  The copy is read again when the size or the
+ *   modification time of the file changes.  passwd_cache_invalidate()
+ *   forces the copy to be read again after the file has been modified.
+ *
+ * Input Parameters:
+ *   username - The user to find
+ *   passwd   - The location to return the record of the user
+ *
+ * Returned Value:
+ *   As for passwd_find().
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FSUTILS_PASSWD_CACHE
+int passwd_cache_find(FAR const char *username, FAR struct passwd_s *passwd);
+void passwd_cache_invalidate(void);
+#else
+#  define passwd_cache_invalidate()
+#endif
+
 #endif /* __APPS_FSUTILS_PASSWD_PASSWD_H */
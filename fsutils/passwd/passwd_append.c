@@ -100,5 +100,6 @@ int passwd_append(FAR const char *username, FAR const char *password)
 
 errout_with_stream:
   (void)fclose(stream);
+  passwd_cache_invalidate();
   return ret;
 }
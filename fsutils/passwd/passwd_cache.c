@@ -0,0 +1,345 @@
+/****************************************************************************
+ * apps/fsutils/passwd/passwd_cache.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <semaphore.h>
+#include <assert.h>
+#include <errno.h>
+
+#include "passwd.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_FSUTILS_PASSWD_CACHE_NBUCKETS
+#  define CONFIG_FSUTILS_PASSWD_CACHE_NBUCKETS 16
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One user of the password file */
+
+struct passwd_entry_s
+{
+  FAR struct passwd_entry_s *flink;
+  off_t offset;                      /* File offset (start of record) */
+  off_t encoffset;                   /* File offset of the encrypted password */
+  int status;                        /* OK or the error passwd_find() reports */
+  char encrypted[MAX_ENCRYPTED + 1]; /* Encrypted password in file */
+  char username[1];                  /* Allocated with the entry */
+};
+
+/* The memory resident copy of the password file */
+
+struct passwd_cache_s
+{
+  sem_t exclsem;                     /* Serializes access to the cache */
+  bool valid;                        /* The entries match the file */
+  off_t size;                        /* Size of the file when read */
+  time_t mtime;                      /* Modification time when read */
+  FAR struct passwd_entry_s *hash[CONFIG_FSUTILS_PASSWD_CACHE_NBUCKETS];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct passwd_cache_s g_passwd_cache =
+{
+  SEM_INITIALIZER(1)
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: passwd_cache_hash
+ ****************************************************************************/
+
+static unsigned int passwd_cache_hash(FAR const char *username)
+{
+  unsigned int hash = 5381;
+
+  while (*username)
+    {
+      hash = hash * 33 + (unsigned char)*username++;
+    }
+
+  return hash % CONFIG_FSUTILS_PASSWD_CACHE_NBUCKETS;
+}
+
+/****************************************************************************
+ * Name: passwd_cache_lookup
+ ****************************************************************************/
+
+static FAR struct passwd_entry_s *
+passwd_cache_lookup(FAR const char *username)
+{
+  FAR struct passwd_entry_s *entry;
+
+  entry = g_passwd_cache.hash[passwd_cache_hash(username)];
+  for (; entry; entry = entry->flink)
+    {
+      if (strcmp(entry->username, username) == 0)
+        {
+          return entry;
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: passwd_cache_flush
+ ****************************************************************************/
+
+static void passwd_cache_flush(void)
+{
+  FAR struct passwd_entry_s *entry;
+  int i;
+
+  for (i = 0; i < CONFIG_FSUTILS_PASSWD_CACHE_NBUCKETS; i++)
+    {
+      while ((entry = g_passwd_cache.hash[i]) != NULL)
+        {
+          g_passwd_cache.hash[i] = entry->flink;
+          free(entry);
+        }
+    }
+
+  g_passwd_cache.valid = false;
+}
+
+/****************************************************************************
+ * Name: passwd_cache_load
+ *
+ * Description:
+ *   Read the whole password file into the hash table.  The file is parsed
+ *   as passwd_find() would parse it, and only the first record of each
+ *   user is kept since that is the one passwd_find() would return.
+ *
+ ****************************************************************************/
+
+static int passwd_cache_load(FAR const struct stat *buf)
+{
+  FAR struct passwd_entry_s *entry;
+  FAR char *iobuffer;
+  FAR char *name;
+  FAR char *encrypted;
+  FILE *stream;
+  unsigned int ndx;
+  off_t offset;
+  int status;
+  int ret;
+
+  passwd_cache_flush();
+
+  iobuffer = (FAR char *)malloc(CONFIG_FSUTILS_PASSWD_IOBUFFER_SIZE);
+  if (iobuffer == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  stream = fopen(CONFIG_FSUTILS_PASSWD_PATH, "r");
+  if (stream == NULL)
+    {
+      ret = -errno;
+      DEBUGASSERT(ret < 0);
+      goto errout_with_iobuffer;
+    }
+
+  offset = 0;
+  ret    = OK;
+
+  while (fgets(iobuffer, CONFIG_FSUTILS_PASSWD_IOBUFFER_SIZE, stream) != NULL)
+    {
+      status = passwd_parse(iobuffer, &name, &encrypted);
+      if (status != -ENOENT && passwd_cache_lookup(name) == NULL)
+        {
+          entry = (FAR struct passwd_entry_s *)
+            malloc(sizeof(struct passwd_entry_s) + strlen(name));
+          if (entry == NULL)
+            {
+              ret = -ENOMEM;
+              break;
+            }
+
+          strcpy(entry->username, name);
+          entry->offset       = offset;
+          entry->encoffset    = 0;
+          entry->encrypted[0] = '\0';
+          entry->status       = status;
+
+          if (status == OK)
+            {
+              entry->encoffset = offset + (encrypted - iobuffer);
+              strcpy(entry->encrypted, encrypted);
+            }
+
+          ndx = passwd_cache_hash(name);
+          entry->flink = g_passwd_cache.hash[ndx];
+          g_passwd_cache.hash[ndx] = entry;
+        }
+
+      offset = ftell(stream);
+    }
+
+  fclose(stream);
+
+  if (ret < 0)
+    {
+      passwd_cache_flush();
+    }
+  else
+    {
+      g_passwd_cache.size  = buf->st_size;
+      g_passwd_cache.mtime = buf->st_mtime;
+      g_passwd_cache.valid = true;
+    }
+
+errout_with_iobuffer:
+  free(iobuffer);
+  return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: passwd_cache_find
+ *
+ * Description:
+ *   Look a user up in the memory resident copy of the password file,
+ *   reading the file again first if it has changed.
+ *
+ * Input Parameters:
+ *   username - The user to find
+ *   passwd   - The location to return the record of the user
+ *
+ * Returned Value:
+ *   As for passwd_find().
+ *
+ ****************************************************************************/
+
+int passwd_cache_find(FAR const char *username, FAR struct passwd_s *passwd)
+{
+  FAR struct passwd_entry_s *entry;
+  struct stat buf;
+  int ret;
+
+  while (sem_wait(&g_passwd_cache.exclsem) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+
+  /* A changed size or modification time means that the file was replaced
+   * or edited by something else.
+   */
+
+  ret = stat(CONFIG_FSUTILS_PASSWD_PATH, &buf);
+  if (ret < 0)
+    {
+      ret = -errno;
+      DEBUGASSERT(ret < 0);
+      passwd_cache_flush();
+      goto errout_with_sem;
+    }
+
+  if (!g_passwd_cache.valid || buf.st_size != g_passwd_cache.size ||
+      buf.st_mtime != g_passwd_cache.mtime)
+    {
+      ret = passwd_cache_load(&buf);
+      if (ret < 0)
+        {
+          goto errout_with_sem;
+        }
+    }
+
+  entry = passwd_cache_lookup(username);
+  if (entry == NULL)
+    {
+      ret = -ENOENT;
+    }
+  else
+    {
+      ret = entry->status;
+      if (ret == OK)
+        {
+          passwd->offset    = entry->offset;
+          passwd->encoffset = entry->encoffset;
+          strcpy(passwd->encrypted, entry->encrypted);
+        }
+    }
+
+errout_with_sem:
+  sem_post(&g_passwd_cache.exclsem);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: passwd_cache_invalidate
+ *
+ * Description:
+ *   Force the copy to be read again after the password file has been
+ *   modified, even if its size and modification time did not change.
+ *
+ ****************************************************************************/
+
+void passwd_cache_invalidate(void)
+{
+  while (sem_wait(&g_passwd_cache.exclsem) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+
+  g_passwd_cache.valid = false;
+  sem_post(&g_passwd_cache.exclsem);
+}
@@ -319,6 +319,8 @@ errout_with_tmpfile:
       (void)unlink(CONFIG_FSUTILS_PASSWD_PATH ".tmp");
     }
 
+  passwd_cache_invalidate();
+
 errout_with_iobuffer:
   free(iobuffer);
   return ret;
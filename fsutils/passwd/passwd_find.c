@@ -37,6 +37,8 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
 #include <sys/types.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -50,6 +52,78 @@
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: passwd_parse
+ *
+ * Description:
+ *   Split one line of the password file into the username and the
+ *   encrypted password.  Both are NUL terminated in place.
+ *
+ * Input Parameters:
+ *   line      - The line read from the password file
+ *   username  - The location to return the username
+ *   encrypted - The location to return the encrypted password
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success; -ENOENT if the line is not a record;
+ *   -EINVAL if the record has no password; -E2BIG if the password is too
+ *   long.  The username is valid in the last two cases.
+ *
+ ****************************************************************************/
+
+int passwd_parse(FAR char *line, FAR char **username,
+                 FAR char **encrypted)
+{
+  FAR char *src;
+  int enclen;
+
+  /* Skip over any leading whitespace */
+
+  for (src = line; *src && isspace((int)*src); src++);
+  if (*src == '\0')
+    {
+      /* Bad file format? */
+
+      return -ENOENT;
+    }
+
+  *username = src;
+
+  /* Skip to the end of the name and properly terminate it */
+
+  for (; *src && !isspace((int)*src); src++);
+  if (*src == '\0')
+    {
+      /* Bad file format? */
+
+      return -ENOENT;
+    }
+
+  *src++ = '\0';
+
+  /* Skip over any whitespace after the user name */
+
+  for (; *src && isspace((int)*src); src++);
+  if (*src == '\0')
+    {
+      /* Bad file format? */
+
+      return -EINVAL;
+    }
+
+  /* Find the end of the password and properly terminate it */
+
+  *encrypted = src;
+  for (enclen = 0; *src && !isspace((int)*src); src++, enclen++);
+  if (enclen >= MAX_ENCRYPTED)
+    {
+      return -E2BIG;
+    }
+
+  *src = '\0';
+  return OK;
+}
+
 /****************************************************************************
  * Name: passwd_find
  *
@@ -66,13 +140,16 @@
 
 int passwd_find(FAR const char *username, FAR struct passwd_s *passwd)
 {
+#ifdef CONFIG_FSUTILS_PASSWD_CACHE
+  /* Look the user up in the memory resident copy */
+
+  return passwd_cache_find(username, passwd);
+#else
   FAR char *iobuffer;
   FAR char *name;
-  FAR char *src;
-  FAR char *dest;
+  FAR char *encrypted;
   FILE *stream;
   off_t offset;
-  int enclen;
   int ret;
 
   /* Allocate an I/O buffer for the transfer */
@@ -90,6 +167,7 @@ int passwd_find(FAR const char *username, FAR struct passwd_s *passwd)
     {
       int errcode = errno;
       DEBUGASSERT(errcode > 0);
+      free(iobuffer);
       return -errcode;
     }
 
@@ -102,65 +180,22 @@ int passwd_find(FAR const char *username, FAR struct passwd_s *passwd)
 
   while (fgets(iobuffer, CONFIG_FSUTILS_PASSWD_IOBUFFER_SIZE, stream) != NULL)
     {
-      /* Skip over any leading whitespace */
-
-      for (src = iobuffer; *src && isspace((int)*src); src++);
-      if (*src == '\0')
-        {
-          /* Bad file format? */
-
-          continue;
-        }
-
-      name = src;
-
-      /* Skip to the end of the name and properly terminate it */
-
-      for (; *src && !isspace((int)*src); src++);
-      if (*src == '\0')
-        {
-          /* Bad file format? */
-
-          continue;
-        }
-
-      *src++ = '\0';
+      int status = passwd_parse(iobuffer, &name, &encrypted);
 
       /* Check for a username match */
 
-      if (strcmp(username, name) == 0)
+      if (status != -ENOENT && strcmp(username, name) == 0)
         {
-          /* We have a match, skip over any whitespace after the user name */
-
-          for (; *src && isspace((int)*src); src++);
-          if (*src == '\0')
+          ret = status;
+          if (ret == OK)
             {
-              /* Bad file format? */
+              /* Copy the offsets and password into the returned structure */
 
-              ret = -EINVAL;
-              break;
-            }
-
-          /* Copy the offset and password into the returned structure */
-
-          passwd->offset = offset;
-          dest = passwd->encrypted;
-          enclen = 0;
-
-          while (*src && !isspace((int)*src) && enclen < MAX_ENCRYPTED)
-            {
-              *dest++ = *src++;
-              enclen++;
-            }
-
-          if (enclen >= MAX_ENCRYPTED)
-            {
-              ret = -E2BIG;
-              break;
+              passwd->offset    = offset;
+              passwd->encoffset = offset + (encrypted - iobuffer);
+              strcpy(passwd->encrypted, encrypted);
             }
 
-          *dest = '\0';
-          ret = OK;
           break;
         }
 
@@ -172,4 +207,5 @@ int passwd_find(FAR const char *username, FAR struct passwd_s *passwd)
   fclose(stream);
   free(iobuffer);
   return ret;
+#endif
 }
@@ -37,11 +37,71 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
+#include <stdio.h>
+#include <string.h>
 #include <semaphore.h>
+#include <assert.h>
+#include <errno.h>
 
 #include "fsutils/passwd.h"
 #include <passwd.h>
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: passwd_rewrite
+ *
+ * Description:
+ *   Overwrite the encrypted password of an existing record.  The new
+ *   encrypted password must have the same length as the old one.
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success; a negated errno value is returned on
+ *   failure.  -ENOSPC means that nothing was written.
+ *
+ ****************************************************************************/
+
+static int passwd_rewrite(off_t encoffset, FAR const char *encrypted)
+{
+  FILE *stream;
+  size_t len;
+  int ret;
+
+  stream = fopen(CONFIG_FSUTILS_PASSWD_PATH, "r+");
+  if (stream == NULL)
+    {
+      return -ENOSPC;
+    }
+
+  ret = fseek(stream, encoffset, SEEK_SET);
+  if (ret < 0)
+    {
+      (void)fclose(stream);
+      return -ENOSPC;
+    }
+
+  len = strlen(encrypted);
+  ret = OK;
+
+  if (fwrite(encrypted, 1, len, stream) != len)
+    {
+      ret = -errno;
+      DEBUGASSERT(ret < 0);
+    }
+
+  if (fclose(stream) < 0 && ret == OK)
+    {
+      ret = -errno;
+      DEBUGASSERT(ret < 0);
+    }
+
+  return ret;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -64,6 +124,7 @@
 int passwd_update(FAR const char *username, FAR const char *password)
 {
   struct passwd_s passwd;
+  char encrypted[MAX_ENCRYPTED + 1];
   PASSWD_SEM_DECL(sem);
   int ret;
 
@@ -85,6 +146,26 @@ int passwd_update(FAR const char *username, FAR const char *password)
       goto errout_with_lock;
     }
 
+  /* A record whose encrypted password keeps its length can be updated in
+   * place.  Otherwise, fall back to rewriting the file.
+   */
+
+  ret = passwd_encrypt(password, encrypted);
+  if (ret < 0)
+    {
+      goto errout_with_lock;
+    }
+
+  if (strlen(encrypted) == strlen(passwd.encrypted))
+    {
+      ret = passwd_rewrite(passwd.encoffset, encrypted);
+      passwd_cache_invalidate();
+      if (ret != -ENOSPC)
+        {
+          goto errout_with_lock;
+        }
+    }
+
   /* Remove the line containing this user from the /etc/passwd file */
 
   ret = passwd_delete(passwd.offset);
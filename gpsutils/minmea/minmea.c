@@ -51,6 +51,30 @@
 
 #define boolstr(s) ((s) ? "true" : "false")
 
+/* Parser states */
+
+#define MINMEA_STATE_IDLE      0  /* Waiting for a '$' */
+#define MINMEA_STATE_BODY      1  /* Collecting fields up to '*' or EOL */
+#define MINMEA_STATE_CHECKSUM1 2  /* Expecting the upper checksum digit */
+#define MINMEA_STATE_CHECKSUM2 3  /* Expecting the lower checksum digit */
+#define MINMEA_STATE_EOL       4  /* Expecting the terminating CR or LF */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* A sentence split into fields.  offset[n] is the index within base of the
+ * first character of field n; the field runs up to the next character for
+ * which minmea_isfield() is false.
+ */
+
+struct minmea_fields_s
+{
+  FAR const char *base;
+  FAR const uint8_t *offset;
+  int count;
+};
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -80,136 +104,75 @@ static inline bool minmea_isfield(char c)
   return isprint((unsigned char) c) && c != ',' && c != '*';
 }
 
-/****************************************************************************
- * Public Functions
- ****************************************************************************/
-
-uint8_t minmea_checksum(FAR const char *sentence)
+static inline FAR const char *
+minmea_field(FAR const struct minmea_fields_s *fields, int index)
 {
-  uint8_t checksum = 0x00;
-
-  /* Support senteces with or without the starting dollar sign. */
-
-  if (*sentence == '$')
-    {
-      sentence++;
-    }
-
-  /* The optional checksum is an XOR of all bytes between "$" and "*". */
-
-  while (*sentence && *sentence != '*')
-    {
-      checksum ^= *sentence++;
-    }
-
-  return checksum;
+  return index < fields->count ? fields->base + fields->offset[index] : NULL;
 }
 
-bool minmea_check(FAR const char *sentence, bool strict)
-{
-  uint8_t checksum = 0x00;
-
-  /* Sequence length is limited. */
-
-  if (strlen(sentence) > MINMEA_MAX_LENGTH + 3)
-    {
-      return false;
-    }
-
-  /* A valid sentence starts with "$". */
-
-  if (*sentence++ != '$')
-    {
-      return false;
-    }
-
-  /* The optional checksum is an XOR of all bytes between "$" and "*". */
-
-  while (*sentence && *sentence != '*' &&
-         isprint((unsigned char) *sentence))
-    {
-      checksum ^= *sentence++;
-    }
+/* Split a sentence into fields the same way minmea_scan() always walked
+ * it: a field ends at the first non-field character and only a ',' starts
+ * another one.  Anything beyond MINMEA_MAX_FIELDS fields or 255 characters
+ * is ignored; no sentence format reaches that far.
+ */
 
-  /* If checksum is present... */
+static void minmea_tokenize(FAR struct minmea_fields_s *fields,
+                            FAR const char *sentence, FAR uint8_t *offset)
+{
+  FAR const char *ptr = sentence;
+  int count = 0;
 
-  if (*sentence == '*')
+  while (count < MINMEA_MAX_FIELDS && ptr - sentence <= UINT8_MAX)
     {
-      int upper;
-      int lower;
-      int expected;
-
-      /* Extract checksum. */
+      offset[count++] = ptr - sentence;
 
-      sentence++;
-      upper = hex2int(*sentence++);
-
-      if (upper == -1)
+      while (minmea_isfield(*ptr))
         {
-          return false;
+          ptr++;
         }
 
-      lower = hex2int(*sentence++);
-      if (lower == -1)
+      if (*ptr != ',')
         {
-          return false;
+          break;
         }
 
-      expected = upper << 4 | lower;
+      ptr++;
+    }
 
-      /* Check for checksum mismatch. */
+  fields->base   = sentence;
+  fields->offset = offset;
+  fields->count  = count;
+}
 
-      if (checksum != expected)
-        {
-          return false;
-        }
-    }
-  else if (strict) 
-    {
-      /* Discard non-checksummed frames in strict mode. */
+/* Map a five character talker+type identifier to a sentence ID. */
 
-      return false;
-    }
+static enum minmea_sentence_id minmea_typeid(FAR const char *type)
+{
+  static const char names[][4] =
+  {
+    "RMC", "GGA", "GSA", "GLL", "GST", "GSV"
+  };
 
-  /* The only stuff allowed at this point is a newline. */
+  int i;
 
-  if (*sentence && strcmp(sentence, "\n") &&
-      strcmp(sentence, "\r\n"))
+  for (i = 0; i < sizeof(names) / sizeof(names[0]); i++)
     {
-      return false;
+      if (memcmp(type + 2, names[i], 3) == 0)
+        {
+          return (enum minmea_sentence_id)(MINMEA_SENTENCE_RMC + i);
+        }
     }
 
-  return true;
+  return MINMEA_UNKNOWN;
 }
 
-bool minmea_scan(FAR const char *sentence, FAR const char *format, ...)
+static bool minmea_vscan(FAR const struct minmea_fields_s *fields,
+                         FAR const char *format, va_list ap)
 {
-  bool result = false;
   bool optional = false;
-  va_list ap;
-  va_start(ap, format);
+  int index = 0;
 
-  const char *field = sentence;
-#define next_field() \
-  do \
-    { \
-      /* Progress to the next field. */ \
-      while (minmea_isfield(*sentence)) \
-        { \
-          sentence++; \
-        } \
-      /* Make sure there is a field there. */ \
-      if (*sentence == ',') \
-        { \
-          sentence++; \
-          field = sentence; \
-        } \
-      else \
-        { \
-          field = NULL; \
-        } \
-    } \
-  while (0)
+  FAR const char *field = minmea_field(fields, 0);
 
   while (*format)
     {
@@ -227,7 +190,7 @@ bool minmea_scan(FAR const char *sentence, FAR const char *format, ...)
         {
           /* Field requested but we ran out if input. Bail out. */
 
-          goto parse_error;
+          return false;
         }
 
       switch (type)
@@ -268,7 +231,7 @@ bool minmea_scan(FAR const char *sentence, FAR const char *format, ...)
                         break;
 
                       default:
-                        goto parse_error;
+                        return false;
                     }
                 }
 
@@ -319,7 +282,7 @@ bool minmea_scan(FAR const char *sentence, FAR const char *format, ...)
                                 {
                                   /* integer overflow. bail out. */
 
-                                  goto parse_error;
+                                  return false;
                                 }
                             }
 
@@ -341,12 +304,12 @@ bool minmea_scan(FAR const char *sentence, FAR const char *format, ...)
 
                           if (sign != 0 || value != -1 || scale != 0)
                             {
-                              goto parse_error;
+                              return false;
                             }
                         }
                       else
                         {
-                          goto parse_error;
+                          return false;
                         }
 
                       field++;
@@ -355,7 +318,7 @@ bool minmea_scan(FAR const char *sentence, FAR const char *format, ...)
 
               if ((sign || scale) && value == -1)
                 {
-                  goto parse_error;
+                  return false;
                 }
 
               if (value == -1)
@@ -395,7 +358,7 @@ bool minmea_scan(FAR const char *sentence, FAR const char *format, ...)
                   value = strtol(field, &endptr, 10);
                   if (minmea_isfield(*endptr))
                     {
-                      goto parse_error;
+                      return false;
                     }
                 }
 
@@ -432,19 +395,19 @@ bool minmea_scan(FAR const char *sentence, FAR const char *format, ...)
 
               if (!field)
                 {
-                  goto parse_error;
+                  return false;
                 }
 
               if (field[0] != '$')
                 {
-                  goto parse_error;
+                  return false;
                 }
 
               for (f = 0; f < 5; f++)
                 {
                   if (!minmea_isfield(field[1+f]))
                     {
-                      goto parse_error;
+                      return false;
                     }
                 }
 
@@ -472,7 +435,7 @@ bool minmea_scan(FAR const char *sentence, FAR const char *format, ...)
                     {
                       if (!isdigit((unsigned char) field[f]))
                         {
-                          goto parse_error;
+                          return false;
                         }
                     }
 
@@ -506,7 +469,7 @@ bool minmea_scan(FAR const char *sentence, FAR const char *format, ...)
                     {
                       if (!isdigit((unsigned char) field[f]))
                         {
-                          goto parse_error;
+                          return false;
                         }
                     }
 
@@ -552,84 +515,34 @@ bool minmea_scan(FAR const char *sentence, FAR const char *format, ...)
 
           default:
             {
-              goto parse_error;
+              return false;
             }
             break;
         }
 
-      next_field();
-    }
-
-  result = true;
-
-parse_error:
-  va_end(ap);
-  return result;
-}
-
-bool minmea_talker_id(char talker[3], FAR const char *sentence)
-{
-  char type[6];
+      /* Progress to the next field. */
 
-  if (!minmea_scan(sentence, "t", type))
-    {
-      return false;
+      field = minmea_field(fields, ++index);
     }
 
-  talker[0] = type[0];
-  talker[1] = type[1];
-  talker[2] = '\0';
-
   return true;
 }
 
-enum minmea_sentence_id minmea_sentence_id(FAR const char *sentence,
-                                           bool strict)
+static bool minmea_scanfields(FAR const struct minmea_fields_s *fields,
+                              FAR const char *format, ...)
 {
-  if (!minmea_check(sentence, strict))
-    return MINMEA_INVALID;
-
-  char type[6];
-  if (!minmea_scan(sentence, "t", type))
-    {
-      return MINMEA_INVALID;
-    }
-
-  if (!strcmp(type+2, "RMC"))
-    {
-      return MINMEA_SENTENCE_RMC;
-    }
-
-  if (!strcmp(type+2, "GGA"))
-    {
-      return MINMEA_SENTENCE_GGA;
-    }
-
-  if (!strcmp(type+2, "GSA"))
-    {
-      return MINMEA_SENTENCE_GSA;
-    }
-
-  if (!strcmp(type+2, "GLL"))
-    {
-      return MINMEA_SENTENCE_GLL;
-    }
-
-  if (!strcmp(type+2, "GST"))
-    {
-      return MINMEA_SENTENCE_GST;
-    }
+  va_list ap;
+  bool result;
 
-  if (!strcmp(type+2, "GSV"))
-    {
-      return MINMEA_SENTENCE_GSV;
-    }
+  va_start(ap, format);
+  result = minmea_vscan(fields, format, ap);
+  va_end(ap);
 
-  return MINMEA_UNKNOWN;
+  return result;
 }
 
-bool minmea_parse_rmc(FAR struct minmea_sentence_rmc *frame,
-                      FAR const char *sentence)
+static bool minmea_decode_rmc(FAR struct minmea_sentence_rmc *frame,
+                              FAR const struct minmea_fields_s *fields)
 {
   /* $GPRMC,081836,A,3751.65,S,14507.36,E,000.0,360.0,130998,011.3,E*62 */
 
@@ -639,16 +552,16 @@ bool minmea_parse_rmc(FAR struct minmea_sentence_rmc *frame,
   int longitude_direction;
   int variation_direction;
 
-  if (!minmea_scan(sentence, "tTcfdfdffDfd",
-                   type,
-                   &frame->time,
-                   &validity,
-                   &frame->latitude, &latitude_direction,
-                   &frame->longitude, &longitude_direction,
-                   &frame->speed,
-                   &frame->course,
-                   &frame->date,
-                   &frame->variation, &variation_direction))
+  if (!minmea_scanfields(fields, "tTcfdfdffDfd",
+                        type,
+                        &frame->time,
+                        &validity,
+                        &frame->latitude, &latitude_direction,
+                        &frame->longitude, &longitude_direction,
+                        &frame->speed,
+                        &frame->course,
+                        &frame->date,
+                        &frame->variation, &variation_direction))
     {
       return false;
     }
@@ -666,8 +579,8 @@ bool minmea_parse_rmc(FAR struct minmea_sentence_rmc *frame,
   return true;
 }
 
-bool minmea_parse_gga(FAR struct minmea_sentence_gga *frame,
-                      FAR const char *sentence)
+static bool minmea_decode_gga(FAR struct minmea_sentence_gga *frame,
+                              FAR const struct minmea_fields_s *fields)
 {
   /* $GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47 */
 
@@ -675,17 +588,17 @@ bool minmea_parse_gga(FAR struct minmea_sentence_gga *frame,
   int latitude_direction;
   int longitude_direction;
 
-  if (!minmea_scan(sentence, "tTfdfdiiffcfci_",
-                   type,
-                   &frame->time,
-                   &frame->latitude, &latitude_direction,
-                   &frame->longitude, &longitude_direction,
-                   &frame->fix_quality,
-                   &frame->satellites_tracked,
-                   &frame->hdop,
-                   &frame->altitude, &frame->altitude_units,
-                   &frame->height, &frame->height_units,
-                   &frame->dgps_age))
+  if (!minmea_scanfields(fields, "tTfdfdiiffcfci_",
+                        type,
+                        &frame->time,
+                        &frame->latitude, &latitude_direction,
+                        &frame->longitude, &longitude_direction,
+                        &frame->fix_quality,
+                        &frame->satellites_tracked,
+                        &frame->hdop,
+                        &frame->altitude, &frame->altitude_units,
+                        &frame->height, &frame->height_units,
+                        &frame->dgps_age))
     {
       return false;
     }
@@ -701,32 +614,32 @@ bool minmea_parse_gga(FAR struct minmea_sentence_gga *frame,
   return true;
 }
 
-bool minmea_parse_gsa(FAR struct minmea_sentence_gsa *frame,
-                      FAR const char *sentence)
+static bool minmea_decode_gsa(FAR struct minmea_sentence_gsa *frame,
+                              FAR const struct minmea_fields_s *fields)
 {
   /* $GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39 */
 
   char type[6];
 
-  if (!minmea_scan(sentence, "tciiiiiiiiiiiiifff",
-                   type,
-                   &frame->mode,
-                   &frame->fix_type,
-                   &frame->sats[0],
-                   &frame->sats[1],
-                   &frame->sats[2],
-                   &frame->sats[3],
-                   &frame->sats[4],
-                   &frame->sats[5],
-                   &frame->sats[6],
-                   &frame->sats[7],
-                   &frame->sats[8],
-                   &frame->sats[9],
-                   &frame->sats[10],
-                   &frame->sats[11],
-                   &frame->pdop,
-                   &frame->hdop,
-                   &frame->vdop))
+  if (!minmea_scanfields(fields, "tciiiiiiiiiiiiifff",
+                        type,
+                        &frame->mode,
+                        &frame->fix_type,
+                        &frame->sats[0],
+                        &frame->sats[1],
+                        &frame->sats[2],
+                        &frame->sats[3],
+                        &frame->sats[4],
+                        &frame->sats[5],
+                        &frame->sats[6],
+                        &frame->sats[7],
+                        &frame->sats[8],
+                        &frame->sats[9],
+                        &frame->sats[10],
+                        &frame->sats[11],
+                        &frame->pdop,
+                        &frame->hdop,
+                        &frame->vdop))
     {
       return false;
     }
@@ -739,8 +652,8 @@ bool minmea_parse_gsa(FAR struct minmea_sentence_gsa *frame,
   return true;
 }
 
-bool minmea_parse_gll(FAR struct minmea_sentence_gll *frame,
-                      FAR const char *sentence)
+static bool minmea_decode_gll(FAR struct minmea_sentence_gll *frame,
+                              FAR const struct minmea_fields_s *fields)
 {
   /* $GPGLL,3723.2475,N,12158.3416,W,161229.487,A,A*41$; */
 
@@ -748,13 +661,13 @@ bool minmea_parse_gll(FAR struct minmea_sentence_gll *frame,
   int latitude_direction;
   int longitude_direction;
 
-  if (!minmea_scan(sentence, "tfdfdTc;c",
-                   type,
-                   &frame->latitude, &latitude_direction,
-                   &frame->longitude, &longitude_direction,
-                   &frame->time,
-                   &frame->status,
-                   &frame->mode))
+  if (!minmea_scanfields(fields, "tfdfdTc;c",
+                        type,
+                        &frame->latitude, &latitude_direction,
+                        &frame->longitude, &longitude_direction,
+                        &frame->time,
+                        &frame->status,
+                        &frame->mode))
     {
       return false;
     }
@@ -770,23 +683,23 @@ bool minmea_parse_gll(FAR struct minmea_sentence_gll *frame,
   return true;
 }
 
-bool minmea_parse_gst(FAR struct minmea_sentence_gst *frame,
-                      FAR const char *sentence)
+static bool minmea_decode_gst(FAR struct minmea_sentence_gst *frame,
+                              FAR const struct minmea_fields_s *fields)
 {
   /* $GPGST,024603.00,3.2,6.6,4.7,47.3,5.8,5.6,22.0*58 */
 
   char type[6];
 
-  if (!minmea_scan(sentence, "tTfffffff",
-                   type,
-                   &frame->time,
-                   &frame->rms_deviation,
-                   &frame->semi_major_deviation,
-                   &frame->semi_minor_deviation,
-                   &frame->semi_major_orientation,
-                   &frame->latitude_error_deviation,
-                   &frame->longitude_error_deviation,
-                   &frame->altitude_error_deviation))
+  if (!minmea_scanfields(fields, "tTfffffff",
+                        type,
+                        &frame->time,
+                        &frame->rms_deviation,
+                        &frame->semi_major_deviation,
+                        &frame->semi_minor_deviation,
+                        &frame->semi_major_orientation,
+                        &frame->latitude_error_deviation,
+                        &frame->longitude_error_deviation,
+                        &frame->altitude_error_deviation))
     {
       return false;
     }
@@ -799,8 +712,8 @@ bool minmea_parse_gst(FAR struct minmea_sentence_gst *frame,
   return true;
 }
 
-bool minmea_parse_gsv(FAR struct minmea_sentence_gsv *frame,
-                      FAR const char *sentence)
+static bool minmea_decode_gsv(FAR struct minmea_sentence_gsv *frame,
+                              FAR const struct minmea_fields_s *fields)
 {
   /* $GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00*74
    * $GPGSV,3,3,11,22,42,067,42,24,14,311,43,27,05,244,00,,,,*4D
@@ -810,27 +723,27 @@ bool minmea_parse_gsv(FAR struct minmea_sentence_gsv *frame,
 
   char type[6];
 
-  if (!minmea_scan(sentence, "tiii;iiiiiiiiiiiiiiii",
-                   type,
-                   &frame->total_msgs,
-                   &frame->msg_nr,
-                   &frame->total_sats,
-                   &frame->sats[0].nr,
-                   &frame->sats[0].elevation,
-                   &frame->sats[0].azimuth,
-                   &frame->sats[0].snr,
-                   &frame->sats[1].nr,
-                   &frame->sats[1].elevation,
-                   &frame->sats[1].azimuth,
-                   &frame->sats[1].snr,
-                   &frame->sats[2].nr,
-                   &frame->sats[2].elevation,
-                   &frame->sats[2].azimuth,
-                   &frame->sats[2].snr,
-                   &frame->sats[3].nr,
-                   &frame->sats[3].elevation,
-                   &frame->sats[3].azimuth,
-                   &frame->sats[3].snr))
+  if (!minmea_scanfields(fields, "tiii;iiiiiiiiiiiiiiii",
+                        type,
+                        &frame->total_msgs,
+                        &frame->msg_nr,
+                        &frame->total_sats,
+                        &frame->sats[0].nr,
+                        &frame->sats[0].elevation,
+                        &frame->sats[0].azimuth,
+                        &frame->sats[0].snr,
+                        &frame->sats[1].nr,
+                        &frame->sats[1].elevation,
+                        &frame->sats[1].azimuth,
+                        &frame->sats[1].snr,
+                        &frame->sats[2].nr,
+                        &frame->sats[2].elevation,
+                        &frame->sats[2].azimuth,
+                        &frame->sats[2].snr,
+                        &frame->sats[3].nr,
+                        &frame->sats[3].elevation,
+                        &frame->sats[3].azimuth,
+                        &frame->sats[3].snr))
     {
       return false;
     }
@@ -843,6 +756,423 @@ bool minmea_parse_gsv(FAR struct minmea_sentence_gsv *frame,
   return true;
 }
 
+/* Decide what the sentence is as soon as its identifier field is complete,
+ * so that filtered sentences are skipped rather than buffered.
+ */
+
+static bool minmea_parser_classify(FAR struct minmea_parser *parser)
+{
+  if (parser->len < 6)
+    {
+      parser->errors++;
+      parser->state = MINMEA_STATE_IDLE;
+      return false;
+    }
+
+  parser->id = minmea_typeid(parser->buffer + 1);
+  if ((parser->mask & MINMEA_MASK(parser->id)) == 0)
+    {
+      parser->state = MINMEA_STATE_IDLE;
+      return false;
+    }
+
+  return true;
+}
+
+/* Decode a complete sentence straight from the recorded field offsets and
+ * hand it to the callback.  Returns the number of frames delivered.
+ */
+
+static int minmea_parser_finish(FAR struct minmea_parser *parser)
+{
+  struct minmea_fields_s fields;
+  union minmea_frame frame;
+  bool ok;
+
+  parser->state = MINMEA_STATE_IDLE;
+  parser->buffer[parser->len] = '\0';
+
+  if (parser->id == MINMEA_INVALID && !minmea_parser_classify(parser))
+    {
+      return 0;
+    }
+
+  fields.base   = parser->buffer;
+  fields.offset = parser->offset;
+  fields.count  = parser->nfields;
+
+  switch (parser->id)
+    {
+      case MINMEA_SENTENCE_RMC:
+        ok = minmea_decode_rmc(&frame.rmc, &fields);
+        break;
+
+      case MINMEA_SENTENCE_GGA:
+        ok = minmea_decode_gga(&frame.gga, &fields);
+        break;
+
+      case MINMEA_SENTENCE_GSA:
+        ok = minmea_decode_gsa(&frame.gsa, &fields);
+        break;
+
+      case MINMEA_SENTENCE_GLL:
+        ok = minmea_decode_gll(&frame.gll, &fields);
+        break;
+
+      case MINMEA_SENTENCE_GST:
+        ok = minmea_decode_gst(&frame.gst, &fields);
+        break;
+
+      case MINMEA_SENTENCE_GSV:
+        ok = minmea_decode_gsv(&frame.gsv, &fields);
+        break;
+
+      default:
+        ok = true;
+        break;
+    }
+
+  if (!ok)
+    {
+      parser->errors++;
+      return 0;
+    }
+
+  parser->callback(parser->arg, (enum minmea_sentence_id)parser->id,
+                   parser->id == MINMEA_UNKNOWN ? NULL : &frame,
+                   parser->buffer);
+  return 1;
+}
+
+static int minmea_parser_putc(FAR struct minmea_parser *parser, char ch)
+{
+  int value;
+
+  if (ch == '$')
+    {
+      /* A '$' always starts a new sentence, abandoning any partial one. */
+
+      if (parser->state != MINMEA_STATE_IDLE)
+        {
+          parser->errors++;
+        }
+
+      parser->state     = MINMEA_STATE_BODY;
+      parser->id        = MINMEA_INVALID;
+      parser->checksum  = 0;
+      parser->buffer[0] = '$';
+      parser->len       = 1;
+      parser->offset[0] = 0;
+      parser->nfields   = 1;
+      return 0;
+    }
+
+  switch (parser->state)
+    {
+      case MINMEA_STATE_BODY:
+        if (ch == '*')
+          {
+            if (parser->id != MINMEA_INVALID ||
+                minmea_parser_classify(parser))
+              {
+                parser->state = MINMEA_STATE_CHECKSUM1;
+              }
+          }
+        else if (ch == '\r' || ch == '\n')
+          {
+            if (!parser->strict)
+              {
+                return minmea_parser_finish(parser);
+              }
+
+            /* Discard non-checksummed frames in strict mode. */
+
+            parser->errors++;
+            parser->state = MINMEA_STATE_IDLE;
+          }
+        else if (!isprint((unsigned char)ch) ||
+                 parser->len >= MINMEA_MAX_LENGTH)
+          {
+            parser->errors++;
+            parser->state = MINMEA_STATE_IDLE;
+          }
+        else if (ch == ',')
+          {
+            if (parser->id == MINMEA_INVALID &&
+                !minmea_parser_classify(parser))
+              {
+                break;
+              }
+
+            if (parser->nfields >= MINMEA_MAX_FIELDS)
+              {
+                parser->errors++;
+                parser->state = MINMEA_STATE_IDLE;
+                break;
+              }
+
+            parser->checksum ^= ch;
+            parser->buffer[parser->len++] = ch;
+            parser->offset[parser->nfields++] = parser->len;
+          }
+        else
+          {
+            parser->checksum ^= ch;
+            parser->buffer[parser->len++] = ch;
+          }
+        break;
+
+      case MINMEA_STATE_CHECKSUM1:
+      case MINMEA_STATE_CHECKSUM2:
+        value = hex2int(ch);
+        if (value < 0)
+          {
+            parser->errors++;
+            parser->state = MINMEA_STATE_IDLE;
+          }
+        else if (parser->state == MINMEA_STATE_CHECKSUM1)
+          {
+            parser->expected = value << 4;
+            parser->state    = MINMEA_STATE_CHECKSUM2;
+          }
+        else if ((parser->expected | value) != parser->checksum)
+          {
+            parser->errors++;
+            parser->state = MINMEA_STATE_IDLE;
+          }
+        else
+          {
+            parser->state = MINMEA_STATE_EOL;
+          }
+        break;
+
+      case MINMEA_STATE_EOL:
+        if (ch == '\r' || ch == '\n')
+          {
+            return minmea_parser_finish(parser);
+          }
+
+        /* The only stuff allowed after the checksum is a newline. */
+
+        parser->errors++;
+        parser->state = MINMEA_STATE_IDLE;
+        break;
+
+      default:
+        break;
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+uint8_t minmea_checksum(FAR const char *sentence)
+{
+  uint8_t checksum = 0x00;
+
+  /* Support senteces with or without the starting dollar sign. */
+
+  if (*sentence == '$')
+    {
+      sentence++;
+    }
+
+  /* The optional checksum is an XOR of all bytes between "$" and "*". */
+
+  while (*sentence && *sentence != '*')
+    {
+      checksum ^= *sentence++;
+    }
+
+  return checksum;
+}
+
+bool minmea_check(FAR const char *sentence, bool strict)
+{
+  uint8_t checksum = 0x00;
+
+  /* Sequence length is limited. */
+
+  if (strlen(sentence) > MINMEA_MAX_LENGTH + 3)
+    {
+      return false;
+    }
+
+  /* A valid sentence starts with "$". */
+
+  if (*sentence++ != '$')
+    {
+      return false;
+    }
+
+  /* The optional checksum is an XOR of all bytes between "$" and "*". */
+
+  while (*sentence && *sentence != '*' &&
+         isprint((unsigned char) *sentence))
+    {
+      checksum ^= *sentence++;
+    }
+
+  /* If checksum is present... */
+
+  if (*sentence == '*')
+    {
+      int upper;
+      int lower;
+      int expected;
+
+      /* Extract checksum. */
+
+      sentence++;
+      upper = hex2int(*sentence++);
+
+      if (upper == -1)
+        {
+          return false;
+        }
+
+      lower = hex2int(*sentence++);
+      if (lower == -1)
+        {
+          return false;
+        }
+
+      expected = upper << 4 | lower;
+
+      /* Check for checksum mismatch. */
+
+      if (checksum != expected)
+        {
+          return false;
+        }
+    }
+  else if (strict) 
+    {
+      /* Discard non-checksummed frames in strict mode. */
+
+      return false;
+    }
+
+  /* The only stuff allowed at this point is a newline. */
+
+  if (*sentence && strcmp(sentence, "\n") &&
+      strcmp(sentence, "\r\n"))
+    {
+      return false;
+    }
+
+  return true;
+}
+
+bool minmea_scan(FAR const char *sentence, FAR const char *format, ...)
+{
+  struct minmea_fields_s fields;
+  uint8_t offset[MINMEA_MAX_FIELDS];
+  va_list ap;
+  bool result;
+
+  minmea_tokenize(&fields, sentence, offset);
+
+  va_start(ap, format);
+  result = minmea_vscan(&fields, format, ap);
+  va_end(ap);
+
+  return result;
+}
+
+bool minmea_talker_id(char talker[3], FAR const char *sentence)
+{
+  char type[6];
+
+  if (!minmea_scan(sentence, "t", type))
+    {
+      return false;
+    }
+
+  talker[0] = type[0];
+  talker[1] = type[1];
+  talker[2] = '\0';
+
+  return true;
+}
+
+enum minmea_sentence_id minmea_sentence_id(FAR const char *sentence,
+                                           bool strict)
+{
+  if (!minmea_check(sentence, strict))
+    return MINMEA_INVALID;
+
+  char type[6];
+  if (!minmea_scan(sentence, "t", type))
+    {
+      return MINMEA_INVALID;
+    }
+
+  return minmea_typeid(type);
+}
+
+bool minmea_parse_rmc(FAR struct minmea_sentence_rmc *frame,
+                      FAR const char *sentence)
+{
+  struct minmea_fields_s fields;
+  uint8_t offset[MINMEA_MAX_FIELDS];
+
+  minmea_tokenize(&fields, sentence, offset);
+  return minmea_decode_rmc(frame, &fields);
+}
+
+bool minmea_parse_gga(FAR struct minmea_sentence_gga *frame,
+                      FAR const char *sentence)
+{
+  struct minmea_fields_s fields;
+  uint8_t offset[MINMEA_MAX_FIELDS];
+
+  minmea_tokenize(&fields, sentence, offset);
+  return minmea_decode_gga(frame, &fields);
+}
+
+bool minmea_parse_gsa(FAR struct minmea_sentence_gsa *frame,
+                      FAR const char *sentence)
+{
+  struct minmea_fields_s fields;
+  uint8_t offset[MINMEA_MAX_FIELDS];
+
+  minmea_tokenize(&fields, sentence, offset);
+  return minmea_decode_gsa(frame, &fields);
+}
+
+bool minmea_parse_gll(FAR struct minmea_sentence_gll *frame,
+                      FAR const char *sentence)
+{
+  struct minmea_fields_s fields;
+  uint8_t offset[MINMEA_MAX_FIELDS];
+
+  minmea_tokenize(&fields, sentence, offset);
+  return minmea_decode_gll(frame, &fields);
+}
+
+bool minmea_parse_gst(FAR struct minmea_sentence_gst *frame,
+                      FAR const char *sentence)
+{
+  struct minmea_fields_s fields;
+  uint8_t offset[MINMEA_MAX_FIELDS];
+
+  minmea_tokenize(&fields, sentence, offset);
+  return minmea_decode_gst(frame, &fields);
+}
+
+bool minmea_parse_gsv(FAR struct minmea_sentence_gsv *frame,
+                      FAR const char *sentence)
+{
+  struct minmea_fields_s fields;
+  uint8_t offset[MINMEA_MAX_FIELDS];
+
+  minmea_tokenize(&fields, sentence, offset);
+  return minmea_decode_gsv(frame, &fields);
+}
+
 int minmea_gettime(FAR struct timespec *ts,
                    FAR const struct minmea_date *date,
                    FAR const struct minmea_time *time_)
@@ -876,3 +1206,85 @@ int minmea_gettime(FAR struct timespec *ts,
       return -1;
     }
 }
+
+int minmea_gettime_cached(FAR struct timespec *ts,
+                          FAR struct minmea_timecache *cache,
+                          FAR const struct minmea_date *date,
+                          FAR const struct minmea_time *time_)
+{
+  int_least32_t seconds;
+
+  if (time_->hours == -1)
+    {
+      return -1;
+    }
+
+  seconds = (time_->hours * 60 + time_->minutes) * 60 + time_->seconds;
+
+  if (date == NULL)
+    {
+      /* Reuse the last date seen, stepping to the next day when the time
+       * of day goes backwards by more than twelve hours.
+       */
+
+      if (cache->date.day == 0)
+        {
+          return -1;
+        }
+
+      if (seconds < cache->seconds - 12 * 60 * 60)
+        {
+          cache->midnight += 24 * 60 * 60;
+        }
+    }
+  else if (date->day != cache->date.day || date->month != cache->date.month ||
+           date->year != cache->date.year)
+    {
+      struct minmea_time midnight;
+      struct timespec base;
+
+      midnight.hours        = 0;
+      midnight.minutes      = 0;
+      midnight.seconds      = 0;
+      midnight.microseconds = 0;
+
+      if (minmea_gettime(&base, date, &midnight) < 0)
+        {
+          return -1;
+        }
+
+      cache->date     = *date;
+      cache->midnight = base.tv_sec;
+    }
+
+  cache->seconds = seconds;
+  ts->tv_sec     = cache->midnight + seconds;
+  ts->tv_nsec    = time_->microseconds * 1000;
+  return 0;
+}
+
+void minmea_parser_init(FAR struct minmea_parser *parser, uint32_t mask,
+                        bool strict, minmea_callback_t callback,
+                        FAR void *arg)
+{
+  memset(parser, 0, sizeof(*parser));
+  parser->callback = callback;
+  parser->arg      = arg;
+  parser->mask     = mask;
+  parser->strict   = strict;
+  parser->state    = MINMEA_STATE_IDLE;
+  parser->id       = MINMEA_INVALID;
+}
+
+int minmea_parser_feed(FAR struct minmea_parser *parser,
+                       FAR const char *data, size_t len)
+{
+  int nframes = 0;
+
+  while (len-- > 0)
+    {
+      nframes += minmea_parser_putc(parser, *data++);
+    }
+
+  return nframes;
+}
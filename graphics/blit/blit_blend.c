@@ -0,0 +1,232 @@
+/****************************************************************************
+ * apps/graphics/blit/blit_blend.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "blit_internal.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The average of every component in a word, rounded up:
+ *
+ *   (a + b + 1) / 2 = (a | b) - (a ^ b) / 2
+ *
+ * The mask clears the least significant bit of each component before the
+ * shift so that no bit moves into the neighboring component.
+ */
+
+#define BLIT_AVG(a,b,m)    (((a) | (b)) - ((((a) ^ (b)) & (m)) >> 1))
+
+#define BLIT_AVGMASK16     0xf7de        /* One RGB565 pixel */
+#define BLIT_AVGMASK16X2   0xf7def7de    /* Two RGB565 pixels */
+#define BLIT_AVGMASK32     0xfefefefe    /* One RGB888 pixel */
+
+/* RGB565 components spread over a 32-bit word as
+ * -----GGGGGG-----RRRRR------BBBBB leave room above each component for it
+ * to be multiplied by an alpha of 0-32.
+ */
+
+#define BLIT_SPREAD16      0x07e0f81f
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: blit_average16
+ *
+ * Description:
+ *   Average two rows of RGB565 pixels, two pixels per word when the rows
+ *   have the same alignment.
+ *
+ ****************************************************************************/
+
+void blit_average16(FAR uint16_t *dest, FAR const uint16_t *src,
+                    unsigned int npixels)
+{
+  FAR uint32_t *dest32;
+  FAR const uint32_t *src32;
+  uint32_t a;
+  uint32_t b;
+  unsigned int i;
+
+  if ((((uintptr_t)dest ^ (uintptr_t)src) & 3) == 0)
+    {
+      if (npixels > 0 && !BLIT_ALIGNED(dest))
+        {
+          a       = *dest;
+          b       = *src++;
+          *dest++ = BLIT_AVG(a, b, BLIT_AVGMASK16);
+          npixels--;
+        }
+
+      dest32 = (FAR uint32_t *)dest;
+      src32  = (FAR const uint32_t *)src;
+
+      for (i = 0; i < (npixels >> 1); i++)
+        {
+          a         = dest32[i];
+          b         = src32[i];
+          dest32[i] = BLIT_AVG(a, b, BLIT_AVGMASK16X2);
+        }
+
+      dest    += npixels & ~1;
+      src     += npixels & ~1;
+      npixels &= 1;
+    }
+
+  for (; npixels > 0; npixels--)
+    {
+      a       = *dest;
+      b       = *src++;
+      *dest++ = BLIT_AVG(a, b, BLIT_AVGMASK16);
+    }
+}
+
+/****************************************************************************
+ * Name: blit_average32
+ *
+ * Description:
+ *   Average two rows of RGB888 pixels.  With the DSP extension, this is
+ *   a - (a - b) / 2 computed on all four bytes by two instructions.
+ *
+ ****************************************************************************/
+
+void blit_average32(FAR uint32_t *dest, FAR const uint32_t *src,
+                    unsigned int npixels)
+{
+  uint32_t a;
+  uint32_t b;
+
+  for (; npixels > 0; npixels--)
+    {
+      a       = *dest;
+      b       = *src++;
+#ifdef HAVE_BLIT_SIMD32
+      *dest++ = blit_usub8(a, blit_uhsub8(a, b));
+#else
+      *dest++ = BLIT_AVG(a, b, BLIT_AVGMASK32);
+#endif
+    }
+}
+
+/****************************************************************************
+ * Name: blit_blend16
+ *
+ * Description:
+ *   Blend RGB565 pixels.  The three components of a pixel are spread over
+ *   one word and blended with a single pair of multiplications.
+ *
+ ****************************************************************************/
+
+void blit_blend16(FAR uint16_t *dest, FAR const uint16_t *src,
+                  unsigned int npixels, uint8_t alpha)
+{
+  uint32_t fg;
+  uint32_t bg;
+  uint32_t a;
+
+  /* Reduce alpha to the range 0-32 */
+
+  a = ((uint32_t)alpha + 4) >> 3;
+  if (a == 0)
+    {
+      return;
+    }
+  else if (a == 32)
+    {
+      memcpy(dest, src, npixels * sizeof(uint16_t));
+      return;
+    }
+
+  for (; npixels > 0; npixels--)
+    {
+      fg      = *src++;
+      bg      = *dest;
+      fg      = (fg | (fg << 16)) & BLIT_SPREAD16;
+      bg      = (bg | (bg << 16)) & BLIT_SPREAD16;
+      fg      = ((fg * a + bg * (32 - a)) >> 5) & BLIT_SPREAD16;
+      *dest++ = (uint16_t)(fg | (fg >> 16));
+    }
+}
+
+/****************************************************************************
+ * Name: blit_blend32
+ *
+ * Description:
+ *   Blend RGB888 pixels.  Red and blue are blended together in one word and
+ *   green in another.
+ *
+ ****************************************************************************/
+
+void blit_blend32(FAR uint32_t *dest, FAR const uint32_t *src,
+                  unsigned int npixels, uint8_t alpha)
+{
+  uint32_t fg;
+  uint32_t bg;
+  uint32_t rb;
+  uint32_t g;
+  uint32_t a;
+
+  if (alpha == 0)
+    {
+      return;
+    }
+
+  /* Extend alpha to the range 1-256 */
+
+  a = (uint32_t)alpha + (alpha >> 7);
+
+  for (; npixels > 0; npixels--)
+    {
+      fg      = *src++;
+      bg      = *dest;
+      rb      = (((fg & 0xff00ff) * a +
+                  (bg & 0xff00ff) * (256 - a)) >> 8) & 0xff00ff;
+      g       = (((fg & 0x00ff00) * a +
+                  (bg & 0x00ff00) * (256 - a)) >> 8) & 0x00ff00;
+      *dest++ = (bg & 0xff000000) | rb | g;
+    }
+}
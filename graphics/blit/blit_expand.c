@@ -0,0 +1,214 @@
+/****************************************************************************
+ * apps/graphics/blit/blit_expand.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <debug.h>
+
+#include "blit_internal.h"
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: blit_slow16
+ *
+ * Description:
+ *   Expand pixels one at a time.  Used for unaligned destinations and for
+ *   the pixels in a final partial source byte.
+ *
+ ****************************************************************************/
+
+static void blit_slow16(FAR uint16_t *dest, FAR const uint8_t *src,
+                        unsigned int bpp, unsigned int npixels,
+                        FAR const uint16_t *palette)
+{
+  unsigned int mask = (1 << bpp) - 1;
+  unsigned int shift = 0;
+  uint8_t byte = 0;
+
+  for (; npixels > 0; npixels--)
+    {
+      if (shift == 0)
+        {
+          byte  = *src++;
+          shift = 8;
+        }
+
+      shift  -= bpp;
+      *dest++ = palette[(byte >> shift) & mask];
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: blit_expand16
+ *
+ * Description:
+ *   Expand 1, 2 or 4 bit-per-pixel indices to RGB565.  When dest is word
+ *   aligned, each source byte is converted with a small table of pixel
+ *   pairs and stored a 32-bit word at a time.
+ *
+ ****************************************************************************/
+
+void blit_expand16(FAR uint16_t *dest, FAR const uint8_t *src,
+                   unsigned int bpp, unsigned int npixels,
+                   FAR const uint16_t *palette)
+{
+  FAR uint32_t *dest32;
+  uint32_t pairs[16];
+  unsigned int nbytes;
+  unsigned int ppb;
+  unsigned int i;
+  uint8_t byte;
+
+  DEBUGASSERT(bpp == 1 || bpp == 2 || bpp == 4);
+
+  if (!BLIT_ALIGNED(dest))
+    {
+      blit_slow16(dest, src, bpp, npixels, palette);
+      return;
+    }
+
+  ppb    = 8 / bpp;
+  nbytes = npixels / ppb;
+  dest32 = (FAR uint32_t *)dest;
+
+  switch (bpp)
+    {
+      case 1:
+
+        /* Four pairs; each byte becomes four words */
+
+        for (i = 0; i < 4; i++)
+          {
+            pairs[i] = BLIT_PAIR16(palette[i >> 1], palette[i & 1]);
+          }
+
+        for (i = 0; i < nbytes; i++, dest32 += 4)
+          {
+            byte      = src[i];
+            dest32[0] = pairs[byte >> 6];
+            dest32[1] = pairs[(byte >> 4) & 3];
+            dest32[2] = pairs[(byte >> 2) & 3];
+            dest32[3] = pairs[byte & 3];
+          }
+        break;
+
+      case 2:
+
+        /* Sixteen pairs; each byte becomes two words */
+
+        for (i = 0; i < 16; i++)
+          {
+            pairs[i] = BLIT_PAIR16(palette[i >> 2], palette[i & 3]);
+          }
+
+        for (i = 0; i < nbytes; i++, dest32 += 2)
+          {
+            byte      = src[i];
+            dest32[0] = pairs[byte >> 4];
+            dest32[1] = pairs[byte & 15];
+          }
+        break;
+
+      default:
+
+        /* Each byte holds exactly one pair */
+
+        for (i = 0; i < nbytes; i++)
+          {
+            byte      = src[i];
+            *dest32++ = BLIT_PAIR16(palette[byte >> 4], palette[byte & 15]);
+          }
+        break;
+    }
+
+  blit_slow16((FAR uint16_t *)dest32, &src[nbytes], bpp, npixels % ppb,
+              palette);
+}
+
+/****************************************************************************
+ * Name: blit_expand32
+ *
+ * Description:
+ *   Expand 1, 2 or 4 bit-per-pixel indices to RGB888 words.
+ *
+ ****************************************************************************/
+
+void blit_expand32(FAR uint32_t *dest, FAR const uint8_t *src,
+                   unsigned int bpp, unsigned int npixels,
+                   FAR const uint32_t *palette)
+{
+  unsigned int mask = (1 << bpp) - 1;
+  unsigned int shift;
+  uint8_t byte;
+
+  DEBUGASSERT(bpp == 1 || bpp == 2 || bpp == 4);
+
+  /* Whole source bytes */
+
+  for (; npixels >= 8 / bpp; npixels -= 8 / bpp)
+    {
+      byte = *src++;
+      for (shift = 8; shift > 0; )
+        {
+          shift  -= bpp;
+          *dest++ = palette[(byte >> shift) & mask];
+        }
+    }
+
+  /* A final partial byte */
+
+  if (npixels > 0)
+    {
+      byte = *src;
+      for (shift = 8; npixels > 0; npixels--)
+        {
+          shift  -= bpp;
+          *dest++ = palette[(byte >> shift) & mask];
+        }
+    }
+}
@@ -0,0 +1,161 @@
+/****************************************************************************
+ * apps/graphics/blit/blit_fill.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "blit_internal.h"
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: blit_fillwords
+ *
+ * Description:
+ *   Store nwords copies of a 32-bit value, four per loop iteration.
+ *
+ ****************************************************************************/
+
+static void blit_fillwords(FAR uint32_t *dest, unsigned int nwords,
+                           uint32_t value)
+{
+  for (; nwords >= 4; nwords -= 4, dest += 4)
+    {
+      dest[0] = value;
+      dest[1] = value;
+      dest[2] = value;
+      dest[3] = value;
+    }
+
+  while (nwords-- > 0)
+    {
+      *dest++ = value;
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: blit_fill8
+ *
+ * Description:
+ *   Fill a rectangle of 8-bit pixels.  memset() is already word-wide.
+ *
+ ****************************************************************************/
+
+void blit_fill8(FAR void *dest, size_t stride, unsigned int width,
+                unsigned int height, uint8_t color)
+{
+  FAR uint8_t *row = (FAR uint8_t *)dest;
+
+  if (stride == width)
+    {
+      memset(row, color, (size_t)width * height);
+      return;
+    }
+
+  for (; height > 0; height--, row += stride)
+    {
+      memset(row, color, width);
+    }
+}
+
+/****************************************************************************
+ * Name: blit_fill16
+ *
+ * Description:
+ *   Fill a rectangle of 16-bit pixels, two pixels per word store.
+ *
+ ****************************************************************************/
+
+void blit_fill16(FAR void *dest, size_t stride, unsigned int width,
+                 unsigned int height, uint16_t color)
+{
+  FAR uint8_t *row = (FAR uint8_t *)dest;
+  FAR uint16_t *pixel;
+  uint32_t color32 = BLIT_PAIR16(color, color);
+  unsigned int npixels;
+
+  for (; height > 0; height--, row += stride)
+    {
+      pixel   = (FAR uint16_t *)row;
+      npixels = width;
+
+      /* Store one pixel to reach a word boundary */
+
+      if (npixels > 0 && !BLIT_ALIGNED(pixel))
+        {
+          *pixel++ = color;
+          npixels--;
+        }
+
+      blit_fillwords((FAR uint32_t *)pixel, npixels >> 1, color32);
+
+      if ((npixels & 1) != 0)
+        {
+          pixel[npixels - 1] = color;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: blit_fill32
+ *
+ * Description:
+ *   Fill a rectangle of 32-bit pixels.
+ *
+ ****************************************************************************/
+
+void blit_fill32(FAR void *dest, size_t stride, unsigned int width,
+                 unsigned int height, uint32_t color)
+{
+  FAR uint8_t *row = (FAR uint8_t *)dest;
+
+  for (; height > 0; height--, row += stride)
+    {
+      blit_fillwords((FAR uint32_t *)row, width, color);
+    }
+}
@@ -0,0 +1,105 @@
+/****************************************************************************
+ * apps/graphics/blit/blit_internal.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_GRAPHICS_BLIT_BLIT_INTERNAL_H
+#define __APPS_GRAPHICS_BLIT_BLIT_INTERNAL_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+
+#include "graphics/blit.h"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/* Word access **************************************************************/
+/* True if the address is aligned to a 32-bit word */
+
+#define BLIT_ALIGNED(p)  (((uintptr_t)(p) & 3) == 0)
+
+/* Pack two 16-bit pixels into one 32-bit word so that p0 lands at the lower
+ * address when the word is stored.
+ */
+
+#ifdef CONFIG_ENDIAN_BIG
+#  define BLIT_PAIR16(p0,p1) (((uint32_t)(p0) << 16) | (uint32_t)(p1))
+#else
+#  define BLIT_PAIR16(p0,p1) ((uint32_t)(p0) | ((uint32_t)(p1) << 16))
+#endif
+
+/* DSP extension ************************************************************/
+/* The ARMv7E-M DSP extension (Cortex-M4/M7) operates on the four bytes of a
+ * word in parallel.  The compiler defines __ARM_FEATURE_SIMD32 when those
+ * instructions are available for the selected CPU.
+ */
+
+#if defined(__ARM_FEATURE_SIMD32) && defined(__GNUC__)
+#  define HAVE_BLIT_SIMD32 1
+#endif
+
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+#ifdef HAVE_BLIT_SIMD32
+/* Per byte (a - b) / 2, rounded down */
+
+static inline uint32_t blit_uhsub8(uint32_t a, uint32_t b)
+{
+  uint32_t result;
+
+  __asm__ ("uhsub8 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+  return result;
+}
+
+/* Per byte (a - b) modulo 256 */
+
+static inline uint32_t blit_usub8(uint32_t a, uint32_t b)
+{
+  uint32_t result;
+
+  __asm__ ("usub8 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b) : "cc");
+  return result;
+}
+#endif
+
+#endif /* __APPS_GRAPHICS_BLIT_BLIT_INTERNAL_H */
@@ -0,0 +1,243 @@
+/****************************************************************************
+ * apps/graphics/blit/blit_rle.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+#include "blit_internal.h"
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: blit_rlerow
+ *
+ * Description:
+ *   Return the encoded data of one row or NULL if there is no such row.
+ *
+ ****************************************************************************/
+
+static FAR const uint8_t *
+blit_rlerow(FAR const struct blit_rleimage_s *image, unsigned int row)
+{
+  if (row >= image->height)
+    {
+      return NULL;
+    }
+
+  return &image->data[image->rows[row]];
+}
+
+/****************************************************************************
+ * Name: blit_rlepacket
+ *
+ * Description:
+ *   Parse the header of the next packet.  Returns the number of pixels that
+ *   it describes, zero for a no-op packet, or -EINVAL if the packet would
+ *   extend beyond the remaining width.  *literal is set true if the codes
+ *   follow the header in the data.
+ *
+ ****************************************************************************/
+
+static int blit_rlepacket(FAR const uint8_t **src, unsigned int remaining,
+                          FAR bool *literal)
+{
+  uint8_t hdr = *(*src)++;
+  unsigned int npixels;
+
+  if (hdr < 128)
+    {
+      npixels  = hdr + 1;
+      *literal = true;
+    }
+  else
+    {
+      npixels  = (hdr == 128) ? 0 : 257 - hdr;
+      *literal = false;
+    }
+
+  return npixels > remaining ? -EINVAL : (int)npixels;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: blit_rledecode
+ *
+ * Description:
+ *   Decode one row to 8-bit pixel codes.
+ *
+ ****************************************************************************/
+
+int blit_rledecode(FAR const struct blit_rleimage_s *image, unsigned int row,
+                   FAR uint8_t *dest)
+{
+  FAR const uint8_t *src;
+  unsigned int x;
+  bool literal;
+  int n;
+
+  src = blit_rlerow(image, row);
+  if (src == NULL)
+    {
+      return -EINVAL;
+    }
+
+  for (x = 0; x < image->width; x += n)
+    {
+      n = blit_rlepacket(&src, image->width - x, &literal);
+      if (n < 0)
+        {
+          return n;
+        }
+      else if (literal)
+        {
+          memcpy(&dest[x], src, n);
+          src += n;
+        }
+      else if (n > 0)
+        {
+          memset(&dest[x], *src++, n);
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: blit_rleexpand16
+ *
+ * Description:
+ *   Decode one row to RGB565 pixels.
+ *
+ ****************************************************************************/
+
+int blit_rleexpand16(FAR const struct blit_rleimage_s *image,
+                     unsigned int row, FAR uint16_t *dest,
+                     FAR const uint16_t *lut)
+{
+  FAR const uint8_t *src;
+  unsigned int x;
+  bool literal;
+  int n;
+  int i;
+
+  src = blit_rlerow(image, row);
+  if (src == NULL)
+    {
+      return -EINVAL;
+    }
+
+  for (x = 0; x < image->width; x += n)
+    {
+      n = blit_rlepacket(&src, image->width - x, &literal);
+      if (n < 0)
+        {
+          return n;
+        }
+      else if (literal)
+        {
+          for (i = 0; i < n; i++)
+            {
+              dest[x + i] = lut[*src++];
+            }
+        }
+      else if (n > 0)
+        {
+          blit_fill16(&dest[x], 0, n, 1, lut[*src++]);
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: blit_rleexpand32
+ *
+ * Description:
+ *   Decode one row to RGB888 pixels.
+ *
+ ****************************************************************************/
+
+int blit_rleexpand32(FAR const struct blit_rleimage_s *image,
+                     unsigned int row, FAR uint32_t *dest,
+                     FAR const uint32_t *lut)
+{
+  FAR const uint8_t *src;
+  unsigned int x;
+  bool literal;
+  int n;
+  int i;
+
+  src = blit_rlerow(image, row);
+  if (src == NULL)
+    {
+      return -EINVAL;
+    }
+
+  for (x = 0; x < image->width; x += n)
+    {
+      n = blit_rlepacket(&src, image->width - x, &literal);
+      if (n < 0)
+        {
+          return n;
+        }
+      else if (literal)
+        {
+          for (i = 0; i < n; i++)
+            {
+              dest[x + i] = lut[*src++];
+            }
+        }
+      else if (n > 0)
+        {
+          blit_fill32(&dest[x], 0, n, 1, lut[*src++]);
+        }
+    }
+
+  return OK;
+}
@@ -0,0 +1,407 @@
+/****************************************************************************
+ * apps/graphics/frameprof/frameprof.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+#ifdef CONFIG_GRAPHICS_FRAMEPROF_SYSLOG
+#  include <syslog.h>
+#endif
+
+#include "frameprof_internal.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define FRAMEPROF_CLOCK CLOCK_MONOTONIC
+#else
+#  define FRAMEPROF_CLOCK CLOCK_REALTIME
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: frameprof_elapsed
+ *
+ * Description:
+ *   Return the microseconds from then to now, saturated to 32 bits.
+ *
+ ****************************************************************************/
+
+static uint32_t frameprof_elapsed(FAR const struct timespec *now,
+                                  FAR const struct timespec *then)
+{
+  int64_t usec;
+
+  usec = (int64_t)(now->tv_sec - then->tv_sec) * 1000000 +
+         (now->tv_nsec - then->tv_nsec) / 1000;
+
+  if (usec < 0)
+    {
+      return 0;
+    }
+
+  return usec > UINT32_MAX ? UINT32_MAX : (uint32_t)usec;
+}
+
+/****************************************************************************
+ * Name: frameprof_count
+ *
+ * Description:
+ *   Add one frame time to a histogram.
+ *
+ ****************************************************************************/
+
+static void frameprof_count(FAR uint16_t *hist, uint32_t usec)
+{
+  uint32_t msec = usec / 1000;
+  int bucket = 0;
+
+  while (msec != 0 && bucket < FRAMEPROF_NBUCKETS - 1)
+    {
+      msec >>= 1;
+      bucket++;
+    }
+
+  if (hist[bucket] < UINT16_MAX)
+    {
+      hist[bucket]++;
+    }
+}
+
+/****************************************************************************
+ * Name: frameprof_append
+ *
+ * Description:
+ *   Append " name avg/peak" to the summary line.
+ *
+ ****************************************************************************/
+
+static int frameprof_append(FAR char *buf, size_t len, int offset,
+                            FAR const char *name, uint32_t avg,
+                            uint32_t peak)
+{
+  offset += snprintf(&buf[offset], (size_t)offset < len ? len - offset : 0,
+                     " %s ", name);
+  offset += frameprof_msec(&buf[offset],
+                           (size_t)offset < len ? len - offset : 0, avg);
+  offset += snprintf(&buf[offset], (size_t)offset < len ? len - offset : 0,
+                     "/");
+  offset += frameprof_msec(&buf[offset],
+                           (size_t)offset < len ? len - offset : 0, peak);
+  return offset;
+}
+
+/****************************************************************************
+ * Name: frameprof_histline
+ *
+ * Description:
+ *   Print one line of the histogram dump.
+ *
+ ****************************************************************************/
+
+static void frameprof_histline(FAR FILE *stream, FAR const char *name,
+                               FAR const uint16_t *hist)
+{
+  int i;
+
+  fprintf(stream, "%-12.12s", name);
+  for (i = 0; i < FRAMEPROF_NBUCKETS; i++)
+    {
+      fprintf(stream, " %6u", hist[i]);
+    }
+
+  fputc('\n', stream);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: frameprof_msec
+ *
+ * Description:
+ *   Format microseconds as milliseconds with one decimal.
+ *
+ ****************************************************************************/
+
+int frameprof_msec(FAR char *buf, size_t len, uint32_t usec)
+{
+  uint32_t tenths = (usec + 50) / 100;
+
+  return snprintf(buf, len, "%lu.%lu", (unsigned long)(tenths / 10),
+                  (unsigned long)(tenths % 10));
+}
+
+/****************************************************************************
+ * Name: frameprof_initialize
+ *
+ * Description:
+ *   Clear all statistics and remove all phases.
+ *
+ ****************************************************************************/
+
+void frameprof_initialize(FAR struct frameprof_s *prof)
+{
+  memset(prof, 0, sizeof(struct frameprof_s));
+}
+
+/****************************************************************************
+ * Name: frameprof_phase
+ *
+ * Description:
+ *   Register a named phase.
+ *
+ ****************************************************************************/
+
+int frameprof_phase(FAR struct frameprof_s *prof, FAR const char *name)
+{
+  if (prof->nphases >= CONFIG_GRAPHICS_FRAMEPROF_MAXPHASES)
+    {
+      return -ENOSPC;
+    }
+
+  prof->phase[prof->nphases].name = name;
+  return prof->nphases++;
+}
+
+/****************************************************************************
+ * Name: frameprof_begin
+ *
+ * Description:
+ *   Mark the beginning of a frame.
+ *
+ ****************************************************************************/
+
+void frameprof_begin(FAR struct frameprof_s *prof)
+{
+  (void)clock_gettime(FRAMEPROF_CLOCK, &prof->framestart);
+
+  if (prof->nframes == 0)
+    {
+      prof->windowstart = prof->framestart;
+    }
+}
+
+/****************************************************************************
+ * Name: frameprof_end
+ *
+ * Description:
+ *   Mark the end of a frame and update the statistics.
+ *
+ ****************************************************************************/
+
+bool frameprof_end(FAR struct frameprof_s *prof)
+{
+  FAR struct frameprof_phase_s *phase;
+  struct timespec now;
+  uint32_t elapsed;
+  int i;
+#ifdef CONFIG_GRAPHICS_FRAMEPROF_SYSLOG
+  char line[128];
+#endif
+
+  (void)clock_gettime(FRAMEPROF_CLOCK, &now);
+
+  /* Account for the frame and for the time spent in each phase */
+
+  elapsed = frameprof_elapsed(&now, &prof->framestart);
+  frameprof_count(prof->hist, elapsed);
+  prof->sum += elapsed;
+  if (elapsed > prof->max)
+    {
+      prof->max = elapsed;
+    }
+
+  for (i = 0; i < prof->nphases; i++)
+    {
+      phase = &prof->phase[i];
+      frameprof_count(phase->hist, phase->frame);
+      phase->sum += phase->frame;
+      if (phase->frame > phase->max)
+        {
+          phase->max = phase->frame;
+        }
+
+      phase->frame = 0;
+    }
+
+  if (++prof->nframes < CONFIG_GRAPHICS_FRAMEPROF_WINDOW)
+    {
+      return false;
+    }
+
+  /* The window is complete.  The frame rate includes any time spent
+   * between frames.
+   */
+
+  elapsed = frameprof_elapsed(&now, &prof->windowstart);
+  prof->fps10 = elapsed == 0 ? 0 :
+                (uint32_t)(((uint64_t)prof->nframes * 10000000 +
+                            elapsed / 2) / elapsed);
+
+  prof->avg  = prof->sum / prof->nframes;
+  prof->peak = prof->max;
+  prof->sum  = 0;
+  prof->max  = 0;
+
+  for (i = 0; i < prof->nphases; i++)
+    {
+      phase       = &prof->phase[i];
+      phase->avg  = phase->sum / prof->nframes;
+      phase->peak = phase->max;
+      phase->sum  = 0;
+      phase->max  = 0;
+    }
+
+  prof->nframes = 0;
+
+#ifdef CONFIG_GRAPHICS_FRAMEPROF_SYSLOG
+  (void)frameprof_summary(prof, line, sizeof(line));
+  syslog(LOG_INFO, "%s\n", line);
+#endif
+
+  return true;
+}
+
+/****************************************************************************
+ * Name: frameprof_start
+ *
+ * Description:
+ *   Mark the start of an interval spent in a phase.
+ *
+ ****************************************************************************/
+
+void frameprof_start(FAR struct frameprof_s *prof, int phase)
+{
+  if (phase >= 0 && phase < prof->nphases)
+    {
+      (void)clock_gettime(FRAMEPROF_CLOCK, &prof->phase[phase].start);
+    }
+}
+
+/****************************************************************************
+ * Name: frameprof_stop
+ *
+ * Description:
+ *   Mark the end of an interval spent in a phase.
+ *
+ ****************************************************************************/
+
+void frameprof_stop(FAR struct frameprof_s *prof, int phase)
+{
+  FAR struct frameprof_phase_s *pphase;
+  struct timespec now;
+
+  if (phase >= 0 && phase < prof->nphases)
+    {
+      (void)clock_gettime(FRAMEPROF_CLOCK, &now);
+
+      pphase         = &prof->phase[phase];
+      pphase->frame += frameprof_elapsed(&now, &pphase->start);
+    }
+}
+
+/****************************************************************************
+ * Name: frameprof_summary
+ *
+ * Description:
+ *   Format the statistics of the last window as one line of text.
+ *
+ ****************************************************************************/
+
+int frameprof_summary(FAR const struct frameprof_s *prof, FAR char *buf,
+                      size_t len)
+{
+  int offset;
+  int i;
+
+  offset = snprintf(buf, len, "fps %lu.%lu",
+                    (unsigned long)(prof->fps10 / 10),
+                    (unsigned long)(prof->fps10 % 10));
+  offset = frameprof_append(buf, len, offset, "frame", prof->avg,
+                            prof->peak);
+
+  for (i = 0; i < prof->nphases; i++)
+    {
+      offset = frameprof_append(buf, len, offset, prof->phase[i].name,
+                                prof->phase[i].avg, prof->phase[i].peak);
+    }
+
+  return offset;
+}
+
+/****************************************************************************
+ * Name: frameprof_dump
+ *
+ * Description:
+ *   Print the frame time and phase histograms.
+ *
+ ****************************************************************************/
+
+void frameprof_dump(FAR const struct frameprof_s *prof, FAR FILE *stream)
+{
+  int i;
+
+  fprintf(stream, "%-12s %6s", "msec", "<1");
+  for (i = 1; i < FRAMEPROF_NBUCKETS - 1; i++)
+    {
+      fprintf(stream, " %6u", 1 << (i - 1));
+    }
+
+  fprintf(stream, " %5u+\n", 1 << (FRAMEPROF_NBUCKETS - 2));
+
+  frameprof_histline(stream, "frame", prof->hist);
+  for (i = 0; i < prof->nphases; i++)
+    {
+      frameprof_histline(stream, prof->phase[i].name, prof->phase[i].hist);
+    }
+}
@@ -0,0 +1,307 @@
+/****************************************************************************
+ * apps/graphics/frameprof/frameprof_overlay.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <ctype.h>
+#include <errno.h>
+
+#include "graphics/blit.h"
+#include "frameprof_internal.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The font covers ' ' through 'Z'.  Lower case is drawn as upper case. */
+
+#define FONT_FIRST  ' '
+#define FONT_LAST   'Z'
+
+/* Width of the phase name column */
+
+#define NAME_CHARS  6
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Each glyph is 5 rows of 3 pixels.  Bit 14 is the left pixel of the top
+ * row and bit 0 is the right pixel of the bottom row.
+ */
+
+static const uint16_t g_font[FONT_LAST - FONT_FIRST + 1] =
+{
+  0x0000, 0x0000, 0x0000, 0x0000,   /* ' ' '!' '"' '#' */
+  0x0000, 0x52a5, 0x0000, 0x0000,   /* '$' '%' '&' '\'' */
+  0x0000, 0x0000, 0x0000, 0x05d0,   /* '(' ')' '*' '+' */
+  0x0000, 0x01c0, 0x0002, 0x12a4,   /* ',' '-' '.' '/' */
+  0x7b6f, 0x2c97, 0x73e7, 0x72cf,   /* '0' '1' '2' '3' */
+  0x5bc9, 0x79cf, 0x79ef, 0x7292,   /* '4' '5' '6' '7' */
+  0x7bef, 0x7bcf, 0x0410, 0x0000,   /* '8' '9' ':' ';' */
+  0x1511, 0x0e38, 0x4454, 0x0000,   /* '<' '=' '>' '?' */
+  0x0000, 0x2bed, 0x6bae, 0x3923,   /* '@' 'A' 'B' 'C' */
+  0x6b6e, 0x79a7, 0x79a4, 0x396b,   /* 'D' 'E' 'F' 'G' */
+  0x5bed, 0x7497, 0x126a, 0x5bad,   /* 'H' 'I' 'J' 'K' */
+  0x4927, 0x5fed, 0x6b6d, 0x2b6a,   /* 'L' 'M' 'N' 'O' */
+  0x6ba4, 0x2b73, 0x6bad, 0x388e,   /* 'P' 'Q' 'R' 'S' */
+  0x7492, 0x5b6f, 0x5b6a, 0x5bfd,   /* 'T' 'U' 'V' 'W' */
+  0x5aad, 0x5a92, 0x72a7,           /* 'X' 'Y' 'Z' */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: frameprof_fill
+ *
+ * Description:
+ *   Fill a rectangle of pixels of the selected depth.
+ *
+ ****************************************************************************/
+
+static void frameprof_fill(FAR uint8_t *dest, size_t stride,
+                           unsigned int bpp, unsigned int width,
+                           unsigned int height, uint32_t color)
+{
+  switch (bpp)
+    {
+      case 8:
+        blit_fill8(dest, stride, width, height, (uint8_t)color);
+        break;
+
+      case 16:
+        blit_fill16(dest, stride, width, height, (uint16_t)color);
+        break;
+
+      default:
+        blit_fill32(dest, stride, width, height, color);
+        break;
+    }
+}
+
+/****************************************************************************
+ * Name: frameprof_line
+ *
+ * Description:
+ *   Format one overlay line:  a name followed by the average and the peak
+ *   milliseconds.
+ *
+ ****************************************************************************/
+
+static void frameprof_line(FAR char *buf, size_t len, FAR const char *name,
+                           uint32_t avg, uint32_t peak)
+{
+  int offset;
+
+  offset  = snprintf(buf, len, "%-*.*s", NAME_CHARS, NAME_CHARS, name);
+  offset += frameprof_msec(&buf[offset], len - offset, avg);
+  if ((size_t)offset < len)
+    {
+      offset += snprintf(&buf[offset], len - offset, "/");
+    }
+
+  if ((size_t)offset < len)
+    {
+      (void)frameprof_msec(&buf[offset], len - offset, peak);
+    }
+}
+
+/****************************************************************************
+ * Name: frameprof_text
+ *
+ * Description:
+ *   Draw the foreground pixels of one line of text, clipped to width x
+ *   height.
+ *
+ ****************************************************************************/
+
+static void frameprof_text(FAR uint8_t *dest, size_t stride,
+                           unsigned int bpp, unsigned int width,
+                           unsigned int height, unsigned int scale,
+                           FAR const char *text, uint32_t fgcolor)
+{
+  unsigned int bytes = bpp >> 3;
+  unsigned int x;
+  unsigned int y;
+  unsigned int px;
+  unsigned int py;
+  uint16_t glyph;
+  int ch;
+
+  for (x = 0; *text != '\0' && x < width;
+       text++, x += FRAMEPROF_GLYPH_WIDTH * scale)
+    {
+      ch = toupper((unsigned char)*text);
+      if (ch < FONT_FIRST || ch > FONT_LAST)
+        {
+          continue;
+        }
+
+      glyph = g_font[ch - FONT_FIRST];
+
+      for (py = 0; py < 5; py++)
+        {
+          y = py * scale;
+          if (y >= height)
+            {
+              break;
+            }
+
+          for (px = 0; px < 3; px++)
+            {
+              if ((glyph & (1 << (14 - 3 * py - px))) != 0 &&
+                  x + px * scale < width)
+                {
+                  unsigned int w = width - (x + px * scale);
+                  unsigned int h = height - y;
+
+                  frameprof_fill(dest + y * stride +
+                                 (x + px * scale) * bytes,
+                                 stride, bpp, w < scale ? w : scale,
+                                 h < scale ? h : scale, fgcolor);
+                }
+            }
+        }
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: frameprof_overlay_size
+ *
+ * Description:
+ *   Return the size of the overlay drawn by frameprof_overlay().
+ *
+ ****************************************************************************/
+
+void frameprof_overlay_size(FAR const struct frameprof_s *prof,
+                            unsigned int scale, FAR unsigned int *width,
+                            FAR unsigned int *height)
+{
+  *width  = FRAMEPROF_OVERLAY_CHARS * FRAMEPROF_GLYPH_WIDTH * scale;
+  *height = (prof->nphases + 2) * FRAMEPROF_GLYPH_HEIGHT * scale;
+}
+
+/****************************************************************************
+ * Name: frameprof_overlay
+ *
+ * Description:
+ *   Draw the frame rate and the phase breakdown of the last window.
+ *
+ ****************************************************************************/
+
+int frameprof_overlay(FAR const struct frameprof_s *prof, FAR void *dest,
+                      size_t stride, unsigned int bpp, unsigned int width,
+                      unsigned int height, unsigned int scale,
+                      uint32_t fgcolor, uint32_t bgcolor)
+{
+  FAR uint8_t *row = (FAR uint8_t *)dest;
+  char text[FRAMEPROF_OVERLAY_CHARS + 1];
+  unsigned int ovwidth;
+  unsigned int ovheight;
+  unsigned int lineheight;
+  int line;
+
+  if ((bpp != 8 && bpp != 16 && bpp != 32) || scale < 1)
+    {
+      return -EINVAL;
+    }
+
+  /* Clear the background of the visible part of the overlay */
+
+  frameprof_overlay_size(prof, scale, &ovwidth, &ovheight);
+  if (width > ovwidth)
+    {
+      width = ovwidth;
+    }
+
+  if (height > ovheight)
+    {
+      height = ovheight;
+    }
+
+  frameprof_fill(row, stride, bpp, width, height, bgcolor);
+
+  /* Then draw one line for the frame rate, one for the frame time and one
+   * for each phase.
+   */
+
+  lineheight = FRAMEPROF_GLYPH_HEIGHT * scale;
+  for (line = 0; line < prof->nphases + 2 && height > 0; line++)
+    {
+      if (line == 0)
+        {
+          snprintf(text, sizeof(text), "%-*s%lu.%lu", NAME_CHARS, "fps",
+                   (unsigned long)(prof->fps10 / 10),
+                   (unsigned long)(prof->fps10 % 10));
+        }
+      else if (line == 1)
+        {
+          frameprof_line(text, sizeof(text), "frame", prof->avg,
+                         prof->peak);
+        }
+      else
+        {
+          frameprof_line(text, sizeof(text), prof->phase[line - 2].name,
+                         prof->phase[line - 2].avg,
+                         prof->phase[line - 2].peak);
+        }
+
+      frameprof_text(row, stride, bpp, width, height, scale, text,
+                     fgcolor);
+
+      if (height <= lineheight)
+        {
+          break;
+        }
+
+      row    += lineheight * stride;
+      height -= lineheight;
+    }
+
+  return OK;
+}
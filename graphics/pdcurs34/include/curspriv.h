@@ -155,6 +155,10 @@ void    PDC_scr_free(void);
 int     PDC_scr_open(int, char **);
 void    PDC_set_keyboard_binary(bool);
 void    PDC_transform_line(int, int, int, const chtype *);
+#ifdef CONFIG_PDCURSES_PERFMON
+void    PDC_frame_begin(void);
+void    PDC_frame_end(void);
+#endif
 const char *PDC_sysname(void);
 
 /* Internal cross-module functions */
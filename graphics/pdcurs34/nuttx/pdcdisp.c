@@ -38,6 +38,7 @@
  ****************************************************************************/
 
 #include <sys/ioctl.h>
+#include <string.h>
 #include <errno.h>
 
 #include "pdcnuttx.h"
@@ -226,51 +227,30 @@ static inline void PDC_set_bg(FAR struct pdc_fbstate_s *fbstate,
                               FAR uint8_t *fbuffer, short bg)
 {
   uint8_t color8;
-  int row;
-  int col;
 
   /* Get a byte that packs multiple pixels into one byte */
 
   color8 = PDC_color(fbstate, bg);
 
-  /* Now copy the color into the entire glyph region */
-
-  for (row = 0; row < fbstate->fheight; row++, fbuffer += fbstate->fstride)
-    {
-      FAR uint8_t *fbdest = fbuffer;
-
-      /* Note that there is no masking on the "right" side, so this will
-       * set color in the unused bits in the final byte of the glyph row.
-       * This should be harmless.
-       */
+  /* Now copy the color into the entire glyph region.  Note that there is no
+   * masking on the "right" side, so this will set color in the unused bits
+   * in the final byte of each glyph row.  This should be harmless.
+   */
 
-      for (col = 0; col < fbstate->fwidth; col += PDCURSES_PPB)
-        {
-          *fbdest++ = color8;
-        }
-    }
+  blit_fill8(fbuffer, fbstate->fstride,
+             (fbstate->fwidth + PDCURSES_PPB - 1) / PDCURSES_PPB,
+             fbstate->fheight, color8);
 }
 #else
 static inline void PDC_set_bg(FAR struct pdc_fbstate_s *fbstate,
                               FAR uint8_t *fbstart, short bg)
 {
   pdc_color_t bgcolor = PDC_color(fbstate, bg);
-  int row;
-  int col;
 
   /* Set the glyph to the background color. */
 
-  for (row = 0; row < fbstate->fheight; row++, fbstart += fbstate->stride)
-    {
-      FAR pdc_color_t *fbdest;
-
-      for (col = 0, fbdest = (FAR pdc_color_t *)fbstart;
-           col < fbstate->fwidth;
-           col++)
-        {
-          *fbdest++ = bgcolor;
-        }
-    }
+  PDC_fill(fbstart, fbstate->stride, fbstate->fwidth, fbstate->fheight,
+           bgcolor);
 }
 #endif
 
@@ -306,8 +286,10 @@ static inline void PDC_render_glyph(FAR struct pdc_fbstate_s *fbstate,
    * case, only the lower quarter of the glyph should be reversed.
    */
 
+  PDC_perf_start(fbstate, PDC_PHASE_GLYPH);
   ret = RENDERER((FAR pdc_color_t *)fbstart, fbstate->fheight,
                  fbstate->fwidth, stride, fbm, fgcolor);
+  PDC_perf_stop(fbstate, PDC_PHASE_GLYPH);
   if (ret < 0)
     {
       /* Actually, the RENDERER never returns a failure */
@@ -521,8 +503,10 @@ static void PDC_update(FAR struct pdc_fbstate_s *fbstate, int row, int col,
 
       /* Then perfom the update via IOCTL */
 
+      PDC_perf_start(fbstate, PDC_PHASE_PUSH);
       ret = ioctl(fbstate->fbfd, FBIO_UPDATE,
                   (unsigned long)((uintptr_t)&rect));
+      PDC_perf_stop(fbstate, PDC_PHASE_PUSH);
       if (ret < 0)
         {
           PDC_LOG(("ERROR:  ioctl(FBIO_UPDATE) failed: %d\n", errno));
@@ -533,6 +517,193 @@ static void PDC_update(FAR struct pdc_fbstate_s *fbstate, int row, int col,
 #  define PDC_update(f,r,c,n)
 #endif
 
+/****************************************************************************
+ * Name: PDC_get_glyph
+ *
+ * Description:
+ *   Return the image of a glyph drawn with the given device colors from the
+ *   glyph cache, rendering it into the cache first if necessary.  The image
+ *   holds fheight rows of fwidth pixels.
+ *
+ ****************************************************************************/
+
+#if CONFIG_PDCURSES_GLYPHCACHE > 0
+static FAR const pdc_color_t *
+  PDC_get_glyph(FAR struct pdc_fbstate_s *fbstate, chtype ch,
+                pdc_color_t fgcolor, pdc_color_t bgcolor)
+{
+  FAR const struct nx_fontbitmap_s *fbm;
+  FAR struct pdc_glyph_s *glyph;
+  FAR pdc_color_t *image;
+  unsigned int npixels;
+  unsigned int index;
+  chtype code;
+  int ret;
+
+#ifdef HAVE_BOLD_FONT
+  code = ch & (A_CHARTEXT | A_BOLD);
+#else
+  code = ch & A_CHARTEXT;
+#endif
+
+  /* The cache is direct mapped */
+
+  index   = ((uint32_t)code * 31 + (uint32_t)fgcolor * 7 + bgcolor) %
+            CONFIG_PDCURSES_GLYPHCACHE;
+  glyph   = &fbstate->glyph[index];
+  npixels = fbstate->fwidth * fbstate->fheight;
+  image   = &fbstate->gbuffer[index * npixels];
+
+  if (glyph->inuse && glyph->ch == code && glyph->fg == fgcolor &&
+      glyph->bg == bgcolor)
+    {
+      return image;
+    }
+
+  /* Initialize the glyph to the background color */
+
+  PDC_fill(image, 0, npixels, 1, bgcolor);
+
+  /* Does the code map to a font? */
+
+#ifdef HAVE_BOLD_FONT
+  fbm = nxf_getbitmap((ch & A_BOLD) != 0 ? fbstate->hbold : fbstate->hfont,
+                      ch & A_CHARTEXT);
+#else
+  fbm = nxf_getbitmap(fbstate->hfont, ch & A_CHARTEXT);
+#endif
+
+  if (fbm != NULL)
+    {
+      /* Yes.. render the glyph into the cache */
+
+      PDC_perf_start(fbstate, PDC_PHASE_GLYPH);
+      ret = RENDERER(image, fbstate->fheight, fbstate->fwidth,
+                     fbstate->fwidth * sizeof(pdc_color_t), fbm, fgcolor);
+      PDC_perf_stop(fbstate, PDC_PHASE_GLYPH);
+      if (ret < 0)
+        {
+          PDC_LOG(("ERROR:  RENDERER failed: %d\n", ret));
+        }
+    }
+
+  glyph->ch    = code;
+  glyph->fg    = fgcolor;
+  glyph->bg    = bgcolor;
+  glyph->inuse = true;
+  return image;
+}
+#endif
+
+/****************************************************************************
+ * Name: PDC_putspan
+ *
+ * Description:
+ *   Put a run of characters that all have the same attributes at the
+ *   selected drawing position.  The colors are resolved once for the whole
+ *   run.  Each glyph is copied from the glyph cache and runs of blanks are
+ *   simply filled with the background color.
+ *
+ ****************************************************************************/
+
+#if CONFIG_PDCURSES_GLYPHCACHE > 0
+static void PDC_putspan(FAR struct pdc_fbstate_s *fbstate, int row, int col,
+                        FAR const chtype *srcp, int len)
+{
+  FAR const pdc_color_t *image;
+  FAR uint8_t *fbstart;
+  pdc_color_t fgcolor;
+  pdc_color_t bgcolor;
+  chtype ch;
+  short fg;
+  short bg;
+  int nblank;
+  int npixels;
+  int i;
+
+  /* Clip */
+
+  if (row < 0 || row >= SP->lines || col < 0 || len < 1 ||
+      col + len > SP->cols)
+    {
+      PDC_LOG(("ERROR: Position out of range: row=%d col=%d len=%d\n",
+               row, col, len));
+      return;
+    }
+
+  /* Get the forground and background colors of the run */
+
+  PDC_pair_content(PAIR_NUMBER(srcp[0]), &fg, &bg);
+
+  /* Handle the A_REVERSE attribute. */
+
+  if ((srcp[0] & A_REVERSE) != 0)
+    {
+      /* Swap the foreground and background colors if reversed */
+
+      short tmp = fg;
+      fg = bg;
+      bg = tmp;
+    }
+
+  fgcolor = PDC_color(fbstate, fg);
+  bgcolor = PDC_color(fbstate, bg);
+
+  /* Calculate the destination address in the framebuffer */
+
+  fbstart = (FAR uint8_t *)fbstate->fbmem +
+                           PDC_fbmem_y(fbstate, row) +
+                           PDC_fbmem_x(fbstate, col);
+
+  for (i = 0; i < len; )
+    {
+      ch = srcp[i];
+
+      /* Fill a run of blanks with the background color */
+
+      if ((ch & A_CHARTEXT) == ' ')
+        {
+          for (nblank = 1;
+               i + nblank < len && (srcp[i + nblank] & A_CHARTEXT) == ' ';
+               nblank++);
+
+          npixels = nblank * fbstate->fwidth;
+          PDC_fill(fbstart, fbstate->stride, npixels, fbstate->fheight,
+                   bgcolor);
+
+          fbstart += npixels * sizeof(pdc_color_t);
+          i       += nblank;
+          continue;
+        }
+
+#ifdef CONFIG_PDCURSES_CHTYPE_LONG
+      /* Translate characters 0-127 via acs_map[], if they're flagged with
+       * A_ALTCHARSET in the attribute portion of the chtype.
+       */
+
+      if (ch & A_ALTCHARSET && !(ch & 0xff80))
+        {
+          ch = (ch & (A_ATTRIBUTES ^ A_ALTCHARSET)) | acs_map[ch & 0x7f];
+        }
+#endif
+
+      /* Copy the glyph into the framebuffer */
+
+      image = PDC_get_glyph(fbstate, ch, fgcolor, bgcolor);
+      blit_copy(fbstart, fbstate->stride, image,
+                fbstate->fwidth * sizeof(pdc_color_t),
+                fbstate->fwidth * sizeof(pdc_color_t), fbstate->fheight);
+
+      /* REVISIT: A_UNDERLINE, A_LEFTLINE and A_RIGHTLINE are not yet
+       * handled here either.
+       */
+
+      fbstart += fbstate->fwidth * sizeof(pdc_color_t);
+      i++;
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: PDC_putc
  *
@@ -542,6 +713,13 @@ static void PDC_update(FAR struct pdc_fbstate_s *fbstate, int row, int col,
  *
  ****************************************************************************/
 
+#if CONFIG_PDCURSES_GLYPHCACHE > 0
+static inline void PDC_putc(FAR struct pdc_fbstate_s *fbstate, int row,
+                            int col, chtype ch)
+{
+  PDC_putspan(fbstate, row, col, &ch, 1);
+}
+#else
 static void PDC_putc(FAR struct pdc_fbstate_s *fbstate, int row, int col,
                      chtype ch)
 {
@@ -611,7 +789,7 @@ static void PDC_putc(FAR struct pdc_fbstate_s *fbstate, int row, int col,
   /* Does the code map to a font? */
 
 #ifdef HAVE_BOLD_FONT
-  fbm = nxf_getbitmap(bold ? fbstate->hfont : fbstate->hbold,
+  fbm = nxf_getbitmap(bold ? fbstate->hbold : fbstate->hfont,
                       ch & A_CHARTEXT);
 #else
   fbm = nxf_getbitmap(fbstate->hfont, ch & A_CHARTEXT);
@@ -647,6 +825,7 @@ static void PDC_putc(FAR struct pdc_fbstate_s *fbstate, int row, int col,
   PDC_copy_glyph(fbstate, dest, col);
 #endif
 }
+#endif /* CONFIG_PDCURSES_GLYPHCACHE > 0 */
 
 /****************************************************************************
  * Public Functions
@@ -712,7 +891,11 @@ void PDC_transform_line(int lineno, int x, int len, const chtype *srcp)
 {
   FAR struct pdc_fbscreen_s *fbscreen = (FAR struct pdc_fbscreen_s *)SP;
   FAR struct pdc_fbstate_s *fbstate;
+#if CONFIG_PDCURSES_GLYPHCACHE > 0
+  int n;
+#else
   int nextx;
+#endif
   int i;
 
   PDC_LOG(("PDC_transform_line() - called: lineno=%d x=%d len=%d\n",
@@ -721,6 +904,34 @@ void PDC_transform_line(int lineno, int x, int len, const chtype *srcp)
   DEBUGASSERT(fbscreen != NULL);
   fbstate = &fbscreen->fbstate;
 
+  PDC_perf_start(fbstate, PDC_PHASE_DRAW);
+
+#if CONFIG_PDCURSES_GLYPHCACHE > 0
+  if (x + len > SP->cols)
+    {
+      PDC_LOG(("ERROR:  Write past end of line\n"));
+      len = SP->cols - x;
+    }
+
+  /* Split the line into runs of characters with the same attributes and
+   * render each run as a span.
+   */
+
+  for (i = 0; i < len; i += n)
+    {
+      for (n = 1;
+           i + n < len && ((srcp[i + n] ^ srcp[i]) & A_ATTRIBUTES) == 0;
+           n++);
+
+      PDC_putspan(fbstate, lineno, x + i, &srcp[i], n);
+    }
+
+  /* Then update the whole line at once */
+
+  PDC_perf_stop(fbstate, PDC_PHASE_DRAW);
+  PDC_update(fbstate, lineno, x, len);
+#else
+
   /* Add each character to the framebuffer at the current position,
    * incrementing the horizontal position after each character.
    */
@@ -738,9 +949,83 @@ void PDC_transform_line(int lineno, int x, int len, const chtype *srcp)
       PDC_putc(fbstate, lineno, nextx, srcp[i]);
     }
 
+  PDC_perf_stop(fbstate, PDC_PHASE_DRAW);
   PDC_update(fbstate, lineno, x, nextx - x);
+#endif
 }
 
+/****************************************************************************
+ * Name: PDC_frame_begin and PDC_frame_end
+ *
+ * Description:
+ *   Mark the beginning and the end of a screen update by doupdate().  If
+ *   CONFIG_PDCURSES_PERFOVERLAY is selected, PDC_frame_end() also draws
+ *   the statistics of the last window of updates in the top right corner
+ *   of the display.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_PDCURSES_PERFMON
+void PDC_frame_begin(void)
+{
+  FAR struct pdc_fbscreen_s *fbscreen = (FAR struct pdc_fbscreen_s *)SP;
+
+  DEBUGASSERT(fbscreen != NULL);
+  frameprof_begin(&fbscreen->fbstate.perf);
+}
+
+void PDC_frame_end(void)
+{
+  FAR struct pdc_fbscreen_s *fbscreen = (FAR struct pdc_fbscreen_s *)SP;
+  FAR struct pdc_fbstate_s *fbstate;
+#ifdef CONFIG_PDCURSES_PERFOVERLAY
+  unsigned int width;
+  unsigned int height;
+#ifdef CONFIG_LCD_UPDATE
+  struct nxgl_rect_s rect;
+  int ret;
+#endif
+#endif
+
+  DEBUGASSERT(fbscreen != NULL);
+  fbstate = &fbscreen->fbstate;
+
+  (void)frameprof_end(&fbstate->perf);
+
+#ifdef CONFIG_PDCURSES_PERFOVERLAY
+  frameprof_overlay_size(&fbstate->perf, 1, &width, &height);
+  if (width > fbstate->xres)
+    {
+      width = fbstate->xres;
+    }
+
+  if (height > fbstate->yres)
+    {
+      height = fbstate->yres;
+    }
+
+  (void)frameprof_overlay(&fbstate->perf,
+                          (FAR uint8_t *)fbstate->fbmem +
+                          (fbstate->xres - width) * sizeof(pdc_color_t),
+                          fbstate->stride, PDCURSES_BPP, width, height, 1,
+                          PDC_PERF_FGCOLOR, PDC_PERF_BGCOLOR);
+
+#ifdef CONFIG_LCD_UPDATE
+  rect.pt1.x = fbstate->xres - width;
+  rect.pt1.y = 0;
+  rect.pt2.x = fbstate->xres - 1;
+  rect.pt2.y = height - 1;
+
+  ret = ioctl(fbstate->fbfd, FBIO_UPDATE, (unsigned long)((uintptr_t)&rect));
+  if (ret < 0)
+    {
+      PDC_LOG(("ERROR:  ioctl(FBIO_UPDATE) failed: %d\n", errno));
+    }
+#endif
+#endif
+}
+#endif
+
 /****************************************************************************
  * Name: PDC_clear_screen
  *
@@ -751,12 +1036,8 @@ void PDC_transform_line(int lineno, int x, int len, const chtype *srcp)
 
 void PDC_clear_screen(FAR struct pdc_fbstate_s *fbstate)
 {
-  FAR pdc_color_t *dest;
-  FAR pdc_color_t bgcolor;
-  FAR uint8_t *line;
+  pdc_color_t bgcolor;
   int width;
-  int row;
-  int col;
 
 #ifdef CONFIG_LCD_UPDATE
   struct nxgl_rect_s rect;
@@ -792,17 +1073,7 @@ void PDC_clear_screen(FAR struct pdc_fbstate_s *fbstate)
 
   /* Write the initial color into the entire framebuffer */
 
-  for (row = 0, line = (FAR uint8_t *)fbstate->fbmem;
-       row < fbstate->yres;
-       row++, line += fbstate->stride)
-    {
-       for (col = 0, dest = (FAR pdc_color_t *)line;
-            col < width;
-            col++)
-         {
-           *dest++ = bgcolor;
-         }
-    }
+  PDC_fill(fbstate->fbmem, fbstate->stride, width, fbstate->yres, bgcolor);
 
 #ifdef CONFIG_LCD_UPDATE
   /* Update the entire display */
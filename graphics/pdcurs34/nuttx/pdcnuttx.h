@@ -50,6 +50,10 @@
 #include <nuttx/video/fb.h>
 #include <nuttx/video/rgbcolors.h>
 
+#include "graphics/blit.h"
+#ifdef CONFIG_PDCURSES_PERFMON
+#  include "graphics/frameprof.h"
+#endif
 #include "curspriv.h"
 
 /****************************************************************************
@@ -186,11 +190,45 @@
 #  error "Unsupported bits-per-pixel"
 #endif
 
+/* Glyph cache */
+
+#ifndef CONFIG_PDCURSES_GLYPHCACHE
+#  define CONFIG_PDCURSES_GLYPHCACHE 0
+#endif
+
+#if PDCURSES_BPP < 8
+#  undef  CONFIG_PDCURSES_GLYPHCACHE
+#  define CONFIG_PDCURSES_GLYPHCACHE 0
+#endif
+
 /* Convert bits to bytes to hold an even number of pixels */
 
 #define PDCURSES_ALIGN_UP(n)   (((n) + PDCURSES_BPP_MASK) >> 3)
 #define PDCURSES_ALIGN_DOWN(n) (((n) & ~PDCURSES_BPP_MASK) >> 3)
 
+/* Performance monitoring */
+
+#ifdef CONFIG_PDCURSES_PERFMON
+#  define PDC_perf_start(f,p)  frameprof_start(&(f)->perf, (p))
+#  define PDC_perf_stop(f,p)   frameprof_stop(&(f)->perf, (p))
+#else
+#  define PDC_perf_start(f,p)
+#  define PDC_perf_stop(f,p)
+#endif
+
+/* The overlay is drawn in white on black */
+
+#ifdef CONFIG_PDCURSES_PERFOVERLAY
+#  if defined(CONFIG_PDCURSES_COLORFMT_RGB332)
+#    define PDC_PERF_FGCOLOR   RGBTO8(0xff, 0xff, 0xff)
+#  elif defined(CONFIG_PDCURSES_COLORFMT_RGB565)
+#    define PDC_PERF_FGCOLOR   RGBTO16(0xff, 0xff, 0xff)
+#  else
+#    define PDC_PERF_FGCOLOR   RGBTO24(0xff, 0xff, 0xff)
+#  endif
+#  define PDC_PERF_BGCOLOR     0
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -224,10 +262,39 @@ struct pdc_rgbcolor_s
 
 #if PDCURSES_BPP <= 8
 typedef uint8_t  pdc_color_t;
+#  define PDC_fill blit_fill8
 #elif PDCURSES_BPP <= 16
 typedef uint16_t pdc_color_t;
+#  define PDC_fill blit_fill16
 #elif PDCURSES_BPP <= 32
 typedef uint32_t pdc_color_t;
+#  define PDC_fill blit_fill32
+#endif
+
+#ifdef CONFIG_PDCURSES_PERFMON
+/* The phases of a screen update that are timed by the performance
+ * monitor.  The draw phase includes the glyph phase.
+ */
+
+enum pdc_phase_e
+{
+  PDC_PHASE_GLYPH = 0,     /* Rendering font glyphs */
+  PDC_PHASE_DRAW,          /* Drawing character cells into the framebuffer */
+  PDC_PHASE_PUSH,          /* Sending changed regions to the display */
+  PDC_NPHASES
+};
+#endif
+
+#if CONFIG_PDCURSES_GLYPHCACHE > 0
+/* Describes one pre-rendered glyph in the glyph cache */
+
+struct pdc_glyph_s
+{
+  chtype ch;               /* Character code (and A_BOLD) of the glyph */
+  pdc_color_t fg;          /* Foreground device color */
+  pdc_color_t bg;          /* Background device color */
+  bool inuse;              /* True: The entry holds a valid glyph */
+};
 #endif
 
 /* This structure provides the overall state of the frambuffer device */
@@ -242,6 +309,12 @@ struct pdc_fbstate_s
   fb_coord_t yres;         /* Vertical resolution (rows) */
   fb_coord_t stride;       /* Length of a line (bytes) */
 
+#ifdef CONFIG_PDCURSES_PERFMON
+  /* Performance monitor */
+
+  struct frameprof_s perf; /* Update and phase time statistics */
+#endif
+
 #ifdef CONFIG_PDCURSES_DJOYSTICK
   /* Discrete joystick */
 
@@ -261,6 +334,10 @@ struct pdc_fbstate_s
   uint8_t fstride;         /* Width of the font buffer (bytes) */
   FAR uint8_t *fbuffer;    /* Allocated font buffer */
 #endif
+#if CONFIG_PDCURSES_GLYPHCACHE > 0
+  struct pdc_glyph_s glyph[CONFIG_PDCURSES_GLYPHCACHE];
+  FAR pdc_color_t *gbuffer; /* Images of the cached glyphs */
+#endif
 
   /* Drawable area (See also SP->lines and SP->cols) */
 
@@ -66,7 +66,18 @@
 
 void PDC_scr_close(void)
 {
+#ifdef CONFIG_PDCURSES_PERFMON
+  FAR struct pdc_fbscreen_s *fbscreen = (FAR struct pdc_fbscreen_s *)SP;
+#endif
+
   PDC_LOG(("PDC_scr_close() - called\n"));
+
+#ifdef CONFIG_PDCURSES_PERFMON
+  /* Show the update and phase time histograms */
+
+  DEBUGASSERT(fbscreen != NULL);
+  frameprof_dump(&fbscreen->fbstate.perf, stderr);
+#endif
 }
 
 /****************************************************************************
@@ -89,6 +100,9 @@ void PDC_scr_free(void)
   close(fbstate->fbfd);
 #ifdef CONFIG_PDCURSES_HAVE_INPUT
   PDC_input_close(fbstate);
+#endif
+#if CONFIG_PDCURSES_GLYPHCACHE > 0
+  free(fbstate->gbuffer);
 #endif
   free(fbscreen);
   SP = NULL;
@@ -313,6 +327,22 @@ int PDC_scr_open(int argc, char **argv)
     }
 #endif
 
+#if CONFIG_PDCURSES_GLYPHCACHE > 0
+  /* Allocate the images for the glyph cache.  All entries are initially
+   * unused because fbscreen was zeroed when it was allocated.
+   */
+
+  fbstate->gbuffer = (FAR pdc_color_t *)
+    malloc(CONFIG_PDCURSES_GLYPHCACHE * fbstate->fwidth * fbstate->fheight *
+           sizeof(pdc_color_t));
+
+  if (fbstate->gbuffer == NULL)
+    {
+      PDC_LOG(("ERROR: Failed to allocate glyph cache: %d\n", errno));
+      goto errout_with_boldfont;
+    }
+#endif
+
   /* Calculate the drawable region */
 
   SP->lines        = fbstate->yres / fbstate->fheight;
@@ -325,6 +355,17 @@ int PDC_scr_open(int argc, char **argv)
 
   PDC_clear_screen(fbstate);
 
+#ifdef CONFIG_PDCURSES_PERFMON
+  /* Set up performance monitoring.  The phases are registered in the order
+   * of enum pdc_phase_e.
+   */
+
+  frameprof_initialize(&fbstate->perf);
+  (void)frameprof_phase(&fbstate->perf, "glyph");
+  (void)frameprof_phase(&fbstate->perf, "draw");
+  (void)frameprof_phase(&fbstate->perf, "push");
+#endif
+
 #ifdef CONFIG_PDCURSES_HAVE_INPUT
   /* Open and configure any input devices */
 
@@ -342,6 +383,9 @@ errout_with_fbuffer:
 #if PDCURSES_BPP < 8
   free(fbstate->fbuffer);
 #endif
+#if CONFIG_PDCURSES_GLYPHCACHE > 0
+  free(fbstate->gbuffer);
+#endif
 #endif
 
 errout_with_boldfont:
@@ -192,6 +192,10 @@ int doupdate(void)
       return ERR;
     }
 
+#ifdef CONFIG_PDCURSES_PERFMON
+  PDC_frame_begin();
+#endif
+
   if (isendwin())               /* coming back after endwin() called */
     {
       reset_prog_mode();
@@ -283,6 +287,10 @@ int doupdate(void)
   SP->cursrow = curscr->_cury;
   SP->curscol = curscr->_curx;
 
+#ifdef CONFIG_PDCURSES_PERFMON
+  PDC_frame_end();
+#endif
+
   return OK;
 }
 
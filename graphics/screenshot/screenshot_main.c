@@ -40,17 +40,29 @@
 
 #include <nuttx/config.h>
 
+#include <sys/types.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <string.h>
 #include <semaphore.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
 #include <errno.h>
 
 #include "graphics/tiff.h"
 
-#include <nuttx/nx/nx.h>
+#ifdef CONFIG_NX
+#  include <nuttx/nx/nx.h>
+#endif
+
+#ifdef CONFIG_SCREENSHOT_FRAMEBUFFER
+#  include <sys/ioctl.h>
+#  include <sys/mman.h>
+#  include <nuttx/video/fb.h>
+#endif
 
 #ifdef CONFIG_VNCSERVER
 #  include <nuttx/video/vnc.h>
@@ -72,69 +84,138 @@
 #  define CONFIG_SCREENSHOT_FORMAT FB_FMT_RGB16_565
 #endif
 
+#ifndef CONFIG_SCREENSHOT_FBDEV
+#  define CONFIG_SCREENSHOT_FBDEV "/dev/fb0"
+#endif
+
+#ifndef CONFIG_SCREENSHOT_IOSIZE
+#  define CONFIG_SCREENSHOT_IOSIZE 8192
+#endif
+
+/* Continuous frame stream.  Each frame starts with this header; all multi-
+ * byte fields are little endian:
+ *
+ *   0  "NXSS"       Magic
+ *   4  seqno        Frame sequence number (32-bit)
+ *   8  x, y, w, h   Captured rectangle (16-bit each)
+ *  16  fmt          FB_FMT_* of the row data
+ *  17  compression  0=raw rows, 1=PackBits rows
+ *  18  rowbytes     Bytes per uncompressed row (16-bit)
+ *
+ * The header is followed by h row records:  A 16-bit byte count and then
+ * the (possibly PackBits encoded) row.
+ */
+
+#define SCREENSHOT_FRAMEHDR    20
+#define SCREENSHOT_STREAM_RAW  0
+#define SCREENSHOT_STREAM_PACK 1
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
-/****************************************************************************
- * Private Data
- ****************************************************************************/
+/* Command line options */
+
+struct screenshot_opts_s
+{
+  FAR const char *filename;  /* TIFF file or stream destination */
+  FAR const char *fbdev;     /* Framebuffer device; NULL: capture via NX */
+  struct nxgl_rect_s rect;   /* Requested region of the display */
+  bool region;               /* True: Only capture rect */
+  uint16_t compression;      /* TAG_COMP_* for the TIFF or stream */
+  int fps;                   /* Stream frames per second; 0: single TIFF */
+  int nframes;               /* Number of frames to stream; 0: forever */
+};
+
+#ifdef CONFIG_SCREENSHOT_FRAMEBUFFER
+/* Mapped framebuffer */
+
+struct screenshot_fb_s
+{
+  int fd;                       /* Framebuffer driver */
+  struct fb_videoinfo_s vinfo;  /* Display characteristics */
+  struct fb_planeinfo_s pinfo;  /* Plane 0 characteristics */
+  FAR uint8_t *fbmem;           /* Mapped framebuffer memory */
+  FAR uint8_t *rowbuf;          /* RGB32 rows converted to RGB24 */
+  uint8_t colorfmt;             /* FB_FMT_* of the captured rows */
+  size_t rowbytes;              /* Bytes per captured row */
+};
+#endif
 
 /****************************************************************************
- * Public Data
+ * Private Functions
  ****************************************************************************/
 
 /****************************************************************************
- * Private Functions
+ * Name: screenshot_cliprect
+ *
+ * Description:
+ *   Limit the requested region to the display.  The whole display is used
+ *   if no region was requested.
+ *
  ****************************************************************************/
 
-static void replace_extension(FAR const char *filename, FAR const char *newext,
-                              FAR char *dest, size_t size)
+static bool screenshot_cliprect(FAR struct screenshot_opts_s *opts,
+                                nxgl_coord_t width, nxgl_coord_t height,
+                                FAR struct nxgl_rect_s *rect)
 {
-  FAR char *p = strrchr(filename, '.');
-  int len = strlen(filename);
-
-  if (p != NULL)
-    {
-      len = p - filename;
-    }
+  rect->pt1.x = 0;
+  rect->pt1.y = 0;
+  rect->pt2.x = width - 1;
+  rect->pt2.y = height - 1;
 
-  if (len > size)
+  if (opts->region)
     {
-      len = size - strlen(newext);
+      if (opts->rect.pt1.x > rect->pt1.x)
+        {
+          rect->pt1.x = opts->rect.pt1.x;
+        }
+
+      if (opts->rect.pt1.y > rect->pt1.y)
+        {
+          rect->pt1.y = opts->rect.pt1.y;
+        }
+
+      if (opts->rect.pt2.x < rect->pt2.x)
+        {
+          rect->pt2.x = opts->rect.pt2.x;
+        }
+
+      if (opts->rect.pt2.y < rect->pt2.y)
+        {
+          rect->pt2.y = opts->rect.pt2.y;
+        }
     }
 
-  strncpy(dest, filename, size);
-  strncpy(dest + len, newext, size - len);
+  return rect->pt1.x <= rect->pt2.x && rect->pt1.y <= rect->pt2.y;
 }
 
+#ifdef CONFIG_NX
 /****************************************************************************
- * Public Functions
- ****************************************************************************/
-
-/****************************************************************************
- * Name: save_screenshot
+ * Name: nx_screenshot
  *
  * Description:
- *   Takes a screenshot and saves it to a tif file.
+ *   Takes a screenshot through NX and saves it to a tif file.
  *
  ****************************************************************************/
 
-int save_screenshot(FAR const char *filename)
+static int nx_screenshot(FAR struct screenshot_opts_s *opts)
 {
   struct tiff_info_s info;
   struct nx_callback_s cb = {};
   struct nxgl_size_s size = {CONFIG_SCREENSHOT_WIDTH, CONFIG_SCREENSHOT_HEIGHT};
+  struct nxgl_rect_s clip;
   FAR uint8_t *strip;
   NXHANDLE server;
   NXWINDOW window;
-  char tempf1[64];
-  char tempf2[64];
   int row;
   int ret;
 
-  replace_extension(filename, ".tm1", tempf1, sizeof(tempf1));
-  replace_extension(filename, ".tm2", tempf2, sizeof(tempf2));
+  if (!screenshot_cliprect(opts, size.w, size.h, &clip))
+    {
+      fprintf(stderr, "Region is outside of the display\n");
+      return 1;
+    }
 
   /* Connect to NX server */
 
@@ -181,15 +262,14 @@ int save_screenshot(FAR const char *filename)
   /* Configure the TIFF structure */
 
   memset(&info, 0, sizeof(struct tiff_info_s));
-  info.outfile   = filename;
-  info.tmpfile1  = tempf1;
-  info.tmpfile2  = tempf2;
-  info.colorfmt  = CONFIG_SCREENSHOT_FORMAT;
-  info.rps       = 1;
-  info.imgwidth  = size.w;
-  info.imgheight = size.h;
-  info.iobuffer  = (uint8_t *)malloc(300);
-  info.iosize    = 300;
+  info.outfile     = opts->filename;
+  info.colorfmt    = CONFIG_SCREENSHOT_FORMAT;
+  info.rps         = 1;
+  info.imgwidth    = clip.pt2.x - clip.pt1.x + 1;
+  info.imgheight   = clip.pt2.y - clip.pt1.y + 1;
+  info.compression = opts->compression;
+  info.iobuffer    = (uint8_t *)malloc(CONFIG_SCREENSHOT_IOSIZE);
+  info.iosize      = CONFIG_SCREENSHOT_IOSIZE;
 
   /* Initialize the TIFF library */
 
@@ -197,16 +277,19 @@ int save_screenshot(FAR const char *filename)
   if (ret < 0)
     {
       printf("tiff_initialize() failed: %d\n", ret);
+      free(info.iobuffer);
+      nx_closewindow(window);
+      nx_disconnect(server);
       return 1;
     }
 
   /* Add each strip to the TIFF file */
 
-  strip = malloc(size.w * 3);
+  strip = malloc(info.imgwidth * 3);
 
-  for (row = 0; row < size.h; row++)
+  for (row = clip.pt1.y; row <= clip.pt2.y; row++)
   {
-    struct nxgl_rect_s rect = {{0, row}, {size.w - 1, row}};
+    struct nxgl_rect_s rect = {{clip.pt1.x, row}, {clip.pt2.x, row}};
     nx_getrectangle(window, &rect, 0, strip, 0);
 
     ret = tiff_addstrip(&info, strip);
@@ -221,17 +304,511 @@ int save_screenshot(FAR const char *filename)
 
   /* Then finalize the TIFF file */
 
-  ret = tiff_finalize(&info);
-  if (ret < 0)
+  if (ret >= 0)
     {
-      printf("tiff_finalize() failed: %d\n", ret);
+      ret = tiff_finalize(&info);
+      if (ret < 0)
+        {
+          printf("tiff_finalize() failed: %d\n", ret);
+        }
     }
 
   free(info.iobuffer);
   nx_closewindow(window);
   nx_disconnect(server);
 
-  return 0;
+  return ret < 0 ? 1 : 0;
+}
+#endif
+
+#ifdef CONFIG_SCREENSHOT_FRAMEBUFFER
+/****************************************************************************
+ * Name: fb_open
+ *
+ * Description:
+ *   Open and map the framebuffer.
+ *
+ ****************************************************************************/
+
+static int fb_open(FAR const char *fbdev, FAR struct screenshot_fb_s *fb)
+{
+  int ret;
+
+  memset(fb, 0, sizeof(struct screenshot_fb_s));
+
+  fb->fd = open(fbdev, O_RDONLY);
+  if (fb->fd < 0)
+    {
+      fprintf(stderr, "ERROR: Failed to open %s: %d\n", fbdev, errno);
+      return ERROR;
+    }
+
+  ret = ioctl(fb->fd, FBIOGET_VIDEOINFO,
+              (unsigned long)((uintptr_t)&fb->vinfo));
+  if (ret >= 0)
+    {
+      ret = ioctl(fb->fd, FBIOGET_PLANEINFO,
+                  (unsigned long)((uintptr_t)&fb->pinfo));
+    }
+
+  if (ret < 0)
+    {
+      fprintf(stderr, "ERROR: ioctl(FBIOGET_*INFO) failed: %d\n", errno);
+      close(fb->fd);
+      return ERROR;
+    }
+
+  /* Only the formats of the TIFF library are supported.  RGB32 rows are
+   * converted to RGB24.
+   */
+
+  fb->colorfmt = fb->vinfo.fmt;
+  switch (fb->vinfo.fmt)
+    {
+      case FB_FMT_Y1:
+      case FB_FMT_Y4:
+      case FB_FMT_Y8:
+      case FB_FMT_RGB16_565:
+      case FB_FMT_RGB24:
+        break;
+
+#ifdef FB_FMT_RGB32
+      case FB_FMT_RGB32:
+        fb->colorfmt = FB_FMT_RGB24;
+        fb->rowbuf   = (FAR uint8_t *)malloc(3 * fb->vinfo.xres);
+        if (fb->rowbuf == NULL)
+          {
+            close(fb->fd);
+            return ERROR;
+          }
+        break;
+#endif
+
+      default:
+        fprintf(stderr, "ERROR: Color format %u is not supported\n",
+                fb->vinfo.fmt);
+        close(fb->fd);
+        return ERROR;
+    }
+
+  /* mmap() the framebuffer.  Rows are then passed to the TIFF writer
+   * directly from the framebuffer memory.
+   */
+
+  fb->fbmem = (FAR uint8_t *)mmap(NULL, fb->pinfo.fblen, PROT_READ,
+                                  MAP_SHARED|MAP_FILE, fb->fd, 0);
+  if (fb->fbmem == MAP_FAILED)
+    {
+      fprintf(stderr, "ERROR: mmap() failed: %d\n", errno);
+      free(fb->rowbuf);
+      close(fb->fd);
+      return ERROR;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: fb_close
+ ****************************************************************************/
+
+static void fb_close(FAR struct screenshot_fb_s *fb)
+{
+  (void)munmap(fb->fbmem, fb->pinfo.fblen);
+  (void)close(fb->fd);
+  free(fb->rowbuf);
+}
+
+/****************************************************************************
+ * Name: fb_cliprect
+ *
+ * Description:
+ *   Determine the framebuffer region to capture.  Sub-byte pixel formats
+ *   are widened to whole bytes so that each row starts on a byte boundary.
+ *
+ ****************************************************************************/
+
+static bool fb_cliprect(FAR struct screenshot_opts_s *opts,
+                        FAR struct screenshot_fb_s *fb,
+                        FAR struct nxgl_rect_s *rect)
+{
+  unsigned int bpp = fb->pinfo.bpp;
+  nxgl_coord_t width;
+
+  if (!screenshot_cliprect(opts, fb->vinfo.xres, fb->vinfo.yres, rect))
+    {
+      return false;
+    }
+
+  if (bpp < 8)
+    {
+      nxgl_coord_t ppb = 8 / bpp;
+
+      rect->pt1.x &= ~(ppb - 1);
+      rect->pt2.x |= (ppb - 1);
+      if (rect->pt2.x >= fb->vinfo.xres)
+        {
+          rect->pt2.x = fb->vinfo.xres - 1;
+        }
+    }
+
+  width = rect->pt2.x - rect->pt1.x + 1;
+  fb->rowbytes = fb->rowbuf != NULL ? 3 * width : (width * bpp + 7) >> 3;
+  return true;
+}
+
+/****************************************************************************
+ * Name: fb_getrow
+ *
+ * Description:
+ *   Return one row of the region in the captured color format.
+ *
+ ****************************************************************************/
+
+static FAR const uint8_t *fb_getrow(FAR struct screenshot_fb_s *fb,
+                                    FAR const struct nxgl_rect_s *rect,
+                                    nxgl_coord_t y)
+{
+  FAR const uint8_t *src = fb->fbmem + y * fb->pinfo.stride +
+                           ((rect->pt1.x * fb->pinfo.bpp) >> 3);
+
+#ifdef FB_FMT_RGB32
+  if (fb->rowbuf != NULL)
+    {
+      FAR const uint32_t *pixel = (FAR const uint32_t *)src;
+      FAR uint8_t *dest = fb->rowbuf;
+      nxgl_coord_t x;
+
+      for (x = rect->pt1.x; x <= rect->pt2.x; x++, pixel++)
+        {
+          *dest++ = (uint8_t)(*pixel >> 16);
+          *dest++ = (uint8_t)(*pixel >> 8);
+          *dest++ = (uint8_t)*pixel;
+        }
+
+      return fb->rowbuf;
+    }
+#endif
+
+  return src;
+}
+
+/****************************************************************************
+ * Name: fb_screenshot
+ *
+ * Description:
+ *   Save a region of the mapped framebuffer to a tif file.
+ *
+ ****************************************************************************/
+
+static int fb_screenshot(FAR struct screenshot_opts_s *opts,
+                         FAR struct screenshot_fb_s *fb)
+{
+  struct tiff_info_s info;
+  struct nxgl_rect_s rect;
+  nxgl_coord_t y;
+  int ret;
+
+  if (!fb_cliprect(opts, fb, &rect))
+    {
+      fprintf(stderr, "Region is outside of the display\n");
+      return 1;
+    }
+
+  memset(&info, 0, sizeof(struct tiff_info_s));
+  info.outfile     = opts->filename;
+  info.colorfmt    = fb->colorfmt;
+  info.rps         = 1;
+  info.imgwidth    = rect.pt2.x - rect.pt1.x + 1;
+  info.imgheight   = rect.pt2.y - rect.pt1.y + 1;
+  info.compression = opts->compression;
+  info.iobuffer    = (uint8_t *)malloc(CONFIG_SCREENSHOT_IOSIZE);
+  info.iosize      = CONFIG_SCREENSHOT_IOSIZE;
+
+  ret = tiff_initialize(&info);
+  if (ret < 0)
+    {
+      printf("tiff_initialize() failed: %d\n", ret);
+      free(info.iobuffer);
+      return 1;
+    }
+
+  /* Each row of the region is one strip, taken straight from the mapped
+   * framebuffer.
+   */
+
+  for (y = rect.pt1.y; y <= rect.pt2.y; y++)
+    {
+      ret = tiff_addstrip(&info, fb_getrow(fb, &rect, y));
+      if (ret < 0)
+        {
+          printf("tiff_addstrip() #%d failed: %d\n", y, ret);
+          break;
+        }
+    }
+
+  if (ret >= 0)
+    {
+      ret = tiff_finalize(&info);
+      if (ret < 0)
+        {
+          printf("tiff_finalize() failed: %d\n", ret);
+        }
+    }
+
+  free(info.iobuffer);
+  return ret < 0 ? 1 : 0;
+}
+
+/****************************************************************************
+ * Name: fb_put16/32
+ ****************************************************************************/
+
+static FAR uint8_t *fb_put16(FAR uint8_t *dest, uint16_t value)
+{
+  *dest++ = (uint8_t)value;
+  *dest++ = (uint8_t)(value >> 8);
+  return dest;
+}
+
+static FAR uint8_t *fb_put32(FAR uint8_t *dest, uint32_t value)
+{
+  dest = fb_put16(dest, (uint16_t)value);
+  return fb_put16(dest, (uint16_t)(value >> 16));
+}
+
+/****************************************************************************
+ * Name: fb_stream
+ *
+ * Description:
+ *   Send frames of a region of the mapped framebuffer continuously at the
+ *   requested rate.
+ *
+ ****************************************************************************/
+
+static int fb_stream(FAR struct screenshot_opts_s *opts,
+                     FAR struct screenshot_fb_s *fb)
+{
+  struct nxgl_rect_s rect;
+  struct timespec ts;
+  FAR uint8_t *buffer;
+  FAR uint8_t *ptr;
+  FAR const uint8_t *row;
+  size_t bufsize;
+  size_t maxrec;
+  size_t len;
+  uint32_t seqno;
+  uint32_t period;
+  uint32_t start;
+  uint32_t now;
+  nxgl_coord_t y;
+  int outfd;
+  int ret = 0;
+
+  if (!fb_cliprect(opts, fb, &rect))
+    {
+      fprintf(stderr, "Region is outside of the display\n");
+      return 1;
+    }
+
+  /* Each row record must fit in the output buffer */
+
+#ifdef CONFIG_TIFF_PACKBITS
+  maxrec = 2 + TIFF_PACKBITS_MAXSIZE(fb->rowbytes);
+#else
+  maxrec = 2 + fb->rowbytes;
+#endif
+
+  bufsize = CONFIG_SCREENSHOT_IOSIZE;
+  if (bufsize < SCREENSHOT_FRAMEHDR + maxrec)
+    {
+      bufsize = SCREENSHOT_FRAMEHDR + maxrec;
+    }
+
+  buffer = (FAR uint8_t *)malloc(bufsize);
+  if (buffer == NULL)
+    {
+      fprintf(stderr, "ERROR: Failed to allocate the stream buffer\n");
+      return 1;
+    }
+
+  outfd = open(opts->filename, O_WRONLY|O_CREAT|O_TRUNC, 0666);
+  if (outfd < 0)
+    {
+      fprintf(stderr, "ERROR: Failed to open %s: %d\n", opts->filename, errno);
+      free(buffer);
+      return 1;
+    }
+
+  period = 1000 / opts->fps;
+
+  for (seqno = 0; opts->nframes == 0 || seqno < opts->nframes; seqno++)
+    {
+      clock_gettime(CLOCK_REALTIME, &ts);
+      start = ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+
+      /* Frame header */
+
+      memcpy(buffer, "NXSS", 4);
+      ptr  = fb_put32(buffer + 4, seqno);
+      ptr  = fb_put16(ptr, rect.pt1.x);
+      ptr  = fb_put16(ptr, rect.pt1.y);
+      ptr  = fb_put16(ptr, rect.pt2.x - rect.pt1.x + 1);
+      ptr  = fb_put16(ptr, rect.pt2.y - rect.pt1.y + 1);
+      *ptr++ = fb->colorfmt;
+      *ptr++ = opts->compression == TAG_COMP_PACKBITS ?
+               SCREENSHOT_STREAM_PACK : SCREENSHOT_STREAM_RAW;
+      ptr  = fb_put16(ptr, fb->rowbytes);
+
+      /* Row records, written whenever the buffer fills */
+
+      for (y = rect.pt1.y; y <= rect.pt2.y && ret == 0; y++)
+        {
+          if (ptr + maxrec > buffer + bufsize)
+            {
+              ret = write(outfd, buffer, ptr - buffer) < 0 ? 1 : 0;
+              ptr = buffer;
+            }
+
+          row = fb_getrow(fb, &rect, y);
+#ifdef CONFIG_TIFF_PACKBITS
+          if (opts->compression == TAG_COMP_PACKBITS)
+            {
+              len = tiff_packbits(ptr + 2, row, fb->rowbytes);
+            }
+          else
+#endif
+            {
+              memcpy(ptr + 2, row, fb->rowbytes);
+              len = fb->rowbytes;
+            }
+
+          ptr  = fb_put16(ptr, len);
+          ptr += len;
+        }
+
+      if (ret == 0 && write(outfd, buffer, ptr - buffer) < 0)
+        {
+          ret = 1;
+        }
+
+      if (ret != 0)
+        {
+          fprintf(stderr, "ERROR: Write to %s failed: %d\n",
+                  opts->filename, errno);
+          break;
+        }
+
+      /* Wait for the next frame time */
+
+      clock_gettime(CLOCK_REALTIME, &ts);
+      now = ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+      if (now - start < period)
+        {
+          usleep((period - (now - start)) * 1000);
+        }
+    }
+
+  close(outfd);
+  free(buffer);
+  return ret;
+}
+#endif
+
+/****************************************************************************
+ * Name: screenshot_parserect
+ *
+ * Description:
+ *   Parse a region given as x,y,w,h.
+ *
+ ****************************************************************************/
+
+static bool screenshot_parserect(FAR const char *arg,
+                                 FAR struct nxgl_rect_s *rect)
+{
+  long value[4];
+  FAR char *end;
+  int i;
+
+  for (i = 0; i < 4; i++)
+    {
+      value[i] = strtol(arg, &end, 10);
+      if (end == arg || (i < 3 && *end != ',') || (i == 3 && *end != '\0'))
+        {
+          return false;
+        }
+
+      arg = end + 1;
+    }
+
+  if (value[0] < 0 || value[1] < 0 || value[2] <= 0 || value[3] <= 0)
+    {
+      return false;
+    }
+
+  rect->pt1.x = value[0];
+  rect->pt1.y = value[1];
+  rect->pt2.x = value[0] + value[2] - 1;
+  rect->pt2.y = value[1] + value[3] - 1;
+  return true;
+}
+
+/****************************************************************************
+ * Name: screenshot_usage
+ ****************************************************************************/
+
+static void screenshot_usage(FAR const char *progname)
+{
+  fprintf(stderr, "Usage: %s [options] <file>\n", progname);
+  fprintf(stderr, "  -r x,y,w,h  Capture only this region\n");
+  fprintf(stderr, "  -c <comp>   Compression: none, packbits or lzw\n");
+#ifdef CONFIG_SCREENSHOT_FRAMEBUFFER
+  fprintf(stderr, "  -d <dev>    Capture from this framebuffer device\n");
+#ifdef CONFIG_NX
+  fprintf(stderr, "  -f          Capture from %s instead of NX\n",
+          CONFIG_SCREENSHOT_FBDEV);
+#endif
+  fprintf(stderr, "  -s <fps>    Stream raw/packbits frames to <file>\n");
+  fprintf(stderr, "  -n <count>  Number of frames to stream (0=forever)\n");
+#endif
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: save_screenshot
+ *
+ * Description:
+ *   Takes a screenshot and saves it to a tif file.
+ *
+ ****************************************************************************/
+
+int save_screenshot(FAR const char *filename)
+{
+  struct screenshot_opts_s opts;
+
+  memset(&opts, 0, sizeof(struct screenshot_opts_s));
+  opts.filename = filename;
+
+#ifdef CONFIG_NX
+  return nx_screenshot(&opts);
+#else
+  {
+    struct screenshot_fb_s fb;
+    int ret;
+
+    if (fb_open(CONFIG_SCREENSHOT_FBDEV, &fb) < 0)
+      {
+        return 1;
+      }
+
+    ret = fb_screenshot(&opts, &fb);
+    fb_close(&fb);
+    return ret;
+  }
+#endif
 }
 
 /****************************************************************************
@@ -248,11 +825,128 @@ int main(int argc, FAR char *argv[])
 int screenshot_main(int argc, char *argv[])
 #endif
 {
-  if (argc != 2)
+  struct screenshot_opts_s opts;
+#ifdef CONFIG_SCREENSHOT_FRAMEBUFFER
+  struct screenshot_fb_s fb;
+#endif
+  int option;
+  int ret;
+
+  memset(&opts, 0, sizeof(struct screenshot_opts_s));
+#ifndef CONFIG_NX
+  opts.fbdev = CONFIG_SCREENSHOT_FBDEV;
+#endif
+
+  while ((option = getopt(argc, argv, "r:c:d:fs:n:h")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'r':
+            if (!screenshot_parserect(optarg, &opts.rect))
+              {
+                fprintf(stderr, "Bad region: %s\n", optarg);
+                return 1;
+              }
+
+            opts.region = true;
+            break;
+
+          case 'c':
+            if (strcmp(optarg, "none") == 0)
+              {
+                opts.compression = TAG_COMP_NONE;
+              }
+            else if (strcmp(optarg, "packbits") == 0)
+              {
+                opts.compression = TAG_COMP_PACKBITS;
+              }
+            else if (strcmp(optarg, "lzw") == 0)
+              {
+                opts.compression = TAG_COMP_LZW;
+              }
+            else
+              {
+                fprintf(stderr, "Bad compression: %s\n", optarg);
+                return 1;
+              }
+            break;
+
+#ifdef CONFIG_SCREENSHOT_FRAMEBUFFER
+          case 'd':
+            opts.fbdev = optarg;
+            break;
+
+          case 'f':
+            opts.fbdev = CONFIG_SCREENSHOT_FBDEV;
+            break;
+
+          case 's':
+            opts.fps = atoi(optarg);
+            if (opts.fps <= 0 || opts.fps > 1000)
+              {
+                fprintf(stderr, "Bad frame rate: %s\n", optarg);
+                return 1;
+              }
+            break;
+
+          case 'n':
+            opts.nframes = atoi(optarg);
+            break;
+#endif
+
+          case 'h':
+          default:
+            screenshot_usage(argv[0]);
+            return 1;
+        }
+    }
+
+  if (optind != argc - 1)
+    {
+      screenshot_usage(argv[0]);
+      return 1;
+    }
+
+  opts.filename = argv[optind];
+
+#ifdef CONFIG_SCREENSHOT_FRAMEBUFFER
+  if (opts.fbdev != NULL)
+    {
+      if (opts.fps > 0 && opts.compression == TAG_COMP_LZW)
+        {
+          fprintf(stderr, "Frames can only be streamed raw or packbits\n");
+          return 1;
+        }
+
+#ifndef CONFIG_TIFF_PACKBITS
+      if (opts.fps > 0 && opts.compression == TAG_COMP_PACKBITS)
+        {
+          fprintf(stderr, "PackBits support is not enabled\n");
+          return 1;
+        }
+#endif
+
+      if (fb_open(opts.fbdev, &fb) < 0)
+        {
+          return 1;
+        }
+
+      ret = opts.fps > 0 ? fb_stream(&opts, &fb) : fb_screenshot(&opts, &fb);
+      fb_close(&fb);
+      return ret;
+    }
+
+  if (opts.fps > 0)
     {
-      fprintf(stderr, "Usage: screenshot file.tif\n");
+      fprintf(stderr, "Streaming requires framebuffer capture (-d or -f)\n");
       return 1;
     }
+#endif
 
-  return save_screenshot(argv[1]);
+#ifdef CONFIG_NX
+  ret = nx_screenshot(&opts);
+#else
+  ret = 1;
+#endif
+  return ret;
 }
@@ -68,86 +68,79 @@
  ****************************************************************************/
 
 /****************************************************************************
- * Name: tiff_addstrip
+ * Name: tiff_convstrip
  *
  * Description:
- *   Convert an RGB565 strip to an RGB888 strip and write it to tmpfile2.
- *
- *   Add an image data strip.  The size of the strip in pixels must be equal
- *   to the RowsPerStrip x ImageWidth values that were provided to
- *   tiff_initialize().
+ *   Convert an RGB565 strip to an RGB888 strip directly in the I/O buffer.
  *
  * Input Parameters:
  *   info    - A pointer to the caller allocated parameter passing/TIFF state instance.
- *   buffer  - A buffer containing a single row of data.
+ *   strip   - A buffer containing a single strip of RGB565 data.
  *
  * Returned Value:
  *   Zero (OK) on success.  A negated errno value on failure.
  *
  ****************************************************************************/
-int tiff_convstrip(FAR struct tiff_info_s *info, FAR const uint8_t *strip)
+
+static int tiff_convstrip(FAR struct tiff_info_s *info,
+                          FAR const uint8_t *strip)
 {
-#ifdef CONFIG_DEBUG_GRAPHICS
-  size_t ntotal;
-#endif
-  size_t nbytes;
-  FAR uint16_t *src;
+  FAR const uint16_t *src;
   FAR uint8_t *dest;
+  uint8_t rgb888[3];
   uint16_t rgb565;
+  size_t npixels;
+  size_t avail;
+  size_t i;
   int ret;
-  int i;
-
-  DEBUGASSERT(info->iobuffer != NULL);
 
-  /* Convert each RGB565 pixel to RGB888 */
-
-  src    = (FAR uint16_t *)strip;
-  dest   = info->iobuffer;
-  nbytes = 0;
-#ifdef CONFIG_DEBUG_GRAPHICS
-  ntotal = 0;
-#endif
+  /* Convert each RGB565 pixel to RGB888, as many at a time as fit in the
+   * current I/O buffer half.
+   */
 
-  for (i = 0; i < info->pps; i++)
+  src = (FAR const uint16_t *)strip;
+  for (npixels = info->pps; npixels > 0; npixels -= i)
     {
-      /* Convert RGB565 to RGB888 */
+      dest = tiff_bufspace(info, &avail);
+      avail /= 3;
 
-      rgb565  = *src++;
-      *dest++ = (rgb565 >> (11-3)) & 0xf8; /* Move bits 11-15 to 3-7 */
-      *dest++ = (rgb565 >> ( 5-2)) & 0xfc; /* Move bits  5-10 to 2-7 */
-      *dest++ = (rgb565 << (   3)) & 0xf8; /* Move bits  0- 4 to 3-7 */
-
-      /* Update the byte count */
-
-      nbytes += 3;
-#ifdef CONFIG_DEBUG_GRAPHICS
-      ntotal += 3;
-#endif
+      if (avail == 0)
+        {
+          /* A pixel straddles the end of the buffer half */
 
-      /* Flush the conversion buffer to tmpfile2 when it becomes full */
+          rgb565    = *src++;
+          rgb888[0] = (rgb565 >> (11-3)) & 0xf8; /* Move bits 11-15 to 3-7 */
+          rgb888[1] = (rgb565 >> ( 5-2)) & 0xfc; /* Move bits  5-10 to 2-7 */
+          rgb888[2] = (rgb565 << (   3)) & 0xf8; /* Move bits  0- 4 to 3-7 */
 
-      if (nbytes > (info->iosize-3))
+          ret = tiff_bufwrite(info, rgb888, 3);
+          i   = 1;
+        }
+      else
         {
-          ret = tiff_write(info->tmp2fd, info->iobuffer, nbytes);
-          if (ret < 0)
+          if (avail > npixels)
+            {
+              avail = npixels;
+            }
+
+          for (i = 0; i < avail; i++)
             {
-              return ret;
+              rgb565  = *src++;
+              *dest++ = (rgb565 >> (11-3)) & 0xf8; /* Move bits 11-15 to 3-7 */
+              *dest++ = (rgb565 >> ( 5-2)) & 0xfc; /* Move bits  5-10 to 2-7 */
+              *dest++ = (rgb565 << (   3)) & 0xf8; /* Move bits  0- 4 to 3-7 */
             }
 
-          /* Reset to refill the conversion buffer */
+          ret = tiff_bufcommit(info, 3 * avail);
+        }
 
-          dest   = info->iobuffer;
-          nbytes = 0;
+      if (ret < 0)
+        {
+          return ret;
         }
     }
 
-  /* Flush any buffer data to tmpfile2 */
-
-  ret = tiff_write(info->tmp2fd, info->iobuffer, nbytes);
-#ifdef CONFIG_DEBUG_GRAPHICS
-  ASSERT(ntotal == info->bps);
-#endif
-  return ret;
+  return OK;
 }
 
 /****************************************************************************
@@ -173,23 +166,41 @@ int tiff_convstrip(FAR struct tiff_info_s *info, FAR const uint8_t *strip)
 
 int tiff_addstrip(FAR struct tiff_info_s *info, FAR const uint8_t *strip)
 {
-  ssize_t newsize;
+  off_t start = info->outsize;
   int ret;
 
+  /* The strip tables written by tiff_initialize() only provide for the
+   * number of strips in the image.
+   */
+
+  if (info->nstrips >= info->maxstrips)
+    {
+      gerr("ERROR: Too many strips: %d\n", info->nstrips + 1);
+      ret = -E2BIG;
+      goto errout;
+    }
+
   /* Add the new strip based on the color format.  For FB_FMT_RGB16_565,
    * will have to perform a conversion to RGB888.
    */
 
+#if defined(CONFIG_TIFF_PACKBITS) || defined(CONFIG_TIFF_LZW)
+  if (info->compression != TAG_COMP_NONE)
+    {
+      ret = tiff_compstrip(info, strip);
+    }
+  else
+#endif
   if (info->colorfmt == FB_FMT_RGB16_565)
     {
       ret = tiff_convstrip(info, strip);
     }
 
-  /* For other formats, it is a simple write using the number of bytes per strip */
+  /* For other formats, it is a simple copy using the number of bytes per strip */
 
   else
     {
-      ret = tiff_write(info->tmp2fd, strip, info->bps);
+      ret = tiff_bufwrite(info, strip, info->bps);
     }
 
   if (ret < 0)
@@ -197,43 +208,30 @@ int tiff_addstrip(FAR struct tiff_info_s *info, FAR const uint8_t *strip)
       goto errout;
     }
 
-  /* Write the byte count to the outfile and the offset to tmpfile1 */
+  /* Remember the size of a compressed strip for the strip tables */
 
-  ret = tiff_putint32(info->outfd, info->bps);
-  if (ret < 0)
+  if (info->counts != NULL)
     {
-      goto errout;
+      info->counts[info->nstrips] = (uint32_t)(info->outsize - start);
     }
-  info->outsize += 4;
 
-  ret = tiff_putint32(info->tmp1fd, info->tmp2size);
-  if (ret < 0)
-    {
-      goto errout;
-    }
-  info->tmp1size += 4;
+  /* Pad the strip as necessary achieve word alignment */
 
-  /* Increment the size of tmp2file. */
-
-  info->tmp2size += info->bps;
-
-  /* Pad tmpfile2 as necessary achieve word alignment */
-
-  newsize = tiff_wordalign(info->tmp2fd, info->tmp2size);
-  if (newsize < 0)
+  ret = tiff_wordalign(info);
+  if (ret < 0)
     {
-      ret = (int)newsize;
       goto errout;
     }
-  info->tmp2size = (size_t)newsize;
 
   /* Increment the number of strips in the TIFF file */
 
   info->nstrips++;
+  DEBUGASSERT(info->counts != NULL ||
+              info->outsize == info->stripoffset +
+              (off_t)info->nstrips * ((info->bps + 3) & ~3));
   return OK;
 
 errout:
   tiff_abort(info);
   return ret;
 }
-
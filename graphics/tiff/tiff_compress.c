@@ -0,0 +1,492 @@
+/****************************************************************************
+ * apps/graphics/tiff/tiff_compress.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include "graphics/tiff.h"
+
+#include "tiff_internal.h"
+
+#if defined(CONFIG_TIFF_PACKBITS) || defined(CONFIG_TIFF_LZW)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: tiff_rgb565row
+ *
+ * Description:
+ *   Convert one row of RGB565 pixels to RGB888.
+ *
+ ****************************************************************************/
+
+static void tiff_rgb565row(FAR uint8_t *dest, FAR const uint16_t *src,
+                           nxgl_coord_t npixels)
+{
+  uint16_t rgb565;
+
+  while (npixels-- > 0)
+    {
+      rgb565  = *src++;
+      *dest++ = (rgb565 >> (11-3)) & 0xf8; /* Move bits 11-15 to 3-7 */
+      *dest++ = (rgb565 >> ( 5-2)) & 0xfc; /* Move bits  5-10 to 2-7 */
+      *dest++ = (rgb565 << (   3)) & 0xf8; /* Move bits  0- 4 to 3-7 */
+    }
+}
+
+/****************************************************************************
+ * Name: tiff_packrun
+ *
+ * Description:
+ *   Measure the next PackBits run.  Runs of two or more repeated bytes are
+ *   repeats with a count byte of 1-n followed by the byte; everything else
+ *   is copied as literals behind a count byte of n-1.  Neither kind of run
+ *   exceeds 128 bytes.
+ *
+ * Returned Value:
+ *   The number of source bytes in the run.  *hdr receives the count byte.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_TIFF_PACKBITS
+static size_t tiff_packrun(FAR const uint8_t *src, size_t nbytes,
+                           FAR uint8_t *hdr)
+{
+  size_t len;
+
+  for (len = 1; len < nbytes && len < 128 && src[len] == src[0]; len++)
+    {
+    }
+
+  if (len > 1)
+    {
+      *hdr = (uint8_t)(1 - (int)len);
+      return len;
+    }
+
+  /* Extend the literal up to the next run of three, which is the shortest
+   * run that is cheaper to encode as a repeat.
+   */
+
+  for (len = 1; len < nbytes && len < 128; len++)
+    {
+      if (len + 2 < nbytes && src[len] == src[len + 1] &&
+          src[len] == src[len + 2])
+        {
+          break;
+        }
+    }
+
+  *hdr = (uint8_t)(len - 1);
+  return len;
+}
+
+/****************************************************************************
+ * Name: tiff_packrow
+ *
+ * Description:
+ *   PackBits encode one row into the outfile.
+ *
+ ****************************************************************************/
+
+static int tiff_packrow(FAR struct tiff_info_s *info,
+                        FAR const uint8_t *src, size_t nbytes)
+{
+  uint8_t hdr[2];
+  size_t len;
+  int ret;
+
+  while (nbytes > 0)
+    {
+      len = tiff_packrun(src, nbytes, &hdr[0]);
+      if (hdr[0] >= 128)
+        {
+          hdr[1] = src[0];
+          ret    = tiff_bufwrite(info, hdr, 2);
+        }
+      else
+        {
+          ret = tiff_bufwrite(info, hdr, 1);
+          if (ret == OK)
+            {
+              ret = tiff_bufwrite(info, src, len);
+            }
+        }
+
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      src    += len;
+      nbytes -= len;
+    }
+
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: tiff_lzwput
+ *
+ * Description:
+ *   Append one code to the LZW bit stream, most significant bit first.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_TIFF_LZW
+static int tiff_lzwput(FAR struct tiff_info_s *info, uint16_t code)
+{
+  FAR struct tiff_lzw_s *lzw = info->lzw;
+  uint8_t bytes[2];
+  int nbytes = 0;
+
+  lzw->bits       = (lzw->bits << lzw->nbits) | code;
+  lzw->nbuffered += lzw->nbits;
+
+  while (lzw->nbuffered >= 8)
+    {
+      lzw->nbuffered -= 8;
+      bytes[nbytes++] = (uint8_t)(lzw->bits >> lzw->nbuffered);
+    }
+
+  lzw->bits &= (1 << lzw->nbuffered) - 1;
+  return tiff_bufwrite(info, bytes, nbytes);
+}
+
+/****************************************************************************
+ * Name: tiff_lzwclear
+ *
+ * Description:
+ *   Empty the dictionary and restart with the minimum code width.
+ *
+ ****************************************************************************/
+
+static void tiff_lzwclear(FAR struct tiff_lzw_s *lzw)
+{
+  memset(lzw->child, 0, sizeof(lzw->child));
+  lzw->nbits    = TIFF_LZW_MINBITS;
+  lzw->nextcode = TIFF_LZW_FIRST;
+}
+
+/****************************************************************************
+ * Name: tiff_lzwadd
+ *
+ * Description:
+ *   Account for a new dictionary code after the pending string was output.
+ *   The code width grows as soon as the next code would not fit and the
+ *   dictionary is cleared just before it overflows, in the same way as
+ *   the decoders expect.
+ *
+ ****************************************************************************/
+
+static int tiff_lzwadd(FAR struct tiff_info_s *info)
+{
+  FAR struct tiff_lzw_s *lzw = info->lzw;
+  int ret = OK;
+
+  if (++lzw->nextcode == TIFF_LZW_FULL)
+    {
+      ret = tiff_lzwput(info, TIFF_LZW_CLEAR);
+      tiff_lzwclear(lzw);
+    }
+  else if (lzw->nextcode >= (1 << lzw->nbits))
+    {
+      lzw->nbits++;
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: tiff_lzwencode
+ *
+ * Description:
+ *   LZW encode the next part of a strip.
+ *
+ ****************************************************************************/
+
+static int tiff_lzwencode(FAR struct tiff_info_s *info,
+                          FAR const uint8_t *src, size_t nbytes)
+{
+  FAR struct tiff_lzw_s *lzw = info->lzw;
+  uint16_t code;
+  uint8_t ch;
+  int ret;
+
+  while (nbytes-- > 0)
+    {
+      ch = *src++;
+      if (lzw->prefix < 0)
+        {
+          lzw->prefix = ch;
+          continue;
+        }
+
+      /* Look for the pending string extended by this byte */
+
+      for (code = lzw->child[lzw->prefix];
+           code != 0 && lzw->suffix[code] != ch;
+           code = lzw->sibling[code])
+        {
+        }
+
+      if (code != 0)
+        {
+          lzw->prefix = code;
+          continue;
+        }
+
+      /* Not in the dictionary:  Output the pending string, add the
+       * extended string as a new code and start over from this byte.
+       */
+
+      ret = tiff_lzwput(info, lzw->prefix);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      code                    = lzw->nextcode;
+      lzw->suffix[code]       = ch;
+      lzw->child[code]        = 0;
+      lzw->sibling[code]      = lzw->child[lzw->prefix];
+      lzw->child[lzw->prefix] = code;
+      lzw->prefix             = ch;
+
+      ret = tiff_lzwadd(info);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: tiff_lzwfinish
+ *
+ * Description:
+ *   Output the pending string and the end-of-information code, then pad
+ *   the last byte of the strip.
+ *
+ ****************************************************************************/
+
+static int tiff_lzwfinish(FAR struct tiff_info_s *info)
+{
+  FAR struct tiff_lzw_s *lzw = info->lzw;
+  uint8_t byte;
+  int ret = OK;
+
+  if (lzw->prefix >= 0)
+    {
+      ret = tiff_lzwput(info, lzw->prefix);
+      if (ret == OK)
+        {
+          ret = tiff_lzwadd(info);
+        }
+    }
+
+  if (ret == OK)
+    {
+      ret = tiff_lzwput(info, TIFF_LZW_EOI);
+    }
+
+  if (ret == OK && lzw->nbuffered > 0)
+    {
+      byte           = (uint8_t)(lzw->bits << (8 - lzw->nbuffered));
+      lzw->nbuffered = 0;
+      ret            = tiff_bufwrite(info, &byte, 1);
+    }
+
+  return ret;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: tiff_packbits
+ *
+ * Description:
+ *   PackBits encode one row into memory.
+ *
+ * Input Parameters:
+ *   dest   - The location to store the encoded row.  This must hold at least
+ *            TIFF_PACKBITS_MAXSIZE(nbytes) bytes.
+ *   src    - The row to be encoded
+ *   nbytes - The number of bytes in the row
+ *
+ * Returned Value:
+ *   The number of bytes stored in dest.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_TIFF_PACKBITS
+size_t tiff_packbits(FAR uint8_t *dest, FAR const uint8_t *src,
+                     size_t nbytes)
+{
+  FAR uint8_t *start = dest;
+  size_t len;
+
+  while (nbytes > 0)
+    {
+      len = tiff_packrun(src, nbytes, dest);
+      if (*dest++ >= 128)
+        {
+          *dest++ = src[0];
+        }
+      else
+        {
+          memcpy(dest, src, len);
+          dest += len;
+        }
+
+      src    += len;
+      nbytes -= len;
+    }
+
+  return dest - start;
+}
+#endif
+
+/****************************************************************************
+ * Name: tiff_compstrip
+ *
+ * Description:
+ *   Compress a strip into the outfile using the compression selected by
+ *   info->compression.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *   strip - A buffer containing a single strip of data
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  A negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int tiff_compstrip(FAR struct tiff_info_s *info, FAR const uint8_t *strip)
+{
+  FAR const uint8_t *row;
+  size_t rowbytes;
+  size_t srcbytes;
+  nxgl_coord_t nrows;
+  nxgl_coord_t i;
+  int ret = OK;
+
+  /* PackBits rows must be encoded separately.  Rows only start on byte
+   * boundaries if the strip divides into them evenly; otherwise the strip
+   * is treated as one long row.
+   */
+
+  nrows    = info->rps;
+  rowbytes = info->bps / nrows;
+  if (rowbytes * nrows != info->bps)
+    {
+      nrows    = 1;
+      rowbytes = info->bps;
+    }
+
+  srcbytes = rowbytes;
+  if (info->colorfmt == FB_FMT_RGB16_565)
+    {
+      srcbytes = 2 * info->imgwidth;
+    }
+
+#ifdef CONFIG_TIFF_LZW
+  if (info->compression == TAG_COMP_LZW)
+    {
+      /* Each strip starts with a clear code and an empty dictionary */
+
+      info->lzw->prefix    = -1;
+      info->lzw->bits      = 0;
+      info->lzw->nbuffered = 0;
+      info->lzw->nbits     = TIFF_LZW_MINBITS;
+
+      ret = tiff_lzwput(info, TIFF_LZW_CLEAR);
+      tiff_lzwclear(info->lzw);
+    }
+#endif
+
+  for (i = 0; i < nrows && ret == OK; i++, strip += srcbytes)
+    {
+      row = strip;
+      if (info->colorfmt == FB_FMT_RGB16_565)
+        {
+          tiff_rgb565row(info->rowbuf, (FAR const uint16_t *)strip,
+                         info->imgwidth);
+          row = info->rowbuf;
+        }
+
+#ifdef CONFIG_TIFF_LZW
+      if (info->compression == TAG_COMP_LZW)
+        {
+          ret = tiff_lzwencode(info, row, rowbytes);
+        }
+#endif
+#ifdef CONFIG_TIFF_PACKBITS
+      if (info->compression == TAG_COMP_PACKBITS)
+        {
+          ret = tiff_packrow(info, row, rowbytes);
+        }
+#endif
+    }
+
+#ifdef CONFIG_TIFF_LZW
+  if (info->compression == TAG_COMP_LZW && ret == OK)
+    {
+      ret = tiff_lzwfinish(info);
+    }
+#endif
+
+  return ret;
+}
+
+#endif /* CONFIG_TIFF_PACKBITS || CONFIG_TIFF_LZW */
@@ -39,6 +39,8 @@
 
 #include <nuttx/config.h>
 
+#include <stdlib.h>
+#include <stdbool.h>
 #include <unistd.h>
 #include <assert.h>
 #include <errno.h>
@@ -69,28 +71,27 @@
  ****************************************************************************/
 
 /****************************************************************************
- * Name: tiff_readifdentry
+ * Name: tiff_writeifdentry
  *
  * Description:
- *   Read the IFD entry at the specified offset.
+ *   Write the IFD entry at the specified offset.
  *
  * Input Parameters:
- *   fd       - File descriptor to rad from
- *   offset   - Offset to read from
- *   ifdentry - Location to read the data
+ *   fd       - File descriptor to write to
+ *   offset   - Offset to write to
+ *   ifdentry - The IFD entry to write
  *
  * Returned Value:
  *   Zero (OK) on success.  A negated errno value on failure.
  *
  ****************************************************************************/
 
-static int tiff_readifdentry(int fd, off_t offset,
-                             FAR struct tiff_ifdentry_s *ifdentry)
+static int tiff_writeifdentry(int fd, off_t offset,
+                              FAR struct tiff_ifdentry_s *ifdentry)
 {
   off_t newoffs;
-  ssize_t nbytes;
 
-  /* Seek to the read position */
+  /* Seek to the write position */
 
   newoffs = lseek(fd, offset, SEEK_SET);
   if (newoffs == (off_t)-1)
@@ -98,47 +99,69 @@ static int tiff_readifdentry(int fd, off_t offset,
       return -errno;
     }
 
-  /* Then read the IFD entry.  Anything returned by tiff_read other than the
-   * size of the IFD entry would be an error.
-   */
+  /* Then write the IFD entry */
 
-  nbytes = tiff_read(fd, ifdentry, SIZEOF_IFD_ENTRY);
-  return nbytes == SIZEOF_IFD_ENTRY ? OK : -ENOSPC;
+   return tiff_write(fd, ifdentry, SIZEOF_IFD_ENTRY);
 }
 
 /****************************************************************************
- * Name: tiff_writeifdentry
+ * Name: tiff_puttable
  *
  * Description:
- *   Write the IFD entry at the specified offset.
+ *   Write the StripByteCounts or StripOffsets table of a compressed image
+ *   from the strip sizes recorded as the strips were added.
  *
  * Input Parameters:
- *   fd       - File descriptor to rad from
- *   offset   - Offset to read from
- *   ifdentry - Location to read the data
+ *   info    - A pointer to the caller allocated parameter passing/TIFF
+ *             state instance.
+ *   offset  - Offset to the table in the outfile
+ *   offsets - True: Write the StripOffsets table, False: StripByteCounts
  *
  * Returned Value:
  *   Zero (OK) on success.  A negated errno value on failure.
  *
  ****************************************************************************/
 
-static int tiff_writeifdentry(int fd, off_t offset,
-                              FAR struct tiff_ifdentry_s *ifdentry)
+#if defined(CONFIG_TIFF_PACKBITS) || defined(CONFIG_TIFF_LZW)
+static int tiff_puttable(FAR struct tiff_info_s *info, off_t offset,
+                         bool offsets)
 {
+  uint32_t stripoffset = info->stripoffset;
+  size_t nbytes = 0;
   off_t newoffs;
+  int ret;
+  int i;
 
-  /* Seek to the write position */
-
-  newoffs = lseek(fd, offset, SEEK_SET);
+  newoffs = lseek(info->outfd, offset, SEEK_SET);
   if (newoffs == (off_t)-1)
     {
       return -errno;
     }
 
-  /* Then write the IFD entry */
+  /* The I/O buffer is idle after tiff_bufflush() */
 
-   return tiff_write(fd, ifdentry, SIZEOF_IFD_ENTRY);
+  for (i = 0; i < info->nstrips; i++)
+    {
+      tiff_put32(info->iobuffer + nbytes,
+                 offsets ? stripoffset : info->counts[i]);
+      stripoffset += (info->counts[i] + 3) & ~3;
+      nbytes      += 4;
+
+      if (nbytes + 4 > info->iosize || i + 1 == info->nstrips)
+        {
+          ret = tiff_write(info->outfd, info->iobuffer, nbytes);
+          if (ret < 0)
+            {
+              return ret;
+            }
+
+          nbytes = 0;
+        }
+    }
+
+  return OK;
 }
+#endif
 
 /****************************************************************************
  * Name: tiff_cleanup
@@ -157,7 +180,7 @@ static int tiff_writeifdentry(int fd, off_t offset,
 
 static void tiff_cleanup(FAR struct tiff_info_s *info)
 {
-  /* Close all opened files */
+  /* Close the output file */
 
   if (info->outfd >= 0)
     {
@@ -165,22 +188,15 @@ static void tiff_cleanup(FAR struct tiff_info_s *info)
     }
   info->outfd = -1;
 
-  if (info->tmp1fd >= 0)
-    {
-      (void)close(info->tmp1fd);
-    }
-  info->tmp1fd = -1;
+  /* Free the compression state */
 
-  if (info->tmp2fd >= 0)
-    {
-      (void)close(info->tmp2fd);
-    }
-  info->tmp2fd = -1;
+  free(info->counts);
+  free(info->rowbuf);
+  free(info->lzw);
 
-  /* And remove the temporary files */
-
-  (void)unlink(info->tmpfile1);
-  (void)unlink(info->tmpfile2);
+  info->counts = NULL;
+  info->rowbuf = NULL;
+  info->lzw    = NULL;
 }
 
 /****************************************************************************
@@ -204,205 +220,70 @@ static void tiff_cleanup(FAR struct tiff_info_s *info)
 
 int tiff_finalize(FAR struct tiff_info_s *info)
 {
-  struct tiff_ifdentry_s ifdentry;
-  FAR uint8_t *ptr;
-  size_t maxoffsets;
-#ifdef CONFIG_DEBUG_GRAPHICS
-  size_t total;
-#endif
-  off_t offset;
+  struct tiff_ifdentry_s soentry;
+  struct tiff_ifdentry_s sbcentry;
   int ret;
-  int i;
-  int j;
-
-  /* Put all of the pieces together to create the final output file.  There
-   * are three pieces:
-   *
-   * 1) outfile: The partial output file containing the header, IFD and strip
-   *    counts. This includes the StripOffsets and StripByteCounts that need
-   *    to be updated.  Size=outsize;
-   * 2) tmpfile1: This contains the offsets into tmpfile3 for each strip.  The
-   *    size of this file is tmp1size.  These offsets are relative to the
-   *    beginning of tmpfile3 and need to be offset by outsize+tmp1size.
-   * 3) tmpfile3: The strip data.  Size is tmp2size.  This is raw image data;
-   *    no fixups are required.
-   */
-
-  DEBUGASSERT(info && info->outfd >= 0 && info->tmp1fd >= 0 && info->tmp2fd >= 0);
-  DEBUGASSERT((info->outsize & 3) == 0 && (info->tmp1size & 3) == 0);
 
-  /* Fix-up the count value in the StripByteCounts IFD entry in the outfile.
-   * The actual number of strips was unknown at the time that the IFD entry
-   * was written.
+  /* The header, IFD, strip tables and strips were all written in file order
+   * as the file was created.  Only the buffered tail remains to be written.
    */
 
-  ret = tiff_readifdentry(info->outfd, info->filefmt->sbcifdoffset, &ifdentry);
-  if (ret < 0)
-    {
-      goto errout;
-    }
+  DEBUGASSERT(info && info->outfd >= 0);
 
-  tiff_put32(ifdentry.count, info->nstrips);
-
-  ret = tiff_writeifdentry(info->outfd, info->filefmt->sbcifdoffset, &ifdentry);
+  ret = tiff_bufflush(info);
   if (ret < 0)
     {
       goto errout;
     }
 
-  /* Fix-up the count and offset values in the StripOffsets IFD entry in the
-   * outfile.  The StripOffsets data will be stored immediately after the
-   * outfile, hence, the correct offset is outsize.
+#if defined(CONFIG_TIFF_PACKBITS) || defined(CONFIG_TIFF_LZW)
+  /* Fill in the strip tables of a compressed image.  A single strip has
+   * no tables; its size is held in the StripByteCounts IFD entry.
    */
 
-  ret = tiff_readifdentry(info->outfd, info->filefmt->soifdoffset, &ifdentry);
-  if (ret < 0)
+  if (info->counts != NULL && info->nstrips > 1)
     {
-      goto errout;
-    }
-
-  tiff_put32(ifdentry.count, info->nstrips);
-  tiff_put32(ifdentry.offset, info->outsize);
+      off_t sbcoffset = info->filefmt->sbcoffset;
 
-  ret = tiff_writeifdentry(info->outfd, info->filefmt->soifdoffset, &ifdentry);
-  if (ret < 0)
-    {
-      goto errout;
-    }
-
-  /* Rewind to the beginning of tmpfile1 */
-
-  offset = lseek(info->tmp1fd, 0, SEEK_SET);
-  if (offset == (off_t)-1)
-    {
-      ret = -errno;
-      goto errout;
-    }
-
-  /* Seek to the end of the outfile */
-
-  ret = lseek(info->outfd, 0, SEEK_END);
-  if (offset == (off_t)-1)
-    {
-      ret = -errno;
-      goto errout;
-    }
-
-  /* Now read strip offset data from tmpfile1, update the offsets, and write
-   * the updated offsets to the outfile.  The strip data will begin at offset
-   * outsize + tmp1size;
-   */
-
-  maxoffsets = info->iosize >> 2;
-#ifdef CONFIG_DEBUG_GRAPHICS
-  total      = 0;
-#endif
-
-  for (i = 0; i < info->nstrips; )
-    {
-      size_t noffsets;
-      ssize_t nbytes;
-
-      /* Read a group of up to 32-bit values */
-
-      noffsets = info->nstrips - i;
-      if (noffsets > maxoffsets)
-        {
-          noffsets = maxoffsets;
-        }
-
-      nbytes = tiff_read(info->tmp1fd, info->iobuffer, noffsets << 2);
-
-      /* If an error occurs or we fail to read exactly this number of
-       * bytes, then something bad happened.
-       */
-
-      if (nbytes != noffsets << 2)
+      ret = tiff_puttable(info, sbcoffset, false);
+      if (ret == OK)
         {
-          goto errout;
+          ret = tiff_puttable(info, sbcoffset + 4 * (off_t)info->maxstrips,
+                              true);
         }
 
-      /* Fix up the offsets */
-
-      for (j = 0, ptr = info->iobuffer;
-           j < noffsets;
-           j++, ptr += 4)
-        {
-          uint32_t stripoff = tiff_get32(ptr);
-          stripoff += (info->outsize + info->tmp1size);
-          tiff_put32(ptr, stripoff);
-        }
-
-      /* Then write the corrected offsets to the outfile */
-
-      ret = tiff_write(info->outfd, info->iobuffer, nbytes);
       if (ret < 0)
         {
           goto errout;
         }
-
-      /* Update the count of offsets written */
-
-      i     += noffsets;
-#ifdef CONFIG_DEBUG_GRAPHICS
-      total += nbytes;
-#endif
     }
-#ifdef CONFIG_DEBUG_GRAPHICS
-  ASSERT(total == info->tmp1size);
 #endif
 
-  /* Rewind to the beginning of tmpfile2 */
-
-  offset = lseek(info->tmp2fd, 0, SEEK_SET);
-  if (offset == (off_t)-1)
-    {
-      ret = -errno;
-      goto errout;
-    }
-
-  /* Finally, copy the tmpfile2 to the end of the outfile */
+  /* If fewer strips were added than the image height provides for, then
+   * fix-up the counts in the StripOffsets and StripByteCounts IFD entries.
+   * A single compressed strip also needs its actual size there.
+   */
 
-#ifdef CONFIG_DEBUG_GRAPHICS
-  total = 0;
-#endif
-  for (;;)
+  if (info->nstrips != info->maxstrips ||
+      (info->counts != NULL && info->nstrips == 1))
     {
-      ssize_t nbytes;
-
-      /* Read a block of data from tmpfile2 */
+      tiff_stripentries(info, info->nstrips, &soentry, &sbcentry);
 
-      nbytes = tiff_read(info->tmp2fd, info->iobuffer, info->iosize);
-
-      /* Check for tead errors and for end-of-file */
-
-      if (nbytes < 0)
-        {
-          ret = (int)nbytes;
-          goto errout;
-        }
-      else if (nbytes == 0)
+      ret = tiff_writeifdentry(info->outfd, info->filefmt->soifdoffset,
+                               &soentry);
+      if (ret == OK)
         {
-          break;
+          ret = tiff_writeifdentry(info->outfd, info->filefmt->sbcifdoffset,
+                                   &sbcentry);
         }
 
-      /* Then copy the data to the outfile */
-
-      ret = tiff_write(info->outfd, info->iobuffer, nbytes);
       if (ret < 0)
         {
           goto errout;
         }
-
-#ifdef CONFIG_DEBUG_GRAPHICS
-      total += nbytes;
-#endif
     }
-#ifdef CONFIG_DEBUG_GRAPHICS
-  ASSERT(total == info->tmp2size);
-#endif
 
-  /* Close all files and return success */
+  /* Close the file and return success */
 
   tiff_cleanup(info);
   return OK;
@@ -428,8 +309,9 @@ errout:
 
 void tiff_abort(FAR struct tiff_info_s *info)
 {
-  /* Perform normal cleanup */
+  /* Wait for any writes from the I/O buffer and perform normal cleanup */
 
+  tiff_bufcancel(info);
   tiff_cleanup(info);
 
   /* But then delete the output file as well */
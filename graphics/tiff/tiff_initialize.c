@@ -39,6 +39,7 @@
 
 #include <nuttx/config.h>
 
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
@@ -65,11 +66,11 @@
  *           12    NewSubfileType
  *           24    ImageWidth                  Number of columns is a user parameter
  *           36    ImageLength                 Number of rows is a user parameter
- *           48    Compression                 Hard-coded no compression (for now)
+ *           48    Compression                 Value is a user parameter
  *           60    PhotometricInterpretation   Value is a user parameter
- *           72    StripOffsets                Offset and count determined as strips added
+ *           72    StripOffsets                Count from ImageLength and RowsPerStrip
  *           84    RowsPerStrip                Value is a user parameter
- *           96    StripByteCounts             Offset and count determined as strips added
+ *           96    StripByteCounts             Count from ImageLength and RowsPerStrip
  *          108    XResolution                 Value is a user parameter
  *          120    YResolution                 Value is a user parameter
  *          132    Resolution Unit             Hard-coded to "inches"
@@ -118,11 +119,11 @@
  *           24    ImageWidth                  Number of columns is a user parameter
  *           36    ImageLength                 Number of rows is a user parameter
  *           48    BitsPerSample
- *           60    Compression                 Hard-coded no compression (for now)
+ *           60    Compression                 Value is a user parameter
  *           72    PhotometricInterpretation   Value is a user parameter
- *           84    StripOffsets                Offset and count determined as strips added
+ *           84    StripOffsets                Count from ImageLength and RowsPerStrip
  *           96    RowsPerStrip                Value is a user parameter
- *          108    StripByteCounts             Offset and count determined as strips added
+ *          108    StripByteCounts             Count from ImageLength and RowsPerStrip
  *          120    XResolution                 Value is a user parameter
  *          132    YResolution                 Value is a user parameter
  *          144    Resolution Unit             Hard-coded to "inches"
@@ -164,12 +165,12 @@
  *           24    ImageWidth                  Number of columns is a user parameter
  *           36    ImageLength                 Number of rows is a user parameter
  *           48    BitsPerSample               8, 8, 8
- *           60    Compression                 Hard-coded no compression (for now)
+ *           60    Compression                 Value is a user parameter
  *           72    PhotometricInterpretation   Value is a user parameter
- *           84    StripOffsets                Offset and count determined as strips added
+ *           84    StripOffsets                Count from ImageLength and RowsPerStrip
  *           96    SamplesPerPixel             Hard-coded to 3
  *          108    RowsPerStrip                Value is a user parameter
- *          120    StripByteCounts             Offset and count determined as strips added
+ *          120    StripByteCounts             Count from ImageLength and RowsPerStrip
  *          132    XResolution                 Value is a user parameter
  *          144    YResolution                 Value is a user parameter
  *          156    Resolution Unit              Hard-coded to "inches"
@@ -315,7 +316,7 @@ static inline int tiff_putheader(FAR struct tiff_info_s *info)
 
   /* Write the header to the output file */
 
-  ret = tiff_write(info->outfd, &hdr, SIZEOF_TIFF_HEADER);
+  ret = tiff_bufwrite(info, &hdr, SIZEOF_TIFF_HEADER);
   if (ret != OK)
     {
       return ret;
@@ -323,7 +324,7 @@ static inline int tiff_putheader(FAR struct tiff_info_s *info)
 
   /* Two pad bytes following the header */
 
-  ret = tiff_putint16(info->outfd, 0);
+  ret = tiff_putint16(info, 0);
   return ret;
 }
 
@@ -354,7 +355,7 @@ static int tiff_putifdentry(FAR struct tiff_info_s *info, uint16_t tag,
   tiff_put16(ifd.type, type);
   tiff_put32(ifd.count, count);
   tiff_put32(ifd.offset, offset);
-  return tiff_write(info->outfd, &ifd, SIZEOF_IFD_ENTRY);
+  return tiff_bufwrite(info, &ifd, SIZEOF_IFD_ENTRY);
 }
 
 /****************************************************************************
@@ -449,39 +450,40 @@ static int tiff_datetime(FAR char *timbuf, unsigned int buflen)
 
 int tiff_initialize(FAR struct tiff_info_s *info)
 {
+  struct tiff_ifdentry_s soentry;
+  struct tiff_ifdentry_s sbcentry;
   uint16_t val16;
+  int i;
 #ifdef CONFIG_DEBUG_TIFFOFFSETS
   off_t offset = 0;
 #endif
   char timbuf[TIFF_DATETIME_STRLEN + 8];
   int ret = -EINVAL;
 
-  DEBUGASSERT(info && info->outfile && info->tmpfile1 && info->tmpfile2);
+  DEBUGASSERT(info && info->outfile);
 
-  /* Open all output files */
-
-  info->outfd = open(info->outfile, O_RDWR|O_CREAT|O_TRUNC, 0666);
-  if (info->outfd < 0)
+  if (info->rps <= 0 || info->imgheight <= 0)
     {
-      gerr("ERROR: Failed to open %s for reading/writing: %d\n",
-           info->outfile, errno);
-      goto errout;
+      gerr("ERROR: Invalid image size: rps=%d imgheight=%d\n",
+           info->rps, info->imgheight);
+      return -EINVAL;
     }
 
-  info->tmp1fd = open(info->tmpfile1, O_RDWR|O_CREAT|O_TRUNC, 0666);
-  if (info->tmp1fd < 0)
+  ret = tiff_bufinitialize(info);
+  if (ret < 0)
     {
-      gerr("ERROR: Failed to open %s for reading/writing: %d\n",
-           info->tmpfile1, errno);
-      goto errout;
+      return ret;
     }
 
-  info->tmp2fd = open(info->tmpfile2, O_RDWR|O_CREAT|O_TRUNC, 0666);
-  if (info->tmp2fd < 0)
+  /* Open the output file */
+
+  info->outfd = open(info->outfile, O_WRONLY|O_CREAT|O_TRUNC, 0666);
+  if (info->outfd < 0)
     {
-      gerr("ERROR: Failed to open %s for reading/writing: %d\n",
-           info->tmpfile2, errno);
-      goto errout;
+      ret = -errno;
+      gerr("ERROR: Failed to open %s for writing: %d\n",
+           info->outfile, -ret);
+      return ret;
     }
 
   /* Make some decisions using the color format.  Only the following are
@@ -523,9 +525,90 @@ int tiff_initialize(FAR struct tiff_info_s *info)
 
       default:
         gerr("ERROR: Unsupported color format: %d\n", info->colorfmt);
-        return -EINVAL;
+        ret = -EINVAL;
+        goto errout;
+    }
+
+  /* The number of strips is determined by the image size, so the complete
+   * file layout is known now:  The StripByteCounts and StripOffsets tables
+   * follow the value section and the word-aligned strips follow the
+   * tables.  A single strip needs no tables; its offset and size are held
+   * in the IFD entries themselves.
+   */
+
+  info->nstrips     = 0;
+  info->maxstrips   = (info->imgheight + info->rps - 1) / info->rps;
+  info->stripoffset = info->filefmt->sbcoffset;
+
+  if (info->maxstrips > 1)
+    {
+      info->stripoffset += 8 * (off_t)info->maxstrips;
     }
 
+  /* Validate the compression.  Compressed strip sizes are only known as
+   * the strips are added; they are saved for tiff_finalize() which then
+   * fills in the strip tables.
+   */
+
+  info->counts = NULL;
+  info->rowbuf = NULL;
+  info->lzw    = NULL;
+
+  if (info->compression == 0)
+    {
+      info->compression = TAG_COMP_NONE;
+    }
+
+  switch (info->compression)
+    {
+      case TAG_COMP_NONE:
+        break;
+
+#ifdef CONFIG_TIFF_LZW
+      case TAG_COMP_LZW:
+        info->lzw = (FAR struct tiff_lzw_s *)malloc(sizeof(struct tiff_lzw_s));
+        if (info->lzw == NULL)
+          {
+            ret = -ENOMEM;
+            goto errout;
+          }
+
+        /* Fall through */
+
+#endif
+#ifdef CONFIG_TIFF_PACKBITS
+      case TAG_COMP_PACKBITS:
+#endif
+#if defined(CONFIG_TIFF_PACKBITS) || defined(CONFIG_TIFF_LZW)
+        info->counts = (FAR uint32_t *)malloc(4 * (size_t)info->maxstrips);
+        if (info->counts == NULL)
+          {
+            ret = -ENOMEM;
+            goto errout;
+          }
+
+        /* RGB565 rows are converted to RGB888 before they are compressed */
+
+        if (info->colorfmt == FB_FMT_RGB16_565)
+          {
+            info->rowbuf = (FAR uint8_t *)malloc(3 * (size_t)info->imgwidth);
+            if (info->rowbuf == NULL)
+              {
+                ret = -ENOMEM;
+                goto errout;
+              }
+          }
+        break;
+#endif
+
+      default:
+        gerr("ERROR: Unsupported compression: %u\n", info->compression);
+        ret = -ENOSYS;
+        goto errout;
+    }
+
+  tiff_stripentries(info, info->maxstrips, &soentry, &sbcentry);
+
   /* Write the TIFF header data to the outfile:
    *
    * Header:    0    Byte Order                  "II" or "MM"
@@ -546,7 +629,7 @@ int tiff_initialize(FAR struct tiff_info_s *info)
    * All formats: Offset 10 Number of Directory Entries 12
    */
 
-  ret = tiff_putint16(info->outfd, info->filefmt->nifdentries);
+  ret = tiff_putint16(info, info->filefmt->nifdentries);
   if (ret < 0)
     {
       goto errout;
@@ -621,12 +704,12 @@ int tiff_initialize(FAR struct tiff_info_s *info)
 
   /* Write Compression:
    *
-   * Bi-level Images: Offset 48 Hard-coded no compression (for now)
-   * Greyscale:       Offset 60  "  " "   " "" "          " " " " "
-   * RGB:             Offset 60 "  " "   " "" "          " " " " "
+   * Bi-level Images: Offset 48 Value is a user parameter
+   * Greyscale:       Offset 60 Value is a user parameter
+   * RGB:             Offset 60 Value is a user parameter
    */
 
-  ret = tiff_putifdentry16(info, IFD_TAG_COMPRESSION, IFD_FIELD_SHORT, 1, TAG_COMP_NONE);
+  ret = tiff_putifdentry16(info, IFD_TAG_COMPRESSION, IFD_FIELD_SHORT, 1, info->compression);
   if (ret < 0)
     {
       goto errout;
@@ -658,13 +741,13 @@ int tiff_initialize(FAR struct tiff_info_s *info)
 
   /* Write StripOffsets:
    *
-   * Bi-level Images: Offset 72 Value determined by switch statement above
-   * Greyscale:       Offset 84 Value determined by switch statement above
-   * RGB:             Offset 84 Value determined by switch statement above
+   * Bi-level Images: Offset 72 Value determined by tiff_stripentries() above
+   * Greyscale:       Offset 84 Value determined by tiff_stripentries() above
+   * RGB:             Offset 84 Value determined by tiff_stripentries() above
    */
 
   tiff_checkoffs(offset, info->filefmt->soifdoffset);
-  ret = tiff_putifdentry(info, IFD_TAG_STRIPOFFSETS, IFD_FIELD_LONG, 0, 0);
+  ret = tiff_bufwrite(info, &soentry, SIZEOF_IFD_ENTRY);
   if (ret < 0)
     {
       goto errout;
@@ -704,13 +787,13 @@ int tiff_initialize(FAR struct tiff_info_s *info)
 
   /* Write StripByteCounts:
    *
-   * Bi-level Images: Offset  96 Count determined as strips added, Value offset = 216
-   * Greyscale:       Offset 108 Count determined as strips added, Value offset = 228
-   * RGB:             Offset 120 Count determined as strips added, Value offset = 248
+   * Bi-level Images: Offset  96 Count = maxstrips, Value offset = 216
+   * Greyscale:       Offset 108 Count = maxstrips, Value offset = 228
+   * RGB:             Offset 120 Count = maxstrips, Value offset = 248
    */
 
   tiff_checkoffs(offset, info->filefmt->sbcifdoffset);
-  ret = tiff_putifdentry(info, IFD_TAG_STRIPCOUNTS, IFD_FIELD_LONG, 0, info->filefmt->sbcoffset);
+  ret = tiff_bufwrite(info, &sbcentry, SIZEOF_IFD_ENTRY);
   if (ret < 0)
     {
       goto errout;
@@ -788,7 +871,7 @@ int tiff_initialize(FAR struct tiff_info_s *info)
    *                  Offset 194, [2 bytes padding]
    */
 
-  ret = tiff_putint32(info->outfd, 0);
+  ret = tiff_putint32(info, 0);
   if (ret < 0)
     {
       goto errout;
@@ -810,10 +893,10 @@ int tiff_initialize(FAR struct tiff_info_s *info)
    */
 
   tiff_checkoffs(offset, info->filefmt->xresoffset);
-  ret = tiff_putint32(info->outfd, 300);
+  ret = tiff_putint32(info, 300);
   if (ret == OK)
     {
-      ret = tiff_putint32(info->outfd, 1);
+      ret = tiff_putint32(info, 1);
     }
 
   if (ret < 0)
@@ -823,10 +906,10 @@ int tiff_initialize(FAR struct tiff_info_s *info)
   tiff_offset(offset, 8);
 
   tiff_checkoffs(offset, info->filefmt->yresoffset);
-  ret = tiff_putint32(info->outfd, 300);
+  ret = tiff_putint32(info, 300);
   if (ret == OK)
     {
-      ret = tiff_putint32(info->outfd, 1);
+      ret = tiff_putint32(info, 1);
     }
 
   if (ret < 0)
@@ -846,10 +929,10 @@ int tiff_initialize(FAR struct tiff_info_s *info)
   if (IMGFLAGS_ISRGB(info->imgflags))
     {
       tiff_checkoffs(offset, TIFF_RGB_BPSOFFSET);
-      tiff_putint16(info->outfd, 8);
-      tiff_putint16(info->outfd, 8);
-      tiff_putint16(info->outfd, 8);
-      tiff_putint16(info->outfd, 0);
+      tiff_putint16(info, 8);
+      tiff_putint16(info, 8);
+      tiff_putint16(info, 8);
+      tiff_putint16(info, 0);
       tiff_offset(offset, 8);
     }
 
@@ -862,7 +945,7 @@ int tiff_initialize(FAR struct tiff_info_s *info)
    */
 
   tiff_checkoffs(offset, info->filefmt->swoffset);
-  ret = tiff_putstring(info->outfd, TIFF_SOFTWARE_STRING, TIFF_SOFTWARE_STRLEN);
+  ret = tiff_putstring(info, TIFF_SOFTWARE_STRING, TIFF_SOFTWARE_STRLEN);
   if (ret < 0)
     {
       goto errout;
@@ -884,7 +967,7 @@ int tiff_initialize(FAR struct tiff_info_s *info)
       goto errout;
     }
 
-  ret = tiff_putstring(info->outfd, timbuf, TIFF_DATETIME_STRLEN);
+  ret = tiff_putstring(info, timbuf, TIFF_DATETIME_STRLEN);
   if (ret < 0)
     {
       goto errout;
@@ -893,17 +976,42 @@ int tiff_initialize(FAR struct tiff_info_s *info)
 
   /* Add two bytes of padding */
 
-  ret = tiff_putint16(info->outfd, 0);
+  ret = tiff_putint16(info, 0);
   if (ret < 0)
     {
       goto errout;
     }
   tiff_offset(offset, 2);
 
-  /* And that should do it! */
+  /* Write the StripByteCounts and StripOffsets tables.  Every strip has
+   * the same size and occupies a word-aligned slot following the tables.
+   * For compressed strips, these only reserve the space that
+   * tiff_finalize() fills in.
+   */
 
   tiff_checkoffs(offset, info->filefmt->sbcoffset);
-  info->outsize = info->filefmt->sbcoffset;
+  if (info->maxstrips > 1)
+    {
+      for (i = 0; i < info->maxstrips && ret == OK; i++)
+        {
+          ret = tiff_putint32(info, info->bps);
+        }
+
+      for (i = 0; i < info->maxstrips && ret == OK; i++)
+        {
+          ret = tiff_putint32(info, info->stripoffset +
+                              (off_t)i * ((info->bps + 3) & ~3));
+        }
+
+      if (ret < 0)
+        {
+          goto errout;
+        }
+    }
+
+  /* And that should do it!  The strip data follows. */
+
+  DEBUGASSERT(info->outsize == info->stripoffset);
   return OK;
 
 errout:
@@ -76,10 +76,45 @@
 #define IMGFLAGS_ISRGB(f) \
   (((f) & IMGFLAGS_FMT_RGB24) != 0)
 
+/* Buffered Output **********************************************************/
+/* Each I/O buffer half is rounded down to a multiple of TIFF_BLOCKSIZE (or
+ * of a word if it is smaller) so that every write but the last begins on a
+ * block boundary of the outfile.
+ */
+
+#define TIFF_BLOCKSIZE         512
+
+/* LZW Compression **********************************************************/
+
+#define TIFF_LZW_CLEAR         256  /* Reset the dictionary */
+#define TIFF_LZW_EOI           257  /* End of the strip */
+#define TIFF_LZW_FIRST         258  /* First dictionary code */
+#define TIFF_LZW_FULL          4094 /* Dictionary full, must be cleared */
+#define TIFF_LZW_NCODES        4096
+#define TIFF_LZW_MINBITS       9
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
 
+/* LZW dictionary.  Each code is the string of its prefix code extended by
+ * one suffix byte.  The codes sharing a prefix are linked from the prefix
+ * code's child through their sibling fields; zero ends the list since no
+ * dictionary code can be below TIFF_LZW_FIRST.
+ */
+
+struct tiff_lzw_s
+{
+  uint16_t child[TIFF_LZW_NCODES];   /* First code extending this code */
+  uint16_t sibling[TIFF_LZW_NCODES]; /* Next code with the same prefix */
+  uint8_t  suffix[TIFF_LZW_NCODES];  /* Last byte of the code's string */
+  uint32_t bits;                     /* Output bits not yet written */
+  uint8_t  nbuffered;                /* Number of valid bits in bits */
+  uint8_t  nbits;                    /* Current code width */
+  uint16_t nextcode;                 /* Next code to be assigned */
+  int16_t  prefix;                   /* Code of the pending string or -1 */
+};
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -98,32 +133,88 @@ extern "C"
  ****************************************************************************/
 
 /****************************************************************************
- * Name: tiff_read
+ * Name: tiff_write
  *
  * Description:
- *   Read TIFF data from the specified file
+ *   Write TIFF data to the specified file
  *
  * Input Parameters:
- *   fd - Open file descriptor to read from
+ *   fd - Open file descriptor to write to
  *   buffer - Read-only buffer containing the data to be written
  *   count - The number of bytes to write
  *
  * Returned Value:
- *   On success, then number of bytes read; Zero is returned on EOF.
- *   Otherwise, a negated errno value on failure.
+ *   Zero (OK) on success.  A negated errno value on failure.
  *
  ****************************************************************************/
 
-ssize_t tiff_read(int fd, FAR void *buffer, size_t count);
+int tiff_write(int fd, FAR const void *buffer, size_t count);
 
 /****************************************************************************
- * Name: tiff_write
+ * Name: tiff_bufinitialize
  *
  * Description:
- *   Write TIFF data to the specified file
+ *   Prepare the caller's I/O buffer for buffered output to the outfile.
  *
  * Input Parameters:
- *   fd - Open file descriptor to write to
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  A negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int tiff_bufinitialize(FAR struct tiff_info_s *info);
+
+/****************************************************************************
+ * Name: tiff_bufspace
+ *
+ * Description:
+ *   Return the free space in the I/O buffer half currently being filled.
+ *   Data placed there is accounted for by tiff_bufcommit().
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *   avail - Location to return the number of free bytes (always non-zero)
+ *
+ * Returned Value:
+ *   A pointer to the free space in the I/O buffer.
+ *
+ ****************************************************************************/
+
+FAR uint8_t *tiff_bufspace(FAR struct tiff_info_s *info, FAR size_t *avail);
+
+/****************************************************************************
+ * Name: tiff_bufcommit
+ *
+ * Description:
+ *   Account for data placed in the I/O buffer after tiff_bufspace().  A
+ *   full half is queued for writing and filling continues in the other
+ *   half.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *   nbytes - The number of bytes added to the I/O buffer
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  A negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int tiff_bufcommit(FAR struct tiff_info_s *info, size_t nbytes);
+
+/****************************************************************************
+ * Name: tiff_bufwrite
+ *
+ * Description:
+ *   Copy data into the I/O buffer, writing full halves to the outfile.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
  *   buffer - Read-only buffer containing the data to be written
  *   count - The number of bytes to write
  *
@@ -132,7 +223,90 @@ ssize_t tiff_read(int fd, FAR void *buffer, size_t count);
  *
  ****************************************************************************/
 
-int tiff_write(int fd, FAR const void *buffer, size_t count);
+int tiff_bufwrite(FAR struct tiff_info_s *info, FAR const void *buffer,
+                  size_t count);
+
+/****************************************************************************
+ * Name: tiff_bufflush
+ *
+ * Description:
+ *   Write any buffered data to the outfile and wait for all outstanding
+ *   writes to complete.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  A negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int tiff_bufflush(FAR struct tiff_info_s *info);
+
+/****************************************************************************
+ * Name: tiff_bufcancel
+ *
+ * Description:
+ *   Wait for any outstanding writes so that the I/O buffer and the outfile
+ *   may be released.  Buffered data is discarded and errors are ignored.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void tiff_bufcancel(FAR struct tiff_info_s *info);
+
+/****************************************************************************
+ * Name: tiff_stripentries
+ *
+ * Description:
+ *   Build the StripOffsets and StripByteCounts IFD entries for the given
+ *   number of strips.  A single strip's values are stored in the entries
+ *   themselves; otherwise the entries refer to the strip tables that
+ *   follow the value section.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *   nstrips - The number of strips to describe
+ *   soentry - Location to build the StripOffsets entry
+ *   sbcentry - Location to build the StripByteCounts entry
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void tiff_stripentries(FAR struct tiff_info_s *info, nxgl_coord_t nstrips,
+                       FAR struct tiff_ifdentry_s *soentry,
+                       FAR struct tiff_ifdentry_s *sbcentry);
+
+/****************************************************************************
+ * Name: tiff_compstrip
+ *
+ * Description:
+ *   Compress a strip into the outfile using the compression selected by
+ *   info->compression.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *   strip - A buffer containing a single strip of data
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  A negated errno value on failure.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_TIFF_PACKBITS) || defined(CONFIG_TIFF_LZW)
+int tiff_compstrip(FAR struct tiff_info_s *info, FAR const uint8_t *strip);
+#endif
 
 /****************************************************************************
  * Name: tiff_putint16
@@ -141,7 +315,8 @@ int tiff_write(int fd, FAR const void *buffer, size_t count);
  *   Write two bytes to the outfile.
  *
  * Input Parameters:
- *   fd - File descriptor to be used.
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
  *   value - The 2-byte, uint16_t value to write
  *
  * Returned Value:
@@ -149,7 +324,7 @@ int tiff_write(int fd, FAR const void *buffer, size_t count);
  *
  ****************************************************************************/
 
-int tiff_putint16(int fd, uint16_t value);
+int tiff_putint16(FAR struct tiff_info_s *info, uint16_t value);
 
 /****************************************************************************
  * Name: tiff_putint32
@@ -158,7 +333,8 @@ int tiff_putint16(int fd, uint16_t value);
  *   Write four bytes to the outfile.
  *
  * Input Parameters:
- *   fd - File descriptor to be used.
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
  *   value - The 4-byte, uint32_t value to write
  *
  * Returned Value:
@@ -166,7 +342,7 @@ int tiff_putint16(int fd, uint16_t value);
  *
  ****************************************************************************/
 
-int tiff_putint32(int fd, uint32_t value);
+int tiff_putint32(FAR struct tiff_info_s *info, uint32_t value);
 
 /****************************************************************************
  * Name: tiff_putstring
@@ -175,7 +351,8 @@ int tiff_putint32(int fd, uint32_t value);
  *  Write a string of fixed length to the outfile.
  *
  * Input Parameters:
- *   fd - File descriptor to be used.
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
  *   string - A pointer to the memory containing the string
  *   len - The length of the string (including the NUL terminator)
  *
@@ -184,24 +361,25 @@ int tiff_putint32(int fd, uint32_t value);
  *
  ****************************************************************************/
 
-int tiff_putstring(int fd, FAR const char *string, int len);
+int tiff_putstring(FAR struct tiff_info_s *info, FAR const char *string,
+                   int len);
 
 /****************************************************************************
  * Name: tiff_wordalign
  *
  * Description:
- *  Pad a file with zeros as necessary to achieve word alignament.
+ *  Pad the outfile with zeros as necessary to achieve word alignament.
  *
  * Input Parameters:
- *   fd - File descriptor to be used.
- *   size - The current size of the file
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
  *
  * Returned Value:
- *   The new size of the file on success.  A negated errno value on failure.
+ *   Zero (OK) on success.  A negated errno value on failure.
  *
  ****************************************************************************/
 
-ssize_t tiff_wordalign(int fd, size_t size);
+int tiff_wordalign(FAR struct tiff_info_s *info);
 
 #undef EXTERN
 #if defined(__cplusplus)
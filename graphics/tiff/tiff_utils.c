@@ -41,6 +41,7 @@
 
 #include <string.h>
 #include <unistd.h>
+#include <signal.h>
 #include <assert.h>
 #include <errno.h>
 #include <debug.h>
@@ -69,6 +70,120 @@
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: tiff_bufwait
+ *
+ * Description:
+ *   Wait for the asynchronous write from one I/O buffer half to complete.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *   ndx  - The index of the I/O buffer half
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  A negated errno value on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_TIFF_AIO
+static int tiff_bufwait(FAR struct tiff_info_s *info, int ndx)
+{
+  FAR struct aiocb *aiocbp = &info->aiocb[ndx];
+  FAR const struct aiocb *list[1];
+  ssize_t nbytes;
+  int ret;
+
+  /* A NULL buffer pointer means that there is no write in progress */
+
+  if (aiocbp->aio_buf == NULL)
+    {
+      return OK;
+    }
+
+  list[0] = aiocbp;
+  while ((ret = aio_error(aiocbp)) == EINPROGRESS)
+    {
+      (void)aio_suspend(list, 1, NULL);
+    }
+
+  nbytes = aio_return(aiocbp);
+  aiocbp->aio_buf = NULL;
+
+  if (ret < 0)
+    {
+      return -errno;
+    }
+  else if (ret > 0)
+    {
+      return -ret;
+    }
+
+  return nbytes == aiocbp->aio_nbytes ? OK : -ENOSPC;
+}
+#endif
+
+/****************************************************************************
+ * Name: tiff_bufsubmit
+ *
+ * Description:
+ *   Write the contents of the current I/O buffer half to the outfile.  With
+ *   CONFIG_TIFF_AIO, the write is only started and filling then continues
+ *   in the other half once its previous write has completed.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  A negated errno value on failure.
+ *
+ ****************************************************************************/
+
+static int tiff_bufsubmit(FAR struct tiff_info_s *info)
+{
+  FAR uint8_t *half = info->iobuffer + info->bufndx * info->bufsize;
+#ifdef CONFIG_TIFF_AIO
+  FAR struct aiocb *aiocbp;
+#endif
+  size_t nbytes = info->buflen;
+  int ret;
+
+  if (nbytes == 0)
+    {
+      return OK;
+    }
+
+  info->buflen = 0;
+
+#ifdef CONFIG_TIFF_AIO
+  aiocbp = &info->aiocb[info->bufndx];
+  memset(aiocbp, 0, sizeof(struct aiocb));
+
+  aiocbp->aio_fildes                = info->outfd;
+  aiocbp->aio_buf                   = half;
+  aiocbp->aio_nbytes                = nbytes;
+  aiocbp->aio_offset                = info->outsize - nbytes;
+  aiocbp->aio_sigevent.sigev_notify = SIGEV_NONE;
+
+  ret = aio_write(aiocbp);
+  if (ret < 0)
+    {
+      ret = -errno;
+      aiocbp->aio_buf = NULL;
+      return ret;
+    }
+
+  /* Continue in the other half as soon as it is free again */
+
+  info->bufndx ^= 1;
+  return tiff_bufwait(info, info->bufndx);
+#else
+  ret = tiff_write(info->outfd, half, nbytes);
+  return ret;
+#endif
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -133,25 +248,23 @@ uint32_t tiff_get32(FAR uint8_t *src)
 }
 
 /****************************************************************************
- * Name: tiff_read
+ * Name: tiff_write
  *
  * Description:
- *   Read TIFF data from the specified file
+ *   Write TIFF data to the specified file
  *
  * Input Parameters:
- *   fd - Open file descriptor to read from
+ *   fd - Open file descriptor to write to
  *   buffer - Read-only buffer containing the data to be written
  *   count - The number of bytes to write
  *
  * Returned Value:
- *   On success, then number of bytes read; Zero is returned on EOF.
- *   Otherwise, a negated errno value on failure.
+ *   Zero (OK) on success.  A negated errno value on failure.
  *
  ****************************************************************************/
 
-ssize_t tiff_read(int fd, FAR void *buffer, size_t count)
+int tiff_write(int fd, FAR const void *buffer, size_t count)
 {
-  size_t  ntotal;
   ssize_t nbytes;
   int errval;
 
@@ -159,14 +272,11 @@ ssize_t tiff_read(int fd, FAR void *buffer, size_t count)
    * or (2) until an irrecoverble error occurs.
    */
 
-  for (ntotal = 0; ntotal < count; )
+  while (count > 0)
     {
-      /* Do the read.  The number of bytes left to read is the total
-       * requested size (count) minus the amount that we have alread read
-       * (ntotal).
-       */
+      /* Do the write */
 
-      nbytes = read(fd, buffer, count-ntotal);
+      nbytes = write(fd, buffer, count);
 
       /* Check for an error */
 
@@ -185,89 +295,274 @@ ssize_t tiff_read(int fd, FAR void *buffer, size_t count)
             }
         }
 
-      /* Zero is a special case and means that the end of file was encountered. */
-
-      else if (nbytes == 0)
-        {
-          break;
-        }
-
-      /* What if read returns some number of bytes other than the requested number?
-       * This probably means that the end-of-file will be encountered the next time
-       * that we call read().
-       */
+      /* What if write returns some number of bytes other than the requested number? */
 
       else
         {
+          DEBUGASSERT(nbytes == count);
           buffer += nbytes;
-          ntotal += nbytes;
+          count  -= nbytes;
         }
     }
 
-  return ntotal;
+  return OK;
 }
 
 /****************************************************************************
- * Name: tiff_write
+ * Name: tiff_bufinitialize
  *
  * Description:
- *   Write TIFF data to the specified file
+ *   Prepare the caller's I/O buffer for buffered output to the outfile.
  *
  * Input Parameters:
- *   fd - Open file descriptor to write to
- *   buffer - Read-only buffer containing the data to be written
- *   count - The number of bytes to write
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
  *
  * Returned Value:
  *   Zero (OK) on success.  A negated errno value on failure.
  *
  ****************************************************************************/
 
-int tiff_write(int fd, FAR const void *buffer, size_t count)
+int tiff_bufinitialize(FAR struct tiff_info_s *info)
 {
-  ssize_t nbytes;
-  int errval;
+  size_t bufsize = info->iosize;
 
-  /* This loop retries the write until either: (1) it completes successfully,
-   * or (2) until an irrecoverble error occurs.
-   */
+#ifdef CONFIG_TIFF_AIO
+  /* Two halves:  One is written while the other is filled */
 
-  while (count > 0)
+  bufsize >>= 1;
+  info->aiocb[0].aio_buf = NULL;
+  info->aiocb[1].aio_buf = NULL;
+#endif
+
+  if (bufsize >= TIFF_BLOCKSIZE)
     {
-      /* Do the write */
+      bufsize &= ~(TIFF_BLOCKSIZE - 1);
+    }
+  else
+    {
+      bufsize &= ~3;
+    }
 
-      nbytes = write(fd, buffer, count);
+  if (info->iobuffer == NULL || bufsize == 0)
+    {
+      gerr("ERROR: I/O buffer too small: %u\n", info->iosize);
+      return -EINVAL;
+    }
 
-      /* Check for an error */
+  info->bufsize = bufsize;
+  info->buflen  = 0;
+  info->bufndx  = 0;
+  info->outsize = 0;
+  return OK;
+}
 
-      if (nbytes < 0)
-        {
-          /* EINTR is not an error.. this just means that the write was
-           * interrupted by a signal.
-           */
+/****************************************************************************
+ * Name: tiff_bufspace
+ *
+ * Description:
+ *   Return the free space in the I/O buffer half currently being filled.
+ *   Data placed there is accounted for by tiff_bufcommit().
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *   avail - Location to return the number of free bytes (always non-zero)
+ *
+ * Returned Value:
+ *   A pointer to the free space in the I/O buffer.
+ *
+ ****************************************************************************/
 
-          errval = errno;
-          if (errval != EINTR)
-            {
-              /* Other errors are bad news and we will break out with an error */
+FAR uint8_t *tiff_bufspace(FAR struct tiff_info_s *info, FAR size_t *avail)
+{
+  DEBUGASSERT(info->buflen < info->bufsize);
 
-              return -errval;
-            }
+  *avail = info->bufsize - info->buflen;
+  return info->iobuffer + info->bufndx * info->bufsize + info->buflen;
+}
+
+/****************************************************************************
+ * Name: tiff_bufcommit
+ *
+ * Description:
+ *   Account for data placed in the I/O buffer after tiff_bufspace().  A
+ *   full half is queued for writing and filling continues in the other
+ *   half.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *   nbytes - The number of bytes added to the I/O buffer
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  A negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int tiff_bufcommit(FAR struct tiff_info_s *info, size_t nbytes)
+{
+  DEBUGASSERT(info->buflen + nbytes <= info->bufsize);
+
+  info->buflen  += nbytes;
+  info->outsize += nbytes;
+
+  if (info->buflen >= info->bufsize)
+    {
+      return tiff_bufsubmit(info);
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: tiff_bufwrite
+ *
+ * Description:
+ *   Copy data into the I/O buffer, writing full halves to the outfile.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *   buffer - Read-only buffer containing the data to be written
+ *   count - The number of bytes to write
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  A negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int tiff_bufwrite(FAR struct tiff_info_s *info, FAR const void *buffer,
+                  size_t count)
+{
+  FAR const uint8_t *src = (FAR const uint8_t *)buffer;
+  FAR uint8_t *dest;
+  size_t avail;
+  int ret;
+
+  while (count > 0)
+    {
+      dest = tiff_bufspace(info, &avail);
+      if (avail > count)
+        {
+          avail = count;
         }
 
-      /* What if write returns some number of bytes other than the requested number? */
+      memcpy(dest, src, avail);
+      src   += avail;
+      count -= avail;
 
-      else
+      ret = tiff_bufcommit(info, avail);
+      if (ret < 0)
         {
-          DEBUGASSERT(nbytes == count);
-          buffer += nbytes;
-          count  -= nbytes;
+          return ret;
         }
     }
 
   return OK;
 }
 
+/****************************************************************************
+ * Name: tiff_bufflush
+ *
+ * Description:
+ *   Write any buffered data to the outfile and wait for all outstanding
+ *   writes to complete.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  A negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int tiff_bufflush(FAR struct tiff_info_s *info)
+{
+  int ret;
+
+  ret = tiff_bufsubmit(info);
+#ifdef CONFIG_TIFF_AIO
+  if (ret == OK)
+    {
+      ret = tiff_bufwait(info, info->bufndx ^ 1);
+    }
+#endif
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: tiff_bufcancel
+ *
+ * Description:
+ *   Wait for any outstanding writes so that the I/O buffer and the outfile
+ *   may be released.  Buffered data is discarded and errors are ignored.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void tiff_bufcancel(FAR struct tiff_info_s *info)
+{
+#ifdef CONFIG_TIFF_AIO
+  (void)tiff_bufwait(info, 0);
+  (void)tiff_bufwait(info, 1);
+#endif
+  info->buflen = 0;
+}
+
+/****************************************************************************
+ * Name: tiff_stripentries
+ *
+ * Description:
+ *   Build the StripOffsets and StripByteCounts IFD entries for the given
+ *   number of strips.  A single strip's values are stored in the entries
+ *   themselves; otherwise the entries refer to the strip tables that
+ *   follow the value section.
+ *
+ * Input Parameters:
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
+ *   nstrips - The number of strips to describe
+ *   soentry - Location to build the StripOffsets entry
+ *   sbcentry - Location to build the StripByteCounts entry
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void tiff_stripentries(FAR struct tiff_info_s *info, nxgl_coord_t nstrips,
+                       FAR struct tiff_ifdentry_s *soentry,
+                       FAR struct tiff_ifdentry_s *sbcentry)
+{
+  uint32_t sbcoffset = info->filefmt->sbcoffset;
+  uint32_t sooffset  = sbcoffset + 4 * (uint32_t)info->maxstrips;
+
+  if (nstrips == 1)
+    {
+      sooffset  = info->stripoffset;
+      sbcoffset = info->counts != NULL ? info->counts[0] : info->bps;
+    }
+
+  tiff_put16(soentry->tag, IFD_TAG_STRIPOFFSETS);
+  tiff_put16(soentry->type, IFD_FIELD_LONG);
+  tiff_put32(soentry->count, nstrips);
+  tiff_put32(soentry->offset, sooffset);
+
+  tiff_put16(sbcentry->tag, IFD_TAG_STRIPCOUNTS);
+  tiff_put16(sbcentry->type, IFD_FIELD_LONG);
+  tiff_put32(sbcentry->count, nstrips);
+  tiff_put32(sbcentry->offset, sbcoffset);
+}
+
 /****************************************************************************
  * Name: tiff_putint16
  *
@@ -275,7 +570,8 @@ int tiff_write(int fd, FAR const void *buffer, size_t count)
  *   Write two bytes to the outfile.
  *
  * Input Parameters:
- *   fd - File descriptor to be used.
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
  *   value - The 2-byte, uint16_t value to write
  *
  * Returned Value:
@@ -283,14 +579,14 @@ int tiff_write(int fd, FAR const void *buffer, size_t count)
  *
  ****************************************************************************/
 
-int tiff_putint16(int fd, uint16_t value)
+int tiff_putint16(FAR struct tiff_info_s *info, uint16_t value)
 {
   uint8_t bytes[2];
 
   /* Write the two bytes to the output file */
 
   tiff_put16(bytes, value);
-  return tiff_write(fd, bytes, 2);
+  return tiff_bufwrite(info, bytes, 2);
 }
 
 /****************************************************************************
@@ -300,7 +596,8 @@ int tiff_putint16(int fd, uint16_t value)
  *   Write four bytes to the outfile.
  *
  * Input Parameters:
- *   fd - File descriptor to be used.
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
  *   value - The 4-byte, uint32_t value to write
  *
  * Returned Value:
@@ -308,14 +605,14 @@ int tiff_putint16(int fd, uint16_t value)
  *
  ****************************************************************************/
 
-int tiff_putint32(int fd, uint32_t value)
+int tiff_putint32(FAR struct tiff_info_s *info, uint32_t value)
 {
   uint8_t bytes[4];
 
   /* Write the four bytes to the output file */
 
   tiff_put32(bytes, value);
-  return tiff_write(fd, bytes, 4);
+  return tiff_bufwrite(info, bytes, 4);
 }
 
 /****************************************************************************
@@ -325,7 +622,8 @@ int tiff_putint32(int fd, uint32_t value)
  *  Write a string of fixed length to the outfile.
  *
  * Input Parameters:
- *   fd - File descriptor to be used.
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
  *   string - A pointer to the memory containing the string
  *   len - The length of the string (including the NUL terminator)
  *
@@ -334,48 +632,44 @@ int tiff_putint32(int fd, uint32_t value)
  *
  ****************************************************************************/
 
-int tiff_putstring(int fd, FAR const char *string, int len)
+int tiff_putstring(FAR struct tiff_info_s *info, FAR const char *string,
+                   int len)
 {
 #ifdef CONFIG_DEBUG_GRAPHICS
   int actual = strlen(string);
 
   ASSERT(len = actual+1);
 #endif
-  return tiff_write(fd, string, len);
+  return tiff_bufwrite(info, string, len);
 }
 
 /****************************************************************************
  * Name: tiff_wordalign
  *
  * Description:
- *  Pad a file with zeros as necessary to achieve word alignament.
+ *  Pad the outfile with zeros as necessary to achieve word alignament.
  *
  * Input Parameters:
- *   fd - File descriptor to be used.
- *   size - The current size of the file
+ *   info - A pointer to the caller allocated parameter passing/TIFF state
+ *          instance.
  *
  * Returned Value:
- *   The new size of the file on success.  A negated errno value on failure.
+ *   Zero (OK) on success.  A negated errno value on failure.
  *
  ****************************************************************************/
 
-ssize_t tiff_wordalign(int fd, size_t size)
+int tiff_wordalign(FAR struct tiff_info_s *info)
 {
   unsigned int remainder;
-  int ret;
 
-  remainder = size & 3;
+  remainder = info->outsize & 3;
   if (remainder > 0)
     {
       unsigned int nbytes = 4 - remainder;
       uint32_t value      = 0;
 
-      ret = tiff_write(fd, &value, nbytes);
-      if (ret < 0)
-        {
-          return (ssize_t)ret;
-        }
-      size += nbytes;
+      return tiff_bufwrite(info, &value, nbytes);
     }
-  return size;
+
+  return OK;
 }
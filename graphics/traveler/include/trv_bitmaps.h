@@ -59,6 +59,10 @@
 #define BMOFFSET(i,j) (((i) << BITMAP_JSHIFT) | (j))
 #define MAX_BITMAPS   256
 
+/* Return the pixels of a texture, reading the texture file on first use */
+
+#define GET_TEXTURE(b) ((b)->bm != NULL ? (b)->bm : trv_load_texture(b))
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -68,7 +72,8 @@ struct trv_bitmap_s
   uint16_t w;
   uint16_t h;
   uint8_t log2h;
-  FAR trv_pixel_t *bm;
+  FAR trv_pixel_t *bm;     /* Texture pixels, NULL until first used */
+  FAR char *path;          /* Texture file to read on first use */
 };
 
 /****************************************************************************
@@ -103,5 +108,6 @@ int trv_initialize_bitmaps(void);
 void trv_release_bitmaps(void);
 int trv_load_bitmapfile(FAR const char *bitmapfile, FAR const char *wldpath);
 FAR struct trv_bitmap_s *trv_read_texture(FAR const char *filename);
+FAR trv_pixel_t *trv_load_texture(FAR struct trv_bitmap_s *bitmap);
 
 #endif /* __APPS_GRAPHICS_TRAVELER_INCLUDE_TRV_BITMAPS_H */
@@ -74,5 +74,7 @@ void trv_graphicfile_free(struct trv_graphicfile_s *gfile);
 struct trv_color_rgb_s
   trv_graphicfile_pixel(FAR struct trv_graphicfile_s *gfile, int x, int y);
 struct trv_graphicfile_s *tvr_graphicfile_read(FAR char *filename);
+int trv_graphicfile_size(FAR const char *filename, FAR uint16_t *width,
+                         FAR uint16_t *height);
 
 #endif /* __APPS_GRAPHICS_TRAVELER_INCLUDE_TRV_GRAPHICFILE_H */
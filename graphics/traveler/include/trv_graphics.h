@@ -100,6 +100,10 @@ struct trv_graphics_info_s
   struct trv_palette_s palette; /* Color palette */
   FAR dev_pixel_t *hwbuffer;    /* Hardware frame buffer */
   FAR trv_pixel_t *swbuffer;    /* Software render buffer */
+#ifdef CONFIG_GRAPHICS_TRAVELER_DIRTYROWS
+  FAR trv_pixel_t *shadow;      /* Render buffer last sent to the display */
+  bool refresh;                 /* Update all rows on the next frame */
+#endif
 };
 
 /****************************************************************************
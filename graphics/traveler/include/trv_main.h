@@ -42,16 +42,55 @@
 
 #include "trv_types.h"
 
+#ifdef CONFIG_GRAPHICS_TRAVELER_PERFMON
+#  include "graphics/frameprof.h"
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* Performance monitoring */
+
+#ifdef CONFIG_GRAPHICS_TRAVELER_PERFMON
+#  define trv_perf_start(p) frameprof_start(&g_trv_perf, (p))
+#  define trv_perf_stop(p)  frameprof_stop(&g_trv_perf, (p))
+#else
+#  define trv_perf_start(p)
+#  define trv_perf_stop(p)
+#endif
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+#ifdef CONFIG_GRAPHICS_TRAVELER_PERFMON
+/* The phases of a frame that are timed by the performance monitor.  The
+ * display phase includes the push phase, the time spent sending the
+ * rendered frame to the display device.
+ */
+
+enum trv_phase_e
+{
+  TRV_PHASE_WORLD = 0,          /* Input, point of view and door animation */
+  TRV_PHASE_BACKDROP,           /* Painting the back drop */
+  TRV_PHASE_RAYCAST,            /* Ray casting and rendering the 3-D view */
+  TRV_PHASE_DISPLAY,            /* Converting and transferring the frame */
+  TRV_PHASE_PUSH,               /* Transfer to the NX window or LCD */
+  TRV_NPHASES
+};
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
 
 extern bool g_trv_terminate;
 
+#ifdef CONFIG_GRAPHICS_TRAVELER_PERFMON
+extern struct frameprof_s g_trv_perf;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
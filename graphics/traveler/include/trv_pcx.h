@@ -83,5 +83,7 @@ struct pcx_header_s
 
 FAR struct trv_graphicfile_s *trv_load_pcx(FAR FILE *fp,
                                            FAR const char *filename);
+void trv_load_pcxsize(FAR FILE *fp, FAR uint16_t *width,
+                      FAR uint16_t *height);
 
 #endif /* __APPS_GRAPHICS_TRAVELER_INCLUDE_TRV_PCX_H */
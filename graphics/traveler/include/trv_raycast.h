@@ -128,6 +128,35 @@ struct trv_raycast_s
   int16_t zdist;    /* Z distance to the hit (not used) */
 };
 
+/* This structure holds everything that changes while casting and rendering
+ * one range of screen columns.  Each ray casting worker has its own
+ * instance so that several workers can cast in parallel.
+ */
+
+struct trv_raystate_s
+{
+  /* The hits from X/Y/Z-ray casting for the current HGULP_SIZE x
+   * VGULP_SIZE cell
+   */
+
+  struct trv_raycast_s hit[VGULP_SIZE][HGULP_SIZE+1];
+
+  /* The "column" offset in g_buffer_row for the current cell */
+
+  int16_t column;
+
+  /* The pitch and yaw angles of the current ray cast.  The tangent and
+   * the cotangent of the pitch are adjusted for the viewing yaw angle so
+   * that the view is correct for the "fish eye" effect which results from
+   * the projection of the polar ray cast onto the flat display.
+   */
+
+  int16_t pitch;
+  int16_t yaw;
+  int32_t adj_tanpitch;
+  int32_t adj_cotpitch;
+};
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -137,24 +166,12 @@ struct trv_raycast_s
  *two in size (don't have to multiply to calculate indices)
  */
 
-/* The following array describes the hits from X/Y/Z-ray casting for the
- * current HGULP_SIZE x VGULP_SIZE cell
- */
-
-extern struct trv_raycast_s g_ray_hit[VGULP_SIZE][HGULP_SIZE+1];
-
 /* This structure points to the double buffer row corresponding to the
  * pitch angle
  */
 
 extern uint8_t *g_buffer_row[VGULP_SIZE];
 
-/* The is the "column" offset in g_buffer_row for the current cell being
- * operated on.  This value is updated in a loop by trv_raycaster.
- */
-
-extern int16_t g_cell_column;
-
 /* This structure holds the parameters used in the current ray cast */
 
 extern struct trv_camera_s g_camera;
@@ -163,7 +180,7 @@ extern struct trv_camera_s g_camera;
  * Public Function Prototypes
  ****************************************************************************/
 
-void trv_raycast(int16_t pitch, int16_t yaw, int16_t screenyaw,
-                 FAR struct trv_raycast_s *result);
+void trv_raycast(FAR struct trv_raystate_s *rs, int16_t pitch, int16_t yaw,
+                 int16_t screenyaw, FAR struct trv_raycast_s *result);
 
 #endif /* __APPS_GRAPHICS_TRAVELER_INCLUDE_TRV_RAYCAST_H */
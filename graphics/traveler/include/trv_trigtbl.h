@@ -43,6 +43,7 @@
  ****************************************************************************/
 
 #include "trv_types.h"
+#include "trv_raycast.h"
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -187,12 +188,19 @@ struct trv_bigfp_s
  * Public Data
  ****************************************************************************/
 
-/* Here are declarations for the trig tables */
+/* Here are declarations for the trig tables.  These tables, and the table
+ * of reciprocals, are generated at build time by tools/misc/mktrig.c for
+ * the angle units defined above.
+ */
 
 extern const int32_t g_tan_table[PI+HALFPI+1];
 extern const int16_t g_sin_table[TWOPI+HALFPI+1];
 extern const int32_t g_csc_table[TWOPI+HALFPI+1];
 
+/* 1/n with 8 bits of fraction for n = 0...VGULP_SIZE-1 (1/0 is bogus) */
+
+extern const uint8_t g_inv_table[VGULP_SIZE];
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -42,6 +42,8 @@
 #include "trv_mem.h"
 #include "trv_bitmaps.h"
 
+#include <stdlib.h>
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -89,6 +91,11 @@ static void trv_free_texture(FAR struct trv_bitmap_s *bitmap)
       trv_free(bitmap->bm);
     }
 
+  if (bitmap->path)
+    {
+      free(bitmap->path);
+    }
+
   trv_free(bitmap);
 }
 
@@ -94,6 +94,37 @@ FAR struct trv_graphicfile_s *tvr_graphicfile_read(char *filename)
   return gfile;
 }
 
+/****************************************************************************
+ * Name: trv_graphicfile_size
+ *
+ * Description:
+ *   Read only the size of the image in a graphic file.  This is much
+ *   cheaper than tvr_graphicfile_read() and is used to validate textures
+ *   that will not be read until they are first needed.
+ *
+ ****************************************************************************/
+
+int trv_graphicfile_size(FAR const char *filename, FAR uint16_t *width,
+                         FAR uint16_t *height)
+{
+  FAR FILE *fp;
+
+  fp = fopen(filename, "rb");
+  if (fp == NULL)
+    {
+      int errcode = errno;
+      fprintf(stderr, "ERROR: Failed to open graphic file %s: %d\n",
+              filename, errcode);
+      return -errcode;
+    }
+
+  /* REVISIT: As in tvr_graphicfile_read(), the file is assumed to be PCX */
+
+  trv_load_pcxsize(fp, width, height);
+  fclose(fp);
+  return OK;
+}
+
 /****************************************************************************
  * Name: trv_graphicfile_new
  *
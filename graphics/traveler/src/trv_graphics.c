@@ -57,6 +57,9 @@
 
 #ifdef CONFIG_GRAPHICS_TRAVELER_FB
 #  include <nuttx/video/fb.h>
+#  ifdef CONFIG_LCD_UPDATE
+#    include <nuttx/nx/nxglib.h>
+#  endif
 #endif
 #ifdef CONFIG_VNCSERVER
 #  include <nuttx/video/vnc.h>
@@ -299,17 +302,61 @@ void trv_row_update(struct trv_graphics_info_s *ginfo,
                     FAR const trv_pixel_t *src,
                     FAR dev_pixel_t *dest)
 {
+  FAR const dev_pixel_t *lut = ginfo->palette.lut;
   dev_pixel_t pixel;
   trv_coord_t srccol;
   int i;
 
+#if TRV_BPP == 16
+  /* Write two 16-bit pixels at a time if the destination is word aligned.
+   * The width of the render buffer is even.
+   */
+
+  if (((uintptr_t)dest & 3) == 0)
+    {
+      FAR uint32_t *dest32 = (FAR uint32_t *)dest;
+      uint32_t pixel32;
+
+      if (ginfo->xscale == 1)
+        {
+          for (srccol = 0; srccol < TRV_SCREEN_WIDTH; srccol += 2)
+            {
+#ifdef CONFIG_ENDIAN_BIG
+              pixel32 = ((uint32_t)lut[src[0]] << 16) | lut[src[1]];
+#else
+              pixel32 = ((uint32_t)lut[src[1]] << 16) | lut[src[0]];
+#endif
+              *dest32++ = pixel32;
+              src += 2;
+            }
+
+          return;
+        }
+      else if ((ginfo->xscale & 1) == 0)
+        {
+          for (srccol = 0; srccol < TRV_SCREEN_WIDTH; srccol++)
+            {
+              pixel   = lut[*src++];
+              pixel32 = ((uint32_t)pixel << 16) | pixel;
+
+              for (i = 0; i < ginfo->xscale; i += 2)
+                {
+                  *dest32++ = pixel32;
+                }
+            }
+
+          return;
+        }
+    }
+#endif
+
   /* Loop for each column in the src render buffer */
 
   for (srccol = 0; srccol < TRV_SCREEN_WIDTH; srccol++)
     {
       /* Map the source pixel */
 
-      pixel = ginfo->palette.lut[*src++];
+      pixel = lut[*src++];
 
       /* Expand pixels horizontally via pixel replication */
 
@@ -410,6 +457,22 @@ int trv_graphics_initialize(FAR struct trv_graphics_info_s *ginfo)
        trv_abort("ERROR: Failed to allocate render buffer\n");
      }
 
+#ifdef CONFIG_GRAPHICS_TRAVELER_DIRTYROWS
+  /* ginfo->shadow - A copy of the render buffer as it was last sent to the
+   *   display.  Only rows that differ from it are expanded.  Nothing has
+   *   been sent yet so the first update must include all rows.
+   */
+
+   ginfo->shadow = (trv_pixel_t*)
+     trv_malloc(TRV_SCREEN_WIDTH * TRV_SCREEN_HEIGHT * sizeof(trv_pixel_t));
+   if (!ginfo->shadow)
+     {
+       trv_abort("ERROR: Failed to allocate shadow buffer\n");
+     }
+
+   ginfo->refresh = true;
+#endif
+
   /* Using the framebuffer driver:
    *   ginfo->hwbuffer - This address of the final, expanded frame image.
    *   This address is determined by hardware and is neither allocated
@@ -455,6 +518,14 @@ void trv_graphics_terminate(FAR struct trv_graphics_info_s *ginfo)
       ginfo->swbuffer = NULL;
     }
 
+#ifdef CONFIG_GRAPHICS_TRAVELER_DIRTYROWS
+  if (ginfo->shadow)
+    {
+      trv_free(ginfo->shadow);
+      ginfo->shadow = NULL;
+    }
+#endif
+
 #if defined(CONFIG_GRAPHICS_TRAVELER_NX)
   if (ginfo->hwbuffer)
     {
@@ -476,6 +547,10 @@ void trv_graphics_terminate(FAR struct trv_graphics_info_s *ginfo)
  * Name: trv_display_update
  *
  * Description:
+ *   Expand the render buffer into the display.  If
+ *   CONFIG_GRAPHICS_TRAVELER_DIRTYROWS is selected, rows that have not
+ *   changed since the last update are skipped.
+ *
  ****************************************************************************/
 
 void trv_display_update(struct trv_graphics_info_s *ginfo)
@@ -487,12 +562,24 @@ void trv_display_update(struct trv_graphics_info_s *ginfo)
   trv_coord_t destrow;
 #else
   FAR uint8_t *first;
+#endif
+#ifdef CONFIG_GRAPHICS_TRAVELER_DIRTYROWS
+  FAR trv_pixel_t *shadow;
+#endif
+#if defined(CONFIG_GRAPHICS_TRAVELER_FB) && defined(CONFIG_LCD_UPDATE)
+  struct nxgl_rect_s rect;
+  trv_coord_t firstrow = TRV_SCREEN_HEIGHT;
+  trv_coord_t lastrow  = 0;
+  int ret;
 #endif
   int i;
 
   /* Get the star tof the first source row */
 
   src = (FAR const uint8_t *)ginfo->swbuffer;
+#ifdef CONFIG_GRAPHICS_TRAVELER_DIRTYROWS
+  shadow = ginfo->shadow;
+#endif
 
   /* Get the start of the first destination row */
 
@@ -508,6 +595,37 @@ void trv_display_update(struct trv_graphics_info_s *ginfo)
 
   for (srcrow = 0; srcrow < TRV_SCREEN_HEIGHT; srcrow++)
     {
+#ifdef CONFIG_GRAPHICS_TRAVELER_DIRTYROWS
+      /* Skip the row if it is the same as it was on the last update */
+
+      if (!ginfo->refresh &&
+          memcmp(src, shadow, TRV_SCREEN_WIDTH * sizeof(trv_pixel_t)) == 0)
+        {
+#ifdef CONFIG_GRAPHICS_TRAVELER_NX
+          destrow += ginfo->yscale;
+#else
+          dest    += ginfo->yscale * ginfo->stride;
+#endif
+          src     += TRV_SCREEN_WIDTH;
+          shadow  += TRV_SCREEN_WIDTH;
+          continue;
+        }
+
+      memcpy(shadow, src, TRV_SCREEN_WIDTH * sizeof(trv_pixel_t));
+      shadow += TRV_SCREEN_WIDTH;
+#endif
+
+#if defined(CONFIG_GRAPHICS_TRAVELER_FB) && defined(CONFIG_LCD_UPDATE)
+      /* Keep track of the band of rows that changed */
+
+      if (srcrow < firstrow)
+        {
+          firstrow = srcrow;
+        }
+
+      lastrow = srcrow;
+#endif
+
       /* Transfer the row to the device row/buffer */
 
       trv_row_update(ginfo, (FAR const trv_pixel_t *)src,
@@ -516,7 +634,9 @@ void trv_display_update(struct trv_graphics_info_s *ginfo)
 #ifdef CONFIG_GRAPHICS_TRAVELER_NX
       /* Transfer the row buffer to the NX window */
 
+      trv_perf_start(TRV_PHASE_PUSH);
       trv_row_transfer(ginfo, dest, destrow);
+      trv_perf_stop(TRV_PHASE_PUSH);
       destrow++;
 #else
       first = dest;
@@ -530,7 +650,9 @@ void trv_display_update(struct trv_graphics_info_s *ginfo)
 #ifdef CONFIG_GRAPHICS_TRAVELER_NX
           /* Transfer the row buffer to the NX window */
 
+          trv_perf_start(TRV_PHASE_PUSH);
           trv_row_transfer(ginfo, dest, destrow);
+          trv_perf_stop(TRV_PHASE_PUSH);
           destrow++;
 #else
           /* Point to the next row in the frame buffer */
@@ -544,5 +666,29 @@ void trv_display_update(struct trv_graphics_info_s *ginfo)
 
       src += TRV_SCREEN_WIDTH;
     }
+
+#ifdef CONFIG_GRAPHICS_TRAVELER_DIRTYROWS
+  ginfo->refresh = false;
+#endif
+
+#if defined(CONFIG_GRAPHICS_TRAVELER_FB) && defined(CONFIG_LCD_UPDATE)
+  /* Send the changed rows to the display in one transfer */
+
+  if (firstrow <= lastrow)
+    {
+      rect.pt1.x = ginfo->xoffset;
+      rect.pt1.y = ginfo->yoffset + firstrow * ginfo->yscale;
+      rect.pt2.x = ginfo->xoffset + TRV_SCREEN_WIDTH * ginfo->xscale - 1;
+      rect.pt2.y = ginfo->yoffset + (lastrow + 1) * ginfo->yscale - 1;
+
+      trv_perf_start(TRV_PHASE_PUSH);
+      ret = ioctl(ginfo->fb, FBIO_UPDATE, (unsigned long)((uintptr_t)&rect));
+      trv_perf_stop(TRV_PHASE_PUSH);
+      if (ret < 0)
+        {
+          trv_debug("ERROR: ioctl(FBIO_UPDATE) failed: %d\n", errno);
+        }
+    }
+#endif
 }
 
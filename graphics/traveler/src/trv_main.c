@@ -56,8 +56,7 @@
 #include "trv_debug.h"
 #include "trv_main.h"
 
-#if defined(CONFIG_GRAPHICS_TRAVELER_PERFMON) || \
-    defined(CONFIG_GRAPHICS_TRAVELER_LIMITFPS)
+#ifdef CONFIG_GRAPHICS_TRAVELER_LIMITFPS
 #  include <sys/types.h>
 #  include <sys/time.h>
 #endif
@@ -87,6 +86,12 @@
 
 bool g_trv_terminate;
 
+#ifdef CONFIG_GRAPHICS_TRAVELER_PERFMON
+/* Frame and render phase statistics */
+
+struct frameprof_s g_trv_perf;
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -95,6 +100,22 @@ static const char g_default_worldfile[] = "transfrm.wld";
 static const char g_default_worldpath[] = CONFIG_GRAPHICS_TRAVELER_DEFPATH;
 static FAR struct trv_graphics_info_s g_trv_ginfo;
 
+#ifdef CONFIG_GRAPHICS_TRAVELER_PERFMON
+/* Names of the phases in enum trv_phase_e order */
+
+static FAR const char * const g_trv_phasename[TRV_NPHASES] =
+{
+  "world", "backdrop", "raycast", "display", "push"
+};
+#endif
+
+#ifdef CONFIG_GRAPHICS_TRAVELER_PERFOVERLAY
+/* Colors of the performance overlay */
+
+static trv_pixel_t g_trv_perffg;
+static trv_pixel_t g_trv_perfbg;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -108,10 +129,19 @@ static FAR struct trv_graphics_info_s g_trv_ginfo;
 static void trv_exit(int exitcode) noreturn_function;
 static void trv_exit(int exitcode)
 {
-  /* Release memory held by the ray casting engine */
+  /* Stop the ray casting workers and release memory held by the ray
+   * casting engine
+   */
 
+  trv_raycaster_uninitialize();
   trv_world_destroy();
 
+#ifdef CONFIG_GRAPHICS_TRAVELER_PERFMON
+  /* Show the frame and phase time histograms */
+
+  frameprof_dump(&g_trv_perf, stderr);
+#endif
+
   /* Close off input */
 
   trv_input_terminate();
@@ -141,8 +171,7 @@ static void trv_usage(char *execname)
  * Description:
  ****************************************************************************/
 
-#if defined(CONFIG_GRAPHICS_TRAVELER_PERFMON) || \
-    defined(CONFIG_GRAPHICS_TRAVELER_LIMITFPS)
+#ifdef CONFIG_GRAPHICS_TRAVELER_LIMITFPS
 static void trv_current_time(FAR struct timespec *tp)
 {
   int ret;
@@ -166,8 +195,7 @@ static void trv_current_time(FAR struct timespec *tp)
  * Description:
  ****************************************************************************/
 
-#if defined(CONFIG_GRAPHICS_TRAVELER_PERFMON) || \
-    defined(CONFIG_GRAPHICS_TRAVELER_LIMITFPS)
+#ifdef CONFIG_GRAPHICS_TRAVELER_LIMITFPS
 static uint32_t trv_timespec2usec(FAR const struct timespec *tp)
 {
   uint64_t usec = (uint64_t)tp->tv_sec * 1000*1000 + (uint64_t)(tp->tv_nsec / 1000);
@@ -186,8 +214,7 @@ static uint32_t trv_timespec2usec(FAR const struct timespec *tp)
  * Description:
  ****************************************************************************/
 
-#if defined(CONFIG_GRAPHICS_TRAVELER_PERFMON) || \
-    defined(CONFIG_GRAPHICS_TRAVELER_LIMITFPS)
+#ifdef CONFIG_GRAPHICS_TRAVELER_LIMITFPS
 static uint32_t trv_elapsed_time(FAR struct timespec *now,
                                  FAR const struct timespec *then)
 {
@@ -252,17 +279,16 @@ int traveler_main(int argc, char *argv[])
 {
   FAR const char *wldpath;
   FAR const char *wldfile;
-#if defined(CONFIG_GRAPHICS_TRAVELER_PERFMON) || \
-    defined(CONFIG_GRAPHICS_TRAVELER_LIMITFPS)
-#ifdef CONFIG_GRAPHICS_TRAVELER_PERFMON
-  struct timespec start_time;
-  uint32_t frame_count = 0;
-#endif
 #ifdef CONFIG_GRAPHICS_TRAVELER_LIMITFPS
   struct timespec frame_start;
-#endif
   struct timespec now;
   uint32_t elapsed_usec;
+#endif
+#ifdef CONFIG_GRAPHICS_TRAVELER_PERFMON
+  char summary[128];
+#endif
+#ifdef CONFIG_GRAPHICS_TRAVELER_PERFOVERLAY
+  struct trv_color_rgb_s rgb;
 #endif
   int ret;
   int i;
@@ -305,6 +331,20 @@ int traveler_main(int argc, char *argv[])
 
   trv_graphics_initialize(&g_trv_ginfo);
 
+#ifdef CONFIG_GRAPHICS_TRAVELER_PERFOVERLAY
+  /* Select the colors of the performance overlay */
+
+  rgb.red      = TRV_PIXEL_MAX;
+  rgb.green    = TRV_PIXEL_MAX;
+  rgb.blue     = TRV_PIXEL_MAX;
+  g_trv_perffg = trv_color_rgb2pixel(&rgb);
+
+  rgb.red      = 0;
+  rgb.green    = 0;
+  rgb.blue     = 0;
+  g_trv_perfbg = trv_color_rgb2pixel(&rgb);
+#endif
+
   /* Load the word data structures */
 
   ret = trv_world_create(wldpath, wldfile);
@@ -318,6 +358,14 @@ int traveler_main(int argc, char *argv[])
 
   trv_color_endmapping();
 
+  /* Start the ray casting workers */
+
+  ret = trv_raycaster_initialize();
+  if (ret < 0)
+    {
+      trv_abort("ERROR: Failed to start the ray caster: %d\n", ret);
+    }
+
   /* Set the player's POV in the new world */
 
   trv_pov_reset();
@@ -331,9 +379,15 @@ int traveler_main(int argc, char *argv[])
   trv_input_initialize();
 
 #ifdef CONFIG_GRAPHICS_TRAVELER_PERFMON
-  /* Get the start time for performance monitoring */
+  /* Set up performance monitoring.  The phases are registered in order so
+   * that the phase numbers are those of enum trv_phase_e.
+   */
 
-  trv_current_time(&start_time);
+  frameprof_initialize(&g_trv_perf);
+  for (i = 0; i < TRV_NPHASES; i++)
+    {
+      (void)frameprof_phase(&g_trv_perf, g_trv_phasename[i]);
+    }
 #endif
 
   g_trv_terminate = false;
@@ -345,6 +399,11 @@ int traveler_main(int argc, char *argv[])
       trv_current_time(&frame_start);
 #endif
 
+#ifdef CONFIG_GRAPHICS_TRAVELER_PERFMON
+      frameprof_begin(&g_trv_perf);
+#endif
+
+      trv_perf_start(TRV_PHASE_WORLD);
       trv_input_read();
 
       /* Select the POV to use on this viewing cycle */
@@ -354,18 +413,35 @@ int traveler_main(int argc, char *argv[])
       /* Process door animations */
 
       trv_door_animate();
+      trv_perf_stop(TRV_PHASE_WORLD);
 
       /* Paint the back drop */
 
+      trv_perf_start(TRV_PHASE_BACKDROP);
       trv_rend_backdrop(&g_player, &g_trv_ginfo);
+      trv_perf_stop(TRV_PHASE_BACKDROP);
 
       /* Render the 3-D view */
 
+      trv_perf_start(TRV_PHASE_RAYCAST);
       trv_raycaster(&g_player, &g_trv_ginfo);
+      trv_perf_stop(TRV_PHASE_RAYCAST);
+
+#ifdef CONFIG_GRAPHICS_TRAVELER_PERFOVERLAY
+      /* Show the statistics of the last window in the top left corner */
+
+      (void)frameprof_overlay(&g_trv_perf, g_trv_ginfo.swbuffer,
+                              TRV_SCREEN_WIDTH * sizeof(trv_pixel_t),
+                              8 * sizeof(trv_pixel_t), TRV_SCREEN_WIDTH,
+                              TRV_SCREEN_HEIGHT, 1, g_trv_perffg,
+                              g_trv_perfbg);
+#endif
 
       /* Display the world. */
 
+      trv_perf_start(TRV_PHASE_DISPLAY);
       trv_display_update(&g_trv_ginfo);
+      trv_perf_stop(TRV_PHASE_DISPLAY);
 
 #ifdef CONFIG_GRAPHICS_TRAVELER_LIMITFPS
        /* In the unlikely event that we are running "too" fast, we can delay
@@ -380,18 +456,12 @@ int traveler_main(int argc, char *argv[])
 #endif
 
 #ifdef CONFIG_GRAPHICS_TRAVELER_PERFMON
-      /* Show the realized frame rate */
+      /* Show the realized frame rate and phase times after each window */
 
-      frame_count++;
-      if (frame_count >= 100)
+      if (frameprof_end(&g_trv_perf))
         {
-          elapsed_usec = trv_elapsed_time(&now, &start_time);
-
-          fprintf(stderr, "fps = %3.2f\n", (double)(frame_count * 1000000) / (double)elapsed_usec);
-
-          frame_count        = 0;
-          start_time.tv_sec  = now.tv_sec;
-          start_time.tv_nsec = now.tv_nsec;
+          (void)frameprof_summary(&g_trv_perf, summary, sizeof(summary));
+          fprintf(stderr, "%s\n", summary);
         }
 #endif
     }
@@ -154,6 +154,25 @@ static void trv_load_pcxpalette(FAR FILE *fp,
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: trv_load_pcxsize
+ *
+ * Description:
+ *   This function reads only the image size from a PCX file.
+ *
+ ****************************************************************************/
+
+void trv_load_pcxsize(FAR FILE *fp, FAR uint16_t *width,
+                      FAR uint16_t *height)
+{
+  struct pcx_header_s header;
+
+  trv_load_pcxheader(fp, &header);
+
+  *width  = header.width - header.x + 1;
+  *height = header.height - header.y + 1;
+}
+
 /****************************************************************************
  * Name: trv_load_pcx
  *
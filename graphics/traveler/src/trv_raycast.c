@@ -64,26 +64,23 @@
  * Private Function Prototypes
  ****************************************************************************/
 
-static void trv_ray_xcaster14(FAR struct trv_raycast_s *result);
-static void trv_ray_xcaster23(FAR struct trv_raycast_s *result);
-static void trv_ray_ycaster12(FAR struct trv_raycast_s *result);
-static void trv_ray_ycaster34(FAR struct trv_raycast_s *result);
-static void trv_ray_zcasteru(FAR struct trv_raycast_s *result);
-static void trv_ray_zcasterl(FAR struct trv_raycast_s *result);
+static void trv_ray_xcaster14(FAR struct trv_raystate_s *rs,
+                              FAR struct trv_raycast_s *result);
+static void trv_ray_xcaster23(FAR struct trv_raystate_s *rs,
+                              FAR struct trv_raycast_s *result);
+static void trv_ray_ycaster12(FAR struct trv_raystate_s *rs,
+                              FAR struct trv_raycast_s *result);
+static void trv_ray_ycaster34(FAR struct trv_raystate_s *rs,
+                              FAR struct trv_raycast_s *result);
+static void trv_ray_zcasteru(FAR struct trv_raystate_s *rs,
+                             FAR struct trv_raycast_s *result);
+static void trv_ray_zcasterl(FAR struct trv_raystate_s *rs,
+                             FAR struct trv_raycast_s *result);
 
 /****************************************************************************
  * Private Data
  ****************************************************************************/
 
-/* The following are the tangent and the cotangent of the pitch angle
- * adjusted for the viewing yaw angle so that the view is correct for the
- * "fish eye" effect which results from the projection of the polar ray cast
- * onto the flat display
- */
-
-static int32_t g_adj_tanpitch;
-static int32_t g_adj_cotpitch;
-
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -105,7 +102,8 @@ static int32_t g_adj_cotpitch;
  *
  ****************************************************************************/
 
-static void trv_ray_xcaster14(FAR struct trv_raycast_s *result)
+static void trv_ray_xcaster14(FAR struct trv_raystate_s *rs,
+                              FAR struct trv_raycast_s *result)
 {
   struct trv_rect_list_s *list; /* Points to the current X plane rectangle */
   struct trv_rect_data_s *rect; /* Points to the rectangle data */
@@ -121,7 +119,7 @@ static void trv_ray_xcaster14(FAR struct trv_raycast_s *result)
    * are possible!
    */
 
-  if (g_camera.yaw == ANGLE_270)
+  if (rs->yaw == ANGLE_270)
     {
       return;
     }
@@ -131,14 +129,14 @@ static void trv_ray_xcaster14(FAR struct trv_raycast_s *result)
    * X-axis.  The tangent is stored at double the "normal" scaling.
    */
 
-  dydx = TAN(g_camera.yaw);
+  dydx = TAN(rs->yaw);
 
   /* Determine the rate of change of the Z with respect to X. The tangent is
    * "double" precision; the secant is "double" precision.  dzdx will be
    * retained as "double" precision.
    */
 
-  dzdx = qTOd(g_adj_tanpitch * ABS(g_sec_table[g_camera.yaw]));
+  dzdx = qTOd(rs->adj_tanpitch * ABS(g_sec_table[rs->yaw]));
 
   /* Look at every rectangle lying in the X plane */
   /* This logic should be improved at some point so that non-visible planes
@@ -334,7 +332,8 @@ static void trv_ray_xcaster14(FAR struct trv_raycast_s *result)
  *
  ****************************************************************************/
 
-static void trv_ray_xcaster23(FAR struct trv_raycast_s *result)
+static void trv_ray_xcaster23(FAR struct trv_raystate_s *rs,
+                              FAR struct trv_raycast_s *result)
 {
   struct trv_rect_list_s *list; /* Points to the current X plane rectangle */
   struct trv_rect_data_s *rect; /* Points to the rectangle data */
@@ -350,7 +349,7 @@ static void trv_ray_xcaster23(FAR struct trv_raycast_s *result)
    * possible!
    */
 
-  if (g_camera.yaw == ANGLE_90)
+  if (rs->yaw == ANGLE_90)
     {
       return;
     }
@@ -360,14 +359,14 @@ static void trv_ray_xcaster23(FAR struct trv_raycast_s *result)
    * to the X-axis.  The tangent is stored at double the "normal" scaling.
    */
 
-  dydx = -TAN(g_camera.yaw);
+  dydx = -TAN(rs->yaw);
 
   /* Determine the rate of change of the Z with respect to X. dydx is
    * "double" precision; the secant is "double" precision.  dzdx will be
    * retained as "double" precision.
    */
 
-  dzdx = qTOd(g_adj_tanpitch * ABS(g_sec_table[g_camera.yaw]));
+  dzdx = qTOd(rs->adj_tanpitch * ABS(g_sec_table[rs->yaw]));
 
   /* Look at every rectangle lying in the X plane */
   /* This logic should be improved at some point so that non-visible planes
@@ -561,7 +560,8 @@ static void trv_ray_xcaster23(FAR struct trv_raycast_s *result)
  *
  ****************************************************************************/
 
-static void trv_ray_ycaster12(FAR struct trv_raycast_s *result)
+static void trv_ray_ycaster12(FAR struct trv_raystate_s *rs,
+                              FAR struct trv_raycast_s *result)
 {
   struct trv_rect_list_s *list; /* Points to the current P plane rectangle */
   struct trv_rect_data_s *rect; /* Points to the rectangle data */
@@ -577,7 +577,7 @@ static void trv_ray_ycaster12(FAR struct trv_raycast_s *result)
    * possible!
    */
 
-  if (g_camera.yaw == ANGLE_0)
+  if (rs->yaw == ANGLE_0)
     {
       return;
     }
@@ -587,14 +587,14 @@ static void trv_ray_ycaster12(FAR struct trv_raycast_s *result)
    * the Y-axis.  The cotangent is stored at double the "normal" scaling.
    */
 
-  dxdy = g_cot_table(g_camera.yaw);
+  dxdy = g_cot_table(rs->yaw);
 
   /* Determine the rate of change of the Z with respect to Y.  The tangent
    * is "double" precision; the cosecant is "double" precision.  dzdy will
    * be retained as "double" precision.
    */
 
-  dzdy = qTOd(g_adj_tanpitch * ABS(g_csc_table[g_camera.yaw]));
+  dzdy = qTOd(rs->adj_tanpitch * ABS(g_csc_table[rs->yaw]));
 
   /* Look at every rectangle lying in a Y plane */
   /* This logic should be improved at some point so that non-visible planes
@@ -787,7 +787,8 @@ static void trv_ray_ycaster12(FAR struct trv_raycast_s *result)
  *
  ****************************************************************************/
 
-static void trv_ray_ycaster34(FAR struct trv_raycast_s *result)
+static void trv_ray_ycaster34(FAR struct trv_raystate_s *rs,
+                              FAR struct trv_raycast_s *result)
 {
   struct trv_rect_list_s *list; /* Points to the current P plane rectangle */
   struct trv_rect_data_s *rect; /* Points to the rectangle data */
@@ -803,7 +804,7 @@ static void trv_ray_ycaster34(FAR struct trv_raycast_s *result)
    * are possible!
    */
 
-  if (g_camera.yaw == ANGLE_180)
+  if (rs->yaw == ANGLE_180)
     {
       return;
     }
@@ -814,14 +815,14 @@ static void trv_ray_ycaster34(FAR struct trv_raycast_s *result)
    * "normal" scaling.
    */
 
-  dxdy = -g_cot_table(g_camera.yaw - ANGLE_180);
+  dxdy = -g_cot_table(rs->yaw - ANGLE_180);
 
   /* Determine the rate of change of the Z with respect to Y.  The tangent
    * is "double" precision; the cosecant is "double" precision.  dzdy will
    * be retained as "double" precision.
    */
 
-  dzdy = qTOd(g_adj_tanpitch * ABS(g_csc_table[g_camera.yaw]));
+  dzdy = qTOd(rs->adj_tanpitch * ABS(g_csc_table[rs->yaw]));
 
   /* Look at every rectangle lying in a Y plane */
   /* This logic should be improved at some point so that non-visible planes
@@ -1016,7 +1017,8 @@ static void trv_ray_ycaster34(FAR struct trv_raycast_s *result)
  *   ran!
  ****************************************************************************/
 
-static void trv_ray_zcasteru(FAR struct trv_raycast_s *result)
+static void trv_ray_zcasteru(FAR struct trv_raystate_s *rs,
+                             FAR struct trv_raycast_s *result)
 {
   struct trv_rect_list_s *list; /* Points to the current Z plane rectangle */
   struct trv_rect_data_s *rect; /* Points to the rectangle data */
@@ -1032,7 +1034,7 @@ static void trv_ray_zcasteru(FAR struct trv_raycast_s *result)
    * possible!
    */
 
-  if (g_camera.pitch == ANGLE_0)
+  if (rs->pitch == ANGLE_0)
     {
       return;
     }
@@ -1044,14 +1046,14 @@ static void trv_ray_zcasteru(FAR struct trv_raycast_s *result)
    * precision.
    */
 
-  dxdz = qTOd(g_adj_cotpitch * ((int32_t) g_cos_table[g_camera.yaw]));
+  dxdz = qTOd(rs->adj_cotpitch * ((int32_t) g_cos_table[rs->yaw]));
 
   /* Calculate the rate of change of Y with respect to the Z-axis. The
    * cotangent is stored at double the "normal" scaling and the sine is also
    * at double scaling.  dxdz will be also be stored at double precision.
    */
 
-  dydz = qTOd(g_adj_cotpitch * ((int32_t) g_sin_table[g_camera.yaw]));
+  dydz = qTOd(rs->adj_cotpitch * ((int32_t) g_sin_table[rs->yaw]));
 
   /* Look at every rectangle lying in the Z plane */
   /* This logic should be improved at some point so that non-visible planes
@@ -1165,7 +1167,8 @@ static void trv_ray_zcasteru(FAR struct trv_raycast_s *result)
  *
  ****************************************************************************/
 
-static void trv_ray_zcasterl(FAR struct trv_raycast_s *result)
+static void trv_ray_zcasterl(FAR struct trv_raystate_s *rs,
+                             FAR struct trv_raycast_s *result)
 {
   struct trv_rect_list_s *list; /* Points to the current Z plane rectangle */
   struct trv_rect_data_s *rect; /* Points to the rectangle data */
@@ -1181,7 +1184,7 @@ static void trv_ray_zcasterl(FAR struct trv_raycast_s *result)
    * possible!
    */
 
-  if (g_camera.pitch == ANGLE_0)
+  if (rs->pitch == ANGLE_0)
     {
       return;
     }
@@ -1193,7 +1196,7 @@ static void trv_ray_zcasterl(FAR struct trv_raycast_s *result)
    * precision.
    */
 
-  dxdz = qTOd(g_adj_cotpitch * ((int32_t) g_cos_table[g_camera.yaw]));
+  dxdz = qTOd(rs->adj_cotpitch * ((int32_t) g_cos_table[rs->yaw]));
 
   /* Calculate the rate of change of Y with respect to the Z-axis. The
    * cotangent is stored at double the "normal" scaling and the sine is
@@ -1201,7 +1204,7 @@ static void trv_ray_zcasterl(FAR struct trv_raycast_s *result)
    * precision.
    */
 
-  dydz = qTOd(g_adj_cotpitch * ((int32_t) g_sin_table[g_camera.yaw]));
+  dydz = qTOd(rs->adj_cotpitch * ((int32_t) g_sin_table[rs->yaw]));
 
   /* Look at every rectangle lying in the Z plane */
   /* This logic should be improved at some point so that non-visible planes
@@ -1312,13 +1315,13 @@ static void trv_ray_zcasterl(FAR struct trv_raycast_s *result)
  *
  ****************************************************************************/
 
-void trv_raycast(int16_t pitch, int16_t yaw, int16_t screenyaw,
-                FAR struct trv_raycast_s *result)
+void trv_raycast(FAR struct trv_raystate_s *rs, int16_t pitch, int16_t yaw,
+                 int16_t screenyaw, FAR struct trv_raycast_s *result)
 {
   /* Set the camera pitch and yaw angles for this cast */
 
-  g_camera.pitch = pitch;
-  g_camera.yaw = yaw;
+  rs->pitch = pitch;
+  rs->yaw = yaw;
 
   /* Initialize the result structure, assuming that there will be no hit */
 
@@ -1339,37 +1342,37 @@ void trv_raycast(int16_t pitch, int16_t yaw, int16_t screenyaw,
 
   screenyaw = ABS(screenyaw);
 #if ENABLE_VIEW_CORRECTION
-  g_adj_tanpitch = qTOd(TAN(pitch) * ((int32_t) g_cos_table[screenyaw]));
+  rs->adj_tanpitch = qTOd(TAN(pitch) * ((int32_t) g_cos_table[screenyaw]));
 #else
-  g_adj_tanpitch = TAN(pitch);
+  rs->adj_tanpitch = TAN(pitch);
 #endif
 
   /* Perform X & Y raycasting based on the quadrant of the yaw angle */
 
-  if (g_camera.yaw < ANGLE_90)
+  if (rs->yaw < ANGLE_90)
     {
-      trv_ray_xcaster14(result);
-      trv_ray_ycaster12(result);
+      trv_ray_xcaster14(rs, result);
+      trv_ray_ycaster12(rs, result);
     }
-  else if (g_camera.yaw < ANGLE_180)
+  else if (rs->yaw < ANGLE_180)
     {
-      trv_ray_xcaster23(result);
-      trv_ray_ycaster12(result);
+      trv_ray_xcaster23(rs, result);
+      trv_ray_ycaster12(rs, result);
     }
-  else if (g_camera.yaw < ANGLE_270)
+  else if (rs->yaw < ANGLE_270)
     {
-      trv_ray_xcaster23(result);
-      trv_ray_ycaster34(result);
+      trv_ray_xcaster23(rs, result);
+      trv_ray_ycaster34(rs, result);
     }
   else
     {
-      trv_ray_xcaster14(result);
-      trv_ray_ycaster34(result);
+      trv_ray_xcaster14(rs, result);
+      trv_ray_ycaster34(rs, result);
     }
 
   /* Perform Z ray casting based upon if we are looking up or down */
 
-  if (g_camera.pitch < ANGLE_90)
+  if (rs->pitch < ANGLE_90)
     {
       /* Get the adjusted cotangent of the pitch angle which is used to correct
        * for the "fish eye" distortion.  This correction consists of
@@ -1379,11 +1382,11 @@ void trv_raycast(int16_t pitch, int16_t yaw, int16_t screenyaw,
        */
 
 #if ENABLE_VIEW_CORRECTION
-      g_adj_cotpitch = qTOd(g_cot_table(pitch) * g_sec_table[screenyaw]);
+      rs->adj_cotpitch = qTOd(g_cot_table(pitch) * g_sec_table[screenyaw]);
 #else
-      g_adj_cotpitch = g_cot_table(pitch);
+      rs->adj_cotpitch = g_cot_table(pitch);
 #endif
-      trv_ray_zcasteru(result);
+      trv_ray_zcasteru(rs, result);
     }
   else
     {
@@ -1395,11 +1398,11 @@ void trv_raycast(int16_t pitch, int16_t yaw, int16_t screenyaw,
        */
 
 #if ENABLE_VIEW_CORRECTION
-      g_adj_cotpitch =
+      rs->adj_cotpitch =
         qTOd(g_cot_table(ANGLE_360 - pitch) * g_sec_table[screenyaw]);
 #else
-      g_adj_cotpitch = g_cot_table(ANGLE_360 - pitch);
+      rs->adj_cotpitch = g_cot_table(ANGLE_360 - pitch);
 #endif
-      trv_ray_zcasterl(result);
+      trv_ray_zcasterl(rs, result);
     }
 }
@@ -39,6 +39,12 @@
  ****************************************************************************/
 
 #include "trv_types.h"
+
+#if CONFIG_GRAPHICS_TRAVELER_RAYWORKERS > 1
+#  include <sched.h>
+#  include <pthread.h>
+#endif
+
 #include "trv_debug.h"
 #include "trv_world.h"
 #include "trv_plane.h"
@@ -56,6 +62,20 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* Configuration */
+
+#ifndef CONFIG_GRAPHICS_TRAVELER_RAYWORKERS
+#  define CONFIG_GRAPHICS_TRAVELER_RAYWORKERS 1
+#endif
+
+#define NRAYWORKERS CONFIG_GRAPHICS_TRAVELER_RAYWORKERS
+
+/* Each worker must cast at least two cells per horizontal swathe */
+
+#if 2 * NRAYWORKERS > NUMBER_HGULPS
+#  error CONFIG_GRAPHICS_TRAVELER_RAYWORKERS is too large for IMAGE_WIDTH
+#endif
+
 /* These definitions simplify creation of the initial ray casting cell */
 
 #define TOP_HEIGHT  (VGULP_SIZE/2)
@@ -80,18 +100,37 @@
 
 /* Macro to determine if two hits "hit" the same object */
 
-#define SAME_CELL(i1,j1,i2,j2) \
-  (g_ray_hit[i1][j1].rect == g_ray_hit[i2][j2].rect)
+#define SAME_CELL(rs,i1,j1,i2,j2) \
+  ((rs)->hit[i1][j1].rect == (rs)->hit[i2][j2].rect)
+
+/* This is the column of the k'th cell of a horizontal swathe.  Cells are
+ * cast from right to left.
+ */
+
+#define CELL_COLUMN(k) (IMAGE_WIDTH - HGULP_SIZE + 1 - (k) * HGULP_SIZE)
 
 /****************************************************************************
- * Public Data
+ * Private Types
  ****************************************************************************/
 
-/* The following array describes the hits from X/Y/Z-ray casting for the
- * current HGULP_SIZE x VGULP_SIZE cell
+#if NRAYWORKERS > 1
+/* Each ray casting worker casts and renders one range of the cells of
+ * every horizontal swathe.  Worker 0 is the task that calls trv_raycaster().
  */
 
-struct trv_raycast_s g_ray_hit[VGULP_SIZE][HGULP_SIZE + 1];
+struct trv_rayworker_s
+{
+  struct trv_raystate_s state;  /* Ray state of this worker */
+  int16_t first;                /* Column of the right-most cell */
+  int16_t last;                 /* Column of the left-most cell */
+  trv_pixel_t seam[VGULP_SIZE]; /* The right-most column of pixels */
+  pthread_t thread;             /* The worker thread (unused for worker 0) */
+};
+#endif
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
 
 /* This array points to the screen buffer row corresponding to the
  * pitch angle
@@ -99,11 +138,6 @@ struct trv_raycast_s g_ray_hit[VGULP_SIZE][HGULP_SIZE + 1];
 
 FAR uint8_t *g_buffer_row[VGULP_SIZE];
 
-/* The is the "column" offset in g_buffer_row for the current cell being 
- * operated on.  This value is updated in a loop by trv_raycaster. */
-
-int16_t g_cell_column;
-
 /* This structure holds the parameters used in the current ray cast */
 
 struct trv_camera_s g_camera;
@@ -124,6 +158,24 @@ static int16_t g_yaw[IMAGE_WIDTH + 1];
 
 static int16_t g_pitch[VGULP_SIZE];
 
+#if NRAYWORKERS > 1
+/* The ray casting workers.  The workers wait at g_ray_start for each
+ * horizontal swathe to be set up and meet at g_ray_seam and g_ray_done
+ * when they have cast their cells.
+ */
+
+static struct trv_rayworker_s g_rayworker[NRAYWORKERS];
+static pthread_barrier_t g_ray_start;
+static pthread_barrier_t g_ray_seam;
+static pthread_barrier_t g_ray_done;
+static volatile bool g_ray_terminate;
+static bool g_ray_started;
+#else
+/* The ray state used by trv_raycaster() */
+
+static struct trv_raystate_s g_raystate;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -138,7 +190,8 @@ static int16_t g_pitch[VGULP_SIZE];
  *
  ****************************************************************************/
 
-static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
+static void trv_resolve_cell(FAR struct trv_raystate_s *rs,
+                             uint8_t toprow, uint8_t leftcol,
                              uint8_t height, uint8_t width)
 {
   uint8_t midrow;
@@ -162,19 +215,20 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
            * the same cell type
            */
 
-          if (!SAME_CELL(toprow, leftcol, toprow, (leftcol + width - 1)))
+          if (!SAME_CELL(rs, toprow, leftcol, toprow, (leftcol + width - 1)))
             {
               /* No.. the top corners are different.  Compare the top left and
                * bottom left corners to decide how to divide this up
                */
 
-              if (!SAME_CELL(toprow, leftcol, (toprow + height - 1), leftcol))
+              if (!SAME_CELL(rs, toprow, leftcol, (toprow + height - 1),
+                             leftcol))
                 {
                   /* The left corners are not the same.  Check the right
                    * corners.
                    */
 
-                  if (!SAME_CELL(toprow, (leftcol + width - 1),
+                  if (!SAME_CELL(rs, toprow, (leftcol + width - 1),
                                  (toprow + height - 1), (leftcol + width - 1)))
                     {
                       /* The right corners are not the same either.  Divide the 
@@ -197,10 +251,10 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
 
                           /* Get the top middle hit */
 
-                          trv_raycast(g_pitch[toprow],
-                                      g_yaw[g_cell_column + midcol],
-                                      RELYAW(g_cell_column + midcol),
-                                      &g_ray_hit[toprow][midcol]);
+                          trv_raycast(rs, g_pitch[toprow],
+                                      g_yaw[rs->column + midcol],
+                                      RELYAW(rs->column + midcol),
+                                      &rs->hit[toprow][midcol]);
                         }
 
                       topheight = ((height + 1) >> 1);
@@ -218,33 +272,35 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
 
                           /* Get the middle left hit */
 
-                          trv_raycast(g_pitch[midrow],
-                                      g_yaw[g_cell_column + leftcol],
-                                      RELYAW(g_cell_column + leftcol),
-                                      &g_ray_hit[midrow][leftcol]);
+                          trv_raycast(rs, g_pitch[midrow],
+                                      g_yaw[rs->column + leftcol],
+                                      RELYAW(rs->column + leftcol),
+                                      &rs->hit[midrow][leftcol]);
 
                           /* Get the center hit */
 
                           if (rightwidth > 1)
                             {
-                              trv_raycast(g_pitch[midrow],
-                                          g_yaw[g_cell_column + midcol],
-                                          RELYAW(g_cell_column + midcol),
-                                          &g_ray_hit[midrow][midcol]);
+                              trv_raycast(rs, g_pitch[midrow],
+                                          g_yaw[rs->column + midcol],
+                                          RELYAW(rs->column + midcol),
+                                          &rs->hit[midrow][midcol]);
                             }
 
                           /* Get the middle right hit */
 
                           rightcol = leftcol + width - 1;
-                          trv_raycast(g_pitch[midrow],
-                                      g_yaw[g_cell_column + rightcol],
-                                      RELYAW(g_cell_column + rightcol),
-                                      &g_ray_hit[midrow][rightcol]);
+                          trv_raycast(rs, g_pitch[midrow],
+                                      g_yaw[rs->column + rightcol],
+                                      RELYAW(rs->column + rightcol),
+                                      &rs->hit[midrow][rightcol]);
                         }
 
-                      trv_resolve_cell(toprow, leftcol, topheight, leftwidth);
-                      trv_resolve_cell(toprow, midcol, topheight, rightwidth);
-                      trv_resolve_cell(midrow, leftcol, botheight, width);
+                      trv_resolve_cell(rs, toprow, leftcol, topheight,
+                                       leftwidth);
+                      trv_resolve_cell(rs, toprow, midcol, topheight,
+                                       rightwidth);
+                      trv_resolve_cell(rs, midrow, leftcol, botheight, width);
                     }
 
                   /* The left corners are not the same, but the right are.
@@ -268,18 +324,18 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
 
                           /* Get the top middle hit */
 
-                          trv_raycast(g_pitch[toprow],
-                                      g_yaw[g_cell_column + midcol],
-                                      RELYAW(g_cell_column + midcol),
-                                      &g_ray_hit[toprow][midcol]);
+                          trv_raycast(rs, g_pitch[toprow],
+                                      g_yaw[rs->column + midcol],
+                                      RELYAW(rs->column + midcol),
+                                      &rs->hit[toprow][midcol]);
 
                           /* Get the bottom middle hit */
 
                           botrow = toprow + height - 1;
-                          trv_raycast(g_pitch[botrow],
-                                      g_yaw[g_cell_column + midcol],
-                                      RELYAW(g_cell_column + midcol),
-                                      &g_ray_hit[botrow][midcol]);
+                          trv_raycast(rs, g_pitch[botrow],
+                                      g_yaw[rs->column + midcol],
+                                      RELYAW(rs->column + midcol),
+                                      &rs->hit[botrow][midcol]);
                         }
 
                       topheight = ((height + 1) >> 1);
@@ -297,25 +353,27 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
 
                           /* Get the middle left hit */
 
-                          trv_raycast(g_pitch[midrow],
-                                      g_yaw[g_cell_column + leftcol],
-                                      RELYAW(g_cell_column + leftcol),
-                                      &g_ray_hit[midrow][leftcol]);
+                          trv_raycast(rs, g_pitch[midrow],
+                                      g_yaw[rs->column + leftcol],
+                                      RELYAW(rs->column + leftcol),
+                                      &rs->hit[midrow][leftcol]);
 
                           /* Get the center hit */
 
                           if (rightwidth > 1)
                             {
-                              trv_raycast(g_pitch[midrow],
-                                          g_yaw[g_cell_column + midcol],
-                                          RELYAW(g_cell_column + midcol),
-                                          &g_ray_hit[midrow][midcol]);
+                              trv_raycast(rs, g_pitch[midrow],
+                                          g_yaw[rs->column + midcol],
+                                          RELYAW(rs->column + midcol),
+                                          &rs->hit[midrow][midcol]);
                             }
                         }
 
-                      trv_resolve_cell(toprow, leftcol, topheight, leftwidth);
-                      trv_resolve_cell(midrow, leftcol, botheight, leftwidth);
-                      trv_resolve_cell(toprow, midcol, height, rightwidth);
+                      trv_resolve_cell(rs, toprow, leftcol, topheight,
+                                       leftwidth);
+                      trv_resolve_cell(rs, midrow, leftcol, botheight,
+                                       leftwidth);
+                      trv_resolve_cell(rs, toprow, midcol, height, rightwidth);
                     }
                 }
 
@@ -339,20 +397,22 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
 
                       /* Get the top middle hit */
 
-                      trv_raycast(g_pitch[toprow], g_yaw[g_cell_column + midcol],
-                                  RELYAW(g_cell_column + midcol),
-                                  &g_ray_hit[toprow][midcol]);
+                      trv_raycast(rs, g_pitch[toprow],
+                                  g_yaw[rs->column + midcol],
+                                  RELYAW(rs->column + midcol),
+                                  &rs->hit[toprow][midcol]);
 
                       /* Get the bottom middle hit */
 
                       botrow = toprow + height - 1;
-                      trv_raycast(g_pitch[botrow], g_yaw[g_cell_column + midcol],
-                                  RELYAW(g_cell_column + midcol),
-                                  &g_ray_hit[botrow][midcol]);
+                      trv_raycast(rs, g_pitch[botrow],
+                                  g_yaw[rs->column + midcol],
+                                  RELYAW(rs->column + midcol),
+                                  &rs->hit[botrow][midcol]);
                     }
 
-                  trv_resolve_cell(toprow, leftcol, height, leftwidth);
-                  trv_resolve_cell(toprow, midcol, height, rightwidth);
+                  trv_resolve_cell(rs, toprow, leftcol, height, leftwidth);
+                  trv_resolve_cell(rs, toprow, midcol, height, rightwidth);
                 }
             }
 
@@ -360,7 +420,8 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
            * left corners
            */
 
-          else if (!SAME_CELL(toprow, leftcol, (toprow + height - 1), leftcol))
+          else if (!SAME_CELL(rs, toprow, leftcol, (toprow + height - 1),
+                              leftcol))
             {
               /* The top corners are the same, but left corners are not. Divide 
                * the cell into two cells horizontally
@@ -381,27 +442,28 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
 
                   /* Get the middle left hit */
 
-                  trv_raycast(g_pitch[midrow], g_yaw[g_cell_column + leftcol],
-                              RELYAW(g_cell_column + leftcol),
-                              &g_ray_hit[midrow][leftcol]);
+                  trv_raycast(rs, g_pitch[midrow], g_yaw[rs->column + leftcol],
+                              RELYAW(rs->column + leftcol),
+                              &rs->hit[midrow][leftcol]);
 
                   /* Get the middle right hit */
 
                   rightcol = leftcol + width - 1;
-                  trv_raycast(g_pitch[midrow], g_yaw[g_cell_column + rightcol],
-                              RELYAW(g_cell_column + rightcol),
-                              &g_ray_hit[midrow][rightcol]);
+                  trv_raycast(rs, g_pitch[midrow], g_yaw[rs->column + rightcol],
+                              RELYAW(rs->column + rightcol),
+                              &rs->hit[midrow][rightcol]);
                 }
 
-              trv_resolve_cell(toprow, leftcol, topheight, width);
-              trv_resolve_cell(midrow, leftcol, botheight, width);
+              trv_resolve_cell(rs, toprow, leftcol, topheight, width);
+              trv_resolve_cell(rs, midrow, leftcol, botheight, width);
             }
 
           /* The top and left corners are the same.  Check the lower right
            * corner
            */
 
-          else if (!SAME_CELL(toprow, leftcol, (toprow + height - 1), (leftcol + width - 1)))
+          else if (!SAME_CELL(rs, toprow, leftcol, (toprow + height - 1),
+                              (leftcol + width - 1)))
             {
               /* The lower right corner differs from all of the others.  Divide
                * the cell into three cells, retaining the left half
@@ -422,16 +484,18 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
 
                   /* Get the top middle hit */
 
-                  trv_raycast(g_pitch[toprow], g_yaw[g_cell_column + midcol],
-                              RELYAW(g_cell_column + midcol),
-                              &g_ray_hit[toprow][midcol]);
+                  trv_raycast(rs, g_pitch[toprow],
+                              g_yaw[rs->column + midcol],
+                              RELYAW(rs->column + midcol),
+                              &rs->hit[toprow][midcol]);
 
                   /* Get the bottom middle hit */
 
                   botrow = toprow + height - 1;
-                  trv_raycast(g_pitch[botrow], g_yaw[g_cell_column + midcol],
-                              RELYAW(g_cell_column + midcol),
-                              &g_ray_hit[botrow][midcol]);
+                  trv_raycast(rs, g_pitch[botrow],
+                              g_yaw[rs->column + midcol],
+                              RELYAW(rs->column + midcol),
+                              &rs->hit[botrow][midcol]);
                 }
 
               topheight = ((height + 1) >> 1);
@@ -450,23 +514,24 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
                   /* Get the middle right hit */
 
                   rightcol = leftcol + width - 1;
-                  trv_raycast(g_pitch[midrow], g_yaw[g_cell_column + rightcol],
-                              RELYAW(g_cell_column + rightcol),
-                              &g_ray_hit[midrow][rightcol]);
+                  trv_raycast(rs, g_pitch[midrow], g_yaw[rs->column + rightcol],
+                              RELYAW(rs->column + rightcol),
+                              &rs->hit[midrow][rightcol]);
 
                   /* Get the center hit */
 
                   if (rightwidth > 1)
                     {
-                      trv_raycast(g_pitch[midrow], g_yaw[g_cell_column + midcol],
-                                  RELYAW(g_cell_column + midcol),
-                                  &g_ray_hit[midrow][midcol]);
+                      trv_raycast(rs, g_pitch[midrow],
+                                  g_yaw[rs->column + midcol],
+                                  RELYAW(rs->column + midcol),
+                                  &rs->hit[midrow][midcol]);
                     }
                 }
 
-              trv_resolve_cell(toprow, leftcol, height, leftwidth);
-              trv_resolve_cell(toprow, midcol, topheight, rightwidth);
-              trv_resolve_cell(midrow, midcol, botheight, rightwidth);
+              trv_resolve_cell(rs, toprow, leftcol, height, leftwidth);
+              trv_resolve_cell(rs, toprow, midcol, topheight, rightwidth);
+              trv_resolve_cell(rs, midrow, midcol, botheight, rightwidth);
             }
 
           /* The four corners are the same! */
@@ -475,7 +540,7 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
             {
               /* Apply texturing */
 
-              trv_rend_cell(toprow, leftcol, height, width);
+              trv_rend_cell(rs, toprow, leftcol, height, width);
             }
         }
 
@@ -485,7 +550,7 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
         {
           /* Check if the endpoints of the horizontal line are the same */
 
-          if (!SAME_CELL(toprow, leftcol, toprow, (leftcol + width - 1)))
+          if (!SAME_CELL(rs, toprow, leftcol, toprow, (leftcol + width - 1)))
             {
               /* No.. they are different.  Divide the line in half */
 
@@ -504,13 +569,14 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
 
                   /* Get the middle hit */
 
-                  trv_raycast(g_pitch[toprow], g_yaw[g_cell_column + midcol],
-                              RELYAW(g_cell_column + midcol),
-                              &g_ray_hit[toprow][midcol]);
+                  trv_raycast(rs, g_pitch[toprow],
+                              g_yaw[rs->column + midcol],
+                              RELYAW(rs->column + midcol),
+                              &rs->hit[toprow][midcol]);
                 }
 
-              trv_resolve_cell(toprow, leftcol, 1, leftwidth);
-              trv_resolve_cell(toprow, midcol, 1, rightwidth);
+              trv_resolve_cell(rs, toprow, leftcol, 1, leftwidth);
+              trv_resolve_cell(rs, toprow, midcol, 1, rightwidth);
             }
 
           /* The endpoints of the horizontal line are the same! */
@@ -519,7 +585,7 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
             {
               /* Apply texturing */
 
-              trv_rend_row(toprow, leftcol, width);
+              trv_rend_row(rs, toprow, leftcol, width);
             }
         }
     }
@@ -534,7 +600,7 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
        * endpoints are the same.
        */
 
-      if (!SAME_CELL(toprow, leftcol, (toprow + height - 1), leftcol))
+      if (!SAME_CELL(rs, toprow, leftcol, (toprow + height - 1), leftcol))
         {
           /* No.. they are different.  Divide the line in half */
 
@@ -553,13 +619,13 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
 
               /* Get the middle hit */
 
-              trv_raycast(g_pitch[midrow], g_yaw[g_cell_column + leftcol],
-                          RELYAW(g_cell_column + leftcol),
-                          &g_ray_hit[midrow][leftcol]);
+              trv_raycast(rs, g_pitch[midrow], g_yaw[rs->column + leftcol],
+                          RELYAW(rs->column + leftcol),
+                          &rs->hit[midrow][leftcol]);
             }
 
-          trv_resolve_cell(toprow, leftcol, topheight, 1);
-          trv_resolve_cell(midrow, leftcol, botheight, 1);
+          trv_resolve_cell(rs, toprow, leftcol, topheight, 1);
+          trv_resolve_cell(rs, midrow, leftcol, botheight, 1);
         }
 
       /* The endpoints of the vertical line are the same! */
@@ -568,7 +634,7 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
         {
           /* Apply texturing */
 
-          trv_rend_column(toprow, leftcol, height);
+          trv_rend_column(rs, toprow, leftcol, height);
         }
     }
 
@@ -578,14 +644,268 @@ static void trv_resolve_cell(uint8_t toprow, uint8_t leftcol,
     {
       /* Apply texturing */
 
-      trv_rend_pixel(toprow, leftcol);
+      trv_rend_pixel(rs, toprow, leftcol);
+    }
+}
+
+/****************************************************************************
+ * Function: trv_ray_cells
+ *
+ * Description:
+ *   Cast and render the cells of the current horizontal swathe from the
+ *   cell at column 'first' leftward through the cell at column 'last'.
+ *   The right corners of the first cell must already be in the left
+ *   corners of the hit array.
+ *
+ ****************************************************************************/
+
+static void trv_ray_cells(FAR struct trv_raystate_s *rs, int16_t first,
+                          int16_t last)
+{
+  for (rs->column = first; rs->column >= last; rs->column -= HGULP_SIZE)
+    {
+      trv_vdebug("\ncolumn=%d yaw=%d", rs->column, g_yaw[rs->column]);
+
+      /* Perform Ray VGULP_SIZE x HGULP_SIZE Casting */
+
+      /* The hits at the right corners will be the same as the hits for for
+       * the left hand corners on the next pass
+       */
+
+      rs->hit[TOP_ROW][RIGHT_COL] = rs->hit[TOP_ROW][LEFT_COL];
+      rs->hit[BOT_ROW][RIGHT_COL] = rs->hit[BOT_ROW][LEFT_COL];
+
+      /* Now get new hits in the right corners. */
+
+      trv_raycast(rs, g_pitch[TOP_ROW], g_yaw[rs->column],
+                  RELYAW(rs->column), &rs->hit[TOP_ROW][LEFT_COL]);
+      trv_raycast(rs, g_pitch[BOT_ROW], g_yaw[rs->column],
+                  RELYAW(rs->column), &rs->hit[BOT_ROW][LEFT_COL]);
+
+      /* Now, resolve the cell recursively until the hits are the same in
+       * all four corners
+       */
+
+      trv_resolve_cell(rs, TOP_ROW, LEFT_COL, VGULP_SIZE, (HGULP_SIZE + 1));
+    }
+}
+
+/****************************************************************************
+ * Function: trv_ray_seed
+ *
+ * Description:
+ *   Seed the algorithm for a range of cells starting at column 'first'.
+ *   The hits cast here are moved to the right corners of the first cell.
+ *   They are the hits that the cell to the right would have left in the
+ *   hit array.
+ *
+ ****************************************************************************/
+
+static void trv_ray_seed(FAR struct trv_raystate_s *rs, int16_t first)
+{
+  int16_t column = first + HGULP_SIZE;
+
+  if (column > IMAGE_WIDTH)
+    {
+      column = IMAGE_WIDTH;
+    }
+
+  trv_raycast(rs, g_pitch[TOP_ROW], g_yaw[column], RELYAW(column),
+              &rs->hit[TOP_ROW][LEFT_COL]);
+  trv_raycast(rs, g_pitch[BOT_ROW], g_yaw[column], RELYAW(column),
+              &rs->hit[BOT_ROW][LEFT_COL]);
+}
+
+#if NRAYWORKERS > 1
+/****************************************************************************
+ * Function: trv_ray_swathe
+ *
+ * Description:
+ *   Cast and render the cells of one worker in the current horizontal
+ *   swathe.
+ *
+ *   Adjacent cells share a column of pixels which, when cast serially, is
+ *   left with the pixels of the cell on the left.  The column shared with
+ *   the worker to the right is saved once the first cell has been rendered
+ *   and all workers have met at g_ray_seam, before the worker to the right
+ *   renders its last cell.  trv_ray_seams() restores it when all workers
+ *   are done.
+ *
+ ****************************************************************************/
+
+static void trv_ray_swathe(FAR struct trv_rayworker_s *worker)
+{
+  FAR struct trv_raystate_s *rs = &worker->state;
+  int16_t column = worker->first + HGULP_SIZE;
+  int i;
+
+  trv_ray_seed(rs, worker->first);
+  trv_ray_cells(rs, worker->first, worker->first);
+
+  if (column <= IMAGE_WIDTH)
+    {
+      for (i = 0; i < VGULP_SIZE; i++)
+        {
+          worker->seam[i] = g_buffer_row[i][column];
+        }
+    }
+
+  (void)pthread_barrier_wait(&g_ray_seam);
+  trv_ray_cells(rs, worker->first - HGULP_SIZE, worker->last);
+}
+
+/****************************************************************************
+ * Function: trv_ray_seams
+ *
+ * Description:
+ *   Restore the columns shared by adjacent workers after all of the workers
+ *   are done with the horizontal swathe.
+ *
+ ****************************************************************************/
+
+static void trv_ray_seams(void)
+{
+  FAR struct trv_rayworker_s *worker;
+  int16_t column;
+  int i;
+  int j;
+
+  for (j = 1; j < NRAYWORKERS; j++)
+    {
+      worker = &g_rayworker[j];
+      column = worker->first + HGULP_SIZE;
+
+      for (i = 0; i < VGULP_SIZE; i++)
+        {
+          g_buffer_row[i][column] = worker->seam[i];
+        }
+    }
+}
+
+/****************************************************************************
+ * Function: trv_ray_worker
+ *
+ * Description:
+ *   The body of each ray casting worker thread.
+ *
+ ****************************************************************************/
+
+static FAR void *trv_ray_worker(FAR void *arg)
+{
+  FAR struct trv_rayworker_s *worker = (FAR struct trv_rayworker_s *)arg;
+
+  for (; ; )
+    {
+      (void)pthread_barrier_wait(&g_ray_start);
+      if (g_ray_terminate)
+        {
+          break;
+        }
+
+      trv_ray_swathe(worker);
+      (void)pthread_barrier_wait(&g_ray_done);
     }
+
+  return NULL;
 }
+#endif
 
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Function: trv_raycaster_initialize
+ *
+ * Description:
+ *   Start the ray casting workers, if any.  Each worker is given the same
+ *   share of the cells of each horizontal swathe.
+ *
+ ****************************************************************************/
+
+int trv_raycaster_initialize(void)
+{
+#if NRAYWORKERS > 1
+  struct sched_param param;
+  pthread_attr_t attr;
+  int first;
+  int last;
+  int ret;
+  int i;
+
+  if (g_ray_started)
+    {
+      return OK;
+    }
+
+  for (i = 0; i < NRAYWORKERS; i++)
+    {
+      first = (i * NUMBER_HGULPS) / NRAYWORKERS;
+      last  = ((i + 1) * NUMBER_HGULPS) / NRAYWORKERS - 1;
+
+      g_rayworker[i].first = CELL_COLUMN(first);
+      g_rayworker[i].last  = CELL_COLUMN(last);
+    }
+
+  (void)pthread_barrier_init(&g_ray_start, NULL, NRAYWORKERS);
+  (void)pthread_barrier_init(&g_ray_seam, NULL, NRAYWORKERS);
+  (void)pthread_barrier_init(&g_ray_done, NULL, NRAYWORKERS);
+
+  /* The workers run at the priority of the caller */
+
+  (void)sched_getparam(0, &param);
+  (void)pthread_attr_init(&attr);
+  (void)pthread_attr_setschedparam(&attr, &param);
+
+  g_ray_terminate = false;
+  for (i = 1; i < NRAYWORKERS; i++)
+    {
+      ret = pthread_create(&g_rayworker[i].thread, &attr, trv_ray_worker,
+                           &g_rayworker[i]);
+      if (ret != 0)
+        {
+          trv_abort("ERROR: Failed to start ray worker %d: %d\n", i, ret);
+        }
+    }
+
+  (void)pthread_attr_destroy(&attr);
+  g_ray_started = true;
+#endif
+
+  return OK;
+}
+
+/****************************************************************************
+ * Function: trv_raycaster_uninitialize
+ *
+ * Description:
+ *   Stop the ray casting workers, if any.
+ *
+ ****************************************************************************/
+
+void trv_raycaster_uninitialize(void)
+{
+#if NRAYWORKERS > 1
+  int i;
+
+  if (g_ray_started)
+    {
+      g_ray_terminate = true;
+      (void)pthread_barrier_wait(&g_ray_start);
+
+      for (i = 1; i < NRAYWORKERS; i++)
+        {
+          (void)pthread_join(g_rayworker[i].thread, NULL);
+        }
+
+      (void)pthread_barrier_destroy(&g_ray_start);
+      (void)pthread_barrier_destroy(&g_ray_seam);
+      (void)pthread_barrier_destroy(&g_ray_done);
+      g_ray_started = false;
+    }
+#endif
+}
+
 /****************************************************************************
  * Function: trv_raycaster
  *
@@ -634,13 +954,13 @@ void trv_raycaster(FAR struct trv_camera_s *player,
 
   /* Loop through all columns at each yaw angle on the screen */
 
-  for (g_cell_column = IMAGE_WIDTH; g_cell_column >= 0; g_cell_column--)
+  for (i = IMAGE_WIDTH; i >= 0; i--)
     {
       /* Save the yaw angle.  By saving all of the yaw angles, we can avoid
        * complex tests for 360 degree wraps.
        */
 
-      g_yaw[g_cell_column] = yaw;
+      g_yaw[i] = yaw;
 
       /* Test if viewing yaw angle needs to wrap around */
 
@@ -692,43 +1012,26 @@ void trv_raycaster(FAR struct trv_camera_s *player,
 
       trv_ray_pitchprune(g_pitch[VGULP_SIZE - 1], g_pitch[0]);
 
-      /* Seed the algorithm PART III: These initial hits will be moved to the
-       * beginning the hit array on the first pass through the loop.
+      /* Seed the algorithm PART III: Cast and render the cells of this
+       * horizontal swathe.
        */
 
-      trv_raycast(g_pitch[TOP_ROW], g_yaw[IMAGE_WIDTH],
-                  RELYAW(IMAGE_WIDTH), &g_ray_hit[TOP_ROW][LEFT_COL]);
-      trv_raycast(g_pitch[BOT_ROW], g_yaw[IMAGE_WIDTH],
-                  RELYAW(IMAGE_WIDTH), &g_ray_hit[BOT_ROW][LEFT_COL]);
-
-      /* Loop through all columns at each yaw angle on the screen window */
-
-      for (g_cell_column = (IMAGE_WIDTH - HGULP_SIZE + 1);
-           g_cell_column >= 0; g_cell_column -= HGULP_SIZE)
-        {
-          trv_vdebug("\ng_cell_column=%d yaw=%d", g_cell_column,
-                     g_yaw[g_cell_column]);
-
-          /* Perform Ray VGULP_SIZE x HGULP_SIZE Casting */
-
-          /* The hits at the right corners will be the same as the hits for for 
-           * the left hand corners on the next pass */
-
-          g_ray_hit[TOP_ROW][RIGHT_COL] = g_ray_hit[TOP_ROW][LEFT_COL];
-          g_ray_hit[BOT_ROW][RIGHT_COL] = g_ray_hit[BOT_ROW][LEFT_COL];
-
-          /* Now get new hits in the right corners. */
+#if NRAYWORKERS > 1
+      (void)pthread_barrier_wait(&g_ray_start);
+      trv_ray_swathe(&g_rayworker[0]);
+      (void)pthread_barrier_wait(&g_ray_done);
+      trv_ray_seams();
+#else
+      /* These initial hits will be moved to the beginning the hit array on
+       * the first pass through the loop.
+       */
 
-          trv_raycast(g_pitch[TOP_ROW], g_yaw[g_cell_column],
-                      RELYAW(g_cell_column), &g_ray_hit[TOP_ROW][LEFT_COL]);
-          trv_raycast(g_pitch[BOT_ROW], g_yaw[g_cell_column],
-                      RELYAW(g_cell_column), &g_ray_hit[BOT_ROW][LEFT_COL]);
+      trv_ray_seed(&g_raystate, CELL_COLUMN(0));
 
-          /* Now, resolve the cell recursively until the hits are the same in
-           * all four corners */
+      /* Loop through all columns at each yaw angle on the screen window */
 
-          trv_resolve_cell(TOP_ROW, LEFT_COL, VGULP_SIZE, (HGULP_SIZE + 1));
-        }
+      trv_ray_cells(&g_raystate, CELL_COLUMN(0), 0);
+#endif
 
       /* End of the pitch loop.  Bump up the pitch angle and the rending buffer 
        * pointer for the next time through the outer loop */
@@ -766,16 +1069,17 @@ void trv_raycaster(FAR struct trv_camera_s *player,
  *
  ****************************************************************************/
 
-uint8_t trv_get_texture(uint8_t row, uint8_t col)
+uint8_t trv_get_texture(FAR struct trv_raystate_s *rs, uint8_t row,
+                        uint8_t col)
 {
-  FAR struct trv_raycast_s *ptr = &g_ray_hit[row][col];
+  FAR struct trv_raycast_s *ptr = &rs->hit[row][col];
   FAR uint8_t *palptr;
   int16_t zone;
 
   /* Perform a ray cast to get the hit at this row & column */
 
-  trv_raycast(g_pitch[row], g_yaw[g_cell_column + col],
-              RELYAW(g_cell_column + col), ptr);
+  trv_raycast(rs, g_pitch[row], g_yaw[rs->column + col],
+              RELYAW(rs->column + col), ptr);
 
   /* Check if we hit anything */
 
@@ -58,18 +58,18 @@
 #define DISABLE_WALL_RENDING  0
 #define DISABLE_FLOOR_RENDING 0
 
-/* The following macros perform division (using g_invsize[]) and then a
+/* The following macros perform division (using g_inv_table[]) and then a
  * rescaling by the approprate constants so that the texture index is
  * byte aligned
  */
 
-#define TDIV(num,den,s) (((num) * g_invsize[den]) >> (s))
+#define TDIV(num,den,s) (((num) * g_inv_table[den]) >> (s))
 
 /* This macro just performs the division and leaves the result with eight
  * (more) bits of fraction
  */
 
-#define DIV8(num,den)  ((num) * g_invsize[den])
+#define DIV8(num,den)  ((num) * g_inv_table[den])
 
 /* The following macro aligns a SMALL precision number to that the texture
  * index is byte aligned
@@ -97,32 +97,25 @@ union tex_ndx_u
  * Private Function Prototypes
  ****************************************************************************/
 
-static void trv_rend_zcell(uint8_t row, uint8_t col, uint8_t height,
+static void trv_rend_zcell(FAR struct trv_raystate_s *rs,
+                           uint8_t row, uint8_t col, uint8_t height,
                            uint8_t width);
-static void trv_rend_zrow(uint8_t row, uint8_t col, uint8_t width);
-static void trv_rend_zcol(uint8_t row, uint8_t col, uint8_t height);
-static void trv_rend_zpixel(uint8_t row, uint8_t col);
-
-static void trv_rend_wall(uint8_t row, uint8_t col, uint8_t height,
+static void trv_rend_zrow(FAR struct trv_raystate_s *rs,
+                          uint8_t row, uint8_t col, uint8_t width);
+static void trv_rend_zcol(FAR struct trv_raystate_s *rs,
+                          uint8_t row, uint8_t col, uint8_t height);
+static void trv_rend_zpixel(FAR struct trv_raystate_s *rs,
+                            uint8_t row, uint8_t col);
+
+static void trv_rend_wall(FAR struct trv_raystate_s *rs,
+                          uint8_t row, uint8_t col, uint8_t height,
                           uint8_t width);
-static void trv_rend_wallrow(uint8_t row, uint8_t col, uint8_t width);
-static void trv_rend_wallcol(uint8_t row, uint8_t col, uint8_t height);
-static void trv_rend_wallpixel(uint8_t row, uint8_t col);
-
-/****************************************************************************
- * Private Data
- ****************************************************************************/
-
-/* The following array simply contains the inverted values of the integers
- * from 0...VGULP_SIZE-1.  The values in the table have 8 bits of fraction.
- * The value for 0 is bogus!
- */
-
-static const uint8_t g_invsize[VGULP_SIZE] =
-{
-  0xff, 0xff, 0x80, 0x55, 0x40, 0x33, 0x2b, 0x25,  /* 0..7 */
-  0x20, 0x1c, 0x1a, 0x17, 0x15, 0x14, 0x12, 0x11   /* 8..15 */ 
-};
+static void trv_rend_wallrow(FAR struct trv_raystate_s *rs,
+                             uint8_t row, uint8_t col, uint8_t width);
+static void trv_rend_wallcol(FAR struct trv_raystate_s *rs,
+                             uint8_t row, uint8_t col, uint8_t height);
+static void trv_rend_wallpixel(FAR struct trv_raystate_s *rs,
+                               uint8_t row, uint8_t col);
 
 /****************************************************************************
  * Private Functions
@@ -142,7 +135,9 @@ static const uint8_t g_invsize[VGULP_SIZE] =
 
 /* This version is for non-degenerate cell, i.e., height>1 and width>1 */
 
-static void trv_rend_zcell(uint8_t row, uint8_t col, uint8_t height, uint8_t width)
+static void trv_rend_zcell(FAR struct trv_raystate_s *rs,
+                           uint8_t row, uint8_t col, uint8_t height,
+                           uint8_t width)
 {
 #if (!DISABLE_FLOOR_RENDING)
   uint8_t i;
@@ -173,31 +168,31 @@ static void trv_rend_zcell(uint8_t row, uint8_t col, uint8_t height, uint8_t wid
 
   /* Displace the double buffer pointer */
 
-  outpixel = &g_buffer_row[row][g_cell_column];
+  outpixel = &g_buffer_row[row][rs->column];
 
   /* Point to the bitmap associated with the upper left pixel.  Since
    * all of the pixels in this cell are the same "hit," we don't have
    * to recalculate this
    */
 
-  if (IS_FRONT_HIT(&g_ray_hit[row][col]))
+  if (IS_FRONT_HIT(&rs->hit[row][col]))
     {
-      bmp = g_even_bitmaps[g_ray_hit[row][col].rect->texture];
+      bmp = g_even_bitmaps[rs->hit[row][col].rect->texture];
     }
   else
     {
-      bmp = g_odd_bitmaps[g_ray_hit[row][col].rect->texture];
+      bmp = g_odd_bitmaps[rs->hit[row][col].rect->texture];
     }
 
   /* Get parameters associated with the size of the bitmap texture */
 
-  texture = bmp->bm;
+  texture = GET_TEXTURE(bmp);
   tsize = bmp->log2h;
   tmask = TMASK(tsize);
 
   /* Extract the texture scaling from the rectangle structure */
 
-  scale = g_ray_hit[row][col].rect->scale;
+  scale = rs->hit[row][col].rect->scale;
 
   /* Within this function, all references to height and width are really
    * (height-1) and (width-1)
@@ -214,18 +209,18 @@ static void trv_rend_zcell(uint8_t row, uint8_t col, uint8_t height, uint8_t wid
   /* Calculate the horizontal interpolation values */
   /* This is the H starting position (first row, first column) */
 
-  hstart = TALIGN(g_ray_hit[row][col].xpos, scale);
+  hstart = TALIGN(rs->hit[row][col].xpos, scale);
 
   /* This is the change in xpos per column in the first row */
 
   hcolstep =
-    TDIV((g_ray_hit[row][endcol].xpos - g_ray_hit[row][col].xpos),
+    TDIV((rs->hit[row][endcol].xpos - rs->hit[row][col].xpos),
       width, scale);
 
   /* This is the change in xpos per column in the last row */
 
   tmpcolstep =
-    TDIV((g_ray_hit[endrow][endcol].xpos - g_ray_hit[endrow][col].xpos),
+    TDIV((rs->hit[endrow][endcol].xpos - rs->hit[endrow][col].xpos),
       width, scale);
 
   /* This is the change in hcolstep per row */
@@ -235,24 +230,24 @@ static void trv_rend_zcell(uint8_t row, uint8_t col, uint8_t height, uint8_t wid
   /* This is the change in hstart for each row */
 
   hrowstep =
-    TDIV((g_ray_hit[endrow][col].xpos - g_ray_hit[row][col].xpos),
+    TDIV((rs->hit[endrow][col].xpos - rs->hit[row][col].xpos),
       height, scale);
 
   /* Calculate the vertical interpolation values */
   /* This is the V starting position (first row, first column) */
 
-  vstart = TALIGN(g_ray_hit[row][col].ypos, scale);
+  vstart = TALIGN(rs->hit[row][col].ypos, scale);
 
   /* This is the change in ypos per column in the first row */
 
   vcolstep =
-    TDIV((g_ray_hit[row][endcol].ypos - g_ray_hit[row][col].ypos),
+    TDIV((rs->hit[row][endcol].ypos - rs->hit[row][col].ypos),
       width, scale);
 
   /* This is the change in ypos per column in the last row */
 
   tmpcolstep =
-    TDIV((g_ray_hit[endrow][endcol].ypos - g_ray_hit[endrow][col].ypos),
+    TDIV((rs->hit[endrow][endcol].ypos - rs->hit[endrow][col].ypos),
       width, scale);
 
   /* This is the change in vcolstep per row */
@@ -262,15 +257,16 @@ static void trv_rend_zcell(uint8_t row, uint8_t col, uint8_t height, uint8_t wid
   /* This is the change in vstart for each row */
 
   vrowstep =
-    TDIV((g_ray_hit[endrow][col].ypos - g_ray_hit[row][col].ypos),
+    TDIV((rs->hit[endrow][col].ypos - rs->hit[row][col].ypos),
       height, scale);
 
   /* Determine the palette mapping table zone for each row */
 
-  if (IS_SHADED(g_ray_hit[row][col].rect))
+  if (IS_SHADED(rs->hit[row][col].rect))
     {
-      zone = GET_FZONE(g_ray_hit[row][col].xdist, g_ray_hit[row][col].ydist, 8);
-      endzone = GET_FZONE(g_ray_hit[endrow][col].xdist, g_ray_hit[endrow][col].ydist, 8);
+      zone = GET_FZONE(rs->hit[row][col].xdist, rs->hit[row][col].ydist, 8);
+      endzone = GET_FZONE(rs->hit[endrow][col].xdist,
+                          rs->hit[endrow][col].ydist, 8);
       zonestep = (DIV8((endzone - zone), height) >> 8);
     }
   else
@@ -329,7 +325,8 @@ static void trv_rend_zcell(uint8_t row, uint8_t col, uint8_t height, uint8_t wid
 
 /* This version is for horizontal lines, i.e., height==1 and width>1 */
 
-static void trv_rend_zrow(uint8_t row, uint8_t col, uint8_t width)
+static void trv_rend_zrow(FAR struct trv_raystate_s *rs,
+                          uint8_t row, uint8_t col, uint8_t width)
 {
 #if (!DISABLE_FLOOR_RENDING)
   uint8_t j;
@@ -349,37 +346,37 @@ static void trv_rend_zrow(uint8_t row, uint8_t col, uint8_t width)
 
   /* Displace the double buffer pointer */
 
-  outpixel = &g_buffer_row[row][g_cell_column];
+  outpixel = &g_buffer_row[row][rs->column];
 
   /* Point to the bitmap associated with the left pixel.  Since
    * all of the pixels in this row are the same "hit," we don't have
    * to recalculate this
    */
 
-   if (IS_FRONT_HIT(&g_ray_hit[row][col]))
+   if (IS_FRONT_HIT(&rs->hit[row][col]))
     {
-      bmp = g_even_bitmaps[g_ray_hit[row][col].rect->texture];
+      bmp = g_even_bitmaps[rs->hit[row][col].rect->texture];
     }
   else
     {
-      bmp = g_odd_bitmaps[g_ray_hit[row][col].rect->texture];
+      bmp = g_odd_bitmaps[rs->hit[row][col].rect->texture];
     }
 
   /* Get parameters associated with the size of the bitmap texture */
 
-  texture = bmp->bm;
+  texture = GET_TEXTURE(bmp);
   tsize = bmp->log2h;
   tmask = TMASK(tsize);
 
   /* Extract the texture scaling from the rectangle structure */
 
-  scale = g_ray_hit[row][col].rect->scale;
+  scale = rs->hit[row][col].rect->scale;
 
   /* Get the a pointer to the palette mapping table */
 
-  if (IS_SHADED(g_ray_hit[row][col].rect))
+  if (IS_SHADED(rs->hit[row][col].rect))
     {
-      zone = GET_ZONE(g_ray_hit[row][col].xdist, g_ray_hit[row][col].ydist);
+      zone = GET_ZONE(rs->hit[row][col].xdist, rs->hit[row][col].ydist);
       palptr = GET_PALPTR(zone);
     }
   else
@@ -400,23 +397,23 @@ static void trv_rend_zrow(uint8_t row, uint8_t col, uint8_t width)
   /* Calculate the horizontal interpolation values */
   /* This is the H starting position (first column) */
 
-  xpos.w = TALIGN(g_ray_hit[row][col].xpos, scale);
+  xpos.w = TALIGN(rs->hit[row][col].xpos, scale);
 
   /* This is the change in xpos per column */
 
   hcolstep =
-    TDIV((g_ray_hit[row][endcol].xpos - g_ray_hit[row][col].xpos),
+    TDIV((rs->hit[row][endcol].xpos - rs->hit[row][col].xpos),
       width, scale);
 
   /* Calculate the vertical interpolation values */
   /* This is the V starting position (first column) */
 
-  ypos.w = TALIGN(g_ray_hit[row][col].ypos, scale);
+  ypos.w = TALIGN(rs->hit[row][col].ypos, scale);
 
   /* This is the change in ypos per column */
 
   vcolstep =
-    TDIV((g_ray_hit[row][endcol].ypos - g_ray_hit[row][col].ypos),
+    TDIV((rs->hit[row][endcol].ypos - rs->hit[row][col].ypos),
       width, scale);
 
   /* Interpolate to texture each column in the row */
@@ -437,7 +434,8 @@ static void trv_rend_zrow(uint8_t row, uint8_t col, uint8_t width)
 
 /* This version is for vertical lines, i.e., height>1 and width==1 */
 
-static void trv_rend_zcol(uint8_t row, uint8_t col, uint8_t height)
+static void trv_rend_zcol(FAR struct trv_raystate_s *rs,
+                          uint8_t row, uint8_t col, uint8_t height)
 {
 #if (!DISABLE_FLOOR_RENDING)
   uint8_t i, endrow;
@@ -456,37 +454,37 @@ static void trv_rend_zcol(uint8_t row, uint8_t col, uint8_t height)
 
   /* Displace the double buffer pointer */
 
-  outpixel = &g_buffer_row[row][g_cell_column+col];
+  outpixel = &g_buffer_row[row][rs->column+col];
 
   /* Point to the bitmap associated with the upper pixel.  Since
    * all of the pixels in this column are the same "hit," we don't have
    * to recalculate this
    */
 
-   if (IS_FRONT_HIT(&g_ray_hit[row][col]))
+   if (IS_FRONT_HIT(&rs->hit[row][col]))
     {
-      bmp = g_even_bitmaps[g_ray_hit[row][col].rect->texture];
+      bmp = g_even_bitmaps[rs->hit[row][col].rect->texture];
     }
   else
     {
-      bmp = g_odd_bitmaps[g_ray_hit[row][col].rect->texture];
+      bmp = g_odd_bitmaps[rs->hit[row][col].rect->texture];
     }
 
   /* Get parameters associated with the size of the bitmap texture */
 
-  texture = bmp->bm;
+  texture = GET_TEXTURE(bmp);
   tsize = bmp->log2h;
   tmask = TMASK(tsize);
 
   /* Extract the texture scaling from the rectangle structure */
 
-  scale = g_ray_hit[row][col].rect->scale;
+  scale = rs->hit[row][col].rect->scale;
 
   /* Get the a pointer to the palette mapping table */
 
-  if (IS_SHADED(g_ray_hit[row][col].rect))
+  if (IS_SHADED(rs->hit[row][col].rect))
     {
-      zone = GET_ZONE(g_ray_hit[row][col].xdist, g_ray_hit[row][col].ydist);
+      zone = GET_ZONE(rs->hit[row][col].xdist, rs->hit[row][col].ydist);
       palptr = GET_PALPTR(zone);
     }
   else
@@ -507,23 +505,23 @@ static void trv_rend_zcol(uint8_t row, uint8_t col, uint8_t height)
   /* Calculate the horizontal interpolation values */
   /* This is the H starting position (first row) */
 
-  xpos.w = TALIGN(g_ray_hit[row][col].xpos, scale);
+  xpos.w = TALIGN(rs->hit[row][col].xpos, scale);
 
   /* This is the change in xpos for each row */
 
   hrowstep =
-    TDIV((g_ray_hit[endrow][col].xpos - g_ray_hit[row][col].xpos),
+    TDIV((rs->hit[endrow][col].xpos - rs->hit[row][col].xpos),
       height, scale);
 
   /* Calculate the vertical interpolation values */
   /* This is the V starting position (first row) */
 
-  ypos.w = TALIGN(g_ray_hit[row][col].ypos, scale);
+  ypos.w = TALIGN(rs->hit[row][col].ypos, scale);
 
   /* This is the change in ypos for each row */
 
   vrowstep =
-    TDIV((g_ray_hit[endrow][col].ypos - g_ray_hit[row][col].ypos),
+    TDIV((rs->hit[endrow][col].ypos - rs->hit[row][col].ypos),
       height, scale);
 
   /* Now, interpolate to texture each row (vertical component) */
@@ -548,7 +546,8 @@ static void trv_rend_zcol(uint8_t row, uint8_t col, uint8_t height)
 
 /* This version is for a single pixel, i.e., height==1 and width==1 */
 
-static void trv_rend_zpixel(uint8_t row, uint8_t col)
+static void trv_rend_zpixel(FAR struct trv_raystate_s *rs,
+                            uint8_t row, uint8_t col)
 {
 #if (!DISABLE_FLOOR_RENDING)
   FAR uint8_t *palptr;
@@ -560,9 +559,9 @@ static void trv_rend_zpixel(uint8_t row, uint8_t col)
 
   /* Get the a pointer to the palette mapping table */
 
-  if (IS_SHADED(g_ray_hit[row][col].rect))
+  if (IS_SHADED(rs->hit[row][col].rect))
     {
-      zone = GET_ZONE(g_ray_hit[row][col].xdist, g_ray_hit[row][col].ydist);
+      zone = GET_ZONE(rs->hit[row][col].xdist, rs->hit[row][col].ydist);
       palptr = GET_PALPTR(zone);
     }
   else
@@ -572,23 +571,23 @@ static void trv_rend_zpixel(uint8_t row, uint8_t col)
 
   /* Point to the bitmap associated with the upper left pixel. */
 
-  if (IS_FRONT_HIT(&g_ray_hit[row][col]))
+  if (IS_FRONT_HIT(&rs->hit[row][col]))
     {
-    bmp = g_even_bitmaps[g_ray_hit[row][col].rect->texture];
+    bmp = g_even_bitmaps[rs->hit[row][col].rect->texture];
     }
   else
     {
-    bmp = g_odd_bitmaps[g_ray_hit[row][col].rect->texture];
+    bmp = g_odd_bitmaps[rs->hit[row][col].rect->texture];
     }
 
   /* Get parameters associated with the size of the bitmap texture */
 
-  texture = bmp->bm;
+  texture = GET_TEXTURE(bmp);
   tsize = bmp->log2h;
   tmask = TMASK(tsize);
 
-  g_buffer_row[row][g_cell_column+col] =
-    palptr[texture[TNDX(g_ray_hit[row][col].xpos, g_ray_hit[row][col].ypos,
+  g_buffer_row[row][rs->column+col] =
+    palptr[texture[TNDX(rs->hit[row][col].xpos, rs->hit[row][col].ypos,
                         tsize, tmask)]];
 #endif
 }
@@ -602,8 +601,8 @@ static void trv_rend_zpixel(uint8_t row, uint8_t col)
  *   to the double buffer.  These special simplifications for use on on
  *   vertical (X or Y) walls.  In this case, we can assume that:
  *
- *     g_ray_hit[row][col].xpos == g_ray_hit[row+height-1][col]
- *     g_ray_hit[row][col+width-1].xpos == g_ray_hit[row+height-1][col+width-1]
+ *     rs->hit[row][col].xpos == rs->hit[row+height-1][col]
+ *     rs->hit[row][col+width-1].xpos == rs->hit[row+height-1][col+width-1]
  *
  *   In addition to these simplifications, these functions include the
  *   added complications of handling internal INVISIBLE_PIXELs which may
@@ -613,7 +612,8 @@ static void trv_rend_zpixel(uint8_t row, uint8_t col)
 
 /* This version is for non-degenerate cell, i.e., height>1 and width>1 */
 
-static void trv_rend_wall(uint8_t row, uint8_t col,
+static void trv_rend_wall(FAR struct trv_raystate_s *rs,
+                          uint8_t row, uint8_t col,
                           uint8_t height, uint8_t width)
 {
 #if (!DISABLE_WALL_RENDING)
@@ -641,37 +641,37 @@ static void trv_rend_wall(uint8_t row, uint8_t col,
 
   /* Displace the double buffer pointer */
 
-  outpixel = &g_buffer_row[row][g_cell_column];
+  outpixel = &g_buffer_row[row][rs->column];
 
   /* Point to the bitmap associated with the upper left pixel.  Since
    * all of the pixels in this cell are the same "hit," we don't have
    * to recalculate this
    */
 
-  if (IS_FRONT_HIT(&g_ray_hit[row][col]))
+  if (IS_FRONT_HIT(&rs->hit[row][col]))
     {
-      bmp = g_even_bitmaps[g_ray_hit[row][col].rect->texture];
+      bmp = g_even_bitmaps[rs->hit[row][col].rect->texture];
     }
   else
     {
-      bmp = g_odd_bitmaps[g_ray_hit[row][col].rect->texture];
+      bmp = g_odd_bitmaps[rs->hit[row][col].rect->texture];
     }
 
   /* Get parameters associated with the size of the bitmap texture */
 
-  texture = bmp->bm;
+  texture = GET_TEXTURE(bmp);
   tsize = bmp->log2h;
   tmask = TMASK(tsize);
 
   /* Extract the texture scaling from the rectangle structure */
 
-  scale = g_ray_hit[row][col].rect->scale;
+  scale = rs->hit[row][col].rect->scale;
 
   /* Get the a pointer to the palette mapping table */
 
-  if (IS_SHADED(g_ray_hit[row][col].rect))
+  if (IS_SHADED(rs->hit[row][col].rect))
     {
-      zone = GET_ZONE(g_ray_hit[row][col].xdist, g_ray_hit[row][col].ydist);
+      zone = GET_ZONE(rs->hit[row][col].xdist, rs->hit[row][col].ydist);
       palptr = GET_PALPTR(zone);
     }
   else
@@ -694,29 +694,29 @@ static void trv_rend_wall(uint8_t row, uint8_t col,
   /* Calculate the horizontal interpolation values */
   /* This is the H starting position (first row, first column) */
 
-  hstart = TALIGN(g_ray_hit[row][col].xpos, scale);
+  hstart = TALIGN(rs->hit[row][col].xpos, scale);
 
   /* This is the change in xpos per column in the first row */
 
   hcolstep =
-    TDIV((g_ray_hit[row][endcol].xpos - g_ray_hit[row][col].xpos),
+    TDIV((rs->hit[row][endcol].xpos - rs->hit[row][col].xpos),
       width, scale);
 
   /* Calculate the vertical interpolation values */
   /* This is the V starting position (first row, first column) */
 
-  vstart = TALIGN(g_ray_hit[row][col].ypos, scale);
+  vstart = TALIGN(rs->hit[row][col].ypos, scale);
 
   /* This is the change in ypos per column in the first row */
 
   vcolstep =
-    TDIV((g_ray_hit[row][endcol].ypos - g_ray_hit[row][col].ypos),
+    TDIV((rs->hit[row][endcol].ypos - rs->hit[row][col].ypos),
       width, scale);
 
   /* This is the change in ypos per column in the last row */
 
   tmpcolstep =
-    TDIV((g_ray_hit[endrow][endcol].ypos - g_ray_hit[endrow][col].ypos),
+    TDIV((rs->hit[endrow][endcol].ypos - rs->hit[endrow][col].ypos),
       width, scale);
 
   /* This is the change in vcolstep per row */
@@ -726,7 +726,7 @@ static void trv_rend_wall(uint8_t row, uint8_t col,
   /* This is the change in vstart for each row */
 
   vrowstep =
-    TDIV((g_ray_hit[endrow][col].ypos - g_ray_hit[row][col].ypos),
+    TDIV((rs->hit[endrow][col].ypos - rs->hit[row][col].ypos),
       height, scale);
 
   /* Now, interpolate to texture each row (vertical component) */
@@ -752,11 +752,11 @@ static void trv_rend_wall(uint8_t row, uint8_t col,
            */
 
           if ((inpixel == INVISIBLE_PIXEL) &&
-              (IS_TRANSPARENT(g_ray_hit[row][col].rect)))
+              (IS_TRANSPARENT(rs->hit[row][col].rect)))
             {
               /* Check if we hit anything */
 
-              if ((inpixel = trv_get_texture(i, j)) != INVISIBLE_PIXEL)
+              if ((inpixel = trv_get_texture(rs, i, j)) != INVISIBLE_PIXEL)
                 {
                   /* Map the normal pixel and transfer the pixel at this
                    * interpolated position
@@ -797,7 +797,8 @@ static void trv_rend_wall(uint8_t row, uint8_t col,
 
 /* This version is for horizontal lines, i.e., height==1 and width>1 */
 
-static void trv_rend_wallrow(uint8_t row, uint8_t col, uint8_t width)
+static void trv_rend_wallrow(FAR struct trv_raystate_s *rs,
+                             uint8_t row, uint8_t col, uint8_t width)
 {
 #if (!DISABLE_WALL_RENDING)
   uint8_t j;
@@ -818,37 +819,37 @@ static void trv_rend_wallrow(uint8_t row, uint8_t col, uint8_t width)
 
   /* Displace the double buffer pointer */
 
-  outpixel = &g_buffer_row[row][g_cell_column];
+  outpixel = &g_buffer_row[row][rs->column];
 
   /* Point to the bitmap associated with the left pixel.  Since
    * all of the pixels in this row are the same "hit," we don't have
    * to recalculate this
    */
 
-  if (IS_FRONT_HIT(&g_ray_hit[row][col]))
+  if (IS_FRONT_HIT(&rs->hit[row][col]))
     {
-      bmp = g_even_bitmaps[g_ray_hit[row][col].rect->texture];
+      bmp = g_even_bitmaps[rs->hit[row][col].rect->texture];
     }
   else
     {
-      bmp = g_odd_bitmaps[g_ray_hit[row][col].rect->texture];
+      bmp = g_odd_bitmaps[rs->hit[row][col].rect->texture];
     }
 
   /* Get parameters associated with the size of the bitmap texture */
 
-  texture = bmp->bm;
+  texture = GET_TEXTURE(bmp);
   tsize = bmp->log2h;
   tmask = TMASK(tsize);
 
   /* Extract the texture scaling from the rectangle structure */
 
-  scale = g_ray_hit[row][col].rect->scale;
+  scale = rs->hit[row][col].rect->scale;
 
   /* Get the a pointer to the palette mapping table */
 
-  if (IS_SHADED(g_ray_hit[row][col].rect))
+  if (IS_SHADED(rs->hit[row][col].rect))
     {
-      zone = GET_ZONE(g_ray_hit[row][col].xdist, g_ray_hit[row][col].ydist);
+      zone = GET_ZONE(rs->hit[row][col].xdist, rs->hit[row][col].ydist);
       palptr = GET_PALPTR(zone);
     }
   else
@@ -869,23 +870,23 @@ static void trv_rend_wallrow(uint8_t row, uint8_t col, uint8_t width)
   /* Calculate the horizontal interpolation values */
   /* This is the H starting position (first column) */
 
-  xpos.w = TALIGN(g_ray_hit[row][col].xpos, scale);
+  xpos.w = TALIGN(rs->hit[row][col].xpos, scale);
 
   /* This is the change in xpos per column */
 
   hcolstep =
-    TDIV((g_ray_hit[row][endcol].xpos - g_ray_hit[row][col].xpos),
+    TDIV((rs->hit[row][endcol].xpos - rs->hit[row][col].xpos),
       width, scale);
 
   /* Calculate the vertical interpolation values */
   /* This is the V starting position (first column) */
 
-  ypos.w = TALIGN(g_ray_hit[row][col].ypos, scale);
+  ypos.w = TALIGN(rs->hit[row][col].ypos, scale);
 
   /* This is the change in ypos per column */
 
   vcolstep =
-    TDIV((g_ray_hit[row][endcol].ypos - g_ray_hit[row][col].ypos),
+    TDIV((rs->hit[row][endcol].ypos - rs->hit[row][col].ypos),
       width, scale);
 
   /* Interpolate to texture each column in the row */
@@ -902,11 +903,11 @@ static void trv_rend_wallrow(uint8_t row, uint8_t col, uint8_t width)
        */
 
       if ((inpixel == INVISIBLE_PIXEL) &&
-          (IS_TRANSPARENT(g_ray_hit[row][col].rect)))
+          (IS_TRANSPARENT(rs->hit[row][col].rect)))
         {
           /* Cast another ray and see if we hit anything */
 
-          if ((inpixel = trv_get_texture(row, j)) != INVISIBLE_PIXEL)
+          if ((inpixel = trv_get_texture(rs, row, j)) != INVISIBLE_PIXEL)
             {
               /* Map the normal pixel and transfer the pixel at this
                * interpolated position
@@ -934,7 +935,8 @@ static void trv_rend_wallrow(uint8_t row, uint8_t col, uint8_t width)
 
 /* This version is for vertical line, i.e., height>1 and width==1 */
 
-static void trv_rend_wallcol(uint8_t row, uint8_t col, uint8_t height)
+static void trv_rend_wallcol(FAR struct trv_raystate_s *rs,
+                             uint8_t row, uint8_t col, uint8_t height)
 {
 #if (!DISABLE_WALL_RENDING)
   uint8_t i;
@@ -954,37 +956,37 @@ static void trv_rend_wallcol(uint8_t row, uint8_t col, uint8_t height)
 
   /* Displace the double buffer pointer */
 
-  outpixel = &g_buffer_row[row][g_cell_column+col];
+  outpixel = &g_buffer_row[row][rs->column+col];
 
   /* Point to the bitmap associated with the upper pixel.  Since
    * all of the pixels in this cell are the same "hit," we don't have
    * to recalculate this
    */
 
-  if (IS_FRONT_HIT(&g_ray_hit[row][col]))
+  if (IS_FRONT_HIT(&rs->hit[row][col]))
     {
-      bmp = g_even_bitmaps[g_ray_hit[row][col].rect->texture];
+      bmp = g_even_bitmaps[rs->hit[row][col].rect->texture];
     }
   else
     {
-      bmp = g_odd_bitmaps[g_ray_hit[row][col].rect->texture];
+      bmp = g_odd_bitmaps[rs->hit[row][col].rect->texture];
     }
 
   /* Get parameters associated with the size of the bitmap texture */
 
-  texture = bmp->bm;
+  texture = GET_TEXTURE(bmp);
   tsize = bmp->log2h;
   tmask = TMASK(tsize);
 
   /* Extract the texture scaling from the rectangle structure */
 
-  scale = g_ray_hit[row][col].rect->scale;
+  scale = rs->hit[row][col].rect->scale;
 
   /* Get the a pointer to the palette mapping table */
 
-  if (IS_SHADED(g_ray_hit[row][col].rect))
+  if (IS_SHADED(rs->hit[row][col].rect))
     {
-      zone = GET_ZONE(g_ray_hit[row][col].xdist, g_ray_hit[row][col].ydist);
+      zone = GET_ZONE(rs->hit[row][col].xdist, rs->hit[row][col].ydist);
       palptr = GET_PALPTR(zone);
     }
   else
@@ -1004,17 +1006,17 @@ static void trv_rend_wallcol(uint8_t row, uint8_t col, uint8_t height)
 
   /* Calculate the horizontal interpolation values */
 
-  xpos = sFRAC(g_ray_hit[row][col].xpos >> scale);
+  xpos = sFRAC(rs->hit[row][col].xpos >> scale);
 
   /* Calculate the vertical interpolation values */
   /* This is the V starting position (first row, first column) */
 
-  ypos.w = TALIGN(g_ray_hit[row][col].ypos, scale);
+  ypos.w = TALIGN(rs->hit[row][col].ypos, scale);
 
   /* This is the change in ypos for each row */
 
   vrowstep =
-    TDIV((g_ray_hit[endrow][col].ypos - g_ray_hit[row][col].ypos),
+    TDIV((rs->hit[endrow][col].ypos - rs->hit[row][col].ypos),
       height, scale);
 
   /* Now, interpolate to texture the vertical line */
@@ -1031,11 +1033,11 @@ static void trv_rend_wallcol(uint8_t row, uint8_t col, uint8_t height)
        */
 
       if ((inpixel == INVISIBLE_PIXEL) &&
-          (IS_TRANSPARENT(g_ray_hit[row][col].rect)))
+          (IS_TRANSPARENT(rs->hit[row][col].rect)))
         {
           /* Check if we hit anything */
 
-          if ((inpixel = trv_get_texture(i, col)) != INVISIBLE_PIXEL)
+          if ((inpixel = trv_get_texture(rs, i, col)) != INVISIBLE_PIXEL)
             {
               /* Map the normal pixel and transfer the pixel at this
                * interpolated position
@@ -1066,7 +1068,8 @@ static void trv_rend_wallcol(uint8_t row, uint8_t col, uint8_t height)
 
 /* This version is for a single pixel, i.e., height==1 and width==1 */
 
-static void trv_rend_wallpixel(uint8_t row, uint8_t col)
+static void trv_rend_wallpixel(FAR struct trv_raystate_s *rs,
+                               uint8_t row, uint8_t col)
 {
 #if (!DISABLE_WALL_RENDING)
   uint8_t *palptr;
@@ -1074,9 +1077,9 @@ static void trv_rend_wallpixel(uint8_t row, uint8_t col)
 
   /* Get the a pointer to the palette mapping table */
 
-  if (IS_SHADED(g_ray_hit[row][col].rect))
+  if (IS_SHADED(rs->hit[row][col].rect))
     {
-      zone = GET_ZONE(g_ray_hit[row][col].xdist, g_ray_hit[row][col].ydist);
+      zone = GET_ZONE(rs->hit[row][col].xdist, rs->hit[row][col].ydist);
       palptr = GET_PALPTR(zone);
     }
   else
@@ -1086,19 +1089,19 @@ static void trv_rend_wallpixel(uint8_t row, uint8_t col)
 
   /* The map and transfer the pixel to the display buffer */
 
-  if (IS_FRONT_HIT(&g_ray_hit[row][col]))
+  if (IS_FRONT_HIT(&rs->hit[row][col]))
     {
-      g_buffer_row[row][g_cell_column+col] =
-        palptr[GET_FRONT_PIXEL(g_ray_hit[row][col].rect,
-                               g_ray_hit[row][col].xpos,
-                               g_ray_hit[row][col].ypos)];
+      g_buffer_row[row][rs->column+col] =
+        palptr[GET_FRONT_PIXEL(rs->hit[row][col].rect,
+                               rs->hit[row][col].xpos,
+                               rs->hit[row][col].ypos)];
     }
   else
     {
-      g_buffer_row[row][g_cell_column+col] =
-        palptr[GET_BACK_PIXEL(g_ray_hit[row][col].rect,
-                              g_ray_hit[row][col].xpos,
-                              g_ray_hit[row][col].ypos)];
+      g_buffer_row[row][rs->column+col] =
+        palptr[GET_BACK_PIXEL(rs->hit[row][col].rect,
+                              rs->hit[row][col].xpos,
+                              rs->hit[row][col].ypos)];
     }
 #endif
 }
@@ -1221,92 +1224,96 @@ void trv_rend_backdrop(FAR struct trv_camera_s *camera,
 
 /* This version is for non-degenerate cell, i.e., height>1 and width>1 */
 
-void trv_rend_cell(uint8_t row, uint8_t col, uint8_t height, uint8_t width)
+void trv_rend_cell(FAR struct trv_raystate_s *rs,
+                   uint8_t row, uint8_t col, uint8_t height, uint8_t width)
 {
   /* If the cell is visible, then put it in the off-screen buffer.
    * Otherwise, just drop it on the floor
    */
 
-  if (g_ray_hit[row][col].rect)
+  if (rs->hit[row][col].rect)
     {
       /* Apply texturing... special case for hits on floor or ceiling */
 
-      if (IS_ZRAY_HIT(&g_ray_hit[row][col]))
+      if (IS_ZRAY_HIT(&rs->hit[row][col]))
         {
-          trv_rend_zcell(row, col, height, width);
+          trv_rend_zcell(rs, row, col, height, width);
         }
       else
         {
-          trv_rend_wall(row, col, height, width);
+          trv_rend_wall(rs, row, col, height, width);
         }
     }
 }
 
 /* This version is for horizontal lines, i.e., height==1 and width>1 */
 
-void trv_rend_row(uint8_t row, uint8_t col, uint8_t width)
+void trv_rend_row(FAR struct trv_raystate_s *rs,
+                  uint8_t row, uint8_t col, uint8_t width)
 {
   /* If the cell is visible, then put it in the off-screen buffer.
    * Otherwise, just drop it on the floor
    */
 
-  if (g_ray_hit[row][col].rect)
+  if (rs->hit[row][col].rect)
     {
       /* Apply texturing... special case for hits on floor or ceiling */
 
-      if (IS_ZRAY_HIT(&g_ray_hit[row][col]))
+      if (IS_ZRAY_HIT(&rs->hit[row][col]))
         {
-          trv_rend_zrow(row, col, width);
+          trv_rend_zrow(rs, row, col, width);
         }
       else
         {
-          trv_rend_wallrow(row, col, width);
+          trv_rend_wallrow(rs, row, col, width);
         }
     }
 }
 
 /* This version is for vertical lines, i.e., height>1 and width==1 */
 
-void trv_rend_column(uint8_t row, uint8_t col, uint8_t height)
+void trv_rend_column(FAR struct trv_raystate_s *rs,
+                     uint8_t row, uint8_t col, uint8_t height)
 {
   /* If the cell is visible, then put it in the off-screen buffer.
    * Otherwise, just drop it on the floor
    */
 
-  if (g_ray_hit[row][col].rect)
+  if (rs->hit[row][col].rect)
     {
       /* Apply texturing... special case for hits on floor or ceiling */
 
-      if (IS_ZRAY_HIT(&g_ray_hit[row][col]))
+      if (IS_ZRAY_HIT(&rs->hit[row][col]))
         {
-          trv_rend_zcol(row, col, height);
+          trv_rend_zcol(rs, row, col, height);
         }
       else
         {
-          trv_rend_wallcol(row, col, height);
+          trv_rend_wallcol(rs, row, col, height);
         }
     }
 }
 
 /* This version is for a single pixel, i.e., height==1 and width==1 */
 
-void trv_rend_pixel(uint8_t row, uint8_t col)
+void trv_rend_pixel(FAR struct trv_raystate_s *rs,
+                    uint8_t row, uint8_t col)
 {
   /* If the cell is visible, then put it in the off-screen buffer.
    * Otherwise, just drop it on the floor
    */
 
-  if (g_ray_hit[row][col].rect)
+  if (rs->hit[row][col].rect)
     {
       /* Apply texturing... special case for hits on floor or ceiling */
 
-      if (IS_ZRAY_HIT(&g_ray_hit[row][col]))
+      if (IS_ZRAY_HIT(&rs->hit[row][col]))
         {
-          trv_rend_zpixel(row, col);
+          trv_rend_zpixel(rs, row, col);
         }
       else
         {
-          trv_rend_wallpixel(row, col);
+          trv_rend_wallpixel(rs, row, col);
         }
     }
 }
@@ -1322,16 +1329,18 @@ void trv_rend_pixel(uint8_t row, uint8_t col)
 trv_pixel_t trv_get_rectpixel(int16_t xpos, int16_t ypos,
                               FAR struct trv_bitmap_s *bmp, uint8_t scale)
 {
+   FAR trv_pixel_t *texture;
    uint16_t tmask;
    uint16_t tsize;
 
    /* Get parameters associated with the size of the bitmap texture */
 
-   tsize = bmp->log2h;
-   tmask = TMASK(tsize);
+   texture = GET_TEXTURE(bmp);
+   tsize   = bmp->log2h;
+   tmask   = TMASK(tsize);
 
    /* Return the texture code at this position */
 
-   return(bmp->bm[TNDX((xpos >> scale), (ypos >> scale), tsize, tmask)]);
+   return(texture[TNDX((xpos >> scale), (ypos >> scale), tsize, tmask)]);
 }
 
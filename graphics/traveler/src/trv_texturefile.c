@@ -45,7 +45,12 @@
 #include "trv_fsutils.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <errno.h>
+#if CONFIG_GRAPHICS_TRAVELER_RAYWORKERS > 1
+#  include <pthread.h>
+#endif
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -58,6 +63,16 @@
 #define MIN(a,b) ((a) < (b) ? (a) : (b))
 #define MAX(a,b) ((a) > (b) ? (a) : (b))
 
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#if CONFIG_GRAPHICS_TRAVELER_RAYWORKERS > 1
+/* Serializes the ray casting workers when they load textures */
+
+static pthread_mutex_t g_texture_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -87,6 +102,9 @@ static int trv_log2(uint16_t x)
  * Name: trv_new_texture
  *
  * Description:
+ *   Allocate the container of a texture.  The texture memory itself is not
+ *   allocated until the texture is first used.
+ *
  ****************************************************************************/
 
 static FAR struct trv_bitmap_s *
@@ -124,22 +142,13 @@ trv_new_texture(uint16_t width, uint16_t height)
       return NULL;
     }
 
-  /* Allocate the bitmap texture memory */
-
-  bitmap->bm = (trv_pixel_t*)trv_malloc(height * width * sizeof(trv_pixel_t));
-  if (!bitmap->bm)
-    {
-      fprintf(stderr, "ERROR: Failed to allocate bitmap: %u x %u x %u\n",
-              height, width, sizeof(trv_pixel_t));
-      trv_free(bitmap);
-      return NULL;
-    }
-
   /* Initialize the bitmap container */
 
   bitmap->w     = width;
   bitmap->h     = height;
   bitmap->log2h = log2h;
+  bitmap->bm    = NULL;
+  bitmap->path  = NULL;
 
   return bitmap;
 }
@@ -150,9 +159,8 @@ trv_new_texture(uint16_t width, uint16_t height)
  ****************************************************************************/
 
 static void trv_quantize_texture(FAR struct trv_graphicfile_s *gfile,
-                                 FAR struct trv_bitmap_s *bitmap)
+                                 FAR trv_pixel_t *destpixel)
 {
-  FAR trv_pixel_t *destpixel = bitmap->bm;
   struct trv_color_rgb_s pixel;
   int x;
   int y;
@@ -175,27 +183,99 @@ static void trv_quantize_texture(FAR struct trv_graphicfile_s *gfile,
  * Name: trv_read_texture
  *
  * Description:
+ *   Prepare a texture.  Only the size of the image is read here; the image
+ *   itself is read by trv_load_texture() when the texture is first drawn.
+ *   Textures that are never seen never use any memory and world startup
+ *   does not wait for all of them to be decoded.
  *
  ****************************************************************************/
 
 FAR struct trv_bitmap_s *trv_read_texture(FAR const char *filename)
 {
-  FAR struct trv_graphicfile_s *gfile;
   FAR struct trv_bitmap_s *bitmap;
+  uint16_t width;
+  uint16_t height;
+  int ret;
 
-  gfile = tvr_graphicfile_read(filename);
-  if (gfile == NULL)
+  ret = trv_graphicfile_size(filename, &width, &height);
+  if (ret < 0)
     {
       fprintf(stderr, "ERROR: Read failed for texture %s\n", filename);
       return NULL;
     }
 
-  bitmap = trv_new_texture(gfile->width, gfile->height);
+  bitmap = trv_new_texture(width, height);
   if (bitmap)
     {
-      trv_quantize_texture(gfile, bitmap);
+      bitmap->path = strdup(filename);
+      if (bitmap->path == NULL)
+        {
+          trv_free(bitmap);
+          return NULL;
+        }
     }
 
-  trv_graphicfile_free(gfile);
   return bitmap;
 }
+
+/****************************************************************************
+ * Name: trv_load_texture
+ *
+ * Description:
+ *   Read and quantize the image of a texture on its first use.  If the file
+ *   can no longer be read, the texture is replaced with a single pixel of
+ *   the ground color so that rendering can continue.
+ *
+ ****************************************************************************/
+
+FAR trv_pixel_t *trv_load_texture(FAR struct trv_bitmap_s *bitmap)
+{
+  FAR struct trv_graphicfile_s *gfile;
+  FAR trv_pixel_t *pixels;
+
+#if CONFIG_GRAPHICS_TRAVELER_RAYWORKERS > 1
+  /* Another worker may have loaded the texture while we waited */
+
+  pthread_mutex_lock(&g_texture_lock);
+  if (bitmap->bm != NULL)
+    {
+      pthread_mutex_unlock(&g_texture_lock);
+      return bitmap->bm;
+    }
+#endif
+
+  gfile = tvr_graphicfile_read(bitmap->path);
+  if (gfile != NULL && gfile->width == bitmap->w &&
+      gfile->height == bitmap->h)
+    {
+      pixels = (FAR trv_pixel_t *)
+        trv_malloc(bitmap->h * bitmap->w * sizeof(trv_pixel_t));
+      trv_quantize_texture(gfile, pixels);
+    }
+  else
+    {
+      fprintf(stderr, "ERROR: Read failed for texture %s\n", bitmap->path);
+
+      pixels        = (FAR trv_pixel_t *)trv_malloc(sizeof(trv_pixel_t));
+      *pixels       = g_ground_color;
+      bitmap->log2h = 0;
+    }
+
+  if (gfile != NULL)
+    {
+      trv_graphicfile_free(gfile);
+    }
+
+  /* The file is no longer needed.  Set the pixels last so that the other
+   * workers never see a texture that is not ready.
+   */
+
+  free(bitmap->path);
+  bitmap->path = NULL;
+  bitmap->bm   = pixels;
+
+#if CONFIG_GRAPHICS_TRAVELER_RAYWORKERS > 1
+  pthread_mutex_unlock(&g_texture_lock);
+#endif
+  return pixels;
+}
@@ -35,154 +35,216 @@
  ****************************************************************************/
 
 /****************************************************************************
- * Included files
+ * Included Files
  ****************************************************************************/
 
+#define FAR
+
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 
+#include "trv_types.h"
+#include "trv_raycast.h"
+#include "trv_trigtbl.h"
+
 /****************************************************************************
- * Included files
+ * Pre-processor Definitions
  ****************************************************************************/
 
-#define PI 3.1415926
+/* The angle units used by the tables are set by TWOPI in trv_trigtbl.h.
+ * The tables hold 12 bits of fraction.
+ */
+
+#define RADIANS(i) ((double)(i) * (2.0 * M_PI / (double)TWOPI))
+#define FIXED(x)   ((long)((x) >= 0.0 ? (x) + 0.5 : (x) - 0.5))
+
+/* Table layout:  a blank line is placed after this many lines */
+
+#define BLOCK_LINES 8
 
 /****************************************************************************
- * Included files
+ * Private Functions
  ****************************************************************************/
 
-int main(int argc, char **argv, char **envp)
-{
-  FILE *outfile;
-  double angle;
-  double valuef;
-  uint32_t value32;
-  uint16_t value16;
-  int i;
-  int j;
+/* TAN(x) is not defined at PI/2 and 3*PI/2.  Zero is substituted. */
 
-  outfile = fopen("trigtbl.tmp", "w");
-  if (!outfile)
+static long tan_value(int i)
+{
+  if (i % PI == HALFPI)
     {
-      fprintf(stderr, "Unable to open trigtbl.tmp\n");
-      exit(1);
+      return 0;
     }
 
-  fprintf(outfile, "#define TWOPI            1920\n");
-  fprintf(outfile, "#define PI                960\n");
-  fprintf(outfile, "#define HALFPI            480\n");
-  fprintf(outfile, "#define QTRPI             240\n\n");
+  return FIXED((double)dUNITY * tan(RADIANS(i)));
+}
 
-  fprintf(outfile, "const int32_t g_tan_table[PI + HALFPI + 1] =\n");
-  fprintf(outfile, "{\n");
+static long sin_value(int i)
+{
+  return FIXED((double)dUNITY * sin(RADIANS(i)));
+}
 
-  for (i = 0; i < 1440;)
-    {
-      fprintf(outfile, "  ");
-      for (j = 0; ((j < 5) && (i < 1440));)
-        {
-          angle = ((double)i) * (2.0 * PI / 1920.0);
-          valuef = (4096.0 * tan(angle));
-          if (valuef >= 0.0)
-            {
-              valuef += 0.5;
-            }
-          else
-            {
-              valuef -= 0.5;
-            }
-
-          value32 = (uint32_t)((long)(valuef));
-          fprintf(outfile, "0x%08lx", (unsigned long)value32);
-
-          i++;
-          j++;
-          if ((j < 5) && (i < 1440))
-            {
-              fprintf(outfile, ", ");
-            }
-        }
+/* 1/SIN(x) is not defined at 0, PI and 2*PI.  Zero is substituted. */
 
-      fprintf(outfile, ",\n");
+static long csc_value(int i)
+{
+  if (i % PI == 0)
+    {
+      return 0;
     }
 
-  fprintf(outfile, "  0x00000000\n");
-  fprintf(outfile, "};\n\n");
+  return FIXED((double)dUNITY / sin(RADIANS(i)));
+}
+
+/* 1/x with 8 bits of fraction, saturated to 8 bits.  1/0 is bogus. */
+
+static long inv_value(int i)
+{
+  long value = i == 0 ? 255 : FIXED(256.0 / (double)i);
+  return value > 255 ? 255 : value;
+}
+
+static void gen_table(FILE *outfile, const char *decl, int nvalues,
+                      int perline, int ndigits, long (*value)(int))
+{
+  unsigned long mask = ndigits >= 8 ? 0xffffffffUL :
+                       (1UL << (4 * ndigits)) - 1;
+  int line;
+  int i;
 
-  fprintf(outfile, "const int16_t g_sin_table[TWOPI + HALFPI + 1] =\n");
-  fprintf(outfile, "{\n");
+  fprintf(outfile, "%s =\n{\n", decl);
 
-  for (i = 0; i < 2400;)
+  for (i = 0, line = 0; i < nvalues; line++)
     {
-      fprintf(outfile, "  ");
-      for (j = 0; ((j < 8) && (i < 2400));)
+      int j;
+
+      if (line > 0 && (line % BLOCK_LINES) == 0)
         {
-          angle = ((double)i) * (2.0 * PI / 1920.0);
-          valuef = (4096.0 * sin(angle));
-          if (valuef >= 0.0)
-            {
-              valuef += 0.5;
-            }
-          else
-            {
-              valuef -= 0.5;
-            }
-
-          value16 = (uint16_t)((long)(valuef));
-          fprintf(outfile, "0x%04x", (unsigned int)value16);
-
-          i++;
-          j++;
-          if ((j < 8) && (i < 2400))
-            {
-              fprintf(outfile, ", ");
-            }
+          fprintf(outfile, "\n");
         }
 
-      fprintf(outfile, ",\n");
+      fprintf(outfile, " ");
+      for (j = 0; j < perline && i < nvalues; j++, i++)
+        {
+          fprintf(outfile, " 0x%0*lx%s", ndigits,
+                  (unsigned long)value(i) & mask,
+                  i < nvalues - 1 ? "," : "");
+        }
+
+      fprintf(outfile, "\n");
     }
 
-  fprintf(outfile, "  0x1000\n");
   fprintf(outfile, "};\n\n");
+}
 
-  fprintf(outfile, "const int32_t cscTable[TWOPI + HALFPI + 1] =\n");
-  fprintf(outfile, "{\n");
+static void show_usage(const char *progname)
+{
+  fprintf(stderr, "USAGE: %s [<outfile>]\n", progname);
+  fprintf(stderr, "The C tables are written to stdout if no <outfile> is "
+                  "given\n");
+  exit(EXIT_FAILURE);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
 
-  for (i = 0; i < 2400;)
+int main(int argc, char **argv, char **envp)
+{
+  FILE *outfile;
+
+  if (argc > 2)
+    {
+      show_usage(argv[0]);
+    }
+
+  if (argc == 2)
     {
-      fprintf(outfile, "  ");
-      for (j = 0; ((j < 5) && (i < 2400));)
+      outfile = fopen(argv[1], "w");
+      if (!outfile)
         {
-          angle = ((double)i) * (2.0 * PI / 1920.0);
-          valuef = (4096.0 / sin(angle));
-          if (valuef >= 0.0)
-            {
-              valuef += 0.5;
-            }
-          else
-            {
-              valuef -= 0.5;
-            }
-
-          value32 = (uint32_t)((long)(valuef));
-          fprintf(outfile, "0x%08lx", (unsigned long)value32);
-
-          i++;
-          j++;
-          if ((j < 5) && (i < 2400))
-            {
-              fprintf(outfile, ", ");
-            }
+          fprintf(stderr, "Unable to open %s\n", argv[1]);
+          exit(EXIT_FAILURE);
         }
-
-      fprintf(outfile, ",\n");
+    }
+  else
+    {
+      outfile = stdout;
     }
 
-  fprintf(outfile, "  0x00001000\n");
-  fprintf(outfile, "};\n\n");
+  fprintf(outfile,
+    "/****************************************************************************\n"
+    " * apps/graphics/traveler/trv_trigtbl.c\n"
+    " * Provides look-up tables for trigonometric functions and reciprocals.\n"
+    " *\n"
+    " * Auto-generated by tools/misc/mktrig.c.  Do not edit.\n"
+    " *\n"
+    " ****************************************************************************/\n"
+    "\n"
+    "/****************************************************************************\n"
+    " * Included Files\n"
+    " ****************************************************************************/\n"
+    "\n"
+    "#include \"trv_types.h\"\n"
+    "#include \"trv_trigtbl.h\"\n"
+    "\n"
+    "/****************************************************************************\n"
+    " * Public Data\n"
+    " ****************************************************************************/\n"
+    "\n");
+
+  fprintf(outfile,
+    "/* This is TAN lookup table.  NOTES:\n"
+    " * 1. The index ranges in value from 0 to 3*PI/2-1.\n"
+    " * 2. Values in the range PI to 2*PI can be obtained from TAN(x) = TAN(x-PI).\n"
+    " * 3. The values obtain from the table have 12 bits of fraction.\n"
+    " * 4. COT(x) = 1/TAN(x) = TAN(90-X)\n"
+    " * 5. TAN(PI/2) is not defined (zero substituted).\n"
+    " */\n\n");
+
+  gen_table(outfile, "const int32_t g_tan_table[PI + HALFPI + 1]",
+            PI + HALFPI + 1, 5, 8, tan_value);
+
+  fprintf(outfile,
+    "/* This is SIN lookup table.  NOTE:\n"
+    " * 1. The index ranges in value from 0 to 3*PI/2-1.\n"
+    " * 2. The value obtain from the table have 12 bits of fraction.\n"
+    " * 3. COS(x) = SIN(x + HALFPI)\n"
+    " */\n\n");
+
+  gen_table(outfile, "const int16_t g_sin_table[TWOPI + HALFPI + 1]",
+            TWOPI + HALFPI + 1, 8, 4, sin_value);
+
+  fprintf(outfile,
+    "/* This is CSC = 1/SIN lookup table.  NOTES:\n"
+    " * 1. The index ranges in value from 0 to 3*PI/2-1.\n"
+    " * 2. The value obtain from the table has 12 bits of fraction.\n"
+    " * 3. This value is used to calculate distance from:\n"
+    " *\n"
+    " *    distance = distanceY * g_csc_table[angle]\n"
+    " * 4. 1/SIN(0) and 1/SIN(PI) are not defined.  The value ZERO is place\n"
+    " *    in the table -- Zero resulting range is a cue to take some other\n"
+    " *    kind of action!\n"
+    " * 5. 1/COS(x) = 1/SIN(x + HALFPI)\n"
+    " */\n\n");
+
+  gen_table(outfile, "const int32_t g_csc_table[TWOPI + HALFPI + 1]",
+            TWOPI + HALFPI + 1, 5, 8, csc_value);
+
+  fprintf(outfile,
+    "/* The following array simply contains the inverted values of the integers\n"
+    " * from 0...VGULP_SIZE-1.  The values in the table have 8 bits of fraction.\n"
+    " * The value for 0 is bogus!\n"
+    " */\n\n");
+
+  gen_table(outfile, "const uint8_t g_inv_table[VGULP_SIZE]",
+            VGULP_SIZE, 8, 2, inv_value);
+
+  if (outfile != stdout)
+    {
+      fclose(outfile);
+    }
 
-  fclose(outfile);
   return 0;
 }
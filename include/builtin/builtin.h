@@ -104,6 +104,112 @@ extern "C"
 int exec_builtin(FAR const char *appname, FAR char * const *argv,
                  FAR const char *redirfile, int oflags);
 
+/****************************************************************************
+ * Name: exec_builtin_closefds
+ *
+ * Description:
+ *   Like exec_builtin(), but the new task does not inherit some file
+ *   descriptors of the caller.  NSH uses this to keep the FIFO ends that
+ *   it holds for a pipeline out of the commands of the pipeline, whose
+ *   readers would otherwise never see the end of file.
+ *
+ * Input Parameter:
+ *   closefds - The file descriptors to close in the new task.
+ *   nclose   - The number of file descriptors in closefds[].
+ *              The other parameters are those of exec_builtin().
+ *
+ * Returned Value:
+ *   The same as exec_builtin().
+ *
+ ****************************************************************************/
+
+int exec_builtin_closefds(FAR const char *appname, FAR char * const *argv,
+                          FAR const char *redirfile, int oflags,
+                          FAR const int *closefds, int nclose);
+
+/****************************************************************************
+ * Name: builtin_find
+ *
+ * Description:
+ *   Find the index of the builtin application with the given name.  The
+ *   builtin table is generated in sorted order so that this is a binary
+ *   search.
+ *
+ * Input Parameter:
+ *   name - Name of the builtin application
+ *
+ * Returned Value:
+ *   The index of the builtin application on success; -ENOENT if there is
+ *   no builtin application with that name.
+ *
+ ****************************************************************************/
+
+int builtin_find(FAR const char *name);
+
+/****************************************************************************
+ * Name: builtin_nextmatch
+ *
+ * Description:
+ *   Find the next builtin application whose name begins with the first
+ *   namelen characters of name.  This is used by the readline tab-
+ *   completion logic.  In the sorted table, all matching names form one
+ *   range that is located with a binary search on the first call; each
+ *   following call is then a single comparison.
+ *
+ * Input Parameter:
+ *   name    - The partial name to be matched
+ *   namelen - The number of characters of name to match (at least one)
+ *   index   - Zero to find the first match; one more than the index of the
+ *             previous match to find the next one.
+ *
+ * Returned Value:
+ *   The index of the matching builtin application; -ENOENT if there are
+ *   no more matches.
+ *
+ ****************************************************************************/
+
+int builtin_nextmatch(FAR const char *name, size_t namelen, int index);
+
+/****************************************************************************
+ * Name: builtin_pool_exec
+ *
+ * Description:
+ *   Run a builtin application that is listed in CONFIG_BUILTIN_POOL_APPS
+ *   on a pre-started worker task instead of spawning a new task, and wait
+ *   for it to finish.  A worker uses the stdin, stdout and stderr of the
+ *   task that started it, so each calling task gets workers of its own;
+ *   they are started on first use and reused after that.
+ *
+ *   The builtin runs with its own priority and name, but it shares the
+ *   worker's task group: its open files, environment and working directory
+ *   and anything it leaves allocated persist from one run to the next.
+ *   Only list builtins that clean up after themselves.
+ *
+ *   Do not call this while the standard streams of the caller are
+ *   temporarily redirected (for example to a pipe): The builtin would not
+ *   see the redirection, and a worker started at that time would keep the
+ *   redirected streams for good.
+ *
+ * Input Parameter:
+ *   appname - Name of the builtin application
+ *   argv    - Argument list, argv[0] is the application name
+ *   status  - Location to return the value returned by the builtin's main()
+ *             (or passed to exit())
+ *
+ * Returned Value:
+ *   OK if the builtin ran.  A negated errno value if it could not run in
+ *   the pool and must be started with exec_builtin() instead: -ENOENT if
+ *   it is not listed, -E2BIG if it needs a larger stack than the workers
+ *   have, -EBUSY if all workers are in use, or the error from starting a
+ *   worker.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILTIN_POOL
+int builtin_pool_exec(FAR const char *appname, FAR char * const *argv,
+                      FAR int *status);
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -0,0 +1,204 @@
+/****************************************************************************
+ * include/canutils/canard_dsdl.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_CANUTILS_CANARD_DSDL_H
+#define __APPS_INCLUDE_CANUTILS_CANARD_DSDL_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <nuttx/compiler.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <canard.h>
+
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/* These are the helpers used by the (de)serializers that mkdsdl.sh
+ * generates from DSDL definitions.  The generated code calls them with the
+ * bit offset and length of each field as constants, so once they are
+ * inlined the compiler keeps only the path that fits the field.
+ */
+
+/****************************************************************************
+ * Name: canard_dsdl_put
+ *
+ * Description:
+ *   Store the low len bits of value at bit offset bit of a buffer that was
+ *   cleared beforehand.  Byte aligned fields are stored directly in the
+ *   little-endian byte order of UAVCAN, fields within one byte are OR'ed
+ *   in and anything else goes through canardEncodeScalar().
+ *
+ ****************************************************************************/
+
+static inline inline_function void canard_dsdl_put(FAR uint8_t *buffer,
+                                                   uint32_t bit, uint8_t len,
+                                                   uint64_t value)
+{
+  uint8_t u8;
+  uint16_t u16;
+  uint32_t u32;
+  int i;
+
+  if (((bit | len) & 7) == 0)
+    {
+      for (i = 0; i < len / 8; i++)
+        {
+          buffer[bit / 8 + i] = (uint8_t)(value >> (8 * i));
+        }
+    }
+  else if ((bit & 7) + len <= 8)
+    {
+      buffer[bit / 8] |= (uint8_t)((value & ((1u << len) - 1)) <<
+                                   (8 - (bit & 7) - len));
+    }
+  else if (len <= 8)
+    {
+      u8 = (uint8_t)value;
+      canardEncodeScalar(buffer, bit, len, &u8);
+    }
+  else if (len <= 16)
+    {
+      u16 = (uint16_t)value;
+      canardEncodeScalar(buffer, bit, len, &u16);
+    }
+  else if (len <= 32)
+    {
+      u32 = (uint32_t)value;
+      canardEncodeScalar(buffer, bit, len, &u32);
+    }
+  else
+    {
+      canardEncodeScalar(buffer, bit, len, &value);
+    }
+}
+
+/****************************************************************************
+ * Name: canard_dsdl_get
+ *
+ * Description:
+ *   Return the len bit field at bit offset bit of a received transfer,
+ *   sign extended if is_signed is set.  The caller has checked that the
+ *   transfer is long enough.  Received payloads are split over several
+ *   blocks, so this always goes through canardDecodeScalar().
+ *
+ ****************************************************************************/
+
+static inline inline_function uint64_t
+canard_dsdl_get(FAR CanardRxTransfer *transfer, uint32_t bit, uint8_t len,
+                bool is_signed)
+{
+  bool b;
+  uint8_t u8;
+  uint16_t u16;
+  uint32_t u32;
+  uint64_t u64;
+
+  if (len == 1)
+    {
+      canardDecodeScalar(transfer, bit, len, false, &b);
+      return b;
+    }
+  else if (len <= 8)
+    {
+      canardDecodeScalar(transfer, bit, len, is_signed, &u8);
+      return is_signed ? (uint64_t)(int8_t)u8 : u8;
+    }
+  else if (len <= 16)
+    {
+      canardDecodeScalar(transfer, bit, len, is_signed, &u16);
+      return is_signed ? (uint64_t)(int16_t)u16 : u16;
+    }
+  else if (len <= 32)
+    {
+      canardDecodeScalar(transfer, bit, len, is_signed, &u32);
+      return is_signed ? (uint64_t)(int32_t)u32 : u32;
+    }
+  else
+    {
+      canardDecodeScalar(transfer, bit, len, is_signed, &u64);
+      return u64;
+    }
+}
+
+/****************************************************************************
+ * Name: canard_dsdl_f32bits, canard_dsdl_f64bits, canard_dsdl_f32 and
+ *       canard_dsdl_f64
+ *
+ * Description:
+ *   Move IEEE 754 values to and from their bit patterns.
+ *
+ ****************************************************************************/
+
+static inline inline_function uint32_t canard_dsdl_f32bits(float value)
+{
+  uint32_t bits;
+
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+static inline inline_function uint64_t canard_dsdl_f64bits(double value)
+{
+  uint64_t bits;
+
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+static inline inline_function float canard_dsdl_f32(uint32_t bits)
+{
+  float value;
+
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+static inline inline_function double canard_dsdl_f64(uint64_t bits)
+{
+  double value;
+
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+#endif /* __APPS_INCLUDE_CANUTILS_CANARD_DSDL_H */
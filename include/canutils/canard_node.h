@@ -0,0 +1,239 @@
+/****************************************************************************
+ * include/canutils/canard_node.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_CANUTILS_CANARD_NODE_H
+#define __APPS_INCLUDE_CANUTILS_CANARD_NODE_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <nuttx/can/can.h>
+
+#include <canard.h>
+#include "canutils/canlib.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Configuration ************************************************************/
+
+#ifndef CONFIG_LIBCANARD_CLEANUP_USEC
+#  define CONFIG_LIBCANARD_CLEANUP_USEC 1000000
+#endif
+
+#ifndef CONFIG_LIBCANARD_NIFACES
+#  define CONFIG_LIBCANARD_NIFACES 1
+#endif
+
+#ifndef CONFIG_LIBCANARD_DEDUP_USEC
+#  define CONFIG_LIBCANARD_DEDUP_USEC 10000
+#endif
+
+/* Size of the table of recently received frames used to drop the copies
+ * that arrive over the redundant interfaces.
+ */
+
+#define CANARD_NODE_DEDUP_BITS 5
+#define CANARD_NODE_DEDUP_SIZE (1 << CANARD_NODE_DEDUP_BITS)
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* One CAN device of a node.  TX frames are packed into the write buffer
+ * of every interface; whatever a full TX FIFO did not accept stays in that
+ * buffer for the next flush.
+ */
+
+struct canard_iface_s
+{
+  int fd;                      /* Non-blocking CAN device descriptor */
+  bool failed;                 /* The device reported a fatal error */
+  uint16_t txlen;              /* Bytes pending in txbuf */
+  uint32_t rxframes;           /* Frames handed to libcanard */
+  uint32_t rxdups;             /* Frames dropped as redundant copies */
+  uint32_t rxerrors;           /* Error reports and read failures */
+  uint32_t txframes;           /* Frames accepted by the driver */
+  uint32_t txbatches;          /* write() calls that moved frames */
+  uint32_t txdropped;          /* Frames not queued for lack of room */
+  uint32_t txerrors;           /* Failed write() calls */
+  uint8_t txbuf[CONFIG_CANUTILS_CANLIB_BATCH * CAN_MSGLEN(8)];
+};
+
+/* A recently received frame */
+
+struct canard_dedup_s
+{
+  uint32_t id;                 /* libcanard frame ID, zero if unused */
+  uint8_t  iface;              /* Interface it arrived on */
+  uint8_t  len;                /* Data length */
+  uint8_t  data[8];            /* Data, including the UAVCAN tail byte */
+  uint64_t time;               /* Arrival time (usec) */
+};
+
+/* A libcanard node bound to one or more redundant CAN devices.  Every
+ * transfer is sent on all of them, and the first copy of each received
+ * frame is passed to the single libcanard instance.
+ */
+
+struct canard_node_s
+{
+  FAR CanardInstance *ins;     /* The libcanard instance served */
+  uint8_t niface;              /* Number of interfaces in use */
+  bool rxseen;                 /* Frames received since the last cleanup */
+  uint64_t cleanup;            /* Earliest time for the next cleanup (usec) */
+  struct canard_iface_s iface[CONFIG_LIBCANARD_NIFACES];
+#if CONFIG_LIBCANARD_NIFACES > 1
+  struct canard_dedup_s dedup[CANARD_NODE_DEDUP_SIZE];
+#endif
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: canard_node_init
+ *
+ * Description:
+ *   Open one or more redundant CAN devices in non-blocking mode and bind
+ *   them to a libcanard instance.
+ *
+ * Input Parameters:
+ *   node     - the node state to initialize
+ *   ins      - the libcanard instance, set up with canardInit()
+ *   devpaths - paths of the CAN devices, e.g. "/dev/can0"
+ *   ndevs    - number of entries in devpaths, at most
+ *              CONFIG_LIBCANARD_NIFACES
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success.  Otherwise -1 (ERROR) is returned
+ *   with the errno variable set to indicate the nature of the error.
+ *
+ ****************************************************************************/
+
+int canard_node_init(FAR struct canard_node_s *node,
+                     FAR CanardInstance *ins,
+                     FAR const char * const *devpaths, int ndevs);
+
+/****************************************************************************
+ * Name: canard_node_close
+ *
+ * Description:
+ *   Close the CAN devices of a node.  Frames still queued are discarded.
+ *
+ ****************************************************************************/
+
+void canard_node_close(FAR struct canard_node_s *node);
+
+/****************************************************************************
+ * Name: canard_node_flush
+ *
+ * Description:
+ *   Move as much of the libcanard TX queue as the drivers accept, one
+ *   batch of up to CONFIG_CANUTILS_CANLIB_BATCH frames per write() and
+ *   interface.  Each frame is popped once and queued on every working
+ *   interface.  An interface whose TX FIFO cannot keep up loses the frame
+ *   (counted in txdropped) rather than holding back the others.
+ *
+ * Returned Value:
+ *   A bit mask of the interfaces with frames still waiting for room in
+ *   their TX FIFO is returned; zero means everything was handed to the
+ *   drivers.  -1 (ERROR) is returned with errno set to EIO if no interface
+ *   works anymore.
+ *
+ ****************************************************************************/
+
+int canard_node_flush(FAR struct canard_node_s *node);
+
+/****************************************************************************
+ * Name: canard_node_spin
+ *
+ * Description:
+ *   Run the node until the given deadline: flush TX, sleep in a single
+ *   poll() until a device is readable, a TX FIFO drains or the deadline
+ *   passes, and hand every received frame to libcanard.  A frame that
+ *   arrived on another interface within CONFIG_LIBCANARD_DEDUP_USEC is
+ *   dropped as a redundant copy.  An interface that fails is counted and
+ *   left out; the node only fails when all of them have.  Stale transfers are cleaned
+ *   up at most every CONFIG_LIBCANARD_CLEANUP_USEC, and only when frames
+ *   were received since the last cleanup.
+ *
+ * Input Parameters:
+ *   node     - the node to run
+ *   deadline - monotonic time (usec, see canard_node_now()) to return at
+ *
+ * Returned Value:
+ *   Zero (OK) is returned once the deadline has passed.  Otherwise -1
+ *   (ERROR) is returned with the errno variable set to indicate the
+ *   nature of the error.
+ *
+ ****************************************************************************/
+
+int canard_node_spin(FAR struct canard_node_s *node, uint64_t deadline);
+
+/****************************************************************************
+ * Name: canard_node_now
+ *
+ * Description:
+ *   Return the monotonic time in microseconds used for deadlines and RX
+ *   timestamps.
+ *
+ ****************************************************************************/
+
+uint64_t canard_node_now(void);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __APPS_INCLUDE_CANUTILS_CANARD_NODE_H */
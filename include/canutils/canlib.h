@@ -43,12 +43,36 @@
 
 #include <nuttx/config.h>
 
+#include <sys/time.h>
 #include <stdbool.h>
+#include <stdint.h>
+
+#include <nuttx/can/can.h>
 
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* Configuration ************************************************************/
+
+#ifndef CONFIG_CANUTILS_CANLIB_BATCH
+#  define CONFIG_CANUTILS_CANLIB_BATCH 16
+#endif
+
+#ifndef CONFIG_CANUTILS_CANLIB_MAXFDS
+#  define CONFIG_CANUTILS_CANLIB_MAXFDS 4
+#endif
+
+/* The driver returns received messages packed back-to-back, each only as
+ * long as its header plus its used data bytes.  canlib_readmsgs() bounds
+ * each read() so that no more than the requested number of messages can
+ * come back, which needs room for at least one full length message.  This
+ * is the smallest batch that satisfies that.
+ */
+
+#define CANLIB_MINBATCH \
+  ((sizeof(struct can_msg_s) + CAN_MSGLEN(0) - 1) / CAN_MSGLEN(0))
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -182,6 +206,163 @@ int canlib_setsilent(int fd, bool silent);
 
 int canlib_getsilent(int fd, FAR bool *silent);
 
+/****************************************************************************
+ * Name: canlib_dlc2bytes
+ *
+ * Description:
+ *   Return the number of data bytes carried by a message with the given
+ *   DLC.  Classic CAN DLCs above 8 still carry 8 bytes; CAN FD DLCs above
+ *   8 carry up to 64 bytes.
+ *
+ * Input Parameter:
+ *   dlc - the 4-bit data length code of a message
+ *
+ * Returned Value:
+ *   The number of data bytes in the message.
+ *
+ ****************************************************************************/
+
+int canlib_dlc2bytes(int dlc);
+
+/****************************************************************************
+ * Name: canlib_readmsgs
+ *
+ * Description:
+ *   Receive up to nmsgs CAN messages with a single read() call and unpack
+ *   them into an array of struct can_msg_s.  At most
+ *   CONFIG_CANUTILS_CANLIB_BATCH messages are moved per call.
+ *
+ *   The size of each read is bounded by the smallest packed message so the
+ *   driver can never return more messages than fit in the array.  A batch
+ *   of full length messages is therefore shorter than nmsgs, and nmsgs must
+ *   be at least CANLIB_MINBATCH.
+ *
+ * Input Parameter:
+ *   fd    - file descriptor of an opened can device
+ *   msgs  - array that receives the messages
+ *   nmsgs - number of entries in msgs
+ *
+ * Returned Value:
+ *   The number of messages received is returned on success; this blocks
+ *   for the first message unless fd is non-blocking.  Otherwise -1 (ERROR)
+ *   is returned with the errno variable set to indicate the nature of the
+ *   error.
+ *
+ ****************************************************************************/
+
+int canlib_readmsgs(int fd, FAR struct can_msg_s *msgs, int nmsgs);
+
+/****************************************************************************
+ * Name: canlib_writemsgs
+ *
+ * Description:
+ *   Queue nmsgs CAN messages for transmission, packing up to
+ *   CONFIG_CANUTILS_CANLIB_BATCH of them at a time into a single write()
+ *   call.
+ *
+ * Input Parameter:
+ *   fd    - file descriptor of an opened can device
+ *   msgs  - array of messages to send
+ *   nmsgs - number of entries in msgs
+ *
+ * Returned Value:
+ *   The number of messages queued is returned on success.  This is less
+ *   than nmsgs only if fd is non-blocking and the TX FIFO filled up.  If
+ *   no message could be queued, -1 (ERROR) is returned with the errno
+ *   variable set to indicate the nature of the error.
+ *
+ ****************************************************************************/
+
+int canlib_writemsgs(int fd, FAR const struct can_msg_s *msgs, int nmsgs);
+
+/****************************************************************************
+ * Name: canlib_waitmsgs
+ *
+ * Description:
+ *   Wait until at least one of several CAN devices has a message to read.
+ *
+ * Input Parameter:
+ *   fds     - array of file descriptors of opened can devices
+ *   nfds    - number of entries in fds, at most
+ *             CONFIG_CANUTILS_CANLIB_MAXFDS
+ *   timeout - time to wait in milliseconds, or -1 to wait forever
+ *   ready   - set to a bit mask with bit n set if fds[n] can be read or has
+ *             an error pending
+ *
+ * Returned Value:
+ *   The number of ready devices is returned on success, or zero if the
+ *   timeout expired.  Otherwise -1 (ERROR) is returned with the errno
+ *   variable set to indicate the nature of the error.
+ *
+ ****************************************************************************/
+
+int canlib_waitmsgs(FAR const int *fds, int nfds, int timeout,
+                    FAR uint32_t *ready);
+
+/****************************************************************************
+ * Name: canlib_addfilter
+ *
+ * Description:
+ *   Wrapper for CANIOC_ADD_STDFILTER and CANIOC_ADD_EXTFILTER.  Accept the
+ *   messages whose ID matches id in every bit that is set in mask.
+ *
+ * Input Parameter:
+ *   fd    - file descriptor of an opened can device
+ *   extid - true for a 29-bit extended ID filter
+ *   id    - the ID to match
+ *   mask  - the ID bits that must match
+ *
+ * Returned Value:
+ *   The non-negative filter ID is returned on success.  Otherwise -1
+ *   (ERROR) is returned with the errno variable set to indicate the
+ *   nature of the error.
+ *
+ ****************************************************************************/
+
+int canlib_addfilter(int fd, bool extid, uint32_t id, uint32_t mask);
+
+/****************************************************************************
+ * Name: canlib_delfilter
+ *
+ * Description:
+ *   Wrapper for CANIOC_DEL_STDFILTER and CANIOC_DEL_EXTFILTER.
+ *
+ * Input Parameter:
+ *   fd     - file descriptor of an opened can device
+ *   extid  - true for a 29-bit extended ID filter
+ *   filter - the filter ID returned by canlib_addfilter()
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success.  Otherwise -1 (ERROR)
+ *   is returned with the errno variable set to indicate the
+ *   nature of the error.
+ *
+ ****************************************************************************/
+
+int canlib_delfilter(int fd, bool extid, int filter);
+
+/****************************************************************************
+ * Name: canlib_gettimestamp
+ *
+ * Description:
+ *   Return the time at which the driver received a message.
+ *
+ * Input Parameter:
+ *   msg - a message returned by read() or canlib_readmsgs()
+ *   ts  - location to return the receive time
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success.  Otherwise -1 (ERROR)
+ *   is returned with the errno variable set to indicate the
+ *   nature of the error.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_CAN_TIMESTAMP
+int canlib_gettimestamp(FAR const struct can_msg_s *msg,
+                        FAR struct timeval *ts);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
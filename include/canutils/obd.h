@@ -48,8 +48,36 @@
 #include <fcntl.h>
 #include <errno.h>
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include <nuttx/can/can.h>
 
+#include "canutils/obd_pid.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Configuration ************************************************************/
+
+#ifndef CONFIG_LIBOBD2_MAXPAYLOAD
+#  define CONFIG_LIBOBD2_MAXPAYLOAD 64
+#endif
+
+#ifndef CONFIG_LIBOBD2_TIMEOUT
+#  define CONFIG_LIBOBD2_TIMEOUT 100
+#endif
+
+/* Decoded PID values are fixed point with this many units per unit */
+
+#define OBD_PID_SCALE 1000
+
+/* PID description flags */
+
+#define OBD_PIDF_RAW    (1 << 0)     /* Bit-encoded, returned unscaled      */
+#define OBD_PIDF_SIGNED (1 << 1)     /* Value bytes are two's complement    */
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -71,13 +99,90 @@ struct obd_dev_s
   struct  canioc_bittiming_s can_bt; /* Current bitrate                     */
   uint8_t can_mode;                  /* Current mode (Standard or Extended) */
   int     can_fd;                    /* File Descriptor of CAN Device       */
-#ifdef CONFIG_MULTIFRAME_SUPPORT
+#ifdef CONFIG_LIBOBD2_MULTIFRAME
   uint8_t data[4096];                /* Up to 4096 bytes                    */
 #else
   uint8_t data[8];                   /* Single Frame = 8 bytes              */
 #endif
 };
 
+/* Description of a mode 01 PID:
+ *
+ *   value = raw * mul / div + offset
+ *
+ * where raw is the big-endian number in the first nbytes value bytes and
+ * value is in OBD_PID_SCALE fixed point.
+ */
+
+struct obd_pidinfo_s
+{
+  uint8_t  len;                      /* Value bytes in a response           */
+  uint8_t  nbytes;                   /* Leading bytes that are decoded      */
+  uint8_t  flags;                    /* OBD_PIDF_* flags                    */
+  int32_t  mul;                      /* Multiplier                          */
+  int32_t  div;                      /* Divisor                             */
+  int32_t  offset;                   /* Offset, in OBD_PID_SCALE units      */
+  FAR const char *unit;              /* Unit of the value                   */
+};
+
+/* ISO-TP (ISO 15765-2) reassembly state of one response */
+
+struct obd_isotp_s
+{
+  FAR uint8_t *buf;                  /* Reassembly buffer                   */
+  uint16_t size;                     /* Size of buf                         */
+  uint16_t len;                      /* Bytes received so far               */
+  uint16_t expected;                 /* Total length announced by the ECU   */
+  uint8_t  seq;                      /* Next consecutive frame number       */
+  bool     active;                   /* A multi-frame message is underway   */
+};
+
+/* A group of PIDs sampled periodically from one ECU by obd_sched_run() */
+
+struct obd_job_s
+{
+  uint8_t  ecu;                      /* ECU number, 0-7                     */
+  uint8_t  opmode;                   /* Operation mode, e.g. OBD_SHOW_DATA  */
+  uint8_t  npids;                    /* Number of PIDs, 1-OBD_MAX_PIDS      */
+  uint8_t  pids[OBD_MAX_PIDS];       /* The PIDs requested together         */
+  uint16_t period;                   /* Sample period in milliseconds       */
+  uint32_t due;                      /* Next request time (internal)        */
+};
+
+/* Called once per PID in each response.  data points to the value bytes
+ * that follow the PID, len of them.
+ */
+
+typedef CODE void (*obd_pid_cb_t)(FAR void *arg, uint8_t ecu, uint8_t pid,
+                                  FAR const uint8_t *data, int len);
+
+/* Per-ECU state of the scheduler */
+
+struct obd_ecu_s
+{
+  struct obd_isotp_s rx;             /* Response reassembly                 */
+  int16_t  job;                      /* Job in flight or -1                 */
+  uint32_t deadline;                 /* When the job in flight times out    */
+  uint8_t  buf[CONFIG_LIBOBD2_MAXPAYLOAD];
+};
+
+/* Scheduler that keeps one request in flight to each ECU */
+
+struct obd_sched_s
+{
+  FAR struct obd_dev_s *dev;         /* The OBD-II device                   */
+  FAR struct obd_job_s *jobs;        /* Jobs to run                         */
+  int      njobs;                    /* Number of jobs                      */
+  int      next;                     /* Round-robin start                   */
+  obd_pid_cb_t cb;                   /* PID value callback                  */
+  FAR void *arg;                     /* Callback argument                   */
+  uint32_t responses;                /* Complete responses received         */
+  uint32_t negatives;                /* Negative responses received         */
+  uint32_t timeouts;                 /* Requests that got no response       */
+  uint32_t errors;                   /* Malformed or aborted responses      */
+  struct obd_ecu_s ecu[OBD_NECUS];
+};
+
 /****************************************************************************
  * Name: obd_init
  *
@@ -129,4 +234,112 @@ int obd_wait_response(FAR struct obd_dev_s *dev, uint8_t opmode, uint8_t pid,
 
 FAR char *obd_decode_pid(FAR struct obd_dev_s *dev, uint8_t pid);
 
+/****************************************************************************
+ * Name: obd_send_pids
+ *
+ * Description:
+ *   Send one "Request Message" carrying up to OBD_MAX_PIDS PIDs, either
+ *   physically addressed to ECU 0-7 or, with ecu OBD_NECUS, to all ECUs.
+ *
+ *   It will return an error case the message fails to be sent.
+ *
+ ****************************************************************************/
+
+int obd_send_pids(FAR struct obd_dev_s *dev, uint8_t ecu, uint8_t opmode,
+                  FAR const uint8_t *pids, int npids);
+
+/****************************************************************************
+ * Name: obd_isotp_receive
+ *
+ * Description:
+ *   Feed one received frame to an ISO-TP reassembly.  A flow control frame
+ *   is sent to the ECU when a multi-frame response starts.
+ *
+ *   It will return the length of the complete message in rx->buf, zero if
+ *   more frames are expected, or a negated errno value if the frame was
+ *   malformed or the message does not fit.
+ *
+ ****************************************************************************/
+
+int obd_isotp_receive(FAR struct obd_dev_s *dev, FAR struct obd_isotp_s *rx,
+                      FAR const struct can_msg_s *msg, uint8_t ecu);
+
+/****************************************************************************
+ * Name: obd_pid_datalen
+ *
+ * Description:
+ *   Return the number of value bytes of a mode 01 PID, or zero if unknown.
+ *
+ ****************************************************************************/
+
+int obd_pid_datalen(uint8_t pid);
+
+/****************************************************************************
+ * Name: obd_pid_info
+ *
+ * Description:
+ *   Return the description of a mode 01 PID, or NULL if unknown.
+ *
+ ****************************************************************************/
+
+FAR const struct obd_pidinfo_s *obd_pid_info(uint8_t pid);
+
+/****************************************************************************
+ * Name: obd_decode_value
+ *
+ * Description:
+ *   Decode the value bytes of a mode 01 PID without any formatting, e.g.
+ *   from an obd_pid_cb_t callback.
+ *
+ *   It will return OK with the value in OBD_PID_SCALE fixed point (or the
+ *   raw bytes for OBD_PIDF_RAW PIDs), -ENOENT if the PID is unknown, or
+ *   -EINVAL if len is too short.
+ *
+ ****************************************************************************/
+
+int obd_decode_value(uint8_t pid, FAR const uint8_t *data, int len,
+                     FAR int32_t *value);
+
+/****************************************************************************
+ * Name: obd_parse_pids
+ *
+ * Description:
+ *   Split a reassembled mode 01 response to a multi-PID request and call
+ *   cb once per PID.
+ *
+ *   It will return the number of PIDs found or a negated errno value if
+ *   the message is not a positive response to opmode.
+ *
+ ****************************************************************************/
+
+int obd_parse_pids(FAR const uint8_t *msg, int len, uint8_t opmode,
+                   uint8_t ecu, obd_pid_cb_t cb, FAR void *arg);
+
+/****************************************************************************
+ * Name: obd_sched_init
+ *
+ * Description:
+ *   Prepare a scheduler for an array of jobs.  All jobs are due at once.
+ *
+ ****************************************************************************/
+
+void obd_sched_init(FAR struct obd_sched_s *sched, FAR struct obd_dev_s *dev,
+                    FAR struct obd_job_s *jobs, int njobs, obd_pid_cb_t cb,
+                    FAR void *arg);
+
+/****************************************************************************
+ * Name: obd_sched_run
+ *
+ * Description:
+ *   Run the jobs for msec milliseconds.  Requests to different ECUs are in
+ *   flight at the same time; each ECU gets its next request as soon as it
+ *   answered (or CONFIG_LIBOBD2_TIMEOUT passed) and a job for it is due.
+ *
+ *   It will return OK when the time is up or a negated errno value if the
+ *   CAN device failed.
+ *
+ ****************************************************************************/
+
+int obd_sched_run(FAR struct obd_sched_s *sched, int msec);
+
 #endif /*__APPS_INCLUDE_CANUTILS_OBD_H */
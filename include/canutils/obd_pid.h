@@ -50,7 +50,18 @@
 #define OBD_PID_STD_RESPONSE            0x7e8       /* Standard PID RESPONSE Message ID = 0x7e8 */
 #define OBD_PID_EXT_RESPONSE            0x18daf110  /* Extended PID RESPONSE Message ID = 0x18daf111 or 0x18daf11d */
 
+/* Physically addressed REQUEST/RESPONSE of ECU n (0-7) */
+
+#define OBD_PID_STD_PHYS_REQUEST(n)     (0x7e0 + (n))
+#define OBD_PID_STD_PHYS_RESPONSE(n)    (0x7e8 + (n))
+#define OBD_PID_EXT_PHYS_REQUEST(n)     (0x18da00f1 | ((0x10 + (n)) << 8))
+#define OBD_PID_EXT_PHYS_RESPONSE(n)    (0x18daf100 | (0x10 + (n)))
+
+#define OBD_NECUS                       8           /* ECUs addressable per bus */
+#define OBD_MAX_PIDS                    6           /* PIDs per mode 01 request */
+
 #define OBD_RESP_BASE                   0x40        /* Response mode = (0x40 + OpMode) */
+#define OBD_NEGATIVE_RESPONSE           0x7f        /* Negative response, followed by mode and code */
 
 /* OBD Operation Modes */
 
@@ -43,6 +43,40 @@
 #include <nuttx/config.h>
 #include <nuttx/compiler.h>
 
+#include <stdint.h>
+#include <stddef.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* flash_eraseblocks() flags */
+
+#define FLASH_ERASE_SKIPBLANK (1 << 0) /* Don't erase blocks already blank */
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+#ifdef CONFIG_FSUTILS_FLASH_ERASEBLOCKS
+/* The state of flash_eraseblocks() passed to the progress callback */
+
+struct flash_erase_progress_s
+{
+  size_t erasesize;     /* Size of one erase block (bytes) */
+  size_t neraseblocks;  /* Number of erase blocks on the device */
+  size_t ndone;         /* Erase blocks checked or erased so far */
+  size_t nerased;       /* Erase blocks actually erased */
+  size_t nskipped;      /* Erase blocks that were already blank */
+  uint32_t elapsed;     /* Time since the start (milliseconds) */
+};
+
+typedef CODE void (*flash_erase_progress_t)
+  (FAR const struct flash_erase_progress_s *progress, FAR void *arg);
+
+struct mtd_dev_s;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -58,4 +92,30 @@
 
 int flash_eraseall(FAR const char *driver);
 
+/****************************************************************************
+ * Name: flash_eraseblocks
+ *
+ * Description:
+ *   Erase all of an MTD device.  Runs of erase blocks are erased with one
+ *   MTD_ERASE() call each.  With FLASH_ERASE_SKIPBLANK, each erase block is
+ *   read first and is not erased if it is already blank.
+ *
+ * Input Parameters:
+ *   mtd      - The MTD device to erase
+ *   flags    - FLASH_ERASE_* flags
+ *   progress - Called after each run of erase blocks and at the end.  May
+ *              be NULL.
+ *   arg      - Passed to the progress callback
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success; a negated errno value is returned on
+ *   failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FSUTILS_FLASH_ERASEBLOCKS
+int flash_eraseblocks(FAR struct mtd_dev_s *mtd, int flags,
+                      flash_erase_progress_t progress, FAR void *arg);
+#endif
+
 #endif /* __APPS_INCLUDE_FSUTILS_FLASH_ERASEALL_H */
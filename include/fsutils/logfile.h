@@ -0,0 +1,161 @@
+/****************************************************************************
+ * apps/include/fsutils/logfile.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_FSUTILS_LOGFILE_H
+#define __APPS_INCLUDE_FSUTILS_LOGFILE_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+typedef FAR void *LOGHANDLE;
+
+/* Describes a log file.  Zero values select defaults. */
+
+struct logfile_config_s
+{
+  FAR const char *path;  /* Path of the current file.  Older files are
+                          * path.1, path.2, ... */
+  size_t chunksize;      /* Size of each write.  Default: The block size
+                          * that statfs() reports */
+  size_t maxsize;        /* Size at which the file is rotated.  Rounded
+                          * down to a multiple of chunksize.  Default: Never
+                          * rotate */
+  uint8_t nfiles;        /* Number of files kept, including the current
+                          * one.  Default: CONFIG_FSUTILS_LOGFILE_NFILES */
+  uint32_t budget;       /* Maximum bytes written per second.  Default:
+                          * No limit */
+};
+
+/* Statistics returned by logfile_stats() */
+
+struct logfile_stats_s
+{
+  uint32_t nappends;     /* Number of calls to logfile_write() */
+  uint32_t nchunks;      /* Number of writes to the file system */
+  uint32_t nrotations;   /* Number of times the files were rotated */
+  uint32_t nthrottled;   /* Writes delayed to stay within the budget */
+  uint64_t nbytes;       /* Bytes written to the file system */
+  uint32_t maxlatency;   /* Longest write to the file system (usec) */
+  uint64_t totlatency;   /* Total time spent writing (usec) */
+};
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: logfile_open
+ *
+ * Description:
+ *   Open the log file described by config for appending.  Returns NULL and
+ *   sets errno on failure.
+ *
+ ****************************************************************************/
+
+LOGHANDLE logfile_open(FAR const struct logfile_config_s *config);
+
+/****************************************************************************
+ * Name: logfile_write
+ *
+ * Description:
+ *   Append data to the log.  The data is written to the file system only
+ *   when a whole chunk has been collected.  If that would exceed the write
+ *   budget, the caller is delayed until the budget allows it.  Returns the
+ *   number of bytes appended or a negated errno value.
+ *
+ ****************************************************************************/
+
+ssize_t logfile_write(LOGHANDLE handle, FAR const void *buffer, size_t len);
+
+/****************************************************************************
+ * Name: logfile_flush
+ *
+ * Description:
+ *   Write a partial chunk now, ignoring the write budget.  This leaves the
+ *   file unaligned until the next chunk and should be used sparingly, e.g.
+ *   before a shutdown.
+ *
+ ****************************************************************************/
+
+int logfile_flush(LOGHANDLE handle);
+
+/****************************************************************************
+ * Name: logfile_stats
+ *
+ * Description:
+ *   Return the write statistics of the log.
+ *
+ ****************************************************************************/
+
+void logfile_stats(LOGHANDLE handle, FAR struct logfile_stats_s *stats);
+
+/****************************************************************************
+ * Name: logfile_close
+ *
+ * Description:
+ *   Flush and close the log and free its resources.
+ *
+ ****************************************************************************/
+
+int logfile_close(LOGHANDLE handle);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __APPS_INCLUDE_FSUTILS_LOGFILE_H */
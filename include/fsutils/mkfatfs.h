@@ -58,6 +58,7 @@
 #define MKFATFS_DEFAULT_HIDSEC       0     /* No hidden sectors */
 #define MKFATFS_DEFAULT_VOLUMEID     0     /* No volume ID */
 #define MKFATFS_DEFAULT_NSECTORS     0     /* 0: Use all sectors on device */
+#define MKFATFS_DEFAULT_ALIGNSECTS   0     /* 0: Do not align the FATs and data */
 
 #define FAT_FORMAT_INITIALIZER \
 { \
@@ -70,7 +71,8 @@
   MKFATFS_DEFAULT_RSVDSECCOUNT, \
   MKFATFS_DEFAULT_HIDSEC, \
   MKFATFS_DEFAULT_VOLUMEID, \
-  MKFATFS_DEFAULT_NSECTORS \
+  MKFATFS_DEFAULT_NSECTORS, \
+  MKFATFS_DEFAULT_ALIGNSECTS \
 }
 
 /****************************************************************************
@@ -93,6 +95,7 @@ struct fat_format_s
    uint32_t ff_hidsec;          /* Count of hidden sectors preceding fat */
    uint32_t ff_volumeid;        /* FAT volume id */
    uint32_t ff_nsectors;        /* Number of sectors from device to use: 0: Use all */
+   uint32_t ff_alignsects;      /* Erase block size in sectors to align to: 0: None */
 };
 
 /****************************************************************************
@@ -41,7 +41,10 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
 #include <stdio.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <errno.h>
@@ -54,6 +57,15 @@
 
 #define MINMEA_MAX_LENGTH 80
 
+/* Enough fields for any sentence of MINMEA_MAX_LENGTH characters */
+
+#define MINMEA_MAX_FIELDS (MINMEA_MAX_LENGTH / 2)
+
+/* Sentence filter masks for minmea_parser_init() */
+
+#define MINMEA_MASK(id)   (1ul << (id))
+#define MINMEA_MASK_ALL   0xfffffffful
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -191,6 +203,63 @@ struct minmea_sentence_gsv
   struct minmea_sat_info  sats[4];
 };
 
+/* Remembers the UNIX time of the last date converted by
+ * minmea_gettime_cached().  Zero-initialize before first use.
+ */
+
+struct minmea_timecache
+{
+  struct minmea_date date;             /* Date of midnight; day 0 if unset */
+  time_t             midnight;         /* UNIX time of 00:00:00 on date */
+  int_least32_t      seconds;          /* Last second of the day converted */
+};
+
+/* One decoded sentence, as handed to a minmea_callback_t */
+
+union minmea_frame
+{
+  struct minmea_sentence_rmc rmc;
+  struct minmea_sentence_gga gga;
+  struct minmea_sentence_gsa gsa;
+  struct minmea_sentence_gll gll;
+  struct minmea_sentence_gst gst;
+  struct minmea_sentence_gsv gsv;
+};
+
+/* Called by minmea_parser_feed() for each complete, valid sentence that
+ * passes the filter.  frame is NULL for MINMEA_UNKNOWN sentences; sentence
+ * is the raw text up to, but not including, the '*' checksum delimiter.
+ * Both are only valid for the duration of the call.
+ */
+
+typedef CODE void (*minmea_callback_t)(FAR void *arg,
+                                       enum minmea_sentence_id id,
+                                       FAR const union minmea_frame *frame,
+                                       FAR const char *sentence);
+
+/* Byte-fed sentence parser.  The checksum is computed and the fields are
+ * located as the bytes arrive, so that each sentence is decoded without
+ * being scanned again.  No memory is allocated; the structure holds one
+ * sentence.  The fields are private to the library.
+ */
+
+struct minmea_parser
+{
+  minmea_callback_t callback;          /* Receives the decoded frames */
+  FAR void *arg;                       /* Argument passed to the callback */
+  uint32_t  mask;                      /* MINMEA_MASK() of wanted sentences */
+  uint32_t  errors;                    /* Count of sentences discarded */
+  bool      strict;                    /* Discard sentences w/o checksum */
+  uint8_t   state;                     /* Tokenizer state */
+  int8_t    id;                        /* Sentence ID, or MINMEA_INVALID */
+  uint8_t   checksum;                  /* Running XOR of the sentence body */
+  uint8_t   expected;                  /* Checksum received so far */
+  uint8_t   len;                       /* Characters in buffer */
+  uint8_t   nfields;                   /* Fields recorded in offset */
+  uint8_t   offset[MINMEA_MAX_FIELDS]; /* Start of each field in buffer */
+  char      buffer[MINMEA_MAX_LENGTH + 1];
+};
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -239,12 +308,40 @@ bool minmea_parse_gll(struct minmea_sentence_gll *frame, const char *sentence);
 bool minmea_parse_gst(struct minmea_sentence_gst *frame, const char *sentence);
 bool minmea_parse_gsv(struct minmea_sentence_gsv *frame, const char *sentence);
 
+/* Prepare a byte-fed parser.  Only sentences whose MINMEA_MASK() is set in
+ * mask (MINMEA_MASK(MINMEA_UNKNOWN) for unsupported types) are delivered to
+ * callback; the others are skipped without being buffered.
+ */
+
+void minmea_parser_init(FAR struct minmea_parser *parser, uint32_t mask,
+                        bool strict, minmea_callback_t callback,
+                        FAR void *arg);
+
+/* Feed len bytes of receiver output, in chunks of any size.  Returns the
+ * number of frames delivered to the callback.
+ */
+
+int minmea_parser_feed(FAR struct minmea_parser *parser,
+                       FAR const char *data, size_t len);
+
 /* Convert GPS UTC date/time representation to a UNIX timestamp. */
 
 int minmea_gettime(FAR struct timespec *ts,
                    FAR const struct minmea_date *date,
                    FAR const struct minmea_time *time_);
 
+/* Like minmea_gettime(), but the calendar arithmetic is only done when the
+ * date differs from the previous call with the same cache; other calls
+ * cost a few multiplications.  date may be NULL for sentences without one
+ * (GGA, GLL, GST), in which case the cached date is used and is advanced
+ * when the time of day wraps around midnight.
+ */
+
+int minmea_gettime_cached(FAR struct timespec *ts,
+                          FAR struct minmea_timecache *cache,
+                          FAR const struct minmea_date *date,
+                          FAR const struct minmea_time *time_);
+
 /* Rescale a fixed-point value to a different scale. Rounds towards zero. */
 
 static inline int_least32_t minmea_rescale(FAR struct minmea_float *f,
@@ -302,6 +399,39 @@ static inline float minmea_tocoord(FAR struct minmea_float *f)
   return (float) degrees + (float) minutes / (60 * f->scale);
 }
 
+/* Convert a raw coordinate to a fixed-point DD.DDD... value with the given
+ * scale, using integer arithmetic only.  Rounds to nearest.  Returns 0 for
+ * "unknown" values.
+ */
+
+static inline int_least32_t minmea_tocoord_scaled(FAR struct minmea_float *f,
+                                                  int_least32_t new_scale)
+{
+  int_least32_t degrees;
+  int_least64_t minutes;
+
+  if (f->scale == 0)
+    {
+      return 0;
+    }
+
+  degrees = f->value / (f->scale * 100);
+  minutes = (int_least64_t)(f->value % (f->scale * 100)) * new_scale;
+  minutes = (minutes + ((minutes > 0) - (minutes < 0)) * 30 * f->scale) /
+            (60 * f->scale);
+
+  return degrees * new_scale + (int_least32_t)minutes;
+}
+
+/* Convert a raw coordinate to integer microdegrees.  Returns 0 for "unknown"
+ * values.
+ */
+
+static inline int_least32_t minmea_tomicrodeg(FAR struct minmea_float *f)
+{
+  return minmea_tocoord_scaled(f, 1000000);
+}
+
 #ifdef __cplusplus
 }
 #endif
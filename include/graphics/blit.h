@@ -0,0 +1,239 @@
+/****************************************************************************
+ * apps/include/graphics/blit.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_GRAPHICS_BLIT_H
+#define __APPS_INCLUDE_GRAPHICS_BLIT_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* A run-length encoded image of 8-bit pixel codes, typically indices into a
+ * color look-up table.  Each row is PackBits encoded by itself:  a header
+ * byte n of 0-127 is followed by n + 1 literal codes, a header byte n of
+ * 129-255 is followed by one code that is repeated 257 - n times, and 128
+ * is ignored.  rows[] holds the offset of each encoded row in data[] so
+ * that any row can be decoded directly, and both may reside in FLASH.
+ */
+
+struct blit_rleimage_s
+{
+  uint16_t width;                /* Width of the image in pixels */
+  uint16_t height;               /* Height of the image in rows */
+  FAR const uint32_t *rows;      /* Offset of each row in data[] */
+  FAR const uint8_t *data;       /* PackBits encoded rows */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: blit_fill8, blit_fill16, and blit_fill32
+ *
+ * Description:
+ *   Fill a rectangle of 8-, 16- or 32-bit pixels with one color.  The
+ *   interior of each row is written a 32-bit word at a time.
+ *
+ * Input Parameters:
+ *   dest   - The address of the first pixel of the first row
+ *   stride - The distance in bytes from one row to the next
+ *   width  - The width of the rectangle in pixels
+ *   height - The height of the rectangle in rows
+ *   color  - The pixel value to fill with
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void blit_fill8(FAR void *dest, size_t stride, unsigned int width,
+                unsigned int height, uint8_t color);
+void blit_fill16(FAR void *dest, size_t stride, unsigned int width,
+                 unsigned int height, uint16_t color);
+void blit_fill32(FAR void *dest, size_t stride, unsigned int width,
+                 unsigned int height, uint32_t color);
+
+/****************************************************************************
+ * Name: blit_copy
+ *
+ * Description:
+ *   Copy a rectangle of nbytes by height from src to dest.  The two
+ *   rectangles must not overlap.  When both are contiguous, the whole
+ *   rectangle is copied with one memcpy().
+ *
+ * Input Parameters:
+ *   dest    - The address of the first byte of the destination
+ *   dstride - The distance in bytes between destination rows
+ *   src     - The address of the first byte of the source
+ *   sstride - The distance in bytes between source rows
+ *   nbytes  - The width of the rectangle in bytes
+ *   height  - The height of the rectangle in rows
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void blit_copy(FAR void *dest, size_t dstride, FAR const void *src,
+               size_t sstride, size_t nbytes, unsigned int height);
+
+/****************************************************************************
+ * Name: blit_expand16 and blit_expand32
+ *
+ * Description:
+ *   Expand a row of 1, 2 or 4 bit-per-pixel palette indices to RGB565 or to
+ *   RGB888 (one 32-bit word per pixel).  The first pixel is in the most
+ *   significant bits of the first source byte.
+ *
+ * Input Parameters:
+ *   dest    - The address of the first destination pixel
+ *   src     - The address of the packed source pixels
+ *   bpp     - The source pixel depth:  1, 2 or 4
+ *   npixels - The number of pixels to expand
+ *   palette - The 2, 4 or 16 destination colors indexed by the source
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void blit_expand16(FAR uint16_t *dest, FAR const uint8_t *src,
+                   unsigned int bpp, unsigned int npixels,
+                   FAR const uint16_t *palette);
+void blit_expand32(FAR uint32_t *dest, FAR const uint8_t *src,
+                   unsigned int bpp, unsigned int npixels,
+                   FAR const uint32_t *palette);
+
+/****************************************************************************
+ * Name: blit_average16 and blit_average32
+ *
+ * Description:
+ *   Replace each RGB565 or RGB888 pixel in dest with the average of itself
+ *   and the corresponding pixel in src, rounding each component up.
+ *
+ * Input Parameters:
+ *   dest    - The first pixel of the row to be averaged in place
+ *   src     - The first pixel of the other row
+ *   npixels - The number of pixels to average
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void blit_average16(FAR uint16_t *dest, FAR const uint16_t *src,
+                    unsigned int npixels);
+void blit_average32(FAR uint32_t *dest, FAR const uint32_t *src,
+                    unsigned int npixels);
+
+/****************************************************************************
+ * Name: blit_blend16 and blit_blend32
+ *
+ * Description:
+ *   Alpha blend a row of RGB565 or RGB888 pixels from src over dest.  The
+ *   components of all pixels are blended at the same time.  blit_blend32()
+ *   leaves the most significant byte of each destination pixel unchanged.
+ *
+ * Input Parameters:
+ *   dest    - The first pixel of the destination row
+ *   src     - The first pixel of the source row
+ *   npixels - The number of pixels to blend
+ *   alpha   - The opacity of src, from 0 (transparent) to 255 (opaque)
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void blit_blend16(FAR uint16_t *dest, FAR const uint16_t *src,
+                  unsigned int npixels, uint8_t alpha);
+void blit_blend32(FAR uint32_t *dest, FAR const uint32_t *src,
+                  unsigned int npixels, uint8_t alpha);
+
+/****************************************************************************
+ * Name: blit_rledecode, blit_rleexpand16, and blit_rleexpand32
+ *
+ * Description:
+ *   Decode one row of a run-length encoded image.  blit_rledecode()
+ *   returns the 8-bit pixel codes themselves.  blit_rleexpand16() and
+ *   blit_rleexpand32() translate the codes through a look-up table of
+ *   RGB565 or RGB888 colors and fill each run a word at a time, so that an
+ *   image in FLASH can be drawn without an intermediate buffer.
+ *
+ * Input Parameters:
+ *   image - The run-length encoded image
+ *   row   - The row to decode
+ *   dest  - The destination for image->width pixels
+ *   lut   - The colors indexed by the pixel codes
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  -EINVAL is returned if the row does not exist
+ *   or if its encoded data does not describe exactly image->width pixels.
+ *
+ ****************************************************************************/
+
+int blit_rledecode(FAR const struct blit_rleimage_s *image, unsigned int row,
+                   FAR uint8_t *dest);
+int blit_rleexpand16(FAR const struct blit_rleimage_s *image,
+                     unsigned int row, FAR uint16_t *dest,
+                     FAR const uint16_t *lut);
+int blit_rleexpand32(FAR const struct blit_rleimage_s *image,
+                     unsigned int row, FAR uint32_t *dest,
+                     FAR const uint32_t *lut);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __APPS_INCLUDE_GRAPHICS_BLIT_H */
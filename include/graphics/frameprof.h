@@ -0,0 +1,294 @@
+/****************************************************************************
+ * apps/include/graphics/frameprof.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_GRAPHICS_FRAMEPROF_H
+#define __APPS_INCLUDE_GRAPHICS_FRAMEPROF_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Configuration ************************************************************/
+
+#ifndef CONFIG_GRAPHICS_FRAMEPROF_MAXPHASES
+#  define CONFIG_GRAPHICS_FRAMEPROF_MAXPHASES 8
+#endif
+
+#ifndef CONFIG_GRAPHICS_FRAMEPROF_WINDOW
+#  define CONFIG_GRAPHICS_FRAMEPROF_WINDOW 100
+#endif
+
+/* Histogram bucket 0 counts frames that took less than one millisecond.
+ * Bucket n counts frames of 2^(n-1) up to 2^n milliseconds and the last
+ * bucket also counts everything longer.
+ */
+
+#define FRAMEPROF_NBUCKETS       12
+
+/* The overlay is drawn with a 3x5 font in 4x6 pixel cells.  It has one
+ * line for the frame rate, one for the frame time and one for each phase.
+ */
+
+#define FRAMEPROF_GLYPH_WIDTH    4
+#define FRAMEPROF_GLYPH_HEIGHT   6
+#define FRAMEPROF_OVERLAY_CHARS  18
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Times are in microseconds.  The avg and peak values are those of the last
+ * completed window of CONFIG_GRAPHICS_FRAMEPROF_WINDOW frames.
+ */
+
+struct frameprof_phase_s
+{
+  FAR const char *name;           /* Name of the phase */
+  struct timespec start;          /* Start of the interval being timed */
+  uint32_t frame;                 /* Time spent in the current frame */
+  uint32_t sum;                   /* Time spent in the current window */
+  uint32_t max;                   /* Longest frame in the current window */
+  uint32_t avg;                   /* Average per frame, last window */
+  uint32_t peak;                  /* Longest frame, last window */
+  uint16_t hist[FRAMEPROF_NBUCKETS]; /* Per-frame time histogram */
+};
+
+struct frameprof_s
+{
+  struct timespec framestart;     /* Start of the current frame */
+  struct timespec windowstart;    /* Start of the current window */
+  uint32_t sum;                   /* Frame time in the current window */
+  uint32_t max;                   /* Longest frame in the current window */
+  uint32_t avg;                   /* Average frame time, last window */
+  uint32_t peak;                  /* Longest frame, last window */
+  uint32_t fps10;                 /* Frames per second x 10, last window */
+  uint16_t nframes;               /* Frames in the current window */
+  uint8_t nphases;                /* Number of registered phases */
+  uint16_t hist[FRAMEPROF_NBUCKETS]; /* Frame time histogram */
+  struct frameprof_phase_s phase[CONFIG_GRAPHICS_FRAMEPROF_MAXPHASES];
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: frameprof_initialize
+ *
+ * Description:
+ *   Clear all statistics and remove all phases.
+ *
+ * Input Parameters:
+ *   prof - The profiler state to initialize
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void frameprof_initialize(FAR struct frameprof_s *prof);
+
+/****************************************************************************
+ * Name: frameprof_phase
+ *
+ * Description:
+ *   Register a named phase.  Phases are numbered from zero in the order
+ *   in which they are registered.
+ *
+ * Input Parameters:
+ *   prof - The profiler state
+ *   name - The name of the phase.  The string is not copied.
+ *
+ * Returned Value:
+ *   The phase number on success; -ENOSPC if there are already
+ *   CONFIG_GRAPHICS_FRAMEPROF_MAXPHASES phases.
+ *
+ ****************************************************************************/
+
+int frameprof_phase(FAR struct frameprof_s *prof, FAR const char *name);
+
+/****************************************************************************
+ * Name: frameprof_begin and frameprof_end
+ *
+ * Description:
+ *   Mark the beginning and the end of a frame.  frameprof_end() adds the
+ *   frame and the time accumulated by each phase to the histograms and,
+ *   after every CONFIG_GRAPHICS_FRAMEPROF_WINDOW frames, updates the
+ *   frame rate and the per-phase averages.
+ *
+ * Input Parameters:
+ *   prof - The profiler state
+ *
+ * Returned Value:
+ *   frameprof_end() returns true if the frame completed a window.
+ *
+ ****************************************************************************/
+
+void frameprof_begin(FAR struct frameprof_s *prof);
+bool frameprof_end(FAR struct frameprof_s *prof);
+
+/****************************************************************************
+ * Name: frameprof_start and frameprof_stop
+ *
+ * Description:
+ *   Mark the start and the end of an interval spent in a phase.  A phase
+ *   may be entered several times in a frame; the intervals are summed.
+ *   Different phases may overlap.
+ *
+ * Input Parameters:
+ *   prof  - The profiler state
+ *   phase - The phase number returned by frameprof_phase()
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void frameprof_start(FAR struct frameprof_s *prof, int phase);
+void frameprof_stop(FAR struct frameprof_s *prof, int phase);
+
+/****************************************************************************
+ * Name: frameprof_summary
+ *
+ * Description:
+ *   Format the statistics of the last window as one line of text:  the
+ *   frame rate, then the average and peak milliseconds of the frame and of
+ *   each phase.
+ *
+ * Input Parameters:
+ *   prof - The profiler state
+ *   buf  - The buffer that receives the NUL terminated text
+ *   len  - The size of buf in bytes
+ *
+ * Returned Value:
+ *   The length of the full line as returned by snprintf().
+ *
+ ****************************************************************************/
+
+int frameprof_summary(FAR const struct frameprof_s *prof, FAR char *buf,
+                      size_t len);
+
+/****************************************************************************
+ * Name: frameprof_dump
+ *
+ * Description:
+ *   Print the frame time and phase histograms.
+ *
+ * Input Parameters:
+ *   prof   - The profiler state
+ *   stream - The stream to print to
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void frameprof_dump(FAR const struct frameprof_s *prof, FAR FILE *stream);
+
+/****************************************************************************
+ * Name: frameprof_overlay_size
+ *
+ * Description:
+ *   Return the size of the overlay drawn by frameprof_overlay().
+ *
+ * Input Parameters:
+ *   prof   - The profiler state
+ *   scale  - The magnification of the overlay font
+ *   width  - Location to return the width in pixels
+ *   height - Location to return the height in rows
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void frameprof_overlay_size(FAR const struct frameprof_s *prof,
+                            unsigned int scale, FAR unsigned int *width,
+                            FAR unsigned int *height);
+
+/****************************************************************************
+ * Name: frameprof_overlay
+ *
+ * Description:
+ *   Draw the frame rate and the phase breakdown of the last window into a
+ *   frame or render buffer.  The overlay is clipped to width x height.
+ *
+ * Input Parameters:
+ *   prof    - The profiler state
+ *   dest    - The address of the top left pixel of the overlay
+ *   stride  - The distance in bytes from one row to the next
+ *   bpp     - The pixel depth:  8, 16 or 32
+ *   width   - The number of pixels available to the right of dest
+ *   height  - The number of rows available below dest
+ *   scale   - The magnification of the overlay font, at least 1
+ *   fgcolor - The pixel value of the text
+ *   bgcolor - The pixel value of the background
+ *
+ * Returned Value:
+ *   Zero (OK) on success; -EINVAL if bpp or scale is not supported.
+ *
+ ****************************************************************************/
+
+int frameprof_overlay(FAR const struct frameprof_s *prof, FAR void *dest,
+                      size_t stride, unsigned int bpp, unsigned int width,
+                      unsigned int height, unsigned int scale,
+                      uint32_t fgcolor, uint32_t bgcolor);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __APPS_INCLUDE_GRAPHICS_FRAMEPROF_H */
@@ -47,11 +47,20 @@
 #include <sys/types.h>
 #include <nuttx/nx/nxglib.h>
 
+#ifdef CONFIG_TIFF_AIO
+#  include <aio.h>
+#endif
+
 /************************************************************************************
  * Pre-processor Definitions
  ************************************************************************************/
 /* Configuration ********************************************************************/
 
+/* PackBits ************************************************************************/
+/* The worst case size of a PackBits encoded row of n bytes */
+
+#define TIFF_PACKBITS_MAXSIZE(n) ((n) + ((n) + 127) / 128)
+
 /* TIFF File Format Definitions *****************************************************/
 /* Values for the IFD field type */
 
@@ -291,10 +300,12 @@ struct tiff_info_s
   /* The first fields are used to pass information to the TIFF file creation
    * logic via tiff_initialize().
    *
-   * Filenames.  Three file names are required.  (1) path to the final
-   * output file and (2) two paths to temporary files.  One temporary file
-   * (tmpfile1) will be used to hold the strip image data and the other
-   * (tmpfile2) will be used to hold strip offset and count information.
+   * Filenames.  Only the path to the final output file is required.  The
+   * number of strips follows from imgheight and rps so the complete file
+   * layout is known up front:  The header, IFD, and strip tables are built
+   * in the I/O buffer and the strips are streamed directly behind them.
+   * The two temporary file paths are no longer used and may be NULL; they
+   * are retained only for compatibility with existing callers.
    *
    * colorfmt  - Specifies the form of the color data that will be provided
    *             in the strip data.  These are the FB_FMT_* definitions
@@ -310,20 +321,30 @@ struct tiff_info_s
    * rps       - TIFF RowsPerStrip
    * imgwidth  - TIFF ImageWidth, Number of columns in the image
    * imgheight - TIFF ImageLength, Number of rows in the image
+   * compression - TIFF Compression applied to each strip.  Zero or
+   *             TAG_COMP_NONE writes uncompressed strips.  TAG_COMP_PACKBITS
+   *             (CONFIG_TIFF_PACKBITS) and TAG_COMP_LZW (CONFIG_TIFF_LZW)
+   *             are also supported.  LZW allocates about 20KiB of
+   *             dictionary for the duration of the file creation.
    */
 
   FAR const char *outfile;  /* Full path to the final output file name */
-  FAR const char *tmpfile1; /* Full path to first temporary file */
-  FAR const char *tmpfile2; /* Full path to second temporary file */
+  FAR const char *tmpfile1; /* Unused, retained for compatibility */
+  FAR const char *tmpfile2; /* Unused, retained for compatibility */
 
   uint8_t      colorfmt;    /* See FB_FMT_* definitions in include/nuttx/video/fb.h */
   nxgl_coord_t rps;         /* TIFF RowsPerStrip */
   nxgl_coord_t imgwidth;    /* TIFF ImageWidth, Number of columns in the image */
   nxgl_coord_t imgheight;   /* TIFF ImageLength, Number of rows in the image */
-
-  /* The caller must provide an I/O buffer as well.  This I/O buffer will
-   * used for color conversions and as the intermediate buffer for copying
-   * files.  The larger the buffer, the better the performance.
+  uint16_t     compression; /* TIFF Compression, see TAG_COMP_* definitions */
+
+  /* The caller must provide an I/O buffer as well.  All output, including
+   * color conversions, is staged in this buffer and written to the outfile
+   * in buffer-sized blocks at block-aligned file offsets.  With
+   * CONFIG_TIFF_AIO the buffer is split into two halves:  One half is
+   * written asynchronously while the next strip fills the other.  The
+   * larger the buffer, the better the performance.  Multiples of 1024
+   * bytes (512 with CONFIG_TIFF_AIO disabled) work best.
    */
 
   FAR uint8_t *iobuffer;    /* IO buffer allocated by the caller */
@@ -338,15 +359,22 @@ struct tiff_info_s
    */
 
   uint8_t      imgflags;    /* Bit-encoded image flags */
-  nxgl_coord_t nstrips;     /* Number of strips in tmpfile3 */
+  uint8_t      bufndx;      /* Index of the I/O buffer half being filled */
+  nxgl_coord_t nstrips;     /* Number of strips added */
+  nxgl_coord_t maxstrips;   /* Number of strips provided for in the IFD */
   size_t       pps;         /* Pixels per strip */
   size_t       bps;         /* Bytes per strip */
+  size_t       bufsize;     /* Size of one I/O buffer half */
+  size_t       buflen;      /* Number of bytes in the current half */
   int          outfd;       /* outfile file descriptor */
-  int          tmp1fd;      /* tmpfile1 file descriptor */
-  int          tmp2fd;      /* tmpfile2 file descriptor */
-  off_t        outsize;     /* Current size of outfile */
-  off_t        tmp1size;    /* Current size of tmpfile1 */
-  off_t        tmp2size;    /* Current size of tmpfile2 */
+  off_t        outsize;     /* Size of outfile, including buffered data */
+  off_t        stripoffset; /* Offset to the first strip */
+#ifdef CONFIG_TIFF_AIO
+  struct aiocb aiocb[2];    /* Write in progress for each buffer half */
+#endif
+  FAR uint32_t *counts;     /* Compressed size of each strip */
+  FAR uint8_t  *rowbuf;     /* Converted row awaiting compression */
+  FAR struct tiff_lzw_s *lzw; /* LZW dictionary */
 
   /* Points to an internal constant structure of file offsets */
 
@@ -458,6 +486,29 @@ void tiff_put32(FAR uint8_t *dest, uint32_t value);
 uint16_t tiff_get16(FAR uint8_t *dest);
 uint32_t tiff_get32(FAR uint8_t *dest);
 
+/************************************************************************************
+ * Name: tiff_packbits
+ *
+ * Description:
+ *   PackBits encode one row into memory.  This is the TAG_COMP_PACKBITS row
+ *   encoding, made available for other uses of the same cheap run-length
+ *   coding.
+ *
+ * Input Parameters:
+ *   dest   - The location to store the encoded row.  This must hold at least
+ *            TIFF_PACKBITS_MAXSIZE(nbytes) bytes.
+ *   src    - The row to be encoded
+ *   nbytes - The number of bytes in the row
+ *
+ * Returned Value:
+ *   The number of bytes stored in dest.
+ *
+ ************************************************************************************/
+
+#ifdef CONFIG_TIFF_PACKBITS
+size_t tiff_packbits(FAR uint8_t *dest, FAR const uint8_t *src, size_t nbytes);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
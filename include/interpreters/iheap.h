@@ -0,0 +1,170 @@
+/****************************************************************************
+ * apps/include/interpreters/iheap.h
+ * Accounted heaps for the interpreters
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_INTERPRETERS_IHEAP_H
+#define __APPS_INCLUDE_INTERPRETERS_IHEAP_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Small blocks are kept on a per-heap free list when released.  Class n
+ * holds blocks with a payload of (IHEAP_MINBLOCK << n) bytes.
+ */
+
+#define IHEAP_MINBLOCK  16
+#define IHEAP_NCLASSES  4
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+struct iheap_chunk_s;
+
+/* One accounted heap.  An interpreter normally owns one of these for each
+ * running instance.  The structure is allocated by the caller and must
+ * not be touched directly except to read the counters.  The counters are
+ * only updated by the owning task, so other tasks see a consistent, if
+ * slightly stale, snapshot.
+ */
+
+struct iheap_s
+{
+  FAR struct iheap_s *flink;       /* Next registered heap */
+  FAR const char *name;            /* Shown by the NSH free command */
+  size_t quota;                    /* Maximum bytes in use, 0 means none */
+  size_t inuse;                    /* Payload bytes currently allocated */
+  size_t peak;                     /* Largest value of inuse seen */
+  size_t pooled;                   /* Bytes held on the free lists */
+  unsigned long nallocs;           /* Successful allocations */
+  unsigned long nfrees;            /* Releases */
+  unsigned long nfailed;           /* Allocations refused or failed */
+  FAR struct iheap_chunk_s *pool[IHEAP_NCLASSES];
+  uint8_t npooled[IHEAP_NCLASSES]; /* Blocks on each free list */
+};
+
+/* Callback used by iheap_foreach() */
+
+typedef int (*iheap_handler_t)(FAR const struct iheap_s *heap,
+                               FAR void *arg);
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: iheap_initialize
+ *
+ * Description:
+ *   Initialize a heap and add it to the list reported by the NSH free
+ *   command.
+ *
+ * Input Parameters:
+ *   heap  - The heap to initialize
+ *   name  - A name for the heap.  The string is not copied.
+ *   quota - The maximum number of payload bytes that may be in use at
+ *           one time, or zero for no limit.
+ *
+ ****************************************************************************/
+
+void iheap_initialize(FAR struct iheap_s *heap, FAR const char *name,
+                      size_t quota);
+
+/****************************************************************************
+ * Name: iheap_uninitialize
+ *
+ * Description:
+ *   Release the free lists of a heap and remove it from the list.  Blocks
+ *   still allocated from the heap are not freed.
+ *
+ ****************************************************************************/
+
+void iheap_uninitialize(FAR struct iheap_s *heap);
+
+/****************************************************************************
+ * Name: iheap_malloc, iheap_zalloc, iheap_realloc, iheap_free
+ *
+ * Description:
+ *   Allocate and release memory charged to a heap.  These behave like
+ *   their standard C counterparts except that an allocation that would
+ *   exceed the quota of the heap fails with NULL.  Memory allocated from
+ *   one heap must be released to the same heap.
+ *
+ ****************************************************************************/
+
+FAR void *iheap_malloc(FAR struct iheap_s *heap, size_t size);
+FAR void *iheap_zalloc(FAR struct iheap_s *heap, size_t size);
+FAR void *iheap_realloc(FAR struct iheap_s *heap, FAR void *mem,
+                        size_t size);
+void iheap_free(FAR struct iheap_s *heap, FAR void *mem);
+
+/****************************************************************************
+ * Name: iheap_foreach
+ *
+ * Description:
+ *   Call a function for each registered heap.  The enumeration stops
+ *   when the handler returns a non-zero value.
+ *
+ * Returned Value:
+ *   The value returned by the last handler called, or zero.
+ *
+ ****************************************************************************/
+
+int iheap_foreach(iheap_handler_t handler, FAR void *arg);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __APPS_INCLUDE_INTERPRETERS_IHEAP_H */
@@ -60,6 +60,9 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
+#include <sys/time.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <termios.h>
@@ -81,6 +84,19 @@ extern "C"
 
 #define MB_TCP_PORT_USE_DEFAULT 0
 
+/* Buffer sizes of a protocol stack instance.  The frame buffer holds a
+ * complete Modbus serial line PDU; the port buffer holds the characters
+ * of a complete frame as they are sent or received.
+ */
+
+#define MB_SER_BUF_SIZE         256
+
+#ifdef CONFIG_MB_ASCII_ENABLED
+#  define MB_PORT_BUF_SIZE      513  /* Must hold a complete ASCII frame. */
+#else
+#  define MB_PORT_BUF_SIZE      256  /* Must hold a complete RTU frame. */
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -130,6 +146,93 @@ typedef enum
   MB_ETIMEDOUT                /* timeout error occurred. */
 } eMBErrorCode;
 
+/* The state of one Modbus slave protocol stack.
+ *
+ * eMBInit() and the other functions without a Ctx suffix work on a
+ * built-in instance.  To serve several ports from one task, give each of
+ * them an xMBInstance, set it up with eMBInitCtx() and eMBEnableCtx(),
+ * then wait in poll() on the descriptors returned by iMBGetFdCtx() and
+ * call eMBPollCtx() for each instance whenever poll() returns.  The poll()
+ * timeout should not exceed a few milliseconds, since the RTU
+ * end-of-frame timer is serviced by eMBPollCtx().
+ *
+ * All Ctx calls must be made from the same task.  The function handlers
+ * registered with eMBRegisterCB() and the register callbacks are shared
+ * by all instances; a callback can use pxMBGetCurrentCtx() to find out
+ * which instance it is serving.  Apart from pvUserData, which is left to
+ * the application, the members are private to the protocol stack.
+ */
+
+typedef struct
+{
+  void             *pvUserData;          /* Free for use by the application */
+
+  /* Protocol stack (mb.c) */
+
+  uint8_t           ucMBAddress;
+  eMBMode           eMBCurrentMode;
+  uint8_t           eMBState;
+  void            (*pvMBFrameStartCur)(void);
+  void            (*pvMBFrameStopCur)(void);
+  eMBErrorCode    (*peMBFrameReceiveCur)(uint8_t *pucRcvAddress,
+                                         uint8_t **pucFrame,
+                                         uint16_t *pusLength);
+  eMBErrorCode    (*peMBFrameSendCur)(uint8_t slaveAddress,
+                                      const uint8_t *pucFrame,
+                                      uint16_t usLength);
+  void            (*pvMBFrameCloseCur)(void);
+  bool            (*pxMBFrameCBByteReceived)(void);
+  bool            (*pxMBFrameCBBlockReceived)(const uint8_t *pucData,
+                                              uint16_t usLength);
+  bool            (*pxMBFrameCBTransmitterEmpty)(void);
+  bool            (*pxMBPortCBTimerExpired)(void);
+  uint8_t          *ucMBFrame;
+  uint8_t           ucRcvAddress;
+  uint8_t           ucFunctionCode;
+  uint16_t          usLength;
+  eMBException      eException;
+
+  /* Serial line framing (rtu/mbrtu.c or ascii/mbascii.c) */
+
+  volatile uint8_t  eSndState;
+  volatile uint8_t  eRcvState;
+  volatile uint8_t  eBytePos;
+  volatile uint8_t  ucMBLFCharacter;
+  volatile uint16_t usRcvBufferPos;
+  volatile uint16_t usSndBufferCount;
+  volatile uint8_t *pucSndBufferCur;
+  volatile uint8_t  ucSerBuf[MB_SER_BUF_SIZE];
+
+  /* Porting layer (nuttx/port*.c) */
+
+  bool              xEventInQueue;
+  eMBEventType      eQueuedEvent;
+  bool              bTimeoutEnable;
+  uint32_t          ulTimeOut;
+  struct timeval    xTimeLast;
+  int               iSerialFd;
+  bool              bRxEnabled;
+  bool              bTxEnabled;
+  uint32_t          ulTimeoutMs;
+  uint32_t          ulPollWaitUs;
+  int               uiRxBufferPos;
+  int               uiTxBufferPos;
+  uint8_t           ucBuffer[MB_PORT_BUF_SIZE];
+#ifdef CONFIG_SERIAL_TERMIOS
+  struct termios    xOldTIO;
+#endif
+} xMBInstance;
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* The instance currently being serviced.  Used by the protocol stack and
+ * the porting layer; applications should call pxMBGetCurrentCtx().
+ */
+
+extern xMBInstance *pxMBInstance;
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -240,6 +343,33 @@ eMBErrorCode eMBDisable(void);
 
 eMBErrorCode eMBPoll(void);
 
+/* Instance versions of eMBInit(), eMBClose(), eMBEnable(), eMBDisable()
+ * and eMBPoll().  They behave like the functions above, except that they
+ * work on pxInst, and that eMBPollCtx() does not wait for input: it only
+ * processes what the port has already received.  eMBInitCtx() clears the
+ * whole instance, including pvUserData.
+ */
+
+eMBErrorCode eMBInitCtx(xMBInstance *pxInst, eMBMode eMode,
+                        uint8_t ucSlaveAddress, uint8_t ucPort,
+                        speed_t ulBaudRate, eMBParity eParity);
+eMBErrorCode eMBCloseCtx(xMBInstance *pxInst);
+eMBErrorCode eMBEnableCtx(xMBInstance *pxInst);
+eMBErrorCode eMBDisableCtx(xMBInstance *pxInst);
+eMBErrorCode eMBPollCtx(xMBInstance *pxInst);
+
+/* Return the file descriptor of the serial port used by an instance, for
+ * use with poll(), or -1 if the port is not open.
+ */
+
+int iMBGetFdCtx(xMBInstance *pxInst);
+
+/* Return the instance being serviced.  Intended for the register
+ * callbacks, e.g. to select the register map through pvUserData.
+ */
+
+xMBInstance *pxMBGetCurrentCtx(void);
+
 /* Configure the slave id of the device.
  *
  * This function should be called when the Modbus function Report Slave ID
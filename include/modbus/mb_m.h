@@ -62,9 +62,13 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
 #include <stdint.h>
 #include <stdbool.h>
 #include <termios.h>
+#include <time.h>
+#include <pthread.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -107,6 +111,52 @@ typedef enum
     MB_TMODE_CONVERT_DELAY          /* Master sent broadcast ,then delay sometime.*/
 }eMBMasterTimerMode;
 
+#ifdef CONFIG_MB_MASTER_SCAN
+/* One range of values the application wants to read each scan cycle.
+ * ucFunc is MB_FUNC_READ_HOLDING_REGISTER, MB_FUNC_READ_INPUT_REGISTER or
+ * MB_FUNC_READ_COILS and usAddr is the protocol address as passed to
+ * eMBMasterReqReadHoldingRegister() and friends.  usCache is set by
+ * eMBMasterScanBuild().
+ */
+
+typedef struct
+{
+    uint8_t  ucSlave;               /* Slave address */
+    uint8_t  ucFunc;                /* Read function code */
+    uint16_t usAddr;                /* First register or coil */
+    uint16_t usCount;               /* Number of registers or coils */
+    uint16_t usCache;               /* Offset of the first value in the cache */
+} xMBMasterScanItem;
+
+/* One request of the scan: the union of adjacent items */
+
+typedef struct
+{
+    uint8_t  ucSlave;
+    uint8_t  ucFunc;
+    uint16_t usAddr;
+    uint16_t usCount;
+    uint16_t usCache;
+    eMBMasterReqErrCode eStatus;    /* Result of the last request */
+    struct timespec xStamp;         /* Time of the last successful read */
+} xMBMasterScanBlock;
+
+/* A scan list.  The application provides the block and cache storage;
+ * each register or coil takes one uint16_t of the cache.
+ */
+
+typedef struct
+{
+    xMBMasterScanBlock *pxBlocks;   /* Storage for the merged requests */
+    uint16_t usMaxBlocks;
+    uint16_t usNBlocks;             /* Set by eMBMasterScanBuild() */
+    uint16_t *pusCache;             /* Storage for the values */
+    uint16_t usCacheSize;           /* In values */
+    uint16_t usMaxGap;              /* Unused values to read to save a request */
+    pthread_mutex_t xLock;          /* Protects the cache and the stamps */
+} xMBMasterScan;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -459,6 +509,72 @@ eMBMasterErrorEventType eMBMasterGetErrorType(void);
 void vMBMasterSetErrorType(eMBMasterErrorEventType errorType);
 eMBMasterReqErrCode eMBMasterWaitRequestFinish(void);
 
+#ifdef CONFIG_MB_MASTER_SCAN
+/****************************************************************************
+ * Description:
+ *   Build the requests of a scan list.
+ *
+ *   The items are sorted by slave, function and address.  Items of the
+ *   same slave and function, which overlap or are at most usMaxGap values
+ *   apart, are merged into one request as long as it stays within the
+ *   limit of the function code (125 registers or 2000 coils).  The usCache
+ *   member of each item is set to the position of its values in the cache.
+ *
+ * Input Parameters:
+ *   pxScan The scan list, with the storage members set up.
+ *   pxItems The values to read; reordered by this call.
+ *   usNItems Number of items.
+ *
+ * Returned Value:
+ *   MB_MRE_NO_ERR, or MB_MRE_ILL_ARG if an item is invalid or the block or
+ *   cache storage is too small.
+ *
+ ****************************************************************************/
+
+eMBMasterReqErrCode eMBMasterScanBuild(xMBMasterScan *pxScan,
+  xMBMasterScanItem *pxItems, uint16_t usNItems);
+
+/****************************************************************************
+ * Description:
+ *   Issue all requests of a scan list and update the cache.  A failing
+ *   request does not stop the scan; its block keeps the old values and
+ *   time stamp.
+ *
+ * Returned Value:
+ *   MB_MRE_NO_ERR, or the error of the first failing request.
+ *
+ ****************************************************************************/
+
+eMBMasterReqErrCode eMBMasterScanRun(xMBMasterScan *pxScan,
+  uint32_t lTimeOut);
+
+/****************************************************************************
+ * Description:
+ *   Copy the cached values of an item.  May be called from any thread.
+ *
+ * Input Parameters:
+ *   pxScan The scan list.
+ *   pxItem An item passed to eMBMasterScanBuild().
+ *   pusValues Receives pxItem->usCount values (coils as 0 or 1).
+ *   pxStamp Receives the time of the read, may be NULL.
+ *
+ * Returned Value:
+ *   MB_MRE_NO_ERR, MB_MRE_ILL_ARG for an unknown item, or the error of the
+ *   last request of the block if it has never been read.
+ *
+ ****************************************************************************/
+
+eMBMasterReqErrCode eMBMasterScanGet(xMBMasterScan *pxScan,
+  const xMBMasterScanItem *pxItem, uint16_t *pusValues,
+  struct timespec *pxStamp);
+
+/* Called by the read function handlers while a scan is running */
+
+bool xMBMasterScanActive(void);
+eMBErrorCode eMBMasterScanStore(uint8_t *pucValues, uint16_t usAddress,
+                                uint16_t usCount);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
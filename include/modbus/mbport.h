@@ -105,10 +105,6 @@ typedef enum
  * currently blocked on the eventqueue.
  */
 
-extern bool(*pxMBFrameCBByteReceived)(void);
-extern bool(*pxMBFrameCBTransmitterEmpty)(void);
-extern bool(*pxMBPortCBTimerExpired)(void);
-
 extern bool(*pxMBMasterFrameCBByteReceived)(void);
 extern bool(*pxMBMasterFrameCBTransmitterEmpty)(void);
 extern bool(*pxMBMasterPortCBTimerExpired)(void);
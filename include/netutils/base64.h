@@ -58,6 +58,30 @@
 
 #include <nuttx/config.h>
 
+#include <sys/types.h>
+#include <stdbool.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Number of characters encoding len bytes, not including a nul terminator */
+
+#define base64_encode_len(len) ((((len) + 2) / 3) * 4)
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* State of an incremental encode or decode */
+
+struct base64_stream_s
+{
+  unsigned char buf[4];  /* Held back bytes or decoded values */
+  unsigned char n;       /* Number of entries in buf */
+  bool websafe;          /* Use the web safe alphabet */
+};
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -76,6 +100,18 @@ unsigned char *base64w_encode(const unsigned char *src, size_t len,
                               unsigned char *dst, size_t *out_len);
 unsigned char *base64w_decode(const unsigned char *src, size_t len,
                               unsigned char *dst, size_t *out_len);
+ssize_t base64_decode_len(const unsigned char *src, size_t len);
+ssize_t base64w_decode_len(const unsigned char *src, size_t len);
+
+void base64_stream_init(struct base64_stream_s *s, bool websafe);
+size_t base64_encode_update(struct base64_stream_s *s,
+                            const unsigned char *src, size_t len,
+                            unsigned char *dst);
+size_t base64_encode_final(struct base64_stream_s *s, unsigned char *dst);
+size_t base64_decode_update(struct base64_stream_s *s,
+                            const unsigned char *src, size_t len,
+                            unsigned char *dst);
+int base64_decode_final(struct base64_stream_s *s);
 #endif /* CONFIG_CODECS_BASE64 */
 
 #ifdef __cplusplus
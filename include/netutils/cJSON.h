@@ -42,6 +42,11 @@ extern "C"
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -54,8 +59,54 @@ extern "C"
 #define cJSON_Array  5
 #define cJSON_Object 6
 
+/* Additional event types of the streaming reader */
+
+#define cJSON_ArrayEnd  7
+#define cJSON_ObjectEnd 8
+
 #define cJSON_IsReference 256
 
+/* Field types of a struct binding */
+
+#define cJSON_FieldInt      0   /* int, from an integral JSON number */
+#define cJSON_FieldDouble   1   /* double, from a JSON number */
+#define cJSON_FieldBool     2   /* bool, from true or false */
+#define cJSON_FieldString   3   /* char array, NUL terminated */
+#define cJSON_FieldObject   4   /* Nested struct, with its own fields */
+#define cJSON_FieldIntArray 5   /* int array with an int element count */
+
+/* The maximum nesting depth of bound objects */
+
+#define cJSON_BIND_MAXDEPTH 8
+
+/* Initializers of the cJSON_Field descriptors of a struct binding.  'st' is
+ * the struct type, 'member' the member and 'key' the JSON member name.  A
+ * table of descriptors ends with cJSON_FIELD_END.
+ */
+
+#define cJSON_FIELD_SIZEOF(st, member) sizeof(((st *)0)->member)
+
+#define cJSON_FIELD_INT(st, member, key) \
+  { key, cJSON_FieldInt, offsetof(st, member), \
+    cJSON_FIELD_SIZEOF(st, member), NULL, 0 }
+#define cJSON_FIELD_DOUBLE(st, member, key) \
+  { key, cJSON_FieldDouble, offsetof(st, member), \
+    cJSON_FIELD_SIZEOF(st, member), NULL, 0 }
+#define cJSON_FIELD_BOOL(st, member, key) \
+  { key, cJSON_FieldBool, offsetof(st, member), \
+    cJSON_FIELD_SIZEOF(st, member), NULL, 0 }
+#define cJSON_FIELD_STRING(st, member, key) \
+  { key, cJSON_FieldString, offsetof(st, member), \
+    cJSON_FIELD_SIZEOF(st, member), NULL, 0 }
+#define cJSON_FIELD_OBJECT(st, member, key, fields) \
+  { key, cJSON_FieldObject, offsetof(st, member), \
+    cJSON_FIELD_SIZEOF(st, member), fields, 0 }
+#define cJSON_FIELD_INTARRAY(st, member, count, key) \
+  { key, cJSON_FieldIntArray, offsetof(st, member), \
+    cJSON_FIELD_SIZEOF(st, member), NULL, offsetof(st, count) }
+#define cJSON_FIELD_END \
+  { NULL, 0, 0, 0, NULL, 0 }
+
 #define cJSON_AddNullToObject(object,name) \
   cJSON_AddItemToObject(object, name, cJSON_CreateNull())
 #define cJSON_AddTrueToObject(object,name) \
@@ -97,6 +148,14 @@ typedef struct cJSON
    */
 
   char *string;
+
+#ifdef CONFIG_NETUTILS_JSON_INDEX
+  /* Hash index of the members of a large object, built by the first
+   * look-up and discarded when the members change.
+   */
+
+  struct cJSON_Index *index;
+#endif
 } cJSON;
 
 typedef struct cJSON_Hooks
@@ -105,6 +164,81 @@ typedef struct cJSON_Hooks
   void (*free_fn)(void *ptr);
 } cJSON_Hooks;
 
+/* The streaming reader reports each value with a call to a callback of
+ * this type.  'type' is cJSON_Object or cJSON_Array at the start of an
+ * object or array, cJSON_ObjectEnd or cJSON_ArrayEnd at its end, or the
+ * type of a simple value.  'name' is the member name within an object (or
+ * NULL).  'valuestring' is the decoded string of a cJSON_String or the text
+ * of a cJSON_Number, whose value is in 'valuedouble'.  The strings are only
+ * valid during the call.  Return non-zero to stop parsing.
+ */
+
+typedef int (*cJSON_StreamCallback)(void *arg, int type, const char *name,
+                                    const char *valuestring,
+                                    double valuedouble);
+
+/* The state of a streaming reader.  The token buffer holds the member name
+ * and the string or number being read, so it limits their combined
+ * length.
+ */
+
+typedef struct cJSON_Reader
+{
+  cJSON_StreamCallback callback;
+  void *arg;
+  char *buffer;           /* Token buffer */
+  size_t size;            /* Size of the token buffer */
+  size_t len;             /* Bytes used in the token buffer */
+  size_t namelen;         /* Size of the pending member name (or 0) */
+  unsigned long nest;     /* One bit per nesting level: 1=object */
+  int depth;              /* Current nesting level */
+  int state;              /* Parser state */
+  int nhex;               /* Number of \u digits collected */
+  unsigned uc;            /* Value of the \u escape being collected */
+  unsigned surrogate;     /* Pending first half of a surrogate pair */
+  bool isname;            /* True: The string is a member name */
+} cJSON_Reader;
+
+/* Descriptor of one member of a struct bound to a JSON object */
+
+typedef struct cJSON_Field
+{
+  const char *key;                  /* JSON member name (NULL: end) */
+  int type;                         /* cJSON_Field* type */
+  size_t offset;                    /* Offset of the member in the struct */
+  size_t size;                      /* Size of the member */
+  const struct cJSON_Field *fields; /* Fields of a cJSON_FieldObject */
+  size_t count;                     /* Offset of the int element count of
+                                     * a cJSON_FieldIntArray */
+} cJSON_Field;
+
+/* The state of a struct binding parse */
+
+typedef struct cJSON_Bind
+{
+  struct
+    {
+      const cJSON_Field *fields;    /* Fields of the object */
+      const cJSON_Field *array;     /* The array being filled, or NULL */
+      char *base;                   /* Address of the (nested) struct */
+    } stack[cJSON_BIND_MAXDEPTH];
+  int depth;                        /* Number of entries in stack */
+  int skip;                         /* Nesting level of a skipped value */
+} cJSON_Bind;
+
+/* The state of a streaming writer */
+
+typedef struct cJSON_Writer
+{
+  char *buffer;           /* Output buffer */
+  size_t size;            /* Size of the output buffer */
+  size_t len;             /* Bytes used in the output buffer */
+  unsigned long nest;     /* One bit per nesting level: 1=needs a comma */
+  int depth;              /* Current nesting level */
+  int fd;                 /* Output file descriptor (or -1) */
+  bool error;             /* True: An error occurred */
+} cJSON_Writer;
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -119,6 +253,21 @@ void cJSON_InitHooks(cJSON_Hooks* hooks);
 
 cJSON *cJSON_Parse(const char *value);
 
+/* Supply a writable block of JSON and an arena of 'size' bytes, and this
+ * returns a cJSON object like cJSON_Parse() without using the heap.  The
+ * nodes are taken from the arena and the strings are decoded in place, so
+ * the input is modified and must be kept as long as the object is used.
+ * Each node takes about sizeof(cJSON) bytes of the arena.  If 'used' is not
+ * NULL, it returns the number of arena bytes consumed.  Returns NULL if the
+ * text is malformed or the arena is too small.
+ *
+ * Do not call cJSON_Delete() or modify the object; just release the arena
+ * (and the input) when finished.
+ */
+
+cJSON *cJSON_ParseInSitu(char *value, void *arena, size_t size,
+                         size_t *used);
+
 /* Render a cJSON entity to text for transfer/storage. Free the char* when
  * finished.
  */
@@ -149,6 +298,10 @@ cJSON *cJSON_GetArrayItem(cJSON *array, int item);
 
 cJSON *cJSON_GetObjectItem(cJSON *object, const char *string);
 
+/* Get item "string" from object.  Case sensitive. */
+
+cJSON *cJSON_GetObjectItemCaseSensitive(cJSON *object, const char *string);
+
 /* For analysing failed parses. This returns a pointer to the parse error.
  * You'll probably need to look a few chars back to make sense of it.
  * Defined when cJSON_Parse() returns 0. 0 when cJSON_Parse() succeeds.
@@ -194,6 +347,67 @@ void cJSON_DeleteItemFromArray(cJSON *array, int which);
 cJSON *cJSON_DetachItemFromObject(cJSON *object, const char *string);
 void cJSON_DeleteItemFromObject(cJSON *object, const char *string);
 
+/* Streaming reader:  Parse JSON text supplied in chunks of any size,
+ * reporting each value to 'callback' instead of building a tree.  'buffer'
+ * holds one member name and one string or number at a time.  Feed and
+ * Finish return 0 on success or -1 if the text is malformed, a token does
+ * not fit in the buffer, the nesting is too deep, or the callback stopped
+ * the parse.
+ */
+
+void cJSON_ReaderInit(cJSON_Reader *reader, char *buffer, size_t size,
+                      cJSON_StreamCallback callback, void *arg);
+int cJSON_ReaderFeed(cJSON_Reader *reader, const char *data, size_t len);
+int cJSON_ReaderFinish(cJSON_Reader *reader);
+
+/* Streaming writer:  Render unformatted JSON directly into 'buffer'.  If
+ * 'fd' is a valid file descriptor, the buffer is written to it whenever it
+ * fills and by cJSON_WriterFlush().  Otherwise the whole text must fit in
+ * the buffer, and cJSON_WriterFlush() NUL terminates it.  'name' is the
+ * member name inside an object and NULL otherwise.  All return 0 on
+ * success or -1 once an error has occurred.
+ */
+
+void cJSON_WriterInit(cJSON_Writer *writer, char *buffer, size_t size,
+                      int fd);
+int cJSON_WriteObjectStart(cJSON_Writer *writer, const char *name);
+int cJSON_WriteObjectEnd(cJSON_Writer *writer);
+int cJSON_WriteArrayStart(cJSON_Writer *writer, const char *name);
+int cJSON_WriteArrayEnd(cJSON_Writer *writer);
+int cJSON_WriteString(cJSON_Writer *writer, const char *name,
+                      const char *string);
+int cJSON_WriteNumber(cJSON_Writer *writer, const char *name, double num);
+int cJSON_WriteBool(cJSON_Writer *writer, const char *name, int b);
+int cJSON_WriteNull(cJSON_Writer *writer, const char *name);
+int cJSON_WriterFlush(cJSON_Writer *writer);
+
+/* Struct binding:  Parse a JSON object straight into a C struct described
+ * by a table of cJSON_Field descriptors, or write a struct as JSON, without
+ * building a tree.  Members without a descriptor are skipped; a value of
+ * the wrong type (including a number with a fraction or out of range for
+ * an int), a string that does not fit or an array that is too long is an
+ * error.  Members not present in the text are left unchanged, so the
+ * struct may be initialized with defaults first; after an error it may have
+ * been partly updated.  'token' is the token buffer of the streaming
+ * reader.  Return 0 on success, -1 on error.
+ */
+
+int cJSON_BindParse(const cJSON_Field *fields, void *st, const char *text,
+                    size_t len, char *token, size_t tokensize);
+int cJSON_BindWrite(cJSON_Writer *writer, const char *name,
+                    const cJSON_Field *fields, const void *st);
+int cJSON_BindPrint(const cJSON_Field *fields, const void *st,
+                    char *buffer, size_t size);
+
+/* For input arriving in chunks:  Prepare 'reader' to parse into 'st' and
+ * then use cJSON_ReaderFeed() and cJSON_ReaderFinish() as usual.  'bind'
+ * holds the binding state and must stay valid during the parse.
+ */
+
+void cJSON_BindReaderInit(cJSON_Reader *reader, cJSON_Bind *bind,
+                          const cJSON_Field *fields, void *st,
+                          char *token, size_t tokensize);
+
 /* Update array items. */
 
 void cJSON_ReplaceItemInArray(cJSON *array, int which, cJSON *newitem);
@@ -78,6 +78,7 @@ extern "C"
 FAR void *dhcpc_open(FAR const char *interface,
                      FAR const void *mac_addr, int mac_len);
 int  dhcpc_request(FAR void *handle, FAR struct dhcpc_state *presult);
+int  dhcpc_reboot(FAR void *handle, FAR struct dhcpc_state *presult);
 void dhcpc_close(FAR void *handle);
 
 #undef EXTERN
@@ -42,6 +42,8 @@
  * Included Files
  ****************************************************************************/
 
+#include <netinet/in.h>
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -62,6 +64,7 @@ extern "C"
 #define EXTERN extern
 #endif
 
+int dhcpd_setpool(in_addr_t startip, unsigned int nleases);
 int dhcpd_run(void);
 
 #undef EXTERN
@@ -37,9 +37,38 @@
 #define __APPS_INCLUDE_NETUTILS_DISCOVER_H
 
 #include <stdint.h>
+#include <netinet/in.h>
 
 /****************************************************************************
- * Public Function Prototypes
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Discover request packet format:
+ * Byte Description
+ * 0    Protocol indentifier (0x99)
+ * 1    Request command 0x01
+ * 2    Destination device class (For querying subsets of available devices)
+ *      0xff for all devices
+ * 3    Checksum (Byte 0 - Byte 1 - Byte n) & 0xff
+ */
+
+/* Discover response packet format:
+ * Byte Description
+ * 0    Protocol indentifier (0x99)
+ * 1    Reponse command (0x02)
+ * 2-33 Device description string with 0 bytes filled
+ * 34   Checksum (Byte 0 - Byte 1 - Byte n) & 0xff
+ */
+
+#define DISCOVER_PROTO_ID 0x99
+#define DISCOVER_REQUEST 0x01
+#define DISCOVER_RESPONSE 0x02
+#define DISCOVER_ALL 0xff
+#define DISCOVER_REQUEST_SIZE 4
+#define DISCOVER_RESPONSE_SIZE 35
+
+/****************************************************************************
+ * Public Types
  ****************************************************************************/
 
 struct discover_info_s
@@ -48,6 +77,18 @@ struct discover_info_s
   const char *description;
 };
 
+/* One device found by discover_scan() */
+
+struct discover_response_s
+{
+  in_addr_t ipaddr;         /* Address of the device, network order */
+  char description[DISCOVER_RESPONSE_SIZE - 2];
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
 /****************************************************************************
  * Name: discover_start
  *
@@ -67,4 +108,19 @@ struct discover_info_s
 
 int discover_start(struct discover_info_s *info);
 
+/****************************************************************************
+ * Name: discover_scan
+ *
+ * Description:
+ *   Send one discover request to dest and collect the responses arriving
+ *   within window milliseconds, one per responding device.
+ *
+ * Return:
+ *   The number of devices found; a negated errno on failure.
+ *
+ ****************************************************************************/
+
+int discover_scan(uint8_t devclass, in_addr_t dest, int window,
+                  struct discover_response_s *resp, int maxresp);
+
 #endif /* __APPS_INCLUDE_NETUTILS_DISCOVER_H */
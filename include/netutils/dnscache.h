@@ -0,0 +1,139 @@
+/****************************************************************************
+ * apps/include/netutils/dnscache.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_NETUTILS_DNSCACHE_H
+#define __APPS_INCLUDE_NETUTILS_DNSCACHE_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <netinet/in.h>
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* The addresses known for one host name */
+
+struct dnscache_addr_s
+{
+  bool            have_ipv4;
+  bool            have_ipv6;
+  struct in_addr  ipv4;
+  struct in6_addr ipv6;
+};
+
+/* Cache counters since boot or the last dnscache_flush() */
+
+struct dnscache_stats_s
+{
+  uint32_t hits;                 /* Answered from the cache */
+  uint32_t neghits;              /* Failures answered from the cache */
+  uint32_t misses;               /* Lookups that had to be resolved */
+  uint32_t queries;              /* DNS queries sent */
+  uint32_t fallbacks;            /* Misses resolved by gethostbyname() */
+  uint32_t evictions;            /* Live entries replaced */
+};
+
+/* One cache entry as reported by dnscache_foreach() */
+
+struct dnscache_info_s
+{
+  FAR const char *name;
+  FAR const struct dnscache_addr_s *addr;
+  int32_t  ttl;                  /* Seconds left, -1 for hosts file names */
+  uint32_t hits;
+  bool     negative;             /* A remembered failure */
+};
+
+typedef CODE int (*dnscache_callback_t)(FAR void *arg,
+                                        FAR const struct dnscache_info_s *info);
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/* Resolve a host name or numeric address through the cache.  Returns OK or
+ * -ENOENT if the name cannot be resolved.
+ */
+
+int  dnscache_lookup(FAR const char *hostname,
+                     FAR struct dnscache_addr_s *addr);
+
+/* Like dnscache_lookup() for callers that only use IPv4 */
+
+int  dnscache_gethostip(FAR const char *hostname, FAR in_addr_t *ipv4addr);
+
+/* Add the names of a hosts file as entries that never expire.  Returns the
+ * number of names added or a negated errno value.
+ */
+
+int  dnscache_loadhosts(FAR const char *path);
+
+/* Call 'callback' for each entry, stopping when it returns non-zero.  The
+ * cache is locked meanwhile, so the callback must not use it.
+ */
+
+int  dnscache_foreach(dnscache_callback_t callback, FAR void *arg);
+
+void dnscache_getstats(FAR struct dnscache_stats_s *stats);
+
+/* Drop all entries, including the hosts file names, and clear the
+ * counters.  The hosts file is read again on the next lookup.
+ */
+
+void dnscache_flush(void);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __APPS_INCLUDE_NETUTILS_DNSCACHE_H */
@@ -219,6 +219,11 @@ void ftpc_dirfree(FAR struct ftpc_dirlist_s *dirlist);
 
 int ftpc_getfile(SESSION handle, FAR const char *rname,
                  FAR const char *lname, uint8_t how, uint8_t xfrmode);
+#ifdef CONFIG_FTPC_SEGMENTED_GET
+int ftpc_getsegments(SESSION handle, FAR const char *rname,
+                     FAR const char *lname, uint8_t how,
+                     unsigned int nsegments);
+#endif
 int ftp_putfile(SESSION handle, FAR const char *lname,
                 FAR const char *rname, uint8_t how, uint8_t xfrmode);
 
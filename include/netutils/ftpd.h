@@ -66,6 +66,11 @@
  *     transfers.  Default: 512 bytes.
  *   CONFIG_FTPD_WORKERSTACKSIZE - The stacksize to allocate for each
  *     FTP daemon worker thread.  Default:  2048 bytes.
+ *   CONFIG_FTPD_MAXSESSIONS - The number of sessions that may be served
+ *     concurrently.  The workers and their buffers are allocated when the
+ *     server is opened.  Default: 2
+ *   CONFIG_FTPD_SENDFILE - Send files in binary mode RETR with sendfile().
+ *     Default: n
  */
 
 #ifdef CONFIG_DISABLE_PTHREAD
@@ -96,6 +101,14 @@
 #  define CONFIG_FTPD_WORKERSTACKSIZE 2048
 #endif
 
+#ifndef CONFIG_FTPD_MAXSESSIONS
+#  define CONFIG_FTPD_MAXSESSIONS 2
+#endif
+
+#if CONFIG_FTPD_MAXSESSIONS < 1
+#  error "CONFIG_FTPD_MAXSESSIONS must be at least 1"
+#endif
+
 /* Interface definitions ****************************************************/
 
 #define FTPD_ACCOUNTFLAG_NONE    (0)
@@ -178,8 +191,10 @@ int ftpd_adduser(FTPD_SESSION handle, uint8_t accountflags,
  * Description:
  *   Execute the FTPD server.  This thread does not return until either (1)
  *   the timeout expires with no connection, (2) some other error occurs, or
- *   (2) a connection was accepted and an FTP worker thread was started to
- *   service the session.  Each call to ftpd_session creates on session.
+ *   (2) a connection was accepted and handed to an idle FTP worker thread
+ *   to service the session.  Each call to ftpd_session creates on session.
+ *   If all CONFIG_FTPD_MAXSESSIONS workers are busy, the client receives a
+ *   "421" reply and is disconnected.
  *
  * Input Parameters:
  *   handle - A handle previously returned by ftpd_open
@@ -187,10 +202,11 @@ int ftpd_adduser(FTPD_SESSION handle, uint8_t accountflags,
  *     time elapses with no connected, the -ETIMEDOUT error will be returned.
  *
  * Returned Value:
- *   Zero is returned if the FTP worker was started.  On failure, a negated
- *   errno value is returned to indicate why the server terminated.
- *   -ETIMEDOUT indicates that the user-provided timeout elapsed with no
- *   connection.
+ *   Zero is returned if the session was handed to an FTP worker.  On
+ *   failure, a negated errno value is returned to indicate why the server
+ *   terminated.  -ETIMEDOUT indicates that the user-provided timeout elapsed
+ *   with no connection; -EBUSY indicates that a connection was refused
+ *   because all workers were busy.
  *
  ****************************************************************************/
 
@@ -200,7 +216,8 @@ int ftpd_session(FTPD_SESSION handle, int timeout);
  * Name: ftpd_close
  *
  * Description:
- *   Close and destroy the handle created by ftpd_open.
+ *   Close and destroy the handle created by ftpd_open.  The worker threads
+ *   are stopped; this waits for any session in progress to end.
  *
  * Input Parameters:
  *   handle - A handle previously returned by ftpd_open
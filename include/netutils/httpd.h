@@ -49,6 +49,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <limits.h>
+#include <time.h>
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -93,12 +94,32 @@
 
 #define HTTPD_MAX_FILENAME CONFIG_NETUTILS_HTTPD_MAXPATH
 
+/* This is the number of connections serviced by the poll()-based server */
+
+#ifndef CONFIG_NETUTILS_HTTPD_MAXCONNECT
+#  define CONFIG_NETUTILS_HTTPD_MAXCONNECT 4
+#endif
+
+#if defined(CONFIG_NETUTILS_HTTPD_STATS) && !defined(CONFIG_NETUTILS_HTTPD_STATS_URL)
+#  define CONFIG_NETUTILS_HTTPD_STATS_URL "/server-status"
+#endif
+
 /* Other tunable values.  If you need to change these values, please create
  * new configurations in apps/netutils/webserver/Kconfig
  */
 
 #define HTTPD_MAX_CONTENTLEN  32
-#define HTTPD_MAX_HEADERLEN   180
+#ifdef CONFIG_NETUTILS_HTTPD_CACHE
+#  define HTTPD_HEADERLEN_CACHE 40  /* Room for the ETag header */
+#else
+#  define HTTPD_HEADERLEN_CACHE 0
+#endif
+#ifdef CONFIG_NETUTILS_HTTPD_GZIP
+#  define HTTPD_HEADERLEN_GZIP 50   /* Room for Content-Encoding and Vary */
+#else
+#  define HTTPD_HEADERLEN_GZIP 0
+#endif
+#define HTTPD_MAX_HEADERLEN   (180 + HTTPD_HEADERLEN_CACHE + HTTPD_HEADERLEN_GZIP)
 
 /****************************************************************************
  * Public types
@@ -111,6 +132,9 @@ struct httpd_fs_file
 #if defined(CONFIG_NETUTILS_HTTPD_MMAP) || defined(CONFIG_NETUTILS_HTTPD_SENDFILE)
   int fd;
 #endif
+#ifdef CONFIG_NETUTILS_HTTPD_CACHE
+  FAR void *cache;  /* Cache entry holding the data, if cached */
+#endif
 };
 
 struct httpd_state
@@ -125,6 +149,19 @@ struct httpd_state
   char    *ht_scriptptr;
   uint16_t ht_scriptlen;
   uint16_t ht_sndlen;
+  uint16_t ht_recvlen;                      /* Bytes held in ht_buffer */
+  uint8_t  ht_parsestate;                   /* Request parser state */
+#ifdef CONFIG_NETUTILS_HTTPD_GZIP
+  bool     ht_acceptgzip;                   /* Accept-Encoding: gzip */
+  bool     ht_gzip;                         /* Sending the .gz variant */
+#endif
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+  uint8_t  ht_sclass;                       /* Statistics class of the response */
+  uint32_t ht_nsent;                        /* Bytes sent for the response */
+#endif
+#ifdef CONFIG_NETUTILS_HTTPD_POLLCONNECT
+  time_t   ht_timestamp;                    /* Time of last activity (sec) */
+#endif
 };
 
 struct httpd_fsdata_file
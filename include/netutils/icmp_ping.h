@@ -0,0 +1,158 @@
+/****************************************************************************
+ * apps/include/netutils/icmp_ping.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_NETUTILS_ICMP_PING_H
+#define __APPS_INCLUDE_NETUTILS_ICMP_PING_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <time.h>
+
+#include <netinet/in.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Round-trip times are counted in a histogram of power-of-two buckets:
+ * bucket 0 counts replies under 1 msec, bucket n (n > 0) those from
+ * 2**(n-1) up to 2**n msec, and the last bucket everything slower.
+ */
+
+#define ICMP_PING_NBUCKETS 10
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* One host pinged by icmp_pinghosts().  The caller sets 'addr'; the rest
+ * is filled in with the results.
+ */
+
+struct icmp_pinghost_s
+{
+  struct in_addr addr;      /* Host to ping */
+
+  uint16_t nsent;           /* ECHO requests sent */
+  uint16_t nrecvd;          /* Matching ECHO replies received */
+  uint16_t ndup;            /* Duplicate replies (not counted) */
+  uint32_t min;             /* Shortest round trip (usec) */
+  uint32_t max;             /* Longest round trip (usec) */
+  uint64_t sum;             /* Sum of the round trips (usec) */
+  uint64_t sumsq;           /* Sum of their squares */
+  uint16_t hist[ICMP_PING_NBUCKETS];
+
+  uint32_t recvmask;        /* Internal: Replies seen in the last 32 rounds */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: icmp_pinghosts
+ *
+ * Description:
+ *   Ping many hosts at once.  Every 'interval' msec one ECHO request is
+ *   sent to each host, 'count' times, all from one ICMP socket.  Replies
+ *   are matched to their host and request by the ICMP ID and sequence
+ *   number, so any number of requests may be outstanding.  Replies are
+ *   accepted until all have arrived or until 'timeout' msec after the last
+ *   requests were sent.
+ *
+ * Input Parameters:
+ *   hosts    - The hosts to ping, with their results on return
+ *   nhosts   - The number of hosts
+ *   count    - The number of requests to send to each host
+ *   interval - The time between requests to the same host (msec)
+ *   timeout  - How long to wait for the last replies (msec)
+ *
+ * Returned Value:
+ *   Zero (OK) on success, even if hosts did not answer; a negated errno
+ *   value if the pings could not be sent.
+ *
+ ****************************************************************************/
+
+int icmp_pinghosts(FAR struct icmp_pinghost_s *hosts, int nhosts,
+                   int count, int interval, int timeout);
+
+/****************************************************************************
+ * Name: icmp_pingavg and icmp_pingstddev
+ *
+ * Description:
+ *   Return the mean and the standard deviation of the round trips to a
+ *   host (usec), or zero if it never answered.
+ *
+ ****************************************************************************/
+
+uint32_t icmp_pingavg(FAR const struct icmp_pinghost_s *host);
+uint32_t icmp_pingstddev(FAR const struct icmp_pinghost_s *host);
+
+/****************************************************************************
+ * Name: ipv4_ping
+ *
+ * Description:
+ *   Send one ECHO request to 'raddr' and wait up to 'timeout' for the
+ *   reply.
+ *
+ * Returned Value:
+ *   Zero (OK) with the round trip time in 'roundtrip'; -ETIMEDOUT if there
+ *   was no reply; another negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int ipv4_ping(FAR struct sockaddr_in *raddr,
+              FAR const struct timespec *timeout,
+              FAR struct timespec *roundtrip);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __APPS_INCLUDE_NETUTILS_ICMP_PING_H */
@@ -63,6 +63,9 @@
 
 #include <nuttx/config.h>
 
+#include <sys/types.h>
+#include <stdint.h>
+
 #ifdef CONFIG_CODECS_HASH_MD5
 
 #ifdef __cplusplus
@@ -83,6 +86,11 @@ struct MD5Context
 
 typedef struct MD5Context MD5_CTX;
 
+/* Processes nblocks whole 64-byte blocks of message bytes into state */
+
+typedef CODE void (*md5_blocks_t)(FAR uint32_t state[4],
+                                  FAR const uint8_t *data, size_t nblocks);
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -95,6 +103,12 @@ void MD5Transform(uint32_t buf[4], uint32_t const in[16]);
 
 void md5_sum(const uint8_t *addr, const size_t len, uint8_t *mac);
 char *md5_hash(const uint8_t *addr, const size_t len);
+void md5_tohex(FAR const uint8_t digest[16], FAR char hash[33]);
+int md5_file(FAR const char *path, FAR uint8_t *mac);
+
+#ifdef CONFIG_CODECS_HASH_MD5_BACKEND
+void md5_set_backend(md5_blocks_t blocks);
+#endif
 
 #ifdef __cplusplus
 }
@@ -55,6 +55,7 @@
 #include <pthread.h>
 
 #include <netinet/in.h>
+#include <net/if.h>
 #include <nuttx/net/netconfig.h>
 
 /****************************************************************************
@@ -67,11 +68,15 @@
 #  define HAVE_ROUTE_PROCFS
 #endif
 
-#ifdef HAVE_ROUTE_PROCFS
-#  ifndef CONFIG_NETLIB_PROCFS_MOUNTPT
-#    define CONFIG_NETLIB_PROCFS_MOUNTPT "/proc"
-#  endif
+#ifndef CONFIG_NETLIB_PROCFS_MOUNTPT
+#  define CONFIG_NETLIB_PROCFS_MOUNTPT "/proc"
+#endif
 
+/* Network devices are enumerated from the /proc/net directory */
+
+#define NETLIB_NETDEV_PATH CONFIG_NETLIB_PROCFS_MOUNTPT "/net"
+
+#ifdef HAVE_ROUTE_PROCFS
 #  define IPv4_ROUTE_PATH CONFIG_NETLIB_PROCFS_MOUNTPT "/net/route/ipv4"
 #  define IPv6_ROUTE_PATH CONFIG_NETLIB_PROCFS_MOUNTPT "/net/route/ipv6"
 #endif
@@ -148,6 +153,27 @@
 #  define NETLIB_SOCK_TYPE SOCK_DGRAM
 #endif
 
+/* Bits of struct netlib_ifinfo_s valid, telling which attributes were
+ * fetched.  The same bits are used in the change mask passed to a
+ * netlib_ifchange_t callback, with NETLIB_IFCHANGE_ADDED/REMOVED added.
+ */
+
+#define NETLIB_IFINFO_FLAGS        (1 << 0) /* flags */
+#define NETLIB_IFINFO_IPV4ADDR     (1 << 1) /* ipv4addr */
+#define NETLIB_IFINFO_DRIPV4ADDR   (1 << 2) /* dripv4addr */
+#define NETLIB_IFINFO_IPV4NETMASK  (1 << 3) /* ipv4netmask */
+#define NETLIB_IFINFO_IPV6ADDR     (1 << 4) /* ipv6addr */
+#define NETLIB_IFINFO_MACADDR      (1 << 5) /* macaddr */
+
+#define NETLIB_IFCHANGE_ADDED      (1 << 14) /* Interface appeared */
+#define NETLIB_IFCHANGE_REMOVED    (1 << 15) /* Interface went away */
+
+#ifdef CONFIG_NETLIB_IFMONITOR
+#  ifndef CONFIG_NETLIB_IFMONITOR_MAXIFS
+#    define CONFIG_NETLIB_IFMONITOR_MAXIFS 4
+#  endif
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -180,6 +206,68 @@ struct netlib_ipv6_route_s
 #endif
 #endif /* HAVE_ROUTE_PROCFS */
 
+/* A netlib context keeps one socket open for the driver ioctls of many
+ * calls.
+ */
+
+struct netlib_ctx_s
+{
+  int sockfd;                     /* Socket used for the ioctls */
+};
+
+/* All attributes of one interface, fetched by netlib_get_ifinfo() */
+
+struct netlib_ifinfo_s
+{
+  char ifname[IFNAMSIZ];          /* Interface name */
+  uint16_t valid;                 /* NETLIB_IFINFO_* bits of valid fields */
+  uint8_t flags;                  /* IFF_* interface flags */
+#ifdef CONFIG_NET_IPv4
+  struct in_addr ipv4addr;        /* IPv4 address */
+  struct in_addr dripv4addr;      /* Default router IPv4 address */
+  struct in_addr ipv4netmask;     /* IPv4 network mask */
+#endif
+#ifdef CONFIG_NET_IPv6
+  struct in6_addr ipv6addr;       /* IPv6 address */
+#endif
+#ifdef CONFIG_NET_ETHERNET
+  uint8_t macaddr[IFHWADDRLEN];   /* MAC address */
+#endif
+};
+
+/* Called by netlib_foreach_ifinfo() for each interface.  A non-zero return
+ * ends the enumeration.
+ */
+
+typedef int (*netlib_ifinfo_cb_t)(FAR const struct netlib_ifinfo_s *info,
+                                  FAR void *arg);
+
+#ifdef CONFIG_NETLIB_IFMONITOR
+/* Called by the interface monitor when an interface appears, goes away or
+ * any of its attributes change.  changed holds the NETLIB_IFINFO_* bits of
+ * the changed attributes and possibly NETLIB_IFCHANGE_ADDED/REMOVED.
+ */
+
+typedef void (*netlib_ifchange_t)(FAR const struct netlib_ifinfo_s *info,
+                                  uint16_t changed, FAR void *arg);
+
+/* Interface monitor state.  Treat as opaque. */
+
+struct netlib_ifmon_s
+{
+  struct netlib_ctx_s ctx;        /* Shared ioctl socket */
+  pthread_t thread;               /* Monitor thread */
+  pthread_mutex_t lock;           /* Protects stop */
+  pthread_cond_t cond;            /* Signals stop */
+  netlib_ifchange_t callback;     /* Change callback */
+  FAR void *arg;                  /* Callback argument */
+  int interval;                   /* Sampling interval in milliseconds */
+  bool stop;                      /* Set to stop the monitor */
+  int nifs;                       /* Number of interfaces in ifs */
+  struct netlib_ifinfo_s ifs[CONFIG_NETLIB_IFMONITOR_MAXIFS];
+};
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -323,11 +411,31 @@ int  netlib_parsehttpurl(FAR const char *url, uint16_t *port,
 int netlib_listenon(uint16_t portno);
 void netlib_server(uint16_t portno, pthread_startroutine_t handler,
                 int stacksize);
+void netlib_poolserver(uint16_t portno, pthread_startroutine_t handler,
+                       int stacksize, int nworkers, int nlisteners);
 
 int netlib_getifstatus(FAR const char *ifname, FAR uint8_t *flags);
 int netlib_ifup(FAR const char *ifname);
 int netlib_ifdown(FAR const char *ifname);
 
+/* Interface attributes fetched over one shared socket */
+
+int netlib_open_ctx(FAR struct netlib_ctx_s *ctx);
+void netlib_close_ctx(FAR struct netlib_ctx_s *ctx);
+int netlib_get_ifinfo(FAR struct netlib_ctx_s *ctx, FAR const char *ifname,
+                      FAR struct netlib_ifinfo_s *info);
+int netlib_foreach_ifinfo(FAR struct netlib_ctx_s *ctx,
+                          netlib_ifinfo_cb_t callback, FAR void *arg);
+
+#ifdef CONFIG_NETLIB_IFMONITOR
+/* Interface change notifications */
+
+int netlib_start_ifmonitor(FAR struct netlib_ifmon_s *mon,
+                           netlib_ifchange_t callback, FAR void *arg,
+                           int interval);
+int netlib_stop_ifmonitor(FAR struct netlib_ifmon_s *mon);
+#endif
+
 /* DNS server addressing */
 
 #if defined(CONFIG_NET_IPv4) && defined(CONFIG_NETDB_DNSCLIENT)
@@ -42,6 +42,12 @@
 
 #include <nuttx/config.h>
 
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include <netinet/in.h>
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -71,10 +77,50 @@
 #  define CONFIG_NETUTILS_NTPCLIENT_SIGWAKEUP 18
 #endif
 
+#ifndef CONFIG_NETUTILS_NTPCLIENT_MAXSERVERS
+#  define CONFIG_NETUTILS_NTPCLIENT_MAXSERVERS 4
+#endif
+
+#ifndef CONFIG_NETUTILS_NTPCLIENT_STEPMSEC
+#  define CONFIG_NETUTILS_NTPCLIENT_STEPMSEC 128
+#endif
+
+#ifndef CONFIG_NETUTILS_NTPCLIENT_SLEWPPM
+#  define CONFIG_NETUTILS_NTPCLIENT_SLEWPPM 500
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
 
+/* The state of one NTP server, as returned by ntpc_status() */
+
+struct ntpc_server_status_s
+{
+  in_addr_t addr;           /* Server address (network order) */
+  uint8_t   reach;          /* Reachability register, bit 0 is the last poll */
+  uint8_t   nsamples;       /* Samples in the clock filter */
+  bool      selected;       /* Used in the last clock update */
+  int32_t   offset;         /* Filtered clock offset (usec) */
+  int32_t   delay;          /* Filtered round-trip delay (usec) */
+  int32_t   jitter;         /* RMS offset jitter (usec) */
+};
+
+/* The synchronization state returned by ntpc_status() */
+
+struct ntpc_status_s
+{
+  bool      synced;         /* The clock has been set */
+  uint8_t   nservers;       /* Number of servers in use */
+  uint8_t   nselected;      /* Servers used in the last clock update */
+  int32_t   offset;         /* Offset corrected by the last update (usec) */
+  int32_t   pending;        /* Part of that correction not yet slewed (usec) */
+  uint32_t  nupdates;       /* Number of clock updates */
+  uint32_t  nsteps;         /* Number of those that stepped the clock */
+  time_t    lastupdate;     /* Time of the last update */
+  struct ntpc_server_status_s server[CONFIG_NETUTILS_NTPCLIENT_MAXSERVERS];
+};
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -120,6 +166,19 @@ int ntpc_start(void);
 int ntpc_stop(void);
 #endif
 
+/****************************************************************************
+ * Name: ntpc_status
+ *
+ * Description:
+ *   Get a snapshot of the synchronization state of the NTP daemon.
+ *
+ * Returned Value:
+ *   Zero on success; -ESRCH if the NTP daemon is not running.
+ *
+ ****************************************************************************/
+
+int ntpc_status(FAR struct ntpc_status_s *status);
+
 #undef EXTERN
 #ifdef __cplusplus
 }
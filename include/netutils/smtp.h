@@ -44,6 +44,8 @@
  * Included Files
  ****************************************************************************/
 
+#include <sys/types.h>
+
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/ip.h>
 
@@ -51,6 +53,35 @@
  * Type Definitions
  ****************************************************************************/
 
+/* A body source fills buffer with up to buflen bytes of the message.  It
+ * returns the number of bytes, zero at the end or a negative value on
+ * error.
+ */
+
+typedef ssize_t (*smtp_source_t)(FAR void *arg, FAR char *buffer,
+                                 size_t buflen);
+
+/* An e-mail for smtp_send_msg().  The text is msg/msglen followed by what
+ * the body source provides; either may be NULL.  With
+ * CONFIG_NETUTILS_SMTP_ATTACHMENTS, the data of the attach source is
+ * added base64 encoded as a file named attachname.
+ */
+
+struct smtp_message_s
+{
+  FAR const char *to;         /* Receiver of the e-mail */
+  FAR const char *cc;         /* CC: receiver or NULL */
+  FAR const char *from;       /* Sender of the e-mail */
+  FAR const char *subject;    /* Subject of the e-mail */
+  FAR const char *msg;        /* Text of the e-mail or NULL */
+  int             msglen;     /* Length of msg */
+  smtp_source_t   body;       /* Streamed text or NULL */
+  FAR void       *bodyarg;    /* Argument of body */
+  FAR const char *attachname; /* File name of the attachment */
+  smtp_source_t   attach;     /* Streamed attachment or NULL */
+  FAR void       *attacharg;  /* Argument of attach */
+};
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -73,6 +104,10 @@ void  smtp_configure(FAR void *handle, FAR const char *localhostname,
 int   smtp_send(FAR void *handle, FAR const char *to, FAR const char *cc,
                 FAR const char *from, FAR const char *subject,
                 FAR const char *msg, int msglen);
+int   smtp_connect(FAR void *handle);
+int   smtp_send_msg(FAR void *handle,
+                    FAR const struct smtp_message_s *msg);
+void  smtp_disconnect(FAR void *handle);
 void  smtp_close(FAR void *handle);
 
 #undef EXTERN
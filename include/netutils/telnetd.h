@@ -47,8 +47,22 @@
  ****************************************************************************/
 /* CONFIG_TELNETD_CONSOLE - Use the first Telnet session as the default
  *   console.
+ * CONFIG_TELNETD_POOLSIZE - If non-zero, each daemon starts this many
+ *   session tasks up front and hands each new connection to an idle one.
+ *   The session entry point (t_entry) should then return when the
+ *   session ends so that the task can serve the next connection.  The
+ *   daemon learns that a session task has exited with waitpid(), so the
+ *   pool requires CONFIG_SCHED_WAITPID and CONFIG_SCHED_HAVE_PARENT.
  */
 
+#if !defined(CONFIG_SCHED_WAITPID) || !defined(CONFIG_SCHED_HAVE_PARENT)
+#  undef CONFIG_TELNETD_POOLSIZE
+#endif
+
+#ifndef CONFIG_TELNETD_POOLSIZE
+#  define CONFIG_TELNETD_POOLSIZE 0
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
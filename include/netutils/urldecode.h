@@ -42,6 +42,33 @@
 
 #include <nuttx/config.h>
 
+#include <stddef.h>
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+#ifdef CONFIG_CODECS_URLCODE
+/* One field of a form (application/x-www-form-urlencoded) body or query.
+ * A NULL value is encoded as an empty one.
+ */
+
+struct urlencode_field_s
+{
+  FAR const char *name;
+  FAR const char *value;
+};
+
+/* Progress of urlencode_fields() through a set of fields */
+
+struct urlencode_state_s
+{
+  int field;              /* Index of the current field */
+  int part;               /* Name, '=', value or '&' */
+  size_t offset;          /* Characters of the name or value encoded */
+};
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -61,6 +88,22 @@ char *urlencode(const char *src, const int src_len, char *dest, int *dest_len);
 char *urldecode(const char *src, const int src_len, char *dest, int *dest_len);
 int urlencode_len(const char *src, const int src_len);
 int urldecode_len(const char *src, const int src_len);
+
+/* Form encoding without intermediate buffers: urlencode_fieldslen() gives
+ * the exact encoded size (e.g. for Content-Length) in one pass, then
+ * urlencode_fields() emits the encoding piece by piece straight into the
+ * caller's send buffer.  urldecode_query() splits and decodes a received
+ * query string in place.
+ */
+
+int urlencode_fieldslen(FAR const struct urlencode_field_s *fields,
+                        int nfields);
+void urlencode_fieldsinit(FAR struct urlencode_state_s *state);
+int urlencode_fields(FAR struct urlencode_state_s *state,
+                     FAR const struct urlencode_field_s *fields,
+                     int nfields, FAR char *dest, int destlen);
+FAR char *urldecode_query(FAR char *query, FAR char **name,
+                          FAR char **value);
 #endif /* CONFIG_CODECS_URLCODE */
 
 #ifdef CONFIG_CODECS_AVR_URLCODE
@@ -50,6 +50,12 @@
 #  include <nuttx/config.h>
 #endif
 #include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(CONFIG_NETUTILS_CODECS) && defined(CONFIG_CODECS_URLCODE)
+#  include "netutils/urldecode.h"
+#endif
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -71,6 +77,22 @@
 #  define CONFIG_WEBCLIENT_MAXFILENAME 100
 #endif
 
+/* Persistent session support */
+
+#ifndef CONFIG_WEBCLIENT_BUFSIZE
+#  define CONFIG_WEBCLIENT_BUFSIZE 512
+#endif
+
+#ifndef CONFIG_WEBCLIENT_SINK_BACKOFF
+#  define CONFIG_WEBCLIENT_SINK_BACKOFF 10
+#endif
+
+/* Asynchronous request support */
+
+#ifndef CONFIG_WEBCLIENT_ASYNC_MAXREQS
+#  define CONFIG_WEBCLIENT_ASYNC_MAXREQS 4
+#endif
+
 /****************************************************************************
  * Public types
  ****************************************************************************/
@@ -98,6 +120,91 @@
 typedef void (*wget_callback_t)(FAR char **buffer, int offset,
                                 int datend, FAR int *buflen, FAR void *arg);
 
+/* webclient_request() and the asynchronous requests pass the decoded
+ * response body to a sink of the following type, in order and in pieces of
+ * at most CONFIG_WEBCLIENT_BUFSIZE bytes.  No more data is read from the
+ * connection until the sink has accepted the data offered, so a slow sink
+ * throttles the server through TCP flow control.  The signature matches
+ * what is needed to push the body straight into a streaming parser such
+ * as cJSON_ReaderFeed().
+ *
+ * Input Parameters:
+ *   data - The next piece of the body.
+ *   len  - The number of bytes at data.
+ *   arg  - User argument passed to webclient_request().
+ *
+ * Returned Value:
+ *   The number of bytes accepted.  A short count causes the remainder to
+ *   be offered again at once; zero means that the sink is full and the
+ *   remainder is offered again after CONFIG_WEBCLIENT_SINK_BACKOFF
+ *   milliseconds.  A negated errno value aborts the request.
+ */
+
+typedef int (*webclient_sink_t)(FAR const char *data, size_t len,
+                                FAR void *arg);
+
+#ifdef CONFIG_WEBCLIENT_SESSION
+/* Opaque handle for a sequence of requests to one server */
+
+struct webclient_session_s;
+#endif
+
+#ifdef CONFIG_WEBCLIENT_ASYNC
+/* An asynchronous request calls a function of this type once when it
+ * finishes.  'result' is the HTTP status code of the response, or a
+ * negated errno value if the request failed or timed out.
+ */
+
+struct webclient_req_s;
+typedef void (*webclient_done_t)(FAR struct webclient_req_s *req,
+                                 int result);
+
+/* One asynchronous request.  The caller fills in the first group of
+ * fields (zero what is not used) and must keep the structure, the URL and
+ * the body valid until the request has completed.
+ */
+
+struct webclient_req_s
+{
+  FAR const char *url;            /* Full URL of the resource */
+  FAR const char *method;         /* Request method; NULL selects "GET" */
+  FAR const char *ctype;          /* Content-Type of the body (or NULL) */
+  FAR const void *body;           /* Request body (or NULL) */
+  size_t bodylen;                 /* Size of the request body */
+  int timeout;                    /* Seconds; 0: CONFIG_WEBCLIENT_TIMEOUT */
+  webclient_sink_t sink;          /* Receives the body; NULL discards it */
+  webclient_done_t done;          /* Completion callback (or NULL) */
+  FAR void *arg;                  /* User argument passed to sink */
+
+  /* The remaining fields are private to the engine */
+
+  FAR struct webclient_req_s *flink;
+  int sockfd;                     /* Socket or -1 */
+  uint8_t state;                  /* Request state */
+  uint8_t rspstate;               /* Response parser state */
+  bool chunked;                   /* True: chunked transfer encoding */
+  bool stalled;                   /* True: the sink refused data */
+  int status;                     /* HTTP status code */
+  uint32_t deadline;              /* Time stamp of the timeout (msec) */
+  size_t hdrlen;                  /* Length of the request headers */
+  size_t sent;                    /* Bytes of the request sent */
+  size_t remaining;               /* Bytes left in the body or chunk */
+  int head;                       /* First unconsumed byte in buffer */
+  int tail;                       /* End of the received data in buffer */
+  int ndx;                        /* Length of the partial line */
+  char line[CONFIG_WEBCLIENT_MAXHTTPLINE];
+  char buffer[CONFIG_WEBCLIENT_BUFSIZE];
+};
+
+/* A set of requests advanced together by webclient_async_poll() */
+
+struct webclient_async_s
+{
+  FAR struct webclient_req_s *head; /* Active requests */
+  int nreqs;                        /* Number of active requests */
+};
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -110,7 +217,7 @@ extern "C"
 #define EXTERN extern
 #endif
 
-#ifdef WGET_USE_URLENCODE
+#if defined(CONFIG_NETUTILS_CODECS) && defined(CONFIG_CODECS_URLCODE)
 FAR char *web_post_str(FAR char *buffer, FAR int *size, FAR char *name,
                        FAR char *value);
 FAR char *web_posts_str(FAR char *buffer, FAR int *size, FAR char **name,
@@ -155,6 +262,175 @@ int wget(FAR const char *url, FAR char *buffer, int buflen,
 int wget_post(FAR const char *url, FAR const char *posts, FAR char *buffer,
               int buflen, wget_callback_t callback, FAR void *arg);
 
+#if defined(CONFIG_NETUTILS_CODECS) && defined(CONFIG_CODECS_URLCODE)
+/****************************************************************************
+ * Name: wget_postfields
+ *
+ * Description:
+ *   POST form fields to an HTTP server.  Like wget_post(), except that the
+ *   fields are given unencoded: the exact Content-Length is computed in one
+ *   pass and the encoding is produced directly in 'buffer' as it is sent,
+ *   so no encoded copy of the form is ever built and the form may be
+ *   larger than the buffer.
+ *
+ * Input Parameters
+ *   url      - The full URL to post to.
+ *   fields   - The form fields.
+ *   nfields  - The number of form fields.
+ *   buffer   - A user provided buffer for the request and the response.
+ *   buflen   - The size of the user provided buffer.
+ *   callback - Disposes of each block of the response as it is received.
+ *   arg      - User argument passed to callback.
+ *
+ * Returned Value:
+ *   0: if the POST operation completed successfully;
+ *  -1: On a failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+int wget_postfields(FAR const char *url,
+                    FAR const struct urlencode_field_s *fields, int nfields,
+                    FAR char *buffer, int buflen, wget_callback_t callback,
+                    FAR void *arg);
+#endif
+
+#ifdef CONFIG_WEBCLIENT_SESSION
+/****************************************************************************
+ * Name: webclient_open
+ *
+ * Description:
+ *   Create a session for a sequence of HTTP/1.1 requests to one server.
+ *   The host name is resolved when the first request is made and the
+ *   address is cached for the lifetime of the session.  The connection is
+ *   kept open between requests unless the server asks to close it, and is
+ *   re-established transparently when needed.
+ *
+ * Input Parameters
+ *   hostname - Host name or dotted IPv4 address of the server.
+ *   port     - TCP port of the server; zero selects port 80.
+ *
+ * Returned Value:
+ *   The new session on success; NULL on failure with errno set
+ *   appropriately.
+ *
+ ****************************************************************************/
+
+FAR struct webclient_session_s *webclient_open(FAR const char *hostname,
+                                               uint16_t port);
+
+/****************************************************************************
+ * Name: webclient_request
+ *
+ * Description:
+ *   Send one request on the session and stream the response body to the
+ *   sink.  Bodies sent with Content-Length, with chunked transfer
+ *   encoding, or delimited by the end of the connection are supported.
+ *   If a reused connection turns out to have been closed by the server
+ *   before any response arrived, the request is sent again once on a new
+ *   connection.
+ *
+ * Input Parameters
+ *   ws      - The session returned by webclient_open().
+ *   method  - The request method, e.g. "GET" or "POST".
+ *   path    - The absolute path of the resource, e.g. "/index.html".
+ *   ctype   - Content-Type of the request body; NULL selects
+ *             application/octet-stream.
+ *   body    - The request body or NULL.
+ *   bodylen - The size of the request body.
+ *   sink    - Receives the response body; NULL discards it.
+ *   arg     - User argument passed to sink.
+ *
+ * Returned Value:
+ *   The HTTP status code of the response on success; a negated errno
+ *   value on failure.
+ *
+ ****************************************************************************/
+
+int webclient_request(FAR struct webclient_session_s *ws,
+                      FAR const char *method, FAR const char *path,
+                      FAR const char *ctype, FAR const void *body,
+                      size_t bodylen, webclient_sink_t sink, FAR void *arg);
+
+/****************************************************************************
+ * Name: webclient_close
+ *
+ * Description:
+ *   Close the connection, if any, and free the session.
+ *
+ ****************************************************************************/
+
+void webclient_close(FAR struct webclient_session_s *ws);
+#endif
+
+#ifdef CONFIG_WEBCLIENT_ASYNC
+/****************************************************************************
+ * Name: webclient_async_init
+ *
+ * Description:
+ *   Initialize an empty set of asynchronous requests.
+ *
+ ****************************************************************************/
+
+void webclient_async_init(FAR struct webclient_async_s *engine);
+
+/****************************************************************************
+ * Name: webclient_async_start
+ *
+ * Description:
+ *   Begin an asynchronous request.  The host name is resolved and a
+ *   non-blocking connection is started; everything after that happens in
+ *   webclient_async_poll().  Each request uses its own connection, which is
+ *   closed when the request completes.
+ *
+ * Input Parameters
+ *   engine - The request set.
+ *   req    - The request, set up by the caller as described above.
+ *
+ * Returned Value:
+ *   Zero (OK) if the request was started; a negated errno value on
+ *   failure, in which case the completion callback is not called.
+ *   -EBUSY means that CONFIG_WEBCLIENT_ASYNC_MAXREQS requests are already
+ *   active.
+ *
+ ****************************************************************************/
+
+int webclient_async_start(FAR struct webclient_async_s *engine,
+                          FAR struct webclient_req_s *req);
+
+/****************************************************************************
+ * Name: webclient_async_poll
+ *
+ * Description:
+ *   Wait with a single poll() for activity on all active requests and
+ *   advance each of them.  Requests that complete, fail or pass their
+ *   timeout are removed and their completion callbacks are called from
+ *   here.  A callback may start new requests.
+ *
+ * Input Parameters
+ *   engine  - The request set.
+ *   timeout - Maximum wait in milliseconds, or -1 to wait until the
+ *             nearest request timeout.
+ *
+ * Returned Value:
+ *   The number of requests still active; a negated errno value if poll()
+ *   failed.
+ *
+ ****************************************************************************/
+
+int webclient_async_poll(FAR struct webclient_async_s *engine, int timeout);
+
+/****************************************************************************
+ * Name: webclient_async_cancel
+ *
+ * Description:
+ *   Abandon an active request without calling its completion callback.
+ *
+ ****************************************************************************/
+
+void webclient_async_cancel(FAR struct webclient_async_s *engine,
+                            FAR struct webclient_req_s *req);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
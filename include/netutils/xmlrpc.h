@@ -55,6 +55,7 @@
  ****************************************************************************/
 
 #include <nuttx/config.h>
+#include <sys/types.h>
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -114,6 +115,9 @@ struct xmlrpc_entry_s
 
 void xmlrpc_register(struct xmlrpc_entry_s *call);
 int xmlrpc_parse(int sock, char *buffer);
+void xmlrpc_parse_begin(void);
+int xmlrpc_parse_push(const char *buffer, size_t len);
+int xmlrpc_parse_end(int sock);
 int xmlrpc_getinteger(struct xmlrpc_s *xmlcall, int *arg);
 int xmlrpc_getbool(struct xmlrpc_s *xmlcall, int *arg);
 int xmlrpc_getdouble(struct xmlrpc_s *xmlcall, double *arg);
@@ -89,6 +89,16 @@ extern "C"
 #define EXTERN extern
 #endif
 
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_STARTUP
+/* A start-up step.  Returns OK on success or a negated errno value. */
+
+typedef CODE int (*nsh_startup_t)(FAR void *arg);
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -226,6 +236,56 @@ int platform_user_verify(FAR const char *username, FAR const char *password);
 
 int nsh_system(int argc, char *argv[]);
 
+/****************************************************************************
+ * Name: nsh_startup_add
+ *
+ * Description:
+ *   Add a start-up step.  func(arg) runs on its own thread as soon as every
+ *   step named in the comma-separated list 'after' has completed, so steps
+ *   that do not depend on each other run concurrently.  A step whose
+ *   prerequisite fails is skipped.  A prerequisite that has not been added
+ *   yet is waited for.  The start and completion times of each step are
+ *   logged and shown by the NSH 'startup' command.
+ *
+ * Input Parameters:
+ *   name  - Unique name of the step
+ *   after - Comma-separated list of prerequisite steps, or NULL
+ *   func  - The step function
+ *   arg   - Argument passed to func
+ *
+ * Returned Values:
+ *   OK on success; a negated errno value on failure:  -EINVAL if the name is
+ *   empty or too long, -EEXIST if it is already in use, or -ENOMEM if the
+ *   step table is full.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_STARTUP
+int nsh_startup_add(FAR const char *name, FAR const char *after,
+                    nsh_startup_t func, FAR void *arg);
+#endif
+
+/****************************************************************************
+ * Name: nsh_startup_wait
+ *
+ * Description:
+ *   Wait until the named start-up step, or all steps if name is NULL, have
+ *   finished.
+ *
+ * Input Parameters:
+ *   name    - The step to wait for, or NULL
+ *   timeout - Maximum time to wait in seconds, or zero to wait forever
+ *
+ * Returned Values:
+ *   OK if the steps completed successfully, -EIO if any failed or was
+ *   skipped, or -ETIMEDOUT.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_STARTUP
+int nsh_startup_wait(FAR const char *name, int timeout);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -78,6 +78,20 @@ extern "C"
 
 int cle(FAR char *line, uint16_t linelen, FILE *instream, FILE *outstream);
 
+/****************************************************************************
+ * Name: cle_buffered
+ *
+ * Description:
+ *   The same as cle() except that display updates are collected in the
+ *   caller-provided buffer 'outbuf' of size 'outsize' and sent with one
+ *   write per keystroke.  The buffer is only used while cle_buffered() runs
+ *   and holds no pending output on return.
+ *
+ ****************************************************************************/
+
+int cle_buffered(FAR char *line, uint16_t linelen, FILE *instream,
+                 FILE *outstream, FAR char *outbuf, uint16_t outsize);
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -50,9 +50,40 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+#  ifndef CONFIG_NXPLAYER_QUEUE_SIZE
+#    define CONFIG_NXPLAYER_QUEUE_SIZE  4
+#  endif
+#endif
+
 /****************************************************************************
  * Public Type Declarations
  ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PREFETCH
+struct nxplayer_prefetch_s;
+#endif
+
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+struct nxplayer_mediaindex_s;
+#endif
+
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+/* This structure describes a media file that has been opened and
+ * identified, either the one playing or one waiting in the queue.
+ */
+
+struct nxplayer_track_s
+{
+  int         fd;             /* File descriptor of the open file */
+  int         filefmt;        /* Audio format of the file */
+  int         subfmt;         /* Audio sub-format of the file */
+  uint32_t    samprate;       /* WAV sample rate, 0 if not a plain WAV file */
+  uint16_t    nchannels;      /* WAV number of channels */
+  uint16_t    bpsamp;         /* WAV bits per sample */
+};
+#endif
+
 /* This structure describes the internal state of the NxPlayer */
 
 struct nxplayer_s
@@ -65,6 +96,16 @@ struct nxplayer_s
   int         crefs;          /* Number of references to the player */
   sem_t       sem;            /* Thread sync semaphore */
   int         fd;         /* File descriptor of open file */
+#ifdef CONFIG_NXPLAYER_PREFETCH
+  FAR struct nxplayer_prefetch_s *prefetch; /* Reader thread and read-ahead ring */
+  unsigned long underruns;    /* Times the read-ahead ring ran dry */
+#endif
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+  struct nxplayer_track_s playing; /* Format of the file being played */
+  struct nxplayer_track_s queue[CONFIG_NXPLAYER_QUEUE_SIZE]; /* Files to play next */
+  uint8_t     qhead;          /* Index of the next file in queue[] */
+  uint8_t     qcount;         /* Number of files in queue[] */
+#endif
 #ifdef CONFIG_NXPLAYER_INCLUDE_PREFERRED_DEVICE
   char        prefdevice[CONFIG_NAME_MAX]; /* Preferred audio device */
   int         prefformat;     /* Formats supported by preferred device */
@@ -73,6 +114,9 @@ struct nxplayer_s
 #ifdef CONFIG_NXPLAYER_INCLUDE_MEDIADIR
   char        mediadir[CONFIG_NAME_MAX];   /* Root media directory where media is located */
 #endif
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+  FAR struct nxplayer_mediaindex_s *mindex; /* Index of the media directory */
+#endif
 #ifdef CONFIG_AUDIO_MULTI_SESSION
   FAR void    *session;       /* Session assigment from device */
 #endif
@@ -207,10 +251,41 @@ int nxplayer_setdevice(FAR struct nxplayer_s *pPlayer,
 int nxplayer_playfile(FAR struct nxplayer_s *pPlayer,
                       FAR const char *filename, int filefmt, int subfmt);
 
+/****************************************************************************
+ * Name: nxplayer_queuefile
+ *
+ *   Queues the specified media file to be played after the current one.
+ *   The file is opened and its format determined now, so nothing but
+ *   reading is left to do when the current file ends.  If the two files
+ *   have the same format, the data of the queued file follows that of the
+ *   current one in the same audio stream, with no gap and without
+ *   reconfiguring the device.  Otherwise, the device is closed and opened
+ *   again for the new format.  If nothing is playing, this is the same as
+ *   nxplayer_playfile().
+ *
+ * Input Parameters:
+ *   pPlayer   - Pointer to the context
+ *   filename  - Pointer to pathname of the file to play
+ *   filefmt   - Format of audio in filename if known, AUDIO_FMT_UNDEF
+ *               to let nxplayer_queuefile() determine automatically.
+ *   subfmt    - Sub-Format of audio in filename if known, AUDIO_FMT_UNDEF
+ *               to let nxplayer_queuefile() determine automatically.
+ *
+ * Returned Value:
+ *   OK if the file was queued (or started), -ENOSPC if the queue is full,
+ *   or one of the errors of nxplayer_playfile().
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+int nxplayer_queuefile(FAR struct nxplayer_s *pPlayer,
+                       FAR const char *filename, int filefmt, int subfmt);
+#endif
+
 /****************************************************************************
  * Name: nxplayer_stop
  *
- *   Stops current playback.
+ *   Stops current playback and discards any queued files.
  *
  * Input Parameters:
  *   pPlayer   - Pointer to the context to initialize
@@ -390,6 +465,25 @@ int nxplayer_setbalance(FAR struct nxplayer_s *pPlayer, uint16_t balance);
 void nxplayer_setmediadir(FAR struct nxplayer_s *pPlayer,
                           FAR const char *mediadir);
 
+/****************************************************************************
+ * Name: nxplayer_getunderruns
+ *
+ *   Returns the number of times the read-ahead ring ran dry while the
+ *   current (or most recent) file was playing, i.e. the number of times
+ *   the audio device asked for data before the reader thread had any.
+ *
+ * Input Parameters:
+ *   pPlayer   - Pointer to the context
+ *
+ * Returned Value:
+ *   The underrun count.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PREFETCH
+unsigned long nxplayer_getunderruns(FAR struct nxplayer_s *pPlayer);
+#endif
+
 /****************************************************************************
  * Name: nxplayer_setequalization
  *
@@ -0,0 +1,256 @@
+/****************************************************************************
+ * apps/include/system/perfcount.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_SYSTEM_PERFCOUNT_H
+#define __APPS_INCLUDE_SYSTEM_PERFCOUNT_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <sched.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_SYSTEM_PERFCOUNT_NBUCKETS
+#  define CONFIG_SYSTEM_PERFCOUNT_NBUCKETS 16
+#endif
+
+/* Entry types */
+
+#define PERF_TYPE_COUNTER   0
+#define PERF_TYPE_HISTOGRAM 1
+
+/* Binary export format (see perf_export()).  All fields are in the byte
+ * order of the target; PERF_EXPORT_MAGIC reads as "PERF" on a little
+ * endian target and as "FREP" on a big endian one.
+ *
+ *   Header:  uint32_t magic, uint16_t version, uint16_t nentries,
+ *            uint64_t time (microseconds since boot)
+ *   Entries: uint8_t type, uint8_t namelen, uint16_t nvalues,
+ *            namelen bytes of name (not terminated),
+ *            nvalues uint32_t values
+ *
+ * A counter has one value.  A histogram has its largest value followed by
+ * CONFIG_SYSTEM_PERFCOUNT_NBUCKETS bucket counts.  Counters are free
+ * running and wrap at 2^32; only the differences between two exports are
+ * meaningful unless nothing has reset them.
+ */
+
+#define PERF_EXPORT_MAGIC   0x46524550
+#define PERF_EXPORT_VERSION 1
+
+/* Subsystems declare, register and update their entries with these macros.
+ * They compile to nothing without CONFIG_SYSTEM_PERFCOUNT, so no #ifdef is
+ * needed around them:
+ *
+ *   PERF_COUNTER(g_nrequests, "thttpd.requests");
+ *   ...
+ *   PERF_REGISTER(g_nrequests);          (once, at initialization)
+ *   ...
+ *   PERF_INC(g_nrequests);
+ */
+
+#ifdef CONFIG_SYSTEM_PERFCOUNT
+#  define PERF_COUNTER(var, name) \
+     static struct perf_counter_s var = \
+       { { NULL, (name), PERF_TYPE_COUNTER, 1 }, 0 }
+#  define PERF_HISTOGRAM(var, name) \
+     static struct perf_hist_s var = \
+       { { NULL, (name), PERF_TYPE_HISTOGRAM, \
+           CONFIG_SYSTEM_PERFCOUNT_NBUCKETS + 1 }, 0, { 0 } }
+#  define PERF_REGISTER(var)      perf_register(&(var).entry)
+#  define PERF_ADD(var, n)        perf_add(&(var), (uint32_t)(n))
+#  define PERF_INC(var)           perf_add(&(var), 1)
+#  define PERF_SAMPLE(var, value) perf_sample(&(var), (uint32_t)(value))
+#else
+#  define PERF_COUNTER(var, name)   extern int var
+#  define PERF_HISTOGRAM(var, name) extern int var
+#  define PERF_REGISTER(var)        ((void)0)
+#  define PERF_ADD(var, n)          ((void)0)
+#  define PERF_INC(var)             ((void)0)
+#  define PERF_SAMPLE(var, value)   ((void)0)
+#endif
+
+#ifdef CONFIG_SYSTEM_PERFCOUNT
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* The common part of all entries.  Names are "<subsystem>.<what>". */
+
+struct perf_entry_s
+{
+  FAR struct perf_entry_s *flink;  /* Next registered entry */
+  FAR const char *name;            /* Name, in static storage */
+  uint8_t type;                    /* PERF_TYPE_* */
+  uint8_t nvalues;                 /* Number of uint32_t values exported */
+};
+
+struct perf_counter_s
+{
+  struct perf_entry_s entry;
+  volatile uint32_t value;
+};
+
+/* A histogram of log2 buckets: bucket 0 counts the value 0 and bucket b
+ * the values from 2^(b-1) to 2^b - 1.  The last bucket is open ended.
+ */
+
+struct perf_hist_s
+{
+  struct perf_entry_s entry;
+  volatile uint32_t max;
+  volatile uint32_t bucket[CONFIG_SYSTEM_PERFCOUNT_NBUCKETS];
+};
+
+/* Called by perf_foreach() for each matching entry */
+
+typedef CODE int (*perf_visitor_t)(FAR const struct perf_entry_s *entry,
+                                   FAR void *arg);
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: perf_add
+ *
+ * Description:
+ *   Add n to a counter.  This is the hot path: a single atomic add with
+ *   CONFIG_SYSTEM_PERFCOUNT_ATOMIC, otherwise an add with pre-emption
+ *   disabled.
+ *
+ ****************************************************************************/
+
+static inline void perf_add(FAR struct perf_counter_s *counter, uint32_t n)
+{
+#ifdef CONFIG_SYSTEM_PERFCOUNT_ATOMIC
+  (void)__atomic_fetch_add(&counter->value, n, __ATOMIC_RELAXED);
+#else
+  sched_lock();
+  counter->value += n;
+  sched_unlock();
+#endif
+}
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: perf_register
+ *
+ * Description:
+ *   Add an entry to the registry.  Registering an entry that is already
+ *   registered does nothing.  Entries cannot be removed, so they must be
+ *   statically allocated.
+ *
+ ****************************************************************************/
+
+void perf_register(FAR struct perf_entry_s *entry);
+
+/****************************************************************************
+ * Name: perf_sample
+ *
+ * Description:
+ *   Count a value in a histogram.
+ *
+ ****************************************************************************/
+
+void perf_sample(FAR struct perf_hist_s *hist, uint32_t value);
+
+/****************************************************************************
+ * Name: perf_foreach
+ *
+ * Description:
+ *   Call visitor for each registered entry whose name begins with prefix
+ *   (all entries if prefix is NULL), in the order of registration.  Stops
+ *   and returns the return value of visitor if it is not zero.
+ *
+ ****************************************************************************/
+
+int perf_foreach(FAR const char *prefix, perf_visitor_t visitor,
+                 FAR void *arg);
+
+/****************************************************************************
+ * Name: perf_reset
+ *
+ * Description:
+ *   Clear the entries whose names begin with prefix (all if NULL).
+ *   Updates that happen at the same time may be lost.
+ *
+ ****************************************************************************/
+
+void perf_reset(FAR const char *prefix);
+
+/****************************************************************************
+ * Name: perf_export
+ *
+ * Description:
+ *   Write the entries whose names begin with prefix (all if NULL) to fd in
+ *   the binary format described above.  Returns the number of bytes
+ *   written or a negated errno value.
+ *
+ ****************************************************************************/
+
+ssize_t perf_export(int fd, FAR const char *prefix);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_SYSTEM_PERFCOUNT */
+#endif /* __APPS_INCLUDE_SYSTEM_PERFCOUNT_H */
@@ -48,10 +48,13 @@
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
-/* Tab completion cannot be supported if there is no console echo */
+/* Tab completion and command history cannot be supported if there is no
+ * console echo
+ */
 
 #ifndef CONFIG_READLINE_ECHO
 #  undef CONFIG_READLINE_TABCOMPLETION
+#  undef CONFIG_READLINE_CMD_HISTORY
 #endif
 
 /* Make sure that the are valid values for all tab-completion settings */
@@ -64,6 +67,16 @@
 #  ifndef CONFIG_READLINE_MAX_EXTCMDS
 #    define CONFIG_READLINE_MAX_EXTCMDS 64
 #  endif
+
+#  ifndef CONFIG_READLINE_MAX_PATHS
+#    define CONFIG_READLINE_MAX_PATHS 64
+#  endif
+#endif
+
+/* Path completion needs directory access */
+
+#if !defined(CONFIG_READLINE_TABCOMPLETION) || CONFIG_NFILE_DESCRIPTORS <= 0
+#  undef CONFIG_READLINE_TABCOMPLETION_PATHS
 #endif
 
 /****************************************************************************
@@ -72,9 +85,17 @@
 
 #if defined(CONFIG_READLINE_TABCOMPLETION) && \
     defined(CONFIG_READLINE_HAVE_EXTMATCH)
+/* next_match() returns the index of the next external command whose name
+ * begins with the first namelen characters of name, starting the search at
+ * index (zero for the first match, one past the previous match after that).
+ * A negative value is returned when there are no more matches.  getname()
+ * returns the full name of the command at an index returned by
+ * next_match().
+ */
+
 struct extmatch_vtable_s
 {
-  CODE int (*count_matches)(FAR char *name, FAR int *matches, int namelen);
+  CODE int (*next_match)(FAR const char *name, int namelen, int index);
   CODE FAR const char *(*getname)(int index);
 };
 #endif
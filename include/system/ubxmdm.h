@@ -0,0 +1,201 @@
+/****************************************************************************
+ * apps/include/system/ubxmdm.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_SYSTEM_UBXMDM_H
+#define __APPS_INCLUDE_SYSTEM_UBXMDM_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_SYSTEM_UBLOXMODEM_MAXURCS
+#  define CONFIG_SYSTEM_UBLOXMODEM_MAXURCS 8
+#endif
+
+#ifndef CONFIG_SYSTEM_UBLOXMODEM_LINESIZE
+#  define CONFIG_SYSTEM_UBLOXMODEM_LINESIZE 128
+#endif
+
+#ifndef CONFIG_SYSTEM_UBLOXMODEM_READSIZE
+#  define CONFIG_SYSTEM_UBLOXMODEM_READSIZE 64
+#endif
+
+#ifndef CONFIG_SYSTEM_UBLOXMODEM_READYTIMEOUT
+#  define CONFIG_SYSTEM_UBLOXMODEM_READYTIMEOUT 10000
+#endif
+
+#ifndef CONFIG_SYSTEM_UBLOXMODEM_READYPOLL
+#  define CONFIG_SYSTEM_UBLOXMODEM_READYPOLL 100
+#endif
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Power state requests for ubxmdm_power() */
+
+enum ubxmdm_power_e
+{
+  UBXMDM_POWER_OFF = 0,
+  UBXMDM_POWER_ON,
+  UBXMDM_POWER_RESET
+};
+
+/* Handler of an unsolicited result code.  'line' is the complete URC line,
+ * including the prefix it was registered with.
+ */
+
+typedef CODE void (*ubxmdm_urc_t)(FAR void *arg, FAR const char *line);
+
+struct ubxmdm_urc_s
+{
+  FAR const char *prefix;        /* For example "+CREG:" */
+  size_t          len;           /* strlen(prefix) */
+  ubxmdm_urc_t    handler;
+  FAR void       *arg;
+};
+
+/* A modem session keeps the modem TTY and power control device open across
+ * commands, so that URCs arriving between commands are not lost.
+ */
+
+struct ubxmdm_session_s
+{
+  int  ttyfd;                    /* Modem AT command TTY */
+  int  mdmfd;                    /* u-blox modem driver, power control */
+
+  /* Registered URC handlers */
+
+  struct ubxmdm_urc_s urcs[CONFIG_SYSTEM_UBLOXMODEM_MAXURCS];
+  int  nurcs;
+
+  /* Receive buffer and the line being assembled from it */
+
+  char   rxbuf[CONFIG_SYSTEM_UBLOXMODEM_READSIZE];
+  size_t rxhead;
+  size_t rxtail;
+  char   line[CONFIG_SYSTEM_UBLOXMODEM_LINESIZE];
+  size_t linelen;
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/* Open the TTY and the modem driver.  Either device name may be NULL to use
+ * the configured default.
+ */
+
+int  ubxmdm_open(FAR struct ubxmdm_session_s *session,
+                 FAR const char *ttydev, FAR const char *mdmdev);
+void ubxmdm_close(FAR struct ubxmdm_session_s *session);
+
+/* Register a handler for the URCs that start with 'prefix'.  The prefix
+ * string must remain valid for the life of the session.
+ */
+
+int  ubxmdm_urc_register(FAR struct ubxmdm_session_s *session,
+                         FAR const char *prefix, ubxmdm_urc_t handler,
+                         FAR void *arg);
+
+/* Send one AT command line and wait for its final result code.  Any
+ * information response is returned in 'resp', one line per '\n'.  URCs
+ * received meanwhile are dispatched to their handlers.  Returns OK, -EIO
+ * if the modem reported an error, or another negated errno.
+ */
+
+int  ubxmdm_command(FAR struct ubxmdm_session_s *session,
+                    FAR const char *cmd, FAR char *resp, size_t resplen,
+                    int timeout_ms);
+
+/* Concatenate several commands, each without its "AT" prefix, into a
+ * single command line so that they cost one round trip.  The modem runs
+ * them in order and stops at the first failing one.
+ */
+
+int  ubxmdm_pipeline(FAR struct ubxmdm_session_s *session,
+                     FAR const char * const *cmds, int ncmds,
+                     FAR char *resp, size_t resplen, int timeout_ms);
+
+/* Wait up to 'timeout_ms' for URCs and dispatch them.  Returns the number
+ * of URCs handled.
+ */
+
+int  ubxmdm_poll(FAR struct ubxmdm_session_s *session, int timeout_ms);
+
+/* Change the power state.  After power on or reset, returns as soon as the
+ * modem answers "AT" rather than after a fixed delay.
+ */
+
+int  ubxmdm_power(FAR struct ubxmdm_session_s *session,
+                  enum ubxmdm_power_e state);
+
+/* Wait until the modem answers "AT", polling every
+ * CONFIG_SYSTEM_UBLOXMODEM_READYPOLL milliseconds.
+ */
+
+int  ubxmdm_waitready(FAR struct ubxmdm_session_s *session, int timeout_ms);
+
+#ifdef CONFIG_NETUTILS_CHAT
+/* Run a chat script on the session TTY with the shared chat engine */
+
+int  ubxmdm_chat(FAR struct ubxmdm_session_s *session, FAR char *script,
+                 int timeout_s);
+#endif
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __APPS_INCLUDE_SYSTEM_UBXMDM_H */
@@ -165,6 +165,15 @@
 #  define CONFIG_SYSTEM_ZMODEM_WRITESIZE 0
 #endif
 
+/* Size of the receive file buffer.  Received data is collected and written
+ * in blocks of this size at aligned file offsets.  The default value of 0
+ * writes each data packet as it is received.
+ */
+
+#ifndef CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE
+#  define CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE 0
+#endif
+
 /* Absolute pathes in received file names are not accepted.  This
  * configuration value must be set to provide the path to the file storage
  * directory (such as a mountpoint directory).
@@ -53,6 +53,7 @@
  * Included Files
  ****************************************************************************/
 
+#include <stdbool.h>
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include <net/ethernet.h>
@@ -178,8 +179,28 @@ struct wapi_scan_info_s
   enum wapi_mode_e mode;
   int has_bitrate;
   int bitrate;
+  int has_rssi;
+  int rssi;                          /* Signal level, in dBm if the driver
+                                      * reports dBm */
 };
 
+/* Selects the scan results passed to a wapi_scan_cb_t */
+
+struct wapi_scan_filter_s
+{
+  FAR const char *essid;             /* Only this ESSID, or NULL for any */
+  bool has_minrssi;                  /* Apply minrssi */
+  int minrssi;                       /* Lowest signal level passed */
+};
+
+/* Called for each AP of a scan as soon as its events have been decoded.
+ * The info is only valid during the call.  Return zero to continue, a
+ * positive value to stop the scan early or a negated errno to abort it.
+ */
+
+typedef CODE int (*wapi_scan_cb_t)(FAR const struct wapi_scan_info_s *info,
+                                   FAR void *arg);
+
 /* Linked list container for routing table rows. */
 
 struct wapi_route_info_s
@@ -254,6 +275,24 @@ struct wpa_wconfig_s
   FAR const uint8_t *passphrase; /* E.g., "mySSIDpassphrase" */
 };
 
+/* This structure describes the network managed by wapi_roam().  The
+ * security parameters are those of struct wpa_wconfig_s and are applied to
+ * every AP of the ESSID.
+ */
+
+struct wapi_roam_config_s
+{
+  FAR const char *ifname;        /* E.g., "wlan0" */
+  FAR const char *essid;         /* ESSID shared by all of the APs */
+  FAR const char *passphrase;    /* E.g., "mySSIDpassphrase" */
+  uint8_t auth_wpa;              /* E.g. IW_AUTH_WPA_VERSION_WPA2 */
+  uint8_t cipher_mode;           /* E.g., IW_AUTH_CIPHER_CCMP */
+  uint8_t alg;                   /* E.g. WPA_ALG_CCMP */
+  int scaninterval;              /* Seconds between background scans */
+  int threshold;                 /* Signal level below which to roam */
+  int hysteresis;                /* Signal gain required to roam */
+};
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -653,6 +692,32 @@ int wapi_scan_stat(int sock, FAR const char *ifname);
 
 int wapi_scan_coll(int sock, FAR const char *ifname, FAR struct wapi_list_s *aps);
 
+/****************************************************************************
+ * Name: wapi_scan_process
+ *
+ * Description:
+ *   Reads the results of a scan process into a buffer provided by the
+ *   caller and passes each AP that matches the filter to a callback while
+ *   the events are decoded, without building a list.  The buffer can be
+ *   reused for every scan.
+ *
+ * Input Parameters:
+ *   buf    - Buffer for the raw scan events
+ *   buflen - Size of buf
+ *   filter - Selects the APs passed to cb, or NULL for all
+ *   cb     - Called for each selected AP
+ *   arg    - Passed to cb
+ *
+ * Returned Value:
+ *   The number of APs passed to cb; -E2BIG if the results do not fit in
+ *   buf; another negated errno on failure, including one returned by cb.
+ *
+ ****************************************************************************/
+
+int wapi_scan_process(int sock, FAR const char *ifname, FAR char *buf,
+                      size_t buflen, FAR const struct wapi_scan_filter_s *filter,
+                      wapi_scan_cb_t cb, FAR void *arg);
+
 /************************************************************************************
  * Name: wpa_driver_wext_set_ssid
  *
@@ -735,6 +800,29 @@ int wpa_driver_wext_associate(FAR struct wpa_wconfig_s *wconfig);
 int wpa_driver_wext_set_auth_param(int sockfd, FAR const char *ifname,
                                    int idx, uint32_t value);
 
+#ifdef CONFIG_WIRELESS_WAPI_ROAM
+/****************************************************************************
+ * Name: wapi_roam
+ *
+ * Description:
+ *   Keep the interface associated with the ESSID.  The channel and BSSID of
+ *   each AP found by the background scans are cached so that a lost link is
+ *   restored by associating directly with the best known AP, without a
+ *   full scan.  The background scans also select a stronger AP to roam to
+ *   when the signal of the current one drops below the threshold.
+ *
+ * Input Parameters:
+ *   config - Describes the network.
+ *
+ * Returned Value:
+ *   Does not return unless a fatal error occurs, in which case a negated
+ *   errno is returned.
+ *
+ ****************************************************************************/
+
+int wapi_roam(FAR const struct wapi_roam_config_s *config);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
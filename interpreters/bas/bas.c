@@ -576,8 +576,15 @@ static struct Value *func(struct Value *value)
         {
           if (g_pass == INTERPRET)
             {
+              struct timespec callstart;
+              int profiled = g_program.profiling;
               int r = 1;
 
+              if (profiled)
+                {
+                  clock_gettime(CLOCK_MONOTONIC, &callstart);
+                }
+
               g_pc = sym->u.sub.u.def.scope.start;
               if (g_pc.token->type == T_COLON)
                 {
@@ -624,6 +631,12 @@ static struct Value *func(struct Value *value)
                 {
                   Value_new_VOID(value);
                 }
+
+              if (profiled)
+                {
+                  Program_profileCall(&g_program, &sym->u.sub.u.def.scope.start,
+                                      &callstart);
+                }
             }
           else
             {
@@ -633,6 +646,13 @@ static struct Value *func(struct Value *value)
 
       Auto_funcReturn(&g_stack, g_pass == INTERPRET &&
                       value->type != V_ERROR ? &g_pc : (struct Pc *)0);
+      if (g_program.profiling && g_pass == INTERPRET &&
+          sym->type == USERFUNCTION)
+        {
+          /* Charge the rest of the calling line to it again */
+
+          Program_profileLine(&g_program, &g_pc, 0);
+        }
     }
 
   return value;
@@ -2079,6 +2099,15 @@ static void runline(struct Token *line)
     }
   while (g_pc.token->type != T_EOL ||
          Program_skipEOL(&g_program, &g_pc, STDCHANNEL, 1));
+
+  if (g_program.profiling)
+    {
+      /* Do not charge the time waiting for the next command to the last
+       * line that ran.
+       */
+
+      Program_profileLine(&g_program, (const struct Pc *)0, 0);
+    }
 }
 
 static struct Value *evalGeometry(struct Value *value, unsigned int *dim,
@@ -68,6 +68,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "bas_auto.h"
 #include "bas_error.h"
@@ -224,6 +225,109 @@ static int cmpName(const void *a, const void *b)
   return strcmp(funcA, funcB);
 }
 
+/* The line index maps line numbers to their place in code[], so that a
+ * jump target is found without a search of the program.  It is built on
+ * the first look-up and dropped by every change to the lines.
+ */
+
+static void dropIndex(struct Program *this)
+{
+  free(this->lineIndex);
+  this->lineIndex = (int *)0;
+  this->lineIndexMask = -1;
+}
+
+static int buildIndex(struct Program *this)
+{
+  unsigned int h;
+  int size;
+  int i;
+
+  for (size = 16; size < 2 * this->size; size <<= 1);
+
+  this->lineIndex = calloc(size, sizeof(int));
+  if (this->lineIndex == (int *)0)
+    {
+      return -1;
+    }
+
+  this->lineIndexMask = size - 1;
+  for (i = 0; i < this->size; ++i)
+    {
+      if (this->code[i]->type == T_INTEGER)
+        {
+          h = (unsigned int)this->code[i]->u.integer * 2654435761u;
+          for (h &= this->lineIndexMask; this->lineIndex[h];
+               h = (h + 1) & this->lineIndexMask);
+
+          this->lineIndex[h] = i + 1;
+        }
+    }
+
+  return 0;
+}
+
+/* Binary search of a numbered program, whose lines are kept in ascending
+ * order by Program_store(): The index of the first line numbered 'line' or
+ * higher, or size if there is none.
+ */
+
+static int findLine(struct Program *this, long int line)
+{
+  int low = 0;
+  int high = this->size;
+  int mid;
+
+  while (low < high)
+    {
+      mid = (low + high) / 2;
+      if (this->code[mid]->u.integer < line)
+        {
+          low = mid + 1;
+        }
+      else
+        {
+          high = mid;
+        }
+    }
+
+  return low;
+}
+
+/* The profile holds counters for each line in code[], so it is thrown
+ * away along with them when lines are added or removed.
+ */
+
+static void dropProfile(struct Program *this)
+{
+  free(this->profile);
+  this->profile = (struct ProfileLine *)0;
+  this->profiling = 0;
+  this->profileLine = -1;
+}
+
+static double elapsed(const struct timespec *from, const struct timespec *to)
+{
+  return (double)(to->tv_sec - from->tv_sec) +
+         (double)(to->tv_nsec - from->tv_nsec) / 1000000000.0;
+}
+
+static int cmpLineTime(const void *a, const void *b)
+{
+  double ta = (*(const struct ProfileLine *const *)a)->time;
+  double tb = (*(const struct ProfileLine *const *)b)->time;
+
+  return ta < tb ? 1 : ta > tb ? -1 : 0;
+}
+
+static int cmpCallTime(const void *a, const void *b)
+{
+  double ta = (*(const struct ProfileLine *const *)a)->calltime;
+  double tb = (*(const struct ProfileLine *const *)b)->calltime;
+
+  return ta < tb ? 1 : ta > tb ? -1 : 0;
+}
+
 static void printName(const void *k, struct Program *p, int chn)
 {
   size_t len = strlen((const char *)k);
@@ -249,6 +353,11 @@ struct Program *Program_new(struct Program *this)
   this->unsaved = 0;
   this->code = (struct Token **)0;
   this->scope = (struct Scope *)0;
+  this->lineIndex = (int *)0;
+  this->lineIndexMask = -1;
+  this->profiling = 0;
+  this->profileLine = -1;
+  this->profile = (struct ProfileLine *)0;
   String_new(&this->name);
   return this;
 }
@@ -267,6 +376,8 @@ void Program_destroy(struct Program *this)
 
   this->code = (struct Token **)0;
   this->scope = (struct Scope *)0;
+  dropIndex(this);
+  dropProfile(this);
   String_destroy(&this->name);
 }
 
@@ -283,6 +394,8 @@ void Program_store(struct Program *this, struct Token *line, long int where)
   assert(line->type == T_INTEGER || line->type == T_UNNUMBERED);
   this->runnable = 0;
   this->unsaved = 1;
+  dropIndex(this);
+  dropProfile(this);
   if (line->type == T_UNNUMBERED)
     {
       this->numbered = 0;
@@ -348,6 +461,8 @@ void Program_delete(struct Program *this, const struct Pc *from,
 
   this->runnable = 0;
   this->unsaved = 1;
+  dropIndex(this);
+  dropProfile(this);
   first = from ? from->line : 0;
   last = to ? to->line : this->size - 1;
   for (i = first; i <= last; ++i)
@@ -375,8 +490,26 @@ void Program_addScope(struct Program *this, struct Scope *scope)
 
 struct Pc *Program_goLine(struct Program *this, long int line, struct Pc *pc)
 {
+  unsigned int h;
   int i;
 
+  if (this->lineIndex != (int *)0 || buildIndex(this) == 0)
+    {
+      h = ((unsigned int)line * 2654435761u) & this->lineIndexMask;
+      for (; this->lineIndex[h]; h = (h + 1) & this->lineIndexMask)
+        {
+          i = this->lineIndex[h] - 1;
+          if (this->code[i]->u.integer == line)
+            {
+              pc->line = i;
+              pc->token = this->code[i] + 1;
+              return pc;
+            }
+        }
+
+      return (struct Pc *)0;
+    }
+
   for (i = 0; i < this->size; ++i)
     {
       if (this->code[i]->type == T_INTEGER && line == this->code[i]->u.integer)
@@ -394,6 +527,19 @@ struct Pc *Program_fromLine(struct Program *this, long int line, struct Pc *pc)
 {
   int i;
 
+  if (this->numbered)
+    {
+      i = findLine(this, line);
+      if (i < this->size)
+        {
+          pc->line = i;
+          pc->token = this->code[i] + 1;
+          return pc;
+        }
+
+      return (struct Pc *)0;
+    }
+
   for (i = 0; i < this->size; ++i)
     {
       if (this->code[i]->type == T_INTEGER && this->code[i]->u.integer >= line)
@@ -411,6 +557,24 @@ struct Pc *Program_toLine(struct Program *this, long int line, struct Pc *pc)
 {
   int i;
 
+  if (this->numbered)
+    {
+      i = findLine(this, line);
+      if (i == this->size || this->code[i]->u.integer != line)
+        {
+          --i;
+        }
+
+      if (i >= 0)
+        {
+          pc->line = i;
+          pc->token = this->code[i] + 1;
+          return pc;
+        }
+
+      return (struct Pc *)0;
+    }
+
   for (i = this->size - 1; i >= 0; --i)
     {
       if (this->code[i]->type == T_INTEGER && this->code[i]->u.integer <= line)
@@ -621,6 +785,11 @@ int Program_skipEOL(struct Program *this, struct Pc *pc, int dev, int tr)
 
 void Program_trace(struct Program *this, struct Pc *pc, int dev, int tr)
 {
+  if (tr && this->profiling)
+    {
+      Program_profileLine(this, pc, 1);
+    }
+
   if (tr && this->trace && pc->line != -1)
     {
       char buf[40];
@@ -630,6 +799,174 @@ void Program_trace(struct Program *this, struct Pc *pc, int dev, int tr)
     }
 }
 
+/* PROFILE ON: Start counting line executions and function calls afresh.
+ * The running time is charged to a line from each line change to the
+ * next, which needs one clock reading per line and works with any clock
+ * resolution: a coarse clock charges whole ticks to the lines that happen
+ * to run across them, which averages out over a longer run.
+ */
+
+int Program_profileStart(struct Program *this)
+{
+  dropProfile(this);
+  this->profile = calloc(this->size ? this->size : 1,
+                         sizeof(struct ProfileLine));
+  if (this->profile == (struct ProfileLine *)0)
+    {
+      return -1;
+    }
+
+  this->profiling = 1;
+  clock_gettime(CLOCK_MONOTONIC, &this->profileStamp);
+  return 0;
+}
+
+/* PROFILE OFF: Stop counting, but keep the counters for the report */
+
+void Program_profileStop(struct Program *this)
+{
+  if (this->profiling)
+    {
+      Program_profileLine(this, (const struct Pc *)0, 0);
+      this->profiling = 0;
+    }
+}
+
+/* Charge the time since the last line change to the current line and
+ * make pc the current line, counting one execution of it if enter is set.
+ * A null pc or one in direct mode charges the time that follows to no
+ * line.
+ */
+
+void Program_profileLine(struct Program *this, const struct Pc *pc,
+                         int enter)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  if (this->profileLine >= 0)
+    {
+      this->profile[this->profileLine].time +=
+        elapsed(&this->profileStamp, &now);
+    }
+
+  this->profileStamp = now;
+  if (pc == (const struct Pc *)0 || pc->line < 0 || pc->line >= this->size)
+    {
+      this->profileLine = -1;
+      return;
+    }
+
+  this->profileLine = pc->line;
+  if (enter)
+    {
+      ++this->profile[pc->line].count;
+    }
+}
+
+/* Count a call of the function whose definition starts at fn and add the
+ * time since start, including the lines and calls it ran, to it.
+ */
+
+void Program_profileCall(struct Program *this, const struct Pc *fn,
+                         const struct timespec *start)
+{
+  struct timespec now;
+
+  if (this->profile == (struct ProfileLine *)0 || fn->line < 0 ||
+      fn->line >= this->size)
+    {
+      return;
+    }
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  ++this->profile[fn->line].calls;
+  this->profile[fn->line].calltime += elapsed(start, &now);
+}
+
+/* PROFILE: Print the lines by the time spent on them, and the functions
+ * by the time spent in their calls.
+ */
+
+void Program_profileReport(struct Program *this, int chn)
+{
+  struct ProfileLine **sorted;
+  struct ProfileLine *p;
+  struct Token *t;
+  double total;
+  char buf[80];
+  struct Pc pc;
+  int header;
+  int n;
+  int i;
+
+  if (this->profile == (struct ProfileLine *)0)
+    {
+      return;
+    }
+
+  if (this->profiling)
+    {
+      Program_profileLine(this, (const struct Pc *)0, 0);
+    }
+
+  sorted = malloc(sizeof(struct ProfileLine *) * (this->size + 1));
+  if (sorted == (struct ProfileLine **)0)
+    {
+      return;
+    }
+
+  for (total = 0.0, n = 0, i = 0; i < this->size; ++i)
+    {
+      p = &this->profile[i];
+      if (p->count || p->calls)
+        {
+          total += p->time;
+          sorted[n++] = p;
+        }
+    }
+
+  qsort(sorted, n, sizeof(struct ProfileLine *), cmpLineTime);
+  FS_putChars(chn, _("    Line      Count   Time [s]  Time %\n"));
+  for (i = 0; i < n; ++i)
+    {
+      if (sorted[i]->count)
+        {
+          pc.line = sorted[i] - this->profile;
+          sprintf(buf, "%8ld %10lu %10.6f %7.2f\n",
+                  Program_lineNumber(this, &pc), sorted[i]->count,
+                  sorted[i]->time,
+                  total > 0.0 ? 100.0 * sorted[i]->time / total : 0.0);
+          FS_putChars(chn, buf);
+        }
+    }
+
+  qsort(sorted, n, sizeof(struct ProfileLine *), cmpCallTime);
+  for (header = 0, i = 0; i < n; ++i)
+    {
+      if (sorted[i]->calls)
+        {
+          if (!header)
+            {
+              FS_putChars(chn, _("Function        Calls   Time [s]    Line\n"));
+              header = 1;
+            }
+
+          pc.line = sorted[i] - this->profile;
+          for (t = this->code[pc.line]; t->type != T_EOL &&
+               t->type != T_IDENTIFIER; ++t);
+
+          sprintf(buf, "%-12.12s %8lu %10.6f %7ld\n",
+                  t->type == T_IDENTIFIER ? t->u.identifier->name : "?",
+                  sorted[i]->calls, sorted[i]->calltime,
+                  Program_lineNumber(this, &pc));
+          FS_putChars(chn, buf);
+        }
+    }
+
+  free(sorted);
+}
+
 void Program_PCtoError(struct Program *this, struct Pc *pc, struct Value *v)
 {
   struct String s;
@@ -880,6 +1217,8 @@ void Program_renum(struct Program *this, int first, int inc)
       this->code[i]->u.integer = first + i * inc;
     }
 
+  dropIndex(this);
+
   this->numbered = 1;
   this->runnable = 0;
   this->unsaved = 1;
@@ -935,6 +1274,8 @@ void Program_unnum(struct Program *this)
         }
     }
 
+  dropIndex(this);
+
   free(ref);
   this->runnable = 0;
   this->unsaved = 1;
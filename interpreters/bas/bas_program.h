@@ -96,6 +96,13 @@ struct Pc *Program_end(struct Program *this, struct Pc *pc);
 struct Pc *Program_nextLine(struct Program *this, struct Pc *pc);
 int Program_skipEOL(struct Program *this, struct Pc *pc, int dev, int tr);
 void Program_trace(struct Program *this, struct Pc *pc, int dev, int tr);
+int Program_profileStart(struct Program *this);
+void Program_profileStop(struct Program *this);
+void Program_profileLine(struct Program *this, const struct Pc *pc,
+                         int enter);
+void Program_profileCall(struct Program *this, const struct Pc *fn,
+                         const struct timespec *start);
+void Program_profileReport(struct Program *this, int chn);
 void Program_PCtoError(struct Program *this, struct Pc *pc,
                        struct Value *v);
 struct Value *Program_merge(struct Program *this, int dev,
@@ -63,6 +63,8 @@
  * Included Files
  ****************************************************************************/
 
+#include <time.h>
+
 #include "bas_str.h"
 
 /****************************************************************************
@@ -83,6 +85,14 @@ struct Scope
   struct Scope *next;
 };
 
+struct ProfileLine
+{
+  unsigned long count;         /* Times the line was entered */
+  unsigned long calls;         /* Calls of a function defined on the line */
+  double time;                 /* Seconds spent executing the line */
+  double calltime;             /* Seconds spent in calls of that function */
+};
+
 struct Program
 {
   int trace;
@@ -94,6 +104,12 @@ struct Program
   struct String name;
   struct Token **code;
   struct Scope *scope;
+  int *lineIndex;      /* Index + 1 of each numbered line, hashed by number */
+  int lineIndexMask;   /* Size of lineIndex - 1, or -1 if it is not built */
+  int profiling;       /* Set by PROFILE ON */
+  int profileLine;     /* Line the running time is charged to, or -1 */
+  struct ProfileLine *profile;  /* Counters for each line, or NULL */
+  struct timespec profileStamp; /* Time of the last line change */
 };
 
 #endif /* __APPS_EXAMPLES_BAS_BAS_PROGRAMTYPES_H */
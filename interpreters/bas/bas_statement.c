@@ -5084,6 +5084,41 @@ struct Value *stmt_PRINT_LPRINT(struct Value *value)
   return (struct Value *)0;
 }
 
+struct Value *stmt_PROFILE(struct Value *value)
+{
+  ++g_pc.token;
+  if (g_pc.token->type == T_ON)
+    {
+      ++g_pc.token;
+      if (g_pass == INTERPRET && Program_profileStart(&g_program) == -1)
+        {
+          return Value_new_ERROR(value, OUTOFMEMORY);
+        }
+    }
+  else if (g_pc.token->type == T_IDENTIFIER &&
+           cistrcmp(g_pc.token->u.identifier->name, "off") == 0)
+    {
+      ++g_pc.token;
+      if (g_pass == INTERPRET)
+        {
+          Program_profileStop(&g_program);
+        }
+    }
+  else if (g_pc.token->type == T_EOL || g_pc.token->type == T_COLON)
+    {
+      if (g_pass == INTERPRET)
+        {
+          Program_profileReport(&g_program, STDCHANNEL);
+        }
+    }
+  else
+    {
+      return Value_new_ERROR(value, SYNTAX);
+    }
+
+  return (struct Value *)0;
+}
+
 struct Value *stmt_RANDOMIZE(struct Value *value)
 {
   struct Pc argpc;
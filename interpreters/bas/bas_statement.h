@@ -133,6 +133,7 @@ struct Value *stmt_OPTIONRUN(struct Value *value);
 struct Value *stmt_OPTIONSTOP(struct Value *value);
 struct Value *stmt_OUT_POKE(struct Value *value);
 struct Value *stmt_PRINT_LPRINT(struct Value *value);
+struct Value *stmt_PROFILE(struct Value *value);
 struct Value *stmt_RANDOMIZE(struct Value *value);
 struct Value *stmt_READ(struct Value *value);
 struct Value *stmt_COPY_RENAME(struct Value *value);
@@ -73,6 +73,131 @@
 
 #include "bas_str.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_INTERPRETER_BAS_STRPOOL
+#  define CONFIG_INTERPRETER_BAS_STRPOOL 8
+#endif
+
+/* Buffers of up to STR_MAXCLASS bytes are rounded up to a power of two
+ * size class, starting with STR_MINCLASS.  Released buffers of each class
+ * are kept on a free list so that the temporaries created while
+ * evaluating string expressions recycle memory instead of going back to
+ * the heap.  Larger buffers grow by half their size at a time.
+ */
+
+#define STR_MINCLASS  16
+#define STR_NCLASSES  5
+#define STR_MAXCLASS  (STR_MINCLASS << (STR_NCLASSES - 1))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+#if CONFIG_INTERPRETER_BAS_STRPOOL > 0
+struct StringBuffer
+{
+  struct StringBuffer *next;
+};
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#if CONFIG_INTERPRETER_BAS_STRPOOL > 0
+static struct StringBuffer *g_strpool[STR_NCLASSES];
+static int g_strpoolcount[STR_NCLASSES];
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Return the size class index of a buffer of the given capacity, or -1 if
+ * it is not managed by the pool.
+ */
+
+static int String_class(size_t capacity)
+{
+  size_t size = STR_MINCLASS;
+  int i;
+
+  for (i = 0; i < STR_NCLASSES; ++i, size <<= 1)
+    {
+      if (capacity == size)
+        {
+          return i;
+        }
+    }
+
+  return -1;
+}
+
+/* Allocate a buffer of at least the given size, rounded up to the capacity
+ * that is actually allocated.
+ */
+
+static char *String_alloc(size_t size, size_t *capacity)
+{
+  size_t cap;
+  char *buf;
+#if CONFIG_INTERPRETER_BAS_STRPOOL > 0
+  int i;
+#endif
+
+  if (size <= STR_MAXCLASS)
+    {
+      for (cap = STR_MINCLASS; cap < size; cap <<= 1);
+
+#if CONFIG_INTERPRETER_BAS_STRPOOL > 0
+      i = String_class(cap);
+      if (g_strpool[i] != (struct StringBuffer *)0)
+        {
+          buf = (char *)g_strpool[i];
+          g_strpool[i] = g_strpool[i]->next;
+          --g_strpoolcount[i];
+          *capacity = cap;
+          return buf;
+        }
+#endif
+    }
+  else
+    {
+      cap = size;
+    }
+
+  if ((buf = malloc(cap)) != (char *)0)
+    {
+      *capacity = cap;
+    }
+
+  return buf;
+}
+
+/* Give a buffer obtained from String_alloc() back to the pool or heap */
+
+static void String_release(char *buf, size_t capacity)
+{
+#if CONFIG_INTERPRETER_BAS_STRPOOL > 0
+  int i = String_class(capacity);
+
+  if (i >= 0 && g_strpoolcount[i] < CONFIG_INTERPRETER_BAS_STRPOOL)
+    {
+      struct StringBuffer *node = (struct StringBuffer *)buf;
+
+      node->next = g_strpool[i];
+      g_strpool[i] = node;
+      ++g_strpoolcount[i];
+      return;
+    }
+#endif
+
+  free(buf);
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -95,6 +220,7 @@ struct String *String_new(struct String *this)
   assert(this != (struct String *)0);
   this->length = 0;
   this->character = (char *)0;
+  this->capacity = 0;
   this->field = (struct StringField *)0;
   return this;
 }
@@ -107,9 +233,9 @@ void String_destroy(struct String *this)
       String_leaveField(this);
     }
 
-  if (this->length)
+  if (this->capacity)
     {
-      free(this->character);
+      String_release(this->character, this->capacity);
     }
 }
 
@@ -137,12 +263,13 @@ int String_joinField(struct String *this, struct StringField *field,
   field->refStrings = n;
   field->refStrings[field->refCount] = this;
   ++field->refCount;
-  if (this->length)
+  if (this->capacity)
     {
-      free(this->character);
+      String_release(this->character, this->capacity);
     }
 
   this->character = character;
+  this->capacity = 0;
   this->length = length;
   return 0;
 }
@@ -168,6 +295,7 @@ void String_leaveField(struct String *this)
             }
 
           this->character = (char *)0;
+          this->capacity = 0;
           this->length = 0;
           this->field = (struct StringField *)0;
           return;
@@ -187,6 +315,8 @@ struct String *String_clone(struct String *this, const struct String *original)
 
 int String_size(struct String *this, size_t length)
 {
+  size_t capacity;
+  size_t size;
   char *n;
 
   assert(this != (struct String *)0);
@@ -197,26 +327,53 @@ int String_size(struct String *this, size_t length)
 
   if (length)
     {
-      if (length > this->length)
+      if (length + 1 > this->capacity)
         {
-          if ((n = realloc(this->character, length + 1)) == (char *)0)
+          /* Leave room for further appends, so that building a string
+           * piecewise does not copy it once per character.
+           */
+
+          size = length + 1;
+          if (size > STR_MAXCLASS && this->capacity > 0)
+            {
+              capacity = this->capacity + this->capacity / 2;
+              if (capacity > size)
+                {
+                  size = capacity;
+                }
+            }
+
+          if ((n = String_alloc(size, &capacity)) == (char *)0)
             {
               return -1;
             }
 
+          if (this->length)
+            {
+              memcpy(n, this->character,
+                     this->length < length ? this->length : length);
+            }
+
+          if (this->capacity)
+            {
+              String_release(this->character, this->capacity);
+            }
+
           this->character = n;
+          this->capacity = capacity;
         }
 
       this->character[length] = '\0';
     }
   else
     {
-      if (this->length)
+      if (this->capacity)
         {
-          free(this->character);
+          String_release(this->character, this->capacity);
         }
 
       this->character = (char *)0;
+      this->capacity = 0;
     }
 
   this->length = length;
@@ -73,6 +73,7 @@ struct String
 {
   size_t length;
   char *character;
+  size_t capacity;             /* Size of the owned buffer, 0 if not owned */
   struct StringField *field;
 };
 
@@ -3645,6 +3645,11 @@ case 195:
 YY_RULE_SETUP
 #line 1186 "bas_token.l"
 {
+        if (cistrcmp(yytext,"profile")==0)
+        {
+          if (cur) cur->statement=stmt_PROFILE;
+          return T_PROFILE;
+        }
         if (cur)
         {
                             size_t len;
@@ -4894,6 +4899,7 @@ void Token_destroy(struct Token *token) /*{{{*/
       case T_POKE:    break;
       case T_POW:               break;
       case T_PRINT:             break;
+      case T_PROFILE:           break;
       case T_PUT:               break;
       case T_QUOTE:             free(r->u.rem); break;
       case T_RANDOMIZE:         break;
@@ -5090,6 +5096,7 @@ struct String *Token_toString(struct Token *token, struct Token *spaceto, struct
     /* T_POKE               */ {"poke",1},
     /* T_POW                */ {"^",0},
     /* T_PRINT              */ {"print",1},
+    /* T_PROFILE            */ {"profile",1},
     /* T_PUT                */ {"put",1},
     /* T_QUOTE              */ {(const char*)0,1},
     /* T_RANDOMIZE          */ {"randomize",1},
@@ -293,6 +293,7 @@ enum TokenType
   T_POKE,
   T_POW,
   T_PRINT,
+  T_PROFILE,
   T_PUT,
   T_QUOTE,
   T_RANDOMIZE,
@@ -473,6 +474,7 @@ struct Token
     /* T_POKE               */
     /* T_POW                */
     /* T_PRINT              */
+    /* T_PROFILE            */
     /* T_PUT                */
     /* T_QUOTE              */ /* char *rem; */
     /* T_RANDOMIZE          */
@@ -75,6 +75,131 @@
 
 #define _(String) String
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Return true if the arrays hold numbers of the same type.  The elements
+ * of an array always carry the type of the array, so the MAT operations
+ * can then work on the raw numbers instead of going through the generic
+ * Value arithmetic for every element.
+ */
+
+static int Var_numeric(enum ValueType type, const struct Var *x,
+                       const struct Var *y)
+{
+  return (type == V_INTEGER || type == V_REAL) &&
+         x->type == type && (y == (struct Var *)0 || y->type == type);
+}
+
+/* Multiply the REAL matrices x and y into foo.  The operands are first
+ * copied to contiguous scratch arrays, with y transposed, so that the
+ * inner product runs over consecutive memory.  Each sum is accumulated
+ * in the same order as the generic code, so the results are identical.
+ */
+
+static int Var_multReal(struct Var *foo, const struct Var *x,
+                        const struct Var *y, int unused)
+{
+  unsigned int rows = x->geometry[0];
+  unsigned int inner = x->geometry[1];
+  unsigned int cols = y->geometry[1];
+  unsigned int i, j, k;
+  double *xv, *yv;
+
+  xv = malloc(sizeof(double) * inner * (cols + 1));
+  if (xv == (double *)0)
+    {
+      return -1;
+    }
+
+  yv = xv + inner;
+  for (k = unused; k < inner; ++k)
+    {
+      for (j = unused; j < cols; ++j)
+        {
+          yv[j * inner + k] = y->value[k * cols + j].u.real;
+        }
+    }
+
+  for (i = unused; i < rows; ++i)
+    {
+      for (k = unused; k < inner; ++k)
+        {
+          xv[k] = x->value[i * inner + k].u.real;
+        }
+
+      for (j = unused; j < cols; ++j)
+        {
+          const double *yc = yv + j * inner;
+          double sum = 0.0;
+
+          for (k = unused; k < inner; ++k)
+            {
+              sum += xv[k] * yc[k];
+            }
+
+          foo->value[i * cols + j].u.real = sum;
+        }
+    }
+
+  free(xv);
+  return 0;
+}
+
+/* The same for INTEGER matrices, which wrap around like the generic
+ * INTEGER arithmetic does.
+ */
+
+static int Var_multInteger(struct Var *foo, const struct Var *x,
+                           const struct Var *y, int unused)
+{
+  unsigned int rows = x->geometry[0];
+  unsigned int inner = x->geometry[1];
+  unsigned int cols = y->geometry[1];
+  unsigned int i, j, k;
+  long int *xv, *yv;
+
+  xv = malloc(sizeof(long int) * inner * (cols + 1));
+  if (xv == (long int *)0)
+    {
+      return -1;
+    }
+
+  yv = xv + inner;
+  for (k = unused; k < inner; ++k)
+    {
+      for (j = unused; j < cols; ++j)
+        {
+          yv[j * inner + k] = y->value[k * cols + j].u.integer;
+        }
+    }
+
+  for (i = unused; i < rows; ++i)
+    {
+      for (k = unused; k < inner; ++k)
+        {
+          xv[k] = x->value[i * inner + k].u.integer;
+        }
+
+      for (j = unused; j < cols; ++j)
+        {
+          const long int *yc = yv + j * inner;
+          long int sum = 0;
+
+          for (k = unused; k < inner; ++k)
+            {
+              sum += xv[k] * yc[k];
+            }
+
+          foo->value[i * cols + j].u.integer = sum;
+        }
+    }
+
+  free(xv);
+  return 0;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -284,6 +409,33 @@ struct Value *Var_mat_addsub(struct Var *this, struct Var *x, struct Var *y,
 
       g0 = x->geometry[0];
       g1 = x->dim == 1 ? unused + 1 : x->geometry[1];
+      if (Var_numeric(thisType, x, y))
+        {
+          for (i = unused; i < g0; ++i)
+            {
+              for (j = unused; j < g1; ++j)
+                {
+                  unsigned int element = x->dim == 1 ? i : i * g1 + j;
+                  struct Value *d = &this->value[element];
+                  const struct Value *a = &x->value[element];
+                  const struct Value *b = &y->value[element];
+
+                  if (thisType == V_REAL)
+                    {
+                      d->u.real = add ? a->u.real + b->u.real :
+                                        a->u.real - b->u.real;
+                    }
+                  else
+                    {
+                      d->u.integer = add ? a->u.integer + b->u.integer :
+                                           a->u.integer - b->u.integer;
+                    }
+                }
+            }
+
+          return (struct Value *)0;
+        }
+
       for (i = unused; i < g0; ++i)
         {
           for (j = unused; j < g1; ++j)
@@ -359,6 +511,15 @@ struct Value *Var_mat_mult(struct Var *this, struct Var *x, struct Var *y,
       newdim[0] = x->geometry[0];
       newdim[1] = y->geometry[1];
       Var_new(&foo, thisType, 2, newdim, 0);
+      if (Var_numeric(thisType, x, y) &&
+          (thisType == V_REAL ? Var_multReal(&foo, x, y, unused) :
+                                Var_multInteger(&foo, x, y, unused)) == 0)
+        {
+          Var_destroy(this);
+          *this = foo;
+          return (struct Value *)0;
+        }
+
       for (i = unused; i < newdim[0]; ++i)
         {
           for (j = unused; j < newdim[1]; ++j)
@@ -426,6 +587,31 @@ struct Value *Var_mat_scalarMult(struct Var *this, struct Value *factor,
 
       g0 = x->geometry[0];
       g1 = x->dim == 1 ? unused + 1 : x->geometry[1];
+      if (Var_numeric(thisType, x, (struct Var *)0) &&
+          factor->type == thisType)
+        {
+          for (i = unused; i < g0; ++i)
+            {
+              for (j = unused; j < g1; ++j)
+                {
+                  unsigned int element = x->dim == 1 ? i : i * g1 + j;
+
+                  if (thisType == V_REAL)
+                    {
+                      this->value[element].u.real =
+                        x->value[element].u.real * factor->u.real;
+                    }
+                  else
+                    {
+                      this->value[element].u.integer =
+                        x->value[element].u.integer * factor->u.integer;
+                    }
+                }
+            }
+
+          return (struct Value *)0;
+        }
+
       for (i = unused; i < g0; ++i)
         {
           for (j = unused; j < g1; ++j)
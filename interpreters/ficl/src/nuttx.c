@@ -1,12 +1,54 @@
+#include <nuttx/config.h>
+
 #include <sys/stat.h>
 #include <sys/statfs.h>
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
 
 #include "ficl.h"
 
+#ifdef CONFIG_INTERPRETERS_IHEAP
+#  include "interpreters/iheap.h"
+
+#  ifndef CONFIG_INTERPRETERS_FICL_HEAPQUOTA
+#    define CONFIG_INTERPRETERS_FICL_HEAPQUOTA 0
+#  endif
+
+/* All Ficl systems share one accounted heap, created on first use */
+
+static struct iheap_s g_ficl_heap;
+static bool g_ficl_heapinit;
+
+static struct iheap_s *ficlHeap(void)
+{
+  if (!g_ficl_heapinit)
+    {
+      iheap_initialize(&g_ficl_heap, "ficl",
+                       CONFIG_INTERPRETERS_FICL_HEAPQUOTA);
+      g_ficl_heapinit = true;
+    }
+
+  return &g_ficl_heap;
+}
+
+void *ficlMalloc(size_t size)
+{
+  return iheap_malloc(ficlHeap(), size);
+}
+
+void *ficlRealloc(void *p, size_t size)
+{
+  return iheap_realloc(ficlHeap(), p, size);
+}
+
+void ficlFree(void *p)
+{
+  iheap_free(ficlHeap(), p);
+}
+#else
 void *ficlMalloc(size_t size)
 {
   return malloc(size);
@@ -21,6 +63,7 @@ void ficlFree(void *p)
 {
   free(p);
 }
+#endif
 
 void ficlCallbackDefaultTextOut(ficlCallback *callback, char *message)
 {
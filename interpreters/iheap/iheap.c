@@ -0,0 +1,399 @@
+/****************************************************************************
+ * apps/interpreters/iheap/iheap.c
+ * Accounted heaps for the interpreters
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <semaphore.h>
+#include <errno.h>
+#include <assert.h>
+
+#include "interpreters/iheap.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Configuration ************************************************************/
+
+#ifndef CONFIG_INTERPRETERS_IHEAP_POOLDEPTH
+#  define CONFIG_INTERPRETERS_IHEAP_POOLDEPTH 8
+#endif
+
+/* The largest payload kept on a free list */
+
+#define IHEAP_MAXBLOCK  (IHEAP_MINBLOCK << (IHEAP_NCLASSES - 1))
+
+/* Size of the chunk header, preserving double alignment of the payload */
+
+#define IHEAP_ALIGN     8
+#define IHEAP_HDRSIZE   ((sizeof(struct iheap_chunk_s) + IHEAP_ALIGN - 1) & \
+                         ~(IHEAP_ALIGN - 1))
+#define IHEAP_HDR(m)    ((FAR struct iheap_chunk_s *)((FAR char *)(m) - IHEAP_HDRSIZE))
+#define IHEAP_DATA(c)   ((FAR char *)(c) + IHEAP_HDRSIZE)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This header precedes every block allocated from a heap */
+
+struct iheap_chunk_s
+{
+  FAR struct iheap_chunk_s *flink; /* Free list link (only when pooled) */
+  size_t size;                     /* Usable size of the payload */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* All initialized heaps.  The list is walked by other tasks, so changes
+ * to it must be protected.
+ */
+
+static FAR struct iheap_s *g_iheaps;
+static sem_t g_iheap_sem = SEM_INITIALIZER(1);
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void iheap_lock(void)
+{
+  while (sem_wait(&g_iheap_sem) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+}
+
+/* Return the size class able to hold size bytes or -1 for the heap */
+
+static int iheap_class(size_t size)
+{
+  size_t blksize = IHEAP_MINBLOCK;
+  int sclass;
+
+  for (sclass = 0; sclass < IHEAP_NCLASSES; sclass++, blksize <<= 1)
+    {
+      if (size <= blksize)
+        {
+          return sclass;
+        }
+    }
+
+  return -1;
+}
+
+/* Check that size more bytes may be charged to the heap */
+
+static bool iheap_charge(FAR struct iheap_s *heap, size_t size)
+{
+  if (heap->quota != 0 &&
+      (size > heap->quota || heap->inuse > heap->quota - size))
+    {
+      heap->nfailed++;
+      return false;
+    }
+
+  return true;
+}
+
+static void iheap_account(FAR struct iheap_s *heap, size_t size)
+{
+  heap->inuse += size;
+  if (heap->inuse > heap->peak)
+    {
+      heap->peak = heap->inuse;
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: iheap_initialize
+ ****************************************************************************/
+
+void iheap_initialize(FAR struct iheap_s *heap, FAR const char *name,
+                      size_t quota)
+{
+  DEBUGASSERT(heap != NULL);
+
+  memset(heap, 0, sizeof(struct iheap_s));
+  heap->name  = name;
+  heap->quota = quota;
+
+  iheap_lock();
+  heap->flink = g_iheaps;
+  g_iheaps    = heap;
+  sem_post(&g_iheap_sem);
+}
+
+/****************************************************************************
+ * Name: iheap_uninitialize
+ ****************************************************************************/
+
+void iheap_uninitialize(FAR struct iheap_s *heap)
+{
+  FAR struct iheap_s **prev;
+  FAR struct iheap_chunk_s *chunk;
+  int sclass;
+
+  DEBUGASSERT(heap != NULL);
+
+  iheap_lock();
+  for (prev = &g_iheaps; *prev != NULL; prev = &(*prev)->flink)
+    {
+      if (*prev == heap)
+        {
+          *prev = heap->flink;
+          break;
+        }
+    }
+
+  sem_post(&g_iheap_sem);
+
+  for (sclass = 0; sclass < IHEAP_NCLASSES; sclass++)
+    {
+      while ((chunk = heap->pool[sclass]) != NULL)
+        {
+          heap->pool[sclass] = chunk->flink;
+          free(chunk);
+        }
+
+      heap->npooled[sclass] = 0;
+    }
+
+  heap->pooled = 0;
+}
+
+/****************************************************************************
+ * Name: iheap_malloc
+ ****************************************************************************/
+
+FAR void *iheap_malloc(FAR struct iheap_s *heap, size_t size)
+{
+  FAR struct iheap_chunk_s *chunk;
+  int sclass;
+
+  sclass = iheap_class(size);
+  if (sclass >= 0)
+    {
+      size = (size_t)IHEAP_MINBLOCK << sclass;
+    }
+
+  if (!iheap_charge(heap, size))
+    {
+      return NULL;
+    }
+
+  if (sclass >= 0 && heap->pool[sclass] != NULL)
+    {
+      chunk                = heap->pool[sclass];
+      heap->pool[sclass]   = chunk->flink;
+      heap->npooled[sclass]--;
+      heap->pooled        -= size;
+    }
+  else
+    {
+      if (size > SIZE_MAX - IHEAP_HDRSIZE)
+        {
+          heap->nfailed++;
+          return NULL;
+        }
+
+      chunk = (FAR struct iheap_chunk_s *)malloc(IHEAP_HDRSIZE + size);
+      if (chunk == NULL)
+        {
+          heap->nfailed++;
+          return NULL;
+        }
+
+      chunk->size = size;
+    }
+
+  heap->nallocs++;
+  iheap_account(heap, size);
+  return IHEAP_DATA(chunk);
+}
+
+/****************************************************************************
+ * Name: iheap_zalloc
+ ****************************************************************************/
+
+FAR void *iheap_zalloc(FAR struct iheap_s *heap, size_t size)
+{
+  FAR void *mem = iheap_malloc(heap, size);
+
+  if (mem != NULL)
+    {
+      memset(mem, 0, size);
+    }
+
+  return mem;
+}
+
+/****************************************************************************
+ * Name: iheap_realloc
+ ****************************************************************************/
+
+FAR void *iheap_realloc(FAR struct iheap_s *heap, FAR void *mem,
+                        size_t size)
+{
+  FAR struct iheap_chunk_s *chunk;
+  FAR void *newmem;
+
+  if (mem == NULL)
+    {
+      return iheap_malloc(heap, size);
+    }
+
+  if (size == 0)
+    {
+      iheap_free(heap, mem);
+      return NULL;
+    }
+
+  /* A pooled block that is large enough is simply kept */
+
+  chunk = IHEAP_HDR(mem);
+  if (chunk->size <= IHEAP_MAXBLOCK && size <= chunk->size)
+    {
+      return mem;
+    }
+
+  /* Heap blocks staying out of the pool can be resized in place */
+
+  if (chunk->size > IHEAP_MAXBLOCK && size > IHEAP_MAXBLOCK)
+    {
+      if (size > chunk->size && !iheap_charge(heap, size - chunk->size))
+        {
+          return NULL;
+        }
+
+      if (size > SIZE_MAX - IHEAP_HDRSIZE)
+        {
+          heap->nfailed++;
+          return NULL;
+        }
+
+      newmem = realloc(chunk, IHEAP_HDRSIZE + size);
+      if (newmem == NULL)
+        {
+          heap->nfailed++;
+          return NULL;
+        }
+
+      chunk        = (FAR struct iheap_chunk_s *)newmem;
+      heap->inuse -= chunk->size;
+      chunk->size  = size;
+      iheap_account(heap, size);
+      return IHEAP_DATA(chunk);
+    }
+
+  /* Otherwise move the data between the pool and the heap */
+
+  newmem = iheap_malloc(heap, size);
+  if (newmem != NULL)
+    {
+      memcpy(newmem, mem, size < chunk->size ? size : chunk->size);
+      iheap_free(heap, mem);
+    }
+
+  return newmem;
+}
+
+/****************************************************************************
+ * Name: iheap_free
+ ****************************************************************************/
+
+void iheap_free(FAR struct iheap_s *heap, FAR void *mem)
+{
+  FAR struct iheap_chunk_s *chunk;
+  int sclass;
+
+  if (mem == NULL)
+    {
+      return;
+    }
+
+  chunk = IHEAP_HDR(mem);
+  DEBUGASSERT(heap->inuse >= chunk->size);
+
+  heap->inuse -= chunk->size;
+  heap->nfrees++;
+
+  sclass = iheap_class(chunk->size);
+  if (sclass >= 0 &&
+      heap->npooled[sclass] < CONFIG_INTERPRETERS_IHEAP_POOLDEPTH)
+    {
+      chunk->flink       = heap->pool[sclass];
+      heap->pool[sclass] = chunk;
+      heap->npooled[sclass]++;
+      heap->pooled      += chunk->size;
+    }
+  else
+    {
+      free(chunk);
+    }
+}
+
+/****************************************************************************
+ * Name: iheap_foreach
+ ****************************************************************************/
+
+int iheap_foreach(iheap_handler_t handler, FAR void *arg)
+{
+  FAR struct iheap_s *heap;
+  int ret = 0;
+
+  iheap_lock();
+  for (heap = g_iheaps; heap != NULL && ret == 0; heap = heap->flink)
+    {
+      ret = handler(heap, arg);
+    }
+
+  sem_post(&g_iheap_sem);
+  return ret;
+}
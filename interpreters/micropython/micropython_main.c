@@ -41,7 +41,12 @@
 #include <nuttx/config.h>
 
 #include <sys/types.h>
+#include <sys/stat.h>
+#include <stdbool.h>
+#include <stdlib.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <semaphore.h>
 #include <string.h>
 #include <debug.h>
 #include <stdio.h>
@@ -61,11 +66,30 @@
 #include "repl.h"
 #include "pfenv.h"
 #include "pyexec.h"
+#include "pyfrozen.h"
 
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* Directory searched for modules that are not found as given */
+
+#ifndef CONFIG_INTERPRETERS_MICROPYTHON_PATH
+#  define CONFIG_INTERPRETERS_MICROPYTHON_PATH "/etc/python"
+#endif
+
+/* Modules imported when the interpreter is initialized */
+
+#ifndef CONFIG_INTERPRETERS_MICROPYTHON_PRELOAD
+#  define CONFIG_INTERPRETERS_MICROPYTHON_PRELOAD ""
+#endif
+
+/* The interpreter state can only outlive a run in the flat address space */
+
+#ifdef CONFIG_BUILD_KERNEL
+#  undef CONFIG_INTERPRETERS_MICROPYTHON_PERSISTENT
+#endif
+
 #define FORCE_EVAL(x) do {                        \
         if (sizeof(x) == sizeof(float)) {         \
                 volatile float __x;               \
@@ -86,10 +110,88 @@
  * Private Data
 ****************************************************************************/
 
+#ifdef CONFIG_INTERPRETERS_MICROPYTHON_PERSISTENT
+/* The interpreter state, its imported modules and globals are kept from
+ * one run to the next.  Only one instance may use them at a time.
+ */
+
+static sem_t g_mp_lock = SEM_INITIALIZER(1);
+static bool g_mp_initialized;
+#endif
+
+/****************************************************************************
+ * Public Data
+****************************************************************************/
+
+#ifndef CONFIG_INTERPRETERS_MICROPYTHON_FROZEN
+/* No frozen modules.  Otherwise the table is generated by mkfrozen.sh */
+
+const struct pyfrozen_s g_pyfrozen[] =
+{
+  { NULL, 0, NULL }
+};
+#endif
+
 /****************************************************************************
  * Private Function
 ****************************************************************************/
 
+/****************************************************************************
+ * frozen_find
+ *
+ * Description:
+ *   Find the frozen module for a module path built by the import code.
+ *   Frozen modules are matched by their file name alone, but an absolute
+ *   path always refers to the file system.
+ *
+ ****************************************************************************/
+
+static FAR const struct pyfrozen_s *frozen_find(FAR const char *path)
+{
+  FAR const struct pyfrozen_s *frozen;
+  FAR const char *name = strrchr(path, '/');
+
+  if (path[0] == '/')
+    {
+      return NULL;
+    }
+
+  name = name != NULL ? name + 1 : path;
+  for (frozen = g_pyfrozen; frozen->name != NULL; frozen++)
+    {
+      if (strcmp(frozen->name, name) == 0)
+        {
+          return frozen;
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * module_stat
+ *
+ * Description:
+ *   stat() a module path as given or, if it is relative and not found,
+ *   in CONFIG_INTERPRETERS_MICROPYTHON_PATH.  The path that was found is
+ *   returned in fullpath.
+ *
+ ****************************************************************************/
+
+static int module_stat(FAR const char *path, FAR char *fullpath,
+                       FAR struct stat *buf)
+{
+  snprintf(fullpath, MICROPY_ALLOC_PATH_MAX, "%s", path);
+  if (stat(fullpath, buf) == 0 || path[0] == '/')
+    {
+      return OK;
+    }
+
+  snprintf(fullpath, MICROPY_ALLOC_PATH_MAX, "%s/%s",
+           CONFIG_INTERPRETERS_MICROPYTHON_PATH, path);
+  return stat(fullpath, buf);
+}
+
 void do_str(FAR const char *src)
 {
   FAR mp_lexer_t *lex =
@@ -139,6 +241,34 @@ void do_str(FAR const char *src)
     }
 }
 
+/****************************************************************************
+ * preload
+ *
+ * Description:
+ *   Import the modules listed in CONFIG_INTERPRETERS_MICROPYTHON_PRELOAD.
+ *
+ ****************************************************************************/
+
+static void preload(void)
+{
+  FAR const char *list = CONFIG_INTERPRETERS_MICROPYTHON_PRELOAD;
+  char cmd[64];
+  size_t len;
+
+  while (*list != '\0')
+    {
+      len = strcspn(list, " ,");
+      if (len > 0 && len < sizeof(cmd) - 8)
+        {
+          snprintf(cmd, sizeof(cmd), "import %.*s", (int)len, list);
+          do_str(cmd);
+        }
+
+      list += len;
+      list += strspn(list, " ,");
+    }
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -149,6 +279,26 @@ void do_str(FAR const char *src)
 
 mp_import_stat_t mp_import_stat(FAR const char *path)
 {
+  char fullpath[MICROPY_ALLOC_PATH_MAX];
+  struct stat buf;
+
+  if (frozen_find(path) != NULL)
+    {
+      return MP_IMPORT_STAT_FILE;
+    }
+
+  if (module_stat(path, fullpath, &buf) == 0)
+    {
+      if (S_ISDIR(buf.st_mode))
+        {
+          return MP_IMPORT_STAT_DIR;
+        }
+      else if (S_ISREG(buf.st_mode))
+        {
+          return MP_IMPORT_STAT_FILE;
+        }
+    }
+
   return MP_IMPORT_STAT_NO_EXIST;
 }
 
@@ -158,7 +308,64 @@ mp_import_stat_t mp_import_stat(FAR const char *path)
 
 mp_lexer_t *mp_lexer_new_from_file(FAR const char *filename)
 {
-  return NULL;
+  FAR const struct pyfrozen_s *frozen;
+  char fullpath[MICROPY_ALLOC_PATH_MAX];
+  struct stat buf;
+  FAR mp_lexer_t *lex;
+  FAR char *source;
+  ssize_t nread;
+  size_t size;
+  size_t len;
+  int fd;
+
+  /* The source of a frozen module is lexed in place in FLASH */
+
+  frozen = frozen_find(filename);
+  if (frozen != NULL)
+    {
+      return mp_lexer_new_from_str_len(qstr_from_str(filename),
+                                       frozen->source, frozen->len, 0);
+    }
+
+  if (module_stat(filename, fullpath, &buf) < 0 || !S_ISREG(buf.st_mode))
+    {
+      return NULL;
+    }
+
+  fd = open(fullpath, O_RDONLY);
+  if (fd < 0)
+    {
+      return NULL;
+    }
+
+  /* Read the whole file.  The lexer frees the buffer when it is done. */
+
+  size = buf.st_size;
+  source = m_new(char, size);
+  for (len = 0; len < size; len += nread)
+    {
+      nread = read(fd, source + len, size - len);
+      if (nread <= 0)
+        {
+          break;
+        }
+    }
+
+  close(fd);
+  if (len < size)
+    {
+      m_del(char, source, size);
+      return NULL;
+    }
+
+  lex = mp_lexer_new_from_str_len(qstr_from_str(filename), source, len,
+                                  size);
+  if (lex == NULL)
+    {
+      m_del(char, source, size);
+    }
+
+  return lex;
 }
 
 /****************************************************************************
@@ -189,7 +396,34 @@ void nlr_jump_fail(void *val)
 #ifdef CONFIG_INTERPRETERS_MICROPYTHON
 int micropython_main(int argc, char *argv[])
 {
+  int ret = 0;
+
+#ifdef CONFIG_INTERPRETERS_MICROPYTHON_PERSISTENT
+  if (sem_trywait(&g_mp_lock) < 0)
+    {
+      fprintf(stderr, "micropython: The interpreter is in use\n");
+      return 1;
+    }
+
+  if (!g_mp_initialized)
+    {
+      mp_init();
+      preload();
+      g_mp_initialized = true;
+    }
+#else
   mp_init();
+  preload();
+#endif
+
+  /* Run a script given on the command line, or the REPL */
+
+  if (argc > 1)
+    {
+      ret = pyexec_file(argv[1]) == 1 ? 0 : 1;
+      goto done;
+    }
+
   for (;;)
     {
       if (pyexec_mode_kind == PYEXEC_MODE_RAW_REPL)
@@ -208,7 +442,12 @@ int micropython_main(int argc, char *argv[])
         }
     }
 
+done:
+#ifdef CONFIG_INTERPRETERS_MICROPYTHON_PERSISTENT
+  sem_post(&g_mp_lock);
+#else
   mp_deinit();
-  return 0;
+#endif
+  return ret;
 }
 #endif
@@ -0,0 +1,56 @@
+#!/bin/sh
+# apps/interpreters/micropython/mkfrozen.sh
+#
+# Generate a C table of the Python modules in a directory, so that they can
+# be imported from FLASH without a file system.
+#
+# Usage: mkfrozen.sh <module-dir> > frozen.c
+
+USAGE="$0 <module-dir>"
+
+MODDIR=$1
+if [ -z "${MODDIR}" ]; then
+    echo "Missing command line argument" 1>&2
+    echo $USAGE 1>&2
+    exit 1
+fi
+
+if [ ! -d "${MODDIR}" ]; then
+    echo "Directory ${MODDIR} does not exist" 1>&2
+    echo $USAGE 1>&2
+    exit 1
+fi
+
+echo "/* Auto-generated by mkfrozen.sh from ${MODDIR}.. Do not edit */"
+echo ""
+echo "#include <stddef.h>"
+echo ""
+echo "#include \"pyfrozen.h\""
+echo ""
+echo "const struct pyfrozen_s g_pyfrozen[] ="
+echo "{"
+
+for FILE in ${MODDIR}/*.py; do
+    if [ ! -r "${FILE}" ]; then
+        continue
+    fi
+
+    NAME=`basename ${FILE}`
+    SIZE=`wc -c < ${FILE}`
+
+    echo "  {"
+    echo "    \"${NAME}\", ${SIZE},"
+    echo "    \"\""
+    sed -e 's/\\/\\\\/g' -e 's/"/\\"/g' -e 's/^/    "/' -e 's/$/\\n"/' ${FILE}
+
+    # sed does not end a last line that has no newline
+
+    if [ -n "`tail -c 1 ${FILE}`" ]; then
+        echo ""
+    fi
+
+    echo "  },"
+done
+
+echo "  { NULL, 0, NULL }"
+echo "};"
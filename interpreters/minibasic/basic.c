@@ -41,6 +41,7 @@
  * Included Files
  ****************************************************************************/
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -50,6 +51,10 @@
 #include <ctype.h>
 #include <assert.h>
 
+#ifdef CONFIG_INTERPRETERS_IHEAP
+#  include "interpreters/iheap.h"
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -61,6 +66,35 @@
 
 #define IOBUFSIZE CONFIG_INTERPRETER_MINIBASIC_IOBUFSIZE
 
+/* All memory used by a script is charged to the interpreter heap when
+ * that is available, so that the script's use is visible and bounded.
+ */
+
+#ifdef CONFIG_INTERPRETERS_IHEAP
+#  ifndef CONFIG_INTERPRETER_MINIBASIC_HEAPQUOTA
+#    define CONFIG_INTERPRETER_MINIBASIC_HEAPQUOTA 0
+#  endif
+
+#  define mb_malloc(s)      iheap_malloc(&g_heap, (s))
+#  define mb_calloc(n,s)    iheap_zalloc(&g_heap, (n) * (s))
+#  define mb_realloc(p,s)   iheap_realloc(&g_heap, (p), (s))
+#  define mb_free(p)        iheap_free(&g_heap, (p))
+#else
+#  define mb_malloc(s)      malloc(s)
+#  define mb_calloc(n,s)    calloc((n), (s))
+#  define mb_realloc(p,s)   realloc((p), (s))
+#  define mb_free(p)        free(p)
+#endif
+
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+/* Size limits of the token cache.  A script with more tokens than
+ * MAXTOKENS runs with the tokens beyond the limit lexed each time.
+ */
+
+#  define MAXTOKENS UINT16_MAX
+#  define LINEHASH(no) (((unsigned)(no) * 2654435761u) & g_linemask)
+#endif
+
 /* Tokens defined */
 
 #define EOS 0
@@ -174,8 +208,26 @@ struct mb_line_s
 {
   int no;                       /* Line number */
   FAR const char *str;          /* Points to start of line */
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+  int forskip;                  /* Where a FOR here that runs no times goes
+                                 * (0 until known) */
+#endif
 };
 
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+/* A token as lexed at one place in the script */
+
+struct mb_token_s
+{
+  int type;                     /* Token type, as from gettoken() */
+  uint16_t skip;                /* White space before the token */
+  uint16_t len;                 /* Token length, as from tokenlen() */
+  int slot;                     /* Index + 1 of the variable or dimensioned
+                                 * array named by an id, 0 until known */
+  double value;                 /* Value of a VALUE */
+};
+#endif
+
 struct mb_variable_s
 {
   char id[32];                  /* Id of variable */
@@ -243,12 +295,31 @@ static int g_token;                             /* Current token (lookahead) */
 static int g_errorflag;                         /* Set when error in input encountered */
 static char g_iobuffer[IOBUFSIZE];              /* I/O buffer */
 
+#ifdef CONFIG_INTERPRETERS_IHEAP
+static struct iheap_s g_heap;                   /* Memory used by the script */
+#endif
+
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+static FAR const char *g_script;                /* The script */
+static FAR uint16_t *g_tokmap;                  /* Token index + 1 by offset */
+static FAR struct mb_token_s *g_tokens;         /* Tokens lexed so far */
+static int g_ntokens;                           /* Number of tokens lexed */
+static int g_maxtokens;                         /* Allocated size of g_tokens */
+static FAR int *g_linehash;                     /* Line index + 1 by number */
+static unsigned g_linemask;                     /* Size of g_linehash - 1 */
+static int g_curline;                           /* Line being executed */
+#endif
+
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
 
 static int setup(FAR const char *script);
 static void cleanup(void);
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+static void cachesetup(void);
+static int cachetoken(FAR const char *str);
+#endif
 
 static void reporterror(int lineno);
 static int findline(int no);
@@ -279,6 +350,8 @@ static double dimvariable(void);
 
 static FAR struct mb_variable_s *findvariable(FAR const char *id);
 static FAR struct mb_dimvar_s *finddimvar(FAR const char *id);
+static FAR struct mb_variable_s *lookupvar(FAR char *id);
+static FAR struct mb_dimvar_s *lookupdimvar(FAR char *id);
 static FAR struct mb_dimvar_s *dimension(FAR const char *id, int ndims, ...);
 static FAR void *getdimvar(FAR struct mb_dimvar_s *dv, ...);
 static FAR struct mb_variable_s *addfloat(FAR const char *id);
@@ -301,6 +374,7 @@ static int integer(double x);
 static void match(int tok);
 static void seterror(int errorcode);
 static int getnextline(FAR const char *str);
+static int nexttoken(FAR const char *str);
 static int gettoken(FAR const char *str);
 static int tokenlen(FAR const char *str, int tokenid);
 
@@ -334,8 +408,12 @@ static int setup(FAR const char *script)
 {
   int i;
 
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+  g_script = script;
+#endif
+
   nlines = mystrcount(script, '\n');
-  g_lines = malloc(nlines * sizeof(struct mb_line_s));
+  g_lines = mb_malloc(nlines * sizeof(struct mb_line_s));
   if (!g_lines)
     {
       if (g_fperr)
@@ -370,7 +448,7 @@ static int setup(FAR const char *script)
           fprintf(g_fperr, "Can't read program\n");
         }
 
-      free(g_lines);
+      mb_free(g_lines);
       return -1;
     }
 
@@ -383,7 +461,7 @@ static int setup(FAR const char *script)
                     g_lines[i - 1].no, g_lines[i].no);
           }
 
-        free(g_lines);
+        mb_free(g_lines);
         return -1;
       }
 
@@ -393,9 +471,149 @@ static int setup(FAR const char *script)
   g_dimvariables = 0;
   g_ndimvariables = 0;
 
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+  cachesetup();
+#endif
+
   return 0;
 }
 
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+/****************************************************************************
+ * Name: cachesetup
+ *
+ * Description:
+ *   Allocate the token cache for g_script and build the hash of line
+ *   numbers.
+ *   Notes: without the memory, the script runs uncached
+ *
+ ****************************************************************************/
+
+static void cachesetup(void)
+{
+  unsigned size;
+  unsigned h;
+  int i;
+
+  g_tokmap = mb_calloc(strlen(g_script) + 1, sizeof(uint16_t));
+  g_ntokens = 0;
+  g_maxtokens = 0;
+  g_tokens = 0;
+
+  for (size = 16; size < 2 * (unsigned)nlines; size <<= 1)
+    {
+    }
+
+  g_linemask = size - 1;
+  g_linehash = mb_calloc(size, sizeof(int));
+
+  for (i = 0; i < nlines; i++)
+    {
+      g_lines[i].forskip = 0;
+      if (g_linehash)
+        {
+          h = LINEHASH(g_lines[i].no);
+          while (g_linehash[h])
+            {
+              h = (h + 1) & g_linemask;
+            }
+
+          g_linehash[h] = i + 1;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: cachetoken
+ *
+ * Description:
+ *   Lex the token at a place in the script, once.
+ *   Params: str - pointer into the script
+ *   Returns: index of the token in g_tokens, -1 if it is not cached
+ *   Notes: a token whose length raises an error is not cached, so that the
+ *          error is raised by match() as without the cache.
+ *
+ ****************************************************************************/
+
+static int cachetoken(FAR const char *str)
+{
+  FAR struct mb_token_s *tok;
+  FAR const char *start;
+  size_t offset;
+  int errorflag;
+  int len;
+
+  if (!g_tokmap)
+    {
+      return -1;
+    }
+
+  offset = str - g_script;
+  if (g_tokmap[offset])
+    {
+      return g_tokmap[offset] - 1;
+    }
+
+  if (g_ntokens >= g_maxtokens)
+    {
+      if (g_maxtokens >= MAXTOKENS)
+        {
+          return -1;
+        }
+
+      len = g_maxtokens ? 2 * g_maxtokens : 64;
+      if (len > MAXTOKENS)
+        {
+          len = MAXTOKENS;
+        }
+
+      tok = mb_realloc(g_tokens, len * sizeof(struct mb_token_s));
+      if (!tok)
+        {
+          return -1;
+        }
+
+      g_tokens = tok;
+      g_maxtokens = len;
+    }
+
+  start = str;
+  while (isspace(*start))
+    {
+      start++;
+    }
+
+  tok = &g_tokens[g_ntokens];
+  tok->type = gettoken(start);
+  tok->slot = 0;
+  tok->value = 0.0;
+
+  errorflag = g_errorflag;
+  g_errorflag = 0;
+
+  if (tok->type == VALUE)
+    {
+      tok->value = getvalue(start, &len);
+    }
+  else
+    {
+      len = tokenlen(start, tok->type);
+    }
+
+  if (g_errorflag || start - str > UINT16_MAX || len > UINT16_MAX)
+    {
+      g_errorflag = errorflag;
+      return -1;
+    }
+
+  g_errorflag = errorflag;
+  tok->skip = start - str;
+  tok->len = len;
+  g_tokmap[offset] = ++g_ntokens;
+  return g_ntokens - 1;
+}
+#endif
+
 /****************************************************************************
  * Name: cleanup
  *
@@ -414,13 +632,13 @@ static void cleanup(void)
     {
       if (g_variables[i].sval)
         {
-          free(g_variables[i].sval);
+          mb_free(g_variables[i].sval);
         }
     }
 
   if (g_variables)
     {
-      free(g_variables);
+      mb_free(g_variables);
     }
 
   g_variables = 0;
@@ -442,23 +660,23 @@ static void cleanup(void)
                 {
                   if (g_dimvariables[i].str[ii])
                     {
-                      free(g_dimvariables[i].str[ii]);
+                      mb_free(g_dimvariables[i].str[ii]);
                     }
                 }
 
-              free(g_dimvariables[i].str);
+              mb_free(g_dimvariables[i].str);
             }
         }
       else if (g_dimvariables[i].dval)
         {
 
-          free(g_dimvariables[i].dval);
+          mb_free(g_dimvariables[i].dval);
         }
     }
 
   if (g_dimvariables)
     {
-      free(g_dimvariables);
+      mb_free(g_dimvariables);
     }
 
   g_dimvariables = 0;
@@ -466,11 +684,23 @@ static void cleanup(void)
 
   if (g_lines)
     {
-      free(g_lines);
+      mb_free(g_lines);
     }
 
   g_lines = 0;
   nlines = 0;
+
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+  mb_free(g_tokmap);
+  mb_free(g_tokens);
+  mb_free(g_linehash);
+
+  g_tokmap = 0;
+  g_tokens = 0;
+  g_ntokens = 0;
+  g_maxtokens = 0;
+  g_linehash = 0;
+#endif
 }
 
 /****************************************************************************
@@ -592,7 +822,8 @@ static void reporterror(int lineno)
  * Name: findline
  *
  * Description:
- *   Binary search for a line
+ *   Binary search for a line, or a look-up in the hash of line numbers
+ *   with the token cache
  *   Params: no - line number to find
  *   Returns: index of the line, or -1 on fail.
  *
@@ -604,6 +835,23 @@ static int findline(int no)
   int low;
   int mid;
 
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+  unsigned h;
+
+  if (g_linehash)
+    {
+      for (h = LINEHASH(no); g_linehash[h]; h = (h + 1) & g_linemask)
+        {
+          if (g_lines[g_linehash[h] - 1].no == no)
+            {
+              return g_linehash[h] - 1;
+            }
+        }
+
+      return -1;
+    }
+#endif
+
   low = 0;
   high = nlines - 1;
   while (high > low + 1)
@@ -746,7 +994,7 @@ static void doprint(void)
           if (str)
             {
               fprintf(g_fpout, "%s", str);
-              free(str);
+              mb_free(str);
             }
         }
       else
@@ -804,7 +1052,7 @@ static void dolet(void)
       *lv.sval = stringexpr();
       if (temp)
         {
-          free(temp);
+          mb_free(temp);
         }
 
       break;
@@ -933,7 +1181,7 @@ static void dodim(void)
           i = 0;
           if (dimvar->str[i])
             {
-              free(dimvar->str[i]);
+              mb_free(dimvar->str[i]);
             }
 
           dimvar->str[i++] = stringexpr();
@@ -943,7 +1191,7 @@ static void dodim(void)
               match(COMMA);
               if (dimvar->str[i])
                 {
-                  free(dimvar->str[i]);
+                  mb_free(dimvar->str[i]);
                 }
 
               dimvar->str[i++] = stringexpr();
@@ -1064,11 +1312,20 @@ static int dofor(void)
   if ((stepval < 0 && initval < toval) ||
       (stepval > 0 && initval > toval))
     {
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+      /* The matching NEXT is only searched for once */
+
+      if (g_lines[g_curline].forskip)
+        {
+          return g_lines[g_curline].forskip;
+        }
+#endif
+
       savestring = g_string;
       while ((g_string = strchr(g_string, '\n')) != NULL)
         {
           g_errorflag = 0;
-          g_token = gettoken(g_string);
+          g_token = nexttoken(g_string);
           match(VALUE);
           if (g_token == NEXT)
             {
@@ -1080,7 +1337,10 @@ static int dofor(void)
                     {
                       answer = getnextline(g_string);
                       g_string = savestring;
-                      g_token = gettoken(g_string);
+                      g_token = nexttoken(g_string);
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+                      g_lines[g_curline].forskip = answer ? answer : -1;
+#endif
                       return answer ? answer : -1;
                     }
                 }
@@ -1212,7 +1472,7 @@ static void doinput(void)
       {
         if (*lv.sval)
           {
-            free(*lv.sval);
+            mb_free(*lv.sval);
             *lv.sval = NULL;
           }
 
@@ -1273,7 +1533,6 @@ static void dorem(void)
 static void lvalue(FAR struct mb_lvalue_s *lv)
 {
   char name[32];
-  int len;
   FAR struct mb_variable_s *var;
   FAR struct mb_dimvar_s *dimvar;
   int index[5];
@@ -1288,9 +1547,8 @@ static void lvalue(FAR struct mb_lvalue_s *lv)
     {
     case FLTID:
       {
-        getid(g_string, name, &len);
+        var = lookupvar(name);
         match(FLTID);
-        var = findvariable(name);
         if (!var)
           {
             var = addfloat(name);
@@ -1310,9 +1568,8 @@ static void lvalue(FAR struct mb_lvalue_s *lv)
 
     case STRID:
       {
-        getid(g_string, name, &len);
+        var = lookupvar(name);
         match(STRID);
-        var = findvariable(name);
         if (!var)
           {
             var = addstring(name);
@@ -1334,9 +1591,8 @@ static void lvalue(FAR struct mb_lvalue_s *lv)
     case DIMSTRID:
       {
         type = (g_token == DIMFLTID) ? FLTID : STRID;
-        getid(g_string, name, &len);
+        dimvar = lookupdimvar(name);
         match(g_token);
-        dimvar = finddimvar(name);
         if (dimvar)
           {
             switch (dimvar->ndims)
@@ -1520,12 +1776,12 @@ static int boolfactor(void)
             {
               if (strleft)
                 {
-                  free(strleft);
+                  mb_free(strleft);
                 }
 
               if (strright)
                 {
-                  free(strright);
+                  mb_free(strright);
                 }
 
               return 0;
@@ -1561,8 +1817,8 @@ static int boolfactor(void)
               answer = 0;
             }
 
-          free(strleft);
-          free(strright);
+          mb_free(strleft);
+          mb_free(strright);
         }
       else
         {
@@ -1764,7 +2020,12 @@ static double factor(void)
       break;
 
     case VALUE:
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+      len = cachetoken(g_string);
+      answer = len >= 0 ? g_tokens[len].value : getvalue(g_string, &len);
+#else
       answer = getvalue(g_string, &len);
+#endif
       match(VALUE);
       break;
 
@@ -1870,7 +2131,7 @@ static double factor(void)
       if (str)
         {
           answer = strlen(str);
-          free(str);
+          mb_free(str);
         }
       else
         {
@@ -1886,7 +2147,7 @@ static double factor(void)
       if (str)
         {
           answer = *str;
-          free(str);
+          mb_free(str);
         }
       else
         {
@@ -1972,7 +2233,7 @@ static double factor(void)
       if (str)
         {
           answer = strtod(str, 0);
-          free(str);
+          mb_free(str);
         }
       else
         {
@@ -1989,7 +2250,7 @@ static double factor(void)
         {
           strtod(str, &end);
           answer = end - str;
-          free(str);
+          mb_free(str);
         }
       else
         {
@@ -2052,12 +2313,12 @@ static double instr(void)
     {
       if (str)
         {
-          free(str);
+          mb_free(str);
         }
 
       if (substr)
         {
-          free(substr);
+          mb_free(substr);
         }
 
       return 0;
@@ -2072,8 +2333,8 @@ static double instr(void)
         }
     }
 
-  free(str);
-  free(substr);
+  mb_free(str);
+  mb_free(substr);
   return answer;
 }
 
@@ -2091,11 +2352,9 @@ static double variable(void)
 {
   FAR struct mb_variable_s *var;
   char id[32];
-  int len;
 
-  getid(g_string, id, &len);
+  var = lookupvar(id);
   match(FLTID);
-  var = findvariable(id);
   if (var)
     {
       return var->dval;
@@ -2120,13 +2379,11 @@ static double dimvariable(void)
 {
   FAR struct mb_dimvar_s *dimvar;
   char id[32];
-  int len;
   int index[5];
   FAR double *answer = NULL;
 
-  getid(g_string, id, &len);
+  dimvar = lookupdimvar(id);
   match(DIMFLTID);
-  dimvar = finddimvar(id);
   if (!dimvar)
     {
       seterror(ERR_NOSUCHVARIABLE);
@@ -2245,6 +2502,83 @@ static struct mb_dimvar_s *finddimvar(FAR const char *id)
   return 0;
 }
 
+/****************************************************************************
+ * Name: lookupvar
+ *
+ * Description:
+ *   Find the scalar variable named by the id at the parse string.  With the
+ *   token cache, the name is only looked up the first time that this place
+ *   in the script is parsed.
+ *   Params: id - id output [32 chars max], not set from the cache
+ *   Returns: pointer to that entry, 0 on fail
+ *
+ ****************************************************************************/
+
+static FAR struct mb_variable_s *lookupvar(FAR char *id)
+{
+  FAR struct mb_variable_s *var;
+  int len;
+
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+  int entry = cachetoken(g_string);
+
+  if (entry >= 0 && g_tokens[entry].slot)
+    {
+      return &g_variables[g_tokens[entry].slot - 1];
+    }
+#endif
+
+  getid(g_string, id, &len);
+  var = findvariable(id);
+
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+  if (var && entry >= 0)
+    {
+      g_tokens[entry].slot = var - g_variables + 1;
+    }
+#endif
+
+  return var;
+}
+
+/****************************************************************************
+ * Name: lookupdimvar
+ *
+ * Description:
+ *   Find the dimensioned array named by the id at the parse string, as
+ *   lookupvar() does for scalars.
+ *   Params: id - id output [32 chars max], not set from the cache
+ *   Returns: pointer to array entry or 0 on fail
+ *
+ ****************************************************************************/
+
+static FAR struct mb_dimvar_s *lookupdimvar(FAR char *id)
+{
+  FAR struct mb_dimvar_s *dimvar;
+  int len;
+
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+  int entry = cachetoken(g_string);
+
+  if (entry >= 0 && g_tokens[entry].slot)
+    {
+      return &g_dimvariables[g_tokens[entry].slot - 1];
+    }
+#endif
+
+  getid(g_string, id, &len);
+  dimvar = finddimvar(id);
+
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+  if (dimvar && entry >= 0)
+    {
+      g_tokens[entry].slot = dimvar - g_dimvariables + 1;
+    }
+#endif
+
+  return dimvar;
+}
+
 /****************************************************************************
  * Name: dimension
  *
@@ -2309,7 +2643,7 @@ static FAR struct mb_dimvar_s *dimension(FAR const char *id, int ndims, ...)
   switch (dv->type)
     {
     case FLTID:
-      dtemp = realloc(dv->dval, size * sizeof(double));
+      dtemp = mb_realloc(dv->dval, size * sizeof(double));
       if (dtemp)
         {
           dv->dval = dtemp;
@@ -2328,13 +2662,13 @@ static FAR struct mb_dimvar_s *dimension(FAR const char *id, int ndims, ...)
             {
               if (dv->str[i])
                 {
-                  free(dv->str[i]);
+                  mb_free(dv->str[i]);
                   dv->str[i] = 0;
                 }
             }
         }
 
-      stemp = realloc(dv->str, size * sizeof(char *));
+      stemp = mb_realloc(dv->str, size * sizeof(char *));
       if (stemp)
         {
           dv->str = stemp;
@@ -2349,7 +2683,7 @@ static FAR struct mb_dimvar_s *dimension(FAR const char *id, int ndims, ...)
             {
               if (dv->str[i])
                 {
-                  free(dv->str[i]);
+                  mb_free(dv->str[i]);
                   dv->str[i] = 0;
                 }
             }
@@ -2497,7 +2831,7 @@ static FAR struct mb_variable_s *addfloat(FAR const char *id)
   FAR struct mb_variable_s *vars;
 
   vars =
-    realloc(g_variables, (g_nvariables + 1) * sizeof(struct mb_variable_s));
+    mb_realloc(g_variables, (g_nvariables + 1) * sizeof(struct mb_variable_s));
   if (vars)
     {
       g_variables = vars;
@@ -2530,7 +2864,7 @@ static FAR struct mb_variable_s *addstring(FAR const char *id)
   FAR struct mb_variable_s *vars;
 
   vars =
-    realloc(g_variables, (g_nvariables + 1) * sizeof(struct mb_variable_s));
+    mb_realloc(g_variables, (g_nvariables + 1) * sizeof(struct mb_variable_s));
   if (vars)
     {
       g_variables = vars;
@@ -2563,7 +2897,7 @@ static FAR struct mb_dimvar_s *adddimvar(FAR const char *id)
   FAR struct mb_dimvar_s *vars;
 
   vars =
-    realloc(g_dimvariables, (g_ndimvariables + 1) * sizeof(struct mb_dimvar_s));
+    mb_realloc(g_dimvariables, (g_ndimvariables + 1) * sizeof(struct mb_dimvar_s));
   if (vars)
     {
       g_dimvariables = vars;
@@ -2664,10 +2998,10 @@ static FAR char *stringexpr(void)
       if (right)
         {
           temp = mystrconcat(left, right);
-          free(right);
+          mb_free(right);
           if (temp)
             {
-              free(left);
+              mb_free(left);
               left = temp;
             }
           else
@@ -2786,7 +3120,7 @@ static FAR char *leftstring(void)
 
   str[x] = 0;
   answer = mystrdup(str);
-  free(str);
+  mb_free(str);
   if (!answer)
     {
       seterror(ERR_OUTOFMEMORY);
@@ -2833,7 +3167,7 @@ static FAR char *rightstring(void)
     }
 
   answer = mystrdup(&str[strlen(str) - x]);
-  free(str);
+  mb_free(str);
   if (!answer)
     {
       seterror(ERR_OUTOFMEMORY);
@@ -2879,7 +3213,7 @@ static FAR char *midstring(void)
 
   if (x > (int)strlen(str) || len < 1)
     {
-      free(str);
+      mb_free(str);
       answer = mystrdup("");
       if (!answer)
         {
@@ -2897,7 +3231,7 @@ static FAR char *midstring(void)
 
   temp = &str[x - 1];
 
-  answer = malloc(len + 1);
+  answer = mb_malloc(len + 1);
   if (!answer)
     {
       seterror(ERR_OUTOFMEMORY);
@@ -2906,7 +3240,7 @@ static FAR char *midstring(void)
 
   strncpy(answer, temp, len);
   answer[len] = 0;
-  free(str);
+  mb_free(str);
   return answer;
 }
 
@@ -2943,7 +3277,7 @@ static FAR char *stringstring(void)
 
   if (N < 1)
     {
-      free(str);
+      mb_free(str);
       answer = mystrdup("");
       if (!answer)
         {
@@ -2954,10 +3288,10 @@ static FAR char *stringstring(void)
     }
 
   len = strlen(str);
-  answer = malloc(N * len + 1);
+  answer = mb_malloc(N * len + 1);
   if (!answer)
     {
-      free(str);
+      mb_free(str);
       seterror(ERR_OUTOFMEMORY);
       return 0;
     }
@@ -2967,7 +3301,7 @@ static FAR char *stringstring(void)
       strcpy(answer + len * i, str);
     }
 
-  free(str);
+  mb_free(str);
   return answer;
 }
 
@@ -2983,14 +3317,12 @@ static FAR char *stringstring(void)
 static FAR char *stringdimvar(void)
 {
   char id[32];
-  int len;
   FAR struct mb_dimvar_s *dimvar;
   FAR char **answer = NULL;
   int index[5];
 
-  getid(g_string, id, &len);
+  dimvar = lookupdimvar(id);
   match(DIMSTRID);
-  dimvar = finddimvar(id);
 
   if (dimvar)
     {
@@ -3073,12 +3405,10 @@ static FAR char *stringdimvar(void)
 static FAR char *stringvar(void)
 {
   char id[32];
-  int len;
   FAR struct mb_variable_s *var;
 
-  getid(g_string, id, &len);
+  var = lookupvar(id);
   match(STRID);
-  var = findvariable(id);
   if (var)
     {
       if (var->sval)
@@ -3123,7 +3453,7 @@ static FAR char *stringliteral(void)
       if (end)
         {
           len = end - g_string;
-          substr = malloc(len);
+          substr = mb_malloc(len);
           if (!substr)
             {
               seterror(ERR_OUTOFMEMORY);
@@ -3134,8 +3464,8 @@ static FAR char *stringliteral(void)
           if (answer)
             {
               temp = mystrconcat(answer, substr);
-              free(substr);
-              free(answer);
+              mb_free(substr);
+              mb_free(answer);
               answer = temp;
               if (!answer)
                 {
@@ -3196,19 +3526,34 @@ static int integer(double x)
 
 static void match(int tok)
 {
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+  int entry;
+#endif
+
   if (g_token != tok)
     {
       seterror(ERR_SYNTAX);
       return;
     }
 
-  while (isspace(*g_string))
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+  entry = cachetoken(g_string);
+  if (entry >= 0 && g_tokens[entry].type == g_token)
+    {
+      g_string += g_tokens[entry].skip + g_tokens[entry].len;
+    }
+  else
+#endif
     {
-      g_string++;
+      while (isspace(*g_string))
+        {
+          g_string++;
+        }
+
+      g_string += tokenlen(g_string, g_token);
     }
 
-  g_string += tokenlen(g_string, g_token);
-  g_token = gettoken(g_string);
+  g_token = nexttoken(g_string);
   if (g_token == SYNTAX_ERROR)
     {
       seterror(ERR_SYNTAX);
@@ -3269,6 +3614,30 @@ static int getnextline(FAR const char *str)
   return 0;
 }
 
+/****************************************************************************
+ * Name: nexttoken
+ *
+ * Description:
+ *   Get the token at a place in the script, from the token cache if it is
+ *   enabled
+ *   Params: str - pointer into the script
+ *
+ ****************************************************************************/
+
+static int nexttoken(FAR const char *str)
+{
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+  int entry = cachetoken(str);
+
+  if (entry >= 0)
+    {
+      return g_tokens[entry].type;
+    }
+#endif
+
+  return gettoken(str);
+}
+
 /****************************************************************************
  * Name: gettoken
  *
@@ -4001,7 +4370,7 @@ static FAR char *mystrdup(FAR const char *str)
 {
   FAR char *answer;
 
-  answer = malloc(strlen(str) + 1);
+  answer = mb_malloc(strlen(str) + 1);
   if (answer)
     {
       strcpy(answer, str);
@@ -4027,7 +4396,7 @@ static FAR char *mystrconcat(FAR const char *str, FAR const char *cat)
   FAR char *answer;
 
   len = strlen(str) + strlen(cat);
-  answer = malloc(len + 1);
+  answer = mb_malloc(len + 1);
   if (answer)
     {
       strcpy(answer, str);
@@ -4094,15 +4463,25 @@ int basic(FAR const char *script, FILE * in, FILE * out, FILE * err)
   g_fpout = out;
   g_fperr = err;
 
+#ifdef CONFIG_INTERPRETERS_IHEAP
+  iheap_initialize(&g_heap, "basic", CONFIG_INTERPRETER_MINIBASIC_HEAPQUOTA);
+#endif
+
   if (setup(script) == -1)
     {
+#ifdef CONFIG_INTERPRETERS_IHEAP
+      iheap_uninitialize(&g_heap);
+#endif
       return 1;
     }
 
   while (curline != -1)
     {
       g_string = g_lines[curline].str;
-      g_token = gettoken(g_string);
+#ifdef CONFIG_INTERPRETER_MINIBASIC_TOKENCACHE
+      g_curline = curline;
+#endif
+      g_token = nexttoken(g_string);
       g_errorflag = 0;
 
       nextline = line();
@@ -4140,5 +4519,8 @@ int basic(FAR const char *script, FILE * in, FILE * out, FILE * err)
     }
 
   cleanup();
+#ifdef CONFIG_INTERPRETERS_IHEAP
+  iheap_uninitialize(&g_heap);
+#endif
   return answer;
 }
@@ -95,29 +95,6 @@ static uint8_t prvucMBint8_t2BIN(uint8_t ucCharacter);
 static uint8_t prvucMBBIN2int8_t(uint8_t ucByte);
 static uint8_t prvucMBLRC(uint8_t *pucFrame, uint16_t usLen);
 
-/****************************************************************************
- * Private Data
- ****************************************************************************/
-
-static volatile eMBSndState eSndState;
-static volatile eMBRcvState eRcvState;
-
-/* We reuse the Modbus RTU buffer because only one buffer is needed and the
- * RTU buffer is bigger.
- */
-
-extern volatile uint8_t ucRTUBuf[];
-static volatile uint8_t *ucASCIIBuf = ucRTUBuf;
-
-static volatile uint16_t usRcvBufferPos;
-static volatile eMBBytePos eBytePos;
-
-static volatile uint8_t *pucSndBufferCur;
-static volatile uint16_t usSndBufferCount;
-
-static volatile uint8_t ucLRC;
-static volatile uint8_t ucMBLFCharacter;
-
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -180,11 +157,12 @@ static uint8_t prvucMBLRC(uint8_t * pucFrame, uint16_t usLen)
 eMBErrorCode eMBASCIIInit(uint8_t ucSlaveAddress, uint8_t ucPort,
                           speed_t ulBaudRate, eMBParity eParity)
 {
+  xMBInstance *pxInst = pxMBInstance;
   eMBErrorCode eStatus = MB_ENOERR;
   (void)ucSlaveAddress;
 
   ENTER_CRITICAL_SECTION();
-  ucMBLFCharacter = MB_ASCII_DEFAULT_LF;
+  pxInst->ucMBLFCharacter = MB_ASCII_DEFAULT_LF;
 
   if (xMBPortSerialInit(ucPort, ulBaudRate, 7, eParity) != true)
     {
@@ -201,9 +179,11 @@ eMBErrorCode eMBASCIIInit(uint8_t ucSlaveAddress, uint8_t ucPort,
 
 void eMBASCIIStart(void)
 {
+  xMBInstance *pxInst = pxMBInstance;
+
   ENTER_CRITICAL_SECTION();
   vMBPortSerialEnable(true, false);
-  eRcvState = STATE_RX_IDLE;
+  pxInst->eRcvState = STATE_RX_IDLE;
   EXIT_CRITICAL_SECTION();
 
   /* No special startup required for ASCII. */
@@ -222,31 +202,33 @@ void eMBASCIIStop(void)
 eMBErrorCode eMBASCIIReceive(uint8_t *pucRcvAddress, uint8_t **pucFrame,
                              uint16_t *pusLength)
 {
+  xMBInstance *pxInst = pxMBInstance;
   eMBErrorCode eStatus = MB_ENOERR;
 
   ENTER_CRITICAL_SECTION();
-  ASSERT(usRcvBufferPos < MB_SER_PDU_SIZE_MAX);
+  ASSERT(pxInst->usRcvBufferPos < MB_SER_PDU_SIZE_MAX);
 
   /* Length and CRC check */
 
-  if ((usRcvBufferPos >= MB_SER_PDU_SIZE_MIN) &&
-      (prvucMBLRC((uint8_t *) ucASCIIBuf, usRcvBufferPos) == 0))
+  if ((pxInst->usRcvBufferPos >= MB_SER_PDU_SIZE_MIN) &&
+      (prvucMBLRC((uint8_t *) pxInst->ucSerBuf, pxInst->usRcvBufferPos) == 0))
     {
       /* Save the address field. All frames are passed to the upper layed
        * and the decision if a frame is used is done there.
        */
 
-      *pucRcvAddress = ucASCIIBuf[MB_SER_PDU_ADDR_OFF];
+      *pucRcvAddress = pxInst->ucSerBuf[MB_SER_PDU_ADDR_OFF];
 
       /* Total length of Modbus-PDU is Modbus-Serial-Line-PDU minus
        * size of address field and CRC checksum.
        */
 
-      *pusLength = (uint16_t)(usRcvBufferPos - MB_SER_PDU_PDU_OFF - MB_SER_PDU_SIZE_LRC);
+      *pusLength = (uint16_t)(pxInst->usRcvBufferPos - MB_SER_PDU_PDU_OFF -
+                              MB_SER_PDU_SIZE_LRC);
 
       /* Return the start of the Modbus PDU to the caller. */
 
-      *pucFrame = (uint8_t *) & ucASCIIBuf[MB_SER_PDU_PDU_OFF];
+      *pucFrame = (uint8_t *) & pxInst->ucSerBuf[MB_SER_PDU_PDU_OFF];
     }
   else
     {
@@ -260,6 +242,7 @@ eMBErrorCode eMBASCIIReceive(uint8_t *pucRcvAddress, uint8_t **pucFrame,
 eMBErrorCode eMBASCIISend(uint8_t ucSlaveAddress, const uint8_t *pucFrame,
                           uint16_t usLength)
 {
+  xMBInstance *pxInst = pxMBInstance;
   eMBErrorCode eStatus = MB_ENOERR;
   uint8_t usLRC;
 
@@ -270,26 +253,27 @@ eMBErrorCode eMBASCIISend(uint8_t ucSlaveAddress, const uint8_t *pucFrame,
    * frame on the network. We have to abort sending the frame.
    */
 
-  if (eRcvState == STATE_RX_IDLE)
+  if (pxInst->eRcvState == STATE_RX_IDLE)
     {
       /* First byte before the Modbus-PDU is the slave address. */
 
-      pucSndBufferCur = (uint8_t *) pucFrame - 1;
-      usSndBufferCount = 1;
+      pxInst->pucSndBufferCur = (uint8_t *) pucFrame - 1;
+      pxInst->usSndBufferCount = 1;
 
       /* Now copy the Modbus-PDU into the Modbus-Serial-Line-PDU. */
 
-      pucSndBufferCur[MB_SER_PDU_ADDR_OFF] = ucSlaveAddress;
-      usSndBufferCount += usLength;
+      pxInst->pucSndBufferCur[MB_SER_PDU_ADDR_OFF] = ucSlaveAddress;
+      pxInst->usSndBufferCount += usLength;
 
       /* Calculate LRC checksum for Modbus-Serial-Line-PDU. */
 
-      usLRC = prvucMBLRC((uint8_t *) pucSndBufferCur, usSndBufferCount);
-      ucASCIIBuf[usSndBufferCount++] = usLRC;
+      usLRC = prvucMBLRC((uint8_t *) pxInst->pucSndBufferCur,
+                         pxInst->usSndBufferCount);
+      pxInst->ucSerBuf[pxInst->usSndBufferCount++] = usLRC;
 
       /* Activate the transmitter. */
 
-      eSndState = STATE_TX_START;
+      pxInst->eSndState = STATE_TX_START;
       vMBPortSerialEnable(false, true);
     }
   else
@@ -303,14 +287,15 @@ eMBErrorCode eMBASCIISend(uint8_t ucSlaveAddress, const uint8_t *pucFrame,
 
 bool xMBASCIIReceiveFSM(void)
 {
+  xMBInstance *pxInst = pxMBInstance;
   bool xNeedPoll = false;
   uint8_t ucByte;
   uint8_t ucResult;
 
-  ASSERT(eSndState == STATE_TX_IDLE);
+  ASSERT(pxInst->eSndState == STATE_TX_IDLE);
 
   (void)xMBPortSerialGetByte((int8_t *) & ucByte);
-  switch (eRcvState)
+  switch (pxInst->eRcvState)
     {
     /* A new character is received. If the character is a ':' the input
      * buffer is cleared. A CR-character signals the end of the data
@@ -326,27 +311,28 @@ bool xMBASCIIReceiveFSM(void)
         {
           /* Empty receive buffer. */
 
-          eBytePos = BYTE_HIGH_NIBBLE;
-          usRcvBufferPos = 0;
+          pxInst->eBytePos = BYTE_HIGH_NIBBLE;
+          pxInst->usRcvBufferPos = 0;
         }
       else if (ucByte == MB_ASCII_DEFAULT_CR)
         {
-          eRcvState = STATE_RX_WAIT_EOF;
+          pxInst->eRcvState = STATE_RX_WAIT_EOF;
         }
       else
         {
           ucResult = prvucMBint8_t2BIN(ucByte);
-          switch (eBytePos)
+          switch (pxInst->eBytePos)
           {
           /* High nibble of the byte comes first. We check for
            * a buffer overflow here.
            */
 
           case BYTE_HIGH_NIBBLE:
-            if (usRcvBufferPos < MB_SER_PDU_SIZE_MAX)
+            if (pxInst->usRcvBufferPos < MB_SER_PDU_SIZE_MAX)
               {
-                ucASCIIBuf[usRcvBufferPos] = (uint8_t)(ucResult << 4);
-                eBytePos = BYTE_LOW_NIBBLE;
+                pxInst->ucSerBuf[pxInst->usRcvBufferPos] =
+                  (uint8_t)(ucResult << 4);
+                pxInst->eBytePos = BYTE_LOW_NIBBLE;
                 break;
               }
             else
@@ -355,7 +341,7 @@ bool xMBASCIIReceiveFSM(void)
                  * a resonable implementation.
                  */
 
-                eRcvState = STATE_RX_IDLE;
+                pxInst->eRcvState = STATE_RX_IDLE;
 
                 /* Disable previously activated timer because of error state. */
 
@@ -364,16 +350,16 @@ bool xMBASCIIReceiveFSM(void)
             break;
 
           case BYTE_LOW_NIBBLE:
-            ucASCIIBuf[usRcvBufferPos] |= ucResult;
-            usRcvBufferPos++;
-            eBytePos = BYTE_HIGH_NIBBLE;
+            pxInst->ucSerBuf[pxInst->usRcvBufferPos] |= ucResult;
+            pxInst->usRcvBufferPos++;
+            pxInst->eBytePos = BYTE_HIGH_NIBBLE;
             break;
           }
         }
         break;
 
     case STATE_RX_WAIT_EOF:
-      if (ucByte == ucMBLFCharacter)
+      if (ucByte == pxInst->ucMBLFCharacter)
         {
           /* Disable character timeout timer because all characters are
            * received.
@@ -383,7 +369,7 @@ bool xMBASCIIReceiveFSM(void)
 
            /* Receiver is again in idle state. */
 
-           eRcvState = STATE_RX_IDLE;
+           pxInst->eRcvState = STATE_RX_IDLE;
 
           /* Notify the caller of eMBASCIIReceive that a new frame
            * was received.
@@ -395,9 +381,9 @@ bool xMBASCIIReceiveFSM(void)
         {
           /* Empty receive buffer and back to receive state. */
 
-          eBytePos = BYTE_HIGH_NIBBLE;
-          usRcvBufferPos = 0;
-          eRcvState = STATE_RX_RCV;
+          pxInst->eBytePos = BYTE_HIGH_NIBBLE;
+          pxInst->usRcvBufferPos = 0;
+          pxInst->eRcvState = STATE_RX_RCV;
 
           /* Enable timer for character timeout. */
 
@@ -407,7 +393,7 @@ bool xMBASCIIReceiveFSM(void)
         {
           /* Frame is not okay. Delete entire frame. */
 
-          eRcvState = STATE_RX_IDLE;
+          pxInst->eRcvState = STATE_RX_IDLE;
         }
         break;
 
@@ -420,9 +406,9 @@ bool xMBASCIIReceiveFSM(void)
 
           /* Reset the input buffers to store the frame. */
 
-          usRcvBufferPos = 0;
-          eBytePos = BYTE_HIGH_NIBBLE;
-          eRcvState = STATE_RX_RCV;
+          pxInst->usRcvBufferPos = 0;
+          pxInst->eBytePos = BYTE_HIGH_NIBBLE;
+          pxInst->eRcvState = STATE_RX_RCV;
         }
         break;
     }
@@ -432,11 +418,12 @@ bool xMBASCIIReceiveFSM(void)
 
 bool xMBASCIITransmitFSM(void)
 {
+  xMBInstance *pxInst = pxMBInstance;
   bool xNeedPoll = false;
   uint8_t ucByte;
 
-  ASSERT(eRcvState == STATE_RX_IDLE);
-  switch (eSndState)
+  ASSERT(pxInst->eRcvState == STATE_RX_IDLE);
+  switch (pxInst->eSndState)
   {
   /* Start of transmission. The start of a frame is defined by sending
    * the character ':'.
@@ -445,8 +432,8 @@ bool xMBASCIITransmitFSM(void)
   case STATE_TX_START:
     ucByte = ':';
     xMBPortSerialPutByte((int8_t)ucByte);
-    eSndState = STATE_TX_DATA;
-    eBytePos = BYTE_HIGH_NIBBLE;
+    pxInst->eSndState = STATE_TX_DATA;
+    pxInst->eBytePos = BYTE_HIGH_NIBBLE;
     break;
 
   /* Send the data block. Each data byte is encoded as a character hex
@@ -456,42 +443,42 @@ bool xMBASCIITransmitFSM(void)
    */
 
   case STATE_TX_DATA:
-    if (usSndBufferCount > 0)
+    if (pxInst->usSndBufferCount > 0)
       {
-        switch (eBytePos)
+        switch (pxInst->eBytePos)
         {
         case BYTE_HIGH_NIBBLE:
-          ucByte = prvucMBBIN2int8_t((uint8_t)(*pucSndBufferCur >> 4));
+          ucByte = prvucMBBIN2int8_t((uint8_t)(*pxInst->pucSndBufferCur >> 4));
           xMBPortSerialPutByte((int8_t) ucByte);
-          eBytePos = BYTE_LOW_NIBBLE;
+          pxInst->eBytePos = BYTE_LOW_NIBBLE;
           break;
 
         case BYTE_LOW_NIBBLE:
-          ucByte = prvucMBBIN2int8_t((uint8_t)(*pucSndBufferCur & 0x0F));
+          ucByte = prvucMBBIN2int8_t((uint8_t)(*pxInst->pucSndBufferCur & 0x0F));
           xMBPortSerialPutByte((int8_t)ucByte);
-          pucSndBufferCur++;
-          eBytePos = BYTE_HIGH_NIBBLE;
-          usSndBufferCount--;
+          pxInst->pucSndBufferCur++;
+          pxInst->eBytePos = BYTE_HIGH_NIBBLE;
+          pxInst->usSndBufferCount--;
           break;
         }
       }
     else
       {
         xMBPortSerialPutByte(MB_ASCII_DEFAULT_CR);
-        eSndState = STATE_TX_END;
+        pxInst->eSndState = STATE_TX_END;
       }
     break;
 
     /* Finish the frame by sending a LF character. */
 
     case STATE_TX_END:
-      xMBPortSerialPutByte((int8_t)ucMBLFCharacter);
+      xMBPortSerialPutByte((int8_t)pxInst->ucMBLFCharacter);
 
       /* We need another state to make sure that the CR character has
        * been sent.
        */
 
-      eSndState = STATE_TX_NOTIFY;
+      pxInst->eSndState = STATE_TX_NOTIFY;
       break;
 
     /* Notify the task which called eMBASCIISend that the frame has
@@ -499,7 +486,7 @@ bool xMBASCIITransmitFSM(void)
      */
 
     case STATE_TX_NOTIFY:
-      eSndState = STATE_TX_IDLE;
+      pxInst->eSndState = STATE_TX_IDLE;
       xNeedPoll = xMBPortEventPost(EV_FRAME_SENT);
 
       /* Disable transmitter. This prevents another transmit buffer
@@ -507,7 +494,7 @@ bool xMBASCIITransmitFSM(void)
        */
 
       vMBPortSerialEnable(true, false);
-      eSndState = STATE_TX_IDLE;
+      pxInst->eSndState = STATE_TX_IDLE;
       break;
 
     /* We should not get a transmitter event if the transmitter is in
@@ -526,18 +513,21 @@ bool xMBASCIITransmitFSM(void)
 
 bool xMBASCIITimerT1SExpired(void)
 {
-  switch (eRcvState)
+  xMBInstance *pxInst = pxMBInstance;
+
+  switch (pxInst->eRcvState)
   {
   /* If we have a timeout we go back to the idle state and wait for
    * the next frame.
    */
   case STATE_RX_RCV:
   case STATE_RX_WAIT_EOF:
-    eRcvState = STATE_RX_IDLE;
+    pxInst->eRcvState = STATE_RX_IDLE;
     break;
 
   default:
-    ASSERT((eRcvState == STATE_RX_RCV) || (eRcvState == STATE_RX_WAIT_EOF));
+    ASSERT((pxInst->eRcvState == STATE_RX_RCV) ||
+           (pxInst->eRcvState == STATE_RX_WAIT_EOF));
     break;
   }
 
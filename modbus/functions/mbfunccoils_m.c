@@ -182,11 +182,24 @@ eMBException eMBMasterFuncReadCoils(uint8_t *pucFrame, uint16_t *usLen)
       if ((usCoilCount >= 1) &&
           (ucByteCount == pucFrame[MB_PDU_FUNC_READ_COILCNT_OFF]))
         {
-          /* Make callback to fill the buffer. */
+          /* Make callback to fill the buffer, or store the values in the
+           * cache of a running scan list.
+           */
 
-          eRegStatus =
-            eMBMasterRegCoilsCB(&pucFrame[MB_PDU_FUNC_READ_VALUES_OFF],
-                                usRegAddress, usCoilCount, MB_REG_READ);
+#ifdef CONFIG_MB_MASTER_SCAN
+          if (xMBMasterScanActive())
+            {
+              eRegStatus =
+                eMBMasterScanStore(&pucFrame[MB_PDU_FUNC_READ_VALUES_OFF],
+                                   usRegAddress, usCoilCount);
+            }
+          else
+#endif
+            {
+              eRegStatus =
+                eMBMasterRegCoilsCB(&pucFrame[MB_PDU_FUNC_READ_VALUES_OFF],
+                                    usRegAddress, usCoilCount, MB_REG_READ);
+            }
 
           /* If an error occurred convert it into a Modbus exception. */
 
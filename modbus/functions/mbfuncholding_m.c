@@ -382,11 +382,24 @@ eMBException eMBMasterFuncReadHoldingRegister(uint8_t *pucFrame,
       if ((usRegCount >= 1) &&
           (2 * usRegCount == pucFrame[MB_PDU_FUNC_READ_BYTECNT_OFF]))
         {
-          /* Make callback to fill the buffer. */
+          /* Make callback to fill the buffer, or store the values in the
+           * cache of a running scan list.
+           */
 
-          eRegStatus =
-            eMBMasterRegHoldingCB(&pucFrame[MB_PDU_FUNC_READ_VALUES_OFF],
-                                  usRegAddress, usRegCount, MB_REG_READ);
+#ifdef CONFIG_MB_MASTER_SCAN
+          if (xMBMasterScanActive())
+            {
+              eRegStatus =
+                eMBMasterScanStore(&pucFrame[MB_PDU_FUNC_READ_VALUES_OFF],
+                                   usRegAddress, usRegCount);
+            }
+          else
+#endif
+            {
+              eRegStatus =
+                eMBMasterRegHoldingCB(&pucFrame[MB_PDU_FUNC_READ_VALUES_OFF],
+                                      usRegAddress, usRegCount, MB_REG_READ);
+            }
 
           /* If an error occurred convert it into a Modbus exception. */
 
@@ -153,11 +153,24 @@ eMBException eMBMasterFuncReadInputRegister(uint8_t *pucFrame,
       if ((usRegCount >= 1) &&
           (2 * usRegCount == pucFrame[MB_PDU_FUNC_READ_BYTECNT_OFF]))
         {
-          /* Make callback to fill the buffer. */
+          /* Make callback to fill the buffer, or store the values in the
+           * cache of a running scan list.
+           */
 
-          eRegStatus =
-            eMBMasterRegInputCB(&pucFrame[MB_PDU_FUNC_READ_VALUES_OFF],
-                                usRegAddress, usRegCount);
+#ifdef CONFIG_MB_MASTER_SCAN
+          if (xMBMasterScanActive())
+            {
+              eRegStatus =
+                eMBMasterScanStore(&pucFrame[MB_PDU_FUNC_READ_VALUES_OFF],
+                                   usRegAddress, usRegCount);
+            }
+          else
+#endif
+            {
+              eRegStatus =
+                eMBMasterRegInputCB(&pucFrame[MB_PDU_FUNC_READ_VALUES_OFF],
+                                    usRegAddress, usRegCount);
+            }
 
           /* If an error occurred convert it into a Modbus exception. */
 
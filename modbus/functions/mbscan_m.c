@@ -0,0 +1,366 @@
+/****************************************************************************
+ * apps/modbus/functions/mbscan_m.c
+ * FreeModBus Library: Modbus Master scan lists
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "port.h"
+
+#include "modbus/mb.h"
+#include "modbus/mb_m.h"
+#include "modbus/mbframe.h"
+#include "modbus/mbproto.h"
+
+#ifdef CONFIG_MB_MASTER_SCAN
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define MB_SCAN_REGCNT_MAX      (0x007D)   /* Read holding/input registers */
+#define MB_SCAN_COILCNT_MAX     (0x07D0)   /* Read coils */
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define MB_SCAN_CLOCK CLOCK_MONOTONIC
+#else
+#  define MB_SCAN_CLOCK CLOCK_REALTIME
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The scan and block whose request is outstanding.  Set by the thread
+ * running the scan and used by the poll thread to store the response.
+ */
+
+static xMBMasterScan *volatile pxScanCur;
+static xMBMasterScanBlock *volatile pxBlockCur;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static int prviMBMasterScanCompare(const void *pvA, const void *pvB)
+{
+  const xMBMasterScanItem *pxA = pvA;
+  const xMBMasterScanItem *pxB = pvB;
+
+  if (pxA->ucSlave != pxB->ucSlave)
+    {
+      return (int)pxA->ucSlave - (int)pxB->ucSlave;
+    }
+
+  if (pxA->ucFunc != pxB->ucFunc)
+    {
+      return (int)pxA->ucFunc - (int)pxB->ucFunc;
+    }
+
+  return (int)pxA->usAddr - (int)pxB->usAddr;
+}
+
+static uint16_t prvusMBMasterScanLimit(uint8_t ucFunc)
+{
+  switch (ucFunc)
+    {
+#ifdef CONFIG_MB_MASTER_FUNC_READ_HOLDING_ENABLED
+      case MB_FUNC_READ_HOLDING_REGISTER:
+#endif
+#ifdef CONFIG_MB_MASTER_FUNC_READ_INPUT_ENABLED
+      case MB_FUNC_READ_INPUT_REGISTER:
+#endif
+        return MB_SCAN_REGCNT_MAX;
+
+#ifdef CONFIG_MB_MASTER_FUNC_READ_COILS_ENABLED
+      case MB_FUNC_READ_COILS:
+        return MB_SCAN_COILCNT_MAX;
+#endif
+
+      default:
+        return 0;
+    }
+}
+
+static eMBMasterReqErrCode prveMBMasterScanRequest(xMBMasterScanBlock *pxBlock,
+                                                   uint32_t lTimeOut)
+{
+  switch (pxBlock->ucFunc)
+    {
+#ifdef CONFIG_MB_MASTER_FUNC_READ_HOLDING_ENABLED
+      case MB_FUNC_READ_HOLDING_REGISTER:
+        return eMBMasterReqReadHoldingRegister(pxBlock->ucSlave,
+                                               pxBlock->usAddr,
+                                               pxBlock->usCount, lTimeOut);
+#endif
+#ifdef CONFIG_MB_MASTER_FUNC_READ_INPUT_ENABLED
+      case MB_FUNC_READ_INPUT_REGISTER:
+        return eMBMasterReqReadInputRegister(pxBlock->ucSlave,
+                                             pxBlock->usAddr,
+                                             pxBlock->usCount, lTimeOut);
+#endif
+#ifdef CONFIG_MB_MASTER_FUNC_READ_COILS_ENABLED
+      case MB_FUNC_READ_COILS:
+        return eMBMasterReqReadCoils(pxBlock->ucSlave, pxBlock->usAddr,
+                                     pxBlock->usCount, lTimeOut);
+#endif
+
+      default:
+        return MB_MRE_ILL_ARG;
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+eMBMasterReqErrCode eMBMasterScanBuild(xMBMasterScan *pxScan,
+                                       xMBMasterScanItem *pxItems,
+                                       uint16_t usNItems)
+{
+  xMBMasterScanBlock *pxBlock = NULL;
+  xMBMasterScanItem *pxItem;
+  uint32_t ulCache = 0;
+  uint32_t ulEnd;
+  uint16_t usLimit;
+  int i;
+
+  pxScan->usNBlocks = 0;
+  (void)pthread_mutex_init(&pxScan->xLock, NULL);
+
+  for (i = 0; i < usNItems; i++)
+    {
+      pxItem = &pxItems[i];
+      if (pxItem->ucSlave == 0 ||
+          pxItem->ucSlave > CONFIG_MB_MASTER_TOTAL_SLAVE_NUM ||
+          pxItem->usCount == 0 ||
+          pxItem->usCount > prvusMBMasterScanLimit(pxItem->ucFunc) ||
+          (uint32_t)pxItem->usAddr + pxItem->usCount > 0x10000)
+        {
+          return MB_MRE_ILL_ARG;
+        }
+    }
+
+  qsort(pxItems, usNItems, sizeof(xMBMasterScanItem),
+        prviMBMasterScanCompare);
+
+  for (i = 0; i < usNItems; i++)
+    {
+      pxItem  = &pxItems[i];
+      usLimit = prvusMBMasterScanLimit(pxItem->ucFunc);
+      ulEnd   = (uint32_t)pxItem->usAddr + pxItem->usCount;
+
+      /* Extend the current block if the item is close enough and the
+       * request stays within the limit of the function code.
+       */
+
+      if (pxBlock != NULL &&
+          pxBlock->ucSlave == pxItem->ucSlave &&
+          pxBlock->ucFunc == pxItem->ucFunc &&
+          pxItem->usAddr <= (uint32_t)pxBlock->usAddr + pxBlock->usCount +
+                            pxScan->usMaxGap &&
+          ulEnd - pxBlock->usAddr <= usLimit)
+        {
+          if (ulEnd > (uint32_t)pxBlock->usAddr + pxBlock->usCount)
+            {
+              ulCache += ulEnd - pxBlock->usAddr - pxBlock->usCount;
+              pxBlock->usCount = ulEnd - pxBlock->usAddr;
+            }
+        }
+      else
+        {
+          if (pxScan->usNBlocks >= pxScan->usMaxBlocks)
+            {
+              return MB_MRE_ILL_ARG;
+            }
+
+          pxBlock = &pxScan->pxBlocks[pxScan->usNBlocks++];
+          pxBlock->ucSlave        = pxItem->ucSlave;
+          pxBlock->ucFunc         = pxItem->ucFunc;
+          pxBlock->usAddr         = pxItem->usAddr;
+          pxBlock->usCount        = pxItem->usCount;
+          pxBlock->usCache        = ulCache;
+          pxBlock->eStatus        = MB_MRE_TIMEDOUT;
+          pxBlock->xStamp.tv_sec  = 0;
+          pxBlock->xStamp.tv_nsec = 0;
+          ulCache += pxItem->usCount;
+        }
+
+      if (ulCache > pxScan->usCacheSize)
+        {
+          return MB_MRE_ILL_ARG;
+        }
+
+      pxItem->usCache = pxBlock->usCache + (pxItem->usAddr - pxBlock->usAddr);
+    }
+
+  memset(pxScan->pusCache, 0, ulCache * sizeof(uint16_t));
+  return MB_MRE_NO_ERR;
+}
+
+eMBMasterReqErrCode eMBMasterScanRun(xMBMasterScan *pxScan,
+                                     uint32_t lTimeOut)
+{
+  eMBMasterReqErrCode eFirstErr = MB_MRE_NO_ERR;
+  eMBMasterReqErrCode eErrStatus;
+  xMBMasterScanBlock *pxBlock;
+  int i;
+
+  /* The blocks are ordered by slave, so consecutive requests go to the
+   * same slave as long as possible.
+   */
+
+  for (i = 0; i < pxScan->usNBlocks; i++)
+    {
+      pxBlock    = &pxScan->pxBlocks[i];
+      pxScanCur  = pxScan;
+      pxBlockCur = pxBlock;
+
+      eErrStatus = prveMBMasterScanRequest(pxBlock, lTimeOut);
+
+      pxBlockCur = NULL;
+      pxScanCur  = NULL;
+
+      (void)pthread_mutex_lock(&pxScan->xLock);
+      pxBlock->eStatus = eErrStatus;
+      (void)pthread_mutex_unlock(&pxScan->xLock);
+
+      if (eErrStatus != MB_MRE_NO_ERR && eFirstErr == MB_MRE_NO_ERR)
+        {
+          eFirstErr = eErrStatus;
+        }
+    }
+
+  return eFirstErr;
+}
+
+eMBMasterReqErrCode eMBMasterScanGet(xMBMasterScan *pxScan,
+                                     const xMBMasterScanItem *pxItem,
+                                     uint16_t *pusValues,
+                                     struct timespec *pxStamp)
+{
+  eMBMasterReqErrCode eErrStatus = MB_MRE_ILL_ARG;
+  xMBMasterScanBlock *pxBlock;
+  int i;
+
+  (void)pthread_mutex_lock(&pxScan->xLock);
+  for (i = 0; i < pxScan->usNBlocks; i++)
+    {
+      pxBlock = &pxScan->pxBlocks[i];
+      if (pxItem->usCache >= pxBlock->usCache &&
+          pxItem->usCache + pxItem->usCount <=
+          pxBlock->usCache + pxBlock->usCount)
+        {
+          if (pxBlock->xStamp.tv_sec == 0 && pxBlock->xStamp.tv_nsec == 0)
+            {
+              /* Never read successfully */
+
+              eErrStatus = pxBlock->eStatus;
+            }
+          else
+            {
+              memcpy(pusValues, &pxScan->pusCache[pxItem->usCache],
+                     pxItem->usCount * sizeof(uint16_t));
+              if (pxStamp != NULL)
+                {
+                  *pxStamp = pxBlock->xStamp;
+                }
+
+              eErrStatus = MB_MRE_NO_ERR;
+            }
+
+          break;
+        }
+    }
+
+  (void)pthread_mutex_unlock(&pxScan->xLock);
+  return eErrStatus;
+}
+
+bool xMBMasterScanActive(void)
+{
+  return pxBlockCur != NULL;
+}
+
+eMBErrorCode eMBMasterScanStore(uint8_t *pucValues, uint16_t usAddress,
+                                uint16_t usCount)
+{
+  xMBMasterScan *pxScan = pxScanCur;
+  xMBMasterScanBlock *pxBlock = pxBlockCur;
+  uint16_t *pusCache;
+  int i;
+
+  /* The handlers pass the address of the first value plus one */
+
+  if (pxScan == NULL || pxBlock == NULL ||
+      (uint16_t)(usAddress - 1) != pxBlock->usAddr ||
+      usCount != pxBlock->usCount)
+    {
+      return MB_ENOREG;
+    }
+
+  pusCache = &pxScan->pusCache[pxBlock->usCache];
+
+  (void)pthread_mutex_lock(&pxScan->xLock);
+  if (pxBlock->ucFunc == MB_FUNC_READ_COILS)
+    {
+      for (i = 0; i < usCount; i++)
+        {
+          pusCache[i] = (pucValues[i >> 3] >> (i & 7)) & 1;
+        }
+    }
+  else
+    {
+      for (i = 0; i < usCount; i++)
+        {
+          pusCache[i] = (uint16_t)(pucValues[2 * i] << 8) |
+                        pucValues[2 * i + 1];
+        }
+    }
+
+  (void)clock_gettime(MB_SCAN_CLOCK, &pxBlock->xStamp);
+  (void)pthread_mutex_unlock(&pxScan->xLock);
+  return MB_ENOERR;
+}
+
+#endif /* CONFIG_MB_MASTER_SCAN */
@@ -45,6 +45,7 @@
 #include "modbus/mbfunc.h"
 
 #include "modbus/mbport.h"
+#include "system/perfcount.h"
 
 #ifdef CONFIG_MB_RTU_ENABLED
 #  include "mbrtu.h"
@@ -59,40 +60,40 @@
 #endif
 
 /****************************************************************************
- * Private Data
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* How long eMBPoll() waits for input on the built-in instance.
+ * eMBPollCtx() never waits; its caller waits in poll() instead.
+ */
+
+#define MB_POLL_WAIT_US 50000
+
+/****************************************************************************
+ * Private Types
  ****************************************************************************/
 
-static uint8_t  ucMBAddress;
-static eMBMode  eMBCurrentMode;
+/* Values of xMBInstance::eMBState.  A zeroed instance is not initialized. */
 
-static enum
+enum
 {
+  STATE_NOT_INITIALIZED,
   STATE_ENABLED,
-  STATE_DISABLED,
-  STATE_NOT_INITIALIZED
-} eMBState = STATE_NOT_INITIALIZED;
-
-/* Functions pointer which are initialized in eMBInit(). Depending on the
- * mode (RTU or ASCII) the are set to the correct implementations.
- */
+  STATE_DISABLED
+};
 
-static peMBFrameSend peMBFrameSendCur;
-static pvMBFrameStart pvMBFrameStartCur;
-static pvMBFrameStop pvMBFrameStopCur;
-static peMBFrameReceive peMBFrameReceiveCur;
-static pvMBFrameClose pvMBFrameCloseCur;
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
 
-/* Callback functions required by the porting layer. They are called when
- * an external event has happened which includes a timeout or the reception
- * or transmission of a character.
+/* The instance used by eMBInit(), eMBPoll() and the other functions
+ * without a Ctx suffix.
  */
 
-bool(*pxMBFrameCBByteReceived)(void);
-bool(*pxMBFrameCBTransmitterEmpty)(void);
-bool(*pxMBPortCBTimerExpired)(void);
-
-bool(*pxMBFrameCBReceiveFSMCur)(void);
-bool(*pxMBFrameCBTransmitFSMCur)(void);
+static xMBInstance xMBDefaultInstance =
+{
+  .iSerialFd = -1
+};
 
 /* An array of Modbus functions handlers which associates Modbus function
  * codes with implementing functions.
@@ -132,15 +133,50 @@ static xMBFunctionHandler xFuncHandlers[CONFIG_MB_FUNC_HANDLERS_MAX] =
 #endif
 };
 
+/* Counters in the performance counter registry, shared by all instances */
+
+PERF_COUNTER(g_perf_frames, "modbus.frames");
+PERF_COUNTER(g_perf_badframes, "modbus.badframes");
+PERF_COUNTER(g_perf_requests, "modbus.requests");
+PERF_COUNTER(g_perf_exceptions, "modbus.exceptions");
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* The instance being serviced.  The mode functions pointed to by the
+ * instance and the port layer keep their state in it.
+ */
+
+xMBInstance *pxMBInstance = &xMBDefaultInstance;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void vMBPerfRegister(void)
+{
+  PERF_REGISTER(g_perf_frames);
+  PERF_REGISTER(g_perf_badframes);
+  PERF_REGISTER(g_perf_requests);
+  PERF_REGISTER(g_perf_exceptions);
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
-eMBErrorCode eMBInit(eMBMode eMode, uint8_t ucSlaveAddress, uint8_t ucPort,
-                     speed_t ulBaudRate, eMBParity eParity)
+eMBErrorCode eMBInitCtx(xMBInstance *pxInst, eMBMode eMode,
+                        uint8_t ucSlaveAddress, uint8_t ucPort,
+                        speed_t ulBaudRate, eMBParity eParity)
 {
   eMBErrorCode eStatus = MB_ENOERR;
 
+  memset(pxInst, 0, sizeof(xMBInstance));
+  pxInst->iSerialFd = -1;
+  pxMBInstance = pxInst;
+  vMBPerfRegister();
+
   /* check preconditions */
 
   if ((ucSlaveAddress == MB_ADDRESS_BROADCAST) ||
@@ -150,36 +186,39 @@ eMBErrorCode eMBInit(eMBMode eMode, uint8_t ucSlaveAddress, uint8_t ucPort,
     }
   else
     {
-      ucMBAddress = ucSlaveAddress;
+      pxInst->ucMBAddress = ucSlaveAddress;
 
       switch (eMode)
         {
 #ifdef CONFIG_MB_RTU_ENABLED
         case MB_RTU:
-          pvMBFrameStartCur = eMBRTUStart;
-          pvMBFrameStopCur = eMBRTUStop;
-          peMBFrameSendCur = eMBRTUSend;
-          peMBFrameReceiveCur = eMBRTUReceive;
-          pvMBFrameCloseCur = vMBPortClose;
-          pxMBFrameCBByteReceived = xMBRTUReceiveFSM;
-          pxMBFrameCBTransmitterEmpty = xMBRTUTransmitFSM;
-          pxMBPortCBTimerExpired = xMBRTUTimerT35Expired;
-
-          eStatus = eMBRTUInit(ucMBAddress, ucPort, ulBaudRate, eParity);
+          pxInst->pvMBFrameStartCur = eMBRTUStart;
+          pxInst->pvMBFrameStopCur = eMBRTUStop;
+          pxInst->peMBFrameSendCur = eMBRTUSend;
+          pxInst->peMBFrameReceiveCur = eMBRTUReceive;
+          pxInst->pvMBFrameCloseCur = vMBPortClose;
+          pxInst->pxMBFrameCBByteReceived = xMBRTUReceiveFSM;
+          pxInst->pxMBFrameCBBlockReceived = xMBRTUReceiveBlock;
+          pxInst->pxMBFrameCBTransmitterEmpty = xMBRTUTransmitFSM;
+          pxInst->pxMBPortCBTimerExpired = xMBRTUTimerT35Expired;
+
+          eStatus = eMBRTUInit(pxInst->ucMBAddress, ucPort, ulBaudRate,
+                               eParity);
           break;
 #endif
 #ifdef CONFIG_MB_ASCII_ENABLED
         case MB_ASCII:
-          pvMBFrameStartCur = eMBASCIIStart;
-          pvMBFrameStopCur = eMBASCIIStop;
-          peMBFrameSendCur = eMBASCIISend;
-          peMBFrameReceiveCur = eMBASCIIReceive;
-          pvMBFrameCloseCur = vMBPortClose;
-          pxMBFrameCBByteReceived = xMBASCIIReceiveFSM;
-          pxMBFrameCBTransmitterEmpty = xMBASCIITransmitFSM;
-          pxMBPortCBTimerExpired = xMBASCIITimerT1SExpired;
-
-          eStatus = eMBASCIIInit(ucMBAddress, ucPort, ulBaudRate, eParity);
+          pxInst->pvMBFrameStartCur = eMBASCIIStart;
+          pxInst->pvMBFrameStopCur = eMBASCIIStop;
+          pxInst->peMBFrameSendCur = eMBASCIISend;
+          pxInst->peMBFrameReceiveCur = eMBASCIIReceive;
+          pxInst->pvMBFrameCloseCur = vMBPortClose;
+          pxInst->pxMBFrameCBByteReceived = xMBASCIIReceiveFSM;
+          pxInst->pxMBFrameCBTransmitterEmpty = xMBASCIITransmitFSM;
+          pxInst->pxMBPortCBTimerExpired = xMBASCIITimerT1SExpired;
+
+          eStatus = eMBASCIIInit(pxInst->ucMBAddress, ucPort, ulBaudRate,
+                                 eParity);
           break;
 #endif
         default:
@@ -196,8 +235,8 @@ eMBErrorCode eMBInit(eMBMode eMode, uint8_t ucSlaveAddress, uint8_t ucPort,
             }
           else
             {
-              eMBCurrentMode = eMode;
-              eMBState = STATE_DISABLED;
+              pxInst->eMBCurrentMode = eMode;
+              pxInst->eMBState = STATE_DISABLED;
             }
         }
     }
@@ -208,11 +247,16 @@ eMBErrorCode eMBInit(eMBMode eMode, uint8_t ucSlaveAddress, uint8_t ucPort,
 #ifdef CONFIG_MB_TCP_ENABLED
 eMBErrorCode eMBTCPInit(uint16_t ucTCPPort)
 {
+  xMBInstance *pxInst = &xMBDefaultInstance;
   eMBErrorCode eStatus = MB_ENOERR;
 
+  pxMBInstance = pxInst;
+  pxInst->ulPollWaitUs = MB_POLL_WAIT_US;
+  vMBPerfRegister();
+
   if ((eStatus = eMBTCPDoInit(ucTCPPort)) != MB_ENOERR)
     {
-      eMBState = STATE_DISABLED;
+      pxInst->eMBState = STATE_DISABLED;
     }
   else if (!xMBPortEventInit())
     {
@@ -222,18 +266,18 @@ eMBErrorCode eMBTCPInit(uint16_t ucTCPPort)
     }
   else
     {
-      pvMBFrameStartCur = eMBTCPStart;
-      pvMBFrameStopCur = eMBTCPStop;
-      peMBFrameReceiveCur = eMBTCPReceive;
-      peMBFrameSendCur = eMBTCPSend;
+      pxInst->pvMBFrameStartCur = eMBTCPStart;
+      pxInst->pvMBFrameStopCur = eMBTCPStop;
+      pxInst->peMBFrameReceiveCur = eMBTCPReceive;
+      pxInst->peMBFrameSendCur = eMBTCPSend;
 #ifdef CONFIG_MB_HAVE_CLOSE
-      pvMBFrameCloseCur = vMBTCPPortClose;
+      pxInst->pvMBFrameCloseCur = vMBTCPPortClose;
 #else
-      pvMBFrameCloseCur = NULL;
+      pxInst->pvMBFrameCloseCur = NULL;
 #endif
-      ucMBAddress = MB_TCP_PSEUDO_ADDRESS;
-      eMBCurrentMode = MB_TCP;
-      eMBState = STATE_DISABLED;
+      pxInst->ucMBAddress = MB_TCP_PSEUDO_ADDRESS;
+      pxInst->eMBCurrentMode = MB_TCP;
+      pxInst->eMBState = STATE_DISABLED;
     }
 
   return eStatus;
@@ -289,15 +333,16 @@ eMBErrorCode eMBRegisterCB(uint8_t ucFunctionCode, pxMBFunctionHandler pxHandler
   return eStatus;
 }
 
-eMBErrorCode eMBClose(void)
+eMBErrorCode eMBCloseCtx(xMBInstance *pxInst)
 {
   eMBErrorCode eStatus = MB_ENOERR;
 
-  if (eMBState == STATE_DISABLED)
+  pxMBInstance = pxInst;
+  if (pxInst->eMBState == STATE_DISABLED)
     {
-      if (pvMBFrameCloseCur != NULL)
+      if (pxInst->pvMBFrameCloseCur != NULL)
         {
-          pvMBFrameCloseCur();
+          pxInst->pvMBFrameCloseCur();
         }
     }
   else
@@ -308,16 +353,17 @@ eMBErrorCode eMBClose(void)
   return eStatus;
 }
 
-eMBErrorCode eMBEnable(void)
+eMBErrorCode eMBEnableCtx(xMBInstance *pxInst)
 {
   eMBErrorCode eStatus = MB_ENOERR;
 
-  if (eMBState == STATE_DISABLED)
+  pxMBInstance = pxInst;
+  if (pxInst->eMBState == STATE_DISABLED)
     {
       /* Activate the protocol stack. */
 
-      pvMBFrameStartCur();
-      eMBState = STATE_ENABLED;
+      pxInst->pvMBFrameStartCur();
+      pxInst->eMBState = STATE_ENABLED;
     }
   else
     {
@@ -327,17 +373,18 @@ eMBErrorCode eMBEnable(void)
   return eStatus;
 }
 
-eMBErrorCode eMBDisable(void)
+eMBErrorCode eMBDisableCtx(xMBInstance *pxInst)
 {
   eMBErrorCode  eStatus;
 
-  if (eMBState == STATE_ENABLED)
+  pxMBInstance = pxInst;
+  if (pxInst->eMBState == STATE_ENABLED)
     {
-      pvMBFrameStopCur();
-      eMBState = STATE_DISABLED;
+      pxInst->pvMBFrameStopCur();
+      pxInst->eMBState = STATE_DISABLED;
       eStatus = MB_ENOERR;
     }
-  else if (eMBState == STATE_DISABLED)
+  else if (pxInst->eMBState == STATE_DISABLED)
     {
       eStatus = MB_ENOERR;
     }
@@ -349,21 +396,17 @@ eMBErrorCode eMBDisable(void)
   return eStatus;
 }
 
-eMBErrorCode eMBPoll(void)
+eMBErrorCode eMBPollCtx(xMBInstance *pxInst)
 {
-  static uint8_t     *ucMBFrame;
-  static uint8_t      ucRcvAddress;
-  static uint8_t      ucFunctionCode;
-  static uint16_t     usLength;
-  static eMBException eException;
-
   int             i;
   eMBErrorCode    eStatus = MB_ENOERR;
   eMBEventType    eEvent;
 
+  pxMBInstance = pxInst;
+
   /* Check if the protocol stack is ready. */
 
-  if (eMBState != STATE_ENABLED)
+  if (pxInst->eMBState != STATE_ENABLED)
     {
       return MB_EILLSTATE;
     }
@@ -380,12 +423,21 @@ eMBErrorCode eMBPoll(void)
           break;
 
         case EV_FRAME_RECEIVED:
-          eStatus = peMBFrameReceiveCur(&ucRcvAddress, &ucMBFrame, &usLength);
-          if (eStatus == MB_ENOERR)
+          eStatus = pxInst->peMBFrameReceiveCur(&pxInst->ucRcvAddress,
+                                                &pxInst->ucMBFrame,
+                                                &pxInst->usLength);
+          if (eStatus != MB_ENOERR)
             {
+              PERF_INC(g_perf_badframes);
+            }
+          else
+            {
+              PERF_INC(g_perf_frames);
+
               /* Check if the frame is for us. If not ignore the frame. */
 
-              if ((ucRcvAddress == ucMBAddress) || (ucRcvAddress == MB_ADDRESS_BROADCAST))
+              if ((pxInst->ucRcvAddress == pxInst->ucMBAddress) ||
+                  (pxInst->ucRcvAddress == MB_ADDRESS_BROADCAST))
                 {
                   (void)xMBPortEventPost(EV_EXECUTE);
                 }
@@ -393,8 +445,9 @@ eMBErrorCode eMBPoll(void)
             break;
 
         case EV_EXECUTE:
-          ucFunctionCode = ucMBFrame[MB_PDU_FUNC_OFF];
-          eException = MB_EX_ILLEGAL_FUNCTION;
+          PERF_INC(g_perf_requests);
+          pxInst->ucFunctionCode = pxInst->ucMBFrame[MB_PDU_FUNC_OFF];
+          pxInst->eException = MB_EX_ILLEGAL_FUNCTION;
           for( i = 0; i < CONFIG_MB_FUNC_HANDLERS_MAX; i++)
             {
               /* No more function handlers registered. Abort. */
@@ -403,9 +456,12 @@ eMBErrorCode eMBPoll(void)
                 {
                   break;
                 }
-              else if (xFuncHandlers[i].ucFunctionCode == ucFunctionCode)
+              else if (xFuncHandlers[i].ucFunctionCode ==
+                       pxInst->ucFunctionCode)
                 {
-                  eException = xFuncHandlers[i].pxHandler(ucMBFrame, &usLength);
+                  pxInst->eException =
+                    xFuncHandlers[i].pxHandler(pxInst->ucMBFrame,
+                                               &pxInst->usLength);
                   break;
                 }
             }
@@ -414,24 +470,29 @@ eMBErrorCode eMBPoll(void)
            * return a reply.
            */
 
-          if (ucRcvAddress != MB_ADDRESS_BROADCAST)
+          if (pxInst->ucRcvAddress != MB_ADDRESS_BROADCAST)
             {
-              if (eException != MB_EX_NONE)
+              if (pxInst->eException != MB_EX_NONE)
                 {
                   /* An exception occured. Build an error frame. */
 
-                  usLength = 0;
-                  ucMBFrame[usLength++] = (uint8_t)(ucFunctionCode | MB_FUNC_ERROR);
-                  ucMBFrame[usLength++] = eException;
+                  PERF_INC(g_perf_exceptions);
+                  pxInst->usLength = 0;
+                  pxInst->ucMBFrame[pxInst->usLength++] =
+                    (uint8_t)(pxInst->ucFunctionCode | MB_FUNC_ERROR);
+                  pxInst->ucMBFrame[pxInst->usLength++] = pxInst->eException;
                 }
 
 #ifdef CONFIG_MB_ASCII_ENABLED
-              if ((eMBCurrentMode == MB_ASCII) && CONFIG_MB_ASCII_TIMEOUT_WAIT_BEFORE_SEND_MS)
+              if ((pxInst->eMBCurrentMode == MB_ASCII) &&
+                  CONFIG_MB_ASCII_TIMEOUT_WAIT_BEFORE_SEND_MS)
                 {
                   vMBPortTimersDelay(CONFIG_MB_ASCII_TIMEOUT_WAIT_BEFORE_SEND_MS);
                 }
 #endif
-              (void)peMBFrameSendCur(ucMBAddress, ucMBFrame, usLength);
+              (void)pxInst->peMBFrameSendCur(pxInst->ucMBAddress,
+                                             pxInst->ucMBFrame,
+                                             pxInst->usLength);
             }
             break;
 
@@ -442,3 +503,44 @@ eMBErrorCode eMBPoll(void)
 
   return MB_ENOERR;
 }
+
+eMBErrorCode eMBInit(eMBMode eMode, uint8_t ucSlaveAddress, uint8_t ucPort,
+                     speed_t ulBaudRate, eMBParity eParity)
+{
+  eMBErrorCode eStatus;
+
+  eStatus = eMBInitCtx(&xMBDefaultInstance, eMode, ucSlaveAddress, ucPort,
+                       ulBaudRate, eParity);
+  xMBDefaultInstance.ulPollWaitUs = MB_POLL_WAIT_US;
+  return eStatus;
+}
+
+eMBErrorCode eMBClose(void)
+{
+  return eMBCloseCtx(&xMBDefaultInstance);
+}
+
+eMBErrorCode eMBEnable(void)
+{
+  return eMBEnableCtx(&xMBDefaultInstance);
+}
+
+eMBErrorCode eMBDisable(void)
+{
+  return eMBDisableCtx(&xMBDefaultInstance);
+}
+
+eMBErrorCode eMBPoll(void)
+{
+  return eMBPollCtx(&xMBDefaultInstance);
+}
+
+int iMBGetFdCtx(xMBInstance *pxInst)
+{
+  return pxInst->iSerialFd;
+}
+
+xMBInstance *pxMBGetCurrentCtx(void)
+{
+  return pxMBInstance;
+}
@@ -38,40 +38,46 @@
 
 #include "port.h"
 
-/****************************************************************************
- * Private Data
- ****************************************************************************/
-
-static eMBEventType eQueuedEvent;
-static bool xEventInQueue;
-
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
 bool xMBPortEventInit(void)
 {
-  xEventInQueue = false;
+  xMBInstance *pxInst = pxMBInstance;
+
+  pxInst->xEventInQueue = false;
   return true;
 }
 
 bool xMBPortEventPost(eMBEventType eEvent)
 {
-  xEventInQueue = true;
-  eQueuedEvent = eEvent;
+  xMBInstance *pxInst = pxMBInstance;
+
+  pxInst->xEventInQueue = true;
+  pxInst->eQueuedEvent = eEvent;
   return true;
 }
 
 bool xMBPortEventGet(eMBEventType * eEvent)
 {
+  xMBInstance *pxInst = pxMBInstance;
   bool xEventHappened = false;
 
-  if (xEventInQueue)
+  if (pxInst->xEventInQueue)
     {
-      *eEvent = eQueuedEvent;
-      xEventInQueue = false;
+      *eEvent = pxInst->eQueuedEvent;
+      pxInst->xEventInQueue = false;
       xEventHappened = true;
     }
+#ifdef CONFIG_MB_TCP_ENABLED
+  else if (pxInst->eMBCurrentMode == MB_TCP)
+    {
+      /* Wait for requests from any of the connected Modbus/TCP masters */
+
+      (void)xMBTCPPortPoll();
+    }
+#endif
   else
     {
       /* Poll the serial device. The serial device timeouts if no
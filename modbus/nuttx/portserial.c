@@ -59,28 +59,7 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
-#ifdef CONFIG_MB_ASCII_ENABLED
-#define BUF_SIZE    513         /* must hold a complete ASCII frame. */
-#else
-#define BUF_SIZE    256         /* must hold a complete RTU frame. */
-#endif
-
-/****************************************************************************
- * Private Data
- ****************************************************************************/
-
-static int      iSerialFd = -1;
-static bool     bRxEnabled;
-static bool     bTxEnabled;
-
-static uint32_t ulTimeoutMs;
-static uint8_t  ucBuffer[BUF_SIZE];
-static int      uiRxBufferPos;
-static int      uiTxBufferPos;
-
-#ifdef CONFIG_SERIAL_TERMIOS
-static struct termios xOldTIO;
-#endif
+#define BUF_SIZE    MB_PORT_BUF_SIZE
 
 /****************************************************************************
  * Private Function Prototypes
@@ -97,15 +76,16 @@ static bool prvbMBPortSerialWrite(uint8_t *pucBuffer, uint16_t usNBytes);
 static bool prvbMBPortSerialRead(uint8_t *pucBuffer, uint16_t usNBytes,
                                  uint16_t *usNBytesRead)
 {
+  xMBInstance *pxInst = pxMBInstance;
   bool            bResult = true;
   ssize_t         res;
   fd_set          rfds;
   struct timeval  tv;
 
   tv.tv_sec = 0;
-  tv.tv_usec = 50000;
+  tv.tv_usec = pxInst->ulPollWaitUs;
   FD_ZERO(&rfds);
-  FD_SET(iSerialFd, &rfds);
+  FD_SET(pxInst->iSerialFd, &rfds);
 
   /* Wait until character received or timeout. Recover in case of an
    * interrupted read system call.
@@ -113,16 +93,16 @@ static bool prvbMBPortSerialRead(uint8_t *pucBuffer, uint16_t usNBytes,
 
   do
     {
-      if (select(iSerialFd + 1, &rfds, NULL, NULL, &tv) == -1)
+      if (select(pxInst->iSerialFd + 1, &rfds, NULL, NULL, &tv) == -1)
         {
           if (errno != EINTR)
             {
               bResult = false;
             }
         }
-      else if (FD_ISSET(iSerialFd, &rfds))
+      else if (FD_ISSET(pxInst->iSerialFd, &rfds))
         {
-          if ((res = read(iSerialFd, pucBuffer, usNBytes)) == -1)
+          if ((res = read(pxInst->iSerialFd, pucBuffer, usNBytes)) == -1)
             {
               bResult = false;
             }
@@ -145,13 +125,14 @@ static bool prvbMBPortSerialRead(uint8_t *pucBuffer, uint16_t usNBytes,
 
 static bool prvbMBPortSerialWrite(uint8_t *pucBuffer, uint16_t usNBytes)
 {
+  xMBInstance *pxInst = pxMBInstance;
   ssize_t res;
   size_t  left = (size_t) usNBytes;
   size_t  done = 0;
 
   while (left > 0)
     {
-      if ((res = write(iSerialFd, pucBuffer + done, left)) == -1)
+      if ((res = write(pxInst->iSerialFd, pucBuffer + done, left)) == -1)
         {
           if (errno != EINTR)
             {
@@ -176,6 +157,8 @@ static bool prvbMBPortSerialWrite(uint8_t *pucBuffer, uint16_t usNBytes)
 
 void vMBPortSerialEnable(bool bEnableRx, bool bEnableTx)
 {
+  xMBInstance *pxInst = pxMBInstance;
+
   /* it is not allowed that both receiver and transmitter are enabled. */
 
   ASSERT(!bEnableRx || !bEnableTx);
@@ -183,30 +166,31 @@ void vMBPortSerialEnable(bool bEnableRx, bool bEnableTx)
   if (bEnableRx)
     {
 #ifdef CONFIG_SERIAL_TERMIOS
-      (void)tcflush(iSerialFd, TCIFLUSH);
+      (void)tcflush(pxInst->iSerialFd, TCIFLUSH);
 #endif
-      uiRxBufferPos = 0;
-      bRxEnabled = true;
+      pxInst->uiRxBufferPos = 0;
+      pxInst->bRxEnabled = true;
     }
   else
     {
-      bRxEnabled = false;
+      pxInst->bRxEnabled = false;
     }
 
   if (bEnableTx)
     {
-      bTxEnabled = true;
-      uiTxBufferPos = 0;
+      pxInst->bTxEnabled = true;
+      pxInst->uiTxBufferPos = 0;
     }
   else
     {
-      bTxEnabled = false;
+      pxInst->bTxEnabled = false;
     }
 }
 
 bool xMBPortSerialInit(uint8_t ucPort, speed_t ulBaudRate,
                        uint8_t ucDataBits, eMBParity eParity)
 {
+  xMBInstance *pxInst = pxMBInstance;
   char szDevice[16];
   bool bStatus = true;
 
@@ -216,7 +200,7 @@ bool xMBPortSerialInit(uint8_t ucPort, speed_t ulBaudRate,
 
   snprintf(szDevice, 16, "/dev/ttyS%d", ucPort);
 
-  if ((iSerialFd = open(szDevice, O_RDWR | O_NOCTTY)) < 0)
+  if ((pxInst->iSerialFd = open(szDevice, O_RDWR | O_NOCTTY)) < 0)
     {
       vMBPortLog(MB_LOG_ERROR, "SER-INIT", "Can't open serial port %s: %d\n",
                  szDevice, errno);
@@ -224,7 +208,7 @@ bool xMBPortSerialInit(uint8_t ucPort, speed_t ulBaudRate,
     }
 
 #ifdef CONFIG_SERIAL_TERMIOS
-  else if (tcgetattr(iSerialFd, &xOldTIO) != 0)
+  else if (tcgetattr(pxInst->iSerialFd, &pxInst->xOldTIO) != 0)
     {
       vMBPortLog(MB_LOG_ERROR, "SER-INIT", "Can't get settings from port %s: %d\n",
                  szDevice, errno);
@@ -286,7 +270,7 @@ bool xMBPortSerialInit(uint8_t ucPort, speed_t ulBaudRate,
               vMBPortLog(MB_LOG_ERROR, "SER-INIT", "Can't set baud rate %ld for port %s: %d\n",
                          ulBaudRate, szDevice, errno);
             }
-          else if (tcsetattr(iSerialFd, TCSANOW, &xNewTIO) != 0)
+          else if (tcsetattr(pxInst->iSerialFd, TCSANOW, &xNewTIO) != 0)
             {
               vMBPortLog(MB_LOG_ERROR, "SER-INIT", "Can't set settings for port %s: %d\n",
                          szDevice, errno);
@@ -305,13 +289,15 @@ bool xMBPortSerialInit(uint8_t ucPort, speed_t ulBaudRate,
 
 bool xMBPortSerialSetTimeout(uint32_t ulNewTimeoutMs)
 {
+  xMBInstance *pxInst = pxMBInstance;
+
   if (ulNewTimeoutMs > 0)
     {
-      ulTimeoutMs = ulNewTimeoutMs;
+      pxInst->ulTimeoutMs = ulNewTimeoutMs;
     }
   else
     {
-      ulTimeoutMs = 1;
+      pxInst->ulTimeoutMs = 1;
     }
 
   return true;
@@ -319,25 +305,28 @@ bool xMBPortSerialSetTimeout(uint32_t ulNewTimeoutMs)
 
 void vMBPortClose(void)
 {
-  if (iSerialFd != -1)
+  xMBInstance *pxInst = pxMBInstance;
+
+  if (pxInst->iSerialFd != -1)
     {
 #ifdef CONFIG_SERIAL_TERMIOS
-      (void)tcsetattr(iSerialFd, TCSANOW, &xOldTIO);
+      (void)tcsetattr(pxInst->iSerialFd, TCSANOW, &pxInst->xOldTIO);
 #endif
-      (void)close(iSerialFd);
-      iSerialFd = -1;
+      (void)close(pxInst->iSerialFd);
+      pxInst->iSerialFd = -1;
     }
 }
 
 bool xMBPortSerialPoll(void)
 {
+  xMBInstance *pxInst = pxMBInstance;
   bool     bStatus = true;
   uint16_t usBytesRead;
   int      i;
 
-  while (bRxEnabled)
+  while (pxInst->bRxEnabled)
     {
-      if (prvbMBPortSerialRead(&ucBuffer[0], BUF_SIZE, &usBytesRead))
+      if (prvbMBPortSerialRead(&pxInst->ucBuffer[0], BUF_SIZE, &usBytesRead))
         {
           if (usBytesRead == 0)
             {
@@ -345,16 +334,23 @@ bool xMBPortSerialPoll(void)
 
               break;
             }
-          else if (usBytesRead > 0)
+          else if (pxInst->pxMBFrameCBBlockReceived != NULL)
+            {
+              /* Hand the whole read to the framer at once. */
+
+              (void)pxInst->pxMBFrameCBBlockReceived(pxInst->ucBuffer,
+                                                     usBytesRead);
+            }
+          else
             {
               for (i = 0; i < usBytesRead; i++)
                 {
                   /* Call the modbus stack and let him fill the buffers. */
 
-                  (void)pxMBFrameCBByteReceived();
+                  (void)pxInst->pxMBFrameCBByteReceived();
                 }
 
-              uiRxBufferPos = 0;
+              pxInst->uiRxBufferPos = 0;
             }
         }
       else
@@ -365,16 +361,16 @@ bool xMBPortSerialPoll(void)
         }
     }
 
-  if (bTxEnabled)
+  if (pxInst->bTxEnabled)
     {
-      while (bTxEnabled)
+      while (pxInst->bTxEnabled)
         {
-          (void)pxMBFrameCBTransmitterEmpty();
+          (void)pxInst->pxMBFrameCBTransmitterEmpty();
 
           /* Call the modbus stack to let him fill the buffer. */
         }
 
-      if (!prvbMBPortSerialWrite(&ucBuffer[0], uiTxBufferPos))
+      if (!prvbMBPortSerialWrite(&pxInst->ucBuffer[0], pxInst->uiTxBufferPos))
         {
           vMBPortLog(MB_LOG_ERROR, "SER-POLL", "write failed on serial device: %d\n",
                      errno);
@@ -387,16 +383,20 @@ bool xMBPortSerialPoll(void)
 
 bool xMBPortSerialPutByte(int8_t ucByte)
 {
-  ASSERT(uiTxBufferPos < BUF_SIZE);
-  ucBuffer[uiTxBufferPos] = ucByte;
-  uiTxBufferPos++;
+  xMBInstance *pxInst = pxMBInstance;
+
+  ASSERT(pxInst->uiTxBufferPos < BUF_SIZE);
+  pxInst->ucBuffer[pxInst->uiTxBufferPos] = ucByte;
+  pxInst->uiTxBufferPos++;
   return true;
 }
 
 bool xMBPortSerialGetByte(int8_t *pucByte)
 {
-  ASSERT(uiRxBufferPos < BUF_SIZE);
-  *pucByte = ucBuffer[uiRxBufferPos];
-  uiRxBufferPos++;
+  xMBInstance *pxInst = pxMBInstance;
+
+  ASSERT(pxInst->uiRxBufferPos < BUF_SIZE);
+  *pucByte = pxInst->ucBuffer[pxInst->uiRxBufferPos];
+  pxInst->uiRxBufferPos++;
   return true;
 }
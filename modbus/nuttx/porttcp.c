@@ -0,0 +1,404 @@
+/****************************************************************************
+ * apps/modbus/nuttx/porttcp.c
+ * FreeModBus Library: NuttX Modbus/TCP port
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <poll.h>
+
+#include <netinet/in.h>
+
+#include "port.h"
+
+#include "modbus/mb.h"
+#include "modbus/mbport.h"
+
+#ifdef CONFIG_MB_TCP_ENABLED
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_MB_TCP_MAX_CLIENTS
+#  define CONFIG_MB_TCP_MAX_CLIENTS 4
+#endif
+
+#define MB_TCP_DEFAULT_PORT 502   /* Registered Modbus/TCP port */
+#define MB_TCP_LEN          4     /* Offset of the MBAP length field */
+#define MB_TCP_UID          6     /* Offset of the unit identifier */
+#define MB_TCP_BUF_SIZE     (MB_TCP_UID + 256) /* Largest Modbus/TCP ADU */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One connected master.  Each client collects its requests in its own
+ * buffer, and the response is built in place, so the MBAP header and thus
+ * the transaction identifier of every client is preserved.
+ */
+
+typedef struct
+{
+  int      iSocket;                    /* Connected socket or -1 */
+  uint16_t usRcvPos;                   /* Bytes of the request received */
+  uint8_t  aucBuf[MB_TCP_BUF_SIZE];    /* Request, then response */
+} xMBTCPClient;
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static int          iListenSocket = -1;
+static xMBTCPClient xClients[CONFIG_MB_TCP_MAX_CLIENTS];
+static int          iCurClient = -1;   /* Client whose request is served */
+static int          iNextClient;       /* Where the next scan starts */
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void prvvMBTCPClientClose(xMBTCPClient *pxClient)
+{
+  if (pxClient->iSocket >= 0)
+    {
+      (void)close(pxClient->iSocket);
+      pxClient->iSocket = -1;
+    }
+
+  pxClient->usRcvPos = 0;
+}
+
+static void prvvMBTCPAccept(void)
+{
+  int iSocket;
+  int i;
+
+  iSocket = accept(iListenSocket, NULL, NULL);
+  if (iSocket < 0)
+    {
+      vMBPortLog(MB_LOG_ERROR, "MBTCP-ACCEPT", "accept failed: %d\n",
+                 errno);
+      return;
+    }
+
+  for (i = 0; i < CONFIG_MB_TCP_MAX_CLIENTS; i++)
+    {
+      if (xClients[i].iSocket < 0)
+        {
+          xClients[i].iSocket  = iSocket;
+          xClients[i].usRcvPos = 0;
+          return;
+        }
+    }
+
+  vMBPortLog(MB_LOG_WARN, "MBTCP-ACCEPT",
+             "Too many clients, connection refused\n");
+  (void)close(iSocket);
+}
+
+/* Read the next part of a client's request.  Returns true when the
+ * request is complete.  Only the bytes of the current request are read,
+ * so pipelined requests stay queued in the socket.
+ */
+
+static bool prvbMBTCPRead(xMBTCPClient *pxClient)
+{
+  uint16_t usNeeded;
+  uint16_t usLength;
+  ssize_t  nRead;
+
+  if (pxClient->usRcvPos < MB_TCP_UID + 1)
+    {
+      usNeeded = MB_TCP_UID + 1;
+    }
+  else
+    {
+      usLength = (uint16_t)(pxClient->aucBuf[MB_TCP_LEN] << 8) |
+                 pxClient->aucBuf[MB_TCP_LEN + 1];
+      usNeeded = MB_TCP_UID + usLength;
+    }
+
+  nRead = recv(pxClient->iSocket, &pxClient->aucBuf[pxClient->usRcvPos],
+               usNeeded - pxClient->usRcvPos, 0);
+  if (nRead <= 0)
+    {
+      /* Connection closed by the master or broken */
+
+      prvvMBTCPClientClose(pxClient);
+      return false;
+    }
+
+  pxClient->usRcvPos += nRead;
+  if (pxClient->usRcvPos == MB_TCP_UID + 1)
+    {
+      /* The header is complete.  The length counts the unit identifier and
+       * the PDU, which must contain at least the function code.
+       */
+
+      usLength = (uint16_t)(pxClient->aucBuf[MB_TCP_LEN] << 8) |
+                 pxClient->aucBuf[MB_TCP_LEN + 1];
+      if (usLength < 2 || MB_TCP_UID + usLength > MB_TCP_BUF_SIZE)
+        {
+          vMBPortLog(MB_LOG_WARN, "MBTCP-RCV",
+                     "Bad frame length %u, closing connection\n",
+                     usLength);
+          prvvMBTCPClientClose(pxClient);
+        }
+
+      return false;
+    }
+
+  return pxClient->usRcvPos == usNeeded;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+bool xMBTCPPortInit(uint16_t usTCPPort)
+{
+  struct sockaddr_in xAddr;
+  int iOpt = 1;
+  int i;
+
+  for (i = 0; i < CONFIG_MB_TCP_MAX_CLIENTS; i++)
+    {
+      xClients[i].iSocket  = -1;
+      xClients[i].usRcvPos = 0;
+    }
+
+  iCurClient  = -1;
+  iNextClient = 0;
+
+  iListenSocket = socket(AF_INET, SOCK_STREAM, 0);
+  if (iListenSocket < 0)
+    {
+      vMBPortLog(MB_LOG_ERROR, "MBTCP-INIT", "Can't create socket: %d\n",
+                 errno);
+      return false;
+    }
+
+  (void)setsockopt(iListenSocket, SOL_SOCKET, SO_REUSEADDR, &iOpt,
+                   sizeof(iOpt));
+
+  memset(&xAddr, 0, sizeof(xAddr));
+  xAddr.sin_family      = AF_INET;
+  xAddr.sin_addr.s_addr = htonl(INADDR_ANY);
+  xAddr.sin_port        = htons(usTCPPort == MB_TCP_PORT_USE_DEFAULT ?
+                                MB_TCP_DEFAULT_PORT : usTCPPort);
+
+  if (bind(iListenSocket, (struct sockaddr *)&xAddr, sizeof(xAddr)) < 0 ||
+      listen(iListenSocket, CONFIG_MB_TCP_MAX_CLIENTS) < 0)
+    {
+      vMBPortLog(MB_LOG_ERROR, "MBTCP-INIT", "Can't listen on port %u: %d\n",
+                 usTCPPort, errno);
+      (void)close(iListenSocket);
+      iListenSocket = -1;
+      return false;
+    }
+
+  return true;
+}
+
+#ifdef CONFIG_MB_HAVE_CLOSE
+void vMBTCPPortClose(void)
+{
+  vMBTCPPortDisable();
+
+  if (iListenSocket >= 0)
+    {
+      (void)close(iListenSocket);
+      iListenSocket = -1;
+    }
+}
+#endif
+
+void vMBTCPPortDisable(void)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_MB_TCP_MAX_CLIENTS; i++)
+    {
+      prvvMBTCPClientClose(&xClients[i]);
+    }
+
+  iCurClient = -1;
+}
+
+/* Wait for activity on the listening socket and on all clients.  Accepts
+ * new connections and reads from every client that has data, posting
+ * EV_FRAME_RECEIVED for the first complete request.  The scan starts
+ * after the client served last, so that busy masters can not starve the
+ * others.
+ */
+
+bool xMBTCPPortPoll(void)
+{
+  struct pollfd axFds[CONFIG_MB_TCP_MAX_CLIENTS + 1];
+  xMBTCPClient *pxClient;
+  int nFds;
+  int i;
+  int k;
+
+  if (iListenSocket < 0)
+    {
+      return false;
+    }
+
+  axFds[0].fd      = iListenSocket;
+  axFds[0].events  = POLLIN;
+  axFds[0].revents = 0;
+
+  for (i = 0; i < CONFIG_MB_TCP_MAX_CLIENTS; i++)
+    {
+      axFds[i + 1].fd      = xClients[i].iSocket;
+      axFds[i + 1].events  = POLLIN;
+      axFds[i + 1].revents = 0;
+    }
+
+  nFds = poll(axFds, CONFIG_MB_TCP_MAX_CLIENTS + 1,
+              pxMBInstance->ulPollWaitUs / 1000);
+  if (nFds < 0)
+    {
+      if (errno != EINTR)
+        {
+          vMBPortLog(MB_LOG_ERROR, "MBTCP-POLL", "poll failed: %d\n", errno);
+        }
+
+      return false;
+    }
+
+  if (axFds[0].revents & POLLIN)
+    {
+      prvvMBTCPAccept();
+    }
+
+  for (k = 0; k < CONFIG_MB_TCP_MAX_CLIENTS; k++)
+    {
+      i = (iNextClient + k) % CONFIG_MB_TCP_MAX_CLIENTS;
+      pxClient = &xClients[i];
+
+      if (pxClient->iSocket < 0 || axFds[i + 1].revents == 0)
+        {
+          continue;
+        }
+
+      if ((axFds[i + 1].revents & (POLLERR | POLLHUP | POLLNVAL)) != 0 &&
+          (axFds[i + 1].revents & POLLIN) == 0)
+        {
+          prvvMBTCPClientClose(pxClient);
+          continue;
+        }
+
+      if (prvbMBTCPRead(pxClient))
+        {
+          iCurClient  = i;
+          iNextClient = (i + 1) % CONFIG_MB_TCP_MAX_CLIENTS;
+          return xMBPortEventPost(EV_FRAME_RECEIVED);
+        }
+    }
+
+  return false;
+}
+
+bool xMBTCPPortGetRequest(uint8_t **ppucMBTCPFrame, uint16_t *usTCPLength)
+{
+  xMBTCPClient *pxClient;
+
+  if (iCurClient < 0)
+    {
+      return false;
+    }
+
+  pxClient = &xClients[iCurClient];
+  *ppucMBTCPFrame = pxClient->aucBuf;
+  *usTCPLength    = pxClient->usRcvPos;
+
+  /* The request stays in the buffer, where the response is assembled, but
+   * the next read from this client starts a new request.
+   */
+
+  pxClient->usRcvPos = 0;
+  return true;
+}
+
+bool xMBTCPPortSendResponse(const uint8_t *pucMBTCPFrame,
+                            uint16_t usTCPLength)
+{
+  xMBTCPClient *pxClient;
+  ssize_t nWritten;
+  size_t  done = 0;
+
+  if (iCurClient < 0)
+    {
+      return false;
+    }
+
+  pxClient   = &xClients[iCurClient];
+  iCurClient = -1;
+
+  while (done < usTCPLength && pxClient->iSocket >= 0)
+    {
+      nWritten = send(pxClient->iSocket, pucMBTCPFrame + done,
+                      usTCPLength - done, 0);
+      if (nWritten < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          vMBPortLog(MB_LOG_ERROR, "MBTCP-SND", "send failed: %d\n", errno);
+          prvvMBTCPClientClose(pxClient);
+          return false;
+        }
+
+      done += nWritten;
+    }
+
+  return done == usTCPLength;
+}
+
+#endif /* CONFIG_MB_TCP_ENABLED */
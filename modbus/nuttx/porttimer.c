@@ -44,28 +44,21 @@
 #include "modbus/mb.h"
 #include "modbus/mbport.h"
 
-/****************************************************************************
- * Public Data
- ****************************************************************************/
-
-uint32_t ulTimeOut;
-bool     bTimeoutEnable;
-
-static struct timeval xTimeLast;
-
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
 bool xMBPortTimersInit(uint16_t usTim1Timerout50us)
 {
-  ulTimeOut = usTim1Timerout50us / 20U;
-  if (ulTimeOut == 0)
+  xMBInstance *pxInst = pxMBInstance;
+
+  pxInst->ulTimeOut = usTim1Timerout50us / 20U;
+  if (pxInst->ulTimeOut == 0)
     {
-      ulTimeOut = 1;
+      pxInst->ulTimeOut = 1;
     }
 
-  return xMBPortSerialSetTimeout(ulTimeOut);
+  return xMBPortSerialSetTimeout(pxInst->ulTimeOut);
 }
 
 void xMBPortTimersClose()
@@ -75,6 +68,7 @@ void xMBPortTimersClose()
 
 void vMBPortTimerPoll()
 {
+  xMBInstance *pxInst = pxMBInstance;
   uint32_t       ulDeltaMS;
   struct timeval xTimeCur;
 
@@ -82,7 +76,7 @@ void vMBPortTimerPoll()
    * res timer in Win32.
    */
 
-  if (bTimeoutEnable)
+  if (pxInst->bTimeoutEnable)
     {
       if (gettimeofday(&xTimeCur, NULL) != 0)
         {
@@ -90,12 +84,12 @@ void vMBPortTimerPoll()
         }
       else
         {
-          ulDeltaMS = (xTimeCur.tv_sec - xTimeLast.tv_sec) * 1000L +
-                      (xTimeCur.tv_usec - xTimeLast.tv_usec) * 1000L;
-          if (ulDeltaMS > ulTimeOut)
+          ulDeltaMS = (xTimeCur.tv_sec - pxInst->xTimeLast.tv_sec) * 1000L +
+                      (xTimeCur.tv_usec - pxInst->xTimeLast.tv_usec) / 1000L;
+          if (ulDeltaMS > pxInst->ulTimeOut)
             {
-              bTimeoutEnable = false;
-              (void)pxMBPortCBTimerExpired();
+              pxInst->bTimeoutEnable = false;
+              (void)pxInst->pxMBPortCBTimerExpired();
             }
         }
     }
@@ -103,13 +97,16 @@ void vMBPortTimerPoll()
 
 void vMBPortTimersEnable()
 {
-  int res = gettimeofday(&xTimeLast, NULL);
+  xMBInstance *pxInst = pxMBInstance;
+  int res = gettimeofday(&pxInst->xTimeLast, NULL);
 
   ASSERT(res == 0);
-  bTimeoutEnable = true;
+  pxInst->bTimeoutEnable = true;
 }
 
 void vMBPortTimersDisable()
 {
-  bTimeoutEnable = false;
+  xMBInstance *pxInst = pxMBInstance;
+
+  pxInst->bTimeoutEnable = false;
 }
@@ -33,12 +33,26 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
 #include "port.h"
+#include "mbcrc.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#if !defined(CONFIG_MB_CRC16_SLICE4) && !defined(CONFIG_MB_CRC16_PLATFORM)
+#  define CONFIG_MB_CRC16_TABLE 1
+#endif
+
+#define MB_CRC16_POLY 0xa001  /* 0x8005 reflected */
 
 /****************************************************************************
  * Private Data
  ****************************************************************************/
 
+#ifdef CONFIG_MB_CRC16_TABLE
 static const uint8_t aucCRCHi[] =
 {
   0x00, 0xc1, 0x81, 0x40, 0x01, 0xc0, 0x80, 0x41, 0x01, 0xc0, 0x80, 0x41,
@@ -90,11 +104,95 @@ static const uint8_t aucCRCLo[] =
   0x44, 0x84, 0x85, 0x45, 0x87, 0x47, 0x46, 0x86, 0x82, 0x42, 0x43, 0x83,
   0x41, 0x81, 0x80, 0x40
 };
+#endif
+
+#ifdef CONFIG_MB_CRC16_SLICE4
+/* Four 256-entry tables for slice-by-4.  ausCRCTab[0] is the classic byte
+ * table; ausCRCTab[k][b] is the CRC of byte b followed by k zero bytes.
+ * They are built on first use to keep the 2 KiB out of the flash image.
+ */
+
+static uint16_t ausCRCTab[4][256];
+static volatile bool bCRCTabValid;
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_MB_CRC16_SLICE4
+static void prvvMBCRC16InitTables(void)
+{
+  uint16_t usCRC;
+  int i;
+  int j;
+
+  for (i = 0; i < 256; i++)
+    {
+      usCRC = i;
+      for (j = 0; j < 8; j++)
+        {
+          usCRC = (usCRC & 1) ? (usCRC >> 1) ^ MB_CRC16_POLY : usCRC >> 1;
+        }
+
+      ausCRCTab[0][i] = usCRC;
+    }
+
+  for (i = 0; i < 256; i++)
+    {
+      for (j = 1; j < 4; j++)
+        {
+          usCRC = ausCRCTab[j - 1][i];
+          ausCRCTab[j][i] = (usCRC >> 8) ^ ausCRCTab[0][usCRC & 0xff];
+        }
+    }
+
+  bCRCTabValid = true;
+}
+#endif
 
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
+#if defined(CONFIG_MB_CRC16_PLATFORM)
+uint16_t usMBCRC16(uint8_t *pucFrame, uint16_t usLen)
+{
+  return usMBPortCRC16(pucFrame, usLen);
+}
+
+#elif defined(CONFIG_MB_CRC16_SLICE4)
+uint16_t usMBCRC16(uint8_t *pucFrame, uint16_t usLen)
+{
+  uint16_t usCRC = 0xffff;
+
+  if (!bCRCTabValid)
+    {
+      prvvMBCRC16InitTables();
+    }
+
+  /* Four bytes per step: the two that overlap the CRC register and two
+   * that are looked up on their own.
+   */
+
+  while (usLen >= 4)
+    {
+      usCRC ^= (uint16_t)pucFrame[0] | (uint16_t)pucFrame[1] << 8;
+      usCRC  = ausCRCTab[3][usCRC & 0xff] ^ ausCRCTab[2][usCRC >> 8] ^
+               ausCRCTab[1][pucFrame[2]] ^ ausCRCTab[0][pucFrame[3]];
+      pucFrame += 4;
+      usLen    -= 4;
+    }
+
+  while (usLen--)
+    {
+      usCRC = (usCRC >> 8) ^ ausCRCTab[0][(usCRC ^ *pucFrame++) & 0xff];
+    }
+
+  return usCRC;
+}
+
+#else
 uint16_t usMBCRC16(uint8_t * pucFrame, uint16_t usLen)
 {
   uint8_t ucCRCHi = 0xff;
@@ -110,3 +208,4 @@ uint16_t usMBCRC16(uint8_t * pucFrame, uint16_t usLen)
 
   return (uint16_t)(ucCRCHi << 8 | ucCRCLo);
 }
+#endif
@@ -38,4 +38,13 @@
 
 uint16_t usMBCRC16(uint8_t *pucFrame, uint16_t usLen);
 
+#ifdef CONFIG_MB_CRC16_PLATFORM
+/* Provided by the platform, e.g. using a CRC peripheral programmed for the
+ * Modbus polynomial (0x8005, reflected, initial value 0xffff).  Returns the
+ * CRC with the byte to be sent first in the low byte.
+ */
+
+uint16_t usMBPortCRC16(const uint8_t *pucFrame, uint16_t usLen);
+#endif
+
 #endif /* __APPS_MODBUS_RTU_MBCRC_H */
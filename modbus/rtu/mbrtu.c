@@ -75,20 +75,6 @@ typedef enum
   STATE_TX_XMIT                 /* Transmitter is in transfer state. */
 } eMBSndState;
 
-/****************************************************************************
- * Private Data
- ****************************************************************************/
-
-static volatile eMBSndState eSndState;
-static volatile eMBRcvState eRcvState;
-
-volatile uint8_t  ucRTUBuf[MB_SER_PDU_SIZE_MAX];
-
-static volatile uint8_t *pucSndBufferCur;
-static volatile uint16_t usSndBufferCount;
-
-static volatile uint16_t usRcvBufferPos;
-
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -144,6 +130,8 @@ eMBErrorCode eMBRTUInit(uint8_t ucSlaveAddress, uint8_t ucPort,
 
 void eMBRTUStart(void)
 {
+  xMBInstance *pxInst = pxMBInstance;
+
   ENTER_CRITICAL_SECTION();
 
   /* Initially the receiver is in the state STATE_RX_INIT. we start
@@ -152,7 +140,7 @@ void eMBRTUStart(void)
    * modbus protocol stack until the bus is free.
    */
 
-  eRcvState = STATE_RX_INIT;
+  pxInst->eRcvState = STATE_RX_INIT;
   vMBPortSerialEnable(true, false);
   vMBPortTimersEnable();
 
@@ -170,31 +158,33 @@ void eMBRTUStop(void)
 eMBErrorCode eMBRTUReceive(uint8_t *pucRcvAddress, uint8_t **pucFrame,
                            uint16_t *pusLength)
 {
+  xMBInstance *pxInst = pxMBInstance;
   eMBErrorCode eStatus = MB_ENOERR;
 
   ENTER_CRITICAL_SECTION();
-  ASSERT(usRcvBufferPos < MB_SER_PDU_SIZE_MAX);
+  ASSERT(pxInst->usRcvBufferPos < MB_SER_PDU_SIZE_MAX);
 
   /* Length and CRC check */
 
-  if ((usRcvBufferPos >= MB_SER_PDU_SIZE_MIN) &&
-      (usMBCRC16((uint8_t *) ucRTUBuf, usRcvBufferPos) == 0))
+  if ((pxInst->usRcvBufferPos >= MB_SER_PDU_SIZE_MIN) &&
+      (usMBCRC16((uint8_t *) pxInst->ucSerBuf, pxInst->usRcvBufferPos) == 0))
     {
       /* Save the address field. All frames are passed to the upper layed
        * and the decision if a frame is used is done there.
        */
 
-      *pucRcvAddress = ucRTUBuf[MB_SER_PDU_ADDR_OFF];
+      *pucRcvAddress = pxInst->ucSerBuf[MB_SER_PDU_ADDR_OFF];
 
       /* Total length of Modbus-PDU is Modbus-Serial-Line-PDU minus
        * size of address field and CRC checksum.
        */
 
-      *pusLength = (uint16_t)(usRcvBufferPos - MB_SER_PDU_PDU_OFF - MB_SER_PDU_SIZE_CRC);
+      *pusLength = (uint16_t)(pxInst->usRcvBufferPos - MB_SER_PDU_PDU_OFF -
+                              MB_SER_PDU_SIZE_CRC);
 
       /* Return the start of the Modbus PDU to the caller. */
 
-      *pucFrame = (uint8_t *) & ucRTUBuf[MB_SER_PDU_PDU_OFF];
+      *pucFrame = (uint8_t *) & pxInst->ucSerBuf[MB_SER_PDU_PDU_OFF];
     }
   else
     {
@@ -207,6 +197,7 @@ eMBErrorCode eMBRTUReceive(uint8_t *pucRcvAddress, uint8_t **pucFrame,
 
 eMBErrorCode eMBRTUSend(uint8_t ucSlaveAddress, const uint8_t *pucFrame, uint16_t usLength)
 {
+  xMBInstance *pxInst = pxMBInstance;
   eMBErrorCode eStatus = MB_ENOERR;
   uint16_t usCRC16;
 
@@ -217,27 +208,28 @@ eMBErrorCode eMBRTUSend(uint8_t ucSlaveAddress, const uint8_t *pucFrame, uint16_
    * frame on the network. We have to abort sending the frame.
    */
 
-  if (eRcvState == STATE_RX_IDLE)
+  if (pxInst->eRcvState == STATE_RX_IDLE)
     {
       /* First byte before the Modbus-PDU is the slave address. */
 
-      pucSndBufferCur = (uint8_t *) pucFrame - 1;
-      usSndBufferCount = 1;
+      pxInst->pucSndBufferCur = (uint8_t *) pucFrame - 1;
+      pxInst->usSndBufferCount = 1;
 
       /* Now copy the Modbus-PDU into the Modbus-Serial-Line-PDU. */
 
-      pucSndBufferCur[MB_SER_PDU_ADDR_OFF] = ucSlaveAddress;
-      usSndBufferCount += usLength;
+      pxInst->pucSndBufferCur[MB_SER_PDU_ADDR_OFF] = ucSlaveAddress;
+      pxInst->usSndBufferCount += usLength;
 
       /* Calculate CRC16 checksum for Modbus-Serial-Line-PDU. */
 
-      usCRC16 = usMBCRC16((uint8_t *) pucSndBufferCur, usSndBufferCount);
-      ucRTUBuf[usSndBufferCount++] = (uint8_t)(usCRC16 & 0xFF);
-      ucRTUBuf[usSndBufferCount++] = (uint8_t)(usCRC16 >> 8);
+      usCRC16 = usMBCRC16((uint8_t *) pxInst->pucSndBufferCur,
+                          pxInst->usSndBufferCount);
+      pxInst->ucSerBuf[pxInst->usSndBufferCount++] = (uint8_t)(usCRC16 & 0xFF);
+      pxInst->ucSerBuf[pxInst->usSndBufferCount++] = (uint8_t)(usCRC16 >> 8);
 
       /* Activate the transmitter. */
 
-      eSndState = STATE_TX_XMIT;
+      pxInst->eSndState = STATE_TX_XMIT;
       vMBPortSerialEnable(false, true);
     }
   else
@@ -251,16 +243,17 @@ eMBErrorCode eMBRTUSend(uint8_t ucSlaveAddress, const uint8_t *pucFrame, uint16_
 
 bool xMBRTUReceiveFSM(void)
 {
+  xMBInstance *pxInst = pxMBInstance;
   bool xTaskNeedSwitch = false;
   uint8_t ucByte;
 
-  ASSERT(eSndState == STATE_TX_IDLE);
+  ASSERT(pxInst->eSndState == STATE_TX_IDLE);
 
   /* Always read the character. */
 
   (void)xMBPortSerialGetByte((int8_t *) & ucByte);
 
-  switch (eRcvState)
+  switch (pxInst->eRcvState)
     {
       /* If we have received a character in the init state we have to
        * wait until the frame is finished.
@@ -284,9 +277,9 @@ bool xMBRTUReceiveFSM(void)
        */
 
       case STATE_RX_IDLE:
-        usRcvBufferPos = 0;
-        ucRTUBuf[usRcvBufferPos++] = ucByte;
-        eRcvState = STATE_RX_RCV;
+        pxInst->usRcvBufferPos = 0;
+        pxInst->ucSerBuf[pxInst->usRcvBufferPos++] = ucByte;
+        pxInst->eRcvState = STATE_RX_RCV;
 
         /* Enable t3.5 timers. */
 
@@ -300,13 +293,13 @@ bool xMBRTUReceiveFSM(void)
        */
 
       case STATE_RX_RCV:
-        if (usRcvBufferPos < MB_SER_PDU_SIZE_MAX)
+        if (pxInst->usRcvBufferPos < MB_SER_PDU_SIZE_MAX)
           {
-            ucRTUBuf[usRcvBufferPos++] = ucByte;
+            pxInst->ucSerBuf[pxInst->usRcvBufferPos++] = ucByte;
           }
         else
           {
-            eRcvState = STATE_RX_ERROR;
+            pxInst->eRcvState = STATE_RX_ERROR;
           }
 
         vMBPortTimersEnable();
@@ -316,13 +309,69 @@ bool xMBRTUReceiveFSM(void)
   return xTaskNeedSwitch;
 }
 
+/* Block version of xMBRTUReceiveFSM(), called once per read with all of
+ * the characters received.  The frame timer is restarted once per call, so
+ * the end of the frame is detected T3.5 after the last read that returned
+ * data rather than after the last character.
+ */
+
+bool xMBRTUReceiveBlock(const uint8_t *pucData, uint16_t usLength)
+{
+  xMBInstance *pxInst = pxMBInstance;
+  uint16_t usRoom;
+
+  ASSERT(pxInst->eSndState == STATE_TX_IDLE);
+
+  switch (pxInst->eRcvState)
+    {
+      /* In the init and error states the characters are dropped until the
+       * bus has been idle for t3.5.
+       */
+
+      case STATE_RX_INIT:
+      case STATE_RX_ERROR:
+        break;
+
+      /* A new frame starts. */
+
+      case STATE_RX_IDLE:
+        pxInst->usRcvBufferPos = 0;
+        pxInst->eRcvState = STATE_RX_RCV;
+
+        /* Fall through */
+
+      /* Append the characters to the frame.  If more than the maximum
+       * possible number of bytes in a modbus frame is received the frame
+       * is ignored.
+       */
+
+      case STATE_RX_RCV:
+        usRoom = MB_SER_PDU_SIZE_MAX - pxInst->usRcvBufferPos;
+        if (usLength <= usRoom)
+          {
+            memcpy((uint8_t *)&pxInst->ucSerBuf[pxInst->usRcvBufferPos],
+                   pucData, usLength);
+            pxInst->usRcvBufferPos += usLength;
+          }
+        else
+          {
+            pxInst->eRcvState = STATE_RX_ERROR;
+          }
+        break;
+    }
+
+  vMBPortTimersEnable();
+  return false;
+}
+
 bool xMBRTUTransmitFSM(void)
 {
+  xMBInstance *pxInst = pxMBInstance;
   bool xNeedPoll = false;
 
-  ASSERT(eRcvState == STATE_RX_IDLE);
+  ASSERT(pxInst->eRcvState == STATE_RX_IDLE);
 
-  switch (eSndState)
+  switch (pxInst->eSndState)
     {
       /* We should not get a transmitter event if the transmitter is in
        * idle state.
@@ -337,11 +386,11 @@ bool xMBRTUTransmitFSM(void)
     case STATE_TX_XMIT:
       /* check if we are finished. */
 
-      if (usSndBufferCount != 0)
+      if (pxInst->usSndBufferCount != 0)
         {
-          xMBPortSerialPutByte((int8_t)*pucSndBufferCur);
-          pucSndBufferCur++;  /* next byte in sendbuffer. */
-          usSndBufferCount--;
+          xMBPortSerialPutByte((int8_t)*pxInst->pucSndBufferCur);
+          pxInst->pucSndBufferCur++;  /* next byte in sendbuffer. */
+          pxInst->usSndBufferCount--;
         }
       else
         {
@@ -352,7 +401,7 @@ bool xMBRTUTransmitFSM(void)
            */
 
           vMBPortSerialEnable(true, false);
-          eSndState = STATE_TX_IDLE;
+          pxInst->eSndState = STATE_TX_IDLE;
         }
       break;
     }
@@ -362,9 +411,10 @@ bool xMBRTUTransmitFSM(void)
 
 bool xMBRTUTimerT35Expired(void)
 {
+  xMBInstance *pxInst = pxMBInstance;
   bool xNeedPoll = false;
 
-  switch (eRcvState)
+  switch (pxInst->eRcvState)
     {
       /* Timer t35 expired. Start-up phase is finished. */
 
@@ -388,13 +438,13 @@ bool xMBRTUTimerT35Expired(void)
       /* Function called in an illegal state. */
 
       default:
-        ASSERT((eRcvState == STATE_RX_INIT) ||
-               (eRcvState == STATE_RX_RCV) ||
-               (eRcvState == STATE_RX_ERROR));
+        ASSERT((pxInst->eRcvState == STATE_RX_INIT) ||
+               (pxInst->eRcvState == STATE_RX_RCV) ||
+               (pxInst->eRcvState == STATE_RX_ERROR));
     }
 
   vMBPortTimersDisable();
-  eRcvState = STATE_RX_IDLE;
+  pxInst->eRcvState = STATE_RX_IDLE;
 
   return xNeedPoll;
 }
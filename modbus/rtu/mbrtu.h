@@ -50,6 +50,7 @@ eMBErrorCode eMBRTUReceive(uint8_t *pucRcvAddress, uint8_t **pucFrame,
 eMBErrorCode eMBRTUSend(uint8_t slaveAddress, const uint8_t *pucFrame,
                         uint16_t usLength);
 bool xMBRTUReceiveFSM(void);
+bool xMBRTUReceiveBlock(const uint8_t *pucData, uint16_t usLength);
 bool xMBRTUTransmitFSM(void);
 bool xMBRTUTimerT15Expired(void);
 bool xMBRTUTimerT35Expired(void);
@@ -45,6 +45,7 @@
 
 #include <errno.h>
 #include <poll.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -58,6 +59,14 @@
 
 #define CHAT_TOKEN_SIZE    128
 
+/* Deadlines are kept against the monotonic clock when there is one */
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define CHAT_CLOCK       CLOCK_MONOTONIC
+#else
+#  define CHAT_CLOCK       CLOCK_REALTIME
+#endif
+
 /****************************************************************************
  * Pivate types
  ****************************************************************************/
@@ -71,6 +80,21 @@ struct chat_token
   FAR struct chat_token* next;
 };
 
+/* A node of the Aho-Corasick automaton matching all of the strings an
+ * expectation waits for.  Index 0 is the root, so 0 also means "none" for
+ * child and sibling.
+ */
+
+struct chat_acnode
+{
+  uint16_t child;                  /* first node one character deeper */
+  uint16_t sibling;                /* next child of the same parent */
+  uint16_t fail;                   /* longest proper suffix in the trie */
+  unsigned char c;                 /* character leading to this node */
+  uint8_t match;                   /* 1 + index of the string matched
+                                    * here, 0 for none */
+};
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -81,6 +105,7 @@ void chat_init(FAR struct chat* priv, FAR struct chat_ctl* ctl)
 
   memcpy(&priv->ctl, ctl, sizeof(struct chat_ctl));
   priv->script  = NULL;
+  priv->naborts = 0;
 }
 
 /* Linear one-pass tokenizer. */
@@ -329,8 +354,15 @@ static int chat_internalise(FAR struct chat* priv,
 
       if (rhs)
         {
+          /* Only strings sent to the modem are line terminated; command
+           * arguments such as ABORT strings are used as they are.
+           */
+
+          bool termin = line->type == CHAT_LINE_TYPE_EXPECT_SEND &&
+                        !tok->no_termin;
+
           len = strlen(tok->string);
-          if (!tok->no_termin)
+          if (termin)
             {
               /* Add space for the line terminator */
 
@@ -342,7 +374,7 @@ static int chat_internalise(FAR struct chat* priv,
             {
               /* Copy the token and add the line terminator as appropriate */
 
-              sprintf(line->rhs, tok->no_termin ? "%s" : "%s\r\n", tok->string);
+              sprintf(line->rhs, termin ? "%s\r\n" : "%s", tok->string);
             }
           else
             {
@@ -447,11 +479,12 @@ static int chat_script_parse(FAR struct chat* priv, FAR char* script)
 }
 
 /* Polls the file descriptor for a specified number of milliseconds and, on
- * successful read, stores 1 read byte at location pointed by 'c'. Otherwise
- * returns a negative error code.
+ * success, reads up to 'size' bytes into 'buf'.  Returns the number of bytes
+ * read or a negative error code.
  */
 
-static int chat_readb(FAR struct chat* priv, FAR char* c, int timeout_ms)
+static int chat_read(FAR struct chat* priv, FAR char* buf, size_t size,
+                     int timeout_ms)
 {
   struct pollfd fds;
   int ret;
@@ -467,8 +500,8 @@ static int chat_readb(FAR struct chat* priv, FAR char* c, int timeout_ms)
       return -ETIMEDOUT;
     }
 
-  ret = read(priv->ctl.fd, c, 1);
-  if (ret != 1)
+  ret = read(priv->ctl.fd, buf, size);
+  if (ret <= 0)
     {
       _info("read failed\n");
       return -EPERM;
@@ -476,69 +509,271 @@ static int chat_readb(FAR struct chat* priv, FAR char* c, int timeout_ms)
 
   if (priv->ctl.echo)
     {
-      fputc(*c, stderr);
+      fwrite(buf, 1, ret, stderr);
     }
 
-  _info("read \'%c\' (0x%02X)\n", *c, *c);
-  return 0;
+  _info("read %d bytes\n", ret);
+  return ret;
 }
 
 static void chat_flush(FAR struct chat* priv)
 {
-  char c;
+  char buf[CONFIG_NETUTILS_CHAT_READSIZE];
 
   _info("starting\n");
-  while (chat_readb(priv, (FAR char*) &c, 0) == 0);
+  while (chat_read(priv, buf, sizeof(buf), 0) > 0);
   _info("done\n");
 }
 
-static int chat_expect(FAR struct chat* priv, FAR const char* s)
+/* Returns the milliseconds left until 'deadline', rounded up so that the
+ * last poll does not return before it.
+ */
+
+static int chat_ms_left(FAR const struct timespec* deadline)
 {
-  char c;
-  struct timespec abstime;
-  struct timespec endtime;
-  int timeout_ms;
-  int s_len = strlen(s);
-  int i_match = 0; /* index of the next character to be matched in s */
-  int ret = 0;
+  struct timespec now;
+  long long ns;
+
+  clock_gettime(CHAT_CLOCK, &now);
+  ns = (long long)(deadline->tv_sec - now.tv_sec) * 1000000000LL +
+       (deadline->tv_nsec - now.tv_nsec);
+
+  if (ns <= 0)
+    {
+      return 0;
+    }
+
+  return (int)((ns + 999999) / 1000000);
+}
 
-  /* Get initial time and set the end time */
+/* Finds the child of 'node' reached by 'c', 0 if there is none */
 
-  clock_gettime(CLOCK_REALTIME, (FAR struct timespec*) &abstime);
-  endtime.tv_sec  = abstime.tv_sec + priv->ctl.timeout;
-  endtime.tv_nsec = abstime.tv_nsec;
+static uint16_t chat_ac_child(FAR const struct chat_acnode* ac,
+                              uint16_t node, unsigned char c)
+{
+  uint16_t child;
 
-  while (!ret && i_match < s_len &&
-         (abstime.tv_sec < endtime.tv_sec ||
-          (abstime.tv_sec == endtime.tv_sec &&
-           abstime.tv_nsec < endtime.tv_nsec)))
+  for (child = ac[node].child; child != 0; child = ac[child].sibling)
     {
-      timeout_ms =
-        (endtime.tv_sec - abstime.tv_sec) * 1000 +
-        (endtime.tv_nsec - abstime.tv_nsec) / 1000000;
+      if (ac[child].c == c)
+        {
+          break;
+        }
+    }
 
-      DEBUGASSERT(timeout_ms >= 0);
+  return child;
+}
 
-      ret = chat_readb(priv, &c, timeout_ms);
-      if (!ret)
+/* Compiles 'nstr' strings into one Aho-Corasick automaton, returned in
+ * '*pac'.  Where several strings end at the same place, the lowest index
+ * wins.
+ */
+
+static int chat_ac_build(FAR const char* const* str, int nstr,
+                         FAR struct chat_acnode** pac)
+{
+  FAR struct chat_acnode* ac;
+  FAR uint16_t* queue;
+  FAR const unsigned char* p;
+  size_t total = 1;
+  uint16_t nnodes = 1;
+  uint16_t node;
+  uint16_t child;
+  uint16_t fail;
+  int head;
+  int tail;
+  int i;
+
+  for (i = 0; i < nstr; i++)
+    {
+      total += strlen(str[i]);
+    }
+
+  if (total > UINT16_MAX)
+    {
+      return -E2BIG;
+    }
+
+  ac = calloc(total, sizeof(struct chat_acnode));
+  queue = malloc(total * sizeof(uint16_t));
+  if (!ac || !queue)
+    {
+      free(ac);
+      free(queue);
+      return -ENOMEM;
+    }
+
+  /* Build the trie of all strings */
+
+  for (i = 0; i < nstr; i++)
+    {
+      node = 0;
+      for (p = (FAR const unsigned char*)str[i]; *p != '\0'; p++)
         {
-          if (c == s[i_match])
+          child = chat_ac_child(ac, node, *p);
+          if (child == 0)
             {
-              /* Continue matching the next character */
+              child = nnodes++;
+              ac[child].c = *p;
+              ac[child].sibling = ac[node].child;
+              ac[node].child = child;
+            }
+
+          node = child;
+        }
 
-              i_match++;
+      if (node != 0 && ac[node].match == 0)
+        {
+          ac[node].match = i + 1;
+        }
+    }
+
+  /* Breadth-first, set the failure links.  A node also matches whatever
+   * its failure node matches.
+   */
+
+  head = 0;
+  tail = 0;
+  queue[tail++] = 0;
+
+  while (head < tail)
+    {
+      node = queue[head++];
+      for (child = ac[node].child; child != 0; child = ac[child].sibling)
+        {
+          if (node == 0)
+            {
+              ac[child].fail = 0;
             }
           else
             {
-              /* Match failed; start anew */
+              fail = ac[node].fail;
+              for (; ; )
+                {
+                  uint16_t next = chat_ac_child(ac, fail, ac[child].c);
+                  if (next != 0 || fail == 0)
+                    {
+                      ac[child].fail = next;
+                      break;
+                    }
+
+                  fail = ac[fail].fail;
+                }
+            }
 
-              i_match = 0;
+          if (ac[child].match == 0)
+            {
+              ac[child].match = ac[ac[child].fail].match;
             }
 
-          /* Update current time */
+          queue[tail++] = child;
+        }
+    }
 
-          clock_gettime(CLOCK_REALTIME, (FAR struct timespec*) &abstime);
+  free(queue);
+  *pac = ac;
+  return 0;
+}
+
+/* Advances the automaton by one character */
+
+static uint16_t chat_ac_step(FAR const struct chat_acnode* ac,
+                             uint16_t node, unsigned char c)
+{
+  uint16_t next;
+
+  for (; ; )
+    {
+      next = chat_ac_child(ac, node, c);
+      if (next != 0 || node == 0)
+        {
+          return next;
         }
+
+      node = ac[node].fail;
+    }
+}
+
+/* Waits for 's' or any of the ABORT strings.  Returns 0 when 's' is seen,
+ * -ECONNABORTED on an ABORT string and -ETIMEDOUT when the timeout expires
+ * first.
+ */
+
+static int chat_expect(FAR struct chat* priv, FAR const char* s)
+{
+  FAR const char* str[CONFIG_NETUTILS_CHAT_MAXABORTS + 1];
+  FAR struct chat_acnode* ac;
+  char buf[CONFIG_NETUTILS_CHAT_READSIZE];
+  struct timespec deadline;
+  uint16_t node = 0;
+  int match = 0;
+  int nstr;
+  int ret;
+  int i;
+
+  if (*s == '\0')
+    {
+      /* Nothing to wait for */
+
+      return 0;
+    }
+
+  /* The expected string is string 0, then come the ABORT strings */
+
+  str[0] = s;
+  for (nstr = 1; nstr <= priv->naborts; nstr++)
+    {
+      str[nstr] = priv->aborts[nstr - 1];
+    }
+
+  ret = chat_ac_build(str, nstr, &ac);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  /* Set the deadline */
+
+  clock_gettime(CHAT_CLOCK, &deadline);
+  deadline.tv_sec += priv->ctl.timeout;
+
+  while (match == 0)
+    {
+      ret = chat_read(priv, buf, sizeof(buf), chat_ms_left(&deadline));
+      if (ret < 0)
+        {
+          break;
+        }
+
+      for (i = 0; i < ret; i++)
+        {
+          node = chat_ac_step(ac, node, buf[i]);
+          match = ac[node].match;
+          if (match != 0)
+            {
+              /* Anything after the match is discarded, as the following
+               * flush would do.
+               */
+
+              break;
+            }
+        }
+    }
+
+  free(ac);
+
+  if (match == 1)
+    {
+      ret = 0;
+    }
+  else if (match > 1)
+    {
+      if (priv->ctl.verbose)
+        {
+          fprintf(stderr, "chat: abort on %s\n", str[match - 1]);
+        }
+
+      ret = -ECONNABORTED;
     }
 
   _info("result %d\n", ret);
@@ -584,11 +819,23 @@ static int chat_line_run(FAR struct chat* priv,
       switch (line->lhs.command)
         {
         case CHAT_COMMAND_ABORT:
-          /* TODO */
+          if (*line->rhs == '\0')
+            {
+              break;
+            }
+
+          if (priv->naborts >= CONFIG_NETUTILS_CHAT_MAXABORTS)
+            {
+              _info("too many ABORT strings\n");
+              ret = -E2BIG;
+              break;
+            }
+
+          priv->aborts[priv->naborts++] = line->rhs;
           break;
 
         case CHAT_COMMAND_ECHO:
-          if (strcmp(line->rhs, "ON"))
+          if (!strcmp(line->rhs, "ON"))
             {
               priv->ctl.echo = true;
             }
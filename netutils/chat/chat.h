@@ -42,6 +42,18 @@
 
 #include "netutils/chat.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_NETUTILS_CHAT_MAXABORTS
+#  define CONFIG_NETUTILS_CHAT_MAXABORTS 8
+#endif
+
+#ifndef CONFIG_NETUTILS_CHAT_READSIZE
+#  define CONFIG_NETUTILS_CHAT_READSIZE 64
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -91,6 +103,11 @@ struct chat
 {
   struct chat_ctl ctl;             /* Embedded 'chat_ctl' type. */
   FAR struct chat_line* script;    /* first line of the script */
+
+  /* ABORT strings, watched for together with every expectation */
+
+  FAR const char* aborts[CONFIG_NETUTILS_CHAT_MAXABORTS];
+  int naborts;
 };
 
 #endif /* __APPS_NETUTILS_CHAT_CHAT_H */
@@ -53,6 +53,8 @@
  * Included Files
  ****************************************************************************/
 
+#include <sys/types.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
@@ -61,30 +63,306 @@
 
 #ifdef CONFIG_CODECS_BASE64
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Decode table entries that are not 6-bit values */
+
+#define BASE64_PAD      0x40  /* The padding character */
+#define BASE64_INVALID  0x80  /* Not part of the alphabet, skipped */
+#define BASE64_NOTVALUE 0xc0  /* Any of the above */
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Encoding alphabets.  The web safe variant also pads with '.' */
+
+static const char g_base64_etab[64] =
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char g_base64w_etab[64] =
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+/* Decoding tables: the 6-bit value of each character, BASE64_PAD or
+ * BASE64_INVALID.
+ */
+
+static const unsigned char g_base64_dtab[256] =
+{
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x3e, 0x80, 0x80, 0x80, 0x3f,
+  0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+  0x3c, 0x3d, 0x80, 0x80, 0x80, 0x40, 0x80, 0x80,
+  0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+  0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+  0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+  0x17, 0x18, 0x19, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
+  0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30,
+  0x31, 0x32, 0x33, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+};
+
+static const unsigned char g_base64w_dtab[256] =
+{
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x3e, 0x40, 0x80,
+  0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+  0x3c, 0x3d, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+  0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+  0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+  0x17, 0x18, 0x19, 0x80, 0x80, 0x80, 0x80, 0x3f,
+  0x80, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
+  0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30,
+  0x31, 0x32, 0x33, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+};
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
 /****************************************************************************
- * Name: base64_tab
+ * Name: base64_encode_groups
+ *
+ * Description:
+ *   Encode ngroups whole groups of 3 bytes.  Each group is loaded into one
+ *   24-bit word from which the four characters are extracted.
+ *
+ ****************************************************************************/
+
+static unsigned char *base64_encode_groups(const char *etab,
+                                           const unsigned char *in,
+                                           size_t ngroups,
+                                           unsigned char *out)
+{
+  uint32_t w;
+
+  for (; ngroups > 0; ngroups--, in += 3, out += 4)
+    {
+      w = ((uint32_t)in[0] << 16) | ((uint32_t)in[1] << 8) | in[2];
+
+      out[0] = etab[w >> 18];
+      out[1] = etab[(w >> 12) & 0x3f];
+      out[2] = etab[(w >> 6) & 0x3f];
+      out[3] = etab[w & 0x3f];
+    }
+
+  return out;
+}
+
+/****************************************************************************
+ * Name: base64_encode_tail
+ *
+ * Description:
+ *   Encode the last 1 or 2 bytes of the input with padding.
+ *
  ****************************************************************************/
 
-static void base64_tab(unsigned char *tab, size_t len, bool websafe)
+static unsigned char *base64_encode_tail(const char *etab,
+                                         const unsigned char *in,
+                                         size_t len, unsigned char *out)
 {
-  static const char *_tab =
-    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  char ch = (etab == g_base64w_etab) ? '.' : '=';
 
-  memset(tab, 0, len);
-  if (len >= 64)
+  *out++ = etab[in[0] >> 2];
+  if (len == 1)
+    {
+      *out++ = etab[(in[0] & 0x03) << 4];
+      *out++ = ch;
+    }
+  else
     {
-      memcpy(tab, _tab, 64);
+      *out++ = etab[((in[0] & 0x03) << 4) | (in[1] >> 4)];
+      *out++ = etab[(in[1] & 0x0f) << 2];
     }
 
-  if (websafe)
+  *out++ = ch;
+  return out;
+}
+
+/****************************************************************************
+ * Name: base64_decode_quad
+ *
+ * Description:
+ *   Output the bytes of a group of 4 decoded values.  The group ends the
+ *   data if it holds padding.
+ *
+ ****************************************************************************/
+
+static unsigned char *base64_decode_quad(const unsigned char *v,
+                                         unsigned char *out)
+{
+  uint32_t w;
+
+  w = ((uint32_t)(v[0] & 0x3f) << 18) | ((uint32_t)(v[1] & 0x3f) << 12) |
+      ((uint32_t)(v[2] & 0x3f) << 6)  |  (uint32_t)(v[3] & 0x3f);
+
+  *out++ = (unsigned char)(w >> 16);
+  if (v[2] != BASE64_PAD)
     {
-      tab[62] = '-';
-      tab[63] = '_';
+      *out++ = (unsigned char)(w >> 8);
+      if (v[3] != BASE64_PAD)
+        {
+          *out++ = (unsigned char)w;
+        }
     }
+
+  return out;
+}
+
+/****************************************************************************
+ * Name: base64_decode_run
+ *
+ * Description:
+ *   Decode src into out, continuing the partial group held in s.  Runs of
+ *   4 alphabet characters are decoded a word at a time; characters outside
+ *   of the alphabet and padding take the slower path.
+ *
+ ****************************************************************************/
+
+static unsigned char *base64_decode_run(struct base64_stream_s *s,
+                                        const unsigned char *src,
+                                        size_t len, unsigned char *out)
+{
+  const unsigned char *dtab = s->websafe ? g_base64w_dtab : g_base64_dtab;
+  const unsigned char *end = src + len;
+  unsigned char v0;
+  unsigned char v1;
+  unsigned char v2;
+  unsigned char v3;
+  unsigned char v;
+  uint32_t w;
+
+  while (src < end)
+    {
+      if (s->n == 0)
+        {
+          while (end - src >= 4)
+            {
+              v0 = dtab[src[0]];
+              v1 = dtab[src[1]];
+              v2 = dtab[src[2]];
+              v3 = dtab[src[3]];
+
+              if (((v0 | v1 | v2 | v3) & BASE64_NOTVALUE) != 0)
+                {
+                  break;
+                }
+
+              w = ((uint32_t)v0 << 18) | ((uint32_t)v1 << 12) |
+                  ((uint32_t)v2 << 6)  |  (uint32_t)v3;
+
+              out[0] = (unsigned char)(w >> 16);
+              out[1] = (unsigned char)(w >> 8);
+              out[2] = (unsigned char)w;
+              out   += 3;
+              src   += 4;
+            }
+
+          if (src >= end)
+            {
+              break;
+            }
+        }
+
+      v = dtab[*src++];
+      if (v != BASE64_INVALID)
+        {
+          s->buf[s->n++] = v;
+          if (s->n == 4)
+            {
+              out  = base64_decode_quad(s->buf, out);
+              s->n = 0;
+            }
+        }
+    }
+
+  return out;
+}
+
+/****************************************************************************
+ * Name: _base64_decode_len
+ *
+ * Description:
+ *   Count the output of each group of 4 values the way that
+ *   base64_decode_quad() produces it, so that padding is honoured in every
+ *   group and not only in the last one.
+ *
+ ****************************************************************************/
+
+static ssize_t _base64_decode_len(const unsigned char *src, size_t len,
+                                  bool websafe)
+{
+  const unsigned char *dtab = websafe ? g_base64w_dtab : g_base64_dtab;
+  unsigned char v[4];
+  size_t count = 0;
+  unsigned int n = 0;
+  size_t i;
+
+  for (i = 0; i < len; i++)
+    {
+      if (dtab[src[i]] == BASE64_INVALID)
+        {
+          continue;
+        }
+
+      v[n++] = dtab[src[i]];
+      if (n == 4)
+        {
+          count += v[2] == BASE64_PAD ? 1 : v[3] == BASE64_PAD ? 2 : 3;
+          n = 0;
+        }
+    }
+
+  if (n != 0)
+    {
+      return ERROR;
+    }
+
+  return count;
 }
 
 /****************************************************************************
@@ -100,11 +378,12 @@ static void base64_tab(unsigned char *tab, size_t len, bool websafe)
  * Input Parameters:
  *   src: Data to be encoded
  *   len: Length of the data to be encoded
+ *   dst: Buffer of at least base64_encode_len(len) + 1 bytes, or NULL to
+ *        allocate the output
  *   out_len: Pointer to output length variable, or NULL if not used
  *
  * Returned Value:
- *   Returns: Allocated buffer of out_len bytes of encoded data,
- *   or NULL on failure
+ *   Returns: Buffer of out_len bytes of encoded data, or NULL on failure
  *
  ****************************************************************************/
 
@@ -112,91 +391,35 @@ static unsigned char *_base64_encode(const unsigned char *src, size_t len,
                                      unsigned char *dst, size_t * out_len,
                                      bool websafe)
 {
+  const char *etab = websafe ? g_base64w_etab : g_base64_etab;
   unsigned char *out;
   unsigned char *pos;
-  const unsigned char *end;
-  const unsigned char *in;
-  size_t olen;
-/*int line_len; */
-  unsigned char base64_table[64];
-  char ch = '=';
-
-  if (websafe)
-    {
-      ch = '.';
-    }
-
-  base64_tab(base64_table, sizeof(base64_table), websafe);
-  olen = len * 4 / 3 + 4;       /* 3-byte blocks to 4-byte */
-
-#if 0
-  olen += olen / 72; /* line feeds */
-  olen++; /* nul termination */
-  out = malloc(olen);
-  if (out == NULL)
-    {
-      return NULL;
-    }
-#endif
-
-  end = src + len;
-  in = src;
 
   if (dst)
     {
-      pos = out = dst;
+      out = dst;
     }
   else
     {
-      pos = out = malloc(olen);
+      out = malloc(base64_encode_len(len) + 1);
       if (out == NULL)
         {
           return NULL;
         }
     }
 
-/*line_len = 0; */
-  while (end - in >= 3)
+  pos = base64_encode_groups(etab, src, len / 3, out);
+  if (len % 3)
     {
-      *pos++ = base64_table[in[0] >> 2];
-      *pos++ = base64_table[((in[0] & 0x03) << 4) | (in[1] >> 4)];
-      *pos++ = base64_table[((in[1] & 0x0f) << 2) | (in[2] >> 6)];
-      *pos++ = base64_table[in[2] & 0x3f];
-      in += 3;
-   /* line_len += 4; */
+      pos = base64_encode_tail(etab, src + len / 3 * 3, len % 3, pos);
     }
 
-  if (end - in)
-    {
-      *pos++ = base64_table[in[0] >> 2];
-      if (end - in == 1)
-        {
-          *pos++ = base64_table[(in[0] & 0x03) << 4];
-          *pos++ = ch;          /* *pos++ = '='; */
-        }
-      else
-        {
-          *pos++ = base64_table[((in[0] & 0x03) << 4) | (in[1] >> 4)];
-          *pos++ = base64_table[(in[1] & 0x0f) << 2];
-        }
-      *pos++ = ch;              /* *pos++ = '='; */
-   /* line_len += 4; */
-    }
-
-#if 0
-  if (line_len)
-    {
-      *pos++ = '\n';
-    }
-#endif
-
   *pos = '\0';
   if (out_len)
     {
       *out_len = pos - out;
     }
 
-/*out[*out_len] = '\0'; */
   return out;
 }
 
@@ -211,101 +434,55 @@ static unsigned char *_base64_encode(const unsigned char *src, size_t len,
  * Input Parameters:
  *   src: Data to be decoded
  *   len: Length of the data to be decoded
+ *   dst: Buffer of at least base64_decode_len(src, len) bytes, or NULL to
+ *        allocate the output
  *   out_len: Pointer to output length variable
  *
  * Returned Value:
- *   Returns: Allocated buffer of out_len bytes of decoded data,
- *   or NULL on failure
+ *   Returns: Buffer of out_len bytes of decoded data, or NULL on failure
  *
  ****************************************************************************/
 
 static unsigned char *_base64_decode(const unsigned char *src, size_t len,
-                              unsigned char *dst, size_t * out_len,
-                              bool websafe)
+                                     unsigned char *dst, size_t * out_len,
+                                     bool websafe)
 {
-  unsigned char dtable[256];
+  struct base64_stream_s s;
   unsigned char *out;
   unsigned char *pos;
-  unsigned char in[4];
-  unsigned char block[4];
-  unsigned char tmp;
-  size_t count;
-  size_t i;
-  unsigned char base64_table[64];
-  char ch = '=';
-
-  if (websafe)
-    {
-      ch = '.';
-    }
-  base64_tab(base64_table, sizeof(base64_table), websafe);
-
-  memset(dtable, 0x80, 256);
-  for (i = 0; i < sizeof(base64_table); i++)
-    {
-      dtable[base64_table[i]] = i;
-    }
-
-  dtable[(int)ch] = 0;          /* dtable['='] = 0; */
-
-  count = 0;
-  for (i = 0; i < len; i++)
-    {
-      if (dtable[src[i]] != 0x80)
-        {
-          count++;
-        }
-    }
-
-  if (count % 4)
-    {
-      return NULL;
-    }
+  ssize_t count;
 
   if (dst)
     {
-      pos = out = dst;
+      out = dst;
     }
   else
     {
-      pos = out = malloc(count);
-      if (out == NULL)
+      count = _base64_decode_len(src, len, websafe);
+      if (count < 0)
         {
           return NULL;
         }
-    }
 
-  count = 0;
-  for (i = 0; i < len; i++)
-    {
-      tmp = dtable[src[i]];
-      if (tmp == 0x80)
-        {
-          continue;
-        }
+      /* Keep one byte so that empty input does not return NULL */
 
-      in[count] = src[i];
-      block[count] = tmp;
-      count++;
-      if (count == 4)
+      out = malloc(count + 1);
+      if (out == NULL)
         {
-          *pos++ = (block[0] << 2) | (block[1] >> 4);
-          *pos++ = (block[1] << 4) | (block[2] >> 2);
-          *pos++ = (block[2] << 6) | block[3];
-          count = 0;
+          return NULL;
         }
     }
 
-  if (pos > out)
+  base64_stream_init(&s, websafe);
+  pos = base64_decode_run(&s, src, len, out);
+  if (s.n != 0)
     {
-      if (in[2] == ch)          /* if (in[2] == '=') */
+      if (out != dst)
         {
-          pos -= 2;
-        }
-      else if (in[3] == ch)     /* else if (in[3] == '=') */
-        {
-          pos--;
+          free(out);
         }
+
+      return NULL;
     }
 
   *out_len = pos - out;
@@ -356,4 +533,161 @@ unsigned char *base64w_decode(const unsigned char *src, size_t len,
   return _base64_decode(src, len, dst, out_len, true);
 }
 
+/****************************************************************************
+ * Name: base64_decode_len
+ *
+ * Description:
+ *   Return the number of bytes base64_decode() produces from src, or ERROR
+ *   if src does not hold a whole number of 4 character groups.  The length
+ *   is exact for canonical input, with padding only in the last group.
+ *   Padding in an earlier group is counted the way the decoder handles it,
+ *   as the end of that group.
+ *
+ ****************************************************************************/
+
+ssize_t base64_decode_len(const unsigned char *src, size_t len)
+{
+  return _base64_decode_len(src, len, false);
+}
+
+/****************************************************************************
+ * Name: base64w_decode_len
+ ****************************************************************************/
+
+ssize_t base64w_decode_len(const unsigned char *src, size_t len)
+{
+  return _base64_decode_len(src, len, true);
+}
+
+/****************************************************************************
+ * Name: base64_stream_init
+ *
+ * Description:
+ *   Prepare a stream for base64_encode_update()/base64_encode_final() or
+ *   base64_decode_update()/base64_decode_final().
+ *
+ ****************************************************************************/
+
+void base64_stream_init(struct base64_stream_s *s, bool websafe)
+{
+  s->n       = 0;
+  s->websafe = websafe;
+}
+
+/****************************************************************************
+ * Name: base64_encode_update
+ *
+ * Description:
+ *   Encode the next len bytes of a stream.  Up to 2 bytes are held back
+ *   until more data or base64_encode_final().  dst must have room for
+ *   base64_encode_len(len) bytes; no nul terminator is written.
+ *
+ * Returned Value:
+ *   The number of characters written to dst.
+ *
+ ****************************************************************************/
+
+size_t base64_encode_update(struct base64_stream_s *s,
+                            const unsigned char *src, size_t len,
+                            unsigned char *dst)
+{
+  const char *etab = s->websafe ? g_base64w_etab : g_base64_etab;
+  unsigned char *pos = dst;
+  size_t ngroups;
+
+  /* Complete the held back group first */
+
+  if (s->n > 0)
+    {
+      while (s->n < 3 && len > 0)
+        {
+          s->buf[s->n++] = *src++;
+          len--;
+        }
+
+      if (s->n < 3)
+        {
+          return 0;
+        }
+
+      pos  = base64_encode_groups(etab, s->buf, 1, pos);
+      s->n = 0;
+    }
+
+  ngroups = len / 3;
+  pos     = base64_encode_groups(etab, src, ngroups, pos);
+  src    += ngroups * 3;
+  len    -= ngroups * 3;
+
+  memcpy(s->buf, src, len);
+  s->n = len;
+
+  return pos - dst;
+}
+
+/****************************************************************************
+ * Name: base64_encode_final
+ *
+ * Description:
+ *   Encode the held back bytes of a stream with padding.  dst must have
+ *   room for 4 bytes; no nul terminator is written.
+ *
+ * Returned Value:
+ *   The number of characters written to dst.
+ *
+ ****************************************************************************/
+
+size_t base64_encode_final(struct base64_stream_s *s, unsigned char *dst)
+{
+  const char *etab = s->websafe ? g_base64w_etab : g_base64_etab;
+  size_t n = s->n;
+
+  s->n = 0;
+  if (n == 0)
+    {
+      return 0;
+    }
+
+  return base64_encode_tail(etab, s->buf, n, dst) - dst;
+}
+
+/****************************************************************************
+ * Name: base64_decode_update
+ *
+ * Description:
+ *   Decode the next len characters of a stream.  The groups of 4
+ *   characters may be split anywhere between calls.  dst must have room for
+ *   len / 4 * 3 + 3 bytes.
+ *
+ * Returned Value:
+ *   The number of bytes written to dst.
+ *
+ ****************************************************************************/
+
+size_t base64_decode_update(struct base64_stream_s *s,
+                            const unsigned char *src, size_t len,
+                            unsigned char *dst)
+{
+  return base64_decode_run(s, src, len, dst) - dst;
+}
+
+/****************************************************************************
+ * Name: base64_decode_final
+ *
+ * Description:
+ *   End a decoded stream.
+ *
+ * Returned Value:
+ *   OK if the stream held a whole number of groups, otherwise ERROR.
+ *
+ ****************************************************************************/
+
+int base64_decode_final(struct base64_stream_s *s)
+{
+  int ret = (s->n == 0) ? OK : ERROR;
+
+  s->n = 0;
+  return ret;
+}
+
 #endif /* CONFIG_CODECS_BASE64 */
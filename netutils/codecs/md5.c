@@ -60,10 +60,14 @@
 
 #include <nuttx/config.h>
 
+#include <sys/types.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
 
 #include "netutils/md5.h"
 
@@ -86,33 +90,92 @@
 #  define MD5STEP(f, w, x, y, z, data, s) \
         ( w += f(x, y, z) + data,  w = w<<s | w>>(32-s),  w += x )
 
+/* Size of the blocks md5_file() reads, a multiple of the 64 byte MD5 block */
+
+#  ifndef CONFIG_CODECS_HASH_MD5_FILEBUF
+#    define CONFIG_CODECS_HASH_MD5_FILEBUF 4096
+#  endif
+
+/* Whole blocks go to the registered backend, if any */
+
+#  ifdef CONFIG_CODECS_HASH_MD5_BACKEND
+#    define MD5BLOCKS(state, data, n) g_md5_blocks(state, data, n)
+#  else
+#    define MD5BLOCKS(state, data, n) md5_blocks(state, data, n)
+#  endif
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static void md5_blocks(FAR uint32_t state[4], FAR const uint8_t *data,
+                       size_t nblocks);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#ifdef CONFIG_CODECS_HASH_MD5_BACKEND
+static md5_blocks_t g_md5_blocks = md5_blocks;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
 /****************************************************************************
- * Name: byteReverse
+ * Name: md5_blocks
+ *
+ * Description:
+ *   Portable processing of whole 64-byte blocks.  On little-endian targets
+ *   aligned blocks are used in place, the others are assembled a byte at a
+ *   time so no copy or byte reversal of the block is needed.
+ *
  ****************************************************************************/
 
-#ifndef CONFIG_ENDIAN_BIG
-#  define byteReverse(buf, len)
-#else
-static void byteReverse(FAR unsigned char *buf, unsigned longs)
+static void md5_blocks(FAR uint32_t state[4], FAR const uint8_t *data,
+                       size_t nblocks)
 {
-  uint32_t t;
-  do
+  FAR const uint32_t *in;
+  uint32_t x[16];
+  int i;
+
+  for (; nblocks > 0; nblocks--, data += 64)
     {
-      t = ((uint32_t)buf[3] << 24) |
-          ((uint32_t)buf[2] << 16) |
-          ((uint32_t)buf[1] << 8)  |
-           (uint32_t)buf[0];
+#ifndef CONFIG_ENDIAN_BIG
+      if (((uintptr_t)data & 3) == 0)
+        {
+          in = (FAR const uint32_t *)data;
+        }
+      else
+#endif
+        {
+          for (i = 0; i < 16; i++)
+            {
+              x[i] =  (uint32_t)data[4 * i]             |
+                     ((uint32_t)data[4 * i + 1] << 8)  |
+                     ((uint32_t)data[4 * i + 2] << 16) |
+                     ((uint32_t)data[4 * i + 3] << 24);
+            }
+
+          in = x;
+        }
 
-      *(uint32_t*)buf = t;
-      buf += 4;
+      MD5Transform(state, in);
     }
-  while (--longs);
 }
-#endif
+
+/****************************************************************************
+ * Name: md5_putle32
+ ****************************************************************************/
+
+static inline void md5_putle32(FAR uint8_t *p, uint32_t v)
+{
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
 
 /****************************************************************************
  * Public Functions
@@ -181,21 +244,19 @@ void MD5Update(struct MD5Context *ctx, unsigned char const *buf, unsigned len)
         }
 
       memcpy(p, buf, t);
-      byteReverse(ctx->in, 16);
-      MD5Transform(ctx->buf, (uint32_t *) ctx->in);
+      MD5BLOCKS(ctx->buf, ctx->in, 1);
       buf += t;
       len -= t;
     }
 
-  /* Process data in 64-byte chunks */
+  /* Process all whole 64-byte blocks straight from the caller's buffer */
 
-  while (len >= 64)
+  if (len >= 64)
     {
-      memcpy(ctx->in, buf, 64);
-      byteReverse(ctx->in, 16);
-      MD5Transform(ctx->buf, (uint32_t *) ctx->in);
-      buf += 64;
-      len -= 64;
+      t = len >> 6;
+      MD5BLOCKS(ctx->buf, buf, t);
+      buf += t << 6;
+      len &= 0x3f;
     }
 
   /* Handle any remaining bytes of data. */
@@ -239,8 +300,7 @@ void MD5Final(unsigned char digest[16], struct MD5Context *ctx)
       /* Two lots of padding: Pad the first block to 64 bytes */
 
       memset(p, 0, count);
-      byteReverse(ctx->in, 16);
-      MD5Transform(ctx->buf, (uint32_t *) ctx->in);
+      MD5BLOCKS(ctx->buf, ctx->in, 1);
 
       /* Now fill the next block with 56 bytes */
 
@@ -253,16 +313,17 @@ void MD5Final(unsigned char digest[16], struct MD5Context *ctx)
       memset(p, 0, count - 8);
     }
 
-  byteReverse(ctx->in, 14);
-
   /* Append length in bits and transform */
 
-  ((uint32_t *)ctx->in)[14] = ctx->bits[0];
-  ((uint32_t *)ctx->in)[15] = ctx->bits[1];
+  md5_putle32(&ctx->in[56], ctx->bits[0]);
+  md5_putle32(&ctx->in[60], ctx->bits[1]);
+
+  MD5BLOCKS(ctx->buf, ctx->in, 1);
 
-  MD5Transform(ctx->buf, (uint32_t *) ctx->in);
-  byteReverse((unsigned char *)ctx->buf, 4);
-  memcpy(digest, ctx->buf, 16);
+  for (count = 0; count < 4; count++)
+    {
+      md5_putle32(&digest[4 * count], ctx->buf[count]);
+    }
   memset(ctx, 0, sizeof(struct MD5Context));  /* In case it's sensitive */
 }
 
@@ -381,6 +442,28 @@ void md5_sum(const uint8_t * addr, const size_t len, uint8_t * mac)
   MD5Final(mac, &ctx);
 }
 
+/****************************************************************************
+ * Name: md5_tohex
+ *
+ * Description:
+ *   Convert a digest to a NUL terminated string of 32 hex digits.
+ *
+ ****************************************************************************/
+
+void md5_tohex(FAR const uint8_t digest[16], FAR char hash[33])
+{
+  static const char hexchars[] = "0123456789abcdef";
+  int i;
+
+  for (i = 0; i < 16; i++)
+    {
+      *hash++ = hexchars[digest[i] >> 4];
+      *hash++ = hexchars[digest[i] & 0x0f];
+    }
+
+  *hash = '\0';
+}
+
 /****************************************************************************
  * Name: md5_hash
  ****************************************************************************/
@@ -389,17 +472,105 @@ char *md5_hash(const uint8_t * addr, const size_t len)
 {
   uint8_t digest[16];
   char *hash;
-  int i;
 
   hash = malloc(33);
-  md5_sum(addr, len, digest);
-  for (i = 0; i < 16; i++)
+  if (hash != NULL)
     {
-      sprintf(&hash[i * 2], "%02x", digest[i]);
+      md5_sum(addr, len, digest);
+      md5_tohex(digest, hash);
     }
 
-  hash[32] = 0;
   return hash;
 }
 
+/****************************************************************************
+ * Name: md5_file
+ *
+ * Description:
+ *   MD5 hash of a file.  The file is read in aligned blocks of
+ *   CONFIG_CODECS_HASH_MD5_FILEBUF bytes that are hashed in place.
+ *
+ * Input Parameters:
+ *   path: Path to the file
+ *   mac: Buffer for the hash
+ *
+ * Returned Value:
+ *   OK on success; ERROR with errno set on failure.
+ *
+ ****************************************************************************/
+
+int md5_file(FAR const char *path, FAR uint8_t *mac)
+{
+  MD5_CTX ctx;
+  FAR uint8_t *buffer;
+  ssize_t nread;
+  int errcode = 0;
+  int fd;
+
+  fd = open(path, O_RDONLY);
+  if (fd < 0)
+    {
+      return ERROR;
+    }
+
+  buffer = malloc(CONFIG_CODECS_HASH_MD5_FILEBUF);
+  if (buffer == NULL)
+    {
+      close(fd);
+      errno = ENOMEM;
+      return ERROR;
+    }
+
+  MD5Init(&ctx);
+  for (; ; )
+    {
+      nread = read(fd, buffer, CONFIG_CODECS_HASH_MD5_FILEBUF);
+      if (nread < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          errcode = errno;
+          break;
+        }
+      else if (nread == 0)
+        {
+          break;
+        }
+
+      MD5Update(&ctx, buffer, nread);
+    }
+
+  free(buffer);
+  close(fd);
+
+  if (errcode != 0)
+    {
+      errno = errcode;
+      return ERROR;
+    }
+
+  MD5Final(mac, &ctx);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: md5_set_backend
+ *
+ * Description:
+ *   Register the function that processes whole 64-byte blocks, for example
+ *   with a hash peripheral.  The function updates the four state words with
+ *   nblocks blocks of message bytes.  NULL restores the portable code.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_CODECS_HASH_MD5_BACKEND
+void md5_set_backend(md5_blocks_t blocks)
+{
+  g_md5_blocks = (blocks != NULL) ? blocks : md5_blocks;
+}
+#endif
+
 #endif /* CONFIG_CODECS_HASH_MD5 */
@@ -37,6 +37,7 @@
  * Included Files
  ****************************************************************************/
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -67,6 +68,34 @@
     { \
       value = ch - 'A' + 10; \
     }
+
+/* Characters passed through unchanged by urlencode().  A space becomes
+ * '+'; everything else becomes a %XX escape.
+ */
+
+#  define IS_UNRESERVED(ch) \
+  ((ch >= '0' && ch <= '9') || \
+   (ch >= 'a' && ch <= 'z') || \
+   (ch >= 'A' && ch <= 'Z') || \
+   ch == '_' || ch == '-' || ch == '.' || ch == '~')
+
+#  define URLENCODE_CHARLEN(ch) \
+  ((IS_UNRESERVED(ch) || ch == ' ') ? 1 : 3)
+
+/* Parts of a field visited by urlencode_fields() */
+
+#  define URLENCODE_SEPARATOR 0
+#  define URLENCODE_NAME      1
+#  define URLENCODE_EQUALS    2
+#  define URLENCODE_VALUE     3
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#ifdef CONFIG_CODECS_URLCODE
+static const unsigned char g_hexchars[] = "0123456789ABCDEF";
 #endif
 
 /****************************************************************************
@@ -163,6 +192,50 @@ static unsigned char h2int(char c)
 }
 #endif
 
+/****************************************************************************
+ * Name: urlencode_part
+ *
+ * Description:
+ *   Encode the string 'src' from offset *offset into 'dest' until either
+ *   the string or the space in 'dest' is exhausted.  An escape sequence is
+ *   never split.  Returns the number of bytes written and advances
+ *   *offset past the characters that were encoded.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_CODECS_URLCODE
+static int urlencode_part(FAR const char *src, FAR size_t *offset,
+                          FAR char *dest, int destlen)
+{
+  FAR const unsigned char *pSrc = (FAR const unsigned char *)src + *offset;
+  FAR char *pDest = dest;
+  FAR char *pEnd  = dest + destlen;
+
+  while (*pSrc != '\0' && pEnd - pDest >= URLENCODE_CHARLEN(*pSrc))
+    {
+      if (IS_UNRESERVED(*pSrc))
+        {
+          *pDest++ = *pSrc;
+        }
+      else if (*pSrc == ' ')
+        {
+          *pDest++ = '+';
+        }
+      else
+        {
+          *pDest++ = '%';
+          *pDest++ = g_hexchars[(*pSrc) >> 4];
+          *pDest++ = g_hexchars[(*pSrc) & 0x0F];
+        }
+
+      pSrc++;
+    }
+
+  *offset = (FAR const char *)pSrc - src;
+  return pDest - dest;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -260,7 +333,6 @@ char *url_decode(char *str)
 #ifdef CONFIG_CODECS_URLCODE
 char *urlencode(const char *src, const int src_len, char *dest, int *dest_len)
 {
-  static const unsigned char hex_chars[] = "0123456789ABCDEF";
   const unsigned char *pSrc;
   const unsigned char *pEnd;
   char *pDest;
@@ -269,10 +341,7 @@ char *urlencode(const char *src, const int src_len, char *dest, int *dest_len)
   pEnd = (unsigned char *)src + src_len;
   for (pSrc = (unsigned char *)src; pSrc < pEnd; pSrc++)
     {
-      if ((*pSrc >= '0' && *pSrc <= '9') ||
-          (*pSrc >= 'a' && *pSrc <= 'z') ||
-          (*pSrc >= 'A' && *pSrc <= 'Z') ||
-          (*pSrc == '_' || *pSrc == '-' || *pSrc == '.' || *pSrc == '~'))
+      if (IS_UNRESERVED(*pSrc))
         {
           *pDest++ = *pSrc;
         }
@@ -283,8 +352,8 @@ char *urlencode(const char *src, const int src_len, char *dest, int *dest_len)
       else
         {
           *pDest++ = '%';
-          *pDest++ = hex_chars[(*pSrc) >> 4];
-          *pDest++ = hex_chars[(*pSrc) & 0x0F];
+          *pDest++ = g_hexchars[(*pSrc) >> 4];
+          *pDest++ = g_hexchars[(*pSrc) & 0x0F];
         }
     }
 
@@ -364,17 +433,7 @@ int urlencode_len(const char *src, const int src_len)
   pEnd = (unsigned char *)src + src_len;
   for (pSrc = (unsigned char *)src; pSrc < pEnd; pSrc++)
     {
-      if ((*pSrc >= '0' && *pSrc <= '9') ||
-          (*pSrc >= 'a' && *pSrc <= 'z') ||
-          (*pSrc >= 'A' && *pSrc <= 'Z') ||
-          (*pSrc == '_' || *pSrc == '-' || *pSrc == '.' || *pSrc == '~' || *pSrc == ' '))
-        {
-          len++;
-        }
-      else
-        {
-          len+=3;
-        }
+      len += URLENCODE_CHARLEN(*pSrc);
     }
 
   return len;
@@ -417,6 +476,196 @@ int urldecode_len(const char *src, const int src_len)
 }
 #endif
 
+/****************************************************************************
+ * Name: urlencode_fieldslen
+ *
+ * Description:
+ *   Return the exact length of the form encoding of 'fields', i.e. of
+ *   "name1=value1&name2=value2...", without producing it.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_CODECS_URLCODE
+int urlencode_fieldslen(FAR const struct urlencode_field_s *fields,
+                        int nfields)
+{
+  FAR const unsigned char *pSrc;
+  int len = 0;
+  int i;
+
+  for (i = 0; i < nfields; i++)
+    {
+      /* One '=' per field and one '&' between fields */
+
+      len += i > 0 ? 2 : 1;
+
+      for (pSrc = (FAR const unsigned char *)fields[i].name; *pSrc; pSrc++)
+        {
+          len += URLENCODE_CHARLEN(*pSrc);
+        }
+
+      if (fields[i].value != NULL)
+        {
+          for (pSrc = (FAR const unsigned char *)fields[i].value; *pSrc;
+               pSrc++)
+            {
+              len += URLENCODE_CHARLEN(*pSrc);
+            }
+        }
+    }
+
+  return len;
+}
+#endif
+
+/****************************************************************************
+ * Name: urlencode_fieldsinit
+ ****************************************************************************/
+
+#ifdef CONFIG_CODECS_URLCODE
+void urlencode_fieldsinit(FAR struct urlencode_state_s *state)
+{
+  state->field  = 0;
+  state->part   = URLENCODE_NAME;
+  state->offset = 0;
+}
+#endif
+
+/****************************************************************************
+ * Name: urlencode_fields
+ *
+ * Description:
+ *   Produce the next piece of the form encoding of 'fields' directly in
+ *   'dest', which is typically the buffer about to be passed to send().
+ *   No intermediate copies are made and no terminating NUL is written.
+ *   'destlen' must be at least 3 so that an escape sequence always fits.
+ *   Returns the number of bytes written, zero once the encoding is
+ *   complete.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_CODECS_URLCODE
+int urlencode_fields(FAR struct urlencode_state_s *state,
+                     FAR const struct urlencode_field_s *fields,
+                     int nfields, FAR char *dest, int destlen)
+{
+  FAR const char *src;
+  int len = 0;
+
+  while (state->field < nfields && len < destlen)
+    {
+      switch (state->part)
+        {
+          case URLENCODE_SEPARATOR:
+            dest[len++] = '&';
+            state->part = URLENCODE_NAME;
+            break;
+
+          case URLENCODE_EQUALS:
+            dest[len++] = '=';
+            state->part = URLENCODE_VALUE;
+            break;
+
+          case URLENCODE_NAME:
+          case URLENCODE_VALUE:
+            src = state->part == URLENCODE_NAME ?
+                  fields[state->field].name : fields[state->field].value;
+            if (src != NULL)
+              {
+                len += urlencode_part(src, &state->offset, &dest[len],
+                                      destlen - len);
+                if (src[state->offset] != '\0')
+                  {
+                    /* Out of space in the middle of the string */
+
+                    return len;
+                  }
+              }
+
+            state->offset = 0;
+            if (state->part == URLENCODE_NAME)
+              {
+                state->part = URLENCODE_EQUALS;
+              }
+            else
+              {
+                state->part = URLENCODE_SEPARATOR;
+                state->field++;
+              }
+            break;
+        }
+    }
+
+  return len;
+}
+#endif
+
+/****************************************************************************
+ * Name: urldecode_query
+ *
+ * Description:
+ *   Split the next "name=value" field off a form-encoded query string and
+ *   decode the name and the value in place.  The query string is modified.
+ *   A field without '=' yields an empty value.
+ *
+ * Returned Value:
+ *   A pointer to the remainder of the query, to be passed to the next
+ *   call, or NULL if no field remained (*name and *value are then not
+ *   set).
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_CODECS_URLCODE
+FAR char *urldecode_query(FAR char *query, FAR char **name,
+                          FAR char **value)
+{
+  FAR char *next;
+  FAR char *eq;
+  int len;
+
+  /* Skip over empty fields */
+
+  while (query != NULL && *query == '&')
+    {
+      query++;
+    }
+
+  if (query == NULL || *query == '\0')
+    {
+      return NULL;
+    }
+
+  next = strchr(query, '&');
+  if (next != NULL)
+    {
+      *next++ = '\0';
+    }
+  else
+    {
+      next = query + strlen(query);
+    }
+
+  eq = strchr(query, '=');
+  if (eq != NULL)
+    {
+      *eq++ = '\0';
+    }
+  else
+    {
+      eq = query + strlen(query);
+    }
+
+  /* urldecode() never writes ahead of its input, so it decodes in place */
+
+  (void)urldecode(query, strlen(query), query, &len);
+  (void)urldecode(eq, strlen(eq), eq, &len);
+
+  *name  = query;
+  *value = eq;
+  return next;
+}
+#endif
+
 /****************************************************************************
  * Name: urlrawdecode
  *
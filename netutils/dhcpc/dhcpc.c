@@ -47,6 +47,7 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <string.h>
 #include <unistd.h>
 #include <errno.h>
@@ -63,6 +64,22 @@
 
 /* Configuration */
 
+#ifndef CONFIG_NETUTILS_DHCPC_TIMEOUT
+#  define CONFIG_NETUTILS_DHCPC_TIMEOUT 4000
+#endif
+
+#ifndef CONFIG_NETUTILS_DHCPC_MAXTIMEOUT
+#  define CONFIG_NETUTILS_DHCPC_MAXTIMEOUT 64000
+#endif
+
+#if CONFIG_NETUTILS_DHCPC_MAXTIMEOUT < CONFIG_NETUTILS_DHCPC_TIMEOUT
+#  undef CONFIG_NETUTILS_DHCPC_MAXTIMEOUT
+#  define CONFIG_NETUTILS_DHCPC_MAXTIMEOUT CONFIG_NETUTILS_DHCPC_TIMEOUT
+#endif
+
+#ifndef CONFIG_NETUTILS_DHCPC_REBOOT_RETRIES
+#  define CONFIG_NETUTILS_DHCPC_REBOOT_RETRIES 2
+#endif
 
 /* DHCP Definitions */
 
@@ -97,6 +114,7 @@
 #define DHCP_OPTION_MSG_TYPE    53
 #define DHCP_OPTION_SERVER_ID   54
 #define DHCP_OPTION_REQ_LIST    55
+#define DHCP_OPTION_RAPID_COMMIT 80
 #define DHCP_OPTION_END         255
 
 #define BUFFER_SIZE             256
@@ -132,6 +150,8 @@ struct dhcpc_state_s
   FAR const void    *ds_macaddr;
   int                ds_maclen;
   int                sockfd;
+  int                timeout;     /* Current receive timeout (msec) */
+  bool               rapidcommit; /* Last reply carried Rapid Commit */
   struct in_addr     ipaddr;
   struct in_addr     serverid;
   struct dhcp_msg    packet;
@@ -178,13 +198,25 @@ static FAR uint8_t *dhcpc_addreqipaddr(FAR struct in_addr *ipaddr,
   return optptr + 4;
 }
 
-static FAR uint8_t *dhcpc_addreqoptions(FAR uint8_t *optptr)
+static FAR uint8_t *dhcpc_addreqoptions(FAR uint8_t *optptr,
+                                        bool rapidcommit)
 {
   *optptr++ = DHCP_OPTION_REQ_LIST;
   *optptr++ = 3;
   *optptr++ = DHCP_OPTION_SUBNET_MASK;
   *optptr++ = DHCP_OPTION_ROUTER;
   *optptr++ = DHCP_OPTION_DNS_SERVER;
+
+#ifdef CONFIG_NETUTILS_DHCPC_RAPIDCOMMIT
+  /* RFC 4039: Let the server answer a DISCOVER directly with an ACK */
+
+  if (rapidcommit)
+    {
+      *optptr++ = DHCP_OPTION_RAPID_COMMIT;
+      *optptr++ = 0;
+    }
+#endif
+
   return optptr;
 }
 
@@ -194,6 +226,50 @@ static FAR uint8_t *dhcpc_addend(FAR uint8_t *optptr)
   return optptr;
 }
 
+/****************************************************************************
+ * Name: dhcpc_settimeout
+ *
+ * Description:
+ *   Set the time that recv() waits for a reply.
+ *
+ ****************************************************************************/
+
+static int dhcpc_settimeout(FAR struct dhcpc_state_s *pdhcpc, int msec)
+{
+  struct timeval tv;
+
+  pdhcpc->timeout = msec;
+  tv.tv_sec       = msec / 1000;
+  tv.tv_usec      = (msec % 1000) * 1000;
+
+  return setsockopt(pdhcpc->sockfd, SOL_SOCKET, SO_RCVTIMEO, &tv,
+                    sizeof(struct timeval));
+}
+
+/****************************************************************************
+ * Name: dhcpc_backoff
+ *
+ * Description:
+ *   No reply arrived: double the receive timeout, up to
+ *   CONFIG_NETUTILS_DHCPC_MAXTIMEOUT, before retransmitting.
+ *
+ ****************************************************************************/
+
+static void dhcpc_backoff(FAR struct dhcpc_state_s *pdhcpc)
+{
+  int msec = pdhcpc->timeout << 1;
+
+  if (msec > CONFIG_NETUTILS_DHCPC_MAXTIMEOUT)
+    {
+      msec = CONFIG_NETUTILS_DHCPC_MAXTIMEOUT;
+    }
+
+  if (msec != pdhcpc->timeout)
+    {
+      (void)dhcpc_settimeout(pdhcpc, msec);
+    }
+}
+
 /****************************************************************************
  * Name: dhcpc_sendmsg
  ****************************************************************************/
@@ -230,15 +306,27 @@ static int dhcpc_sendmsg(FAR struct dhcpc_state_s *pdhcpc,
 
       case DHCPDISCOVER:
         pdhcpc->packet.flags = HTONS(BOOTP_BROADCAST); /*  Broadcast bit. */
-        pend     = dhcpc_addreqoptions(pend);
+        pend     = dhcpc_addreqoptions(pend, true);
         break;
 
-      /* Send REQUEST message to the server that sent the *first* OFFER */
+      /* Send REQUEST message to the server that sent the *first* OFFER.
+       * Without a server ID this is an INIT-REBOOT request (RFC 2131,
+       * 4.3.2) for the address of a previous lease, which any server that
+       * knows the lease may confirm.
+       */
 
       case DHCPREQUEST:
         pdhcpc->packet.flags = HTONS(BOOTP_BROADCAST); /*  Broadcast bit. */
-        memcpy(pdhcpc->packet.ciaddr, &pdhcpc->ipaddr.s_addr, 4);
-        pend     = dhcpc_addserverid(&pdhcpc->serverid, pend);
+        if (pdhcpc->serverid.s_addr != INADDR_ANY)
+          {
+            memcpy(pdhcpc->packet.ciaddr, &pdhcpc->ipaddr.s_addr, 4);
+            pend = dhcpc_addserverid(&pdhcpc->serverid, pend);
+          }
+        else
+          {
+            pend = dhcpc_addreqoptions(pend, false);
+          }
+
         pend     = dhcpc_addreqipaddr(&pdhcpc->ipaddr, pend);
         break;
 
@@ -271,7 +359,8 @@ static int dhcpc_sendmsg(FAR struct dhcpc_state_s *pdhcpc,
  * Name: dhcpc_parseoptions
  ****************************************************************************/
 
-static uint8_t dhcpc_parseoptions(FAR struct dhcpc_state *presult,
+static uint8_t dhcpc_parseoptions(FAR struct dhcpc_state_s *pdhcpc,
+                                  FAR struct dhcpc_state *presult,
                                   FAR uint8_t *optptr, int len)
 {
   FAR uint8_t *end = optptr + len;
@@ -321,6 +410,12 @@ static uint8_t dhcpc_parseoptions(FAR struct dhcpc_state *presult,
             }
             break;
 
+          case DHCP_OPTION_RAPID_COMMIT:
+            /* The ACK answers a DISCOVER sent with Rapid Commit */
+
+            pdhcpc->rapidcommit = true;
+            break;
+
           case DHCP_OPTION_END:
             return type;
         }
@@ -343,7 +438,9 @@ static uint8_t dhcpc_parsemsg(FAR struct dhcpc_state_s *pdhcpc, int buflen,
       memcmp(pdhcpc->packet.chaddr, pdhcpc->ds_macaddr, pdhcpc->ds_maclen) == 0)
     {
       memcpy(&presult->ipaddr.s_addr, pdhcpc->packet.yiaddr, 4);
-      return dhcpc_parseoptions(presult, &pdhcpc->packet.options[4], buflen);
+      pdhcpc->rapidcommit = false;
+      return dhcpc_parseoptions(pdhcpc, presult, &pdhcpc->packet.options[4],
+                                buflen);
     }
 
   return 0;
@@ -362,7 +459,6 @@ FAR void *dhcpc_open(FAR const char *interface, FAR const void *macaddr,
 {
   FAR struct dhcpc_state_s *pdhcpc;
   struct sockaddr_in addr;
-  struct timeval tv;
   int ret;
 
   ninfo("MAC: %02x:%02x:%02x:%02x:%02x:%02x\n",
@@ -408,10 +504,7 @@ FAR void *dhcpc_open(FAR const char *interface, FAR const void *macaddr,
 
       /* Configure for read timeouts */
 
-      tv.tv_sec  = 10;
-      tv.tv_usec = 0;
-
-      ret = setsockopt(pdhcpc->sockfd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(struct timeval));
+      ret = dhcpc_settimeout(pdhcpc, CONFIG_NETUTILS_DHCPC_TIMEOUT);
       if (ret < 0)
         {
           ninfo("setsockopt status %d\n",ret);
@@ -478,6 +571,8 @@ int dhcpc_request(FAR void *handle, FAR struct dhcpc_state *presult)
        */
 
       state = STATE_INITIAL;
+      (void)dhcpc_settimeout(pdhcpc, CONFIG_NETUTILS_DHCPC_TIMEOUT);
+
       do
         {
           /* Send the DISCOVER command */
@@ -510,8 +605,20 @@ int dhcpc_request(FAR void *handle, FAR struct dhcpc_state *presult)
                    */
 
                   (void)netlib_set_ipv4addr(pdhcpc->interface, &presult->ipaddr);
+                  (void)dhcpc_settimeout(pdhcpc, CONFIG_NETUTILS_DHCPC_TIMEOUT);
                   state = STATE_HAVE_OFFER;
                 }
+
+              /* A server that supports Rapid Commit may skip the OFFER and
+               * commit the lease immediately.
+               */
+
+              else if (msgtype == DHCPACK && pdhcpc->rapidcommit)
+                {
+                  ninfo("Received rapid ACK from %08x\n",
+                       ntohl(presult->serverid.s_addr));
+                  state = STATE_HAVE_LEASE;
+                }
             }
 
           /* An error has occurred.  If this was a timeout error (meaning that
@@ -525,9 +632,17 @@ int dhcpc_request(FAR void *handle, FAR struct dhcpc_state *presult)
 
               return ERROR;
             }
+          else
+            {
+              dhcpc_backoff(pdhcpc);
+            }
         }
       while (state == STATE_INITIAL);
 
+      if (state == STATE_HAVE_LEASE)
+        {
+          break;
+        }
 
       /* Loop sending the REQUEST up to three times (if there is no response) */
 
@@ -605,6 +720,10 @@ int dhcpc_request(FAR void *handle, FAR struct dhcpc_state *presult)
               (void)netlib_set_ipv4addr(pdhcpc->interface, &oldaddr);
               return ERROR;
             }
+          else
+            {
+              dhcpc_backoff(pdhcpc);
+            }
         }
       while (state == STATE_HAVE_OFFER && retries < 3);
     }
@@ -633,3 +752,88 @@ int dhcpc_request(FAR void *handle, FAR struct dhcpc_state *presult)
   ninfo("Lease expires in %d seconds\n", presult->lease_time);
   return OK;
 }
+
+/****************************************************************************
+ * Name: dhcpc_reboot
+ *
+ * Description:
+ *   Try to resume the lease in presult, obtained by an earlier call to
+ *   dhcpc_request() and saved by the caller across a reset or sleep.  A
+ *   single INIT-REBOOT REQUEST for the previous address is broadcast, and
+ *   the server holding the lease may ACK it within one round trip.  If the
+ *   server refuses the address, or there is no reply after
+ *   CONFIG_NETUTILS_DHCPC_REBOOT_RETRIES attempts, this falls back to
+ *   dhcpc_request().
+ *
+ * Input Parameters:
+ *   handle  - The handle returned by dhcpc_open()
+ *   presult - On entry, the previous lease.  On return, the current lease.
+ *
+ * Returned Value:
+ *   OK on success; ERROR on failure.
+ *
+ ****************************************************************************/
+
+int dhcpc_reboot(FAR void *handle, FAR struct dhcpc_state *presult)
+{
+  FAR struct dhcpc_state_s *pdhcpc = (FAR struct dhcpc_state_s *)handle;
+  ssize_t result;
+  uint8_t msgtype;
+  int     retries;
+
+  if (presult->ipaddr.s_addr == INADDR_ANY)
+    {
+      return dhcpc_request(handle, presult);
+    }
+
+  /* Request the previous address without naming a server.  Receive the
+   * reply on that address, as when a lease is offered.
+   */
+
+  pdhcpc->ipaddr.s_addr   = presult->ipaddr.s_addr;
+  pdhcpc->serverid.s_addr = INADDR_ANY;
+  (void)netlib_set_ipv4addr(pdhcpc->interface, &presult->ipaddr);
+  (void)dhcpc_settimeout(pdhcpc, CONFIG_NETUTILS_DHCPC_TIMEOUT);
+
+  for (retries = 0; retries < CONFIG_NETUTILS_DHCPC_REBOOT_RETRIES; retries++)
+    {
+      ninfo("Broadcast INIT-REBOOT REQUEST\n");
+      if (dhcpc_sendmsg(pdhcpc, presult, DHCPREQUEST) < 0)
+        {
+          return ERROR;
+        }
+
+      result = recv(pdhcpc->sockfd, &pdhcpc->packet, sizeof(struct dhcp_msg), 0);
+      if (result >= 0)
+        {
+          msgtype = dhcpc_parsemsg(pdhcpc, result, presult);
+          if (msgtype == DHCPACK &&
+              presult->ipaddr.s_addr == pdhcpc->ipaddr.s_addr)
+            {
+              ninfo("Received ACK, lease expires in %d seconds\n",
+                    presult->lease_time);
+              return OK;
+            }
+          else if (msgtype == DHCPNAK)
+            {
+              ninfo("Received NAK\n");
+              break;
+            }
+
+          ninfo("Ignoring msgtype=%d\n", msgtype);
+        }
+      else if (errno != EAGAIN)
+        {
+          return ERROR;
+        }
+      else
+        {
+          dhcpc_backoff(pdhcpc);
+        }
+    }
+
+  /* The previous lease cannot be resumed.  Start over. */
+
+  presult->ipaddr.s_addr = INADDR_ANY;
+  return dhcpc_request(handle, presult);
+}
@@ -63,8 +63,11 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <time.h>
 #include <errno.h>
 
@@ -171,9 +174,17 @@
 #  define CONFIG_NETUTILS_DHCPD_STARTIP (10L<<24|0L<<16|0L<<16|2L)
 #endif
 
-#undef CONFIG_NETUTILS_DHCP_OPTION_ENDIP
-#define CONFIG_NETUTILS_DHCP_OPTION_ENDIP \
-  (CONFIG_NETUTILS_DHCPD_STARTIP + CONFIG_NETUTILS_DHCPD_MAXLEASES - 1)
+/* Lease table indices are 16-bit; DHCPD_NOLEASE terminates a hash chain */
+
+#define DHCPD_NOLEASE             0xffff
+#define DHCPD_MAXPOOL             0xfffe
+
+/* The in-use bitmap has one bit per lease, 32 leases per word */
+
+#define DHCPD_NWORDS(n)           (((n) + 31) >> 5)
+#define DHCPD_ISINUSE(n)          ((g_state.ds_inuse[(n) >> 5] >> ((n) & 31)) & 1)
+#define DHCPD_SETINUSE(n)         (g_state.ds_inuse[(n) >> 5] |= (uint32_t)1 << ((n) & 31))
+#define DHCPD_CLRINUSE(n)         (g_state.ds_inuse[(n) >> 5] &= ~((uint32_t)1 << ((n) & 31)))
 
 #ifndef CONFIG_NETUTILS_DHCPD_OFFERTIME
 #  define CONFIG_NETUTILS_DHCPD_OFFERTIME (60*60) /* 1 hour */
@@ -203,6 +214,37 @@
 #  define HAVE_LEASE_TIME 1
 #endif
 
+/* The lease journal records expiry times, so it needs lease times */
+
+#undef HAVE_LEASEDB
+#if defined(CONFIG_NETUTILS_DHCPD_LEASEDB) && defined(HAVE_LEASE_TIME)
+#  define HAVE_LEASEDB 1
+#endif
+
+#ifdef HAVE_LEASEDB
+#  ifndef CONFIG_NETUTILS_DHCPD_LEASEDB_PATH
+#    define CONFIG_NETUTILS_DHCPD_LEASEDB_PATH "/mnt/dhcpd.leases"
+#  endif
+
+#  ifndef CONFIG_NETUTILS_DHCPD_LEASEDB_COMPACT
+#    define CONFIG_NETUTILS_DHCPD_LEASEDB_COMPACT 64
+#  endif
+
+#  define DHCPD_LEASEDB_TMPPATH   CONFIG_NETUTILS_DHCPD_LEASEDB_PATH ".tmp"
+
+/* Layout of one lease journal record */
+
+#  define DHCPD_DBREC_TYPE        0  /* DHCPD_DBREC_SET or DHCPD_DBREC_FREE */
+#  define DHCPD_DBREC_MAC         1  /* Client MAC address */
+#  define DHCPD_DBREC_IPADDR      7  /* Leased address */
+#  define DHCPD_DBREC_EXPIRY     11  /* Lease expiration time */
+#  define DHCPD_DBREC_CHECKSUM   15  /* One's complement of the byte sum */
+#  define DHCPD_DBREC_SIZE       16
+
+#  define DHCPD_DBREC_SET       'S'  /* Lease granted or renewed */
+#  define DHCPD_DBREC_FREE      'F'  /* Lease released or declined */
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -210,12 +252,17 @@
 /* This structure describes one element in the lease table.  There is one slot
  * in the lease table for each assign-able IP address (hence, the IP address
  * itself does not have to be in the table.
+ *
+ * Slots holding a MAC address are also linked into the MAC hash table,
+ * chained through 'hnext'.
  */
 
 struct lease_s
 {
   uint8_t  mac[DHCP_HLEN_ETHERNET]; /* MAC address (network order) -- could be larger! */
   bool     allocated;               /* true: IP address is allocated */
+  bool     hashed;                  /* true: Linked into the MAC hash table */
+  uint16_t hnext;                   /* Next slot in the same hash bucket */
 #ifdef HAVE_LEASE_TIME
   time_t   expiry;                  /* Lease expiration time (seconds past Epoch) */
 #endif
@@ -264,9 +311,26 @@ struct dhcpd_state_s
 
   uint8_t         *ds_optend;
 
-  /* Leases */
+  /* Leases.  The lease table, the MAC hash buckets and the in-use bitmap
+   * are allocated by dhcpd_run() for the configured address pool.  A bit
+   * in ds_inuse is set for each allocated lease and for each address that
+   * may never be offered (those ending in 0 or 255).
+   */
+
+  in_addr_t        ds_startip;      /* First address in the pool (host order) */
+  uint16_t         ds_nleases;      /* Number of addresses in the pool */
+  uint16_t         ds_hashmask;     /* Number of hash buckets minus one */
+  uint16_t         ds_nextword;     /* Where the next free address search starts */
+  FAR struct lease_s *ds_leases;    /* One lease per address in the pool */
+  FAR uint16_t    *ds_buckets;      /* MAC hash buckets */
+  FAR uint32_t    *ds_inuse;        /* In-use bitmap */
+
+#ifdef HAVE_LEASEDB
+  /* Lease journal */
 
-  struct lease_s   ds_leases[CONFIG_NETUTILS_DHCPD_MAXLEASES];
+  int              ds_dbfd;         /* Journal opened for appending */
+  int              ds_dbappended;   /* Records appended since compaction */
+#endif
 };
 
 /****************************************************************************
@@ -277,6 +341,11 @@ static const uint8_t        g_magiccookie[4] = {99, 130, 83, 99};
 static const uint8_t        g_anyipaddr[4] = {0, 0, 0, 0};
 static struct dhcpd_state_s g_state;
 
+/* The address pool used by the next dhcpd_run() (see dhcpd_setpool()) */
+
+static in_addr_t            g_poolstart = CONFIG_NETUTILS_DHCPD_STARTIP;
+static uint16_t             g_poolsize  = CONFIG_NETUTILS_DHCPD_MAXLEASES;
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -296,14 +365,14 @@ static inline void dhcpd_arpupdate(FAR uint8_t *ipaddr, FAR uint8_t *hwaddr)
 
   inaddr.sin_family = AF_INET;
   inaddr.sin_port = 0;
-  memcpy(&inaddr.sin_addr.s_addr, hwaddr, sizeof(in_addr_t));
+  memcpy(&inaddr.sin_addr.s_addr, ipaddr, sizeof(in_addr_t));
 
   /* Update the ARP table */
 
   (void)netlib_set_arpmapping(&inaddr, hwaddr);
 }
 #else
-#  define dhcpd_arpupdate(ipaddr,hwaddr)
+#  define dhcpd_arpupdate(ipaddr,hwaddr) ((void)(ipaddr), (void)(hwaddr))
 #endif
 
 /****************************************************************************
@@ -329,20 +398,131 @@ static time_t dhcpd_time(void)
 # define dhcpd_time() (0)
 #endif
 
+/****************************************************************************
+ * Name: dhcpd_inpool
+ ****************************************************************************/
+
+static inline bool dhcpd_inpool(in_addr_t ipaddr)
+{
+  /* ipaddr must be in host order.  The unsigned subtraction also rejects
+   * addresses below the start of the pool.
+   */
+
+  return (in_addr_t)(ipaddr - g_state.ds_startip) < g_state.ds_nleases;
+}
+
+/****************************************************************************
+ * Name: dhcpd_reserved
+ ****************************************************************************/
+
+static inline bool dhcpd_reserved(in_addr_t ipaddr)
+{
+  /* Never offer addresses ending in 0 or 255 */
+
+  return (ipaddr & 0xff) == 0 || (ipaddr & 0xff) == 0xff;
+}
+
+/****************************************************************************
+ * Name: dhcpd_machash
+ ****************************************************************************/
+
+static inline uint16_t dhcpd_machash(FAR const uint8_t *mac)
+{
+  uint32_t hash = 2166136261u;
+  int i;
+
+  /* FNV-1a.  Fold the upper half in so that small tables still see the
+   * bits contributed by the last (NIC specific) octets.
+   */
+
+  for (i = 0; i < DHCP_HLEN_ETHERNET; i++)
+    {
+      hash ^= mac[i];
+      hash *= 16777619u;
+    }
+
+  return (uint16_t)(hash ^ (hash >> 16)) & g_state.ds_hashmask;
+}
+
+/****************************************************************************
+ * Name: dhcpd_hash
+ ****************************************************************************/
+
+static void dhcpd_hash(FAR struct lease_s *lease)
+{
+  uint16_t bucket = dhcpd_machash(lease->mac);
+
+  lease->hnext  = g_state.ds_buckets[bucket];
+  lease->hashed = true;
+  g_state.ds_buckets[bucket] = (uint16_t)(lease - g_state.ds_leases);
+}
+
+/****************************************************************************
+ * Name: dhcpd_unhash
+ ****************************************************************************/
+
+static void dhcpd_unhash(FAR struct lease_s *lease)
+{
+  FAR uint16_t *link;
+  uint16_t ndx;
+
+  if (!lease->hashed)
+    {
+      return;
+    }
+
+  ndx  = (uint16_t)(lease - g_state.ds_leases);
+  link = &g_state.ds_buckets[dhcpd_machash(lease->mac)];
+
+  while (*link != DHCPD_NOLEASE)
+    {
+      if (*link == ndx)
+        {
+          *link = lease->hnext;
+          break;
+        }
+
+      link = &g_state.ds_leases[*link].hnext;
+    }
+
+  lease->hnext  = DHCPD_NOLEASE;
+  lease->hashed = false;
+}
+
+/****************************************************************************
+ * Name: dhcpd_freelease
+ ****************************************************************************/
+
+static void dhcpd_freelease(FAR struct lease_s *lease)
+{
+  int ndx = lease - g_state.ds_leases;
+
+  dhcpd_unhash(lease);
+  memset(lease, 0, sizeof(struct lease_s));
+  lease->hnext = DHCPD_NOLEASE;
+
+  /* Reserved addresses stay marked so that they are never allocated */
+
+  if (!dhcpd_reserved(g_state.ds_startip + ndx))
+    {
+      DHCPD_CLRINUSE(ndx);
+    }
+}
+
 /****************************************************************************
  * Name: dhcpd_leaseexpired
  ****************************************************************************/
 
 #ifdef HAVE_LEASE_TIME
-static inline bool dhcpd_leaseexpired(struct lease_s *lease)
+static bool dhcpd_leaseexpired(FAR struct lease_s *lease)
 {
-  if (lease->expiry < dhcpd_time())
+  if (lease->expiry > dhcpd_time())
     {
       return false;
     }
   else
     {
-      memset(lease, 0, sizeof(struct lease_s));
+      dhcpd_freelease(lease);
       return true;
     }
 }
@@ -350,6 +530,28 @@ static inline bool dhcpd_leaseexpired(struct lease_s *lease)
 # define dhcpd_leaseexpired(lease) (false)
 #endif
 
+/****************************************************************************
+ * Name: dhcpd_findbymac
+ ****************************************************************************/
+
+static struct lease_s *dhcpd_findbymac(const uint8_t *mac)
+{
+  uint16_t ndx;
+
+  ndx = g_state.ds_buckets[dhcpd_machash(mac)];
+  while (ndx != DHCPD_NOLEASE)
+    {
+      if (memcmp(g_state.ds_leases[ndx].mac, mac, DHCP_HLEN_ETHERNET) == 0)
+        {
+          return &(g_state.ds_leases[ndx]);
+        }
+
+      ndx = g_state.ds_leases[ndx].hnext;
+    }
+
+  return NULL;
+}
+
 /****************************************************************************
  * Name: dhcpd_setlease
  ****************************************************************************/
@@ -360,20 +562,38 @@ struct lease_s *dhcpd_setlease(const uint8_t *mac, in_addr_t ipaddr, time_t expi
    * ipaddr must be in host order!
    */
 
-  int ndx = ipaddr - CONFIG_NETUTILS_DHCPD_STARTIP;
+  int ndx = ipaddr - g_state.ds_startip;
   struct lease_s *ret = NULL;
+  struct lease_s *old;
 
   ninfo("ipaddr: %08x ipaddr: %08x ndx: %d MAX: %d\n",
-        ipaddr, CONFIG_NETUTILS_DHCPD_STARTIP, ndx,
-        CONFIG_NETUTILS_DHCPD_MAXLEASES);
+        ipaddr, g_state.ds_startip, ndx, g_state.ds_nleases);
 
   /* Verify that the address offset is within the supported range */
 
-  if (ndx >= 0 && ndx < CONFIG_NETUTILS_DHCPD_MAXLEASES)
+  if (dhcpd_inpool(ipaddr))
     {
        ret = &g_state.ds_leases[ndx];
-       memcpy(ret->mac, mac, DHCP_HLEN_ETHERNET);
+
+       /* A client holds only one lease.  Drop any other lease held by this
+        * MAC and the index entry of whichever MAC held this slot before.
+        */
+
+       old = dhcpd_findbymac(mac);
+       if (old != NULL && old != ret)
+         {
+           dhcpd_freelease(old);
+         }
+
+       if (old != ret)
+         {
+           dhcpd_unhash(ret);
+           memcpy(ret->mac, mac, DHCP_HLEN_ETHERNET);
+           dhcpd_hash(ret);
+         }
+
        ret->allocated = true;
+       DHCPD_SETINUSE(ndx);
 #ifdef HAVE_LEASE_TIME
        ret->expiry = dhcpd_time() + expiry;
 #endif
@@ -390,22 +610,21 @@ static inline in_addr_t dhcp_leaseipaddr(struct lease_s *lease)
 {
   /* Return IP address in host order */
 
-  return (in_addr_t)(lease - g_state.ds_leases) + CONFIG_NETUTILS_DHCPD_STARTIP;
+  return (in_addr_t)(lease - g_state.ds_leases) + g_state.ds_startip;
 }
 
 /****************************************************************************
- * Name: dhcpd_findbymac
+ * Name: dhcpd_findbyipaddr
  ****************************************************************************/
 
-static struct lease_s *dhcpd_findbymac(const uint8_t *mac)
+static struct lease_s *dhcpd_findbyipaddr(in_addr_t ipaddr)
 {
-  int i;
-
-  for (i = 0; i < CONFIG_NETUTILS_DHCPD_MAXLEASES; i++)
+  if (dhcpd_inpool(ipaddr))
     {
-      if (memcmp(g_state.ds_leases[i].mac, mac, DHCP_HLEN_ETHERNET) == 0)
+      struct lease_s *lease = &g_state.ds_leases[ipaddr - g_state.ds_startip];
+      if (lease->allocated > 0)
         {
-          return &(g_state.ds_leases[i]);
+          return lease;
         }
     }
 
@@ -413,66 +632,515 @@ static struct lease_s *dhcpd_findbymac(const uint8_t *mac)
 }
 
 /****************************************************************************
- * Name: dhcpd_findbyipaddr
+ * Name: dhcpd_findfree
+ *
+ * Description:
+ *   Return the index of a lease slot whose in-use bit is clear, or -1 if
+ *   every address is in use.  The search examines 32 addresses at a time
+ *   and resumes where the previous one succeeded.
+ *
  ****************************************************************************/
 
-static struct lease_s *dhcpd_findbyipaddr(in_addr_t ipaddr)
+static int dhcpd_findfree(void)
 {
-  if (ipaddr >= CONFIG_NETUTILS_DHCPD_STARTIP &&
-      ipaddr <= CONFIG_NETUTILS_DHCP_OPTION_ENDIP)
+  unsigned int nwords = DHCPD_NWORDS(g_state.ds_nleases);
+  unsigned int word = g_state.ds_nextword;
+  unsigned int i;
+
+  for (i = 0; i < nwords; i++)
     {
-      struct lease_s *lease = &g_state.ds_leases[ipaddr - CONFIG_NETUTILS_DHCPD_STARTIP];
-      if (lease->allocated > 0)
+      uint32_t bits = ~g_state.ds_inuse[word];
+      if (bits != 0)
         {
-          return lease;
+          int bit = 0;
+
+          while ((bits & 1) == 0)
+            {
+              bits >>= 1;
+              bit++;
+            }
+
+          g_state.ds_nextword = word;
+          return (word << 5) + bit;
+        }
+
+      if (++word >= nwords)
+        {
+          word = 0;
         }
     }
 
-  return NULL;
+  return -1;
 }
 
 /****************************************************************************
- * Name: dhcpd_allocipaddr
+ * Name: dhcpd_reclaim
+ *
+ * Description:
+ *   Free every lease and offer that has expired.  Expired leases keep their
+ *   in-use bit until they are looked at, so this only runs when the bitmap
+ *   shows no free address at all.
+ *
  ****************************************************************************/
 
-static in_addr_t dhcpd_allocipaddr(void)
+#ifdef HAVE_LEASE_TIME
+static void dhcpd_reclaim(void)
 {
-  struct lease_s *lease = NULL;
-  in_addr_t ipaddr;
+  int i;
 
-  ipaddr = CONFIG_NETUTILS_DHCPD_STARTIP;
-  for (; ipaddr <= CONFIG_NETUTILS_DHCP_OPTION_ENDIP; ipaddr++)
+  for (i = 0; i < g_state.ds_nleases; i++)
     {
-      /* Skip over address ending in 0 or 255 */
-
-      if ((ipaddr & 0xff) == 0 || (ipaddr & 0xff) == 0xff)
+      if (g_state.ds_leases[i].allocated)
         {
-          continue;
+          (void)dhcpd_leaseexpired(&g_state.ds_leases[i]);
         }
+    }
+}
+#endif
 
-      /* Is there already a lease on this address?  If so, has it expired? */
+/****************************************************************************
+ * Name: dhcpd_allocipaddr
+ ****************************************************************************/
+
+static in_addr_t dhcpd_allocipaddr(void)
+{
+  struct lease_s *lease;
+  int ndx;
+
+  ndx = dhcpd_findfree();
+#ifdef HAVE_LEASE_TIME
+  if (ndx < 0)
+    {
+      dhcpd_reclaim();
+      ndx = dhcpd_findfree();
+    }
+#endif
+
+  if (ndx < 0)
+    {
+      return 0;
+    }
 
-      lease = dhcpd_findbyipaddr(ipaddr);
-      if ((!lease || dhcpd_leaseexpired(lease)))
-        {
 #ifdef CONFIG_CPP_HAVE_WARNING
 #  warning "FIXME: Should check if anything responds to an ARP request or ping"
 #  warning "       to verify that there is no other user of this IP address"
 #endif
-          memset(g_state.ds_leases[ipaddr - CONFIG_NETUTILS_DHCPD_STARTIP].mac, 0, DHCP_HLEN_ETHERNET);
-          g_state.ds_leases[ipaddr - CONFIG_NETUTILS_DHCPD_STARTIP].allocated = true;
+
+  lease = &g_state.ds_leases[ndx];
+  lease->allocated = true;
+  DHCPD_SETINUSE(ndx);
 #ifdef HAVE_LEASE_TIME
-          g_state.ds_leases[ipaddr - CONFIG_NETUTILS_DHCPD_STARTIP].expiry = dhcpd_time() + CONFIG_NETUTILS_DHCPD_OFFERTIME;
+  lease->expiry = dhcpd_time() + CONFIG_NETUTILS_DHCPD_OFFERTIME;
 #endif
-          /* Return the address in host order */
 
-          return ipaddr;
+  /* Return the address in host order */
+
+  return g_state.ds_startip + ndx;
+}
+
+/****************************************************************************
+ * Name: dhcpd_leaseinit
+ *
+ * Description:
+ *   Allocate and initialize the lease table, the MAC hash buckets and the
+ *   in-use bitmap for the current address pool.
+ *
+ ****************************************************************************/
+
+static int dhcpd_leaseinit(void)
+{
+  unsigned int nbuckets;
+  unsigned int nwords;
+  unsigned int i;
+
+  g_state.ds_startip = g_poolstart;
+  g_state.ds_nleases = g_poolsize;
+
+  /* Use a power of two number of buckets, at least one per lease */
+
+  for (nbuckets = 1; nbuckets < g_state.ds_nleases; nbuckets <<= 1);
+  g_state.ds_hashmask = nbuckets - 1;
+
+  nwords = DHCPD_NWORDS(g_state.ds_nleases);
+
+  g_state.ds_leases  = (FAR struct lease_s *)
+    calloc(g_state.ds_nleases, sizeof(struct lease_s));
+  g_state.ds_buckets = (FAR uint16_t *)malloc(nbuckets * sizeof(uint16_t));
+  g_state.ds_inuse   = (FAR uint32_t *)calloc(nwords, sizeof(uint32_t));
+
+  if (g_state.ds_leases == NULL || g_state.ds_buckets == NULL ||
+      g_state.ds_inuse == NULL)
+    {
+      nerr("ERROR: Failed to allocate %d leases\n", g_state.ds_nleases);
+      return ERROR;
+    }
+
+  for (i = 0; i < nbuckets; i++)
+    {
+      g_state.ds_buckets[i] = DHCPD_NOLEASE;
+    }
+
+  for (i = 0; i < g_state.ds_nleases; i++)
+    {
+      g_state.ds_leases[i].hnext = DHCPD_NOLEASE;
+      if (dhcpd_reserved(g_state.ds_startip + i))
+        {
+          DHCPD_SETINUSE(i);
         }
     }
 
-  return 0;
+  /* Mark the unused bits in the last word so that they are never found */
+
+  for (i = g_state.ds_nleases; i < (nwords << 5); i++)
+    {
+      DHCPD_SETINUSE(i);
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: dhcpd_leasefree
+ ****************************************************************************/
+
+static void dhcpd_leasefree(void)
+{
+  free(g_state.ds_leases);
+  free(g_state.ds_buckets);
+  free(g_state.ds_inuse);
+
+  g_state.ds_leases  = NULL;
+  g_state.ds_buckets = NULL;
+  g_state.ds_inuse   = NULL;
+}
+
+/****************************************************************************
+ * Name: dhcpd_dbencode
+ *
+ * Description:
+ *   Format one journal record.  Records are DHCPD_DBREC_SIZE bytes with all
+ *   multi-byte fields in network order and a trailing checksum so that a
+ *   record torn by a power failure is recognized on replay.
+ *
+ ****************************************************************************/
+
+#ifdef HAVE_LEASEDB
+static void dhcpd_dbencode(FAR uint8_t *rec, uint8_t type,
+                           FAR const uint8_t *mac, in_addr_t ipaddr,
+                           time_t expiry)
+{
+  uint8_t sum = 0;
+  int i;
+
+  rec[DHCPD_DBREC_TYPE] = type;
+  memcpy(&rec[DHCPD_DBREC_MAC], mac, DHCP_HLEN_ETHERNET);
+
+  rec[DHCPD_DBREC_IPADDR]     = (uint8_t)(ipaddr >> 24);
+  rec[DHCPD_DBREC_IPADDR + 1] = (uint8_t)(ipaddr >> 16);
+  rec[DHCPD_DBREC_IPADDR + 2] = (uint8_t)(ipaddr >> 8);
+  rec[DHCPD_DBREC_IPADDR + 3] = (uint8_t)ipaddr;
+
+  rec[DHCPD_DBREC_EXPIRY]     = (uint8_t)((uint32_t)expiry >> 24);
+  rec[DHCPD_DBREC_EXPIRY + 1] = (uint8_t)((uint32_t)expiry >> 16);
+  rec[DHCPD_DBREC_EXPIRY + 2] = (uint8_t)((uint32_t)expiry >> 8);
+  rec[DHCPD_DBREC_EXPIRY + 3] = (uint8_t)expiry;
+
+  for (i = 0; i < DHCPD_DBREC_CHECKSUM; i++)
+    {
+      sum += rec[i];
+    }
+
+  rec[DHCPD_DBREC_CHECKSUM] = ~sum;
 }
 
+/****************************************************************************
+ * Name: dhcpd_dbdecode
+ ****************************************************************************/
+
+static bool dhcpd_dbdecode(FAR const uint8_t *rec, FAR in_addr_t *ipaddr,
+                           FAR time_t *expiry)
+{
+  uint8_t sum = 0;
+  int i;
+
+  for (i = 0; i < DHCPD_DBREC_CHECKSUM; i++)
+    {
+      sum += rec[i];
+    }
+
+  if ((uint8_t)~sum != rec[DHCPD_DBREC_CHECKSUM] ||
+      (rec[DHCPD_DBREC_TYPE] != DHCPD_DBREC_SET &&
+       rec[DHCPD_DBREC_TYPE] != DHCPD_DBREC_FREE))
+    {
+      return false;
+    }
+
+  *ipaddr = (in_addr_t)rec[DHCPD_DBREC_IPADDR] << 24 |
+            (in_addr_t)rec[DHCPD_DBREC_IPADDR + 1] << 16 |
+            (in_addr_t)rec[DHCPD_DBREC_IPADDR + 2] << 8 |
+            (in_addr_t)rec[DHCPD_DBREC_IPADDR + 3];
+
+  *expiry = (time_t)((uint32_t)rec[DHCPD_DBREC_EXPIRY] << 24 |
+                     (uint32_t)rec[DHCPD_DBREC_EXPIRY + 1] << 16 |
+                     (uint32_t)rec[DHCPD_DBREC_EXPIRY + 2] << 8 |
+                     (uint32_t)rec[DHCPD_DBREC_EXPIRY + 3]);
+  return true;
+}
+
+/****************************************************************************
+ * Name: dhcpd_dbwrite
+ ****************************************************************************/
+
+static int dhcpd_dbwrite(int fd, FAR const uint8_t *rec)
+{
+  ssize_t nwritten;
+  size_t offset = 0;
+
+  while (offset < DHCPD_DBREC_SIZE)
+    {
+      nwritten = write(fd, &rec[offset], DHCPD_DBREC_SIZE - offset);
+      if (nwritten < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          return ERROR;
+        }
+
+      offset += nwritten;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: dhcpd_dbcompact
+ *
+ * Description:
+ *   Replace the journal with one SET record per live lease.  The new
+ *   journal is written to a temporary file, synced and then renamed over
+ *   the old one, so a failure at any point leaves one complete journal on
+ *   flash.
+ *
+ ****************************************************************************/
+
+static void dhcpd_dbcompact(void)
+{
+  uint8_t rec[DHCPD_DBREC_SIZE];
+  time_t now = dhcpd_time();
+  int nrecords = 0;
+  int fd;
+  int i;
+
+  if (g_state.ds_dbfd >= 0)
+    {
+      close(g_state.ds_dbfd);
+      g_state.ds_dbfd = -1;
+    }
+
+  fd = open(DHCPD_LEASEDB_TMPPATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    {
+      nerr("ERROR: open %s failed: %d\n", DHCPD_LEASEDB_TMPPATH, errno);
+      goto errout;
+    }
+
+  for (i = 0; i < g_state.ds_nleases; i++)
+    {
+      FAR struct lease_s *lease = &g_state.ds_leases[i];
+
+      if (lease->allocated && lease->hashed && lease->expiry > now)
+        {
+          dhcpd_dbencode(rec, DHCPD_DBREC_SET, lease->mac,
+                         g_state.ds_startip + i, lease->expiry);
+          if (dhcpd_dbwrite(fd, rec) < 0)
+            {
+              nerr("ERROR: write %s failed: %d\n",
+                   DHCPD_LEASEDB_TMPPATH, errno);
+              close(fd);
+              unlink(DHCPD_LEASEDB_TMPPATH);
+              goto errout;
+            }
+
+          nrecords++;
+        }
+    }
+
+  if (fsync(fd) < 0 ||
+      close(fd) < 0 ||
+      rename(DHCPD_LEASEDB_TMPPATH, CONFIG_NETUTILS_DHCPD_LEASEDB_PATH) < 0)
+    {
+      nerr("ERROR: Failed to replace %s: %d\n",
+           CONFIG_NETUTILS_DHCPD_LEASEDB_PATH, errno);
+      unlink(DHCPD_LEASEDB_TMPPATH);
+      goto errout;
+    }
+
+  g_state.ds_dbappended = 0;
+  ninfo("Compacted lease journal: %d leases\n", nrecords);
+
+errout:
+
+  /* Keep appending to whichever journal is now in place */
+
+  g_state.ds_dbfd = open(CONFIG_NETUTILS_DHCPD_LEASEDB_PATH,
+                         O_WRONLY | O_CREAT | O_APPEND, 0644);
+  if (g_state.ds_dbfd < 0)
+    {
+      nerr("ERROR: open %s failed: %d\n",
+           CONFIG_NETUTILS_DHCPD_LEASEDB_PATH, errno);
+    }
+}
+
+/****************************************************************************
+ * Name: dhcpd_dbappend
+ *
+ * Description:
+ *   Append one record to the journal and sync it before the reply that
+ *   depends on it is sent.
+ *
+ ****************************************************************************/
+
+static void dhcpd_dbappend(uint8_t type, FAR const uint8_t *mac,
+                           in_addr_t ipaddr, time_t expiry)
+{
+  uint8_t rec[DHCPD_DBREC_SIZE];
+
+  if (g_state.ds_dbfd < 0)
+    {
+      return;
+    }
+
+  dhcpd_dbencode(rec, type, mac, ipaddr, expiry);
+  if (dhcpd_dbwrite(g_state.ds_dbfd, rec) < 0 || fsync(g_state.ds_dbfd) < 0)
+    {
+      nerr("ERROR: write %s failed: %d\n",
+           CONFIG_NETUTILS_DHCPD_LEASEDB_PATH, errno);
+
+      /* Rewriting the journal also discards any partial record */
+
+      dhcpd_dbcompact();
+      return;
+    }
+
+  if (++g_state.ds_dbappended >= CONFIG_NETUTILS_DHCPD_LEASEDB_COMPACT)
+    {
+      dhcpd_dbcompact();
+    }
+}
+
+/****************************************************************************
+ * Name: dhcpd_dbload
+ *
+ * Description:
+ *   Replay the lease journal into the lease table, restore the ARP entries
+ *   of the clients that still hold leases and then compact the journal.
+ *   Replay stops at the first damaged record; everything before it is
+ *   kept.
+ *
+ ****************************************************************************/
+
+static void dhcpd_dbload(void)
+{
+  uint8_t rec[DHCPD_DBREC_SIZE];
+  FAR struct lease_s *lease;
+  in_addr_t ipaddr;
+  time_t expiry;
+  time_t now;
+  ssize_t nread;
+  int nrecords = 0;
+  int fd;
+  int i;
+
+  g_state.ds_dbfd = -1;
+
+  fd = open(CONFIG_NETUTILS_DHCPD_LEASEDB_PATH, O_RDONLY);
+  if (fd >= 0)
+    {
+      now = dhcpd_time();
+
+      while ((nread = read(fd, rec, DHCPD_DBREC_SIZE)) == DHCPD_DBREC_SIZE)
+        {
+          if (!dhcpd_dbdecode(rec, &ipaddr, &expiry))
+            {
+              nerr("ERROR: Bad lease record %d\n", nrecords);
+              break;
+            }
+
+          nrecords++;
+          if (!dhcpd_inpool(ipaddr))
+            {
+              continue;
+            }
+
+          if (rec[DHCPD_DBREC_TYPE] == DHCPD_DBREC_FREE)
+            {
+              lease = dhcpd_findbyipaddr(ipaddr);
+              if (lease != NULL &&
+                  memcmp(lease->mac, &rec[DHCPD_DBREC_MAC],
+                         DHCP_HLEN_ETHERNET) == 0)
+                {
+                  dhcpd_freelease(lease);
+                }
+            }
+          else if (expiry > now)
+            {
+              /* Without a valid real time clock, 'now' may be far in the
+               * past.  Never restore a lease longer than it could have been
+               * granted.
+               */
+
+              if (expiry - now > CONFIG_NETUTILS_DHCPD_MAXLEASETIME)
+                {
+                  expiry = now + CONFIG_NETUTILS_DHCPD_MAXLEASETIME;
+                }
+
+              (void)dhcpd_setlease(&rec[DHCPD_DBREC_MAC], ipaddr,
+                                   expiry - now);
+            }
+        }
+
+      close(fd);
+      ninfo("Replayed %d lease records\n", nrecords);
+
+      /* Clients that kept their leases may unicast to us right away */
+
+      for (i = 0; i < g_state.ds_nleases; i++)
+        {
+          lease = &g_state.ds_leases[i];
+          if (lease->allocated && lease->hashed)
+            {
+              uint32_t netaddr = htonl(g_state.ds_startip + i);
+              dhcpd_arpupdate((FAR uint8_t *)&netaddr, lease->mac);
+            }
+        }
+    }
+
+  /* Start each run from a compact journal */
+
+  dhcpd_dbcompact();
+}
+
+/****************************************************************************
+ * Name: dhcpd_dbclose
+ ****************************************************************************/
+
+static void dhcpd_dbclose(void)
+{
+  if (g_state.ds_dbfd >= 0)
+    {
+      close(g_state.ds_dbfd);
+      g_state.ds_dbfd = -1;
+    }
+}
+#else
+#  define dhcpd_dbappend(type,mac,ipaddr,expiry)
+#  define dhcpd_dbload()
+#  define dhcpd_dbclose()
+#endif
+
 /****************************************************************************
  * Name: dhcpd_parseoptions
  ****************************************************************************/
@@ -645,8 +1313,7 @@ static inline bool dhcpd_verifyreqip(void)
 
   /* Verify that the requested IP address is within the supported lease range */
 
-  if (g_state.ds_optreqip >= CONFIG_NETUTILS_DHCPD_STARTIP &&
-      g_state.ds_optreqip <= CONFIG_NETUTILS_DHCP_OPTION_ENDIP)
+  if (dhcpd_inpool(g_state.ds_optreqip))
     {
       /* And verify that the lease has not already been taken or offered
        * (unless the lease/offer is expired, then the address is free game).
@@ -1100,7 +1767,12 @@ int dhcpd_sendack(in_addr_t ipaddr)
       return ERROR;
     }
 
-  dhcpd_setlease(g_state.ds_inpacket.chaddr, ipaddr, leasetime);
+  if (dhcpd_setlease(g_state.ds_inpacket.chaddr, ipaddr, leasetime))
+    {
+      dhcpd_dbappend(DHCPD_DBREC_SET, g_state.ds_inpacket.chaddr, ipaddr,
+                     dhcpd_time() + leasetime);
+    }
+
   return OK;
 }
 
@@ -1289,8 +1961,7 @@ static inline int dhcpd_request(void)
 
       /* No.. is the requested IP address in range? NAK if not */
 
-      else if (g_state.ds_optreqip < CONFIG_NETUTILS_DHCPD_STARTIP ||
-               g_state.ds_optreqip > CONFIG_NETUTILS_DHCP_OPTION_ENDIP)
+      else if (!dhcpd_inpool(g_state.ds_optreqip))
         {
           response = DHCPNAK;
         }
@@ -1339,6 +2010,9 @@ static inline int dhcpd_decline(void)
         * address for a period of time.
         */
 
+       dhcpd_dbappend(DHCPD_DBREC_FREE, lease->mac,
+                      dhcp_leaseipaddr(lease), 0);
+       dhcpd_unhash(lease);
        memset(lease->mac, 0, DHCP_HLEN_ETHERNET);
 #ifdef HAVE_LEASE_TIME
        lease->expiry = dhcpd_time() + CONFIG_NETUTILS_DHCPD_DECLINETIME;
@@ -1359,7 +2033,9 @@ static inline int dhcpd_release(void)
     {
       /* Release the IP address now */
 
-      memset(lease, 0, sizeof(struct lease_s));
+      dhcpd_dbappend(DHCPD_DBREC_FREE, lease->mac,
+                     dhcp_leaseipaddr(lease), 0);
+      dhcpd_freelease(lease);
     }
 
   return OK;
@@ -1423,6 +2099,38 @@ static inline int dhcpd_openlistener(void)
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: dhcpd_setpool
+ *
+ * Description:
+ *   Select the range of addresses handed out by the next call to
+ *   dhcpd_run(), replacing CONFIG_NETUTILS_DHCPD_STARTIP and
+ *   CONFIG_NETUTILS_DHCPD_MAXLEASES.  The lease table is allocated for
+ *   exactly this many addresses.
+ *
+ * Input Parameters:
+ *   startip - The first address in the pool (host order)
+ *   nleases - The number of addresses in the pool
+ *
+ * Returned Value:
+ *   OK on success; -EINVAL if the pool is empty, too large or wraps past
+ *   255.255.255.255.
+ *
+ ****************************************************************************/
+
+int dhcpd_setpool(in_addr_t startip, unsigned int nleases)
+{
+  if (nleases < 1 || nleases > DHCPD_MAXPOOL ||
+      startip + (nleases - 1) < startip)
+    {
+      return -EINVAL;
+    }
+
+  g_poolstart = startip;
+  g_poolsize  = (uint16_t)nleases;
+  return OK;
+}
+
 /****************************************************************************
  * Name: dhcpd_run
  ****************************************************************************/
@@ -1438,6 +2146,18 @@ int dhcpd_run(void)
 
   memset(&g_state, 0, sizeof(struct dhcpd_state_s));
 
+  /* Allocate the lease table for the address pool */
+
+  if (dhcpd_leaseinit() < 0)
+    {
+      dhcpd_leasefree();
+      return ERROR;
+    }
+
+  /* Restore the leases granted before the last restart */
+
+  dhcpd_dbload();
+
   /* Now loop indefinitely, reading packets from the DHCP server socket */
 
   sockfd = -1;
@@ -1519,5 +2239,7 @@ int dhcpd_run(void)
         }
     }
 
+  dhcpd_dbclose();
+  dhcpd_leasefree();
   return OK;
 }
@@ -42,13 +42,18 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
 #include <debug.h>
 #include <errno.h>
+#include <poll.h>
 #include <sched.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 
 #include <sys/ioctl.h>
@@ -59,6 +64,9 @@
 #include <arpa/inet.h>
 
 #include "netutils/discover.h"
+#ifdef CONFIG_DISCOVER_MCAST
+#  include "netutils/ipmsfilter.h"
+#endif
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -89,30 +97,35 @@
 #  define CONFIG_DISCOVER_DESCR CONFIG_ARCH_BOARD
 #endif
 
-/* Internal Definitions *****************************************************/
-/* Discover request packet format:
- * Byte Description
- * 0    Protocol indentifier (0x99)
- * 1    Request command 0x01
- * 2    Destination device class (For querying subsets of available devices)
- *      0xff for all devices
- * 3    Checksum (Byte 0 - Byte 1 - Byte n) & 0xff
+/* Responses are delayed by a random time of up to CONFIG_DISCOVER_MAXDELAY
+ * milliseconds so that a fleet does not answer a probe all at once.
  */
 
-/* Discover response packet format:
- * Byte Description
- * 0    Protocol indentifier (0x99)
- * 1    Reponse command (0x02)
- * 2-33 Device description string with 0 bytes filled
- * 34   Checksum (Byte 0 - Byte 1 - Byte n) & 0xff
+#if defined(CONFIG_DISCOVER_MAXDELAY) && defined(CONFIG_DISABLE_POLL)
+#  undef CONFIG_DISCOVER_MAXDELAY
+#endif
+
+#ifndef CONFIG_DISCOVER_MAXDELAY
+#  define CONFIG_DISCOVER_MAXDELAY 0
+#endif
+
+/* Further queries from a peer are ignored while its response is pending
+ * and for CONFIG_DISCOVER_HOLDOFF milliseconds after it was sent.
  */
 
-#define DISCOVER_PROTO_ID 0x99
-#define DISCOVER_REQUEST 0x01
-#define DISCOVER_RESPONSE 0x02
-#define DISCOVER_ALL 0xff
-#define DISCOVER_REQUEST_SIZE 4
-#define DISCOVER_RESPONSE_SIZE 35
+#ifndef CONFIG_DISCOVER_HOLDOFF
+#  define CONFIG_DISCOVER_HOLDOFF 1000
+#endif
+
+#ifndef CONFIG_DISCOVER_MAXPEERS
+#  define CONFIG_DISCOVER_MAXPEERS 8
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define DISCOVER_CLOCK CLOCK_MONOTONIC
+#else
+#  define DISCOVER_CLOCK CLOCK_REALTIME
+#endif
 
 /****************************************************************************
  * Private Types
@@ -121,12 +134,25 @@
 typedef uint8_t request_t[DISCOVER_REQUEST_SIZE];
 typedef uint8_t response_t[DISCOVER_RESPONSE_SIZE];
 
+/* A peer that queried recently: either its response is pending until due,
+ * or it was answered and further queries are ignored until due.
+ */
+
+struct discover_peer_s
+{
+  in_addr_t ipaddr;          /* Peer address, 0 if the entry is unused */
+  uint32_t due;              /* Response or hold-off time in ms */
+  bool pending;              /* Response not yet sent */
+};
+
 struct discover_state_s
 {
   struct discover_info_s info;
   in_addr_t serverip;
+  int respfd;                /* Responder socket, kept open */
   request_t request;
-  response_t response;
+  response_t response;       /* Built once, sent to every peer */
+  struct discover_peer_s peers[CONFIG_DISCOVER_MAXPEERS];
 };
 
 /****************************************************************************
@@ -135,7 +161,9 @@ struct discover_state_s
 
 struct discover_state_s g_state =
 {
-  {CONFIG_DISCOVER_DEVICE_CLASS, CONFIG_DISCOVER_DESCR}
+  {CONFIG_DISCOVER_DEVICE_CLASS, CONFIG_DISCOVER_DESCR},
+  0,
+  -1
 };
 
 /****************************************************************************
@@ -147,7 +175,7 @@ static inline int discover_socket(void);
 static inline int discover_openlistener(void);
 static inline int discover_openresponder(void);
 static inline int discover_parse(request_t packet);
-static inline int discover_respond(in_addr_t *ipaddr);
+static int discover_respond(in_addr_t *ipaddr);
 static inline void discover_initresponse(void);
 
 /****************************************************************************
@@ -175,12 +203,112 @@ static inline void discover_initresponse()
   g_state.response[DISCOVER_RESPONSE_SIZE-1] = chk & 0xff;
 }
 
+static uint32_t discover_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(DISCOVER_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/* Queue a response to ipaddr unless the peer is already pending or held
+ * off.  Responds at once if there is no delay or no free entry.
+ */
+
+static void discover_schedule(in_addr_t ipaddr, uint32_t now)
+{
+  FAR struct discover_peer_s *peer;
+  FAR struct discover_peer_s *slot = NULL;
+  int i;
+
+  for (i = 0; i < CONFIG_DISCOVER_MAXPEERS; i++)
+    {
+      peer = &g_state.peers[i];
+      if (peer->ipaddr != 0 && !peer->pending &&
+          (int32_t)(peer->due - now) <= 0)
+        {
+          /* Hold-off expired */
+
+          peer->ipaddr = 0;
+        }
+
+      if (peer->ipaddr == ipaddr)
+        {
+          ninfo("Duplicate discover from %08lx\n", (long)ipaddr);
+          return;
+        }
+
+      if (peer->ipaddr == 0 && slot == NULL)
+        {
+          slot = peer;
+        }
+    }
+
+#if CONFIG_DISCOVER_MAXDELAY > 0
+  if (slot != NULL)
+    {
+      slot->ipaddr  = ipaddr;
+      slot->due     = now + (uint32_t)rand() % CONFIG_DISCOVER_MAXDELAY;
+      slot->pending = true;
+      return;
+    }
+#endif
+
+  discover_respond(&ipaddr);
+  if (slot != NULL)
+    {
+      slot->ipaddr  = ipaddr;
+      slot->due     = now + CONFIG_DISCOVER_HOLDOFF;
+      slot->pending = false;
+    }
+}
+
+/* Send the responses that are due and return the poll timeout until the
+ * next one, -1 if none is pending.
+ */
+
+static int discover_flush(uint32_t now)
+{
+  FAR struct discover_peer_s *peer;
+  int timeout = -1;
+  int32_t left;
+  int i;
+
+  for (i = 0; i < CONFIG_DISCOVER_MAXPEERS; i++)
+    {
+      peer = &g_state.peers[i];
+      if (peer->ipaddr == 0 || !peer->pending)
+        {
+          continue;
+        }
+
+      left = (int32_t)(peer->due - now);
+      if (left <= 0)
+        {
+          discover_respond(&peer->ipaddr);
+          peer->due     = now + CONFIG_DISCOVER_HOLDOFF;
+          peer->pending = false;
+        }
+      else if (timeout < 0 || left < timeout)
+        {
+          timeout = left;
+        }
+    }
+
+  return timeout;
+}
+
 static int discover_daemon(int argc, char *argv[])
 {
   int sockfd = -1;
   int nbytes;
   int addrlen = sizeof(struct sockaddr_in);
   struct sockaddr_in srcaddr;
+#if CONFIG_DISCOVER_MAXDELAY > 0
+  struct pollfd fds;
+  int timeout = -1;
+  int ret;
+#endif
 
   /* memset(&g_state, 0, sizeof(struct discover_state_s)); */
   discover_initresponse();
@@ -199,7 +327,26 @@ static int discover_daemon(int argc, char *argv[])
                 nerr("ERROR: Failed to create socket\n");
                 break;
             }
+
+          /* Spread the response delays of devices booted together */
+
+          srand(g_state.serverip ^ discover_now());
+        }
+
+#if CONFIG_DISCOVER_MAXDELAY > 0
+      /* Wait for the next packet or the next response to become due */
+
+      fds.fd      = sockfd;
+      fds.events  = POLLIN;
+      fds.revents = 0;
+
+      ret = poll(&fds, 1, timeout);
+      if (ret <= 0)
+        {
+          timeout = discover_flush(discover_now());
+          continue;
         }
+#endif
 
       /* Read the next packet */
 
@@ -219,14 +366,15 @@ static int discover_daemon(int argc, char *argv[])
           continue;
         }
 
-      if (discover_parse(g_state.request) != OK)
+      if (discover_parse(g_state.request) == OK)
         {
-          continue;
+          ninfo("Received discover from %08lx'\n", srcaddr.sin_addr.s_addr);
+          discover_schedule(srcaddr.sin_addr.s_addr, discover_now());
         }
 
-      ninfo("Received discover from %08lx'\n", srcaddr.sin_addr.s_addr);
-
-      discover_respond(&srcaddr.sin_addr.s_addr);
+#if CONFIG_DISCOVER_MAXDELAY > 0
+      timeout = discover_flush(discover_now());
+#endif
     }
 
   return OK;
@@ -267,17 +415,21 @@ static inline int discover_parse(request_t packet)
   return ERROR;
 }
 
-static inline int discover_respond(in_addr_t *ipaddr)
+static int discover_respond(in_addr_t *ipaddr)
 {
   struct sockaddr_in addr;
-  int sockfd;
   int ret;
 
-  sockfd = discover_openresponder();
-  if (sockfd < 0)
+  /* The responder socket is opened once and reused for all responses */
+
+  if (g_state.respfd < 0)
     {
-      nerr("ERROR: discover_openresponder failed\n");
-      return ERROR;
+      g_state.respfd = discover_openresponder();
+      if (g_state.respfd < 0)
+        {
+          nerr("ERROR: discover_openresponder failed\n");
+          return ERROR;
+        }
     }
 
   /* Then send the reponse to the DHCP client port at that address */
@@ -287,14 +439,17 @@ static inline int discover_respond(in_addr_t *ipaddr)
   addr.sin_port        = HTONS(CONFIG_DISCOVER_PORT);
   addr.sin_addr.s_addr = *ipaddr;
 
-  ret = sendto(sockfd, &g_state.response, sizeof(g_state.response), 0,
-               (struct sockaddr *)&addr, sizeof(struct sockaddr_in));
+  ret = sendto(g_state.respfd, &g_state.response, sizeof(g_state.response),
+               0, (struct sockaddr *)&addr, sizeof(struct sockaddr_in));
   if (ret < 0)
     {
+      /* Open a new socket for the next response */
+
       nerr("ERROR: Could not send discovery response: %d\n", errno);
+      close(g_state.respfd);
+      g_state.respfd = -1;
     }
 
-  close(sockfd);
   return ret;
 }
 
@@ -388,6 +543,21 @@ static inline int discover_openlistener()
      return ERROR;
    }
 
+#ifdef CONFIG_DISCOVER_MCAST
+  /* Also receive the queries sent to the discover multicast group */
+
+  {
+    struct in_addr group;
+
+    group.s_addr = inet_addr(CONFIG_DISCOVER_MCASTGROUP);
+    if (ipmsfilter(CONFIG_DISCOVER_INTERFACE, &group, MCAST_EXCLUDE) < 0)
+      {
+        nerr("ERROR: Failed to join %s: %d\n",
+             CONFIG_DISCOVER_MCASTGROUP, errno);
+      }
+  }
+#endif
+
   return sockfd;
 }
 
@@ -465,3 +635,137 @@ int discover_start(struct discover_info_s *info)
 
   return pid;
 }
+
+/****************************************************************************
+ * Name: discover_scan
+ *
+ * Description:
+ *   Send one discover request and collect the responses that arrive within
+ *   a time window.  Every responder is reported once, however many
+ *   responses it sends.
+ *
+ * Input Parameters:
+ *   devclass  Device class to query, DISCOVER_ALL for all devices
+ *   dest      Destination of the request in network order: INADDR_BROADCAST
+ *             or the discover multicast group
+ *   window    Milliseconds to collect responses for
+ *   resp      Array receiving the responses
+ *   maxresp   Size of the array
+ *
+ * Return:
+ *   The number of responders found; a negated errno on failure.
+ *
+ ****************************************************************************/
+
+int discover_scan(uint8_t devclass, in_addr_t dest, int window,
+                  FAR struct discover_response_s *resp, int maxresp)
+{
+  struct sockaddr_in addr;
+  struct pollfd fds;
+  socklen_t addrlen;
+  response_t packet;
+  request_t request;
+  uint32_t deadline;
+  int32_t left;
+  uint8_t chk;
+  int nresp = 0;
+  int errval;
+  int sockfd;
+  int ret;
+  int i;
+
+  /* Responses are sent to the discover port of the requester */
+
+  sockfd = discover_socket();
+  if (sockfd < 0)
+    {
+      return -errno;
+    }
+
+  memset(&addr, 0, sizeof(struct sockaddr_in));
+  addr.sin_family      = AF_INET;
+  addr.sin_port        = HTONS(CONFIG_DISCOVER_PORT);
+  addr.sin_addr.s_addr = INADDR_ANY;
+
+  if (bind(sockfd, (struct sockaddr *)&addr, sizeof(struct sockaddr_in)) < 0)
+    {
+      goto errout_with_socket;
+    }
+
+  request[0] = DISCOVER_PROTO_ID;
+  request[1] = DISCOVER_REQUEST;
+  request[2] = devclass;
+  request[3] = (uint8_t)(0 - request[0] - request[1] - request[2]);
+
+  addr.sin_addr.s_addr = dest;
+  if (sendto(sockfd, request, sizeof(request), 0, (struct sockaddr *)&addr,
+             sizeof(struct sockaddr_in)) < 0)
+    {
+      goto errout_with_socket;
+    }
+
+  deadline = discover_now() + window;
+  while ((left = (int32_t)(deadline - discover_now())) > 0)
+    {
+      fds.fd      = sockfd;
+      fds.events  = POLLIN;
+      fds.revents = 0;
+
+      ret = poll(&fds, 1, left);
+      if (ret < 0 && errno != EINTR)
+        {
+          goto errout_with_socket;
+        }
+      else if (ret <= 0)
+        {
+          continue;
+        }
+
+      addrlen = sizeof(struct sockaddr_in);
+      ret = recvfrom(sockfd, packet, sizeof(packet), 0,
+                     (struct sockaddr *)&addr, &addrlen);
+      if (ret != sizeof(packet) || packet[0] != DISCOVER_PROTO_ID ||
+          packet[1] != DISCOVER_RESPONSE)
+        {
+          continue;
+        }
+
+      for (chk = 0, i = 0; i < DISCOVER_RESPONSE_SIZE - 1; i++)
+        {
+          chk -= packet[i];
+        }
+
+      if (chk != packet[DISCOVER_RESPONSE_SIZE - 1])
+        {
+          continue;
+        }
+
+      /* Skip responders seen before */
+
+      for (i = 0; i < nresp; i++)
+        {
+          if (resp[i].ipaddr == addr.sin_addr.s_addr)
+            {
+              break;
+            }
+        }
+
+      if (i < nresp || nresp >= maxresp)
+        {
+          continue;
+        }
+
+      resp[nresp].ipaddr = addr.sin_addr.s_addr;
+      memcpy(resp[nresp].description, &packet[2], DISCOVER_RESPONSE_SIZE - 3);
+      resp[nresp].description[DISCOVER_RESPONSE_SIZE - 3] = '\0';
+      nresp++;
+    }
+
+  close(sockfd);
+  return nresp;
+
+errout_with_socket:
+  errval = errno;
+  close(sockfd);
+  return -errval;
+}
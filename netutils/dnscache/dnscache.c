@@ -0,0 +1,1041 @@
+/****************************************************************************
+ * apps/netutils/dnscache/dnscache.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <time.h>
+#include <poll.h>
+#include <netdb.h>
+#include <semaphore.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#ifdef CONFIG_NETDB_DNSCLIENT
+#  include <nuttx/net/dns.h>
+#endif
+
+#include "netutils/dnscache.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_NETUTILS_DNSCACHE_ENTRIES
+#  define CONFIG_NETUTILS_DNSCACHE_ENTRIES 16
+#endif
+
+#ifndef CONFIG_NETUTILS_DNSCACHE_NAMESIZE
+#  define CONFIG_NETUTILS_DNSCACHE_NAMESIZE 64
+#endif
+
+#ifndef CONFIG_NETUTILS_DNSCACHE_MINTTL
+#  define CONFIG_NETUTILS_DNSCACHE_MINTTL 10
+#endif
+
+#ifndef CONFIG_NETUTILS_DNSCACHE_MAXTTL
+#  define CONFIG_NETUTILS_DNSCACHE_MAXTTL 3600
+#endif
+
+#ifndef CONFIG_NETUTILS_DNSCACHE_NEGTTL
+#  define CONFIG_NETUTILS_DNSCACHE_NEGTTL 5
+#endif
+
+#ifndef CONFIG_NETUTILS_DNSCACHE_TIMEOUT
+#  define CONFIG_NETUTILS_DNSCACHE_TIMEOUT 2000
+#endif
+
+#ifndef CONFIG_NETUTILS_DNSCACHE_HOSTFILE
+#  define CONFIG_NETUTILS_DNSCACHE_HOSTFILE "/etc/hosts"
+#endif
+
+#define DNSCACHE_MAXSERVERS  3
+#define DNSCACHE_PORT        53
+#define DNSCACHE_MSGSIZE     512
+#define DNSCACHE_LINESIZE    128
+
+/* DNS message fields */
+
+#define DNS_HDRSIZE          12
+#define DNS_FLAG1_RD         0x01
+#define DNS_FLAG1_QR         0x80
+#define DNS_FLAG2_RCODE      0x0f
+#define DNS_RCODE_NXDOMAIN   3
+#define DNS_TYPE_A           1
+#define DNS_TYPE_AAAA        28
+#define DNS_CLASS_IN         1
+
+/* Query slots, each query of a lookup goes out at the same time */
+
+#define DNSCACHE_QUERY_A     0
+#define DNSCACHE_QUERY_AAAA  1
+#define DNSCACHE_NQUERIES    2
+
+#define DNSCACHE_NOTFOUND    1     /* Internal: authoritative "no" */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct dnscache_entry_s
+{
+  struct dnscache_addr_s addr;
+  time_t   expiry;               /* Monotonic seconds */
+  time_t   lastuse;              /* For LRU replacement */
+  uint32_t hits;
+  bool     inuse;
+  bool     pinned;               /* From the hosts file, never expires */
+  bool     negative;             /* A remembered failure */
+  char     name[CONFIG_NETUTILS_DNSCACHE_NAMESIZE];
+};
+
+#ifdef CONFIG_NETDB_DNSCLIENT
+struct dnscache_servers_s
+{
+  struct sockaddr_storage addr[DNSCACHE_MAXSERVERS];
+  socklen_t addrlen[DNSCACHE_MAXSERVERS];
+  int nservers;
+};
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct dnscache_entry_s g_dnscache[CONFIG_NETUTILS_DNSCACHE_ENTRIES];
+static struct dnscache_stats_s g_dnscache_stats;
+static bool g_dnscache_loaded;
+static sem_t g_dnscache_sem = SEM_INITIALIZER(1);
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void dnscache_lock(void)
+{
+  while (sem_wait(&g_dnscache_sem) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+}
+
+static inline void dnscache_unlock(void)
+{
+  sem_post(&g_dnscache_sem);
+}
+
+static void dnscache_gettime(FAR struct timespec *ts)
+{
+#ifdef CONFIG_CLOCK_MONOTONIC
+  (void)clock_gettime(CLOCK_MONOTONIC, ts);
+#else
+  (void)clock_gettime(CLOCK_REALTIME, ts);
+#endif
+}
+
+static time_t dnscache_now(void)
+{
+  struct timespec ts;
+
+  dnscache_gettime(&ts);
+  return ts.tv_sec;
+}
+
+static void dnscache_count(FAR uint32_t *counter)
+{
+  dnscache_lock();
+  (*counter)++;
+  dnscache_unlock();
+}
+
+static int dnscache_clampttl(uint32_t ttl)
+{
+  if (ttl < CONFIG_NETUTILS_DNSCACHE_MINTTL)
+    {
+      return CONFIG_NETUTILS_DNSCACHE_MINTTL;
+    }
+
+  if (ttl > CONFIG_NETUTILS_DNSCACHE_MAXTTL)
+    {
+      return CONFIG_NETUTILS_DNSCACHE_MAXTTL;
+    }
+
+  return (int)ttl;
+}
+
+static bool dnscache_live(FAR const struct dnscache_entry_s *entry,
+                          time_t now)
+{
+  return entry->inuse && (entry->pinned || entry->expiry > now);
+}
+
+/* Find the entry for a name, live or not.  Called with the cache locked. */
+
+static FAR struct dnscache_entry_s *dnscache_find(FAR const char *name)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_NETUTILS_DNSCACHE_ENTRIES; i++)
+    {
+      if (g_dnscache[i].inuse && strcasecmp(g_dnscache[i].name, name) == 0)
+        {
+          return &g_dnscache[i];
+        }
+    }
+
+  return NULL;
+}
+
+/* Find the entry to (re)use for a name: its own, a free or expired one, or
+ * the least recently used one that is not pinned.  Called with the cache
+ * locked.
+ */
+
+static FAR struct dnscache_entry_s *dnscache_slot(FAR const char *name,
+                                                  time_t now)
+{
+  FAR struct dnscache_entry_s *entry;
+  FAR struct dnscache_entry_s *lru = NULL;
+  int i;
+
+  entry = dnscache_find(name);
+  if (entry != NULL)
+    {
+      return entry;
+    }
+
+  for (i = 0; i < CONFIG_NETUTILS_DNSCACHE_ENTRIES; i++)
+    {
+      entry = &g_dnscache[i];
+      if (!dnscache_live(entry, now))
+        {
+          return entry;
+        }
+
+      if (!entry->pinned && (lru == NULL || entry->lastuse < lru->lastuse))
+        {
+          lru = entry;
+        }
+    }
+
+  if (lru != NULL)
+    {
+      g_dnscache_stats.evictions++;
+    }
+
+  return lru;
+}
+
+static void dnscache_store(FAR const char *name,
+                           FAR const struct dnscache_addr_s *addr,
+                           int ttl, bool negative)
+{
+  FAR struct dnscache_entry_s *entry;
+  time_t now;
+
+  if (strlen(name) >= CONFIG_NETUTILS_DNSCACHE_NAMESIZE)
+    {
+      return;
+    }
+
+  now = dnscache_now();
+
+  dnscache_lock();
+  entry = dnscache_slot(name, now);
+  if (entry != NULL && !entry->pinned)
+    {
+      memset(entry, 0, sizeof(*entry));
+      if (addr != NULL)
+        {
+          entry->addr = *addr;
+        }
+
+      entry->expiry   = now + ttl;
+      entry->lastuse  = now;
+      entry->inuse    = true;
+      entry->negative = negative;
+      strcpy(entry->name, name);
+    }
+
+  dnscache_unlock();
+}
+
+/* Add one hosts file name.  Called with the cache locked. */
+
+static bool dnscache_pin(FAR const char *name, int family,
+                         FAR const void *inaddr)
+{
+  FAR struct dnscache_entry_s *entry;
+
+  if (strlen(name) >= CONFIG_NETUTILS_DNSCACHE_NAMESIZE)
+    {
+      return false;
+    }
+
+  entry = dnscache_slot(name, dnscache_now());
+  if (entry == NULL)
+    {
+      return false;
+    }
+
+  /* An IPv4 and an IPv6 line for the same name merge into one entry */
+
+  if (!entry->inuse || !entry->pinned)
+    {
+      memset(entry, 0, sizeof(*entry));
+      entry->inuse  = true;
+      entry->pinned = true;
+      strcpy(entry->name, name);
+    }
+
+  if (family == AF_INET)
+    {
+      memcpy(&entry->addr.ipv4, inaddr, sizeof(struct in_addr));
+      entry->addr.have_ipv4 = true;
+    }
+  else
+    {
+      memcpy(&entry->addr.ipv6, inaddr, sizeof(struct in6_addr));
+      entry->addr.have_ipv6 = true;
+    }
+
+  return true;
+}
+
+static int dnscache_loadhosts_locked(FAR const char *path)
+{
+  char line[DNSCACHE_LINESIZE];
+  struct in6_addr inaddr;
+  FAR char *saveptr;
+  FAR char *token;
+  FAR FILE *stream;
+  int family;
+  int count = 0;
+
+  stream = fopen(path, "r");
+  if (stream == NULL)
+    {
+      return -errno;
+    }
+
+  while (fgets(line, sizeof(line), stream) != NULL)
+    {
+      token = strchr(line, '#');
+      if (token != NULL)
+        {
+          *token = '\0';
+        }
+
+      token = strtok_r(line, " \t\r\n", &saveptr);
+      if (token == NULL)
+        {
+          continue;
+        }
+
+      if (inet_pton(AF_INET, token, &inaddr) == 1)
+        {
+          family = AF_INET;
+        }
+      else if (inet_pton(AF_INET6, token, &inaddr) == 1)
+        {
+          family = AF_INET6;
+        }
+      else
+        {
+          continue;
+        }
+
+      while ((token = strtok_r(NULL, " \t\r\n", &saveptr)) != NULL)
+        {
+          if (dnscache_pin(token, family, &inaddr))
+            {
+              count++;
+            }
+        }
+    }
+
+  fclose(stream);
+  return count;
+}
+
+/* Resolve through the libc resolver.  No TTL is known. */
+
+static int dnscache_gethostbyname(FAR const char *hostname,
+                                  FAR struct dnscache_addr_s *addr)
+{
+  FAR struct hostent *he;
+
+  he = gethostbyname(hostname);
+  if (he == NULL)
+    {
+      return -ENOENT;
+    }
+
+  memset(addr, 0, sizeof(*addr));
+  if (he->h_addrtype == AF_INET)
+    {
+      memcpy(&addr->ipv4, he->h_addr, sizeof(struct in_addr));
+      addr->have_ipv4 = true;
+    }
+  else if (he->h_addrtype == AF_INET6)
+    {
+      memcpy(&addr->ipv6, he->h_addr, sizeof(struct in6_addr));
+      addr->have_ipv6 = true;
+    }
+  else
+    {
+      return -ENOENT;
+    }
+
+  return OK;
+}
+
+#ifdef CONFIG_NETDB_DNSCLIENT
+static int dnscache_addserver(FAR void *arg, FAR struct sockaddr *addr,
+                              FAR socklen_t addrlen)
+{
+  FAR struct dnscache_servers_s *servers = arg;
+  int n = servers->nservers;
+
+  if (addrlen > sizeof(struct sockaddr_storage))
+    {
+      return 0;
+    }
+
+  memcpy(&servers->addr[n], addr, addrlen);
+  servers->addrlen[n] = addrlen;
+
+  /* The name servers may be stored without a port */
+
+  if (addr->sa_family == AF_INET)
+    {
+      FAR struct sockaddr_in *in = (FAR struct sockaddr_in *)&servers->addr[n];
+      if (in->sin_port == 0)
+        {
+          in->sin_port = HTONS(DNSCACHE_PORT);
+        }
+    }
+#ifdef CONFIG_NET_IPv6
+  else if (addr->sa_family == AF_INET6)
+    {
+      FAR struct sockaddr_in6 *in6 =
+        (FAR struct sockaddr_in6 *)&servers->addr[n];
+      if (in6->sin6_port == 0)
+        {
+          in6->sin6_port = HTONS(DNSCACHE_PORT);
+        }
+    }
+#endif
+
+  servers->nservers = ++n;
+  return n >= DNSCACHE_MAXSERVERS;
+}
+
+/* Encode a query for 'type', returning its length or -E2BIG */
+
+static int dnscache_mkquery(FAR uint8_t *msg, uint16_t id,
+                            FAR const char *hostname, uint16_t type)
+{
+  FAR const char *label = hostname;
+  FAR uint8_t *ptr;
+  size_t len;
+
+  memset(msg, 0, DNS_HDRSIZE);
+  msg[0] = id >> 8;
+  msg[1] = id & 0xff;
+  msg[2] = DNS_FLAG1_RD;
+  msg[5] = 1;                    /* One question */
+
+  ptr = msg + DNS_HDRSIZE;
+  while (*label != '\0')
+    {
+      len = strcspn(label, ".");
+      if (len == 0 || len > 63 ||
+          ptr + len + 1 + 5 > msg + DNSCACHE_MSGSIZE)
+        {
+          return -E2BIG;
+        }
+
+      *ptr++ = len;
+      memcpy(ptr, label, len);
+      ptr   += len;
+      label += len;
+      if (*label == '.')
+        {
+          label++;
+        }
+    }
+
+  *ptr++ = 0;
+  *ptr++ = type >> 8;
+  *ptr++ = type & 0xff;
+  *ptr++ = 0;
+  *ptr++ = DNS_CLASS_IN;
+  return ptr - msg;
+}
+
+/* Skip an encoded, possibly compressed, name.  Returns NULL if the name
+ * runs past the end of the message.
+ */
+
+static FAR const uint8_t *dnscache_skipname(FAR const uint8_t *ptr,
+                                            FAR const uint8_t *end)
+{
+  while (ptr < end)
+    {
+      if (*ptr == 0)
+        {
+          return ptr + 1;
+        }
+
+      if ((*ptr & 0xc0) == 0xc0)
+        {
+          return ptr + 2 <= end ? ptr + 2 : NULL;
+        }
+
+      ptr += *ptr + 1;
+    }
+
+  return NULL;
+}
+
+/* Parse an answer into 'addr' and lower '*ttl' to the TTL of the records
+ * used.  Returns OK, DNSCACHE_NOTFOUND for a negative answer, or a negated
+ * errno value if the message is not usable.
+ */
+
+static int dnscache_parse(FAR const uint8_t *msg, size_t len,
+                          FAR struct dnscache_addr_s *addr,
+                          FAR uint32_t *ttl)
+{
+  FAR const uint8_t *end = msg + len;
+  FAR const uint8_t *ptr;
+  uint16_t nquestions;
+  uint16_t nanswers;
+  uint16_t type;
+  uint16_t rrclass;
+  uint16_t rdlen;
+  uint32_t rrttl;
+  bool found = false;
+
+  if ((msg[2] & DNS_FLAG1_QR) == 0)
+    {
+      return -EPROTO;
+    }
+
+  if ((msg[3] & DNS_FLAG2_RCODE) == DNS_RCODE_NXDOMAIN)
+    {
+      return DNSCACHE_NOTFOUND;
+    }
+  else if ((msg[3] & DNS_FLAG2_RCODE) != 0)
+    {
+      return -EAGAIN;
+    }
+
+  nquestions = (msg[4] << 8) | msg[5];
+  nanswers   = (msg[6] << 8) | msg[7];
+
+  ptr = msg + DNS_HDRSIZE;
+  while (nquestions-- > 0)
+    {
+      ptr = dnscache_skipname(ptr, end);
+      if (ptr == NULL || ptr + 4 > end)
+        {
+          return -EPROTO;
+        }
+
+      ptr += 4;
+    }
+
+  while (nanswers-- > 0)
+    {
+      ptr = dnscache_skipname(ptr, end);
+      if (ptr == NULL || ptr + 10 > end)
+        {
+          return -EPROTO;
+        }
+
+      type    = (ptr[0] << 8) | ptr[1];
+      rrclass = (ptr[2] << 8) | ptr[3];
+      rrttl   = ((uint32_t)ptr[4] << 24) | ((uint32_t)ptr[5] << 16) |
+                ((uint32_t)ptr[6] << 8) | ptr[7];
+      rdlen   = (ptr[8] << 8) | ptr[9];
+      ptr    += 10;
+
+      if (ptr + rdlen > end)
+        {
+          return -EPROTO;
+        }
+
+      /* CNAME records are skipped: the server follows the chain and
+       * includes the addresses of the canonical name in the answer.
+       */
+
+      if (rrclass == DNS_CLASS_IN && type == DNS_TYPE_A && rdlen == 4 &&
+          !addr->have_ipv4)
+        {
+          memcpy(&addr->ipv4, ptr, 4);
+          addr->have_ipv4 = true;
+          found = true;
+        }
+      else if (rrclass == DNS_CLASS_IN && type == DNS_TYPE_AAAA &&
+               rdlen == 16 && !addr->have_ipv6)
+        {
+          memcpy(&addr->ipv6, ptr, 16);
+          addr->have_ipv6 = true;
+          found = true;
+        }
+      else
+        {
+          ptr += rdlen;
+          continue;
+        }
+
+      if (rrttl < *ttl)
+        {
+          *ttl = rrttl;
+        }
+
+      ptr += rdlen;
+    }
+
+  return found ? OK : DNSCACHE_NOTFOUND;
+}
+
+/* Send the A and AAAA queries to one server and wait for both answers.
+ * Returns OK if any address was found, DNSCACHE_NOTFOUND if the server
+ * says the name does not exist, or a negated errno value to try the next
+ * server.
+ */
+
+static int dnscache_ask(FAR const struct sockaddr *server, socklen_t srvlen,
+                        FAR const char *hostname,
+                        FAR struct dnscache_addr_s *addr, FAR uint32_t *ttl)
+{
+  static const uint16_t types[DNSCACHE_NQUERIES] =
+  {
+    DNS_TYPE_A, DNS_TYPE_AAAA
+  };
+
+  uint8_t msg[DNSCACHE_MSGSIZE];
+  uint16_t ids[DNSCACHE_NQUERIES];
+  bool pending[DNSCACHE_NQUERIES];
+  struct pollfd fds;
+  struct timespec start;
+  struct timespec now;
+  ssize_t nrecvd;
+  bool notfound = false;
+  int npending = 0;
+  int sd;
+  int ret;
+  int i;
+
+  sd = socket(server->sa_family, SOCK_DGRAM, 0);
+  if (sd < 0)
+    {
+      return -errno;
+    }
+
+  ret = connect(sd, server, srvlen);
+  if (ret < 0)
+    {
+      ret = -errno;
+      goto errout;
+    }
+
+  /* Both questions go out before waiting for either answer */
+
+  for (i = 0; i < DNSCACHE_NQUERIES; i++)
+    {
+      pending[i] = false;
+
+#ifndef CONFIG_NET_IPv4
+      if (types[i] == DNS_TYPE_A)
+        {
+          continue;
+        }
+#endif
+#ifndef CONFIG_NET_IPv6
+      if (types[i] == DNS_TYPE_AAAA)
+        {
+          continue;
+        }
+#endif
+
+      ids[i] = (uint16_t)rand();
+      ret = dnscache_mkquery(msg, ids[i], hostname, types[i]);
+      if (ret < 0)
+        {
+          goto errout;
+        }
+
+      if (send(sd, msg, ret, 0) == ret)
+        {
+          dnscache_count(&g_dnscache_stats.queries);
+          pending[i] = true;
+          npending++;
+        }
+    }
+
+  dnscache_gettime(&start);
+  ret = -ETIMEDOUT;
+
+  while (npending > 0)
+    {
+      fds.fd      = sd;
+      fds.events  = POLLIN;
+      fds.revents = 0;
+
+      dnscache_gettime(&now);
+      i = CONFIG_NETUTILS_DNSCACHE_TIMEOUT -
+          ((now.tv_sec - start.tv_sec) * 1000 +
+           (now.tv_nsec - start.tv_nsec) / 1000000);
+      if (i <= 0 || poll(&fds, 1, i) <= 0)
+        {
+          break;
+        }
+
+      nrecvd = recv(sd, msg, sizeof(msg), 0);
+      if (nrecvd < DNS_HDRSIZE)
+        {
+          continue;
+        }
+
+      for (i = 0; i < DNSCACHE_NQUERIES; i++)
+        {
+          if (pending[i] && ((msg[0] << 8) | msg[1]) == ids[i])
+            {
+              break;
+            }
+        }
+
+      if (i >= DNSCACHE_NQUERIES)
+        {
+          continue;
+        }
+
+      pending[i] = false;
+      npending--;
+
+      ret = dnscache_parse(msg, nrecvd, addr, ttl);
+      if (ret == DNSCACHE_NOTFOUND)
+        {
+          notfound = true;
+        }
+      else if (ret < 0)
+        {
+          nwarn("WARNING: Unusable answer for %s: %d\n", hostname, ret);
+        }
+    }
+
+  if (addr->have_ipv4 || addr->have_ipv6)
+    {
+      ret = OK;
+    }
+  else if (notfound)
+    {
+      ret = DNSCACHE_NOTFOUND;
+    }
+  else if (ret >= 0)
+    {
+      ret = -ETIMEDOUT;
+    }
+
+errout:
+  close(sd);
+  return ret;
+}
+
+static int dnscache_query(FAR const char *hostname,
+                          FAR struct dnscache_addr_s *addr,
+                          FAR uint32_t *ttl)
+{
+  struct dnscache_servers_s servers;
+  int ret = -ENOENT;
+  int i;
+
+  servers.nservers = 0;
+  dns_foreach_nameserver(dnscache_addserver, &servers);
+
+  for (i = 0; i < servers.nservers; i++)
+    {
+      memset(addr, 0, sizeof(*addr));
+      *ttl = UINT32_MAX;
+
+      ret = dnscache_ask((FAR struct sockaddr *)&servers.addr[i],
+                         servers.addrlen[i], hostname, addr, ttl);
+      if (ret >= 0)
+        {
+          break;
+        }
+    }
+
+  return ret;
+}
+#endif /* CONFIG_NETDB_DNSCLIENT */
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: dnscache_lookup
+ *
+ * Description:
+ *   Return the addresses of a host name from the cache or, on a miss, from
+ *   the name servers.  The A and AAAA questions of a miss are sent
+ *   together and the entry lives as long as the shortest TTL in the
+ *   answers.  If no name server answers, gethostbyname() is tried.
+ *
+ * Input Parameters:
+ *   hostname - A host name or a numeric IPv4 or IPv6 address
+ *   addr     - The location to return the addresses
+ *
+ * Returned Value:
+ *   Zero (OK) on success; -ENOENT if the name cannot be resolved.
+ *
+ ****************************************************************************/
+
+int dnscache_lookup(FAR const char *hostname,
+                    FAR struct dnscache_addr_s *addr)
+{
+  FAR struct dnscache_entry_s *entry;
+  uint32_t ttl = CONFIG_NETUTILS_DNSCACHE_MAXTTL;
+  time_t now;
+  int ret;
+
+  memset(addr, 0, sizeof(*addr));
+
+  /* Numeric addresses need no lookup */
+
+  if (inet_pton(AF_INET, hostname, &addr->ipv4) == 1)
+    {
+      addr->have_ipv4 = true;
+      return OK;
+    }
+
+  if (inet_pton(AF_INET6, hostname, &addr->ipv6) == 1)
+    {
+      addr->have_ipv6 = true;
+      return OK;
+    }
+
+  dnscache_lock();
+  if (!g_dnscache_loaded)
+    {
+      g_dnscache_loaded = true;
+      if (CONFIG_NETUTILS_DNSCACHE_HOSTFILE[0] != '\0')
+        {
+          (void)dnscache_loadhosts_locked(CONFIG_NETUTILS_DNSCACHE_HOSTFILE);
+        }
+    }
+
+  now   = dnscache_now();
+  entry = dnscache_find(hostname);
+  if (entry != NULL && dnscache_live(entry, now))
+    {
+      entry->lastuse = now;
+      entry->hits++;
+      if (entry->negative)
+        {
+          g_dnscache_stats.neghits++;
+          ret = -ENOENT;
+        }
+      else
+        {
+          g_dnscache_stats.hits++;
+          *addr = entry->addr;
+          ret = OK;
+        }
+
+      dnscache_unlock();
+      return ret;
+    }
+
+  g_dnscache_stats.misses++;
+  dnscache_unlock();
+
+  /* The query is made without holding the lock so that lookups of cached
+   * names are not held up by it.
+   */
+
+#ifdef CONFIG_NETDB_DNSCLIENT
+  ret = dnscache_query(hostname, addr, &ttl);
+#else
+  ret = -ENOENT;
+#endif
+
+  if (ret < 0)
+    {
+      ret = dnscache_gethostbyname(hostname, addr);
+      if (ret == OK)
+        {
+          dnscache_count(&g_dnscache_stats.fallbacks);
+        }
+    }
+
+  if (ret == OK)
+    {
+      dnscache_store(hostname, addr, dnscache_clampttl(ttl), false);
+      return OK;
+    }
+
+  if (CONFIG_NETUTILS_DNSCACHE_NEGTTL > 0)
+    {
+      dnscache_store(hostname, NULL, CONFIG_NETUTILS_DNSCACHE_NEGTTL, true);
+    }
+
+  return -ENOENT;
+}
+
+/****************************************************************************
+ * Name: dnscache_gethostip
+ *
+ * Description:
+ *   Return the IPv4 address of a host name through the cache.
+ *
+ ****************************************************************************/
+
+int dnscache_gethostip(FAR const char *hostname, FAR in_addr_t *ipv4addr)
+{
+  struct dnscache_addr_s addr;
+  int ret;
+
+  ret = dnscache_lookup(hostname, &addr);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  if (!addr.have_ipv4)
+    {
+      return -ENOENT;
+    }
+
+  memcpy(ipv4addr, &addr.ipv4, sizeof(in_addr_t));
+  return OK;
+}
+
+/****************************************************************************
+ * Name: dnscache_loadhosts
+ ****************************************************************************/
+
+int dnscache_loadhosts(FAR const char *path)
+{
+  int ret;
+
+  dnscache_lock();
+  g_dnscache_loaded = true;
+  ret = dnscache_loadhosts_locked(path);
+  dnscache_unlock();
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: dnscache_foreach
+ ****************************************************************************/
+
+int dnscache_foreach(dnscache_callback_t callback, FAR void *arg)
+{
+  FAR struct dnscache_entry_s *entry;
+  struct dnscache_info_s info;
+  time_t now;
+  int ret = 0;
+  int i;
+
+  now = dnscache_now();
+
+  dnscache_lock();
+  for (i = 0; i < CONFIG_NETUTILS_DNSCACHE_ENTRIES && ret == 0; i++)
+    {
+      entry = &g_dnscache[i];
+      if (!dnscache_live(entry, now))
+        {
+          continue;
+        }
+
+      info.name     = entry->name;
+      info.addr     = &entry->addr;
+      info.ttl      = entry->pinned ? -1 : (int32_t)(entry->expiry - now);
+      info.hits     = entry->hits;
+      info.negative = entry->negative;
+
+      ret = callback(arg, &info);
+    }
+
+  dnscache_unlock();
+  return ret;
+}
+
+/****************************************************************************
+ * Name: dnscache_getstats
+ ****************************************************************************/
+
+void dnscache_getstats(FAR struct dnscache_stats_s *stats)
+{
+  dnscache_lock();
+  *stats = g_dnscache_stats;
+  dnscache_unlock();
+}
+
+/****************************************************************************
+ * Name: dnscache_flush
+ ****************************************************************************/
+
+void dnscache_flush(void)
+{
+  dnscache_lock();
+  memset(g_dnscache, 0, sizeof(g_dnscache));
+  memset(&g_dnscache_stats, 0, sizeof(g_dnscache_stats));
+  g_dnscache_loaded = false;
+  dnscache_unlock();
+}
@@ -78,6 +78,14 @@
 #   define CONFIG_NETUTILS_ESP8266_MAXRXLEN  256
 #endif
 
+#ifndef CONFIG_NETUTILS_ESP8266_RXBUF_LEN
+#   define CONFIG_NETUTILS_ESP8266_RXBUF_LEN  512
+#endif
+
+#ifndef CONFIG_NETUTILS_ESP8266_SOCKET_FIFO_LEN
+#   define CONFIG_NETUTILS_ESP8266_SOCKET_FIFO_LEN  2048
+#endif
+
 #if (CONFIG_NETUTILS_ESP8266_MAXRXLEN < CONFIG_NETUTILS_ESP8266_WORKER_BUF_LEN)
 #   error "CONFIG_NETUTILS_ESP8266_WORKER_BUF_LEN whould be bigger than CONFIG_NETUTILS_ESP8266_MAXRXLEN"
 #endif
@@ -85,6 +93,7 @@
 #define BUF_CMD_LEN     CONFIG_NETUTILS_ESP8266_MAXTXLEN
 #define BUF_ANS_LEN     CONFIG_NETUTILS_ESP8266_MAXRXLEN
 #define BUF_WORKER_LEN  CONFIG_NETUTILS_ESP8266_WORKER_BUF_LEN
+#define BUF_READ_LEN    CONFIG_NETUTILS_ESP8266_RXBUF_LEN
 
 
 #define CON_NBR 4
@@ -100,16 +109,19 @@
 #define lespTIMEOUT_FLOODING_OFFSET_S 3
 #define lespTIMEOUT_MS_RECV_S       60
 
+/* The module accepts at most 2048 bytes per AT+CIPSEND */
+
+#define lespMAX_CIPSEND_LEN         2048
+
 #define lespCON_USED_MASK(idx)      (1<<(idx))
 #define lespPOLLING_TIME_MS         1000
 
-/* Must be a power of 2 */
-
-#define SOCKET_FIFO_SIZE            2048
+#define SOCKET_FIFO_SIZE            CONFIG_NETUTILS_ESP8266_SOCKET_FIFO_LEN
 #define SOCKET_NBR                  4
 
 #define FLAGS_SOCK_USED             (1 << 0)
 #define FLAGS_SOCK_CONNECTED        (1 << 1)
+#define FLAGS_SOCK_SENDERR          (1 << 4) /* Last deferred send failed */
 
 #define FLAGS_SOCK_TYPE_MASK        (3 << 2)
 #define FLAGS_SOCK_TYPE_TCP         (0 << 2)
@@ -122,11 +134,20 @@
 
 typedef enum
 {
-  lesp_eERR  = -1,
-  lesp_eNONE =  0,
-  lesp_eOK   =  1
+  lesp_eERR    = -1,
+  lesp_eNONE   =  0,
+  lesp_eOK     =  1,
+  lesp_ePROMPT =  2,  /* '>' prompt for the data of AT+CIPSEND */
+  lesp_eSENDOK =  3   /* "SEND OK" at end of the data of AT+CIPSEND */
 }lesp_ans_t;
 
+/* The worker fills a socket FIFO and lesp_recv() empties it.  Each socket
+ * has its own mutex for the FIFO indexes so that readers of different
+ * sockets, and the worker parsing AT answers, do not wait on each other.
+ * Only the worker writes at 'inndx' and only readers read at 'outndx', so
+ * data is moved without holding the mutex.
+ */
+
 typedef struct
 {
   sem_t          *sem;
@@ -134,6 +155,7 @@ typedef struct
   uint16_t        inndx;
   uint16_t        outndx;
   struct timespec rcv_timeo;
+  pthread_mutex_t mutex;            /* Protects inndx, outndx, sem */
   uint8_t         rxbuf[SOCKET_FIFO_SIZE];
 } lesp_socket_t;
 
@@ -144,6 +166,12 @@ typedef struct
 
   char            rxbuf[BUF_WORKER_LEN];
 
+  /* Bytes read from the module in bulk, owned by the worker thread */
+
+  uint8_t         rdbuf[BUF_READ_LEN];
+  int             rdpos;            /* Next byte to parse */
+  int             rdlen;            /* Number of bytes in rdbuf */
+
   sem_t           sem;              /* Inform that something is received */
   char            buf[BUF_ANS_LEN]; /* Last complete line received */
   lesp_ans_t      ans;              /* Last ans received (OK,FAIL or ERROR) */
@@ -158,6 +186,8 @@ typedef struct
   lesp_worker_t   worker;
   lesp_socket_t   sockets[SOCKET_NBR];
   lesp_ans_t      ans;
+  bool            insync;           /* Last command got its final answer */
+  int             sendpending;      /* Socket waiting "SEND OK" or -1 */
   char            bufans[BUF_ANS_LEN];
   char            bufcmd[BUF_CMD_LEN];
   struct hostent  hostent;
@@ -174,6 +204,7 @@ typedef struct
  ****************************************************************************/
 
 static int lesp_low_level_read(uint8_t *buf, int size);
+static int lesp_send_wait(void);
 static inline int lesp_read_ipd(int sockfd, int len);
 static lesp_socket_t *get_sock(int sockfd);
 
@@ -190,6 +221,8 @@ lesp_state_t g_lesp_state =
   .worker.ans     = lesp_eNONE,
   .worker.mutex   = PTHREAD_MUTEX_INITIALIZER,
   .ans            = lesp_eNONE,
+  .insync         = false,
+  .sendpending    = -1,
 };
 
 /****************************************************************************
@@ -391,6 +424,8 @@ static void set_sock_closed(int sockfd)
   DEBUGASSERT(((unsigned int)sockfd) < SOCKET_NBR);
 
   sock         = &g_lesp_state.sockets[sockfd];
+
+  pthread_mutex_lock(&sock->mutex);
   sem          = sock->sem;
   sock->sem    = NULL;
   sock->flags  = 0;
@@ -403,6 +438,37 @@ static void set_sock_closed(int sockfd)
     {
       sem_post(sem);
     }
+
+  pthread_mutex_unlock(&sock->mutex);
+}
+
+/****************************************************************************
+ * Name: lesp_fifo_space
+ *
+ * Description:
+ *   Get the contiguous free space at the head of a socket FIFO.
+ *
+ * Note:
+ *  sock->mutex should be locked.
+ *
+ * Input Parmeters:
+ *   sock : socket whose FIFO will be written.
+ *
+ * Returned Value:
+ *   number of bytes that can be written at sock->inndx.
+ *
+ ****************************************************************************/
+
+static inline int lesp_fifo_space(lesp_socket_t *sock)
+{
+  /* One byte stays free so that a full FIFO differs from an empty one */
+
+  if (sock->inndx >= sock->outndx)
+    {
+      return SOCKET_FIFO_SIZE - sock->inndx - (sock->outndx == 0 ? 1 : 0);
+    }
+
+  return sock->outndx - sock->inndx - 1;
 }
 
 /****************************************************************************
@@ -464,6 +530,11 @@ static int lesp_low_level_read(uint8_t *buf, int size)
  *   Try to treat an '+IPD' command in worker buffer.  Worker buffer should
  *   already contain '+IPD,<id>,<len>:'
  *
+ *   The payload is taken from what the worker has already read in bulk,
+ *   then read from the serial port straight into the socket FIFO.  The
+ *   worker mutex is released meanwhile so that AT answers waiting in the
+ *   worker buffer and the other sockets are not held up.
+ *
  * Note:
  *  g_lesp_state.worker.mutex should be locked.
  *
@@ -478,7 +549,12 @@ static int lesp_low_level_read(uint8_t *buf, int size)
 
 static inline int lesp_read_ipd(int sockfd, int len)
 {
+  lesp_worker_t *worker = &g_lesp_state.worker;
   lesp_socket_t *sock;
+  uint8_t *dst;
+  int space;
+  int size;
+  int ret = 1;
 
   sock = get_sock(sockfd);
 
@@ -489,82 +565,147 @@ static inline int lesp_read_ipd(int sockfd, int len)
       nwarn("socket not opened: drop all data.\n");
     }
 
-  while (len)
+  pthread_mutex_unlock(&worker->mutex);
+
+  while (len > 0)
     {
-      int size;
-      uint8_t *buf = (uint8_t *)g_lesp_state.worker.rxbuf;
+      /* Find where the next chunk goes */
 
-      size = len;
-      if (size >= BUF_WORKER_LEN)
+      dst   = NULL;
+      space = 0;
+
+      if (sock != NULL)
         {
-          size = BUF_WORKER_LEN;
+          pthread_mutex_lock(&sock->mutex);
+          space = lesp_fifo_space(sock);
+          pthread_mutex_unlock(&sock->mutex);
+
+          if (space == 0)
+            {
+              usleep(100); /* leave time of aplicative to read buffer */
+
+              pthread_mutex_lock(&sock->mutex);
+              space = lesp_fifo_space(sock);
+              pthread_mutex_unlock(&sock->mutex);
+            }
+
+          if (space > 0)
+            {
+              dst = &sock->rxbuf[sock->inndx];
+            }
+          else
+            {
+              /* No.. the we will lose data */
+
+              nwarn("overflow socket %d\n", sockfd);
+            }
         }
 
-      size = lesp_low_level_read(buf, size);
-      if (size <= 0)
+      size = len;
+      if (dst != NULL && size > space)
         {
-          return -1;
+          size = space;
         }
 
-      len -= size;
+      /* Use the bytes already read first, then read from the module */
 
-      if (sock != NULL)
+      if (worker->rdpos < worker->rdlen)
         {
-          while (size--)
+          if (size > worker->rdlen - worker->rdpos)
             {
-              int next;
-              uint8_t b;
-
-              /* Read the next byte from the buffer */
+              size = worker->rdlen - worker->rdpos;
+            }
 
-              b = *buf++;
+          if (dst != NULL)
+            {
+              memcpy(dst, &worker->rdbuf[worker->rdpos], size);
+            }
 
-              /* Pre-calculate the next 'inndx'.  We do this so that we can
-               * check if the FIFO is full.
-               */
+          worker->rdpos += size;
+        }
+      else
+        {
+          if (dst == NULL)
+            {
+              /* Read into the worker buffer to discard */
 
-              next = sock->inndx + 1;
-              if (next >= SOCKET_FIFO_SIZE)
+              dst = worker->rdbuf;
+              if (size > BUF_READ_LEN)
                 {
-                  next -= SOCKET_FIFO_SIZE;
+                  size = BUF_READ_LEN;
                 }
 
-              /* Is there space in the circular buffer for another byte?  If
-               * the next 'inndx' would be equal to the 'outndx', then the
-               * circular buffer is full.
-               */
+              size = lesp_low_level_read(dst, size);
+              dst  = NULL;
+            }
+          else
+            {
+              size = lesp_low_level_read(dst, size);
+            }
 
-              if (next == sock->outndx)
-                {
-                  pthread_mutex_unlock(&g_lesp_state.worker.mutex);
-                  usleep(100); /* leave time of aplicative to read buffer */
-                  pthread_mutex_lock(&g_lesp_state.worker.mutex);
-                }
+          if (size <= 0)
+            {
+              ret = -1;
+              break;
+            }
+        }
 
-              if (next != sock->outndx)
-                {
-                  /* Yes.. add the byte to the circular buffer */
+      len -= size;
 
-                  sock->rxbuf[sock->inndx] = b;
-                  sock->inndx = next;
-                }
-              else
+      /* Publish the new data unless the socket was closed meanwhile */
+
+      if (dst != NULL)
+        {
+          pthread_mutex_lock(&sock->mutex);
+          if ((sock->flags & FLAGS_SOCK_USED) != 0)
+            {
+              sock->inndx += size;
+              if (sock->inndx >= SOCKET_FIFO_SIZE)
                 {
-                  /* No.. the we have lost data */
+                  sock->inndx -= SOCKET_FIFO_SIZE;
+                }
 
-                  nwarn("overflow socket 0x%02X\n", b);
+              if (sock->sem)
+                {
+                  ninfo("post %p \n", sock->sem);
+                  sem_post(sock->sem);
                 }
             }
 
-          if (sock->sem)
-            {
-              ninfo("post %p \n", sock->sem);
-              sem_post(sock->sem);
-            }
+          pthread_mutex_unlock(&sock->mutex);
         }
     }
 
-  return 1;
+  pthread_mutex_lock(&worker->mutex);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: lesp_drain
+ *
+ * Description:
+ *   Discard answer lines already received without waiting.  Called before
+ *   each command so that unsolicited lines are not taken as its answer.
+ *
+ * Input Parmeters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+static void lesp_drain(void)
+{
+  while (sem_trywait(&g_lesp_state.worker.sem) == 0);
+
+  pthread_mutex_lock(&g_lesp_state.worker.mutex);
+  g_lesp_state.worker.buf[0] = '\0';
+  g_lesp_state.worker.ans = lesp_eNONE;
+  pthread_mutex_unlock(&g_lesp_state.worker.mutex);
+
+  lesp_clear_read_buffer();
+  lesp_clear_read_ans();
 }
 
 /****************************************************************************
@@ -596,6 +737,11 @@ int lesp_vsend_cmd(FAR const IPTR char *format, va_list ap)
 
   ninfo("Write:%s\n", g_lesp_state.bufcmd);
 
+  /* Until its final answer is read the command is in flight */
+
+  lesp_drain();
+  g_lesp_state.insync = false;
+
   ret = write(g_lesp_state.fd, g_lesp_state.bufcmd, ret);
   if (ret < 0)
     {
@@ -627,9 +773,6 @@ static int lesp_send_cmd(FAR const IPTR char *format, ...)
   int ret = 0;
   va_list ap;
 
-  lesp_clear_read_buffer();
-  lesp_clear_read_ans();
-
   /* Let lesp_vsend_cmd do the real work */
 
   va_start(ap, format);
@@ -738,27 +881,28 @@ static void lesp_flush(void)
 }
 
 /****************************************************************************
- * Name: lesp_read_ans_ok
+ * Name: lesp_read_ans
  *
  * Description:
- *   Read up to read OK, ERROR, or FAIL.
+ *   Read up to the expected answer, ERROR, or FAIL.
  *
  * Input Parmeters:
+ *   ans        : answer that ends the command.
  *   timeout_ms : timeout in millisecond.
  *
  * Returned Value:
- *   0 on OK, -1 on error.
+ *   0 on expected answer, -1 on error.
  *
  ****************************************************************************/
 
-int lesp_read_ans_ok(int timeout_ms)
+static int lesp_read_ans(lesp_ans_t ans, int timeout_ms)
 {
   int ret = 0;
   time_t end;
 
   end = time(NULL) + (timeout_ms/1000) + lespTIMEOUT_FLOODING_OFFSET_S;
 
-  while (g_lesp_state.ans != lesp_eOK)
+  while (g_lesp_state.ans != ans)
     {
       ret = lesp_read(timeout_ms);
 
@@ -772,12 +916,37 @@ int lesp_read_ans_ok(int timeout_ms)
       ninfo("Got:%s\n", g_lesp_state.bufans);
     }
 
+  /* Both the expected answer and an error end the command, only a timeout
+   * leaves the answer stream in an unknown state.
+   */
+
+  g_lesp_state.insync = (ret >= 0) || (g_lesp_state.ans == lesp_eERR);
+
   lesp_clear_read_ans();
   lesp_clear_read_buffer();
 
   return ret;
 }
 
+/****************************************************************************
+ * Name: lesp_read_ans_ok
+ *
+ * Description:
+ *   Read up to read OK, ERROR, or FAIL.
+ *
+ * Input Parmeters:
+ *   timeout_ms : timeout in millisecond.
+ *
+ * Returned Value:
+ *   0 on OK, -1 on error.
+ *
+ ****************************************************************************/
+
+int lesp_read_ans_ok(int timeout_ms)
+{
+  return lesp_read_ans(lesp_eOK, timeout_ms);
+}
+
 /****************************************************************************
  * Name: lesp_ask_ans_ok
  *
@@ -810,6 +979,54 @@ static int lesp_ask_ans_ok(int timeout_ms, FAR const IPTR char *format, ...)
   return ret;
 }
 
+/****************************************************************************
+ * Name: lesp_send_wait
+ *
+ * Description:
+ *   Wait for the "SEND OK" of the last AT+CIPSEND.  lesp_send() returns as
+ *   soon as the data is written so that the module transmits while the
+ *   application prepares the next data; the answer is collected by the
+ *   next command.  A failure is reported by the next send on the socket.
+ *
+ * Input Parmeters:
+ *   None
+ *
+ * Returned Value:
+ *   0 on success or nothing pending, -1 on error.
+ *
+ ****************************************************************************/
+
+static int lesp_send_wait(void)
+{
+  int sockfd = g_lesp_state.sendpending;
+  lesp_socket_t *sock;
+  int ret;
+
+  if (sockfd < 0)
+    {
+      return 0;
+    }
+
+  g_lesp_state.sendpending = -1;
+
+  ret = lesp_read_ans(lesp_eSENDOK, lespTIMEOUT_MS_SEND);
+  if (ret < 0)
+    {
+      nerr("ERROR: Send in socket %d failed\n", sockfd);
+
+      pthread_mutex_lock(&g_lesp_state.worker.mutex);
+      sock = get_sock(sockfd);
+      if (sock != NULL)
+        {
+          sock->flags |= FLAGS_SOCK_SENDERR;
+        }
+
+      pthread_mutex_unlock(&g_lesp_state.worker.mutex);
+    }
+
+  return ret;
+}
+
 /****************************************************************************
  * Name: lesp_check
  *
@@ -832,6 +1049,17 @@ static int lesp_check(void)
       return -1;
     }
 
+  /* Collect the end of the last send before any other command */
+
+  lesp_send_wait();
+
+  /* Only check the module if the last command was not answered */
+
+  if (g_lesp_state.insync)
+    {
+      return 0;
+    }
+
   lesp_flush();
 
   if (lesp_ask_ans_ok(lespTIMEOUT_MS, "AT\r\n") < 0)
@@ -1268,20 +1496,29 @@ static void *lesp_worker(void *args)
     {
       uint8_t c;
 
-      ret = lesp_low_level_read(&c, 1);
+      /* Read everything the serial port has at once */
 
+      ret = lesp_low_level_read(worker->rdbuf, BUF_READ_LEN);
       if (ret < 0)
         {
           nerr("ERROR: worker read data Error %d\n", ret);
+          continue;
         }
-      else if (ret > 0)
+
+      worker->rdpos = 0;
+      worker->rdlen = ret;
+
+      pthread_mutex_lock(&(worker->mutex));
+
+      while (worker->rdpos < worker->rdlen)
         {
+          c = worker->rdbuf[worker->rdpos++];
+
           /* ninfo("c:0x%02X (%c)\n", c); */
 
-          pthread_mutex_lock(&(worker->mutex));
           if (c == '\n')
             {
-              if (worker->rxbuf[rxlen-1] == '\r')
+              if (rxlen > 0 && worker->rxbuf[rxlen-1] == '\r')
                 {
                   rxlen--;
                 }
@@ -1297,12 +1534,28 @@ static void *lesp_worker(void *args)
                     {
                       worker->ans = lesp_eOK;
                     }
+                  else if (strcmp(worker->rxbuf, "SEND OK") == 0)
+                    {
+                      worker->ans = lesp_eSENDOK;
+                    }
                   else if ((strcmp(worker->rxbuf, "FAIL") == 0) ||
-                           (strcmp(worker->rxbuf, "ERROR") == 0)
+                           (strcmp(worker->rxbuf, "ERROR") == 0) ||
+                           (strcmp(worker->rxbuf, "SEND FAIL") == 0)
                           )
                     {
                       worker->ans = lesp_eERR;
                     }
+                  else if ((memcmp(worker->rxbuf, "WIFI ", 5) == 0) ||
+                           ((rxlen == 9) &&
+                            (memcmp(worker->rxbuf+1, ",CONNECT", 8) == 0)))
+                    {
+                      /* Unsolicited status, not an answer to a command */
+
+                      ninfo("Status:%s\n", worker->rxbuf);
+                      worker->rxbuf[0] = '\0';
+                      rxlen = 0;
+                      continue;
+                    }
                   else if ((rxlen == 8) &&
                             (memcmp(worker->rxbuf+1, ",CLOSED", 7) == 0))
                     {
@@ -1338,6 +1591,17 @@ static void *lesp_worker(void *args)
                   rxlen = 0;
                 }
             }
+          else if ((rxlen == 0) && (c == '>'))
+            {
+              /* "> " prompt of AT+CIPSEND is not followed by a line return */
+
+              worker->ans = lesp_ePROMPT;
+              sem_post(&worker->sem);
+            }
+          else if ((rxlen == 0) && (c == ' '))
+            {
+              /* Ignore the space of the prompt */
+            }
           else if (rxlen < BUF_WORKER_LEN - 1)
             {
               worker->rxbuf[rxlen++] = c;
@@ -1364,9 +1628,9 @@ static void *lesp_worker(void *args)
             {
               nerr("Read char overflow:%c\n", c);
             }
-
-          pthread_mutex_unlock(&(worker->mutex));
         }
+
+      pthread_mutex_unlock(&(worker->mutex));
     }
 
   return NULL;
@@ -1481,7 +1745,16 @@ int lesp_initialize(void)
 
   ninfo("Initializing Esp8266...\n");
 
-  memset(g_lesp_state.sockets, 0, SOCKET_NBR * sizeof(lesp_socket_t));
+  if (!g_lesp_state.worker.running)
+    {
+      int i;
+
+      memset(g_lesp_state.sockets, 0, SOCKET_NBR * sizeof(lesp_socket_t));
+      for (i = 0; i < SOCKET_NBR; i++)
+        {
+          pthread_mutex_init(&g_lesp_state.sockets[i].mutex, NULL);
+        }
+    }
 
   if (sem_init(&g_lesp_state.worker.sem, 0, 0) < 0)
     {
@@ -1551,6 +1824,10 @@ int lesp_soft_reset(void)
 
   pthread_mutex_lock(&g_lesp_state.mutex);
 
+  /* Nothing sent before the reset will be answered */
+
+  g_lesp_state.sendpending = -1;
+
   /* Rry to close opened reset */
 
   pthread_mutex_lock(&g_lesp_state.worker.mutex);
@@ -2157,9 +2434,13 @@ int lesp_socket(int domain, int type, int protocol)
         {
           if ((g_lesp_state.sockets[i].flags & FLAGS_SOCK_USED) == 0)
             {
+              pthread_mutex_lock(&g_lesp_state.sockets[i].mutex);
               g_lesp_state.sockets[i].flags = flags;
+              g_lesp_state.sockets[i].inndx = 0;
+              g_lesp_state.sockets[i].outndx = 0;
               g_lesp_state.sockets[i].rcv_timeo.tv_sec = lespTIMEOUT_MS_RECV_S;
               g_lesp_state.sockets[i].rcv_timeo.tv_nsec = 0;
+              pthread_mutex_unlock(&g_lesp_state.sockets[i].mutex);
               ret = i;
               break;
             }
@@ -2458,6 +2739,8 @@ ssize_t lesp_send(int sockfd, FAR const uint8_t *buf, size_t len, int flags)
 {
   int ret = 0;
   lesp_socket_t *sock = NULL;
+  size_t sent = 0;
+  size_t size;
 
   UNUSED(flags);
 
@@ -2469,43 +2752,57 @@ ssize_t lesp_send(int sockfd, FAR const uint8_t *buf, size_t len, int flags)
 
   if (ret >= 0)
     {
-      sock = get_sock_protected(sockfd);
+      pthread_mutex_lock(&g_lesp_state.worker.mutex);
+      sock = get_sock(sockfd);
       if (sock == NULL)
         {
           ret = -1;
         }
-    }
+      else if ((sock->flags & FLAGS_SOCK_SENDERR) != 0)
+        {
+          /* A previous send did not get through */
 
-  if (ret >= 0)
-    {
-      ret = lesp_ask_ans_ok(lespTIMEOUT_MS, "AT+CIPSEND=%d,%d\r\n", sockfd, len);
-    }
+          sock->flags &= ~FLAGS_SOCK_SENDERR;
+          errno = EIO;
+          ret = -1;
+        }
 
-  if (ret >= 0)
-    {
-      ninfo("Sending in socket %d, %d bytes\n", sockfd, len);
-      ret = write(g_lesp_state.fd, buf, len);
+      pthread_mutex_unlock(&g_lesp_state.worker.mutex);
     }
 
-  while (ret >= 0)
+  while (ret >= 0 && sent < len)
     {
-      char * ptr = g_lesp_state.bufans;
-      ret = lesp_read(lespTIMEOUT_MS);
+      size = len - sent;
+      if (size > lespMAX_CIPSEND_LEN)
+        {
+          size = lespMAX_CIPSEND_LEN;
+        }
 
-      if (ret < 0)
+      /* The module takes the next data once the previous are sent */
+
+      ret = lesp_send_wait();
+
+      if (ret >= 0)
         {
-          break;
+          ret = lesp_send_cmd("AT+CIPSEND=%d,%d\r\n", sockfd, (int)size);
         }
 
-      while ((*ptr != 0) && (*ptr != 'S'))
+      if (ret >= 0)
         {
-          ptr++;
+          ret = lesp_read_ans(lesp_ePROMPT, lespTIMEOUT_MS);
         }
 
-      if (*ptr == 'S')
+      if (ret >= 0)
         {
-          if (strcmp(ptr, "SEND OK") == 0)
-              break;
+          ninfo("Sending in socket %d, %d bytes\n", sockfd, (int)size);
+          ret = write(g_lesp_state.fd, buf + sent, size);
+        }
+
+      if (ret >= 0)
+        {
+          g_lesp_state.insync = false;
+          g_lesp_state.sendpending = sockfd;
+          sent += size;
         }
     }
 
@@ -2558,10 +2855,17 @@ ssize_t lesp_recv(int sockfd, FAR uint8_t *buf, size_t len, int flags)
   sock = get_sock(sockfd);
   if (sock == NULL)
     {
-      ret = -1;
+      pthread_mutex_unlock(&g_lesp_state.worker.mutex);
+      sem_destroy(&sem);
+      return -1;
     }
 
-  if (ret >= 0 && sock->inndx == sock->outndx)
+  /* From here only the socket is locked: the worker may keep parsing */
+
+  pthread_mutex_lock(&sock->mutex);
+  pthread_mutex_unlock(&g_lesp_state.worker.mutex);
+
+  if (sock->inndx == sock->outndx)
     {
       struct timespec ts;
 
@@ -2581,14 +2885,18 @@ ssize_t lesp_recv(int sockfd, FAR uint8_t *buf, size_t len, int flags)
 
           sock->sem = &sem;
 
-          while (ret >= 0 && sock->inndx == sock->outndx)
+          while (ret >= 0 && sock->inndx == sock->outndx &&
+                 (sock->flags & FLAGS_SOCK_USED) != 0)
             {
-              pthread_mutex_unlock(&g_lesp_state.worker.mutex);
+              pthread_mutex_unlock(&sock->mutex);
               ret = sem_timedwait(&sem, &ts);
-              pthread_mutex_lock(&g_lesp_state.worker.mutex);
+              pthread_mutex_lock(&sock->mutex);
             }
 
-          sock->sem = NULL;
+          if (sock->sem == &sem)
+            {
+              sock->sem = NULL;
+            }
         }
     }
 
@@ -2597,27 +2905,43 @@ ssize_t lesp_recv(int sockfd, FAR uint8_t *buf, size_t len, int flags)
       ret = 0;
       while (ret < len && sock->outndx != sock->inndx)
         {
-          /* Remove one byte from the circular buffer */
+          /* Copy up to the head or the end of the circular buffer */
 
           int ndx = sock->outndx;
-          *buf++  = sock->rxbuf[ndx];
+          int n;
+
+          if (sock->inndx > ndx)
+            {
+              n = sock->inndx - ndx;
+            }
+          else
+            {
+              n = SOCKET_FIFO_SIZE - ndx;
+            }
+
+          if (n > len - ret)
+            {
+              n = len - ret;
+            }
+
+          memcpy(buf, &sock->rxbuf[ndx], n);
+          buf += n;
+          ret += n;
 
           /* Increment the circular buffer 'outndx' */
 
-          if (++ndx >= SOCKET_FIFO_SIZE)
+          ndx += n;
+          if (ndx >= SOCKET_FIFO_SIZE)
             {
               ndx -= SOCKET_FIFO_SIZE;
             }
 
           sock->outndx = ndx;
-
-          /* Increment the count of bytes returned */
-
-          ret++;
         }
     }
 
-  pthread_mutex_unlock(&g_lesp_state.worker.mutex);
+  pthread_mutex_unlock(&sock->mutex);
+  sem_destroy(&sem);
 
   if (ret < 0)
     {
@@ -2672,9 +2996,11 @@ int lesp_setsockopt(int sockfd, int level, int option,
           case SO_RCVTIMEO:
               if (value_len == sizeof(struct timeval))
                 {
+                  pthread_mutex_lock(&sock->mutex);
                   sock->rcv_timeo.tv_sec = ((struct timeval *)(value))->tv_sec;
                   sock->rcv_timeo.tv_nsec = ((struct timeval *)(value))->tv_usec;
                   sock->rcv_timeo.tv_nsec *= 1000; /* tv_usec to tv_nsec */
+                  pthread_mutex_unlock(&sock->mutex);
                 }
               else
                 {
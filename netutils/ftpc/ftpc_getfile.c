@@ -70,100 +70,6 @@
  * Private Functions
  ****************************************************************************/
 
-/****************************************************************************
- * Name: ftpc_recvinit
- *
- * Description:
- *   Initialize to receive a file
- *
- ****************************************************************************/
-
-static int ftpc_recvinit(struct ftpc_session_s *session, FAR const char *path,
-                         uint8_t xfrmode, off_t offset)
-{
-  int ret;
-
-  /* Reset transfer related variables */
-
-  ftpc_xfrreset(session);
-
-  ret = ftpc_xfrinit(session);
-  if (ret != OK)
-    {
-      return ERROR;
-    }
-
-  /* Configure the transfer:  Initial file offset and tranfer mode */
-
-  session->offset = 0;
-  ftpc_xfrmode(session, xfrmode);
-
-  /* Handle the resume offset (caller is responsible for fseeking in the
-   * file)
-   */
-
-  if (offset > 0)
-    {
-      /* Send the REST command.  This command sets the offset where the
-       * transfer should start.  This must come after PORT or PASV commands.
-       */
-
-      ret = ftpc_cmd(session, "REST %ld", offset);
-      if (ret < 0)
-        {
-          nwarn("WARNING: REST command failed: %d\n", errno);
-          return ERROR;
-        }
-
-      session->size = offset;
-    }
-
-  /* Send the RETR (Retrieve a remote file) command.  Normally the server
-   * responds with a mark using code 150:
-   *
-   * - "150 File status okay; about to open data connection"
-   *
-   * It then stops accepting new connections, attempts to send the contents
-   * of the file over the data connection, and closes the data connection.
-   * Finally it either accepts the RETR request with:
-   *
-   * - "226 Closing data connection" if the entire file was successfully
-   *    written to the server's TCP buffers
-   *
-   * Or rejects the RETR request with:
-   *
-   * - "425 Can't open data connection" if no TCP connection was established
-   * - "426 Connection closed; transfer aborted" if the TCP connection was
-   *    established but then broken by the client or by network failure
-   * - "451 Requested action aborted: local error in processing" or
-   *   "551 Requested action aborted: page type unknown" if the server had
-   *   trouble reading the file from disk.
-   */
-
-  ret = ftpc_cmd(session, "RETR %s", path);
-  if (ret < 0)
-    {
-      nwarn("WARNING: RETR command failed: %d\n", errno);
-      return ERROR;
-    }
-
-  /* In active mode, we need to accept a connection on the data socket
-   * (in passive mode, we have already connected the data channel to
-   * the FTP server).
-   */
-
-  if (!FTPC_IS_PASSIVE(session))
-    {
-      ret = ftpc_sockaccept(&session->dacceptor, &session->data);
-      if (ret != OK)
-        {
-          nerr("ERROR: Data connection not accepted\n");
-        }
-    }
-
-  return ret;
-}
-
 /****************************************************************************
  * Name: ftpc_recvbinary
  *
@@ -369,6 +275,100 @@ errout:
   return ERROR;
 }
 
+/****************************************************************************
+ * Name: ftpc_recvinit
+ *
+ * Description:
+ *   Initialize to receive a file
+ *
+ ****************************************************************************/
+
+int ftpc_recvinit(struct ftpc_session_s *session, FAR const char *path,
+                  uint8_t xfrmode, off_t offset)
+{
+  int ret;
+
+  /* Reset transfer related variables */
+
+  ftpc_xfrreset(session);
+
+  ret = ftpc_xfrinit(session);
+  if (ret != OK)
+    {
+      return ERROR;
+    }
+
+  /* Configure the transfer:  Initial file offset and tranfer mode */
+
+  session->offset = 0;
+  ftpc_xfrmode(session, xfrmode);
+
+  /* Handle the resume offset (caller is responsible for fseeking in the
+   * file)
+   */
+
+  if (offset > 0)
+    {
+      /* Send the REST command.  This command sets the offset where the
+       * transfer should start.  This must come after PORT or PASV commands.
+       */
+
+      ret = ftpc_cmd(session, "REST %ld", offset);
+      if (ret < 0)
+        {
+          nwarn("WARNING: REST command failed: %d\n", errno);
+          return ERROR;
+        }
+
+      session->size = offset;
+    }
+
+  /* Send the RETR (Retrieve a remote file) command.  Normally the server
+   * responds with a mark using code 150:
+   *
+   * - "150 File status okay; about to open data connection"
+   *
+   * It then stops accepting new connections, attempts to send the contents
+   * of the file over the data connection, and closes the data connection.
+   * Finally it either accepts the RETR request with:
+   *
+   * - "226 Closing data connection" if the entire file was successfully
+   *    written to the server's TCP buffers
+   *
+   * Or rejects the RETR request with:
+   *
+   * - "425 Can't open data connection" if no TCP connection was established
+   * - "426 Connection closed; transfer aborted" if the TCP connection was
+   *    established but then broken by the client or by network failure
+   * - "451 Requested action aborted: local error in processing" or
+   *   "551 Requested action aborted: page type unknown" if the server had
+   *   trouble reading the file from disk.
+   */
+
+  ret = ftpc_cmd(session, "RETR %s", path);
+  if (ret < 0)
+    {
+      nwarn("WARNING: RETR command failed: %d\n", errno);
+      return ERROR;
+    }
+
+  /* In active mode, we need to accept a connection on the data socket
+   * (in passive mode, we have already connected the data channel to
+   * the FTP server).
+   */
+
+  if (!FTPC_IS_PASSIVE(session))
+    {
+      ret = ftpc_sockaccept(&session->dacceptor, &session->data);
+      if (ret != OK)
+        {
+          nerr("ERROR: Data connection not accepted\n");
+        }
+    }
+
+  return ret;
+}
+
 /****************************************************************************
  * Name: ftpc_recvtext
  *
@@ -0,0 +1,445 @@
+/****************************************************************************
+ * apps/netutils/ftpc/ftpc_getsegments.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include "ftpc_config.h"
+
+#include <sys/stat.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <debug.h>
+#include <errno.h>
+
+#include "netutils/ftpc.h"
+
+#include "ftpc_internal.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_FTPC_MAXSEGMENTS
+#  define CONFIG_FTPC_MAXSEGMENTS 4
+#endif
+
+#ifndef CONFIG_FTPC_SEGMENT_STACKSIZE
+#  define CONFIG_FTPC_SEGMENT_STACKSIZE 2048
+#endif
+
+/* Segments smaller than this are not worth a connection of their own */
+
+#define FTPC_SEGMENT_MINSIZE (4 * CONFIG_FTP_BUFSIZE)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes one range of the remote file and the data
+ * connection that retrieves it.
+ */
+
+struct ftpc_segment_s
+{
+  FAR struct ftpc_session_s *master; /* Session that logged in first */
+  FAR const char *rpath;             /* Absolute remote path */
+  FAR const char *lpath;             /* Absolute local path */
+  off_t          start;              /* File offset of the segment */
+  off_t          len;                /* Segment length (-1: to end of file) */
+  off_t          done;               /* Bytes written to the local file */
+  pthread_t      threadid;           /* Helper thread receiving the segment */
+  bool           started;            /* True: The helper thread was started */
+  int            result;             /* OK or ERROR */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: ftpc_segrecv
+ *
+ * Description:
+ *   Retrieve one segment on the given session and write it to the local
+ *   file at its offset.
+ *
+ ****************************************************************************/
+
+static int ftpc_segrecv(FAR struct ftpc_session_s *session,
+                        FAR struct ftpc_segment_s *seg)
+{
+  size_t wantsize;
+  ssize_t nread;
+  ssize_t nwritten;
+  int ret;
+  int fd;
+
+  /* Each segment has its own descriptor so that its file position is not
+   * disturbed by the other segments.
+   */
+
+  fd = open(seg->lpath, O_WRONLY);
+  if (fd < 0)
+    {
+      nerr("ERROR: open failed: %d\n", errno);
+      return ERROR;
+    }
+
+  if (lseek(fd, seg->start, SEEK_SET) < 0)
+    {
+      nerr("ERROR: lseek failed: %d\n", errno);
+      close(fd);
+      return ERROR;
+    }
+
+  /* Send REST and RETR and open the data connection */
+
+  ret = ftpc_recvinit(session, seg->rpath, FTPC_XFRMODE_BINARY, seg->start);
+  if (ret != OK)
+    {
+      nerr("ERROR: ftpc_recvinit failed\n");
+      ftpc_sockclose(&session->data);
+      close(fd);
+      return ERROR;
+    }
+
+  /* Receive until the end of the segment */
+
+  while (seg->len < 0 || seg->done < seg->len)
+    {
+      wantsize = CONFIG_FTP_BUFSIZE;
+      if (seg->len >= 0 && seg->len - seg->done < (off_t)wantsize)
+        {
+          wantsize = (size_t)(seg->len - seg->done);
+        }
+
+      nread = fread(session->buffer, sizeof(char), wantsize,
+                    session->data.instream);
+      if (nread <= 0)
+        {
+          if (ferror(session->data.instream))
+            {
+              ret = ERROR;
+            }
+
+          break;
+        }
+
+      nwritten = write(fd, session->buffer, nread);
+      if (nwritten != nread)
+        {
+          nerr("ERROR: write failed: %d\n", errno);
+          ret = ERROR;
+          break;
+        }
+
+      seg->done += nwritten;
+    }
+
+  close(fd);
+
+  /* Closing the data connection before the end of the file makes the server
+   * abort the RETR.  Only a segment that ran to the end of the file leaves
+   * the session with a normal "226" reply to collect.
+   */
+
+  ftpc_sockclose(&session->data);
+
+  if (seg->len >= 0)
+    {
+      return (ret == OK && seg->done == seg->len) ? OK : ERROR;
+    }
+
+  if (ret == OK)
+    {
+      fptc_getreply(session);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: ftpc_segworker
+ *
+ * Description:
+ *   Open a session of its own, log in with the credentials of the master
+ *   session and retrieve one segment.
+ *
+ ****************************************************************************/
+
+static FAR void *ftpc_segworker(FAR void *arg)
+{
+  FAR struct ftpc_segment_s *seg = (FAR struct ftpc_segment_s *)arg;
+  FAR struct ftpc_session_s *session;
+  struct ftpc_login_s login;
+
+  seg->result = ERROR;
+
+  session = (FAR struct ftpc_session_s *)ftpc_connect(&seg->master->server);
+  if (!session)
+    {
+      nerr("ERROR: ftpc_connect failed: %d\n", errno);
+      return NULL;
+    }
+
+  login.uname = seg->master->uname;
+  login.pwd   = seg->master->pwd;
+  login.rdir  = NULL;
+  login.pasv  = FTPC_IS_PASSIVE(seg->master);
+
+  if (ftpc_login((SESSION)session, &login) == OK)
+    {
+      seg->result = ftpc_segrecv(session, seg);
+    }
+
+  ftpc_disconnect((SESSION)session);
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: ftpc_segstart
+ *
+ * Description:
+ *   Start the helper thread that retrieves one segment.
+ *
+ ****************************************************************************/
+
+static int ftpc_segstart(FAR struct ftpc_segment_s *seg)
+{
+  pthread_attr_t attr;
+  int ret;
+
+  ret = pthread_attr_init(&attr);
+  if (ret != 0)
+    {
+      return ERROR;
+    }
+
+  (void)pthread_attr_setstacksize(&attr, CONFIG_FTPC_SEGMENT_STACKSIZE);
+
+  ret = pthread_create(&seg->threadid, &attr, ftpc_segworker, seg);
+  pthread_attr_destroy(&attr);
+  if (ret != 0)
+    {
+      nerr("ERROR: pthread_create failed: %d\n", ret);
+      return ERROR;
+    }
+
+  seg->started = true;
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: ftpc_getsegments
+ *
+ * Description:
+ *   Get a file from the remote host in binary mode over nsegments data
+ *   connections.  The remaining part of the file is split into ranges;
+ *   each range is retrieved with REST and RETR on a session of its own and
+ *   written into the local file at its offset.  The last range is
+ *   retrieved on the caller's session.
+ *
+ *   If the transfer fails, the local file is truncated to the part that
+ *   was received without gaps, so that a later call with
+ *   FTPC_GET_RESUME restarts from the existing local size.
+ *
+ ****************************************************************************/
+
+int ftpc_getsegments(SESSION handle, FAR const char *rname,
+                     FAR const char *lname, uint8_t how,
+                     unsigned int nsegments)
+{
+  FAR struct ftpc_session_s *session = (FAR struct ftpc_session_s *)handle;
+  FAR struct ftpc_segment_s *segs;
+  FAR struct ftpc_segment_s *seg;
+  struct stat statbuf;
+  FAR char *absrpath;
+  FAR char *abslpath;
+  off_t rsize;
+  off_t offset;
+  off_t seglen;
+  off_t end;
+  unsigned int i;
+  int ret = ERROR;
+  int fd;
+
+  DEBUGASSERT(rname);
+
+  if (!lname)
+    {
+      lname = rname;
+    }
+
+  /* The helper sessions start in the home directory, so they need the
+   * absolute remote path.
+   */
+
+  absrpath = ftpc_absrpath(session, rname);
+  abslpath = ftpc_abslpath(session, lname);
+  if (!absrpath || !abslpath)
+    {
+      goto errout_with_paths;
+    }
+
+  /* Where does the transfer start? */
+
+  offset = 0;
+  if (how == FTPC_GET_RESUME && stat(abslpath, &statbuf) == 0)
+    {
+      offset = statbuf.st_size;
+    }
+
+  /* The size of the remote file is needed to split it into ranges */
+
+  rsize = ftpc_filesize(handle, absrpath);
+
+  if (nsegments > CONFIG_FTPC_MAXSEGMENTS)
+    {
+      nsegments = CONFIG_FTPC_MAXSEGMENTS;
+    }
+
+  if (rsize > offset && (rsize - offset) / FTPC_SEGMENT_MINSIZE < nsegments)
+    {
+      nsegments = (unsigned int)((rsize - offset) / FTPC_SEGMENT_MINSIZE);
+    }
+
+  if (rsize >= 0 && offset >= rsize)
+    {
+      /* Nothing is left to retrieve */
+
+      ret = OK;
+      goto errout_with_paths;
+    }
+
+  if (rsize < 0 || nsegments < 2)
+    {
+      /* No SIZE or too little data: use a single sequential transfer */
+
+      ret = ftpc_getfile(handle, rname, lname, how, FTPC_XFRMODE_BINARY);
+      goto errout_with_paths;
+    }
+
+  segs = (FAR struct ftpc_segment_s *)
+    zalloc(nsegments * sizeof(struct ftpc_segment_s));
+  if (!segs)
+    {
+      set_errno(ENOMEM);
+      goto errout_with_paths;
+    }
+
+  /* Create the local file, keeping the data already received when
+   * resuming.
+   */
+
+  fd = open(abslpath, O_WRONLY | O_CREAT | (offset > 0 ? 0 : O_TRUNC), 0666);
+  if (fd < 0)
+    {
+      nerr("ERROR: open failed: %d\n", errno);
+      goto errout_with_segs;
+    }
+
+  /* Start the helper sessions, one for each range but the last */
+
+  seglen = (rsize - offset) / nsegments;
+  for (i = 0; i < nsegments; i++)
+    {
+      seg         = &segs[i];
+      seg->master = session;
+      seg->rpath  = absrpath;
+      seg->lpath  = abslpath;
+      seg->start  = offset + i * seglen;
+      seg->len    = (i < nsegments - 1) ? seglen : -1;
+      seg->result = ERROR;
+
+      if (i < nsegments - 1)
+        {
+          (void)ftpc_segstart(seg);
+        }
+    }
+
+  /* The last range runs to the end of the file on the caller's session */
+
+  seg         = &segs[nsegments - 1];
+  seg->result = ftpc_segrecv(session, seg);
+
+  for (i = 0; i < nsegments - 1; i++)
+    {
+      if (segs[i].started)
+        {
+          (void)pthread_join(segs[i].threadid, NULL);
+        }
+    }
+
+  /* Find the end of the data received without gaps */
+
+  ret = OK;
+  end = offset;
+  for (i = 0; i < nsegments; i++)
+    {
+      end = segs[i].start + segs[i].done;
+      if (segs[i].result != OK)
+        {
+          ret = ERROR;
+          break;
+        }
+    }
+
+  /* If a range failed, drop anything received beyond the gap so that the
+   * local size tells where to resume.
+   */
+
+  if (ret != OK)
+    {
+      nwarn("WARNING: Transfer incomplete, keeping %ld bytes\n", (long)end);
+      (void)ftruncate(fd, end);
+    }
+
+  close(fd);
+
+errout_with_segs:
+  free(segs);
+errout_with_paths:
+  free(absrpath);
+  free(abslpath);
+  return ret;
+}
@@ -270,6 +270,9 @@ EXTERN void ftpc_timeout(int argc, uint32_t arg1, ...);
 /* Transfer helpers */
 
 EXTERN int ftpc_xfrinit(FAR struct ftpc_session_s *session);
+EXTERN int ftpc_recvinit(FAR struct ftpc_session_s *session,
+                         FAR const char *path, uint8_t xfrmode,
+                         off_t offset);
 EXTERN int ftpc_recvtext(FAR struct ftpc_session_s *session,
                          FAR FILE *rinstream, FAR FILE *loutstream);
 EXTERN int ftpc_waitdata(FAR struct ftpc_session_s *session,
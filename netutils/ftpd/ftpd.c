@@ -62,6 +62,10 @@
 
 #include <arpa/inet.h>
 
+#ifdef CONFIG_FTPD_SENDFILE
+#  include <sys/sendfile.h>
+#endif
+
 #include "netutils/ftpd.h"
 
 #include "ftpd.h"
@@ -72,6 +76,10 @@
 
 #define __NUTTX__ 1 /* Flags some unusual NuttX dependencies */
 
+/* The largest transfer requested from one sendfile() call */
+
+#define FTPD_SENDFILE_CHUNK (32 * 1024)
+
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
@@ -134,6 +142,9 @@ static int  ftpd_getpath(FAR struct ftpd_session_s *session,
 static int  ftpd_changedir(FAR struct ftpd_session_s *session,
               FAR const char *rempath);
 static off_t ftpd_offsatoi(FAR const char *filename, off_t offset);
+#ifdef CONFIG_FTPD_SENDFILE
+static int ftpd_sendfile(FAR struct ftpd_session_s *session, off_t pos);
+#endif
 static int ftpd_stream(FAR struct ftpd_session_s *session, int cmdtype);
 static uint8_t ftpd_listoption(FAR char **param);
 static int  ftpd_listbuffer(FAR struct ftpd_session_s *session,
@@ -185,10 +196,15 @@ static int ftpd_command(FAR struct ftpd_session_s *session);
 /* Worker thread */
 
 static int  ftpd_startworker(pthread_startroutine_t handler, FAR void *arg,
-              size_t stacksize);
-static void ftpd_freesession(FAR struct ftpd_session_s *session);
+              size_t stacksize, FAR pthread_t *threadid);
+static void ftpd_initsession(FAR struct ftpd_session_s *session,
+              FAR struct ftpd_server_s *server);
+static void ftpd_resetsession(FAR struct ftpd_session_s *session);
 static void ftpd_workersetup(FAR struct ftpd_session_s *session);
+static void ftpd_serve(FAR struct ftpd_session_s *session);
 static FAR void *ftpd_worker(FAR void *arg);
+static int  ftpd_startworkers(FAR struct ftpd_server_s *server);
+static void ftpd_stopworkers(FAR struct ftpd_server_s *server);
 
 /****************************************************************************
  * Private Data
@@ -1130,6 +1146,10 @@ static FAR struct ftpd_server_s *ftpd_openserver(int port, sa_family_t family)
     server->head = NULL;
     server->tail = NULL;
 
+  /* The idle count is raised as each worker of the pool is started */
+
+  (void)sem_init(&server->idle, 0, 0);
+
   /* Create the server listen socket */
 
 #ifdef CONFIG_NET_IPv6
@@ -1716,6 +1736,43 @@ static off_t ftpd_offsatoi(FAR const char *filename, off_t offset)
   return ret;
 }
 
+/****************************************************************************
+ * Name: ftpd_sendfile
+ ****************************************************************************/
+
+#ifdef CONFIG_FTPD_SENDFILE
+static int ftpd_sendfile(FAR struct ftpd_session_s *session, off_t pos)
+{
+  ssize_t nsent;
+  int errval;
+
+  for (;;)
+    {
+      /* sendfile() advances pos past the bytes sent and returns zero at the
+       * end of the file.
+       */
+
+      nsent = sendfile(session->data.sd, session->fd, &pos,
+                       FTPD_SENDFILE_CHUNK);
+      if (nsent < 0)
+        {
+          errval = errno;
+          nerr("ERROR: sendfile failed: %d\n", errval);
+          (void)ftpd_response(session->cmd.sd, session->txtimeout,
+                              g_respfmt1, 550, ' ', "Data send error !");
+          return -errval;
+        }
+
+      if (nsent == 0)
+        {
+          (void)ftpd_response(session->cmd.sd, session->txtimeout,
+                              g_respfmt1, 226, ' ', "Transfer complete");
+          return OK;
+        }
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: ftpd_stream
  ****************************************************************************/
@@ -1730,6 +1787,7 @@ static int ftpd_stream(FAR struct ftpd_session_s *session, int cmdtype)
   size_t buflen;
   size_t wantsize;
   ssize_t rdbytes;
+  ssize_t nread;
   ssize_t wrbytes;
   off_t pos = 0;
   int errval = 0;
@@ -1865,6 +1923,16 @@ static int ftpd_stream(FAR struct ftpd_session_s *session, int cmdtype)
 
         pos += (off_t)seekoffs;
     }
+  else if (cmdtype == 2)
+    {
+      /* Appending: the data will be written at the end of the file */
+
+      pos = lseek(session->fd, 0, SEEK_END);
+      if (pos < 0)
+        {
+          pos = 0;
+        }
+    }
 
   /* Send success message */
 
@@ -1876,6 +1944,18 @@ static int ftpd_stream(FAR struct ftpd_session_s *session, int cmdtype)
       goto errout_with_session;
     }
 
+#ifdef CONFIG_FTPD_SENDFILE
+  /* A binary RETR needs no translation, so send the file without copying
+   * it through the data buffer.
+   */
+
+  if (cmdtype == 0 && session->type != FTPD_SESSIONTYPE_A)
+    {
+      ret = ftpd_sendfile(session, pos);
+      goto errout_with_session;
+    }
+#endif
+
   for (;;)
     {
       /* Read from the source (file or TCP connection) */
@@ -1889,6 +1969,16 @@ static int ftpd_stream(FAR struct ftpd_session_s *session, int cmdtype)
         {
           buffer   = session->data.buffer;
           wantsize = session->data.buflen;
+
+          /* Keep the writes to the file on buffer-sized boundaries: the
+           * first block after a restart or an append is shortened to
+           * reach the next boundary.
+           */
+
+          if (cmdtype != 0)
+            {
+              wantsize -= (size_t)(pos % (off_t)session->data.buflen);
+            }
         }
 
       if (cmdtype == 0)
@@ -1904,15 +1994,28 @@ static int ftpd_stream(FAR struct ftpd_session_s *session, int cmdtype)
       else
         {
           /* Read from the TCP connection, ftpd_recve returns the negated error
-           * condition.
+           * condition.  In binary mode, keep reading until the buffer is
+           * full so that the file is written in whole blocks instead of in
+           * whatever sizes the segments arrived.
            */
 
-          rdbytes = ftpd_recv(session->data.sd, session->data.buffer,
-                              wantsize, session->rxtimeout);
-          if (rdbytes < 0)
+          rdbytes = 0;
+          do
             {
-              errval = -rdbytes;
+              nread = ftpd_recv(session->data.sd,
+                                &session->data.buffer[rdbytes],
+                                wantsize - rdbytes, session->rxtimeout);
+              if (nread < 0)
+                {
+                  errval  = -nread;
+                  rdbytes = nread;
+                  break;
+                }
+
+              rdbytes += nread;
             }
+          while (nread > 0 && session->type != FTPD_SESSIONTYPE_A &&
+                 (size_t)rdbytes < wantsize);
         }
 
       /* A negative vaule of rdbytes indicates a read error.  errval has the
@@ -3908,9 +4011,8 @@ static int ftpd_command(FAR struct ftpd_session_s *session)
  ****************************************************************************/
 
 static int ftpd_startworker(pthread_startroutine_t handler, FAR void *arg,
-                            size_t stacksize)
+                            size_t stacksize, FAR pthread_t *threadid)
 {
-  pthread_t threadid;
   pthread_attr_t attr;
   int ret;
 
@@ -3934,19 +4036,10 @@ static int ftpd_startworker(pthread_startroutine_t handler, FAR void *arg,
 
   /* And create the thread */
 
-  ret = pthread_create(&threadid, &attr, handler, arg);
+  ret = pthread_create(threadid, &attr, handler, arg);
   if (ret != 0)
     {
       nerr("ERROR: pthread_create() failed: %d\n", ret);
-      goto errout_with_attr;
-    }
-
-  /* Put the thread in the detached stated */
-
-  ret = pthread_detach(threadid);
-  if (ret != 0)
-    {
-      nerr("ERROR: pthread_detach() failed: %d\n", ret);
     }
 
 errout_with_attr:
@@ -3956,56 +4049,87 @@ errout:
 }
 
 /****************************************************************************
- * Name: ftpd_freesession
+ * Name: ftpd_initsession
  ****************************************************************************/
 
-static void ftpd_freesession(FAR struct ftpd_session_s *session)
+static void ftpd_initsession(FAR struct ftpd_session_s *session,
+                             FAR struct ftpd_server_s *server)
+{
+  /* The command and data buffers belong to the worker and are kept */
+
+  session->server       = server;
+  session->head         = server->head;
+  session->curr         = NULL;
+  session->flags        = 0;
+  session->txtimeout    = -1;
+  session->rxtimeout    = -1;
+  session->cmd.sd       = (int)(-1);
+  session->cmd.addrlen  = (socklen_t)sizeof(session->cmd.addr);
+  session->cmd.buflen   = (size_t)CONFIG_FTPD_CMDBUFFERSIZE;
+  session->command      = NULL;
+  session->param        = NULL;
+  session->data.sd      = -1;
+  session->data.addrlen = sizeof(session->data.addr);
+  session->data.buflen  = CONFIG_FTPD_DATABUFFERSIZE;
+  session->restartpos   = 0;
+  session->fd           = -1;
+  session->user         = NULL;
+  session->type         = FTPD_SESSIONTYPE_NONE;
+  session->home         = NULL;
+  session->work         = NULL;
+  session->renamefrom   = NULL;
+}
+
+/****************************************************************************
+ * Name: ftpd_resetsession
+ *
+ * Description:
+ *   Release everything acquired while serving a session so that the
+ *   worker can serve the next one.  The buffers are not freed.
+ *
+ ****************************************************************************/
+
+static void ftpd_resetsession(FAR struct ftpd_session_s *session)
 {
   /* Free resources */
 
   if (session->renamefrom)
     {
       free(session->renamefrom);
+      session->renamefrom = NULL;
     }
 
   if (session->work)
     {
       free(session->work);
+      session->work = NULL;
     }
 
   if (session->home)
     {
       free(session->home);
+      session->home = NULL;
     }
 
   if (session->user)
     {
       free(session->user);
+      session->user = NULL;
     }
 
   if (session->fd >= 0)
     {
       close(session->fd);
-    }
-
-  if (session->data.buffer)
-    {
-      free(session->data.buffer);
+      session->fd = -1;
     }
 
   (void)ftpd_dataclose(session);
 
-  if (session->cmd.buffer)
-    {
-      free(session->cmd.buffer);
-    }
-
   if (session->cmd.sd >= 0)
     {
       close(session->cmd.sd);
+      session->cmd.sd = -1;
     }
-
-  free(session);
 }
 
 /****************************************************************************
@@ -4040,19 +4164,17 @@ static void ftpd_workersetup(FAR struct ftpd_session_s *session)
 }
 
 /****************************************************************************
- * Name: ftpd_worker
+ * Name: ftpd_serve
  ****************************************************************************/
 
-static FAR void *ftpd_worker(FAR void *arg)
+static void ftpd_serve(FAR struct ftpd_session_s *session)
 {
-  FAR struct ftpd_session_s *session = (FAR struct ftpd_session_s *)arg;
   ssize_t recvbytes;
   size_t offset;
   uint8_t ch;
   int ret;
 
-  ninfo("Worker started\n");
-  DEBUGASSERT(session);
+  ninfo("Session started\n");
 
   /* Configure the session sockets */
 
@@ -4065,8 +4187,7 @@ static FAR void *ftpd_worker(FAR void *arg)
   if (ret < 0)
     {
       nerr("ERROR: ftpd_response() failed: %d\n", ret);
-      ftpd_freesession(session);
-      return NULL;
+      return;
     }
 
   /* Then loop processing FTP commands */
@@ -4159,11 +4280,149 @@ static FAR void *ftpd_worker(FAR void *arg)
           break;
         }
     }
+}
+
+/****************************************************************************
+ * Name: ftpd_worker
+ ****************************************************************************/
+
+static FAR void *ftpd_worker(FAR void *arg)
+{
+  FAR struct ftpd_worker_s *worker = (FAR struct ftpd_worker_s *)arg;
+  FAR struct ftpd_server_s *server;
+
+  DEBUGASSERT(worker);
+  server = worker->server;
+  ninfo("Worker started\n");
+
+  for (;;)
+    {
+      /* Wait for ftpd_session() to hand over a connection */
+
+      while (sem_wait(&worker->sem) < 0)
+        {
+          DEBUGASSERT(errno == EINTR);
+        }
+
+      if (server->stop)
+        {
+          break;
+        }
+
+      ftpd_serve(&worker->session);
+      ftpd_resetsession(&worker->session);
+
+      /* Return this worker to the pool */
+
+      worker->busy = false;
+      sem_post(&server->idle);
+    }
 
-  ftpd_freesession(session);
   return NULL;
 }
 
+/****************************************************************************
+ * Name: ftpd_startworkers
+ *
+ * Description:
+ *   Allocate the buffers of every session and start the pool of worker
+ *   threads.  Nothing more is allocated per connection, so the memory used
+ *   by the server is bounded by CONFIG_FTPD_MAXSESSIONS.
+ *
+ ****************************************************************************/
+
+static int ftpd_startworkers(FAR struct ftpd_server_s *server)
+{
+  FAR struct ftpd_worker_s *worker;
+  FAR struct ftpd_session_s *session;
+  int ret;
+  int i;
+
+  for (i = 0; i < CONFIG_FTPD_MAXSESSIONS; i++)
+    {
+      worker  = &server->workers[i];
+      session = &worker->session;
+
+      worker->server = server;
+      worker->busy   = false;
+      (void)sem_init(&worker->sem, 0, 0);
+
+      /* Allocate a command buffer */
+
+      session->cmd.buffer = (FAR char *)malloc(CONFIG_FTPD_CMDBUFFERSIZE);
+      if (!session->cmd.buffer)
+        {
+          nerr("ERROR: Failed to allocate command buffer\n");
+          ret = -ENOMEM;
+          goto errout_with_worker;
+        }
+
+      /* Allocate a data buffer */
+
+      session->data.buffer = (FAR char *)malloc(CONFIG_FTPD_DATABUFFERSIZE);
+      if (!session->data.buffer)
+        {
+          nerr("ERROR: Failed to allocate data buffer\n");
+          ret = -ENOMEM;
+          goto errout_with_worker;
+        }
+
+      /* And create the worker thread that will serve the session */
+
+      ret = ftpd_startworker(ftpd_worker, (FAR void *)worker,
+                             CONFIG_FTPD_WORKERSTACKSIZE, &worker->threadid);
+      if (ret < 0)
+        {
+          nerr("ERROR: ftpd_startworker() failed: %d\n", ret);
+          goto errout_with_worker;
+        }
+
+      server->nworkers++;
+      sem_post(&server->idle);
+    }
+
+  return OK;
+
+errout_with_worker:
+  free(session->cmd.buffer);
+  free(session->data.buffer);
+  session->cmd.buffer  = NULL;
+  session->data.buffer = NULL;
+  sem_destroy(&worker->sem);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: ftpd_stopworkers
+ *
+ * Description:
+ *   Stop the pool of worker threads and free their buffers.  A worker that
+ *   is serving a session exits when that session ends.
+ *
+ ****************************************************************************/
+
+static void ftpd_stopworkers(FAR struct ftpd_server_s *server)
+{
+  FAR struct ftpd_worker_s *worker;
+  int i;
+
+  server->stop = true;
+
+  for (i = 0; i < server->nworkers; i++)
+    {
+      worker = &server->workers[i];
+
+      sem_post(&worker->sem);
+      (void)pthread_join(worker->threadid, NULL);
+
+      sem_destroy(&worker->sem);
+      free(worker->session.cmd.buffer);
+      free(worker->session.data.buffer);
+    }
+
+  server->nworkers = 0;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -4194,6 +4453,14 @@ FTPD_SESSION ftpd_open(sa_family_t family)
       server = ftpd_openserver(2211, family);
     }
 
+  /* Start the pool of workers that will serve the sessions */
+
+  if (server && ftpd_startworkers(server) < 0)
+    {
+      ftpd_close((FTPD_SESSION)server);
+      server = NULL;
+    }
+
   return (FTPD_SESSION)server;
 }
 
@@ -4274,8 +4541,9 @@ errout:
  * Description:
  *   Execute the FTPD server.  This thread does not return until either (1)
  *   the timeout expires with no connection, (2) some other error occurs, or
- *   (2) a connection was accepted and an FTP worker thread was started to
- *   service the session.
+ *   (2) a connection was accepted and handed to an idle FTP worker thread
+ *   to service the session.  If every worker is busy, the client receives
+ *   a "421" reply, the connection is closed and -EBUSY is returned.
  *
  * Input Parameters:
  *   handle - A handle previously returned by ftpd_open
@@ -4283,7 +4551,7 @@ errout:
  *     time elapses with no connected, the -ETIMEDOUT error will be returned.
  *
  * Returned Value:
- *   Zero is returned if the FTP worker was started.  On failure, a negated
+ *   Zero is returned if the session was handed to an FTP worker.  On failure, a negated
  *   errno value is returned to indicate why the servier terminated.
  *   -ETIMEDOUT indicates that the user-provided timeout elapsed with no
  *   connection.
@@ -4293,112 +4561,78 @@ errout:
 int ftpd_session(FTPD_SESSION handle, int timeout)
 {
   FAR struct ftpd_server_s  *server;
+  FAR struct ftpd_worker_s  *worker;
   FAR struct ftpd_session_s *session;
-  int ret;
+  union ftpd_sockaddr_u      addr;
+  socklen_t                  addrlen;
+  int sd;
+  int i;
 
   DEBUGASSERT(handle);
 
   server = (FAR struct ftpd_server_s *)handle;
 
-  /* Allocate a session */
+  /* Accept a connection */
 
-  session = (FAR struct ftpd_session_s *)zalloc(sizeof(struct ftpd_session_s));
-  if (!session)
+  addrlen = (socklen_t)sizeof(addr);
+  sd = ftpd_accept(server->sd, (FAR void *)&addr, &addrlen, timeout);
+  if (sd < 0)
     {
-      nerr("ERROR: Failed to allocate session\n");
-      ret = -ENOMEM;
-      goto errout;
-    }
-
-  /* Initialize the session */
-
-  session->server       = server;
-  session->head         = server->head;
-  session->curr         = NULL;
-  session->flags        = 0;
-  session->txtimeout    = -1;
-  session->rxtimeout    = -1;
-  session->cmd.sd       = (int)(-1);
-  session->cmd.addrlen  = (socklen_t)sizeof(session->cmd.addr);
-  session->cmd.buflen   = (size_t)CONFIG_FTPD_CMDBUFFERSIZE;
-  session->cmd.buffer   = NULL;
-  session->command      = NULL;
-  session->param        = NULL;
-  session->data.sd      = -1;
-  session->data.addrlen = sizeof(session->data.addr);
-  session->data.buflen  = CONFIG_FTPD_DATABUFFERSIZE;
-  session->data.buffer  = NULL;
-  session->restartpos   = 0;
-  session->fd           = -1;
-  session->user         = NULL;
-  session->type         = FTPD_SESSIONTYPE_NONE;
-  session->home         = NULL;
-  session->work         = NULL;
-  session->renamefrom   = NULL;
-
-  /* Allocate a command buffer */
+      /* Only report interesting, infrequent errors (not the common timeout) */
 
-  session->cmd.buffer = (FAR char *)malloc(session->cmd.buflen);
-  if (!session->cmd.buffer)
-    {
-      nerr("ERROR: Failed to allocate command buffer\n");
-      ret = -ENOMEM;
-      goto errout_with_session;
+#ifdef CONFIG_DEBUG_NET
+      if (sd != -ETIMEDOUT)
+        {
+          nerr("ERROR: ftpd_accept() failed: %d\n", sd);
+        }
+#endif
+      return sd;
     }
 
-  /* Allocate a data buffer */
+  /* Claim an idle worker.  If all of them are busy, turn the client away
+   * rather than allocating anything more for it.
+   */
 
-  session->data.buffer = (FAR char *)malloc(session->data.buflen);
-  if (!session->data.buffer)
+  if (sem_trywait(&server->idle) < 0)
     {
-      nerr("ERROR: Failed to allocate data buffer\n");
-      ret = -ENOMEM;
-      goto errout_with_session;
+      nwarn("WARNING: All %d sessions are busy\n", server->nworkers);
+      (void)ftpd_response(sd, timeout, g_respfmt1, 421, ' ',
+                          "Too many users, try again later");
+      close(sd);
+      return -EBUSY;
     }
 
-  /* Accept a connection */
-
-  session->cmd.sd = ftpd_accept(server->sd, (FAR void *)&session->cmd.addr,
-                                &session->cmd.addrlen, timeout);
-  if (session->cmd.sd < 0)
+  for (i = 0; i < server->nworkers; i++)
     {
-      /* Only report interesting, infrequent errors (not the common timeout) */
-
-#ifdef CONFIG_DEBUG_NET
-      if (session->cmd.sd != -ETIMEDOUT)
+      if (!server->workers[i].busy)
         {
-          nerr("ERROR: ftpd_accept() failed: %d\n", session->cmd.sd);
+          break;
         }
-#endif
-      ret = session->cmd.sd;
-      goto errout_with_session;
     }
 
-  /* And create a worker thread to service the session */
+  DEBUGASSERT(i < server->nworkers);
 
-  ret = ftpd_startworker(ftpd_worker, (FAR void *)session,
-                         CONFIG_FTPD_WORKERSTACKSIZE);
-  if (ret < 0)
-    {
-      nerr("ERROR: ftpd_startworker() failed: %d\n", ret);
-      goto errout_with_session;
-    }
+  /* Initialize the session and hand it to the worker */
 
-  /* Successfully connected an launched the worker thread */
+  worker  = &server->workers[i];
+  session = &worker->session;
 
-  return 0;
+  ftpd_initsession(session, server);
+  memcpy(&session->cmd.addr, &addr, addrlen);
+  session->cmd.addrlen = addrlen;
+  session->cmd.sd      = sd;
 
-errout_with_session:
-  ftpd_freesession(session);
-errout:
-  return ret;
+  worker->busy = true;
+  sem_post(&worker->sem);
+  return 0;
 }
 
 /****************************************************************************
  * Name: ftpd_close
  *
  * Description:
- *   Close and destroy the handle created by ftpd_open.
+ *   Close and destroy the handle created by ftpd_open.  The worker threads
+ *   are stopped; this waits for any session in progress to end.
  *
  * Input Parameters:
  *   handle - A handle previously returned by ftpd_open
@@ -4414,7 +4648,6 @@ void ftpd_close(FTPD_SESSION handle)
   DEBUGASSERT(handle);
 
   server = (struct ftpd_server_s *)handle;
-  ftpd_account_free(server->head);
 
   if (server->sd >= 0)
     {
@@ -4422,6 +4655,14 @@ void ftpd_close(FTPD_SESSION handle)
       server->sd = -1;
     }
 
+  /* Wait for the workers to exit before freeing the accounts that their
+   * sessions reference.
+   */
+
+  ftpd_stopworkers(server);
+  sem_destroy(&server->idle);
+
+  ftpd_account_free(server->head);
   free(server);
 }
 
@@ -44,6 +44,8 @@
 
 #include <sys/types.h>
 #include <stdbool.h>
+#include <pthread.h>
+#include <semaphore.h>
 
 #include <netinet/in.h>
 
@@ -109,16 +111,6 @@ struct ftpd_account_s
   FAR char                  *home;     /* Home directory path */
 };
 
-/* This structures describes an FTP session a list of associated accounts */
-
-struct ftpd_server_s
-{
-  int                        sd;     /* Listen socket descriptor */
-  union ftpd_sockaddr_u      addr;   /* Listen address */
-  struct ftpd_account_s     *head;   /* Head of a list of accounts */
-  struct ftpd_account_s     *tail;   /* Tail of a list of accounts */
-};
-
 struct ftpd_stream_s
 {
   int                        sd;      /* Socket descriptor */
@@ -161,6 +153,31 @@ struct ftpd_session_s
   FAR char                  *renamefrom;
 };
 
+/* This structure describes one worker of the preallocated session pool */
+
+struct ftpd_worker_s
+{
+  FAR struct ftpd_server_s  *server;
+  pthread_t                  threadid; /* Worker thread */
+  sem_t                      sem;      /* Posted when a session is assigned */
+  volatile bool              busy;     /* The worker is serving a session */
+  struct ftpd_session_s      session;  /* The session served by the worker */
+};
+
+/* This structures describes an FTP session a list of associated accounts */
+
+struct ftpd_server_s
+{
+  int                        sd;     /* Listen socket descriptor */
+  union ftpd_sockaddr_u      addr;   /* Listen address */
+  struct ftpd_account_s     *head;   /* Head of a list of accounts */
+  struct ftpd_account_s     *tail;   /* Tail of a list of accounts */
+  sem_t                      idle;   /* Counts the idle workers */
+  volatile bool              stop;   /* The server is being closed */
+  uint8_t                    nworkers; /* Number of workers started */
+  struct ftpd_worker_s       workers[CONFIG_FTPD_MAXSESSIONS];
+};
+
 typedef int (*ftpd_cmdhandler_t)(struct ftpd_session_s *);
 
 struct ftpd_cmd_s
@@ -35,6 +35,7 @@
  ****************************************************************************/
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdio.h>
 #include <math.h>
@@ -45,11 +46,63 @@
 #include <unistd.h>
 
 #include "netutils/cJSON.h"
+#include "cJSON_internal.h"
 
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* Nodes taken from an arena by cJSON_ParseInSitu() are aligned to this */
+
+#define CJSON_ARENA_ALIGN  sizeof(double)
+#define CJSON_ARENA_MASK   (CJSON_ARENA_ALIGN - 1)
+
+/* Objects with at least this many members get a hash index of their
+ * members on the first lookup.
+ */
+
+#ifndef CONFIG_NETUTILS_JSON_INDEX_MIN
+#  define CONFIG_NETUTILS_JSON_INDEX_MIN 16
+#endif
+
+/* This value of the 'index' field marks items that are never indexed:
+ * references, whose members belong to another item, and the items of
+ * cJSON_ParseInSitu(), which are never deleted.
+ */
+
+#define CJSON_NOINDEX      ((struct cJSON_Index *)1)
+
+/* Number rendering:  The largest number of decimal places rendered without
+ * floating point formatting, and the magnitude below which all integers are
+ * exact in a double (2^53).
+ */
+
+#define CJSON_MAXDECIMALS  9
+#define CJSON_MAXEXACT     9007199254740992.0
+
+/* True if the character must be escaped in a JSON string */
+
+#define CJSON_NEEDESCAPE(c) \
+  ((unsigned char)(c) < 32 || (c) == '\"' || (c) == '\\')
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+#ifdef CONFIG_NETUTILS_JSON_INDEX
+/* The hash index of the members of an object.  Members are hashed without
+ * regard to case so that the same index serves both the case-sensitive
+ * and the case-insensitive look-up.  Members are entered in list order, so
+ * the first of several members with the same name is found first.
+ */
+
+struct cJSON_Index
+{
+  unsigned int mask;        /* Number of slots - 1 (a power of two - 1) */
+  cJSON *slot[1];           /* Open addressing hash table of members */
+};
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -62,6 +115,14 @@ static const unsigned char firstByteMark[7] =
 static void *(*cJSON_malloc)(size_t sz) = malloc;
 static void (*cJSON_free)(void *ptr)    = free;
 
+/* While cJSON_ParseInSitu() runs, nodes are taken from this arena and
+ * strings are decoded in place in the input buffer.
+ */
+
+static char *g_arena;
+static size_t g_arenasize;
+static size_t g_arenaused;
+
 /****************************************************************************
  * Private Prototypes
  ****************************************************************************/
@@ -96,10 +157,34 @@ static char *cJSON_strdup(const char *str)
 
 static cJSON *cJSON_New_Item(void)
 {
-  cJSON *node = (cJSON *) cJSON_malloc(sizeof(cJSON));
+  cJSON *node;
+
+  if (g_arena)
+    {
+      /* Take the node from the arena of cJSON_ParseInSitu() */
+
+      if (g_arenasize - g_arenaused < sizeof(cJSON))
+        {
+          return 0;
+        }
+
+      node = (cJSON *)&g_arena[g_arenaused];
+      g_arenaused += (sizeof(cJSON) + CJSON_ARENA_MASK) & ~CJSON_ARENA_MASK;
+    }
+  else
+    {
+      node = (cJSON *) cJSON_malloc(sizeof(cJSON));
+    }
+
   if (node)
     {
       memset(node, 0, sizeof(cJSON));
+#ifdef CONFIG_NETUTILS_JSON_INDEX
+      if (g_arena)
+        {
+          node->index = CJSON_NOINDEX;
+        }
+#endif
     }
 
   return node;
@@ -208,45 +293,139 @@ static const char *parse_number(cJSON *item, const char *num)
   return num;
 }
 
-/* Render the number nicely from the given item into a string. */
+/* Render the decimal digits of 'value' into 'str', with a decimal point
+ * before the final 'ndecimals' digits.  Returns the end of the string.
+ */
 
-static char *print_number(cJSON *item)
+static char *print_digits(char *str, uint64_t value, int ndecimals)
 {
-  char *str;
-  double d = item->valuedouble;
+  char tmp[24];
+  int n = 0;
 
-  if (fabs(((double)item->valueint) - d) <= DBL_EPSILON) /* && d<=INT_MAX && d>=INT_MIN) */
+  do
     {
-       /* 2^64+1 can be represented in 21 chars. */
+      tmp[n++] = '0' + (int)(value % 10);
+      value   /= 10;
+    }
+  while (value > 0 || n <= ndecimals);
 
-      str = (char *)cJSON_malloc(21);
-      if (str)
+  while (n > 0)
+    {
+      if (n == ndecimals)
         {
-          sprintf(str, "%d", item->valueint);
+          *str++ = '.';
         }
+
+      *str++ = tmp[--n];
     }
-  else
+
+  *str = '\0';
+  return str;
+}
+
+/* Render a double with the fewest digits that convert back to the same
+ * value.  Values that are an integer count of up to CJSON_MAXDECIMALS
+ * decimal places are rendered from that integer without any floating
+ * point formatting.
+ */
+
+static void print_double(char *str, double d)
+{
+  static const double p10[CJSON_MAXDECIMALS + 1] =
+    {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9
+    };
+
+  double mag = fabs(d);
+  double m;
+  int prec;
+  int k;
+
+  if (isnan(d) || isinf(d))
+    {
+      /* There is no JSON representation */
+
+      strcpy(str, "null");
+      return;
+    }
+
+  if (mag >= 1.0e-6 && mag < CJSON_MAXEXACT)
     {
-      /* This is a nice tradeoff. */
+      /* If d * 10^k is an integer m and m / 10^k gives back d exactly,
+       * then the digits of m with a decimal point k places from the right
+       * convert back to d:  Both are the correctly rounded value of the
+       * same decimal number.  The smallest such k gives the shortest text.
+       */
 
-      str = (char *)cJSON_malloc(64);
-      if (str)
+      for (k = 0; k <= CJSON_MAXDECIMALS; k++)
         {
-          if (fabs(floor(d) - d) <= DBL_EPSILON)
+          m = mag * p10[k];
+          if (m >= CJSON_MAXEXACT)
             {
-              sprintf(str, "%d", item->valueint);
-            }
-          else if (fabs(d) < 1.0e-6 || fabs(d) > 1.0e9)
-            {
-              sprintf(str, "%e", d);
+              break;
             }
-          else
+
+          if (m == floor(m) && m / p10[k] == mag)
             {
-              sprintf(str, " %f", d);
+              if (d < 0)
+                {
+                  *str++ = '-';
+                }
+
+              print_digits(str, (uint64_t)m, k);
+              return;
             }
         }
     }
 
+  /* Otherwise, use the smallest precision that converts back to d */
+
+  for (prec = 15; prec < 17; prec++)
+    {
+      snprintf(str, CJSON_NUMBUFSIZE, "%.*g", prec, d);
+      if (strtod(str, NULL) == d)
+        {
+          return;
+        }
+    }
+
+  snprintf(str, CJSON_NUMBUFSIZE, "%.17g", d);
+}
+
+/* Render the number nicely from the given item into a string. */
+
+static char *print_number(cJSON *item)
+{
+  char *str;
+  double d = item->valuedouble;
+
+  /* A double needs at most 24 characters with 17 significant digits */
+
+  str = (char *)cJSON_malloc(CJSON_NUMBUFSIZE);
+  if (!str)
+    {
+      return 0;
+    }
+
+  if (d >= INT_MIN && d <= INT_MAX && d == (double)item->valueint)
+    {
+      /* Integer fast path */
+
+      if (item->valueint < 0)
+        {
+          *str = '-';
+          print_digits(str + 1, -(uint64_t)item->valueint, 0);
+        }
+      else
+        {
+          print_digits(str, item->valueint, 0);
+        }
+    }
+  else
+    {
+      print_double(str, d);
+    }
+
   return str;
 }
 
@@ -260,6 +439,7 @@ static const char *parse_string(cJSON *item, const char *str)
   int len = 0;
   unsigned uc;
   unsigned uc2;
+  bool quote;
 
   if (*str != '\"')
     {
@@ -269,22 +449,34 @@ static const char *parse_string(cJSON *item, const char *str)
       return 0;
     }
 
-  while (*ptr != '\"' && *ptr && ++len)
+  if (g_arena)
     {
-      /* Skip escaped quotes. */
+      /* cJSON_ParseInSitu():  The input buffer is writable.  The decoded
+       * string is never longer than the escaped one, so it is decoded in
+       * place, starting where the opening quote was.
+       */
 
-      if (*ptr++ == '\\')
+      out = (char *)str;
+    }
+  else
+    {
+      while (*ptr != '\"' && *ptr && ++len)
         {
-          ptr++;
+          /* Skip escaped quotes. */
+
+          if (*ptr++ == '\\')
+            {
+              ptr++;
+            }
         }
-    }
 
-  /* This is how long we need for the string, roughly. */
+      /* This is how long we need for the string, roughly. */
 
-  out = (char *)cJSON_malloc(len + 1);
-  if (!out)
-    {
-      return 0;
+      out = (char *)cJSON_malloc(len + 1);
+      if (!out)
+        {
+          return 0;
+        }
     }
 
   ptr = str + 1;
@@ -398,8 +590,13 @@ static const char *parse_string(cJSON *item, const char *str)
         }
     }
 
+  /* Check for the closing quote before the terminator is written:  When
+   * decoding in place, they may be at the same position.
+   */
+
+  quote = (*ptr == '\"');
   *ptr2 = 0;
-  if (*ptr == '\"')
+  if (quote)
     {
       ptr++;
     }
@@ -414,8 +611,10 @@ static const char *parse_string(cJSON *item, const char *str)
 static char *print_string_ptr(const char *str)
 {
   const char *ptr;
+  const char *run;
   char *ptr2, *out;
-  int len = 0;
+  size_t len = 0;
+  size_t extra = 0;
   unsigned char token;
 
   if (!str)
@@ -423,39 +622,50 @@ static char *print_string_ptr(const char *str)
       return cJSON_strdup("");
     }
 
-  ptr = str;
-  while ((token = *ptr) && ++len)
+  /* Measure the string and the space needed for the escapes */
+
+  for (ptr = str; (token = *ptr); ptr++)
     {
-      if (strchr("\"\\\b\f\n\r\t", token))
+      if (CJSON_NEEDESCAPE(token))
         {
-          len++;
+          extra += strchr("\"\\\b\f\n\r\t", token) ? 1 : 5;
         }
-      else if (token < 32)
-        {
-          len += 5;
-        }
-
-      ptr++;
     }
 
-  out = (char *)cJSON_malloc(len + 3);
+  len = ptr - str;
+  out = (char *)cJSON_malloc(len + extra + 3);
   if (!out)
     {
       return 0;
     }
 
   ptr2 = out;
-  ptr = str;
   *ptr2++ = '\"';
 
-  while (*ptr)
+  if (extra == 0)
     {
-      if ((unsigned char)*ptr > 31 && *ptr != '\"' && *ptr != '\\')
-        {
-          *ptr2++ = *ptr++;
-        }
-      else
+      /* Nothing to escape:  Copy the whole string at once */
+
+      memcpy(ptr2, str, len);
+      ptr2 += len;
+    }
+  else
+    {
+      ptr = str;
+      while (*ptr)
         {
+          /* Copy the run of characters up to the next escape at once */
+
+          for (run = ptr; *ptr && !CJSON_NEEDESCAPE(*ptr); ptr++);
+
+          memcpy(ptr2, run, ptr - run);
+          ptr2 += ptr - run;
+
+          if (!*ptr)
+            {
+              break;
+            }
+
           *ptr2++ = '\\';
           switch (token = *ptr++)
             {
@@ -1085,6 +1295,141 @@ static void suffix_object(cJSON *prev, cJSON *item)
   item->prev = prev;
 }
 
+#ifdef CONFIG_NETUTILS_JSON_INDEX
+/* Hash a member name without regard to case (FNV-1a). */
+
+static unsigned int index_hash(const char *str)
+{
+  unsigned int hash = 2166136261u;
+
+  for (; *str; str++)
+    {
+      hash = (hash ^ (unsigned char)tolower((unsigned char)*str)) *
+             16777619u;
+    }
+
+  return hash;
+}
+
+/* Discard the index of an object after its members have changed.  It will
+ * be rebuilt by the next look-up.
+ */
+
+static void index_invalidate(cJSON *object)
+{
+  if (object->index && object->index != CJSON_NOINDEX)
+    {
+      cJSON_free(object->index);
+      object->index = 0;
+    }
+}
+
+/* Build the index of an object if it is large enough to need one. */
+
+static struct cJSON_Index *index_build(cJSON *object)
+{
+  struct cJSON_Index *index;
+  unsigned int nslots;
+  unsigned int count;
+  unsigned int i;
+  cJSON *c;
+
+  /* Count the members */
+
+  for (count = 0, c = object->child; c; c = c->next)
+    {
+      if (!c->string)
+        {
+          /* Only named members can be indexed */
+
+          return 0;
+        }
+
+      count++;
+    }
+
+  if (count < CONFIG_NETUTILS_JSON_INDEX_MIN)
+    {
+      return 0;
+    }
+
+  /* Keep the table at most half full */
+
+  for (nslots = 4; nslots < 2 * count; nslots <<= 1);
+
+  index = (struct cJSON_Index *)
+    cJSON_malloc(sizeof(struct cJSON_Index) + (nslots - 1) * sizeof(cJSON *));
+  if (!index)
+    {
+      /* Just use the linear search */
+
+      return 0;
+    }
+
+  memset(index->slot, 0, nslots * sizeof(cJSON *));
+  index->mask = nslots - 1;
+
+  for (c = object->child; c; c = c->next)
+    {
+      for (i = index_hash(c->string) & index->mask;
+           index->slot[i];
+           i = (i + 1) & index->mask);
+
+      index->slot[i] = c;
+    }
+
+  object->index = index;
+  return index;
+}
+
+/* Look up a member using the index (or the member list if the object is
+ * not indexed).
+ */
+
+static cJSON *index_lookup(cJSON *object, const char *string,
+                           bool casesensitive)
+{
+  struct cJSON_Index *index = object->index;
+  unsigned int i;
+  cJSON *c;
+
+  if (!index && string && !(object->type & cJSON_IsReference))
+    {
+      index = index_build(object);
+    }
+
+  if (!index || index == CJSON_NOINDEX || !string)
+    {
+      for (c = object->child; c; c = c->next)
+        {
+          if (casesensitive ?
+              (c->string && string && strcmp(c->string, string) == 0) :
+              cJSON_strcasecmp(c->string, string) == 0)
+            {
+              break;
+            }
+        }
+
+      return c;
+    }
+
+  for (i = index_hash(string) & index->mask;
+       (c = index->slot[i]) != 0;
+       i = (i + 1) & index->mask)
+    {
+      if (casesensitive ? strcmp(c->string, string) == 0 :
+          cJSON_strcasecmp(c->string, string) == 0)
+        {
+          break;
+        }
+    }
+
+  return c;
+}
+#else
+#  define index_invalidate(o)
+#endif
+
 /* Utility for handling references. */
 
 static cJSON *create_reference(cJSON *item)
@@ -1099,6 +1444,9 @@ static cJSON *create_reference(cJSON *item)
   ref->string = 0;
   ref->type |= cJSON_IsReference;
   ref->next = ref->prev = 0;
+#ifdef CONFIG_NETUTILS_JSON_INDEX
+  ref->index = CJSON_NOINDEX;
+#endif
   return ref;
 }
 
@@ -1149,6 +1497,7 @@ void cJSON_Delete(cJSON *c)
           cJSON_free(c->string);
         }
 
+      index_invalidate(c);
       cJSON_free(c);
       c = next;
     }
@@ -1176,6 +1525,46 @@ cJSON *cJSON_Parse(const char *value)
   return c;
 }
 
+/* Parse a mutable block of JSON without using the heap.  The nodes are
+ * taken from the caller's arena and the strings are decoded in place in the
+ * input.
+ */
+
+cJSON *cJSON_ParseInSitu(char *value, void *arena, size_t size,
+                         size_t *used)
+{
+  cJSON *c;
+  size_t offset;
+
+  /* Align the start of the arena for the cJSON nodes */
+
+  offset = (CJSON_ARENA_ALIGN - ((uintptr_t)arena & CJSON_ARENA_MASK)) &
+           CJSON_ARENA_MASK;
+  if (!arena || size < offset)
+    {
+      return 0;
+    }
+
+  g_arena     = (char *)arena + offset;
+  g_arenasize = size - offset;
+  g_arenaused = 0;
+  ep = 0;
+
+  c = cJSON_New_Item();
+  if (c && !parse_value(c, skip(value)))
+    {
+      c = 0;
+    }
+
+  if (used)
+    {
+      *used = offset + g_arenaused;
+    }
+
+  g_arena = 0;
+  return c;
+}
+
 /* Render a cJSON item/entity/structure to text. */
 
 char *cJSON_Print(cJSON *item)
@@ -1188,6 +1577,13 @@ char *cJSON_PrintUnformatted(cJSON *item)
   return print_value(item, 0, 0);
 }
 
+/* Render a number as cJSON_Print() does, for the streaming writer. */
+
+void cJSON_PrintDouble(char *str, double d)
+{
+  print_double(str, d);
+}
+
 /* Get Array size/item / object item. */
 
 int cJSON_GetArraySize(cJSON *array)
@@ -1219,6 +1615,9 @@ cJSON *cJSON_GetArrayItem(cJSON *array, int item)
 
 cJSON *cJSON_GetObjectItem(cJSON *object, const char *string)
 {
+#ifdef CONFIG_NETUTILS_JSON_INDEX
+  return index_lookup(object, string, false);
+#else
   cJSON *c = object->child;
 
   while (c && cJSON_strcasecmp(c->string, string))
@@ -1227,6 +1626,23 @@ cJSON *cJSON_GetObjectItem(cJSON *object, const char *string)
     }
 
   return c;
+#endif
+}
+
+cJSON *cJSON_GetObjectItemCaseSensitive(cJSON *object, const char *string)
+{
+#ifdef CONFIG_NETUTILS_JSON_INDEX
+  return index_lookup(object, string, true);
+#else
+  cJSON *c = object->child;
+
+  while (c && (!c->string || !string || strcmp(c->string, string)))
+    {
+      c = c->next;
+    }
+
+  return c;
+#endif
 }
 
 /* Add item to array/object. */
@@ -1239,6 +1655,7 @@ void cJSON_AddItemToArray(cJSON *array, cJSON *item)
       return;
     }
 
+  index_invalidate(array);
   if (!c)
     {
       array->child = item;
@@ -1294,6 +1711,7 @@ cJSON *cJSON_DetachItemFromArray(cJSON *array, int which)
       return 0;
     }
 
+  index_invalidate(array);
   if (c->prev)
     {
       c->prev->next = c->next;
@@ -1358,6 +1776,7 @@ void cJSON_ReplaceItemInArray(cJSON *array, int which, cJSON *newitem)
       return;
     }
 
+  index_invalidate(array);
   newitem->next = c->next;
   newitem->prev = c->prev;
   if (newitem->next)
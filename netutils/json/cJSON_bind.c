@@ -0,0 +1,372 @@
+/****************************************************************************
+ * apps/netutils/json/cJSON_bind.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <limits.h>
+
+#include "netutils/cJSON.h"
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Find the descriptor of a member. */
+
+static const cJSON_Field *bind_find(const cJSON_Field *fields,
+                                    const char *name)
+{
+  if (name != NULL)
+    {
+      for (; fields->key != NULL; fields++)
+        {
+          if (strcmp(fields->key, name) == 0)
+            {
+              return fields;
+            }
+        }
+    }
+
+  return NULL;
+}
+
+/* Start a nested object or array. */
+
+static int bind_push(cJSON_Bind *bind, const cJSON_Field *fields,
+                     const cJSON_Field *array, char *base)
+{
+  if (bind->depth >= cJSON_BIND_MAXDEPTH)
+    {
+      return -1;
+    }
+
+  bind->stack[bind->depth].fields = fields;
+  bind->stack[bind->depth].array  = array;
+  bind->stack[bind->depth].base   = base;
+  bind->depth++;
+  return 0;
+}
+
+/* Is the value a number that an int holds exactly? */
+
+static int bind_isint(int type, double valuedouble)
+{
+  return type == cJSON_Number && valuedouble >= INT_MIN &&
+         valuedouble <= INT_MAX && valuedouble == (double)(int)valuedouble;
+}
+
+/* Add an element to the int array being filled. */
+
+static int bind_element(const cJSON_Field *field, char *base, int type,
+                        double valuedouble)
+{
+  int *count = (int *)(base + field->count);
+
+  if (!bind_isint(type, valuedouble) ||
+      (size_t)*count >= field->size / sizeof(int))
+    {
+      return -1;
+    }
+
+  ((int *)(base + field->offset))[(*count)++] = (int)valuedouble;
+  return 0;
+}
+
+/* Store a member value. */
+
+static int bind_member(cJSON_Bind *bind, const cJSON_Field *field,
+                       char *base, int type, const char *valuestring,
+                       double valuedouble)
+{
+  char *member = base + field->offset;
+
+  if (type == cJSON_NULL)
+    {
+      /* null leaves the member unchanged */
+
+      return 0;
+    }
+
+  switch (field->type)
+    {
+      case cJSON_FieldInt:
+        if (!bind_isint(type, valuedouble))
+          {
+            return -1;
+          }
+
+        *(int *)member = (int)valuedouble;
+        return 0;
+
+      case cJSON_FieldDouble:
+        if (type != cJSON_Number)
+          {
+            return -1;
+          }
+
+        *(double *)member = valuedouble;
+        return 0;
+
+      case cJSON_FieldBool:
+        if (type != cJSON_True && type != cJSON_False)
+          {
+            return -1;
+          }
+
+        *(bool *)member = (type == cJSON_True);
+        return 0;
+
+      case cJSON_FieldString:
+        if (type != cJSON_String || strlen(valuestring) >= field->size)
+          {
+            return -1;
+          }
+
+        strcpy(member, valuestring);
+        return 0;
+
+      case cJSON_FieldObject:
+        if (type != cJSON_Object)
+          {
+            return -1;
+          }
+
+        return bind_push(bind, field->fields, NULL, member);
+
+      case cJSON_FieldIntArray:
+        if (type != cJSON_Array)
+          {
+            return -1;
+          }
+
+        *(int *)(base + field->count) = 0;
+        return bind_push(bind, NULL, field, base);
+
+      default:
+        return -1;
+    }
+}
+
+/* The streaming reader callback:  Route each event to the struct member it
+ * belongs to.
+ */
+
+static int bind_callback(void *arg, int type, const char *name,
+                         const char *valuestring, double valuedouble)
+{
+  cJSON_Bind *bind = (cJSON_Bind *)arg;
+  const cJSON_Field *field;
+  int top;
+
+  if (bind->skip > 0)
+    {
+      /* Inside a member without a descriptor */
+
+      if (type == cJSON_Object || type == cJSON_Array)
+        {
+          bind->skip++;
+        }
+      else if (type == cJSON_ObjectEnd || type == cJSON_ArrayEnd)
+        {
+          bind->skip--;
+        }
+
+      return 0;
+    }
+
+  if (type == cJSON_ObjectEnd || type == cJSON_ArrayEnd)
+    {
+      bind->depth--;
+      return 0;
+    }
+
+  top = bind->depth - 1;
+  if (top < 0)
+    {
+      /* The top-level value must be the object itself */
+
+      if (type != cJSON_Object)
+        {
+          return -1;
+        }
+
+      return bind_push(bind, bind->stack[0].fields, NULL,
+                       bind->stack[0].base);
+    }
+
+  if (bind->stack[top].array != NULL)
+    {
+      return bind_element(bind->stack[top].array, bind->stack[top].base,
+                          type, valuedouble);
+    }
+
+  field = bind_find(bind->stack[top].fields, name);
+  if (field == NULL)
+    {
+      if (type == cJSON_Object || type == cJSON_Array)
+        {
+          bind->skip = 1;
+        }
+
+      return 0;
+    }
+
+  return bind_member(bind, field, bind->stack[top].base, type, valuestring,
+                     valuedouble);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/* Prepare a streaming reader to parse into a struct. */
+
+void cJSON_BindReaderInit(cJSON_Reader *reader, cJSON_Bind *bind,
+                          const cJSON_Field *fields, void *st,
+                          char *token, size_t tokensize)
+{
+  memset(bind, 0, sizeof(cJSON_Bind));
+  bind->stack[0].fields = fields;
+  bind->stack[0].base   = (char *)st;
+
+  cJSON_ReaderInit(reader, token, tokensize, bind_callback, bind);
+}
+
+/* Parse a complete JSON object into a struct. */
+
+int cJSON_BindParse(const cJSON_Field *fields, void *st, const char *text,
+                    size_t len, char *token, size_t tokensize)
+{
+  cJSON_Reader reader;
+  cJSON_Bind bind;
+
+  cJSON_BindReaderInit(&reader, &bind, fields, st, token, tokensize);
+  if (cJSON_ReaderFeed(&reader, text, len) < 0)
+    {
+      return -1;
+    }
+
+  return cJSON_ReaderFinish(&reader);
+}
+
+/* Write a struct as a JSON object, as a member 'name' of the enclosing
+ * object (or NULL).
+ */
+
+int cJSON_BindWrite(cJSON_Writer *writer, const char *name,
+                    const cJSON_Field *fields, const void *st)
+{
+  const char *base = (const char *)st;
+  const char *member;
+  int count;
+  int ret;
+  int i;
+
+  ret = cJSON_WriteObjectStart(writer, name);
+  for (; fields->key != NULL && ret == 0; fields++)
+    {
+      member = base + fields->offset;
+
+      switch (fields->type)
+        {
+          case cJSON_FieldInt:
+            ret = cJSON_WriteNumber(writer, fields->key,
+                                    *(const int *)member);
+            break;
+
+          case cJSON_FieldDouble:
+            ret = cJSON_WriteNumber(writer, fields->key,
+                                    *(const double *)member);
+            break;
+
+          case cJSON_FieldBool:
+            ret = cJSON_WriteBool(writer, fields->key,
+                                  *(const bool *)member);
+            break;
+
+          case cJSON_FieldString:
+            ret = cJSON_WriteString(writer, fields->key, member);
+            break;
+
+          case cJSON_FieldObject:
+            ret = cJSON_BindWrite(writer, fields->key, fields->fields,
+                                  member);
+            break;
+
+          case cJSON_FieldIntArray:
+            count = *(const int *)(base + fields->count);
+            if (count < 0 || (size_t)count > fields->size / sizeof(int))
+              {
+                return -1;
+              }
+
+            ret = cJSON_WriteArrayStart(writer, fields->key);
+            for (i = 0; i < count && ret == 0; i++)
+              {
+                ret = cJSON_WriteNumber(writer, NULL,
+                                        ((const int *)member)[i]);
+              }
+
+            ret |= cJSON_WriteArrayEnd(writer);
+            break;
+
+          default:
+            return -1;
+        }
+    }
+
+  return ret | cJSON_WriteObjectEnd(writer);
+}
+
+/* Print a struct as JSON into a fixed buffer. */
+
+int cJSON_BindPrint(const cJSON_Field *fields, const void *st,
+                    char *buffer, size_t size)
+{
+  cJSON_Writer writer;
+
+  cJSON_WriterInit(&writer, buffer, size, -1);
+  if (cJSON_BindWrite(&writer, NULL, fields, st) < 0)
+    {
+      return -1;
+    }
+
+  return cJSON_WriterFlush(&writer);
+}
@@ -0,0 +1,847 @@
+/****************************************************************************
+ * apps/netutils/json/cJSON_stream.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <float.h>
+#include <limits.h>
+#include <ctype.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "netutils/cJSON.h"
+#include "cJSON_internal.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The maximum nesting depth:  One bit of 'nest' per level */
+
+#define CJSON_MAXDEPTH  ((int)(8 * sizeof(unsigned long)))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Reader states */
+
+enum reader_state_e
+{
+  READER_VALUE = 0,     /* Expecting a value */
+  READER_FIRSTVALUE,    /* Expecting a value or ']' after '[' */
+  READER_FIRSTNAME,     /* Expecting a name or '}' after '{' */
+  READER_NAME,          /* Expecting a name after ',' in an object */
+  READER_COLON,         /* Expecting ':' after a name */
+  READER_AFTER,         /* Expecting ',' or the end of the container */
+  READER_STRING,        /* Inside a string */
+  READER_ESCAPE,        /* After '\' inside a string */
+  READER_UNICODE,       /* Collecting the hex digits of a \u escape */
+  READER_NUMBER,        /* Inside a number */
+  READER_LITERAL,       /* Inside true, false or null */
+  READER_DONE,          /* After the top-level value */
+  READER_ERROR          /* Malformed input or stopped by the callback */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Add one character to the token being collected. */
+
+static int reader_addch(cJSON_Reader *reader, char ch)
+{
+  if (reader->len + 1 >= reader->size)
+    {
+      /* No room for the character and the NUL terminator */
+
+      return -1;
+    }
+
+  reader->buffer[reader->len++] = ch;
+  return 0;
+}
+
+/* Add a unicode character to the string being collected as UTF-8. */
+
+static int reader_addutf8(cJSON_Reader *reader, unsigned uc)
+{
+  int ret;
+
+  if (uc < 0x80)
+    {
+      return reader_addch(reader, uc);
+    }
+  else if (uc < 0x800)
+    {
+      ret = reader_addch(reader, 0xc0 | (uc >> 6));
+    }
+  else if (uc < 0x10000)
+    {
+      ret  = reader_addch(reader, 0xe0 | (uc >> 12));
+      ret |= reader_addch(reader, 0x80 | ((uc >> 6) & 0x3f));
+    }
+  else
+    {
+      ret  = reader_addch(reader, 0xf0 | (uc >> 18));
+      ret |= reader_addch(reader, 0x80 | ((uc >> 12) & 0x3f));
+      ret |= reader_addch(reader, 0x80 | ((uc >> 6) & 0x3f));
+    }
+
+  return ret | reader_addch(reader, 0x80 | (uc & 0x3f));
+}
+
+/* Report one event.  The name of the value, if any, is at the beginning of
+ * the token buffer and is consumed by the event.
+ */
+
+static int reader_event(cJSON_Reader *reader, int type,
+                        const char *valuestring, double valuedouble)
+{
+  const char *name = reader->namelen ? reader->buffer : NULL;
+  int ret;
+
+  ret = reader->callback(reader->arg, type, name, valuestring, valuedouble);
+
+  reader->namelen = 0;
+  reader->len     = 0;
+  return ret != 0 ? -1 : 0;
+}
+
+/* Report a completed scalar value and move to the next state. */
+
+static int reader_value(cJSON_Reader *reader, int type)
+{
+  char *value = &reader->buffer[reader->namelen];
+  double number = 0;
+  char *end;
+
+  if (reader->len >= reader->size)
+    {
+      return -1;
+    }
+
+  reader->buffer[reader->len] = '\0';
+
+  if (type == cJSON_Number)
+    {
+      number = strtod(value, &end);
+      if (end == value || *end != '\0')
+        {
+          return -1;
+        }
+    }
+  else if (type != cJSON_String)
+    {
+      /* A literal */
+
+      if (strcmp(value, "true") == 0)
+        {
+          type = cJSON_True;
+        }
+      else if (strcmp(value, "false") == 0)
+        {
+          type = cJSON_False;
+        }
+      else if (strcmp(value, "null") == 0)
+        {
+          type = cJSON_NULL;
+        }
+      else
+        {
+          return -1;
+        }
+
+      value = NULL;
+    }
+
+  reader->state = reader->depth > 0 ? READER_AFTER : READER_DONE;
+  return reader_event(reader, type, value, number);
+}
+
+/* Start an object or array. */
+
+static int reader_push(cJSON_Reader *reader, int type)
+{
+  if (reader->depth >= CJSON_MAXDEPTH)
+    {
+      return -1;
+    }
+
+  if (type == cJSON_Object)
+    {
+      reader->nest |= (1ul << reader->depth);
+      reader->state = READER_FIRSTNAME;
+    }
+  else
+    {
+      reader->nest &= ~(1ul << reader->depth);
+      reader->state = READER_FIRSTVALUE;
+    }
+
+  reader->depth++;
+  return reader_event(reader, type, NULL, 0);
+}
+
+/* End the current object or array. */
+
+static int reader_pop(cJSON_Reader *reader, int type)
+{
+  bool isobject;
+
+  isobject = (reader->nest & (1ul << (reader->depth - 1))) != 0;
+  if (isobject != (type == cJSON_ObjectEnd))
+    {
+      /* Mismatched closing bracket */
+
+      return -1;
+    }
+
+  reader->depth--;
+  reader->state = reader->depth > 0 ? READER_AFTER : READER_DONE;
+  return reader_event(reader, type, NULL, 0);
+}
+
+/* Handle the completion of a \u escape sequence. */
+
+static int reader_unicode(cJSON_Reader *reader)
+{
+  unsigned uc = reader->uc;
+
+  if (reader->surrogate)
+    {
+      /* Combine the pending first half of a UTF16 surrogate pair with the
+       * second half.  A missing or invalid second half drops the pair.
+       */
+
+      unsigned hi = reader->surrogate;
+
+      reader->surrogate = 0;
+      if (uc >= 0xdc00 && uc <= 0xdfff)
+        {
+          return reader_addutf8(reader,
+                                0x10000 | ((hi & 0x3ff) << 10) |
+                                (uc & 0x3ff));
+        }
+    }
+
+  if (uc >= 0xd800 && uc <= 0xdbff)
+    {
+      /* First half of a surrogate pair.  Wait for the second half. */
+
+      reader->surrogate = uc;
+      return 0;
+    }
+
+  if ((uc >= 0xdc00 && uc <= 0xdfff) || uc == 0)
+    {
+      /* Invalid.  Ignore it. */
+
+      return 0;
+    }
+
+  return reader_addutf8(reader, uc);
+}
+
+/* Process one character of input. */
+
+static int reader_char(cJSON_Reader *reader, char ch)
+{
+  for (;;)
+    {
+      switch (reader->state)
+        {
+        case READER_FIRSTVALUE:
+          if (ch == ']')
+            {
+              return reader_pop(reader, cJSON_ArrayEnd);
+            }
+
+          /* Fall through */
+
+        case READER_VALUE:
+          if ((unsigned char)ch <= 32)
+            {
+              return 0;
+            }
+          else if (ch == '{')
+            {
+              return reader_push(reader, cJSON_Object);
+            }
+          else if (ch == '[')
+            {
+              return reader_push(reader, cJSON_Array);
+            }
+          else if (ch == '\"')
+            {
+              reader->isname = false;
+              reader->state = READER_STRING;
+              return 0;
+            }
+          else if (ch == '-' || (ch >= '0' && ch <= '9'))
+            {
+              reader->state = READER_NUMBER;
+              return reader_addch(reader, ch);
+            }
+          else if (ch >= 'a' && ch <= 'z')
+            {
+              reader->state = READER_LITERAL;
+              return reader_addch(reader, ch);
+            }
+
+          return -1;
+
+        case READER_FIRSTNAME:
+          if (ch == '}')
+            {
+              return reader_pop(reader, cJSON_ObjectEnd);
+            }
+
+          /* Fall through */
+
+        case READER_NAME:
+          if ((unsigned char)ch <= 32)
+            {
+              return 0;
+            }
+          else if (ch == '\"')
+            {
+              reader->isname = true;
+              reader->state = READER_STRING;
+              return 0;
+            }
+
+          return -1;
+
+        case READER_COLON:
+          if ((unsigned char)ch <= 32)
+            {
+              return 0;
+            }
+          else if (ch == ':')
+            {
+              reader->state = READER_VALUE;
+              return 0;
+            }
+
+          return -1;
+
+        case READER_AFTER:
+          if ((unsigned char)ch <= 32)
+            {
+              return 0;
+            }
+          else if (ch == ',')
+            {
+              reader->state =
+                (reader->nest & (1ul << (reader->depth - 1))) != 0 ?
+                READER_NAME : READER_VALUE;
+              return 0;
+            }
+          else if (ch == '}')
+            {
+              return reader_pop(reader, cJSON_ObjectEnd);
+            }
+          else if (ch == ']')
+            {
+              return reader_pop(reader, cJSON_ArrayEnd);
+            }
+
+          return -1;
+
+        case READER_STRING:
+          if (reader->surrogate && ch != '\\')
+            {
+              /* Missing second half of a surrogate pair */
+
+              reader->surrogate = 0;
+            }
+
+          if (ch == '\\')
+            {
+              reader->state = READER_ESCAPE;
+              return 0;
+            }
+          else if (ch != '\"')
+            {
+              return reader_addch(reader, ch);
+            }
+
+          /* The end of the string */
+
+          if (!reader->isname)
+            {
+              return reader_value(reader, cJSON_String);
+            }
+
+          /* It was the name of an object member.  Keep it at the beginning
+           * of the buffer until the value has been read.  This also leaves
+           * room for the terminator of an empty value.
+           */
+
+          if (reader_addch(reader, '\0') < 0)
+            {
+              return -1;
+            }
+
+          reader->namelen = reader->len;
+          reader->state   = READER_COLON;
+          return 0;
+
+        case READER_ESCAPE:
+          reader->state = READER_STRING;
+          if (reader->surrogate && ch != 'u')
+            {
+              reader->surrogate = 0;
+            }
+
+          switch (ch)
+            {
+            case 'b':
+              return reader_addch(reader, '\b');
+
+            case 'f':
+              return reader_addch(reader, '\f');
+
+            case 'n':
+              return reader_addch(reader, '\n');
+
+            case 'r':
+              return reader_addch(reader, '\r');
+
+            case 't':
+              return reader_addch(reader, '\t');
+
+            case 'u':
+              reader->uc    = 0;
+              reader->nhex  = 0;
+              reader->state = READER_UNICODE;
+              return 0;
+
+            default:
+              return reader_addch(reader, ch);
+            }
+
+        case READER_UNICODE:
+          if (!isxdigit((unsigned char)ch))
+            {
+              return -1;
+            }
+
+          reader->uc = (reader->uc << 4) |
+                       (isdigit((unsigned char)ch) ? ch - '0' :
+                        (tolower((unsigned char)ch) - 'a' + 10));
+
+          if (++reader->nhex < 4)
+            {
+              return 0;
+            }
+
+          reader->state = READER_STRING;
+          return reader_unicode(reader);
+
+        case READER_NUMBER:
+          if ((ch >= '0' && ch <= '9') || ch == '.' || ch == 'e' ||
+              ch == 'E' || ch == '+' || ch == '-')
+            {
+              return reader_addch(reader, ch);
+            }
+
+          /* The number ends here.  Report it, then process the character
+           * that ended it.
+           */
+
+          if (reader_value(reader, cJSON_Number) < 0)
+            {
+              return -1;
+            }
+
+          break;
+
+        case READER_LITERAL:
+          if (ch >= 'a' && ch <= 'z')
+            {
+              return reader_addch(reader, ch);
+            }
+
+          if (reader_value(reader, cJSON_True) < 0)
+            {
+              return -1;
+            }
+
+          break;
+
+        case READER_DONE:
+          return (unsigned char)ch <= 32 ? 0 : -1;
+
+        default:
+        case READER_ERROR:
+          return -1;
+        }
+    }
+}
+
+/* Add data to the writer buffer, flushing it to the file descriptor as it
+ * fills.
+ */
+
+static int writer_put(cJSON_Writer *writer, const char *data, size_t len)
+{
+  size_t n;
+
+  if (writer->error)
+    {
+      return -1;
+    }
+
+  while (len > 0)
+    {
+      if (writer->fd >= 0 && writer->len >= writer->size &&
+          cJSON_WriterFlush(writer) < 0)
+        {
+          return -1;
+        }
+
+      /* A fixed buffer must keep one byte for the NUL terminator */
+
+      n = writer->size - writer->len;
+      if (writer->fd < 0 && n > 0)
+        {
+          n--;
+        }
+
+      if (n == 0)
+        {
+          /* The fixed buffer is full */
+
+          writer->error = true;
+          return -1;
+        }
+
+      if (n > len)
+        {
+          n = len;
+        }
+
+      memcpy(&writer->buffer[writer->len], data, n);
+      writer->len += n;
+      data        += n;
+      len         -= n;
+    }
+
+  return 0;
+}
+
+/* Write a string with JSON escapes. */
+
+static int writer_string(cJSON_Writer *writer, const char *str)
+{
+  const char *esc;
+  char tmp[8];
+  int ret;
+
+  ret = writer_put(writer, "\"", 1);
+  for (; str && *str && ret == 0; str++)
+    {
+      unsigned char token = *str;
+
+      if (token > 31 && token != '\"' && token != '\\')
+        {
+          /* Copy the run of characters that need no escape at once */
+
+          for (esc = str; *esc && (unsigned char)*esc > 31 &&
+               *esc != '\"' && *esc != '\\'; esc++);
+
+          ret = writer_put(writer, str, esc - str);
+          str = esc - 1;
+          continue;
+        }
+
+      switch (token)
+        {
+        case '\\':
+        case '\"':
+          tmp[0] = '\\';
+          tmp[1] = token;
+          tmp[2] = '\0';
+          break;
+
+        case '\b':
+          strcpy(tmp, "\\b");
+          break;
+
+        case '\f':
+          strcpy(tmp, "\\f");
+          break;
+
+        case '\n':
+          strcpy(tmp, "\\n");
+          break;
+
+        case '\r':
+          strcpy(tmp, "\\r");
+          break;
+
+        case '\t':
+          strcpy(tmp, "\\t");
+          break;
+
+        default:
+          sprintf(tmp, "\\u%04x", token);
+          break;
+        }
+
+      ret = writer_put(writer, tmp, strlen(tmp));
+    }
+
+  return ret | writer_put(writer, "\"", 1);
+}
+
+/* Write the separator and the name that precede a value. */
+
+static int writer_begin(cJSON_Writer *writer, const char *name)
+{
+  unsigned long bit;
+  int ret = 0;
+
+  if (writer->error)
+    {
+      return -1;
+    }
+
+  if (writer->depth > 0)
+    {
+      bit = 1ul << (writer->depth - 1);
+      if (writer->nest & bit)
+        {
+          ret = writer_put(writer, ",", 1);
+        }
+
+      writer->nest |= bit;
+    }
+
+  if (name && ret == 0)
+    {
+      ret = writer_string(writer, name) | writer_put(writer, ":", 1);
+    }
+
+  return ret;
+}
+
+/* Start an object or array. */
+
+static int writer_push(cJSON_Writer *writer, const char *name, char ch)
+{
+  if (writer->depth >= CJSON_MAXDEPTH || writer_begin(writer, name) < 0)
+    {
+      writer->error = true;
+      return -1;
+    }
+
+  writer->nest &= ~(1ul << writer->depth);
+  writer->depth++;
+  return writer_put(writer, &ch, 1);
+}
+
+/* End an object or array. */
+
+static int writer_pop(cJSON_Writer *writer, char ch)
+{
+  if (writer->depth <= 0)
+    {
+      writer->error = true;
+      return -1;
+    }
+
+  writer->depth--;
+  return writer_put(writer, &ch, 1);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/* Prepare a streaming reader. */
+
+void cJSON_ReaderInit(cJSON_Reader *reader, char *buffer, size_t size,
+                      cJSON_StreamCallback callback, void *arg)
+{
+  memset(reader, 0, sizeof(cJSON_Reader));
+  reader->buffer   = buffer;
+  reader->size     = size;
+  reader->callback = callback;
+  reader->arg      = arg;
+  reader->state    = READER_VALUE;
+}
+
+/* Parse the next chunk of input. */
+
+int cJSON_ReaderFeed(cJSON_Reader *reader, const char *data, size_t len)
+{
+  for (; len > 0; data++, len--)
+    {
+      if (reader_char(reader, *data) < 0)
+        {
+          reader->state = READER_ERROR;
+          return -1;
+        }
+    }
+
+  return 0;
+}
+
+/* End of input.  Complete a top-level number and check that the input
+ * held one complete value.
+ */
+
+int cJSON_ReaderFinish(cJSON_Reader *reader)
+{
+  if ((reader->state == READER_NUMBER || reader->state == READER_LITERAL) &&
+      reader_char(reader, ' ') < 0)
+    {
+      reader->state = READER_ERROR;
+    }
+
+  return reader->state == READER_DONE ? 0 : -1;
+}
+
+/* Prepare a streaming writer. */
+
+void cJSON_WriterInit(cJSON_Writer *writer, char *buffer, size_t size,
+                      int fd)
+{
+  memset(writer, 0, sizeof(cJSON_Writer));
+  writer->buffer = buffer;
+  writer->size   = size;
+  writer->fd     = fd;
+}
+
+int cJSON_WriteObjectStart(cJSON_Writer *writer, const char *name)
+{
+  return writer_push(writer, name, '{');
+}
+
+int cJSON_WriteObjectEnd(cJSON_Writer *writer)
+{
+  return writer_pop(writer, '}');
+}
+
+int cJSON_WriteArrayStart(cJSON_Writer *writer, const char *name)
+{
+  return writer_push(writer, name, '[');
+}
+
+int cJSON_WriteArrayEnd(cJSON_Writer *writer)
+{
+  return writer_pop(writer, ']');
+}
+
+int cJSON_WriteString(cJSON_Writer *writer, const char *name,
+                      const char *string)
+{
+  return writer_begin(writer, name) | writer_string(writer, string);
+}
+
+/* Numbers are rendered in the same way as cJSON_Print():  With the fewest
+ * digits that convert back to the same value, and as null if they are not
+ * finite.
+ */
+
+int cJSON_WriteNumber(cJSON_Writer *writer, const char *name, double num)
+{
+  char tmp[CJSON_NUMBUFSIZE];
+
+  cJSON_PrintDouble(tmp, num);
+  return writer_begin(writer, name) | writer_put(writer, tmp, strlen(tmp));
+}
+
+int cJSON_WriteBool(cJSON_Writer *writer, const char *name, int b)
+{
+  return writer_begin(writer, name) |
+         writer_put(writer, b ? "true" : "false", b ? 4 : 5);
+}
+
+int cJSON_WriteNull(cJSON_Writer *writer, const char *name)
+{
+  return writer_begin(writer, name) | writer_put(writer, "null", 4);
+}
+
+/* Write out the buffered output (or NUL terminate a fixed buffer). */
+
+int cJSON_WriterFlush(cJSON_Writer *writer)
+{
+  ssize_t nwritten;
+  size_t offset;
+
+  if (writer->error)
+    {
+      return -1;
+    }
+
+  if (writer->fd < 0)
+    {
+      if (writer->size > 0)
+        {
+          writer->buffer[writer->len] = '\0';
+        }
+
+      return 0;
+    }
+
+  for (offset = 0; offset < writer->len; offset += nwritten)
+    {
+      nwritten = write(writer->fd, &writer->buffer[offset],
+                       writer->len - offset);
+      if (nwritten < 0 && errno == EINTR)
+        {
+          nwritten = 0;
+        }
+      else if (nwritten <= 0)
+        {
+          writer->error = true;
+          return -1;
+        }
+    }
+
+  writer->len = 0;
+  return 0;
+}
@@ -0,0 +1,275 @@
+/****************************************************************************
+ * netutils/netlib/netlib_ifinfo.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <stdint.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include <netinet/in.h>
+#include <net/if.h>
+
+#include "netutils/netlib.h"
+
+#if defined(CONFIG_NET) && CONFIG_NSOCKET_DESCRIPTORS > 0
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: netlib_ifreq
+ *
+ * Description:
+ *   Perform one interface ioctl on the context socket
+ *
+ ****************************************************************************/
+
+static int netlib_ifreq(FAR struct netlib_ctx_s *ctx, FAR const char *ifname,
+                        int cmd, FAR struct ifreq *req)
+{
+  memset(req, 0, sizeof(struct ifreq));
+  strncpy(req->ifr_name, ifname, IFNAMSIZ);
+  return ioctl(ctx->sockfd, cmd, (unsigned long)req);
+}
+
+#ifdef CONFIG_NET_IPv4
+/****************************************************************************
+ * Name: netlib_ifreq_ipv4
+ *
+ * Description:
+ *   Get one IPv4 address attribute.  Sets the valid bit on success.
+ *
+ ****************************************************************************/
+
+static void netlib_ifreq_ipv4(FAR struct netlib_ctx_s *ctx,
+                              FAR struct netlib_ifinfo_s *info, int cmd,
+                              FAR struct in_addr *addr, uint16_t bit)
+{
+  struct ifreq req;
+
+  if (netlib_ifreq(ctx, info->ifname, cmd, &req) == OK)
+    {
+      FAR struct sockaddr_in *req_addr;
+
+      req_addr = (FAR struct sockaddr_in *)&req.ifr_addr;
+      memcpy(addr, &req_addr->sin_addr, sizeof(struct in_addr));
+      info->valid |= bit;
+    }
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: netlib_open_ctx
+ *
+ * Description:
+ *   Open the socket of a netlib context.  The socket stays open for all of
+ *   the calls made with the context until netlib_close_ctx().
+ *
+ * Parameters:
+ *   ctx      The context to initialize
+ *
+ * Return:
+ *   0 on success; -1 on failure with errno set
+ *
+ ****************************************************************************/
+
+int netlib_open_ctx(FAR struct netlib_ctx_s *ctx)
+{
+  ctx->sockfd = socket(NETLIB_SOCK_FAMILY, NETLIB_SOCK_TYPE,
+                       NETLIB_SOCK_PROTOCOL);
+  return ctx->sockfd < 0 ? ERROR : OK;
+}
+
+/****************************************************************************
+ * Name: netlib_close_ctx
+ *
+ * Description:
+ *   Close the socket of a netlib context
+ *
+ ****************************************************************************/
+
+void netlib_close_ctx(FAR struct netlib_ctx_s *ctx)
+{
+  if (ctx->sockfd >= 0)
+    {
+      close(ctx->sockfd);
+      ctx->sockfd = -1;
+    }
+}
+
+/****************************************************************************
+ * Name: netlib_get_ifinfo
+ *
+ * Description:
+ *   Get all attributes of a network interface with the socket of the
+ *   context.  Attributes the interface does not have, such as the MAC
+ *   address of a SLIP device, are left out of info->valid.
+ *
+ * Parameters:
+ *   ctx      An open netlib context
+ *   ifname   The name of the interface
+ *   info     The location to return the attributes
+ *
+ * Return:
+ *   0 on success; -1 on failure, if there is no such interface
+ *
+ ****************************************************************************/
+
+int netlib_get_ifinfo(FAR struct netlib_ctx_s *ctx, FAR const char *ifname,
+                      FAR struct netlib_ifinfo_s *info)
+{
+  struct ifreq req;
+#ifdef CONFIG_NET_IPv6
+  struct lifreq lreq;
+#endif
+
+  if (ctx == NULL || ifname == NULL || info == NULL)
+    {
+      return ERROR;
+    }
+
+  memset(info, 0, sizeof(struct netlib_ifinfo_s));
+  strncpy(info->ifname, ifname, IFNAMSIZ - 1);
+
+  /* The flags must be available for any interface */
+
+  if (netlib_ifreq(ctx, ifname, SIOCGIFFLAGS, &req) != OK)
+    {
+      return ERROR;
+    }
+
+  info->flags  = req.ifr_flags;
+  info->valid |= NETLIB_IFINFO_FLAGS;
+
+#ifdef CONFIG_NET_IPv4
+  netlib_ifreq_ipv4(ctx, info, SIOCGIFADDR, &info->ipv4addr,
+                    NETLIB_IFINFO_IPV4ADDR);
+  netlib_ifreq_ipv4(ctx, info, SIOCGIFDSTADDR, &info->dripv4addr,
+                    NETLIB_IFINFO_DRIPV4ADDR);
+  netlib_ifreq_ipv4(ctx, info, SIOCGIFNETMASK, &info->ipv4netmask,
+                    NETLIB_IFINFO_IPV4NETMASK);
+#endif
+
+#ifdef CONFIG_NET_IPv6
+  memset(&lreq, 0, sizeof(struct lifreq));
+  strncpy(lreq.lifr_name, ifname, IFNAMSIZ);
+  if (ioctl(ctx->sockfd, SIOCGLIFADDR, (unsigned long)&lreq) == OK)
+    {
+      FAR struct sockaddr_in6 *req_addr;
+
+      req_addr = (FAR struct sockaddr_in6 *)&lreq.lifr_addr;
+      memcpy(&info->ipv6addr, &req_addr->sin6_addr, sizeof(struct in6_addr));
+      info->valid |= NETLIB_IFINFO_IPV6ADDR;
+    }
+#endif
+
+#ifdef CONFIG_NET_ETHERNET
+  if (netlib_ifreq(ctx, ifname, SIOCGIFHWADDR, &req) == OK)
+    {
+      memcpy(info->macaddr, &req.ifr_hwaddr.sa_data, IFHWADDRLEN);
+      info->valid |= NETLIB_IFINFO_MACADDR;
+    }
+#endif
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: netlib_foreach_ifinfo
+ *
+ * Description:
+ *   Get the attributes of every network interface listed in /proc/net and
+ *   pass them to the callback.
+ *
+ * Parameters:
+ *   ctx      An open netlib context
+ *   callback Called for each interface
+ *   arg      Argument passed to the callback
+ *
+ * Return:
+ *   0 when all interfaces were visited, the non-zero return value of the
+ *   callback that ended the enumeration, or -1 if /proc/net could not be
+ *   opened
+ *
+ ****************************************************************************/
+
+int netlib_foreach_ifinfo(FAR struct netlib_ctx_s *ctx,
+                          netlib_ifinfo_cb_t callback, FAR void *arg)
+{
+  struct netlib_ifinfo_s info;
+  FAR struct dirent *entry;
+  FAR DIR *dir;
+  int ret = OK;
+
+  dir = opendir(NETLIB_NETDEV_PATH);
+  if (dir == NULL)
+    {
+      return ERROR;
+    }
+
+  /* Each network device has a regular file; /proc/net/stat is not one */
+
+  while ((entry = readdir(dir)) != NULL)
+    {
+      if (entry->d_type == DTYPE_FILE && strcmp(entry->d_name, "stat") != 0 &&
+          netlib_get_ifinfo(ctx, entry->d_name, &info) == OK)
+        {
+          ret = callback(&info, arg);
+          if (ret != OK)
+            {
+              break;
+            }
+        }
+    }
+
+  closedir(dir);
+  return ret;
+}
+
+#endif /* CONFIG_NET && CONFIG_NSOCKET_DESCRIPTORS */
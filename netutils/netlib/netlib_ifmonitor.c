@@ -0,0 +1,342 @@
+/****************************************************************************
+ * netutils/netlib/netlib_ifmonitor.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+
+#include "netutils/netlib.h"
+
+#if defined(CONFIG_NETLIB_IFMONITOR) && CONFIG_NSOCKET_DESCRIPTORS > 0
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_NETLIB_IFMONITOR_STACKSIZE
+#  define CONFIG_NETLIB_IFMONITOR_STACKSIZE 2048
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One sampling pass over all interfaces */
+
+struct netlib_ifscan_s
+{
+  FAR struct netlib_ifmon_s *mon;
+  int nifs;
+  struct netlib_ifinfo_s ifs[CONFIG_NETLIB_IFMONITOR_MAXIFS];
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: netlib_ifinfo_diff
+ *
+ * Description:
+ *   Return the NETLIB_IFINFO_* bits of the attributes that differ
+ *
+ ****************************************************************************/
+
+static uint16_t netlib_ifinfo_diff(FAR const struct netlib_ifinfo_s *a,
+                                   FAR const struct netlib_ifinfo_s *b)
+{
+  uint16_t changed = a->valid ^ b->valid;
+  uint16_t both = a->valid & b->valid;
+
+  if ((both & NETLIB_IFINFO_FLAGS) != 0 && a->flags != b->flags)
+    {
+      changed |= NETLIB_IFINFO_FLAGS;
+    }
+
+#ifdef CONFIG_NET_IPv4
+  if ((both & NETLIB_IFINFO_IPV4ADDR) != 0 &&
+      a->ipv4addr.s_addr != b->ipv4addr.s_addr)
+    {
+      changed |= NETLIB_IFINFO_IPV4ADDR;
+    }
+
+  if ((both & NETLIB_IFINFO_DRIPV4ADDR) != 0 &&
+      a->dripv4addr.s_addr != b->dripv4addr.s_addr)
+    {
+      changed |= NETLIB_IFINFO_DRIPV4ADDR;
+    }
+
+  if ((both & NETLIB_IFINFO_IPV4NETMASK) != 0 &&
+      a->ipv4netmask.s_addr != b->ipv4netmask.s_addr)
+    {
+      changed |= NETLIB_IFINFO_IPV4NETMASK;
+    }
+#endif
+
+#ifdef CONFIG_NET_IPv6
+  if ((both & NETLIB_IFINFO_IPV6ADDR) != 0 &&
+      memcmp(&a->ipv6addr, &b->ipv6addr, sizeof(struct in6_addr)) != 0)
+    {
+      changed |= NETLIB_IFINFO_IPV6ADDR;
+    }
+#endif
+
+#ifdef CONFIG_NET_ETHERNET
+  if ((both & NETLIB_IFINFO_MACADDR) != 0 &&
+      memcmp(a->macaddr, b->macaddr, IFHWADDRLEN) != 0)
+    {
+      changed |= NETLIB_IFINFO_MACADDR;
+    }
+#endif
+
+  return changed;
+}
+
+/****************************************************************************
+ * Name: netlib_ifmon_find
+ ****************************************************************************/
+
+static FAR struct netlib_ifinfo_s *
+netlib_ifmon_find(FAR struct netlib_ifinfo_s *ifs, int nifs,
+                  FAR const char *ifname)
+{
+  int i;
+
+  for (i = 0; i < nifs; i++)
+    {
+      if (strncmp(ifs[i].ifname, ifname, IFNAMSIZ) == 0)
+        {
+          return &ifs[i];
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: netlib_ifmon_sample
+ *
+ * Description:
+ *   netlib_foreach_ifinfo() callback.  Reports new and changed interfaces
+ *   and records the new state.
+ *
+ ****************************************************************************/
+
+static int netlib_ifmon_sample(FAR const struct netlib_ifinfo_s *info,
+                               FAR void *arg)
+{
+  FAR struct netlib_ifscan_s *scan = (FAR struct netlib_ifscan_s *)arg;
+  FAR struct netlib_ifmon_s *mon = scan->mon;
+  FAR struct netlib_ifinfo_s *prev;
+  uint16_t changed;
+
+  if (scan->nifs >= CONFIG_NETLIB_IFMONITOR_MAXIFS)
+    {
+      /* Interfaces beyond the limit are not monitored */
+
+      return OK;
+    }
+
+  prev = netlib_ifmon_find(mon->ifs, mon->nifs, info->ifname);
+  changed = prev ? netlib_ifinfo_diff(prev, info) : NETLIB_IFCHANGE_ADDED;
+  if (changed != 0)
+    {
+      mon->callback(info, changed, mon->arg);
+    }
+
+  memcpy(&scan->ifs[scan->nifs++], info, sizeof(struct netlib_ifinfo_s));
+  return OK;
+}
+
+/****************************************************************************
+ * Name: netlib_ifmon_thread
+ ****************************************************************************/
+
+static FAR void *netlib_ifmon_thread(FAR void *arg)
+{
+  FAR struct netlib_ifmon_s *mon = (FAR struct netlib_ifmon_s *)arg;
+  struct netlib_ifscan_s scan;
+  struct timespec abstime;
+  int i;
+
+  scan.mon = mon;
+
+  pthread_mutex_lock(&mon->lock);
+  while (!mon->stop)
+    {
+      pthread_mutex_unlock(&mon->lock);
+
+      /* Sample all interfaces and report the ones that went away */
+
+      scan.nifs = 0;
+      if (netlib_foreach_ifinfo(&mon->ctx, netlib_ifmon_sample, &scan) >= 0)
+        {
+          for (i = 0; i < mon->nifs; i++)
+            {
+              if (netlib_ifmon_find(scan.ifs, scan.nifs,
+                                    mon->ifs[i].ifname) == NULL)
+                {
+                  mon->callback(&mon->ifs[i], NETLIB_IFCHANGE_REMOVED,
+                                mon->arg);
+                }
+            }
+
+          memcpy(mon->ifs, scan.ifs,
+                 scan.nifs * sizeof(struct netlib_ifinfo_s));
+          mon->nifs = scan.nifs;
+        }
+
+      /* Wait for the next interval, or to be stopped */
+
+      clock_gettime(CLOCK_REALTIME, &abstime);
+      abstime.tv_sec  += mon->interval / 1000;
+      abstime.tv_nsec += (mon->interval % 1000) * 1000000;
+      if (abstime.tv_nsec >= 1000000000)
+        {
+          abstime.tv_sec++;
+          abstime.tv_nsec -= 1000000000;
+        }
+
+      pthread_mutex_lock(&mon->lock);
+      while (!mon->stop &&
+             pthread_cond_timedwait(&mon->cond, &mon->lock, &abstime) == 0)
+        {
+        }
+    }
+
+  pthread_mutex_unlock(&mon->lock);
+  return NULL;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: netlib_start_ifmonitor
+ *
+ * Description:
+ *   Start a thread that samples all network interfaces every 'interval'
+ *   milliseconds over one netlib context, and calls 'callback' for every
+ *   interface that appeared, went away or changed since the last sample.
+ *   All interfaces present are reported as added on the first sample.
+ *
+ * Parameters:
+ *   mon      Monitor state, must stay valid until netlib_stop_ifmonitor()
+ *   callback Change callback, called on the monitor thread
+ *   arg      Argument passed to the callback
+ *   interval Sampling interval in milliseconds
+ *
+ * Return:
+ *   0 on success; -1 on failure
+ *
+ ****************************************************************************/
+
+int netlib_start_ifmonitor(FAR struct netlib_ifmon_s *mon,
+                           netlib_ifchange_t callback, FAR void *arg,
+                           int interval)
+{
+  pthread_attr_t attr;
+  int ret;
+
+  if (mon == NULL || callback == NULL || interval <= 0)
+    {
+      return ERROR;
+    }
+
+  memset(mon, 0, sizeof(struct netlib_ifmon_s));
+  mon->callback = callback;
+  mon->arg      = arg;
+  mon->interval = interval;
+
+  if (netlib_open_ctx(&mon->ctx) < 0)
+    {
+      return ERROR;
+    }
+
+  pthread_mutex_init(&mon->lock, NULL);
+  pthread_cond_init(&mon->cond, NULL);
+
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, CONFIG_NETLIB_IFMONITOR_STACKSIZE);
+  ret = pthread_create(&mon->thread, &attr, netlib_ifmon_thread, mon);
+  pthread_attr_destroy(&attr);
+
+  if (ret != 0)
+    {
+      pthread_cond_destroy(&mon->cond);
+      pthread_mutex_destroy(&mon->lock);
+      netlib_close_ctx(&mon->ctx);
+      errno = ret;
+      return ERROR;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: netlib_stop_ifmonitor
+ *
+ * Description:
+ *   Stop the monitor thread and release its resources.  Must not be called
+ *   from the change callback.
+ *
+ ****************************************************************************/
+
+int netlib_stop_ifmonitor(FAR struct netlib_ifmon_s *mon)
+{
+  pthread_mutex_lock(&mon->lock);
+  mon->stop = true;
+  pthread_cond_signal(&mon->cond);
+  pthread_mutex_unlock(&mon->lock);
+
+  pthread_join(mon->thread, NULL);
+
+  pthread_cond_destroy(&mon->cond);
+  pthread_mutex_destroy(&mon->lock);
+  netlib_close_ctx(&mon->ctx);
+  return OK;
+}
+
+#endif /* CONFIG_NETLIB_IFMONITOR && CONFIG_NSOCKET_DESCRIPTORS */
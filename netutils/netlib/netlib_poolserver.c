@@ -0,0 +1,413 @@
+/****************************************************************************
+ * netutils/netlib/netlib_poolserver.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <netinet/in.h>
+
+#include "netutils/netlib.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_NETLIB_SERVER_QUEUELEN
+#  define CONFIG_NETLIB_SERVER_QUEUELEN 8
+#endif
+
+/* Several listeners take turns on the listen socket with poll() */
+
+#ifdef CONFIG_DISABLE_POLL
+#  define NETLIB_MAXLISTENERS 1
+#else
+#  define NETLIB_MAXLISTENERS 4
+#  define NETLIB_POLL_TIMEOUT 1000 /* ms between checks of the stop flag */
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct netlib_pool_s
+{
+  pthread_startroutine_t handler;  /* Connection handler */
+  pthread_mutex_t lock;            /* Protects everything below */
+  pthread_cond_t notempty;         /* Signalled when a connection is queued */
+  pthread_cond_t notfull;          /* Signalled when a connection is taken */
+  int listensd;                    /* The shared listen socket */
+  int head;                        /* Next connection to serve */
+  int count;                       /* Number of queued connections */
+  bool stop;                       /* Set when the server shuts down */
+  int queue[CONFIG_NETLIB_SERVER_QUEUELEN];
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: netlib_pool_stop
+ ****************************************************************************/
+
+static void netlib_pool_stop(FAR struct netlib_pool_s *pool)
+{
+  pthread_mutex_lock(&pool->lock);
+  pool->stop = true;
+  pthread_cond_broadcast(&pool->notempty);
+  pthread_cond_broadcast(&pool->notfull);
+  pthread_mutex_unlock(&pool->lock);
+}
+
+/****************************************************************************
+ * Name: netlib_pool_worker
+ *
+ * Description:
+ *   Worker thread: serves queued connections until the server stops
+ *
+ ****************************************************************************/
+
+static FAR void *netlib_pool_worker(FAR void *arg)
+{
+  FAR struct netlib_pool_s *pool = (FAR struct netlib_pool_s *)arg;
+  int acceptsd;
+
+  for (; ; )
+    {
+      pthread_mutex_lock(&pool->lock);
+      while (pool->count == 0 && !pool->stop)
+        {
+          pthread_cond_wait(&pool->notempty, &pool->lock);
+        }
+
+      if (pool->count == 0)
+        {
+          /* Stopped and nothing left to serve */
+
+          pthread_mutex_unlock(&pool->lock);
+          break;
+        }
+
+      acceptsd    = pool->queue[pool->head];
+      pool->head  = (pool->head + 1) % CONFIG_NETLIB_SERVER_QUEUELEN;
+      pool->count--;
+      pthread_cond_signal(&pool->notfull);
+      pthread_mutex_unlock(&pool->lock);
+
+      /* The handler owns and closes the socket, as with netlib_server() */
+
+      ninfo("Serving sd=%d\n", acceptsd);
+      (void)pool->handler((pthread_addr_t)((uintptr_t)acceptsd));
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: netlib_pool_listener
+ *
+ * Description:
+ *   Listener: accepts connections and queues them for the workers.  Waits
+ *   while the queue is full, leaving further connections in the listen
+ *   backlog.
+ *
+ ****************************************************************************/
+
+static FAR void *netlib_pool_listener(FAR void *arg)
+{
+  FAR struct netlib_pool_s *pool = (FAR struct netlib_pool_s *)arg;
+  struct sockaddr_in myaddr;
+#ifdef CONFIG_NET_SOLINGER
+  struct linger ling;
+#endif
+#ifndef CONFIG_DISABLE_POLL
+  struct pollfd fds;
+  int flags;
+#endif
+  socklen_t addrlen;
+  int acceptsd;
+  int ret;
+
+  while (!pool->stop)
+    {
+#ifndef CONFIG_DISABLE_POLL
+      /* Wait for a connection, checking the stop flag now and then */
+
+      fds.fd      = pool->listensd;
+      fds.events  = POLLIN;
+      fds.revents = 0;
+
+      ret = poll(&fds, 1, NETLIB_POLL_TIMEOUT);
+      if (ret < 0 && errno != EINTR)
+        {
+          nerr("ERROR: poll failure: %d\n", errno);
+          break;
+        }
+      else if (ret <= 0)
+        {
+          continue;
+        }
+#endif
+
+      addrlen  = sizeof(struct sockaddr_in);
+      acceptsd = accept(pool->listensd, (struct sockaddr *)&myaddr, &addrlen);
+      if (acceptsd < 0)
+        {
+          /* Another listener may have taken the connection */
+
+          if (errno == EAGAIN || errno == EINTR)
+            {
+              continue;
+            }
+
+          nerr("ERROR: accept failure: %d\n", errno);
+          break;
+        }
+
+#ifndef CONFIG_DISABLE_POLL
+      /* The listen socket is non-blocking; the handler expects a blocking
+       * connection.
+       */
+
+      flags = fcntl(acceptsd, F_GETFL, 0);
+      if (flags >= 0 && (flags & O_NONBLOCK) != 0)
+        {
+          (void)fcntl(acceptsd, F_SETFL, flags & ~O_NONBLOCK);
+        }
+#endif
+
+#ifdef CONFIG_NET_SOLINGER
+      ling.l_onoff  = 1;
+      ling.l_linger = 30;     /* timeout is seconds */
+
+      ret = setsockopt(acceptsd, SOL_SOCKET, SO_LINGER, &ling,
+                       sizeof(struct linger));
+      if (ret < 0)
+        {
+          close(acceptsd);
+          nerr("ERROR: setsockopt SO_LINGER failure: %d\n", errno);
+          break;
+        }
+#endif
+
+      /* Queue the connection */
+
+      pthread_mutex_lock(&pool->lock);
+      while (pool->count >= CONFIG_NETLIB_SERVER_QUEUELEN && !pool->stop)
+        {
+          pthread_cond_wait(&pool->notfull, &pool->lock);
+        }
+
+      if (pool->stop)
+        {
+          pthread_mutex_unlock(&pool->lock);
+          close(acceptsd);
+          break;
+        }
+
+      pool->queue[(pool->head + pool->count) %
+                  CONFIG_NETLIB_SERVER_QUEUELEN] = acceptsd;
+      pool->count++;
+      pthread_cond_signal(&pool->notempty);
+      pthread_mutex_unlock(&pool->lock);
+    }
+
+  /* Take the whole server down with this listener */
+
+  netlib_pool_stop(pool);
+  return NULL;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: netlib_poolserver
+ *
+ * Description:
+ *   Implement server logic with a fixed pool of worker threads.  Unlike
+ *   netlib_server(), no thread is created per connection: accepted
+ *   connections are queued and served by the first free worker, and the
+ *   workers persist between connections.  Optionally, several listener
+ *   threads accept connections from the same listen socket.
+ *
+ * Parameters:
+ *   portno     The port to listen on (in network byte order)
+ *   handler    Called on a worker thread for each accepted connection with
+ *              the socket descriptor as its argument; the handler must close
+ *              the socket.  Handlers written for netlib_server() work as is.
+ *   stacksize  The stack size of the worker and listener threads
+ *   nworkers   The number of worker threads; the number of connections
+ *              served at the same time
+ *   nlisteners The number of listener threads including the calling thread
+ *
+ * Return:
+ *   Does not return unless an error occurs.
+ *
+ ****************************************************************************/
+
+void netlib_poolserver(uint16_t portno, pthread_startroutine_t handler,
+                       int stacksize, int nworkers, int nlisteners)
+{
+  FAR struct netlib_pool_s *pool;
+  FAR pthread_t *threads;
+  pthread_attr_t attr;
+  int nthreads = 0;
+  int ret;
+  int i;
+
+  if (nworkers < 1)
+    {
+      nworkers = 1;
+    }
+
+  if (nlisteners < 1)
+    {
+      nlisteners = 1;
+    }
+  else if (nlisteners > NETLIB_MAXLISTENERS)
+    {
+      nlisteners = NETLIB_MAXLISTENERS;
+    }
+
+  pool    = (FAR struct netlib_pool_s *)zalloc(sizeof(struct netlib_pool_s));
+  threads = (FAR pthread_t *)malloc((nworkers + nlisteners - 1) *
+                                    sizeof(pthread_t));
+  if (pool == NULL || threads == NULL)
+    {
+      nerr("ERROR: Failed to allocate the server\n");
+      goto errout_with_alloc;
+    }
+
+  pool->handler = handler;
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->notempty, NULL);
+  pthread_cond_init(&pool->notfull, NULL);
+
+  /* Create a new TCP socket to use to listen for connections */
+
+  pool->listensd = netlib_listenon(portno);
+  if (pool->listensd < 0)
+    {
+      goto errout_with_pool;
+    }
+
+#ifndef CONFIG_DISABLE_POLL
+  ret = fcntl(pool->listensd, F_GETFL, 0);
+  if (ret < 0 || fcntl(pool->listensd, F_SETFL, ret | O_NONBLOCK) < 0)
+    {
+      nerr("ERROR: fcntl failure: %d\n", errno);
+      goto errout_with_socket;
+    }
+#endif
+
+  /* Start the workers and the additional listeners */
+
+  (void)pthread_attr_init(&attr);
+  (void)pthread_attr_setstacksize(&attr, stacksize);
+
+  for (i = 0; i < nworkers + nlisteners - 1; i++)
+    {
+      ret = pthread_create(&threads[i], &attr,
+                           i < nworkers ? netlib_pool_worker :
+                                          netlib_pool_listener,
+                           pool);
+      if (ret != 0)
+        {
+          nerr("ERROR: pthread_create failed: %d\n", ret);
+          break;
+        }
+
+      nthreads++;
+    }
+
+  (void)pthread_attr_destroy(&attr);
+
+  /* Serve as the first listener until an error occurs.  Without a single
+   * worker there is no server.
+   */
+
+  if (nthreads > 0)
+    {
+      (void)netlib_pool_listener(pool);
+    }
+
+  netlib_pool_stop(pool);
+  for (i = 0; i < nthreads; i++)
+    {
+      (void)pthread_join(threads[i], NULL);
+    }
+
+  /* Close connections that were never served */
+
+  while (pool->count > 0)
+    {
+      close(pool->queue[pool->head]);
+      pool->head = (pool->head + 1) % CONFIG_NETLIB_SERVER_QUEUELEN;
+      pool->count--;
+    }
+
+#ifndef CONFIG_DISABLE_POLL
+errout_with_socket:
+#endif
+  close(pool->listensd);
+
+errout_with_pool:
+  pthread_cond_destroy(&pool->notfull);
+  pthread_cond_destroy(&pool->notempty);
+  pthread_mutex_destroy(&pool->lock);
+
+errout_with_alloc:
+  free(threads);
+  free(pool);
+}
@@ -42,9 +42,12 @@
 #include <sys/socket.h>
 #include <sys/time.h>
 
+#include <stdint.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include <time.h>
 #include <sched.h>
 #include <errno.h>
@@ -75,6 +78,10 @@
 #  error CONFIG_NETUTILS_NTPCLIENT_SERVERIP my be provided
 #endif
 
+#ifndef CONFIG_HAVE_LONG_LONG
+#  error The NTP client requires 64-bit integer support
+#endif
+
 /* NTP Time is seconds since 1900. Convert to Unix time which is seconds
  * since 1970
  */
@@ -82,6 +89,37 @@
 #define NTP2UNIX_TRANLSLATION 2208988800u
 #define NTP_VERSION          3
 
+#define NTP_MODE_CLIENT      3
+#define NTP_MODE_SERVER      4
+#define NTP_LI_NOSYNC        3
+#define NTP_MAXSTRATUM       15
+
+/* Each server keeps its last NTP_FILTER_STAGES samples (RFC 5905 clock
+ * filter).
+ */
+
+#define NTP_FILTER_STAGES    8
+
+/* How long to wait for the replies of one poll (seconds), and how soon to
+ * poll again while the clock has never been set.
+ */
+
+#define NTP_RECV_TIMEOUT     2
+#define NTP_STARTUP_DELAYSEC 4
+
+/* While a correction is being slewed, the clock is adjusted every
+ * NTP_SLEW_TICK_MSEC by at most CONFIG_NETUTILS_NTPCLIENT_SLEWPPM parts per
+ * million of the elapsed time.
+ */
+
+#define NTP_SLEW_TICK_MSEC   100
+#define NTP_SLEW_STEP_NSEC   \
+  ((int64_t)CONFIG_NETUTILS_NTPCLIENT_SLEWPPM * NTP_SLEW_TICK_MSEC)
+
+#define NSEC_PER_SEC         1000000000ll
+#define NSEC_PER_MSEC        1000000ll
+#define NSEC_PER_USEC        1000ll
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -108,6 +146,50 @@ struct ntpc_daemon_s
   pid_t pid;              /* Task ID of the NTP daemon */
 };
 
+/* One offset/delay measurement.  The offset excludes any correction that
+ * was still being slewed when the sample was taken.
+ */
+
+struct ntpc_sample_s
+{
+  int64_t offset;         /* Clock offset (nsec) */
+  int64_t delay;          /* Round-trip delay (nsec) */
+};
+
+/* The state kept for each server */
+
+struct ntpc_peer_s
+{
+  struct sockaddr_in addr;  /* Server address */
+  uint64_t xmt;             /* Transmit timestamp of the pending request */
+  uint8_t  reach;           /* Reachability register */
+  uint8_t  nsamples;        /* Number of valid samples */
+  uint8_t  next;            /* Next sample slot to replace */
+  bool     selected;        /* Survived the last selection */
+  struct ntpc_sample_s samples[NTP_FILTER_STAGES];
+
+  /* Clock filter output */
+
+  int64_t  offset;          /* Offset of the lowest-delay sample (nsec) */
+  int64_t  delay;           /* Its round-trip delay (nsec) */
+  int64_t  jitter;          /* RMS offset difference of the samples (nsec) */
+};
+
+/* The state of the clock discipline */
+
+struct ntpc_clock_s
+{
+  uint8_t  npeers;          /* Number of servers */
+  uint8_t  nselected;       /* Survivors of the last selection */
+  bool     synced;          /* The clock has been set at least once */
+  int64_t  offset;          /* Last combined offset (nsec) */
+  int64_t  pending;         /* Correction not yet slewed (nsec) */
+  uint32_t nupdates;        /* Number of clock updates */
+  uint32_t nsteps;          /* Number of those that stepped the clock */
+  time_t   lastupdate;      /* Time of the last update */
+  struct ntpc_peer_s peers[CONFIG_NETUTILS_NTPCLIENT_MAXSERVERS];
+};
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -119,6 +201,12 @@ struct ntpc_daemon_s
 
 static struct ntpc_daemon_s g_ntpc_daemon;
 
+/* The servers and the clock discipline.  Only the daemon modifies this,
+ * and only with the scheduler locked.
+ */
+
+static struct ntpc_clock_s g_ntpc_clock;
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -142,182 +230,796 @@ static inline uint32_t ntpc_getuint32(FAR uint8_t *ptr)
 }
 
 /****************************************************************************
- * Name: ntpc_settime
+ * Name: ntpc_getuint64 and ntpc_putuint64
  *
  * Description:
- *   Given the NTP time in seconds, set the system time
+ *   Get or put a 64-bit NTP timestamp in network order.
+ *
+ *   NTP timestamps are represented as a 64-bit fixed-point number, in
+ *   seconds relative to 0000 UT on 1 January 1900.  The integer part is
+ *   in the first 32 bits and the fraction part in the last 32 bits, as
+ *   shown in the following diagram.
+ *
+ *    0                   1                   2                   3
+ *    0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ *   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *   |                         Integer Part                          |
+ *   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *   |                         Fraction Part                         |
+ *   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
  *
  ****************************************************************************/
 
-static void ntpc_settime(FAR uint8_t *timestamp)
+static inline uint64_t ntpc_getuint64(FAR uint8_t *ptr)
+{
+  return (uint64_t)ntpc_getuint32(ptr) << 32 | ntpc_getuint32(ptr + 4);
+}
+
+static void ntpc_putuint64(FAR uint8_t *ptr, uint64_t value)
+{
+  int i;
+
+  for (i = 7; i >= 0; i--)
+    {
+      ptr[i] = (uint8_t)value;
+      value >>= 8;
+    }
+}
+
+/****************************************************************************
+ * Name: ntpc_localtime
+ *
+ * Description:
+ *   Return the system time as an NTP timestamp.
+ *
+ ****************************************************************************/
+
+static uint64_t ntpc_localtime(void)
 {
   struct timespec tp;
-  time_t seconds;
-  uint32_t frac;
-  uint32_t nsec;
-#ifdef CONFIG_HAVE_LONG_LONG
-  uint64_t tmp;
+
+  (void)clock_gettime(CLOCK_REALTIME, &tp);
+
+  /* The fraction is nsec * 2**32 / 10**9 */
+
+  return ((uint64_t)tp.tv_sec + NTP2UNIX_TRANLSLATION) << 32 |
+         (((uint64_t)tp.tv_nsec << 32) / NSEC_PER_SEC);
+}
+
+/****************************************************************************
+ * Name: ntpc_diff2nsec
+ *
+ * Description:
+ *   Convert the difference of two NTP timestamps to nanoseconds.
+ *
+ ****************************************************************************/
+
+static int64_t ntpc_diff2nsec(int64_t diff)
+{
+  int64_t sec  = diff >> 32;           /* Rounds toward minus infinity */
+  uint64_t frac = (uint64_t)diff & 0xffffffff;
+
+  return sec * NSEC_PER_SEC + (int64_t)((frac * NSEC_PER_SEC) >> 32);
+}
+
+/****************************************************************************
+ * Name: ntpc_nsec2usec
+ *
+ * Description:
+ *   Convert nanoseconds to microseconds, saturating at the int32_t range.
+ *
+ ****************************************************************************/
+
+static int32_t ntpc_nsec2usec(int64_t nsec)
+{
+  int64_t usec = nsec / NSEC_PER_USEC;
+
+  if (usec > INT32_MAX)
+    {
+      return INT32_MAX;
+    }
+  else if (usec < INT32_MIN)
+    {
+      return INT32_MIN;
+    }
+
+  return (int32_t)usec;
+}
+
+/****************************************************************************
+ * Name: ntpc_isqrt
+ ****************************************************************************/
+
+static uint64_t ntpc_isqrt(uint64_t value)
+{
+  uint64_t root = 0;
+  uint64_t bit  = (uint64_t)1 << 62;
+
+  while (bit > value)
+    {
+      bit >>= 2;
+    }
+
+  while (bit != 0)
+    {
+      if (value >= root + bit)
+        {
+          value -= root + bit;
+          root   = (root >> 1) + bit;
+        }
+      else
+        {
+          root >>= 1;
+        }
+
+      bit >>= 2;
+    }
+
+  return root;
+}
+
+/****************************************************************************
+ * Name: ntpc_adjclock
+ *
+ * Description:
+ *   Add nsec to the system time.
+ *
+ ****************************************************************************/
+
+static void ntpc_adjclock(int64_t nsec)
+{
+  struct timespec tp;
+  int64_t ns;
+
+  (void)clock_gettime(CLOCK_REALTIME, &tp);
+
+  ns          = (int64_t)tp.tv_nsec + nsec % NSEC_PER_SEC;
+  tp.tv_sec  += (time_t)(nsec / NSEC_PER_SEC);
+
+  if (ns < 0)
+    {
+      ns += NSEC_PER_SEC;
+      tp.tv_sec--;
+    }
+  else if (ns >= NSEC_PER_SEC)
+    {
+      ns -= NSEC_PER_SEC;
+      tp.tv_sec++;
+    }
+
+  tp.tv_nsec = (long)ns;
+  (void)clock_settime(CLOCK_REALTIME, &tp);
+}
+
+/****************************************************************************
+ * Name: ntpc_addpeer
+ ****************************************************************************/
+
+static void ntpc_addpeer(in_addr_t addr)
+{
+  FAR struct ntpc_peer_s *peer;
+  int i;
+
+  for (i = 0; i < g_ntpc_clock.npeers; i++)
+    {
+      if (g_ntpc_clock.peers[i].addr.sin_addr.s_addr == addr)
+        {
+          return;
+        }
+    }
+
+  if (g_ntpc_clock.npeers < CONFIG_NETUTILS_NTPCLIENT_MAXSERVERS)
+    {
+      peer = &g_ntpc_clock.peers[g_ntpc_clock.npeers++];
+      memset(peer, 0, sizeof(struct ntpc_peer_s));
+
+      peer->addr.sin_family      = AF_INET;
+      peer->addr.sin_port        = htons(CONFIG_NETUTILS_NTPCLIENT_PORTNO);
+      peer->addr.sin_addr.s_addr = addr;
+    }
+}
+
+/****************************************************************************
+ * Name: ntpc_resolve
+ *
+ * Description:
+ *   Set up the list of servers.  With name resolution, every address of
+ *   every name listed in CONFIG_NETUTILS_NTPCLIENT_SERVER is used, up to
+ *   CONFIG_NETUTILS_NTPCLIENT_MAXSERVERS.
+ *
+ ****************************************************************************/
+
+static int ntpc_resolve(void)
+{
+#ifdef CONFIG_LIBC_NETDB
+  static const char servers[] = CONFIG_NETUTILS_NTPCLIENT_SERVER;
+  char name[sizeof(servers)];
+  FAR struct hostent *he;
+  FAR struct in_addr **addr_list;
+  FAR const char *ptr = servers;
+  size_t len;
+  int i;
+
+  memset(&g_ntpc_clock, 0, sizeof(struct ntpc_clock_s));
+
+  while (*ptr != '\0')
+    {
+      /* Names are separated by semicolons */
+
+      len = strcspn(ptr, ";");
+      memcpy(name, ptr, len);
+      name[len] = '\0';
+      ptr += len;
+      if (*ptr == ';')
+        {
+          ptr++;
+        }
+
+      if (len == 0)
+        {
+          continue;
+        }
+
+      he = gethostbyname(name);
+      if (he == NULL || he->h_addrtype != AF_INET)
+        {
+          nerr("ERROR: Failed to resolve '%s'\n", name);
+          continue;
+        }
+
+      addr_list = (FAR struct in_addr **)he->h_addr_list;
+      for (i = 0; addr_list[i] != NULL; i++)
+        {
+          ninfo("INFO: '%s' resolved to: %s\n",
+                name, inet_ntoa(*addr_list[i]));
+          ntpc_addpeer(addr_list[i]->s_addr);
+        }
+    }
 #else
-  uint32_t a16;
-  uint32_t b0;
-  uint32_t t32;
-  uint32_t t16;
-  uint32_t t0;
+  memset(&g_ntpc_clock, 0, sizeof(struct ntpc_clock_s));
+  ntpc_addpeer(htonl(CONFIG_NETUTILS_NTPCLIENT_SERVERIP));
 #endif
 
-  /* NTP timestamps are represented as a 64-bit fixed-point number, in
-   * seconds relative to 0000 UT on 1 January 1900.  The integer part is
-   * in the first 32 bits and the fraction part in the last 32 bits, as
-   * shown in the following diagram.
-   *
-   *    0                   1                   2                   3
-   *    0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
-   *   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
-   *   |                         Integer Part                          |
-   *   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
-   *   |                         Fraction Part                         |
-   *   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
-   */
+  return g_ntpc_clock.npeers > 0 ? OK : -ENOENT;
+}
 
-  seconds = ntpc_getuint32(timestamp);
+/****************************************************************************
+ * Name: ntpc_filter
+ *
+ * Description:
+ *   Add a sample to the clock filter of a server.  The filter selects the
+ *   stored sample with the lowest round-trip delay, since that one suffered
+ *   least from queuing, and takes the RMS offset difference of all samples
+ *   as the jitter.
+ *
+ ****************************************************************************/
 
-  /* Translate seconds to account for the difference in the origin time */
+static void ntpc_filter(FAR struct ntpc_peer_s *peer, int64_t offset,
+                        int64_t delay)
+{
+  FAR struct ntpc_sample_s *best;
+  uint64_t sum = 0;
+  int64_t diff;
+  int i;
+
+  peer->samples[peer->next].offset = offset;
+  peer->samples[peer->next].delay  = delay;
+  peer->next = (peer->next + 1) % NTP_FILTER_STAGES;
+  if (peer->nsamples < NTP_FILTER_STAGES)
+    {
+      peer->nsamples++;
+    }
 
-  if (seconds > NTP2UNIX_TRANLSLATION)
+  best = &peer->samples[0];
+  for (i = 1; i < peer->nsamples; i++)
     {
-      seconds -= NTP2UNIX_TRANLSLATION;
+      if (peer->samples[i].delay < best->delay)
+        {
+          best = &peer->samples[i];
+        }
     }
 
-  /* Conversion of the fractional part to nanoseconds:
-   *
-   *  NSec = (f * 1,000,000,000) / 4,294,967,296
-   *       = (f * (5**9 * 2**9) / (2**32)
-   *       = (f * 5**9) / (2**23)
-   *       = (f * 1,953,125) / 8,388,608
-   */
+  for (i = 0; i < peer->nsamples; i++)
+    {
+      /* Limit each term to 1000 seconds so the sum cannot overflow */
 
-  frac = ntpc_getuint32(timestamp + 4);
-#ifdef CONFIG_HAVE_LONG_LONG
-  /* if we have 64-bit long long values, then the computation is easy */
+      diff = ntpc_nsec2usec(peer->samples[i].offset - best->offset);
+      diff = diff < 1000000000 ? (diff > -1000000000 ? diff : -1000000000) :
+                                 1000000000;
+      sum += (uint64_t)(diff * diff);
+    }
 
-  tmp  = ((uint64_t)frac * 1953125) >> 23;
-  nsec = (uint32_t)tmp;
+  peer->offset = best->offset;
+  peer->delay  = best->delay;
+  peer->jitter = (int64_t)ntpc_isqrt(sum / peer->nsamples) * NSEC_PER_USEC;
+}
 
-#else
-  /* If we don't have 64 bit integer types, then the calculation is a little
-   * more complex:
-   *
-   * Let f         = a    << 16 + b
-   *     1,953,125 = 0x1d << 16 + 0xcd65
-   * NSec << 23 =  ((a << 16) + b) * ((0x1d << 16) + 0xcd65)
-   *            = (a << 16) * 0x1d << 16) +
-   *              (a << 16) * 0xcd65 +
-   *              b         * 0x1d << 16) +
-   *              b         * 0xcd65;
-   */
+/****************************************************************************
+ * Name: ntpc_rootdist
+ *
+ * Description:
+ *   The distance within which the true offset lies, around the filtered
+ *   offset of a server.
+ *
+ ****************************************************************************/
 
-  /* Break the fractional part up into two values */
+static int64_t ntpc_rootdist(FAR struct ntpc_peer_s *peer)
+{
+  int64_t dist = peer->delay / 2 + peer->jitter;
 
-  a16  = frac >> 16;
-  b0   = frac & 0xffff;
+  return dist > NSEC_PER_USEC ? dist : NSEC_PER_USEC;
+}
 
-  /* Get the b32 and b0 terms
-   *
-   * t32 = (a << 16) * 0x1d << 16)
-   * t0  = b * 0xcd65
-   */
+/****************************************************************************
+ * Name: ntpc_select
+ *
+ * Description:
+ *   Find the largest set of servers whose correctness intervals
+ *   (offset +/- root distance) overlap (Marzullo's algorithm) and mark
+ *   them selected.  The set must contain a majority of the servers that
+ *   answered recently; otherwise no server is selected.
+ *
+ * Returned Value:
+ *   The number of selected servers.
+ *
+ ****************************************************************************/
 
-  t32  = 0x001d * a16;
-  t0   = 0xcd65 * b0;
+static int ntpc_select(void)
+{
+  struct
+  {
+    int64_t edge;
+    int     type;               /* +1: low end, -1: high end */
+  } edges[2 * CONFIG_NETUTILS_NTPCLIENT_MAXSERVERS], tmp;
+  FAR struct ntpc_peer_s *peer;
+  int64_t lo = 0;
+  int64_t hi = 0;
+  int nedges = 0;
+  int ncand;
+  int count = 0;
+  int best = 0;
+  int i;
+  int j;
+
+  for (i = 0; i < g_ntpc_clock.npeers; i++)
+    {
+      peer = &g_ntpc_clock.peers[i];
+      peer->selected = false;
 
-  /* Get the first b16 term
-   *
-   * (a << 16) * 0xcd65
-   */
+      if (peer->reach != 0 && peer->nsamples > 0)
+        {
+          edges[nedges].edge   = peer->offset - ntpc_rootdist(peer);
+          edges[nedges++].type = 1;
+          edges[nedges].edge   = peer->offset + ntpc_rootdist(peer);
+          edges[nedges++].type = -1;
+        }
+    }
 
-  t16  = 0xcd65 * a16;
+  ncand = nedges / 2;
+  if (ncand == 0)
+    {
+      return 0;
+    }
 
-  /* Add the upper 16-bits to the b32 accumulator */
+  /* Sort the edges, low ends first where they coincide */
 
-  t32 += (t16 >> 16);
+  for (i = 1; i < nedges; i++)
+    {
+      tmp = edges[i];
+      for (j = i;
+           j > 0 && (edges[j - 1].edge > tmp.edge ||
+                     (edges[j - 1].edge == tmp.edge &&
+                      edges[j - 1].type < tmp.type));
+           j--)
+        {
+          edges[j] = edges[j - 1];
+        }
 
-  /* Add the lower 16-bits to the b0 accumulator, handling carry to the b32
-   * accumulator
-   */
+      edges[j] = tmp;
+    }
+
+  /* Find the interval covered by the most servers */
+
+  for (i = 0; i < nedges; i++)
+    {
+      count += edges[i].type;
+      if (count > best)
+        {
+          best = count;
+          lo   = edges[i].edge;
+          hi   = edges[i + 1].edge;
+        }
+    }
 
-  t16  <<= 16;
-  if (t0 > (0xffffffff - t16))
+  if (2 * best <= ncand)
     {
-      t32++;
+      nwarn("WARNING: No majority among %d servers\n", ncand);
+      return 0;
     }
 
-  t0 += t16;
+  /* The truechimers are the servers whose intervals contain it */
 
-  /* Get the second b16 term
-   *
-   * b * (0x1d << 16)
-   */
+  for (i = 0; i < g_ntpc_clock.npeers; i++)
+    {
+      peer = &g_ntpc_clock.peers[i];
+      if (peer->reach != 0 && peer->nsamples > 0 &&
+          peer->offset - ntpc_rootdist(peer) <= lo &&
+          peer->offset + ntpc_rootdist(peer) >= hi)
+        {
+          peer->selected = true;
+        }
+    }
 
-  t16  = 0x001d * b0;
+  return best;
+}
+
+/****************************************************************************
+ * Name: ntpc_combine
+ *
+ * Description:
+ *   Average the offsets of the selected servers, each weighted by the
+ *   inverse of its root distance.
+ *
+ ****************************************************************************/
 
-  /* Add the upper 16-bits to the b32 accumulator */
+static int64_t ntpc_combine(void)
+{
+  FAR struct ntpc_peer_s *peer;
+  int64_t base = 0;
+  int64_t sum = 0;
+  int64_t weights = 0;
+  int64_t weight;
+  bool first = true;
+  int i;
+
+  for (i = 0; i < g_ntpc_clock.npeers; i++)
+    {
+      peer = &g_ntpc_clock.peers[i];
+      if (!peer->selected)
+        {
+          continue;
+        }
 
-  t32 += (t16 >> 16);
+      /* Sum in microseconds, relative to the first survivor, so that large
+       * initial offsets cannot overflow.
+       */
 
-  /* Add the lower 16-bits to the b0 accumulator, handling carry to the b32
-   * accumulator
-   */
+      if (first)
+        {
+          base  = peer->offset;
+          first = false;
+        }
+
+      weight   = 1000000 / (ntpc_rootdist(peer) / NSEC_PER_USEC);
+      weight   = weight > 0 ? weight : 1;
+      sum     += ntpc_nsec2usec(peer->offset - base) * weight;
+      weights += weight;
+    }
+
+  return base + sum / weights * NSEC_PER_USEC;
+}
+
+/****************************************************************************
+ * Name: ntpc_update
+ *
+ * Description:
+ *   Select and combine the servers and correct the system clock.  Large
+ *   offsets, and the first one, step the clock.  Smaller ones are slewed
+ *   by ntpc_wait() so that the time never jumps.
+ *
+ ****************************************************************************/
+
+static void ntpc_update(void)
+{
+  int64_t offset;
+  int64_t total;
+  int i;
+  int j;
+
+  g_ntpc_clock.nselected = ntpc_select();
+  if (g_ntpc_clock.nselected == 0)
+    {
+      return;
+    }
+
+  offset = ntpc_combine();
+  total  = offset + g_ntpc_clock.pending;
+
+  g_ntpc_clock.offset = total;
+  g_ntpc_clock.nupdates++;
+
+  if (!g_ntpc_clock.synced ||
+      total >  (int64_t)CONFIG_NETUTILS_NTPCLIENT_STEPMSEC * NSEC_PER_MSEC ||
+      total < -(int64_t)CONFIG_NETUTILS_NTPCLIENT_STEPMSEC * NSEC_PER_MSEC)
+    {
+      sinfo("Stepping the clock by %ld msec\n",
+            (long)(total / NSEC_PER_MSEC));
+
+      ntpc_adjclock(total);
+      g_ntpc_clock.pending = 0;
+      g_ntpc_clock.synced  = true;
+      g_ntpc_clock.nsteps++;
+
+      /* The old samples describe the clock before the step */
+
+      for (i = 0; i < g_ntpc_clock.npeers; i++)
+        {
+          g_ntpc_clock.peers[i].nsamples = 0;
+          g_ntpc_clock.peers[i].next     = 0;
+        }
+    }
+  else
+    {
+      sinfo("Slewing the clock by %ld usec\n", (long)(total / NSEC_PER_USEC));
 
-  t16  <<= 16;
-  if (t0 > (0xffffffff - t16))
+      /* The samples so far are relative to a clock that has not yet been
+       * corrected by 'offset'.
+       */
+
+      g_ntpc_clock.pending = total;
+      for (i = 0; i < g_ntpc_clock.npeers; i++)
+        {
+          FAR struct ntpc_peer_s *peer = &g_ntpc_clock.peers[i];
+
+          for (j = 0; j < peer->nsamples; j++)
+            {
+              peer->samples[j].offset -= offset;
+            }
+
+          peer->offset -= offset;
+        }
+    }
+
+  g_ntpc_clock.lastupdate = (time_t)(ntpc_localtime() >> 32) -
+                            NTP2UNIX_TRANLSLATION;
+}
+
+/****************************************************************************
+ * Name: ntpc_receive
+ *
+ * Description:
+ *   Process one reply.  Replies that do not answer the pending request of
+ *   the server they came from, and replies from unsynchronized servers,
+ *   are ignored.
+ *
+ ****************************************************************************/
+
+static void ntpc_receive(FAR struct ntp_datagram_s *recv,
+                         FAR struct sockaddr_in *from, uint64_t t4)
+{
+  FAR struct ntpc_peer_s *peer;
+  uint64_t t1;
+  uint64_t t2;
+  uint64_t t3;
+  int64_t offset;
+  int64_t delay;
+  int i;
+
+  for (i = 0; i < g_ntpc_clock.npeers; i++)
     {
-      t32++;
+      peer = &g_ntpc_clock.peers[i];
+      if (peer->addr.sin_addr.s_addr == from->sin_addr.s_addr &&
+          peer->addr.sin_port == from->sin_port)
+        {
+          break;
+        }
     }
 
-  t0 += t16;
+  if (i >= g_ntpc_clock.npeers || peer->xmt == 0 ||
+      ntpc_getuint64(recv->origtimestamp) != peer->xmt ||
+      GETMODE(recv->lvm) != NTP_MODE_SERVER ||
+      GETLI(recv->lvm) == NTP_LI_NOSYNC ||
+      recv->stratum == 0 || recv->stratum > NTP_MAXSTRATUM)
+    {
+      sinfo("Ignoring reply\n");
+      return;
+    }
 
-  /* t32 and t0 represent the 64 bit product.  Now shift right by 23 bits to
-   * accomplish the divide by by 2**23.
+  /* T1: request sent, T2: request received by the server, T3: reply sent
+   * by the server, T4: reply received.
+   *
+   *   offset = ((T2 - T1) + (T3 - T4)) / 2
+   *   delay  = (T4 - T1) - (T3 - T2)
    */
 
-  nsec = (t32 << (32 - 23)) + (t0 >> 23);
-#endif
+  t1 = peer->xmt;
+  t2 = ntpc_getuint64(recv->recvtimestamp);
+  t3 = ntpc_getuint64(recv->xmittimestamp);
+  peer->xmt = 0;
 
-  /* Set the system time */
+  offset = (ntpc_diff2nsec((int64_t)(t2 - t1)) +
+            ntpc_diff2nsec((int64_t)(t3 - t4))) / 2;
+  delay  = ntpc_diff2nsec((int64_t)(t4 - t1)) -
+           ntpc_diff2nsec((int64_t)(t3 - t2));
+  if (delay < 0)
+    {
+      delay = 0;
+    }
 
-  tp.tv_sec  = seconds;
-  tp.tv_nsec = nsec;
-  clock_settime(CLOCK_REALTIME, &tp);
+  peer->reach |= 1;
+  ntpc_filter(peer, offset - g_ntpc_clock.pending, delay);
 
-  sinfo("Set time to %lu seconds: %d\n", (unsigned long)tp.tv_sec, ret);
+  sinfo("Server %08lx offset %ld usec delay %ld usec\n",
+        (unsigned long)ntohl(from->sin_addr.s_addr),
+        (long)(offset / NSEC_PER_USEC), (long)(delay / NSEC_PER_USEC));
 }
 
 /****************************************************************************
- * Name: ntpc_daemon
+ * Name: ntpc_poll
  *
  * Description:
- *   This the NTP client daemon.  This is a *very* minimal
- *   implementation! An NTP request is and the system clock is set when the
- *   response is received
+ *   Send a request to every server, then collect the replies until all
+ *   have answered or none arrives for NTP_RECV_TIMEOUT seconds.
+ *
+ * Returned Value:
+ *   OK, or a negated errno value on a socket error that ends the daemon.
  *
  ****************************************************************************/
 
-static int ntpc_daemon(int argc, char **argv)
+static int ntpc_poll(int sd)
 {
-  struct sockaddr_in server;
+  FAR struct ntpc_peer_s *peer;
   struct ntp_datagram_s xmit;
   struct ntp_datagram_s recv;
-  struct timeval tv;
-
-#ifdef CONFIG_LIBC_NETDB
-  struct hostent *he;
-  struct in_addr **addr_list;
-#endif
-
+  struct sockaddr_in from;
   socklen_t socklen;
   ssize_t nbytes;
+  int npending = 0;
+  int errval;
+  int ret;
+  int i;
+
+  for (i = 0; i < g_ntpc_clock.npeers; i++)
+    {
+      peer = &g_ntpc_clock.peers[i];
+      peer->reach <<= 1;
+
+      /* The transmit timestamp comes back as the originate timestamp of
+       * the reply, which pairs the reply with this request.
+       */
+
+      memset(&xmit, 0, sizeof(xmit));
+      xmit.lvm  = MKLVM(0, NTP_VERSION, NTP_MODE_CLIENT);
+      peer->xmt = ntpc_localtime();
+      ntpc_putuint64(xmit.xmittimestamp, peer->xmt);
+
+      ret = sendto(sd, &xmit, sizeof(struct ntp_datagram_s), 0,
+                   (FAR struct sockaddr *)&peer->addr,
+                   sizeof(struct sockaddr_in));
+      if (ret < 0)
+        {
+          errval = errno;
+          peer->xmt = 0;
+
+          if (errval == EINTR)
+            {
+              return -EINTR;
+            }
+
+          /* Unreachable servers are not fatal */
+
+          nwarn("WARNING: sendto() failed: %d\n", errval);
+          continue;
+        }
+
+      npending++;
+    }
+
+  while (npending > 0)
+    {
+      socklen = sizeof(struct sockaddr_in);
+      nbytes  = recvfrom(sd, (FAR void *)&recv, sizeof(struct ntp_datagram_s),
+                         0, (FAR struct sockaddr *)&from, &socklen);
+
+      if (nbytes >= (ssize_t)NTP_DATAGRAM_MINSIZE)
+        {
+          ntpc_receive(&recv, &from, ntpc_localtime());
+
+          for (npending = 0, i = 0; i < g_ntpc_clock.npeers; i++)
+            {
+              if (g_ntpc_clock.peers[i].xmt != 0)
+                {
+                  npending++;
+                }
+            }
+        }
+
+      /* Properly received, short datagrams are simply ignored */
+
+      else if (nbytes < 0)
+        {
+          errval = errno;
+          if (errval == EAGAIN || errval == EWOULDBLOCK)
+            {
+              /* The remaining servers did not answer */
+
+              break;
+            }
+
+          if (errval == EINTR)
+            {
+              return -EINTR;
+            }
+
+          nerr("ERROR: recvfrom() failed: %d\n", errval);
+          return -errval;
+        }
+    }
+
+  for (i = 0; i < g_ntpc_clock.npeers; i++)
+    {
+      g_ntpc_clock.peers[i].xmt = 0;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: ntpc_wait
+ *
+ * Description:
+ *   Wait for the next poll, slewing out any pending correction meanwhile.
+ *   Returns early if a signal is received.
+ *
+ ****************************************************************************/
+
+static void ntpc_wait(int seconds)
+{
+  struct timespec ts;
+  int64_t remaining = (int64_t)seconds * NSEC_PER_SEC;
+  int64_t step;
+
+  while (remaining > 0 && g_ntpc_daemon.state == NTP_RUNNING)
+    {
+      if (g_ntpc_clock.pending == 0)
+        {
+          ts.tv_sec  = (time_t)(remaining / NSEC_PER_SEC);
+          ts.tv_nsec = (long)(remaining % NSEC_PER_SEC);
+          (void)nanosleep(&ts, NULL);
+          return;
+        }
+
+      ts.tv_sec  = 0;
+      ts.tv_nsec = NTP_SLEW_TICK_MSEC * NSEC_PER_MSEC;
+      if (nanosleep(&ts, NULL) < 0)
+        {
+          return;
+        }
+
+      remaining -= NTP_SLEW_TICK_MSEC * NSEC_PER_MSEC;
+
+      /* Apply the next slice of the pending correction */
+
+      step = g_ntpc_clock.pending;
+      if (step > NTP_SLEW_STEP_NSEC)
+        {
+          step = NTP_SLEW_STEP_NSEC;
+        }
+      else if (step < -NTP_SLEW_STEP_NSEC)
+        {
+          step = -NTP_SLEW_STEP_NSEC;
+        }
+
+      ntpc_adjclock(step);
+      g_ntpc_clock.pending -= step;
+    }
+}
+
+/****************************************************************************
+ * Name: ntpc_daemon
+ *
+ * Description:
+ *   This the NTP client daemon.  Each poll queries all servers in
+ *   parallel.  The replies go through a clock filter per server; the
+ *   servers that agree are then combined into one offset, which steps or
+ *   slews the system clock.
+ *
+ ****************************************************************************/
+
+static int ntpc_daemon(int argc, char **argv)
+{
+  struct timeval tv;
   int exitcode = EXIT_SUCCESS;
-  int retry = 0;
   int sd;
   int ret;
 
@@ -340,98 +1042,55 @@ static int ntpc_daemon(int argc, char **argv)
 
   /* Setup a receive timeout on the socket */
 
-  tv.tv_sec  = 5;
+  tv.tv_sec  = NTP_RECV_TIMEOUT;
   tv.tv_usec = 0;
 
   ret = setsockopt(sd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(struct timeval));
   if (ret < 0)
     {
       nerr("ERROR: setsockopt failed: %d\n", errno);
+      close(sd);
 
       g_ntpc_daemon.state = NTP_STOPPED;
       sem_post(&g_ntpc_daemon.interlock);
       return EXIT_FAILURE;
     }
 
-  /* Setup or sockaddr_in struct with information about the server we are
-   * going to ask the time from.
-   */
+  /* Get the addresses of the servers we are going to ask the time from */
 
-  memset(&server, 0, sizeof(struct sockaddr_in));
-  server.sin_family      = AF_INET;
-  server.sin_port        = htons(CONFIG_NETUTILS_NTPCLIENT_PORTNO);
+  sched_lock();
+  ret = ntpc_resolve();
+  sched_unlock();
 
-#ifndef CONFIG_LIBC_NETDB
-  server.sin_addr.s_addr = htonl(CONFIG_NETUTILS_NTPCLIENT_SERVERIP);
-#else
-  he = gethostbyname(CONFIG_NETUTILS_NTPCLIENT_SERVER);
-  if (he != NULL && he->h_addrtype == AF_INET)
-    {
-      addr_list = (struct in_addr **)he->h_addr_list;
-      server.sin_addr.s_addr = addr_list[0]->s_addr;
-      ninfo("INFO: '%s' resolved to: %s\n",
-            CONFIG_NETUTILS_NTPCLIENT_SERVER,
-            inet_ntoa(server.sin_addr));
-    }
-  else
+  if (ret < 0)
     {
-      nerr("ERROR: Failed to resolve '%s'\n", CONFIG_NETUTILS_NTPCLIENT_SERVER);
+      nerr("ERROR: No NTP server\n");
+      close(sd);
+
+      g_ntpc_daemon.state = NTP_STOPPED;
+      sem_post(&g_ntpc_daemon.interlock);
       return EXIT_FAILURE;
     }
-#endif
 
-  /* Here we do the communication with the NTP server.  This is a very simple
-   * client architecture.  A request is sent and then a NTP packet is received
-   * and used to set the current time.
+  /* NOTE that the scheduler is locked whenever this loop runs.  That
+   * assures: (1) that there are no asynchronous stop requests, (2) that we
+   * are not suspended while in critical moments when we about to set the
+   * new time, and (3) that ntpc_status() always sees consistent data.  This
+   * sounds harsh, but this function is suspended most of the time either:
+   * (1) sending a datagram, (2) receiving a datagram, or (3) waiting for
+   * the next poll cycle.
    *
-   * NOTE that the scheduler is locked whenever this loop runs.  That
-   * assures both:  (1) that there are no asynchronous stop requests and
-   * (2) that we are not suspended while in critical moments when we about
-   * to set the new time.  This sounds harsh, but this function is suspended
-   * most of the time either: (1) sending a datagram, (2) receiving a datagram,
-   * or (3) waiting for the next poll cycle.
-   *
-   * TODO: The first datagram that is sent is usually lost.  That is because
-   * the MAC address of the NTP server is not in the ARP table.  This is
-   * particularly bad here because the request will not be sent again until
-   * the long delay expires leaving the system with bad time for a long time
-   * initially.  Solutions:
-   *
-   * 1. Fix send logic so that it assures that the ARP request has been
-   *    sent and the entry is in the ARP table before sending the packet
-   *    (best).
-   * 2. Add some ad hoc logic here so that there is no delay until at least
-   *    one good time is received.
+   * The first datagram that is sent is often lost while the MAC address of
+   * the server is resolved.  Until the clock has been set, the poll is
+   * repeated after only NTP_STARTUP_DELAYSEC seconds.
    */
 
   sched_lock();
   while (g_ntpc_daemon.state != NTP_STOP_REQUESTED)
     {
-      /* Format the transmit datagram */
-
-      memset(&xmit, 0, sizeof(xmit));
-      xmit.lvm = MKLVM(0, 3, NTP_VERSION);
-
-      sinfo("Sending a NTP packet\n");
-
-      ret = sendto(sd, &xmit, sizeof(struct ntp_datagram_s),
-                   0, (FAR struct sockaddr *)&server,
-                   sizeof(struct sockaddr_in));
-
-      if (ret < 0)
+      ret = ntpc_poll(sd);
+      if (ret == -EINTR)
         {
-          /* Check if we received a signal.  That is not an error but
-           * other error events will terminate the client.
-           */
-
-          int errval = errno;
-          if (errval != EINTR)
-            {
-              nerr("ERROR: sendto() failed: %d\n", errval);
-              exitcode = EXIT_FAILURE;
-              break;
-            }
-
           /* Go back to the top of the loop if we were interrupted
            * by a signal.  The signal might mean that we were
            * requested to stop(?)
@@ -439,70 +1098,29 @@ static int ntpc_daemon(int argc, char **argv)
 
           continue;
         }
-
-      /* Attempt to receive a packet (with a timeout that was set up via
-       * setsockopt() above)
-       */
-
-      socklen = sizeof(struct sockaddr_in);
-      nbytes = recvfrom(sd, (void *)&recv, sizeof(struct ntp_datagram_s),
-                        0, (FAR struct sockaddr *)&server, &socklen);
-
-      /* Check if the received message was long enough to be a valid NTP
-       * datagram.
-       */
-
-      if (nbytes >= (ssize_t)NTP_DATAGRAM_MINSIZE)
+      else if (ret < 0)
         {
-          sinfo("Setting time\n");
-          ntpc_settime(recv.recvtimestamp);
-          retry = 0;
+          exitcode = EXIT_FAILURE;
+          break;
         }
 
-      /* Check for errors.  Note that properly received, short datagrams
-       * are simply ignored.
-       */
-
-      else if (nbytes < 0)
-        {
-          /* Check if we received a signal.  That is not an error but
-           * other error events will terminate the client.
-           */
-
-          int errval = errno;
-          if (errval != EINTR)
-            {
-              /* Allow up to three retries */
-
-              if (++retry < 3)
-                {
-                  continue;
-                }
-
-              /* Then declare the failure */
-
-              nerr("ERROR: recvfrom() failed: %d\n", errval);
-              exitcode = EXIT_FAILURE;
-              break;
-            }
-        }
-
-      /* A full implementation of an NTP client would require much more.  I
-       * think we can skip most of that here.
-       */
+      ntpc_update();
 
       if (g_ntpc_daemon.state == NTP_RUNNING)
         {
-          sinfo("Waiting for %d seconds\n",
-                CONFIG_NETUTILS_NTPCLIENT_POLLDELAYSEC);
+          int delay = g_ntpc_clock.synced ?
+                      CONFIG_NETUTILS_NTPCLIENT_POLLDELAYSEC :
+                      NTP_STARTUP_DELAYSEC;
 
-          (void)sleep(CONFIG_NETUTILS_NTPCLIENT_POLLDELAYSEC);
+          sinfo("Waiting for %d seconds\n", delay);
+          ntpc_wait(delay);
         }
     }
 
   /* The NTP client is terminating */
 
   sched_unlock();
+  close(sd);
 
   g_ntpc_daemon.state = NTP_STOPPED;
   sem_post(&g_ntpc_daemon.interlock);
@@ -629,3 +1247,59 @@ int ntpc_stop(void)
   return OK;
 }
 #endif
+
+/****************************************************************************
+ * Name: ntpc_status
+ *
+ * Description:
+ *   Get a snapshot of the synchronization state: the last combined offset,
+ *   the correction still being slewed and, for each server, the
+ *   reachability and the filtered offset, delay and jitter.
+ *
+ * Input Parameters:
+ *   status - The location to return the snapshot
+ *
+ * Returned Value:
+ *   Zero on success; -ESRCH if the NTP daemon is not running.
+ *
+ ****************************************************************************/
+
+int ntpc_status(FAR struct ntpc_status_s *status)
+{
+  FAR struct ntpc_peer_s *peer;
+  int ret = -ESRCH;
+  int i;
+
+  memset(status, 0, sizeof(struct ntpc_status_s));
+
+  sched_lock();
+  if (g_ntpc_daemon.state == NTP_RUNNING)
+    {
+      status->synced     = g_ntpc_clock.synced;
+      status->nservers   = g_ntpc_clock.npeers;
+      status->nselected  = g_ntpc_clock.nselected;
+      status->offset     = ntpc_nsec2usec(g_ntpc_clock.offset);
+      status->pending    = ntpc_nsec2usec(g_ntpc_clock.pending);
+      status->nupdates   = g_ntpc_clock.nupdates;
+      status->nsteps     = g_ntpc_clock.nsteps;
+      status->lastupdate = g_ntpc_clock.lastupdate;
+
+      for (i = 0; i < g_ntpc_clock.npeers; i++)
+        {
+          peer = &g_ntpc_clock.peers[i];
+
+          status->server[i].addr     = peer->addr.sin_addr.s_addr;
+          status->server[i].reach    = peer->reach;
+          status->server[i].selected = peer->selected;
+          status->server[i].nsamples = peer->nsamples;
+          status->server[i].offset   = ntpc_nsec2usec(peer->offset);
+          status->server[i].delay    = ntpc_nsec2usec(peer->delay);
+          status->server[i].jitter   = ntpc_nsec2usec(peer->jitter);
+        }
+
+      ret = OK;
+    }
+
+  sched_unlock();
+  return ret;
+}
@@ -37,19 +37,27 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
 #include <sys/socket.h>
-#include <signal.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
 #include <time.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <netinet/in.h>
+#include <nuttx/net/icmp.h>
 
-#include <arpa/inet.h>
+#include "netutils/icmp_ping.h"
 
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
 
-#define ICMPBUF ((struct icmp_iphdr_s *)&dev->d_buf[NET_LL_HDRLEN(dev)])
-#define ICMPDAT (&dev->d_buf[NET_LL_HDRLEN(dev) + sizeof(struct icmp_iphdr_s)])
-
 /* Use the monotonic clock if it is available */
 
 #ifdef CONFIG_CLOCK_MONOTONIC
@@ -58,258 +66,430 @@
 #  define PING_CLOCK  CLOCK_REALTIME
 #endif
 
-#ifndef CONFIG_NETUTILS_PING_SIGNO
-#  define CONFIG_NETUTILS_PING_SIGNO 13
-#endif
+/* Each ECHO request carries a small header in its payload that lets the
+ * reply be matched without any per-request state:  the send time, the
+ * index of the host and the round, followed by a recognizable pattern.
+ */
 
+#define PING_STAMPLEN     8
 #define ICMP_DATALEN      56
-#define IPv4_PAYLOAD_SIZE (ICMP_HDRLEN + ICMP_DATALEN)
-#define PING_BUFFER_SIZE  (IPv4_HDRLEN + IPv4_PAYLOAD_SIZE)
+#define PING_PKTLEN       (sizeof(struct icmp_hdr_s) + ICMP_DATALEN)
+
+/* Replies are only accepted for the last 32 rounds (see recvmask) */
+
+#define PING_MAXAGE       32
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* NOTE: This will not work in the kernel build where there will be a
+ * separate instance of g_pingid in every process space.
+ */
+
+static uint16_t g_pingid;
 
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
 /****************************************************************************
- * Name: icmpv6_echo_request
+ * Name: ping_usec
  *
  * Description:
- *   Setup to send an ICMP packet
- *
- * Input Parameters:
- *   
- *
- * Return:
- *   None
+ *   Return the current time in microseconds.  The value wraps every 71
+ *   minutes so it may only be used in differences.
  *
  ****************************************************************************/
 
-static void icmp_echo_request(FAR struct net_driver_s *dev,
-                              FAR in_addr_t *destaddr)
+static uint32_t ping_usec(void)
 {
-  FAR struct icmp_iphdr_s *picmp = ICMPBUF;
-  FAR uint8_t *ptr;
-  size_t sendlen;
-  size_t icmplen;
-  size_t pktlen;
-  int i;
+  struct timespec ts;
 
-  /* The total length to send is the size of the application data plus the
-   * IPv4 and ICMP headers (and, eventually, the Ethernet header)
-   */
+  (void)clock_gettime(PING_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000000 + (uint32_t)(ts.tv_nsec / 1000);
+}
 
-  pktlen = IPv4_PAYLOAD_SIZE + IPICMP_HDRLEN;
+/****************************************************************************
+ * Name: ping_isqrt
+ ****************************************************************************/
 
-  /* The total size of the data (for ICMP checksum calculation) includes the
-   * size of the ICMP header
-   */
+static uint32_t ping_isqrt(uint64_t value)
+{
+  uint64_t root = 0;
+  uint64_t bit  = (uint64_t)1 << 62;
 
-  icmplen = IPv4_PAYLOAD_SIZE + ICMP_HDRLEN;
+  while (bit > value)
+    {
+      bit >>= 2;
+    }
 
-  /* Initialize the IP header. */
+  while (bit != 0)
+    {
+      if (value >= root + bit)
+        {
+          value -= root + bit;
+          root   = (root >> 1) + bit;
+        }
+      else
+        {
+          root >>= 1;
+        }
 
-  picmp->vhl         = 0x45;
-  picmp->tos         = 0;
-  picmp->len[0]      = (pktlen >> 8);
-  picmp->len[1]      = (pktlen & 0xff);
-  ++g_ipid;
-  picmp->ipid[0]     = g_ipid >> 8;
-  picmp->ipid[1]     = g_ipid & 0xff;
-  picmp->ipoffset[0] = IP_FLAG_DONTFRAG >> 8;
-  picmp->ipoffset[1] = IP_FLAG_DONTFRAG & 0xff;
-  picmp->ttl         = IP_TTL;
-  picmp->proto       = IP_PROTO_ICMP;
+      bit >>= 2;
+    }
 
-  net_ipv4addr_hdrcopy(picmp->srcipaddr, &dev->d_ipaddr);
-  net_ipv4addr_hdrcopy(picmp->destipaddr, destaddr);
+  return (uint32_t)root;
+}
 
-  /* Format the ICMP ECHO request packet */
+/****************************************************************************
+ * Name: ping_send
+ *
+ * Description:
+ *   Send the ECHO request of one round to one host.
+ *
+ ****************************************************************************/
+
+static void ping_send(int sockfd, FAR struct icmp_pinghost_s *host,
+                      uint16_t id, uint16_t index, uint16_t round,
+                      FAR uint8_t *buffer)
+{
+  FAR struct icmp_hdr_s *hdr = (FAR struct icmp_hdr_s *)buffer;
+  FAR uint8_t *ptr = &buffer[sizeof(struct icmp_hdr_s)];
+  struct sockaddr_in destaddr;
+  uint32_t now;
+  ssize_t nsent;
+  int i;
 
-  picmp->type  = ICMP_ECHO_REQUEST;
-  picmp->icode = 0;
-  picmp->id    = htons(pstate->png_id);
-  picmp->seqno = htons(pstate->png_seqno);
+  memset(hdr, 0, sizeof(struct icmp_hdr_s));
+  hdr->type  = ICMP_ECHO_REQUEST;
+  hdr->id    = id;
+  hdr->seqno = round;
 
-  /* Insert some recognizable data into the packet */
+  now = ping_usec();
+  memcpy(&ptr[0], &now, 4);
+  memcpy(&ptr[4], &index, 2);
+  memcpy(&ptr[6], &round, 2);
 
-  for (i = 0, ptr = ICMPDAT; i < ICMP_DATALEN; i++)
+  for (i = PING_STAMPLEN; i < ICMP_DATALEN; i++)
     {
-      *ptr++ = i;
+      ptr[i] = i;
     }
 
-  /* Calculate IP checksum. */
+  memset(&destaddr, 0, sizeof(struct sockaddr_in));
+  destaddr.sin_family      = AF_INET;
+  destaddr.sin_addr.s_addr = host->addr.s_addr;
 
-  picmp->ipchksum    = 0;
-  picmp->ipchksum    = ~(ipv4_chksum(dev));
+  /* A request that cannot be sent is simply lost */
 
-  /* Calculate the ICMP checksum. */
+  host->nsent++;
+  host->recvmask <<= 1;
 
-  picmp->icmpchksum  = 0;
-  picmp->icmpchksum  = ~(icmp_chksum(dev, icmplen));
-  if (picmp->icmpchksum == 0)
+  nsent = sendto(sockfd, buffer, PING_PKTLEN, 0,
+                 (FAR struct sockaddr *)&destaddr,
+                 sizeof(struct sockaddr_in));
+  if (nsent < 0)
     {
-      picmp->icmpchksum = 0xffff;
+      nerr("ERROR: sendto failed: %d\n", errno);
     }
 }
 
-static void ping_timeout(int signo, FAR siginfo_t *info, FAR void *arg)
-{
-  FAR bool *timeout = (FAR bool *)arg;
-  *timeout = true;
-}
+/****************************************************************************
+ * Name: ping_recv
+ *
+ * Description:
+ *   Receive one reply and credit it to the host and round that it
+ *   answers.
+ *
+ * Returned Value:
+ *   One if a new reply was counted, zero if the packet was ignored, or a
+ *   negated errno value if the socket failed.
+ *
+ ****************************************************************************/
 
-int ipv4_ping(FAR struct sockaddr_in *raddr,
-              FAR const struct timespec *timeout,
-              FAR struct timespec *roundtrip)
+static int ping_recv(int sockfd, FAR struct icmp_pinghost_s *hosts,
+                     int nhosts, uint16_t id, uint16_t round,
+                     FAR uint8_t *buffer)
 {
-  FAR struct icmp *icmpv4;
-  struct sigevent notify;
-  struct sigaction act;
-  struct sigaction oact;
-  struct itimerspec value;
-  struct itimerspec ovalue;
-  char buffer[PING_BUFFER_SIZE]; /* Kind of big to be on the stack */
-  timer_t timerid;
+  FAR struct icmp_hdr_s *hdr = (FAR struct icmp_hdr_s *)buffer;
+  FAR uint8_t *ptr = &buffer[sizeof(struct icmp_hdr_s)];
+  FAR struct icmp_pinghost_s *host;
+  struct sockaddr_in fromaddr;
+  socklen_t addrlen;
   ssize_t nrecvd;
-  bool timeout;
-  int errcode;
-  int ret;
-  int sd;
+  uint32_t sendtime;
+  uint32_t rtt;
+  uint32_t msec;
+  uint16_t index;
+  uint16_t sentround;
+  uint16_t age;
+  int bucket;
+  int i;
 
-  DEBUGASSERT(raddr != NULL);
+  addrlen = sizeof(struct sockaddr_in);
+  nrecvd  = recvfrom(sockfd, buffer, PING_PKTLEN, 0,
+                     (FAR struct sockaddr *)&fromaddr, &addrlen);
+  rtt     = ping_usec();
 
-  /* Allocate a POSIX timer */
+  if (nrecvd < 0)
+    {
+      return errno == EINTR ? 0 : -errno;
+    }
+
+  if (nrecvd != PING_PKTLEN || hdr->type != ICMP_ECHO_REPLY ||
+      hdr->id != id)
+    {
+      return 0;
+    }
 
-  timeout                      = false;
-  notify.sigev_notify          = SIGEV_SIGNAL;
-  notify.sigev_signo           = CONFIG_NETUTILS_PING_SIGNO;
-  notify.sigev_value.sival_ptr = (FAR void *)&timeout;
+  memcpy(&sendtime, &ptr[0], 4);
+  memcpy(&index, &ptr[4], 2);
+  memcpy(&sentround, &ptr[6], 2);
 
-  ret = timer_create(PING_CLOCK, &notify, &timerid);
-  if (ret < 0)
+  if (index >= nhosts || sentround != hdr->seqno ||
+      hosts[index].addr.s_addr != fromaddr.sin_addr.s_addr)
     {
-      errcode = errno;
-      DEBUGASSERT(errno > 0);
-      return -errcode;
+      return 0;
     }
 
-  /* Attach a signal handler */
+  for (i = PING_STAMPLEN; i < ICMP_DATALEN; i++)
+    {
+      if (ptr[i] != (uint8_t)i)
+        {
+          return 0;
+        }
+    }
 
-  act.sa_sigaction = ping_timeout;
-  act.sa_flags     = SA_SIGINFO;
+  /* Accept each request's reply once */
 
-  (void)sigfillset(&act.sa_mask);
-  (void)sigdelset(&act.sa_mask, CONFIG_NETUTILS_PING_SIGNO);
+  host = &hosts[index];
+  age  = round - sentround;
+  if (age >= PING_MAXAGE)
+    {
+      return 0;
+    }
 
-  ret = sigaction(CONFIG_NETUTILS_PING_SIGNO, &act, &oact);
-  if (ret < 0)
+  if ((host->recvmask & (1ul << age)) != 0)
     {
-      errcode = errno;
-      DEBUGASSERT(errno > 0);
-      ret = -errcode;
-      goto errout_with_timer;
+      host->ndup++;
+      return 0;
     }
 
-  /* Create the raw socket */
+  host->recvmask |= 1ul << age;
+  host->nrecvd++;
 
-  sd = socket(AF_INET, SOCK_RAW, IPPROTO_ICMP);
-  if (sd < 0)
+  rtt -= sendtime;
+  if (host->nrecvd == 1 || rtt < host->min)
     {
-      errcode = errno;
-      DEBUGASSERT(errno > 0);
-      ret = -errcode;
-      goto errout_with_sigaction;
+      host->min = rtt;
     }
 
-  /* Format and send the ECHO request */
+  if (rtt > host->max)
+    {
+      host->max = rtt;
+    }
 
-  icmpv6_echo_request(dev, destaddr);
+  host->sum   += rtt;
+  host->sumsq += (uint64_t)rtt * rtt;
+
+  for (bucket = 0, msec = rtt / 1000;
+       msec != 0 && bucket < ICMP_PING_NBUCKETS - 1;
+       msec >>= 1)
+    {
+      bucket++;
+    }
 
-  ret = sendto(sd, buffer, PING6_BUFFER_SIZE, &raddr,
-               sizeof(struct sockaddr_in));
+  host->hist[bucket]++;
+  return 1;
+}
 
-  if (ret < 0)
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: icmp_pinghosts
+ *
+ * Description:
+ *   Ping many hosts at once.  See include/netutils/icmp_ping.h.
+ *
+ ****************************************************************************/
+
+int icmp_pinghosts(FAR struct icmp_pinghost_s *hosts, int nhosts,
+                   int count, int interval, int timeout)
+{
+  uint8_t buffer[PING_PKTLEN];
+  struct pollfd fds;
+  uint32_t deadline;
+  int32_t remaining;
+  int outstanding;
+  uint16_t round;
+  uint16_t id;
+  int sockfd;
+  int ret;
+  int i;
+
+  if (hosts == NULL || nhosts < 1 || nhosts > UINT16_MAX ||
+      count < 1 || count > UINT16_MAX || interval < 0 || timeout < 0)
     {
-      errcode = errno;
-      DEBUGASSERT(errno > 0);
-      ret = -errcode;
-      goto errout_with_socket;
+      return -EINVAL;
     }
 
-  /* Start the timer */
+  for (i = 0; i < nhosts; i++)
+    {
+      struct in_addr addr = hosts[i].addr;
 
-  value.it_value.tv_sec     = timeout->tv_sec;
-  value.it_value.tv_nsec    = timeout->tv_nsec;
-  value.it_interval.tv_sec  = 0;
-  value.it_interval.tv_nsec = 0;
+      memset(&hosts[i], 0, sizeof(struct icmp_pinghost_s));
+      hosts[i].addr = addr;
+    }
 
-  ret = timer_settime(timerid, 0, &value, NULL);
-  if (ret < 0)
+  sockfd = socket(AF_INET, SOCK_DGRAM, IPPROTO_ICMP);
+  if (sockfd < 0)
     {
-      errcode = errno;
-      DEBUGASSERT(errno > 0);
-      ret = -errcode;
-      goto errout_with_socket;
+      ret = -errno;
+      nerr("ERROR: socket failed: %d\n", ret);
+      return ret;
     }
 
-  /* Wait for the echo reply */
+  /* The ICMP socket only delivers replies that carry our ID */
+
+  id          = ++g_pingid;
+  outstanding = 0;
+  ret         = OK;
 
-  for (; ; )
+  for (round = 0; round < count; round++)
     {
-      nrecvd = recv(sd, buffer, PING_BUFFER_SIZE, 0);
-      if (nrecvd < 0)
+      for (i = 0; i < nhosts; i++)
         {
-          if (errno != EINTR)
-            {
-              int errcode = errno;
-              DEBUGASSERT(errno > 0);
+          ping_send(sockfd, &hosts[i], id, i, round, buffer);
+        }
 
-              nerr("ERROR: recv failed: %d\n", errcode);
-              ret = -errcode;
+      outstanding += nhosts;
+
+      /* Collect replies until the next round is due or, after the last
+       * round, until all are in or the timeout expires.
+       */
+
+      deadline = ping_usec() +
+                 1000 * (uint32_t)(round + 1 < count ? interval : timeout);
+
+      for (; ; )
+        {
+          if (round + 1 >= count && outstanding <= 0)
+            {
               break;
             }
-        }
-      else if (nrecvd >= PING_BUFFER_SIZE)
-        {
-          FAR struct iphdr *iphdr = (FAR struct iphdr *)buffer;
 
-          icmpv4 = (FAR struct icmp *)(buffer + (iphdr->ihl << 2));  /* skip ip hdr */
-          if (icmpv4->icmp_type == ICMP_ECHO_REPLY)
+          remaining = (int32_t)(deadline - ping_usec());
+          if (remaining <= 0)
             {
-              ret = OK;
               break;
             }
+
+          fds.fd      = sockfd;
+          fds.events  = POLLIN;
+          fds.revents = 0;
+
+          ret = poll(&fds, 1, (remaining + 999) / 1000);
+          if (ret < 0)
+            {
+              if (errno == EINTR)
+                {
+                  continue;
+                }
+
+              ret = -errno;
+              nerr("ERROR: poll failed: %d\n", ret);
+              goto errout;
+            }
+          else if (ret > 0)
+            {
+              ret = ping_recv(sockfd, hosts, nhosts, id, round, buffer);
+              if (ret < 0)
+                {
+                  nerr("ERROR: recvfrom failed: %d\n", ret);
+                  goto errout;
+                }
+
+              outstanding -= ret;
+            }
         }
     }
 
-  /* Stop the timer */
+  ret = OK;
 
-  value.it_value.tv_sec     = 0;
-  value.it_value.tv_nsec    = 0;
-  value.it_interval.tv_sec  = 0;
-  value.it_interval.tv_nsec = 0;
+errout:
+  close(sockfd);
+  return ret;
+}
 
-  (void)timer_settime(timerid, 0, &value, &ovalue);
-  if (ret < 0)
+/****************************************************************************
+ * Name: icmp_pingavg
+ ****************************************************************************/
+
+uint32_t icmp_pingavg(FAR const struct icmp_pinghost_s *host)
+{
+  return host->nrecvd > 0 ? (uint32_t)(host->sum / host->nrecvd) : 0;
+}
+
+/****************************************************************************
+ * Name: icmp_pingstddev
+ ****************************************************************************/
+
+uint32_t icmp_pingstddev(FAR const struct icmp_pinghost_s *host)
+{
+  uint64_t mean;
+  uint64_t meansq;
+
+  if (host->nrecvd < 2)
     {
-      errcode = errno;
-      DEBUGASSERT(errno > 0);
-      ret = -errcode;
+      return 0;
     }
-  else
+
+  mean   = host->sum / host->nrecvd;
+  meansq = host->sumsq / host->nrecvd;
+
+  return meansq > mean * mean ? ping_isqrt(meansq - mean * mean) : 0;
+}
+
+/****************************************************************************
+ * Name: ipv4_ping
+ *
+ * Description:
+ *   Send one ECHO request and wait for the reply.  See
+ *   include/netutils/icmp_ping.h.
+ *
+ ****************************************************************************/
+
+int ipv4_ping(FAR struct sockaddr_in *raddr,
+              FAR const struct timespec *timeout,
+              FAR struct timespec *roundtrip)
+{
+  struct icmp_pinghost_s host;
+  int msec;
+  int ret;
+
+  DEBUGASSERT(raddr != NULL && timeout != NULL);
+
+  host.addr = raddr->sin_addr;
+  msec      = timeout->tv_sec * 1000 + timeout->tv_nsec / 1000000;
+
+  ret = icmp_pinghosts(&host, 1, 1, 0, msec);
+  if (ret < 0)
     {
-      rountrip->tv_sec  = ovalue.it_value.tv_sec;
-      rountrip->tv_nsec = ovalue.it_value.tv_nsec;
-      ret = OK;
+      return ret;
     }
 
-errout_with_socket:
-  close(sd);
+  if (host.nrecvd == 0)
+    {
+      return -ETIMEDOUT;
+    }
 
-errout_with_sigaction:
-  (void) sigaction(CONFIG_NETUTILS_PING_SIGNO, &oact, NULL);
+  if (roundtrip != NULL)
+    {
+      roundtrip->tv_sec  = host.sum / 1000000;
+      roundtrip->tv_nsec = (host.sum % 1000000) * 1000;
+    }
 
-errout_with_timer:
-  timer_delete(timerid);
-  return ret;
+  return OK;
 }
@@ -42,6 +42,10 @@
  * Included Files
  ****************************************************************************/
 
+#include <string.h>
+
+#include "system/perfcount.h"
+
 #include "ppp_conf.h"
 #include "ppp.h"
 
@@ -71,33 +75,241 @@
 #define AHDLC_PFC            0x10
 #define AHDLC_ACFC           0x20
 
+/* Framing characters */
+
+#define AHDLC_FLAG           0x7e
+#define AHDLC_ESC            0x7d
+
+/* Table-driven FCS-16 (RFC 1662, appendix C.2) */
+
+#define FCS16(fcs, c)        (((fcs) >> 8) ^ g_fcstab[((fcs) ^ (c)) & 0xff])
+
+/* Test a character against a 256-bit escape map */
+
+#define AHDLC_MUST_ESCAPE(map, c) (((map)[(c) >> 3] & (1 << ((c) & 7))) != 0)
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Counters in the performance counter registry */
+
+PERF_COUNTER(g_perf_rxframes, "pppd.rxframes");
+PERF_COUNTER(g_perf_rxbytes, "pppd.rxbytes");
+PERF_COUNTER(g_perf_crcerrors, "pppd.crcerrors");
+PERF_COUNTER(g_perf_txframes, "pppd.txframes");
+PERF_COUNTER(g_perf_txbytes, "pppd.txbytes");
+
+static const u16_t g_fcstab[256] =
+{
+  0x0000, 0x1189, 0x2312, 0x329b, 0x4624, 0x57ad, 0x6536, 0x74bf,
+  0x8c48, 0x9dc1, 0xaf5a, 0xbed3, 0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
+  0x1081, 0x0108, 0x3393, 0x221a, 0x56a5, 0x472c, 0x75b7, 0x643e,
+  0x9cc9, 0x8d40, 0xbfdb, 0xae52, 0xdaed, 0xcb64, 0xf9ff, 0xe876,
+  0x2102, 0x308b, 0x0210, 0x1399, 0x6726, 0x76af, 0x4434, 0x55bd,
+  0xad4a, 0xbcc3, 0x8e58, 0x9fd1, 0xeb6e, 0xfae7, 0xc87c, 0xd9f5,
+  0x3183, 0x200a, 0x1291, 0x0318, 0x77a7, 0x662e, 0x54b5, 0x453c,
+  0xbdcb, 0xac42, 0x9ed9, 0x8f50, 0xfbef, 0xea66, 0xd8fd, 0xc974,
+  0x4204, 0x538d, 0x6116, 0x709f, 0x0420, 0x15a9, 0x2732, 0x36bb,
+  0xce4c, 0xdfc5, 0xed5e, 0xfcd7, 0x8868, 0x99e1, 0xab7a, 0xbaf3,
+  0x5285, 0x430c, 0x7197, 0x601e, 0x14a1, 0x0528, 0x37b3, 0x263a,
+  0xdecd, 0xcf44, 0xfddf, 0xec56, 0x98e9, 0x8960, 0xbbfb, 0xaa72,
+  0x6306, 0x728f, 0x4014, 0x519d, 0x2522, 0x34ab, 0x0630, 0x17b9,
+  0xef4e, 0xfec7, 0xcc5c, 0xddd5, 0xa96a, 0xb8e3, 0x8a78, 0x9bf1,
+  0x7387, 0x620e, 0x5095, 0x411c, 0x35a3, 0x242a, 0x16b1, 0x0738,
+  0xffcf, 0xee46, 0xdcdd, 0xcd54, 0xb9eb, 0xa862, 0x9af9, 0x8b70,
+  0x8408, 0x9581, 0xa71a, 0xb693, 0xc22c, 0xd3a5, 0xe13e, 0xf0b7,
+  0x0840, 0x19c9, 0x2b52, 0x3adb, 0x4e64, 0x5fed, 0x6d76, 0x7cff,
+  0x9489, 0x8500, 0xb79b, 0xa612, 0xd2ad, 0xc324, 0xf1bf, 0xe036,
+  0x18c1, 0x0948, 0x3bd3, 0x2a5a, 0x5ee5, 0x4f6c, 0x7df7, 0x6c7e,
+  0xa50a, 0xb483, 0x8618, 0x9791, 0xe32e, 0xf2a7, 0xc03c, 0xd1b5,
+  0x2942, 0x38cb, 0x0a50, 0x1bd9, 0x6f66, 0x7eef, 0x4c74, 0x5dfd,
+  0xb58b, 0xa402, 0x9699, 0x8710, 0xf3af, 0xe226, 0xd0bd, 0xc134,
+  0x39c3, 0x284a, 0x1ad1, 0x0b58, 0x7fe7, 0x6e6e, 0x5cf5, 0x4d7c,
+  0xc60c, 0xd785, 0xe51e, 0xf497, 0x8028, 0x91a1, 0xa33a, 0xb2b3,
+  0x4a44, 0x5bcd, 0x6956, 0x78df, 0x0c60, 0x1de9, 0x2f72, 0x3efb,
+  0xd68d, 0xc704, 0xf59f, 0xe416, 0x90a9, 0x8120, 0xb3bb, 0xa232,
+  0x5ac5, 0x4b4c, 0x79d7, 0x685e, 0x1ce1, 0x0d68, 0x3ff3, 0x2e7a,
+  0xe70e, 0xf687, 0xc41c, 0xd595, 0xa12a, 0xb0a3, 0x8238, 0x93b1,
+  0x6b46, 0x7acf, 0x4854, 0x59dd, 0x2d62, 0x3ceb, 0x0e70, 0x1ff9,
+  0xf78f, 0xe606, 0xd49d, 0xc514, 0xb1ab, 0xa022, 0x92b9, 0x8330,
+  0x7bc7, 0x6a4e, 0x58d5, 0x495c, 0x3de3, 0x2c6a, 0x1ef1, 0x0f78
+};
+
+/* LCP frames are always sent with every control character escaped */
+
+static const u8_t g_lcp_escape_map[32] =
+{
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60
+};
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
 /****************************************************************************
- * Simple and fast CRC16 routine for embedded processors.
+ * ahdlc_tx_flush() - write the encoded part of the TX frame to the serial
+ *    device.
  *
- *    Just slightly slower than the table lookup method but consumes
- *    almost no space.  Much faster and smaller than the loop and
- *    shift method that is widely used in the embedded space.
- *    Can be optimized even more in .ASM
+ ****************************************************************************/
+
+static void ahdlc_tx_flush(struct ppp_context_s *ctx)
+{
+  if (ctx->ahdlc_tx_len > 0)
+    {
+      ppp_arch_write(ctx, ctx->ahdlc_tx_buffer, ctx->ahdlc_tx_len);
+      ctx->ahdlc_tx_len = 0;
+    }
+}
+
+/****************************************************************************
+ * ahdlc_tx_encode(map, data, len) - add the FCS of a block to the TX CRC
+ *    and append it to the TX buffer, escaping the characters in the
+ *    escape map.
  *
- *    data = (crcvalue ^ inputchar) & 0xff;
- *    data = (data ^ (data << 4)) & 0xff;
- *    crc = (crc >> 8) ^ ((data << 8) ^ (data <<3) ^ (data >> 4))
+ ****************************************************************************/
+
+static void ahdlc_tx_encode(struct ppp_context_s *ctx, const u8_t *map,
+                            const u8_t *data, u16_t len)
+{
+  u8_t *buf = ctx->ahdlc_tx_buffer;
+  u16_t crc = ctx->ahdlc_tx_crc;
+  u16_t n = ctx->ahdlc_tx_len;
+  u8_t c;
+
+  while (len-- > 0)
+    {
+      c   = *data++;
+      crc = FCS16(crc, c);
+
+      /* Only frames larger than the buffer take more than one write */
+
+      if (n > AHDLC_TX_BUFFER_SIZE - 2)
+        {
+          ctx->ahdlc_tx_len = n;
+          ahdlc_tx_flush(ctx);
+          n = 0;
+        }
+
+      if (AHDLC_MUST_ESCAPE(map, c))
+        {
+          buf[n++] = AHDLC_ESC;
+          c ^= 0x20;
+        }
+
+      buf[n++] = c;
+    }
+
+  ctx->ahdlc_tx_crc = crc;
+  ctx->ahdlc_tx_len = n;
+}
+
+/****************************************************************************
+ * ahdlc_rx_store(c) - add one received character to the frame.
  *
  ****************************************************************************/
 
-static u16_t crcadd(u16_t crcvalue, u8_t c)
+static void ahdlc_rx_store(struct ppp_context_s *ctx, u8_t c)
 {
-  u16_t b;
+  /* Try to store char if not too big */
 
-  b = (crcvalue ^ c) & 0xFF;
-  b = (b ^ (b << 4)) & 0xFF;
-  b = (b << 8) ^ (b << 3) ^ (b >> 4);
+  if (ctx->ahdlc_rx_count >= PPP_RX_BUFFER_SIZE)
+    {
+#ifdef PPP_STATISTICS
+      ++ctx->ahdlc_rx_tobig_error;
+#endif
+      ahdlc_rx_ready(ctx);
+      return;
+    }
+
+  ctx->ahdlc_rx_crc = FCS16(ctx->ahdlc_rx_crc, c);
+
+  /* Do auto ACFC, if packet len is zero discard 0xff and 0x03 */
+
+  if (ctx->ahdlc_rx_count == 0 && (c == 0xff || c == 0x03))
+    {
+      return;
+    }
+
+  ctx->ahdlc_rx_buffer[ctx->ahdlc_rx_count++] = c;
+}
+
+/****************************************************************************
+ * ahdlc_rx_frame() - handle the flag at the end of a frame: check the FCS
+ *    and pass good frames up.
+ *
+ ****************************************************************************/
+
+static void ahdlc_rx_frame(struct ppp_context_s *ctx)
+{
+  if (ctx->ahdlc_rx_crc == CRC_GOOD_VALUE)
+    {
+      DEBUG1(("\nReceiving packet with good crc value, len %d\n",
+             ctx->ahdlc_rx_count));
+
+#if PPP_STATISTICS
+      /* Update statistics */
+
+      ++ctx->ppp_rx_frame_count;
+#endif
+
+      /* Remove CRC bytes from packet */
+
+      ctx->ahdlc_rx_count -= 2;
 
-  return ((crcvalue >> 8) ^ b);
+      PERF_INC(g_perf_rxframes);
+      PERF_ADD(g_perf_rxbytes, ctx->ahdlc_rx_count);
+
+      /* Lock PPP buffer */
+
+      ctx->ahdlc_flags &= ~AHDLC_RX_READY;
+
+      /* upcall routine must fully process frame before return
+       *    as returning signifies that buffer belongs to AHDLC again.
+       */
+
+      /* Protocol numbers have an even first byte, so an odd one means
+       * that the protocol field was compressed.  Accept it whether or not
+       * PFC was negotiated.
+       */
+
+      if (ctx->ahdlc_rx_buffer[0] & 0x1)
+        {
+          /* Send up packet */
+
+          ppp_upcall(ctx, (u16_t)ctx->ahdlc_rx_buffer[0],
+                     (u8_t *)&ctx->ahdlc_rx_buffer[1],
+                     (u16_t)(ctx->ahdlc_rx_count - 1));
+        }
+      else
+        {
+          /* Send up packet */
+
+          ppp_upcall(ctx, (u16_t)(ctx->ahdlc_rx_buffer[0] << 8 |
+                                  ctx->ahdlc_rx_buffer[1]),
+                     (u8_t *)&ctx->ahdlc_rx_buffer[2],
+                     (u16_t)(ctx->ahdlc_rx_count - 2));
+        }
+
+      ctx->ahdlc_tx_offline = 0;    /* The remote side is alive */
+    }
+  else if (ctx->ahdlc_rx_count > 3)
+    {
+      DEBUG1(("\nReceiving packet with bad crc value, was 0x%04x len %d\n",
+             ctx->ahdlc_rx_crc, ctx->ahdlc_rx_count));
+#ifdef PPP_STATISTICS
+      ++ctx->ahdlc_crc_error;
+#endif
+      PERF_INC(g_perf_crcerrors);
+#ifdef CONFIG_NETUTILS_PPPD_VJC
+      /* The VJ decompressor cannot know what the lost frame changed */
+
+      vjc_rx_error(&ctx->vjc);
+#endif
+    }
+
+  ahdlc_rx_ready(ctx);
 }
 
 /****************************************************************************
@@ -115,10 +327,43 @@ void ahdlc_init(struct ppp_context_s *ctx)
   ctx->ahdlc_flags      = 0 | AHDLC_RX_ASYNC_MAP;
   ctx->ahdlc_rx_count   = 0;
   ctx->ahdlc_tx_offline = 0;
+  ctx->ahdlc_tx_len     = 0;
+  ctx->ahdlc_rx_rawpos  = 0;
+  ctx->ahdlc_rx_rawlen  = 0;
+
+  /* Until the peer tells us otherwise, escape all control characters */
+
+  ahdlc_tx_accm(ctx, 0xffffffff);
 
 #ifdef PPP_STATISTICS
   ctx->ahdlc_rx_tobig_error = 0;
 #endif
+
+  PERF_REGISTER(g_perf_rxframes);
+  PERF_REGISTER(g_perf_rxbytes);
+  PERF_REGISTER(g_perf_crcerrors);
+  PERF_REGISTER(g_perf_txframes);
+  PERF_REGISTER(g_perf_txbytes);
+}
+
+/****************************************************************************
+ * ahdlc_tx_accm(accm) - set the async control character map requested by
+ *    the peer.  Bit n set means that control character n must be escaped.
+ *
+ ****************************************************************************/
+
+void ahdlc_tx_accm(struct ppp_context_s *ctx, u32_t accm)
+{
+  int i;
+
+  memset(ctx->ahdlc_tx_escape_map, 0, sizeof(ctx->ahdlc_tx_escape_map));
+  for (i = 0; i < 4; i++)
+    {
+      ctx->ahdlc_tx_escape_map[i] = (u8_t)(accm >> (8 * i));
+    }
+
+  ctx->ahdlc_tx_escape_map[AHDLC_ESC >> 3]  |= 1 << (AHDLC_ESC & 7);
+  ctx->ahdlc_tx_escape_map[AHDLC_FLAG >> 3] |= 1 << (AHDLC_FLAG & 7);
 }
 
 /****************************************************************************
@@ -135,222 +380,160 @@ void ahdlc_rx_ready(struct ppp_context_s *ctx)
 }
 
 /****************************************************************************
- * ahdlc receive function - This routine processes incoming bytes and tries
- *    to build a PPP frame.
+ * ahdlc_rx_block(buffer, len) - process a block of incoming bytes and build
+ *    PPP frames from them.
  *
- *    Two possible reasons that ahdlc_rx will not process characters:
- *        o Buffer is locked - in this case ahdlc_rx returns 1, char
- *            sending routing should retry.
+ *    Runs of ordinary characters between flag and escape characters are
+ *    copied into the frame in one tight loop.  Processing stops early when
+ *    a frame leaves IP data in ctx->ip_buf or when the receive buffer is
+ *    locked; the caller should retry the remaining bytes later.
+ *
+ *    Returns the number of bytes consumed.
  *
  ****************************************************************************/
 
-u8_t ahdlc_rx(struct ppp_context_s *ctx, u8_t c)
+u16_t ahdlc_rx_block(struct ppp_context_s *ctx, const u8_t *buffer,
+                     u16_t len)
 {
-  //static u16_t protocol;
-
-  /* Check to see if PPP packet is useable, we should have hardware
-     flow control set, but if host ignores it and sends us a char when
-     the PPP Receive packet is in use, discard the character. */
+  const u8_t *ptr = buffer;
+  const u8_t *end = buffer + len;
+  u16_t count;
+  u16_t crc;
+  u8_t c;
 
-  if (ctx->ahdlc_flags & AHDLC_RX_READY)
+  while (ptr < end)
     {
-      /* Check to see if character is less than 0x20 hex we really
-         should set AHDLC_RX_ASYNC_MAP on by default and only turn it
-         off when it is negotiated off to handle some buggy stacks. */
+      /* Check to see if PPP packet is useable, we should have hardware
+       * flow control set, but if host ignores it and sends us a char when
+       * the PPP Receive packet is in use, discard the character.
+       */
 
-      if ((c < 0x20) && ((ctx->ahdlc_flags & AHDLC_RX_ASYNC_MAP) == 0))
+      if ((ctx->ahdlc_flags & AHDLC_RX_READY) == 0)
         {
-          /* Discard character */
-
-          DEBUG1(("Discard because char is < 0x20 hex and asysnc map is 0\n"));
-          return 0;
+          DEBUG1(("Busy/not active\n"));
+          break;
         }
 
-      /* Are we in escaped mode? */
+      /* The character after an escape is the only one handled alone */
 
       if (ctx->ahdlc_flags & AHDLC_ESCAPED)
         {
-          /* Set escaped to FALSE */
-
           ctx->ahdlc_flags &= ~AHDLC_ESCAPED;
 
-          /* If value is 0x7e then silently discard and reset receive packet */
+          /* If value is 0x7e then silently discard and reset receive
+           * packet
+           */
 
-          if (c == 0x7e)
+          if (*ptr == AHDLC_FLAG)
             {
+              ptr++;
               ahdlc_rx_ready(ctx);
-              return 0;
+              continue;
             }
 
-          /* Incoming char = itself xor 20 */
-
-          c = c ^ 0x20;
+          ahdlc_rx_store(ctx, *ptr++ ^ 0x20);
+          continue;
         }
-      else if (c == 0x7e)
-        {
-          /* Handle frame end */
-
-          if (ctx->ahdlc_rx_crc == CRC_GOOD_VALUE)
-            {
-              DEBUG1(("\nReceiving packet with good crc value, len %d\n",
-                     ctx->ahdlc_rx_count));
 
-              /* we hae a good packet, turn off CTS until we are done with
-                this packet */
-              /*CTS_OFF();*/
+      /* Copy the run of ordinary characters */
 
-#if PPP_STATISTICS
-              /* Update statistics */
-
-              ++ctx->ppp_rx_frame_count;
-#endif
+      count = ctx->ahdlc_rx_count;
+      crc   = ctx->ahdlc_rx_crc;
 
-              /* Femove CRC bytes from packet */
-
-              ctx->ahdlc_rx_count -= 2;
+      while (ptr < end && *ptr != AHDLC_FLAG && *ptr != AHDLC_ESC)
+        {
+          c = *ptr++;
 
-              /* Lock PPP buffer */
+          /* We really should set AHDLC_RX_ASYNC_MAP on by default and
+           * only turn it off when it is negotiated off to handle some
+           * buggy stacks.
+           */
 
-              ctx->ahdlc_flags &= ~AHDLC_RX_READY;
+          if (c < 0x20 && (ctx->ahdlc_flags & AHDLC_RX_ASYNC_MAP) == 0)
+            {
+              continue;
+            }
 
-             /*upcall routine must fully process frame before return
-              *    as returning signifies that buffer belongs to AHDLC again.
-              */
+          if (count >= PPP_RX_BUFFER_SIZE)
+            {
+              /* Too big: drop what we have and start over */
 
-              if ((c & 0x1) && (ctx->ahdlc_flags & PPP_PFC))
-                {
-                  /* Send up packet */
+#ifdef PPP_STATISTICS
+              ++ctx->ahdlc_rx_tobig_error;
+#endif
+              count = 0;
+              crc   = 0xffff;
+              continue;
+            }
 
-                  ppp_upcall(ctx, (u16_t)ctx->ahdlc_rx_buffer[0],
-                      (u8_t *)&ctx->ahdlc_rx_buffer[1],
-                      (u16_t)(ctx->ahdlc_rx_count - 1));
-                }
-              else
-                {
-                  /* Send up packet */
+          crc = FCS16(crc, c);
 
-                  ppp_upcall(ctx, (u16_t)(ctx->ahdlc_rx_buffer[0] << 8 | ctx->ahdlc_rx_buffer[1]),
-                      (u8_t *)&ctx->ahdlc_rx_buffer[2], (u16_t)(ctx->ahdlc_rx_count - 2));
-                }
+          /* Do auto ACFC, if packet len is zero discard 0xff and 0x03 */
 
-              ctx->ahdlc_tx_offline = 0;    /* The remote side is alive */
-              ahdlc_rx_ready(ctx);
-              return 0;
-            }
-          else if (ctx->ahdlc_rx_count > 3)
+          if (count == 0 && (c == 0xff || c == 0x03))
             {
-              DEBUG1(("\nReceiving packet with bad crc value, was 0x%04x len %d\n",
-                     ctx->ahdlc_rx_crc, ctx->ahdlc_rx_count));
-#ifdef PPP_STATISTICS
-              ++ctx->ahdlc_crc_error;
-#endif
-              /* Shouldn't we dump the packet and not pass it up? */
-
-              /*ppp_upcall((u16_t)ahdlc_rx_buffer[0],
-                (u8_t *)&ahdlc_rx_buffer[0], (u16_t)(ahdlc_rx_count+2));
-                dump_ppp_packet(&ahdlc_rx_buffer[0],ahdlc_rx_count);*/
+              continue;
             }
 
-          ahdlc_rx_ready(ctx);
-          return 0;
+          ctx->ahdlc_rx_buffer[count++] = c;
         }
-      else if (c == 0x7d)
-        {
-          /* Handle escaped chars*/
 
-          ctx->ahdlc_flags |= PPP_ESCAPED;
-          return 0;
-        }
+      ctx->ahdlc_rx_count = count;
+      ctx->ahdlc_rx_crc   = crc;
 
-      /* Rry to store char if not too big */
+      if (ptr >= end)
+        {
+          break;
+        }
 
-      if (ctx->ahdlc_rx_count >= PPP_RX_BUFFER_SIZE)
+      if (*ptr++ == AHDLC_ESC)
         {
-#ifdef PPP_STATISTICS
-          ++ctx->ahdlc_rx_tobig_error;
-#endif
-          ahdlc_rx_ready(ctx);
+          ctx->ahdlc_flags |= AHDLC_ESCAPED;
         }
       else
         {
-          /* Add CRC in */
-
-          ctx->ahdlc_rx_crc = crcadd(ctx->ahdlc_rx_crc, c);
-
-          /* Do auto ACFC, if packet len is zero discard 0xff and 0x03 */
-
-          if (ctx->ahdlc_rx_count == 0)
+          ahdlc_rx_frame(ctx);
+          if (ctx->ip_len > 0)
             {
-              if ((c == 0xff) || (c == 0x03))
-                {
-                  return 0;
-                }
+              break;
             }
-
-          /* Store char */
-
-          ctx->ahdlc_rx_buffer[ctx->ahdlc_rx_count++] = c;
         }
     }
-  else
-    {
-      /* we are busy and didn't process the character. */
-      DEBUG1(("Busy/not active\n"));
-      return 1;
-    }
 
-  return 0;
+  return (u16_t)(ptr - buffer);
 }
 
 /****************************************************************************
- * ahdlc_tx_char(char) - write a character to the serial device,
- * escape if necessary.
+ * ahdlc receive function - This routine processes one incoming byte and
+ *    tries to build a PPP frame.
  *
- * Relies on local global vars   :    ahdlc_tx_crc, ahdlc_flags.
- * Modifies local global vars    :    ahdlc_tx_crc.
+ *    Two possible reasons that ahdlc_rx will not process characters:
+ *        o Buffer is locked - in this case ahdlc_rx returns 1, char
+ *            sending routing should retry.
  *
  ****************************************************************************/
 
-void ahdlc_tx_char(struct ppp_context_s *ctx, u16_t protocol, u8_t c)
+u8_t ahdlc_rx(struct ppp_context_s *ctx, u8_t c)
 {
-  /* Add in crc */
-
-  ctx->ahdlc_tx_crc = crcadd(ctx->ahdlc_tx_crc, c);
-
-  /* See if we need to escape char, we always escape 0x7d and 0x7e, in the case
-   * of char < 0x20 we only support async map of default or none, so escape if
-   * ASYNC map is not set.  We may want to modify this to support a bitmap set
-   * ASYNC map.
-   */
-
-  if ((c == 0x7d) || (c == 0x7e) || ((c < 0x20) && ((protocol == LCP) ||
-      (ctx->ahdlc_flags & PPP_TX_ASYNC_MAP) == 0)))
-    {
-      /* Send escape char and xor byte by 0x20 */
-
-      ppp_arch_putchar(ctx, 0x7d);
-      c ^= 0x20;
-    }
-
-  ppp_arch_putchar(ctx, c);
+  return ahdlc_rx_block(ctx, &c, 1) == 1 ? 0 : 1;
 }
 
 /****************************************************************************
  * ahdlc_tx(protocol,buffer,len) - Transmit a PPP frame.
  *
  *    Buffer contains protocol data, ahdlc_tx addes address, control and
- *    protocol data.
- *
- * Relies on local global vars    :    ahdlc_tx_crc, ahdlc_flags.
- * Modifies local global vars    :    ahdlc_tx_crc.
+ *    protocol data.  The whole frame is encoded into the TX buffer and
+ *    written to the serial device at once.
  *
  ****************************************************************************/
 
 u8_t ahdlc_tx(struct ppp_context_s *ctx, u16_t protocol, u8_t *header,
               u8_t *buffer, u16_t headerlen, u16_t datalen)
 {
+  const u8_t *map;
+  u8_t hdr[4];
+  u8_t fcs[2];
   u16_t i;
-  u8_t c;
 
   DEBUG1(("\nAHDLC_TX - transmit frame, protocol 0x%04x, length %d  offline %d\n",
           protocol, datalen + headerlen, ctx->ahdlc_tx_offline));
@@ -378,66 +561,60 @@ u8_t ahdlc_tx(struct ppp_context_s *ctx, u16_t protocol, u8_t *header,
   DEBUG1(("\n\n"));
 #endif
 
-  /* Check to see that physical layer is up, we can assume is some
-     cases */
-
-  /* Write leading 0x7e */
+  /* LCP frames escape all control characters, others follow the ACCM */
 
-  ppp_arch_putchar(ctx, 0x7e);
+  map = (protocol == LCP) ? g_lcp_escape_map : ctx->ahdlc_tx_escape_map;
 
-  /* Set initial CRC value */
+  /* Write leading 0x7e and set initial CRC value */
 
-  ctx->ahdlc_tx_crc = 0xffff;
+  ctx->ahdlc_tx_buffer[0] = AHDLC_FLAG;
+  ctx->ahdlc_tx_len       = 1;
+  ctx->ahdlc_tx_crc       = 0xffff;
 
-  /* send HDLC control and address if not disabled or of LCP frame type */
+  /* Send HDLC control and address if not disabled or of LCP frame type,
+   * then the protocol, in one byte if PFC was negotiated and it fits.
+   */
 
-  /*if ((0==(ahdlc_flags & PPP_ACFC)) || ((0xc0==buffer[0]) && (0x21==buffer[1]))) */
+  i = 0;
   if ((0 == (ctx->ahdlc_flags & PPP_ACFC)) || (protocol == LCP))
     {
-      ahdlc_tx_char(ctx, protocol, 0xff);
-      ahdlc_tx_char(ctx, protocol, 0x03);
+      hdr[i++] = 0xff;
+      hdr[i++] = 0x03;
     }
 
-  /* Write Protocol */
-
-  ahdlc_tx_char(ctx, protocol,(u8_t)(protocol >> 8));
-  ahdlc_tx_char(ctx, protocol,(u8_t)(protocol & 0xff));
-
-  /* Write header if it exists */
-
-  for (i = 0; i < headerlen; ++i)
+  if ((ctx->ahdlc_flags & PPP_PFC) == 0 || protocol > 0xff)
     {
-      /* Get next byte from buffer */
-
-      c = header[i];
-
-      /* Write it...*/
-
-      ahdlc_tx_char(ctx, protocol, c);
+      hdr[i++] = (u8_t)(protocol >> 8);
     }
 
-  /* Write frame bytes */
+  hdr[i++] = (u8_t)(protocol & 0xff);
 
-  for (i = 0; i < datalen; ++i)
-    {
-      /* Get next byte from buffer */
+  ahdlc_tx_encode(ctx, map, hdr, i);
 
-      c = buffer[i];
+  /* Write header if it exists, then the frame bytes */
 
-      /* Write it...*/
-
-      ahdlc_tx_char(ctx, protocol, c);
-    }
+  ahdlc_tx_encode(ctx, map, header, headerlen);
+  ahdlc_tx_encode(ctx, map, buffer, datalen);
 
   /* Send crc, lsb then msb */
 
-  i = ctx->ahdlc_tx_crc ^ 0xffff;
-  ahdlc_tx_char(ctx, protocol, (u8_t)(i & 0xff));
-  ahdlc_tx_char(ctx, protocol, (u8_t)((i >> 8) & 0xff));
+  i      = ctx->ahdlc_tx_crc ^ 0xffff;
+  fcs[0] = (u8_t)(i & 0xff);
+  fcs[1] = (u8_t)((i >> 8) & 0xff);
+  ahdlc_tx_encode(ctx, map, fcs, 2);
 
   /* Write trailing 0x7e, probably not needed but it doesn't hurt */
 
-  ppp_arch_putchar(ctx, 0x7e);
+  if (ctx->ahdlc_tx_len >= AHDLC_TX_BUFFER_SIZE)
+    {
+      ahdlc_tx_flush(ctx);
+    }
+
+  ctx->ahdlc_tx_buffer[ctx->ahdlc_tx_len++] = AHDLC_FLAG;
+  ahdlc_tx_flush(ctx);
+
+  PERF_INC(g_perf_txframes);
+  PERF_ADD(g_perf_txbytes, headerlen + datalen);
 
 #if PPP_STATISTICS
   /* Update statistics */
@@ -65,8 +65,11 @@ extern "C"
 void ahdlc_init(struct ppp_context_s *ctx);
 
 void ahdlc_rx_ready(struct ppp_context_s *ctx);
+void ahdlc_tx_accm(struct ppp_context_s *ctx, u32_t accm);
 
 u8_t ahdlc_rx(struct ppp_context_s *ctx, u8_t);
+u16_t ahdlc_rx_block(struct ppp_context_s *ctx, const u8_t *buffer,
+                     u16_t len);
 u8_t ahdlc_tx(struct ppp_context_s *ctx, u16_t protocol, u8_t *header,
               u8_t *buffer, u16_t headerlen, u16_t datalen);
 
@@ -62,13 +62,14 @@
  * Private Types
  ****************************************************************************/
 
-/* In the future add compression protocol and name servers (possibly for servers
- * only)
- */
+/* In the future add name servers (possibly for servers only) */
 
 static const u8_t ipcplist[] =
 {
-  0x3,
+#ifdef CONFIG_NETUTILS_PPPD_VJC
+  IPCP_COMPRESSION,
+#endif
+  IPCP_IPADDRESS,
   0
 };
 
@@ -106,6 +107,10 @@ void ipcp_init(struct ppp_context_s *ctx)
   ctx->ipcp_retry = 0;
   ctx->ipcp_prev_seconds = 0;
 
+#ifdef CONFIG_NETUTILS_PPPD_VJC
+  vjc_init(&ctx->vjc);
+#endif
+
   memset(&ctx->local_ip, 0, sizeof(struct in_addr));
 #ifdef IPCP_GET_PEER_IP
   memset(&ctx->peer_ip, 0, sizeof(struct in_addr));
@@ -129,8 +134,11 @@ void ipcp_init(struct ppp_context_s *ctx)
 void ipcp_rx(struct ppp_context_s *ctx, u8_t *buffer, u16_t count)
 {
   u8_t *bptr = buffer;
+  u8_t *tptr;
   //IPCPPKT *pkt=(IPCPPKT *)buffer;
   u16_t len;
+  u8_t optlen;
+  u8_t error;
 
   DEBUG1(("IPCP len %d\n",count));
 
@@ -155,44 +163,84 @@ void ipcp_rx(struct ppp_context_s *ctx, u8_t *buffer, u16_t count)
 
         /* Parse out the results */
         /* lets try to implement what peer wants */
-        /* Reject any protocol not */
-        /* Error? if we we need to send a config Reject ++++ this is good for a subroutine*/
-        /* All we should get is the peer IP address */
 
-        if (IPCP_IPADDRESS == *bptr++)
-          {
-            /* Dump length */
+        tptr  = buffer + 4;
+        error = 0;
 
-            ++bptr;
+#ifdef CONFIG_NETUTILS_PPPD_VJC
+        /* No compression unless this request asks for it */
+
+        ctx->vjc.tx_slots = 0;
+#endif
+
+        while (bptr + 1 < buffer + len)
+          {
+            optlen = bptr[1];
+            if (optlen < 2)
+              {
+                break;
+              }
+
+            switch (*bptr)
+              {
+              case IPCP_IPADDRESS:
+                if (optlen == 6)
+                  {
 #ifdef IPCP_GET_PEER_IP
-            ((u8_t*)&ctx->peer_ip)[0] = *bptr++;
-            ((u8_t*)&ctx->peer_ip)[1] = *bptr++;
-            ((u8_t*)&ctx->peer_ip)[2] = *bptr++;
-            ((u8_t*)&ctx->peer_ip)[3] = *bptr++;
+                    ((u8_t*)&ctx->peer_ip)[0] = bptr[2];
+                    ((u8_t*)&ctx->peer_ip)[1] = bptr[3];
+                    ((u8_t*)&ctx->peer_ip)[2] = bptr[4];
+                    ((u8_t*)&ctx->peer_ip)[3] = bptr[5];
 
-            DEBUG1(("Peer IP "));
-            /* printip(peer_ip_addr); */
-            DEBUG1(("\n"));
+                    DEBUG1(("Peer IP "));
+                    /* printip(peer_ip_addr); */
+                    DEBUG1(("\n"));
 
-            netlib_set_dripv4addr((char*)ctx->ifname, &ctx->peer_ip);
-#else
-            bptr += 4;
+                    netlib_set_dripv4addr((char*)ctx->ifname, &ctx->peer_ip);
 #endif
-          }
-        else
-          {
-            DEBUG1(("HMMMM this shouldn't happen IPCP1\n"));
+                  }
+                break;
+
+#ifdef CONFIG_NETUTILS_PPPD_VJC
+              case IPCP_COMPRESSION:
+
+                /* We only speak VJ compression with its slot parameters */
+
+                if (optlen == 6 && bptr[2] == (VJC_COMP >> 8) &&
+                    bptr[3] == (VJC_COMP & 0xff))
+                  {
+                    DEBUG1(("<vj max slot %d comp slot %d> ",
+                            bptr[4], bptr[5]));
+                    vjc_tx_enable(&ctx->vjc, bptr[4], bptr[5]);
+                  }
+                else
+                  {
+                    /* Write it back in the reject */
+
+                    memmove(tptr, bptr, optlen);
+                    tptr += optlen;
+                    error = 1;
+                  }
+                break;
+#endif /* CONFIG_NETUTILS_PPPD_VJC */
+
+              default:
+                DEBUG1(("HMMMM this shouldn't happen IPCP1\n"));
+                break;
+              }
+
+            bptr += optlen;
           }
 
-#if 0
         if (error)
           {
-            /* Write the config NAK packet we've built above, take on the header */
+            /* Write the config Reject packet we've built above, take on the
+             * header
+             */
 
             bptr = buffer;
-            *bptr++ = CONF_NAK;        /* Write Conf_rej */
-            *bptr++;
-            /*tptr++;*/  /* skip over ID */
+            *bptr++ = CONF_REJ;       /* Write Conf_rej */
+            bptr++;                   /* skip over ID */
 
             /* Write new length */
 
@@ -201,14 +249,12 @@ void ipcp_rx(struct ppp_context_s *ctx, u8_t *buffer, u16_t count)
 
             /* Write the reject frame */
 
-            DEBUG1(("Writing NAK frame \n"));
-            ahdlc_tx(IPCP, buffer, (u16_t)(tptr - buffer));
-            DEBUG1(("- End NAK Write frame\n"));
+            DEBUG1(("Writing REJ frame \n"));
+            ahdlc_tx(ctx, IPCP, 0, buffer, 0, (u16_t)(tptr - buffer));
+            DEBUG1(("- End REJ Write frame\n"));
+            break;
           }
-        else
-          {
-          }
-#endif
+
         /* If we get here then we are OK, lets send an ACK and tell the rest
          * of our modules our negotiated config.
          */
@@ -322,6 +368,20 @@ void ipcp_rx(struct ppp_context_s *ctx, u8_t *buffer, u16_t count)
       {
         switch (*bptr++)
         {
+#ifdef CONFIG_NETUTILS_PPPD_VJC
+        case IPCP_COMPRESSION:
+
+          /* We can take any VJ slot count; stop asking for anything else */
+
+          if (bptr[1] != (VJC_COMP >> 8) || bptr[2] != (VJC_COMP & 0xff))
+            {
+              ctx->ipcp_state |= IPCP_VJC_BIT;
+            }
+
+          bptr += *bptr - 1;
+          break;
+#endif /* CONFIG_NETUTILS_PPPD_VJC */
+
         case IPCP_IPADDRESS:
           /* dump length */
           bptr++;
@@ -395,6 +455,13 @@ void ipcp_rx(struct ppp_context_s *ctx, u8_t *buffer, u16_t count)
       {
         switch (*bptr++)
         {
+#ifdef CONFIG_NETUTILS_PPPD_VJC
+        case IPCP_COMPRESSION:
+          ctx->ipcp_state |= IPCP_VJC_BIT;
+          bptr += *bptr - 1;
+          break;
+#endif /* CONFIG_NETUTILS_PPPD_VJC */
+
         case IPCP_IPADDRESS:
           ctx->ipcp_state |= IPCP_IP_BIT;
           bptr += 5;
@@ -467,6 +534,20 @@ void ipcp_task(struct ppp_context_s *ctx, u8_t *buffer)
           *bptr++ = (u8_t)((u8_t*)&ctx->local_ip)[2];
           *bptr++ = (u8_t)((u8_t*)&ctx->local_ip)[3];
 
+#ifdef CONFIG_NETUTILS_PPPD_VJC
+          if (!(ctx->ipcp_state & IPCP_VJC_BIT))
+            {
+              /* Offer to receive VJ compressed TCP/IP on all our slots */
+
+              *bptr++ = IPCP_COMPRESSION;
+              *bptr++ = 0x6;
+              *bptr++ = (u8_t)(VJC_COMP >> 8);
+              *bptr++ = (u8_t)(VJC_COMP & 0xff);
+              *bptr++ = VJC_SLOTS - 1;
+              *bptr++ = 1;
+            }
+#endif
+
 #ifdef IPCP_GET_PRI_DNS
           if (!(ppp_ipcp_state & IPCP_PRI_DNS_BIT))
             {
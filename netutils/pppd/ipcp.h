@@ -58,6 +58,7 @@
 
 /* IPCP Option Types */
 
+#define IPCP_COMPRESSION      0x02
 #define IPCP_IPADDRESS        0x03
 #define IPCP_PRIMARY_DNS      0x81
 #define IPCP_SECONDARY_DNS    0x83
@@ -70,6 +71,7 @@
 #define IPCP_TX_TIMEOUT       0x08
 #define IPCP_PRI_DNS_BIT      0x08
 #define IPCP_SEC_DNS_BIT      0x10
+#define IPCP_VJC_BIT          0x20  /* Peer refused VJ compression */
 
 /****************************************************************************
  * Public Types
@@ -111,6 +111,7 @@ void lcp_rx(struct ppp_context_s *ctx, u8_t *buffer, u16_t count)
 {
   u8_t *bptr = buffer, *tptr;
   u8_t error = 0;
+  u8_t tflag = 0;
   u8_t id;
   u16_t len, j;
   struct pppd_settings_s *pppd_settings = ctx->settings;
@@ -168,36 +169,22 @@ void lcp_rx(struct ppp_context_s *ctx, u8_t *buffer, u16_t count)
               break;
 
             case LPC_ACCM:
-              bptr++;  /* skip length */
-              j = *bptr++;
-              j += *bptr++;
-              j += *bptr++;
-              j += *bptr++;
-
-              if (j==0)
-                {
-                  // ok
-                  DEBUG1(("<asyncmap sum=0x%04x>",j));
-                  //ahdlc_flags |= PPP_TX_ASYNC_MAP;
-                }
-              else if (j!=0)
-                {
-                  // ok
-                  DEBUG1(("<asyncmap sum=0x%04x>, assume 0xffffffff",j));
-                }
-              else
-                {
-                  /* Fail.  We only support default or all zeros */
-
-                  DEBUG1(("We only support default or all zeros for ACCM "));
-                  error = 1;
-                  *tptr++ = LPC_ACCM;
-                  *tptr++ = 0x6;
-                  *tptr++ = 0;
-                  *tptr++ = 0;
-                  *tptr++ = 0;
-                  *tptr++ = 0;
-                }
+              {
+                u32_t accm;
+
+                /* The peer's map tells which control characters we must
+                 * escape when sending to it.  Any map can be honoured.
+                 */
+
+                bptr++;  /* skip length */
+                accm  = (u32_t)*bptr++ << 24;
+                accm |= (u32_t)*bptr++ << 16;
+                accm |= (u32_t)*bptr++ << 8;
+                accm |= (u32_t)*bptr++;
+
+                DEBUG1(("<asyncmap 0x%08lx> ", (unsigned long)accm));
+                ahdlc_tx_accm(ctx, accm);
+              }
               break;
 
 #ifdef CONFIG_NETUTILS_PPPD_PAP
@@ -257,13 +244,13 @@ void lcp_rx(struct ppp_context_s *ctx, u8_t *buffer, u16_t count)
             case LPC_PFC:
               bptr++;
               DEBUG1(("<pcomp> "));
-              /*tflag|=PPP_PFC;*/
+              tflag |= PPP_PFC;
               break;
 
             case LPC_ACFC:
               bptr++;
               DEBUG1(("<accomp> "));
-              /*tflag|=PPP_ACFC;*/
+              tflag |= PPP_ACFC;
               break;
             }
           }
@@ -305,9 +292,10 @@ void lcp_rx(struct ppp_context_s *ctx, u8_t *buffer, u16_t count)
             *bptr++ = CONF_ACK;  /* Write Conf_ACK */
             bptr++;              /* Skip ID (send same one) */
 
-            /* Set stuff */
+            /* Set stuff: the peer can take compressed fields from us */
 
-            /*ppp_flags|=tflag;*/
+            ctx->ahdlc_flags &= ~(PPP_PFC | PPP_ACFC);
+            ctx->ahdlc_flags |= tflag;
             /* DEBUG2("SET- stuff -- are we up? c=%d dif=%d \n", count, (u16_t)(bptr-buffer)); */
 
             /* Write the ACK frame */
@@ -351,6 +339,26 @@ void lcp_rx(struct ppp_context_s *ctx, u8_t *buffer, u16_t count)
 
   case CONF_REJ: /* Config Reject */
     DEBUG1(("LCP-CONF REJ\n"));
+
+    /* Stop asking for the rejected options */
+
+    len = (bptr[1] << 8) | bptr[2];
+    bptr += 3;
+
+    while (bptr + 1 < buffer + len && bptr[1] >= 2)
+      {
+        if (bptr[0] == LPC_PFC)
+          {
+            ctx->lcp_state |= LCP_PFC_REJ;
+          }
+        else if (bptr[0] == LPC_ACFC)
+          {
+            ctx->lcp_state |= LCP_ACFC_REJ;
+          }
+
+        bptr += bptr[1];
+      }
+
     ctx->ppp_id++;
     break;
 
@@ -524,6 +532,20 @@ void lcp_task(struct ppp_context_s *ctx, u8_t *buffer)
           *bptr++ = 0xff;
           *bptr++ = 0xff;
 
+          /* We can receive compressed protocol and address/control fields */
+
+          if (!(ctx->lcp_state & LCP_PFC_REJ))
+            {
+              *bptr++ = LPC_PFC;
+              *bptr++ = 0x2;
+            }
+
+          if (!(ctx->lcp_state & LCP_ACFC_REJ))
+            {
+              *bptr++ = LPC_ACFC;
+              *bptr++ = 0x2;
+            }
+
 #if 0
           /* Write magic number */
 
@@ -557,25 +579,6 @@ void lcp_task(struct ppp_context_s *ctx, u8_t *buffer)
               *bptr++ = 0x23;
             }
 
-          /* PFC */
-
-          if ((lcp_tx_options & LCP_OPT_PFC) && 0)
-            {
-              /* If turned on, we only negotiate PAP */
-
-              *bptr++ = LPC_PFC;
-              *bptr++ = 0x2;
-            }
-
-          /* ACFC */
-
-          if ((lcp_tx_options & LCP_OPT_ACFC) && 0)
-            {
-              /* If turned on, we only negotiate PAP */
-
-              *bptr++ = LPC_ACFC;
-              *bptr++ = 0x2;
-            }
 #endif
 
           /* Write length */
@@ -73,6 +73,8 @@
 
 #define LCP_TX_UP          0x1
 #define LCP_RX_UP          0x2
+#define LCP_PFC_REJ        0x4  /* Peer rejected our PFC option */
+#define LCP_ACFC_REJ       0x8  /* Peer rejected our ACFC option */
 
 #define LCP_RX_AUTH        0x10
 
@@ -268,7 +268,27 @@ void ppp_send(struct ppp_context_s *ctx)
 
   if ((ctx->ipcp_state & IPCP_TX_UP) && (ctx->ipcp_state & IPCP_RX_UP))
     {
+#ifdef CONFIG_NETUTILS_PPPD_VJC
+      u8_t comphdr[VJC_MAX_COMPHDR];
+      u16_t comphdrlen;
+      u16_t protocol;
+      u16_t skip;
+
+      protocol = vjc_compress(&ctx->vjc, ctx->ip_buf, ctx->ip_len,
+                              comphdr, &comphdrlen, &skip);
+      if (protocol == VJC_COMP)
+        {
+          /* Send the compressed header in place of the IP/TCP header */
+
+          ahdlc_tx(ctx, VJC_COMP, comphdr, ctx->ip_buf + skip, comphdrlen,
+                   ctx->ip_len - skip);
+          return;
+        }
+
+      ahdlc_tx(ctx, protocol, 0, ctx->ip_buf, 0, ctx->ip_len);
+#else
       ahdlc_tx(ctx, IPV4, 0, ctx->ip_buf, 0, ctx->ip_len);
+#endif
     }
 }
 
@@ -278,7 +298,7 @@ void ppp_send(struct ppp_context_s *ctx)
 
 void ppp_poll(struct ppp_context_s *ctx)
 {
-  u8_t c;
+  int ret;
 
   ctx->ip_len = 0;
 
@@ -294,9 +314,32 @@ void ppp_poll(struct ppp_context_s *ctx)
       return;
     }
 
-  while (ctx->ip_len == 0 && ppp_arch_getchar(ctx, &c))
+  /* Decode what the serial device has, a block at a time, until an IP
+   * packet is received.
+   */
+
+  while (ctx->ip_len == 0)
     {
-      ahdlc_rx(ctx, c);
+      if (ctx->ahdlc_rx_rawpos >= ctx->ahdlc_rx_rawlen)
+        {
+          ret = ppp_arch_read(ctx, ctx->ahdlc_rx_raw, AHDLC_RX_READ_SIZE);
+          if (ret <= 0)
+            {
+              break;
+            }
+
+          ctx->ahdlc_rx_rawpos = 0;
+          ctx->ahdlc_rx_rawlen = ret;
+        }
+
+      ret = ahdlc_rx_block(ctx, &ctx->ahdlc_rx_raw[ctx->ahdlc_rx_rawpos],
+                           ctx->ahdlc_rx_rawlen - ctx->ahdlc_rx_rawpos);
+      if (ret == 0)
+        {
+          break;
+        }
+
+      ctx->ahdlc_rx_rawpos += ret;
     }
 
   /* If IPCP came up then our link should be up. */
@@ -401,6 +444,16 @@ void ppp_upcall(struct ppp_context_s *ctx, u16_t protocol, u8_t *buffer, u16_t l
           DEBUG1(("\n"));
           break;
 
+#ifdef CONFIG_NETUTILS_PPPD_VJC
+        case VJC_COMP:   /* VJ compressed TCP/IP */
+        case VJC_UNCOMP: /* VJ uncompressed TCP/IP */
+          DEBUG1(("VJ TCP/IP Packet---\n"));
+          ctx->ip_len = vjc_uncompress(&ctx->vjc, protocol, buffer, len,
+                                       ctx->ip_buf, PPP_RX_BUFFER_SIZE);
+          ctx->ip_no_data_time = 0;
+          break;
+#endif /* CONFIG_NETUTILS_PPPD_VJC */
+
         default:
           DEBUG1(("Unknown PPP Packet Type 0x%04x - ",protocol));
           ppp_reject_protocol(ctx, protocol, buffer, len);
@@ -59,6 +59,10 @@
 #  include "pap.h"
 #endif /* CONFIG_NETUTILS_PPPD_PAP */
 
+#ifdef CONFIG_NETUTILS_PPPD_VJC
+#  include "vjc.h"
+#endif /* CONFIG_NETUTILS_PPPD_VJC */
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -167,9 +171,21 @@ struct ppp_context_s
   u8_t   ipcp_retry;
   time_t ipcp_prev_seconds;
 
+#ifdef CONFIG_NETUTILS_PPPD_VJC
+  /* VJ TCP/IP header compression */
+
+  struct vjc_s vjc;
+#endif /* CONFIG_NETUTILS_PPPD_VJC */
+
   /* AHDLC */
 
   u8_t  ahdlc_rx_buffer[PPP_RX_BUFFER_SIZE];
+  u8_t  ahdlc_rx_raw[AHDLC_RX_READ_SIZE];    /* Bytes read, not yet decoded */
+  u8_t  ahdlc_tx_buffer[AHDLC_TX_BUFFER_SIZE];
+  u8_t  ahdlc_tx_escape_map[32];             /* Characters escaped on tx */
+  u16_t ahdlc_rx_rawpos;  /* Next undecoded byte in ahdlc_rx_raw */
+  u16_t ahdlc_rx_rawlen;  /* Number of bytes in ahdlc_rx_raw */
+  u16_t ahdlc_tx_len;     /* Number of bytes in ahdlc_tx_buffer */
   u16_t ahdlc_tx_crc;     /* Running tx CRC */
   u16_t ahdlc_rx_crc;     /* Running rx CRC */
   u16_t ahdlc_rx_count;   /* Number of rx bytes processed, cur frame */
@@ -81,8 +81,9 @@ extern "C"
 
 time_t ppp_arch_clock_seconds(void);
 
-int ppp_arch_getchar(struct ppp_context_s *ctx, u8_t *p);
-int ppp_arch_putchar(struct ppp_context_s *ctx, u8_t c);
+int ppp_arch_read(struct ppp_context_s *ctx, u8_t *buffer, size_t len);
+int ppp_arch_write(struct ppp_context_s *ctx, const u8_t *buffer,
+                   size_t len);
 
 #undef EXTERN
 #ifdef __cplusplus
@@ -62,6 +62,15 @@
 #define PPP_RX_BUFFER_SIZE      1024 //1024  //GD 2048 for 1280 IPv6 MTU
 #define PPP_TX_BUFFER_SIZE      64
 
+/* Encoded frames are collected in the AHDLC TX buffer and written to the
+ * serial device at once.  The default holds a fully escaped frame of
+ * PPP_RX_BUFFER_SIZE bytes; larger frames take several writes.  Received
+ * bytes are read from the serial device AHDLC_RX_READ_SIZE at a time.
+ */
+
+#define AHDLC_TX_BUFFER_SIZE    (2 * (PPP_RX_BUFFER_SIZE + 6) + 2)
+#define AHDLC_RX_READ_SIZE      256
+
 #define AHDLC_TX_OFFLINE        5
 //#define AHDLC_COUNTERS          1 //defined for AHDLC stats support, Guillaume Descamps, September 19th, 2011
 
@@ -0,0 +1,682 @@
+/****************************************************************************
+ * netutils/pppd/vjc.c
+ * Van Jacobson TCP/IP header compression (RFC 1144)
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "ppp.h"
+#include "vjc.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Bits in the change mask of a compressed header */
+
+#define NEW_C                 0x40  /* Slot number follows */
+#define NEW_I                 0x20  /* IP ID delta follows */
+#define TCP_PUSH_BIT          0x10  /* TCP PSH flag */
+#define NEW_S                 0x08  /* Sequence number delta follows */
+#define NEW_A                 0x04  /* Acknowledgment delta follows */
+#define NEW_W                 0x02  /* Window delta follows */
+#define NEW_U                 0x01  /* Urgent pointer follows */
+
+/* Combinations that cannot occur and so encode common cases */
+
+#define SPECIAL_I             (NEW_S | NEW_W | NEW_U)  /* Echoed data */
+#define SPECIAL_D             (NEW_S | NEW_A | NEW_W | NEW_U)  /* Data */
+#define SPECIALS_MASK         (NEW_S | NEW_A | NEW_W | NEW_U)
+
+/* TCP header flags */
+
+#define TH_FIN                0x01
+#define TH_SYN                0x02
+#define TH_RST                0x04
+#define TH_PUSH               0x08
+#define TH_ACK                0x10
+#define TH_URG                0x20
+
+/* IP and TCP header field offsets */
+
+#define IP_LEN                2
+#define IP_ID                 4
+#define IP_OFF                6
+#define IP_PROTO              9
+#define IP_CHKSUM             10
+#define IP_SRC                12
+
+#define TH_SEQ                4
+#define TH_ACKNO              8
+#define TH_OFF                12
+#define TH_FLAGS              13
+#define TH_WIN                14
+#define TH_SUM                16
+#define TH_URP                18
+
+#define IP_PROTO_TCP          6
+
+#define IPHLEN(p)             (((p)[0] & 0x0f) << 2)
+#define THLEN(t)              (((t)[TH_OFF] >> 4) << 2)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static u16_t vjc_get16(const u8_t *p)
+{
+  return (u16_t)(p[0] << 8 | p[1]);
+}
+
+static u32_t vjc_get32(const u8_t *p)
+{
+  return (u32_t)p[0] << 24 | (u32_t)p[1] << 16 | (u32_t)p[2] << 8 | p[3];
+}
+
+static void vjc_put16(u8_t *p, u16_t v)
+{
+  p[0] = (u8_t)(v >> 8);
+  p[1] = (u8_t)v;
+}
+
+static void vjc_put32(u8_t *p, u32_t v)
+{
+  p[0] = (u8_t)(v >> 24);
+  p[1] = (u8_t)(v >> 16);
+  p[2] = (u8_t)(v >> 8);
+  p[3] = (u8_t)v;
+}
+
+/****************************************************************************
+ * Name: vjc_encode
+ *
+ * Description:
+ *   Append a delta: one byte if it is 1..255, else a zero byte and two
+ *   bytes.  Deltas that may be zero are always sent long.
+ *
+ ****************************************************************************/
+
+static u8_t *vjc_encode(u8_t *cp, u16_t n)
+{
+  if (n == 0 || n >= 256)
+    {
+      *cp++ = 0;
+      *cp++ = (u8_t)(n >> 8);
+    }
+
+  *cp++ = (u8_t)n;
+  return cp;
+}
+
+/****************************************************************************
+ * Name: vjc_decode
+ ****************************************************************************/
+
+static bool vjc_decode(const u8_t **cpp, const u8_t *end, u16_t *n)
+{
+  const u8_t *cp = *cpp;
+
+  if (cp >= end)
+    {
+      return false;
+    }
+
+  if (*cp != 0)
+    {
+      *n = *cp++;
+    }
+  else
+    {
+      if (cp + 3 > end)
+        {
+          return false;
+        }
+
+      *n  = vjc_get16(&cp[1]);
+      cp += 3;
+    }
+
+  *cpp = cp;
+  return true;
+}
+
+/****************************************************************************
+ * Name: vjc_ipchksum
+ ****************************************************************************/
+
+static void vjc_ipchksum(u8_t *ip)
+{
+  u32_t sum = 0;
+  u16_t ihl = IPHLEN(ip);
+  u16_t i;
+
+  ip[IP_CHKSUM]     = 0;
+  ip[IP_CHKSUM + 1] = 0;
+
+  for (i = 0; i < ihl; i += 2)
+    {
+      sum += vjc_get16(&ip[i]);
+    }
+
+  while (sum >> 16)
+    {
+      sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+  vjc_put16(&ip[IP_CHKSUM], (u16_t)~sum);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: vjc_init
+ *
+ * Description:
+ *   Forget all connections.  Compression is off until the peer accepts it.
+ *
+ ****************************************************************************/
+
+void vjc_init(struct vjc_s *vjc)
+{
+  memset(vjc, 0, sizeof(struct vjc_s));
+  vjc->tx_last = 0xff;
+  vjc->rx_toss = 1;
+}
+
+/****************************************************************************
+ * Name: vjc_tx_enable
+ *
+ * Description:
+ *   Start compressing with the parameters of the peer's IP-Compression-
+ *   Protocol option.
+ *
+ ****************************************************************************/
+
+void vjc_tx_enable(struct vjc_s *vjc, u8_t maxslot, u8_t compslot)
+{
+  vjc->tx_slots    = maxslot < VJC_SLOTS ? maxslot + 1 : VJC_SLOTS;
+  vjc->tx_compslot = compslot;
+  vjc->tx_last     = 0xff;
+}
+
+/****************************************************************************
+ * Name: vjc_compress
+ ****************************************************************************/
+
+u16_t vjc_compress(struct vjc_s *vjc, u8_t *packet, u16_t len,
+                   u8_t *comphdr, u16_t *comphdrlen, u16_t *skip)
+{
+  struct vjc_slot_s *cs = NULL;
+  u8_t deltas[15];
+  u8_t *ip = packet;
+  u8_t *th;
+  u8_t *oip;
+  u8_t *oth;
+  u8_t *cp;
+  u8_t changes;
+  u8_t slot;
+  u8_t lru;
+  u16_t ihl;
+  u16_t hlen;
+  u16_t olddata;
+  u16_t delta;
+  u32_t deltas32;
+  u32_t deltaa32;
+  int i;
+
+  /* Only complete TCP segments that carry nothing but ACK can be
+   * compressed.
+   */
+
+  if (vjc->tx_slots == 0 || len < 40 || (ip[0] >> 4) != 4 ||
+      ip[IP_PROTO] != IP_PROTO_TCP ||
+      (vjc_get16(&ip[IP_OFF]) & 0x3fff) != 0)
+    {
+      return IPV4;
+    }
+
+  ihl = IPHLEN(ip);
+  th  = ip + ihl;
+
+  if (ihl < 20 || ihl + 20 > len ||
+      (th[TH_FLAGS] & (TH_SYN | TH_FIN | TH_RST | TH_ACK)) != TH_ACK)
+    {
+      return IPV4;
+    }
+
+  hlen = ihl + THLEN(th);
+  if (THLEN(th) < 20 || hlen > len || hlen > VJC_MAX_HDR)
+    {
+      return IPV4;
+    }
+
+  /* Find the connection, or the least recently used slot */
+
+  lru = 0;
+  for (slot = 0; slot < vjc->tx_slots; slot++)
+    {
+      struct vjc_slot_s *tmp = &vjc->tx[slot];
+
+      if (tmp->hlen == 0)
+        {
+          lru = slot;
+          continue;
+        }
+
+      oth = tmp->hdr + IPHLEN(tmp->hdr);
+      if (memcmp(&tmp->hdr[IP_SRC], &ip[IP_SRC], 8) == 0 &&
+          memcmp(oth, th, 4) == 0)
+        {
+          cs = tmp;
+          break;
+        }
+
+      if (vjc->tx[lru].hlen != 0 &&
+          (u16_t)(vjc->tx_stamp - tmp->stamp) >
+          (u16_t)(vjc->tx_stamp - vjc->tx[lru].stamp))
+        {
+          lru = slot;
+        }
+    }
+
+  if (cs == NULL)
+    {
+      slot = lru;
+      cs   = &vjc->tx[slot];
+      goto uncompressed;
+    }
+
+  /* Everything but the fields we encode must match the saved header */
+
+  oip = cs->hdr;
+  oth = oip + ihl;
+
+  if (cs->hlen != hlen || oip[0] != ip[0] || oip[1] != ip[1] ||
+      memcmp(&oip[IP_OFF], &ip[IP_OFF], 3) != 0 ||
+      oth[TH_OFF] != th[TH_OFF] ||
+      memcmp(&oip[20], &ip[20], ihl - 20) != 0 ||
+      memcmp(&oth[20], &th[20], THLEN(th) - 20) != 0)
+    {
+      goto uncompressed;
+    }
+
+  cp      = deltas;
+  changes = 0;
+
+  if (th[TH_FLAGS] & TH_URG)
+    {
+      cp = vjc_encode(cp, vjc_get16(&th[TH_URP]));
+      changes |= NEW_U;
+    }
+  else if (vjc_get16(&th[TH_URP]) != vjc_get16(&oth[TH_URP]))
+    {
+      goto uncompressed;
+    }
+
+  delta = vjc_get16(&th[TH_WIN]) - vjc_get16(&oth[TH_WIN]);
+  if (delta != 0)
+    {
+      cp = vjc_encode(cp, delta);
+      changes |= NEW_W;
+    }
+
+  deltaa32 = vjc_get32(&th[TH_ACKNO]) - vjc_get32(&oth[TH_ACKNO]);
+  if (deltaa32 != 0)
+    {
+      if (deltaa32 > 0xffff)
+        {
+          goto uncompressed;
+        }
+
+      cp = vjc_encode(cp, (u16_t)deltaa32);
+      changes |= NEW_A;
+    }
+
+  deltas32 = vjc_get32(&th[TH_SEQ]) - vjc_get32(&oth[TH_SEQ]);
+  if (deltas32 != 0)
+    {
+      if (deltas32 > 0xffff)
+        {
+          goto uncompressed;
+        }
+
+      cp = vjc_encode(cp, (u16_t)deltas32);
+      changes |= NEW_S;
+    }
+
+  olddata = vjc_get16(&oip[IP_LEN]) - hlen;
+
+  switch (changes)
+    {
+      case 0:
+        /* Nothing changed.  Data following a pure ACK is normal on an
+         * interactive connection; anything else is probably a
+         * retransmission and goes uncompressed.
+         */
+
+        if (vjc_get16(&ip[IP_LEN]) != vjc_get16(&oip[IP_LEN]) &&
+            olddata == 0)
+          {
+            break;
+          }
+
+        goto uncompressed;
+
+      case SPECIAL_I:
+      case SPECIAL_D:
+
+        /* Real changes that look like the special cases */
+
+        goto uncompressed;
+
+      case NEW_S | NEW_A:
+        if (deltas32 == deltaa32 && deltas32 == olddata)
+          {
+            /* Terminal traffic echoed by the peer */
+
+            changes = SPECIAL_I;
+            cp      = deltas;
+          }
+        break;
+
+      case NEW_S:
+        if (deltas32 == olddata)
+          {
+            /* Unidirectional data transfer */
+
+            changes = SPECIAL_D;
+            cp      = deltas;
+          }
+        break;
+    }
+
+  delta = vjc_get16(&ip[IP_ID]) - vjc_get16(&oip[IP_ID]);
+  if (delta != 1)
+    {
+      cp = vjc_encode(cp, delta);
+      changes |= NEW_I;
+    }
+
+  if (th[TH_FLAGS] & TH_PUSH)
+    {
+      changes |= TCP_PUSH_BIT;
+    }
+
+  memcpy(cs->hdr, ip, hlen);
+  cs->stamp = ++vjc->tx_stamp;
+
+  /* Write the compressed header */
+
+  i = 0;
+  if (!vjc->tx_compslot || vjc->tx_last != slot)
+    {
+      comphdr[i++] = changes | NEW_C;
+      comphdr[i++] = slot;
+      vjc->tx_last = slot;
+    }
+  else
+    {
+      comphdr[i++] = changes;
+    }
+
+  comphdr[i++] = th[TH_SUM];
+  comphdr[i++] = th[TH_SUM + 1];
+
+  memcpy(&comphdr[i], deltas, cp - deltas);
+
+  *comphdrlen = i + (cp - deltas);
+  *skip       = hlen;
+  return VJC_COMP;
+
+uncompressed:
+
+  /* Send the whole header so that the peer learns it, with the slot in
+   * place of the IP protocol.
+   */
+
+  memcpy(cs->hdr, ip, hlen);
+  cs->hlen     = hlen;
+  cs->stamp    = ++vjc->tx_stamp;
+  vjc->tx_last = slot;
+
+  ip[IP_PROTO] = slot;
+  return VJC_UNCOMP;
+}
+
+/****************************************************************************
+ * Name: vjc_uncompress
+ ****************************************************************************/
+
+u16_t vjc_uncompress(struct vjc_s *vjc, u16_t protocol, const u8_t *buffer,
+                     u16_t len, u8_t *ip, u16_t iplen)
+{
+  const u8_t *cp = buffer;
+  const u8_t *end = buffer + len;
+  struct vjc_slot_s *cs;
+  u8_t *hdr;
+  u8_t *th;
+  u8_t changes;
+  u8_t slot;
+  u16_t hlen;
+  u16_t datalen;
+  u16_t n;
+
+  if (protocol == VJC_UNCOMP)
+    {
+      /* Remember the header and restore the IP protocol */
+
+      if (len < 40 || len > iplen)
+        {
+          goto toss;
+        }
+
+      slot = buffer[IP_PROTO];
+      hlen = IPHLEN(buffer);
+      if (slot >= VJC_SLOTS || hlen < 20 || hlen + 20 > len)
+        {
+          goto toss;
+        }
+
+      hlen += THLEN(buffer + hlen);
+      if (hlen > len || hlen > VJC_MAX_HDR)
+        {
+          goto toss;
+        }
+
+      memcpy(ip, buffer, len);
+      ip[IP_PROTO] = IP_PROTO_TCP;
+
+      cs = &vjc->rx[slot];
+      memcpy(cs->hdr, ip, hlen);
+      cs->hlen     = hlen;
+      vjc->rx_last = slot;
+      vjc->rx_toss = 0;
+      return len;
+    }
+
+  if (len < 3)
+    {
+      goto toss;
+    }
+
+  changes = *cp++;
+  if (changes & NEW_C)
+    {
+      if (*cp >= VJC_SLOTS)
+        {
+          goto toss;
+        }
+
+      vjc->rx_last = *cp++;
+      vjc->rx_toss = 0;
+    }
+  else if (vjc->rx_toss)
+    {
+      return 0;
+    }
+
+  cs   = &vjc->rx[vjc->rx_last];
+  hdr  = cs->hdr;
+  hlen = cs->hlen;
+  if (hlen == 0 || cp + 2 > end)
+    {
+      goto toss;
+    }
+
+  th = hdr + IPHLEN(hdr);
+
+  th[TH_SUM]     = *cp++;
+  th[TH_SUM + 1] = *cp++;
+
+  if (changes & TCP_PUSH_BIT)
+    {
+      th[TH_FLAGS] |= TH_PUSH;
+    }
+  else
+    {
+      th[TH_FLAGS] &= ~TH_PUSH;
+    }
+
+  switch (changes & SPECIALS_MASK)
+    {
+      case SPECIAL_I:
+        n = vjc_get16(&hdr[IP_LEN]) - hlen;
+        vjc_put32(&th[TH_ACKNO], vjc_get32(&th[TH_ACKNO]) + n);
+        vjc_put32(&th[TH_SEQ], vjc_get32(&th[TH_SEQ]) + n);
+        break;
+
+      case SPECIAL_D:
+        n = vjc_get16(&hdr[IP_LEN]) - hlen;
+        vjc_put32(&th[TH_SEQ], vjc_get32(&th[TH_SEQ]) + n);
+        break;
+
+      default:
+        if (changes & NEW_U)
+          {
+            if (!vjc_decode(&cp, end, &n))
+              {
+                goto toss;
+              }
+
+            th[TH_FLAGS] |= TH_URG;
+            vjc_put16(&th[TH_URP], n);
+          }
+        else
+          {
+            th[TH_FLAGS] &= ~TH_URG;
+          }
+
+        if (changes & NEW_W)
+          {
+            if (!vjc_decode(&cp, end, &n))
+              {
+                goto toss;
+              }
+
+            vjc_put16(&th[TH_WIN], vjc_get16(&th[TH_WIN]) + n);
+          }
+
+        if (changes & NEW_A)
+          {
+            if (!vjc_decode(&cp, end, &n))
+              {
+                goto toss;
+              }
+
+            vjc_put32(&th[TH_ACKNO], vjc_get32(&th[TH_ACKNO]) + n);
+          }
+
+        if (changes & NEW_S)
+          {
+            if (!vjc_decode(&cp, end, &n))
+              {
+                goto toss;
+              }
+
+            vjc_put32(&th[TH_SEQ], vjc_get32(&th[TH_SEQ]) + n);
+          }
+        break;
+    }
+
+  if (changes & NEW_I)
+    {
+      if (!vjc_decode(&cp, end, &n))
+        {
+          goto toss;
+        }
+    }
+  else
+    {
+      n = 1;
+    }
+
+  vjc_put16(&hdr[IP_ID], vjc_get16(&hdr[IP_ID]) + n);
+
+  /* Rebuild the datagram */
+
+  datalen = end - cp;
+  if (hlen + datalen > iplen)
+    {
+      goto toss;
+    }
+
+  vjc_put16(&hdr[IP_LEN], hlen + datalen);
+  vjc_ipchksum(hdr);
+
+  memcpy(ip, hdr, hlen);
+  memcpy(ip + hlen, cp, datalen);
+  return hlen + datalen;
+
+toss:
+  vjc->rx_toss = 1;
+  return 0;
+}
+
+/****************************************************************************
+ * Name: vjc_rx_error
+ ****************************************************************************/
+
+void vjc_rx_error(struct vjc_s *vjc)
+{
+  vjc->rx_toss = 1;
+}
@@ -0,0 +1,147 @@
+/****************************************************************************
+ * netutils/pppd/vjc.h
+ * Van Jacobson TCP/IP header compression (RFC 1144)
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_NETUTILS_PPPD_VJC_H
+#define __APPS_NETUTILS_PPPD_VJC_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include "ppp_arch.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_NETUTILS_PPPD_VJC_SLOTS
+#  define CONFIG_NETUTILS_PPPD_VJC_SLOTS 8
+#endif
+
+#define VJC_SLOTS             CONFIG_NETUTILS_PPPD_VJC_SLOTS
+
+/* Longest IP + TCP header that is remembered; packets with longer headers
+ * are sent as plain IP.
+ */
+
+#define VJC_MAX_HDR           64
+
+/* Longest compressed header: change mask, connection, checksum and five
+ * three-byte deltas.
+ */
+
+#define VJC_MAX_COMPHDR       19
+
+/* PPP protocols (RFC 1332) */
+
+#define VJC_COMP              0x002d  /* Compressed TCP/IP */
+#define VJC_UNCOMP            0x002f  /* Uncompressed TCP/IP */
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* The saved headers of one TCP connection */
+
+struct vjc_slot_s
+{
+  u8_t  hdr[VJC_MAX_HDR];   /* Last IP + TCP header seen */
+  u8_t  hlen;               /* Its length, zero if the slot is unused */
+  u16_t stamp;              /* Last use, for LRU replacement (tx only) */
+};
+
+/* Compression state for both directions of a link */
+
+struct vjc_s
+{
+  struct vjc_slot_s tx[VJC_SLOTS];
+  struct vjc_slot_s rx[VJC_SLOTS];
+
+  u16_t tx_stamp;           /* Use counter for the tx LRU */
+  u8_t  tx_slots;           /* Number of tx slots the peer allows, 0 = off */
+  u8_t  tx_compslot;        /* The peer accepts an elided slot number */
+  u8_t  tx_last;            /* Slot of the last compressed packet sent */
+  u8_t  rx_last;            /* Slot of the last packet received */
+  u8_t  rx_toss;            /* Drop compressed packets until re-synced */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+void vjc_init(struct vjc_s *vjc);
+void vjc_tx_enable(struct vjc_s *vjc, u8_t maxslot, u8_t compslot);
+
+/* Compress the IP packet in 'packet'.  Returns the PPP protocol to send it
+ * with.  For VJC_COMP, the compressed header is written to 'comphdr', its
+ * length to '*comphdrlen', and the first '*skip' bytes of the packet are
+ * replaced by it.  For VJC_UNCOMP, the packet has been modified in place.
+ */
+
+u16_t vjc_compress(struct vjc_s *vjc, u8_t *packet, u16_t len,
+                   u8_t *comphdr, u16_t *comphdrlen, u16_t *skip);
+
+/* Rebuild the IP packet from a VJC_COMP or VJC_UNCOMP frame into 'ip'
+ * (of size 'iplen').  Returns the IP packet length, or zero if the frame
+ * had to be dropped.
+ */
+
+u16_t vjc_uncompress(struct vjc_s *vjc, u16_t protocol, const u8_t *buffer,
+                     u16_t len, u8_t *ip, u16_t iplen);
+
+/* Note a damaged frame: compressed packets are dropped until the next one
+ * that names its slot.
+ */
+
+void vjc_rx_error(struct vjc_s *vjc);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __APPS_NETUTILS_PPPD_VJC_H */
@@ -48,6 +48,7 @@
 
 #include <nuttx/config.h>
 
+#include <sys/types.h>
 #include <sys/socket.h>
 #include <stdint.h>
 #include <stdbool.h>
@@ -55,6 +56,8 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <string.h>
+#include <strings.h>
+#include <ctype.h>
 #include <semaphore.h>
 
 #include <arpa/inet.h>
@@ -62,11 +65,22 @@
 #include <nuttx/net/ip.h>
 #include "netutils/smtp.h"
 
+#ifdef CONFIG_NETUTILS_SMTP_ATTACHMENTS
+#  include "netutils/base64.h"
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
 
-#define SMTP_INPUT_BUFFER_SIZE 512
+#define SMTP_INPUT_BUFFER_SIZE  512
+#define SMTP_OUTPUT_BUFFER_SIZE 512
+
+/* Input bytes per 76 character line of base64 */
+
+#define SMTP_BASE64_LINE        57
+
+#define SMTP_BOUNDARY           "=_smtp_nuttx_part_boundary"
 
 #define ISO_nl 0x0a
 #define ISO_cr 0x0d
@@ -82,192 +96,417 @@
  * Private Types
  ****************************************************************************/
 
-/* This structure represents the state of a single SMTP transaction */
+/* This structure represents the state of an SMTP session */
 
 struct smtp_state
 {
-  uint8_t      state;
   bool         connected;
+  bool         pipelining;      /* The server offers ESMTP PIPELINING */
+  bool         bol;             /* Body output is at the beginning of a line */
+  bool         cr;              /* Last body byte sent is a CR */
+  int          sockfd;
   sem_t        sem;
   in_addr_t    smtpserver;
   const char  *localhostname;
-  const char  *to;
-  const char  *cc;
-  const char  *from;
-  const char  *subject;
-  const char  *msg;
-  int          msglen;
-  int          sentlen;
-  int          textlen;
-  int          sendptr;
+  int          rxlen;           /* Number of bytes in buffer */
+  int          txlen;           /* Number of bytes in txbuf */
   char         buffer[SMTP_INPUT_BUFFER_SIZE];
+  char         line[SMTP_INPUT_BUFFER_SIZE + 1];
+  char         txbuf[SMTP_OUTPUT_BUFFER_SIZE];
 };
 
 /****************************************************************************
  * Private Data
  ****************************************************************************/
 
-static const char g_smtp220[]            = "220";
-static const char g_smtpcrnlperiodcrnl[] = "\r\n.\r\n";
+static const char g_smtpcc[]             = "Cc: ";
+static const char g_smtpcrnl[]           = "\r\n";
 static const char g_smtpdata[]           = "DATA\r\n";
+static const char g_smtpehlo[]           = "EHLO ";
 static const char g_smtpfrom[]           = "From: ";
 static const char g_smtphelo[]           = "HELO ";
 static const char g_smtpmailfrom[]       = "MAIL FROM: ";
+static const char g_smtpperiodcrnl[]     = ".\r\n";
+static const char g_smtppipelining[]     = "PIPELINING";
 static const char g_smtpquit[]           = "QUIT\r\n";
 static const char g_smtprcptto[]         = "RCPT TO: ";
+static const char g_smtprset[]           = "RSET\r\n";
 static const char g_smtpsubject[]        = "Subject: ";
 static const char g_smtpto[]             = "To: ";
 
+#ifdef CONFIG_NETUTILS_SMTP_ATTACHMENTS
+static const char g_smtpmime[]           =
+  "MIME-Version: 1.0\r\n"
+  "Content-Type: multipart/mixed; boundary=\"" SMTP_BOUNDARY "\"\r\n";
+static const char g_smtptextpart[]       =
+  "--" SMTP_BOUNDARY "\r\n"
+  "Content-Type: text/plain\r\n\r\n";
+static const char g_smtpattachpart[]     =
+  "--" SMTP_BOUNDARY "\r\n"
+  "Content-Type: application/octet-stream\r\n"
+  "Content-Transfer-Encoding: base64\r\n"
+  "Content-Disposition: attachment; filename=\"";
+static const char g_smtplastpart[]       = "--" SMTP_BOUNDARY "--\r\n";
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
-static inline int smtp_send_message(int sockfd, struct smtp_state *psmtp)
+/* Send everything gathered in the output buffer */
+
+static int smtp_flush(struct smtp_state *psmtp)
 {
-  if (recv(sockfd, psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, 0) < 0)
-    {
-      return ERROR;
-    }
+  int sent = 0;
+  int ret;
 
-  if (strncmp(psmtp->buffer, g_smtp220, strlen(g_smtp220)) != 0)
+  while (sent < psmtp->txlen)
     {
-      return ERROR;
-    }
+      ret = send(psmtp->sockfd, psmtp->txbuf + sent, psmtp->txlen - sent, 0);
+      if (ret < 0)
+        {
+          return ERROR;
+        }
 
-  snprintf(psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, "%s%s\r\n", g_smtphelo, psmtp->localhostname);
-  if (send(sockfd, psmtp->buffer, strlen(psmtp->buffer), 0) < 0)
-    {
-      return ERROR;
+      sent += ret;
     }
 
-  if (recv(sockfd, psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, 0) < 0)
-    {
-      return ERROR;
-    }
+  psmtp->txlen = 0;
+  return OK;
+}
 
-  if (psmtp->buffer[0] != ISO_2)
-    {
-      return ERROR;
-    }
+/* Gather output; commands and body go out in as few sends as possible */
 
-  snprintf(psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, "%s%s\r\n", g_smtpmailfrom, psmtp->from);
-  if (send(sockfd, psmtp->buffer, strlen(psmtp->buffer), 0) < 0)
-    {
-      return ERROR;
-    }
+static int smtp_put(struct smtp_state *psmtp, const char *data, size_t len)
+{
+  size_t n;
 
-  if (recv(sockfd, psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, 0) < 0)
+  while (len > 0)
     {
-      return ERROR;
-    }
+      if (psmtp->txlen == SMTP_OUTPUT_BUFFER_SIZE && smtp_flush(psmtp) < 0)
+        {
+          return ERROR;
+        }
 
-  if (psmtp->buffer[0] != ISO_2)
-    {
-      return ERROR;
-    }
+      n = SMTP_OUTPUT_BUFFER_SIZE - psmtp->txlen;
+      if (n > len)
+        {
+          n = len;
+        }
 
-  snprintf(psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, "%s%s\r\n", g_smtprcptto, psmtp->to);
-  if (send(sockfd, psmtp->buffer, strlen(psmtp->buffer), 0) < 0)
-    {
-      return ERROR;
+      memcpy(psmtp->txbuf + psmtp->txlen, data, n);
+      psmtp->txlen += n;
+      data         += n;
+      len          -= n;
     }
 
-  if (recv(sockfd, psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, 0) < 0)
-    {
-      return ERROR;
-    }
+  return OK;
+}
 
-  if (psmtp->buffer[0] != ISO_2)
+static inline int smtp_puts(struct smtp_state *psmtp, const char *str)
+{
+  return smtp_put(psmtp, str, strlen(str));
+}
+
+/* Put a command line: the command, its argument and CR LF */
+
+static int smtp_putcmd(struct smtp_state *psmtp, const char *cmd,
+                       const char *arg)
+{
+  if (smtp_puts(psmtp, cmd) < 0 || smtp_puts(psmtp, arg) < 0)
     {
       return ERROR;
     }
 
-  if (psmtp->cc != 0)
+  return smtp_puts(psmtp, g_smtpcrnl);
+}
+
+/* Put message text.  Lines are ended with CR LF and a period at the start
+ * of a line is doubled, so that any text can be sent after DATA.
+ */
+
+static int smtp_putbody(struct smtp_state *psmtp, const char *data,
+                        size_t len)
+{
+  const char *nl;
+  size_t run;
+
+  while (len > 0)
     {
-      snprintf(psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, "%s%s\r\n", g_smtprcptto, psmtp->cc);
-      if (send(sockfd, psmtp->buffer, strlen(psmtp->buffer), 0) < 0)
+      if (psmtp->bol && *data == ISO_period &&
+          smtp_put(psmtp, data, 1) < 0)
         {
           return ERROR;
         }
 
-      if (recv(sockfd, psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, 0) < 0)
+      nl  = memchr(data, ISO_nl, len);
+      run = (nl != NULL) ? nl - data : len;
+
+      if (run > 0)
         {
-          return ERROR;
+          if (smtp_put(psmtp, data, run) < 0)
+            {
+              return ERROR;
+            }
+
+          psmtp->cr  = (data[run - 1] == ISO_cr);
+          psmtp->bol = false;
         }
 
-      if (psmtp->buffer[0] != ISO_2)
+      if (nl == NULL)
+        {
+          break;
+        }
+
+      if ((!psmtp->cr && smtp_put(psmtp, g_smtpcrnl, 1) < 0) ||
+          smtp_put(psmtp, nl, 1) < 0)
         {
           return ERROR;
         }
+
+      psmtp->cr  = false;
+      psmtp->bol = true;
+      data      += run + 1;
+      len       -= run + 1;
     }
 
-  if (send(sockfd, g_smtpdata, strlen(g_smtpdata), 0) < 0)
+  return OK;
+}
+
+/* End the current body line, if any */
+
+static inline int smtp_endline(struct smtp_state *psmtp)
+{
+  if (!psmtp->bol)
     {
-      return ERROR;
+      psmtp->bol = true;
+      psmtp->cr  = false;
+      return smtp_puts(psmtp, g_smtpcrnl);
     }
 
-  if (recv(sockfd, psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, 0) < 0)
+  return OK;
+}
+
+/* Stream message text from a body source */
+
+static int smtp_putsource(struct smtp_state *psmtp, smtp_source_t source,
+                          void *arg)
+{
+  ssize_t n;
+
+  /* The reply line buffer is free while the message is sent */
+
+  while ((n = source(arg, psmtp->line, SMTP_INPUT_BUFFER_SIZE)) > 0)
     {
-      return ERROR;
+      if (smtp_putbody(psmtp, psmtp->line, n) < 0)
+        {
+          return ERROR;
+        }
     }
 
-  if (psmtp->buffer[0] != ISO_3)
+  return (n < 0) ? ERROR : OK;
+}
+
+#ifdef CONFIG_NETUTILS_SMTP_ATTACHMENTS
+/* Stream an attachment from its source, base64 encoded in 76 character
+ * lines.  The base64 alphabet has no period, so no dot-stuffing is needed.
+ */
+
+static int smtp_putbase64(struct smtp_state *psmtp, smtp_source_t source,
+                          void *arg)
+{
+  unsigned char in[SMTP_BASE64_LINE];
+  unsigned char out[base64_encode_len(SMTP_BASE64_LINE) + 1];
+  size_t have = 0;
+  size_t outlen;
+  ssize_t n;
+
+  do
     {
-      return ERROR;
+      n = source(arg, (char *)in + have, sizeof(in) - have);
+      if (n < 0)
+        {
+          return ERROR;
+        }
+
+      have += n;
+      if (have == sizeof(in) || (n == 0 && have > 0))
+        {
+          base64_encode(in, have, out, &outlen);
+          if (smtp_put(psmtp, (char *)out, outlen) < 0 ||
+              smtp_puts(psmtp, g_smtpcrnl) < 0)
+            {
+              return ERROR;
+            }
+
+          have = 0;
+        }
     }
+  while (n > 0);
+
+  return OK;
+}
+#endif
+
+/* Get the next reply line into psmtp->line */
+
+static int smtp_getline(struct smtp_state *psmtp)
+{
+  char *nl;
+  int len;
+  int ret;
 
-  snprintf(psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, "%s%s\r\n", g_smtpto, psmtp->to);
-  if (send(sockfd, psmtp->buffer, strlen(psmtp->buffer), 0) < 0)
+  for (; ; )
     {
-      return ERROR;
+      nl = memchr(psmtp->buffer, ISO_nl, psmtp->rxlen);
+      if (nl != NULL || psmtp->rxlen == SMTP_INPUT_BUFFER_SIZE)
+        {
+          /* A complete line, or a line longer than the buffer */
+
+          len = (nl != NULL) ? nl - psmtp->buffer + 1 : psmtp->rxlen;
+          memcpy(psmtp->line, psmtp->buffer, len);
+          psmtp->line[len] = '\0';
+
+          psmtp->rxlen -= len;
+          memmove(psmtp->buffer, psmtp->buffer + len, psmtp->rxlen);
+          return len;
+        }
+
+      ret = recv(psmtp->sockfd, psmtp->buffer + psmtp->rxlen,
+                 SMTP_INPUT_BUFFER_SIZE - psmtp->rxlen, 0);
+      if (ret <= 0)
+        {
+          return ERROR;
+        }
+
+      psmtp->rxlen += ret;
     }
+}
 
-  if (psmtp->cc != 0)
+/* Read a complete, possibly multi-line, reply and return its code */
+
+static int smtp_getreply(struct smtp_state *psmtp)
+{
+  char *line = psmtp->line;
+  int len;
+
+  do
     {
-      snprintf(psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, "%s%s\r\n", g_smtpto, psmtp->cc);
-      if (send(sockfd, psmtp->buffer, strlen(psmtp->buffer), 0) < 0)
+      len = smtp_getline(psmtp);
+      if (len < 3 || !isdigit(line[0]) || !isdigit(line[1]) ||
+          !isdigit(line[2]))
         {
           return ERROR;
         }
+
+      /* Note the extensions offered in the EHLO reply */
+
+      if (len > 4 && strncasecmp(line + 4, g_smtppipelining,
+                                 strlen(g_smtppipelining)) == 0)
+        {
+          psmtp->pipelining = true;
+        }
     }
+  while (line[3] == '-');
+
+  return (line[0] - '0') * 100 + (line[1] - '0') * 10 + (line[2] - '0');
+}
 
-  snprintf(psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, "%s%s\r\n", g_smtpfrom, psmtp->from);
-  if (send(sockfd, psmtp->buffer, strlen(psmtp->buffer), 0) < 0)
+/* Send the gathered commands and check the reply */
+
+static int smtp_command(struct smtp_state *psmtp, char expect)
+{
+  int reply;
+
+  if (smtp_flush(psmtp) < 0)
     {
       return ERROR;
     }
 
-  snprintf(psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, "%s%s\r\n", g_smtpsubject, psmtp->subject);
-  if (send(sockfd, psmtp->buffer, strlen(psmtp->buffer), 0) < 0)
+  reply = smtp_getreply(psmtp);
+  if (reply < 0)
     {
       return ERROR;
     }
 
-  if (send(sockfd, psmtp->msg, psmtp->msglen, 0) < 0)
+  return (reply / 100 == expect - '0') ? OK : reply;
+}
+
+/* Close the connection after a network or protocol error */
+
+static void smtp_abort(struct smtp_state *psmtp)
+{
+  close(psmtp->sockfd);
+  psmtp->connected = false;
+  psmtp->rxlen = 0;
+  psmtp->txlen = 0;
+}
+
+/* Send the message after DATA was accepted */
+
+static int smtp_send_content(struct smtp_state *psmtp,
+                             FAR const struct smtp_message_s *msg)
+{
+  int ret = OK;
+
+  psmtp->bol = true;
+  psmtp->cr  = false;
+
+  ret |= smtp_putcmd(psmtp, g_smtpto, msg->to);
+  if (msg->cc != NULL)
     {
-      return ERROR;
+      ret |= smtp_putcmd(psmtp, g_smtpcc, msg->cc);
     }
 
-  if (send(sockfd, g_smtpcrnlperiodcrnl, strlen(g_smtpcrnlperiodcrnl), 0) < 0)
+  ret |= smtp_putcmd(psmtp, g_smtpfrom, msg->from);
+  ret |= smtp_putcmd(psmtp, g_smtpsubject, msg->subject);
+
+#ifdef CONFIG_NETUTILS_SMTP_ATTACHMENTS
+  if (msg->attach != NULL)
     {
-      return ERROR;
+      ret |= smtp_puts(psmtp, g_smtpmime);
+      ret |= smtp_puts(psmtp, g_smtpcrnl);
+      ret |= smtp_puts(psmtp, g_smtptextpart);
+    }
+  else
+#endif
+    {
+      ret |= smtp_puts(psmtp, g_smtpcrnl);
     }
 
-  if (recv(sockfd, psmtp->buffer, SMTP_INPUT_BUFFER_SIZE, 0) < 0)
+  /* The text, from memory or streamed */
+
+  if (ret == OK && msg->msg != NULL)
     {
-      return ERROR;
+      ret = smtp_putbody(psmtp, msg->msg, msg->msglen);
     }
 
-  if (psmtp->buffer[0] != ISO_2)
+  if (ret == OK && msg->body != NULL)
     {
-      return ERROR;
+      ret = smtp_putsource(psmtp, msg->body, msg->bodyarg);
     }
 
-  if (send(sockfd, g_smtpquit, strlen(g_smtpquit), 0) < 0)
+  ret |= smtp_endline(psmtp);
+
+#ifdef CONFIG_NETUTILS_SMTP_ATTACHMENTS
+  if (ret == OK && msg->attach != NULL)
     {
-      return ERROR;
+      ret |= smtp_puts(psmtp, g_smtpattachpart);
+      ret |= smtp_putcmd(psmtp, msg->attachname, "\"");
+      ret |= smtp_puts(psmtp, g_smtpcrnl);
+      if (ret == OK)
+        {
+          ret = smtp_putbase64(psmtp, msg->attach, msg->attacharg);
+        }
+
+      ret |= smtp_puts(psmtp, g_smtplastpart);
     }
-  return OK;
+#endif
+
+  /* End of data */
+
+  ret |= smtp_puts(psmtp, g_smtpperiodcrnl);
+  return (ret == OK) ? OK : ERROR;
 }
 
 /****************************************************************************
@@ -293,38 +532,28 @@ void smtp_configure(FAR void *handle, FAR const char *lhostname,
   net_ipv4addr_copy(psmtp->smtpserver, paddr);
 }
 
-/* Send an e-mail.
+/* Open an SMTP session.
  *
- *   to      - The e-mail address of the receiver of the e-mail.
- *   cc      - The e-mail address of the CC: receivers of the e-mail.
- *   from    - The e-mail address of the sender of the e-mail.
- *   subject - The subject of the e-mail.
- *   msg     - The actual e-mail message.
- *   msglen  - The length of the e-mail message.
+ * Connects to the configured server and greets it with EHLO, or HELO if
+ * the server does not know ESMTP.  Messages are then sent with
+ * smtp_send_msg() until smtp_disconnect().
  */
 
-int smtp_send(void *handle, const char *to, const char *cc, const char *from,
-              const char *subject, const char *msg, int msglen)
+int smtp_connect(FAR void *handle)
 {
   struct smtp_state *psmtp = (struct smtp_state *)handle;
   struct sockaddr_in server;
-  int sockfd;
   int ret;
 
-  /* Setup */
-
-  psmtp->connected = true;
-  psmtp->to        = to;
-  psmtp->cc        = cc;
-  psmtp->from      = from;
-  psmtp->subject   = subject;
-  psmtp->msg       = msg;
-  psmtp->msglen    = msglen;
+  if (psmtp->connected)
+    {
+      return OK;
+    }
 
   /* Create a socket */
 
-  sockfd = socket(AF_INET, SOCK_STREAM, 0);
-  if (sockfd < 0)
+  psmtp->sockfd = socket(AF_INET, SOCK_STREAM, 0);
+  if (psmtp->sockfd < 0)
     {
       return ERROR;
     }
@@ -338,17 +567,260 @@ int smtp_send(void *handle, const char *to, const char *cc, const char *from,
   memcpy(&server.sin_addr.s_addr, &psmtp->smtpserver, sizeof(in_addr_t));
   server.sin_port = HTONS(25);
 
-  if (connect(sockfd, (struct sockaddr *)&server, sizeof(struct sockaddr_in)) < 0)
+  if (connect(psmtp->sockfd, (struct sockaddr *)&server,
+              sizeof(struct sockaddr_in)) < 0)
     {
-      close(sockfd);
+      close(psmtp->sockfd);
       return ERROR;
     }
 
+  psmtp->connected  = true;
+  psmtp->pipelining = false;
+  psmtp->rxlen      = 0;
+  psmtp->txlen      = 0;
+
+  /* Wait for the greeting, then introduce ourself */
+
+  if (smtp_command(psmtp, ISO_2) != OK ||
+      smtp_putcmd(psmtp, g_smtpehlo, psmtp->localhostname) < 0 ||
+      (ret = smtp_command(psmtp, ISO_2)) < 0)
+    {
+      goto errout;
+    }
+
+  /* A server without ESMTP refuses EHLO */
+
+  if (ret != OK &&
+      (smtp_putcmd(psmtp, g_smtphelo, psmtp->localhostname) < 0 ||
+       smtp_command(psmtp, ISO_2) != OK))
+    {
+      goto errout;
+    }
+
+  return OK;
+
+errout:
+  smtp_abort(psmtp);
+  return ERROR;
+}
+
+/* Send an e-mail in the open session.
+ *
+ * When the server offers PIPELINING, MAIL, RCPT and DATA are sent at once
+ * and their replies are read afterward.  If one of the recipients is
+ * refused, the message is still delivered to the other one, but ERROR is
+ * returned.  The session is kept open if the server refuses the message.
+ */
+
+int smtp_send_msg(FAR void *handle, FAR const struct smtp_message_s *msg)
+{
+  struct smtp_state *psmtp = (struct smtp_state *)handle;
+  const char *rcpt[2];
+  int nrcpt = 0;
+  int rcptok = 0;
+  int mailret;
+  int dataret;
+  int ret;
+  int i;
+
+  if (!psmtp->connected)
+    {
+      return ERROR;
+    }
+
+#ifndef CONFIG_NETUTILS_SMTP_ATTACHMENTS
+  if (msg->attach != NULL)
+    {
+      return ERROR;
+    }
+#endif
+
+  rcpt[nrcpt++] = msg->to;
+  if (msg->cc != NULL)
+    {
+      rcpt[nrcpt++] = msg->cc;
+    }
+
+  /* The envelope */
+
+  if (smtp_putcmd(psmtp, g_smtpmailfrom, msg->from) < 0)
+    {
+      goto errout;
+    }
+
+  mailret = OK;
+  if (!psmtp->pipelining)
+    {
+      mailret = smtp_command(psmtp, ISO_2);
+      if (mailret < 0)
+        {
+          goto errout;
+        }
+      else if (mailret != OK)
+        {
+          goto reset;
+        }
+    }
+
+  for (i = 0; i < nrcpt; i++)
+    {
+      if (smtp_putcmd(psmtp, g_smtprcptto, rcpt[i]) < 0)
+        {
+          goto errout;
+        }
+
+      if (!psmtp->pipelining)
+        {
+          ret = smtp_command(psmtp, ISO_2);
+          if (ret < 0)
+            {
+              goto errout;
+            }
+
+          rcptok += (ret == OK);
+        }
+    }
+
+  if (!psmtp->pipelining && rcptok == 0)
+    {
+      goto reset;
+    }
+
+  if (smtp_puts(psmtp, g_smtpdata) < 0)
+    {
+      goto errout;
+    }
+
+  if (psmtp->pipelining)
+    {
+      /* Every command gets its reply, in order */
+
+      if (smtp_flush(psmtp) < 0 || (mailret = smtp_getreply(psmtp)) < 0)
+        {
+          goto errout;
+        }
+
+      for (i = 0; i < nrcpt; i++)
+        {
+          ret = smtp_getreply(psmtp);
+          if (ret < 0)
+            {
+              goto errout;
+            }
+
+          rcptok += (ret / 100 == 2);
+        }
+
+      dataret = smtp_getreply(psmtp);
+      dataret = (dataret < 0) ? ERROR : (dataret / 100 == 3) ? OK : dataret;
+    }
+  else
+    {
+      dataret = smtp_command(psmtp, ISO_3);
+    }
+
+  if (dataret < 0)
+    {
+      goto errout;
+    }
+  else if (dataret != OK)
+    {
+      /* DATA was refused: no message to finish */
+
+      goto reset;
+    }
+
+  /* The message */
+
+  if (smtp_send_content(psmtp, msg) < 0 ||
+      (ret = smtp_command(psmtp, ISO_2)) < 0)
+    {
+      goto errout;
+    }
+
+  return (ret == OK && rcptok == nrcpt) ? OK : ERROR;
+
+reset:
+
+  /* The transaction failed; make the session ready for the next one */
+
+  if (smtp_puts(psmtp, g_smtprset) < 0 || smtp_command(psmtp, ISO_2) < 0)
+    {
+      goto errout;
+    }
+
+  return ERROR;
+
+errout:
+  smtp_abort(psmtp);
+  return ERROR;
+}
+
+/* Close the SMTP session opened with smtp_connect() */
+
+void smtp_disconnect(FAR void *handle)
+{
+  struct smtp_state *psmtp = (struct smtp_state *)handle;
+
+  if (psmtp->connected)
+    {
+      if (smtp_puts(psmtp, g_smtpquit) == OK)
+        {
+          (void)smtp_command(psmtp, ISO_2);
+        }
+
+      smtp_abort(psmtp);
+    }
+}
+
+/* Send an e-mail.
+ *
+ *   to      - The e-mail address of the receiver of the e-mail.
+ *   cc      - The e-mail address of the CC: receivers of the e-mail.
+ *   from    - The e-mail address of the sender of the e-mail.
+ *   subject - The subject of the e-mail.
+ *   msg     - The actual e-mail message.
+ *   msglen  - The length of the e-mail message.
+ *
+ * The message is sent in the session open with smtp_connect(), if any.
+ * Otherwise a session is opened for this message only.
+ */
+
+int smtp_send(void *handle, const char *to, const char *cc, const char *from,
+              const char *subject, const char *msg, int msglen)
+{
+  struct smtp_state *psmtp = (struct smtp_state *)handle;
+  struct smtp_message_s message;
+  bool opened = false;
+  int ret;
+
+  memset(&message, 0, sizeof(struct smtp_message_s));
+  message.to      = to;
+  message.cc      = cc;
+  message.from    = from;
+  message.subject = subject;
+  message.msg     = msg;
+  message.msglen  = msglen;
+
+  if (!psmtp->connected)
+    {
+      if (smtp_connect(handle) < 0)
+        {
+          return ERROR;
+        }
+
+      opened = true;
+    }
+
   /* Send the message */
 
-  ret = smtp_send_message(sockfd, psmtp);
+  ret = smtp_send_msg(handle, &message);
+
+  if (opened)
+    {
+      smtp_disconnect(handle);
+    }
 
-  close(sockfd);
   return ret;
 }
 
@@ -373,6 +845,7 @@ void smtp_close(void *handle)
   struct smtp_state *psmtp = (struct smtp_state *)handle;
   if (psmtp)
     {
+      smtp_disconnect(handle);
       sem_destroy(&psmtp->sem);
       free(psmtp);
     }
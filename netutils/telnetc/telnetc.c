@@ -52,6 +52,8 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -95,6 +97,12 @@
 
 #define _sendu(t, d, s) _send((t), (const char*)(d), (s))
 
+/* Size of the buffer escaped output is gathered in */
+
+#ifndef CONFIG_NETUTILS_TELNETC_SENDBUF_SIZE
+#  define CONFIG_NETUTILS_TELNETC_SENDBUF_SIZE 256
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -114,6 +122,14 @@ enum telnet_state_e
   TELNET_STATE_SB_DATA_IAC
 };
 
+/* Escaped output waiting to be sent */
+
+struct telnet_sendbuf_s
+{
+  size_t len;
+  char buf[CONFIG_NETUTILS_TELNETC_SENDBUF_SIZE];
+};
+
 /* Telnet state tracker */
 
 struct telnet_s
@@ -344,6 +360,55 @@ static void _send(struct telnet_s *telnet, const char *buffer, size_t size)
   telnet->eh(telnet, &ev, telnet->ud);
 }
 
+/* Append bytes to the output buffer, sending it when full.  Runs that are
+ * at least as large as the buffer are sent as they are, without a copy.
+ */
+
+static void _sendbuf_put(struct telnet_s *telnet,
+                         struct telnet_sendbuf_s *sb,
+                         const char *buffer, size_t size)
+{
+  size_t n;
+
+  while (size > 0)
+    {
+      if (sb->len == 0 && size >= sizeof(sb->buf))
+        {
+          _send(telnet, buffer, size);
+          return;
+        }
+
+      n = sizeof(sb->buf) - sb->len;
+      if (n > size)
+        {
+          n = size;
+        }
+
+      memcpy(sb->buf + sb->len, buffer, n);
+      sb->len += n;
+      buffer  += n;
+      size    -= n;
+
+      if (sb->len == sizeof(sb->buf))
+        {
+          _send(telnet, sb->buf, sb->len);
+          sb->len = 0;
+        }
+    }
+}
+
+/* Send what is left in the output buffer */
+
+static void _sendbuf_flush(struct telnet_s *telnet,
+                           struct telnet_sendbuf_s *sb)
+{
+  if (sb->len > 0)
+    {
+      _send(telnet, sb->buf, sb->len);
+      sb->len = 0;
+    }
+}
+
 /* Check if we support a particular telopt; if us is non-zero, we
  * check if we (local) supports it, otherwise we check if he (remote)
  * supports it.  return non-zero if supported, zero if not supported.
@@ -1302,11 +1367,28 @@ static void _process(struct telnet_s *telnet, const char *buffer,
 {
   union telnet_event_u ev;
   unsigned char byte;
+  const char *iac;
   size_t start;
   size_t i;
 
   for (i = start = 0; i != size; ++i)
     {
+      /* In data, skip straight to the next IAC: the bytes before it are
+       * passed in one event, here or after the loop.
+       */
+
+      if (telnet->state == TELNET_STATE_DATA)
+        {
+          iac = memchr(buffer + i, TELNET_IAC, size - i);
+          if (iac == NULL)
+            {
+              i = size;
+              break;
+            }
+
+          i = iac - buffer;
+        }
+
       byte = buffer[i];
       switch (telnet->state)
         {
@@ -1361,16 +1443,9 @@ static void _process(struct telnet_s *telnet, const char *buffer,
             /* IAC escaping */
 
             case TELNET_IAC:
-              /* Event */
+              /* The second IAC is data: it starts the next data run */
 
-              ev.type        = TELNET_EV_DATA;
-              ev.data.buffer = (char *)&byte;
-              ev.data.size   = 1;
-              telnet->eh(telnet, &ev, telnet->ud);
-
-              /* State update */
-
-              start = i + 1;
+              start = i;
               telnet->state = TELNET_STATE_DATA;
               break;
 
@@ -1784,36 +1859,35 @@ void telnet_negotiate(struct telnet_s *telnet, unsigned char cmd,
 
 void telnet_send(struct telnet_s *telnet, const char *buffer, size_t size)
 {
-  size_t l;
-  size_t i;
-
-  for (l = i = 0; i != size; ++i)
-    {
-      /* Dump prior portion of text, send escaped bytes */
+  struct telnet_sendbuf_s sb;
+  const char *iac;
+  size_t run;
 
-      if (buffer[i] == (char)TELNET_IAC)
-        {
-          /* Dump prior text if any */
+  /* Data without IAC is sent as it is */
 
-          if (i != l)
-            {
-              _send(telnet, buffer + l, i - l);
-            }
-
-          l = i + 1;
-
-          /* Send escape */
-
-          telnet_iac(telnet, TELNET_IAC);
-        }
+  iac = memchr(buffer, TELNET_IAC, size);
+  if (iac == NULL)
+    {
+      _send(telnet, buffer, size);
+      return;
     }
 
-  /* Send whatever portion of buffer is left */
+  /* Otherwise gather the runs with each IAC doubled */
 
-  if (i != l)
+  sb.len = 0;
+  while (iac != NULL)
     {
-      _send(telnet, buffer + l, i - l);
+      run = iac - buffer + 1;
+      _sendbuf_put(telnet, &sb, buffer, run);
+      _sendbuf_put(telnet, &sb, iac, 1);
+
+      buffer += run;
+      size   -= run;
+      iac     = memchr(buffer, TELNET_IAC, size);
     }
+
+  _sendbuf_put(telnet, &sb, buffer, size);
+  _sendbuf_flush(telnet, &sb);
 }
 
 /****************************************************************************
@@ -1963,6 +2037,8 @@ int telnet_vprintf(struct telnet_s *telnet, const char *fmt, va_list va)
 {
   static const char CRLF[] = { '\r', '\n' };
   static const char CRNUL[] = { '\r', '\0' };
+  static const char IACIAC[] = { (char)TELNET_IAC, (char)TELNET_IAC };
+  struct telnet_sendbuf_s sb;
   char buffer[1024];
   char *output = buffer;
   int rs;
@@ -1990,8 +2066,9 @@ int telnet_vprintf(struct telnet_s *telnet, const char *fmt, va_list va)
   va_end(va2);
   va_end(va);
 
-  /* Send */
+  /* Send, gathering the translated output into as few sends as possible */
 
+  sb.len = 0;
   for (l = i = 0; i != rs; ++i)
     {
       /* Special characters */
@@ -2001,42 +2078,36 @@ int telnet_vprintf(struct telnet_s *telnet, const char *fmt, va_list va)
         {
           /* Dump prior portion of text */
 
-          if (i != l)
-            {
-              _send(telnet, output + l, i - l);
-            }
-
+          _sendbuf_put(telnet, &sb, output + l, i - l);
           l = i + 1;
 
           /* IAC -> IAC IAC */
 
           if (output[i] == (char)TELNET_IAC)
             {
-              telnet_iac(telnet, TELNET_IAC);
+              _sendbuf_put(telnet, &sb, IACIAC, 2);
             }
 
           /* Automatic translation of \r -> CRNUL */
 
           else if (output[i] == '\r')
             {
-              _send(telnet, CRNUL, 2);
+              _sendbuf_put(telnet, &sb, CRNUL, 2);
             }
 
           /* Automatic translation of \n -> CRLF */
 
           else if (output[i] == '\n')
             {
-              _send(telnet, CRLF, 2);
+              _sendbuf_put(telnet, &sb, CRLF, 2);
             }
         }
     }
 
   /* Send whatever portion of output is left */
 
-  if (i != l)
-    {
-      _send(telnet, output + l, i - l);
-    }
+  _sendbuf_put(telnet, &sb, output + l, i - l);
+  _sendbuf_flush(telnet, &sb);
 
   /* Free allocated memory, if any */
 
@@ -42,7 +42,9 @@
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/ioctl.h>
+#include <sys/wait.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -67,6 +69,20 @@
  * Private Types
  ****************************************************************************/
 
+/* This structure represents one session task of the pool */
+
+#if CONFIG_TELNETD_POOLSIZE > 0
+struct telnetd_s;
+struct telnetd_worker_s
+{
+  FAR struct telnetd_s *daemon;    /* The daemon that owns this worker */
+  sem_t                 sem;       /* Posted when a connection is assigned */
+  pid_t                 pid;       /* Task ID of the worker */
+  volatile bool         busy;      /* True: Serving a connection */
+  char                  devpath[TELNET_DEVPATH_MAX]; /* Telnet driver path */
+};
+#endif
+
 /* This structure represents the overall state of one telnet daemon instance
  * (Yes, multiple telnet daemons are supported).
  */
@@ -79,6 +95,9 @@ struct telnetd_s
   size_t                stacksize; /* The stack size needed by the spawned task */
   main_t                entry;     /* The entrypoint of the task to spawn when a new
                                     * connection is accepted. */
+#if CONFIG_TELNETD_POOLSIZE > 0
+  struct telnetd_worker_s workers[CONFIG_TELNETD_POOLSIZE];
+#endif
 };
 
 /* This structure is used to passed information to telnet daemon when it
@@ -106,6 +125,217 @@ struct telnetd_common_s
 
 static struct telnetd_common_s g_telnetdcommon;
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: telnetd_worker
+ *
+ * Description:
+ *   The body of one pooled session task.  It waits for the daemon to
+ *   assign it a connection, runs the session entry point with that
+ *   connection as stdin, stdout, and stderr, and then returns to the pool
+ *   when the entry point returns.  If the entry point exits instead, the
+ *   daemon will replace this task when it next needs one.
+ *
+ ****************************************************************************/
+
+#if CONFIG_TELNETD_POOLSIZE > 0
+static int telnetd_worker(int argc, char *argv[])
+{
+  FAR struct telnetd_worker_s *worker;
+  FAR struct telnetd_s *daemon;
+  FAR char *sargv[2];
+  int drvrfd;
+  int ret;
+
+  /* Get the worker startup info.  argv[1] is the address of the pool
+   * entry.
+   */
+
+  DEBUGASSERT(argc == 2);
+  worker   = (FAR struct telnetd_worker_s *)
+             ((uintptr_t)strtoul(argv[1], NULL, 16));
+  daemon   = worker->daemon;
+
+  sargv[0] = argv[0];
+  sargv[1] = NULL;
+
+  for (;;)
+    {
+      /* Wait for a connection */
+
+      do
+        {
+          ret = sem_wait(&worker->sem);
+          DEBUGASSERT(ret == OK || errno == EINTR);
+        }
+      while (ret < 0);
+
+      /* Open the driver and use it as stdin, stdout, and stderror */
+
+      ninfo("Opening the telnet driver at %s\n", worker->devpath);
+      drvrfd = open(worker->devpath, O_RDWR);
+      if (drvrfd < 0)
+        {
+          nerr("ERROR: Failed to open %s: %d\n", worker->devpath, errno);
+        }
+      else
+        {
+          (void)dup2(drvrfd, 0);
+          (void)dup2(drvrfd, 1);
+          (void)dup2(drvrfd, 2);
+
+          if (drvrfd > 2)
+            {
+              close(drvrfd);
+            }
+
+          /* Forget anything left from the previous session */
+
+          clearerr(stdin);
+          clearerr(stdout);
+
+          /* Run the session */
+
+          (void)daemon->entry(1, sargv);
+
+          /* The session has ended.  Disconnect. */
+
+          fflush(stdout);
+          fflush(stderr);
+          close(0);
+          close(1);
+          close(2);
+        }
+
+      /* Return to the pool */
+
+      worker->busy = false;
+    }
+
+  return OK; /* Not reached */
+}
+#endif
+
+/****************************************************************************
+ * Name: telnetd_startworker
+ *
+ * Description:
+ *   Start the session task for one pool entry.
+ *
+ ****************************************************************************/
+
+#if CONFIG_TELNETD_POOLSIZE > 0
+static int telnetd_startworker(FAR struct telnetd_s *daemon,
+                               FAR struct telnetd_worker_s *worker)
+{
+  char arg[2 * sizeof(uintptr_t) + 1];
+  FAR char *argv[2];
+
+  worker->daemon = daemon;
+  worker->busy   = false;
+  sem_init(&worker->sem, 0, 0);
+
+  /* Pass the address of the pool entry to the new task */
+
+  snprintf(arg, sizeof(arg), "%lx", (unsigned long)((uintptr_t)worker));
+  argv[0] = arg;
+  argv[1] = NULL;
+
+  worker->pid = task_create("Telnet session", daemon->priority,
+                            daemon->stacksize, telnetd_worker, argv);
+  if (worker->pid < 0)
+    {
+      int errval = errno;
+      nerr("ERROR: Failed start the telnet session: %d\n", errval);
+      sem_destroy(&worker->sem);
+      return -errval;
+    }
+
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: telnetd_workerexited
+ *
+ * Description:
+ *   Return true if the session task of a pool entry has exited.  The task
+ *   is a child of the daemon, so waitpid() answers for that task only,
+ *   even if its task ID has since been given to another task.
+ *
+ ****************************************************************************/
+
+#if CONFIG_TELNETD_POOLSIZE > 0
+static bool telnetd_workerexited(FAR struct telnetd_worker_s *worker)
+{
+  int status;
+  int ret;
+
+  if (worker->pid < 0)
+    {
+      return true;
+    }
+
+  /* Zero means that the child is still running.  Because SIGCHLD is set
+   * up with SA_NOCLDWAIT, an exited child is usually not retained and
+   * waitpid() fails with ECHILD.
+   */
+
+  ret = waitpid(worker->pid, &status, WNOHANG);
+  return ret == worker->pid || (ret < 0 && errno == ECHILD);
+}
+#endif
+
+/****************************************************************************
+ * Name: telnetd_getworker
+ *
+ * Description:
+ *   Get an idle session task from the pool.  If none is idle, replace any
+ *   that have exited.  Returns NULL if all sessions are in use.
+ *
+ ****************************************************************************/
+
+#if CONFIG_TELNETD_POOLSIZE > 0
+static FAR struct telnetd_worker_s *
+telnetd_getworker(FAR struct telnetd_s *daemon)
+{
+  FAR struct telnetd_worker_s *worker;
+  int i;
+
+  for (i = 0; i < CONFIG_TELNETD_POOLSIZE; i++)
+    {
+      worker = &daemon->workers[i];
+      if (worker->pid >= 0 && !worker->busy)
+        {
+          return worker;
+        }
+    }
+
+  for (i = 0; i < CONFIG_TELNETD_POOLSIZE; i++)
+    {
+      worker = &daemon->workers[i];
+      if (telnetd_workerexited(worker))
+        {
+          ninfo("Replacing telnet session %d\n", i);
+          if (worker->pid >= 0)
+            {
+              sem_destroy(&worker->sem);
+            }
+
+          if (telnetd_startworker(daemon, worker) >= 0)
+            {
+              return worker;
+            }
+        }
+    }
+
+  return NULL;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -146,11 +376,15 @@ static int telnetd_daemon(int argc, char *argv[])
   struct sigaction sa;
   sigset_t blockset;
 #endif
-  socklen_t addrlen;
+#if CONFIG_TELNETD_POOLSIZE > 0
+  FAR struct telnetd_worker_s *worker;
+#else
   pid_t pid;
+  int drvrfd;
+#endif
+  socklen_t addrlen;
   int listensd;
   int acceptsd;
-  int drvrfd;
 #ifdef CONFIG_NET_HAVE_REUSEADDR
   int optval;
 #endif
@@ -260,6 +494,19 @@ static int telnetd_daemon(int argc, char *argv[])
       goto errout_with_socket;
     }
 
+#if CONFIG_TELNETD_POOLSIZE > 0
+  /* Pre-start the session tasks.  These are the only session tasks that
+   * will ever be created, so the memory used by sessions has a fixed
+   * upper bound.
+   */
+
+  for (ret = 0; ret < CONFIG_TELNETD_POOLSIZE; ret++)
+    {
+      daemon->workers[ret].pid = -1;
+      (void)telnetd_startworker(daemon, &daemon->workers[ret]);
+    }
+#endif
+
   /* Now go silent. */
 
 #ifndef CONFIG_DEBUG_FEATURES
@@ -295,6 +542,20 @@ static int telnetd_daemon(int argc, char *argv[])
             }
         }
 
+#if CONFIG_TELNETD_POOLSIZE > 0
+      /* Get a session task for the connection.  If all are busy, refuse
+       * the connection.
+       */
+
+      worker = telnetd_getworker(daemon);
+      if (worker == NULL)
+        {
+          nwarn("WARNING: All telnet sessions are in use\n");
+          close(acceptsd);
+          continue;
+        }
+#endif
+
       /* Configure to "linger" until all data is sent when the socket is closed */
 
 #ifdef CONFIG_NET_SOLINGER
@@ -332,6 +593,15 @@ static int telnetd_daemon(int argc, char *argv[])
           goto errout_with_acceptsd;
         }
 
+#if CONFIG_TELNETD_POOLSIZE > 0
+      /* Hand the driver to the session task */
+
+      ninfo("Assigning %s to session %d\n", session.ts_devpath, worker->pid);
+      strncpy(worker->devpath, session.ts_devpath, TELNET_DEVPATH_MAX);
+      worker->devpath[TELNET_DEVPATH_MAX - 1] = '\0';
+      worker->busy = true;
+      sem_post(&worker->sem);
+#else
       /* Open the driver */
 
       ninfo("Opening the telnet driver at %s\n", session.ts_devpath);
@@ -373,6 +643,7 @@ static int telnetd_daemon(int argc, char *argv[])
       close(0);
       close(1);
       close(2);
+#endif
     }
 
 errout_with_acceptsd:
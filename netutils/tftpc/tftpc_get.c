@@ -129,6 +129,25 @@ static inline int tftp_parsedatapacket(const uint8_t *packet,
   return ERROR;
 }
 
+/****************************************************************************
+ * Name: tftp_sendack
+ ****************************************************************************/
+
+static int tftp_sendack(int sd, uint8_t *packet, struct sockaddr_in *server,
+                        uint16_t blockno)
+{
+  int len;
+
+  len = tftp_mkackpacket(packet, blockno);
+  if (tftp_sendto(sd, packet, len, server) != len)
+    {
+      return ERROR;
+    }
+
+  ninfo("ACK blockno %d\n", blockno);
+  return OK;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -150,11 +169,15 @@ int tftpget(FAR const char *remote, FAR const char *local, in_addr_t addr,
             bool binary)
 {
   struct sockaddr_in server;  /* The address of the TFTP server */
-  struct sockaddr_in from;    /* The address the last UDP message recv'd from */
   FAR uint8_t *packet;        /* Allocated memory to hold one packet */
-  uint16_t blockno = 0;       /* The current transfer block number */
+  uint16_t blockno = 0;       /* The last block written to the file */
+  uint16_t blksize;           /* The negotiated block size */
+  uint16_t windowsize;        /* The negotiated number of blocks per ACK */
+  uint16_t inwindow = 0;      /* Blocks received since the last ACK */
   uint16_t opcode;            /* Received opcode */
   uint16_t rblockno;          /* Received block number */
+  bool options;               /* True: Request the blksize/windowsize options */
+  bool recovering = false;    /* True: A lost block has been reported */
   int len;                    /* Generic length */
   int sd;                     /* Socket descriptor for socket I/O */
   int fd;                     /* File descriptor for file I/O */
@@ -162,7 +185,6 @@ int tftpget(FAR const char *remote, FAR const char *local, in_addr_t addr,
   int nbytesrecvd = 0;        /* The number of bytes received in the packet */
   int ndatabytes;             /* The number of data bytes received */
   int result = ERROR;         /* Assume failure */
-  int ret;                    /* Generic return status */
 
   /* Allocate the buffer to used for socket/disk I/O */
 
@@ -191,137 +213,199 @@ int tftpget(FAR const char *remote, FAR const char *local, in_addr_t addr,
       goto errout_with_fd;
     }
 
-  /* Then enter the transfer loop.  Loop until the entire file has
-   * been received or until an error occurs.
+  /* Send the read request using the well-known port number until the server
+   * answers with either an OACK (it accepted some options) or the first
+   * DATA block (it ignored them).
    */
 
-  do
+#ifdef TFTP_HAVE_OPTIONS
+  options    = true;
+#else
+  options    = false;
+#endif
+  blksize    = TFTP_STDDATASIZE;
+  windowsize = 1;
+
+  for (retry = 0; ; retry++)
     {
-      /* Increment the TFTP block number for the next transfer */
+      if (retry >= TFTP_RETRIES)
+        {
+          ninfo("Retry limit exceeded\n");
+          goto errout_with_sd;
+        }
 
-      blockno++;
+      len             = tftp_mkreqpacket(packet, TFTP_RRQ, remote, binary,
+                                         options);
+      server.sin_port = HTONS(CONFIG_NETUTILS_TFTP_PORT);
+      if (tftp_sendto(sd, packet, len, &server) != len)
+        {
+          goto errout_with_sd;
+        }
 
-      /* Send the next block if the file within a loop.  We will
-       * retry up to TFTP_RETRIES times before giving up on the
-       * transfer.
+      /* Subsequent sendto will use the port number selected by the TFTP
+       * server.  Setting the server port to zero here indicates that we
+       * have not yet received the server port number.
        */
 
-      for (retry = 0; retry < TFTP_RETRIES; retry++)
+      server.sin_port = 0;
+
+      nbytesrecvd = tftp_rcvpacket(sd, packet, &server);
+      if (nbytesrecvd < 0)
         {
-          /* Send the read request using the well-known port number before
-           * receiving the first block.  Each retry of the first block will
-           * re-send the request.
-           */
+          continue;
+        }
 
-          if (blockno == 1)
+      opcode = (uint16_t)packet[0] << 8 | (uint16_t)packet[1];
+      if (opcode == TFTP_OACK && options)
+        {
+          if (tftp_parseoack(packet, nbytesrecvd, &blksize,
+                             &windowsize) != OK)
             {
-              len             = tftp_mkreqpacket(packet, TFTP_RRQ, remote, binary);
-              server.sin_port = HTONS(CONFIG_NETUTILS_TFTP_PORT);
-              ret             = tftp_sendto(sd, packet, len, &server);
-              if (ret != len)
-                {
-                  goto errout_with_sd;
-                }
+              len = tftp_mkerrpacket(packet, TFTP_ERR_NEGOTIATE,
+                                     TFTP_ERRST_NEGOTIATE);
+              (void)tftp_sendto(sd, packet, len, &server);
+              goto errout_with_sd;
+            }
 
-              /* Subsequent sendto will use the port number selected by the TFTP
-               * server in the DATA packet.  Setting the server port to zero
-               * here indicates that we have not yet received the server port number.
-               */
+          /* Accept the options by acknowledging block zero */
 
-              server.sin_port = 0;
+          nbytesrecvd = 0;
+          if (tftp_sendack(sd, packet, &server, 0) != OK)
+            {
+              goto errout_with_sd;
             }
 
-          /* Get the next packet from the server */
+          break;
+        }
 
-          nbytesrecvd = tftp_recvfrom(sd, packet, TFTP_IOBUFSIZE, &from);
+      if (tftp_parsedatapacket(packet, &opcode, &rblockno) == OK &&
+          rblockno == 1)
+        {
+          /* The server ignored the options; this is the first block */
 
-          /* Check if anything valid was received */
+          break;
+        }
 
-          if (nbytesrecvd > 0)
-            {
-              /* Verify the sender address and port number */
+      if (opcode == TFTP_ERR && options)
+        {
+          /* Some servers reject requests that carry options */
 
-              if (server.sin_addr.s_addr != from.sin_addr.s_addr)
-                {
-                  ninfo("Invalid address in DATA\n");
-                  retry--;
-                  continue;
-                }
+          nwarn("WARNING: Request refused, retrying without options\n");
+          options = false;
+          retry   = -1;
+          continue;
+        }
 
-              if (server.sin_port && server.sin_port != from.sin_port)
-                {
-                  ninfo("Invalid port in DATA\n");
-                  len = tftp_mkerrpacket(packet, TFTP_ERR_UNKID, TFTP_ERRST_UNKID);
-                  ret = tftp_sendto(sd, packet, len, &from);
-                  retry--;
-                  continue;
-                }
+      if (opcode == TFTP_ERR)
+        {
+          goto errout_with_sd;
+        }
+    }
 
-              /* Parse the incoming DATA packet */
+  /* Then loop until the entire file has been received or until an error
+   * occurs.  The server sends windowsize blocks per ACK.  On a lost or
+   * misordered block, the last block written is ACKed so that the server
+   * resumes from the block after it (RFC 7440).
+   */
 
-              if (nbytesrecvd < TFTP_DATAHEADERSIZE)
-                {
-                  /* Packet is not big enough to be parsed */
+  retry = 0;
+  for (;;)
+    {
+      /* Handle a DATA packet.  nbytesrecvd is zero if there is none */
 
-                  ninfo("Tiny data packet ignored\n");
-                  continue;
+      if (nbytesrecvd > 0)
+        {
+          rblockno = (uint16_t)packet[2] << 8 | (uint16_t)packet[3];
+          if (rblockno == (uint16_t)(blockno + 1))
+            {
+              /* Write the received data chunk to the file */
+
+              ndatabytes = nbytesrecvd - TFTP_DATAHEADERSIZE;
+              tftp_dumpbuffer("Recvd DATA", packet + TFTP_DATAHEADERSIZE,
+                              ndatabytes);
+              if (tftp_write(fd, packet + TFTP_DATAHEADERSIZE, ndatabytes) < 0)
+                {
+                  goto errout_with_sd;
                 }
 
-              if (tftp_parsedatapacket(packet, &opcode, &rblockno) != OK ||
-                  blockno != rblockno)
+              blockno++;
+              inwindow++;
+              recovering = false;
+              retry      = 0;
+
+              /* Acknowledge the end of each window and the last block */
+
+              if (inwindow >= windowsize || ndatabytes < blksize)
                 {
-                  /* Opcode is not TFTP_DATA or the block number is unexpected */
+                  if (tftp_sendack(sd, packet, &server, blockno) != OK)
+                    {
+                      goto errout_with_sd;
+                    }
 
-                  ninfo("Parse failure\n");
-                  if (opcode > TFTP_MAXRFC1350)
+                  inwindow = 0;
+                  if (ndatabytes < blksize)
                     {
-                      len = tftp_mkerrpacket(packet, TFTP_ERR_ILLEGALOP, TFTP_ERRST_ILLEGALOP);
-                      ret = tftp_sendto(sd, packet, len, &from);
+                      break;
                     }
-                  continue;
                 }
-
-              /* Replace the server port to the one in the good data response */
-
-              if (!server.sin_port)
+            }
+          else if (!recovering)
+            {
+              ninfo("Unexpected block %d, ACK %d\n", rblockno, blockno);
+              if (tftp_sendack(sd, packet, &server, blockno) != OK)
                 {
-                  server.sin_port = from.sin_port;
+                  goto errout_with_sd;
                 }
 
-              /* Then break out of the loop */
-
-              break;
+              inwindow   = 0;
+              recovering = true;
             }
         }
 
-      /* Did we exhaust all of the retries? */
+      /* Get the next packet from the server */
 
-      if (retry == TFTP_RETRIES)
+      nbytesrecvd = tftp_rcvpacket(sd, packet, &server);
+      if (nbytesrecvd < 0)
         {
-          ninfo("Retry limit exceeded\n");
-          goto errout_with_sd;
-        }
+          /* Timed out.  Repeat the last ACK so that the server resends the
+           * blocks after it.
+           */
 
-      /* Write the received data chunk to the file */
+          if (++retry >= TFTP_RETRIES)
+            {
+              ninfo("Retry limit exceeded\n");
+              goto errout_with_sd;
+            }
 
-      ndatabytes = nbytesrecvd - TFTP_DATAHEADERSIZE;
-      tftp_dumpbuffer("Recvd DATA", packet + TFTP_DATAHEADERSIZE, ndatabytes);
-      if (tftp_write(fd, packet + TFTP_DATAHEADERSIZE, ndatabytes) < 0)
-        {
-          goto errout_with_sd;
-        }
+          nbytesrecvd = 0;
+          inwindow    = 0;
+          if (tftp_sendack(sd, packet, &server, blockno) != OK)
+            {
+              goto errout_with_sd;
+            }
 
-      /* Send the acknowledgment */
+          continue;
+        }
 
-      len = tftp_mkackpacket(packet, blockno);
-      ret = tftp_sendto(sd, packet, len, &server);
-      if (ret != len)
+      if (tftp_parsedatapacket(packet, &opcode, &rblockno) != OK)
         {
-          goto errout_with_sd;
+          /* Opcode is not TFTP_DATA */
+
+          ninfo("Parse failure\n");
+          if (opcode == TFTP_ERR)
+            {
+              goto errout_with_sd;
+            }
+
+          if (opcode > TFTP_OACK)
+            {
+              len = tftp_mkerrpacket(packet, TFTP_ERR_ILLEGALOP, TFTP_ERRST_ILLEGALOP);
+              (void)tftp_sendto(sd, packet, len, &server);
+            }
+
+          nbytesrecvd = 0;
         }
-      ninfo("ACK blockno %d\n", blockno);
     }
-  while (ndatabytes >= TFTP_DATASIZE);
 
   /* Return success */
 
@@ -77,6 +77,23 @@
 #  define CONFIG_NETUTILS_TFTP_TIMEOUT 10 /* One second */
 #endif
 
+/* The block size to request with the RFC 2348 blksize option.  The value
+ * actually requested is limited by the UDP MSS below.  The RFC 1350 block
+ * size of 512 bytes is used when the server does not accept the option.
+ */
+
+#ifndef CONFIG_NETUTILS_TFTP_BLKSIZE
+#  define CONFIG_NETUTILS_TFTP_BLKSIZE 512
+#endif
+
+/* The number of blocks per ACK to request with the RFC 7440 windowsize
+ * option.  A value of one disables the option (lock-step transfers).
+ */
+
+#ifndef CONFIG_NETUTILS_TFTP_WINDOWSIZE
+#  define CONFIG_NETUTILS_TFTP_WINDOWSIZE 1
+#endif
+
 /* Dump received buffers */
 
 #undef CONFIG_NETUTILS_TFTP_DUMPBUFFERS
@@ -88,7 +105,8 @@
 #define TFTP_DATAHEADERSIZE   4
 
 /* The maximum size for TFTP data is determined by the configured UDP packet
- * payload size (UDP_MSS), but cannot exceed 512 + sizeof(TFTP_DATA header).
+ * payload size (UDP_MSS), but cannot exceed CONFIG_NETUTILS_TFTP_BLKSIZE +
+ * sizeof(TFTP_DATA header).
  *
  * In the case where there are multiple network devices with different
  * link layer protocols, each network device may support a different UDP MSS
@@ -98,29 +116,48 @@
  */
 
 #define TFTP_DATAHEADERSIZE   4
-#define TFTP_MAXPACKETSIZE    (TFTP_DATAHEADERSIZE+512)
+#define TFTP_DEFBLKSIZE       512
+#define TFTP_MAXPACKETSIZE    (TFTP_DATAHEADERSIZE+CONFIG_NETUTILS_TFTP_BLKSIZE)
 
 #if defined(CONFIG_NET_ETHERNET)
-#  if ETH_UDP_MSS(IPv4_HDRLEN) < TFTP_MAXPACKETSIZE
-#    define TFTP_PACKETSIZE   ETH_UDP_MSS(IPv4_HDRLEN)
+#  define TFTP_UDP_MSS        ETH_UDP_MSS(IPv4_HDRLEN)
+#else
+#  define TFTP_UDP_MSS        MIN_UDP_MSS
+#endif
+
+#if TFTP_UDP_MSS < TFTP_MAXPACKETSIZE
+#  define TFTP_PACKETSIZE     TFTP_UDP_MSS
+#  if TFTP_UDP_MSS < TFTP_DATAHEADERSIZE+TFTP_DEFBLKSIZE
 #    ifdef CONFIG_CPP_HAVE_WARNING
-#      warning "Ethernet MSS is too small for TFTP"
+#      warning "UDP MSS is too small for TFTP"
 #    endif
-#  else
-#    define TFTP_PACKETSIZE   TFTP_MAXPACKETSIZE
-#  endif
-#elif MIN_UDP_MSS < TFTP_MAXPACKETSIZE
-#  define TFTP_PACKETSIZE     MIN_UDP_MSS
-#  ifdef CONFIG_CPP_HAVE_WARNING
-#    warning "Minimum MSS is too small for TFTP"
 #  endif
 #else
 #  define TFTP_PACKETSIZE     TFTP_MAXPACKETSIZE
 #endif
 
+/* TFTP_DATASIZE is the largest block that the client can handle; it is the
+ * blksize requested from the server.  TFTP_STDDATASIZE is the block size
+ * used when the server does not negotiate blksize.
+ */
+
 #define TFTP_DATASIZE         (TFTP_PACKETSIZE-TFTP_DATAHEADERSIZE)
 #define TFTP_IOBUFSIZE        (TFTP_PACKETSIZE+8)
 
+#if TFTP_DATASIZE < TFTP_DEFBLKSIZE
+#  define TFTP_STDDATASIZE    TFTP_DATASIZE
+#else
+#  define TFTP_STDDATASIZE    TFTP_DEFBLKSIZE
+#endif
+
+/* Options are only sent if they ask for something other than the RFC 1350
+ * behavior.
+ */
+
+#if TFTP_DATASIZE > TFTP_DEFBLKSIZE || CONFIG_NETUTILS_TFTP_WINDOWSIZE > 1
+#  define TFTP_HAVE_OPTIONS   1
+#endif
+
 /* TFTP Opcodes *************************************************************/
 
 #define TFTP_RRQ  1  /* Read Request          RFC 1350, RFC 2090 */
@@ -172,7 +209,10 @@
 /* Defined in tftp_packet.c *************************************************/
 
 extern int tftp_sockinit(struct sockaddr_in *server, in_addr_t addr);
-extern int tftp_mkreqpacket(uint8_t *buffer, int opcode, const char *path, bool binary);
+extern int tftp_mkreqpacket(uint8_t *buffer, int opcode, const char *path,
+                            bool binary, bool options);
+extern int tftp_parseoack(const uint8_t *packet, int len, uint16_t *blksize,
+                          uint16_t *windowsize);
 extern int tftp_mkackpacket(uint8_t *buffer, uint16_t blockno);
 extern int tftp_mkerrpacket(uint8_t *buffer, uint16_t errorcode, const char *errormsg);
 #ifdef CONFIG_DEBUG_NET_WARN
@@ -181,6 +221,7 @@ extern int tftp_parseerrpacket(const uint8_t *packet);
 
 extern ssize_t tftp_recvfrom(int sd, void *buf, size_t len, struct sockaddr_in *from);
 extern ssize_t tftp_sendto(int sd, const void *buf, size_t len, struct sockaddr_in *to);
+extern ssize_t tftp_rcvpacket(int sd, uint8_t *packet, struct sockaddr_in *server);
 
 #ifdef CONFIG_NETUTILS_TFTP_DUMPBUFFERS
 # define tftp_dumpbuffer(msg, buffer, nbytes) ninfodumpbuffer(msg, buffer, nbytes)
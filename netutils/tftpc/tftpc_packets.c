@@ -46,6 +46,8 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
+#include <strings.h>
+#include <stdlib.h>
 #include <errno.h>
 #include <debug.h>
 
@@ -139,16 +141,104 @@ int tftp_sockinit(struct sockaddr_in *server, in_addr_t addr)
  *     N bytes: mode
  *     1 byte:  0
  *
+ *   If options is true, the blksize (RFC 2348) and windowsize (RFC 7440)
+ *   options are appended as pairs of NUL-terminated name and value strings
+ *   (RFC 2347).
+ *
  * Return
  *  Then number of bytes in the request packet (never fails)
  *
  ****************************************************************************/
 
-int tftp_mkreqpacket(uint8_t *buffer, int opcode, const char *path, bool binary)
+int tftp_mkreqpacket(uint8_t *buffer, int opcode, const char *path,
+                     bool binary, bool options)
 {
+  int len;
+
   buffer[0] = opcode >> 8;
   buffer[1] = opcode & 0xff;
-  return sprintf((char*)&buffer[2], "%s%c%s", path, 0, tftp_mode(binary)) + 3;
+  len = sprintf((char*)&buffer[2], "%s%c%s", path, 0, tftp_mode(binary)) + 3;
+
+  if (options)
+    {
+#if TFTP_DATASIZE > TFTP_DEFBLKSIZE
+      len += sprintf((char*)&buffer[len], "blksize%c%d", 0, TFTP_DATASIZE) + 1;
+#endif
+#if CONFIG_NETUTILS_TFTP_WINDOWSIZE > 1
+      len += sprintf((char*)&buffer[len], "windowsize%c%d", 0,
+                     CONFIG_NETUTILS_TFTP_WINDOWSIZE) + 1;
+#endif
+    }
+
+  return len;
+}
+
+/****************************************************************************
+ * Name: tftp_parseoack
+ *
+ * Description:
+ *   OACK message format:
+ *
+ *     2 bytes: Opcode (network order == big-endian)
+ *     N bytes: Option name
+ *     1 byte:  0
+ *     N bytes: Option value
+ *     1 byte:  0
+ *     ...
+ *
+ *   An option that the server leaves out keeps its RFC 1350 value.  The
+ *   server may only lower the values that were requested.
+ *
+ * Return
+ *   OK if all options were understood and acceptable; ERROR otherwise.
+ *
+ ****************************************************************************/
+
+int tftp_parseoack(const uint8_t *packet, int len, uint16_t *blksize,
+                   uint16_t *windowsize)
+{
+  FAR const char *name;
+  FAR const char *value;
+  FAR const char *end = (FAR const char *)&packet[len];
+  long num;
+
+  *blksize    = TFTP_STDDATASIZE;
+  *windowsize = 1;
+
+  name = (FAR const char *)&packet[2];
+  while (name < end)
+    {
+      /* Both strings must be NUL-terminated within the packet */
+
+      value = name + strnlen(name, end - name) + 1;
+      if (value >= end || value + strnlen(value, end - value) >= end)
+        {
+          nwarn("WARNING: Truncated OACK\n");
+          return ERROR;
+        }
+
+      num = strtol(value, NULL, 10);
+      if (strcasecmp(name, "blksize") == 0 && num >= 8 &&
+          num <= TFTP_DATASIZE)
+        {
+          *blksize = (uint16_t)num;
+        }
+      else if (strcasecmp(name, "windowsize") == 0 && num >= 1 &&
+               num <= CONFIG_NETUTILS_TFTP_WINDOWSIZE)
+        {
+          *windowsize = (uint16_t)num;
+        }
+      else
+        {
+          nwarn("WARNING: Bad option %s=%s\n", name, value);
+          return ERROR;
+        }
+
+      name = value + strlen(value) + 1;
+    }
+
+  ninfo("OACK blksize=%d windowsize=%d\n", *blksize, *windowsize);
+  return OK;
 }
 
 /****************************************************************************
@@ -328,4 +418,62 @@ ssize_t tftp_sendto(int sd, const void *buf, size_t len, struct sockaddr_in *to)
     }
 }
 
+/****************************************************************************
+ * Name: tftp_rcvpacket
+ *
+ * Description:
+ *   Receive the next packet from the server.  If the server port is still
+ *   zero, it is set to the port of the first packet from the server's
+ *   address; packets from any other port are answered with an error and
+ *   ignored, as are packets too short to hold an opcode and a block number.
+ *
+ * Return
+ *   The number of bytes received, or ERROR on a timeout or failure.
+ *
+ ****************************************************************************/
+
+ssize_t tftp_rcvpacket(int sd, uint8_t *packet, struct sockaddr_in *server)
+{
+  struct sockaddr_in from;
+  ssize_t nbytes;
+  int len;
+
+  for (;;)
+    {
+      nbytes = tftp_recvfrom(sd, packet, TFTP_IOBUFSIZE, &from);
+      if (nbytes < 0)
+        {
+          return ERROR;
+        }
+
+      /* Verify the sender address and port number */
+
+      if (server->sin_addr.s_addr != from.sin_addr.s_addr)
+        {
+          ninfo("Invalid address\n");
+          continue;
+        }
+
+      if (!server->sin_port)
+        {
+          server->sin_port = from.sin_port;
+        }
+      else if (server->sin_port != from.sin_port)
+        {
+          ninfo("Invalid port\n");
+          len = tftp_mkerrpacket(packet, TFTP_ERR_UNKID, TFTP_ERRST_UNKID);
+          (void)tftp_sendto(sd, packet, len, &from);
+          continue;
+        }
+
+      if (nbytes < TFTP_DATAHEADERSIZE)
+        {
+          ninfo("Tiny packet ignored\n");
+          continue;
+        }
+
+      return nbytes;
+    }
+}
+
 #endif /* CONFIG_NET && CONFIG_NET_UDP && CONFIG_NFILE_DESCRIPTORS */
@@ -125,21 +125,23 @@ static inline ssize_t tftp_read(int fd, uint8_t *buf, size_t buflen)
  *
  *     2 bytes: Opcode (network order == big-endian)
  *     2 bytes: Block number (network order == big-endian)
- *     N bytes: Data (where N <= 512)
+ *     N bytes: Data (where N <= blksize)
  *
  * Input Parameters:
  *   fd      - File descriptor used to read from the file
  *   offset  - File offset to read from
  *   packet  - Buffer to write the data packet into
  *   blockno - The block number of the packet
+ *   blksize - The negotiated block size
  *
  * Return Value:
- *   Number of bytes read into the packet. <TFTP_PACKETSIZE means end of file;
- *   <1 if an error occurs.
+ *   Number of bytes read into the packet. <blksize + TFTP_DATAHEADERSIZE
+ *   means end of file; <1 if an error occurs.
  *
  ****************************************************************************/
 
-int tftp_mkdatapacket(int fd, off_t offset, uint8_t *packet, uint16_t blockno)
+int tftp_mkdatapacket(int fd, off_t offset, uint8_t *packet, uint16_t blockno,
+                      uint16_t blksize)
 {
   off_t tmp;
   int nbytesread;
@@ -162,7 +164,7 @@ int tftp_mkdatapacket(int fd, off_t offset, uint8_t *packet, uint16_t blockno)
 
   /* Read the file data into the packet buffer */
 
-  nbytesread = tftp_read(fd, &packet[TFTP_DATAHEADERSIZE], TFTP_DATASIZE);
+  nbytesread = tftp_read(fd, &packet[TFTP_DATAHEADERSIZE], blksize);
   if (nbytesread < 0)
     {
       return ERROR;
@@ -181,9 +183,8 @@ int tftp_mkdatapacket(int fd, off_t offset, uint8_t *packet, uint16_t blockno)
  *
  * Input Parameters:
  *   sd      - Socket descriptor to use in in the transfer
- *   packet   - buffer to use for the tranfers
- *   server  - The address of the server
- *   port    - The port number of the server (0 if not yet known)
+ *   packet  - buffer to use for the tranfers
+ *   server  - The address of the server (port 0 if not yet known)
  *   blockno - Location to return block number in the received ACK
  *
  * Returned Value:
@@ -192,117 +193,45 @@ int tftp_mkdatapacket(int fd, off_t offset, uint8_t *packet, uint16_t blockno)
  ****************************************************************************/
 
 static int tftp_rcvack(int sd, uint8_t *packet, struct sockaddr_in *server,
-                       uint16_t *port, uint16_t *blockno)
+                       uint16_t *blockno)
 {
-  struct sockaddr_in from;     /* The address the last UDP message recv'd from */
-  ssize_t nbytes;              /* The number of bytes received. */
   uint16_t opcode;             /* The received opcode */
-  uint16_t rblockno;           /* The received block number */
   int packetlen;               /* Packet length */
-  int retry;                   /* Retry counter */
 
-  /* Try up to TFTP_RETRIES times */
+  /* Wait for one packet.  On a timeout the caller re-sends its data */
 
-  for (retry = 0; retry < TFTP_RETRIES; retry++)
+  if (tftp_rcvpacket(sd, packet, server) < 0)
     {
-      /* Try for until a valid ACK is received or some error occurs */
-
-      for (;;)
-        {
-          /* Receive the next UDP packet from the server */
-
-          nbytes = tftp_recvfrom(sd, packet, TFTP_IOBUFSIZE, &from);
-          if (nbytes < TFTP_ACKHEADERSIZE)
-            {
-              /* Failed to receive a good packet */
-
-              if (nbytes == 0)
-                {
-                  nerr("ERROR: Connection lost: %d bytes\n", nbytes);
-                }
-              else if (nbytes > 0)
-                {
-                  nerr("ERROR: Short packet: %d bytes\n", nbytes);
-                }
-              else
-                {
-                  nerr("ERROR: Recvfrom failure\n");
-                }
-
-              /* Break out to bump up the retry count */
-
-              break;
-            }
-          else
-            {
-               /* Get the port being used by the server if that has not yet been established */
-
-               if (!*port)
-                 {
-                   *port            = from.sin_port;
-                   server->sin_port = from.sin_port;
-                 }
-
-               /* Verify that the packet was received from the correct host and port */
-
-               if (server->sin_addr.s_addr != from.sin_addr.s_addr)
-                 {
-                   ninfo("Invalid address in DATA\n");
-                   continue;
-                 }
-
-              if (*port != server->sin_port)
-                {
-                  ninfo("Invalid port in DATA\n");
-                  packetlen = tftp_mkerrpacket(packet, TFTP_ERR_UNKID, TFTP_ERRST_UNKID);
-                  (void)tftp_sendto(sd, packet, packetlen, server);
-                  continue;
-                }
-
-              /* Parse the error message */
-
-               opcode   = (uint16_t)packet[0] << 8 | (uint16_t)packet[1];
-               rblockno = (uint16_t)packet[2] << 8 | (uint16_t)packet[3];
-
-              /* Verify that the message that we received is an ACK for the
-               * expected block number.
-               */
+      nerr("ERROR: Timeout, Waiting for ACK\n");
+      return ERROR;
+    }
 
-               if (opcode != TFTP_ACK)
-                 {
-                   nwarn("WARNING: Bad opcode\n");
+  opcode = (uint16_t)packet[0] << 8 | (uint16_t)packet[1];
+  if (opcode != TFTP_ACK)
+    {
+      nwarn("WARNING: Bad opcode\n");
 
 #ifdef CONFIG_DEBUG_NET_WARN
-                  if (opcode == TFTP_ERR)
-                    {
-                      (void)tftp_parseerrpacket(packet);
-                    }
-                  else
+      if (opcode == TFTP_ERR)
+        {
+          (void)tftp_parseerrpacket(packet);
+        }
+      else
 #endif
-                  if (opcode > TFTP_MAXRFC1350)
-                    {
-                      packetlen = tftp_mkerrpacket(packet, TFTP_ERR_ILLEGALOP, TFTP_ERRST_ILLEGALOP);
-                      (void)tftp_sendto(sd, packet, packetlen, server);
-                    }
-
-                  /* Break out an bump up the retry count */
-
-                  break;
-                }
-
-              /* Success! */
-
-              ninfo("Received ACK for block %d\n", rblockno);
-              *blockno = rblockno;
-              return OK;
-            }
+      if (opcode > TFTP_OACK)
+        {
+          packetlen = tftp_mkerrpacket(packet, TFTP_ERR_ILLEGALOP, TFTP_ERRST_ILLEGALOP);
+          (void)tftp_sendto(sd, packet, packetlen, server);
         }
+
+      return ERROR;
     }
 
-  /* We have tried TFTP_RETRIES times */
+  /* Success! */
 
-  nerr("ERROR: Timeout, Waiting for ACK\n");
-  return ERROR; /* Will never get here */
+  *blockno = (uint16_t)packet[2] << 8 | (uint16_t)packet[3];
+  ninfo("Received ACK for block %d\n", *blockno);
+  return OK;
 }
 
 /****************************************************************************
@@ -325,10 +254,20 @@ int tftpput(const char *local, const char *remote, in_addr_t addr, bool binary)
 {
   struct sockaddr_in server;         /* The address of the TFTP server */
   uint8_t *packet;                   /* Allocated memory to hold one packet */
-  off_t offset;                      /* Offset into source file */
-  uint16_t blockno;                  /* The current transfer block number */
+  off_t offset;                      /* File offset of block blockno */
+  uint16_t blockno;                  /* The first unacknowledged block */
   uint16_t rblockno;                 /* The ACK'ed block number */
-  uint16_t port = 0;                 /* This is the port number for the transfer */
+  uint16_t blksize;                  /* The negotiated block size */
+  uint16_t windowsize;               /* The negotiated blocks per ACK */
+  uint16_t nsent;                    /* Blocks sent in this window */
+  uint16_t nacked;                   /* Blocks of the window ACK'ed */
+  uint16_t opcode;                   /* Received opcode */
+  bool options;                      /* True: Request options */
+  bool eof;                          /* True: Last block is in the window */
+  bool resend;                       /* True: (Re-)send the window */
+  bool nakok;                        /* True: Resend on an ACK of blockno-1 */
+  uint16_t ndups;                    /* ACKs of blockno-1 ignored */
+  ssize_t nbytes;                    /* The number of bytes received */
   int packetlen;                     /* The length of the data packet */
   int sd;                            /* Socket descriptor for socket I/O */
   int fd;                            /* File descriptor for file I/O */
@@ -367,31 +306,83 @@ int tftpput(const char *local, const char *remote, in_addr_t addr, bool binary)
    * to be done several times because (1) UDP is inherenly unreliable
    * and packets may be lost normally, and (2) uIP has a nasty habit
    * of droppying packets if there is nothing hit in the ARP table.
+   *
+   * The server answers with an OACK if it accepted some of the options,
+   * or with ACK 0 if it ignored them.
    */
 
-  blockno = 1;
-  retry   = 0;
+#ifdef TFTP_HAVE_OPTIONS
+  options    = true;
+#else
+  options    = false;
+#endif
+  blksize    = TFTP_STDDATASIZE;
+  windowsize = 1;
+  retry      = 0;
+
   for (;;)
     {
-      packetlen = tftp_mkreqpacket(packet, TFTP_WRQ, remote, binary);
+      packetlen       = tftp_mkreqpacket(packet, TFTP_WRQ, remote, binary,
+                                         options);
+      server.sin_port = HTONS(CONFIG_NETUTILS_TFTP_PORT);
       ret = tftp_sendto(sd, packet, packetlen, &server);
       if (ret != packetlen)
         {
           goto errout_with_sd;
         }
 
-      /* Receive the ACK for the write request */
+      /* Receive the response from the port selected by the server */
 
-      if (tftp_rcvack(sd, packet, &server, &port, NULL) == 0)
+      server.sin_port = 0;
+      nbytes = tftp_rcvpacket(sd, packet, &server);
+      if (nbytes >= 0)
         {
-          break;
+          opcode = (uint16_t)packet[0] << 8 | (uint16_t)packet[1];
+          if (opcode == TFTP_OACK && options)
+            {
+              if (tftp_parseoack(packet, nbytes, &blksize,
+                                 &windowsize) != OK)
+                {
+                  packetlen = tftp_mkerrpacket(packet, TFTP_ERR_NEGOTIATE,
+                                               TFTP_ERRST_NEGOTIATE);
+                  (void)tftp_sendto(sd, packet, packetlen, &server);
+                  goto errout_with_sd;
+                }
+
+              break;
+            }
+
+          if (opcode == TFTP_ACK)
+            {
+              /* The server ignored the options */
+
+              break;
+            }
+
+          if (opcode == TFTP_ERR)
+            {
+#ifdef CONFIG_DEBUG_NET_WARN
+              (void)tftp_parseerrpacket(packet);
+#endif
+              if (!options)
+                {
+                  goto errout_with_sd;
+                }
+
+              /* Some servers reject requests that carry options */
+
+              nwarn("WARNING: Request refused, retrying without options\n");
+              options = false;
+              retry   = 0;
+              continue;
+            }
         }
 
       nwarn("WARNING: Re-sending request\n");
 
       /* We are going to loop and re-send the request packet. Check the
        * retry count so that we do not loop forever.
-        */
+       */
 
       if (++retry > TFTP_RETRIES)
         {
@@ -401,65 +392,102 @@ int tftpput(const char *local, const char *remote, in_addr_t addr, bool binary)
         }
     }
 
-  /* Then loop sending the entire file to the server in chunks */
+  /* Then loop sending the entire file to the server in windows of
+   * windowsize blocks.  The server ACKs the last block of a window that it
+   * received in order; the window then restarts after that block.
+   */
 
-  offset     = 0;
-  retry      = 0;
+  blockno = 1;
+  offset  = 0;
+  retry   = 0;
+  nakok   = true;
+  ndups   = 0;
+  resend  = true;
+  nsent   = 0;
+  eof     = false;
 
   for (;;)
     {
-      /* Construct the next data packet */
+      /* Send the next window of data chunks */
 
-      packetlen = tftp_mkdatapacket(fd, offset, packet, blockno);
-      if (packetlen < 0)
+      if (resend)
         {
-          goto errout_with_sd;
-        }
+          eof = false;
+          for (nsent = 0; nsent < windowsize && !eof; nsent++)
+            {
+              packetlen = tftp_mkdatapacket(fd, offset + (off_t)nsent * blksize,
+                                            packet, blockno + nsent, blksize);
+              if (packetlen < 0)
+                {
+                  goto errout_with_sd;
+                }
 
-      /* Send the next data chunk */
+              ret = tftp_sendto(sd, packet, packetlen, &server);
+              if (ret != packetlen)
+                {
+                  goto errout_with_sd;
+                }
 
-      ret = tftp_sendto(sd, packet, packetlen, &server);
-      if (ret != packetlen)
-        {
-          goto errout_with_sd;
+              eof = (packetlen < blksize + TFTP_DATAHEADERSIZE);
+            }
         }
 
-      /* Check for an ACK for the data chunk */
+      resend = true;
 
-      if (tftp_rcvack(sd, packet, &server, &port, &rblockno) == OK)
+      /* Check for an ACK of the window */
+
+      if (tftp_rcvack(sd, packet, &server, &rblockno) == OK)
         {
-          /* Check if the packet that we just sent was ACK'ed.  If not,
-           * we just loop to resend the same packet (same blockno, same
-           * file offset).
-           */
+          /* Count the blocks of this window that were ACK'ed */
 
-          if (rblockno == blockno)
+          nacked = (uint16_t)(rblockno - blockno + 1);
+          if (nacked >= 1 && nacked <= nsent)
             {
-               /* Yes.. If we are at the end of the file and if all of the packets
-                * have been ACKed, then we are done.
-                */
+              /* If the last block of the file was ACK'ed, we are done */
 
-              if (packetlen < TFTP_PACKETSIZE)
+              if (eof && nacked == nsent)
                 {
                   break;
                 }
 
-               /* Not the last block.. set up for the next block */
+              /* Set up for the blocks after the last one ACK'ed */
 
-               blockno++;
-               offset += TFTP_DATASIZE;
-               retry  = 0;
+              blockno += nacked;
+              offset  += (off_t)nacked * blksize;
+              retry    = 0;
+              nakok    = true;
+              ndups    = 0;
 
-               /* Skip the retry test */
+              /* Skip the retry test */
 
-               continue;
+              continue;
             }
+
+          /* An ACK of the block before the window means that the server
+           * lost the start of it: resend the same window (same blockno,
+           * same file offset).  The server may send that ACK for each
+           * block of the window that arrived out of order, so after one
+           * resend, up to windowsize - 1 more are ignored.  ACKs of older
+           * blocks are always ignored.
+           */
+
+          if (nacked == 0 && (nakok || ++ndups >= windowsize))
+            {
+              nakok = false;
+              ndups = 0;
+              continue;
+            }
+
+          resend = false;
+          continue;
         }
 
-      /* We are going to loop and re-send the data packet. Check the retry
+      /* We are going to loop and re-send the window. Check the retry
        * count so that we do not loop forever.
        */
 
+      nakok = true;
+      ndups = 0;
       if (++retry > TFTP_RETRIES)
         {
           nerr("ERROR: Retry count exceeded\n");
@@ -133,6 +133,14 @@
 #    define CONFIG_THTTPD_CGI_TIMELIMIT 0 /* No time limit */
 #  endif
 
+/* The number of persistent CGI worker threads */
+
+#  ifdef CONFIG_THTTPD_CGI_POOL
+#    ifndef CONFIG_THTTPD_CGI_POOLSIZE
+#      define CONFIG_THTTPD_CGI_POOLSIZE 2
+#    endif
+#  endif
+
 /* The default character set name to use with text MIME types. */
 
 #  ifndef CONFIG_THTTPD_CHARSET
@@ -145,6 +153,41 @@
 #    define CONFIG_THTTPD_IOBUFFERSIZE 256
 #  endif
 
+#  ifndef CONFIG_THTTPD_SENDFILE_CHUNKSIZE
+#    define CONFIG_THTTPD_SENDFILE_CHUNKSIZE 4096
+#  endif
+
+/* The URL of the statistics report */
+
+#  if defined(CONFIG_THTTPD_STATS) && !defined(CONFIG_THTTPD_STATS_URL)
+#    define CONFIG_THTTPD_STATS_URL "server-status"
+#  endif
+
+/* Directory listings */
+
+#  ifdef CONFIG_THTTPD_GENERATE_INDICES
+#    ifndef CONFIG_THTTPD_INDEX_CACHESIZE
+#      define CONFIG_THTTPD_INDEX_CACHESIZE 2
+#    endif
+#    ifndef CONFIG_THTTPD_INDEX_PAGESIZE
+#      define CONFIG_THTTPD_INDEX_PAGESIZE 0
+#    endif
+#  endif
+
+/* Server-side-includes templates run by the server */
+
+#  ifdef CONFIG_THTTPD_SSI
+#    ifndef CONFIG_THTTPD_SSI_PATTERN
+#      define CONFIG_THTTPD_SSI_PATTERN "**.shtml"
+#    endif
+#    ifndef CONFIG_THTTPD_SSI_CACHESIZE
+#      define CONFIG_THTTPD_SSI_CACHESIZE 4
+#    endif
+#    ifndef CONFIG_THTTPD_SSI_MAXSIZE
+#      define CONFIG_THTTPD_SSI_MAXSIZE 8192
+#    endif
+#  endif
+
 #  ifndef CONFIG_THTTPD_MINSTRSIZE
 #   define CONFIG_THTTPD_MINSTRSIZE 64
 #  endif
@@ -169,6 +212,15 @@
 #    error "Can't use uint16_t for buffer size"
 #  endif
 
+/* The response headers are built in the I/O buffer.  With the additional
+ * Content-Encoding and Vary headers of compressed files, they no longer
+ * fit in the default 256 bytes.
+ */
+
+#  if defined(CONFIG_THTTPD_GZIP) && CONFIG_THTTPD_IOBUFFERSIZE < 384
+#    warning "CONFIG_THTTPD_IOBUFFERSIZE too small for CONFIG_THTTPD_GZIP headers"
+#  endif
+
 /* A list of index filenames to check. The files are searched for in this order. */
 
 #  ifndef CONFIG_THTTPD_INDEX_NAMES
@@ -42,7 +42,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
-#include <debug.h>
+#include <string.h>
 #include <poll.h>
 #include <debug.h>
 
@@ -82,6 +82,17 @@
 #  define MIN(a,b) ((a) < (b) ? (a) : (b))
 #endif
 
+/* The fd-to-poll index map must be able to hold every descriptor number
+ * that may be watched:  Both file descriptors (CGI pipes) and socket
+ * descriptors (which are numbered after the file descriptors).
+ */
+
+#define FDW_MAXFD   (CONFIG_NFILE_DESCRIPTORS + CONFIG_NSOCKET_DESCRIPTORS)
+
+/* Marks an fd that is not in the poll list */
+
+#define FDW_NOINDEX 0xff
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -117,22 +128,28 @@ static void fdwatch_dump(const char *msg, FAR struct fdwatch_s *fw)
 #  define fdwatch_dump(m,f)
 #endif
 
+/* Get the poll table index of a watched descriptor, or -1 if it is not
+ * watched.  That is not an error:  A descriptor in the ready list may have
+ * been removed while the list was being visited.
+ */
+
 static int fdwatch_pollndx(FAR struct fdwatch_s *fw, int fd)
 {
   int pollndx;
 
   /* Get the index associated with the fd */
 
-  for (pollndx = 0; pollndx < fw->nwatched; pollndx++)
+  if (fd >= 0 && fd < FDW_MAXFD)
     {
-      if (fw->pollfds[pollndx].fd == fd)
+      pollndx = fw->fdndx[fd];
+      if (pollndx != FDW_NOINDEX)
         {
           fwinfo("pollndx: %d\n", pollndx);
           return pollndx;
         }
     }
 
-  fwerr("ERROR: No poll index for fd %d: %d\n", fd);
+  fwinfo("No poll index for fd %d\n", fd);
   return -1;
 }
 
@@ -177,6 +194,14 @@ struct fdwatch_s *fdwatch_initialize(int nfds)
       goto errout_with_allocations;
     }
 
+  fw->fdndx = (uint8_t*)httpd_malloc(sizeof(uint8_t) * FDW_MAXFD);
+  if (!fw->fdndx)
+    {
+      goto errout_with_allocations;
+    }
+
+  memset(fw->fdndx, FDW_NOINDEX, sizeof(uint8_t) * FDW_MAXFD);
+
   fdwatch_dump("Initial state:", fw);
   return fw;
 
@@ -207,6 +232,11 @@ void fdwatch_uninitialize(struct fdwatch_s *fw)
           httpd_free(fw->ready);
         }
 
+      if (fw->fdndx)
+        {
+          httpd_free(fw->fdndx);
+        }
+
       httpd_free(fw);
     }
 }
@@ -224,11 +254,19 @@ void fdwatch_add_fd(struct fdwatch_s *fw, int fd, void *client_data)
       return;
     }
 
+  if (fd < 0 || fd >= FDW_MAXFD)
+    {
+      fwerr("ERROR: fd %d out of range\n", fd);
+      return;
+    }
+
   /* Save the new fd at the end of the list */
 
-  fw->pollfds[fw->nwatched].fd     = fd;
-  fw->pollfds[fw->nwatched].events = POLLIN;
-  fw->client[fw->nwatched]         = client_data;
+  fw->pollfds[fw->nwatched].fd      = fd;
+  fw->pollfds[fw->nwatched].events  = POLLIN;
+  fw->pollfds[fw->nwatched].revents = 0;
+  fw->client[fw->nwatched]          = client_data;
+  fw->fdndx[fd]                     = fw->nwatched;
 
   /* Increment the count of watched descriptors */
 
@@ -253,6 +291,7 @@ void fdwatch_del_fd(struct fdwatch_s *fw, int fd)
       /* Decrement the number of fds in the poll table */
 
       fw->nwatched--;
+      fw->fdndx[fd] = FDW_NOINDEX;
 
       /* Replace the deleted one with the one at the end
        * of the list.
@@ -262,6 +301,7 @@ void fdwatch_del_fd(struct fdwatch_s *fw, int fd)
         {
           fw->pollfds[pollndx] = fw->pollfds[fw->nwatched];
           fw->client[pollndx]  = fw->client[fw->nwatched];
+          fw->fdndx[fw->pollfds[pollndx].fd] = pollndx;
         }
     }
    fdwatch_dump("After deleting:", fw);
@@ -345,17 +385,28 @@ int fdwatch_check_fd(struct fdwatch_s *fw, int fd)
   return 0;
 }
 
+/* Get the client data for the next returned event.  Only the descriptors
+ * collected in the ready list by fdwatch() are visited; descriptors that
+ * were removed from the watch list since then are skipped.
+ */
+
 void *fdwatch_get_next_client_data(struct fdwatch_s *fw)
 {
+  int pollndx;
+
   fdwatch_dump("Before getting client data:", fw);
-  if (fw->next >= fw->nwatched)
+  while (fw->next < fw->nactive)
     {
-      fwinfo("All client data returned: %d\n", fw->next);
-      return (void*)-1;
+      pollndx = fdwatch_pollndx(fw, fw->ready[fw->next++]);
+      if (pollndx >= 0)
+        {
+          fwinfo("client_data[%d]: %p\n", pollndx, fw->client[pollndx]);
+          return fw->client[pollndx];
+        }
     }
 
-  fwinfo("client_data[%d]: %p\n", fw->next, fw->client[fw->next]);
-  return fw->client[fw->next++];
+  fwinfo("All client data returned: %d\n", fw->next);
+  return (void*)-1;
 }
 
 #endif /* CONFIG_THTTPD */
@@ -64,6 +64,7 @@ struct fdwatch_s
   struct pollfd *pollfds;          /* Poll data (allocated) */
   void         **client;           /* Client data (allocated) */
   uint8_t       *ready;            /* The list of fds with activity (allocated) */
+  uint8_t       *fdndx;            /* Map of fd to poll index (allocated) */
   uint8_t        nfds;             /* The configured maximum number of fds */
   uint8_t        nwatched;         /* The number of fds currently watched */
   uint8_t        nactive;          /* The number of fds with activity */
@@ -54,7 +54,6 @@
 #include <stdarg.h>
 #include <ctype.h>
 #include <fcntl.h>
-#include <dirent.h>
 #include <signal.h>
 #include <sched.h>
 #include <errno.h>
@@ -71,6 +70,9 @@
 #include "thttpd_cgi.h"
 #include "tdate_parse.h"
 #include "fdwatch.h"
+#include "thttpd_stats.h"
+#include "thttpd_ssi.h"
+#include "thttpd_dirlist.h"
 
 #ifdef CONFIG_THTTPD
 
@@ -88,8 +90,6 @@
 #  define STDERR_FILENO 2
 #endif
 
-#define NAMLEN(dirent) strlen((dirent)->d_name)
-
 extern CODE char *crypt(const char *key, const char *setting);
 
 #ifndef MAX
@@ -155,7 +155,6 @@ static void de_dotdot(char *file);
 static void init_mime(void);
 static void figure_mime(httpd_conn *hc);
 #ifdef CONFIG_THTTPD_GENERATE_INDICES
-static void ls_child(int argc, char **argv);
 static int  ls(httpd_conn *hc);
 #endif
 #ifdef SERVER_NAME_LIST
@@ -172,6 +171,12 @@ static int  sockaddr_check(httpd_sockaddr *saP);
 #  define sockaddr_check(saP) (1)
 #endif
 static size_t sockaddr_len(httpd_sockaddr *saP);
+#ifdef CONFIG_THTTPD_SSI
+static int  send_ssi(httpd_conn *hc);
+#endif
+#ifdef CONFIG_THTTPD_STATS
+static int  send_stats(httpd_conn *hc);
+#endif
 
 /****************************************************************************
  * Private Data
@@ -192,6 +197,17 @@ static pid_t main_thread;
 
 #include "mime_types.h"
 
+/* Extra headers sent with static files.  When precompressed variants may
+ * be served, caches must know that the response depends on the request's
+ * Accept-Encoding.
+ */
+
+#ifdef CONFIG_THTTPD_GZIP
+#  define FILE_EXTRAHEADS "Vary: Accept-Encoding\r\n"
+#else
+#  define FILE_EXTRAHEADS ""
+#endif
+
 /* Names for index file */
 
 static const char *index_names[]   = { CONFIG_THTTPD_INDEX_NAMES };
@@ -322,6 +338,9 @@ static void send_mime(httpd_conn *hc, int status, const char *title, const char
   int partial_content;
   int s100;
 
+#ifdef CONFIG_THTTPD_STATS
+  hc->status        = status;
+#endif
   hc->bytes_to_send = length;
   if (hc->mime_flag)
     {
@@ -1427,6 +1446,96 @@ static void init_mime(void)
  * which they were applied to the file.
  */
 
+#ifdef CONFIG_THTTPD_GZIP
+/* Check if the client accepts the gzip content coding.  A q-value of zero
+ * explicitly refuses it.
+ */
+
+static bool accepts_gzip(const char *accepte)
+{
+  const char *cp = accepte;
+  const char *end;
+  const char *q;
+  size_t len;
+
+  while (*cp != '\0')
+    {
+      cp += strspn(cp, " \t,");
+      end = cp + strcspn(cp, ",");
+      len = strcspn(cp, " \t;,");
+
+      if ((len == 4 && strncasecmp(cp, "gzip", 4) == 0) ||
+          (len == 6 && strncasecmp(cp, "x-gzip", 6) == 0))
+        {
+          q = strstr(cp, "q=");
+          if (q == NULL || q > end)
+            {
+              return true;
+            }
+
+          /* Only "0", "0.", "0.0", ... refuse the coding */
+
+          q += 2;
+          if (*q != '0')
+            {
+              return true;
+            }
+
+          q++;
+          if (*q == '.')
+            {
+              q += 1 + strspn(q + 1, "0");
+            }
+
+          return *q >= '1' && *q <= '9';
+        }
+
+      cp = end;
+    }
+
+  return false;
+}
+
+/* If the client accepts gzip and a file with a .gz extension exists next to
+ * the requested one, switch to that file.  figure_mime() then derives the
+ * content type from the original name and Content-Encoding from ".gz".
+ */
+
+static void gzip_variant(httpd_conn *hc)
+{
+  struct stat sb;
+  size_t len;
+
+  len = strlen(hc->expnfilename);
+  if (len > 3 && strcmp(&hc->expnfilename[len - 3], ".gz") == 0)
+    {
+      /* The compressed file was requested explicitly */
+
+      return;
+    }
+
+  if (!accepts_gzip(hc->accepte))
+    {
+      return;
+    }
+
+  httpd_realloc_str(&hc->expnfilename, &hc->maxexpnfilename, len + 3);
+  (void)strcpy(&hc->expnfilename[len], ".gz");
+
+  if (stat(hc->expnfilename, &sb) < 0 || !S_ISREG(sb.st_mode) ||
+      (sb.st_mode & S_IXOTH) != 0)
+    {
+      /* No usable compressed variant */
+
+      hc->expnfilename[len] = '\0';
+      return;
+    }
+
+  ninfo("Serving %s\n", hc->expnfilename);
+  hc->sb = sb;
+}
+#endif
+
 static void figure_mime(httpd_conn *hc)
 {
   char *prev_dot;
@@ -1537,355 +1646,50 @@ done:
     }
 }
 
-/* qsort comparison routine. */
-
 #ifdef CONFIG_THTTPD_GENERATE_INDICES
-static int name_compare(FAR const void *a, FAR const void *b)
-{
-  return strcmp(*((FAR char **)a), *((FAR char **)b));
-}
+/* Send a directory listing.  The listing is written directly to the
+ * connection as it is produced, so its length is not sent.
+ */
 
-static void ls_child(int argc, char **argv)
+static int ls(httpd_conn *hc)
 {
-  FAR httpd_conn *hc = (FAR httpd_conn*)strtoul(argv[1], NULL, 16);
-  DIR *dirp;
-  struct dirent *de;
-  int namlen;
-  static int maxnames = 0;
-  int oldmax;
-  int nnames;
-  static char *names;
-  static char **nameptrs;
-  static char *name;
-  static size_t maxname = 0;
-  static char *rname;
-  static size_t maxrname = 0;
-  static char *encrname;
-  static size_t maxencrname = 0;
-  FILE *fp;
+  FAR struct dirlist_s *dl;
   struct stat sb;
-  char modestr[20];
-  char *linkprefix;
-#if 0
-  char link[PATH_MAX + 1];
-#else
-  char link[1];
-#endif
-  char *fileclass;
-  time_t now;
-  char *timestr;
-  int i;
-
-  httpd_unlisten(hc->hs);
-  send_mime(hc, 200, ok200title, "", "", "text/html; charset=%s",
-            (off_t) - 1, hc->sb.st_mtime);
-  httpd_write_response(hc);
 
-  /* Open a stdio stream so that we can use fprintf, which is more
-   * efficient than a bunch of separate write()s.  We don't have to
-   * worry about double closes or file descriptor leaks cause we're
-   * in a sub-task.
-   */
-
-  fp = fdopen(hc->conn_fd, "w");
-  if (fp == NULL)
+  if (hc->method != METHOD_GET && hc->method != METHOD_HEAD)
     {
-      nerr("ERROR: fdopen: %d\n", errno);
-      INTERNALERROR("fdopen");
-      httpd_send_err(hc, 500, err500title, "", err500form, hc->encodedurl);
-      httpd_write_response(hc);
-      closedir(dirp);
-      exit(1);
+      NOTIMPLEMENTED(httpd_method_str(hc->method));
+      httpd_send_err(hc, 501, err501title, "", err501form, httpd_method_str(hc->method));
+      return -1;
     }
 
-  fputs(html_html, fp);
-  fputs(html_hdtitle, fp);
-  (void)fprintf(fp, "Index of %s", hc->encodedurl, hc->encodedurl);
-  fputs(html_titlehd, fp);
-  fputs(html_body, fp);
-  fputs(html_hdr2, fp);
-  (void)fprintf(fp, "Index of %s", hc->encodedurl, hc->encodedurl);
-  fputs(html_endhdr2, fp);
-  fputs(html_crlf, fp);
-  fputs("<PRE>\r\nmode  links  bytes  last-changed  name\r\n<HR>", fp);
-
-  /* Read in names. */
-
-  nnames = 0;
-  while ((de = readdir(dirp)) != 0)     /* dirent or direct */
+  dl = NULL;
+  if (stat(hc->expnfilename, &sb) >= 0)
     {
-      if (nnames >= maxnames)
-        {
-          if (maxnames == 0)
-            {
-              maxnames = 100;
-              names    = NEW(char, maxnames * (PATH_MAX + 1));
-              nameptrs = NEW(char*, maxnames);
-            }
-          else
-            {
-              oldmax    = maxnames;
-              maxnames *= 2;
-              names     = RENEW(names, char, oldmax*(PATH_MAX+1), maxnames*(PATH_MAX + 1));
-              nameptrs  = RENEW(nameptrs, char*, oldmax, maxnames);
-            }
-
-          if (!names || !nameptrs)
-            {
-              nerr("ERROR: out of memory reallocating directory names\n");
-              exit(1);
-            }
-
-          for (i = 0; i < maxnames; ++i)
-            {
-              nameptrs[i] = &names[i * (PATH_MAX + 1)];
-            }
-        }
-
-      namlen = NAMLEN(de);
-      (void)strncpy(nameptrs[nnames], de->d_name, namlen);
-      nameptrs[nnames][namlen] = '\0';
-      ++nnames;
+      dl = thttpd_dirlist_open(hc->expnfilename, &sb);
     }
 
-  closedir(dirp);
-
-  /* Sort the names. */
-
-  qsort(nameptrs, nnames, sizeof(*nameptrs), name_compare);
-
-  /* Generate output. */
-
-  for (i = 0; i < nnames; ++i)
+  if (dl == NULL)
     {
-      httpd_realloc_str(&name, &maxname,
-                        strlen(hc->expnfilename) + 1 +
-                        strlen(nameptrs[i]));
-      httpd_realloc_str(&rname, &maxrname,
-                        strlen(hc->origfilename) + 1 +
-                        strlen(nameptrs[i]));
-
-      if (hc->expnfilename[0] == '\0' || strcmp(hc->expnfilename, ".") == 0)
-        {
-          (void)strcpy(name, nameptrs[i]);
-          (void)strcpy(rname, nameptrs[i]);
-        }
-      else
-        {
-          (void)snprintf(name, maxname, "%s/%s", hc->expnfilename, nameptrs[i]);
-          if (strcmp(hc->origfilename, ".") == 0)
-            {
-              (void)snprintf(rname, maxrname, "%s", nameptrs[i]);
-            }
-          else
-            {
-              (void)snprintf(rname, maxrname, "%s%s", hc->origfilename, nameptrs[i]);
-            }
-        }
-
-      httpd_realloc_str(&encrname, &maxencrname, 3 * strlen(rname) + 1);
-      httpd_strencode(encrname, maxencrname, rname);
-
-      if (stat(name, &sb) < 0)
-        {
-          continue;
-        }
-
-      linkprefix = "";
-      link[0] = '\0';
-
-      /* Break down mode word.  First the file type. */
-
-      switch (sb.st_mode & S_IFMT)
-        {
-        case S_IFIFO:
-          modestr[0] = 'p';
-          break;
-
-        case S_IFCHR:
-          modestr[0] = 'c';
-          break;
-
-        case S_IFDIR:
-          modestr[0] = 'd';
-          break;
-
-        case S_IFBLK:
-          modestr[0] = 'b';
-          break;
-
-        case S_IFREG:
-          modestr[0] = '-';
-          break;
-
-        case S_IFSOCK:
-          modestr[0] = 's';
-          break;
-
-        case S_IFLNK:
-        default:
-          modestr[0] = '?';
-          break;
-        }
-
-      /* Now the world permissions.  Owner and group permissions are
-       * not of interest to web clients.
-       */
-
-      modestr[1] = (sb.st_mode & S_IROTH) ? 'r' : '-';
-      modestr[2] = (sb.st_mode & S_IWOTH) ? 'w' : '-';
-      modestr[3] = (sb.st_mode & S_IXOTH) ? 'x' : '-';
-      modestr[4] = '\0';
-
-      /* We also leave out the owner and group name */
-
-      /* Get time string. */
-
-      now = time(NULL);
-      timestr = ctime(&sb.st_mtime);
-      timestr[0] = timestr[4];
-      timestr[1] = timestr[5];
-      timestr[2] = timestr[6];
-      timestr[3] = ' ';
-      timestr[4] = timestr[8];
-      timestr[5] = timestr[9];
-      timestr[6] = ' ';
-
-      if (now - sb.st_mtime > 60 * 60 * 24 * 182)      /* 1/2 year */
-        {
-          timestr[7] = ' ';
-          timestr[8] = timestr[20];
-          timestr[9] = timestr[21];
-          timestr[10] = timestr[22];
-          timestr[11] = timestr[23];
-        }
-      else
-        {
-          timestr[7] = timestr[11];
-          timestr[8] = timestr[12];
-          timestr[9] = ':';
-          timestr[10] = timestr[14];
-          timestr[11] = timestr[15];
-        }
-      timestr[12] = '\0';
-
-      /* The ls -F file class. */
-
-      switch (sb.st_mode & S_IFMT)
-        {
-        case S_IFDIR:
-          fileclass = "/";
-          break;
-
-        case S_IFSOCK:
-          fileclass = "=";
-          break;
-
-        case S_IFLNK:
-          fileclass = "@";
-          break;
-
-        default:
-          fileclass = (sb.st_mode & S_IXOTH) ? "*" : "";
-          break;
-        }
-
-      /* And print. */
-
-      (void)fprintf(fp,
-                    "%s %3ld  %10lld  %s  <A HREF=\"/%.500s%s\">%s</A>%s%s%s\n",
-                    modestr, 0, (int16_t)sb.st_size, timestr, encrname,
-                    S_ISDIR(sb.st_mode) ? "/" : "", nameptrs[i], linkprefix,
-                    link, fileclass);
-    }
-
-  fputs("</PRE>", fp);
-  fputs(html_endbody, fp);
-  fputs(html_endhtml, fp);
-  (void)fclose(fp);
-  exit(0);
-}
-
-static int ls(httpd_conn *hc)
-{
-  DIR *dirp;
-  int child;
-  char arg[16];
-  char *argv[1];
-#if CONFIG_THTTPD_CGI_TIMELIMIT > 0
-  ClientData client_data;
-#endif
-
-  dirp = opendir(hc->expnfilename);
-  if (dirp == NULL)
-    {
-      nerr("ERROR: opendir %s: %d\n", hc->expnfilename, errno);
       httpd_send_err(hc, 404, err404title, "", err404form, hc->encodedurl);
       return -1;
     }
 
-  if (hc->method == METHOD_HEAD)
+  hc->got_range = false;
+  send_mime(hc, 200, ok200title, "", "", "text/html; charset=%s",
+            (off_t) - 1, sb.st_mtime);
+  httpd_write_response(hc);
+
+  if (hc->method == METHOD_GET)
     {
-      closedir(dirp);
-      send_mime(hc, 200, ok200title, "", "", "text/html; charset=%s",
-                (off_t) - 1, hc->sb.st_mtime);
+      hc->bytes_sent = thttpd_dirlist_render(hc, dl);
     }
-  else if (hc->method == METHOD_GET)
-    {
-#ifdef CONFIG_THTTPD_CGILIMIT
-      if (hc->hs->cgi_count >= CONFIG_THTTPD_CGILIMIT)
-        {
-          closedir(dirp);
-          httpd_send_err(hc, 503, httpd_err503title, "", httpd_err503form,
-                         hc->encodedurl);
-          return -1;
-        }
-#endif
-      ++hc->hs->cgi_count;
-
-      /* Start the child task. */
-
-      snprintf(arg, 16, "%p", hc); /* task_create doesn't handle binary arguments. */
-      argv[0] = arg;
-
-      child = task_create("CGI child", CONFIG_THTTPD_CGI_PRIORITY,
-                          CONFIG_THTTPD_CGI_STACKSIZE,
-                          (main_t)ls_child, (FAR char * const *)argv);
-      if (child < 0)
-        {
-          nerr("ERROR: task_create: %d\n", errno);
-          closedir(dirp);
-          INTERNALERROR("task_create");
-          httpd_send_err(hc, 500, err500title, "", err500form, hc->encodedurl);
-          return -1;
-        }
 
-      closedir(dirp);
-      nerr("ERROR: spawned indexing task %d for directory '%s'\n",
-           child, hc->expnfilename);
+  thttpd_dirlist_close(dl);
 
-      /* Schedule a kill for the child task, in case it runs too long */
-
-#if CONFIG_THTTPD_CGI_TIMELIMIT > 0
-      client_data.i = child;
-      if (tmr_create(NULL, cgi_kill, client_data, CONFIG_THTTPD_CGI_TIMELIMIT * 1000L, 0) == NULL)
-        {
-          nerr("ERROR: tmr_create(cgi_kill ls) failed\n");
-          exit(1);
-        }
-#endif
-
-      hc->bytes_sent = CONFIG_THTTPD_CGI_BYTECOUNT;
-      hc->should_linger = false;
-    }
-  else
-    {
-      closedir(dirp);
-      NOTIMPLEMENTED(httpd_method_str(hc->method));
-      httpd_send_err(hc, 501, err501title, "", err501form, httpd_method_str(hc->method));
-      return -1;
-    }
+  /* Nothing is left for the main loop to send */
 
+  hc->file_fd = -1;
   return 0;
 }
 #endif /* CONFIG_THTTPD_GENERATE_INDICES */
@@ -2078,6 +1882,82 @@ static size_t sockaddr_len(httpd_sockaddr *saP)
   return 0;
 }
 
+#ifdef CONFIG_THTTPD_STATS
+/* Send the server statistics report.  It is written directly to the
+ * connection because it does not fit in the response buffer.
+ */
+
+static int send_stats(httpd_conn *hc)
+{
+  FAR char *report;
+  int len;
+
+  report = (FAR char *)httpd_malloc(THTTPD_STATS_REPORTLEN);
+  if (!report)
+    {
+      INTERNALERROR("stats");
+      httpd_send_err(hc, 500, err500title, "", err500form, hc->encodedurl);
+      return -1;
+    }
+
+  len = thttpd_stats_format(report, THTTPD_STATS_REPORTLEN);
+
+  hc->got_range = false;
+  send_mime(hc, 200, ok200title, "", "", "text/plain; charset=%s",
+            (off_t)len, (time_t)0);
+  httpd_write_response(hc);
+
+  if (hc->method != METHOD_HEAD &&
+      httpd_write(hc->conn_fd, report, len) == len)
+    {
+      hc->bytes_sent = len;
+    }
+
+  httpd_free(report);
+
+  /* Nothing is left for the main loop to send */
+
+  hc->file_fd = -1;
+  return 0;
+}
+#endif
+
+#ifdef CONFIG_THTTPD_SSI
+/* Run a server-side-includes template.  The output is written directly to
+ * the connection as it is produced, so its length is not sent.
+ */
+
+static int send_ssi(httpd_conn *hc)
+{
+  FAR struct ssi_template_s *tpl;
+
+  tpl = thttpd_ssi_open(hc->expnfilename, &hc->sb);
+  if (!tpl)
+    {
+      INTERNALERROR(hc->expnfilename);
+      httpd_send_err(hc, 500, err500title, "", err500form, hc->encodedurl);
+      return -1;
+    }
+
+  hc->got_range = false;
+  send_mime(hc, 200, ok200title, "", "", "text/html; charset=%s",
+            (off_t)-1, (time_t)0);
+  httpd_write_response(hc);
+
+  if (hc->method != METHOD_HEAD)
+    {
+      hc->bytes_sent = thttpd_ssi_render(hc, tpl);
+    }
+
+  thttpd_ssi_close(tpl);
+
+  /* Nothing is left for the main loop to send */
+
+  hc->file_fd = -1;
+  return 0;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -2370,6 +2250,9 @@ int httpd_get_conn(httpd_server *hs, int listen_fd, httpd_conn *hc)
   hc->keep_alive        = false;
   hc->should_linger     = false;
   hc->file_fd           = -1;
+#ifdef CONFIG_THTTPD_STATS
+  hc->status            = 0;
+#endif
 
   ninfo("New connection accepted on %d\n", hc->conn_fd);
   return GC_OK;
@@ -3095,21 +2978,20 @@ void httpd_destroy_conn(httpd_conn *hc)
 {
   if (hc->initialized)
     {
-      httpd_free((void *)hc->read_buf);
-      httpd_free((void *)hc->decodedurl);
-      httpd_free((void *)hc->origfilename);
-      httpd_free((void *)hc->expnfilename);
-      httpd_free((void *)hc->encodings);
-      httpd_free((void *)hc->pathinfo);
-      httpd_free((void *)hc->query);
-      httpd_free((void *)hc->accept);
-      httpd_free((void *)hc->accepte);
-      httpd_free((void *)hc->reqhost);
-      httpd_free((void *)hc->hostdir);
-      httpd_free((void *)hc->remoteuser);
-      httpd_free((void *)hc->buffer);
+      httpd_free_str(hc->read_buf);
+      httpd_free_str(hc->decodedurl);
+      httpd_free_str(hc->origfilename);
+      httpd_free_str(hc->expnfilename);
+      httpd_free_str(hc->encodings);
+      httpd_free_str(hc->pathinfo);
+      httpd_free_str(hc->query);
+      httpd_free_str(hc->accept);
+      httpd_free_str(hc->accepte);
+      httpd_free_str(hc->reqhost);
+      httpd_free_str(hc->hostdir);
+      httpd_free_str(hc->remoteuser);
 #ifdef CONFIG_THTTPD_TILDE_MAP2
-      httpd_free((void *)hc->altdir);
+      httpd_free_str(hc->altdir);
 #endif /*CONFIG_THTTPD_TILDE_MAP2 */
       hc->initialized = 0;
     }
@@ -3140,6 +3022,15 @@ int httpd_start_request(httpd_conn *hc, struct timeval *nowP)
       return -1;
     }
 
+#ifdef CONFIG_THTTPD_STATS
+  /* The statistics report is not a file */
+
+  if (strcmp(hc->origfilename, CONFIG_THTTPD_STATS_URL) == 0)
+    {
+      return send_stats(hc);
+    }
+#endif
+
   /* Stat the file. */
 
   if (stat(hc->expnfilename, &hc->sb) < 0)
@@ -3385,6 +3276,21 @@ int httpd_start_request(httpd_conn *hc, struct timeval *nowP)
       return -1;
     }
 
+#ifdef CONFIG_THTTPD_SSI
+  /* Templates are run, not sent */
+
+  if (match(CONFIG_THTTPD_SSI_PATTERN, hc->expnfilename))
+    {
+      return send_ssi(hc);
+    }
+#endif
+
+#ifdef CONFIG_THTTPD_GZIP
+  /* Serve a precompressed variant of the file if there is one */
+
+  gzip_variant(hc);
+#endif
+
   /* Fill in range_end, if necessary. */
 
   if (hc->got_range &&
@@ -3397,13 +3303,13 @@ int httpd_start_request(httpd_conn *hc, struct timeval *nowP)
 
   if (hc->method == METHOD_HEAD)
     {
-      send_mime(hc, 200, ok200title, hc->encodings, "", hc->type,
+      send_mime(hc, 200, ok200title, hc->encodings, FILE_EXTRAHEADS, hc->type,
                 hc->sb.st_size, hc->sb.st_mtime);
     }
   else if (hc->if_modified_since != (time_t) - 1 &&
            hc->if_modified_since >= hc->sb.st_mtime)
     {
-      send_mime(hc, 304, err304title, hc->encodings, "", hc->type, (off_t) - 1,
+      send_mime(hc, 304, err304title, hc->encodings, FILE_EXTRAHEADS, hc->type, (off_t) - 1,
                 hc->sb.st_mtime);
     }
   else
@@ -3415,7 +3321,7 @@ int httpd_start_request(httpd_conn *hc, struct timeval *nowP)
           httpd_send_err(hc, 500, err500title, "", err500form, hc->encodedurl);
           return -1;
         }
-      send_mime(hc, 200, ok200title, hc->encodings, "", hc->type,
+      send_mime(hc, 200, ok200title, hc->encodings, FILE_EXTRAHEADS, hc->type,
                 hc->sb.st_size, hc->sb.st_mtime);
     }
 
@@ -223,6 +223,9 @@ typedef struct
   bool tildemapped;            /* this connection got tilde-mapped */
   bool keep_alive;
   bool should_linger;
+#ifdef CONFIG_THTTPD_STATS
+  int status;                  /* Response status, 0 if sent by a CGI program */
+#endif
   int conn_fd;                 /* Connection to the client */
   int file_fd;                 /* Descriptor for open, outgoing file */
   off_t range_start;           /* File range start from Range= */
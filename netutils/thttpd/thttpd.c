@@ -42,6 +42,9 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/time.h>
+#ifdef CONFIG_THTTPD_SENDFILE
+#  include <sys/sendfile.h>
+#endif
 
 #include <stdbool.h>
 #include <stdio.h>
@@ -58,6 +61,7 @@
 #include <nuttx/compiler.h>
 #include <nuttx/binfmt/symtab.h>
 #include "netutils/thttpd.h"
+#include "system/perfcount.h"
 
 #include "config.h"
 #include "fdwatch.h"
@@ -65,6 +69,7 @@
 #include "thttpd_alloc.h"
 #include "thttpd_strings.h"
 #include "timers.h"
+#include "thttpd_stats.h"
 
 #ifdef CONFIG_THTTPD
 
@@ -101,6 +106,9 @@ struct connect_s
   off_t end_offset;            /* The final offset+1 of the file to send */
   off_t offset;                /* The current offset into the file to send */
   bool eof;                    /* Set true when length==0 read from file */
+#ifdef CONFIG_THTTPD_STATS
+  struct timeval accepted_at;  /* Time that the connection was accepted */
+#endif
 };
 
 /****************************************************************************
@@ -112,6 +120,13 @@ static struct connect_s *free_connections;
 static struct connect_s *connects;
 static struct fdwatch_s *fw;
 
+/* Counters in the performance counter registry */
+
+PERF_COUNTER(g_perf_accepted, "thttpd.accepted");
+PERF_COUNTER(g_perf_responses, "thttpd.responses");
+PERF_COUNTER(g_perf_errors, "thttpd.errors");
+PERF_COUNTER(g_perf_bytes, "thttpd.bytes");
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -246,6 +261,11 @@ static int handle_newconnect(FAR struct timeval *tv, int listen_fd)
       conn->wakeup_timer      = NULL;
       conn->linger_timer      = NULL;
       conn->offset            = 0;
+      PERF_INC(g_perf_accepted);
+#ifdef CONFIG_THTTPD_STATS
+      conn->accepted_at       = *tv;
+      thttpd_stats_accept();
+#endif
 
       /* Set the connection file descriptor to no-delay mode */
 
@@ -397,11 +417,19 @@ static inline int read_buffer(struct connect_s *conn)
 {
   httpd_conn *hc = conn->hc;
   ssize_t nread = 0;
+  size_t nbytes;
 
   if (hc->buflen < CONFIG_THTTPD_IOBUFFERSIZE && !conn->eof)
     {
-      nread = read(hc->file_fd, &hc->buffer[hc->buflen],
-                   CONFIG_THTTPD_IOBUFFERSIZE - hc->buflen);
+      /* Do not read beyond the end of the requested range */
+
+      nbytes = CONFIG_THTTPD_IOBUFFERSIZE - hc->buflen;
+      if (nbytes > conn->end_offset - conn->offset)
+        {
+          nbytes = conn->end_offset - conn->offset;
+        }
+
+      nread = read(hc->file_fd, &hc->buffer[hc->buflen], nbytes);
       if (nread == 0)
         {
           /* Reading zero bytes means we are at the end of file */
@@ -417,12 +445,108 @@ static inline int read_buffer(struct connect_s *conn)
   return nread;
 }
 
+#ifdef CONFIG_THTTPD_SENDFILE
+/* Send the file with sendfile(), avoiding the copy through hc->buffer.
+ * Returns OK when the transfer is complete, or ERROR with errno set.  An
+ * errno value of ENOSYS, EINVAL or EOPNOTSUPP on the first transfer means
+ * that sendfile() could not be used and the caller should fall back to
+ * buffered I/O.
+ */
+
+static inline int sendfile_data(struct connect_s *conn, struct timeval *tv)
+{
+  httpd_conn *hc = conn->hc;
+  ssize_t nsent;
+  size_t nbytes;
+  off_t offset;
+
+  /* Send any response headers that are still buffered */
+
+  if (hc->buflen > 0)
+    {
+      if (httpd_write(hc->conn_fd, hc->buffer, hc->buflen) < 0)
+        {
+          return ERROR;
+        }
+
+      hc->buflen = 0;
+    }
+
+  while (conn->offset < conn->end_offset)
+    {
+      nbytes = conn->end_offset - conn->offset;
+      if (nbytes > CONFIG_THTTPD_SENDFILE_CHUNKSIZE)
+        {
+          nbytes = CONFIG_THTTPD_SENDFILE_CHUNKSIZE;
+        }
+
+      offset = conn->offset;
+      nsent  = sendfile(hc->conn_fd, hc->file_fd, &offset, nbytes);
+      if (nsent < 0)
+        {
+          if (errno == EAGAIN)
+            {
+              /* The socket is non-blocking; wait for space as httpd_write
+               * does.
+               */
+
+              usleep(100000); /* 100MS */
+              continue;
+            }
+          else if (errno == EINTR)
+            {
+              continue;
+            }
+
+          return ERROR;
+        }
+      else if (nsent == 0)
+        {
+          /* End of file */
+
+          conn->end_offset = conn->offset;
+          conn->eof        = true;
+          break;
+        }
+
+      conn->active_at       = tv->tv_sec;
+      conn->offset         += nsent;
+      conn->hc->bytes_sent += nsent;
+      ninfo("Sent %d bytes\n", (int)nsent);
+    }
+
+  return OK;
+}
+#endif
+
 static void handle_send(struct connect_s *conn, struct timeval *tv)
 {
   httpd_conn *hc = conn->hc;
   int nwritten;
   int nread;
 
+#ifdef CONFIG_THTTPD_SENDFILE
+  off_t start = conn->offset;
+
+  if (sendfile_data(conn, tv) == OK)
+    {
+      ninfo("Finish connection\n");
+      finish_connection(conn, tv);
+      return;
+    }
+
+  if (conn->offset != start ||
+      (errno != ENOSYS && errno != EINVAL && errno != EOPNOTSUPP))
+    {
+      nerr("ERROR: Error sending %s: %d\n", hc->encodedurl, errno);
+      goto errout_clear_connection;
+    }
+
+  /* sendfile() is not usable with this file.  Fall back to buffered I/O */
+
+  nwarn("WARNING: sendfile failed: %d, using buffered I/O\n", errno);
+#endif
+
   /* Read until the entire file is sent -- this could take awhile!! */
 
   while (conn->offset < conn->end_offset)
@@ -462,12 +586,17 @@ static void handle_send(struct connect_s *conn, struct timeval *tv)
 
           conn->active_at       = tv->tv_sec;
           hc->buflen            = 0;
+          ninfo("Wrote %d bytes\n", nwritten);
+        }
 
-          /* And update how much of the file we wrote */
+      /* And update how much of the file we wrote.  The buffer may also
+       * have held the response headers, so count only the file data.
+       */
 
-          conn->offset         += nwritten;
-          conn->hc->bytes_sent += nwritten;
-          ninfo("Wrote %d bytes\n", nwritten);
+      if (nread > 0)
+        {
+          conn->offset         += nread;
+          conn->hc->bytes_sent += nread;
         }
     }
 
@@ -519,6 +648,41 @@ static void clear_connection(struct connect_s *conn, struct timeval *tv)
 {
   ClientData client_data;
 
+  if (conn->conn_state != CNST_LINGERING)
+    {
+      PERF_INC(g_perf_responses);
+      if (conn->hc->status >= 400)
+        {
+          PERF_INC(g_perf_errors);
+        }
+      else if (conn->hc->status != 0)
+        {
+          PERF_ADD(g_perf_bytes, conn->hc->bytes_sent);
+        }
+    }
+
+#ifdef CONFIG_THTTPD_STATS
+  /* The response is complete; a lingering close does not count */
+
+  if (conn->conn_state != CNST_LINGERING)
+    {
+      httpd_conn *hc = conn->hc;
+
+      if (hc->status == 0)
+        {
+          /* The bytes sent by CGI programs are not known here */
+
+          thttpd_stats_close(THTTPD_STATS_CGI, 0, &conn->accepted_at);
+        }
+      else
+        {
+          thttpd_stats_close(hc->status >= 400 ? THTTPD_STATS_ERROR :
+                             THTTPD_STATS_STATIC, hc->bytes_sent,
+                             &conn->accepted_at);
+        }
+    }
+#endif
+
   if (conn->wakeup_timer != NULL)
     {
       tmr_cancel(conn->wakeup_timer);
@@ -582,6 +746,14 @@ static void really_clear_connection(struct connect_s *conn)
   conn->conn_state  = CNST_FREE;
   conn->next        = free_connections;
   free_connections  = conn;
+
+#ifdef CONFIG_THTTPD_STRPOOL
+  /* Release the connection strings back to the pool in bulk.  They will
+   * be re-allocated from the pool when the connection is used again.
+   */
+
+  httpd_destroy_conn(conn->hc);
+#endif
 }
 
 static void idle(ClientData client_data, struct timeval *nowP)
@@ -664,12 +836,20 @@ int thttpd_main(int argc, char **argv)
   FAR httpd_conn *hc;
   httpd_sockaddr sa;
   struct timeval tv;
+#ifdef CONFIG_THTTPD_STATS
+  struct timeval now;
+#endif
 #ifdef CONFIG_THTTPD_DIR
   int ret;
 #endif
 
   ninfo("THTTPD started\n");
 
+  PERF_REGISTER(g_perf_accepted);
+  PERF_REGISTER(g_perf_responses);
+  PERF_REGISTER(g_perf_errors);
+  PERF_REGISTER(g_perf_bytes);
+
   /* Setup host address */
 
 #ifdef  CONFIG_NET_IPv6
@@ -766,6 +946,13 @@ int thttpd_main(int argc, char **argv)
   (void)gettimeofday(&tv, NULL);
   for (;;)
     {
+#ifdef CONFIG_THTTPD_STATS
+      /* Everything since the last fdwatch() returned was handler time */
+
+      (void)gettimeofday(&now, NULL);
+      thttpd_stats_phase(THTTPD_STATS_HANDLE, &tv, &now);
+#endif
+
       /* Do the fd watch */
 
       num_ready = fdwatch(fw, tmr_mstimeout(&tv));
@@ -783,6 +970,9 @@ int thttpd_main(int argc, char **argv)
         }
 
       (void)gettimeofday(&tv, NULL);
+#ifdef CONFIG_THTTPD_STATS
+      thttpd_stats_phase(THTTPD_STATS_WAIT, &now, &tv);
+#endif
 
       if (num_ready == 0)
         {
@@ -40,7 +40,10 @@
 #include <nuttx/config.h>
 
 #include <sys/types.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#include <semaphore.h>
 #include <debug.h>
 #include <errno.h>
 
@@ -61,6 +64,38 @@
 #  define MIN(a,b) ((a) < (b) ? (a) : (b))
 #endif
 
+/* String pool size classes.  Class n holds blocks with a payload of
+ * (STRPOOL_MINBLOCK << n) bytes.  Larger strings come directly from the
+ * heap.
+ */
+
+#ifdef CONFIG_THTTPD_STRPOOL
+#  define STRPOOL_MINBLOCK  CONFIG_THTTPD_MINSTRSIZE
+#  define STRPOOL_NCLASSES  8
+#  define STRPOOL_HEAP      0xff
+
+/* Size of the block header, preserving pointer alignment of the payload */
+
+#  define STRPOOL_HDRSIZE   ((sizeof(struct strpool_block_s) + sizeof(FAR void *) - 1) & \
+                             ~(sizeof(FAR void *) - 1))
+#  define STRPOOL_HDR(s)    ((FAR struct strpool_block_s *)((FAR char *)(s) - STRPOOL_HDRSIZE))
+#  define STRPOOL_DATA(b)   ((FAR char *)(b) + STRPOOL_HDRSIZE)
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+#ifdef CONFIG_THTTPD_STRPOOL
+/* This header precedes every string allocated from the pool */
+
+struct strpool_block_s
+{
+  FAR struct strpool_block_s *flink; /* Free list link (only when free) */
+  uint8_t sclass;                    /* Size class or STRPOOL_HEAP */
+};
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -71,6 +106,23 @@ static int    g_nfreed       = 0;
 static size_t g_allocated    = 0;
 #endif
 
+#ifdef CONFIG_THTTPD_STRPOOL
+/* Free blocks of each size class.  Blocks are never returned to the heap
+ * so that long-running servers do not fragment it.  The pool is shared
+ * with the CGI tasks and so must be protected.
+ */
+
+static FAR struct strpool_block_s *g_strpool[STRPOOL_NCLASSES];
+static sem_t g_strpool_sem = SEM_INITIALIZER(1);
+
+#ifdef CONFIG_THTTPD_MEMDEBUG
+static int    g_strpool_hits;    /* Allocations satisfied from a free list */
+static int    g_strpool_misses;  /* Allocations that needed a new block */
+static int    g_strpool_heap;    /* Allocations too large for the pool */
+static size_t g_strpool_size;    /* Total bytes held by the pool */
+#endif
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -94,6 +146,96 @@ void httpd_memstats(void)
 #endif
   ninfo("arena: %08x ordblks: %08x mxordblk: %08x uordblks: %08x fordblks: %08x\n",
        mm.arena, mm.ordblks, mm.mxordblk, mm.uordblks, mm.fordblks);
+
+#ifdef CONFIG_THTTPD_STRPOOL
+  ninfo("strpool: %d hits, %d misses, %d heap, %lu bytes\n",
+        g_strpool_hits, g_strpool_misses, g_strpool_heap,
+        (unsigned long)g_strpool_size);
+#endif
+}
+#endif
+
+#ifdef CONFIG_THTTPD_STRPOOL
+/* Return the size class able to hold nbytes or STRPOOL_HEAP */
+
+static uint8_t strpool_class(size_t nbytes)
+{
+  size_t blksize = STRPOOL_MINBLOCK;
+  uint8_t sclass;
+
+  for (sclass = 0; sclass < STRPOOL_NCLASSES; sclass++, blksize <<= 1)
+    {
+      if (nbytes <= blksize)
+        {
+          return sclass;
+        }
+    }
+
+  return STRPOOL_HEAP;
+}
+
+/* Allocate a string of at least *nbytes bytes.  On return, *nbytes holds
+ * the usable size of the block.
+ */
+
+static FAR char *strpool_alloc(FAR size_t *nbytes)
+{
+  FAR struct strpool_block_s *blk;
+  uint8_t sclass;
+  size_t blksize;
+
+  sclass = strpool_class(*nbytes);
+  if (sclass == STRPOOL_HEAP)
+    {
+      blk = (FAR struct strpool_block_s *)
+        httpd_malloc(STRPOOL_HDRSIZE + *nbytes);
+#ifdef CONFIG_THTTPD_MEMDEBUG
+      g_strpool_heap++;
+#endif
+    }
+  else
+    {
+      blksize = (size_t)STRPOOL_MINBLOCK << sclass;
+
+      while (sem_wait(&g_strpool_sem) < 0)
+        {
+          DEBUGASSERT(errno == EINTR);
+        }
+
+      blk = g_strpool[sclass];
+      if (blk != NULL)
+        {
+          g_strpool[sclass] = blk->flink;
+#ifdef CONFIG_THTTPD_MEMDEBUG
+          g_strpool_hits++;
+#endif
+        }
+
+      sem_post(&g_strpool_sem);
+
+      if (blk == NULL)
+        {
+          blk = (FAR struct strpool_block_s *)
+            httpd_malloc(STRPOOL_HDRSIZE + blksize);
+#ifdef CONFIG_THTTPD_MEMDEBUG
+          g_strpool_misses++;
+          if (blk != NULL)
+            {
+              g_strpool_size += STRPOOL_HDRSIZE + blksize;
+            }
+#endif
+        }
+
+      *nbytes = blksize;
+    }
+
+  if (blk == NULL)
+    {
+      return NULL;
+    }
+
+  blk->sclass = sclass;
+  return STRPOOL_DATA(blk);
 }
 #endif
 
@@ -171,25 +313,81 @@ FAR char *httpd_strdup(const char *str)
 
 /* Helpers to implement dynamically allocated strings */
 
+#ifdef CONFIG_THTTPD_STRPOOL
+void httpd_free_str(FAR char *str)
+{
+  FAR struct strpool_block_s *blk;
+
+  if (str == NULL)
+    {
+      return;
+    }
+
+  blk = STRPOOL_HDR(str);
+  if (blk->sclass == STRPOOL_HEAP)
+    {
+      httpd_free(blk);
+      return;
+    }
+
+  while (sem_wait(&g_strpool_sem) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+
+  blk->flink = g_strpool[blk->sclass];
+  g_strpool[blk->sclass] = blk;
+  sem_post(&g_strpool_sem);
+}
+#endif
+
 void httpd_realloc_str(char **pstr, size_t *maxsize, size_t size)
 {
   size_t oldsize;
+#ifdef CONFIG_THTTPD_STRPOOL
+  FAR char *newstr;
+  size_t nbytes;
+#endif
+
   if (*maxsize == 0)
     {
+      oldsize  = 0;
       *maxsize = MAX(CONFIG_THTTPD_MINSTRSIZE, size + CONFIG_THTTPD_REALLOCINCR);
+#ifndef CONFIG_THTTPD_STRPOOL
       *pstr    = NEW(char, *maxsize + 1);
+#endif
     }
   else if (size > *maxsize)
     {
       oldsize  = *maxsize;
       *maxsize = MAX(oldsize * 2, size * 5 / 4);
+#ifndef CONFIG_THTTPD_STRPOOL
       *pstr    = httpd_realloc(*pstr, oldsize + 1, *maxsize + 1);
+#endif
     }
   else
     {
       return;
     }
 
+#ifdef CONFIG_THTTPD_STRPOOL
+  /* Take the rounded-up block from the pool and make the slack usable */
+
+  nbytes = *maxsize + 1;
+  newstr = strpool_alloc(&nbytes);
+  if (newstr != NULL)
+    {
+      *maxsize = nbytes - 1;
+      if (oldsize > 0)
+        {
+          memcpy(newstr, *pstr, oldsize + 1);
+          httpd_free_str(*pstr);
+        }
+    }
+
+  *pstr = newstr;
+#endif
+
   if (!*pstr)
     {
       nerr("ERROR: out of memory reallocating a string to %d bytes\n",
@@ -70,9 +70,17 @@ extern FAR char *httpd_strdup(const char *str);
 #define NEW(t,n)               ((t*)httpd_malloc(sizeof(t)*(n)))
 #define RENEW(p,t,o,n)         ((t*)httpd_realloc((void*)p, sizeof(t)*(o), sizeof(t)*(n)))
 
-/* Helpers to implement dynamically allocated strings */
+/* Helpers to implement dynamically allocated strings.  Strings allocated
+ * with httpd_realloc_str() must be freed with httpd_free_str().
+ */
 
 extern void httpd_realloc_str(char **pstr, size_t *maxsizeP, size_t size);
 
+#ifdef CONFIG_THTTPD_STRPOOL
+extern void httpd_free_str(FAR char *str);
+#else
+#  define httpd_free_str(s)    httpd_free(s)
+#endif
+
 #endif /* CONFIG_THTTPD */
 #endif /* __NETUTILS_THTTPD_HTTDP_ALLOC_H */
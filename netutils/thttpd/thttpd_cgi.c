@@ -51,6 +51,8 @@
 #include <string.h>
 #include <signal.h>
 #include <libgen.h>
+#include <limits.h>
+#include <pthread.h>
 #include <errno.h>
 #include <debug.h>
 
@@ -121,6 +123,16 @@ struct cgi_conn_s
   struct cgi_inbuffer_s inbuf;   /* Fixed size input buffer */
 };
 
+#ifdef CONFIG_THTTPD_CGI_POOL
+struct cgi_worker_s
+{
+  pthread_t thread;              /* The worker thread */
+  sem_t  sem;                    /* Posted when a request is assigned */
+  FAR httpd_conn *hc;            /* The assigned request */
+  volatile bool busy;            /* True while a request is assigned */
+};
+#endif
+
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
@@ -129,7 +141,15 @@ static void create_environment(httpd_conn *hc);
 static char **make_argp(httpd_conn *hc);
 static inline int cgi_interpose_input(struct cgi_conn_s *cc);
 static inline int cgi_interpose_output(struct cgi_conn_s *cc);
+static int cgi_run(FAR httpd_conn *hc);
+#ifdef CONFIG_THTTPD_CGI_POOL
+static FAR void *cgi_worker(FAR void *arg);
+#else
 static int cgi_child(int argc, char **argv);
+#endif
+#if CONFIG_THTTPD_CGI_TIMELIMIT > 0
+static void cgi_kill(ClientData client_data, struct timeval *nowP);
+#endif
 
 /****************************************************************************
  * Private Data
@@ -139,6 +159,31 @@ static int cgi_child(int argc, char **argv);
 
 static sem_t g_cgisem;
 
+#ifdef CONFIG_THTTPD_CGI_POOL
+/* The CGI worker pool.  g_cgiidle counts the workers that have no request
+ * assigned.
+ */
+
+static struct cgi_worker_s g_cgipool[CONFIG_THTTPD_CGI_POOLSIZE];
+static sem_t g_cgiidle;
+static int   g_cginworkers;
+static FAR char *g_cgicwd;       /* The server's working directory */
+
+/* Environment variables that are only set by some requests.  The workers
+ * share one environment, so these must be cleared before each request.
+ */
+
+static FAR const char * const g_cgioptenv[] =
+{
+  "SERVER_NAME", "PATH_INFO", "PATH_TRANSLATED", "QUERY_STRING",
+  "HTTP_REFERER", "HTTP_USER_AGENT", "HTTP_ACCEPT", "HTTP_ACCEPT_ENCODING",
+  "HTTP_ACCEPT_LANGUAGE", "HTTP_COOKIE", "CONTENT_TYPE", "HTTP_HOST",
+  "CONTENT_LENGTH", "REMOTE_USER", "AUTH_TYPE"
+};
+
+#define CGI_NOPTENV (sizeof(g_cgioptenv) / sizeof(g_cgioptenv[0]))
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -163,8 +208,7 @@ static inline void cgi_semgive(void)
 }
 
 /* Set up environment variables. Be real careful here to avoid
- * letting malicious clients overrun a buffer.  We don't have
- * to worry about freeing stuff since we're a sub-task.
+ * letting malicious clients overrun a buffer.
  */
 
 static void create_environment(httpd_conn *hc)
@@ -172,6 +216,15 @@ static void create_environment(httpd_conn *hc)
   char *cp;
   char buf[256];
 
+#ifdef CONFIG_THTTPD_CGI_POOL
+  int i;
+
+  for (i = 0; i < CGI_NOPTENV; i++)
+    {
+      (void)unsetenv(g_cgioptenv[i]);
+    }
+#endif
+
   setenv("PATH", CONFIG_THTTPD_CGI_PATH, TRUE);
 #ifdef CGI_LD_LIBRARY_PATH
   setenv("LD_LIBRARY_PATH", CGI_LD_LIBRARY_PATH, TRUE);
@@ -218,6 +271,7 @@ static void create_environment(httpd_conn *hc)
         {
           (void)snprintf(cp2, l, "%s%s", httpd_root, hc->pathinfo);
           setenv("PATH_TRANSLATED", cp2, TRUE);
+          httpd_free(cp2);
         }
     }
 
@@ -689,9 +743,43 @@ static inline int cgi_interpose_output(struct cgi_conn_s *cc)
 
 /* CGI child task. */
 
-static int cgi_child(int argc, char **argv)
+#ifdef CONFIG_THTTPD_CGI_POOL
+/* The worker shares stdin, stdout and the working directory with the
+ * server.  Restore them once the CGI program has inherited its own.
+ */
+
+static void cgi_restore(FAR int *stdfd)
+{
+  int fd;
+
+  for (fd = 0; fd < 2; fd++)
+    {
+      if (stdfd[fd] >= 0)
+        {
+          (void)dup2(stdfd[fd], fd);
+          close(stdfd[fd]);
+        }
+      else
+        {
+          /* The server had nothing open here */
+
+          close(fd);
+        }
+    }
+
+  if (g_cgicwd != NULL)
+    {
+      (void)chdir(g_cgicwd);
+    }
+}
+#endif
+
+/* Start the CGI program for one request and interpose between it and the
+ * client.  The server is held off on g_cgisem until hc is no longer needed.
+ */
+
+static int cgi_run(FAR httpd_conn *hc)
 {
-  FAR httpd_conn *hc = (FAR httpd_conn*)strtoul(argv[1], NULL, 16);
 #if CONFIG_THTTPD_CGI_TIMELIMIT > 0
   ClientData client_data;
 #endif
@@ -705,15 +793,14 @@ static int cgi_child(int argc, char **argv)
   int        child;
   int        pipefd[2];
   int        nbytes;
-  int        fd;
   int        ret;
   int        errcode = 1;
-
-  /* Use low-level debug out (because the low-level output may survive closing
-   * all file descriptors
-   */
-
-  ninfo("Started: %s\n", argv[1]);
+#ifdef CONFIG_THTTPD_CGI_POOL
+  int        stdfd[2];
+  bool       redirected = false;
+#else
+  int        fd;
+#endif
 
   /* Allocate memory and initialize memory for interposing */
 
@@ -721,11 +808,27 @@ static int cgi_child(int argc, char **argv)
   if (!cc)
     {
       nerr("ERROR: cgi_conn allocation failed\n");
+#ifndef CONFIG_THTTPD_CGI_POOL
       close(hc->conn_fd);
+#endif
       goto errout;
     }
 
+#ifdef CONFIG_THTTPD_CGI_POOL
+  /* The server closes its own descriptor for the connection as soon as it
+   * is released.  Keep a separate reference to the socket.
+   */
+
+  cc->connfd = dup(hc->conn_fd);
+  if (cc->connfd < 0)
+    {
+      nerr("ERROR: dup: %d\n", errno);
+      httpd_free(cc);
+      goto errout;
+    }
+#else
   cc->connfd = hc->conn_fd;
+#endif
   cc->wrfd   = -1;
   cc->rdfd   = -1;
   memset(&cc->outbuf, 0, sizeof(struct cgi_outbuffer_s));
@@ -740,6 +843,16 @@ static int cgi_child(int argc, char **argv)
 
   argp = make_argp(hc);
 
+#ifdef CONFIG_THTTPD_CGI_POOL
+  /* Descriptors are shared with the server, so none can be closed here.
+   * Save stdin and stdout so that they can be restored after the CGI
+   * program has been started with the pipes in their place.
+   */
+
+  stdfd[0]   = dup(0);
+  stdfd[1]   = dup(1);
+  redirected = true;
+#else
   /* Close all file descriptors EXCEPT for stdin, stdout, stderr and
    * hc->conn_fd.  We'll keep stderr open for error reporting; stdin and
    * stdout will be closed later by dup2().  Keeping stdin and stdout open
@@ -756,6 +869,7 @@ static int cgi_child(int argc, char **argv)
            close(fd);
          }
     }
+#endif
 
   /* Create pipes that will be interposed between the CGI task's stdin or
    * stdout and the socket.
@@ -864,6 +978,16 @@ static int cgi_child(int argc, char **argv)
 #else
   child = exec(hc->expnfilename, (FAR char * const *)argp, NULL, 0);
 #endif
+
+  /* The child has its own copies of the arguments by now */
+
+  httpd_free(argp);
+
+#ifdef CONFIG_THTTPD_CGI_POOL
+  cgi_restore(stdfd);
+  redirected = false;
+#endif
+
   if (child < 0)
     {
       /* Something went wrong. */
@@ -897,7 +1021,7 @@ static int cgi_child(int argc, char **argv)
       if (httpd_write(cc->wrfd, &(hc->read_buf[hc->checked_idx]), nbytes) != nbytes)
         {
           nerr("ERROR: httpd_write failed\n");
-          return 1;
+          goto errout_with_watch;
         }
     }
 
@@ -964,7 +1088,7 @@ errout_with_watch:
   /* Free output buffer memory */
 
 errout_with_outbuffer:
-  httpd_free(cc->outbuf.buffer);
+  httpd_free_str(cc->outbuf.buffer);
 
   /* Close all descriptors */
 
@@ -973,6 +1097,13 @@ errout_with_descriptors:
   close(cc->rdfd);
 
 errout_with_cgiconn:
+#ifdef CONFIG_THTTPD_CGI_POOL
+  if (redirected)
+    {
+      cgi_restore(stdfd);
+    }
+#endif
+
   close(cc->connfd);
   httpd_free(cc);
 
@@ -989,15 +1120,121 @@ errout:
   return errcode;
 }
 
+#ifdef CONFIG_THTTPD_CGI_POOL
+/* A persistent worker: serve one assigned request at a time */
+
+static FAR void *cgi_worker(FAR void *arg)
+{
+  FAR struct cgi_worker_s *worker = (FAR struct cgi_worker_s *)arg;
+
+  for (; ; )
+    {
+      while (sem_wait(&worker->sem) != 0)
+        {
+          ASSERT(errno == EINTR);
+        }
+
+      ninfo("Worker %d started: %s\n",
+            (int)(worker - g_cgipool), worker->hc->expnfilename);
+
+      (void)cgi_run(worker->hc);
+
+      /* Return to the pool */
+
+      worker->hc   = NULL;
+      worker->busy = false;
+      sem_post(&g_cgiidle);
+    }
+
+  return NULL;
+}
+
+/* Create the worker threads the first time that they are needed */
+
+static int cgi_startpool(void)
+{
+  FAR struct cgi_worker_s *worker;
+  struct sched_param param;
+  pthread_attr_t attr;
+  int ret;
+
+  if (g_cginworkers > 0)
+    {
+      return OK;
+    }
+
+  /* Remember where the server runs so that the workers can return here
+   * after starting a CGI program in its own directory.
+   */
+
+  g_cgicwd = (FAR char *)httpd_malloc(PATH_MAX);
+  if (g_cgicwd != NULL && getcwd(g_cgicwd, PATH_MAX) == NULL)
+    {
+      httpd_free(g_cgicwd);
+      g_cgicwd = NULL;
+    }
+
+  (void)pthread_attr_init(&attr);
+  (void)pthread_attr_setstacksize(&attr, CONFIG_THTTPD_CGI_STACKSIZE);
+  param.sched_priority = CONFIG_THTTPD_CGI_PRIORITY;
+  (void)pthread_attr_setschedparam(&attr, &param);
+
+  while (g_cginworkers < CONFIG_THTTPD_CGI_POOLSIZE)
+    {
+      worker = &g_cgipool[g_cginworkers];
+      sem_init(&worker->sem, 0, 0);
+      worker->busy = false;
+
+      ret = pthread_create(&worker->thread, &attr, cgi_worker, worker);
+      if (ret != 0)
+        {
+          nerr("ERROR: pthread_create: %d\n", ret);
+          sem_destroy(&worker->sem);
+          break;
+        }
+
+      g_cginworkers++;
+    }
+
+  (void)pthread_attr_destroy(&attr);
+
+  if (g_cginworkers == 0)
+    {
+      return ERROR;
+    }
+
+  sem_init(&g_cgiidle, 0, g_cginworkers);
+  return OK;
+}
+#endif
+
+#ifndef CONFIG_THTTPD_CGI_POOL
+static int cgi_child(int argc, char **argv)
+{
+  FAR httpd_conn *hc = (FAR httpd_conn*)strtoul(argv[1], NULL, 16);
+
+  /* Use low-level debug out (because the low-level output may survive closing
+   * all file descriptors
+   */
+
+  ninfo("Started: %s\n", argv[1]);
+  return cgi_run(hc);
+}
+#endif
+
 /****************************************************************************
- * Private Function Prototypes
+ * Public Functions
  ****************************************************************************/
 
 int cgi(httpd_conn *hc)
 {
+#ifdef CONFIG_THTTPD_CGI_POOL
+  int   i;
+#else
   char arg[16];
   char *argv[2];
   pid_t child;
+#endif
   int   retval = ERROR;
 
   /* Set up a semaphore to hold off the make THTTPD thread until the CGI
@@ -1016,10 +1253,42 @@ int cgi(httpd_conn *hc)
                          hc->encodedurl);
           goto errout_with_sem;
         }
+#endif
+#ifdef CONFIG_THTTPD_CGI_POOL
+      /* Reserve an idle worker.  The size of the pool limits the number of
+       * concurrent CGI programs.
+       */
+
+      if (cgi_startpool() < 0)
+        {
+          INTERNALERROR("cgi_startpool");
+          httpd_send_err(hc, 500, err500title, "", err500form,
+                         hc->encodedurl);
+          goto errout_with_sem;
+        }
+
+      if (sem_trywait(&g_cgiidle) < 0)
+        {
+          nwarn("WARNING: No idle CGI worker\n");
+          httpd_send_err(hc, 503, httpd_err503title, "", httpd_err503form,
+                         hc->encodedurl);
+          goto errout_with_sem;
+        }
 #endif
       ++hc->hs->cgi_count;
       httpd_clear_ndelay(hc->conn_fd);
 
+#ifdef CONFIG_THTTPD_CGI_POOL
+      /* Hand the request to the reserved worker */
+
+      for (i = 0; g_cgipool[i].busy; i++);
+
+      g_cgipool[i].busy = true;
+      g_cgipool[i].hc   = hc;
+      sem_post(&g_cgipool[i].sem);
+
+      ninfo("CGI worker %d serving file '%s'\n", i, hc->expnfilename);
+#else
       /* Start the child task.  We use a trampoline task here so that we can
        * safely muck with the file descriptors before actually started the CGI
        * task.
@@ -1042,6 +1311,7 @@ int cgi(httpd_conn *hc)
         }
 
       ninfo("Started CGI task %d for file '%s'\n", child, hc->expnfilename);
+#endif
 
       /* Wait for the CGI threads to become initialized */
 
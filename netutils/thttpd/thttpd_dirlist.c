@@ -0,0 +1,609 @@
+/****************************************************************************
+ * netutils/thttpd/thttpd_dirlist.c
+ * Cached directory listings
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <time.h>
+#include <errno.h>
+#include <debug.h>
+
+#include "config.h"
+#include "libhttpd.h"
+#include "thttpd_alloc.h"
+#include "thttpd_strings.h"
+#include "thttpd_dirlist.h"
+
+#if defined(CONFIG_THTTPD) && defined(CONFIG_THTTPD_GENERATE_INDICES)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define DIRLIST_BUFSIZE  512
+#define DIRLIST_NNAMES   32    /* Name pointer array growth increment */
+#define DIRLIST_NAMEINCR 512   /* Name buffer growth increment */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct dirlist_s
+{
+  FAR char *path;              /* Path of the directory */
+  time_t mtime;                /* Modification time of the directory */
+  FAR char *names;             /* NUL-terminated names, packed */
+  FAR char **sorted;           /* The names in strcmp() order */
+  int nnames;
+  bool cached;                 /* In g_dirlist_cache[] */
+  uint32_t lastuse;            /* For least-recently-used eviction */
+};
+
+/* Buffered output of one listing */
+
+struct dirlist_out_s
+{
+  int fd;
+  bool failed;
+  off_t nsent;
+  size_t buflen;
+  char buffer[DIRLIST_BUFSIZE];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The server is single threaded, so none of this needs a lock */
+
+#if CONFIG_THTTPD_INDEX_CACHESIZE > 0
+static FAR struct dirlist_s *g_dirlist_cache[CONFIG_THTTPD_INDEX_CACHESIZE];
+static uint32_t g_dirlist_clock;
+#endif
+
+static struct dirlist_out_s g_dirlist_out;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static int dirlist_compare(FAR const void *a, FAR const void *b)
+{
+  return strcmp(*((FAR char **)a), *((FAR char **)b));
+}
+
+static void dirlist_free(FAR struct dirlist_s *dl)
+{
+  httpd_free(dl->sorted);
+  httpd_free(dl->names);
+  httpd_free(dl->path);
+  httpd_free(dl);
+}
+
+/* Read and sort the names in a directory */
+
+static FAR struct dirlist_s *dirlist_load(FAR const char *path,
+                                          FAR const struct stat *sb)
+{
+  FAR struct dirlist_s *dl;
+  FAR struct dirent *de;
+  FAR char *newnames;
+  FAR char *name;
+  FAR DIR *dirp;
+  size_t maxnames = 0;
+  size_t used = 0;
+  size_t namlen;
+  int i;
+
+  dirp = opendir(path);
+  if (dirp == NULL)
+    {
+      nerr("ERROR: opendir %s: %d\n", path, errno);
+      return NULL;
+    }
+
+  dl = (FAR struct dirlist_s *)httpd_malloc(sizeof(*dl));
+  if (!dl)
+    {
+      goto errout_with_dir;
+    }
+
+  memset(dl, 0, sizeof(*dl));
+  dl->mtime = sb->st_mtime;
+  dl->path  = httpd_strdup(path);
+  if (!dl->path)
+    {
+      goto errout_with_dl;
+    }
+
+  while ((de = readdir(dirp)) != NULL)
+    {
+      namlen = strlen(de->d_name);
+      if (used + namlen + 1 > maxnames)
+        {
+          newnames = RENEW(dl->names, char, maxnames,
+                           maxnames + namlen + 1 + DIRLIST_NAMEINCR);
+          if (!newnames)
+            {
+              nerr("ERROR: out of memory reading %s\n", path);
+              goto errout_with_dl;
+            }
+
+          dl->names = newnames;
+          maxnames += namlen + 1 + DIRLIST_NAMEINCR;
+        }
+
+      memcpy(&dl->names[used], de->d_name, namlen + 1);
+      used += namlen + 1;
+      dl->nnames++;
+    }
+
+  closedir(dirp);
+
+  /* The name buffer has stopped moving, so it can be indexed now */
+
+  if (dl->nnames > 0)
+    {
+      dl->sorted = NEW(char *, dl->nnames);
+      if (!dl->sorted)
+        {
+          dirlist_free(dl);
+          return NULL;
+        }
+
+      for (i = 0, name = dl->names; i < dl->nnames; i++)
+        {
+          dl->sorted[i] = name;
+          name += strlen(name) + 1;
+        }
+
+      qsort(dl->sorted, dl->nnames, sizeof(*dl->sorted), dirlist_compare);
+    }
+
+  return dl;
+
+errout_with_dl:
+  dirlist_free(dl);
+
+errout_with_dir:
+  closedir(dirp);
+  return NULL;
+}
+
+static void dirlist_flush(FAR struct dirlist_out_s *out)
+{
+  if (out->buflen > 0 && !out->failed)
+    {
+      if (httpd_write(out->fd, out->buffer, out->buflen) < 0)
+        {
+          out->failed = true;
+        }
+      else
+        {
+          out->nsent += out->buflen;
+        }
+    }
+
+  out->buflen = 0;
+}
+
+static void dirlist_puts(FAR struct dirlist_out_s *out, FAR const char *str)
+{
+  size_t len = strlen(str);
+  size_t n;
+
+  while (len > 0 && !out->failed)
+    {
+      if (out->buflen >= DIRLIST_BUFSIZE)
+        {
+          dirlist_flush(out);
+        }
+
+      n = DIRLIST_BUFSIZE - out->buflen;
+      if (n > len)
+        {
+          n = len;
+        }
+
+      memcpy(&out->buffer[out->buflen], str, n);
+      out->buflen += n;
+      str         += n;
+      len         -= n;
+    }
+}
+
+static void dirlist_printf(FAR struct dirlist_out_s *out,
+                           FAR const char *fmt, ...)
+{
+  char line[160];
+  va_list ap;
+
+  va_start(ap, fmt);
+  (void)vsnprintf(line, sizeof(line), fmt, ap);
+  va_end(ap);
+
+  dirlist_puts(out, line);
+}
+
+#if CONFIG_THTTPD_INDEX_PAGESIZE > 0
+/* The page number from "page=<n>" in the query, starting at 1 */
+
+static int dirlist_page(FAR httpd_conn *hc)
+{
+  FAR const char *cp = hc->query;
+
+  while (cp != NULL && *cp != '\0')
+    {
+      if (strncmp(cp, "page=", 5) == 0)
+        {
+          return atoi(cp + 5);
+        }
+
+      cp = strchr(cp, '&');
+      if (cp != NULL)
+        {
+          cp++;
+        }
+    }
+
+  return 1;
+}
+#endif
+
+static void dirlist_pagelinks(FAR struct dirlist_out_s *out, int page,
+                              int npages)
+{
+  dirlist_printf(out, "Page %d of %d", page, npages);
+  if (page > 1)
+    {
+      dirlist_printf(out, "  <A HREF=\"?page=%d\">previous</A>", page - 1);
+    }
+
+  if (page < npages)
+    {
+      dirlist_printf(out, "  <A HREF=\"?page=%d\">next</A>", page + 1);
+    }
+
+  dirlist_puts(out, html_crlf);
+}
+
+/* Write one line of the listing in the style of ls -l */
+
+static void dirlist_entry(FAR struct dirlist_out_s *out, FAR httpd_conn *hc,
+                          FAR const char *entry, time_t now)
+{
+  static FAR char *name;
+  static size_t maxname = 0;
+  static FAR char *rname;
+  static size_t maxrname = 0;
+  static FAR char *encrname;
+  static size_t maxencrname = 0;
+  struct stat sb;
+  char modestr[20];
+  char timestr[16];
+  FAR char *ctimestr;
+  FAR const char *fileclass;
+
+  httpd_realloc_str(&name, &maxname,
+                    strlen(hc->expnfilename) + 1 + strlen(entry));
+  httpd_realloc_str(&rname, &maxrname,
+                    strlen(hc->origfilename) + 1 + strlen(entry));
+
+  if (hc->expnfilename[0] == '\0' || strcmp(hc->expnfilename, ".") == 0)
+    {
+      (void)strcpy(name, entry);
+      (void)strcpy(rname, entry);
+    }
+  else
+    {
+      (void)snprintf(name, maxname, "%s/%s", hc->expnfilename, entry);
+      if (strcmp(hc->origfilename, ".") == 0)
+        {
+          (void)snprintf(rname, maxrname, "%s", entry);
+        }
+      else
+        {
+          (void)snprintf(rname, maxrname, "%s%s", hc->origfilename, entry);
+        }
+    }
+
+  httpd_realloc_str(&encrname, &maxencrname, 3 * strlen(rname) + 1);
+  httpd_strencode(encrname, maxencrname, rname);
+
+  /* Sizes and times change without changing the directory, so they are
+   * not cached.
+   */
+
+  if (stat(name, &sb) < 0)
+    {
+      return;
+    }
+
+  /* Break down mode word.  First the file type. */
+
+  switch (sb.st_mode & S_IFMT)
+    {
+    case S_IFIFO:
+      modestr[0] = 'p';
+      break;
+
+    case S_IFCHR:
+      modestr[0] = 'c';
+      break;
+
+    case S_IFDIR:
+      modestr[0] = 'd';
+      break;
+
+    case S_IFBLK:
+      modestr[0] = 'b';
+      break;
+
+    case S_IFREG:
+      modestr[0] = '-';
+      break;
+
+    case S_IFSOCK:
+      modestr[0] = 's';
+      break;
+
+    case S_IFLNK:
+    default:
+      modestr[0] = '?';
+      break;
+    }
+
+  /* Now the world permissions.  Owner and group permissions are not of
+   * interest to web clients.
+   */
+
+  modestr[1] = (sb.st_mode & S_IROTH) ? 'r' : '-';
+  modestr[2] = (sb.st_mode & S_IWOTH) ? 'w' : '-';
+  modestr[3] = (sb.st_mode & S_IXOTH) ? 'x' : '-';
+  modestr[4] = '\0';
+
+  /* Get time string: "Mmm dd hh:mm", or "Mmm dd  yyyy" after 1/2 year */
+
+  timestr[0] = '\0';
+  ctimestr   = ctime(&sb.st_mtime);
+  if (ctimestr != NULL)
+    {
+      if (now - sb.st_mtime > 60 * 60 * 24 * 182)
+        {
+          (void)snprintf(timestr, sizeof(timestr), "%.6s  %.4s",
+                         &ctimestr[4], &ctimestr[20]);
+        }
+      else
+        {
+          (void)snprintf(timestr, sizeof(timestr), "%.6s %.5s",
+                         &ctimestr[4], &ctimestr[11]);
+        }
+    }
+
+  /* The ls -F file class. */
+
+  switch (sb.st_mode & S_IFMT)
+    {
+    case S_IFDIR:
+      fileclass = "/";
+      break;
+
+    case S_IFSOCK:
+      fileclass = "=";
+      break;
+
+    case S_IFLNK:
+      fileclass = "@";
+      break;
+
+    default:
+      fileclass = (sb.st_mode & S_IXOTH) ? "*" : "";
+      break;
+    }
+
+  /* And print.  The name is too long for dirlist_printf(). */
+
+  dirlist_printf(out, "%s %3d  %10ld  %s  <A HREF=\"/", modestr, 0,
+                 (long)sb.st_size, timestr);
+  dirlist_puts(out, encrname);
+  dirlist_printf(out, "%s\">", S_ISDIR(sb.st_mode) ? "/" : "");
+  dirlist_puts(out, entry);
+  dirlist_printf(out, "</A>%s\n", fileclass);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+FAR struct dirlist_s *thttpd_dirlist_open(FAR const char *path,
+                                          FAR const struct stat *sb)
+{
+  FAR struct dirlist_s *dl;
+#if CONFIG_THTTPD_INDEX_CACHESIZE > 0
+  int victim = 0;
+  int i;
+
+  /* File systems without directory times report 0.  Those directories
+   * are read again for every listing.
+   */
+
+  g_dirlist_clock++;
+  for (i = 0; sb->st_mtime != 0 && i < CONFIG_THTTPD_INDEX_CACHESIZE; i++)
+    {
+      dl = g_dirlist_cache[i];
+      if (!dl)
+        {
+          victim = i;
+          break;
+        }
+
+      if (strcmp(dl->path, path) == 0)
+        {
+          if (dl->mtime == sb->st_mtime)
+            {
+              dl->lastuse = g_dirlist_clock;
+              return dl;
+            }
+
+          victim = i;
+          break;
+        }
+
+      if (dl->lastuse < g_dirlist_cache[victim]->lastuse)
+        {
+          victim = i;
+        }
+    }
+#endif
+
+  dl = dirlist_load(path, sb);
+
+#if CONFIG_THTTPD_INDEX_CACHESIZE > 0
+  if (dl && sb->st_mtime != 0)
+    {
+      if (g_dirlist_cache[victim])
+        {
+          dirlist_free(g_dirlist_cache[victim]);
+        }
+
+      g_dirlist_cache[victim] = dl;
+      dl->cached  = true;
+      dl->lastuse = g_dirlist_clock;
+    }
+#endif
+
+  return dl;
+}
+
+off_t thttpd_dirlist_render(FAR httpd_conn *hc, FAR struct dirlist_s *dl)
+{
+  FAR struct dirlist_out_s *out = &g_dirlist_out;
+  time_t now = time(NULL);
+  int first = 0;
+  int last = dl->nnames;
+  int npages = 1;
+  int page = 1;
+  int i;
+
+  out->fd     = hc->conn_fd;
+  out->failed = false;
+  out->nsent  = 0;
+  out->buflen = 0;
+
+#if CONFIG_THTTPD_INDEX_PAGESIZE > 0
+  npages = (dl->nnames + CONFIG_THTTPD_INDEX_PAGESIZE - 1) /
+           CONFIG_THTTPD_INDEX_PAGESIZE;
+  if (npages < 1)
+    {
+      npages = 1;
+    }
+
+  page = dirlist_page(hc);
+  if (page < 1)
+    {
+      page = 1;
+    }
+  else if (page > npages)
+    {
+      page = npages;
+    }
+
+  first = (page - 1) * CONFIG_THTTPD_INDEX_PAGESIZE;
+  if (last > first + CONFIG_THTTPD_INDEX_PAGESIZE)
+    {
+      last = first + CONFIG_THTTPD_INDEX_PAGESIZE;
+    }
+#endif
+
+  dirlist_puts(out, html_html);
+  dirlist_puts(out, html_hdtitle);
+  dirlist_puts(out, "Index of ");
+  dirlist_puts(out, hc->encodedurl);
+  dirlist_puts(out, html_titlehd);
+  dirlist_puts(out, html_body);
+  dirlist_puts(out, html_hdr2);
+  dirlist_puts(out, "Index of ");
+  dirlist_puts(out, hc->encodedurl);
+  dirlist_puts(out, html_endhdr2);
+  dirlist_puts(out, html_crlf);
+
+  if (npages > 1)
+    {
+      dirlist_pagelinks(out, page, npages);
+    }
+
+  dirlist_puts(out, "<PRE>\r\nmode  links  bytes  last-changed  name\r\n"
+                    "<HR>");
+
+  for (i = first; i < last && !out->failed; i++)
+    {
+      dirlist_entry(out, hc, dl->sorted[i], now);
+    }
+
+  dirlist_puts(out, "</PRE>");
+  if (npages > 1)
+    {
+      dirlist_pagelinks(out, page, npages);
+    }
+
+  dirlist_puts(out, html_endbody);
+  dirlist_puts(out, html_endhtml);
+  dirlist_flush(out);
+
+  return out->nsent;
+}
+
+void thttpd_dirlist_close(FAR struct dirlist_s *dl)
+{
+  if (!dl->cached)
+    {
+      dirlist_free(dl);
+    }
+}
+
+#endif /* CONFIG_THTTPD && CONFIG_THTTPD_GENERATE_INDICES */
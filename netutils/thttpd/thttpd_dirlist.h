@@ -0,0 +1,88 @@
+/****************************************************************************
+ * netutils/thttpd/thttpd_dirlist.h
+ * Cached directory listings
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __NETUTILS_THTTPD_THTTPD_DIRLIST_H
+#define __NETUTILS_THTTPD_THTTPD_DIRLIST_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "config.h"
+#include "libhttpd.h"
+
+#if defined(CONFIG_THTTPD) && defined(CONFIG_THTTPD_GENERATE_INDICES)
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* The sorted names in a directory (opaque) */
+
+struct dirlist_s;
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/* Get the sorted names in the directory path whose attributes are in sb.
+ * The names are read on first use and taken from the cache until the
+ * directory's modification time changes.  Returns NULL if the directory
+ * cannot be read.
+ */
+
+extern FAR struct dirlist_s *thttpd_dirlist_open(FAR const char *path,
+                                                 FAR const struct stat *sb);
+
+/* Write the HTML listing of the directory to hc->conn_fd.  If
+ * CONFIG_THTTPD_INDEX_PAGESIZE is nonzero, only the page selected by
+ * "page=<n>" in the query is written.  Returns the number of bytes sent.
+ */
+
+extern off_t thttpd_dirlist_render(FAR httpd_conn *hc,
+                                   FAR struct dirlist_s *dl);
+
+/* Release a listing returned by thttpd_dirlist_open() */
+
+extern void thttpd_dirlist_close(FAR struct dirlist_s *dl);
+
+#endif /* CONFIG_THTTPD && CONFIG_THTTPD_GENERATE_INDICES */
+#endif /* __NETUTILS_THTTPD_THTTPD_DIRLIST_H */
@@ -0,0 +1,996 @@
+/****************************************************************************
+ * netutils/thttpd/thttpd_ssi.c
+ * Parsed server-side-includes templates
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/lib/regex.h>
+
+#include "config.h"
+#include "libhttpd.h"
+#include "thttpd_alloc.h"
+#include "thttpd_strings.h"
+#include "thttpd_ssi.h"
+
+#if defined(CONFIG_THTTPD) && defined(CONFIG_THTTPD_SSI)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Chunk operations */
+
+#define SSI_TEXT       0   /* Literal text */
+#define SSI_TIMEFMT    1   /* config timefmt= */
+#define SSI_SIZEFMT    2   /* config sizefmt= */
+#define SSI_INCLUDE    3   /* include virtual= or file= */
+#define SSI_ECHO       4   /* echo var= */
+#define SSI_FSIZE      5   /* fsize virtual= or file= */
+#define SSI_FLASTMOD   6   /* flastmod virtual= or file= */
+#define SSI_ERROR      7   /* Error found when parsing */
+
+/* Arguments of the file directives */
+
+#define SSI_VIRTUAL    0   /* Path relative to the document root */
+#define SSI_FILE       1   /* Path relative to the current file */
+
+/* Arguments of SSI_SIZEFMT */
+
+#define SF_BYTES       0
+#define SF_ABBREV      1
+
+/* Arguments of SSI_ECHO */
+
+#define VAR_DOCUMENT_NAME          0
+#define VAR_DOCUMENT_URI           1
+#define VAR_QUERY_STRING_UNESCAPED 2
+#define VAR_DATE_LOCAL             3
+#define VAR_DATE_GMT               4
+#define VAR_LAST_MODIFIED          5
+#define VAR_REMOTE_ADDR            6
+#define VAR_HTTP_USER_AGENT        7
+#define VAR_HTTP_REFERER           8
+#define VAR_SERVER_SOFTWARE        9
+#define VAR_ENVIRONMENT            10  /* Any other name */
+
+/* Arguments of SSI_ERROR */
+
+#define ERR_DIRECTIVE  0
+#define ERR_TAG        1
+#define ERR_VALUE      2
+#define ERR_PERMITTED  3
+
+#define SSI_TIMEFMTLEN 80
+#define SSI_BUFSIZE    512
+#define SSI_MAXDEPTH   4   /* Levels of nested include directives */
+#define SSI_NCHUNKS    16  /* Chunk array growth increment */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One piece of a template: literal text, or one tag of a directive */
+
+struct ssi_chunk_s
+{
+  uint8_t  op;                 /* SSI_* operation */
+  uint8_t  arg;                /* Operation argument */
+  uint16_t len;                /* Length of literal text */
+  uint32_t offset;             /* Text or NUL-terminated value in text */
+};
+
+struct ssi_template_s
+{
+  FAR char *path;              /* Path of the file */
+  time_t mtime;                /* Modification time of the parsed file */
+  off_t size;                  /* Size of the parsed file */
+  FAR char *text;              /* File contents, directives NUL-terminated */
+  FAR struct ssi_chunk_s *chunks;
+  int nchunks;
+  int maxchunks;
+  int inuse;                   /* Open count, not evicted while nonzero */
+  bool cached;                 /* In g_ssi_cache[] */
+  uint32_t lastuse;            /* For least-recently-used eviction */
+};
+
+/* State of one response */
+
+struct ssi_render_s
+{
+  FAR httpd_conn *hc;
+  bool failed;                 /* Write to the client failed */
+  int sizefmt;
+  int depth;
+  off_t nsent;
+  size_t buflen;
+  char timefmt[SSI_TIMEFMTLEN];
+  char buffer[SSI_BUFSIZE];
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static void ssi_run(FAR struct ssi_render_s *rs,
+                    FAR struct ssi_template_s *tpl, FAR const char *vpath);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The server is single threaded, so none of this needs a lock */
+
+static FAR struct ssi_template_s *g_ssi_cache[CONFIG_THTTPD_SSI_CACHESIZE];
+static uint32_t g_ssi_clock;
+static struct ssi_render_s g_ssi_render;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Template parsing *********************************************************/
+
+static void ssi_free(FAR struct ssi_template_s *tpl)
+{
+  httpd_free(tpl->chunks);
+  httpd_free(tpl->text);
+  httpd_free(tpl->path);
+  httpd_free(tpl);
+}
+
+static int ssi_addchunk(FAR struct ssi_template_s *tpl, int op, int arg,
+                        FAR const char *str, size_t len)
+{
+  FAR struct ssi_chunk_s *chunk;
+  FAR struct ssi_chunk_s *newchunks;
+  size_t offset = str - tpl->text;
+
+  /* Literal text longer than a chunk can describe is split */
+
+  while (len > UINT16_MAX)
+    {
+      if (ssi_addchunk(tpl, op, arg, &tpl->text[offset], UINT16_MAX) < 0)
+        {
+          return -1;
+        }
+
+      offset += UINT16_MAX;
+      len    -= UINT16_MAX;
+    }
+
+  if (tpl->nchunks >= tpl->maxchunks)
+    {
+      newchunks = RENEW(tpl->chunks, struct ssi_chunk_s, tpl->maxchunks,
+                        tpl->maxchunks + SSI_NCHUNKS);
+      if (!newchunks)
+        {
+          return -1;
+        }
+
+      tpl->chunks     = newchunks;
+      tpl->maxchunks += SSI_NCHUNKS;
+    }
+
+  chunk         = &tpl->chunks[tpl->nchunks++];
+  chunk->op     = op;
+  chunk->arg    = arg;
+  chunk->len    = len;
+  chunk->offset = offset;
+  return 0;
+}
+
+static int ssi_addtext(FAR struct ssi_template_s *tpl, FAR const char *str,
+                       size_t len)
+{
+  return len > 0 ? ssi_addchunk(tpl, SSI_TEXT, 0, str, len) : 0;
+}
+
+static int ssi_adderror(FAR struct ssi_template_s *tpl, int err,
+                        FAR const char *str)
+{
+  return ssi_addchunk(tpl, SSI_ERROR, err, str, 0);
+}
+
+static int ssi_varid(FAR const char *name)
+{
+  static FAR const char * const varnames[] =
+  {
+    "DOCUMENT_NAME", "DOCUMENT_URI", "QUERY_STRING_UNESCAPED",
+    "DATE_LOCAL", "DATE_GMT", "LAST_MODIFIED", "REMOTE_ADDR",
+    "HTTP_USER_AGENT", "HTTP_REFERER", "SERVER_SOFTWARE"
+  };
+
+  int i;
+
+  for (i = 0; i < sizeof(varnames) / sizeof(varnames[0]); i++)
+    {
+      if (strcmp(name, varnames[i]) == 0)
+        {
+          return i;
+        }
+    }
+
+  return VAR_ENVIRONMENT;
+}
+
+/* Add the chunk for one tag=value of a directive.  The checks that do not
+ * depend on the request are done here, once.
+ */
+
+static int ssi_addtag(FAR struct ssi_template_s *tpl,
+                      FAR const char *directive, FAR const char *tag,
+                      FAR const char *val)
+{
+  int op;
+
+  if (strcmp(directive, "config") == 0)
+    {
+      if (strcmp(tag, "timefmt") == 0)
+        {
+          return ssi_addchunk(tpl, SSI_TIMEFMT, 0, val, 0);
+        }
+      else if (strcmp(tag, "sizefmt") != 0)
+        {
+          return ssi_adderror(tpl, ERR_TAG, tag);
+        }
+      else if (strcmp(val, "bytes") == 0)
+        {
+          return ssi_addchunk(tpl, SSI_SIZEFMT, SF_BYTES, val, 0);
+        }
+      else if (strcmp(val, "abbrev") == 0)
+        {
+          return ssi_addchunk(tpl, SSI_SIZEFMT, SF_ABBREV, val, 0);
+        }
+
+      return ssi_adderror(tpl, ERR_VALUE, val);
+    }
+
+  if (strcmp(directive, "echo") == 0)
+    {
+      if (strcmp(tag, "var") != 0)
+        {
+          return ssi_adderror(tpl, ERR_TAG, tag);
+        }
+
+      return ssi_addchunk(tpl, SSI_ECHO, ssi_varid(val), val, 0);
+    }
+
+  if (strcmp(directive, "include") == 0)
+    {
+      op = SSI_INCLUDE;
+    }
+  else if (strcmp(directive, "fsize") == 0)
+    {
+      op = SSI_FSIZE;
+    }
+  else if (strcmp(directive, "flastmod") == 0)
+    {
+      op = SSI_FLASTMOD;
+    }
+  else
+    {
+      return ssi_adderror(tpl, ERR_DIRECTIVE, directive);
+    }
+
+  /* ../ cannot be used in either path, and file= paths are relative */
+
+  if (strcmp(tag, "virtual") == 0)
+    {
+      if (strstr(val, "../") != NULL)
+        {
+          return ssi_adderror(tpl, ERR_PERMITTED, val);
+        }
+
+      return ssi_addchunk(tpl, op, SSI_VIRTUAL, val, 0);
+    }
+  else if (strcmp(tag, "file") == 0)
+    {
+      if (val[0] == '/' || strstr(val, "../") != NULL)
+        {
+          return ssi_adderror(tpl, ERR_PERMITTED, val);
+        }
+
+      return ssi_addchunk(tpl, op, SSI_FILE, val, 0);
+    }
+
+  return ssi_adderror(tpl, ERR_TAG, tag);
+}
+
+/* Parse the text between "<!--#" and "-->".  The directive name, tags and
+ * values are NUL-terminated in place.
+ */
+
+static int ssi_parsedirective(FAR struct ssi_template_s *tpl, FAR char *str)
+{
+  FAR char *directive;
+  FAR char *tag;
+  FAR char *val;
+  FAR char *cp;
+
+  directive = str + strspn(str, " \t\n\r");
+  cp = directive + strcspn(directive, " \t\n\r");
+  if (*cp != '\0')
+    {
+      *cp++ = '\0';
+    }
+
+  for (; ; )
+    {
+      cp += strspn(cp, " \t\n\r");
+      if (*cp == '\0')
+        {
+          return 0;
+        }
+
+      /* tag=value or tag="value with spaces" */
+
+      tag = cp;
+      cp += strcspn(cp, "= \t\n\r");
+      if (*cp == '=')
+        {
+          *cp++ = '\0';
+          if (*cp == '"')
+            {
+              val = ++cp;
+              cp += strcspn(cp, "\"");
+            }
+          else
+            {
+              val = cp;
+              cp += strcspn(cp, " \t\n\r");
+            }
+        }
+      else
+        {
+          val = cp;
+        }
+
+      if (*cp != '\0')
+        {
+          *cp++ = '\0';
+        }
+
+      if (ssi_addtag(tpl, directive, tag, val) < 0)
+        {
+          return -1;
+        }
+    }
+}
+
+static int ssi_parse(FAR struct ssi_template_s *tpl, size_t len)
+{
+  FAR char *text = tpl->text;
+  FAR char *start;
+  FAR char *end;
+
+  while ((start = strstr(text, "<!--#")) != NULL)
+    {
+      if (ssi_addtext(tpl, text, start - text) < 0)
+        {
+          return -1;
+        }
+
+      /* An unterminated directive swallows the rest of the file */
+
+      end = strstr(start + 5, "-->");
+      if (end == NULL)
+        {
+          return 0;
+        }
+
+      *end = '\0';
+      if (ssi_parsedirective(tpl, start + 5) < 0)
+        {
+          return -1;
+        }
+
+      text = end + 3;
+    }
+
+  return ssi_addtext(tpl, text, &tpl->text[len] - text);
+}
+
+static FAR struct ssi_template_s *ssi_load(FAR const char *path,
+                                           FAR const struct stat *sb)
+{
+  FAR struct ssi_template_s *tpl;
+  ssize_t nread;
+  int fd;
+
+  if (sb->st_size > CONFIG_THTTPD_SSI_MAXSIZE)
+    {
+      nwarn("WARNING: %s is larger than the SSI size limit\n", path);
+      return NULL;
+    }
+
+  tpl = (FAR struct ssi_template_s *)httpd_malloc(sizeof(*tpl));
+  if (!tpl)
+    {
+      return NULL;
+    }
+
+  memset(tpl, 0, sizeof(*tpl));
+  tpl->mtime = sb->st_mtime;
+  tpl->size  = sb->st_size;
+  tpl->path  = httpd_strdup(path);
+  tpl->text  = (FAR char *)httpd_malloc(sb->st_size + 1);
+  if (!tpl->path || !tpl->text)
+    {
+      goto errout;
+    }
+
+  fd = open(path, O_RDONLY);
+  if (fd < 0)
+    {
+      goto errout;
+    }
+
+  nread = httpd_read(fd, tpl->text, sb->st_size);
+  close(fd);
+
+  if (nread < 0)
+    {
+      goto errout;
+    }
+
+  /* strstr() must not see NULs in the file as the end of the template */
+
+  tpl->text[nread] = '\0';
+  if (strlen(tpl->text) != nread)
+    {
+      nwarn("WARNING: %s contains NUL characters\n", path);
+      goto errout;
+    }
+
+  if (ssi_parse(tpl, nread) < 0)
+    {
+      goto errout;
+    }
+
+  return tpl;
+
+errout:
+  ssi_free(tpl);
+  return NULL;
+}
+
+/* Rendering ****************************************************************/
+
+static void ssi_flush(FAR struct ssi_render_s *rs)
+{
+  if (rs->buflen > 0 && !rs->failed)
+    {
+      if (httpd_write(rs->hc->conn_fd, rs->buffer, rs->buflen) < 0)
+        {
+          rs->failed = true;
+        }
+      else
+        {
+          rs->nsent += rs->buflen;
+        }
+    }
+
+  rs->buflen = 0;
+}
+
+static void ssi_write(FAR struct ssi_render_s *rs, FAR const char *str,
+                      size_t len)
+{
+  if (rs->buflen + len > SSI_BUFSIZE)
+    {
+      ssi_flush(rs);
+
+      /* Large literal text goes straight from the template to the client */
+
+      if (len > SSI_BUFSIZE)
+        {
+          if (!rs->failed)
+            {
+              if (httpd_write(rs->hc->conn_fd, str, len) < 0)
+                {
+                  rs->failed = true;
+                }
+              else
+                {
+                  rs->nsent += len;
+                }
+            }
+
+          return;
+        }
+    }
+
+  memcpy(&rs->buffer[rs->buflen], str, len);
+  rs->buflen += len;
+}
+
+static void ssi_puts(FAR struct ssi_render_s *rs, FAR const char *str)
+{
+  ssi_write(rs, str, strlen(str));
+}
+
+static void ssi_printf(FAR struct ssi_render_s *rs, FAR const char *fmt, ...)
+{
+  char line[160];
+  va_list ap;
+  int len;
+
+  va_start(ap, fmt);
+  len = vsnprintf(line, sizeof(line), fmt, ap);
+  va_end(ap);
+
+  if (len >= sizeof(line))
+    {
+      len = sizeof(line) - 1;
+    }
+
+  if (len > 0)
+    {
+      ssi_write(rs, line, len);
+    }
+}
+
+static void ssi_error(FAR struct ssi_render_s *rs, FAR const char *title,
+                      FAR const char *what, FAR const char *arg)
+{
+  ssi_printf(rs, "<HR><H2>%s</H2>\n%s: %s\n<HR>\n", title, what, arg);
+}
+
+static void ssi_showtime(FAR struct ssi_render_s *rs, time_t t, bool gmt)
+{
+  char tmbuf[SSI_TIMEFMTLEN];
+  FAR struct tm *tm;
+
+  tm = gmt ? gmtime(&t) : localtime(&t);
+  if (tm != NULL && strftime(tmbuf, sizeof(tmbuf), rs->timefmt, tm) > 0)
+    {
+      ssi_puts(rs, tmbuf);
+    }
+}
+
+static void ssi_showsize(FAR struct ssi_render_s *rs, off_t size)
+{
+  if (rs->sizefmt == SF_BYTES || size < 1024)
+    {
+      ssi_printf(rs, "%ld", (long)size);
+    }
+  else if (size < 1024 * 1024)
+    {
+      ssi_printf(rs, "%ldK", (long)size / 1024L);
+    }
+  else if (size < 1024 * 1024 * 1024)
+    {
+      ssi_printf(rs, "%ldM", (long)size / (1024L * 1024L));
+    }
+  else
+    {
+      ssi_printf(rs, "%ldG", (long)size / (1024L * 1024L * 1024L));
+    }
+}
+
+/* Check that a file named in a directive may be shown.  CGI programs and
+ * authorization files are never shown.
+ */
+
+static bool ssi_permitted(FAR const char *path)
+{
+#ifdef CONFIG_AUTH_FILE
+  FAR const char *name;
+#endif
+
+#ifdef CONFIG_THTTPD_CGI_PATTERN
+  if (match(CONFIG_THTTPD_CGI_PATTERN, path))
+    {
+      return false;
+    }
+#endif
+
+#ifdef CONFIG_AUTH_FILE
+  name = strrchr(path, '/');
+  name = name ? name + 1 : path;
+  if (strcmp(name, CONFIG_AUTH_FILE) == 0)
+    {
+      return false;
+    }
+#endif
+
+  return true;
+}
+
+/* Build the file and virtual paths named by a file directive.  Returns
+ * false if either does not fit.
+ */
+
+static bool ssi_filename(FAR const struct ssi_template_s *tpl, int arg,
+                         FAR const char *val, FAR const char *vpath,
+                         FAR char *path, FAR char *vpath2, size_t size)
+{
+  FAR const char *slash;
+  int len;
+
+  if (arg == SSI_VIRTUAL)
+    {
+      len = snprintf(path, size, "%s%s%s", httpd_root,
+                     val[0] == '/' ? "" : "/", val);
+      if (len >= size)
+        {
+          return false;
+        }
+
+      len = snprintf(vpath2, size, "%s%s", val[0] == '/' ? "" : "/", val);
+      return len < size;
+    }
+
+  slash = strrchr(tpl->path, '/');
+  len   = slash ? slash - tpl->path + 1 : 0;
+  if (snprintf(path, size, "%.*s%s", len, tpl->path, val) >= size)
+    {
+      return false;
+    }
+
+  slash = strrchr(vpath, '/');
+  len   = slash ? slash - vpath + 1 : 0;
+  return snprintf(vpath2, size, "%.*s%s", len, vpath, val) < size;
+}
+
+static void ssi_dofile(FAR struct ssi_render_s *rs,
+                       FAR struct ssi_template_s *tpl,
+                       FAR const struct ssi_chunk_s *chunk,
+                       FAR const char *vpath)
+{
+  FAR struct ssi_template_s *tpl2;
+  FAR const char *val = &tpl->text[chunk->offset];
+  FAR char *path;
+  FAR char *vpath2;
+  struct stat sb;
+
+  path = (FAR char *)httpd_malloc(2 * PATH_MAX);
+  if (!path)
+    {
+      ssi_error(rs, "Internal Error", "Out of memory in", val);
+      return;
+    }
+
+  vpath2 = &path[PATH_MAX];
+  if (!ssi_filename(tpl, chunk->arg, val, vpath, path, vpath2,
+                    PATH_MAX))
+    {
+      ssi_error(rs, "Not Found", "The file name is too long", val);
+    }
+  else if (!ssi_permitted(path))
+    {
+      ssi_error(rs, "Not Permitted", "This file may not be fetched", val);
+    }
+  else if (stat(path, &sb) < 0 || !(sb.st_mode & S_IROTH) ||
+           S_ISDIR(sb.st_mode))
+    {
+      ssi_error(rs, "Not Found", "The file does not seem to exist", val);
+    }
+  else if (chunk->op == SSI_FSIZE)
+    {
+      ssi_showsize(rs, sb.st_size);
+    }
+  else if (chunk->op == SSI_FLASTMOD)
+    {
+      ssi_showtime(rs, sb.st_mtime, false);
+    }
+  else if (rs->depth >= SSI_MAXDEPTH)
+    {
+      ssi_error(rs, "Not Permitted", "Includes are nested too deep", val);
+    }
+  else
+    {
+      tpl2 = thttpd_ssi_open(path, &sb);
+      if (!tpl2)
+        {
+          ssi_error(rs, "Internal Error", "Could not read", val);
+        }
+      else
+        {
+          rs->depth++;
+          ssi_run(rs, tpl2, vpath2);
+          rs->depth--;
+          thttpd_ssi_close(tpl2);
+        }
+    }
+
+  httpd_free(path);
+}
+
+static void ssi_echo(FAR struct ssi_render_s *rs,
+                     FAR const struct ssi_template_s *tpl,
+                     FAR const struct ssi_chunk_s *chunk,
+                     FAR const char *vpath)
+{
+  FAR httpd_conn *hc = rs->hc;
+  FAR const char *val = &tpl->text[chunk->offset];
+  FAR const char *str = NULL;
+  struct timeval tv;
+
+  switch (chunk->arg)
+    {
+      case VAR_DOCUMENT_NAME:
+        str = tpl->path;
+        break;
+
+      case VAR_DOCUMENT_URI:
+        str = vpath;
+        break;
+
+      case VAR_QUERY_STRING_UNESCAPED:
+        str = hc->query;
+        break;
+
+      case VAR_DATE_LOCAL:
+      case VAR_DATE_GMT:
+        gettimeofday(&tv, NULL);
+        ssi_showtime(rs, tv.tv_sec, chunk->arg == VAR_DATE_GMT);
+        return;
+
+      case VAR_LAST_MODIFIED:
+        ssi_showtime(rs, tpl->mtime, false);
+        return;
+
+      case VAR_REMOTE_ADDR:
+        str = httpd_ntoa(&hc->client_addr);
+        break;
+
+      case VAR_HTTP_USER_AGENT:
+        str = hc->useragent;
+        break;
+
+      case VAR_HTTP_REFERER:
+        str = hc->referer;
+        break;
+
+      case VAR_SERVER_SOFTWARE:
+        str = CONFIG_THTTPD_SERVER_SOFTWARE;
+        break;
+
+      default:
+        str = getenv(val);
+        if (!str)
+          {
+            ssi_error(rs, "Unknown Value", "Unknown variable", val);
+            return;
+          }
+        break;
+    }
+
+  if (str)
+    {
+      ssi_puts(rs, str);
+    }
+}
+
+static void ssi_run(FAR struct ssi_render_s *rs,
+                    FAR struct ssi_template_s *tpl, FAR const char *vpath)
+{
+  FAR const struct ssi_chunk_s *chunk;
+  FAR const char *str;
+  int i;
+
+  for (i = 0; i < tpl->nchunks && !rs->failed; i++)
+    {
+      chunk = &tpl->chunks[i];
+      str   = &tpl->text[chunk->offset];
+
+      switch (chunk->op)
+        {
+          case SSI_TEXT:
+            ssi_write(rs, str, chunk->len);
+            break;
+
+          case SSI_TIMEFMT:
+            strncpy(rs->timefmt, str, SSI_TIMEFMTLEN - 1);
+            rs->timefmt[SSI_TIMEFMTLEN - 1] = '\0';
+            break;
+
+          case SSI_SIZEFMT:
+            rs->sizefmt = chunk->arg;
+            break;
+
+          case SSI_ECHO:
+            ssi_echo(rs, tpl, chunk, vpath);
+            break;
+
+          case SSI_INCLUDE:
+          case SSI_FSIZE:
+          case SSI_FLASTMOD:
+            ssi_dofile(rs, tpl, chunk, vpath);
+            break;
+
+          case SSI_ERROR:
+            switch (chunk->arg)
+              {
+                case ERR_DIRECTIVE:
+                  ssi_error(rs, "Unknown Directive", tpl->path, str);
+                  break;
+
+                case ERR_TAG:
+                  ssi_error(rs, "Unknown Tag", tpl->path, str);
+                  break;
+
+                case ERR_VALUE:
+                  ssi_error(rs, "Unknown Value", tpl->path, str);
+                  break;
+
+                default:
+                  ssi_error(rs, "Not Permitted",
+                            "This file may not be fetched", str);
+                  break;
+              }
+            break;
+        }
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+FAR struct ssi_template_s *thttpd_ssi_open(FAR const char *path,
+                                           FAR const struct stat *sb)
+{
+  FAR struct ssi_template_s *tpl;
+  int victim = -1;
+  int stale = -1;
+  int i;
+
+  g_ssi_clock++;
+
+  /* Look for a current copy, and for the slot to replace if there is none:
+   * a stale copy of the same file, an empty slot or the least recently
+   * used template that is not being rendered.
+   */
+
+  for (i = 0; i < CONFIG_THTTPD_SSI_CACHESIZE; i++)
+    {
+      tpl = g_ssi_cache[i];
+      if (!tpl)
+        {
+          if (victim < 0 || g_ssi_cache[victim])
+            {
+              victim = i;
+            }
+        }
+      else if (strcmp(tpl->path, path) == 0 &&
+               tpl->mtime == sb->st_mtime && tpl->size == sb->st_size)
+        {
+          tpl->inuse++;
+          tpl->lastuse = g_ssi_clock;
+          return tpl;
+        }
+      else if (tpl->inuse > 0)
+        {
+          continue;
+        }
+      else if (strcmp(tpl->path, path) == 0)
+        {
+          stale = i;
+        }
+      else if (victim < 0 || (g_ssi_cache[victim] &&
+                              tpl->lastuse < g_ssi_cache[victim]->lastuse))
+        {
+          victim = i;
+        }
+    }
+
+  if (stale >= 0)
+    {
+      victim = stale;
+    }
+
+  tpl = ssi_load(path, sb);
+  if (!tpl)
+    {
+      return NULL;
+    }
+
+  /* If every slot is being rendered, the template is used once */
+
+  tpl->inuse   = 1;
+  tpl->lastuse = g_ssi_clock;
+  if (victim >= 0)
+    {
+      if (g_ssi_cache[victim])
+        {
+          ssi_free(g_ssi_cache[victim]);
+        }
+
+      g_ssi_cache[victim] = tpl;
+      tpl->cached = true;
+    }
+
+  return tpl;
+}
+
+off_t thttpd_ssi_render(FAR httpd_conn *hc, FAR struct ssi_template_s *tpl)
+{
+  FAR struct ssi_render_s *rs = &g_ssi_render;
+  FAR char *vpath;
+
+  rs->hc      = hc;
+  rs->failed  = false;
+  rs->sizefmt = SF_BYTES;
+  rs->depth   = 0;
+  rs->nsent   = 0;
+  rs->buflen  = 0;
+  strcpy(rs->timefmt, "%a %b %e %T %Z %Y");
+
+  /* DOCUMENT_URI of the requested file */
+
+  vpath = (FAR char *)httpd_malloc(strlen(hc->origfilename) + 2);
+  if (vpath)
+    {
+      sprintf(vpath, "/%s", hc->origfilename);
+      ssi_run(rs, tpl, vpath);
+      ssi_flush(rs);
+      httpd_free(vpath);
+    }
+
+  return rs->nsent;
+}
+
+void thttpd_ssi_close(FAR struct ssi_template_s *tpl)
+{
+  tpl->inuse--;
+  if (!tpl->cached)
+    {
+      ssi_free(tpl);
+    }
+}
+
+#endif /* CONFIG_THTTPD && CONFIG_THTTPD_SSI */
@@ -0,0 +1,87 @@
+/****************************************************************************
+ * netutils/thttpd/thttpd_ssi.h
+ * Parsed server-side-includes templates
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __NETUTILS_THTTPD_THTTPD_SSI_H
+#define __NETUTILS_THTTPD_THTTPD_SSI_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "config.h"
+#include "libhttpd.h"
+
+#if defined(CONFIG_THTTPD) && defined(CONFIG_THTTPD_SSI)
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* A template parsed into literal text and directives (opaque) */
+
+struct ssi_template_s;
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/* Get the parsed template for the file path whose attributes are in sb.
+ * The template is parsed on first use and taken from the cache until the
+ * file's size or modification time changes.  Returns NULL if the file
+ * cannot be read or is larger than CONFIG_THTTPD_SSI_MAXSIZE.
+ */
+
+extern FAR struct ssi_template_s *thttpd_ssi_open(FAR const char *path,
+                                                  FAR const struct stat *sb);
+
+/* Write the body of an SSI response to hc->conn_fd, running the
+ * directives of the template.  Returns the number of bytes sent.
+ */
+
+extern off_t thttpd_ssi_render(FAR httpd_conn *hc,
+                               FAR struct ssi_template_s *tpl);
+
+/* Release a template returned by thttpd_ssi_open() */
+
+extern void thttpd_ssi_close(FAR struct ssi_template_s *tpl);
+
+#endif /* CONFIG_THTTPD && CONFIG_THTTPD_SSI */
+#endif /* __NETUTILS_THTTPD_THTTPD_SSI_H */
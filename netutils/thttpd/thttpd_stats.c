@@ -0,0 +1,196 @@
+/****************************************************************************
+ * netutils/thttpd/thttpd_stats.c
+ * Server statistics
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/time.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "config.h"
+#include "thttpd_stats.h"
+
+#if defined(CONFIG_THTTPD) && defined(CONFIG_THTTPD_STATS)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Request times are sorted into buckets that grow by a factor of four:
+ * <1, <4, <16, <64, <256, <1024, <4096 and >=4096 milliseconds.
+ */
+
+#define STATS_NBUCKETS 8
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct thttpd_stats_s
+{
+  uint32_t accepted;                     /* Connections accepted */
+  uint32_t closed;                       /* Connections completed */
+  uint32_t nbytes;                       /* Body bytes sent */
+  uint32_t msec[THTTPD_STATS_NPHASES];   /* Time in each phase */
+  uint32_t usec[THTTPD_STATS_NPHASES];   /* Remainder below one msec */
+  uint32_t hist[THTTPD_STATS_NCLASSES][STATS_NBUCKETS];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The statistics are only updated from the main loop, so no locking is
+ * needed.
+ */
+
+static struct thttpd_stats_s g_stats;
+
+static const char * const g_classname[THTTPD_STATS_NCLASSES] =
+{
+  "static", "cgi", "error"
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t stats_elapsed(FAR const struct timeval *start,
+                              FAR const struct timeval *end)
+{
+  long usec;
+
+  usec = (end->tv_sec - start->tv_sec) * 1000000L +
+         (end->tv_usec - start->tv_usec);
+  return usec > 0 ? (uint32_t)usec : 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+void thttpd_stats_accept(void)
+{
+  g_stats.accepted++;
+}
+
+void thttpd_stats_close(int sclass, off_t nbytes,
+                        FAR const struct timeval *start)
+{
+  struct timeval now;
+  uint32_t msec;
+  int bucket;
+
+  (void)gettimeofday(&now, NULL);
+  msec = stats_elapsed(start, &now) / 1000;
+
+  for (bucket = 0; bucket < STATS_NBUCKETS - 1 && msec >= 1; bucket++)
+    {
+      msec >>= 2;
+    }
+
+  g_stats.hist[sclass][bucket]++;
+  g_stats.closed++;
+
+  if (nbytes > 0)
+    {
+      g_stats.nbytes += nbytes;
+    }
+}
+
+void thttpd_stats_phase(int phase, FAR const struct timeval *start,
+                        FAR const struct timeval *end)
+{
+  g_stats.usec[phase] += stats_elapsed(start, end);
+  g_stats.msec[phase] += g_stats.usec[phase] / 1000;
+  g_stats.usec[phase] %= 1000;
+}
+
+int thttpd_stats_format(FAR char *buffer, size_t buflen)
+{
+  size_t len;
+  uint32_t total;
+  int i;
+  int j;
+
+  len = snprintf(buffer, buflen,
+                 "Connections accepted: %lu\n"
+                 "Connections active:   %lu\n"
+                 "Bytes sent:           %lu\n"
+                 "Wait time (msec):     %lu\n"
+                 "Handler time (msec):  %lu\n"
+                 "\n"
+                 "Request time (msec):\n"
+                 "class     total   <1   <4  <16  <64 <256  <1k  <4k  4k+\n",
+                 (unsigned long)g_stats.accepted,
+                 (unsigned long)(g_stats.accepted - g_stats.closed),
+                 (unsigned long)g_stats.nbytes,
+                 (unsigned long)g_stats.msec[THTTPD_STATS_WAIT],
+                 (unsigned long)g_stats.msec[THTTPD_STATS_HANDLE]);
+
+  for (i = 0; i < THTTPD_STATS_NCLASSES && len < buflen; i++)
+    {
+      total = 0;
+      for (j = 0; j < STATS_NBUCKETS; j++)
+        {
+          total += g_stats.hist[i][j];
+        }
+
+      len += snprintf(&buffer[len], buflen - len, "%-6s %8lu",
+                      g_classname[i], (unsigned long)total);
+
+      for (j = 0; j < STATS_NBUCKETS && len < buflen; j++)
+        {
+          len += snprintf(&buffer[len], buflen - len, " %4lu",
+                          (unsigned long)g_stats.hist[i][j]);
+        }
+
+      if (len < buflen)
+        {
+          len += snprintf(&buffer[len], buflen - len, "\n");
+        }
+    }
+
+  return len < buflen ? len : buflen - 1;
+}
+
+#endif /* CONFIG_THTTPD && CONFIG_THTTPD_STATS */
@@ -0,0 +1,109 @@
+/****************************************************************************
+ * netutils/thttpd/thttpd_stats.h
+ * Server statistics
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __NETUTILS_THTTPD_THTTPD_STATS_H
+#define __NETUTILS_THTTPD_THTTPD_STATS_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/time.h>
+
+#include "config.h"
+
+#if defined(CONFIG_THTTPD) && defined(CONFIG_THTTPD_STATS)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* A buffer of this size holds the complete statistics report */
+
+#define THTTPD_STATS_REPORTLEN 640
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Responses are counted in these classes */
+
+enum thttpd_stats_class_e
+{
+  THTTPD_STATS_STATIC = 0,       /* Files and pages generated by the server */
+  THTTPD_STATS_CGI,              /* Output of CGI programs */
+  THTTPD_STATS_ERROR,            /* Error responses */
+  THTTPD_STATS_NCLASSES
+};
+
+/* Phases of the main loop */
+
+enum thttpd_stats_phase_e
+{
+  THTTPD_STATS_WAIT = 0,         /* Waiting in fdwatch() */
+  THTTPD_STATS_HANDLE,           /* Running the handlers and timers */
+  THTTPD_STATS_NPHASES
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/* Count a new connection */
+
+extern void thttpd_stats_accept(void);
+
+/* Count a completed connection.  start is the time that the connection was
+ * accepted and nbytes is the number of body bytes sent.
+ */
+
+extern void thttpd_stats_close(int sclass, off_t nbytes,
+                               FAR const struct timeval *start);
+
+/* Add the time between start and end to a main loop phase */
+
+extern void thttpd_stats_phase(int phase, FAR const struct timeval *start,
+                               FAR const struct timeval *end);
+
+/* Format the report as plain text.  Returns the length of the report. */
+
+extern int thttpd_stats_format(FAR char *buffer, size_t buflen);
+
+#endif /* CONFIG_THTTPD && CONFIG_THTTPD_STATS */
+#endif /* __NETUTILS_THTTPD_THTTPD_STATS_H */
@@ -51,15 +51,43 @@
  * Pre-Processor Definitons
  ****************************************************************************/
 
-#define HASH_SIZE 67
+/* Timers are kept in a hierarchical timing wheel.  Time is quantized into
+ * ticks of TMR_TICK_MSEC milliseconds.  Each of the TMR_NLEVELS levels
+ * has TMR_NSLOTS slots, each slot of a level covering TMR_NSLOTS slots of
+ * the level below.  With the values below, the wheel spans 2**24 ticks
+ * (about 46 hours); timers further in the future are parked in the last
+ * level and re-inserted as time advances.
+ */
+
+#define TMR_TICK_MSEC   10
+#define TMR_SLOTBITS    6
+#define TMR_NSLOTS      (1 << TMR_SLOTBITS)
+#define TMR_SLOTMASK    (TMR_NSLOTS - 1)
+#define TMR_NLEVELS     4
+#define TMR_MAXDELTA    ((1ul << (TMR_SLOTBITS * TMR_NLEVELS)) - 1)
+
+/* Special values of Timer::slot */
+
+#define TMR_EXPIRED     (TMR_NLEVELS * TMR_NSLOTS) /* On the expired list */
+#define TMR_DETACHED    -1                         /* Not on any list */
+
+/* Wrap-safe tick comparison */
+
+#define TICK_AFTER_EQ(a,b) ((long)((a) - (b)) >= 0)
 
 /****************************************************************************
  * Private Data
  ****************************************************************************/
 
-static Timer *timers[HASH_SIZE];
+/* The wheel plus one extra list head for timers being expired */
+
+static Timer *timers[TMR_NLEVELS * TMR_NSLOTS + 1];
 static Timer *free_timers;
 
+static struct timeval g_basetime;  /* Time corresponding to tick zero */
+static unsigned long g_nexttick;   /* Next tick to be processed */
+static unsigned int g_ntimers;     /* Number of timers in the wheel */
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -70,76 +98,91 @@ ClientData JunkClientData;
  * Private Functions
  ****************************************************************************/
 
-static unsigned int hash(Timer *tmr)
+/* Convert a time to milliseconds relative to the wheel base time */
+
+static unsigned long tmr_msec(struct timeval *tv)
 {
-  /* We can hash on the trigger time, even though it can change over the
-   * life of a timer via the periodic bit.
-   * This is because both of those guys call l_resort(), which  * recomputes
-   * the hash and moves the timer to the appropriate list.
-   */
+  return (unsigned long)(tv->tv_sec - g_basetime.tv_sec) * 1000ul +
+         (unsigned long)((tv->tv_usec - g_basetime.tv_usec) / 1000L);
+}
+
+/* Return the current tick.  Partial ticks are truncated. */
 
-  return ((unsigned int)tmr->time.tv_sec ^
-          (unsigned int)tmr->time.tv_usec) % HASH_SIZE;
+static unsigned long tmr_nowtick(struct timeval *now)
+{
+  return tmr_msec(now) / TMR_TICK_MSEC;
+}
+
+/* Return the tick in which a timer expires.  Partial ticks are rounded up
+ * so that a timer never runs before its expiration time.
+ */
+
+static unsigned long tmr_expiretick(Timer *tmr)
+{
+  return (tmr_msec(&tmr->time) + TMR_TICK_MSEC - 1) / TMR_TICK_MSEC;
 }
 
 static void l_add(Timer *tmr)
 {
-  int h = tmr->hash;
-  register Timer *tmr2;
-  register Timer *tmr2prev;
+  unsigned long expires = tmr->tick;
+  unsigned long delta;
+  int level;
+  int h;
 
-  tmr2 = timers[h];
-  if (tmr2 == NULL)
+  /* Timers that are already due are added to the slot that will be
+   * processed next.
+   */
+
+  if (!TICK_AFTER_EQ(expires, g_nexttick))
     {
-      /* The list is empty. */
-      timers[h] = tmr;
-      tmr->prev = tmr->next = NULL;
+      expires = g_nexttick;
     }
-  else
+
+  delta = expires - g_nexttick;
+  if (delta > TMR_MAXDELTA)
     {
-      if (tmr->time.tv_sec < tmr2->time.tv_sec ||
-          (tmr->time.tv_sec == tmr2->time.tv_sec &&
-           tmr->time.tv_usec <= tmr2->time.tv_usec))
-        {
-          /* The new timer goes at the head of the list. */
+      /* Park it in the farthest slot.  It will be re-inserted when that
+       * slot is cascaded.
+       */
 
-          timers[h] = tmr;
-          tmr->prev = NULL;
-          tmr->next = tmr2;
-          tmr2->prev = tmr;
-        }
-      else
+      delta   = TMR_MAXDELTA;
+      expires = g_nexttick + delta;
+    }
+
+  /* Find the level that can hold this delta */
+
+  for (level = 0; level < TMR_NLEVELS - 1; level++)
+    {
+      if (delta < (1ul << (TMR_SLOTBITS * (level + 1))))
         {
-          /* Walk the list to find the insertion point. */
+          break;
+        }
+    }
 
-          for (tmr2prev = tmr2, tmr2 = tmr2->next; tmr2 != NULL;
-               tmr2prev = tmr2, tmr2 = tmr2->next)
-            {
-              if (tmr->time.tv_sec < tmr2->time.tv_sec ||
-                  (tmr->time.tv_sec == tmr2->time.tv_sec &&
-                   tmr->time.tv_usec <= tmr2->time.tv_usec))
-                {
-                  /* Found it. */
-                  tmr2prev->next = tmr;
-                  tmr->prev = tmr2prev;
-                  tmr->next = tmr2;
-                  tmr2->prev = tmr;
-                  return;
-                }
-            }
+  h = level * TMR_NSLOTS +
+      ((expires >> (TMR_SLOTBITS * level)) & TMR_SLOTMASK);
 
-          /* Oops, got to the end of the list.  Add to tail. */
+  /* Add at the head of the slot list */
 
-          tmr2prev->next = tmr;
-          tmr->prev = tmr2prev;
-          tmr->next = NULL;
-        }
+  tmr->slot = h;
+  tmr->prev = NULL;
+  tmr->next = timers[h];
+  if (timers[h] != NULL)
+    {
+      timers[h]->prev = tmr;
     }
+
+  timers[h] = tmr;
 }
 
 static void l_remove(Timer *tmr)
 {
-  int h = tmr->hash;
+  int h = tmr->slot;
+
+  if (h == TMR_DETACHED)
+    {
+      return;
+    }
 
   if (tmr->prev == NULL)
     {
@@ -154,21 +197,42 @@ static void l_remove(Timer *tmr)
     {
       tmr->next->prev = tmr->prev;
     }
+
+  tmr->slot = TMR_DETACHED;
+  tmr->prev = NULL;
+  tmr->next = NULL;
 }
 
-static void l_resort(Timer *tmr)
+/* Move all timers of one slot of a higher level down the wheel */
+
+static void l_cascade(int level)
 {
-  /* Remove the timer from its old list. */
+  Timer *tmr;
+  int h;
 
-  l_remove(tmr);
+  h = level * TMR_NSLOTS +
+      ((g_nexttick >> (TMR_SLOTBITS * level)) & TMR_SLOTMASK);
 
-  /* Recompute the hash. */
+  while ((tmr = timers[h]) != NULL)
+    {
+      l_remove(tmr);
+      l_add(tmr);
+    }
+}
 
-  tmr->hash = hash(tmr);
+/* Compute the expiration time of a timer from the time it was last set */
 
-  /* And add it back in to its new list, sorted correctly. */
+static void tmr_settime(Timer *tmr)
+{
+  tmr->time.tv_sec  += tmr->msecs / 1000L;
+  tmr->time.tv_usec += (tmr->msecs % 1000L) * 1000L;
+  if (tmr->time.tv_usec >= 1000000L)
+    {
+      tmr->time.tv_sec  += tmr->time.tv_usec / 1000000L;
+      tmr->time.tv_usec %= 1000000L;
+    }
 
-  l_add(tmr);
+  tmr->tick = tmr_expiretick(tmr);
 }
 
 /****************************************************************************
@@ -179,12 +243,16 @@ void tmr_init(void)
 {
   int h;
 
-  for (h = 0; h < HASH_SIZE; ++h)
+  for (h = 0; h < TMR_NLEVELS * TMR_NSLOTS + 1; ++h)
     {
       timers[h] = NULL;
     }
 
   free_timers = NULL;
+  g_ntimers   = 0;
+
+  (void)gettimeofday(&g_basetime, NULL);
+  g_nexttick  = 0;
 }
 
 Timer *tmr_create(struct timeval *now, TimerProc *timer_proc,
@@ -220,59 +288,52 @@ Timer *tmr_create(struct timeval *now, TimerProc *timer_proc,
       (void)gettimeofday(&tmr->time, NULL);
     }
 
-  tmr->time.tv_sec  += msecs / 1000L;
-  tmr->time.tv_usec += (msecs % 1000L) * 1000L;
-  if (tmr->time.tv_usec >= 1000000L)
-    {
-      tmr->time.tv_sec  += tmr->time.tv_usec / 1000000L;
-      tmr->time.tv_usec %= 1000000L;
-    }
-  tmr->hash = hash(tmr);
+  tmr_settime(tmr);
 
-  /* Add the new timer to the proper active list. */
+  /* Add the new timer to the proper wheel slot. */
 
   l_add(tmr);
+  g_ntimers++;
   return tmr;
 }
 
 long tmr_mstimeout(struct timeval *now)
 {
-  int h;
-  int gotone;
-  long msecs, m;
-  register Timer *tmr;
+  unsigned long nowms;
+  unsigned long tick;
+  long msecs;
+  int i;
 
-  gotone = 0;
-  msecs  = 0;
+  if (g_ntimers == 0)
+    {
+      return INFTIM;
+    }
 
-  /* Since the lists are sorted, we only need to look at the  * first timer on
-   * each one.
-   */
+  /* Anything waiting on the expired list is due now */
 
-  for (h = 0; h < HASH_SIZE; ++h)
+  if (timers[TMR_EXPIRED] != NULL)
     {
-      tmr = timers[h];
-      if (tmr != NULL)
-        {
-          m = (tmr->time.tv_sec - now->tv_sec) * 1000L +
-            (tmr->time.tv_usec - now->tv_usec) / 1000L;
-          if (!gotone)
-            {
-              msecs = m;
-              gotone = 1;
-            }
-          else if (m < msecs)
-            {
-              msecs = m;
-            }
-        }
+      return 0;
     }
 
-  if (!gotone)
+  /* Look for the first occupied slot in the lowest level.  This is bounded
+   * by the number of slots, not by the number of timers.  If none is found
+   * before the lowest level wraps, wake up when the higher levels are
+   * cascaded.
+   */
+
+  tick = g_nexttick;
+  for (i = 0; i < TMR_NSLOTS; i++, tick++)
     {
-      return INFTIM;
+      if (timers[tick & TMR_SLOTMASK] != NULL ||
+          (tick & TMR_SLOTMASK) == 0)
+        {
+          break;
+        }
     }
 
+  nowms = tmr_msec(now);
+  msecs = (long)(tick * TMR_TICK_MSEC - nowms);
   if (msecs <= 0)
     {
       msecs = 0;
@@ -283,43 +344,71 @@ long tmr_mstimeout(struct timeval *now)
 
 void tmr_run(struct timeval *now)
 {
-  int h;
+  unsigned long nowtick = tmr_nowtick(now);
   Timer *tmr;
-  Timer *next;
+  int level;
+  int h;
+
+  /* If there is nothing to run, there is no need to step through the
+   * elapsed ticks.
+   */
+
+  if (g_ntimers == 0 && TICK_AFTER_EQ(nowtick, g_nexttick))
+    {
+      g_nexttick = nowtick + 1;
+      return;
+    }
 
-  for (h = 0; h < HASH_SIZE; ++h)
+  while (TICK_AFTER_EQ(nowtick, g_nexttick))
     {
-      for (tmr = timers[h]; tmr != NULL; tmr = next)
+      /* Cascade higher levels each time a lower level wraps around */
+
+      for (level = 1;
+           level < TMR_NLEVELS &&
+           ((g_nexttick >> (TMR_SLOTBITS * (level - 1))) & TMR_SLOTMASK) == 0;
+           level++)
         {
-          next = tmr->next;
+          l_cascade(level);
+        }
+
+      /* Move the timers in the current slot onto the expired list so that
+       * a callback may safely cancel or create any timer.
+       */
 
-          /* Since the lists are sorted, as soon as we find a timer  * that isn'tmr
-           * ready yet, we can go on to the next list
-           */
+      h = g_nexttick & TMR_SLOTMASK;
+      g_nexttick++;
 
-          if (tmr->time.tv_sec > now->tv_sec ||
-              (tmr->time.tv_sec == now->tv_sec && tmr->time.tv_usec > now->tv_usec))
+      while ((tmr = timers[h]) != NULL)
+        {
+          l_remove(tmr);
+          tmr->slot = TMR_EXPIRED;
+          tmr->next = timers[TMR_EXPIRED];
+          if (timers[TMR_EXPIRED] != NULL)
             {
-              break;
+              timers[TMR_EXPIRED]->prev = tmr;
             }
 
+          timers[TMR_EXPIRED] = tmr;
+        }
+
+      while ((tmr = timers[TMR_EXPIRED]) != NULL)
+        {
+          l_remove(tmr);
           (tmr->timer_proc)(tmr->client_data, now);
           if (tmr->periodic)
             {
               /* Reschedule. */
 
-              tmr->time.tv_sec += tmr->msecs / 1000L;
-              tmr->time.tv_usec += (tmr->msecs % 1000L) * 1000L;
-              if (tmr->time.tv_usec >= 1000000L)
-                {
-                  tmr->time.tv_sec += tmr->time.tv_usec / 1000000L;
-                  tmr->time.tv_usec %= 1000000L;
-                }
-              l_resort(tmr);
+              tmr_settime(tmr);
+              l_add(tmr);
             }
           else
             {
-              tmr_cancel(tmr);
+              /* Put it on the free list. */
+
+              g_ntimers--;
+              tmr->next   = free_timers;
+              free_timers = tmr;
             }
         }
     }
@@ -327,9 +416,10 @@ void tmr_run(struct timeval *now)
 
 void tmr_cancel(Timer *tmr)
 {
-  /* Remove it from its active list. */
+  /* Remove it from its wheel slot. */
 
   l_remove(tmr);
+  g_ntimers--;
 
   /* And put it on the free list. */
 
@@ -354,12 +444,13 @@ void tmr_destroy(void)
 {
   int h;
 
-  for (h = 0; h < HASH_SIZE; ++h)
+  for (h = 0; h < TMR_NLEVELS * TMR_NSLOTS + 1; ++h)
     {
       while (timers[h] != NULL)
         {
           tmr_cancel(timers[h]);
         }
     }
+
   tmr_cleanup();
 }
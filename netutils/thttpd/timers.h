@@ -83,9 +83,10 @@ typedef struct TimerStruct
   long                msecs;
   int                 periodic;
   struct timeval      time;
+  unsigned long       tick;        /* Expiration time in wheel ticks */
   struct TimerStruct *prev;
   struct TimerStruct *next;
-  int hash;
+  int                 slot;        /* Index of the wheel slot holding the timer */
 } Timer;
 
 /****************************************************************************
@@ -61,6 +61,7 @@
 #include <stdbool.h>
 #include <unistd.h>
 #include <netdb.h>
+#include <string.h>
 #include <strings.h>
 #include <errno.h>
 
@@ -72,6 +73,10 @@
 #include "netutils/netlib.h"
 #include "netutils/webclient.h"
 
+#ifdef CONFIG_NETUTILS_DNSCACHE
+#  include "netutils/dnscache.h"
+#endif
+
 #if defined(CONFIG_NETUTILS_CODECS)
 #  if defined(CONFIG_CODECS_URLCODE)
 #    define WGET_USE_URLENCODE 1
@@ -119,11 +124,14 @@
 
 #define WGET_MODE_GET              0
 #define WGET_MODE_POST             1
+#define WGET_MODE_POSTFIELDS       2
 
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
+struct urlencode_field_s; /* Form field, see netutils/urldecode.h */
+
 struct wget_s
 {
   /* Internal status */
@@ -211,15 +219,54 @@ static char *wget_strcpy(char *dest, const char *src)
 #ifdef WGET_USE_URLENCODE
 static char *wget_urlencode_strcpy(char *dest, const char *src)
 {
-  int len = strlen(src);
   int d_len;
 
-  d_len = urlencode_len(src, len);
-  urlencode(src, len, dest, &d_len);
+  urlencode(src, strlen(src), dest, &d_len);
   return dest + d_len;
 }
 #endif
 
+/****************************************************************************
+ * Name: wget_sendfields
+ *
+ * Description:
+ *   Send the request headers already in 'buffer' followed by the form
+ *   encoding of 'fields'.  The fields are encoded directly into the free
+ *   part of the buffer, one buffer-full at a time, so the size of the body
+ *   is not limited by the size of the buffer.
+ *
+ ****************************************************************************/
+
+#ifdef WGET_USE_URLENCODE
+static int wget_sendfields(int sockfd, FAR char *buffer, int len,
+                           int buflen,
+                           FAR const struct urlencode_field_s *fields,
+                           int nfields)
+{
+  struct urlencode_state_s state;
+  int ret;
+
+  urlencode_fieldsinit(&state);
+  for (; ; )
+    {
+      len += urlencode_fields(&state, fields, nfields, &buffer[len],
+                              buflen - len);
+      if (len == 0)
+        {
+          return OK;
+        }
+
+      ret = send(sockfd, buffer, len, 0);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      len = 0;
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: wget_parsestatus
  ****************************************************************************/
@@ -379,6 +426,7 @@ exit:
  *
  * Description:
  *   Call gethostbyname() to get the IPv4 address associated with a hostname.
+ *   With CONFIG_NETUTILS_DNSCACHE the shared resolver cache is used instead.
  *
  * Input Parameters
  *   hostname - The host name to use in the nslookup.
@@ -391,6 +439,9 @@ exit:
 
 static int wget_gethostip(FAR char *hostname, in_addr_t *ipv4addr)
 {
+#ifdef CONFIG_NETUTILS_DNSCACHE
+  return dnscache_gethostip(hostname, ipv4addr);
+#else
   FAR struct hostent *he;
 
   he = gethostbyname(hostname);
@@ -408,6 +459,7 @@ static int wget_gethostip(FAR char *hostname, in_addr_t *ipv4addr)
 
   memcpy(ipv4addr, he->h_addr, sizeof(in_addr_t));
   return OK;
+#endif
 }
 
 /****************************************************************************
@@ -431,6 +483,9 @@ static int wget_gethostip(FAR char *hostname, in_addr_t *ipv4addr)
  *   buflen   - The size of the user provided buffer
  *   callback - As data is obtained from the host, this function is
  *              to dispose of each block of file data as it is received.
+ *   posts    - The encoded POST data (WGET_MODE_POST)
+ *   fields   - The form fields to encode (WGET_MODE_POSTFIELDS)
+ *   nfields  - The number of form fields
  *   mode     - Indicates GET or POST modes
  *
  * Returned Value:
@@ -441,7 +496,9 @@ static int wget_gethostip(FAR char *hostname, in_addr_t *ipv4addr)
 
 static int wget_base(FAR const char *url, FAR char *buffer, int buflen,
                      wget_callback_t callback, FAR void *arg,
-                     FAR const char *posts, uint8_t mode)
+                     FAR const char *posts,
+                     FAR const struct urlencode_field_s *fields,
+                     int nfields, uint8_t mode)
 {
   struct sockaddr_in server;
   struct wget_s ws;
@@ -537,7 +594,7 @@ static int wget_base(FAR const char *url, FAR char *buffer, int buflen,
       /* Send the GET request */
 
       dest = ws.buffer;
-      if (mode == WGET_MODE_POST)
+      if (mode != WGET_MODE_GET)
         {
           dest = wget_strcpy(dest, g_httppost);
         }
@@ -560,7 +617,7 @@ static int wget_base(FAR const char *url, FAR char *buffer, int buflen,
       dest = wget_strcpy(dest, ws.hostname);
       dest = wget_strcpy(dest, g_httpcrnl);
 
-      if (mode == WGET_MODE_POST)
+      if (mode != WGET_MODE_GET)
         {
           dest = wget_strcpy(dest, g_httpform);
           dest = wget_strcpy(dest, g_httpcrnl);
@@ -568,7 +625,17 @@ static int wget_base(FAR const char *url, FAR char *buffer, int buflen,
 
           /* Post content size */
 
-          post_len = strlen((char *)posts);
+#ifdef WGET_USE_URLENCODE
+          if (mode == WGET_MODE_POSTFIELDS)
+            {
+              post_len = urlencode_fieldslen(fields, nfields);
+            }
+          else
+#endif
+            {
+              post_len = strlen((char *)posts);
+            }
+
           sprintf(post_size,"%d", post_len);
           dest = wget_strcpy(dest, post_size);
           dest = wget_strcpy(dest, g_httpcrnl);
@@ -582,7 +649,18 @@ static int wget_base(FAR const char *url, FAR char *buffer, int buflen,
 
       len = dest - buffer;
 
-      ret = send(sockfd, buffer, len, 0);
+#ifdef WGET_USE_URLENCODE
+      if (mode == WGET_MODE_POSTFIELDS)
+        {
+          ret = wget_sendfields(sockfd, buffer, len, buflen, fields,
+                                nfields);
+        }
+      else
+#endif
+        {
+          ret = send(sockfd, buffer, len, 0);
+        }
+
       if (ret < 0)
         {
           nerr("ERROR: send failed: %d\n", errno);
@@ -776,7 +854,8 @@ int web_posts_strlen(FAR char **name, FAR char **value, int len)
 int wget(FAR const char *url, FAR char *buffer, int buflen,
          wget_callback_t callback, FAR void *arg)
 {
-  return wget_base(url, buffer, buflen, callback, arg, NULL, WGET_MODE_GET);
+  return wget_base(url, buffer, buflen, callback, arg, NULL, NULL, 0,
+                   WGET_MODE_GET);
 }
 
 /****************************************************************************
@@ -786,5 +865,21 @@ int wget(FAR const char *url, FAR char *buffer, int buflen,
 int wget_post(FAR const char *url, FAR const char *posts, FAR char *buffer,
               int buflen, wget_callback_t callback, FAR void *arg)
 {
-  return wget_base(url, buffer, buflen, callback, arg, posts, WGET_MODE_POST);
+  return wget_base(url, buffer, buflen, callback, arg, posts, NULL, 0,
+                   WGET_MODE_POST);
+}
+
+/****************************************************************************
+ * Name: wget_postfields
+ ****************************************************************************/
+
+#ifdef WGET_USE_URLENCODE
+int wget_postfields(FAR const char *url,
+                    FAR const struct urlencode_field_s *fields, int nfields,
+                    FAR char *buffer, int buflen, wget_callback_t callback,
+                    FAR void *arg)
+{
+  return wget_base(url, buffer, buflen, callback, arg, NULL, fields,
+                   nfields, WGET_MODE_POSTFIELDS);
 }
+#endif
@@ -0,0 +1,869 @@
+/****************************************************************************
+ * apps/netutils/webclient/webclient_async.c
+ * Non-blocking HTTP requests driven by a single poll() loop
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#ifndef CONFIG_WEBCLIENT_HOST
+#  include <nuttx/config.h>
+#  include <nuttx/compiler.h>
+#  include <debug.h>
+#endif
+
+#include <sys/socket.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <netdb.h>
+#include <errno.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include <nuttx/version.h>
+
+#include "netutils/netlib.h"
+#include "netutils/webclient.h"
+
+#ifdef CONFIG_NETUTILS_DNSCACHE
+#  include "netutils/dnscache.h"
+#endif
+
+#ifndef CONFIG_NSH_WGET_USERAGENT
+#  if CONFIG_VERSION_MAJOR != 0 || CONFIG_VERSION_MINOR != 0
+#    define CONFIG_NSH_WGET_USERAGENT \
+     "NuttX/" CONFIG_VERSION_STRING " (; http://www.nuttx.org/)"
+#  else
+#    define CONFIG_NSH_WGET_USERAGENT \
+    "NuttX/6.xx.x (; http://www.nuttx.org/)"
+#  endif
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_WEBCLIENT_TIMEOUT
+#  define CONFIG_WEBCLIENT_TIMEOUT 10
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define WEBCLIENT_CLOCK CLOCK_MONOTONIC
+#else
+#  define WEBCLIENT_CLOCK CLOCK_REALTIME
+#endif
+
+/* Request states */
+
+#define ASYNC_IDLE       0  /* Not started, completed or cancelled */
+#define ASYNC_CONNECTING 1  /* Waiting for connect() to complete */
+#define ASYNC_SENDING    2  /* Sending the request */
+#define ASYNC_RECEIVING  3  /* Receiving the response */
+
+/* Response parser states */
+
+#define RSP_STATUS       0  /* Status line */
+#define RSP_HEADER       1  /* Header lines */
+#define RSP_BODY         2  /* Body of known length */
+#define RSP_UNTILCLOSE   3  /* Body delimited by the end of the connection */
+#define RSP_CHUNKSIZE    4  /* Chunk size line */
+#define RSP_CHUNKDATA    5  /* Chunk data */
+#define RSP_CHUNKEND     6  /* CRLF following the chunk data */
+#define RSP_TRAILER      7  /* Trailer lines after the last chunk */
+
+/* Length of a body of unknown size */
+
+#define WEBCLIENT_UNKNOWN ((size_t)-1)
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char g_httpuseragent[] = CONFIG_NSH_WGET_USERAGENT;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: webclient_msec
+ *
+ * Description:
+ *   Return a millisecond time stamp for timeout calculations.
+ *
+ ****************************************************************************/
+
+static uint32_t webclient_msec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(WEBCLIENT_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/****************************************************************************
+ * Name: webclient_complete
+ *
+ * Description:
+ *   Remove a request from the engine, release its socket and report the
+ *   result.  The request is no longer referenced by the engine when the
+ *   callback runs, so the callback may start it (or another one) again.
+ *
+ ****************************************************************************/
+
+static void webclient_complete(FAR struct webclient_async_s *engine,
+                               FAR struct webclient_req_s *req, int result)
+{
+  FAR struct webclient_req_s **pprev;
+
+  for (pprev = &engine->head; *pprev != NULL; pprev = &(*pprev)->flink)
+    {
+      if (*pprev == req)
+        {
+          *pprev = req->flink;
+          engine->nreqs--;
+          break;
+        }
+    }
+
+  if (req->sockfd >= 0)
+    {
+      close(req->sockfd);
+      req->sockfd = -1;
+    }
+
+  req->flink = NULL;
+  req->state = ASYNC_IDLE;
+
+  ninfo("%s: %d\n", req->url, result);
+  if (req->done != NULL)
+    {
+      req->done(req, result);
+    }
+}
+
+/****************************************************************************
+ * Name: webclient_hasheader
+ ****************************************************************************/
+
+static FAR const char *webclient_hasheader(FAR struct webclient_req_s *req,
+                                           FAR const char *name)
+{
+  FAR const char *value;
+  size_t len = strlen(name);
+
+  if (strncasecmp(req->line, name, len) != 0 || req->line[len] != ':')
+    {
+      return NULL;
+    }
+
+  value = &req->line[len + 1];
+  while (*value == ' ' || *value == '\t')
+    {
+      value++;
+    }
+
+  return value;
+}
+
+/****************************************************************************
+ * Name: webclient_parseline
+ *
+ * Description:
+ *   Handle one complete line of the response.  Returns 1 if the response
+ *   is complete, 0 to continue, or a negated errno value.
+ *
+ ****************************************************************************/
+
+static int webclient_parseline(FAR struct webclient_req_s *req)
+{
+  FAR const char *value;
+  unsigned long chunklen;
+  FAR char *end;
+
+  switch (req->rspstate)
+    {
+      case RSP_STATUS:
+        if (strncmp(req->line, "HTTP/1.", 7) != 0 || req->line[8] != ' ')
+          {
+            return -ECONNABORTED;
+          }
+
+        req->status    = atoi(&req->line[9]);
+        req->chunked   = false;
+        req->remaining = WEBCLIENT_UNKNOWN;
+        req->rspstate  = RSP_HEADER;
+        break;
+
+      case RSP_HEADER:
+        if (req->line[0] != '\0')
+          {
+            if ((value = webclient_hasheader(req, "Content-Length")) != NULL)
+              {
+                req->remaining = strtoul(value, NULL, 10);
+              }
+            else if ((value = webclient_hasheader(req, "Transfer-Encoding"))
+                     != NULL)
+              {
+                req->chunked = (strcasestr(value, "chunked") != NULL);
+              }
+
+            break;
+          }
+
+        /* End of the headers.  Skip over interim 1xx responses. */
+
+        if (req->status >= 100 && req->status < 200)
+          {
+            req->rspstate = RSP_STATUS;
+          }
+        else if (req->status == 204 || req->status == 304 ||
+                 (req->method != NULL && strcmp(req->method, "HEAD") == 0))
+          {
+            return 1;
+          }
+        else if (req->chunked)
+          {
+            req->rspstate = RSP_CHUNKSIZE;
+          }
+        else if (req->remaining == WEBCLIENT_UNKNOWN)
+          {
+            req->rspstate = RSP_UNTILCLOSE;
+          }
+        else if (req->remaining == 0)
+          {
+            return 1;
+          }
+        else
+          {
+            req->rspstate = RSP_BODY;
+          }
+        break;
+
+      case RSP_CHUNKSIZE:
+        chunklen = strtoul(req->line, &end, 16);
+        if (end == req->line)
+          {
+            return -EPROTO;
+          }
+
+        req->remaining = chunklen;
+        req->rspstate  = chunklen > 0 ? RSP_CHUNKDATA : RSP_TRAILER;
+        break;
+
+      case RSP_CHUNKEND:
+        if (req->line[0] != '\0')
+          {
+            return -EPROTO;
+          }
+
+        req->rspstate = RSP_CHUNKSIZE;
+        break;
+
+      case RSP_TRAILER:
+        if (req->line[0] == '\0')
+          {
+            return 1;
+          }
+        break;
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Name: webclient_parse
+ *
+ * Description:
+ *   Consume the received data in req->buffer.  Lines are collected in
+ *   req->line and body data is offered to the sink.  If the sink does not
+ *   accept everything, the request is marked as stalled and the remaining
+ *   data stays in the buffer; no more data is received for the request
+ *   until the sink has taken it.
+ *
+ *   Returns 1 if the response is complete, 0 to continue, or a negated
+ *   errno value.
+ *
+ ****************************************************************************/
+
+static int webclient_parse(FAR struct webclient_req_s *req)
+{
+  size_t navail;
+  int ret;
+  char ch;
+
+  req->stalled = false;
+  while (req->head < req->tail)
+    {
+      if (req->rspstate == RSP_BODY || req->rspstate == RSP_UNTILCLOSE ||
+          req->rspstate == RSP_CHUNKDATA)
+        {
+          navail = req->tail - req->head;
+          if (req->rspstate != RSP_UNTILCLOSE && navail > req->remaining)
+            {
+              navail = req->remaining;
+            }
+
+          ret = req->sink == NULL ? (int)navail :
+                req->sink(&req->buffer[req->head], navail, req->arg);
+          if (ret < 0)
+            {
+              return ret;
+            }
+          else if (ret == 0)
+            {
+              req->stalled = true;
+              return 0;
+            }
+
+          if ((size_t)ret > navail)
+            {
+              ret = navail;
+            }
+
+          req->head += ret;
+          if (req->rspstate == RSP_UNTILCLOSE)
+            {
+              continue;
+            }
+
+          req->remaining -= ret;
+          if (req->remaining == 0)
+            {
+              if (req->rspstate == RSP_BODY)
+                {
+                  return 1;
+                }
+
+              req->ndx      = 0;
+              req->rspstate = RSP_CHUNKEND;
+            }
+
+          continue;
+        }
+
+      /* Collect the next line */
+
+      ch = req->buffer[req->head++];
+      if (ch != '\n')
+        {
+          if (req->ndx < CONFIG_WEBCLIENT_MAXHTTPLINE - 1)
+            {
+              req->line[req->ndx++] = ch;
+            }
+
+          continue;
+        }
+
+      if (req->ndx > 0 && req->line[req->ndx - 1] == '\r')
+        {
+          req->ndx--;
+        }
+
+      req->line[req->ndx] = '\0';
+      req->ndx = 0;
+
+      ret = webclient_parseline(req);
+      if (ret != 0)
+        {
+          return ret;
+        }
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Name: webclient_send
+ *
+ * Description:
+ *   Send as much of the request headers and body as the socket accepts.
+ *   Returns 1 when everything has been sent, 0 to continue, or a negated
+ *   errno value.
+ *
+ ****************************************************************************/
+
+static int webclient_send(FAR struct webclient_req_s *req)
+{
+  FAR const char *ptr;
+  ssize_t nsent;
+  size_t len;
+
+  while (req->sent < req->hdrlen + req->bodylen)
+    {
+      if (req->sent < req->hdrlen)
+        {
+          ptr = &req->buffer[req->sent];
+          len = req->hdrlen - req->sent;
+        }
+      else
+        {
+          ptr = (FAR const char *)req->body + (req->sent - req->hdrlen);
+          len = req->hdrlen + req->bodylen - req->sent;
+        }
+
+      nsent = send(req->sockfd, ptr, len, 0);
+      if (nsent < 0)
+        {
+          if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+              return 0;
+            }
+          else if (errno == EINTR)
+            {
+              continue;
+            }
+
+          return -errno;
+        }
+
+      req->sent += nsent;
+    }
+
+  return 1;
+}
+
+/****************************************************************************
+ * Name: webclient_advance
+ *
+ * Description:
+ *   Move the request forward after poll() reported activity on its socket.
+ *   Returns 1 if the response is complete, 0 to continue, or a negated
+ *   errno value.
+ *
+ ****************************************************************************/
+
+static int webclient_advance(FAR struct webclient_req_s *req,
+                             pollevent_t revents)
+{
+  socklen_t optlen;
+  ssize_t nrecvd;
+  int error;
+  int ret;
+
+  switch (req->state)
+    {
+      case ASYNC_CONNECTING:
+        error  = 0;
+        optlen = sizeof(int);
+        if (getsockopt(req->sockfd, SOL_SOCKET, SO_ERROR, &error,
+                       &optlen) < 0)
+          {
+            return -errno;
+          }
+        else if (error != 0)
+          {
+            nerr("ERROR: connect failed: %d\n", error);
+            return -error;
+          }
+
+        req->state = ASYNC_SENDING;
+
+        /* Fall through */
+
+      case ASYNC_SENDING:
+        ret = webclient_send(req);
+        if (ret <= 0)
+          {
+            return ret;
+          }
+
+        /* The buffer now receives the response */
+
+        req->state    = ASYNC_RECEIVING;
+        req->rspstate = RSP_STATUS;
+        req->head     = 0;
+        req->tail     = 0;
+        req->ndx      = 0;
+        break;
+
+      case ASYNC_RECEIVING:
+        if ((revents & (POLLIN | POLLERR | POLLHUP)) == 0)
+          {
+            break;
+          }
+
+        nrecvd = recv(req->sockfd, req->buffer, CONFIG_WEBCLIENT_BUFSIZE, 0);
+        if (nrecvd < 0)
+          {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+              {
+                return 0;
+              }
+
+            nerr("ERROR: recv failed: %d\n", errno);
+            return -errno;
+          }
+        else if (nrecvd == 0)
+          {
+            return req->rspstate == RSP_UNTILCLOSE ? 1 : -ECONNRESET;
+          }
+
+        req->head = 0;
+        req->tail = nrecvd;
+        return webclient_parse(req);
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Name: webclient_open_socket
+ *
+ * Description:
+ *   Resolve the host, create a non-blocking socket and begin connecting.
+ *
+ ****************************************************************************/
+
+static int webclient_open_socket(FAR struct webclient_req_s *req,
+                                 FAR const char *hostname, uint16_t port)
+{
+  struct sockaddr_in server;
+#ifndef CONFIG_NETUTILS_DNSCACHE
+  FAR struct hostent *he;
+#endif
+  int flags;
+  int ret;
+
+  memset(&server, 0, sizeof(struct sockaddr_in));
+  server.sin_family = AF_INET;
+  server.sin_port   = htons(port);
+
+  /* Name resolution itself is not asynchronous.  Dotted addresses and
+   * cached names return at once.
+   */
+
+#ifdef CONFIG_NETUTILS_DNSCACHE
+  if (dnscache_gethostip(hostname, &server.sin_addr.s_addr) < 0)
+    {
+      nwarn("WARNING: Failed to resolve %s\n", hostname);
+      return -EHOSTUNREACH;
+    }
+#else
+  he = gethostbyname(hostname);
+  if (he == NULL || he->h_addrtype != AF_INET)
+    {
+      nwarn("WARNING: Failed to resolve %s\n", hostname);
+      return -EHOSTUNREACH;
+    }
+
+  memcpy(&server.sin_addr.s_addr, he->h_addr, sizeof(in_addr_t));
+#endif
+
+  req->sockfd = socket(AF_INET, SOCK_STREAM, 0);
+  if (req->sockfd < 0)
+    {
+      ret = -errno;
+      nerr("ERROR: socket failed: %d\n", -ret);
+      return ret;
+    }
+
+  flags = fcntl(req->sockfd, F_GETFL, 0);
+  if (flags < 0 || fcntl(req->sockfd, F_SETFL, flags | O_NONBLOCK) < 0)
+    {
+      ret = -errno;
+      goto errout_with_socket;
+    }
+
+  ret = connect(req->sockfd, (FAR struct sockaddr *)&server,
+                sizeof(struct sockaddr_in));
+  if (ret == 0)
+    {
+      req->state = ASYNC_SENDING;
+      return OK;
+    }
+  else if (errno == EINPROGRESS)
+    {
+      req->state = ASYNC_CONNECTING;
+      return OK;
+    }
+
+  ret = -errno;
+  nerr("ERROR: connect failed: %d\n", -ret);
+
+errout_with_socket:
+  close(req->sockfd);
+  req->sockfd = -1;
+  return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: webclient_async_init
+ ****************************************************************************/
+
+void webclient_async_init(FAR struct webclient_async_s *engine)
+{
+  engine->head  = NULL;
+  engine->nreqs = 0;
+}
+
+/****************************************************************************
+ * Name: webclient_async_start
+ *
+ * Description:
+ *   Start a request.  See include/netutils/webclient.h.
+ *
+ ****************************************************************************/
+
+int webclient_async_start(FAR struct webclient_async_s *engine,
+                          FAR struct webclient_req_s *req)
+{
+  char hostname[CONFIG_WEBCLIENT_MAXHOSTNAME];
+  char filename[CONFIG_WEBCLIENT_MAXFILENAME];
+  uint16_t port = 80;
+  int timeout;
+  int len;
+  int ret;
+
+  DEBUGASSERT(engine != NULL && req != NULL && req->url != NULL);
+
+  if (engine->nreqs >= CONFIG_WEBCLIENT_ASYNC_MAXREQS)
+    {
+      return -EBUSY;
+    }
+
+  ret = netlib_parsehttpurl(req->url, &port,
+                            hostname, CONFIG_WEBCLIENT_MAXHOSTNAME,
+                            filename, CONFIG_WEBCLIENT_MAXFILENAME);
+  if (ret != 0)
+    {
+      nwarn("WARNING: Malformed HTTP URL: %s\n", req->url);
+      return ret;
+    }
+
+  /* Format the complete request headers now; the buffer is not needed for
+   * the response until they have been sent.
+   */
+
+  len = snprintf(req->buffer, CONFIG_WEBCLIENT_BUFSIZE,
+                 "%s %s HTTP/1.1\r\n"
+                 "Host: %s\r\n"
+                 "Connection: close\r\n"
+                 "User-Agent: %s\r\n",
+                 req->method != NULL ? req->method : "GET", filename,
+                 hostname, g_httpuseragent);
+
+  if (len < CONFIG_WEBCLIENT_BUFSIZE &&
+      (req->body != NULL || req->bodylen > 0))
+    {
+      len += snprintf(&req->buffer[len], CONFIG_WEBCLIENT_BUFSIZE - len,
+                      "Content-Type: %s\r\n"
+                      "Content-Length: %lu\r\n",
+                      req->ctype != NULL ? req->ctype :
+                      "application/octet-stream",
+                      (unsigned long)req->bodylen);
+    }
+
+  if (len < CONFIG_WEBCLIENT_BUFSIZE)
+    {
+      len += snprintf(&req->buffer[len], CONFIG_WEBCLIENT_BUFSIZE - len,
+                      "\r\n");
+    }
+
+  if (len >= CONFIG_WEBCLIENT_BUFSIZE)
+    {
+      nwarn("WARNING: Request headers too long\n");
+      return -E2BIG;
+    }
+
+  req->hdrlen  = len;
+  req->sent    = 0;
+  req->stalled = false;
+  req->status  = 0;
+
+  ret = webclient_open_socket(req, hostname, port);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  timeout       = req->timeout > 0 ? req->timeout : CONFIG_WEBCLIENT_TIMEOUT;
+  req->deadline = webclient_msec() + (uint32_t)timeout * 1000;
+
+  req->flink    = engine->head;
+  engine->head  = req;
+  engine->nreqs++;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: webclient_async_cancel
+ ****************************************************************************/
+
+void webclient_async_cancel(FAR struct webclient_async_s *engine,
+                            FAR struct webclient_req_s *req)
+{
+  webclient_done_t done;
+
+  if (req->state != ASYNC_IDLE)
+    {
+      done      = req->done;
+      req->done = NULL;
+      webclient_complete(engine, req, -ECANCELED);
+      req->done = done;
+    }
+}
+
+/****************************************************************************
+ * Name: webclient_async_poll
+ *
+ * Description:
+ *   Wait for and process activity on all active requests.  See
+ *   include/netutils/webclient.h.
+ *
+ ****************************************************************************/
+
+int webclient_async_poll(FAR struct webclient_async_s *engine, int timeout)
+{
+  struct pollfd fds[CONFIG_WEBCLIENT_ASYNC_MAXREQS];
+  FAR struct webclient_req_s *reqs[CONFIG_WEBCLIENT_ASYNC_MAXREQS];
+  FAR struct webclient_req_s *req;
+  uint32_t now;
+  int32_t left;
+  int nfds;
+  int ret;
+  int i;
+
+  /* Gather the sockets and find the nearest deadline */
+
+  now  = webclient_msec();
+  nfds = 0;
+
+  for (req = engine->head; req != NULL; req = req->flink)
+    {
+      left = (int32_t)(req->deadline - now);
+      if (left < 0)
+        {
+          left = 0;
+        }
+
+      if (timeout < 0 || left < timeout)
+        {
+          timeout = left;
+        }
+
+      reqs[nfds]        = req;
+      fds[nfds].fd      = req->sockfd;
+      fds[nfds].events  = req->state == ASYNC_RECEIVING ? POLLIN : POLLOUT;
+      fds[nfds].revents = 0;
+
+      /* A stalled sink is retried after a short delay rather than being
+       * given more data.
+       */
+
+      if (req->stalled)
+        {
+          fds[nfds].fd = -1;
+          if (timeout < 0 || timeout > CONFIG_WEBCLIENT_SINK_BACKOFF)
+            {
+              timeout = CONFIG_WEBCLIENT_SINK_BACKOFF;
+            }
+        }
+
+      nfds++;
+    }
+
+  if (nfds == 0)
+    {
+      return 0;
+    }
+
+  ret = poll(fds, nfds, timeout);
+  if (ret < 0)
+    {
+      if (errno != EINTR)
+        {
+          return -errno;
+        }
+
+      return engine->nreqs;
+    }
+
+  /* Advance each request.  A completion callback may start new requests;
+   * those are picked up on the next call.
+   */
+
+  now = webclient_msec();
+  for (i = 0; i < nfds; i++)
+    {
+      req = reqs[i];
+      if (req->state == ASYNC_IDLE)
+        {
+          continue;
+        }
+
+      if (req->stalled)
+        {
+          ret = webclient_parse(req);
+        }
+      else if (fds[i].revents != 0)
+        {
+          ret = webclient_advance(req, fds[i].revents);
+        }
+      else
+        {
+          ret = 0;
+        }
+
+      if (ret < 0)
+        {
+          webclient_complete(engine, req, ret);
+        }
+      else if (ret > 0)
+        {
+          webclient_complete(engine, req, req->status);
+        }
+      else if ((int32_t)(req->deadline - now) <= 0)
+        {
+          nwarn("WARNING: %s timed out\n", req->url);
+          webclient_complete(engine, req, -ETIMEDOUT);
+        }
+    }
+
+  return engine->nreqs;
+}
@@ -0,0 +1,823 @@
+/****************************************************************************
+ * apps/netutils/webclient/webclient_session.c
+ * Persistent HTTP/1.1 client sessions
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#ifndef CONFIG_WEBCLIENT_HOST
+#  include <nuttx/config.h>
+#  include <nuttx/compiler.h>
+#  include <debug.h>
+#endif
+
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <errno.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include <nuttx/version.h>
+
+#include "netutils/webclient.h"
+
+#ifdef CONFIG_NETUTILS_DNSCACHE
+#  include "netutils/dnscache.h"
+#endif
+
+#ifndef CONFIG_NSH_WGET_USERAGENT
+#  if CONFIG_VERSION_MAJOR != 0 || CONFIG_VERSION_MINOR != 0
+#    define CONFIG_NSH_WGET_USERAGENT \
+     "NuttX/" CONFIG_VERSION_STRING " (; http://www.nuttx.org/)"
+#  else
+#    define CONFIG_NSH_WGET_USERAGENT \
+    "NuttX/6.xx.x (; http://www.nuttx.org/)"
+#  endif
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_WEBCLIENT_TIMEOUT
+#  define CONFIG_WEBCLIENT_TIMEOUT 10
+#endif
+
+/* Length of a body of unknown size (read until the server closes) */
+
+#define WEBCLIENT_UNTILCLOSE ((size_t)-1)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct webclient_session_s
+{
+  int sockfd;                     /* Connected socket or -1 */
+  bool resolved;                  /* True: server holds a cached address */
+  bool keepalive;                 /* True: connection may be reused */
+  bool chunked;                   /* True: body uses chunked encoding */
+  bool received;                  /* True: response data has arrived */
+  size_t bodylen;                 /* Content-Length or WEBCLIENT_UNTILCLOSE */
+  struct sockaddr_in server;      /* Cached server address */
+
+  /* Receive buffer.  Data in buffer[head..tail) has been received but not
+   * yet consumed by the response parser.
+   */
+
+  int head;
+  int tail;
+  char buffer[CONFIG_WEBCLIENT_BUFSIZE];
+
+  char line[CONFIG_WEBCLIENT_MAXHTTPLINE];
+  char hostname[CONFIG_WEBCLIENT_MAXHOSTNAME];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char g_httpuseragent[] = CONFIG_NSH_WGET_USERAGENT;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: webclient_resolve
+ *
+ * Description:
+ *   Look up the session host name and cache the resulting IPv4 address so
+ *   that subsequent requests need not query the resolver again.
+ *
+ ****************************************************************************/
+
+static int webclient_resolve(FAR struct webclient_session_s *ws)
+{
+#ifdef CONFIG_NETUTILS_DNSCACHE
+  if (dnscache_gethostip(ws->hostname, &ws->server.sin_addr.s_addr) < 0)
+    {
+      nwarn("WARNING: Failed to resolve %s\n", ws->hostname);
+      return -EHOSTUNREACH;
+    }
+#else
+  FAR struct hostent *he;
+
+  he = gethostbyname(ws->hostname);
+  if (he == NULL)
+    {
+      nwarn("WARNING: gethostbyname failed: %d\n", h_errno);
+      return -EHOSTUNREACH;
+    }
+  else if (he->h_addrtype != AF_INET)
+    {
+      nwarn("WARNING: gethostbyname returned an address of type: %d\n",
+           he->h_addrtype);
+      return -EHOSTUNREACH;
+    }
+
+  memcpy(&ws->server.sin_addr.s_addr, he->h_addr, sizeof(in_addr_t));
+#endif
+
+  ws->resolved = true;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: webclient_disconnect
+ ****************************************************************************/
+
+static void webclient_disconnect(FAR struct webclient_session_s *ws)
+{
+  if (ws->sockfd >= 0)
+    {
+      close(ws->sockfd);
+      ws->sockfd = -1;
+    }
+
+  ws->head = 0;
+  ws->tail = 0;
+}
+
+/****************************************************************************
+ * Name: webclient_connect
+ *
+ * Description:
+ *   Make sure that the session has a connected socket.  An existing
+ *   connection is reused as is.  If connecting to the cached address
+ *   fails, the address is resolved again once in case the host has moved.
+ *
+ ****************************************************************************/
+
+static int webclient_connect(FAR struct webclient_session_s *ws)
+{
+  struct timeval tv;
+  bool retried = false;
+  int ret;
+
+  if (ws->sockfd >= 0)
+    {
+      return OK;
+    }
+
+  for (; ; )
+    {
+      if (!ws->resolved)
+        {
+          ret = webclient_resolve(ws);
+          if (ret < 0)
+            {
+              return ret;
+            }
+        }
+
+      ws->sockfd = socket(AF_INET, SOCK_STREAM, 0);
+      if (ws->sockfd < 0)
+        {
+          ret = -errno;
+          nerr("ERROR: socket failed: %d\n", -ret);
+          return ret;
+        }
+
+      tv.tv_sec  = CONFIG_WEBCLIENT_TIMEOUT;
+      tv.tv_usec = 0;
+
+      (void)setsockopt(ws->sockfd, SOL_SOCKET, SO_RCVTIMEO,
+                       (FAR const void *)&tv, sizeof(struct timeval));
+      (void)setsockopt(ws->sockfd, SOL_SOCKET, SO_SNDTIMEO,
+                       (FAR const void *)&tv, sizeof(struct timeval));
+
+      ret = connect(ws->sockfd, (FAR struct sockaddr *)&ws->server,
+                    sizeof(struct sockaddr_in));
+      if (ret == 0)
+        {
+          ws->head = 0;
+          ws->tail = 0;
+          return OK;
+        }
+
+      ret = -errno;
+      nerr("ERROR: connect failed: %d\n", -ret);
+      webclient_disconnect(ws);
+
+      if (retried)
+        {
+          return ret;
+        }
+
+      retried      = true;
+      ws->resolved = false;
+    }
+}
+
+/****************************************************************************
+ * Name: webclient_sendall
+ ****************************************************************************/
+
+static int webclient_sendall(FAR struct webclient_session_s *ws,
+                             FAR const void *data, size_t len)
+{
+  FAR const char *ptr = (FAR const char *)data;
+  ssize_t nsent;
+
+  while (len > 0)
+    {
+      nsent = send(ws->sockfd, ptr, len, 0);
+      if (nsent < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          return -errno;
+        }
+
+      ptr += nsent;
+      len -= nsent;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: webclient_fill
+ *
+ * Description:
+ *   Receive more data into the session buffer if it has been completely
+ *   consumed.  Returns the number of buffered bytes, zero if the server
+ *   closed the connection, or a negated errno value.
+ *
+ ****************************************************************************/
+
+static int webclient_fill(FAR struct webclient_session_s *ws)
+{
+  ssize_t nrecvd;
+
+  if (ws->head < ws->tail)
+    {
+      return ws->tail - ws->head;
+    }
+
+  do
+    {
+      nrecvd = recv(ws->sockfd, ws->buffer, CONFIG_WEBCLIENT_BUFSIZE, 0);
+    }
+  while (nrecvd < 0 && errno == EINTR);
+
+  if (nrecvd < 0)
+    {
+      nerr("ERROR: recv failed: %d\n", errno);
+      return -errno;
+    }
+
+  if (nrecvd > 0)
+    {
+      ws->received = true;
+    }
+
+  ws->head = 0;
+  ws->tail = nrecvd;
+  return nrecvd;
+}
+
+/****************************************************************************
+ * Name: webclient_getline
+ *
+ * Description:
+ *   Extract one CRLF (or LF) terminated line into ws->line, without the
+ *   line terminator.  Over-long lines are truncated.
+ *
+ ****************************************************************************/
+
+static int webclient_getline(FAR struct webclient_session_s *ws)
+{
+  int ndx = 0;
+  int ret;
+  char ch;
+
+  for (; ; )
+    {
+      ret = webclient_fill(ws);
+      if (ret <= 0)
+        {
+          return ret < 0 ? ret : -ECONNRESET;
+        }
+
+      ch = ws->buffer[ws->head++];
+      if (ch == '\n')
+        {
+          break;
+        }
+
+      if (ndx < CONFIG_WEBCLIENT_MAXHTTPLINE - 1)
+        {
+          ws->line[ndx++] = ch;
+        }
+    }
+
+  if (ndx > 0 && ws->line[ndx - 1] == '\r')
+    {
+      ndx--;
+    }
+
+  ws->line[ndx] = '\0';
+  return ndx;
+}
+
+/****************************************************************************
+ * Name: webclient_hasheader
+ *
+ * Description:
+ *   If ws->line holds the header 'name', return a pointer to its value with
+ *   leading white space skipped.  Otherwise return NULL.
+ *
+ ****************************************************************************/
+
+static FAR const char *webclient_hasheader(FAR struct webclient_session_s *ws,
+                                           FAR const char *name)
+{
+  FAR const char *value;
+  size_t len = strlen(name);
+
+  if (strncasecmp(ws->line, name, len) != 0 || ws->line[len] != ':')
+    {
+      return NULL;
+    }
+
+  value = &ws->line[len + 1];
+  while (*value == ' ' || *value == '\t')
+    {
+      value++;
+    }
+
+  return value;
+}
+
+/****************************************************************************
+ * Name: webclient_response
+ *
+ * Description:
+ *   Parse the status line and the headers of the response.  Returns the
+ *   HTTP status code or a negated errno value.
+ *
+ ****************************************************************************/
+
+static int webclient_response(FAR struct webclient_session_s *ws)
+{
+  FAR const char *value;
+  int status;
+  int ret;
+
+  /* Skip over any interim 1xx responses */
+
+  do
+    {
+      ret = webclient_getline(ws);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      if (strncmp(ws->line, "HTTP/1.", 7) != 0 || ws->line[8] != ' ')
+        {
+          return -ECONNABORTED;
+        }
+
+      status = atoi(&ws->line[9]);
+
+      /* HTTP/1.1 connections are persistent unless stated otherwise */
+
+      ws->keepalive = (ws->line[7] != '0');
+      ws->chunked   = false;
+      ws->bodylen   = WEBCLIENT_UNTILCLOSE;
+
+      for (; ; )
+        {
+          ret = webclient_getline(ws);
+          if (ret < 0)
+            {
+              return ret;
+            }
+          else if (ret == 0)
+            {
+              break;
+            }
+
+          if ((value = webclient_hasheader(ws, "Content-Length")) != NULL)
+            {
+              ws->bodylen = strtoul(value, NULL, 10);
+            }
+          else if ((value = webclient_hasheader(ws, "Transfer-Encoding"))
+                   != NULL)
+            {
+              ws->chunked = (strcasestr(value, "chunked") != NULL);
+            }
+          else if ((value = webclient_hasheader(ws, "Connection")) != NULL)
+            {
+              if (strcasecmp(value, "close") == 0)
+                {
+                  ws->keepalive = false;
+                }
+              else if (strcasecmp(value, "keep-alive") == 0)
+                {
+                  ws->keepalive = true;
+                }
+            }
+        }
+    }
+  while (status >= 100 && status < 200);
+
+  /* 204 and 304 responses never carry a body */
+
+  if (status == 204 || status == 304)
+    {
+      ws->chunked = false;
+      ws->bodylen = 0;
+    }
+
+  /* The end of a body of unknown length is the end of the connection */
+
+  if (!ws->chunked && ws->bodylen == WEBCLIENT_UNTILCLOSE)
+    {
+      ws->keepalive = false;
+    }
+
+  return status;
+}
+
+/****************************************************************************
+ * Name: webclient_deliver
+ *
+ * Description:
+ *   Pass up to 'len' bytes of the body to the sink.  The socket is not read
+ *   again until the sink has accepted everything buffered so far; a sink
+ *   that cannot keep up therefore stalls the TCP receive window and,
+ *   through it, the server.
+ *
+ ****************************************************************************/
+
+static int webclient_deliver(FAR struct webclient_session_s *ws,
+                             size_t len, webclient_sink_t sink,
+                             FAR void *arg)
+{
+  size_t navail;
+  int ret;
+
+  while (len > 0)
+    {
+      ret = webclient_fill(ws);
+      if (ret < 0)
+        {
+          return ret;
+        }
+      else if (ret == 0)
+        {
+          /* End of connection terminates a body of unknown length only */
+
+          return len == WEBCLIENT_UNTILCLOSE ? OK : -ECONNRESET;
+        }
+
+      navail = ws->tail - ws->head;
+      if (navail > len)
+        {
+          navail = len;
+        }
+
+      while (navail > 0)
+        {
+          ret = sink == NULL ? (int)navail :
+                sink(&ws->buffer[ws->head], navail, arg);
+          if (ret < 0)
+            {
+              return ret;
+            }
+          else if (ret == 0)
+            {
+              /* The sink is full.  Back off before offering the data
+               * again.
+               */
+
+              usleep(CONFIG_WEBCLIENT_SINK_BACKOFF * 1000);
+              continue;
+            }
+
+          if ((size_t)ret > navail)
+            {
+              ret = navail;
+            }
+
+          ws->head += ret;
+          navail   -= ret;
+          if (len != WEBCLIENT_UNTILCLOSE)
+            {
+              len  -= ret;
+            }
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: webclient_body
+ *
+ * Description:
+ *   Receive the response body, decoding chunked transfer encoding if the
+ *   server used it.
+ *
+ ****************************************************************************/
+
+static int webclient_body(FAR struct webclient_session_s *ws,
+                          webclient_sink_t sink, FAR void *arg)
+{
+  unsigned long chunklen;
+  FAR char *end;
+  int ret;
+
+  if (!ws->chunked)
+    {
+      return webclient_deliver(ws, ws->bodylen, sink, arg);
+    }
+
+  for (; ; )
+    {
+      /* Chunk header: hexadecimal size, optionally followed by extensions */
+
+      ret = webclient_getline(ws);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      chunklen = strtoul(ws->line, &end, 16);
+      if (end == ws->line)
+        {
+          return -EPROTO;
+        }
+
+      if (chunklen == 0)
+        {
+          break;
+        }
+
+      ret = webclient_deliver(ws, chunklen, sink, arg);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      /* Each chunk is followed by an empty line */
+
+      ret = webclient_getline(ws);
+      if (ret != 0)
+        {
+          return ret < 0 ? ret : -EPROTO;
+        }
+    }
+
+  /* Discard the trailer up to the final empty line */
+
+  do
+    {
+      ret = webclient_getline(ws);
+    }
+  while (ret > 0);
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: webclient_sendrequest
+ *
+ * Description:
+ *   Format the request headers, connect if necessary and send the request.
+ *
+ ****************************************************************************/
+
+static int webclient_sendrequest(FAR struct webclient_session_s *ws,
+                                 FAR const char *method,
+                                 FAR const char *path,
+                                 FAR const char *ctype,
+                                 FAR const void *body, size_t bodylen)
+{
+  int len;
+  int ret;
+
+  /* The receive buffer is idle between requests; format the request
+   * headers there.
+   */
+
+  len = snprintf(ws->buffer, CONFIG_WEBCLIENT_BUFSIZE,
+                 "%s %s HTTP/1.1\r\n"
+                 "Host: %s\r\n"
+                 "User-Agent: %s\r\n",
+                 method, path, ws->hostname, g_httpuseragent);
+
+  if (len < CONFIG_WEBCLIENT_BUFSIZE && (body != NULL || bodylen > 0))
+    {
+      len += snprintf(&ws->buffer[len], CONFIG_WEBCLIENT_BUFSIZE - len,
+                      "Content-Type: %s\r\n"
+                      "Content-Length: %lu\r\n",
+                      ctype != NULL ? ctype : "application/octet-stream",
+                      (unsigned long)bodylen);
+    }
+
+  if (len < CONFIG_WEBCLIENT_BUFSIZE)
+    {
+      len += snprintf(&ws->buffer[len], CONFIG_WEBCLIENT_BUFSIZE - len,
+                      "\r\n");
+    }
+
+  if (len >= CONFIG_WEBCLIENT_BUFSIZE)
+    {
+      nwarn("WARNING: Request headers too long\n");
+      return -E2BIG;
+    }
+
+  ws->head     = 0;
+  ws->tail     = 0;
+  ws->received = false;
+
+  ret = webclient_connect(ws);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  ret = webclient_sendall(ws, ws->buffer, len);
+  if (ret == OK && bodylen > 0)
+    {
+      ret = webclient_sendall(ws, body, bodylen);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: webclient_open
+ *
+ * Description:
+ *   Create a session for a sequence of requests to one HTTP server.  See
+ *   include/netutils/webclient.h.
+ *
+ ****************************************************************************/
+
+FAR struct webclient_session_s *webclient_open(FAR const char *hostname,
+                                               uint16_t port)
+{
+  FAR struct webclient_session_s *ws;
+
+  if (hostname == NULL ||
+      strlen(hostname) >= CONFIG_WEBCLIENT_MAXHOSTNAME)
+    {
+      set_errno(EINVAL);
+      return NULL;
+    }
+
+  ws = (FAR struct webclient_session_s *)
+    zalloc(sizeof(struct webclient_session_s));
+  if (ws == NULL)
+    {
+      set_errno(ENOMEM);
+      return NULL;
+    }
+
+  ws->sockfd             = -1;
+  ws->server.sin_family  = AF_INET;
+  ws->server.sin_port    = htons(port != 0 ? port : 80);
+  strcpy(ws->hostname, hostname);
+  return ws;
+}
+
+/****************************************************************************
+ * Name: webclient_request
+ *
+ * Description:
+ *   Perform one request on the session.  See include/netutils/webclient.h.
+ *
+ ****************************************************************************/
+
+int webclient_request(FAR struct webclient_session_s *ws,
+                      FAR const char *method, FAR const char *path,
+                      FAR const char *ctype, FAR const void *body,
+                      size_t bodylen, webclient_sink_t sink, FAR void *arg)
+{
+  bool reused;
+  int status;
+  int ret;
+
+  DEBUGASSERT(ws != NULL && method != NULL && path != NULL);
+
+  for (; ; )
+    {
+      reused = (ws->sockfd >= 0);
+
+      ret = webclient_sendrequest(ws, method, path, ctype, body, bodylen);
+      if (ret == OK)
+        {
+          ret = webclient_response(ws);
+        }
+
+      /* The server may have closed an idle persistent connection.  If
+       * nothing at all came back on a reused connection, open a new one
+       * and try again once.
+       */
+
+      if (ret < 0 && reused && ws->sockfd >= 0 && !ws->received)
+        {
+          ninfo("Persistent connection lost, reconnecting\n");
+          webclient_disconnect(ws);
+          continue;
+        }
+
+      break;
+    }
+
+  if (ret < 0)
+    {
+      webclient_disconnect(ws);
+      return ret;
+    }
+
+  status = ret;
+
+  /* There is no body in the response to a HEAD request */
+
+  if (strcmp(method, "HEAD") == 0)
+    {
+      ws->chunked = false;
+      ws->bodylen = 0;
+    }
+
+  ret = webclient_body(ws, sink, arg);
+  if (ret < 0 || !ws->keepalive)
+    {
+      webclient_disconnect(ws);
+    }
+
+  return ret < 0 ? ret : status;
+}
+
+/****************************************************************************
+ * Name: webclient_close
+ *
+ * Description:
+ *   Close the connection (if any) and free the session.
+ *
+ ****************************************************************************/
+
+void webclient_close(FAR struct webclient_session_s *ws)
+{
+  if (ws != NULL)
+    {
+      webclient_disconnect(ws);
+      free(ws);
+    }
+}
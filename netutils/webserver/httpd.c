@@ -63,10 +63,16 @@
 #  include <pthread.h>
 #endif
 
+#ifdef CONFIG_NETUTILS_HTTPD_POLLCONNECT
+#  include <poll.h>
+#  include <time.h>
+#endif
+
 #include <arpa/inet.h>
 
 #include "netutils/netlib.h"
 #include "netutils/httpd.h"
+#include "system/perfcount.h"
 
 #include "httpd.h"
 #include "httpd_cgi.h"
@@ -101,6 +107,10 @@
 #  define CONFIG_NETUTILS_HTTPD_ERRPATH ""
 #endif
 
+#ifndef CONFIG_NETUTILS_HTTPD_LISTENERS
+#  define CONFIG_NETUTILS_HTTPD_LISTENERS 1
+#endif
+
 /* The correct way to disable receive timeout errors is by setting the
  * timeout to zero.
  */
@@ -129,16 +139,46 @@
 #  endif
 #endif
 
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Request parser states (struct httpd_state::ht_parsestate) */
+
+enum httpd_parsestate_e
+{
+  HTTPD_PARSE_METHOD = 0,
+  HTTPD_PARSE_HEADER,
+  HTTPD_PARSE_BODY
+};
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
 
+/* Counters in the performance counter registry.  They are updated from all
+ * handler threads.
+ */
+
+PERF_COUNTER(g_perf_requests, "webserver.requests");
+PERF_COUNTER(g_perf_errors, "webserver.errors");
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
 static int httpd_open(const char *name, struct httpd_fs_file *file)
 {
+#ifdef CONFIG_NETUTILS_HTTPD_CACHE
+  /* Serve small files from memory when possible */
+
+  file->cache = NULL;
+  if (httpd_cache_open(name, file) == OK)
+    {
+      return OK;
+    }
+#endif
+
 #if defined(CONFIG_NETUTILS_HTTPD_CLASSIC)
   return httpd_fs_open(name, file);
 #elif defined(CONFIG_NETUTILS_HTTPD_MMAP)
@@ -180,6 +220,13 @@ static int httpd_openindex(struct httpd_state *pstate)
 
 static int httpd_close(struct httpd_fs_file *file)
 {
+#ifdef CONFIG_NETUTILS_HTTPD_CACHE
+  if (file->cache != NULL)
+    {
+      return httpd_cache_close(file);
+    }
+#endif
+
 #if defined(CONFIG_NETUTILS_HTTPD_CLASSIC)
   return OK;
 #elif defined(CONFIG_NETUTILS_HTTPD_MMAP)
@@ -334,6 +381,9 @@ static int send_chunk(struct httpd_state *pstate, const char *buf, int len)
           return ERROR;
         }
 
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+      pstate->ht_nsent += ret;
+#endif
       buf += ret;
       len -= ret;
     }
@@ -342,53 +392,147 @@ static int send_chunk(struct httpd_state *pstate, const char *buf, int len)
   return OK;
 }
 
+#ifdef CONFIG_NETUTILS_HTTPD_GZIP
+/* Check if an Accept-Encoding value accepts the gzip content coding.  A
+ * q-value of zero explicitly refuses it.
+ */
+
+static bool httpd_acceptgzip(FAR const char *value)
+{
+  FAR const char *end;
+  FAR const char *q;
+  size_t len;
+
+  while (*value != '\0')
+    {
+      value += strspn(value, " \t,");
+      end    = value + strcspn(value, ",");
+      len    = strcspn(value, " \t;,");
+
+      if ((len == 4 && strncasecmp(value, "gzip", 4) == 0) ||
+          (len == 6 && strncasecmp(value, "x-gzip", 6) == 0))
+        {
+          q = strstr(value, "q=");
+          if (q == NULL || q > end)
+            {
+              return true;
+            }
+
+          /* Only "0", "0.", "0.0", ... refuse the coding */
+
+          q += 2;
+          if (*q != '0')
+            {
+              return true;
+            }
+
+          q++;
+          if (*q == '.')
+            {
+              q += 1 + strspn(q + 1, "0");
+            }
+
+          return *q >= '1' && *q <= '9';
+        }
+
+      value = end;
+    }
+
+  return false;
+}
+
+/* Replace the open file with its precompressed variant, if there is one */
+
+static void httpd_opengzip(struct httpd_state *pstate)
+{
+  struct httpd_fs_file file;
+  char name[HTTPD_MAX_FILENAME + 3];
+  size_t len;
+
+  pstate->ht_gzip = false;
+  if (!pstate->ht_acceptgzip)
+    {
+      return;
+    }
+
+  len = strlen(pstate->ht_filename);
+  if (len > 3 && strcmp(&pstate->ht_filename[len - 3], ".gz") == 0)
+    {
+      /* The compressed file was requested explicitly */
+
+      return;
+    }
+
+  (void)snprintf(name, sizeof name, "%s.gz", pstate->ht_filename);
+  if (httpd_open(name, &file) != OK)
+    {
+      return;
+    }
+
+  ninfo("[%d] sending '%s'\n", pstate->ht_sockfd, name);
+
+  (void)httpd_close(&pstate->ht_file);
+  pstate->ht_file = file;
+  pstate->ht_gzip = true;
+}
+#endif
+
 static int send_headers(struct httpd_state *pstate, int status, int len)
 {
   const char *mime;
-  const char *ptr;
   char contentlen[HTTPD_MAX_CONTENTLEN];
   char header[HTTPD_MAX_HEADERLEN];
+#ifdef CONFIG_NETUTILS_HTTPD_CACHE
+  char etag[HTTPD_CACHE_ETAGLEN + 8];
+#endif
+#ifdef CONFIG_NETUTILS_HTTPD_GZIP
+  const char *encoding = "";
+#endif
   int hdrlen;
-  int i;
 
-  static const struct
-  {
-    const char *ext;
-    const char *mime;
-  } a[] =
-  {
-#ifndef CONFIG_NETUTILS_HTTPD_SCRIPT_DISABLE
-    { "shtml", "text/html"       },
-#endif
-    { "html",  "text/html"       },
-    { "css",   "text/css"        },
-    { "txt",   "text/plain"      },
-    { "js",    "text/javascript" },
+#ifdef CONFIG_NETUTILS_HTTPD_CACHE
+  /* Cached files carry precomputed header values */
 
-    { "png",   "image/png"       },
-    { "gif",   "image/gif"       },
-    { "jpeg",  "image/jpeg"      },
-    { "jpg",   "image/jpeg"      }
-  };
+  etag[0] = '\0';
+  if (status < 400 && pstate->ht_file.cache != NULL)
+    {
+      (void)snprintf(etag, sizeof etag, "ETag: %s\r\n",
+                     httpd_cache_etag(&pstate->ht_file));
+    }
 
-  ptr = strrchr(pstate->ht_filename, ISO_period);
-  if (ptr == NULL)
+  if (status < 400 && pstate->ht_file.cache != NULL
+#ifdef CONFIG_NETUTILS_HTTPD_GZIP
+      && !pstate->ht_gzip
+#endif
+      )
     {
-      mime = "application/octet-stream";
+      mime = httpd_cache_mimetype(&pstate->ht_file);
     }
   else
+#endif
     {
-      mime = "text/plain";
+      /* The type of a .gz variant is that of the requested file */
 
-      for (i = 0; i < sizeof a / sizeof *a; i++)
-        {
-          if (strncmp(a[i].ext, ptr + 1, strlen(a[i].ext)) == 0)
-            {
-              mime = a[i].mime;
-              break;
-            }
-        }
+      mime = httpd_mimetype(pstate->ht_filename);
+    }
+
+#ifdef CONFIG_NETUTILS_HTTPD_GZIP
+  /* Responses for files depend on the request's Accept-Encoding */
+
+  if (status < 400)
+    {
+      encoding = pstate->ht_gzip ?
+                 "Content-Encoding: gzip\r\nVary: Accept-Encoding\r\n" :
+                 "Vary: Accept-Encoding\r\n";
+    }
+#endif
+
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+  if (status >= 400)
+    {
+      pstate->ht_sclass = HTTPD_STATS_ERROR;
     }
+#endif
 
   if (len >= 0)
     {
@@ -421,6 +565,12 @@ static int send_headers(struct httpd_state *pstate, int status, int len)
                     "Connection: %s\r\n"
                     "Content-type: %s\r\n"
                     "%s"
+#ifdef CONFIG_NETUTILS_HTTPD_CACHE
+                    "%s"
+#endif
+#ifdef CONFIG_NETUTILS_HTTPD_GZIP
+                    "%s"
+#endif
                     "\r\n",
                     status,
                     status >= 400 ? "Error" : "OK",
@@ -430,11 +580,46 @@ static int send_headers(struct httpd_state *pstate, int status, int len)
                     "close",
 #endif
                     mime,
-                    len >= 0 ? contentlen : "");
+                    len >= 0 ? contentlen : ""
+#ifdef CONFIG_NETUTILS_HTTPD_CACHE
+                    , etag
+#endif
+#ifdef CONFIG_NETUTILS_HTTPD_GZIP
+                    , encoding
+#endif
+                    );
 
   return send_chunk(pstate, header, hdrlen);
 }
 
+/* Send the body of the file that is open in pstate->ht_file */
+
+static int httpd_senddata(struct httpd_state *pstate)
+{
+#ifdef CONFIG_NETUTILS_HTTPD_CACHE
+  if (pstate->ht_file.cache != NULL)
+    {
+      return send_chunk(pstate, pstate->ht_file.data, pstate->ht_file.len);
+    }
+#endif
+
+#if defined(CONFIG_NETUTILS_HTTPD_CLASSIC) || defined(CONFIG_NETUTILS_HTTPD_MMAP)
+  return send_chunk(pstate, pstate->ht_file.data, pstate->ht_file.len);
+#elif defined(CONFIG_NETUTILS_HTTPD_SENDFILE)
+  if (httpd_sendfile_send(pstate->ht_sockfd, &pstate->ht_file) != OK)
+    {
+      return ERROR;
+    }
+
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+  pstate->ht_nsent += pstate->ht_file.len;
+#endif
+  return OK;
+#else
+  return ERROR;
+#endif
+}
+
 static int httpd_senderror(struct httpd_state *pstate, int status)
 {
   int ret;
@@ -442,6 +627,10 @@ static int httpd_senderror(struct httpd_state *pstate, int status)
 
   ninfo("[%d] sending error '%d'\n", pstate->ht_sockfd, status);
 
+#ifdef CONFIG_NETUTILS_HTTPD_GZIP
+  pstate->ht_gzip = false;
+#endif
+
   if (status < 400 || status >= 600)
     {
       status = 500;
@@ -473,20 +662,41 @@ static int httpd_senderror(struct httpd_state *pstate, int status)
     }
   else
     {
-#ifdef CONFIG_NETUTILS_HTTPD_CLASSIC
-      ret = send_chunk(pstate, pstate->ht_file.data, pstate->ht_file.len);
-#else
-#ifdef CONFIG_NETUTILS_HTTPD_SENDFILE
-      ret = httpd_sendfile_send(pstate->ht_sockfd, &pstate->ht_file);
-#endif
-#endif
-
+      ret = httpd_senddata(pstate);
       (void)httpd_close(&pstate->ht_file);
     }
 
   return ret;
 }
 
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+/* Send the server statistics report */
+
+static int httpd_sendstats(struct httpd_state *pstate)
+{
+  FAR char *report;
+  int len;
+  int ret;
+
+  report = (FAR char *)malloc(HTTPD_STATS_REPORTLEN);
+  if (report == NULL)
+    {
+      return httpd_senderror(pstate, 500);
+    }
+
+  len = httpd_stats_format(report, HTTPD_STATS_REPORTLEN);
+
+  ret = send_headers(pstate, 200, len);
+  if (ret == OK)
+    {
+      ret = send_chunk(pstate, report, len);
+    }
+
+  free(report);
+  return ret;
+}
+#endif
+
 static int httpd_sendfile(struct httpd_state *pstate)
 {
 #ifndef CONFIG_NETUTILS_HTTPD_SCRIPT_DISABLE
@@ -495,9 +705,19 @@ static int httpd_sendfile(struct httpd_state *pstate)
   int ret = ERROR;
 
   pstate->ht_sndlen = 0;
+#ifdef CONFIG_NETUTILS_HTTPD_GZIP
+  pstate->ht_gzip   = false;
+#endif
 
   ninfo("[%d] sending file '%s'\n", pstate->ht_sockfd, pstate->ht_filename);
 
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+  if (strcmp(pstate->ht_filename, CONFIG_NETUTILS_HTTPD_STATS_URL) == 0)
+    {
+      return httpd_sendstats(pstate);
+    }
+#endif
+
 #ifdef CONFIG_NETUTILS_HTTPD_CGIPATH
   {
     httpd_cgifunction f;
@@ -507,6 +727,9 @@ static int httpd_sendfile(struct httpd_state *pstate)
       {
 #ifndef CONFIG_NETUTILS_HTTPD_KEEPALIVE_DISABLE
         pstate->ht_keepalive = false;
+#endif
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+        pstate->ht_sclass = HTTPD_STATS_SCRIPT;
 #endif
         f(pstate, pstate->ht_filename);
 
@@ -529,6 +752,9 @@ static int httpd_sendfile(struct httpd_state *pstate)
     {
 #ifndef CONFIG_NETUTILS_HTTPD_KEEPALIVE_DISABLE
       pstate->ht_keepalive = false;
+#endif
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+      pstate->ht_sclass = HTTPD_STATS_SCRIPT;
 #endif
       if (send_headers(pstate, 200, -1) != OK)
         {
@@ -540,180 +766,185 @@ static int httpd_sendfile(struct httpd_state *pstate)
     }
 #endif
 
+#ifdef CONFIG_NETUTILS_HTTPD_GZIP
+  httpd_opengzip(pstate);
+#endif
+
   if (send_headers(pstate, pstate->ht_file.len == 0 ? 204 : 200, pstate->ht_file.len) != OK)
     {
       goto done;
     }
 
-#ifdef CONFIG_NETUTILS_HTTPD_CLASSIC
-      ret = send_chunk(pstate, pstate->ht_file.data, pstate->ht_file.len);
-#else
-#ifdef CONFIG_NETUTILS_HTTPD_SENDFILE
-      ret = httpd_sendfile_send(pstate->ht_sockfd, &pstate->ht_file);
-#endif
-#endif
+  ret = httpd_senddata(pstate);
 
 done:
   (void)httpd_close(&pstate->ht_file);
   return ret;
 }
 
-static inline int httpd_parse(struct httpd_state *pstate)
-{
-  char *o;
+/****************************************************************************
+ * Name: httpd_parse_block
+ *
+ * Description:
+ *   Process every complete line currently held in ht_buffer.  Partial lines
+ *   are shuffled down to the start of the buffer so that more data can be
+ *   appended by the caller.
+ *
+ * Returned Value:
+ *   Zero if more data is required to complete the request header, 200 if
+ *   the request header is complete, or an HTTP error status.
+ *
+ ****************************************************************************/
 
-  enum
-  {
-    STATE_METHOD,
-    STATE_HEADER,
-    STATE_BODY
-  } state;
+static int httpd_parse_block(struct httpd_state *pstate)
+{
+  char *o = pstate->ht_buffer + pstate->ht_recvlen;
+  char *start;
+  char *end;
 
-  state = STATE_METHOD;
-  o = pstate->ht_buffer;
+  /* Here o marks the end of the total block currently awaiting processing.
+   * There may be multiple lines in a block; next we deal with each in turn.
+   */
 
-  do
+  for (start = pstate->ht_buffer;
+       (end = memchr(start, '\r', o - start)), end != NULL;
+       start = end)
     {
-      char *start;
-      char *end;
+      *end = '\0';
+      end++;
 
-      if (o == pstate->ht_buffer + sizeof pstate->ht_buffer)
+      if (end >= o)
         {
-          nerr("ERROR: [%d] ht_buffer overflow\n");
-          return 413;
+          /* The LF has not been received yet.  Restore the CR so that the
+           * line is processed again once the remainder arrives.
+           */
+
+          *(end - 1) = '\r';
+          break;
         }
 
+      /* Here start and end are a single line within the current block */
+
+      httpd_dumpbuffer("Incoming HTTP line", start, end - start);
+
+      if (*end != '\n')
+        {
+          nwarn("WARNING: [%d] expected CRLF\n");
+          return 400;
+        }
+
+      end++;
+
+      switch (pstate->ht_parsestate)
       {
-        ssize_t r;
+      char *v;
 
-        r = recv(pstate->ht_sockfd, o,
-          sizeof pstate->ht_buffer - (o - pstate->ht_buffer), 0);
-        if (r == 0)
+      case HTTPD_PARSE_METHOD:
+        if (0 != strncmp(start, "GET ", 4))
           {
-            nwarn("WARNING: [%d] connection lost\n", pstate->ht_sockfd);
-            return ERROR;
+            nwarn("WARNING: [%d] method not supported\n");
+            return 501;
           }
 
-#if CONFIG_NETUTILS_HTTPD_TIMEOUT > 0
-        if (r == -1 && errno == EWOULDBLOCK)
-          {
-            nwarn("WARNING: [%d] recv timeout\n");
-            return 408;
-          }
-#endif
-        if (r == -1)
+        start += 4;
+        v = start + strcspn(start, " ");
+
+        if (0 != strcmp(v, " HTTP/1.0") && 0 != strcmp(v, " HTTP/1.1"))
           {
-            nerr("ERROR: [%d] recv failed: %d\n",
-                 pstate->ht_sockfd, errno);
-            return 400;
+            nwarn("WARNING: [%d] HTTP version not supported\n");
+            return 505;
           }
 
-        o += r;
-      }
+#ifndef CONFIG_NETUTILS_HTTPD_KEEPALIVE_DISABLE
+        /* HTTP/1.1 connections are persistent unless the client asks for
+         * "Connection: close".
+         */
 
-      /* Here o marks the end of the total block currently awaiting processing.
-       * There may be multiple lines in a block; next we deal with each in turn.
-       */
+        pstate->ht_keepalive = (0 == strcmp(v, " HTTP/1.1"));
+#endif
 
-      for (start = pstate->ht_buffer;
-           (end = memchr(start, '\r', o - start)), end != NULL;
-           start = end)
-        {
-          *end = '\0';
-          end++;
+        /* TODO: url decoding */
 
-          /* Here start and end are a single line within the current block */
+        if (v - start >= sizeof pstate->ht_filename)
+          {
+            nerr("ERROR: [%d] ht_filename overflow\n");
+            return 414;
+          }
 
-          httpd_dumpbuffer("Incoming HTTP line", start, end - start);
+        *v = '\0';
+        (void) strcpy(pstate->ht_filename, start);
+        pstate->ht_parsestate = HTTPD_PARSE_HEADER;
+#ifdef CONFIG_NETUTILS_HTTPD_GZIP
+        pstate->ht_acceptgzip = false;
+#endif
+        break;
 
-          if (*end != '\n')
-            {
-              nwarn("WARNING: [%d] expected CRLF\n");
-              return 400;
-            }
+      case HTTPD_PARSE_HEADER:
+        if (*start == '\0')
+          {
+            pstate->ht_parsestate = HTTPD_PARSE_BODY;
+            break;
+          }
 
-          end++;
+        v = start + strcspn(start, ":");
+        if (*v != '\0')
+          {
+            *v = '\0', v++;
+            v += strspn(v, ": ");
+          }
 
-          switch (state)
+        if (*start == '\0' || *v == '\0')
           {
-          char *v;
-
-          case STATE_METHOD:
-            if (0 != strncmp(start, "GET ", 4))
-              {
-                nwarn("WARNING: [%d] method not supported\n");
-                return 501;
-              }
-
-            start += 4;
-            v = start + strcspn(start, " ");
-
-            if (0 != strcmp(v, " HTTP/1.0") && 0 != strcmp(v, " HTTP/1.1"))
-              {
-                nwarn("WARNING: [%d] HTTP version not supported\n");
-                return 505;
-              }
-
-            /* TODO: url decoding */
-
-            if (v - start >= sizeof pstate->ht_filename)
-              {
-                nerr("ERROR: [%d] ht_filename overflow\n");
-                return 414;
-              }
-
-            *v = '\0';
-            (void) strcpy(pstate->ht_filename, start);
-            state = STATE_HEADER;
-            break;
+            nwarn("WARNING: [%d] header parse error\n");
+            return 400;
+          }
 
-          case STATE_HEADER:
-            if (*start == '\0')
-              {
-                state = STATE_BODY;
-                break;
-              }
-
-            v = start + strcspn(start, ":");
-            if (*v != '\0')
-              {
-                *v = '\0', v++;
-                v += strspn(v, ": ");
-              }
-
-            if (*start == '\0' || *v == '\0')
-              {
-                nwarn("WARNING: [%d] header parse error\n");
-                return 400;
-              }
-
-            ninfo("[%d] Request header %s: %s\n", pstate->ht_sockfd, start, v);
-
-            if (0 == strcasecmp(start, "Content-Length") && 0 != atoi(v))
-              {
-                nwarn("WARNING: [%d] non-zero request length\n");
-                return 413;
-              }
+        ninfo("[%d] Request header %s: %s\n", pstate->ht_sockfd, start, v);
+
+        if (0 == strcasecmp(start, "Content-Length") && 0 != atoi(v))
+          {
+            nwarn("WARNING: [%d] non-zero request length\n");
+            return 413;
+          }
 #ifndef CONFIG_NETUTILS_HTTPD_KEEPALIVE_DISABLE
-            else if (0 == strcasecmp(start, "Connection") && 0 == strcasecmp(v, "keep-alive"))
-              {
-                pstate->ht_keepalive = true;
-              }
+        else if (0 == strcasecmp(start, "Connection") && 0 == strcasecmp(v, "keep-alive"))
+          {
+            pstate->ht_keepalive = true;
+          }
+        else if (0 == strcasecmp(start, "Connection") && 0 == strcasecmp(v, "close"))
+          {
+            pstate->ht_keepalive = false;
+          }
 #endif
-            break;
-
-          case STATE_BODY:
-            /* Not implemented */
-            break;
+#ifdef CONFIG_NETUTILS_HTTPD_GZIP
+        else if (0 == strcasecmp(start, "Accept-Encoding"))
+          {
+            pstate->ht_acceptgzip = httpd_acceptgzip(v);
           }
-       }
+#endif
+        break;
+
+      case HTTPD_PARSE_BODY:
+        /* Not implemented */
+        break;
+      }
+
+      if (pstate->ht_parsestate == HTTPD_PARSE_BODY)
+        {
+          start = end;
+          break;
+        }
+    }
+
+  /* Shuffle down for the next block */
 
-      /* Shuffle down for the next block */
+  memmove(pstate->ht_buffer, start, o - start);
+  pstate->ht_recvlen -= (start - pstate->ht_buffer);
 
-      memmove(pstate->ht_buffer, start, o - start);
-      o -= (start - pstate->ht_buffer);
+  if (pstate->ht_parsestate != HTTPD_PARSE_BODY)
+    {
+      return 0;
     }
-  while (state != STATE_BODY);
 
 #ifdef CONFIG_NETUTILS_HTTPD_CLASSIC
   if (0 == strcmp(pstate->ht_filename, "/"))
@@ -727,33 +958,134 @@ static inline int httpd_parse(struct httpd_state *pstate)
   return 200;
 }
 
-/****************************************************************************
- * Name: httpd_handler
- *
- * Description:
- *   Each time a new connection to port 80 is made, a new thread is created
- *   that begins at this entry point.  There should be exactly one argument
- *   and it should be the socket descriptor (+1).
- *
- ****************************************************************************/
-
-static void *httpd_handler(void *arg)
+static inline int httpd_parse(struct httpd_state *pstate)
 {
-  struct httpd_state *pstate = (struct httpd_state *)malloc(sizeof(struct httpd_state));
-  int sockfd = (int)arg;
+  int status;
 
-  ninfo("[%d] Started\n", sockfd);
+  /* Bytes left in ht_buffer after the previous request header belong to
+   * requests that the client pipelined behind it.  Parse those before
+   * waiting for more data.
+   */
 
-  /* Verify that the state structure was successfully allocated */
+  pstate->ht_parsestate = HTTPD_PARSE_METHOD;
+  status = httpd_parse_block(pstate);
 
-  if (pstate)
+  while (status == 0)
     {
-      int status;
-
-      /* Re-initialize the thread state structure */
+      ssize_t r;
+
+      if (pstate->ht_recvlen >= sizeof pstate->ht_buffer)
+        {
+          nerr("ERROR: [%d] ht_buffer overflow\n");
+          return 413;
+        }
+
+      r = recv(pstate->ht_sockfd, pstate->ht_buffer + pstate->ht_recvlen,
+               sizeof pstate->ht_buffer - pstate->ht_recvlen, 0);
+      if (r == 0)
+        {
+          nwarn("WARNING: [%d] connection lost\n", pstate->ht_sockfd);
+          return ERROR;
+        }
+
+#if CONFIG_NETUTILS_HTTPD_TIMEOUT > 0
+      if (r == -1 && errno == EWOULDBLOCK)
+        {
+          nwarn("WARNING: [%d] recv timeout\n");
+          return 408;
+        }
+#endif
+      if (r == -1)
+        {
+          nerr("ERROR: [%d] recv failed: %d\n",
+               pstate->ht_sockfd, errno);
+          return 400;
+        }
+
+      pstate->ht_recvlen += r;
+      status = httpd_parse_block(pstate);
+    }
+
+  return status;
+}
+
+/****************************************************************************
+ * Name: httpd_respond
+ *
+ * Description:
+ *   Send the response to a parsed request:  Either the requested file or
+ *   an error page.
+ *
+ ****************************************************************************/
+
+static inline void httpd_respond(struct httpd_state *pstate, int status)
+{
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+  uint32_t start = httpd_stats_now();
+  uint32_t end;
+
+  pstate->ht_sclass = HTTPD_STATS_STATIC;
+  pstate->ht_nsent  = 0;
+#endif
+
+  if (status < 0)
+    {
+      /* The connection was lost, there is nobody to respond to */
+
+      return;
+    }
+
+  PERF_INC(g_perf_requests);
+  if (status >= 400)
+    {
+      PERF_INC(g_perf_errors);
+      (void)httpd_senderror(pstate, status);
+    }
+  else
+    {
+      (void)httpd_sendfile(pstate);
+    }
+
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+  end = httpd_stats_now();
+  httpd_stats_response(pstate->ht_sclass, pstate->ht_nsent, start, end);
+  httpd_stats_phase(HTTPD_STATS_HANDLE, start, end);
+#endif
+}
+
+/****************************************************************************
+ * Name: httpd_handler
+ *
+ * Description:
+ *   Each time a new connection to port 80 is made, a new thread is created
+ *   that begins at this entry point.  There should be exactly one argument
+ *   and it should be the socket descriptor (+1).
+ *
+ ****************************************************************************/
+
+static void *httpd_handler(void *arg)
+{
+  struct httpd_state *pstate = (struct httpd_state *)malloc(sizeof(struct httpd_state));
+  int sockfd = (int)arg;
+
+  ninfo("[%d] Started\n", sockfd);
+
+  /* Verify that the state structure was successfully allocated */
+
+  if (pstate)
+    {
+      int status;
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+      uint32_t start;
+#endif
+
+      /* Re-initialize the thread state structure */
 
       memset(pstate, 0, sizeof(struct httpd_state));
       pstate->ht_sockfd = sockfd;
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+      httpd_stats_accept();
+#endif
 
 #ifndef CONFIG_NETUTILS_HTTPD_KEEPALIVE_DISABLE
       do
@@ -762,15 +1094,14 @@ static void *httpd_handler(void *arg)
 #endif
           /* Then handle the next httpd command */
 
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+          start  = httpd_stats_now();
           status = httpd_parse(pstate);
-          if (status >= 400)
-            {
-              (void)httpd_senderror(pstate, status);
-            }
-          else
-            {
-              (void) httpd_sendfile(pstate);
-            }
+          httpd_stats_phase(HTTPD_STATS_WAIT, start, httpd_stats_now());
+#else
+          status = httpd_parse(pstate);
+#endif
+          httpd_respond(pstate, status);
 
 #ifndef CONFIG_NETUTILS_HTTPD_KEEPALIVE_DISABLE
         }
@@ -779,6 +1110,9 @@ static void *httpd_handler(void *arg)
 
       /* End of command processing -- Clean up and exit */
 
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+      httpd_stats_close();
+#endif
       free(pstate);
     }
 
@@ -789,7 +1123,8 @@ static void *httpd_handler(void *arg)
   return NULL;
 }
 
-#ifdef CONFIG_NETUTILS_HTTPD_SINGLECONNECT
+#if defined(CONFIG_NETUTILS_HTTPD_SINGLECONNECT) && \
+   !defined(CONFIG_NETUTILS_HTTPD_POLLCONNECT)
 static void single_server(uint16_t portno, pthread_startroutine_t handler, int stacksize)
 {
   struct sockaddr_in myaddr;
@@ -862,9 +1197,385 @@ static void single_server(uint16_t portno, pthread_startroutine_t handler, int s
 }
 #endif
 
+#ifdef CONFIG_NETUTILS_HTTPD_POLLCONNECT
+/****************************************************************************
+ * Name: httpd_now
+ *
+ * Description:
+ *   Return the current time in seconds for connection timeout accounting.
+ *
+ ****************************************************************************/
+
+static time_t httpd_now(void)
+{
+  struct timespec ts;
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+  (void)clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+  return ts.tv_sec;
+}
+
+/****************************************************************************
+ * Name: httpd_slot_reset
+ *
+ * Description:
+ *   Prepare a connection slot to receive the next request.  Any bytes
+ *   already held in ht_buffer are kept; they start the next request.
+ *
+ ****************************************************************************/
+
+static void httpd_slot_reset(struct httpd_state *pstate)
+{
+  pstate->ht_parsestate = HTTPD_PARSE_METHOD;
+  pstate->ht_timestamp  = httpd_now();
+#ifndef CONFIG_NETUTILS_HTTPD_KEEPALIVE_DISABLE
+  pstate->ht_keepalive  = false;
+#endif
+}
+
+/****************************************************************************
+ * Name: httpd_slot_close
+ *
+ * Description:
+ *   Close the connection held by a slot and mark the slot as free.
+ *
+ ****************************************************************************/
+
+static void httpd_slot_close(struct httpd_state *pstate)
+{
+  ninfo("[%d] Closing\n", pstate->ht_sockfd);
+  close(pstate->ht_sockfd);
+  pstate->ht_sockfd = -1;
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+  httpd_stats_close();
+#endif
+}
+
+/****************************************************************************
+ * Name: httpd_slot_recv
+ *
+ * Description:
+ *   Called when poll() reports that a connection is readable.  Receive what
+ *   is available and, once the request header is complete, send the
+ *   response.
+ *
+ ****************************************************************************/
+
+static void httpd_slot_recv(struct httpd_state *pstate)
+{
+  ssize_t r;
+  int status;
+
+  if (pstate->ht_recvlen >= sizeof pstate->ht_buffer)
+    {
+      nerr("ERROR: [%d] ht_buffer overflow\n", pstate->ht_sockfd);
+      (void)httpd_senderror(pstate, 413);
+      httpd_slot_close(pstate);
+      return;
+    }
+
+  r = recv(pstate->ht_sockfd, pstate->ht_buffer + pstate->ht_recvlen,
+           sizeof pstate->ht_buffer - pstate->ht_recvlen, 0);
+  if (r == 0)
+    {
+      nwarn("WARNING: [%d] connection lost\n", pstate->ht_sockfd);
+      httpd_slot_close(pstate);
+      return;
+    }
+  else if (r < 0)
+    {
+      if (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+          return;
+        }
+
+      nerr("ERROR: [%d] recv failed: %d\n", pstate->ht_sockfd, errno);
+      (void)httpd_senderror(pstate, 400);
+      httpd_slot_close(pstate);
+      return;
+    }
+
+  pstate->ht_recvlen  += r;
+  pstate->ht_timestamp = httpd_now();
+
+  /* Answer every complete request in the buffer.  Pipelined requests will
+   * not cause another POLLIN event, so they must be handled here.
+   */
+
+  for (; ; )
+    {
+      status = httpd_parse_block(pstate);
+      if (status == 0)
+        {
+          /* The request header is still incomplete */
+
+          return;
+        }
+
+      httpd_respond(pstate, status);
+
+#ifndef CONFIG_NETUTILS_HTTPD_KEEPALIVE_DISABLE
+      if (status < 400 && pstate->ht_keepalive)
+        {
+          httpd_slot_reset(pstate);
+          if (pstate->ht_recvlen > 0)
+            {
+              continue;
+            }
+
+          return;
+        }
+#endif
+
+      httpd_slot_close(pstate);
+      return;
+    }
+}
+
+/****************************************************************************
+ * Name: poll_server
+ *
+ * Description:
+ *   Service up to CONFIG_NETUTILS_HTTPD_MAXCONNECT connections from a single
+ *   thread.  Requests are accumulated in per-connection httpd_state slots as
+ *   data arrives so that one slow client cannot stall the others.
+ *
+ ****************************************************************************/
+
+static void poll_server(uint16_t portno)
+{
+  FAR struct httpd_state *slots;
+  struct pollfd fds[CONFIG_NETUTILS_HTTPD_MAXCONNECT + 1];
+  FAR struct httpd_state *map[CONFIG_NETUTILS_HTTPD_MAXCONNECT];
+  struct sockaddr_in myaddr;
+  socklen_t addrlen;
+  int listensd;
+  int acceptsd;
+  int timeout;
+  int nfds;
+  int ret;
+  int i;
+#ifdef CONFIG_NET_SOLINGER
+  struct linger ling;
+#endif
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+  uint32_t start;
+#endif
+
+  slots = (FAR struct httpd_state *)
+    malloc(CONFIG_NETUTILS_HTTPD_MAXCONNECT * sizeof(struct httpd_state));
+  if (slots == NULL)
+    {
+      nerr("ERROR: Failed to allocate connection slots\n");
+      return;
+    }
+
+  for (i = 0; i < CONFIG_NETUTILS_HTTPD_MAXCONNECT; i++)
+    {
+      slots[i].ht_sockfd = -1;
+    }
+
+  listensd = netlib_listenon(portno);
+  if (listensd < 0)
+    {
+      free(slots);
+      return;
+    }
+
+  /* Begin serving connections */
+
+  for (; ; )
+    {
+      FAR struct httpd_state *free_slot = NULL;
+
+      /* Set up the poll list.  The listen socket is only included while
+       * there is a free slot to hold the new connection.
+       */
+
+      nfds    = 1;
+      timeout = -1;
+
+      for (i = 0; i < CONFIG_NETUTILS_HTTPD_MAXCONNECT; i++)
+        {
+          if (slots[i].ht_sockfd < 0)
+            {
+              free_slot = &slots[i];
+              continue;
+            }
+
+          fds[nfds].fd      = slots[i].ht_sockfd;
+          fds[nfds].events  = POLLIN;
+          fds[nfds].revents = 0;
+          map[nfds - 1]     = &slots[i];
+          nfds++;
+
+#if CONFIG_NETUTILS_HTTPD_TIMEOUT > 0
+          /* Wake up once per second to expire idle connections */
+
+          timeout = 1000;
+#endif
+        }
+
+      fds[0].fd      = listensd;
+      fds[0].events  = free_slot != NULL ? POLLIN : 0;
+      fds[0].revents = 0;
+
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+      start = httpd_stats_now();
+      ret   = poll(fds, nfds, timeout);
+      httpd_stats_phase(HTTPD_STATS_WAIT, start, httpd_stats_now());
+#else
+      ret = poll(fds, nfds, timeout);
+#endif
+      if (ret < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          nerr("ERROR: poll failure: %d\n", errno);
+          break;
+        }
+
+      /* Service readable connections */
+
+      for (i = 1; i < nfds; i++)
+        {
+          if (fds[i].revents != 0)
+            {
+              httpd_slot_recv(map[i - 1]);
+            }
+#if CONFIG_NETUTILS_HTTPD_TIMEOUT > 0
+          else if (httpd_now() - map[i - 1]->ht_timestamp >=
+                   CONFIG_NETUTILS_HTTPD_TIMEOUT)
+            {
+              nwarn("WARNING: [%d] recv timeout\n", map[i - 1]->ht_sockfd);
+
+              /* Only report the timeout if a request was started */
+
+              if (map[i - 1]->ht_recvlen > 0 ||
+                  map[i - 1]->ht_parsestate != HTTPD_PARSE_METHOD)
+                {
+                  (void)httpd_senderror(map[i - 1], 408);
+                }
+
+              httpd_slot_close(map[i - 1]);
+            }
+#endif
+        }
+
+      /* Accept a new connection */
+
+      if ((fds[0].revents & POLLIN) != 0 && free_slot != NULL)
+        {
+          addrlen  = sizeof(struct sockaddr_in);
+          acceptsd = accept(listensd, (struct sockaddr*)&myaddr, &addrlen);
+          if (acceptsd < 0)
+            {
+              nerr("ERROR: accept failure: %d\n", errno);
+              break;
+            }
+
+          ninfo("Connection accepted -- serving sd=%d\n", acceptsd);
+
+#ifdef CONFIG_NET_SOLINGER
+          /* Configure to "linger" until all data is sent when the socket is
+           * closed
+           */
+
+          ling.l_onoff  = 1;
+          ling.l_linger = 30;     /* timeout is seconds */
+          if (setsockopt(acceptsd, SOL_SOCKET, SO_LINGER, &ling,
+                         sizeof(struct linger)) < 0)
+            {
+              nerr("ERROR: setsockopt SO_LINGER failure: %d\n", errno);
+              close(acceptsd);
+              continue;
+            }
+#endif
+
+          memset(free_slot, 0, sizeof(struct httpd_state));
+          free_slot->ht_sockfd = acceptsd;
+          httpd_slot_reset(free_slot);
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+          httpd_stats_accept();
+#endif
+        }
+    }
+
+  /* Close the sockets */
+
+  for (i = 0; i < CONFIG_NETUTILS_HTTPD_MAXCONNECT; i++)
+    {
+      if (slots[i].ht_sockfd >= 0)
+        {
+          httpd_slot_close(&slots[i]);
+        }
+    }
+
+  close(listensd);
+  free(slots);
+}
+#endif /* CONFIG_NETUTILS_HTTPD_POLLCONNECT */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
+
+/****************************************************************************
+ * Name: httpd_mimetype
+ *
+ * Description:
+ *   Return the MIME type to use for a file, based on its extension.
+ *
+ ****************************************************************************/
+
+FAR const char *httpd_mimetype(FAR const char *name)
+{
+  FAR const char *ptr;
+  int i;
+
+  static const struct
+  {
+    const char *ext;
+    const char *mime;
+  } a[] =
+  {
+#ifndef CONFIG_NETUTILS_HTTPD_SCRIPT_DISABLE
+    { "shtml", "text/html"       },
+#endif
+    { "html",  "text/html"       },
+    { "css",   "text/css"        },
+    { "txt",   "text/plain"      },
+    { "js",    "text/javascript" },
+
+    { "png",   "image/png"       },
+    { "gif",   "image/gif"       },
+    { "jpeg",  "image/jpeg"      },
+    { "jpg",   "image/jpeg"      }
+  };
+
+  ptr = strrchr(name, ISO_period);
+  if (ptr == NULL)
+    {
+      return "application/octet-stream";
+    }
+
+  for (i = 0; i < sizeof a / sizeof *a; i++)
+    {
+      if (strncmp(a[i].ext, ptr + 1, strlen(a[i].ext)) == 0)
+        {
+          return a[i].mime;
+        }
+    }
+
+  return "text/plain";
+}
+
 /****************************************************************************
  * Name: httpd_listen
  *
@@ -878,8 +1589,14 @@ int httpd_listen(void)
 {
   /* Execute httpd_handler on each connection to port 80 */
 
-#ifdef CONFIG_NETUTILS_HTTPD_SINGLECONNECT
+#if defined(CONFIG_NETUTILS_HTTPD_POLLCONNECT)
+  poll_server(HTONS(80));
+#elif defined(CONFIG_NETUTILS_HTTPD_SINGLECONNECT)
   single_server(HTONS(80), httpd_handler, CONFIG_NETUTILS_HTTPDSTACKSIZE);
+#elif defined(CONFIG_NETUTILS_HTTPD_WORKERS) && CONFIG_NETUTILS_HTTPD_WORKERS > 0
+  netlib_poolserver(HTONS(80), httpd_handler, CONFIG_NETUTILS_HTTPDSTACKSIZE,
+                    CONFIG_NETUTILS_HTTPD_WORKERS,
+                    CONFIG_NETUTILS_HTTPD_LISTENERS);
 #else
   netlib_server(HTONS(80), httpd_handler, CONFIG_NETUTILS_HTTPDSTACKSIZE);
 #endif
@@ -900,6 +1617,9 @@ int httpd_listen(void)
 
 void httpd_init(void)
 {
+  PERF_REGISTER(g_perf_requests);
+  PERF_REGISTER(g_perf_errors);
+
 #ifdef CONFIG_NETUTILS_HTTPD_CLASSIC
   httpd_fs_init();
 #endif
@@ -48,10 +48,43 @@
 #include <stdint.h>
 #include <nuttx/net/netconfig.h>
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Size of the ETag value precomputed for cached files */
+
+#define HTTPD_CACHE_ETAGLEN 24
+
+/* A buffer of this size holds the complete statistics report */
+
+#define HTTPD_STATS_REPORTLEN 640
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
 
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+/* Responses are counted in these classes */
+
+enum httpd_stats_class_e
+{
+  HTTPD_STATS_STATIC = 0,    /* Files */
+  HTTPD_STATS_SCRIPT,        /* CGI functions and scripts */
+  HTTPD_STATS_ERROR,         /* Error responses */
+  HTTPD_STATS_NCLASSES
+};
+
+/* Server phases */
+
+enum httpd_stats_phase_e
+{
+  HTTPD_STATS_WAIT = 0,      /* Waiting for requests */
+  HTTPD_STATS_HANDLE,        /* Sending responses */
+  HTTPD_STATS_NPHASES
+};
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -76,4 +109,25 @@ void httpd_fs_init(void);
 
 #endif
 
+#ifdef CONFIG_NETUTILS_HTTPD_CACHE
+int  httpd_cache_open(FAR const char *name, FAR struct httpd_fs_file *file);
+int  httpd_cache_close(FAR struct httpd_fs_file *file);
+FAR const char *httpd_cache_mimetype(FAR struct httpd_fs_file *file);
+FAR const char *httpd_cache_etag(FAR struct httpd_fs_file *file);
+#endif
+
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+uint32_t httpd_stats_now(void);
+void httpd_stats_accept(void);
+void httpd_stats_close(void);
+void httpd_stats_response(int sclass, uint32_t nbytes, uint32_t start,
+                          uint32_t end);
+void httpd_stats_phase(int phase, uint32_t start, uint32_t end);
+int  httpd_stats_format(FAR char *buffer, size_t buflen);
+#endif
+
+/* Return the MIME type to use for a file name */
+
+FAR const char *httpd_mimetype(FAR const char *name);
+
 #endif /* _NETUTILS_WEBSERVER_HTTPD_H */
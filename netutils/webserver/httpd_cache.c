@@ -0,0 +1,463 @@
+/****************************************************************************
+ * netutils/webserver/httpd_cache.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Header Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <time.h>
+#include <semaphore.h>
+#include <errno.h>
+#include <debug.h>
+
+#include "netutils/httpd.h"
+
+#include "httpd.h"
+
+#ifdef CONFIG_NETUTILS_HTTPD_CACHE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_NETUTILS_HTTPD_CACHE_SIZE
+#  define CONFIG_NETUTILS_HTTPD_CACHE_SIZE 16384
+#endif
+
+#ifndef CONFIG_NETUTILS_HTTPD_CACHE_MAXFILE
+#  define CONFIG_NETUTILS_HTTPD_CACHE_MAXFILE 4096
+#endif
+
+#ifndef CONFIG_NETUTILS_HTTPD_CACHE_REVALIDATE
+#  define CONFIG_NETUTILS_HTTPD_CACHE_REVALIDATE 0
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One cached file.  The file name and the file content follow the
+ * structure in the same allocation.
+ */
+
+struct httpd_cache_s
+{
+  FAR struct httpd_cache_s *flink; /* Next entry in LRU order */
+  FAR struct httpd_cache_s *blink; /* Previous entry in LRU order */
+  FAR char    *data;               /* File content */
+  FAR const char *mime;            /* Precomputed MIME type */
+  time_t       mtime;              /* Modification time when cached */
+  time_t       checked;            /* Time of the last stat() */
+  int          len;                /* File length */
+  uint16_t     refs;               /* Number of requests using the entry */
+  bool         stale;              /* Removed from the cache, free on release */
+  char         etag[HTTPD_CACHE_ETAGLEN];
+  char         name[1];            /* File name (variable length) */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The LRU list.  The most recently used entry is at the head. */
+
+static FAR struct httpd_cache_s *g_cache_head;
+static FAR struct httpd_cache_s *g_cache_tail;
+static size_t g_cache_size;
+
+/* Requests may be served concurrently from several threads */
+
+static sem_t g_cache_sem = SEM_INITIALIZER(1);
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void httpd_cache_lock(void)
+{
+  while (sem_wait(&g_cache_sem) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+}
+
+static inline void httpd_cache_unlock(void)
+{
+  sem_post(&g_cache_sem);
+}
+
+static time_t httpd_cache_now(void)
+{
+  struct timespec ts;
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+  (void)clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+  return ts.tv_sec;
+}
+
+static size_t httpd_cache_cost(FAR struct httpd_cache_s *entry)
+{
+  return sizeof(struct httpd_cache_s) + strlen(entry->name) + entry->len;
+}
+
+static void httpd_cache_unlink(FAR struct httpd_cache_s *entry)
+{
+  if (entry->blink != NULL)
+    {
+      entry->blink->flink = entry->flink;
+    }
+  else
+    {
+      g_cache_head = entry->flink;
+    }
+
+  if (entry->flink != NULL)
+    {
+      entry->flink->blink = entry->blink;
+    }
+  else
+    {
+      g_cache_tail = entry->blink;
+    }
+
+  entry->flink = NULL;
+  entry->blink = NULL;
+}
+
+static void httpd_cache_addhead(FAR struct httpd_cache_s *entry)
+{
+  entry->blink = NULL;
+  entry->flink = g_cache_head;
+  if (g_cache_head != NULL)
+    {
+      g_cache_head->blink = entry;
+    }
+  else
+    {
+      g_cache_tail = entry;
+    }
+
+  g_cache_head = entry;
+}
+
+/* Remove an entry from the cache.  It is freed now or, if a request is
+ * still sending it, when that request closes the file.
+ */
+
+static void httpd_cache_remove(FAR struct httpd_cache_s *entry)
+{
+  httpd_cache_unlink(entry);
+  g_cache_size -= httpd_cache_cost(entry);
+
+  if (entry->refs > 0)
+    {
+      entry->stale = true;
+    }
+  else
+    {
+      free(entry);
+    }
+}
+
+static FAR struct httpd_cache_s *httpd_cache_find(FAR const char *name)
+{
+  FAR struct httpd_cache_s *entry;
+
+  for (entry = g_cache_head; entry != NULL; entry = entry->flink)
+    {
+      if (strcmp(entry->name, name) == 0)
+        {
+          return entry;
+        }
+    }
+
+  return NULL;
+}
+
+static int httpd_cache_path(FAR const char *name, FAR char *path,
+                            size_t size)
+{
+  if (size < snprintf(path, size, "%s%s",
+      CONFIG_NETUTILS_HTTPD_PATH, name))
+    {
+      errno = ENAMETOOLONG;
+      return ERROR;
+    }
+
+  return OK;
+}
+
+/* Read a file into a new cache entry */
+
+static FAR struct httpd_cache_s *httpd_cache_load(FAR const char *name,
+                                                  FAR const char *path,
+                                                  FAR struct stat *st)
+{
+  FAR struct httpd_cache_s *entry;
+  size_t namelen;
+  ssize_t nread;
+  int offset;
+  int fd;
+
+  namelen = strlen(name);
+  entry   = (FAR struct httpd_cache_s *)
+    malloc(sizeof(struct httpd_cache_s) + namelen + st->st_size);
+  if (entry == NULL)
+    {
+      errno = ENOMEM;
+      return NULL;
+    }
+
+  memset(entry, 0, sizeof(struct httpd_cache_s));
+  strcpy(entry->name, name);
+
+  entry->data    = &entry->name[namelen + 1];
+  entry->len     = (int)st->st_size;
+  entry->mtime   = st->st_mtime;
+  entry->checked = httpd_cache_now();
+  entry->mime    = httpd_mimetype(name);
+
+  (void)snprintf(entry->etag, HTTPD_CACHE_ETAGLEN, "\"%lx-%x\"",
+                 (unsigned long)entry->mtime, entry->len);
+
+  fd = open(path, O_RDONLY);
+  if (fd < 0)
+    {
+      goto errout_with_entry;
+    }
+
+  for (offset = 0; offset < entry->len; offset += nread)
+    {
+      nread = read(fd, entry->data + offset, entry->len - offset);
+      if (nread <= 0)
+        {
+          if (nread < 0 && errno == EINTR)
+            {
+              nread = 0;
+              continue;
+            }
+
+          /* The file changed size underneath us */
+
+          (void)close(fd);
+          errno = EIO;
+          goto errout_with_entry;
+        }
+    }
+
+  (void)close(fd);
+  return entry;
+
+errout_with_entry:
+  free(entry);
+  return NULL;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: httpd_cache_open
+ *
+ * Description:
+ *   Look up a file in the cache, loading it if it is small enough.  On
+ *   success, file->data and file->len describe the cached content and the
+ *   file must be released with httpd_cache_close().  On failure, the
+ *   caller should fall back to its usual way of opening the file.
+ *
+ ****************************************************************************/
+
+int httpd_cache_open(FAR const char *name, FAR struct httpd_fs_file *file)
+{
+  FAR struct httpd_cache_s *entry;
+  FAR struct httpd_cache_s *dup;
+  char path[PATH_MAX];
+  struct stat st;
+  time_t now;
+
+  if (httpd_cache_path(name, path, sizeof path) < 0)
+    {
+      return ERROR;
+    }
+
+  now = httpd_cache_now();
+  httpd_cache_lock();
+
+  entry = httpd_cache_find(name);
+  if (entry != NULL &&
+      now - entry->checked >= CONFIG_NETUTILS_HTTPD_CACHE_REVALIDATE)
+    {
+      /* Check that the file has not changed since it was cached */
+
+      if (stat(path, &st) < 0 || !S_ISREG(st.st_mode) ||
+          st.st_mtime != entry->mtime || st.st_size != entry->len)
+        {
+          ninfo("Invalidate %s\n", name);
+          httpd_cache_remove(entry);
+          entry = NULL;
+        }
+      else
+        {
+          entry->checked = now;
+        }
+    }
+
+  if (entry != NULL)
+    {
+      /* Cache hit.  Move the entry to the head of the LRU list. */
+
+      httpd_cache_unlink(entry);
+      httpd_cache_addhead(entry);
+      goto found;
+    }
+
+  httpd_cache_unlock();
+
+  /* Cache miss.  Only regular files within the size limit are cached.  A
+   * file whose entry would not fit even in an empty cache is not cached
+   * either; it would only evict every other entry.
+   */
+
+  if (stat(path, &st) < 0)
+    {
+      return ERROR;
+    }
+
+  if (!S_ISREG(st.st_mode) || st.st_size == 0 ||
+      st.st_size > CONFIG_NETUTILS_HTTPD_CACHE_MAXFILE ||
+      sizeof(struct httpd_cache_s) + strlen(name) + (size_t)st.st_size >
+      CONFIG_NETUTILS_HTTPD_CACHE_SIZE)
+    {
+      errno = ENOENT;
+      return ERROR;
+    }
+
+  entry = httpd_cache_load(name, path, &st);
+  if (entry == NULL)
+    {
+      return ERROR;
+    }
+
+  httpd_cache_lock();
+
+  /* Another thread may have loaded the same file in the meantime */
+
+  dup = httpd_cache_find(name);
+  if (dup != NULL)
+    {
+      httpd_cache_remove(dup);
+    }
+
+  /* Evict the least recently used entries until the new one fits */
+
+  while (g_cache_tail != NULL &&
+         g_cache_size + httpd_cache_cost(entry) >
+         CONFIG_NETUTILS_HTTPD_CACHE_SIZE)
+    {
+      ninfo("Evict %s\n", g_cache_tail->name);
+      httpd_cache_remove(g_cache_tail);
+    }
+
+  httpd_cache_addhead(entry);
+  g_cache_size += httpd_cache_cost(entry);
+
+found:
+  entry->refs++;
+  file->data  = entry->data;
+  file->len   = entry->len;
+  file->cache = entry;
+  httpd_cache_unlock();
+  return OK;
+}
+
+/****************************************************************************
+ * Name: httpd_cache_close
+ *
+ * Description:
+ *   Release a file obtained from httpd_cache_open().
+ *
+ ****************************************************************************/
+
+int httpd_cache_close(FAR struct httpd_fs_file *file)
+{
+  FAR struct httpd_cache_s *entry = file->cache;
+
+  httpd_cache_lock();
+
+  DEBUGASSERT(entry != NULL && entry->refs > 0);
+  if (--entry->refs == 0 && entry->stale)
+    {
+      free(entry);
+    }
+
+  file->cache = NULL;
+  httpd_cache_unlock();
+  return OK;
+}
+
+/****************************************************************************
+ * Name: httpd_cache_mimetype and httpd_cache_etag
+ *
+ * Description:
+ *   Return the header values precomputed for a cached file.
+ *
+ ****************************************************************************/
+
+FAR const char *httpd_cache_mimetype(FAR struct httpd_fs_file *file)
+{
+  return ((FAR struct httpd_cache_s *)file->cache)->mime;
+}
+
+FAR const char *httpd_cache_etag(FAR struct httpd_fs_file *file)
+{
+  return ((FAR struct httpd_cache_s *)file->cache)->etag;
+}
+
+#endif /* CONFIG_NETUTILS_HTTPD_CACHE */
@@ -0,0 +1,256 @@
+/****************************************************************************
+ * netutils/webserver/httpd_stats.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Header Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include <semaphore.h>
+#include <errno.h>
+#include <debug.h>
+
+#include "netutils/httpd.h"
+
+#include "httpd.h"
+
+#ifdef CONFIG_NETUTILS_HTTPD_STATS
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Response times are sorted into buckets that grow by a factor of four:
+ * <1, <4, <16, <64, <256, <1024, <4096 and >=4096 milliseconds.
+ */
+
+#define HTTPD_STATS_NBUCKETS 8
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct httpd_stats_s
+{
+  uint32_t accepted;                    /* Connections accepted */
+  uint32_t closed;                      /* Connections closed */
+  uint32_t nbytes;                      /* Bytes sent */
+  uint32_t msec[HTTPD_STATS_NPHASES];   /* Time in each phase */
+  uint32_t usec[HTTPD_STATS_NPHASES];   /* Remainder below one msec */
+  uint32_t hist[HTTPD_STATS_NCLASSES][HTTPD_STATS_NBUCKETS];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct httpd_stats_s g_stats;
+static sem_t g_stats_sem = SEM_INITIALIZER(1);
+
+static FAR const char * const g_classname[HTTPD_STATS_NCLASSES] =
+{
+  "static", "script", "error"
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void httpd_stats_lock(void)
+{
+  while (sem_wait(&g_stats_sem) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+}
+
+static inline void httpd_stats_unlock(void)
+{
+  sem_post(&g_stats_sem);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: httpd_stats_now
+ *
+ * Description:
+ *   Return a free running time stamp in microseconds.  Only differences
+ *   between two time stamps are meaningful.
+ *
+ ****************************************************************************/
+
+uint32_t httpd_stats_now(void)
+{
+  struct timespec ts;
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+  (void)clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+  return (uint32_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+void httpd_stats_accept(void)
+{
+  httpd_stats_lock();
+  g_stats.accepted++;
+  httpd_stats_unlock();
+}
+
+void httpd_stats_close(void)
+{
+  httpd_stats_lock();
+  g_stats.closed++;
+  httpd_stats_unlock();
+}
+
+/****************************************************************************
+ * Name: httpd_stats_response
+ *
+ * Description:
+ *   Count a response of class sclass that sent nbytes bytes and that took
+ *   'start' to 'end' to produce.
+ *
+ ****************************************************************************/
+
+void httpd_stats_response(int sclass, uint32_t nbytes, uint32_t start,
+                          uint32_t end)
+{
+  uint32_t msec = (end - start) / 1000;
+  int bucket;
+
+  for (bucket = 0; bucket < HTTPD_STATS_NBUCKETS - 1 && msec >= 1; bucket++)
+    {
+      msec >>= 2;
+    }
+
+  httpd_stats_lock();
+  g_stats.hist[sclass][bucket]++;
+  g_stats.nbytes += nbytes;
+  httpd_stats_unlock();
+}
+
+/****************************************************************************
+ * Name: httpd_stats_phase
+ *
+ * Description:
+ *   Add the time from 'start' to 'end' to one of the server phases.
+ *
+ ****************************************************************************/
+
+void httpd_stats_phase(int phase, uint32_t start, uint32_t end)
+{
+  httpd_stats_lock();
+  g_stats.usec[phase] += end - start;
+  g_stats.msec[phase] += g_stats.usec[phase] / 1000;
+  g_stats.usec[phase] %= 1000;
+  httpd_stats_unlock();
+}
+
+/****************************************************************************
+ * Name: httpd_stats_format
+ *
+ * Description:
+ *   Format the statistics as plain text.
+ *
+ * Returned Value:
+ *   The length of the report in 'buffer'.
+ *
+ ****************************************************************************/
+
+int httpd_stats_format(FAR char *buffer, size_t buflen)
+{
+  struct httpd_stats_s stats;
+  uint32_t total;
+  size_t len;
+  int i;
+  int j;
+
+  /* Report a consistent snapshot */
+
+  httpd_stats_lock();
+  stats = g_stats;
+  httpd_stats_unlock();
+
+  len = snprintf(buffer, buflen,
+                 "Connections accepted: %lu\n"
+                 "Connections active:   %lu\n"
+                 "Bytes sent:           %lu\n"
+                 "Wait time (msec):     %lu\n"
+                 "Handler time (msec):  %lu\n"
+                 "\n"
+                 "Response time (msec):\n"
+                 "class     total   <1   <4  <16  <64 <256  <1k  <4k  4k+\n",
+                 (unsigned long)stats.accepted,
+                 (unsigned long)(stats.accepted - stats.closed),
+                 (unsigned long)stats.nbytes,
+                 (unsigned long)stats.msec[HTTPD_STATS_WAIT],
+                 (unsigned long)stats.msec[HTTPD_STATS_HANDLE]);
+
+  for (i = 0; i < HTTPD_STATS_NCLASSES && len < buflen; i++)
+    {
+      total = 0;
+      for (j = 0; j < HTTPD_STATS_NBUCKETS; j++)
+        {
+          total += stats.hist[i][j];
+        }
+
+      len += snprintf(&buffer[len], buflen - len, "%-6s %8lu",
+                      g_classname[i], (unsigned long)total);
+
+      for (j = 0; j < HTTPD_STATS_NBUCKETS && len < buflen; j++)
+        {
+          len += snprintf(&buffer[len], buflen - len, " %4lu",
+                          (unsigned long)stats.hist[i][j]);
+        }
+
+      if (len < buflen)
+        {
+          len += snprintf(&buffer[len], buflen - len, "\n");
+        }
+    }
+
+  return len < buflen ? len : buflen - 1;
+}
+
+#endif /* CONFIG_NETUTILS_HTTPD_STATS */
@@ -51,7 +51,9 @@
  * Included Files
  ****************************************************************************/
 
+#include <sys/types.h>
 #include <ctype.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -62,17 +64,57 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
-#define TAG        0
-#define VALUE      1
-#define DONE       2
+#ifndef CONFIG_XMLRPC_HASHSIZE
+#  define CONFIG_XMLRPC_HASHSIZE 16
+#endif
+
+/* Element types */
+
+#define NONE       0
+#define TAG        1
+#define VALUE      2
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Where the parser is in the methodCall document.  Each state names the
+ * element expected next.
+ */
+
+enum xmlrpc_pstate_e
+{
+  XMLRPC_P_XML = 0,         /* <?xml ...> */
+  XMLRPC_P_METHODCALL,      /* <methodCall> */
+  XMLRPC_P_METHODNAME,      /* <methodName> */
+  XMLRPC_P_NAME,            /* method name value */
+  XMLRPC_P_NAMEEND,         /* </methodName> */
+  XMLRPC_P_PARAMS,          /* <params> */
+  XMLRPC_P_PARAM,           /* <param> or </params> */
+  XMLRPC_P_VALUE,           /* <value> */
+  XMLRPC_P_TYPE,            /* <i4>, <int>, <boolean>, <double> or <string> */
+  XMLRPC_P_DATA,            /* argument value */
+  XMLRPC_P_TYPEEND,         /* </type> */
+  XMLRPC_P_VALUEEND,        /* </value> */
+  XMLRPC_P_PARAMEND,        /* </param> */
+  XMLRPC_P_CALLEND,         /* </methodCall> */
+  XMLRPC_P_DONE,            /* Complete request */
+  XMLRPC_P_ERROR            /* Parse error, the rest is ignored */
+};
 
 /****************************************************************************
  * Private Data
  ****************************************************************************/
 
 static struct xmlrpc_s g_xmlcall;
+static struct xmlrpc_entry_s *g_entries[CONFIG_XMLRPC_HASHSIZE];
+
+/* Tokenizer state: the element being received and the parser state */
+
 static char g_data[CONFIG_XMLRPC_STRINGSIZE+1];
-static struct xmlrpc_entry_s *g_entries = NULL;
+static int  g_datalen;
+static int  g_type;
+static enum xmlrpc_pstate_e g_state;
 
 static const char *errorStrings[] =
 {
@@ -88,21 +130,29 @@ static const char *errorStrings[] =
 
 #define MAX_ERROR_CODE  (sizeof(errorStrings)/sizeof(char *))
 
-struct parsebuf_s
-{
-  char *buf;
-  int len;
-  int index;
-};
-
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+static unsigned int xmlrpc_hash(const char *name)
+{
+  uint32_t hash = 2166136261u;
+
+  /* FNV-1a */
+
+  while (*name != '\0')
+    {
+      hash ^= (unsigned char)*name++;
+      hash *= 16777619u;
+    }
+
+  return hash % CONFIG_XMLRPC_HASHSIZE;
+}
+
 static int xmlrpc_call(struct xmlrpc_s * call)
 {
   int ret = XMLRPC_NO_SUCH_FUNCTION;
-  struct xmlrpc_entry_s *entry = g_entries;
+  struct xmlrpc_entry_s *entry = g_entries[xmlrpc_hash(call->name)];
 
   while (entry != NULL)
     {
@@ -120,274 +170,267 @@ static int xmlrpc_call(struct xmlrpc_s * call)
   return ret;
 }
 
-static int xmlrpc_getelement(struct parsebuf_s * pbuf, char *data, int dataSize)
+/* Is the current element the tag 'tag'?  Only the start of the element is
+ * compared so that attributes are accepted.
+ */
+
+static inline int xmlrpc_istag(const char *tag)
 {
-  int j = 0;
-  int ret = XMLRPC_NO_ERROR;
+  return g_type == TAG && strncmp(g_data, tag, strlen(tag)) == 0;
+}
 
-  while (pbuf->index < pbuf->len && !isprint(pbuf->buf[pbuf->index]))
-    {
-      pbuf->index++;
-    }
+/* Handle one complete element in g_data according to the parser state */
 
-  if (pbuf->index >= pbuf->len)
-    {
-      return DONE;
-    }
+static enum xmlrpc_pstate_e xmlrpc_element(void)
+{
+  struct xmlrpc_arg_s *arg = &g_xmlcall.arguments[g_xmlcall.argsize];
 
-  if (pbuf->buf[pbuf->index] == '<')
-    {
-      ret = TAG;
-    }
-  else
+  switch (g_state)
     {
-      ret = VALUE;
-    }
+    case XMLRPC_P_XML:
+      return xmlrpc_istag("<?xml") ? XMLRPC_P_METHODCALL : XMLRPC_P_ERROR;
 
-  data[j++] = pbuf->buf[pbuf->index++];
+    case XMLRPC_P_METHODCALL:
+      return xmlrpc_istag("<methodCall>") ?
+             XMLRPC_P_METHODNAME : XMLRPC_P_ERROR;
 
-  while (j < dataSize)
-    {
-      if (pbuf->buf[pbuf->index] == '>')
+    case XMLRPC_P_METHODNAME:
+      return xmlrpc_istag("<methodName>") ? XMLRPC_P_NAME : XMLRPC_P_ERROR;
+
+    case XMLRPC_P_NAME:
+      if (g_type != VALUE)
         {
-          data[j++] = pbuf->buf[pbuf->index++];
-          break;
+          return XMLRPC_P_ERROR;
         }
-      else if ((pbuf->buf[pbuf->index] == '\n') ||
-               (pbuf->buf[pbuf->index] == '<'))
+
+      /* Save the method name */
+
+      strcpy(g_xmlcall.name, g_data);
+      return XMLRPC_P_NAMEEND;
+
+    case XMLRPC_P_NAMEEND:
+      return xmlrpc_istag("</methodName>") ? XMLRPC_P_PARAMS : XMLRPC_P_ERROR;
+
+    case XMLRPC_P_PARAMS:
+      return xmlrpc_istag("<params>") ? XMLRPC_P_PARAM : XMLRPC_P_ERROR;
+
+    case XMLRPC_P_PARAM:
+      if (xmlrpc_istag("</params>"))
         {
-          break;
+          return XMLRPC_P_CALLEND;
         }
-      else
+
+      if (!xmlrpc_istag("<param>") || g_xmlcall.argsize >= MAX_ARGS)
         {
-          data[j++] = pbuf->buf[pbuf->index++];
-          if (j >= dataSize)
-            {
-              ret = XMLRPC_PARSE_ERROR;
-            }
+          return XMLRPC_P_ERROR;
         }
-    }
 
-  data[j] = 0;
-  return ret;
-}
+      return XMLRPC_P_VALUE;
 
-static int xmlrpc_parseparam(struct parsebuf_s * pbuf)
-{
-  int type;
+    case XMLRPC_P_VALUE:
+      return xmlrpc_istag("<value>") ? XMLRPC_P_TYPE : XMLRPC_P_ERROR;
 
-  /* Next, we need a <value> tag */
+    case XMLRPC_P_TYPE:
 
-  type = xmlrpc_getelement(pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-  if (!((type == TAG) && (!strncmp(g_data, "<value>", 7))))
-    {
-      return XMLRPC_PARSE_ERROR;
-    }
+      /* The variable tag, the type of the value */
 
-  /* Now we get a variable tag, the type of the value */
+      if (xmlrpc_istag("<i4>") || xmlrpc_istag("<int>"))
+        {
+          g_xmlcall.args[g_xmlcall.argsize] = 'i';
+        }
+      else if (xmlrpc_istag("<boolean>"))
+        {
+          g_xmlcall.args[g_xmlcall.argsize] = 'b';
+        }
+      else if (xmlrpc_istag("<double>"))
+        {
+          g_xmlcall.args[g_xmlcall.argsize] = 'd';
+        }
+      else if (xmlrpc_istag("<string>"))
+        {
+          g_xmlcall.args[g_xmlcall.argsize] = 's';
+        }
+      else
+        {
+          return XMLRPC_P_ERROR;
+        }
 
-  type = xmlrpc_getelement(pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-  if (type != TAG)
-    {
-      return XMLRPC_PARSE_ERROR;
-    }
+      return XMLRPC_P_DATA;
 
-  if (!strncmp(g_data, "<i4>", 4))
-    {
-      g_xmlcall.args[g_xmlcall.argsize] = 'i';
-    }
-  else if (!strncmp(g_data, "<int>", 5))
-    {
-      g_xmlcall.args[g_xmlcall.argsize] = 'i';
-    }
-  else if (!strncmp(g_data, "<boolean>", 9))
-    {
-      g_xmlcall.args[g_xmlcall.argsize] = 'b';
-    }
-  else if (!strncmp(g_data, "<double>", 8))
-    {
-      g_xmlcall.args[g_xmlcall.argsize] = 'd';
-    }
-  else if (!strncmp(g_data, "<string>", 8))
-    {
-      g_xmlcall.args[g_xmlcall.argsize] = 's';
-    }
-  else
-    {
-      return XMLRPC_PARSE_ERROR;
-    }
+    case XMLRPC_P_DATA:
+      if (g_type != VALUE)
+        {
+          return XMLRPC_P_ERROR;
+        }
 
-  /* Now, parse the actual value */
+      switch (g_xmlcall.args[g_xmlcall.argsize])
+        {
+        case 'i':
+        case 'b':
+          arg->u.i = atoi(g_data);
+          break;
 
-  type = xmlrpc_getelement(pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-  if (type != VALUE)
-    {
-      return XMLRPC_PARSE_ERROR;
-    }
+        case 'd':
+          arg->u.d = atof(g_data);
+          break;
 
-  switch (g_xmlcall.args[g_xmlcall.argsize])
-    {
-    case 'i':
-    case 'b':
-      g_xmlcall.arguments[g_xmlcall.argsize].u.i = atoi(g_data);
-      break;
+        case 's':
+          strcpy(arg->u.string, g_data);
+          break;
 
-    case 'd':
-      g_xmlcall.arguments[g_xmlcall.argsize].u.d = atof(g_data);
-      break;
+        default:
+          return XMLRPC_P_ERROR;
+        }
 
-    case 's':
-      strcpy(g_xmlcall.arguments[g_xmlcall.argsize].u.string, g_data);
-      break;
+      g_xmlcall.argsize++;
+      return XMLRPC_P_TYPEEND;
 
-    default:
-      return XMLRPC_PARSE_ERROR;
-    }
+    case XMLRPC_P_TYPEEND:
+      return xmlrpc_istag("</") ? XMLRPC_P_VALUEEND : XMLRPC_P_ERROR;
 
-  g_xmlcall.argsize++;
+    case XMLRPC_P_VALUEEND:
+      return xmlrpc_istag("</value>") ? XMLRPC_P_PARAMEND : XMLRPC_P_ERROR;
 
-  /* Now we close out the tag, starting with the type */
+    case XMLRPC_P_PARAMEND:
+      return xmlrpc_istag("</param>") ? XMLRPC_P_PARAM : XMLRPC_P_ERROR;
 
-  type = xmlrpc_getelement(pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-  if (!((type == TAG) && (!strncmp(g_data, "</", 2))))
-    {
-      return XMLRPC_PARSE_ERROR;
-    }
+    case XMLRPC_P_CALLEND:
+      return xmlrpc_istag("</methodCall>") ? XMLRPC_P_DONE : XMLRPC_P_ERROR;
 
-  /* Next, look for the </value> close */
+    case XMLRPC_P_DONE:
 
-  type = xmlrpc_getelement(pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-  if (!((type == TAG) && (!strncmp(g_data, "</value>", 8))))
-    {
-      return XMLRPC_PARSE_ERROR;
-    }
+      /* Whatever follows the request is ignored */
 
-  /* Finally, close out the </param> tag */
+      return XMLRPC_P_DONE;
 
-  type = xmlrpc_getelement(pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-  if (!((type == TAG) && (!strncmp(g_data, "</param>", 8))))
-    {
-      return XMLRPC_PARSE_ERROR;
+    default:
+      return XMLRPC_P_ERROR;
     }
-
-  return XMLRPC_NO_ERROR;
 }
 
-static int xmlrpc_parseparams(struct parsebuf_s * pbuf)
-{
-  int type, ret = XMLRPC_PARSE_ERROR;
+/* Terminate the element being received and pass it to the parser */
 
-  /* First, look for the params tag */
+static void xmlrpc_endelement(void)
+{
+  g_data[g_datalen] = '\0';
+  g_state = xmlrpc_element();
+  g_type = NONE;
+  g_datalen = 0;
+}
 
-  type = xmlrpc_getelement(pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-  if ((type == TAG) && (!strncmp(g_data, "<params>", 8)))
+static void xmlrpc_sendfault(int fault)
+{
+  fault = -fault;
+  if (fault >= MAX_ERROR_CODE)
     {
-      while (1)
-        {
-          /* Get next tag */
-
-          type = xmlrpc_getelement(pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-          if ((type == TAG) && (!strncmp(g_data, "<param>", 7)))
-            {
-              ret = xmlrpc_parseparam(pbuf);
-            }
-          else if ((type == TAG) && (!strncmp(g_data, "</params>", 9)))
-            {
-              return XMLRPC_NO_ERROR;
-            }
-          else
-            {
-              return XMLRPC_PARSE_ERROR;
-            }
-        }
+      fault = 0;
     }
 
-  return ret;
+  xmlrpc_buildresponse(&g_xmlcall, "{is}",
+                        "faultCode", fault, "faultString", errorStrings[fault]);
 }
 
-static int xmlrpc_parsemethod(struct parsebuf_s * pbuf)
-{
-  int type, ret = XMLRPC_PARSE_ERROR;
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
 
+/****************************************************************************
+ * Name: xmlrpc_parse_begin
+ *
+ * Description:
+ *   Prepare to receive a new request with xmlrpc_parse_push().
+ *
+ ****************************************************************************/
+
+void xmlrpc_parse_begin(void)
+{
   memset((void *)&g_xmlcall, 0, sizeof(struct xmlrpc_s));
+  g_datalen = 0;
+  g_type = NONE;
+  g_state = XMLRPC_P_XML;
+}
 
-  /* Look for the methodName tag */
+/****************************************************************************
+ * Name: xmlrpc_parse_push
+ *
+ * Description:
+ *   Parse the next part of the request body, as it is received.  Only the
+ *   element being received is kept, so the body may be of any size.
+ *
+ * Returned Value:
+ *   XMLRPC_NO_ERROR if the request is valid so far, XMLRPC_PARSE_ERROR
+ *   otherwise.
+ *
+ ****************************************************************************/
 
-  type = xmlrpc_getelement(pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-  if ((type == TAG) && (!strncmp(g_data, "<methodName>", 12)))
+int xmlrpc_parse_push(const char *buffer, size_t len)
+{
+  size_t i;
+  char c;
+
+  for (i = 0; i < len && g_state != XMLRPC_P_ERROR; i++)
     {
-      /* Get the method name for the call */
+      c = buffer[i];
 
-      type = xmlrpc_getelement(pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-      if (type == VALUE)
-        {
-          /* Save the method name */
+      /* An element ends after '>', or before '<' or a line feed */
 
-          strcpy(g_xmlcall.name, g_data);
+      if (g_type != NONE && (c == '<' || c == '\n'))
+        {
+          xmlrpc_endelement();
+        }
 
-          /* Find the closing /methodCall */
+      if (g_type == NONE)
+        {
+          /* Skip what is not printable between elements */
 
-          type = xmlrpc_getelement(pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-          if ((type == TAG) && (!strncmp(g_data, "</methodName>", 13)))
+          if (!isprint((unsigned char)c))
             {
-              /* Now, it's time to parse the parameters */
-
-              ret = xmlrpc_parseparams(pbuf);
+              continue;
             }
+
+          g_type = (c == '<') ? TAG : VALUE;
         }
-    }
 
-  return ret;
-}
+      if (g_datalen >= CONFIG_XMLRPC_STRINGSIZE)
+        {
+          g_state = XMLRPC_P_ERROR;
+          break;
+        }
 
-static void xmlrpc_sendfault(int fault)
-{
-  fault = -fault;
-  if (fault >= MAX_ERROR_CODE)
-    {
-      fault = 0;
+      g_data[g_datalen++] = c;
+
+      if (c == '>')
+        {
+          xmlrpc_endelement();
+        }
     }
 
-  xmlrpc_buildresponse(&g_xmlcall, "{is}",
-                        "faultCode", fault, "faultString", errorStrings[fault]);
+  return g_state == XMLRPC_P_ERROR ? XMLRPC_PARSE_ERROR : XMLRPC_NO_ERROR;
 }
 
 /****************************************************************************
- * Public Functions
+ * Name: xmlrpc_parse_end
+ *
+ * Description:
+ *   Complete the request pushed with xmlrpc_parse_push(), call its handler
+ *   and write the response or the fault to sock.
+ *
  ****************************************************************************/
 
-int xmlrpc_parse(int sock, char *buffer)
+int xmlrpc_parse_end(int sock)
 {
-  struct parsebuf_s pbuf;
-  int type;
   int ret = XMLRPC_PARSE_ERROR;
 
-  pbuf.buf = buffer;
-  pbuf.len = strlen(buffer);
-  pbuf.index = 0;
-
-  /* Parse the xml header tag */
-
-  type = xmlrpc_getelement(&pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-  if ((type == TAG) && (!strncmp(g_data, "<?xml", 5)))
+  if (g_type != NONE && g_state != XMLRPC_P_ERROR)
     {
-      type = xmlrpc_getelement(&pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-      if ((type == TAG) && (!strncmp(g_data, "<methodCall>", 12)))
-        {
-          /* Parse the remaining tags within the methodCall tag */
-
-          xmlrpc_parsemethod(&pbuf);
-
-          /* Check for the closing /methodCall */
+      xmlrpc_endelement();
+    }
 
-          type = xmlrpc_getelement(&pbuf, g_data, CONFIG_XMLRPC_STRINGSIZE);
-          if ((type == TAG) && (!strncmp(g_data, "</methodCall>", 13)))
-            {
-              /* Successful parse, try to call a user function */
+  if (g_state == XMLRPC_P_DONE)
+    {
+      /* Successful parse, try to call a user function */
 
-              ret = xmlrpc_call(&g_xmlcall);
-            }
-        }
+      ret = xmlrpc_call(&g_xmlcall);
     }
 
   if (ret == 0)
@@ -406,16 +449,17 @@ int xmlrpc_parse(int sock, char *buffer)
   return ret;
 }
 
+int xmlrpc_parse(int sock, char *buffer)
+{
+  xmlrpc_parse_begin();
+  xmlrpc_parse_push(buffer, strlen(buffer));
+  return xmlrpc_parse_end(sock);
+}
+
 void xmlrpc_register(struct xmlrpc_entry_s *entry)
 {
-  if (g_entries == NULL)
-    {
-      g_entries = entry;
-      entry->next = NULL;
-    }
-  else
-    {
-      entry->next = g_entries;
-      g_entries = entry;
-    }
+  unsigned int bucket = xmlrpc_hash(entry->name);
+
+  entry->next = g_entries[bucket];
+  g_entries[bucket] = entry;
 }
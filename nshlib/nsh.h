@@ -547,6 +547,45 @@
 # define CONFIG_NSH_NESTDEPTH 3
 #endif
 
+/* Command pipelines run the writer of each stage in background with its
+ * output redirected to a FIFO that becomes the input of the next stage.
+ */
+
+#if defined(CONFIG_NSH_PIPES) && (defined(CONFIG_NSH_DISABLEBG) || \
+    CONFIG_NFILE_STREAMS <= 0 || defined(NSH_DISABLE_SEMICOLON))
+#  undef CONFIG_NSH_PIPES
+#endif
+
+#if defined(CONFIG_NSH_PIPES) && !defined(CONFIG_NSH_PIPES_PREFIX)
+#  define CONFIG_NSH_PIPES_PREFIX "/dev/nshpipe"
+#endif
+
+/* The most FIFO descriptors that NSH holds at once for one pipeline:  Up
+ * to two for each NSH command of the pipeline and one while a stage is
+ * started.
+ */
+
+#define NSH_PIPE_MAXFDS 8
+
+/* Expanded and concatenated arguments are built in a per-session arena */
+
+#if defined(CONFIG_NSH_CMDPARMS) || defined(CONFIG_NSH_ARGCAT)
+#  define NSH_HAVE_ARENA 1
+#  ifndef CONFIG_NSH_ARENASIZE
+#    define CONFIG_NSH_ARENASIZE 512
+#  endif
+#endif
+
+/* Scripts up to this size are read into memory before they are executed */
+
+#if defined(CONFIG_NSH_DISABLESCRIPT) || CONFIG_NFILE_STREAMS <= 0
+#  undef CONFIG_NSH_SCRIPT_PRELOAD
+#endif
+
+#if defined(CONFIG_NSH_SCRIPT_PRELOAD) && !defined(CONFIG_NSH_SCRIPT_PRELOAD_MAX)
+#  define CONFIG_NSH_SCRIPT_PRELOAD_MAX 4096
+#endif
+
 /* Define to enable dumping of all input/output buffers */
 
 #undef CONFIG_NSH_TELNETD_DUMPBUFFER
@@ -641,6 +680,27 @@
 #  undef NSH_HAVE_CPULOAD
 #endif
 
+/* The time command reports the CPU time used while the command ran only if
+ * it can read the CPU load counters of the idle task directly.
+ */
+
+#define NSH_HAVE_TIME_CPULOAD 1
+#if defined(CONFIG_NSH_DISABLE_TIME) || !defined(CONFIG_SCHED_CPULOAD) || \
+    defined(CONFIG_SMP) || defined(CONFIG_BUILD_PROTECTED) || \
+    defined(CONFIG_BUILD_KERNEL)
+#  undef NSH_HAVE_TIME_CPULOAD
+#endif
+
+/* 'top' reads the task list and the CPU load counters directly from the
+ * OS and so is only available in a flat build.
+ */
+
+#if !defined(CONFIG_SCHED_CPULOAD) || defined(CONFIG_DISABLE_SIGNALS) || \
+    defined(CONFIG_BUILD_PROTECTED) || defined(CONFIG_BUILD_KERNEL)
+#  undef  CONFIG_NSH_DISABLE_TOP
+#  define CONFIG_NSH_DISABLE_TOP 1
+#endif
+
 #if !defined(CONFIG_FS_PROCFS) || (defined(CONFIG_FS_PROCFS_EXCLUDE_BLOCKS) && \
                                    defined(CONFIG_FS_PROCFS_EXCLUDE_USAGE))
 #  undef  CONFIG_NSH_DISABLE_DF          /* 'df' depends on fs procfs */
@@ -707,9 +767,10 @@
 #  undef NSH_HAVE_READFILE
 #endif
 
-/* nsh_foreach_direntry used by the ls and ps commands */
+/* nsh_foreach_direntry used by the ls, ps, and cp commands */
 
-#if defined(CONFIG_NSH_DISABLE_LS) && defined(CONFIG_NSH_DISABLE_PS)
+#if defined(CONFIG_NSH_DISABLE_LS) && defined(CONFIG_NSH_DISABLE_PS) && \
+    defined(CONFIG_NSH_DISABLE_CP)
 #  undef NSH_HAVE_FOREACH_DIRENTRY
 #endif
 
@@ -728,6 +789,18 @@
 #  define NSH_NP_SET_OPTIONS_INIT    (NSH_PFLAG_SILENT)
 #endif
 
+/* True if commands are being taken from a script, either from the script
+ * file or from its preloaded image.
+ */
+
+#ifndef CONFIG_NSH_DISABLESCRIPT
+#  ifdef CONFIG_NSH_SCRIPT_PRELOAD
+#    define nsh_inscript(np) ((np)->np_stream != NULL || (np)->np_image != NULL)
+#  else
+#    define nsh_inscript(np) ((np)->np_stream != NULL)
+#  endif
+#endif
+
 #if defined(CONFIG_DISABLE_ENVIRON) && defined(CONFIG_NSH_DISABLESCRIPT)
 #  undef  CONFIG_NSH_DISABLE_SET
 #  define CONFIG_NSH_DISABLE_SET 1
@@ -800,6 +873,34 @@ enum nsh_npflags_e
 };
 #endif
 
+#ifdef NSH_HAVE_ARENA
+/* The header of an argument string that did not fit in the arena.  The
+ * string follows it in the same heap allocation.
+ */
+
+struct nsh_arenablk_s
+{
+  FAR struct nsh_arenablk_s *ab_flink;    /* Next older block */
+};
+#endif
+
+#ifdef CONFIG_NSH_PIPES
+/* The FIFO descriptors that NSH itself holds for one pipeline:  The read
+ * end of the FIFO whose writer is being started, and the write ends and
+ * the standard inputs of the NSH commands of the pipeline that run in
+ * background.  The tasks started for the pipeline must not inherit them.
+ * The record is shared by the shell and those commands.  Each removes its
+ * descriptors before it closes them, so that a number that is reused is
+ * never closed by mistake.
+ */
+
+struct nsh_pipefds_s
+{
+  uint8_t  pf_refs;                 /* Number of parsers using the record */
+  int      pf_fd[NSH_PIPE_MAXFDS];  /* The descriptors, -1 if unused */
+};
+#endif
+
 /* These structure provides the overall state of the parser */
 
 struct nsh_parser_s
@@ -817,9 +918,24 @@ struct nsh_parser_s
 #ifndef CONFIG_NSH_DISABLEBG
   int      np_nice;     /* "nice" value applied to last background cmd */
 #endif
+#ifdef CONFIG_NSH_PIPES
+  FAR const char *np_pipeout; /* FIFO that receives the output of the next
+                               * command (which then runs in background) */
+  FAR struct nsh_pipefds_s *np_pipefds; /* Descriptors of the pipeline,
+                                         * or NULL */
+  int      np_pipein;   /* Background NSH command: Its own copy of the read
+                         * end that is its standard input, or -1 */
+  bool     np_inpipe;   /* true: Part of a pipeline, so the standard input
+                         * of NSH may be a FIFO */
+#endif
 
 #ifndef CONFIG_NSH_DISABLESCRIPT
   FILE    *np_stream;   /* Stream of current script */
+#ifdef CONFIG_NSH_SCRIPT_PRELOAD
+  FAR char *np_image;   /* In-memory image of the current script */
+  size_t   np_imglen;   /* Size of the script image in bytes */
+  size_t   np_imgpos;   /* Read position in the script image */
+#endif
 #ifndef CONFIG_NSH_DISABLE_LOOPS
   long     np_foffs;    /* File offset to the beginning of a line */
 #ifndef NSH_DISABLE_SEMICOLON
@@ -841,6 +957,17 @@ struct nsh_parser_s
   struct nsh_loop_s np_lpstate[CONFIG_NSH_NESTDEPTH];
 #endif
 #endif
+
+#ifdef NSH_HAVE_ARENA
+  /* Storage for the expanded arguments of the commands being parsed.
+   * Arguments that do not fit are kept in a list of heap blocks.
+   */
+
+  FAR struct nsh_arenablk_s *np_arenaheap; /* Newest heap block */
+  uint16_t np_arenanheap;                  /* Number of heap blocks */
+  uint16_t np_arenaused;                   /* Bytes in use in np_arena[] */
+  char     np_arena[CONFIG_NSH_ARENASIZE];
+#endif
 };
 
 /* This is the general form of a command handler */
@@ -939,6 +1066,10 @@ int nsh_loginscript(FAR struct nsh_vtbl_s *vtbl);
 struct console_stdio_s;
 int nsh_session(FAR struct console_stdio_s *pstate);
 int nsh_parse(FAR struct nsh_vtbl_s *vtbl, char *cmdline);
+int nsh_execargv(FAR struct nsh_vtbl_s *vtbl, int argc, FAR char *argv[]);
+#ifdef CONFIG_NSH_PIPES
+int nsh_pipefds(FAR struct nsh_vtbl_s *vtbl, FAR int *fds);
+#endif
 
 /****************************************************************************
  * Name: nsh_login
@@ -1036,9 +1167,15 @@ void nsh_usbtrace(void);
 #ifndef CONFIG_NSH_DISABLE_TIME
   int cmd_time(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv);
 #endif
+#ifdef CONFIG_NSH_STARTUP
+  int cmd_startup(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv);
+#endif
 #ifndef CONFIG_NSH_DISABLE_PS
   int cmd_ps(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv);
 #endif
+#ifndef CONFIG_NSH_DISABLE_TOP
+  int cmd_top(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv);
+#endif
 #ifndef CONFIG_NSH_DISABLE_XD
   int cmd_xd(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv);
 #endif
@@ -1231,6 +1368,10 @@ int cmd_irqinfo(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv);
    int cmd_nslookup(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv);
 #endif
 
+#if defined(CONFIG_SYSTEM_PERFCOUNT) && !defined(CONFIG_NSH_DISABLE_PERF)
+   int cmd_perf(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv);
+#endif
+
 #if defined(CONFIG_BOARDCTL_POWEROFF) && !defined(CONFIG_NSH_DISABLE_POWEROFF)
    int cmd_poweroff(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv);
 #endif
@@ -1294,27 +1435,28 @@ int cmd_irqinfo(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv);
 #endif
 
 /****************************************************************************
- * Name: nsh_extmatch_count
+ * Name: nsh_extmatch_next
  *
  * Description:
  *   This support function is used to provide support for realine tab-
- *   completion logic  nsh_extmatch_count() counts the number of matching
- *   nsh command names
+ *   completion logic  nsh_extmatch_next() returns the index of the next
+ *   nsh command name that matches.
  *
  * Input Parameters:
  *   name    - A point to the name containing the name to be matched.
- *   matches - A table is size CONFIG_READLINE_MAX_EXTCMDS that can
- *             be used to remember matching name indices.
  *   namelen - The lenght of the name to match
+ *   index   - Zero to find the first match; one more than the index of the
+ *             previous match to find the next one.
  *
  * Returned Values:
- *   The number commands that match to the first namelen characters.
+ *   The index of the next command that matches the first namelen
+ *   characters; -ENOENT if there are no more matches.
  *
  ****************************************************************************/
 
 #if defined(CONFIG_NSH_READLINE) && defined(CONFIG_READLINE_TABCOMPLETION) && \
     defined(CONFIG_READLINE_HAVE_EXTMATCH)
-int nsh_extmatch_count(FAR char *name, FAR int *matches, int namelen);
+int nsh_extmatch_next(FAR const char *name, int namelen, int index);
 #endif
 
 /****************************************************************************
@@ -1323,7 +1465,7 @@ int nsh_extmatch_count(FAR char *name, FAR int *matches, int namelen);
  * Description:
  *   This support function is used to provide support for realine tab-
  *   completion logic  nsh_extmatch_getname() will return the full command
- *   string from an index that was previously saved by nsh_exmatch_count().
+ *   string from an index that was previously returned by nsh_exmatch_next().
  *
  * Input Parameters:
  *   index - The index of the command name to be returned.
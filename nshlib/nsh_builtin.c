@@ -90,8 +90,37 @@
 int nsh_builtin(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd,
                 FAR char **argv, FAR const char *redirfile, int oflags)
 {
+#ifdef CONFIG_NSH_PIPES
+  int closefds[NSH_PIPE_MAXFDS];
+  int nclose;
+#endif
   int ret = OK;
 
+#if defined(CONFIG_BUILTIN_POOL) && defined(CONFIG_SCHED_WAITPID)
+  /* A foreground builtin without redirection that is selected for the pool
+   * runs on a warm worker task.  Anything the pool does not take is
+   * spawned below as usual.  So is every stage of a pipeline:  A worker
+   * reads the standard input that NSH had when the worker was started,
+   * not the FIFO that NSH has as its standard input now.
+   */
+
+  bool pooled = (redirfile == NULL);
+  int status;
+
+#  ifndef CONFIG_NSH_DISABLEBG
+  pooled = pooled && !vtbl->np.np_bg;
+#  endif
+#  ifdef CONFIG_NSH_PIPES
+  pooled = pooled && !vtbl->np.np_inpipe;
+#  endif
+
+  if (pooled &&
+      builtin_pool_exec(cmd, (FAR char * const *)argv, &status) == OK)
+    {
+      return (status == 0) ? OK : 1;
+    }
+#endif
+
   /* Lock the scheduler in an attempt to prevent the application from
    * running until waitpid() has been called.
    */
@@ -99,10 +128,18 @@ int nsh_builtin(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd,
   sched_lock();
 
   /* Try to find and execute the command within the list of builtin
-   * applications.
+   * applications.  In a pipeline, it must not inherit the FIFO ends that
+   * NSH holds, or the readers of those FIFOs would never see the end of
+   * file.
    */
 
+#ifdef CONFIG_NSH_PIPES
+  nclose = nsh_pipefds(vtbl, closefds);
+  ret    = exec_builtin_closefds(cmd, (FAR char * const *)argv, redirfile,
+                                 oflags, closefds, nclose);
+#else
   ret = exec_builtin(cmd, (FAR char * const *)argv, redirfile, oflags);
+#endif
   if (ret >= 0)
     {
       /* The application was successfully started with pre-emption disabled.
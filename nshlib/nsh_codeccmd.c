@@ -51,6 +51,7 @@
 #include <string.h>
 #include <sched.h>
 #include <fcntl.h>
+#include <time.h>
 #include <libgen.h>
 #include <errno.h>
 #include <debug.h>
@@ -83,7 +84,24 @@
  ****************************************************************************/
 
 #ifndef CONFIG_NSH_CODECS_BUFSIZE
-#  define CONFIG_NSH_CODECS_BUFSIZE    128
+#  define CONFIG_NSH_CODECS_BUFSIZE    2048
+#endif
+
+/* Files are read in whole multiples of the 64-byte MD5 block so that each
+ * buffer is hashed in place.  With the usual power-of-two sizes this is also
+ * a whole number of sectors of a block device.
+ */
+
+#if CONFIG_NSH_CODECS_BUFSIZE < 64
+#  define CODECS_BUFSIZE 64
+#else
+#  define CODECS_BUFSIZE (CONFIG_NSH_CODECS_BUFSIZE & ~63)
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define CODECS_CLOCK CLOCK_MONOTONIC
+#else
+#  define CODECS_CLOCK CLOCK_REALTIME
 #endif
 
 #undef NEED_CMD_CODECS_PROC
@@ -168,16 +186,20 @@ static void urldecode_cb(FAR char *src, int srclen, FAR char *dest,
 static void b64enc_cb(FAR char *src, int srclen, FAR char *dest,
                       FAR int *destlen, int mode)
 {
+  size_t len;
+
   if (mode == 0)
     {
       base64_encode((unsigned char *)src, srclen,
-                    (unsigned char *)dest, (size_t *)destlen);
+                    (unsigned char *)dest, &len);
     }
   else
     {
       base64w_encode((unsigned char *)src, srclen,
-                     (unsigned char *)dest, (size_t *)destlen);
+                     (unsigned char *)dest, &len);
     }
+
+  *destlen = len;
 }
 #endif
 
@@ -189,16 +211,20 @@ static void b64enc_cb(FAR char *src, int srclen, FAR char *dest,
 static void b64dec_cb(FAR char *src, int srclen, FAR char *dest,
                       FAR int *destlen, int mode)
 {
+  size_t len;
+
   if (mode == 0)
     {
       base64_decode((unsigned char *)src, srclen,
-                    (unsigned char *)dest, (size_t *)destlen);
+                    (unsigned char *)dest, &len);
     }
   else
     {
       base64w_decode((unsigned char *)src, srclen,
-                     (unsigned char *)dest,(size_t *)destlen);
+                     (unsigned char *)dest, &len);
     }
+
+  *destlen = len;
 }
 #endif
 
@@ -244,6 +270,201 @@ static int calc_codec_buffsize(int srclen, uint8_t mode)
 }
 #endif
 
+/****************************************************************************
+ * Name: codecs_file
+ *
+ * Description:
+ *   Stream a file or a block device through a codec.  Each buffer is read,
+ *   transformed with the incremental codec interfaces and written out in one
+ *   piece; base64 groups and URL escapes may be split between buffers.
+ *
+ ****************************************************************************/
+
+#ifdef NEED_CMD_CODECS_PROC
+static int codecs_file(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd,
+                       FAR const char *path, uint8_t mode, bool iswebsafe,
+                       bool timing)
+{
+#ifdef HAVE_CODECS_HASH_MD5
+  MD5_CTX ctx;
+  unsigned char mac[16];
+#endif
+#ifdef CONFIG_CODECS_BASE64
+  struct base64_stream_s b64;
+#endif
+  struct timespec start;
+  struct timespec end;
+  FAR char *srcbuf;
+  FAR char *destbuf;
+  uint64_t total = 0;
+  uint32_t msec;
+  ssize_t nread;
+  size_t held = 0;
+  size_t len;
+  int destlen;
+  int ret = ERROR;
+  int fd;
+
+  fd = open(path, O_RDONLY);
+  if (fd < 0)
+    {
+      nsh_output(vtbl, g_fmtcmdfailed, cmd, "open", NSH_ERRNO);
+      return ERROR;
+    }
+
+  /* Room is left for up to 2 bytes carried over from the previous buffer */
+
+  srcbuf  = (FAR char *)malloc(CODECS_BUFSIZE + 2);
+  destbuf = (FAR char *)malloc(calc_codec_buffsize(CODECS_BUFSIZE + 2,
+                                                   mode));
+  if (srcbuf == NULL || destbuf == NULL)
+    {
+      nsh_output(vtbl, g_fmtcmdoutofmemory, cmd);
+      goto errout;
+    }
+
+#ifdef HAVE_CODECS_HASH_MD5
+  MD5Init(&ctx);
+#endif
+#ifdef CONFIG_CODECS_BASE64
+  base64_stream_init(&b64, iswebsafe);
+#endif
+
+  (void)clock_gettime(CODECS_CLOCK, &start);
+
+  do
+    {
+      nread = read(fd, srcbuf + held, CODECS_BUFSIZE);
+      if (nread < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          nsh_output(vtbl, g_fmtcmdfailed, cmd, "read", NSH_ERRNO);
+          goto errout;
+        }
+
+      total  += nread;
+      len     = held + nread;
+      held    = 0;
+      destlen = 0;
+
+      switch (mode)
+        {
+#ifdef HAVE_CODECS_URLENCODE
+          case CODEC_MODE_URLENCODE:
+            urlencode(srcbuf, len, destbuf, &destlen);
+            break;
+#endif
+
+#ifdef HAVE_CODECS_URLDECODE
+          case CODEC_MODE_URLDECODE:
+
+            /* Carry an escape sequence split by the end of the buffer over
+             * to the next one.
+             */
+
+            if (nread > 0)
+              {
+                if (srcbuf[len - 1] == '%')
+                  {
+                    held = 1;
+                  }
+                else if (len > 1 && srcbuf[len - 2] == '%')
+                  {
+                    held = 2;
+                  }
+              }
+
+            urldecode(srcbuf, len - held, destbuf, &destlen);
+            memmove(srcbuf, srcbuf + len - held, held);
+            break;
+#endif
+
+#ifdef HAVE_CODECS_BASE64ENC
+          case CODEC_MODE_BASE64ENC:
+            destlen = nread > 0 ?
+              base64_encode_update(&b64, (FAR unsigned char *)srcbuf, len,
+                                   (FAR unsigned char *)destbuf) :
+              base64_encode_final(&b64, (FAR unsigned char *)destbuf);
+            break;
+#endif
+
+#ifdef HAVE_CODECS_BASE64DEC
+          case CODEC_MODE_BASE64DEC:
+            if (nread > 0)
+              {
+                destlen = base64_decode_update(&b64,
+                                               (FAR unsigned char *)srcbuf,
+                                               len,
+                                               (FAR unsigned char *)destbuf);
+              }
+            else if (base64_decode_final(&b64) < 0)
+              {
+                nsh_output(vtbl, g_fmtcmdfailed, cmd, "decode",
+                           NSH_ERRNO_OF(EINVAL));
+                goto errout;
+              }
+            break;
+#endif
+
+#ifdef HAVE_CODECS_HASH_MD5
+          case CODEC_MODE_HASH_MD5:
+            MD5Update(&ctx, (FAR unsigned char *)srcbuf, len);
+            break;
+#endif
+
+          default:
+            break;
+        }
+
+      if (destlen > 0)
+        {
+          (void)nsh_write(vtbl, destbuf, destlen);
+        }
+    }
+  while (nread != 0);
+
+  (void)clock_gettime(CODECS_CLOCK, &end);
+
+#ifdef HAVE_CODECS_HASH_MD5
+  if (mode == CODEC_MODE_HASH_MD5)
+    {
+      MD5Final(mac, &ctx);
+      md5_tohex(mac, destbuf);
+      nsh_output(vtbl, "%s\n", destbuf);
+    }
+  else
+#endif
+  if (timing)
+    {
+      /* Encoded output has no trailing newline */
+
+      nsh_output(vtbl, "\n");
+    }
+
+  if (timing)
+    {
+      msec = (end.tv_sec - start.tv_sec) * 1000 +
+             (end.tv_nsec - start.tv_nsec) / 1000000;
+
+      nsh_output(vtbl, "%llu bytes in %lu ms (%lu KB/s)\n",
+                 (unsigned long long)total, (unsigned long)msec,
+                 msec > 0 ? (unsigned long)(total * 1000 / 1024 / msec) : 0);
+    }
+
+  ret = OK;
+
+errout:
+  free(destbuf);
+  free(srcbuf);
+  close(fd);
+  return ret;
+}
+#endif
+
 /****************************************************************************
  * Name: cmd_codecs_proc
  ****************************************************************************/
@@ -253,11 +474,8 @@ static int cmd_codecs_proc(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv,
                            uint8_t mode, codec_callback_t func)
 {
 #ifdef HAVE_CODECS_HASH_MD5
-  static const unsigned char hexchars[] = "0123456789abcdef";
   MD5_CTX ctx;
   unsigned char mac[16];
-  FAR char *src;
-  FAR char *dest;
 #endif
 
   FAR char *localfile = NULL;
@@ -269,15 +487,15 @@ static int cmd_codecs_proc(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv,
   bool badarg = false;
   bool isfile = false;
   bool iswebsafe = false;
+  bool timing = false;
   int option;
-  int fd = -1;
   int buflen = 0;
   int srclen = 0;
   int ret = OK;
 
   /* Get the command options */
 
-  while ((option = getopt(argc, argv, ":fw")) != ERROR)
+  while ((option = getopt(argc, argv, ":ftw")) != ERROR)
     {
       switch (option)
         {
@@ -285,6 +503,10 @@ static int cmd_codecs_proc(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv,
             isfile = true;
             break;
 
+          case 't':
+            timing = true;
+            break;
+
 #ifdef CONFIG_CODECS_BASE64
           case 'w':
             iswebsafe = true;
@@ -315,6 +537,14 @@ static int cmd_codecs_proc(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv,
       return ERROR;
     }
 
+  /* Throughput is only reported for files */
+
+  if (timing && !isfile)
+    {
+      nsh_output(vtbl, g_fmtarginvalid, argv[0]);
+      return ERROR;
+    }
+
   /* There should be exactly on parameter left on the command-line */
 
   if (optind == argc-1)
@@ -341,104 +571,17 @@ static int cmd_codecs_proc(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv,
 
   if (isfile)
     {
-      /* Get the local file name */
-
-      localfile = sdata;
-
       /* Get the full path to the local file */
 
-      fullpath = nsh_getfullpath(vtbl, localfile);
-
-      /* Open the local file for reading */
-
-      fd = open(fullpath, O_RDONLY);
-      if (fd < 0)
-        {
-          nsh_output(vtbl, g_fmtcmdfailed, argv[0], "open", NSH_ERRNO);
-          ret = ERROR;
-          goto exit;
-        }
-
-      srcbuf = malloc(CONFIG_NSH_CODECS_BUFSIZE+2);
-#ifdef HAVE_CODECS_BASE64ENC
-      if (mode == CODEC_MODE_BASE64ENC)
-        {
-          srclen = CONFIG_NSH_CODECS_BUFSIZE / 3 * 3;
-        }
-      else
-#endif
-        {
-          srclen = CONFIG_NSH_CODECS_BUFSIZE;
-        }
-
-      buflen = calc_codec_buffsize(srclen+2, mode);
-      destbuf = malloc(buflen);
-      while (true)
+      localfile = sdata;
+      fullpath  = nsh_getfullpath(vtbl, localfile);
+      if (fullpath == NULL)
         {
-          memset(srcbuf, 0, srclen+2);
-          ret=read(fd, srcbuf, srclen);
-          if (ret < 0)
-            {
-              nsh_output(vtbl, g_fmtcmdfailed, argv[0], "read", NSH_ERRNO);
-              ret = ERROR;
-              goto exit;
-            }
-          else if (ret==0)
-            {
-              break;
-            }
-
-#ifdef HAVE_CODECS_URLDECODE
-          if (mode == CODEC_MODE_URLDECODE)
-            {
-              if (srcbuf[srclen-1]=='%')
-                {
-                  ret += read(fd,&srcbuf[srclen],2);
-                }
-              else if (srcbuf[srclen-2]=='%')
-                {
-                  ret += read(fd,&srcbuf[srclen],1);
-                }
-            }
-#endif
-          memset(destbuf, 0, buflen);
-          if (func)
-            {
-#ifdef HAVE_CODECS_HASH_MD5
-              if (mode == CODEC_MODE_HASH_MD5)
-                {
-                  func(srcbuf, ret, (char *)&ctx, &buflen,0);
-                }
-              else
-#endif
-                {
-                  func(srcbuf, ret, destbuf, &buflen,(iswebsafe)?1:0);
-                  nsh_output(vtbl, "%s", destbuf);
-                }
-            }
-
-          buflen = calc_codec_buffsize(srclen+2, mode);
+          fmt = g_fmtcmdoutofmemory;
+          goto errout;
         }
 
-#ifdef HAVE_CODECS_HASH_MD5
-      if (mode == CODEC_MODE_HASH_MD5)
-        {
-          int i;
-
-          MD5Final(mac, &ctx);
-          src = (FAR char *)&mac;
-          dest = destbuf;
-          for (i = 0; i < 16; i++, src++)
-            {
-              *dest++ = hexchars[(*src) >> 4];
-              *dest++ = hexchars[(*src) & 0x0f];
-            }
-
-          *dest = '\0';
-          nsh_output(vtbl, "%s\n", destbuf);
-        }
-#endif
-      ret = OK;
+      ret = codecs_file(vtbl, argv[0], fullpath, mode, iswebsafe, timing);
       goto exit;
     }
   else
@@ -447,7 +590,6 @@ static int cmd_codecs_proc(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv,
       srclen  = strlen(sdata);
       buflen  = calc_codec_buffsize(srclen, mode);
       destbuf = malloc(buflen);
-      destbuf[0]=0;
       if (!destbuf)
         {
           fmt = g_fmtcmdoutofmemory;
@@ -460,19 +602,9 @@ static int cmd_codecs_proc(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv,
 #ifdef HAVE_CODECS_HASH_MD5
           if (mode == CODEC_MODE_HASH_MD5)
             {
-              int i;
-
               func(srcbuf, srclen, (char *)&ctx, &buflen, 0);
               MD5Final(mac, &ctx);
-              src = (char *)&mac;
-              dest = destbuf;
-              for (i = 0; i < 16; i++, src++)
-                {
-                  *dest++ = hexchars[(*src) >> 4];
-                  *dest++ = hexchars[(*src) & 0x0f];
-                }
-
-              *dest = '\0';
+              md5_tohex(mac, destbuf);
             }
           else
 #endif
@@ -487,11 +619,6 @@ static int cmd_codecs_proc(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv,
     }
 
 exit:
-  if (fd >= 0)
-    {
-      close(fd);
-    }
-
   if (fullpath)
     {
       free(fullpath);
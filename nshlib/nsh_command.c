@@ -100,16 +100,21 @@ static int  cmd_unrecognized(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
  * Private Data
  ****************************************************************************/
 
+/* The command table.  Entries must be kept in strcmp() order so that
+ * nsh_findcmd() can locate a command with a binary search.  The NULL entry
+ * at the end is a terminator and is not part of the sorted range.
+ */
+
 static const struct cmdmap_s g_cmdmap[] =
 {
-#if !defined(CONFIG_NSH_DISABLESCRIPT) && !defined(CONFIG_NSH_DISABLE_TEST)
-  { "[",        cmd_lbracket, 4, CONFIG_NSH_MAXARGUMENTS, "<expression> ]" },
-#endif
-
 #ifndef CONFIG_NSH_DISABLE_HELP
   { "?",        cmd_help,     1, 1, NULL },
 #endif
 
+#if !defined(CONFIG_NSH_DISABLESCRIPT) && !defined(CONFIG_NSH_DISABLE_TEST)
+  { "[",        cmd_lbracket, 4, CONFIG_NSH_MAXARGUMENTS, "<expression> ]" },
+#endif
+
 #if defined(CONFIG_NET) && defined(CONFIG_NET_ROUTE) && !defined(CONFIG_NSH_DISABLE_ADDROUTE)
   { "addroute", cmd_addroute, 3, 4, "<target> [<netmask>] <router>" },
 #endif
@@ -120,10 +125,10 @@ static const struct cmdmap_s g_cmdmap[] =
 
 #if defined(CONFIG_NETUTILS_CODECS) && defined(CONFIG_CODECS_BASE64)
 #  ifndef CONFIG_NSH_DISABLE_BASE64DEC
-  { "base64dec", cmd_base64decode, 2, 4, "[-w] [-f] <string or filepath>" },
+  { "base64dec", cmd_base64decode, 2, 5, "[-w] [-f [-t]] <string or filepath>" },
 #  endif
 #  ifndef CONFIG_NSH_DISABLE_BASE64ENC
-  { "base64enc", cmd_base64encode, 2, 4, "[-w] [-f] <string or filepath>" },
+  { "base64enc", cmd_base64encode, 2, 5, "[-w] [-f [-t]] <string or filepath>" },
 #  endif
 #endif
 
@@ -144,16 +149,12 @@ static const struct cmdmap_s g_cmdmap[] =
   { "cd",       cmd_cd,       1, 2, "[<dir-path>|-|~|..]" },
 # endif
 #endif
-# ifndef CONFIG_NSH_DISABLE_CP
-  { "cp",       cmd_cp,       3, 3, "<source-path> <dest-path>" },
-# endif
 # ifndef CONFIG_NSH_DISABLE_CMP
   { "cmp",      cmd_cmp,      3, 3, "<path1> <path2>" },
 # endif
-#endif
-
-#ifndef CONFIG_NSH_DISABLE_DIRNAME
-  { "dirname",  cmd_dirname,  2, 2, "<path>" },
+# ifndef CONFIG_NSH_DISABLE_CP
+  { "cp",       cmd_cp,       3, 4, "[-r] <source-path> <dest-path>" },
+# endif
 #endif
 
 #ifndef CONFIG_NSH_DISABLE_DATE
@@ -161,8 +162,12 @@ static const struct cmdmap_s g_cmdmap[] =
 #endif
 
 #if CONFIG_NFILE_DESCRIPTORS > 0 && !defined(CONFIG_NSH_DISABLE_DD)
+# ifdef CONFIG_NSH_CMDOPT_DD_AIO
+  { "dd",       cmd_dd,       3, 7, "if=<infile> of=<outfile> [bs=<sectsize>] [count=<sectors>] [skip=<sectors>] [aio=<nbuffers>]" },
+# else
   { "dd",       cmd_dd,       3, 6, "if=<infile> of=<outfile> [bs=<sectsize>] [count=<sectors>] [skip=<sectors>]" },
 # endif
+# endif
 
 #if defined(CONFIG_NET) && defined(CONFIG_NET_ROUTE) && !defined(CONFIG_NSH_DISABLE_DELROUTE)
   { "delroute", cmd_delroute, 2, 3, "<target> [<netmask>]" },
@@ -179,6 +184,10 @@ static const struct cmdmap_s g_cmdmap[] =
 #endif
 #endif
 
+#ifndef CONFIG_NSH_DISABLE_DIRNAME
+  { "dirname",  cmd_dirname,  2, 2, "<path>" },
+#endif
+
 #if CONFIG_NFILE_DESCRIPTORS > 0 && defined(CONFIG_RAMLOG_SYSLOG) && \
    !defined(CONFIG_NSH_DISABLE_DMESG)
   { "dmesg",    cmd_dmesg,    1, 1, NULL },
@@ -256,6 +265,12 @@ static const struct cmdmap_s g_cmdmap[] =
 # endif
 #endif
 
+#if CONFIG_NFILE_DESCRIPTORS > 0
+#  if !defined(CONFIG_NSH_DISABLE_LN) && defined(CONFIG_PSEUDOFS_SOFTLINKS)
+  { "ln",       cmd_ln,       3, 4, "[-s] <target> <link>" },
+# endif
+#endif
+
 #if CONFIG_NFILE_DESCRIPTORS > 0 && !defined(CONFIG_DISABLE_MOUNTPOINT)
 # if defined(CONFIG_DEV_LOOP) && !defined(CONFIG_NSH_DISABLE_LOSETUP)
   { "losetup",   cmd_losetup, 3, 6, "[-d <dev-path>] | [[-o <offset>] [-r] <dev-path> <file-path>]" },
@@ -268,12 +283,6 @@ static const struct cmdmap_s g_cmdmap[] =
 # endif
 #endif
 
-#if CONFIG_NFILE_DESCRIPTORS > 0
-#  if !defined(CONFIG_NSH_DISABLE_LN) && defined(CONFIG_PSEUDOFS_SOFTLINKS)
-  { "ln",       cmd_ln,       3, 4, "[-s] <target> <link>" },
-# endif
-#endif
-
 #if CONFIG_NFILE_DESCRIPTORS > 0
 # ifndef CONFIG_NSH_DISABLE_LS
   { "ls",       cmd_ls,       1, 5, "[-lRs] <dir-path>" },
@@ -292,10 +301,14 @@ static const struct cmdmap_s g_cmdmap[] =
 
 #if defined(CONFIG_NETUTILS_CODECS) && defined(CONFIG_CODECS_HASH_MD5)
 #  ifndef CONFIG_NSH_DISABLE_MD5
-  { "md5",      cmd_md5,      2, 3, "[-f] <string or filepath>" },
+  { "md5",      cmd_md5,      2, 4, "[-f [-t]] <string or filepath>" },
 #  endif
 #endif
 
+#ifndef CONFIG_NSH_DISABLE_MH
+  { "mh",       cmd_mh,       2, 3, "<hex-address>[=<hex-value>][ <hex-byte-count>]" },
+#endif
+
 #ifdef NSH_HAVE_DIROPTS
 # ifndef CONFIG_NSH_DISABLE_MKDIR
   { "mkdir",    cmd_mkdir,    2, 2, "<path>" },
@@ -305,7 +318,7 @@ static const struct cmdmap_s g_cmdmap[] =
 #if !defined(CONFIG_DISABLE_MOUNTPOINT) && CONFIG_NFILE_DESCRIPTORS > 0 && \
      defined(CONFIG_FSUTILS_MKFATFS)
 # ifndef CONFIG_NSH_DISABLE_MKFATFS
-  { "mkfatfs",  cmd_mkfatfs,  2, 4, "[-F <fatsize>] <block-driver>" },
+  { "mkfatfs",  cmd_mkfatfs,  2, 6, "[-F <fatsize>] [-a <sectors>] <block-driver>" },
 # endif
 #endif
 
@@ -333,10 +346,6 @@ static const struct cmdmap_s g_cmdmap[] =
 # endif
 #endif
 
-#ifndef CONFIG_NSH_DISABLE_MH
-  { "mh",       cmd_mh,       2, 3, "<hex-address>[=<hex-value>][ <hex-byte-count>]" },
-#endif
-
 #if !defined(CONFIG_DISABLE_MOUNTPOINT) && CONFIG_NFILE_DESCRIPTORS > 0 && defined(CONFIG_FS_READABLE)
 #ifndef CONFIG_NSH_DISABLE_MOUNT
 #if defined(NSH_HAVE_CATFILE) && defined(HAVE_MOUNT_LIST)
@@ -377,6 +386,10 @@ static const struct cmdmap_s g_cmdmap[] =
 #  endif
 #endif
 
+#if defined(CONFIG_SYSTEM_PERFCOUNT) && !defined(CONFIG_NSH_DISABLE_PERF)
+  { "perf",     cmd_perf,     1, 4, "[-r] [-b <path>] [<prefix>]" },
+#endif
+
 #if defined(CONFIG_BOARDCTL_POWEROFF) && !defined(CONFIG_NSH_DISABLE_POWEROFF)
   { "poweroff", cmd_poweroff,  1, 1, NULL },
 #endif
@@ -473,8 +486,8 @@ static const struct cmdmap_s g_cmdmap[] =
 # endif
 #endif
 
-#if !defined(CONFIG_NSH_DISABLESCRIPT) && !defined(CONFIG_NSH_DISABLE_TEST)
-  { "test",     cmd_test,     3, CONFIG_NSH_MAXARGUMENTS, "<expression>" },
+#ifdef CONFIG_NSH_STARTUP
+  { "startup",  cmd_startup,  1, CONFIG_NSH_MAXARGUMENTS, "[status | add <name> [-a <after>[,<after>...]] <command> [<arg> ...] | wait [-t <sec>] [<name> ...]]" },
 #endif
 
 #if defined(CONFIG_NSH_TELNET) && !defined(CONFIG_NSH_DISABLE_TELNETD)
@@ -485,8 +498,16 @@ static const struct cmdmap_s g_cmdmap[] =
 #endif
 #endif
 
+#if !defined(CONFIG_NSH_DISABLESCRIPT) && !defined(CONFIG_NSH_DISABLE_TEST)
+  { "test",     cmd_test,     3, CONFIG_NSH_MAXARGUMENTS, "<expression>" },
+#endif
+
 #ifndef CONFIG_NSH_DISABLE_TIME
-  { "time",     cmd_time,     2, 2, "\"<command>\"" },
+  { "time",     cmd_time,     2, CONFIG_NSH_MAXARGUMENTS, "<command> [<arg> [<arg> ...]]" },
+#endif
+
+#ifndef CONFIG_NSH_DISABLE_TOP
+  { "top",      cmd_top,      1, 6, "[-b] [-d <secs>] [-n <count>]" },
 #endif
 
 #ifndef CONFIG_NSH_DISABLESCRIPT
@@ -499,6 +520,12 @@ static const struct cmdmap_s g_cmdmap[] =
 # endif
 #endif
 
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && CONFIG_NFILE_DESCRIPTORS > 0 && defined(CONFIG_FS_READABLE)
+# ifndef CONFIG_NSH_DISABLE_UMOUNT
+  { "umount",   cmd_umount,   2, 2, "<dir-path>" },
+# endif
+#endif
+
 #ifndef CONFIG_NSH_DISABLE_UNAME
 #ifdef CONFIG_NET
   { "uname",    cmd_uname,    1, 7, "[-a | -imnoprsv]" },
@@ -507,12 +534,6 @@ static const struct cmdmap_s g_cmdmap[] =
 #endif
 #endif
 
-#if !defined(CONFIG_DISABLE_MOUNTPOINT) && CONFIG_NFILE_DESCRIPTORS > 0 && defined(CONFIG_FS_READABLE)
-# ifndef CONFIG_NSH_DISABLE_UMOUNT
-  { "umount",   cmd_umount,   2, 2, "<dir-path>" },
-# endif
-#endif
-
 #ifndef CONFIG_DISABLE_ENVIRON
 # ifndef CONFIG_NSH_DISABLE_UNSET
   { "unset",    cmd_unset,    2, 2, "<name>" },
@@ -521,10 +542,10 @@ static const struct cmdmap_s g_cmdmap[] =
 
 #if defined(CONFIG_NETUTILS_CODECS) && defined(CONFIG_CODECS_URLCODE)
 #  ifndef CONFIG_NSH_DISABLE_URLDECODE
-  { "urldecode", cmd_urldecode, 2, 3, "[-f] <string or filepath>" },
+  { "urldecode", cmd_urldecode, 2, 4, "[-f [-t]] <string or filepath>" },
 #  endif
 #  ifndef CONFIG_NSH_DISABLE_URLENCODE
-  { "urlencode", cmd_urlencode, 2, 3, "[-f] <string or filepath>" },
+  { "urlencode", cmd_urlencode, 2, 4, "[-f [-t]] <string or filepath>" },
 #  endif
 #endif
 
@@ -562,6 +583,69 @@ static const struct cmdmap_s g_cmdmap[] =
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: nsh_lowerbound
+ *
+ * Description:
+ *   Return the index of the first command in g_cmdmap whose first namelen
+ *   characters do not compare less than the first namelen characters of
+ *   name.  If namelen is zero, the whole name is compared.
+ *
+ ****************************************************************************/
+
+static int nsh_lowerbound(FAR const char *name, size_t namelen)
+{
+  int lower = 0;
+  int upper = NUM_CMDS;
+
+  while (lower < upper)
+    {
+      int mid = (lower + upper) >> 1;
+      int cmp;
+
+      if (namelen > 0)
+        {
+          cmp = strncmp(g_cmdmap[mid].cmd, name, namelen);
+        }
+      else
+        {
+          cmp = strcmp(g_cmdmap[mid].cmd, name);
+        }
+
+      if (cmp < 0)
+        {
+          lower = mid + 1;
+        }
+      else
+        {
+          upper = mid;
+        }
+    }
+
+  return lower;
+}
+
+/****************************************************************************
+ * Name: nsh_findcmd
+ *
+ * Description:
+ *   Find the command table entry for cmd.  Returns NULL if there is no such
+ *   command.
+ *
+ ****************************************************************************/
+
+static FAR const struct cmdmap_s *nsh_findcmd(FAR const char *cmd)
+{
+  int index = nsh_lowerbound(cmd, 0);
+
+  if (index < NUM_CMDS && strcmp(g_cmdmap[index].cmd, cmd) == 0)
+    {
+      return &g_cmdmap[index];
+    }
+
+  return NULL;
+}
+
 /****************************************************************************
  * Name: help_cmdlist
  ****************************************************************************/
@@ -663,18 +747,14 @@ static int help_cmd(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd)
 
   /* Find the command in the command table */
 
-  for (cmdmap = g_cmdmap; cmdmap->cmd; cmdmap++)
+  cmdmap = nsh_findcmd(cmd);
+  if (cmdmap != NULL)
     {
-      /* Is this the one we are looking for? */
+      /* Yes... show it */
 
-      if (strcmp(cmdmap->cmd, cmd) == 0)
-        {
-          /* Yes... show it */
-
-          nsh_output(vtbl, "%s usage:", cmd);
-          help_showcmd(vtbl, cmdmap);
-          return OK;
-        }
+      nsh_output(vtbl, "%s usage:", cmd);
+      help_showcmd(vtbl, cmdmap);
+      return OK;
     }
 
   nsh_output(vtbl, g_fmtcmdnotfound, cmd);
@@ -886,38 +966,35 @@ int nsh_command(FAR struct nsh_vtbl_s *vtbl, int argc, char *argv[])
 
   /* See if the command is one that we understand */
 
-  for (cmdmap = g_cmdmap; cmdmap->cmd; cmdmap++)
+  cmdmap = nsh_findcmd(cmd);
+  if (cmdmap != NULL)
     {
-      if (strcmp(cmdmap->cmd, cmd) == 0)
+      /* Check if a valid number of arguments was provided.  We
+       * do this simple, imperfect checking here so that it does
+       * not have to be performed in each command.
+       */
+
+      if (argc < cmdmap->minargs)
+        {
+          /* Fewer than the minimum number were provided */
+
+          nsh_output(vtbl, g_fmtargrequired, cmd);
+          return ERROR;
+        }
+      else if (argc > cmdmap->maxargs)
         {
-          /* Check if a valid number of arguments was provided.  We
-           * do this simple, imperfect checking here so that it does
-           * not have to be performed in each command.
+          /* More than the maximum number were provided */
+
+          nsh_output(vtbl, g_fmttoomanyargs, cmd);
+          return ERROR;
+        }
+      else
+        {
+          /* A valid number of arguments were provided (this does
+           * not mean they are right).
            */
 
-          if (argc < cmdmap->minargs)
-            {
-              /* Fewer than the minimum number were provided */
-
-              nsh_output(vtbl, g_fmtargrequired, cmd);
-              return ERROR;
-            }
-          else if (argc > cmdmap->maxargs)
-            {
-              /* More than the maximum number were provided */
-
-              nsh_output(vtbl, g_fmttoomanyargs, cmd);
-              return ERROR;
-            }
-          else
-            {
-              /* A valid number of arguments were provided (this does
-               * not mean they are right).
-               */
-
-              handler = cmdmap->handler;
-              break;
-            }
+          handler = cmdmap->handler;
         }
     }
 
@@ -926,46 +1003,44 @@ int nsh_command(FAR struct nsh_vtbl_s *vtbl, int argc, char *argv[])
 }
 
 /****************************************************************************
- * Name: nsh_extmatch_count
+ * Name: nsh_extmatch_next
  *
  * Description:
  *   This support function is used to provide support for realine tab-
- *   completion logic  nsh_extmatch_count() counts the number of matching
- *   nsh command names
+ *   completion logic  nsh_extmatch_next() returns the index of the next
+ *   nsh command name that matches.
  *
  * Input Parameters:
  *   name    - A point to the name containing the name to be matched.
- *   matches - A table is size CONFIG_READLINE_MAX_EXTCMDS that can
- *             be used to remember matching name indices.
  *   namelen - The lenght of the name to match
+ *   index   - Zero to find the first match; one more than the index of the
+ *             previous match to find the next one.
  *
  * Returned Values:
- *   The number commands that match to the first namelen characters.
+ *   The index of the next command that matches the first namelen
+ *   characters; -ENOENT if there are no more matches.
  *
  ****************************************************************************/
 
 #if defined(CONFIG_NSH_READLINE) && defined(CONFIG_READLINE_TABCOMPLETION) && \
     defined(CONFIG_READLINE_HAVE_EXTMATCH)
-int nsh_extmatch_count(FAR char *name, FAR int *matches, int namelen)
+int nsh_extmatch_next(FAR const char *name, int namelen, int index)
 {
-  int nr_matches = 0;
-  int i;
+  /* The table is sorted, so all matching names are adjacent and only the
+   * first of them has to be searched for.
+   */
 
-  for (i = 0; i < NUM_CMDS; i++)
+  if (index == 0)
     {
-      if (strncmp(name, g_cmdmap[i].cmd, namelen) == 0)
-        {
-          matches[nr_matches] = i;
-          nr_matches++;
+      index = nsh_lowerbound(name, namelen);
+    }
 
-          if (nr_matches >= CONFIG_READLINE_MAX_EXTCMDS)
-            {
-              break;
-            }
-        }
+  if (index < NUM_CMDS && strncmp(name, g_cmdmap[index].cmd, namelen) == 0)
+    {
+      return index;
     }
 
-  return nr_matches;
+  return -ENOENT;
 }
 #endif
 
@@ -975,7 +1050,7 @@ int nsh_extmatch_count(FAR char *name, FAR int *matches, int namelen)
  * Description:
  *   This support function is used to provide support for realine tab-
  *   completion logic  nsh_extmatch_getname() will return the full command
- *   string from an index that was previously saved by nsh_exmatch_count().
+ *   string from an index that was previously returned by nsh_exmatch_next().
  *
  * Input Parameters:
  *   index - The index of the command name to be returned.
@@ -989,7 +1064,7 @@ int nsh_extmatch_count(FAR char *name, FAR int *matches, int namelen)
     defined(CONFIG_READLINE_HAVE_EXTMATCH)
 FAR const char *nsh_extmatch_getname(int index)
 {
-  DEBUGASSERT(index > 0 && index <= NUM_CMDS);
+  DEBUGASSERT(index >= 0 && index < NUM_CMDS);
   return  g_cmdmap[index].cmd;
 }
 #endif
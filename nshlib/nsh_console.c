@@ -77,6 +77,7 @@ static ssize_t nsh_consolewrite(FAR struct nsh_vtbl_s *vtbl,
   FAR const void *buffer, size_t nbytes);
 static int nsh_consoleoutput(FAR struct nsh_vtbl_s *vtbl,
   FAR const char *fmt, ...);
+static void nsh_consoleflush(FAR struct nsh_vtbl_s *vtbl);
 static FAR char *nsh_consolelinebuffer(FAR struct nsh_vtbl_s *vtbl);
 
 #if CONFIG_NFILE_DESCRIPTORS > 0
@@ -178,6 +179,30 @@ static ssize_t nsh_consolewrite(FAR struct nsh_vtbl_s *vtbl,
      return (ssize_t)ERROR;
    }
 
+#ifdef NSH_HAVE_OUTBUF
+  /* Add the data to the output buffer if it fits (after flushing the
+   * buffer if necessary).
+   */
+
+  if (nbytes > (size_t)(CONFIG_NSH_OUTBUFSIZE - pstate->cn_outlen))
+    {
+      nsh_consoleflush(vtbl);
+    }
+
+  if (nbytes <= (size_t)(CONFIG_NSH_OUTBUFSIZE - pstate->cn_outlen))
+    {
+      memcpy(&pstate->cn_outbuf[pstate->cn_outlen], buffer, nbytes);
+      pstate->cn_outlen += nbytes;
+
+      if (pstate->cn_lineflush && memchr(buffer, '\n', nbytes) != NULL)
+        {
+          nsh_consoleflush(vtbl);
+        }
+
+      return nbytes;
+    }
+#endif
+
   /* Write the data to the output stream */
 
   ret = fwrite(buffer, 1, nbytes, pstate->cn_outstream);
@@ -221,6 +246,49 @@ static int nsh_consoleoutput(FAR struct nsh_vtbl_s *vtbl,
      return ERROR;
    }
 
+#ifdef NSH_HAVE_OUTBUF
+  /* Format the output into the space remaining in the output buffer */
+
+  {
+    FAR char *dest = &pstate->cn_outbuf[pstate->cn_outlen];
+    size_t avail   = CONFIG_NSH_OUTBUFSIZE - pstate->cn_outlen;
+
+    va_start(ap, fmt);
+    ret = vsnprintf(dest, avail, fmt, ap);
+    va_end(ap);
+
+    if (ret >= 0 && (size_t)ret >= avail && pstate->cn_outlen > 0 &&
+        ret < CONFIG_NSH_OUTBUFSIZE)
+      {
+        /* It did not fit, but would fit in an empty buffer */
+
+        nsh_consoleflush(vtbl);
+        dest  = pstate->cn_outbuf;
+        avail = CONFIG_NSH_OUTBUFSIZE;
+
+        va_start(ap, fmt);
+        ret = vsnprintf(dest, avail, fmt, ap);
+        va_end(ap);
+      }
+
+    if (ret >= 0 && (size_t)ret < avail)
+      {
+        pstate->cn_outlen += ret;
+
+        if (pstate->cn_lineflush && memchr(dest, '\n', ret) != NULL)
+          {
+            nsh_consoleflush(vtbl);
+          }
+
+        return ret;
+      }
+
+    /* Too large for the buffer.  Write it directly. */
+
+    nsh_consoleflush(vtbl);
+  }
+#endif
+
   va_start(ap, fmt);
   ret = vfprintf(pstate->cn_outstream, fmt, ap);
   va_end(ap);
@@ -253,6 +321,40 @@ static int nsh_consoleoutput(FAR struct nsh_vtbl_s *vtbl,
 #endif
 }
 
+/****************************************************************************
+ * Name: nsh_consoleflush
+ *
+ * Description:
+ *   Write any buffered output to the currently selected stream.
+ *
+ ****************************************************************************/
+
+static void nsh_consoleflush(FAR struct nsh_vtbl_s *vtbl)
+{
+#if CONFIG_NFILE_STREAMS > 0
+  FAR struct console_stdio_s *pstate = (FAR struct console_stdio_s *)vtbl;
+
+#ifdef NSH_HAVE_OUTBUF
+  if (pstate->cn_outlen > 0 && nsh_openifnotopen(pstate) == 0)
+    {
+      if (fwrite(pstate->cn_outbuf, 1, pstate->cn_outlen,
+                 pstate->cn_outstream) < pstate->cn_outlen)
+        {
+          _err("ERROR: [%d] Failed to send buffer: %d\n",
+              pstate->cn_outfd, errno);
+        }
+    }
+
+  pstate->cn_outlen = 0;
+#endif
+
+  if (pstate->cn_outstream)
+    {
+      fflush(pstate->cn_outstream);
+    }
+#endif
+}
+
 /****************************************************************************
  * Name: nsh_consolelinebuffer
  *
@@ -279,6 +381,15 @@ static FAR char *nsh_consolelinebuffer(FAR struct nsh_vtbl_s *vtbl)
 static FAR struct nsh_vtbl_s *nsh_consoleclone(FAR struct nsh_vtbl_s *vtbl)
 {
   FAR struct console_stdio_s *pclone = nsh_newconsole();
+
+#ifdef NSH_HAVE_OUTBUF
+  if (pclone != NULL)
+    {
+      pclone->cn_lineflush =
+        ((FAR struct console_stdio_s *)vtbl)->cn_lineflush;
+    }
+#endif
+
   return &pclone->cn_vtbl;
 }
 #endif
@@ -295,6 +406,10 @@ static void nsh_consolerelease(FAR struct nsh_vtbl_s *vtbl)
 {
   FAR struct console_stdio_s *pstate = (FAR struct console_stdio_s *)vtbl;
 
+  /* Write any buffered output */
+
+  nsh_consoleflush(vtbl);
+
 #if CONFIG_NFILE_DESCRIPTORS > 0
   /* Close the output stream */
 
@@ -348,6 +463,10 @@ static void nsh_consoleredirect(FAR struct nsh_vtbl_s *vtbl, int fd, FAR uint8_t
   FAR struct console_stdio_s *pstate = (FAR struct console_stdio_s *)vtbl;
   FAR struct serialsave_s *ssave  = (FAR struct serialsave_s *)save;
 
+  /* Any buffered output belongs to the current output stream */
+
+  nsh_consoleflush(vtbl);
+
   /* Case 1: Redirected foreground commands */
 
   if (ssave)
@@ -400,6 +519,7 @@ static void nsh_consoleundirect(FAR struct nsh_vtbl_s *vtbl, FAR uint8_t *save)
   FAR struct console_stdio_s *pstate = (FAR struct console_stdio_s *)vtbl;
   FAR struct serialsave_s *ssave  = (FAR struct serialsave_s *)save;
 
+  nsh_consoleflush(vtbl);
   nsh_closeifnotclosed(pstate);
   pstate->cn_outfd     = ssave->cn_outfd;
   pstate->cn_outstream = ssave->cn_outstream;
@@ -441,10 +561,11 @@ FAR struct console_stdio_s *nsh_newconsole(void)
 
 #ifndef CONFIG_NSH_DISABLEBG
       pstate->cn_vtbl.clone      = nsh_consoleclone;
-      pstate->cn_vtbl.release    = nsh_consolerelease;
 #endif
+      pstate->cn_vtbl.release    = nsh_consolerelease;
       pstate->cn_vtbl.write      = nsh_consolewrite;
       pstate->cn_vtbl.output     = nsh_consoleoutput;
+      pstate->cn_vtbl.flush      = nsh_consoleflush;
       pstate->cn_vtbl.linebuffer = nsh_consolelinebuffer;
       pstate->cn_vtbl.exit       = nsh_consoleexit;
 
@@ -478,6 +599,18 @@ FAR struct console_stdio_s *nsh_newconsole(void)
       pstate->cn_outfd           = OUTFD(pstate);
       pstate->cn_outstream       = OUTSTREAM(pstate);
 #endif
+
+#ifdef NSH_HAVE_OUTBUF
+      /* Interactive consoles see each line as soon as it is complete */
+
+      pstate->cn_lineflush       = true;
+#endif
+
+#ifdef CONFIG_NSH_PIPES
+      /* Not a background command of a pipeline */
+
+      pstate->cn_vtbl.np.np_pipein = -1;
+#endif
     }
 
 #ifndef CONFIG_NSH_DISABLESCRIPT
@@ -61,6 +61,7 @@
 #define nsh_redirect(v,f,s)    (v)->redirect(v,f,s)
 #define nsh_undirect(v,s)      (v)->undirect(v,s)
 #define nsh_exit(v,s)          (v)->exit(v,s)
+#define nsh_flush(v)           (v)->flush(v)
 
 #ifdef CONFIG_CPP_HAVE_VARARGS
 # define nsh_output(v, ...)    (v)->output(v, ##__VA_ARGS__)
@@ -72,6 +73,20 @@
 
 #define SAVE_SIZE (sizeof(int) + sizeof(FILE*) + sizeof(bool))
 
+/* Output of NSH commands may be collected in a per-session buffer so that
+ * it is written in large pieces (one TCP segment rather than one per line
+ * for a Telnet session).
+ */
+
+#ifndef CONFIG_NSH_OUTBUFSIZE
+#  define CONFIG_NSH_OUTBUFSIZE 0
+#endif
+
+#undef NSH_HAVE_OUTBUF
+#if CONFIG_NSH_OUTBUFSIZE > 0 && CONFIG_NFILE_STREAMS > 0
+#  define NSH_HAVE_OUTBUF 1
+#endif
+
 /* Are we using the NuttX console for I/O?  Or some other character device? */
 
 #if CONFIG_NFILE_STREAMS > 0
@@ -96,6 +111,21 @@
 #  endif
 #endif
 
+/* The command line editor borrows the session output buffer (which is
+ * always empty while waiting for a command) to batch its display updates.
+ */
+
+#ifdef CONFIG_NSH_CLE
+#  ifdef NSH_HAVE_OUTBUF
+#    define NSH_CLE(p) \
+       cle_buffered((p)->cn_line, CONFIG_NSH_LINELEN, INSTREAM(p), \
+                    OUTSTREAM(p), (p)->cn_outbuf, CONFIG_NSH_OUTBUFSIZE)
+#  else
+#    define NSH_CLE(p) \
+       cle((p)->cn_line, CONFIG_NSH_LINELEN, INSTREAM(p), OUTSTREAM(p))
+#  endif
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -112,11 +142,12 @@ struct nsh_vtbl_s
 #ifndef CONFIG_NSH_DISABLEBG
   FAR struct nsh_vtbl_s *(*clone)(FAR struct nsh_vtbl_s *vtbl);
   void (*addref)(FAR struct nsh_vtbl_s *vtbl);
-  void (*release)(FAR struct nsh_vtbl_s *vtbl);
 #endif
+  void (*release)(FAR struct nsh_vtbl_s *vtbl);
   ssize_t (*write)(FAR struct nsh_vtbl_s *vtbl, FAR const void *buffer,
                    size_t nbytes);
   int (*output)(FAR struct nsh_vtbl_s *vtbl, FAR const char *fmt, ...);
+  void (*flush)(FAR struct nsh_vtbl_s *vtbl);
   FAR char *(*linebuffer)(FAR struct nsh_vtbl_s *vtbl);
 #if CONFIG_NFILE_DESCRIPTORS > 0
   void (*redirect)(FAR struct nsh_vtbl_s *vtbl, int fd, FAR uint8_t *save);
@@ -158,6 +189,17 @@ struct console_stdio_s
   FILE  *cn_outstream; /* Output stream */
 #endif
 
+#ifdef NSH_HAVE_OUTBUF
+  /* Buffered output.  It is flushed when full, at each newline if
+   * cn_lineflush is set, when the output is redirected, and when a command
+   * completes.
+   */
+
+  bool     cn_lineflush;                  /* Flush at each newline */
+  uint16_t cn_outlen;                     /* Bytes in cn_outbuf[] */
+  char     cn_outbuf[CONFIG_NSH_OUTBUFSIZE];
+#endif
+
   /* Line input buffer */
 
   char   cn_line[CONFIG_NSH_LINELEN];
@@ -52,6 +52,10 @@
 #include <errno.h>
 #include <time.h>
 
+#ifdef CONFIG_NSH_CMDOPT_DD_AIO
+#  include <aio.h>
+#endif
+
 #include "nsh.h"
 #include "nsh_console.h"
 
@@ -73,6 +77,10 @@
 
 #undef CAN_PIPE_FROM_STD
 
+/* The maximum number of buffers that may be requested with aio= */
+
+#define DD_AIO_MAXBUFS 8
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -162,6 +170,229 @@ static int dd_read(struct dd_s *dd)
   return OK;
 }
 
+/****************************************************************************
+ * Name: dd_aiowait
+ *
+ * Description:
+ *   Wait for an asynchronous transfer to complete and return its result.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_CMDOPT_DD_AIO
+static ssize_t dd_aiowait(FAR struct aiocb *aiocbp)
+{
+  FAR const struct aiocb *list[1];
+  int ret;
+
+  list[0] = aiocbp;
+  while ((ret = aio_error(aiocbp)) == EINPROGRESS)
+    {
+      /* aio_suspend() may be interrupted by a signal; just try again */
+
+      (void)aio_suspend(list, 1, NULL);
+    }
+
+  if (ret != OK)
+    {
+      (void)aio_return(aiocbp);
+      return -ret;
+    }
+
+  return aio_return(aiocbp);
+}
+#endif
+
+/****************************************************************************
+ * Name: dd_aiostart
+ *
+ * Description:
+ *   Start an asynchronous read (read == true) or write of one sector.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_CMDOPT_DD_AIO
+static int dd_aiostart(FAR struct dd_s *dd, FAR struct aiocb *aiocbp,
+                       FAR uint8_t *buffer, uint32_t sector, bool read)
+{
+  FAR struct nsh_vtbl_s *vtbl = dd->vtbl;
+  int ret;
+
+  memset(aiocbp, 0, sizeof(struct aiocb));
+  aiocbp->aio_fildes  = read ? dd->infd : dd->outfd;
+  aiocbp->aio_buf     = buffer;
+  aiocbp->aio_nbytes  = dd->sectsize;
+  aiocbp->aio_offset  = (off_t)sector * dd->sectsize;
+  aiocbp->aio_sigevent.sigev_notify = SIGEV_NONE;
+
+  ret = read ? aio_read(aiocbp) : aio_write(aiocbp);
+  if (ret < 0)
+    {
+      nsh_output(vtbl, g_fmtcmdfailed, g_dd,
+                 read ? "aio_read" : "aio_write", NSH_ERRNO);
+      return ERROR;
+    }
+
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: dd_aiocopy
+ *
+ * Description:
+ *   Copy the data using nbufs buffers and asynchronous I/O.  Up to
+ *   nbufs - 1 reads are kept in flight while the previous sector is being
+ *   written, so that reading and writing overlap.  Both files must support
+ *   positioned I/O (regular files, block and MTD devices).
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_CMDOPT_DD_AIO
+static int dd_aiocopy(FAR struct dd_s *dd, int nbufs)
+{
+  FAR struct nsh_vtbl_s *vtbl = dd->vtbl;
+  FAR struct aiocb *aiocbs;
+  FAR uint8_t *buffers;
+  uint32_t nread;       /* Number of sectors for which reads were started */
+  uint32_t nwritten;    /* Number of sectors written */
+  bool writing = false; /* A write is in progress on the previous buffer */
+  ssize_t nbytes;
+  int ret = ERROR;
+  int prev = 0;
+  int bufno;
+  int i;
+
+  aiocbs = (FAR struct aiocb *)malloc(nbufs * sizeof(struct aiocb));
+  if (aiocbs == NULL)
+    {
+      nsh_output(vtbl, g_fmtcmdoutofmemory, g_dd);
+      return ERROR;
+    }
+
+  /* Use the buffer allocated by cmd_dd() for nbufs sectors */
+
+  buffers = dd->buffer;
+
+  /* Prime the pipeline with reads into all buffers.  Sectors before skip=
+   * are never read.
+   */
+
+  for (nread = 0; nread < (uint32_t)nbufs && nread < dd->nsectors; nread++)
+    {
+      if (dd_aiostart(dd, &aiocbs[nread], &buffers[nread * dd->sectsize],
+                      dd->skip + nread, true) < 0)
+        {
+          goto errout_with_aio;
+        }
+    }
+
+  for (nwritten = 0; nwritten < dd->nsectors; nwritten++)
+    {
+      bufno = nwritten % nbufs;
+
+      /* Wait for the read into this buffer */
+
+      nbytes = dd_aiowait(&aiocbs[bufno]);
+      if (nbytes < 0)
+        {
+          nsh_output(vtbl, g_fmtcmdfailed, g_dd, "aio_read",
+                     NSH_ERRNO_OF(-nbytes));
+          goto errout_with_aio;
+        }
+
+      if (nbytes == 0)
+        {
+          /* End of the input file */
+
+          break;
+        }
+
+      /* Pad with zero if necessary (at the end of file only) */
+
+      memset(&buffers[bufno * dd->sectsize + nbytes], 0,
+             dd->sectsize - nbytes);
+
+      /* Wait for the write from the previous buffer.  That buffer is then
+       * free and can be used to read ahead.
+       */
+
+      if (writing)
+        {
+          nbytes = dd_aiowait(&aiocbs[prev]);
+          writing = false;
+
+          if (nbytes != dd->sectsize)
+            {
+              nsh_output(vtbl, g_fmtcmdfailed, g_dd, "aio_write",
+                         NSH_ERRNO_OF(nbytes < 0 ? -nbytes : EIO));
+              goto errout_with_aio;
+            }
+
+          if (nread < dd->nsectors)
+            {
+              if (dd_aiostart(dd, &aiocbs[prev],
+                              &buffers[prev * dd->sectsize],
+                              dd->skip + nread, true) < 0)
+                {
+                  goto errout_with_aio;
+                }
+
+              nread++;
+            }
+        }
+
+      /* Write this buffer */
+
+      if (dd_aiostart(dd, &aiocbs[bufno], &buffers[bufno * dd->sectsize],
+                      nwritten, false) < 0)
+        {
+          goto errout_with_aio;
+        }
+
+      writing = true;
+      prev    = bufno;
+    }
+
+  /* Wait for the last write */
+
+  if (writing)
+    {
+      nbytes  = dd_aiowait(&aiocbs[prev]);
+      writing = false;
+
+      if (nbytes != dd->sectsize)
+        {
+          nsh_output(vtbl, g_fmtcmdfailed, g_dd, "aio_write",
+                     NSH_ERRNO_OF(nbytes < 0 ? -nbytes : EIO));
+          goto errout_with_aio;
+        }
+    }
+
+  ret = OK;
+
+errout_with_aio:
+
+  /* Cancel and reap any transfers that are still in flight */
+
+  (void)aio_cancel(dd->infd, NULL);
+  (void)aio_cancel(dd->outfd, NULL);
+
+  for (i = 0; i < nbufs && i < (int)nread; i++)
+    {
+      if (aio_error(&aiocbs[i]) == EINPROGRESS)
+        {
+          (void)dd_aiowait(&aiocbs[i]);
+        }
+    }
+
+  /* Report the number of sectors handled, as the synchronous loop does */
+
+  dd->sector = dd->skip + nwritten;
+  free(aiocbs);
+  return ret;
+}
+#endif
+
 /****************************************************************************
  * Name: dd_infopen
  ****************************************************************************/
@@ -213,6 +444,10 @@ int cmd_dd(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
   struct timespec ts1;
   uint64_t elapsed;
   uint64_t total;
+  uint32_t nsectors;
+#endif
+#ifdef CONFIG_NSH_CMDOPT_DD_AIO
+  int nbufs = 0;
 #endif
   int ret = ERROR;
   int i;
@@ -274,6 +509,17 @@ int cmd_dd(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
         {
           dd.skip = atoi(&argv[i][5]);
         }
+#ifdef CONFIG_NSH_CMDOPT_DD_AIO
+      else if (strncmp(argv[i], "aio=", 4) == 0)
+        {
+          nbufs = atoi(&argv[i][4]);
+          if (nbufs < 2 || nbufs > DD_AIO_MAXBUFS)
+            {
+              nsh_output(vtbl, g_fmtarginvalid, g_dd);
+              goto errout_with_paths;
+            }
+        }
+#endif
     }
 
 #ifndef CAN_PIPE_FROM_STD
@@ -284,9 +530,13 @@ int cmd_dd(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
     }
 #endif
 
-  /* Allocate the I/O buffer */
+  /* Allocate the I/O buffer (one per sector in flight for aio=) */
 
+#ifdef CONFIG_NSH_CMDOPT_DD_AIO
+  dd.buffer = malloc(nbufs > 0 ? nbufs * dd.sectsize : dd.sectsize);
+#else
   dd.buffer = malloc(dd.sectsize);
+#endif
   if (!dd.buffer)
     {
       nsh_output(vtbl, g_fmtcmdoutofmemory, g_dd);
@@ -320,6 +570,20 @@ int cmd_dd(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
 #endif
 
   dd.sector = 0;
+
+#ifdef CONFIG_NSH_CMDOPT_DD_AIO
+  if (nbufs > 0)
+    {
+      ret = dd_aiocopy(&dd, nbufs);
+      if (ret < 0)
+        {
+          goto errout_with_outf;
+        }
+
+      dd.eof = true;
+    }
+#endif
+
   while (!dd.eof && dd.nsectors > 0)
     {
       /* Read one sector from from the input */
@@ -375,12 +639,23 @@ int cmd_dd(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
   elapsed -= (((uint64_t)ts0.tv_sec * NSEC_PER_SEC) + ts0.tv_nsec);
   elapsed /= NSEC_PER_MSEC; /* msec */
 
-  total = ((uint64_t)dd.sector * (uint64_t)dd.sectsize);
+  if (elapsed == 0)
+    {
+      elapsed = 1;
+    }
+
+  /* Only the sectors written to the output count as copied */
+
+  nsectors = dd.sector > dd.skip ? dd.sector - dd.skip : 0;
+  total    = ((uint64_t)nsectors * (uint64_t)dd.sectsize);
 
   nsh_output(vtbl, "%llu bytes copied, %u msec, ",
              total, (unsigned int)elapsed);
-  nsh_output(vtbl, "%u KB/s\n" ,
-             (unsigned int)((double)total / (double)elapsed));
+  nsh_output(vtbl, "%u KB/s, %u.%03u MB/s, %u IOPS\n" ,
+             (unsigned int)(total / elapsed),
+             (unsigned int)(total / (elapsed * 1000)),
+             (unsigned int)((total / elapsed) % 1000),
+             (unsigned int)(((uint64_t)nsectors * 1000) / elapsed));
 #endif
 
 errout_with_outf:
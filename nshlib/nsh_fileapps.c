@@ -83,6 +83,11 @@ int nsh_fileapp(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd,
 {
   posix_spawn_file_actions_t file_actions;
   posix_spawnattr_t attr;
+#ifdef CONFIG_NSH_PIPES
+  int closefds[NSH_PIPE_MAXFDS];
+  int nclose;
+  int i;
+#endif
   pid_t pid;
   int ret;
 
@@ -110,6 +115,25 @@ int nsh_fileapp(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd,
       goto errout_with_actions;
     }
 
+#ifdef CONFIG_NSH_PIPES
+  /* Keep the FIFO ends that NSH holds for the pipeline out of the new
+   * task.  Otherwise the readers of those FIFOs never see the end of file.
+   */
+
+  nclose = nsh_pipefds(vtbl, closefds);
+  for (i = 0; i < nclose; i++)
+    {
+      ret = posix_spawn_file_actions_addclose(&file_actions, closefds[i]);
+      if (ret != 0)
+        {
+          nsh_output(vtbl, g_fmtcmdfailed, cmd,
+                     "posix_spawn_file_actions_addclose",
+                     NSH_ERRNO_OF(ret));
+          goto errout_with_attrs;
+        }
+    }
+#endif
+
   /* Handle re-direction of output */
 
   if (redirfile)
@@ -99,6 +99,69 @@
 #define LSFLAGS_LONG          2
 #define LSFLAGS_RECURSIVE     4
 
+/* The size of the buffer used by cp.  Larger buffers let the underlying
+ * file system and driver transfer whole clusters or erase blocks at once.
+ */
+
+#ifndef CONFIG_NSH_CMDOPT_CP_BUFSIZE
+#  define CONFIG_NSH_CMDOPT_CP_BUFSIZE 4096
+#endif
+
+/* cp -r needs directory creation and traversal */
+
+#undef HAVE_CP_RECURSIVE
+#if CONFIG_NFILE_DESCRIPTORS > 0 && !defined(CONFIG_NSH_DISABLE_CP) && \
+    defined(NSH_HAVE_DIROPTS) && defined(NSH_HAVE_FOREACH_DIRENTRY)
+#  define HAVE_CP_RECURSIVE 1
+#endif
+
+/* ls and cp -r walk directory trees through one in-place path buffer */
+
+#undef HAVE_WALKPATH
+#if (CONFIG_NFILE_DESCRIPTORS > 0 && !defined(CONFIG_NSH_DISABLE_LS)) || \
+    defined(HAVE_CP_RECURSIVE)
+#  define HAVE_WALKPATH 1
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* A path that is extended and truncated in place while walking a
+ * directory tree, so that no per-entry path allocations are needed.
+ */
+
+#ifdef HAVE_WALKPATH
+struct nsh_walkpath_s
+{
+  size_t len;                  /* Length of the path in path[] */
+  char   path[PATH_MAX + 1];   /* NUL terminated path */
+};
+#endif
+
+/* The state of one ls command */
+
+#if CONFIG_NFILE_DESCRIPTORS > 0 && !defined(CONFIG_NSH_DISABLE_LS)
+struct ls_state_s
+{
+  unsigned int lsflags;        /* See LSFLAGS_* definitions */
+  struct nsh_walkpath_s dir;   /* The directory being listed */
+};
+#endif
+
+/* The state of one recursive cp command */
+
+#ifdef HAVE_CP_RECURSIVE
+struct cp_state_s
+{
+  FAR const char *cmd;         /* Command name for error reports */
+  FAR char *buffer;            /* Copy buffer */
+  size_t bufsize;              /* Size of the copy buffer */
+  struct nsh_walkpath_s src;   /* Current source path */
+  struct nsh_walkpath_s dest;  /* Current destination path */
+};
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -107,8 +170,7 @@
  * Name: nsh_getdirpath
  ****************************************************************************/
 
-#if CONFIG_NFILE_DESCRIPTORS > 0 && \
-    (!defined(CONFIG_NSH_DISABLE_LS) || !defined(CONFIG_NSH_DISABLE_CP))
+#if CONFIG_NFILE_DESCRIPTORS > 0 && !defined(CONFIG_NSH_DISABLE_CP)
 static char *nsh_getdirpath(FAR struct nsh_vtbl_s *vtbl,
                             FAR const char *path, FAR const char *file)
 {
@@ -128,6 +190,80 @@ static char *nsh_getdirpath(FAR struct nsh_vtbl_s *vtbl,
 }
 #endif
 
+/****************************************************************************
+ * Name: nsh_pathinit
+ *
+ * Description:
+ *   Initialize a walk path.  Returns ERROR if the path is too long.
+ *
+ ****************************************************************************/
+
+#ifdef HAVE_WALKPATH
+static int nsh_pathinit(FAR struct nsh_walkpath_s *wp, FAR const char *path)
+{
+  wp->len = strlen(path);
+  if (wp->len > PATH_MAX)
+    {
+      return ERROR;
+    }
+
+  strcpy(wp->path, path);
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: nsh_pathpush
+ *
+ * Description:
+ *   Append "/name" to a walk path.  Returns the previous length of the
+ *   path, to be given to nsh_pathpop(), or ERROR if the result would be
+ *   too long.
+ *
+ ****************************************************************************/
+
+#ifdef HAVE_WALKPATH
+static int nsh_pathpush(FAR struct nsh_walkpath_s *wp, FAR const char *name)
+{
+  size_t oldlen = wp->len;
+  size_t namelen = strlen(name);
+  size_t len = oldlen;
+
+  /* Don't double the '/' of the root directory */
+
+  if (len == 0 || wp->path[len - 1] != '/')
+    {
+      len++;
+    }
+
+  if (len + namelen > PATH_MAX)
+    {
+      return ERROR;
+    }
+
+  wp->path[oldlen] = '/';
+  memcpy(&wp->path[len], name, namelen + 1);
+  wp->len = len + namelen;
+  return (int)oldlen;
+}
+#endif
+
+/****************************************************************************
+ * Name: nsh_pathpop
+ *
+ * Description:
+ *   Undo nsh_pathpush().
+ *
+ ****************************************************************************/
+
+#ifdef HAVE_WALKPATH
+static void nsh_pathpop(FAR struct nsh_walkpath_s *wp, int oldlen)
+{
+  wp->len = oldlen;
+  wp->path[oldlen] = '\0';
+}
+#endif
+
 /****************************************************************************
  * Name: ls_specialdir
  ****************************************************************************/
@@ -147,10 +283,12 @@ static inline int ls_specialdir(const char *dir)
 static int ls_handler(FAR struct nsh_vtbl_s *vtbl, FAR const char *dirpath,
                       FAR struct dirent *entryp, FAR void *pvarg)
 {
-  unsigned int lsflags = (unsigned int)((uintptr_t)pvarg);
+  FAR struct ls_state_s *ls = (FAR struct ls_state_s *)pvarg;
+  unsigned int lsflags = ls->lsflags;
 #ifdef CONFIG_PSEUDOFS_SOFTLINKS
   bool isdir = false;
 #endif
+  int oldlen;
   int ret;
 
   /* Check if any options will require that we stat the file */
@@ -163,9 +301,17 @@ static int ls_handler(FAR struct nsh_vtbl_s *vtbl, FAR const char *dirpath,
 
       if (entryp != NULL)
         {
-          FAR char *fullpath = nsh_getdirpath(vtbl, dirpath, entryp->d_name);
-          ret = stat(fullpath, &buf);
-          free(fullpath);
+          /* dirpath is ls->dir.path; extend it in place to name the entry */
+
+          oldlen = nsh_pathpush(&ls->dir, entryp->d_name);
+          if (oldlen < 0)
+            {
+              nsh_output(vtbl, g_fmtcmdfailed, "ls", "stat", NSH_ERRNO_OF(ENAMETOOLONG));
+              return ERROR;
+            }
+
+          ret = stat(ls->dir.path, &buf);
+          nsh_pathpop(&ls->dir, oldlen);
         }
       else
         {
@@ -272,14 +418,19 @@ static int ls_handler(FAR struct nsh_vtbl_s *vtbl, FAR const char *dirpath,
 #ifdef CONFIG_PSEUDOFS_SOFTLINKS
       if (DIRENT_ISLINK(entryp->d_type))
         {
-          FAR char *fullpath;
           ssize_t len;
 
           /* Get the target of the symbolic link */
 
-          fullpath = nsh_getdirpath(vtbl, dirpath, entryp->d_name);
-          len = readlink(fullpath, vtbl->iobuffer, IOBUFFERSIZE);
-          free(fullpath);
+          oldlen = nsh_pathpush(&ls->dir, entryp->d_name);
+          if (oldlen < 0)
+            {
+              nsh_output(vtbl, g_fmtcmdfailed, "ls", "readlink", NSH_ERRNO_OF(ENAMETOOLONG));
+              return ERROR;
+            }
+
+          len = readlink(ls->dir.path, vtbl->iobuffer, IOBUFFERSIZE);
+          nsh_pathpop(&ls->dir, oldlen);
 
           if (len < 0)
             {
@@ -327,32 +478,41 @@ static int ls_handler(FAR struct nsh_vtbl_s *vtbl, FAR const char *dirpath,
 static int ls_recursive(FAR struct nsh_vtbl_s *vtbl, const char *dirpath,
                         struct dirent *entryp, void *pvarg)
 {
+  FAR struct ls_state_s *ls = (FAR struct ls_state_s *)pvarg;
+  int oldlen;
   int ret = OK;
 
   /* Is this entry a directory (and not one of the special directories, . and ..)? */
 
   if (DIRENT_ISDIRECTORY(entryp->d_type) && !ls_specialdir(entryp->d_name))
     {
-      /* Yes.. */
+      /* Yes.. descend into it.  dirpath is ls->dir.path, which is extended
+       * in place rather than copied.
+       */
 
-      FAR char *newpath;
-      newpath = nsh_getdirpath(vtbl, dirpath, entryp->d_name);
+      oldlen = nsh_pathpush(&ls->dir, entryp->d_name);
+      if (oldlen < 0)
+        {
+          nsh_output(vtbl, g_fmtcmdfailed, "ls", "opendir", NSH_ERRNO_OF(ENAMETOOLONG));
+          return ERROR;
+        }
 
       /* List the directory contents */
 
-      nsh_output(vtbl, "%s:\n", newpath);
+      nsh_output(vtbl, "%s:\n", ls->dir.path);
 
       /* Traverse the directory  */
 
-      ret = nsh_foreach_direntry(vtbl, "ls", newpath, ls_handler, pvarg);
+      ret = nsh_foreach_direntry(vtbl, "ls", ls->dir.path, ls_handler, pvarg);
       if (ret == 0)
         {
           /* Then recurse to list each directory within the directory */
 
-          ret = nsh_foreach_direntry(vtbl, "ls", newpath, ls_recursive,
+          ret = nsh_foreach_direntry(vtbl, "ls", ls->dir.path, ls_recursive,
                                      pvarg);
-          free(newpath);
         }
+
+      nsh_pathpop(&ls->dir, oldlen);
     }
 
   return ret;
@@ -360,6 +520,187 @@ static int ls_recursive(FAR struct nsh_vtbl_s *vtbl, const char *dirpath,
 
 #endif /* CONFIG_NFILE_DESCRIPTORS > 0 && !CONFIG_NSH_DISABLE_LS */
 
+/****************************************************************************
+ * Name: cp_copyfile
+ *
+ * Description:
+ *   Copy one file from srcpath to destpath through the caller's buffer.
+ *
+ ****************************************************************************/
+
+#if CONFIG_NFILE_DESCRIPTORS > 0 && !defined(CONFIG_NSH_DISABLE_CP)
+static int cp_copyfile(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd,
+                       FAR const char *srcpath, FAR const char *destpath,
+                       int oflags, FAR char *buffer, size_t bufsize)
+{
+  int rdfd;
+  int wrfd;
+  int ret = ERROR;
+
+  /* Open the source file for reading */
+
+  rdfd = open(srcpath, O_RDONLY);
+  if (rdfd < 0)
+    {
+      nsh_output(vtbl, g_fmtcmdfailed, cmd, "open", NSH_ERRNO);
+      return ERROR;
+    }
+
+  /* Now open the destination */
+
+  wrfd = open(destpath, oflags, 0666);
+  if (wrfd < 0)
+    {
+      nsh_output(vtbl, g_fmtcmdfailed, cmd, "open", NSH_ERRNO);
+      goto errout_with_rdfd;
+    }
+
+  /* Now copy the file */
+
+  for (;;)
+    {
+      ssize_t nbytesread;
+      ssize_t nbyteswritten;
+      FAR char *ptr;
+
+      do
+        {
+          nbytesread = read(rdfd, buffer, bufsize);
+          if (nbytesread == 0)
+            {
+              /* End of file */
+
+              ret = OK;
+              goto errout_with_wrfd;
+            }
+          else if (nbytesread < 0)
+            {
+              /* EINTR is not an error (but will still stop the copy) */
+
+#ifndef CONFIG_DISABLE_SIGNALS
+              if (errno == EINTR)
+                {
+                  nsh_output(vtbl, g_fmtsignalrecvd, cmd);
+                }
+              else
+#endif
+                {
+                  /* Read error */
+
+                  nsh_output(vtbl, g_fmtcmdfailed, cmd, "read", NSH_ERRNO);
+                }
+              goto errout_with_wrfd;
+            }
+        }
+      while (nbytesread <= 0);
+
+      ptr = buffer;
+      do
+        {
+          nbyteswritten = write(wrfd, ptr, nbytesread);
+          if (nbyteswritten >= 0)
+            {
+              ptr        += nbyteswritten;
+              nbytesread -= nbyteswritten;
+            }
+          else
+            {
+              /* EINTR is not an error (but will still stop the copy) */
+
+#ifndef CONFIG_DISABLE_SIGNALS
+              if (errno == EINTR)
+                {
+                  nsh_output(vtbl, g_fmtsignalrecvd, cmd);
+                }
+              else
+#endif
+                {
+                 /* Write error */
+
+                  nsh_output(vtbl, g_fmtcmdfailed, cmd, "write", NSH_ERRNO);
+                }
+              goto errout_with_wrfd;
+            }
+        }
+      while (nbytesread > 0);
+    }
+
+errout_with_wrfd:
+  close(wrfd);
+
+errout_with_rdfd:
+  close(rdfd);
+  return ret;
+}
+#endif
+
+/****************************************************************************
+ * Name: cp_recursive
+ *
+ * Description:
+ *   nsh_foreach_direntry() callback for cp -r.  Copies one directory
+ *   entry, descending into sub-directories.  The source and destination
+ *   paths are extended and restored in place.
+ *
+ ****************************************************************************/
+
+#ifdef HAVE_CP_RECURSIVE
+static int cp_recursive(FAR struct nsh_vtbl_s *vtbl, FAR const char *dirpath,
+                        FAR struct dirent *entryp, FAR void *pvarg)
+{
+  FAR struct cp_state_s *cp = (FAR struct cp_state_s *)pvarg;
+  int srclen;
+  int destlen;
+  int ret;
+
+  if (ls_specialdir(entryp->d_name))
+    {
+      return OK;
+    }
+
+  srclen = nsh_pathpush(&cp->src, entryp->d_name);
+  if (srclen < 0)
+    {
+      nsh_output(vtbl, g_fmtcmdfailed, cp->cmd, "open", NSH_ERRNO_OF(ENAMETOOLONG));
+      return ERROR;
+    }
+
+  destlen = nsh_pathpush(&cp->dest, entryp->d_name);
+  if (destlen < 0)
+    {
+      nsh_output(vtbl, g_fmtcmdfailed, cp->cmd, "open", NSH_ERRNO_OF(ENAMETOOLONG));
+      nsh_pathpop(&cp->src, srclen);
+      return ERROR;
+    }
+
+  if (DIRENT_ISDIRECTORY(entryp->d_type))
+    {
+      /* Create the destination directory, then copy its contents */
+
+      ret = mkdir(cp->dest.path, 0777);
+      if (ret < 0 && errno != EEXIST)
+        {
+          nsh_output(vtbl, g_fmtcmdfailed, cp->cmd, "mkdir", NSH_ERRNO);
+        }
+      else
+        {
+          ret = nsh_foreach_direntry(vtbl, cp->cmd, cp->src.path,
+                                     cp_recursive, cp);
+        }
+    }
+  else
+    {
+      ret = cp_copyfile(vtbl, cp->cmd, cp->src.path, cp->dest.path,
+                        O_WRONLY | O_CREAT | O_TRUNC, cp->buffer,
+                        cp->bufsize);
+    }
+
+  nsh_pathpop(&cp->dest, destlen);
+  nsh_pathpop(&cp->src, srclen);
+  return ret;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -489,36 +830,84 @@ int cmd_cp(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
   FAR char *srcpath  = NULL;
   FAR char *destpath = NULL;
   FAR char *allocpath = NULL;
+  FAR char *buffer;
+  size_t bufsize;
   int oflags = O_WRONLY | O_CREAT | O_TRUNC;
-  int rdfd;
-  int wrfd;
+#ifdef HAVE_CP_RECURSIVE
+  bool recursive = false;
+#endif
+  bool badarg = false;
+  int option;
   int ret = ERROR;
 
-  /* Get the full path to the source file */
+  /* Get the cp options:  [-r] <source-path> <dest-path> */
 
-  srcpath = nsh_getfullpath(vtbl, argv[1]);
-  if (srcpath == NULL)
+  while ((option = getopt(argc, argv, "r")) != ERROR)
     {
-      nsh_output(vtbl, g_fmtcmdoutofmemory, argv[0]);
-      goto errout;
+      switch (option)
+        {
+#ifdef HAVE_CP_RECURSIVE
+          case 'r':
+            recursive = true;
+            break;
+#endif
+
+          case '?':
+          default:
+            nsh_output(vtbl, g_fmtarginvalid, argv[0]);
+            badarg = true;
+            break;
+        }
     }
 
-  /* Open the source file for reading */
+  /* If a bad argument was encountered, then return without processing the command */
 
-  rdfd = open(srcpath, O_RDONLY);
-  if (rdfd < 0)
+  if (badarg)
     {
-      nsh_output(vtbl, g_fmtcmdfailed, argv[0], "open", NSH_ERRNO);
-      goto errout_with_srcpath;
+      return ERROR;
+    }
+
+  /* There must be exactly two arguments after the options */
+
+  if (optind + 2 > argc)
+    {
+      nsh_output(vtbl, g_fmtargrequired, argv[0]);
+      return ERROR;
+    }
+  else if (optind + 2 < argc)
+    {
+      nsh_output(vtbl, g_fmttoomanyargs, argv[0]);
+      return ERROR;
+    }
+
+  /* Allocate the copy buffer.  If that fails, fall back to the (smaller)
+   * I/O buffer of the session.
+   */
+
+  bufsize = CONFIG_NSH_CMDOPT_CP_BUFSIZE;
+  buffer  = (FAR char *)malloc(bufsize);
+  if (buffer == NULL)
+    {
+      buffer  = vtbl->iobuffer;
+      bufsize = IOBUFFERSIZE;
+    }
+
+  /* Get the full path to the source file */
+
+  srcpath = nsh_getfullpath(vtbl, argv[optind]);
+  if (srcpath == NULL)
+    {
+      nsh_output(vtbl, g_fmtcmdoutofmemory, argv[0]);
+      goto errout_with_buffer;
     }
 
   /* Get the full path to the destination file or directory */
 
-  destpath = nsh_getfullpath(vtbl, argv[2]);
+  destpath = nsh_getfullpath(vtbl, argv[optind + 1]);
   if (destpath == NULL)
     {
       nsh_output(vtbl, g_fmtcmdoutofmemory, argv[0]);
-      goto errout_with_rdfd;
+      goto errout_with_srcpath;
     }
 
   /* Check if the destination is a directory */
@@ -536,10 +925,11 @@ int cmd_cp(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
 
           /* Construct the full path to the new file */
 
-          allocpath = nsh_getdirpath(vtbl, destpath, basename(argv[1]) );
+          allocpath = nsh_getdirpath(vtbl, destpath, basename(argv[optind]));
           if (!allocpath)
             {
               nsh_output(vtbl, g_fmtcmdoutofmemory, argv[0]);
+              ret = ERROR;
               goto errout_with_destpath;
             }
 
@@ -556,86 +946,64 @@ int cmd_cp(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
         }
     }
 
-  /* Now open the destination */
+#ifdef HAVE_CP_RECURSIVE
+  /* Copy a whole directory tree? */
 
-  wrfd = open(destpath, oflags, 0666);
-  if (wrfd < 0)
+  nsh_trimdir(srcpath);
+  if (recursive && stat(srcpath, &buf) == 0 && S_ISDIR(buf.st_mode))
     {
-      nsh_output(vtbl, g_fmtcmdfailed, argv[0], "open", NSH_ERRNO);
-      goto errout_with_allocpath;
-    }
-
-  /* Now copy the file */
+      FAR struct cp_state_s *cp;
+      size_t srclen = strlen(srcpath);
 
-  for (;;)
-    {
-      int nbytesread;
-      int nbyteswritten;
+      /* Make sure that we do not try to copy a directory into itself */
 
-      do
+      if (strncmp(destpath, srcpath, srclen) == 0 &&
+          (destpath[srclen] == '\0' || destpath[srclen] == '/'))
         {
-          nbytesread = read(rdfd, vtbl->iobuffer, IOBUFFERSIZE);
-          if (nbytesread == 0)
-            {
-              /* End of file */
+          nsh_output(vtbl, g_fmtarginvalid, argv[0]);
+          ret = ERROR;
+        }
+      else if ((cp = (FAR struct cp_state_s *)
+                     malloc(sizeof(struct cp_state_s))) == NULL)
+        {
+          nsh_output(vtbl, g_fmtcmdoutofmemory, argv[0]);
+          ret = ERROR;
+        }
+      else
+        {
+          cp->cmd     = argv[0];
+          cp->buffer  = buffer;
+          cp->bufsize = bufsize;
 
-              ret = OK;
-              goto errout_with_wrfd;
-            }
-          else if (nbytesread < 0)
+          if (nsh_pathinit(&cp->src, srcpath) < 0 ||
+              nsh_pathinit(&cp->dest, destpath) < 0)
             {
-              /* EINTR is not an error (but will still stop the copy) */
-
-#ifndef CONFIG_DISABLE_SIGNALS
-              if (errno == EINTR)
-                {
-                  nsh_output(vtbl, g_fmtsignalrecvd, argv[0]);
-                }
-              else
-#endif
-                {
-                  /* Read error */
-
-                  nsh_output(vtbl, g_fmtcmdfailed, argv[0], "read", NSH_ERRNO);
-                }
-              goto errout_with_wrfd;
+              nsh_output(vtbl, g_fmtcmdfailed, argv[0], "open", NSH_ERRNO_OF(ENAMETOOLONG));
+              ret = ERROR;
             }
-        }
-      while (nbytesread <= 0);
-
-      do
-        {
-          nbyteswritten = write(wrfd, vtbl->iobuffer, nbytesread);
-          if (nbyteswritten >= 0)
+          else if (mkdir(cp->dest.path, 0777) < 0 && errno != EEXIST)
             {
-              nbytesread -= nbyteswritten;
+              nsh_output(vtbl, g_fmtcmdfailed, argv[0], "mkdir", NSH_ERRNO);
+              ret = ERROR;
             }
           else
             {
-              /* EINTR is not an error (but will still stop the copy) */
-
-#ifndef CONFIG_DISABLE_SIGNALS
-              if (errno == EINTR)
-                {
-                  nsh_output(vtbl, g_fmtsignalrecvd, argv[0]);
-                }
-              else
-#endif
-                {
-                 /* Read error */
-
-                  nsh_output(vtbl, g_fmtcmdfailed, argv[0], "write", NSH_ERRNO);
-                }
-              goto errout_with_wrfd;
+              ret = nsh_foreach_direntry(vtbl, argv[0], cp->src.path,
+                                         cp_recursive, cp);
             }
+
+          free(cp);
         }
-      while (nbytesread > 0);
     }
+  else
+#endif
+    {
+      /* Now copy the file */
 
-errout_with_wrfd:
-  close(wrfd);
+      ret = cp_copyfile(vtbl, argv[0], srcpath, destpath, oflags, buffer,
+                        bufsize);
+    }
 
-errout_with_allocpath:
   if (allocpath)
     {
       free(allocpath);
@@ -647,15 +1015,18 @@ errout_with_destpath:
       nsh_freefullpath(destpath);
     }
 
-errout_with_rdfd:
-  close(rdfd);
-
 errout_with_srcpath:
   if (srcpath)
     {
       nsh_freefullpath(srcpath);
     }
-errout:
+
+errout_with_buffer:
+  if (buffer != vtbl->iobuffer)
+    {
+      free(buffer);
+    }
+
   return ret;
 }
 #endif
@@ -1056,6 +1427,7 @@ errout_with_nomemory:
 #ifndef CONFIG_NSH_DISABLE_LS
 int cmd_ls(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
 {
+  FAR struct ls_state_s *ls;
   struct stat st;
   FAR const char *relpath;
   unsigned int lsflags = 0;
@@ -1137,6 +1509,20 @@ int cmd_ls(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
       len--;
     }
 
+  /* Allocate the listing state, including the one path buffer that is
+   * used for every entry at every level.
+   */
+
+  ls = (FAR struct ls_state_s *)malloc(sizeof(struct ls_state_s));
+  if (ls == NULL)
+    {
+      nsh_output(vtbl, g_fmtcmdoutofmemory, argv[0]);
+      nsh_freefullpath(fullpath);
+      return ERROR;
+    }
+
+  ls->lsflags = lsflags;
+
   /* See if it is a single file */
 
   if (stat(fullpath, &st) < 0)
@@ -1150,25 +1536,30 @@ int cmd_ls(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
        * file
        */
 
-      ret = ls_handler(vtbl, fullpath, NULL, (FAR void *)((uintptr_t)lsflags));
+      ret = ls_handler(vtbl, fullpath, NULL, ls);
+    }
+  else if (nsh_pathinit(&ls->dir, fullpath) < 0)
+    {
+      nsh_output(vtbl, g_fmtcmdfailed, argv[0], "opendir", NSH_ERRNO_OF(ENAMETOOLONG));
+      ret = ERROR;
     }
   else
     {
       /* List the directory contents */
 
-      nsh_output(vtbl, "%s:\n", fullpath);
+      nsh_output(vtbl, "%s:\n", ls->dir.path);
 
-      ret = nsh_foreach_direntry(vtbl, "ls", fullpath, ls_handler,
-                                 (FAR void*)((uintptr_t)lsflags));
+      ret = nsh_foreach_direntry(vtbl, "ls", ls->dir.path, ls_handler, ls);
       if (ret == OK && (lsflags & LSFLAGS_RECURSIVE) != 0)
         {
           /* Then recurse to list each directory within the directory */
 
-          ret = nsh_foreach_direntry(vtbl, "ls", fullpath, ls_recursive,
-                                     (FAR void *)((uintptr_t)lsflags));
+          ret = nsh_foreach_direntry(vtbl, "ls", ls->dir.path, ls_recursive,
+                                     ls);
         }
     }
 
+  free(ls);
   nsh_freefullpath(fullpath);
   return ret;
 }
@@ -1217,13 +1608,17 @@ int cmd_mkfatfs(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
   int option;
   int ret = ERROR;
 
-  /* mkfatfs [-F <fatsize>] <block-driver> */
+  /* mkfatfs [-F <fatsize>] [-a <sectors>] <block-driver> */
 
   badarg = false;
-  while ((option = getopt(argc, argv, ":F:")) != ERROR)
+  while ((option = getopt(argc, argv, ":F:a:")) != ERROR)
     {
       switch (option)
         {
+          case 'a':
+            fmt.ff_alignsects = strtoul(optarg, NULL, 0);
+            break;
+
           case 'F':
             fmt.ff_fattype = atoi(optarg);
             if (fmt.ff_fattype != 0  && fmt.ff_fattype != 12 &&
@@ -54,7 +54,7 @@
     defined(CONFIG_READLINE_HAVE_EXTMATCH)
 static const struct extmatch_vtable_s g_nsh_extmatch =
 {
-  nsh_extmatch_count,  /* count_matches */
+  nsh_extmatch_next,   /* next_match */
   nsh_extmatch_getname /* getname */
 };
 #endif
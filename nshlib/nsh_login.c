@@ -172,8 +172,7 @@ int nsh_login(FAR struct console_stdio_s *pstate)
       fflush(pstate->cn_outstream);
 
 #ifdef CONFIG_NSH_CLE
-      ret = cle(pstate->cn_line, CONFIG_NSH_LINELEN,
-                INSTREAM(pstate), OUTSTREAM(pstate));
+      ret = NSH_CLE(pstate);
 #else
       ret = readline(pstate->cn_line, CONFIG_NSH_LINELEN,
                      INSTREAM(pstate), OUTSTREAM(pstate));
@@ -39,11 +39,41 @@
 
 #include <nuttx/config.h>
 
+#ifdef CONFIG_INTERPRETERS_IHEAP
+#  include "interpreters/iheap.h"
+#endif
+
 #include "nsh.h"
 #include "nsh_console.h"
 
 #if !defined(CONFIG_NSH_DISABLE_FREE) && defined(NSH_HAVE_CATFILE)
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: free_iheap
+ *
+ * Description:
+ *   Show the use of one interpreter heap
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_INTERPRETERS_IHEAP
+static int free_iheap(FAR const struct iheap_s *heap, FAR void *arg)
+{
+  FAR struct nsh_vtbl_s *vtbl = (FAR struct nsh_vtbl_s *)arg;
+
+  nsh_output(vtbl, "%-10s %10lu %10lu %10lu %10lu %8lu %8lu %6lu\n",
+             heap->name, (unsigned long)heap->quota,
+             (unsigned long)heap->inuse, (unsigned long)heap->peak,
+             (unsigned long)heap->pooled, heap->nallocs, heap->nfrees,
+             heap->nfailed);
+  return 0;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -54,7 +84,21 @@
 
 int cmd_free(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
 {
+#ifdef CONFIG_INTERPRETERS_IHEAP
+  int ret;
+
+  ret = nsh_catfile(vtbl, argv[0], CONFIG_NSH_PROC_MOUNTPOINT "/meminfo");
+
+  /* Then show the heaps of the interpreters that are running */
+
+  nsh_output(vtbl, "\n%-10s %10s %10s %10s %10s %8s %8s %6s\n",
+             "Heap", "quota", "used", "peak", "pooled", "allocs", "frees",
+             "failed");
+  (void)iheap_foreach(free_iheap, vtbl);
+  return ret;
+#else
   return nsh_catfile(vtbl, argv[0], CONFIG_NSH_PROC_MOUNTPOINT "/meminfo");
+#endif
 }
 
 #endif /* !CONFIG_NSH_DISABLE_FREE && NSH_HAVE_CATFILE */
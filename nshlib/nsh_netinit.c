@@ -68,6 +68,9 @@
 #include <nuttx/net/mii.h>
 
 #include "netutils/netlib.h"
+#ifdef CONFIG_NSH_STARTUP_NETINIT
+#  include "nshlib/nshlib.h"
+#endif
 #if defined(CONFIG_NSH_DHCPC) || defined(CONFIG_NSH_DNS)
 #  include "netutils/dhcpc.h"
 #endif
@@ -806,6 +809,23 @@ static pthread_addr_t nsh_netinit_thread(pthread_addr_t arg)
 }
 #endif
 
+/****************************************************************************
+ * Name: nsh_netinit_step
+ *
+ * Description:
+ *   Start-up manager step that brings the network up concurrently with the
+ *   other start-up steps.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_STARTUP_NETINIT
+static int nsh_netinit_step(FAR void *arg)
+{
+  nsh_netinit_configure();
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -855,6 +875,18 @@ int nsh_netinit(void)
 
   return OK;
 
+#elif defined(CONFIG_NSH_STARTUP_NETINIT)
+  /* Bring the network up as the start-up step "netinit".  Steps added with
+   * "-a netinit" will run once it completes.
+   */
+
+  if (nsh_startup_add("netinit", NULL, nsh_netinit_step, NULL) < 0)
+    {
+      nsh_netinit_configure();
+    }
+
+  return OK;
+
 #else
   /* Perform network initialization sequentially */
 
@@ -45,7 +45,7 @@
 #include <errno.h>
 #include <debug.h>
 
-#ifdef CONFIG_NSH_CMDPARMS
+#if defined(CONFIG_NSH_CMDPARMS) || defined(CONFIG_NSH_PIPES)
 #  include <sys/stat.h>
 #endif
 
@@ -58,42 +58,44 @@
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
-/* If CONFIG_NSH_CMDPARMS or CONFIG_NSH_ARGCAT is enabled, then we will need
- * retain a list of memory allocations to be freed at the completion of
- * command processing.
+/* If CONFIG_NSH_CMDPARMS or CONFIG_NSH_ARGCAT is enabled, then argument
+ * strings built while parsing a command are taken from the arena in the
+ * parser state, or from the heap if they do not fit.  The arena level is
+ * remembered before the command is parsed and restored when the command
+ * completes.  Nested commands (scripts and command parameters) simply stack
+ * on top of the caller's allocations.
  */
 
-#undef HAVE_MEMLIST
-#if defined(CONFIG_NSH_CMDPARMS) || defined(CONFIG_NSH_ARGCAT)
-#  define HAVE_MEMLIST 1
-#endif
-
-#if defined(HAVE_MEMLIST) && !defined(CONFIG_NSH_MAXALLOCS)
-#  ifdef CONFIG_NSH_ARGCAT
-#    define CONFIG_NSH_MAXALLOCS (2*CONFIG_NSH_MAXARGUMENTS)
-#  else
-#    define CONFIG_NSH_MAXALLOCS CONFIG_NSH_MAXARGUMENTS
-#  endif
-#endif
-
-/* Allocation list helper macros */
-
-#ifdef HAVE_MEMLIST
-#  define NSH_MEMLIST_TYPE      struct nsh_memlist_s
-#  define NSH_MEMLIST_INIT(m)   memset(&(m), 0, sizeof(struct nsh_memlist_s));
-#  define NSH_MEMLIST_ADD(m,a)  nsh_memlist_add(m,a)
-#  define NSH_MEMLIST_FREE(m)   nsh_memlist_free(m)
+#ifdef NSH_HAVE_ARENA
+#  define NSH_ARENA_TYPE         struct nsh_arenamark_s
+#  define NSH_ARENA_MARK(v,m) \
+     do \
+       { \
+         (m).am_used  = (v)->np.np_arenaused; \
+         (m).am_nheap = (v)->np.np_arenanheap; \
+       } \
+     while (0)
+#  define NSH_ARENA_RELEASE(v,m) nsh_arena_release(v, &(m))
 #else
-#  define NSH_MEMLIST_TYPE      uint8_t
-#  define NSH_MEMLIST_INIT(m)   do { (m) = 0; } while (0)
-#  define NSH_MEMLIST_ADD(m,a)
-#  define NSH_MEMLIST_FREE(m)
+#  define NSH_ARENA_TYPE         uint8_t
+#  define NSH_ARENA_MARK(v,m)    do { (m) = 0; (void)(m); } while (0)
+#  define NSH_ARENA_RELEASE(v,m)
 #endif
 
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
+/* The arena level that NSH_ARENA_RELEASE() returns to */
+
+#ifdef NSH_HAVE_ARENA
+struct nsh_arenamark_s
+{
+  uint16_t am_used;                 /* Bytes in use in np_arena[] */
+  uint16_t am_nheap;                /* Number of heap blocks */
+};
+#endif
+
 /* These structure describes the parsed command line */
 
 #ifndef CONFIG_NSH_DISABLEBG
@@ -106,24 +108,16 @@ struct cmdarg_s
 };
 #endif
 
-/* This structure describes the allocation list */
-
-#ifdef HAVE_MEMLIST
-struct nsh_memlist_s
-{
-  int nallocs;                      /* Number of allocations */
-  FAR char *allocations[CONFIG_NSH_MAXALLOCS];
-};
-#endif
-
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
 
-#ifdef HAVE_MEMLIST
-static void nsh_memlist_add(FAR struct nsh_memlist_s *memlist,
-              FAR char *allocation);
-static void nsh_memlist_free(FAR struct nsh_memlist_s *memlist);
+#ifdef NSH_HAVE_ARENA
+static FAR char *nsh_arena_alloc(FAR struct nsh_vtbl_s *vtbl, size_t size);
+static FAR char *nsh_arena_realloc(FAR struct nsh_vtbl_s *vtbl,
+              FAR char *mem, size_t oldsize, size_t newsize);
+static void nsh_arena_release(FAR struct nsh_vtbl_s *vtbl,
+              FAR const struct nsh_arenamark_s *mark);
 #endif
 
 #ifndef CONFIG_NSH_DISABLEBG
@@ -139,10 +133,9 @@ static int nsh_execute(FAR struct nsh_vtbl_s *vtbl,
                int oflags);
 
 #ifdef CONFIG_NSH_CMDPARMS
-static FAR char *nsh_filecat(FAR struct nsh_vtbl_s *vtbl, FAR char *s1,
+static FAR char *nsh_filecat(FAR struct nsh_vtbl_s *vtbl,
                FAR const char *filename);
-static FAR char *nsh_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
-               FAR char **allocation);
+static FAR char *nsh_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline);
 #endif
 
 #ifdef CONFIG_NSH_ARGCAT
@@ -155,10 +148,9 @@ static FAR char *nsh_envexpand(FAR struct nsh_vtbl_s *vtbl,
                FAR char *varname);
 #endif
 
-static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
-               FAR char **allocation);
-static FAR char *nsh_argument(FAR struct nsh_vtbl_s *vtbl, char **saveptr,
-               FAR NSH_MEMLIST_TYPE *memlist);
+static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl,
+               FAR char *cmdline);
+static FAR char *nsh_argument(FAR struct nsh_vtbl_s *vtbl, char **saveptr);
 
 #ifndef CONFIG_NSH_DISABLESCRIPT
 #ifndef CONFIG_NSH_DISABLE_LOOPS
@@ -170,17 +162,17 @@ static bool nsh_itef_enabled(FAR struct nsh_vtbl_s *vtbl);
 static bool nsh_cmdenabled(FAR struct nsh_vtbl_s *vtbl);
 #ifndef CONFIG_NSH_DISABLE_LOOPS
 static int nsh_loop(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
-                    FAR char **saveptr, FAR NSH_MEMLIST_TYPE *memlist);
+                    FAR char **saveptr);
 #endif
 #ifndef CONFIG_NSH_DISABLE_ITEF
 static int nsh_itef(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
-                    FAR char **saveptr, FAR NSH_MEMLIST_TYPE *memlist);
+                    FAR char **saveptr);
 #endif
 #endif
 
 #ifndef CONFIG_NSH_DISABLEBG
 static int nsh_nice(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
-               FAR char **saveptr, FAR NSH_MEMLIST_TYPE *memlist);
+               FAR char **saveptr);
 #endif
 
 #ifdef CONFIG_NSH_CMDPARMS
@@ -190,14 +182,29 @@ static int nsh_parse_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
 
 static int nsh_parse_command(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline);
 
+#ifdef CONFIG_NSH_PIPES
+static int nsh_pipefds_add(FAR struct nsh_pipefds_s *pf, int fd);
+static void nsh_pipefds_remove(FAR struct nsh_pipefds_s *pf, int fd);
+static void nsh_pipefds_release(FAR struct nsh_pipefds_s *pf);
+static int nsh_pipestage(FAR struct nsh_vtbl_s *vtbl,
+                         FAR struct nsh_vtbl_s *bkgvtbl, int fd);
+static int nsh_pipe(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
+                    FAR int *savein);
+static void nsh_unpipe(FAR struct nsh_vtbl_s *vtbl, int savein);
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
 
 static const char g_token_separator[] = " \t\n";
 #ifndef NSH_DISABLE_SEMICOLON
+#ifdef CONFIG_NSH_PIPES
+static const char g_line_separator[]  = "\"#;|\n";
+#else
 static const char g_line_separator[]  = "\"#;\n";
 #endif
+#endif
 #ifdef CONFIG_NSH_ARGCAT
 static const char g_arg_separator[]   = "`$";
 #endif
@@ -275,44 +282,130 @@ const char g_fmtsignalrecvd[]    = "nsh: %s: Interrupted by signal\n";
  ****************************************************************************/
 
 /****************************************************************************
- * Name: nsh_memlist_add
+ * Name: nsh_arena_alloc
+ *
+ * Description:
+ *   Allocate size bytes from the arena.  An allocation that does not fit
+ *   in what is left of the arena is taken from the heap instead.  Returns
+ *   NULL if neither has room.  Arena memory is never freed individually;
+ *   it is released, together with the heap blocks, when the command that
+ *   allocated it completes.
+ *
  ****************************************************************************/
 
-#ifdef HAVE_MEMLIST
-static void nsh_memlist_add(FAR struct nsh_memlist_s *memlist,
-                            FAR char *allocation)
+#ifdef NSH_HAVE_ARENA
+static FAR char *nsh_arena_alloc(FAR struct nsh_vtbl_s *vtbl, size_t size)
 {
-  if (memlist && allocation)
+  FAR struct nsh_parser_s *np = &vtbl->np;
+  FAR struct nsh_arenablk_s *blk;
+  FAR char *mem;
+
+  if (size <= CONFIG_NSH_ARENASIZE - np->np_arenaused)
     {
-      int index = memlist->nallocs;
-      if (index < CONFIG_NSH_MAXALLOCS)
-        {
-          memlist->allocations[index] = allocation;
-          memlist->nallocs = index + 1;
-        }
+      mem = &np->np_arena[np->np_arenaused];
+      np->np_arenaused += size;
+      return mem;
+    }
+
+  if (np->np_arenanheap == UINT16_MAX)
+    {
+      return NULL;
+    }
+
+  blk = (FAR struct nsh_arenablk_s *)
+    malloc(sizeof(struct nsh_arenablk_s) + size);
+  if (blk == NULL)
+    {
+      return NULL;
     }
+
+  blk->ab_flink     = np->np_arenaheap;
+  np->np_arenaheap  = blk;
+  np->np_arenanheap++;
+  return (FAR char *)(blk + 1);
 }
 #endif
 
 /****************************************************************************
- * Name: nsh_memlist_free
+ * Name: nsh_arena_realloc
+ *
+ * Description:
+ *   Resize an arena allocation of oldsize bytes (mem may be NULL).  The
+ *   most recent arena allocation is resized in place if it still fits,
+ *   and the most recent heap block with realloc(); anything else is copied
+ *   to a new allocation.  Returns NULL if there is no room, in which case
+ *   the original allocation is unchanged.
+ *
  ****************************************************************************/
 
-#ifdef HAVE_MEMLIST
-static void nsh_memlist_free(FAR struct nsh_memlist_s *memlist)
+#ifdef NSH_HAVE_ARENA
+static FAR char *nsh_arena_realloc(FAR struct nsh_vtbl_s *vtbl,
+                                   FAR char *mem, size_t oldsize,
+                                   size_t newsize)
 {
-  if (memlist)
+  FAR struct nsh_parser_s *np = &vtbl->np;
+  FAR struct nsh_arenablk_s *blk;
+  FAR char *newmem;
+
+  if (mem != NULL && mem + oldsize == &np->np_arena[np->np_arenaused])
     {
-      int index;
+      size_t base = np->np_arenaused - oldsize;
 
-      for (index = 0; index < memlist->nallocs; index++)
+      if (newsize <= CONFIG_NSH_ARENASIZE - base)
         {
-          free(memlist->allocations[index]);
-          memlist->allocations[index] = NULL;
+          np->np_arenaused = base + newsize;
+          return mem;
+        }
+    }
+  else if (mem != NULL && np->np_arenaheap != NULL &&
+           mem == (FAR char *)(np->np_arenaheap + 1))
+    {
+      blk = (FAR struct nsh_arenablk_s *)
+        realloc(np->np_arenaheap, sizeof(struct nsh_arenablk_s) + newsize);
+      if (blk == NULL)
+        {
+          return NULL;
         }
 
-      memlist->nallocs = 0;
+      np->np_arenaheap = blk;
+      return (FAR char *)(blk + 1);
     }
+
+  newmem = nsh_arena_alloc(vtbl, newsize);
+  if (newmem != NULL && mem != NULL)
+    {
+      memcpy(newmem, mem, oldsize < newsize ? oldsize : newsize);
+    }
+
+  return newmem;
+}
+#endif
+
+/****************************************************************************
+ * Name: nsh_arena_release
+ *
+ * Description:
+ *   Return the arena to a level noted with NSH_ARENA_MARK() and free the
+ *   heap blocks allocated since then.
+ *
+ ****************************************************************************/
+
+#ifdef NSH_HAVE_ARENA
+static void nsh_arena_release(FAR struct nsh_vtbl_s *vtbl,
+                              FAR const struct nsh_arenamark_s *mark)
+{
+  FAR struct nsh_parser_s *np = &vtbl->np;
+  FAR struct nsh_arenablk_s *blk;
+
+  while (np->np_arenanheap > mark->am_nheap)
+    {
+      blk              = np->np_arenaheap;
+      np->np_arenaheap = blk->ab_flink;
+      np->np_arenanheap--;
+      free(blk);
+    }
+
+  np->np_arenaused = mark->am_used;
 }
 #endif
 
@@ -324,7 +417,6 @@ static void nsh_memlist_free(FAR struct nsh_memlist_s *memlist)
 static void nsh_releaseargs(struct cmdarg_s *arg)
 {
   FAR struct nsh_vtbl_s *vtbl = arg->vtbl;
-  int i;
 
 #if CONFIG_NFILE_STREAMS > 0
   /* If the output was redirected, then file descriptor should
@@ -334,20 +426,32 @@ static void nsh_releaseargs(struct cmdarg_s *arg)
 
   if (vtbl->np.np_redirect)
     {
+#ifdef CONFIG_NSH_PIPES
+      nsh_pipefds_remove(vtbl->np.np_pipefds, arg->fd);
+#endif
       (void)close(arg->fd);
     }
 #endif
 
+#ifdef CONFIG_NSH_PIPES
+  /* Let go of the standard input and of the shared pipeline record */
+
+  if (vtbl->np.np_pipein >= 0)
+    {
+      nsh_pipefds_remove(vtbl->np.np_pipefds, vtbl->np.np_pipein);
+      (void)close(vtbl->np.np_pipein);
+    }
+
+  nsh_pipefds_release(vtbl->np.np_pipefds);
+#endif
+
   /* Released the cloned vtbl instance */
 
   nsh_release(vtbl);
 
-  /* Release the cloned args */
-
-  for (i = 0; i < arg->argc; i++)
-    {
-      free(arg->argv[i]);
-    }
+  /* Release the cloned args.  The argument strings are part of the same
+   * allocation.
+   */
 
   free(arg);
 }
@@ -385,18 +489,36 @@ static pthread_addr_t nsh_child(pthread_addr_t arg)
 static struct cmdarg_s *nsh_cloneargs(FAR struct nsh_vtbl_s *vtbl,
                                       int fd, int argc, char *argv[])
 {
-  struct cmdarg_s *ret = (struct cmdarg_s *)zalloc(sizeof(struct cmdarg_s));
+  struct cmdarg_s *ret;
+  FAR char *strings;
+  size_t allocsize;
+  size_t len;
   int i;
 
+  /* The arguments are copied into a single allocation that follows the
+   * cmdarg_s structure.
+   */
+
+  allocsize = sizeof(struct cmdarg_s);
+  for (i = 0; i < argc; i++)
+    {
+      allocsize += strlen(argv[i]) + 1;
+    }
+
+  ret = (struct cmdarg_s *)zalloc(allocsize);
   if (ret)
     {
       ret->vtbl = vtbl;
       ret->fd   = fd;
       ret->argc = argc;
 
+      strings = (FAR char *)(ret + 1);
       for (i = 0; i < argc; i++)
         {
-          ret->argv[i] = strdup(argv[i]);
+          len = strlen(argv[i]) + 1;
+          memcpy(strings, argv[i], len);
+          ret->argv[i] = strings;
+          strings += len;
         }
     }
 
@@ -479,6 +601,12 @@ static int nsh_execute(FAR struct nsh_vtbl_s *vtbl,
 #endif
   int ret;
 
+  /* Applications write directly to the console, so any output that NSH
+   * has buffered must go first.
+   */
+
+  nsh_flush(vtbl);
+
   /* Does this command correspond to an application filename?
    * nsh_fileapp() returns:
    *
@@ -601,6 +729,25 @@ static int nsh_execute(FAR struct nsh_vtbl_s *vtbl,
           goto errout_with_redirect;
         }
 
+#ifdef CONFIG_NSH_PIPES
+      /* The commands of a background stage share the standard input of
+       * NSH, which may be a FIFO while the pipeline runs.  The FIFO
+       * descriptors that the stage holds are recorded so that the tasks
+       * of the pipeline do not inherit them.
+       */
+
+      bkgvtbl->np.np_inpipe = vtbl->np.np_inpipe ||
+                              vtbl->np.np_pipeout != NULL;
+
+      if (vtbl->np.np_pipefds != NULL &&
+          nsh_pipestage(vtbl, bkgvtbl, fd) < 0)
+        {
+          nsh_output(vtbl, g_fmtcmdfailed, argv[0], "|", NSH_ERRNO);
+          nsh_release(bkgvtbl);
+          goto errout_with_redirect;
+        }
+#endif
+
       /* Create a container for the command arguments */
 
       args = nsh_cloneargs(bkgvtbl, fd, argc, argv);
@@ -749,11 +896,10 @@ errout:
  ****************************************************************************/
 
 #ifdef CONFIG_NSH_CMDPARMS
-static FAR char *nsh_filecat(FAR struct nsh_vtbl_s *vtbl, FAR char *s1,
+static FAR char *nsh_filecat(FAR struct nsh_vtbl_s *vtbl,
                              FAR const char *filename)
 {
   struct stat buf;
-  size_t s1size = 0;
   size_t allocsize;
   ssize_t nbytesread;
   FAR char *argument;
@@ -761,13 +907,6 @@ static FAR char *nsh_filecat(FAR struct nsh_vtbl_s *vtbl, FAR char *s1,
   int fd;
   int ret;
 
-  /* Get the size of the string */
-
-  if (s1)
-    {
-      s1size = (size_t)strlen(s1);
-    }
-
   /* Get the size of file */
 
   ret = stat(filename, &buf);
@@ -779,8 +918,8 @@ static FAR char *nsh_filecat(FAR struct nsh_vtbl_s *vtbl, FAR char *s1,
 
   /* Get the total allocation size */
 
-  allocsize = s1size + (size_t)buf.st_size + 1;
-  argument = (FAR char *)realloc(s1, allocsize);
+  allocsize = (size_t)buf.st_size + 1;
+  argument  = nsh_arena_alloc(vtbl, allocsize);
   if (!argument)
     {
       nsh_output(vtbl, g_fmtcmdoutofmemory, "``");
@@ -793,14 +932,14 @@ static FAR char *nsh_filecat(FAR struct nsh_vtbl_s *vtbl, FAR char *s1,
   if (fd < 0)
     {
       nsh_output(vtbl, g_fmtcmdfailed,  "``", "open", NSH_ERRNO);
-      goto errout_with_alloc;
+      return NULL;
     }
 
   /* Now copy the file.  Loop until the entire file has been transferred to
-   * the allocated string (after the original contents of s1size bytes.
+   * the allocated string.
    */
 
-  for (index = s1size; index < allocsize - 1; )
+  for (index = 0; index < allocsize - 1; )
     {
       /* Loop until we successfully read something , we encounter the
        * end-of-file, or until a read error occurs
@@ -853,9 +992,6 @@ static FAR char *nsh_filecat(FAR struct nsh_vtbl_s *vtbl, FAR char *s1,
 
 errout_with_fd:
   close(fd);
-
-errout_with_alloc:
-  free(argument);
   return NULL;
 }
 #endif
@@ -865,30 +1001,27 @@ errout_with_alloc:
  ****************************************************************************/
 
 #ifdef CONFIG_NSH_CMDPARMS
-static FAR char *nsh_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
-                             FAR char **allocation)
+static FAR char *nsh_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
 {
   FAR char *tmpfile;
   FAR char *argument;
+  size_t len;
   int ret;
 
-  /* We cannot process the command argument if there is no allocation pointer */
-
-  if (!allocation)
-    {
-      return (FAR char *)g_nullstring;
-    }
-
-  /* Create a unique file name using the task ID */
+  /* Create a unique file name using the task ID.  "/TMP" plus up to 11
+   * digits plus ".dat" plus the NUL terminator.
+   */
 
-  tmpfile = NULL;
-  ret = asprintf(&tmpfile, "%s/TMP%d.dat", CONFIG_LIBC_TMPDIR, getpid());
-  if (ret < 0 || !tmpfile)
+  len     = strlen(CONFIG_LIBC_TMPDIR) + 20;
+  tmpfile = nsh_arena_alloc(vtbl, len);
+  if (!tmpfile)
     {
       nsh_output(vtbl, g_fmtcmdoutofmemory, "``");
       return (FAR char *)g_nullstring;
     }
 
+  snprintf(tmpfile, len, "%s/TMP%d.dat", CONFIG_LIBC_TMPDIR, getpid());
+
   /* Execute the command that will re-direct the output of the command to
    * the temporary file.  This is a simple command that can't handle most
    * options.
@@ -900,16 +1033,14 @@ static FAR char *nsh_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
       /* Report the failure */
 
       nsh_output(vtbl, g_fmtcmdfailed, "``", "exec", NSH_ERRNO);
-      free(tmpfile);
       return (FAR char *)g_nullstring;
     }
 
-  /* Concatenate the file contents with the current allocation */
+  /* Read the file contents into the arena */
 
-  argument    = nsh_filecat(vtbl, *allocation, tmpfile);
-  *allocation = argument;
+  argument = nsh_filecat(vtbl, tmpfile);
 
-  /* We can now unlink the tmpfile and free the tmpfile string */
+  /* We can now unlink the tmpfile */
 
   ret = unlink(tmpfile);
   if (ret < 0)
@@ -917,8 +1048,7 @@ static FAR char *nsh_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
       nsh_output(vtbl, g_fmtcmdfailed, "``", "unlink", NSH_ERRNO);
     }
 
-  free(tmpfile);
-  return argument;
+  return argument ? argument : (FAR char *)g_nullstring;
 }
 #endif
 
@@ -931,8 +1061,8 @@ static FAR char *nsh_strcat(FAR struct nsh_vtbl_s *vtbl, FAR char *s1,
                             FAR const char *s2)
 {
   FAR char *argument;
-  int s1size = 0;
-  int allocsize;
+  size_t s1size = 0;
+  size_t allocsize;
 
   /* Get the size of the first string... it might be NULL */
 
@@ -946,7 +1076,7 @@ static FAR char *nsh_strcat(FAR struct nsh_vtbl_s *vtbl, FAR char *s1,
    */
 
   allocsize = s1size + strlen(s2) + 1;
-  argument  = (FAR char *)realloc(s1, allocsize);
+  argument  = nsh_arena_realloc(vtbl, s1, s1 ? s1size + 1 : 0, allocsize);
   if (!argument)
     {
       nsh_output(vtbl, g_fmtcmdoutofmemory, "$");
@@ -1007,9 +1137,8 @@ static FAR char *nsh_envexpand(FAR struct nsh_vtbl_s *vtbl,
  * Name: nsh_argexpand
  ****************************************************************************/
 
-#if defined(CONFIG_NSH_ARGCAT) && defined(HAVE_MEMLIST)
-static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
-                               FAR char **allocation)
+#ifdef CONFIG_NSH_ARGCAT
+static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
 {
   FAR char *working = cmdline;
   FAR char *argument = NULL;
@@ -1043,9 +1172,7 @@ static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
                * value value of argument
                */
 
-              argument    = nsh_strcat(vtbl, argument, working);
-              *allocation = argument;
-              return argument;
+              return nsh_strcat(vtbl, argument, working);
             }
           else
             {
@@ -1061,7 +1188,6 @@ static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
 
       if (*ptr == '`')
         {
-          FAR char *tmpalloc = NULL;
           FAR char *result;
           FAR char *rptr;
 
@@ -1069,9 +1195,8 @@ static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
            * intervening character to the concatenated string.
            */
 
-          *ptr++      = '\0';
-          argument    = nsh_strcat(vtbl, argument, working);
-          *allocation = argument;
+          *ptr++   = '\0';
+          argument = nsh_strcat(vtbl, argument, working);
 
           /* Find the closing backquote */
 
@@ -1090,23 +1215,15 @@ static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
            * error, nsh_cmdparm may return g_nullstring but never NULL.
            */
 
-          result = nsh_cmdparm(vtbl, ptr, &tmpalloc);
+          result = nsh_cmdparm(vtbl, ptr);
 
           /* Concatenate the result of the operation with the accumulated
            * string.  On failures to allocation memory, nsh_strcat will
            * just return value value of argument
            */
 
-          argument    = nsh_strcat(vtbl, argument, result);
-          *allocation = argument;
-          working     = rptr + 1;
-
-          /* And free any temporary allocations */
-
-          if (tmpalloc)
-            {
-              free(tmpalloc);
-            }
+          argument = nsh_strcat(vtbl, argument, result);
+          working  = rptr + 1;
         }
       else
 #endif
@@ -1123,9 +1240,8 @@ static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
            * intervening character to the concatenated string.
            */
 
-          *ptr++      = '\0';
-          argument    = nsh_strcat(vtbl, argument, working);
-          *allocation = argument;
+          *ptr++   = '\0';
+          argument = nsh_strcat(vtbl, argument, working);
 
           /* Find the end of the environment variable reference.  If the
            * dollar sign ('$') is followed by a right bracket ('{') then the
@@ -1179,8 +1295,7 @@ static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
            * just return value value of argument
            */
 
-          argument    = nsh_strcat(vtbl, argument, envstr);
-          *allocation = argument;
+          argument = nsh_strcat(vtbl, argument, envstr);
         }
       else
 #endif
@@ -1195,8 +1310,7 @@ static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
 }
 
 #else
-static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
-                               FAR char **allocation)
+static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
 {
   FAR char *argument = (FAR char *)g_nullstring;
 
@@ -1222,7 +1336,7 @@ static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
 
       /* Then execute the command to get the parameter value */
 
-      argument = nsh_cmdparm(vtbl, cmdline + 1, allocation);
+      argument = nsh_cmdparm(vtbl, cmdline + 1);
     }
   else
 #endif
@@ -1253,12 +1367,10 @@ static FAR char *nsh_argexpand(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
  * Name: nsh_argument
  ****************************************************************************/
 
-static FAR char *nsh_argument(FAR struct nsh_vtbl_s *vtbl, FAR char **saveptr,
-                              FAR NSH_MEMLIST_TYPE *memlist)
+static FAR char *nsh_argument(FAR struct nsh_vtbl_s *vtbl, FAR char **saveptr)
 {
   FAR char *pbegin     = *saveptr;
   FAR char *pend       = NULL;
-  FAR char *allocation = NULL;
   FAR char *argument   = NULL;
   FAR const char *term;
 #ifdef CONFIG_NSH_CMDPARMS
@@ -1397,16 +1509,9 @@ static FAR char *nsh_argument(FAR struct nsh_vtbl_s *vtbl, FAR char **saveptr,
 
       /* Perform expansions as necessary for the argument */
 
-      argument = nsh_argexpand(vtbl, pbegin, &allocation);
+      argument = nsh_argexpand(vtbl, pbegin);
     }
 
-  /* If any memory was allocated for this argument, make sure that it is
-   * added to the list of memory to be freed at the end of commend
-   * processing.
-   */
-
-  NSH_MEMLIST_ADD(memlist, allocation);
-
   /* Return the parsed argument. */
 
   return argument;
@@ -1495,7 +1600,7 @@ static bool nsh_cmdenabled(FAR struct nsh_vtbl_s *vtbl)
 
 #if !defined(CONFIG_NSH_DISABLESCRIPT) && !defined(CONFIG_NSH_DISABLE_LOOPS)
 static int nsh_loop(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
-                    FAR char **saveptr, FAR NSH_MEMLIST_TYPE *memlist)
+                    FAR char **saveptr)
 {
   FAR struct nsh_parser_s *np = &vtbl->np;
   FAR char *cmd = *ppcmd;
@@ -1518,7 +1623,7 @@ static int nsh_loop(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
 
           /* Get the cmd following the "while" or "until" */
 
-          *ppcmd = nsh_argument(vtbl, saveptr, memlist);
+          *ppcmd = nsh_argument(vtbl, saveptr);
           if (!*ppcmd)
             {
               nsh_output(vtbl, g_fmtarginvalid, "if");
@@ -1533,7 +1638,7 @@ static int nsh_loop(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
 #endif
               np->np_lpstate[np->np_lpndx].lp_state == NSH_LOOP_WHILE ||
               np->np_lpstate[np->np_lpndx].lp_state == NSH_LOOP_UNTIL ||
-              np->np_stream == NULL || np->np_foffs < 0)
+              !nsh_inscript(np) || np->np_foffs < 0)
             {
               nsh_output(vtbl, g_fmtcontext, cmd);
               goto errout;
@@ -1575,7 +1680,7 @@ static int nsh_loop(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
         {
           /* Get the cmd following the "do" -- there may or may not be one */
 
-          *ppcmd = nsh_argument(vtbl, saveptr, memlist);
+          *ppcmd = nsh_argument(vtbl, saveptr);
 
           /* Verify that "do" is valid in this context */
 
@@ -1595,7 +1700,7 @@ static int nsh_loop(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
         {
           /* Get the cmd following the "done" -- there should be one */
 
-          *ppcmd = nsh_argument(vtbl, saveptr, memlist);
+          *ppcmd = nsh_argument(vtbl, saveptr);
           if (*ppcmd)
             {
               nsh_output(vtbl, g_fmtarginvalid, "done");
@@ -1625,13 +1730,25 @@ static int nsh_loop(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
             {
                /* Set the new file position to the top of the loop offset */
 
-               ret = fseek(np->np_stream,
-                           np->np_lpstate[np->np_lpndx].lp_topoffs,
-                           SEEK_SET);
-               if (ret <  0)
-                {
-                  nsh_output(vtbl, g_fmtcmdfailed, "done", "fseek", NSH_ERRNO);
-                }
+#ifdef CONFIG_NSH_SCRIPT_PRELOAD
+               if (np->np_image != NULL)
+                 {
+                   /* The script is in memory; just move the read position */
+
+                   np->np_imgpos = np->np_lpstate[np->np_lpndx].lp_topoffs;
+                 }
+               else
+#endif
+                 {
+                   ret = fseek(np->np_stream,
+                               np->np_lpstate[np->np_lpndx].lp_topoffs,
+                               SEEK_SET);
+                   if (ret <  0)
+                    {
+                      nsh_output(vtbl, g_fmtcmdfailed, "done", "fseek",
+                                 NSH_ERRNO);
+                    }
+                 }
 
 #ifndef NSH_DISABLE_SEMICOLON
                /* Signal nsh_parse that we need to stop processing the
@@ -1686,7 +1803,7 @@ errout:
 
 #if !defined(CONFIG_NSH_DISABLESCRIPT) && !defined(CONFIG_NSH_DISABLE_ITEF)
 static int nsh_itef(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
-                    FAR char **saveptr, FAR NSH_MEMLIST_TYPE *memlist)
+                    FAR char **saveptr)
 {
   FAR struct nsh_parser_s *np = &vtbl->np;
   FAR char *cmd = *ppcmd;
@@ -1700,7 +1817,7 @@ static int nsh_itef(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
         {
           /* Get the cmd following the if */
 
-          *ppcmd = nsh_argument(vtbl, saveptr, memlist);
+          *ppcmd = nsh_argument(vtbl, saveptr);
           if (!*ppcmd)
             {
               nsh_output(vtbl, g_fmtarginvalid, "if");
@@ -1738,7 +1855,7 @@ static int nsh_itef(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
         {
           /* Get the cmd following the "then" -- there may or may not be one */
 
-          *ppcmd = nsh_argument(vtbl, saveptr, memlist);
+          *ppcmd = nsh_argument(vtbl, saveptr);
 
           /* Verify that "then" is valid in this context */
 
@@ -1757,7 +1874,7 @@ static int nsh_itef(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
         {
           /* Get the cmd following the "else" -- there may or may not be one */
 
-          *ppcmd = nsh_argument(vtbl, saveptr, memlist);
+          *ppcmd = nsh_argument(vtbl, saveptr);
 
           /* Verify that "else" is valid in this context */
 
@@ -1776,7 +1893,7 @@ static int nsh_itef(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
         {
           /* Get the cmd following the fi -- there should be one */
 
-          *ppcmd = nsh_argument(vtbl, saveptr, memlist);
+          *ppcmd = nsh_argument(vtbl, saveptr);
           if (*ppcmd)
             {
               nsh_output(vtbl, g_fmtarginvalid, "fi");
@@ -1829,7 +1946,7 @@ errout:
 
 #ifndef CONFIG_NSH_DISABLEBG
 static int nsh_nice(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
-                    FAR char **saveptr, FAR NSH_MEMLIST_TYPE *memlist)
+                    FAR char **saveptr)
 {
   FAR char *cmd = *ppcmd;
 
@@ -1848,10 +1965,10 @@ static int nsh_nice(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
 
           /* Get the cmd (or -d option of nice command) */
 
-          cmd = nsh_argument(vtbl, saveptr, memlist);
+          cmd = nsh_argument(vtbl, saveptr);
           if (cmd && strcmp(cmd, "-d") == 0)
             {
-              FAR char *val = nsh_argument(vtbl, saveptr, memlist);
+              FAR char *val = nsh_argument(vtbl, saveptr);
               if (val)
                 {
                   char *endptr;
@@ -1862,7 +1979,7 @@ static int nsh_nice(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
                       nsh_output(vtbl, g_fmtarginvalid, "nice");
                       return ERROR;
                     }
-                  cmd = nsh_argument(vtbl, saveptr, memlist);
+                  cmd = nsh_argument(vtbl, saveptr);
                 }
             }
 
@@ -1894,7 +2011,7 @@ static int nsh_nice(FAR struct nsh_vtbl_s *vtbl, FAR char **ppcmd,
 static int nsh_parse_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
                              FAR const char *redirfile)
 {
-  NSH_MEMLIST_TYPE memlist;
+  NSH_ARENA_TYPE mark;
   FAR char *argv[MAX_ARGV_ENTRIES];
   FAR char *saveptr;
   FAR char *cmd;
@@ -1908,7 +2025,7 @@ static int nsh_parse_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
   /* Initialize parser state */
 
   memset(argv, 0, MAX_ARGV_ENTRIES*sizeof(FAR char *));
-  NSH_MEMLIST_INIT(memlist);
+  NSH_ARENA_MARK(vtbl, mark);
 
   /* If any options like nice, redirection, or backgrounding are attempted,
    * these will not be recognized and will just be passed through as
@@ -1932,7 +2049,7 @@ static int nsh_parse_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
   /* Parse out the command at the beginning of the line */
 
   saveptr = cmdline;
-  cmd = nsh_argument(vtbl, &saveptr, &memlist);
+  cmd = nsh_argument(vtbl, &saveptr);
 
   /* Check if any command was provided -OR- if command processing is
    * currently disabled.
@@ -1949,7 +2066,7 @@ static int nsh_parse_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
        * status.
        */
 
-      NSH_MEMLIST_FREE(&memlist);
+      NSH_ARENA_RELEASE(vtbl, mark);
       return OK;
     }
 
@@ -1966,7 +2083,7 @@ static int nsh_parse_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
   argv[0] = cmd;
   for (argc = 1; argc < MAX_ARGV_ENTRIES-1; argc++)
     {
-      argv[argc] = nsh_argument(vtbl, &saveptr, &memlist);
+      argv[argc] = nsh_argument(vtbl, &saveptr);
       if (!argv[argc])
         {
           break;
@@ -1993,7 +2110,7 @@ static int nsh_parse_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
 #endif
   vtbl->np.np_redirect = redirsave;
 
-  NSH_MEMLIST_FREE(&memlist);
+  NSH_ARENA_RELEASE(vtbl, mark);
   return ret;
 }
 #endif
@@ -2008,7 +2125,7 @@ static int nsh_parse_cmdparm(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
 
 static int nsh_parse_command(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
 {
-  NSH_MEMLIST_TYPE memlist;
+  NSH_ARENA_TYPE mark;
   FAR char *argv[MAX_ARGV_ENTRIES];
   FAR char *saveptr;
   FAR char *cmd;
@@ -2020,7 +2137,7 @@ static int nsh_parse_command(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
   /* Initialize parser state */
 
   memset(argv, 0, MAX_ARGV_ENTRIES*sizeof(FAR char *));
-  NSH_MEMLIST_INIT(memlist);
+  NSH_ARENA_MARK(vtbl, mark);
 
 #ifndef CONFIG_NSH_DISABLEBG
   vtbl->np.np_bg       = false;
@@ -2033,15 +2150,15 @@ static int nsh_parse_command(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
   /* Parse out the command at the beginning of the line */
 
   saveptr = cmdline;
-  cmd = nsh_argument(vtbl, &saveptr, &memlist);
+  cmd = nsh_argument(vtbl, &saveptr);
 
 #ifndef CONFIG_NSH_DISABLESCRIPT
 #ifndef CONFIG_NSH_DISABLE_LOOPS
   /* Handle while-do-done and until-do-done loops */
 
-  if (nsh_loop(vtbl, &cmd, &saveptr, &memlist) != 0)
+  if (nsh_loop(vtbl, &cmd, &saveptr) != 0)
     {
-      NSH_MEMLIST_FREE(&memlist);
+      NSH_ARENA_RELEASE(vtbl, mark);
       return nsh_saveresult(vtbl, true);
     }
 #endif
@@ -2049,9 +2166,9 @@ static int nsh_parse_command(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
 #ifndef CONFIG_NSH_DISABLE_ITEF
   /* Handle if-then-else-fi */
 
-  if (nsh_itef(vtbl, &cmd, &saveptr, &memlist) != 0)
+  if (nsh_itef(vtbl, &cmd, &saveptr) != 0)
     {
-      NSH_MEMLIST_FREE(&memlist);
+      NSH_ARENA_RELEASE(vtbl, mark);
       return nsh_saveresult(vtbl, true);
     }
 
@@ -2061,9 +2178,9 @@ static int nsh_parse_command(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
   /* Handle nice */
 
 #ifndef CONFIG_NSH_DISABLEBG
-  if (nsh_nice(vtbl, &cmd, &saveptr, &memlist) != 0)
+  if (nsh_nice(vtbl, &cmd, &saveptr) != 0)
     {
-      NSH_MEMLIST_FREE(&memlist);
+      NSH_ARENA_RELEASE(vtbl, mark);
       return nsh_saveresult(vtbl, true);
     }
 #endif
@@ -2083,7 +2200,7 @@ static int nsh_parse_command(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
        * status.
        */
 
-      NSH_MEMLIST_FREE(&memlist);
+      NSH_ARENA_RELEASE(vtbl, mark);
       return OK;
     }
 
@@ -2103,7 +2220,7 @@ static int nsh_parse_command(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
   argv[0] = cmd;
   for (argc = 1; argc < MAX_ARGV_ENTRIES-1; argc++)
     {
-      argv[argc] = nsh_argument(vtbl, &saveptr, &memlist);
+      argv[argc] = nsh_argument(vtbl, &saveptr);
       if (!argv[argc])
         {
           break;
@@ -2150,6 +2267,25 @@ static int nsh_parse_command(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
     }
 #endif
 
+#ifdef CONFIG_NSH_PIPES
+  /* Is this the writer of a pipeline stage?  Then it runs in background
+   * with its output going into the FIFO.
+   */
+
+  if (vtbl->np.np_pipeout != NULL)
+    {
+      if (redirfile != NULL)
+        {
+          nsh_freefullpath(redirfile);
+        }
+
+      vtbl->np.np_bg       = true;
+      vtbl->np.np_redirect = true;
+      oflags               = O_WRONLY;
+      redirfile            = nsh_getfullpath(vtbl, vtbl->np.np_pipeout);
+    }
+#endif
+
   /* Check if the maximum number of arguments was exceeded */
 
   if (argc > CONFIG_NSH_MAXARGUMENTS)
@@ -2157,9 +2293,12 @@ static int nsh_parse_command(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
       nsh_output(vtbl, g_fmttoomanyargs, cmd);
     }
 
-  /* Then execute the command */
+  /* Then execute the command and write out any output that it left in
+   * the output buffer.
+   */
 
   ret = nsh_execute(vtbl, argc, argv, redirfile, oflags);
+  nsh_flush(vtbl);
 
   /* Free any allocated resources */
 
@@ -2172,10 +2311,301 @@ static int nsh_parse_command(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
     }
 #endif
 
-  NSH_MEMLIST_FREE(&memlist);
+  NSH_ARENA_RELEASE(vtbl, mark);
   return ret;
 }
 
+/****************************************************************************
+ * Name: nsh_pipefds_add
+ *
+ * Description:
+ *   Record a FIFO descriptor that NSH holds for a pipeline.  Fails with
+ *   EMFILE if NSH_PIPE_MAXFDS descriptors are recorded already.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_PIPES
+static int nsh_pipefds_add(FAR struct nsh_pipefds_s *pf, int fd)
+{
+  int ret = ERROR;
+  int i;
+
+  sched_lock();
+  for (i = 0; i < NSH_PIPE_MAXFDS; i++)
+    {
+      if (pf->pf_fd[i] < 0)
+        {
+          pf->pf_fd[i] = fd;
+          ret = OK;
+          break;
+        }
+    }
+
+  sched_unlock();
+
+  if (ret < 0)
+    {
+      set_errno(EMFILE);
+    }
+
+  return ret;
+}
+#endif
+
+/****************************************************************************
+ * Name: nsh_pipefds_remove
+ *
+ * Description:
+ *   Forget a descriptor recorded by nsh_pipefds_add().  This must be done
+ *   before the descriptor is closed.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_PIPES
+static void nsh_pipefds_remove(FAR struct nsh_pipefds_s *pf, int fd)
+{
+  int i;
+
+  if (pf != NULL)
+    {
+      sched_lock();
+      for (i = 0; i < NSH_PIPE_MAXFDS; i++)
+        {
+          if (pf->pf_fd[i] == fd)
+            {
+              pf->pf_fd[i] = -1;
+              break;
+            }
+        }
+
+      sched_unlock();
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: nsh_pipefds_release
+ *
+ * Description:
+ *   Drop a reference to the pipeline record and free it with the last one.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_PIPES
+static void nsh_pipefds_release(FAR struct nsh_pipefds_s *pf)
+{
+  bool last;
+
+  if (pf != NULL)
+    {
+      sched_lock();
+      last = (--pf->pf_refs == 0);
+      sched_unlock();
+
+      if (last)
+        {
+          free(pf);
+        }
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: nsh_pipestage
+ *
+ * Description:
+ *   Prepare the clone of a background NSH command of a pipeline.  The
+ *   clone shares the pipeline record.  If the standard input of NSH is a
+ *   FIFO of the pipeline, the clone keeps its own copy of that, because
+ *   NSH replaces its standard input when it starts the next stage.  That
+ *   copy and the write end of the command, if it writes into a FIFO, are
+ *   recorded.  Nothing is left behind on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_PIPES
+static int nsh_pipestage(FAR struct nsh_vtbl_s *vtbl,
+                         FAR struct nsh_vtbl_s *bkgvtbl, int fd)
+{
+  FAR struct nsh_pipefds_s *pf = vtbl->np.np_pipefds;
+  int infd = -1;
+
+  if (vtbl->np.np_inpipe)
+    {
+      infd = dup(0);
+      if (infd < 0)
+        {
+          return ERROR;
+        }
+
+      if (nsh_pipefds_add(pf, infd) < 0)
+        {
+          (void)close(infd);
+          return ERROR;
+        }
+    }
+
+  if (vtbl->np.np_pipeout != NULL && nsh_pipefds_add(pf, fd) < 0)
+    {
+      if (infd >= 0)
+        {
+          nsh_pipefds_remove(pf, infd);
+          (void)close(infd);
+        }
+
+      return ERROR;
+    }
+
+  sched_lock();
+  pf->pf_refs++;
+  sched_unlock();
+
+  bkgvtbl->np.np_pipefds = pf;
+  bkgvtbl->np.np_pipein  = infd;
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: nsh_pipe
+ *
+ * Description:
+ *   Start 'cmdline' as the writer of one pipeline stage and make the read
+ *   end of its FIFO the standard input of NSH, so that it is inherited by
+ *   the next command.  The original standard input is saved in *savein
+ *   the first time.
+ *
+ *   The FIFO is opened for reading (without blocking) before the writer is
+ *   started so that the writer never sees a pipe without readers, and it
+ *   is unlinked once both ends are open.  The read end is recorded while
+ *   the writer is started, so that a writer task does not inherit it.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_PIPES
+static int nsh_pipe(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline,
+                    FAR int *savein)
+{
+  FAR struct nsh_pipefds_s *pf;
+  char fifopath[32];
+  int oflags;
+  int rdfd;
+  int ret;
+  int i;
+
+  if (*savein < 0)
+    {
+      *savein = dup(0);
+      if (*savein < 0)
+        {
+          nsh_output(vtbl, g_fmtcmdfailed, "|", "dup", NSH_ERRNO);
+          return ERROR;
+        }
+    }
+
+  /* The first stage creates the record of the pipeline's descriptors */
+
+  pf = vtbl->np.np_pipefds;
+  if (pf == NULL)
+    {
+      pf = (FAR struct nsh_pipefds_s *)malloc(sizeof(struct nsh_pipefds_s));
+      if (pf == NULL)
+        {
+          nsh_output(vtbl, g_fmtcmdoutofmemory, "|");
+          return ERROR;
+        }
+
+      pf->pf_refs = 1;
+      for (i = 0; i < NSH_PIPE_MAXFDS; i++)
+        {
+          pf->pf_fd[i] = -1;
+        }
+
+      vtbl->np.np_pipefds = pf;
+    }
+
+  snprintf(fifopath, sizeof(fifopath), "%s%d", CONFIG_NSH_PIPES_PREFIX,
+           (int)getpid());
+
+  ret = mkfifo(fifopath, 0666);
+  if (ret < 0)
+    {
+      nsh_output(vtbl, g_fmtcmdfailed, "|", "mkfifo", NSH_ERRNO);
+      return ERROR;
+    }
+
+  rdfd = open(fifopath, O_RDONLY | O_NONBLOCK);
+  if (rdfd < 0)
+    {
+      nsh_output(vtbl, g_fmtcmdfailed, "|", "open", NSH_ERRNO);
+      (void)unlink(fifopath);
+      return ERROR;
+    }
+
+  if (nsh_pipefds_add(pf, rdfd) < 0)
+    {
+      nsh_output(vtbl, g_fmtcmdfailed, "|", "open", NSH_ERRNO);
+      (void)close(rdfd);
+      (void)unlink(fifopath);
+      return ERROR;
+    }
+
+  /* Start the writer in background with its output going into the FIFO */
+
+  vtbl->np.np_pipeout = fifopath;
+  ret = nsh_parse_command(vtbl, cmdline);
+  vtbl->np.np_pipeout = NULL;
+
+  (void)unlink(fifopath);
+
+  if (ret == OK)
+    {
+      /* Reads by the next command should block until there is data */
+
+      oflags = fcntl(rdfd, F_GETFL);
+      (void)fcntl(rdfd, F_SETFL, oflags & ~O_NONBLOCK);
+
+      if (dup2(rdfd, 0) < 0)
+        {
+          nsh_output(vtbl, g_fmtcmdfailed, "|", "dup2", NSH_ERRNO);
+          ret = ERROR;
+        }
+      else
+        {
+          vtbl->np.np_inpipe = true;
+        }
+    }
+
+  nsh_pipefds_remove(pf, rdfd);
+  close(rdfd);
+  return ret;
+}
+#endif
+
+/****************************************************************************
+ * Name: nsh_unpipe
+ *
+ * Description:
+ *   Restore the standard input of NSH at the end of a pipeline and drop
+ *   the reference of NSH to the record of its descriptors.  Background
+ *   commands of the pipeline that still run keep the record.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_PIPES
+static void nsh_unpipe(FAR struct nsh_vtbl_s *vtbl, int savein)
+{
+  if (savein >= 0)
+    {
+      nsh_pipefds_release(vtbl->np.np_pipefds);
+      vtbl->np.np_pipefds = NULL;
+      vtbl->np.np_inpipe  = false;
+      (void)dup2(savein, 0);
+      close(savein);
+    }
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -2203,6 +2633,9 @@ int nsh_parse(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
   FAR char *working = cmdline;
   FAR char *ptr;
   size_t len;
+#ifdef CONFIG_NSH_PIPES
+  int savein = -1;
+#endif
   int ret;
 
   /* Loop until all of the commands on the command line have been processed OR
@@ -2242,7 +2675,13 @@ int nsh_parse(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
         {
           /* Parse the last command on the line */
 
+#ifdef CONFIG_NSH_PIPES
+          ret = nsh_parse_command(vtbl, start);
+          nsh_unpipe(vtbl, savein);
+          return ret;
+#else
           return nsh_parse_command(vtbl, start);
+#endif
         }
 
       /* Check for a command terminated with ';'.  There is probably another
@@ -2258,6 +2697,14 @@ int nsh_parse(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
           /* Parse this command */
 
           ret = nsh_parse_command(vtbl, start);
+
+#ifdef CONFIG_NSH_PIPES
+          /* This ends any pipeline */
+
+          nsh_unpipe(vtbl, savein);
+          savein = -1;
+#endif
+
           if (ret != OK)
             {
               /* nsh_parse_command may return (1) -1 (ERROR) meaning that the
@@ -2275,6 +2722,25 @@ int nsh_parse(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
           working = ptr;
         }
 
+#ifdef CONFIG_NSH_PIPES
+      /* Check for a command whose output is piped into the next command */
+
+      else if (*ptr == '|')
+        {
+          *ptr++ = '\0';
+
+          ret = nsh_pipe(vtbl, start, &savein);
+          if (ret != OK)
+            {
+              nsh_unpipe(vtbl, savein);
+              return ret;
+            }
+
+          start   = ptr;
+          working = ptr;
+        }
+#endif
+
       /* Check if we encountered a quoted string */
 
       else /* if (*ptr == '"') */
@@ -2297,11 +2763,98 @@ int nsh_parse(FAR struct nsh_vtbl_s *vtbl, FAR char *cmdline)
     }
 
 #ifndef CONFIG_NSH_DISABLESCRIPT
+#ifdef CONFIG_NSH_PIPES
+  nsh_unpipe(vtbl, savein);
+#endif
   return OK;
 #endif
 #endif
 }
 
+/****************************************************************************
+ * Name: nsh_execargv
+ *
+ * Description:
+ *   Run a command that has already been split into arguments in the
+ *   foreground, like a command from the command line.  The arguments are
+ *   used as they are:  They are not expanded or split again.  argv[argc]
+ *   must be NULL.
+ *
+ ****************************************************************************/
+
+int nsh_execargv(FAR struct nsh_vtbl_s *vtbl, int argc, FAR char *argv[])
+{
+#ifndef CONFIG_NSH_DISABLEBG
+  bool bgsave;
+#endif
+#if CONFIG_NFILE_STREAMS > 0
+  bool redirsave;
+#endif
+  int ret;
+
+  /* The command is neither backgrounded nor redirected */
+
+#ifndef CONFIG_NSH_DISABLEBG
+  bgsave               = vtbl->np.np_bg;
+  vtbl->np.np_bg       = false;
+#endif
+#if CONFIG_NFILE_STREAMS > 0
+  redirsave            = vtbl->np.np_redirect;
+  vtbl->np.np_redirect = false;
+#endif
+
+  ret = nsh_execute(vtbl, argc, argv, NULL, 0);
+  nsh_flush(vtbl);
+
+  /* Restore the backgrounding and redirection state */
+
+#ifndef CONFIG_NSH_DISABLEBG
+  vtbl->np.np_bg       = bgsave;
+#endif
+#if CONFIG_NFILE_STREAMS > 0
+  vtbl->np.np_redirect = redirsave;
+#endif
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: nsh_pipefds
+ *
+ * Description:
+ *   Copy the FIFO descriptors that NSH holds for the current pipeline to
+ *   fds[], which has room for NSH_PIPE_MAXFDS, and return their number.
+ *   A task that is started for the pipeline must close them, or the
+ *   other end of those FIFOs would not see the end of file or a broken
+ *   pipe when it should.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_PIPES
+int nsh_pipefds(FAR struct nsh_vtbl_s *vtbl, FAR int *fds)
+{
+  FAR struct nsh_pipefds_s *pf = vtbl->np.np_pipefds;
+  int nfds = 0;
+  int i;
+
+  if (pf != NULL)
+    {
+      sched_lock();
+      for (i = 0; i < NSH_PIPE_MAXFDS; i++)
+        {
+          if (pf->pf_fd[i] >= 0)
+            {
+              fds[nfds++] = pf->pf_fd[i];
+            }
+        }
+
+      sched_unlock();
+    }
+
+  return nfds;
+}
+#endif
+
 /****************************************************************************
  * Name: cmd_break
  ****************************************************************************/
@@ -0,0 +1,222 @@
+/****************************************************************************
+ * apps/nshlib/nsh_perfcmd.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <string.h>
+#include <fcntl.h>
+#include <errno.h>
+
+#include "system/perfcount.h"
+
+#include "nsh.h"
+#include "nsh_console.h"
+
+#if defined(CONFIG_SYSTEM_PERFCOUNT) && !defined(CONFIG_NSH_DISABLE_PERF)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: perf_show
+ *
+ * Description:
+ *   perf_foreach() visitor that shows one entry.  A histogram is shown as
+ *   its total count and maximum followed by the non-empty buckets, each
+ *   labelled with the bound below which its values lie.
+ *
+ ****************************************************************************/
+
+static int perf_show(FAR const struct perf_entry_s *entry, FAR void *arg)
+{
+  FAR struct nsh_vtbl_s *vtbl = (FAR struct nsh_vtbl_s *)arg;
+  FAR const struct perf_counter_s *counter;
+  FAR const struct perf_hist_s *hist;
+  uint32_t count;
+  uint32_t n;
+  int b;
+
+  if (entry->type == PERF_TYPE_COUNTER)
+    {
+      counter = (FAR const struct perf_counter_s *)entry;
+      nsh_output(vtbl, "%-24s %lu\n", entry->name,
+                 (unsigned long)counter->value);
+      return 0;
+    }
+
+  hist = (FAR const struct perf_hist_s *)entry;
+  for (b = 0, count = 0; b < CONFIG_SYSTEM_PERFCOUNT_NBUCKETS; b++)
+    {
+      count += hist->bucket[b];
+    }
+
+  nsh_output(vtbl, "%-24s count=%lu max=%lu\n", entry->name,
+             (unsigned long)count, (unsigned long)hist->max);
+
+  for (b = 0; b < CONFIG_SYSTEM_PERFCOUNT_NBUCKETS; b++)
+    {
+      n = hist->bucket[b];
+      if (n == 0)
+        {
+          continue;
+        }
+
+      if (b == CONFIG_SYSTEM_PERFCOUNT_NBUCKETS - 1)
+        {
+          nsh_output(vtbl, "  >=%-10lu %lu\n",
+                     b > 0 ? 1ul << (b - 1) : 0ul, (unsigned long)n);
+        }
+      else
+        {
+          nsh_output(vtbl, "  <%-11lu %lu\n", 1ul << b, (unsigned long)n);
+        }
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: cmd_perf
+ *
+ * Description:
+ *   perf [-r] [-b <path>] [<prefix>]
+ *
+ *   Show the performance counters whose names begin with <prefix>, or
+ *   write them to <path> in the binary format of perf_export().  -r
+ *   clears them afterwards.
+ *
+ ****************************************************************************/
+
+int cmd_perf(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
+{
+  FAR const char *prefix = NULL;
+  FAR char *path = NULL;
+  bool reset = false;
+  bool badarg = false;
+  ssize_t nwritten;
+  int ret = OK;
+  int option;
+  int fd;
+
+  while ((option = getopt(argc, argv, "b:r")) != ERROR)
+    {
+      switch (option)
+        {
+        case 'b':
+          path = optarg;
+          break;
+
+        case 'r':
+          reset = true;
+          break;
+
+        case '?':
+        default:
+          nsh_output(vtbl, g_fmtarginvalid, argv[0]);
+          badarg = true;
+          break;
+        }
+    }
+
+  if (badarg)
+    {
+      return ERROR;
+    }
+
+  if (optind < argc)
+    {
+      prefix = argv[optind++];
+    }
+
+  if (optind < argc)
+    {
+      nsh_output(vtbl, g_fmttoomanyargs, argv[0]);
+      return ERROR;
+    }
+
+  if (path == NULL)
+    {
+      (void)perf_foreach(prefix, perf_show, vtbl);
+    }
+  else
+    {
+      path = nsh_getfullpath(vtbl, path);
+      if (path == NULL)
+        {
+          nsh_output(vtbl, g_fmtcmdoutofmemory, argv[0]);
+          return ERROR;
+        }
+
+      fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+      if (fd < 0)
+        {
+          nsh_output(vtbl, g_fmtcmdfailed, argv[0], "open", NSH_ERRNO);
+          nsh_freefullpath(path);
+          return ERROR;
+        }
+
+      nwritten = perf_export(fd, prefix);
+      if (nwritten < 0)
+        {
+          nsh_output(vtbl, g_fmtcmdfailed, argv[0], "write",
+                     NSH_ERRNO_OF(-nwritten));
+          ret = ERROR;
+        }
+
+      close(fd);
+      nsh_freefullpath(path);
+    }
+
+  if (reset && ret == OK)
+    {
+      perf_reset(prefix);
+    }
+
+  return ret;
+}
+
+#endif /* CONFIG_SYSTEM_PERFCOUNT && !CONFIG_NSH_DISABLE_PERF */
@@ -39,6 +39,8 @@
 
 #include <nuttx/config.h>
 
+#include <sys/types.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -46,8 +48,12 @@
 #include <ctype.h>
 #include <fcntl.h>
 #include <dirent.h>
+#include <sched.h>
 #include <errno.h>
 
+#include <nuttx/sched.h>
+#include <nuttx/clock.h>
+
 #include "nsh.h"
 #include "nsh_console.h"
 
@@ -71,6 +77,33 @@
 #  undef HAVE_GROUPID
 #endif
 
+/* top: Default delay between samples in seconds */
+
+#define TOP_DEFAULT_DELAY 1
+
+/* Rate at which the CPU load counters are incremented.  Each CPU adds one
+ * count per CPU load tick to the total.
+ */
+
+#ifdef CONFIG_SCHED_CPULOAD_EXTCLK
+#  define TOP_CPULOAD_TICKSPERSEC CONFIG_SCHED_CPULOAD_TICKSPERSEC
+#else
+#  define TOP_CPULOAD_TICKSPERSEC TICK_PER_SEC
+#endif
+
+#ifdef CONFIG_SMP
+#  define TOP_NCPUS CONFIG_SMP_NCPUS
+#else
+#  define TOP_NCPUS 1
+#endif
+
+/* Allowed mismatch between the change in the CPU load total and the elapsed
+ * time.  This covers one system timer tick of quantization.
+ */
+
+#define TOP_TOLERANCE \
+  (TOP_NCPUS * (TOP_CPULOAD_TICKSPERSEC / TICK_PER_SEC + 2))
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -106,6 +139,33 @@ struct nsh_taskstatus_s
 #endif
 };
 
+/* These structures hold one sample of the task list for the top command.
+ * They are filled in directly from the TCBs so that no procfs files have to
+ * be opened or parsed.
+ */
+
+#ifndef CONFIG_NSH_DISABLE_TOP
+struct top_task_s
+{
+  pid_t    tt_pid;                 /* Task ID */
+  uint8_t  tt_priority;            /* Current priority */
+  uint8_t  tt_state;               /* Task state (see enum tstate_e) */
+  uint16_t tt_load;                /* CPU load in tenths of a percent */
+  uint32_t tt_active;              /* CPU load counter of the task */
+#if CONFIG_TASK_NAME_SIZE > 0
+  char     tt_name[CONFIG_TASK_NAME_SIZE + 1];
+#endif
+};
+
+struct top_sample_s
+{
+  clock_t  ts_systime;             /* System time when sampled */
+  uint32_t ts_total;               /* Total of all CPU load counters */
+  int      ts_ntasks;              /* Number of valid entries in ts_task[] */
+  struct top_task_s ts_task[CONFIG_MAX_TASKS];
+};
+#endif
+
 /* Status strings */
 
 #ifndef CONFIG_NSH_DISABLE_PS
@@ -547,6 +607,244 @@ static int ps_callback(FAR struct nsh_vtbl_s *vtbl, FAR const char *dirpath,
 }
 #endif
 
+/****************************************************************************
+ * Name: top_callback
+ *
+ * Description:
+ *   Called by sched_foreach() for each task with interrupts disabled.  Only
+ *   copy the information that is needed; output is done later.
+ *
+ ****************************************************************************/
+
+#ifndef CONFIG_NSH_DISABLE_TOP
+static void top_callback(FAR struct tcb_s *tcb, FAR void *arg)
+{
+  FAR struct top_sample_s *sample = (FAR struct top_sample_s *)arg;
+  FAR struct top_task_s *task;
+  struct cpuload_s cpuload;
+
+  if (sample->ts_ntasks >= CONFIG_MAX_TASKS ||
+      clock_cpuload(tcb->pid, &cpuload) < 0)
+    {
+      return;
+    }
+
+  task              = &sample->ts_task[sample->ts_ntasks++];
+  task->tt_pid      = tcb->pid;
+  task->tt_priority = tcb->sched_priority;
+  task->tt_state    = tcb->task_state;
+  task->tt_load     = 0;
+  task->tt_active   = cpuload.active;
+  sample->ts_total  = cpuload.total;
+
+#if CONFIG_TASK_NAME_SIZE > 0
+  strncpy(task->tt_name, tcb->name, CONFIG_TASK_NAME_SIZE);
+  task->tt_name[CONFIG_TASK_NAME_SIZE] = '\0';
+#endif
+}
+#endif
+
+/****************************************************************************
+ * Name: top_sample
+ ****************************************************************************/
+
+#ifndef CONFIG_NSH_DISABLE_TOP
+static void top_sample(FAR struct top_sample_s *sample)
+{
+  sample->ts_ntasks  = 0;
+  sample->ts_total   = 0;
+  sample->ts_systime = clock_systimer();
+
+  sched_foreach(top_callback, sample);
+}
+#endif
+
+/****************************************************************************
+ * Name: top_calcload
+ *
+ * Description:
+ *   Compute the CPU load of each task in 'cur' over the interval since
+ *   'prev'.  The kernel halves all CPU load counters periodically.  If that
+ *   happened during the interval, the change in the total will not match
+ *   the elapsed time and the load since the last halving is used instead.
+ *
+ ****************************************************************************/
+
+#ifndef CONFIG_NSH_DISABLE_TOP
+static void top_calcload(FAR const struct top_sample_s *prev,
+                         FAR struct top_sample_s *cur)
+{
+  uint32_t dtotal = 0;
+  bool delta = false;
+  int i;
+  int j;
+
+  if (cur->ts_total > prev->ts_total)
+    {
+      uint32_t expected;
+
+      expected = (uint32_t)((uint64_t)(cur->ts_systime - prev->ts_systime) *
+                            TOP_CPULOAD_TICKSPERSEC * TOP_NCPUS /
+                            TICK_PER_SEC);
+      dtotal   = cur->ts_total - prev->ts_total;
+      delta    = (dtotal + TOP_TOLERANCE >= expected &&
+                  dtotal <= expected + TOP_TOLERANCE);
+    }
+
+  for (i = 0; i < cur->ts_ntasks; i++)
+    {
+      FAR struct top_task_s *task = &cur->ts_task[i];
+      uint32_t active = task->tt_active;
+      uint32_t total  = cur->ts_total;
+      uint32_t load;
+
+      if (delta)
+        {
+          /* A task that was not in the previous sample was started during
+           * the interval, so all of its count belongs to the interval.
+           */
+
+          for (j = 0; j < prev->ts_ntasks; j++)
+            {
+              if (prev->ts_task[j].tt_pid == task->tt_pid)
+                {
+                  if (active >= prev->ts_task[j].tt_active)
+                    {
+                      active -= prev->ts_task[j].tt_active;
+                    }
+
+                  break;
+                }
+            }
+
+          total = dtotal;
+        }
+
+      load = 0;
+      if (total > 0)
+        {
+          load = (uint32_t)(((uint64_t)active * 1000 + total / 2) / total);
+          if (load > 1000)
+            {
+              load = 1000;
+            }
+        }
+
+      task->tt_load = (uint16_t)load;
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: top_compare
+ *
+ * Description:
+ *   qsort() comparison:  Highest load first, then by task ID.
+ *
+ ****************************************************************************/
+
+#ifndef CONFIG_NSH_DISABLE_TOP
+static int top_compare(FAR const void *a, FAR const void *b)
+{
+  FAR const struct top_task_s *ta = (FAR const struct top_task_s *)a;
+  FAR const struct top_task_s *tb = (FAR const struct top_task_s *)b;
+
+  if (ta->tt_load != tb->tt_load)
+    {
+      return (int)tb->tt_load - (int)ta->tt_load;
+    }
+
+  return (int)ta->tt_pid - (int)tb->tt_pid;
+}
+#endif
+
+/****************************************************************************
+ * Name: top_statename
+ ****************************************************************************/
+
+#ifndef CONFIG_NSH_DISABLE_TOP
+static FAR const char *top_statename(uint8_t state)
+{
+  if (state == TSTATE_TASK_RUNNING)
+    {
+      return "Running";
+    }
+  else if (state == TSTATE_TASK_INACTIVE)
+    {
+      return "Inactive";
+    }
+  else if (state == TSTATE_TASK_INVALID)
+    {
+      return "Invalid";
+    }
+  else if (state < TSTATE_TASK_INACTIVE)
+    {
+      return "Ready";
+    }
+
+  return "Waiting";
+}
+#endif
+
+/****************************************************************************
+ * Name: top_show
+ ****************************************************************************/
+
+#ifndef CONFIG_NSH_DISABLE_TOP
+static void top_show(FAR struct nsh_vtbl_s *vtbl,
+                     FAR struct top_sample_s *sample, bool batch)
+{
+  FAR struct top_task_s *task;
+  FAR const char *name;
+  int i;
+
+  if (!batch)
+    {
+      /* Show the busiest tasks first */
+
+      qsort(sample->ts_task, sample->ts_ntasks, sizeof(struct top_task_s),
+            top_compare);
+
+      nsh_output(vtbl, "%5s %3s %-8s %6s %s\n",
+                 "PID", "PRI", "STATE", "CPU", "COMMAND");
+    }
+
+  for (i = 0; i < sample->ts_ntasks; i++)
+    {
+      task = &sample->ts_task[i];
+
+#if CONFIG_TASK_NAME_SIZE > 0
+      name = task->tt_name;
+#else
+      name = "<noname>";
+#endif
+
+      if (batch)
+        {
+          /* One line per task:  <pid> <priority> <state> <load> <name> with
+           * the load in tenths of a percent.
+           */
+
+          nsh_output(vtbl, "%d %d %s %d %s\n",
+                     (int)task->tt_pid, task->tt_priority,
+                     top_statename(task->tt_state), task->tt_load, name);
+        }
+      else
+        {
+          nsh_output(vtbl, "%5d %3d %-8s %3d.%1d%% %s\n",
+                     (int)task->tt_pid, task->tt_priority,
+                     top_statename(task->tt_state),
+                     task->tt_load / 10, task->tt_load % 10, name);
+        }
+    }
+
+  /* An empty line terminates each sample */
+
+  nsh_output(vtbl, "\n");
+  nsh_flush(vtbl);
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -619,6 +917,108 @@ int cmd_ps(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
 }
 #endif
 
+/****************************************************************************
+ * Name: cmd_top
+ ****************************************************************************/
+
+#ifndef CONFIG_NSH_DISABLE_TOP
+int cmd_top(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
+{
+  FAR struct top_sample_s *samples;
+  FAR struct top_sample_s *prev;
+  FAR struct top_sample_s *cur;
+  FAR char *endptr;
+  bool badarg = false;
+  bool batch = false;
+  long delay = TOP_DEFAULT_DELAY;
+  long count = 1;
+  int option;
+  int i;
+
+  while ((option = getopt(argc, argv, "bd:n:")) != ERROR)
+    {
+      switch (option)
+        {
+        case 'b':
+          batch = true;
+          break;
+
+        case 'd':
+          delay = strtol(optarg, &endptr, 0);
+          if (delay <= 0 || endptr == optarg || *endptr != '\0')
+            {
+              nsh_output(vtbl, g_fmtarginvalid, argv[0]);
+              badarg = true;
+            }
+          break;
+
+        case 'n':
+          count = strtol(optarg, &endptr, 0);
+          if (count <= 0 || endptr == optarg || *endptr != '\0')
+            {
+              nsh_output(vtbl, g_fmtarginvalid, argv[0]);
+              badarg = true;
+            }
+          break;
+
+        case '?':
+        default:
+          nsh_output(vtbl, g_fmtarginvalid, argv[0]);
+          badarg = true;
+          break;
+        }
+    }
+
+  /* If a bad argument was encountered, then return without processing the
+   * command.
+   */
+
+  if (badarg)
+    {
+      return ERROR;
+    }
+
+  if (optind < argc)
+    {
+      nsh_output(vtbl, g_fmttoomanyargs, argv[0]);
+      return ERROR;
+    }
+
+  /* Two samples are kept:  The previous one and the current one */
+
+  samples = (FAR struct top_sample_s *)
+    malloc(2 * sizeof(struct top_sample_s));
+
+  if (samples == NULL)
+    {
+      nsh_output(vtbl, g_fmtcmdoutofmemory, argv[0]);
+      return ERROR;
+    }
+
+  prev = &samples[0];
+  cur  = &samples[1];
+
+  top_sample(prev);
+  for (i = 0; i < count; i++)
+    {
+      FAR struct top_sample_s *tmp;
+
+      sleep(delay);
+
+      top_sample(cur);
+      top_calcload(prev, cur);
+      top_show(vtbl, cur, batch);
+
+      tmp  = prev;
+      prev = cur;
+      cur  = tmp;
+    }
+
+  free(samples);
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Name: cmd_kill
  ****************************************************************************/
@@ -39,12 +39,138 @@
 
 #include <nuttx/config.h>
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "nsh.h"
 #include "nsh_console.h"
 
 #if CONFIG_NFILE_DESCRIPTORS > 0 && CONFIG_NFILE_STREAMS > 0 && \
     !defined(CONFIG_NSH_DISABLESCRIPT)
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nsh_preload
+ *
+ * Description:
+ *   Read the whole script file open on np_stream into memory.  On success
+ *   the stream is closed and commands are then taken from np_image.  If the
+ *   script is too large or memory is not available, the stream is left
+ *   open at the beginning of file and the script is read from the file.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NSH_SCRIPT_PRELOAD
+static void nsh_preload(FAR struct nsh_parser_s *np)
+{
+  FAR char *image;
+  long size;
+
+  if (fseek(np->np_stream, 0, SEEK_END) < 0 ||
+      (size = ftell(np->np_stream)) <= 0 ||
+      size > CONFIG_NSH_SCRIPT_PRELOAD_MAX)
+    {
+      goto errout;
+    }
+
+  image = (FAR char *)malloc(size);
+  if (image == NULL)
+    {
+      goto errout;
+    }
+
+  if (fseek(np->np_stream, 0, SEEK_SET) < 0 ||
+      fread(image, 1, size, np->np_stream) != (size_t)size)
+    {
+      free(image);
+      goto errout;
+    }
+
+  /* Commands come from the image from now on */
+
+  fclose(np->np_stream);
+  np->np_stream = NULL;
+  np->np_image  = image;
+  np->np_imglen = size;
+  np->np_imgpos = 0;
+  return;
+
+errout:
+  (void)fseek(np->np_stream, 0, SEEK_SET);
+}
+#endif
+
+/****************************************************************************
+ * Name: nsh_scripttell
+ *
+ * Description:
+ *   Return the current read position in the script.
+ *
+ ****************************************************************************/
+
+#ifndef CONFIG_NSH_DISABLE_LOOPS
+static long nsh_scripttell(FAR struct nsh_parser_s *np)
+{
+#ifdef CONFIG_NSH_SCRIPT_PRELOAD
+  if (np->np_image != NULL)
+    {
+      return (long)np->np_imgpos;
+    }
+#endif
+
+  return ftell(np->np_stream);
+}
+#endif
+
+/****************************************************************************
+ * Name: nsh_scriptgets
+ *
+ * Description:
+ *   Read the next line of the script into buffer, with the same semantics
+ *   as fgets().
+ *
+ ****************************************************************************/
+
+static FAR char *nsh_scriptgets(FAR struct nsh_parser_s *np,
+                                FAR char *buffer, size_t buflen)
+{
+#ifdef CONFIG_NSH_SCRIPT_PRELOAD
+  if (np->np_image != NULL)
+    {
+      FAR const char *line;
+      FAR const char *end;
+      size_t remaining;
+      size_t len;
+
+      remaining = np->np_imglen - np->np_imgpos;
+      if (remaining == 0 || buflen < 2)
+        {
+          return NULL;
+        }
+
+      /* Copy up to and including the next newline, if it fits */
+
+      line = &np->np_image[np->np_imgpos];
+      len  = remaining < buflen - 1 ? remaining : buflen - 1;
+      end  = memchr(line, '\n', len);
+      if (end != NULL)
+        {
+          len = end - line + 1;
+        }
+
+      memcpy(buffer, line, len);
+      buffer[len]    = '\0';
+      np->np_imgpos += len;
+      return buffer;
+    }
+#endif
+
+  return fgets(buffer, buflen, np->np_stream);
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -60,8 +186,14 @@
 int nsh_script(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd,
                FAR const char *path)
 {
+  FAR struct nsh_parser_s *np = &vtbl->np;
   FAR char *fullpath;
   FAR FILE *savestream;
+#ifdef CONFIG_NSH_SCRIPT_PRELOAD
+  FAR char *saveimage;
+  size_t savelen;
+  size_t savepos;
+#endif
   FAR char *buffer;
   FAR char *pret;
   int ret = ERROR;
@@ -81,12 +213,18 @@ int nsh_script(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd,
     {
       /* Save the parent stream in case of nested script processing */
 
-      savestream = vtbl->np.np_stream;
+      savestream = np->np_stream;
+#ifdef CONFIG_NSH_SCRIPT_PRELOAD
+      saveimage  = np->np_image;
+      savelen    = np->np_imglen;
+      savepos    = np->np_imgpos;
+      np->np_image = NULL;
+#endif
 
       /* Open the file containing the script */
 
-      vtbl->np.np_stream = fopen(fullpath, "r");
-      if (!vtbl->np.np_stream)
+      np->np_stream = fopen(fullpath, "r");
+      if (!np->np_stream)
         {
           nsh_output(vtbl, g_fmtcmdfailed, cmd, "fopen", NSH_ERRNO);
 
@@ -96,10 +234,21 @@ int nsh_script(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd,
 
           /* Restore the parent script stream */
 
-          vtbl->np.np_stream = savestream;
+          np->np_stream = savestream;
+#ifdef CONFIG_NSH_SCRIPT_PRELOAD
+          np->np_image  = saveimage;
+#endif
           return ERROR;
         }
 
+#ifdef CONFIG_NSH_SCRIPT_PRELOAD
+      /* Read small scripts into memory so that they are read from the file
+       * only once, however many times their loops are executed.
+       */
+
+      nsh_preload(np);
+#endif
+
       /* Loop, processing each command line in the script file (or
        * until an error occurs)
        */
@@ -117,10 +266,10 @@ int nsh_script(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd,
            * script file.  Note that ftell will return -1 on failure.
            */
 
-          vtbl->np.np_foffs = ftell(vtbl->np.np_stream);
-          vtbl->np.np_loffs = 0;
+          np->np_foffs = nsh_scripttell(np);
+          np->np_loffs = 0;
 
-          if (vtbl->np.np_foffs < 0)
+          if (np->np_foffs < 0)
             {
               nsh_output(vtbl, g_fmtcmdfailed, "loop", "ftell", NSH_ERRNO);
             }
@@ -128,7 +277,7 @@ int nsh_script(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd,
 
           /* Now read the next line from the script file */
 
-          pret = fgets(buffer, CONFIG_NSH_LINELEN, vtbl->np.np_stream);
+          pret = nsh_scriptgets(np, buffer, CONFIG_NSH_LINELEN);
           if (pret)
             {
               /* Parse process the command.  NOTE:  this is recursive...
@@ -136,7 +285,7 @@ int nsh_script(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd,
                * considerable amount of stack may be used.
                */
 
-              if ((vtbl->np.np_flags & NSH_PFLAG_SILENT) == 0)
+              if ((np->np_flags & NSH_PFLAG_SILENT) == 0)
                 {
                   nsh_output(vtbl,"%s", buffer);
                 }
@@ -144,15 +293,29 @@ int nsh_script(FAR struct nsh_vtbl_s *vtbl, FAR const char *cmd,
               ret = nsh_parse(vtbl, buffer);
             }
         }
-      while (pret && (ret == OK || (vtbl->np.np_flags & NSH_PFLAG_IGNORE)));
+      while (pret && (ret == OK || (np->np_flags & NSH_PFLAG_IGNORE)));
 
-      /* Close the script file */
+      /* Close the script file (or free its image) */
 
-      fclose(vtbl->np.np_stream);
+#ifdef CONFIG_NSH_SCRIPT_PRELOAD
+      if (np->np_image != NULL)
+        {
+          free(np->np_image);
+        }
+      else
+#endif
+        {
+          fclose(np->np_stream);
+        }
 
       /* Restore the parent script stream */
 
-      vtbl->np.np_stream = savestream;
+      np->np_stream = savestream;
+#ifdef CONFIG_NSH_SCRIPT_PRELOAD
+      np->np_image  = saveimage;
+      np->np_imglen = savelen;
+      np->np_imgpos = savepos;
+#endif
     }
 
   /* Free the allocated path */
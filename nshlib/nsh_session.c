@@ -142,8 +142,7 @@ int nsh_session(FAR struct console_stdio_s *pstate)
        */
 
 #ifdef CONFIG_NSH_CLE
-      ret = cle(pstate->cn_line, CONFIG_NSH_LINELEN,
-                INSTREAM(pstate), OUTSTREAM(pstate));
+      ret = NSH_CLE(pstate);
 #else
       ret = readline(pstate->cn_line, CONFIG_NSH_LINELEN,
                      INSTREAM(pstate), OUTSTREAM(pstate));
@@ -0,0 +1,665 @@
+/****************************************************************************
+ * apps/nshlib/nsh_startup.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <syslog.h>
+#include <time.h>
+#include <errno.h>
+
+#include "nshlib/nshlib.h"
+
+#include "nsh.h"
+#include "nsh_console.h"
+
+#ifdef CONFIG_NSH_STARTUP
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_NSH_STARTUP_MAXSTEPS
+#  define CONFIG_NSH_STARTUP_MAXSTEPS 16
+#endif
+
+#ifndef CONFIG_NSH_STARTUP_NAMELEN
+#  define CONFIG_NSH_STARTUP_NAMELEN 15
+#endif
+
+#ifndef CONFIG_NSH_STARTUP_STACKSIZE
+#  define CONFIG_NSH_STARTUP_STACKSIZE 2048
+#endif
+
+#ifndef CONFIG_NSH_STARTUP_PRIORITY
+#  define CONFIG_NSH_STARTUP_PRIORITY 100
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define STARTUP_CLOCK CLOCK_MONOTONIC
+#else
+#  define STARTUP_CLOCK CLOCK_REALTIME
+#endif
+
+/* Step states */
+
+#define STEP_PENDING 0               /* Waiting for its prerequisites */
+#define STEP_RUNNING 1
+#define STEP_DONE    2
+#define STEP_FAILED  3
+#define STEP_SKIPPED 4               /* A prerequisite failed */
+
+#define STEP_FINISHED(s) ((s)->state >= STEP_DONE)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct nsh_step_s
+{
+  char name[CONFIG_NSH_STARTUP_NAMELEN + 1];
+  uint8_t state;                     /* See STEP_* */
+  int result;                        /* Return value of the step */
+  uint32_t start;                    /* Start time, msec since boot */
+  uint32_t end;                      /* End time, msec since boot */
+  FAR char *after;                   /* Comma-separated prerequisites */
+  FAR char **argv;                   /* NSH command and arguments, or NULL */
+  int argc;                          /* Number of entries in argv */
+  FAR struct nsh_vtbl_s *vtbl;       /* Session that runs argv */
+  nsh_startup_t func;                /* Function, if argv is NULL */
+  FAR void *arg;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static pthread_mutex_t g_startup_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_startup_cond = PTHREAD_COND_INITIALIZER;
+static struct nsh_step_s g_steps[CONFIG_NSH_STARTUP_MAXSTEPS];
+static int g_nsteps;
+
+static FAR const char *g_statename[] =
+{
+  "pending", "running", "done", "failed", "skipped"
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t startup_msnow(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(STARTUP_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static FAR struct nsh_step_s *startup_find(FAR const char *name,
+                                           size_t len)
+{
+  int i;
+
+  for (i = 0; i < g_nsteps; i++)
+    {
+      if (strncmp(g_steps[i].name, name, len) == 0 &&
+          g_steps[i].name[len] == '\0')
+        {
+          return &g_steps[i];
+        }
+    }
+
+  return NULL;
+}
+
+/* Returns STEP_DONE when all of the prerequisites of a step are done,
+ * STEP_SKIPPED when one failed or was skipped, and STEP_PENDING otherwise.
+ * A prerequisite that has not been added yet is waited for.
+ */
+
+static int startup_depstate(FAR struct nsh_step_s *step)
+{
+  FAR struct nsh_step_s *dep;
+  FAR const char *cp = step->after;
+  int state = STEP_DONE;
+  size_t len;
+
+  while (cp != NULL && *cp != '\0')
+    {
+      len = strcspn(cp, ",");
+      if (len > 0)
+        {
+          dep = startup_find(cp, len);
+          if (dep == NULL || !STEP_FINISHED(dep))
+            {
+              state = STEP_PENDING;
+            }
+          else if (dep->state != STEP_DONE)
+            {
+              return STEP_SKIPPED;
+            }
+        }
+
+      cp += len;
+      if (*cp == ',')
+        {
+          cp++;
+        }
+    }
+
+  return state;
+}
+
+static void startup_finish(FAR struct nsh_step_s *step, int state,
+                           int result)
+{
+  step->state  = state;
+  step->result = result;
+  step->end    = startup_msnow();
+
+  syslog(LOG_INFO, "startup: %s %s after %lu ms (at %lu ms)\n", step->name,
+         g_statename[state], (unsigned long)(step->end - step->start),
+         (unsigned long)step->end);
+}
+
+static pthread_addr_t startup_thread(pthread_addr_t arg);
+
+/* Start every pending step whose prerequisites are done, and skip those
+ * with a failed prerequisite.  Called with g_startup_lock held.
+ */
+
+static void startup_schedule(void)
+{
+  FAR struct nsh_step_s *step;
+  struct sched_param param;
+  pthread_attr_t attr;
+  pthread_t thread;
+  bool changed;
+  int state;
+  int ret;
+  int i;
+
+  do
+    {
+      changed = false;
+      for (i = 0; i < g_nsteps; i++)
+        {
+          step = &g_steps[i];
+          if (step->state != STEP_PENDING)
+            {
+              continue;
+            }
+
+          state = startup_depstate(step);
+          if (state == STEP_PENDING)
+            {
+              continue;
+            }
+
+          changed     = true;
+          step->start = startup_msnow();
+
+          if (state == STEP_SKIPPED)
+            {
+              startup_finish(step, STEP_SKIPPED, -ECANCELED);
+              continue;
+            }
+
+          (void)pthread_attr_init(&attr);
+          param.sched_priority = CONFIG_NSH_STARTUP_PRIORITY;
+          (void)pthread_attr_setschedparam(&attr, &param);
+          (void)pthread_attr_setstacksize(&attr,
+                                          CONFIG_NSH_STARTUP_STACKSIZE);
+
+          step->state = STEP_RUNNING;
+          ret = pthread_create(&thread, &attr, startup_thread,
+                               (pthread_addr_t)step);
+          (void)pthread_attr_destroy(&attr);
+
+          if (ret != 0)
+            {
+              startup_finish(step, STEP_FAILED, -ret);
+              continue;
+            }
+
+          (void)pthread_detach(thread);
+        }
+    }
+  while (changed);
+
+  (void)pthread_cond_broadcast(&g_startup_cond);
+}
+
+static pthread_addr_t startup_thread(pthread_addr_t arg)
+{
+  FAR struct nsh_step_s *step = (FAR struct nsh_step_s *)arg;
+  int ret;
+
+  if (step->argv != NULL)
+    {
+      /* A single argument is a command line.  Several arguments are run
+       * as they were given, without being split or expanded again.
+       */
+
+      if (step->argc == 1)
+        {
+          ret = nsh_parse(step->vtbl, step->argv[0]);
+        }
+      else
+        {
+          ret = nsh_execargv(step->vtbl, step->argc, step->argv);
+        }
+
+      nsh_release(step->vtbl);
+      free(step->argv);
+      step->vtbl = NULL;
+      step->argv = NULL;
+    }
+  else
+    {
+      ret = step->func(step->arg);
+    }
+
+  /* Completion may allow other steps to start */
+
+  (void)pthread_mutex_lock(&g_startup_lock);
+  startup_finish(step, ret == OK ? STEP_DONE : STEP_FAILED, ret);
+  startup_schedule();
+  (void)pthread_mutex_unlock(&g_startup_lock);
+  return NULL;
+}
+
+static int startup_add(FAR const char *name, FAR const char *after,
+                       FAR struct nsh_vtbl_s *vtbl, int argc,
+                       FAR char **argv, nsh_startup_t func, FAR void *arg)
+{
+  FAR struct nsh_step_s *step;
+  size_t len = strlen(name);
+  int ret = OK;
+
+  if (len == 0 || len > CONFIG_NSH_STARTUP_NAMELEN ||
+      strchr(name, ',') != NULL)
+    {
+      return -EINVAL;
+    }
+
+  (void)pthread_mutex_lock(&g_startup_lock);
+
+  if (startup_find(name, len) != NULL)
+    {
+      ret = -EEXIST;
+      goto errout_with_lock;
+    }
+
+  if (g_nsteps >= CONFIG_NSH_STARTUP_MAXSTEPS)
+    {
+      ret = -ENOMEM;
+      goto errout_with_lock;
+    }
+
+  step = &g_steps[g_nsteps];
+  memset(step, 0, sizeof(*step));
+  if (after != NULL && *after != '\0')
+    {
+      step->after = strdup(after);
+      if (step->after == NULL)
+        {
+          ret = -ENOMEM;
+          goto errout_with_lock;
+        }
+    }
+
+  strcpy(step->name, name);
+  step->state   = STEP_PENDING;
+  step->argv    = argv;
+  step->argc    = argc;
+  step->vtbl    = vtbl;
+  step->func    = func;
+  step->arg     = arg;
+  g_nsteps++;
+
+  startup_schedule();
+
+errout_with_lock:
+  (void)pthread_mutex_unlock(&g_startup_lock);
+  return ret;
+}
+
+static int startup_cmdadd(FAR struct nsh_vtbl_s *vtbl, int argc,
+                          FAR char **argv)
+{
+  FAR struct nsh_vtbl_s *stepvtbl;
+  FAR const char *after = NULL;
+  FAR char **cmdargv;
+  FAR char *strings;
+  size_t len;
+  int cmdargc;
+  int first = 3;
+  int ret;
+  int i;
+
+  if (argc > 4 && strcmp(argv[3], "-a") == 0)
+    {
+      after = argv[4];
+      first = 5;
+    }
+
+  if (argc <= first)
+    {
+      nsh_output(vtbl, g_fmtargrequired, argv[0]);
+      return ERROR;
+    }
+
+  /* The command may be given as one quoted string or as several arguments.
+   * Keep a copy of the argument vector, with the strings in the same
+   * allocation, so that the arguments are run exactly as given.
+   */
+
+  cmdargc = argc - first;
+  len     = (cmdargc + 1) * sizeof(FAR char *);
+  for (i = first; i < argc; i++)
+    {
+      len += strlen(argv[i]) + 1;
+    }
+
+  cmdargv = (FAR char **)malloc(len);
+  if (cmdargv == NULL)
+    {
+      nsh_output(vtbl, g_fmtcmdoutofmemory, argv[0]);
+      return ERROR;
+    }
+
+  strings = (FAR char *)&cmdargv[cmdargc + 1];
+  for (i = 0; i < cmdargc; i++)
+    {
+      len = strlen(argv[first + i]) + 1;
+      memcpy(strings, argv[first + i], len);
+      cmdargv[i] = strings;
+      strings   += len;
+    }
+
+  cmdargv[cmdargc] = NULL;
+
+  /* The step runs in its own session, with the same output */
+
+  stepvtbl = nsh_clone(vtbl);
+  if (stepvtbl == NULL)
+    {
+      free(cmdargv);
+      nsh_output(vtbl, g_fmtcmdoutofmemory, argv[0]);
+      return ERROR;
+    }
+
+  ret = startup_add(argv[2], after, stepvtbl, cmdargc, cmdargv, NULL, NULL);
+  if (ret < 0)
+    {
+      nsh_release(stepvtbl);
+      free(cmdargv);
+      nsh_output(vtbl, g_fmtcmdfailed, argv[0], "add", NSH_ERRNO_OF(-ret));
+      return ERROR;
+    }
+
+  return OK;
+}
+
+static int startup_cmdwait(FAR struct nsh_vtbl_s *vtbl, int argc,
+                           FAR char **argv)
+{
+  int timeout = 0;
+  int first = 2;
+  int ret = OK;
+  int tmp;
+
+  if (argc > 3 && strcmp(argv[2], "-t") == 0)
+    {
+      timeout = atoi(argv[3]);
+      first   = 4;
+    }
+
+  if (argc <= first)
+    {
+      ret = nsh_startup_wait(NULL, timeout);
+      if (ret < 0)
+        {
+          nsh_output(vtbl, g_fmtcmdfailed, argv[0], "wait",
+                     NSH_ERRNO_OF(-ret));
+        }
+    }
+
+  for (; first < argc; first++)
+    {
+      tmp = nsh_startup_wait(argv[first], timeout);
+      if (tmp < 0)
+        {
+          nsh_output(vtbl, g_fmtcmdfailed, argv[0], argv[first],
+                     NSH_ERRNO_OF(-tmp));
+          ret = tmp;
+        }
+    }
+
+  return ret < 0 ? ERROR : OK;
+}
+
+static int startup_cmdstatus(FAR struct nsh_vtbl_s *vtbl)
+{
+  FAR struct nsh_step_s *step;
+  uint32_t ready = 0;
+  uint32_t now;
+  bool finished = true;
+  int i;
+
+  (void)pthread_mutex_lock(&g_startup_lock);
+
+  now = startup_msnow();
+  nsh_output(vtbl, "%-*s %-8s %8s %8s  %s\n", CONFIG_NSH_STARTUP_NAMELEN,
+             "STEP", "STATE", "START", "MSEC", "AFTER");
+
+  for (i = 0; i < g_nsteps; i++)
+    {
+      step = &g_steps[i];
+      if (STEP_FINISHED(step))
+        {
+          if (step->end > ready)
+            {
+              ready = step->end;
+            }
+        }
+      else
+        {
+          finished = false;
+        }
+
+      if (step->state == STEP_PENDING)
+        {
+          nsh_output(vtbl, "%-*s %-8s %8s %8s  %s\n",
+                     CONFIG_NSH_STARTUP_NAMELEN, step->name,
+                     g_statename[step->state], "-", "-",
+                     step->after ? step->after : "");
+        }
+      else
+        {
+          nsh_output(vtbl, "%-*s %-8s %8lu %8lu  %s\n",
+                     CONFIG_NSH_STARTUP_NAMELEN, step->name,
+                     g_statename[step->state], (unsigned long)step->start,
+                     (unsigned long)((STEP_FINISHED(step) ? step->end : now) -
+                                     step->start),
+                     step->after ? step->after : "");
+        }
+    }
+
+  if (g_nsteps > 0 && finished)
+    {
+      nsh_output(vtbl, "All steps finished at %lu ms\n",
+                 (unsigned long)ready);
+    }
+
+  (void)pthread_mutex_unlock(&g_startup_lock);
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nsh_startup_add
+ *
+ * Description:
+ *   Add a start-up step that calls func(arg) on its own thread once all of
+ *   the steps in the comma-separated list 'after' have completed
+ *   successfully.  A step that has no prerequisites starts immediately.
+ *
+ ****************************************************************************/
+
+int nsh_startup_add(FAR const char *name, FAR const char *after,
+                    nsh_startup_t func, FAR void *arg)
+{
+  return startup_add(name, after, NULL, 0, NULL, func, arg);
+}
+
+/****************************************************************************
+ * Name: nsh_startup_wait
+ *
+ * Description:
+ *   Wait until the named step, or every step if name is NULL, has finished.
+ *   timeout is in seconds; zero waits forever.
+ *
+ * Returned Value:
+ *   OK if the steps completed successfully, -EIO if one failed or was
+ *   skipped, or -ETIMEDOUT.
+ *
+ ****************************************************************************/
+
+int nsh_startup_wait(FAR const char *name, int timeout)
+{
+  FAR struct nsh_step_s *step;
+  struct timespec abstime;
+  bool finished;
+  int ret = OK;
+  int i;
+
+  (void)clock_gettime(CLOCK_REALTIME, &abstime);
+  abstime.tv_sec += timeout;
+
+  (void)pthread_mutex_lock(&g_startup_lock);
+  for (; ; )
+    {
+      finished = true;
+      ret      = OK;
+
+      for (i = 0; i < g_nsteps; i++)
+        {
+          step = &g_steps[i];
+          if (name != NULL && strcmp(step->name, name) != 0)
+            {
+              continue;
+            }
+
+          if (!STEP_FINISHED(step))
+            {
+              finished = false;
+            }
+          else if (step->state != STEP_DONE)
+            {
+              ret = -EIO;
+            }
+        }
+
+      /* A named step that has not been added yet is waited for */
+
+      if (name != NULL && startup_find(name, strlen(name)) == NULL)
+        {
+          finished = false;
+        }
+
+      if (finished)
+        {
+          break;
+        }
+
+      if (timeout > 0)
+        {
+          if (pthread_cond_timedwait(&g_startup_cond, &g_startup_lock,
+                                     &abstime) == ETIMEDOUT)
+            {
+              ret = -ETIMEDOUT;
+              break;
+            }
+        }
+      else
+        {
+          (void)pthread_cond_wait(&g_startup_cond, &g_startup_lock);
+        }
+    }
+
+  (void)pthread_mutex_unlock(&g_startup_lock);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: cmd_startup
+ ****************************************************************************/
+
+int cmd_startup(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
+{
+  if (argc < 2 || strcmp(argv[1], "status") == 0)
+    {
+      return startup_cmdstatus(vtbl);
+    }
+  else if (strcmp(argv[1], "add") == 0 && argc > 2)
+    {
+      return startup_cmdadd(vtbl, argc, argv);
+    }
+  else if (strcmp(argv[1], "wait") == 0)
+    {
+      return startup_cmdwait(vtbl, argc, argv);
+    }
+
+  nsh_output(vtbl, g_fmtarginvalid, argv[0]);
+  return ERROR;
+}
+
+#endif /* CONFIG_NSH_STARTUP */
@@ -89,6 +89,12 @@ static int nsh_telnetmain(int argc, char *argv[])
   DEBUGASSERT(pstate != NULL);
   vtbl = &pstate->cn_vtbl;
 
+#ifdef NSH_HAVE_OUTBUF
+  /* Send command output in as few TCP segments as possible */
+
+  pstate->cn_lineflush = false;
+#endif
+
   _info("Session [%d] Started\n", getpid());
 
 #ifdef CONFIG_NSH_TELNET_LOGIN
@@ -96,8 +102,13 @@ static int nsh_telnetmain(int argc, char *argv[])
 
   if (nsh_telnetlogin(pstate) != OK)
     {
+#if CONFIG_TELNETD_POOLSIZE > 0
+      nsh_release(vtbl);
+      return -1;
+#else
       nsh_exit(vtbl, 1);
       return -1; /* nsh_exit does not return */
+#endif
     }
 #endif /* CONFIG_NSH_TELNET_LOGIN */
 
@@ -153,8 +164,7 @@ static int nsh_telnetmain(int argc, char *argv[])
       /* Get the next line of input from the Telnet client */
 #ifdef CONFIG_TELNET_CHARACTER_MODE
 #ifdef CONFIG_NSH_CLE
-      ret = cle(pstate->cn_line, CONFIG_NSH_LINELEN,
-                INSTREAM(pstate), OUTSTREAM(pstate));
+      ret = NSH_CLE(pstate);
 #else
       ret = readline(pstate->cn_line, CONFIG_NSH_LINELEN,
                      INSTREAM(pstate), OUTSTREAM(pstate));
@@ -180,19 +190,32 @@ static int nsh_telnetmain(int argc, char *argv[])
         }
       else
         {
+#if CONFIG_TELNETD_POOLSIZE > 0
+          /* The client disconnected.  Return so that this task can serve
+           * the next connection from the Telnet daemon's pool.
+           */
+
+          break;
+#else
           fprintf(pstate->cn_outstream, g_fmtcmdfailed, "nsh_telnetmain",
                   "cle/readline/fgets", NSH_ERRNO);
           nsh_exit(vtbl, 1);
+#endif
         }
     }
 
   /* Clean up */
 
+#if CONFIG_TELNETD_POOLSIZE > 0
+  nsh_release(vtbl);
+  return OK;
+#else
   nsh_exit(vtbl, 0);
 
   /* We do not get here, but this is necessary to keep some compilers happy */
 
   return OK;
+#endif
 }
 
 /****************************************************************************
@@ -44,6 +44,8 @@
 #include <unistd.h>
 #include <time.h>
 
+#include <nuttx/clock.h>
+
 #include "nsh.h"
 #include "nsh_console.h"
 
@@ -293,6 +295,10 @@ errout_bad_parm:
 int cmd_time(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
 {
   struct timespec start;
+  struct mallinfo mmbefore;
+#ifdef NSH_HAVE_TIME_CPULOAD
+  struct cpuload_s idlebefore;
+#endif
 #ifndef CONFIG_NSH_DISABLEBG
   bool bgsave;
 #endif
@@ -301,7 +307,17 @@ int cmd_time(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
 #endif
   int ret;
 
-  /* Get the current time */
+  /* Sample the heap and the CPU load counters, then get the current time */
+
+#ifdef CONFIG_CAN_PASS_STRUCTS
+  mmbefore = mallinfo();
+#else
+  (void)mallinfo(&mmbefore);
+#endif
+
+#ifdef NSH_HAVE_TIME_CPULOAD
+  (void)clock_cpuload(0, &idlebefore);
+#endif
 
   ret = clock_gettime(TIME_CLOCK, &start);
   if (ret < 0)
@@ -319,13 +335,37 @@ int cmd_time(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
   redirsave = vtbl->np.np_redirect;
 #endif
 
-  /* Execute the command */
+  /* Execute the command.  It may be given as one quoted string, which is
+   * parsed as a command line, or as several arguments, which are run as
+   * they are.  Builtin and file applications are waited for in the
+   * foreground, so their run time is included.
+   */
+
+  if (argc > 2)
+    {
+      ret = nsh_execargv(vtbl, argc - 1, &argv[1]);
+    }
+  else
+    {
+      ret = nsh_parse(vtbl, argv[1]);
+    }
 
-  ret = nsh_parse(vtbl, argv[1]);
   if (ret >= 0)
     {
       struct timespec end;
       struct timespec diff;
+      struct mallinfo mmafter;
+#ifdef NSH_HAVE_TIME_CPULOAD
+      struct cpuload_s idleafter;
+
+      (void)clock_cpuload(0, &idleafter);
+#endif
+
+#ifdef CONFIG_CAN_PASS_STRUCTS
+      mmafter = mallinfo();
+#else
+      (void)mallinfo(&mmafter);
+#endif
 
       /* Get and print the elapsed time */
 
@@ -347,6 +387,41 @@ int cmd_time(FAR struct nsh_vtbl_s *vtbl, int argc, char **argv)
           diff.tv_nsec = end.tv_nsec - start.tv_nsec;
           nsh_output(vtbl, "\n%lu.%04lu sec\n", (unsigned long)diff.tv_sec,
                      (unsigned long)diff.tv_nsec / 100000);
+
+#ifdef NSH_HAVE_TIME_CPULOAD
+          /* The CPU time is the number of ticks that were not charged to
+           * the idle task.  This includes any other tasks and interrupt
+           * handlers that ran in the meantime.  The counters are halved
+           * periodically; if that happened during the command, the total
+           * will not match the wall time and the CPU time is not known.
+           */
+
+          {
+            uint32_t total = idleafter.total - idlebefore.total;
+            uint32_t idle  = idleafter.active - idlebefore.active;
+            uint32_t wall  = diff.tv_sec * TICK_PER_SEC +
+                             diff.tv_nsec / (USEC_PER_TICK * 1000);
+
+            if (idleafter.total >= idlebefore.total &&
+                idleafter.active >= idlebefore.active &&
+                total <= wall + 1 && total + 1 >= wall)
+              {
+                uint32_t busy = total - idle;
+                unsigned long usec = (unsigned long)busy * USEC_PER_TICK;
+
+                nsh_output(vtbl, "%lu.%04lu sec CPU\n", usec / 1000000,
+                           (usec % 1000000) / 100);
+              }
+          }
+#endif
+
+          /* Report the change in heap usage.  A positive number is memory
+           * that the command left allocated.
+           */
+
+          nsh_output(vtbl, "%ld bytes heap (%d bytes free)\n",
+                     (long)mmafter.uordblks - (long)mmbefore.uordblks,
+                     mmafter.fordblks);
         }
     }
 
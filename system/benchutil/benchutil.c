@@ -0,0 +1,113 @@
+/****************************************************************************
+ * apps/system/benchutil/benchutil.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+
+#include "system/benchutil.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define BENCHUTIL_CLOCK CLOCK_MONOTONIC
+#else
+#  define BENCHUTIL_CLOCK CLOCK_REALTIME
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: benchutil_usec
+ ****************************************************************************/
+
+uint64_t benchutil_usec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(BENCHUTIL_CLOCK, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * Name: benchutil_cpuload
+ ****************************************************************************/
+
+int benchutil_cpuload(void)
+{
+  FAR char *ptr;
+  char buffer[16];
+  ssize_t nread;
+  int load;
+  int fd;
+
+  fd = open("/proc/cpuload", O_RDONLY);
+  if (fd < 0)
+    {
+      return -1;
+    }
+
+  nread = read(fd, buffer, sizeof(buffer) - 1);
+  close(fd);
+
+  if (nread <= 0)
+    {
+      return -1;
+    }
+
+  /* A single line like "  12.3%" */
+
+  buffer[nread] = '\0';
+  load = (int)strtoul(buffer, &ptr, 10) * 10;
+  if (*ptr == '.' && ptr[1] >= '0' && ptr[1] <= '9')
+    {
+      load += ptr[1] - '0';
+    }
+
+  return load;
+}
@@ -100,6 +100,19 @@
 #define TABMASK         7    /* Mask for TAB alignment */
 #define NEXT_TAB(p)     (((p) + TABSIZE) & ~TABMASK)
 
+/* cle() collects the output for each keystroke in a buffer of this size on
+ * its stack.  cle_buffered() uses a buffer provided by the caller instead.
+ */
+
+#ifndef CONFIG_SYSTEM_CLE_OUTBUFSIZE
+#  define CONFIG_SYSTEM_CLE_OUTBUFSIZE 32
+#endif
+
+/* Values of 'dirty' and 'column' in struct cle_s */
+
+#define CLE_CLEAN       UINT16_MAX /* The display matches the line buffer */
+#define CLE_UNKNOWN     UINT16_MAX /* The display cursor column is unknown */
+
 /* Debug */
 
 #ifndef CONFIG_SYSTEM_CLE_DEBUGLEVEL
@@ -162,9 +175,15 @@ struct cle_s
   uint16_t coloffs;         /* Left cursor offset */
   uint16_t linelen;         /* Size of the line buffer */
   uint16_t nchars;          /* Size of data in the line buffer */
+  uint16_t dirty;           /* First line position changed since last shown */
+  uint16_t shown;           /* Number of display columns showing text */
+  uint16_t column;          /* Display cursor column (or CLE_UNKNOWN) */
+  uint16_t outsize;         /* Size of the output buffer */
+  uint16_t outlen;          /* Number of bytes in the output buffer */
   int infd;                 /* Input file descriptor */
   int outfd;                /* Output file descriptor */
   FAR char *line;           /* Line buffer */
+  FAR char *outbuf;         /* Output buffer (may be NULL) */
 };
 
 /****************************************************************************
@@ -177,6 +196,9 @@ static int      cle_debug(FAR const char *fmt, ...);
 
 /* Low-level display and data entry functions */
 
+static void     cle_send(FAR struct cle_s *priv, FAR const char *buffer,
+                  uint16_t buflen);
+static void     cle_flush(FAR struct cle_s *priv);
 static void     cle_write(FAR struct cle_s *priv, FAR const char *buffer,
                   uint16_t buflen);
 static void     cle_putch(FAR struct cle_s *priv, char ch);
@@ -193,6 +215,8 @@ static void     cle_clrtoeol(FAR struct cle_s *priv);
 static bool     cle_opentext(FAR struct cle_s *priv, uint16_t pos,
                   uint16_t increment);
 static void     cle_closetext(FAR struct cle_s *priv, uint16_t pos, uint16_t size);
+static void     cle_changed(FAR struct cle_s *priv, uint16_t pos);
+static uint16_t cle_column(FAR struct cle_s *priv, uint16_t pos);
 static void     cle_showtext(FAR struct cle_s *priv);
 static void     cle_insertch(FAR struct cle_s *priv, char ch);
 static int      cle_editloop(FAR struct cle_s *priv);
@@ -237,15 +261,15 @@ static int cle_debug(FAR const char *fmt, ...)
 #endif
 
 /****************************************************************************
- * Name: cle_write
+ * Name: cle_send
  *
  * Description:
- *   Write a sequence of bytes to the console output device.
+ *   Write a sequence of bytes directly to the console output device.
  *
  ****************************************************************************/
 
-static void cle_write(FAR struct cle_s *priv, FAR const char *buffer,
-                      uint16_t buflen)
+static void cle_send(FAR struct cle_s *priv, FAR const char *buffer,
+                     uint16_t buflen)
 {
   ssize_t nwritten;
   uint16_t  nremaining = buflen;
@@ -260,7 +284,7 @@ static void cle_write(FAR struct cle_s *priv, FAR const char *buffer,
     {
       /* Take the next gulp */
 
-      nwritten = write(priv->outfd, buffer, buflen);
+      nwritten = write(priv->outfd, buffer, nremaining);
 
       /* Handle write errors.  write() should neve return 0. */
 
@@ -284,12 +308,66 @@ static void cle_write(FAR struct cle_s *priv, FAR const char *buffer,
 
       else
         {
+          buffer     += nwritten;
           nremaining -= nwritten;
         }
     }
   while (nremaining > 0);
 }
 
+/****************************************************************************
+ * Name: cle_flush
+ *
+ * Description:
+ *   Send any output collected in the output buffer.  This is done before
+ *   waiting for input so that each keystroke produces a single write.
+ *
+ ****************************************************************************/
+
+static void cle_flush(FAR struct cle_s *priv)
+{
+  if (priv->outlen > 0)
+    {
+      cle_send(priv, priv->outbuf, priv->outlen);
+      priv->outlen = 0;
+    }
+}
+
+/****************************************************************************
+ * Name: cle_write
+ *
+ * Description:
+ *   Write a sequence of bytes to the console output device.  The bytes are
+ *   collected in the output buffer, if there is one, until the next
+ *   cle_flush().
+ *
+ ****************************************************************************/
+
+static void cle_write(FAR struct cle_s *priv, FAR const char *buffer,
+                      uint16_t buflen)
+{
+  /* Make room in the output buffer, if necessary */
+
+  if (buflen > priv->outsize - priv->outlen)
+    {
+      cle_flush(priv);
+    }
+
+  /* Add the data to the output buffer if it fits.  Otherwise, write it
+   * directly.
+   */
+
+  if (buflen <= priv->outsize - priv->outlen)
+    {
+      memcpy(&priv->outbuf[priv->outlen], buffer, buflen);
+      priv->outlen += buflen;
+    }
+  else
+    {
+      cle_send(priv, buffer, buflen);
+    }
+}
+
 /****************************************************************************
  * Name: cle_putch
  *
@@ -316,6 +394,10 @@ static int cle_getch(FAR struct cle_s *priv)
   char buffer;
   ssize_t nread;
 
+  /* Send any buffered output before waiting for input */
+
+  cle_flush(priv);
+
   /* Loop until we successfully read a character (or until an unexpected
    * error occurs).
    */
@@ -402,6 +484,7 @@ static void cle_setcursor(FAR struct cle_s *priv, uint16_t column)
   /* Send the VT100 CURSORPOS command */
 
   cle_write(priv, buffer, len);
+  priv->column = column;
 }
 
 /****************************************************************************
@@ -593,6 +676,7 @@ static bool cle_opentext(FAR struct cle_s *priv, uint16_t pos,
   /* Adjust end of file position */
 
   priv->nchars += increment;
+  cle_changed(priv, pos);
   return true;
 }
 
@@ -621,6 +705,7 @@ static void cle_closetext(FAR struct cle_s *priv, uint16_t pos, uint16_t size)
   /* Adjust sizes and positions */
 
   priv->nchars -= size;
+  cle_changed(priv, pos);
 
   /* Check if the cursor position is beyond the deleted region */
 
@@ -641,12 +726,52 @@ static void cle_closetext(FAR struct cle_s *priv, uint16_t pos, uint16_t size)
     }
 }
 
+/****************************************************************************
+ * Name: cle_changed
+ *
+ * Description:
+ *   Note that the line buffer content has changed at position 'pos' and
+ *   beyond.
+ *
+ ****************************************************************************/
+
+static void cle_changed(FAR struct cle_s *priv, uint16_t pos)
+{
+  if (pos < priv->dirty)
+    {
+      priv->dirty = pos;
+    }
+}
+
+/****************************************************************************
+ * Name: cle_column
+ *
+ * Description:
+ *   Return the display column of line buffer position 'pos', accounting for
+ *   TAB expansion.
+ *
+ ****************************************************************************/
+
+static uint16_t cle_column(FAR struct cle_s *priv, uint16_t pos)
+{
+  uint16_t column;
+  uint16_t i;
+
+  for (i = 0, column = 0; i < pos && i < priv->nchars; i++)
+    {
+      column = (priv->line[i] == '\t') ? NEXT_TAB(column) : column + 1;
+    }
+
+  return column;
+}
+
 /****************************************************************************
  * Name: cle_showtext
  *
  * Description:
  *   Update the display based on the last operation.  This function is
- *   called at the beginning of the editor loop.
+ *   called at the beginning of the editor loop.  Only the part of the line
+ *   that changed since the last update is rewritten.
  *
  ****************************************************************************/
 
@@ -654,23 +779,36 @@ static void cle_showtext(FAR struct cle_s *priv)
 {
   uint16_t column;
   uint16_t tabcol;
+  uint16_t pos;
+
+  /* Is there anything to update? */
+
+  if (priv->dirty == CLE_CLEAN)
+    {
+      return;
+    }
 
   /* Turn off the cursor during the update. */
 
   cle_cursoroff(priv);
 
-  /* Set the cursor position to the beginning of this row */
+  /* Set the cursor position to the first changed column (if it is not
+   * already there).
+   */
 
-  cle_setcursor(priv, 0);
-  cle_clrtoeol(priv);
+  column = cle_column(priv, priv->dirty);
+  if (column != priv->column)
+    {
+      cle_setcursor(priv, column);
+    }
 
-  /* Loop for each column */
+  /* Loop for each character from the first change to the end of the line */
 
-  for (column = 0; column < priv->nchars; )
+  for (pos = priv->dirty; pos < priv->nchars; pos++)
     {
       /* Perform TAB expansion */
 
-      if (priv->line[column] == '\t')
+      if (priv->line[pos] == '\t')
         {
           tabcol = NEXT_TAB(column);
           if (tabcol < priv->linelen)
@@ -694,11 +832,22 @@ static void cle_showtext(FAR struct cle_s *priv)
 
       else
         {
-          cle_putch(priv, priv->line[column]);
+          cle_putch(priv, priv->line[pos]);
           column++;
         }
     }
 
+  /* Clear any old text that remains beyond the new end of the line */
+
+  if (column < priv->shown)
+    {
+      cle_clrtoeol(priv);
+    }
+
+  priv->shown  = column;
+  priv->column = column;
+  priv->dirty  = CLE_CLEAN;
+
   /* Turn the cursor back on */
 
   cle_cursoron(priv);
@@ -742,10 +891,17 @@ static int cle_editloop(FAR struct cle_s *priv)
     {
       int ch;
 
+      uint16_t column;
+
       /* Make sure that the display reflects the current state */
 
       cle_showtext(priv);
-      cle_setcursor(priv, priv->curpos);
+
+      column = cle_column(priv, priv->curpos);
+      if (column != priv->column)
+        {
+          cle_setcursor(priv, column);
+        }
 
       /* Get the next character from the input */
 
@@ -828,6 +984,7 @@ static int cle_editloop(FAR struct cle_s *priv)
         case KEY_DELEOL:  /* Delete to the end of the line */
           {
             priv->nchars = (priv->nchars > 0 ? priv->curpos + 1 : 0);
+            cle_changed(priv, priv->nchars);
           }
           break;
 
@@ -835,6 +992,7 @@ static int cle_editloop(FAR struct cle_s *priv)
           {
             priv->nchars = 0;
             priv->curpos = 0;
+            cle_changed(priv, 0);
           }
           break;
 
@@ -868,6 +1026,7 @@ static int cle_editloop(FAR struct cle_s *priv)
             priv->curpos = priv->nchars;
             cle_insertch(priv, '\n');
             cle_putch(priv, '\n');
+            cle_flush(priv);
             return OK;
           }
           break;
@@ -910,15 +1069,17 @@ static int cle_editloop(FAR struct cle_s *priv)
  ****************************************************************************/
 
 /****************************************************************************
- * Name: cle
+ * Name: cle_buffered
  *
  * Description:
- *   EMACS-like command line editor.  This is actually more like readline
- *   than is the NuttX readline!
+ *   EMACS-like command line editor.  This is the same as cle() except that
+ *   the display updates are collected in the caller-provided buffer
+ *   'outbuf' of size 'outsize' and sent with one write per keystroke.
  *
  ****************************************************************************/
 
-int cle(FAR char *line, uint16_t linelen, FILE *instream, FILE *outstream)
+int cle_buffered(FAR char *line, uint16_t linelen, FILE *instream,
+                 FILE *outstream, FAR char *outbuf, uint16_t outsize)
 {
   FAR struct cle_s priv;
   uint16_t column;
@@ -930,6 +1091,10 @@ int cle(FAR char *line, uint16_t linelen, FILE *instream, FILE *outstream)
 
   priv.linelen  = linelen;
   priv.line     = line;
+  priv.outbuf   = outbuf;
+  priv.outsize  = (outbuf != NULL) ? outsize : 0;
+  priv.dirty    = CLE_CLEAN;
+  priv.column   = CLE_UNKNOWN;
 
   /* REVISIT:  Non-standard, non-portable */
 
@@ -952,6 +1117,7 @@ int cle(FAR char *line, uint16_t linelen, FILE *instream, FILE *outstream)
     }
 
   priv.coloffs = column - 1;
+  priv.column  = 0;
 
   cleinfo("row=%d column=%d\n", priv.row, column);
 
@@ -959,8 +1125,33 @@ int cle(FAR char *line, uint16_t linelen, FILE *instream, FILE *outstream)
 
   ret = cle_editloop(&priv);
 
+  /* Send any remaining output.  The output buffer is empty on return. */
+
+  cle_flush(&priv);
+
   /* Make sure that the line is NUL terminated */
 
   line[priv.nchars] = '\0';
   return ret;
 }
+
+/****************************************************************************
+ * Name: cle
+ *
+ * Description:
+ *   EMACS-like command line editor.  This is actually more like readline
+ *   than is the NuttX readline!
+ *
+ ****************************************************************************/
+
+int cle(FAR char *line, uint16_t linelen, FILE *instream, FILE *outstream)
+{
+#if CONFIG_SYSTEM_CLE_OUTBUFSIZE > 0
+  char outbuf[CONFIG_SYSTEM_CLE_OUTBUFSIZE];
+
+  return cle_buffered(line, linelen, instream, outstream, outbuf,
+                      CONFIG_SYSTEM_CLE_OUTBUFSIZE);
+#else
+  return cle_buffered(line, linelen, instream, outstream, NULL, 0);
+#endif
+}
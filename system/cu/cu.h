@@ -59,6 +59,10 @@
 #  define CONFIG_SYSTEM_CUTERM_DEFAULT_BAUD 115200
 #endif
 
+#ifndef CONFIG_SYSTEM_CUTERM_BUFSIZE
+#  define CONFIG_SYSTEM_CUTERM_BUFSIZE 512
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -72,6 +76,8 @@ struct cu_globals_s
   int infd;            /* Incmoming data from serial port */
   int outfd;           /* Outgoing data to serial port */
   pthread_t listener;  /* Terminal listener thread */
+  FAR char *rxbuf;     /* Data from the serial port to the terminal */
+  FAR char *txbuf;     /* Data from the terminal in binary mode */
 };
 
 /****************************************************************************
@@ -98,16 +98,17 @@ static FAR void *cu_listener(FAR void *parameter)
 {
   for (;;)
     {
-      int rc;
-      char ch;
+      ssize_t nread;
 
-      rc = read(g_cu.infd, &ch, 1);
-      if (rc <= 0)
+      /* Take everything the serial driver has buffered in one read */
+
+      nread = read(g_cu.infd, g_cu.rxbuf, CONFIG_SYSTEM_CUTERM_BUFSIZE);
+      if (nread <= 0)
         {
           break;
         }
 
-      fputc(ch, stdout);
+      fwrite(g_cu.rxbuf, 1, nread, stdout);
       fflush(stdout);
     }
 
@@ -116,6 +117,38 @@ static FAR void *cu_listener(FAR void *parameter)
   return NULL;
 }
 
+/****************************************************************************
+ * Name: cu_write
+ *
+ * Description:
+ *   Write all of a buffer to the serial port.
+ *
+ ****************************************************************************/
+
+static int cu_write(int fd, FAR const char *buffer, size_t buflen)
+{
+  ssize_t nwritten;
+
+  while (buflen > 0)
+    {
+      nwritten = write(fd, buffer, buflen);
+      if (nwritten < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          return -errno;
+        }
+
+      buffer += nwritten;
+      buflen -= nwritten;
+    }
+
+  return OK;
+}
+
 static void sigint(int sig)
 {
   pthread_cancel(g_cu.listener);
@@ -124,14 +157,16 @@ static void sigint(int sig)
   exit(0);
 }
 
-static int enable_crlf_conversion(int fd)
+static int enable_crlf_conversion(int fd, bool enable)
 {
 #ifdef CONFIG_SERIAL_TERMIOS
   int rc = 0;
   int ret;
   struct termios tio;
 
-  /* enable \n -> \r\n conversion during write */
+  /* enable \n -> \r\n conversion during write, or pass all data through
+   * unchanged in binary mode.
+   */
 
   ret = tcgetattr(fd, &tio);
   if (ret)
@@ -140,7 +175,7 @@ static int enable_crlf_conversion(int fd)
       rc = -1;
     }
 
-  tio.c_oflag = OPOST | ONLCR;
+  tio.c_oflag = enable ? OPOST | ONLCR : 0;
   ret = tcsetattr(fd, TCSANOW, &tio);
   if (ret)
     {
@@ -150,7 +185,7 @@ static int enable_crlf_conversion(int fd)
 
   return rc;
 #else
-  return -1;
+  return enable ? -1 : 0;
 #endif
 }
 
@@ -220,6 +255,7 @@ static void print_help(void)
          " -o: Set odd parity\n"
          " -s: Use given speed (default %d)\n"
          " -r: Disable RTS/CTS flow control (default: on)\n"
+         " -b: Binary passthrough, no CR/LF conversion or escapes\n"
          " -?: This help\n",
          CONFIG_SYSTEM_CUTERM_DEFAULT_DEVICE,
          CONFIG_SYSTEM_CUTERM_DEFAULT_BAUD);
@@ -273,6 +309,7 @@ int cu_main(int argc, FAR char *argv[])
   int baudrate = CONFIG_SYSTEM_CUTERM_DEFAULT_BAUD;
   enum parity_mode parity = PARITY_NONE;
   int rtscts = 1;
+  bool binary = false;
   int option;
   int ret;
   int bcmd;
@@ -291,7 +328,7 @@ int cu_main(int argc, FAR char *argv[])
   sigaction(SIGTERM, &sa, NULL);
   sigaction(SIGKILL, &sa, NULL);
 
-  while ((option = getopt(argc, argv, "l:s:eor?")) != ERROR)
+  while ((option = getopt(argc, argv, "l:s:eorb?")) != ERROR)
     {
       switch (option)
         {
@@ -315,6 +352,10 @@ int cu_main(int argc, FAR char *argv[])
             rtscts = 0;
             break;
 
+          case 'b':
+            binary = true;
+            break;
+
           case '?':
             print_help();
             return EXIT_SUCCESS;
@@ -334,7 +375,7 @@ int cu_main(int argc, FAR char *argv[])
       goto errout_with_devinit;
     }
 
-  enable_crlf_conversion(g_cu.outfd);
+  enable_crlf_conversion(g_cu.outfd, !binary);
   set_baudrate(g_cu.outfd, baudrate, parity, rtscts);
 
   /* Open the serial device for reading.  Since we are already connected, this
@@ -349,6 +390,16 @@ int cu_main(int argc, FAR char *argv[])
       goto errout_with_outfd;
     }
 
+  /* Allocate the transfer buffers */
+
+  g_cu.rxbuf = (FAR char *)malloc(CONFIG_SYSTEM_CUTERM_BUFSIZE);
+  g_cu.txbuf = (FAR char *)malloc(CONFIG_SYSTEM_CUTERM_BUFSIZE);
+  if (g_cu.rxbuf == NULL || g_cu.txbuf == NULL)
+    {
+      fprintf(stderr, "cu_main: ERROR: Failed to allocate buffers\n");
+      goto errout_with_fds;
+    }
+
   /* Start the serial receiver thread */
 
   ret = pthread_attr_init(&attr);
@@ -366,9 +417,25 @@ int cu_main(int argc, FAR char *argv[])
       goto errout_with_fds;
     }
 
+  /* In binary mode, relay whole buffers from the terminal to the serial
+   * port until end of input or a signal.  There are no escapes since any
+   * byte may be part of the data.
+   */
+
+  while (binary)
+    {
+      ssize_t nread;
+
+      nread = read(fileno(stdin), g_cu.txbuf, CONFIG_SYSTEM_CUTERM_BUFSIZE);
+      if (nread <= 0 || cu_write(g_cu.outfd, g_cu.txbuf, nread) < 0)
+        {
+          break;
+        }
+    }
+
   /* Send messages and get responses -- forever */
 
-  for (;;)
+  while (!binary)
     {
       int ch = getc(stdin);
 
@@ -417,13 +484,18 @@ int cu_main(int argc, FAR char *argv[])
         }
     }
 
+  /* Wait for the listener to stop before its buffer is freed */
+
   pthread_cancel(g_cu.listener);
+  pthread_join(g_cu.listener, NULL);
   pthread_attr_destroy(&attr);
   exitval = EXIT_SUCCESS;
 
   /* Error exits */
 
 errout_with_fds:
+  free(g_cu.rxbuf);
+  free(g_cu.txbuf);
   close(g_cu.infd);
 errout_with_outfd:
   close(g_cu.outfd);
@@ -0,0 +1,410 @@
+/****************************************************************************
+ * apps/system/hex2bin/hex2bin_blk.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include "hex2bin_blk.h"
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: blk_start and blk_end
+ *
+ * Description:
+ *   Return the range of offsets covered by the block containing 'offset'.
+ *
+ ****************************************************************************/
+
+static off_t blk_start(FAR struct hex2bin_blkstream_s *stream, off_t offset)
+{
+  size_t rem = (size_t)((stream->origin + (uintptr_t)offset) %
+                        stream->blocksize);
+
+  return offset > (off_t)rem ? offset - (off_t)rem : 0;
+}
+
+static off_t blk_end(FAR struct hex2bin_blkstream_s *stream, off_t offset)
+{
+  size_t rem = (size_t)((stream->origin + (uintptr_t)offset) %
+                        stream->blocksize);
+  off_t end  = offset - (off_t)rem + (off_t)stream->blocksize;
+
+  if (stream->limit > 0 && end > stream->limit)
+    {
+      end = stream->limit;
+    }
+
+  return end;
+}
+
+/****************************************************************************
+ * Name: blk_writeout
+ *
+ * Description:
+ *   Pass the buffered block to the backing store if it has been modified.
+ *
+ ****************************************************************************/
+
+static int blk_writeout(FAR struct hex2bin_blkstream_s *stream)
+{
+  off_t end;
+  int ret;
+
+  if (!stream->dirty)
+    {
+      return OK;
+    }
+
+  ret = stream->write(stream, stream->blkoffset, stream->buffer,
+                      stream->blklen);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  end = stream->blkoffset + (off_t)stream->blklen;
+  if (end > stream->written)
+    {
+      stream->written = end;
+    }
+
+  stream->dirty = false;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: blk_load
+ *
+ * Description:
+ *   Make the block containing 'offset' the buffered block.  Any hole
+ *   between the end of the data already written and the new block is
+ *   written with the fill value first, a block at block boundaries at a
+ *   time, so that the output never contains undefined data.
+ *
+ ****************************************************************************/
+
+static int blk_load(FAR struct hex2bin_blkstream_s *stream, off_t offset)
+{
+  off_t start;
+  off_t end;
+  off_t pos;
+  ssize_t nread;
+  int ret;
+
+  ret = blk_writeout(stream);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  stream->blkoffset = -1;
+  start = blk_start(stream, offset);
+
+  for (pos = stream->written; pos < start; pos = end)
+    {
+      end = blk_end(stream, pos);
+      if (end > start)
+        {
+          end = start;
+        }
+
+      memset(stream->buffer, stream->fill, (size_t)(end - pos));
+      ret = stream->write(stream, pos, stream->buffer, (size_t)(end - pos));
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      stream->written = end;
+    }
+
+  /* Start from the fill value, then merge in anything already written */
+
+  end = blk_end(stream, start);
+  memset(stream->buffer, stream->fill, (size_t)(end - start));
+  stream->blklen = 0;
+
+  if (start < stream->written)
+    {
+      if (end > stream->written)
+        {
+          end = stream->written;
+        }
+
+      nread = stream->read(stream, start, stream->buffer,
+                           (size_t)(end - start));
+      if (nread < 0)
+        {
+          return (int)nread;
+        }
+
+      stream->blklen = (size_t)nread;
+    }
+
+  stream->blkoffset = start;
+  stream->blkend    = blk_end(stream, start);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: blk_putc
+ ****************************************************************************/
+
+static void blk_putc(FAR struct lib_sostream_s *this, int ch)
+{
+  FAR struct hex2bin_blkstream_s *stream =
+    (FAR struct hex2bin_blkstream_s *)this;
+  size_t index;
+  int ret;
+
+  if (stream->errcode < 0)
+    {
+      return;
+    }
+
+  if (stream->limit > 0 && stream->offset >= stream->limit)
+    {
+      stream->errcode = -ENOSPC;
+      return;
+    }
+
+  if (stream->blkoffset < 0 || stream->offset < stream->blkoffset ||
+      stream->offset >= stream->blkend)
+    {
+      ret = blk_load(stream, stream->offset);
+      if (ret < 0)
+        {
+          stream->errcode = ret;
+          return;
+        }
+    }
+
+  index = (size_t)(stream->offset - stream->blkoffset);
+  stream->buffer[index] = (uint8_t)ch;
+  if (index >= stream->blklen)
+    {
+      stream->blklen = index + 1;
+    }
+
+  stream->dirty = true;
+  stream->offset++;
+  this->nput++;
+}
+
+/****************************************************************************
+ * Name: blk_seek
+ ****************************************************************************/
+
+static off_t blk_seek(FAR struct lib_sostream_s *this, off_t offset,
+                      int whence)
+{
+  FAR struct hex2bin_blkstream_s *stream =
+    (FAR struct hex2bin_blkstream_s *)this;
+
+  if (stream->errcode < 0)
+    {
+      return (off_t)stream->errcode;
+    }
+
+  switch (whence)
+    {
+      case SEEK_CUR:
+        offset += stream->offset;
+        break;
+
+      case SEEK_SET:
+        break;
+
+      default:
+        return (off_t)-EINVAL;
+    }
+
+  if (offset < 0 || (stream->limit > 0 && offset > stream->limit))
+    {
+      return (off_t)-EINVAL;
+    }
+
+  /* The block is only changed on the next put so that consecutive records
+   * in the same block are merged.
+   */
+
+  stream->offset = offset;
+  return offset;
+}
+
+/****************************************************************************
+ * Name: blk_flush
+ ****************************************************************************/
+
+static int blk_flush(FAR struct lib_sostream_s *this)
+{
+  FAR struct hex2bin_blkstream_s *stream =
+    (FAR struct hex2bin_blkstream_s *)this;
+  int ret;
+
+  if (stream->errcode < 0)
+    {
+      return stream->errcode;
+    }
+
+  ret = blk_writeout(stream);
+  if (ret < 0)
+    {
+      stream->errcode = ret;
+      return ret;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: blk_init
+ ****************************************************************************/
+
+static void blk_init(FAR struct hex2bin_blkstream_s *stream,
+                     FAR uint8_t *buffer, size_t blocksize, uint8_t fill)
+{
+  memset(stream, 0, sizeof(struct hex2bin_blkstream_s));
+
+  stream->public.put   = blk_putc;
+  stream->public.flush = blk_flush;
+  stream->public.seek  = blk_seek;
+  stream->buffer       = buffer;
+  stream->blocksize    = blocksize;
+  stream->blkoffset    = -1;
+  stream->fill         = fill;
+}
+
+/****************************************************************************
+ * Name: file_write and file_read
+ ****************************************************************************/
+
+static int file_write(FAR struct hex2bin_blkstream_s *stream, off_t offset,
+                      FAR uint8_t *buffer, size_t nbytes)
+{
+  FAR FILE *outstream = (FAR FILE *)stream->backing;
+
+  if (fseek(outstream, offset, SEEK_SET) < 0 ||
+      fwrite(buffer, 1, nbytes, outstream) != nbytes)
+    {
+      return -errno;
+    }
+
+  return OK;
+}
+
+static int file_read(FAR struct hex2bin_blkstream_s *stream, off_t offset,
+                     FAR uint8_t *buffer, size_t nbytes)
+{
+  FAR FILE *outstream = (FAR FILE *)stream->backing;
+  size_t nread;
+
+  if (fseek(outstream, offset, SEEK_SET) < 0)
+    {
+      return -errno;
+    }
+
+  nread = fread(buffer, 1, nbytes, outstream);
+  if (nread < nbytes && ferror(outstream))
+    {
+      return -errno;
+    }
+
+  return (int)nread;
+}
+
+/****************************************************************************
+ * Name: mem_write and mem_read
+ ****************************************************************************/
+
+static int mem_write(FAR struct hex2bin_blkstream_s *stream, off_t offset,
+                     FAR uint8_t *buffer, size_t nbytes)
+{
+  memcpy((FAR uint8_t *)stream->backing + offset, buffer, nbytes);
+  return OK;
+}
+
+static int mem_read(FAR struct hex2bin_blkstream_s *stream, off_t offset,
+                    FAR uint8_t *buffer, size_t nbytes)
+{
+  memcpy(buffer, (FAR uint8_t *)stream->backing + offset, nbytes);
+  return (int)nbytes;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: hex2bin_blkfile
+ ****************************************************************************/
+
+void hex2bin_blkfile(FAR struct hex2bin_blkstream_s *stream,
+                     FAR FILE *outstream, FAR uint8_t *buffer,
+                     size_t blocksize, uint8_t fill)
+{
+  blk_init(stream, buffer, blocksize, fill);
+
+  stream->write   = file_write;
+  stream->read    = file_read;
+  stream->backing = outstream;
+}
+
+/****************************************************************************
+ * Name: hex2bin_blkmem
+ ****************************************************************************/
+
+void hex2bin_blkmem(FAR struct hex2bin_blkstream_s *stream,
+                    uintptr_t baseaddr, size_t size, FAR uint8_t *buffer,
+                    size_t blocksize, uint8_t fill)
+{
+  blk_init(stream, buffer, blocksize, fill);
+
+  stream->write   = mem_write;
+  stream->read    = mem_read;
+  stream->backing = (FAR void *)baseaddr;
+  stream->limit   = (off_t)size;
+  stream->origin  = baseaddr;
+}
@@ -0,0 +1,135 @@
+/****************************************************************************
+ * apps/system/hex2bin/hex2bin_blk.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_SYSTEM_HEX2BIN_HEX2BIN_BLK_H
+#define __APPS_SYSTEM_HEX2BIN_HEX2BIN_BLK_H 1
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <nuttx/streams.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Configuration ************************************************************/
+
+#ifndef CONFIG_SYSTEM_HEX2BIN_BLOCKSIZE
+#  define CONFIG_SYSTEM_HEX2BIN_BLOCKSIZE 4096
+#endif
+
+#ifndef CONFIG_SYSTEM_HEX2BIN_FILL
+#  define CONFIG_SYSTEM_HEX2BIN_FILL 0xff
+#endif
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* hex2bin() emits each record as a seek followed by a few put() calls.  A
+ * block stream collects those bytes in a buffer covering one aligned block
+ * of the output and only passes whole blocks to the backing store.  Bytes
+ * not covered by any record are set to the fill value.  A block that was
+ * already written out is read back before it is modified again, so the
+ * records need not be in address order.
+ */
+
+struct hex2bin_blkstream_s;
+
+typedef CODE int (*hex2bin_blkio_t)(FAR struct hex2bin_blkstream_s *stream,
+                                    off_t offset, FAR uint8_t *buffer,
+                                    size_t nbytes);
+
+struct hex2bin_blkstream_s
+{
+  struct lib_sostream_s public;  /* Stream passed to hex2bin() */
+  hex2bin_blkio_t write;         /* Write data to the backing store */
+  hex2bin_blkio_t read;          /* Read back data, returns bytes read */
+  FAR void       *backing;       /* FILE stream or memory base address */
+  FAR uint8_t    *buffer;        /* One block of output data */
+  size_t          blocksize;     /* Size of the buffer */
+  off_t           limit;         /* Size of the backing store, zero if none */
+  uintptr_t       origin;        /* Absolute address of offset zero */
+  off_t           offset;        /* Current position */
+  off_t           blkoffset;     /* Position of buffer[0], -1 if none */
+  off_t           blkend;        /* End of the buffered block */
+  off_t           written;       /* End of the data written to the backing */
+  size_t          blklen;        /* Number of valid bytes in the buffer */
+  uint8_t         fill;          /* Value of bytes not in any record */
+  bool            dirty;         /* Buffer modified since last written */
+  int             errcode;       /* First error, reported by seek and flush */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: hex2bin_blkfile
+ *
+ * Description:
+ *   Initialize a block stream that writes to a FILE stream opened for both
+ *   reading and writing.  Blocks are aligned to the start of the file.
+ *
+ ****************************************************************************/
+
+void hex2bin_blkfile(FAR struct hex2bin_blkstream_s *stream,
+                     FAR FILE *outstream, FAR uint8_t *buffer,
+                     size_t blocksize, uint8_t fill);
+
+/****************************************************************************
+ * Name: hex2bin_blkmem
+ *
+ * Description:
+ *   Initialize a block stream that writes to 'size' bytes of memory at
+ *   'baseaddr'.  Blocks are aligned to absolute addresses so that each
+ *   write covers whole flash pages or sectors.
+ *
+ ****************************************************************************/
+
+void hex2bin_blkmem(FAR struct hex2bin_blkstream_s *stream,
+                    uintptr_t baseaddr, size_t size, FAR uint8_t *buffer,
+                    size_t blocksize, uint8_t fill);
+
+#endif /* __APPS_SYSTEM_HEX2BIN_HEX2BIN_BLK_H */
@@ -47,6 +47,8 @@
 
 #include <nuttx/streams.h>
 
+#include "hex2bin_blk.h"
+
 #ifdef CONFIG_SYSTEM_HEX2BIN_BUILTIN
 
 /****************************************************************************
@@ -87,6 +89,9 @@ static void show_usage(FAR const char *progname, int exitcode)
   fprintf(stderr, "\t\t(0) No swap, (1) swap bytes in 16-bit values, or (3) swap\n");
   fprintf(stderr, "\t\tbytes in 32-bit values.  Default: %d\n",
           CONFIG_SYSTEM_HEX2BIN_SWAP);
+  fprintf(stderr, "\t-f <fill value>\n");
+  fprintf(stderr, "\t\tThe value of bytes not covered by any record.  Default:\n");
+  fprintf(stderr, "\t\t0x%02x\n", CONFIG_SYSTEM_HEX2BIN_FILL);
 #endif
   exit(exitcode);
 }
@@ -116,15 +121,17 @@ int hex2bin_main(int argc, char **argv)
 #endif
 {
   struct lib_stdinstream_s stdinstream;
-  struct lib_stdsostream_s stdoutstream;
+  struct hex2bin_blkstream_s blkoutstream;
   FAR const char *hexfile;
   FAR const char *binfile;
   FAR char *endptr;
   FAR FILE *instream;
   FAR FILE *outstream;
+  FAR uint8_t *buffer;
   unsigned long baseaddr;
   unsigned long endpaddr;
   unsigned long swap;
+  unsigned long fill;
   int option;
   int ret;
 
@@ -133,8 +140,9 @@ int hex2bin_main(int argc, char **argv)
   baseaddr = CONFIG_SYSTEM_HEX2BIN_BASEADDR;
   endpaddr = CONFIG_SYSTEM_HEX2BIN_ENDPADDR;
   swap     = CONFIG_SYSTEM_HEX2BIN_SWAP;
+  fill     = CONFIG_SYSTEM_HEX2BIN_FILL;
 
-  while ((option = getopt(argc, argv, ":hs:e:w:")) != ERROR)
+  while ((option = getopt(argc, argv, ":hs:e:w:f:")) != ERROR)
     {
       switch (option)
         {
@@ -171,6 +179,15 @@ int hex2bin_main(int argc, char **argv)
             }
           break;
 
+        case 'f':
+          fill = strtoul(optarg, &endptr, 16);
+          if (endptr == optarg || fill > 0xff)
+            {
+              fprintf(stderr, "ERROR: Invalid argument to the -f option\n");
+              show_usage(argv[0], EXIT_FAILURE);
+            }
+          break;
+
         case ':':
           fprintf(stderr, "ERROR: Missing required argument\n");
           show_usage(argv[0], EXIT_FAILURE);
@@ -223,9 +240,11 @@ int hex2bin_main(int argc, char **argv)
       return -errcode;
     }
 
-  /* Open the BIN file for reading */
+  /* Open the BIN file for writing.  It is also read so that a block that
+   * was already written can be updated by a later record.
+   */
 
-  outstream = fopen(binfile, "wb");
+  outstream = fopen(binfile, "w+b");
   if (outstream == NULL)
     {
       int errcode = errno;
@@ -237,16 +256,37 @@ int hex2bin_main(int argc, char **argv)
       return -errcode;
     }
 
-  /* Wrap the FILE streams as standard streams */
+  /* Allocate the buffer that collects records into whole blocks */
+
+  buffer = (FAR uint8_t *)malloc(CONFIG_SYSTEM_HEX2BIN_BLOCKSIZE);
+  if (buffer == NULL)
+    {
+      fprintf(stderr, "ERROR: Failed to allocate the block buffer\n");
+      fclose(instream);
+      fclose(outstream);
+      return -ENOMEM;
+    }
+
+  /* Wrap the HEX FILE stream as a standard stream and the BIN FILE stream
+   * as a block stream so that it is written a block at a time.
+   */
 
   lib_stdinstream(&stdinstream, instream);
-  lib_stdsostream(&stdoutstream, outstream);
+  hex2bin_blkfile(&blkoutstream, outstream, buffer,
+                  CONFIG_SYSTEM_HEX2BIN_BLOCKSIZE, (uint8_t)fill);
 
   /* And do the deed */
 
-  ret = hex2bin(&stdinstream.public, &stdoutstream.public,
+  ret = hex2bin(&stdinstream.public, &blkoutstream.public,
                 (uint32_t)baseaddr, (uint32_t)endpaddr,
                 (enum hex2bin_swap_e)swap);
+  if (ret >= 0)
+    {
+      /* Write out the final partial block */
+
+      ret = blkoutstream.public.flush(&blkoutstream.public);
+    }
+
   if (ret < 0)
     {
       fprintf(stderr, "ERROR: Failed to convert to binary: %d\n", ret);
@@ -257,6 +297,7 @@ int hex2bin_main(int argc, char **argv)
   fflush(outstream);
   fclose(instream);
   fclose(outstream);
+  free(buffer);
   return ret < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
 }
 
@@ -47,6 +47,8 @@
 
 #include <nuttx/streams.h>
 
+#include "hex2bin_blk.h"
+
 #ifdef CONFIG_SYSTEM_HEX2MEM_BUILTIN
 
 /****************************************************************************
@@ -82,6 +84,9 @@ static void show_usage(FAR const char *progname, int exitcode)
   fprintf(stderr, "\t\t(0) No swap, (1) swap bytes in 16-bit values, or (3) swap\n");
   fprintf(stderr, "\t\tbytes in 32-bit values.  Default: %d\n",
           CONFIG_SYSTEM_HEX2MEM_SWAP);
+  fprintf(stderr, "\t-f <fill value>\n");
+  fprintf(stderr, "\t\tThe value of bytes not covered by any record.  Default:\n");
+  fprintf(stderr, "\t\t0x%02x\n", CONFIG_SYSTEM_HEX2BIN_FILL);
 #endif
   exit(exitcode);
 }
@@ -111,13 +116,15 @@ int hex2mem_main(int argc, char **argv)
 #endif
 {
   struct lib_stdinstream_s stdinstream;
-  struct lib_memsostream_s memoutstream;
+  struct hex2bin_blkstream_s memoutstream;
   FAR const char *hexfile;
   FAR char *endptr;
   FAR FILE *instream;
+  FAR uint8_t *buffer;
   unsigned long baseaddr;
   unsigned long endpaddr;
   unsigned long swap;
+  unsigned long fill;
   int option;
   int ret;
 
@@ -126,8 +133,9 @@ int hex2mem_main(int argc, char **argv)
   baseaddr = CONFIG_SYSTEM_HEX2MEM_BASEADDR;
   endpaddr = CONFIG_SYSTEM_HEX2MEM_ENDPADDR;
   swap     = CONFIG_SYSTEM_HEX2MEM_SWAP;
+  fill     = CONFIG_SYSTEM_HEX2BIN_FILL;
 
-  while ((option = getopt(argc, argv, ":hs:e:w:")) != ERROR)
+  while ((option = getopt(argc, argv, ":hs:e:w:f:")) != ERROR)
     {
       switch (option)
         {
@@ -164,6 +172,15 @@ int hex2mem_main(int argc, char **argv)
             }
           break;
 
+        case 'f':
+          fill = strtoul(optarg, &endptr, 16);
+          if (endptr == optarg || fill > 0xff)
+            {
+              fprintf(stderr, "ERROR: Invalid argument to the -f option\n");
+              show_usage(argv[0], EXIT_FAILURE);
+            }
+          break;
+
         case ':':
           fprintf(stderr, "ERROR: Missing required argument\n");
           show_usage(argv[0], EXIT_FAILURE);
@@ -215,19 +232,37 @@ int hex2mem_main(int argc, char **argv)
       return -errcode;
     }
 
-  /* Wrap the FILE stream as a standard stream; wrap the memory as a memory
-   * stream.
+  /* Allocate the buffer that collects records into whole blocks */
+
+  buffer = (FAR uint8_t *)malloc(CONFIG_SYSTEM_HEX2BIN_BLOCKSIZE);
+  if (buffer == NULL)
+    {
+      fprintf(stderr, "ERROR: Failed to allocate the block buffer\n");
+      fclose(instream);
+      return -ENOMEM;
+    }
+
+  /* Wrap the FILE stream as a standard stream; wrap the memory as a block
+   * stream so that it is written a page or sector at a time.
    */
 
   lib_stdinstream(&stdinstream, instream);
-  lib_memsostream(&memoutstream, (FAR char *)baseaddr,
-                  (int)(endpaddr - baseaddr));
+  hex2bin_blkmem(&memoutstream, (uintptr_t)baseaddr,
+                 (size_t)(endpaddr - baseaddr), buffer,
+                 CONFIG_SYSTEM_HEX2BIN_BLOCKSIZE, (uint8_t)fill);
 
   /* And do the deed */
 
   ret = hex2bin(&stdinstream.public, &memoutstream.public,
                 (uint32_t)baseaddr, (uint32_t)endpaddr,
                 (enum hex2bin_swap_e)swap);
+  if (ret >= 0)
+    {
+      /* Write out the final partial block */
+
+      ret = memoutstream.public.flush(&memoutstream.public);
+    }
+
   if (ret < 0)
     {
       fprintf(stderr, "ERROR: Failed to convert to binary: %d\n", ret);
@@ -236,6 +271,7 @@ int hex2mem_main(int argc, char **argv)
   /* Clean up and return */
 
   fclose(instream);
+  free(buffer);
   return ret < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
 }
 
@@ -39,6 +39,9 @@
  * Included Files
  ****************************************************************************/
 
+#include <nuttx/config.h>
+
+#include <stdbool.h>
 #include <stdio.h>
 
 /****************************************************************************
@@ -51,6 +54,19 @@
 #define BFILE_BUF_ALIGN(sz) \
   ((sz + BFILE_BUF_MIN - 1) / BFILE_BUF_MIN * BFILE_BUF_MIN)
 
+/* Paged file page size/count */
+
+#ifdef CONFIG_SYSTEM_HEXED_PAGED
+#  ifndef CONFIG_SYSTEM_HEXED_PAGESIZE
+#    define CONFIG_SYSTEM_HEXED_PAGESIZE 4096
+#  endif
+#  ifndef CONFIG_SYSTEM_HEXED_NPAGES
+#    define CONFIG_SYSTEM_HEXED_NPAGES 8
+#  endif
+#  define BFILE_PAGE_SIZE CONFIG_SYSTEM_HEXED_PAGESIZE
+#  define BFILE_NPAGES    CONFIG_SYSTEM_HEXED_NPAGES
+#endif
+
 /* Buffered File flags */
 
 #define BFILE_FL_DIRTY 0x00000001
@@ -59,6 +75,34 @@
  * Public Types
  ****************************************************************************/
 
+#ifdef CONFIG_SYSTEM_HEXED_PAGED
+/* Paged File
+ *
+ * Only BFILE_NPAGES windows of the file are held in memory.  Pages are
+ * loaded when first accessed and are written back when they are evicted or
+ * the file is flushed, and only if they were modified.
+ */
+
+struct bfpage_s
+{
+  long off;                 /* File offset of the page, -1 if unused */
+  unsigned long lru;        /* Last access, for eviction */
+  bool dirty;               /* Modified since loaded or written */
+  FAR char *data;           /* BFILE_PAGE_SIZE bytes of page data */
+};
+
+struct bfile_s
+{
+  FAR FILE *fp;
+  FAR char *name;
+  long size;                /* Logical file size */
+  int flags;
+  long disksz;              /* Bytes of the disk file holding valid data */
+  unsigned long tick;       /* LRU clock */
+  FAR char *tmp;            /* Bounce buffer for moving data */
+  struct bfpage_s pages[BFILE_NPAGES];
+};
+#else
 /* Buffered File */
 
 struct bfile_s
@@ -70,6 +114,7 @@ struct bfile_s
   long bufsz;
   FAR char *buf;
 };
+#endif
 
 /****************************************************************************
  * Public Function Prototypes
@@ -81,6 +126,8 @@ struct bfile_s *bfopen(FAR char *name, FAR char *mode);
 int    bfclose(FAR struct bfile_s *bf);
 long   bfclip(FAR struct bfile_s *bf, long off, long sz);
 long   bfcopy(FAR struct bfile_s *bf, long dest, long src, long sz);
+long   bfcopyover(FAR struct bfile_s *bf, long dest, long src, long sz);
+long   bfget(FAR struct bfile_s *bf, long off, FAR void *mem, long sz);
 long   bfinsert(FAR struct bfile_s *bf, long off, FAR void *mem, long sz);
 long   bfmove(FAR struct bfile_s *bf, long dest, long src, long sz);
 long   bfread(FAR struct bfile_s *bf);
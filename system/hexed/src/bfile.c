@@ -168,7 +168,7 @@ int bfflush(FAR struct bfile_s *bf)
       fprintf(stderr, "ERROR: Write to file failed: %d\n", errcode);
       ret = -errcode;
     }
-  else if (fwrite(bf->buf, 1, bf->size, bf->fp) == bf->size)
+  else if (nread != bf->size)
     {
       fprintf(stderr, "ERROR: Bad write size\n");
       ret = -EIO;
@@ -392,6 +392,51 @@ long bfcopy(FAR struct bfile_s *bf, long off, long src, long sz)
   return bfinsert(bf, off, bf->buf + src, sz);
 }
 
+/* Copies bytes from src to off, overwriting the data at off */
+
+long bfcopyover(FAR struct bfile_s *bf, long off, long src, long sz)
+{
+  if (bf == NULL)
+    {
+      return EOF;
+    }
+
+  /* Grow the buffer first so that the source is not moved by bfwrite */
+
+  if (bf->bufsz < off + sz && bfallocbuf(bf, off + sz) == NULL)
+    {
+      return EOF;
+    }
+
+  return bfwrite(bf, off, bf->buf + src, sz);
+}
+
+/* Get bytes from the Buffered File
+ *
+ * Copies up to sz bytes at off to mem, returns the number of bytes copied.
+ */
+
+long bfget(FAR struct bfile_s *bf, long off, FAR void *mem, long sz)
+{
+  if (bf == NULL)
+    {
+      return EOF;
+    }
+
+  if (off < 0 || off >= bf->size)
+    {
+      return 0;
+    }
+
+  if (off + sz > bf->size)
+    {
+      sz = bf->size - off;
+    }
+
+  memcpy(mem, bf->buf + off, sz);
+  return sz;
+}
+
 /* Moves bytes from src to off
  *
  * Moves the data from src to off then removes the data from the original src
@@ -0,0 +1,816 @@
+/****************************************************************************
+ * apps/system/hexed/src/bfpage.c
+ * Paged file control
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "bfile.h"
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char g_zeroes[64];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Free a paged file */
+
+static int bffree(FAR struct bfile_s *bf)
+{
+  if (bf == NULL)
+    {
+      return -EBADF;
+    }
+
+  /* Free the page data and the bounce buffer, they are one allocation */
+
+  if (bf->tmp != NULL)
+    {
+      free(bf->tmp);
+    }
+
+  /* Free file name */
+
+  if (bf->name != NULL)
+    {
+      free(bf->name);
+    }
+
+  free(bf);
+  return 0;
+}
+
+/* Write a page back to the file
+ *
+ * Only the part of the page inside the logical file is written.  If the page
+ * starts past the valid data in the file, the hole is zeroed first so that
+ * it reads back as it would from the buffered backend.
+ */
+
+static int bfpage_writeback(FAR struct bfile_s *bf, FAR struct bfpage_s *pg)
+{
+  long len;
+  long n;
+
+  if (!pg->dirty)
+    {
+      return OK;
+    }
+
+  pg->dirty = false;
+  len = bf->size - pg->off;
+  if (len <= 0)
+    {
+      return OK;
+    }
+
+  if (len > BFILE_PAGE_SIZE)
+    {
+      len = BFILE_PAGE_SIZE;
+    }
+
+  if (bf->disksz < pg->off)
+    {
+      fseek(bf->fp, bf->disksz, SEEK_SET);
+      for (; bf->disksz < pg->off; bf->disksz += n)
+        {
+          n = pg->off - bf->disksz;
+          if (n > (long)sizeof(g_zeroes))
+            {
+              n = sizeof(g_zeroes);
+            }
+
+          if (fwrite(g_zeroes, 1, n, bf->fp) != (size_t)n)
+            {
+              goto errout;
+            }
+        }
+    }
+
+  fseek(bf->fp, pg->off, SEEK_SET);
+  if (fwrite(pg->data, 1, len, bf->fp) != (size_t)len)
+    {
+      goto errout;
+    }
+
+  if (bf->disksz < pg->off + len)
+    {
+      bf->disksz = pg->off + len;
+    }
+
+  return OK;
+
+errout:
+  fprintf(stderr, "ERROR: Write to file failed: %d\n", errno);
+  return -EIO;
+}
+
+/* Get the page holding offset off, loading it if needed */
+
+static FAR struct bfpage_s *bfpage(FAR struct bfile_s *bf, long off)
+{
+  FAR struct bfpage_s *pg;
+  FAR struct bfpage_s *victim;
+  long len;
+  int i;
+
+  off -= off % BFILE_PAGE_SIZE;
+  victim = &bf->pages[0];
+
+  for (i = 0; i < BFILE_NPAGES; i++)
+    {
+      pg = &bf->pages[i];
+      if (pg->off == off)
+        {
+          pg->lru = ++bf->tick;
+          return pg;
+        }
+
+      if (pg->off < 0 || (victim->off >= 0 && pg->lru < victim->lru))
+        {
+          victim = pg;
+        }
+    }
+
+  /* Evict the least recently used page */
+
+  pg = victim;
+  if (pg->off >= 0 && bfpage_writeback(bf, pg) < 0)
+    {
+      return NULL;
+    }
+
+  /* Load the valid file data, anything past it reads as zero */
+
+  len = bf->disksz - off;
+  if (len < 0)
+    {
+      len = 0;
+    }
+  else if (len > BFILE_PAGE_SIZE)
+    {
+      len = BFILE_PAGE_SIZE;
+    }
+
+  if (len > 0)
+    {
+      fseek(bf->fp, off, SEEK_SET);
+      if (fread(pg->data, 1, len, bf->fp) != (size_t)len)
+        {
+          fprintf(stderr, "ERROR: Read from file failed: %d\n", errno);
+          pg->off = -1;
+          return NULL;
+        }
+    }
+
+  memset(pg->data + len, 0, BFILE_PAGE_SIZE - len);
+
+  pg->off   = off;
+  pg->dirty = false;
+  pg->lru   = ++bf->tick;
+  return pg;
+}
+
+/* Copy data between memory and the pages
+ *
+ * Writing past the end of the file increases the file size.
+ */
+
+static long bfxfer(FAR struct bfile_s *bf, long off, FAR char *mem, long sz,
+                   bool write)
+{
+  FAR struct bfpage_s *pg;
+  long done;
+  long pos;
+  long len;
+
+  for (done = 0; done < sz; done += len)
+    {
+      pg = bfpage(bf, off + done);
+      if (pg == NULL)
+        {
+          return EOF;
+        }
+
+      pos = (off + done) - pg->off;
+      len = BFILE_PAGE_SIZE - pos;
+      if (len > sz - done)
+        {
+          len = sz - done;
+        }
+
+      if (write)
+        {
+          /* Grow the file as each page is written, a page evicted by the
+           * next one is only written back up to the file size.
+           */
+
+          memcpy(pg->data + pos, mem + done, len);
+          pg->dirty  = true;
+          bf->flags |= BFILE_FL_DIRTY;
+
+          if (bf->size < off + done + len)
+            {
+              bf->size = off + done + len;
+            }
+        }
+      else
+        {
+          memcpy(mem + done, pg->data + pos, len);
+        }
+    }
+
+  return sz;
+}
+
+/* Copy sz bytes from src to off within the file, through the bounce
+ * buffer.  Overlapping ranges are copied in the safe direction.
+ */
+
+static long bfxcopy(FAR struct bfile_s *bf, long off, long src, long sz)
+{
+  long done;
+  long len;
+
+  if (off == src)
+    {
+      return sz;
+    }
+
+  for (done = 0; done < sz; done += len)
+    {
+      len = sz - done;
+      if (len > BFILE_PAGE_SIZE)
+        {
+          len = BFILE_PAGE_SIZE;
+        }
+
+      if (off > src)
+        {
+          /* Copy tail first */
+
+          if (bfxfer(bf, src + sz - done - len, bf->tmp, len, false) < 0 ||
+              bfxfer(bf, off + sz - done - len, bf->tmp, len, true) < 0)
+            {
+              return EOF;
+            }
+        }
+      else
+        {
+          if (bfxfer(bf, src + done, bf->tmp, len, false) < 0 ||
+              bfxfer(bf, off + done, bf->tmp, len, true) < 0)
+            {
+              return EOF;
+            }
+        }
+    }
+
+  return sz;
+}
+
+/* Set the file size, data past the new end reads as zero */
+
+static void bfresize(FAR struct bfile_s *bf, long sz)
+{
+  FAR struct bfpage_s *pg;
+  long pos;
+  int i;
+
+  if (sz < bf->size)
+    {
+      for (i = 0; i < BFILE_NPAGES; i++)
+        {
+          pg = &bf->pages[i];
+          if (pg->off >= 0 && pg->off + BFILE_PAGE_SIZE > sz)
+            {
+              pos = sz > pg->off ? sz - pg->off : 0;
+              memset(pg->data + pos, 0, BFILE_PAGE_SIZE - pos);
+            }
+        }
+
+      if (bf->disksz > sz)
+        {
+          bf->disksz = sz;
+        }
+    }
+
+  bf->size = sz;
+}
+
+/* Write back all dirty pages, lowest offset first */
+
+static int bfsync(FAR struct bfile_s *bf)
+{
+  FAR struct bfpage_s *pg;
+  int ret = OK;
+  int i;
+
+  do
+    {
+      pg = NULL;
+      for (i = 0; i < BFILE_NPAGES; i++)
+        {
+          if (bf->pages[i].off >= 0 && bf->pages[i].dirty &&
+              (pg == NULL || bf->pages[i].off < pg->off))
+            {
+              pg = &bf->pages[i];
+            }
+        }
+
+      if (pg != NULL && bfpage_writeback(bf, pg) < 0)
+        {
+          ret = -EIO;
+        }
+    }
+  while (pg != NULL);
+
+  return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/* Get file size */
+
+long fsize(FILE * fp)
+{
+  long off, sz;
+
+  if (fp == NULL)
+    {
+      return 0;
+    }
+
+  off = ftell(fp);
+  fseek(fp, 0, SEEK_END);
+
+  sz = ftell(fp);
+  fseek(fp, off, SEEK_SET);
+
+  return sz;
+}
+
+/* Write back and cut the file to sz bytes */
+
+long bftruncate(FAR struct bfile_s *bf, long sz)
+{
+  int ret;
+
+  if (bf == NULL)
+    {
+      return -EBADF;
+    }
+
+  ret = bfsync(bf);
+  fflush(bf->fp);
+
+  if (fsize(bf->fp) > sz && ftruncate(fileno(bf->fp), sz) < 0)
+    {
+      int errcode = errno;
+      fprintf(stderr, "ERROR: Truncate file failed: %d\n", errcode);
+      return -errcode;
+    }
+
+  if (bf->disksz > sz)
+    {
+      bf->disksz = sz;
+    }
+
+  return ret;
+}
+
+/* Flush dirty pages to the file */
+
+int bfflush(FAR struct bfile_s *bf)
+{
+  int ret;
+
+  if (bf == NULL)
+    {
+      return -EBADF;
+    }
+
+  /* Check for file changes */
+
+  if (!(bf->flags & BFILE_FL_DIRTY))
+    {
+      return 0;
+    }
+
+  ret = bftruncate(bf, bf->size);
+  if (ret == OK)
+    {
+      bf->flags &= ~BFILE_FL_DIRTY;
+    }
+
+  fflush(bf->fp);
+  return ret;
+}
+
+/* Opens a Paged File */
+
+FAR struct bfile_s *bfopen(char *name, char *mode)
+{
+  FAR struct bfile_s *bf;
+  int i;
+
+  /* NULL file name */
+
+  if (name == NULL)
+    {
+      return NULL;
+    }
+
+  /* Allocate a paged file structure */
+
+  if ((bf = malloc(sizeof(struct bfile_s))) == NULL)
+    {
+      return NULL;
+    }
+
+  memset(bf, 0, sizeof(struct bfile_s));
+
+  /* Set file name */
+
+  if ((bf->name = malloc(strlen(name) + 1)) == NULL)
+    {
+      bffree(bf);
+      return NULL;
+    }
+
+  strcpy(bf->name, name);
+
+  /* Allocate the bounce buffer followed by the pages */
+
+  bf->tmp = malloc((BFILE_NPAGES + 1) * BFILE_PAGE_SIZE);
+  if (bf->tmp == NULL)
+    {
+      bffree(bf);
+      return NULL;
+    }
+
+  for (i = 0; i < BFILE_NPAGES; i++)
+    {
+      bf->pages[i].off  = -1;
+      bf->pages[i].data = bf->tmp + (i + 1) * BFILE_PAGE_SIZE;
+    }
+
+  /* Open file */
+
+  if ((bf->fp = fopen(bf->name, mode)) == NULL)
+    {
+      bffree(bf);
+      return NULL;
+    }
+
+  bf->size   = fsize(bf->fp);
+  bf->disksz = bf->size;
+  return bf;
+}
+
+/* Closes a Paged File */
+
+int bfclose(FAR struct bfile_s *bf)
+{
+  int r;
+
+  if (bf == NULL)
+    {
+      return -EBADF;
+    }
+
+  bfflush(bf);
+
+  /* Close file */
+
+  r = fclose(bf->fp);
+  bffree(bf);
+  return r;
+}
+
+/* Remove bytes from the Paged File
+ *
+ * Moves the data from the end of the file, then shrinks the file size.
+ */
+
+long bfclip(FAR struct bfile_s *bf, long off, long sz)
+{
+  long cnt;
+
+  if (bf == NULL)
+    {
+      return EOF;
+    }
+
+  /* Negative error */
+
+  if (off < 0 || sz <= 0)
+    {
+      return EOF;
+    }
+
+  /* Offset past EOF */
+
+  if (off > bf->size)
+    {
+      return EOF;
+    }
+
+  /* Size past EOF */
+
+  if ((off + sz) > bf->size)
+    {
+      sz = bf->size - off;
+    }
+
+  /* Remove from file */
+
+  cnt = bf->size - (off + sz);
+  if (bfxcopy(bf, off, off + sz, cnt) < 0)
+    {
+      return EOF;
+    }
+
+  bfresize(bf, bf->size - sz);
+  bf->flags |= BFILE_FL_DIRTY;
+  return cnt;
+}
+
+/* Open a hole of sz bytes at off, past EOF the file is extended */
+
+static long bfopenhole(FAR struct bfile_s *bf, long off, long sz)
+{
+  long end = bf->size;
+
+  if (off > end)
+    {
+      bf->size = off;
+      end = off;
+    }
+
+  if (bfxcopy(bf, off + sz, off, end - off) < 0)
+    {
+      return EOF;
+    }
+
+  if (bf->size < end + sz)
+    {
+      bf->size = end + sz;
+    }
+
+  bf->flags |= BFILE_FL_DIRTY;
+  return sz;
+}
+
+/* Insert bytes into the Paged File
+ *
+ * Increases the file size, moves the current data and inserts the
+ * new data.
+ */
+
+long bfinsert(FAR struct bfile_s *bf, long off, void *mem, long sz)
+{
+  if (bf == NULL)
+    {
+      return EOF;
+    }
+
+  /* Negative error */
+
+  if (off < 0 || sz <= 0)
+    {
+      return EOF;
+    }
+
+  if (bfopenhole(bf, off, sz) < 0)
+    {
+      return EOF;
+    }
+
+  return bfxfer(bf, off, mem, sz, true);
+}
+
+/* Copies bytes from src to off */
+
+long bfcopy(FAR struct bfile_s *bf, long off, long src, long sz)
+{
+  if (bf == NULL)
+    {
+      return EOF;
+    }
+
+  /* Error: Source past EOF */
+
+  if (src > bf->size)
+    {
+      return EOF;
+    }
+
+  /* Adjust sz to EOF */
+
+  if ((src > off) && (src + sz > bf->size))
+    {
+      sz = bf->size - src;
+    }
+
+  /* Adjust source/length for insert */
+
+  if (src >= off)
+    {
+      if (src + sz > bf->size)
+        {
+          sz = bf->size - src;
+        }
+
+      src += sz;
+    }
+
+  if (off < 0 || sz <= 0 || bfopenhole(bf, off, sz) < 0)
+    {
+      return EOF;
+    }
+
+  /* The hole still holds the data that was moved out of it, so a source
+   * before off that overlaps the hole reads the original data.
+   */
+
+  return bfxcopy(bf, off, src, sz);
+}
+
+/* Copies bytes from src to off, overwriting the data at off */
+
+long bfcopyover(FAR struct bfile_s *bf, long off, long src, long sz)
+{
+  if (bf == NULL)
+    {
+      return EOF;
+    }
+
+  if (off < 0 || src < 0 || sz <= 0)
+    {
+      return EOF;
+    }
+
+  return bfxcopy(bf, off, src, sz);
+}
+
+/* Get bytes from the Paged File
+ *
+ * Copies up to sz bytes at off to mem, returns the number of bytes copied.
+ */
+
+long bfget(FAR struct bfile_s *bf, long off, FAR void *mem, long sz)
+{
+  if (bf == NULL)
+    {
+      return EOF;
+    }
+
+  if (off < 0 || off >= bf->size)
+    {
+      return 0;
+    }
+
+  if (off + sz > bf->size)
+    {
+      sz = bf->size - off;
+    }
+
+  return bfxfer(bf, off, mem, sz, false);
+}
+
+/* Moves bytes from src to off
+ *
+ * Copies the data from src to off then removes the data from the original
+ * src.  As in the buffered backend, when moving forward off is the final
+ * position of the data.
+ */
+
+long bfmove(FAR struct bfile_s *bf, long off, long src, long sz)
+{
+  if (bf == NULL)
+    {
+      return EOF;
+    }
+
+  /* Error: source past EOF */
+
+  if (src > bf->size)
+    {
+      return EOF;
+    }
+
+  /* Adjust sz to EOF */
+
+  if ((src > off) && (src + sz > bf->size))
+    {
+      sz = bf->size - src;
+    }
+
+  if (src > off)
+    {
+      if (bfcopy(bf, off, src, sz) < 0)
+        {
+          return EOF;
+        }
+
+      bfclip(bf, src + sz, sz);
+    }
+  else
+    {
+      if (bfcopy(bf, off + sz, src, sz) < 0)
+        {
+          return EOF;
+        }
+
+      bfclip(bf, src, sz);
+    }
+
+  return sz;
+}
+
+/* Read Paged File
+ *
+ * Discards all pages so that the file is read again on demand.
+ */
+
+long bfread(FAR struct bfile_s *bf)
+{
+  int i;
+
+  if (bf == NULL)
+    {
+      return EOF;
+    }
+
+  for (i = 0; i < BFILE_NPAGES; i++)
+    {
+      bf->pages[i].off   = -1;
+      bf->pages[i].dirty = false;
+    }
+
+  bf->size   = fsize(bf->fp);
+  bf->disksz = bf->size;
+  bf->flags &= ~BFILE_FL_DIRTY;
+  return bf->size;
+}
+
+/* Write Paged File
+ *
+ * Writes data to the pages, the pages still need to be flushed to the file
+ * before closing or reading.
+ */
+
+long bfwrite(FAR struct bfile_s *bf, long off, void *mem, long sz)
+{
+  if (bf == NULL || off < 0 || sz < 0)
+    {
+      return EOF;
+    }
+
+  return bfxfer(bf, off, mem, sz, true);
+}
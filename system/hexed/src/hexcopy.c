@@ -68,8 +68,7 @@ static int copyover(FAR struct command_s *cmd)
 
   /* Copy overwrite */
 
-  bfwrite(g_hexfile, cmd->opts.dest, g_hexfile->buf + cmd->opts.src,
-          cmd->opts.bytes);
+  bfcopyover(g_hexfile, cmd->opts.dest, cmd->opts.src, cmd->opts.bytes);
   return 0;
 }
 
@@ -51,6 +51,11 @@
 
 static int rundump(FAR struct command_s *cmd)
 {
+  union
+  {
+    uint64_t align;
+    unsigned char b[0x10];
+  } line;
   unsigned char *cur;
   int x, i;
   long off, last;
@@ -78,12 +83,15 @@ static int rundump(FAR struct command_s *cmd)
 
   /* Show file */
 
-  cur  = (unsigned char *)(g_hexfile->buf + cmd->opts.src);
+  cur  = line.b;
   off  = cmd->opts.src;
   last = cmd->opts.src + cmd->opts.bytes;
 
-  for (; off < last; off += 0x10, cur += 0x10)
+  for (; off < last; off += 0x10)
     {
+      /* Get one line of data */
+
+      bfget(g_hexfile, off, cur, 0x10);
       printf("%08lx ", off);
 
       /* Print hex values */
@@ -0,0 +1,274 @@
+/****************************************************************************
+ * apps/system/i2c/i2c_bench.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include <nuttx/i2c/i2c_master.h>
+
+#include "system/benchutil.h"
+
+#include "i2ctool.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Default number of transfers at each frequency */
+
+#define I2CTOOL_BENCH_REPS 100
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: i2ctool_bench_bits
+ *
+ * Description:
+ *   Estimate the number of SCL clocks needed for one register read of
+ *   'nbytes':  START, the write address and register address, a repeated
+ *   START (or STOP plus START with -s), the read address, the data, and the
+ *   final STOP.  Every byte costs nine clocks including its ACK.
+ *
+ ****************************************************************************/
+
+static uint32_t i2ctool_bench_bits(FAR struct i2ctool_s *i2ctool,
+                                   size_t nbytes)
+{
+  return (i2ctool->start ? 31 : 30) + 9 * (uint32_t)nbytes;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: i2ccmd_bench
+ *
+ * Description:
+ *   Repeatedly read <count> registers with a combined transfer at each of
+ *   the frequencies in CONFIG_I2CTOOL_BENCHFREQS and report the achieved
+ *   transfer rate and the fraction of the bus time spent clocking bits.
+ *
+ ****************************************************************************/
+
+int i2ccmd_bench(FAR struct i2ctool_s *i2ctool, int argc, FAR char **argv)
+{
+  FAR const char *freqs = CONFIG_I2CTOOL_BENCHFREQS;
+  FAR uint8_t *buffer;
+  FAR char *ptr;
+  uint32_t savefreq;
+  uint32_t freq;
+  uint64_t start;
+  uint64_t elapsed;
+  uint64_t bits;
+  long count;
+  long repititions;
+  size_t nbytes;
+  int nargs;
+  int argndx;
+  int ret;
+  int fd;
+  int i;
+
+  /* Parse any command line arguments */
+
+  for (argndx = 1; argndx < argc; )
+    {
+      /* Break out of the look when the last option has been parsed */
+
+      ptr = argv[argndx];
+      if (*ptr != '-')
+        {
+          break;
+        }
+
+      /* Otherwise, check for common options */
+
+      nargs = i2ctool_common_args(i2ctool, &argv[argndx]);
+      if (nargs < 0)
+        {
+          return ERROR;
+        }
+      argndx += nargs;
+    }
+
+  /* The options may be followed by the number of registers per transfer
+   * and by the number of transfers at each frequency.
+   */
+
+  count = 1;
+  if (argndx < argc)
+    {
+      count = strtol(argv[argndx], NULL, 16);
+      argndx++;
+    }
+
+  nbytes = (size_t)count * (i2ctool->width / 8);
+  if (count < 1 || nbytes > CONFIG_I2CTOOL_MAXBURST)
+    {
+      i2ctool_printf(i2ctool, g_i2cargrange, argv[0]);
+      return ERROR;
+    }
+
+  repititions = I2CTOOL_BENCH_REPS;
+  if (argndx < argc)
+    {
+      repititions = strtol(argv[argndx], NULL, 16);
+      if (repititions < 1)
+        {
+          i2ctool_printf(i2ctool, g_i2cargrange, argv[0]);
+          return ERROR;
+        }
+
+      argndx++;
+    }
+
+  if (argndx != argc)
+    {
+      i2ctool_printf(i2ctool, g_i2ctoomanyargs, argv[0]);
+      return ERROR;
+    }
+
+  buffer = (FAR uint8_t *)malloc(nbytes);
+  if (buffer == NULL)
+    {
+      i2ctool_printf(i2ctool, g_i2ccmdfailed, argv[0], "malloc", -ENOMEM);
+      return ERROR;
+    }
+
+  /* Get a handle to the I2C bus */
+
+  fd = i2cdev_open(i2ctool->bus);
+  if (fd < 0)
+    {
+       i2ctool_printf(i2ctool, "Failed to get bus %d\n", i2ctool->bus);
+       free(buffer);
+       return ERROR;
+    }
+
+  i2ctool_printf(i2ctool,
+                 "BENCH Bus: %d Addr: %02x Subaddr: %02x Bytes: %lu Transfers: %ld\n",
+                 i2ctool->bus, i2ctool->addr, i2ctool->regaddr,
+                 (unsigned long)nbytes, repititions);
+  i2ctool_printf(i2ctool, "%10s %10s %10s %10s %6s\n",
+                 "Freq", "usec/xfer", "xfer/s", "bytes/s", "Bus%");
+
+  savefreq = i2ctool->freq;
+  bits     = i2ctool_bench_bits(i2ctool, nbytes);
+  ret      = OK;
+
+  while (*freqs != '\0')
+    {
+      freq = (uint32_t)strtoul(freqs, &ptr, 10);
+      if (ptr == freqs)
+        {
+          break;
+        }
+
+      freqs = ptr;
+      while (*freqs == ',' || *freqs == ' ')
+        {
+          freqs++;
+        }
+
+      if (freq == 0)
+        {
+          continue;
+        }
+
+      i2ctool->freq = freq;
+
+      /* Prime the bus at the new frequency before timing */
+
+      ret = i2ctool_getburst(i2ctool, fd, i2ctool->regaddr, buffer, nbytes);
+      if (ret < 0)
+        {
+          i2ctool_printf(i2ctool, g_i2cxfrerror, argv[0], -ret);
+          break;
+        }
+
+      start = benchutil_usec();
+      for (i = 0; i < repititions; i++)
+        {
+          ret = i2ctool_getburst(i2ctool, fd, i2ctool->regaddr, buffer,
+                                 nbytes);
+          if (ret < 0)
+            {
+              break;
+            }
+        }
+
+      elapsed = benchutil_usec() - start;
+      if (ret < 0)
+        {
+          i2ctool_printf(i2ctool, g_i2cxfrerror, argv[0], -ret);
+          break;
+        }
+
+      if (elapsed == 0)
+        {
+          elapsed = 1;
+        }
+
+      /* Bus utilization is the time spent clocking bits at the nominal
+       * frequency over the elapsed time, so what is left is software,
+       * driver and clock stretching overhead.
+       */
+
+      i2ctool_printf(i2ctool, "%10lu %10lu %10lu %10lu %5lu%%\n",
+                     (unsigned long)freq,
+                     (unsigned long)(elapsed / repititions),
+                     (unsigned long)(repititions * 1000000ull / elapsed),
+                     (unsigned long)(repititions * nbytes * 1000000ull /
+                                     elapsed),
+                     (unsigned long)(repititions * bits * 100000000ull /
+                                     ((uint64_t)freq * elapsed)));
+    }
+
+  i2ctool->freq = savefreq;
+  (void)close(fd);
+  free(buffer);
+  return ret;
+}
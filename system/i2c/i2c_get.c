@@ -232,3 +232,47 @@ int i2ctool_get(FAR struct i2ctool_s *i2ctool, int fd, uint8_t regaddr,
 
   return ret;
 }
+
+/****************************************************************************
+ * Name: i2ctool_getburst
+ *
+ * Description:
+ *   Read 'nbytes' of consecutive register data starting at 'regaddr' in one
+ *   combined transfer.  This relies on the device auto-incrementing its
+ *   register address after each register.
+ *
+ ****************************************************************************/
+
+int i2ctool_getburst(FAR struct i2ctool_s *i2ctool, int fd, uint8_t regaddr,
+                     FAR uint8_t *buffer, size_t nbytes)
+{
+  struct i2c_msg_s msg[2];
+  int ret;
+
+  msg[0].frequency = i2ctool->freq;
+  msg[0].addr      = i2ctool->addr;
+  msg[0].flags     = 0;
+  msg[0].buffer    = &regaddr;
+  msg[0].length    = 1;
+
+  msg[1].frequency = i2ctool->freq;
+  msg[1].addr      = i2ctool->addr;
+  msg[1].flags     = I2C_M_READ;
+  msg[1].buffer    = buffer;
+  msg[1].length    = nbytes;
+
+  if (i2ctool->start)
+    {
+      ret = i2cdev_transfer(fd, &msg[0], 1);
+      if (ret == OK)
+        {
+          ret = i2cdev_transfer(fd, &msg[1], 1);
+        }
+    }
+  else
+    {
+      ret = i2cdev_transfer(fd, msg, 2);
+    }
+
+  return ret;
+}
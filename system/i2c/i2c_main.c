@@ -67,14 +67,17 @@ static struct i2ctool_s g_i2ctool;
 
 static const struct cmdmap_s g_i2ccmds[] =
 {
-  { "?",    i2ccmd_help, "Show help     ",  NULL },
-  { "bus",  i2ccmd_bus,  "List busses   ",  NULL },
-  { "dev",  i2ccmd_dev,  "List devices  ", "[OPTIONS] <first> <last>" },
-  { "get",  i2ccmd_get,  "Read register ", "[OPTIONS] [<repititions>]" },
-  { "help", i2ccmd_help, "Show help     ", NULL },
-  { "set",  i2ccmd_set,  "Write register", "[OPTIONS] <value> [<repititions>]" },
-  { "verf", i2ccmd_verf, "Verify access ", "[OPTIONS] [<value>] [<repititions>]" },
-  { NULL,   NULL,        NULL,             NULL }
+  { "?",     i2ccmd_help,  "Show help     ",  NULL },
+  { "bench", i2ccmd_bench, "Benchmark bus ", "[OPTIONS] [<count>] [<repititions>]" },
+  { "bus",   i2ccmd_bus,   "List busses   ",  NULL },
+  { "dev",   i2ccmd_dev,   "List devices  ", "[OPTIONS] <first> <last>" },
+  { "dump",  i2ccmd_dump,  "Read registers", "[OPTIONS] <count>" },
+  { "get",   i2ccmd_get,   "Read register ", "[OPTIONS] [<repititions>]" },
+  { "help",  i2ccmd_help,  "Show help     ", NULL },
+  { "set",   i2ccmd_set,   "Write register", "[OPTIONS] <value> [<repititions>]" },
+  { "verf",  i2ccmd_verf,  "Verify access ", "[OPTIONS] [<value>] [<repititions>]" },
+  { "write", i2ccmd_write, "Write burst   ", "[OPTIONS] <value> [<value> ...]" },
+  { NULL,    NULL,         NULL,             NULL }
 };
 
 /****************************************************************************
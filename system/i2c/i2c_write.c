@@ -0,0 +1,173 @@
+/****************************************************************************
+ * apps/system/i2c/i2c_write.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <nuttx/i2c/i2c_master.h>
+
+#include "i2ctool.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: i2ccmd_write
+ *
+ * Description:
+ *   Write each of the values on the command line to consecutive registers
+ *   starting at the register address in a single transfer.  This requires
+ *   a device that auto-increments its register address.
+ *
+ ****************************************************************************/
+
+int i2ccmd_write(FAR struct i2ctool_s *i2ctool, int argc, FAR char **argv)
+{
+  FAR uint8_t *buffer;
+  FAR char *ptr;
+  uint16_t data16;
+  size_t regsize;
+  size_t nbytes;
+  long value;
+  int nargs;
+  int argndx;
+  int ret;
+  int fd;
+  int i;
+
+  /* Parse any command line arguments */
+
+  for (argndx = 1; argndx < argc; )
+    {
+      /* Break out of the look when the last option has been parsed */
+
+      ptr = argv[argndx];
+      if (*ptr != '-')
+        {
+          break;
+        }
+
+      /* Otherwise, check for common options */
+
+      nargs = i2ctool_common_args(i2ctool, &argv[argndx]);
+      if (nargs < 0)
+        {
+          return ERROR;
+        }
+      argndx += nargs;
+    }
+
+  /* There must be at least one value to be written */
+
+  if (argndx >= argc)
+    {
+      i2ctool_printf(i2ctool, g_i2cargrequired, argv[0]);
+      return ERROR;
+    }
+
+  regsize = i2ctool->width / 8;
+  nbytes  = (size_t)(argc - argndx) * regsize;
+
+  if (nbytes > CONFIG_I2CTOOL_MAXBURST)
+    {
+      i2ctool_printf(i2ctool, g_i2ctoomanyargs, argv[0]);
+      return ERROR;
+    }
+
+  buffer = (FAR uint8_t *)malloc(nbytes);
+  if (buffer == NULL)
+    {
+      i2ctool_printf(i2ctool, g_i2ccmdfailed, argv[0], "malloc", -ENOMEM);
+      return ERROR;
+    }
+
+  /* Collect the values in the same byte order that the set command uses */
+
+  for (i = 0; argndx < argc; i++, argndx++)
+    {
+      value = strtol(argv[argndx], NULL, 16);
+      if (value < 0 || value > (i2ctool->width == 8 ? 255 : 65535))
+        {
+          i2ctool_printf(i2ctool, g_i2cargrange, argv[0]);
+          free(buffer);
+          return ERROR;
+        }
+
+      if (i2ctool->width == 8)
+        {
+          buffer[i] = (uint8_t)value;
+        }
+      else
+        {
+          data16 = (uint16_t)value;
+          memcpy(&buffer[i * regsize], &data16, sizeof(uint16_t));
+        }
+    }
+
+  /* Get a handle to the I2C bus */
+
+  fd = i2cdev_open(i2ctool->bus);
+  if (fd < 0)
+    {
+       i2ctool_printf(i2ctool, "Failed to get bus %d\n", i2ctool->bus);
+       free(buffer);
+       return ERROR;
+    }
+
+  /* Write all of the registers in one transfer */
+
+  ret = i2ctool_setburst(i2ctool, fd, i2ctool->regaddr, buffer, nbytes);
+  if (ret == OK)
+    {
+      i2ctool_printf(i2ctool, "WRITE Bus: %d Addr: %02x Subaddr: %02x Count: %02x\n",
+                     i2ctool->bus, i2ctool->addr, i2ctool->regaddr, i);
+    }
+  else
+    {
+      i2ctool_printf(i2ctool, g_i2cxfrerror, argv[0], -ret);
+    }
+
+  (void)close(fd);
+  free(buffer);
+  return ret;
+}
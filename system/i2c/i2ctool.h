@@ -62,6 +62,8 @@
  * CONFIG_I2CTOOL_MAXADDR - Largest device address (default: 0x77)
  * CONFIG_I2CTOOL_MAXREGADDR - Largest register address (default: 0xff)
  * CONFIG_I2CTOOL_DEFFREQ - Default frequency (default: 4000000)
+ * CONFIG_I2CTOOL_MAXBURST - Largest burst transfer in bytes (default: 256)
+ * CONFIG_I2CTOOL_BENCHFREQS - Frequencies swept by the bench command
  */
 
 #ifndef CONFIG_I2CTOOL_MINBUS
@@ -88,6 +90,14 @@
 #  define CONFIG_I2CTOOL_DEFFREQ 100000
 #endif
 
+#ifndef CONFIG_I2CTOOL_MAXBURST
+#  define CONFIG_I2CTOOL_MAXBURST 256
+#endif
+
+#ifndef CONFIG_I2CTOOL_BENCHFREQS
+#  define CONFIG_I2CTOOL_BENCHFREQS "100000,400000,1000000"
+#endif
+
 /* This is the maximum number of arguments that will be accepted for a
  * command.  This is only used for sizing a hardcoded array and is set
  * to be sufficiently large to support all possible I2C tool arguments and
@@ -184,11 +194,14 @@ void i2ctool_flush(FAR struct i2ctool_s *i2ctool);
 
 /* Command handlers */
 
+int i2ccmd_bench(FAR struct i2ctool_s *i2ctool, int argc, FAR char **argv);
 int i2ccmd_bus(FAR struct i2ctool_s *i2ctool, int argc, FAR char **argv);
 int i2ccmd_dev(FAR struct i2ctool_s *i2ctool, int argc, FAR char **argv);
+int i2ccmd_dump(FAR struct i2ctool_s *i2ctool, int argc, FAR char **argv);
 int i2ccmd_get(FAR struct i2ctool_s *i2ctool, int argc, FAR char **argv);
 int i2ccmd_set(FAR struct i2ctool_s *i2ctool, int argc, FAR char **argv);
 int i2ccmd_verf(FAR struct i2ctool_s *i2ctool, int argc, FAR char **argv);
+int i2ccmd_write(FAR struct i2ctool_s *i2ctool, int argc, FAR char **argv);
 
 /* I2C access functions */
 
@@ -196,6 +209,10 @@ int i2ctool_get(FAR struct i2ctool_s *i2ctool, int fd, uint8_t addr,
                 FAR uint16_t *result);
 int i2ctool_set(FAR struct i2ctool_s *i2ctool, int fd, uint8_t regaddr,
                 uint16_t value);
+int i2ctool_getburst(FAR struct i2ctool_s *i2ctool, int fd, uint8_t regaddr,
+                     FAR uint8_t *buffer, size_t nbytes);
+int i2ctool_setburst(FAR struct i2ctool_s *i2ctool, int fd, uint8_t regaddr,
+                     FAR const uint8_t *buffer, size_t nbytes);
 
 /* Common logic */
 
@@ -41,12 +41,18 @@
 #include <nuttx/progmem.h>
 #include <sys/stat.h>
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <unistd.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 
+#ifdef CONFIG_SYSTEM_INSTALL_MD5
+#  include "netutils/md5.h"
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -56,7 +62,51 @@
 #define ACTION_REINSTALL            0x03
 #define ACTION_INSUFPARAM           0x80
 
-#define INSTALL_PROGRAMBLOCKSIZE    1024
+/* Flash is programmed in blocks of this size, which should be a multiple of
+ * the flash page size.
+ */
+
+#ifndef CONFIG_SYSTEM_INSTALL_BLOCKSIZE
+#  define CONFIG_SYSTEM_INSTALL_BLOCKSIZE 4096
+#endif
+
+#define INSTALL_PROGRAMBLOCKSIZE    CONFIG_SYSTEM_INSTALL_BLOCKSIZE
+
+/* Largest LZ4 block accepted.  The decoder needs one buffer of this size. */
+
+#ifndef CONFIG_SYSTEM_INSTALL_LZ4_MAXBLOCK
+#  define CONFIG_SYSTEM_INSTALL_LZ4_MAXBLOCK 65536
+#endif
+
+/* LZ4 frame format */
+
+#define LZ4_MAGIC                   0x184d2204
+#define LZ4_FLG_VERSION_MASK        0xc0
+#define LZ4_FLG_VERSION             0x40
+#define LZ4_FLG_BINDEP              0x20
+#define LZ4_FLG_BCHECKSUM           0x10
+#define LZ4_FLG_CSIZE               0x08
+#define LZ4_FLG_CCHECKSUM           0x04
+#define LZ4_FLG_DICTID              0x01
+#define LZ4_BLOCK_UNCOMPRESSED      0x80000000
+#define LZ4_MINMATCH                4
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Collects the program image into aligned blocks for up_progmem_write() */
+
+struct install_writer_s
+{
+  FAR char *buf;                /* Partial block */
+  size_t    fill;               /* Bytes in buf */
+  int       addr;               /* Next program memory address */
+  int       size;               /* Bytes written so far */
+#ifdef CONFIG_SYSTEM_INSTALL_MD5
+  MD5_CTX   md5;                /* Over the uncompressed image */
+#endif
+};
 
 /****************************************************************************
  * Private data
@@ -73,7 +123,11 @@ static const char *install_help =
     "\t--remove <dest-file>\tRemoves installed application\n"
     "\t--force\t\t\tReplaces existing installation\n"
     "\t--start <page>\t\tInstalls application at or after <page>\n"
-    "\t--margin <pages>\tLeave some free space after the kernel (default 16)\n";
+    "\t--margin <pages>\tLeave some free space after the kernel (default 16)\n"
+#ifdef CONFIG_SYSTEM_INSTALL_MD5
+    "\t--md5 <hex>\t\tVerify the MD5 sum of the (uncompressed) program\n"
+#endif
+    ;
 
 static const char *install_script_text =
     "# XIP stacksize=%x priority=%x size=%x\n";
@@ -108,7 +162,7 @@ static int install_getstartpage(int startpage, int pagemargin, int desiredsize)
         {
           if (stpage != 0xffff)
             {
-              if ((page - stpage) > maxlen)
+              if ((int)(page - stpage) > maxlen)
                 {
                   if (maxlen==-1)
                     {
@@ -146,45 +200,460 @@ static int install_getstartpage(int startpage, int pagemargin, int desiredsize)
   return -1;
 }
 
-static int install_programflash(int startaddr, const char *source)
+static int install_flush(FAR struct install_writer_s *writer)
+{
+  ssize_t status;
+
+  if (writer->fill > 0)
+    {
+      status = up_progmem_write(writer->addr, writer->buf, writer->fill);
+      if (status < 0)
+        {
+          return status;
+        }
+
+      writer->addr += writer->fill;
+      writer->size += writer->fill;
+      writer->fill  = 0;
+    }
+
+  return 0;
+}
+
+#ifdef CONFIG_SYSTEM_INSTALL_LZ4
+/* Add image data.  Whole blocks are written straight from the caller's
+ * buffer, only the remainder is copied.
+ */
+
+static int install_write(FAR struct install_writer_s *writer,
+                         FAR const char *data, size_t len)
 {
   ssize_t status;
   size_t  count;
-  ssize_t totalsize = 0;
-  char    *buf;
-  FILE    *fp;
 
-  if ((buf = malloc(INSTALL_PROGRAMBLOCKSIZE)) == NULL)
+#ifdef CONFIG_SYSTEM_INSTALL_MD5
+  MD5Update(&writer->md5, (FAR const unsigned char *)data, len);
+#endif
+
+  while (len > 0)
+    {
+      if (writer->fill == 0 && len >= INSTALL_PROGRAMBLOCKSIZE)
+        {
+          count  = len - len % INSTALL_PROGRAMBLOCKSIZE;
+          status = up_progmem_write(writer->addr, data, count);
+          if (status < 0)
+            {
+              return status;
+            }
+
+          writer->addr += count;
+          writer->size += count;
+        }
+      else
+        {
+          count = INSTALL_PROGRAMBLOCKSIZE - writer->fill;
+          if (count > len)
+            {
+              count = len;
+            }
+
+          memcpy(writer->buf + writer->fill, data, count);
+          writer->fill += count;
+
+          if (writer->fill == INSTALL_PROGRAMBLOCKSIZE)
+            {
+              status = install_flush(writer);
+              if (status < 0)
+                {
+                  return status;
+                }
+            }
+        }
+
+      data += count;
+      len  -= count;
+    }
+
+  return 0;
+}
+
+static uint32_t install_getle32(FAR const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+         ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* Read and check an LZ4 frame header.  Returns the block maximum size and
+ * the frame flags, and the content size if the frame has one (else 0).
+ */
+
+static int install_lz4_header(FILE *fp, FAR uint8_t *flg,
+                              FAR size_t *blockmax, FAR size_t *content)
+{
+  static const size_t blocksizes[4] =
+  {
+    64 * 1024, 256 * 1024, 1024 * 1024, 4 * 1024 * 1024
+  };
+
+  uint8_t hdr[14];
+  int     bd;
+
+  if (fread(hdr, 1, 6, fp) != 6 ||
+      install_getle32(hdr) != LZ4_MAGIC ||
+      (hdr[4] & LZ4_FLG_VERSION_MASK) != LZ4_FLG_VERSION)
+    {
+      return -EINVAL;
+    }
+
+  *flg = hdr[4];
+  bd   = (hdr[5] >> 4) & 7;
+  if (bd < 4)
+    {
+      return -EINVAL;
+    }
+
+  /* Linked blocks would need the whole previous output as dictionary */
+
+  *blockmax = blocksizes[bd - 4];
+  if ((*flg & LZ4_FLG_BINDEP) == 0 ||
+      *blockmax > CONFIG_SYSTEM_INSTALL_LZ4_MAXBLOCK)
+    {
+      return -ENOTSUP;
+    }
+
+  *content = 0;
+  if (*flg & LZ4_FLG_CSIZE)
+    {
+      if (fread(hdr, 1, 8, fp) != 8)
+        {
+          return -EINVAL;
+        }
+
+      *content = install_getle32(hdr);
+    }
+
+  if (*flg & LZ4_FLG_DICTID)
+    {
+      return -ENOTSUP;
+    }
+
+  /* Header checksum, the MD5 sum covers the whole image instead */
+
+  return fgetc(fp) == EOF ? -EINVAL : 0;
+}
+
+static int install_lz4_getlen(FILE *fp, FAR size_t *remaining)
+{
+  size_t len = 0;
+  int    c;
+
+  do
+    {
+      if (*remaining == 0 || (c = fgetc(fp)) == EOF)
+        {
+          return -EINVAL;
+        }
+
+      (*remaining)--;
+      len += c;
+    }
+  while (c == 255);
+
+  return len;
+}
+
+/* Decode one compressed block of 'csize' bytes into 'out'.  Literals are
+ * read straight into the output buffer.
+ */
+
+static ssize_t install_lz4_block(FILE *fp, size_t csize, FAR char *out,
+                                 size_t outmax)
+{
+  FAR char *dst = out;
+  FAR char *end = out + outmax;
+  FAR const char *match;
+  size_t    litlen;
+  size_t    matchlen;
+  size_t    offset;
+  int       token;
+  int       ret;
+
+  while (csize > 0)
+    {
+      token = fgetc(fp);
+      if (token == EOF)
+        {
+          return -EINVAL;
+        }
+
+      csize--;
+
+      litlen = token >> 4;
+      if (litlen == 15)
+        {
+          if ((ret = install_lz4_getlen(fp, &csize)) < 0)
+            {
+              return ret;
+            }
+
+          litlen += ret;
+        }
+
+      if (litlen > csize || litlen > (size_t)(end - dst) ||
+          fread(dst, 1, litlen, fp) != litlen)
+        {
+          return -EINVAL;
+        }
+
+      dst   += litlen;
+      csize -= litlen;
+
+      /* The last sequence has literals only */
+
+      if (csize == 0)
+        {
+          break;
+        }
+
+      if (csize < 2)
+        {
+          return -EINVAL;
+        }
+
+      offset  = fgetc(fp);
+      offset |= fgetc(fp) << 8;
+      csize  -= 2;
+
+      matchlen = token & 15;
+      if (matchlen == 15)
+        {
+          if ((ret = install_lz4_getlen(fp, &csize)) < 0)
+            {
+              return ret;
+            }
+
+          matchlen += ret;
+        }
+
+      matchlen += LZ4_MINMATCH;
+      if (offset == 0 || offset > (size_t)(dst - out) ||
+          matchlen > (size_t)(end - dst))
+        {
+          return -EINVAL;
+        }
+
+      /* Byte by byte, the match may overlap the bytes being produced */
+
+      match = dst - offset;
+      while (matchlen-- > 0)
+        {
+          *dst++ = *match++;
+        }
+    }
+
+  return dst - out;
+}
+
+static int install_lz4_program(FAR struct install_writer_s *writer,
+                               FILE *fp)
+{
+  FAR char *out;
+  uint8_t   hdr[4];
+  uint8_t   flg;
+  uint32_t  bsize;
+  size_t    blockmax;
+  size_t    content;
+  ssize_t   len;
+  int       ret;
+
+  ret = install_lz4_header(fp, &flg, &blockmax, &content);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  if ((out = malloc(blockmax)) == NULL)
     {
       return -ENOMEM;
     }
 
-  if ((fp = fopen(source, "r")))
+  for (; ; )
     {
-      do
+      if (fread(hdr, 1, 4, fp) != 4)
         {
-          count = fread(buf, 1, INSTALL_PROGRAMBLOCKSIZE, fp);
+          ret = -EINVAL;
+          break;
+        }
 
-          if ((status = up_progmem_write(startaddr, buf, count)) < 0)
+      bsize = install_getle32(hdr);
+      if (bsize == 0)
+        {
+          break;  /* End mark */
+        }
+
+      if (bsize & LZ4_BLOCK_UNCOMPRESSED)
+        {
+          bsize &= ~LZ4_BLOCK_UNCOMPRESSED;
+          len = bsize <= blockmax ? fread(out, 1, bsize, fp) : -EINVAL;
+          if (len >= 0 && len != bsize)
             {
-              totalsize = status;
-              break;
+              len = -EINVAL;
             }
+        }
+      else
+        {
+          len = bsize <= blockmax ?
+                install_lz4_block(fp, bsize, out, blockmax) : -EINVAL;
+        }
+
+      if (len < 0 ||
+          ((flg & LZ4_FLG_BCHECKSUM) && fread(hdr, 1, 4, fp) != 4))
+        {
+          ret = len < 0 ? len : -EINVAL;
+          break;
+        }
+
+      if ((ret = install_write(writer, out, len)) < 0)
+        {
+          break;
+        }
+    }
+
+  free(out);
+  return ret;
+}
+
+/* The size the image takes in program memory: the content size from the
+ * frame header, or else an upper bound from the number of blocks.
+ */
+
+static int install_lz4_size(FILE *fp)
+{
+  uint8_t  hdr[4];
+  uint8_t  flg;
+  uint32_t bsize;
+  size_t   blockmax;
+  size_t   content;
+  int      size = 0;
+  int      ret;
+
+  ret = install_lz4_header(fp, &flg, &blockmax, &content);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  if (content > 0)
+    {
+      return content;
+    }
+
+  while (fread(hdr, 1, 4, fp) == 4 && (bsize = install_getle32(hdr)) != 0)
+    {
+      bsize &= ~LZ4_BLOCK_UNCOMPRESSED;
+      if (flg & LZ4_FLG_BCHECKSUM)
+        {
+          bsize += 4;
+        }
 
-          startaddr += count;
-          totalsize += count;
+      if (fseek(fp, bsize, SEEK_CUR) < 0)
+        {
+          return -errno;
         }
-      while (count);
+
+      size += blockmax;
+    }
+
+  return size;
+}
+
+static bool install_iscompressed(FILE *fp)
+{
+  uint8_t magic[4];
+  bool    lz4;
+
+  lz4 = fread(magic, 1, 4, fp) == 4 && install_getle32(magic) == LZ4_MAGIC;
+  rewind(fp);
+  return lz4;
+}
+#endif /* CONFIG_SYSTEM_INSTALL_LZ4 */
+
+/* Program the image at startaddr.  Returns the program size or a negated
+ * errno value.  '*written' is set to the bytes programmed either way, so
+ * that a failed installation can be erased again.
+ */
+
+static int install_programflash(int startaddr, const char *source,
+                                const uint8_t *md5, int *written)
+{
+  struct install_writer_s writer;
+  size_t  count;
+  int     status = 0;
+  FILE    *fp;
+#ifdef CONFIG_SYSTEM_INSTALL_MD5
+  uint8_t digest[16];
+#endif
+
+  *written = 0;
+
+  memset(&writer, 0, sizeof(writer));
+  writer.addr = startaddr;
+#ifdef CONFIG_SYSTEM_INSTALL_MD5
+  MD5Init(&writer.md5);
+#endif
+
+  if ((writer.buf = malloc(INSTALL_PROGRAMBLOCKSIZE)) == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  if ((fp = fopen(source, "r")) == NULL)
+    {
+      free(writer.buf);
+      return -errno;
+    }
+
+#ifdef CONFIG_SYSTEM_INSTALL_LZ4
+  if (install_iscompressed(fp))
+    {
+      status = install_lz4_program(&writer, fp);
     }
   else
+#endif
+    {
+      /* Read whole blocks so each one is programmed in one go */
+
+      while ((count = fread(writer.buf, 1, INSTALL_PROGRAMBLOCKSIZE, fp)) > 0)
+        {
+#ifdef CONFIG_SYSTEM_INSTALL_MD5
+          MD5Update(&writer.md5, (FAR unsigned char *)writer.buf, count);
+#endif
+          writer.fill = count;
+          if ((status = install_flush(&writer)) < 0)
+            {
+              break;
+            }
+        }
+    }
+
+  if (status >= 0)
     {
-      totalsize = -errno;
+      status = install_flush(&writer);
     }
 
   fclose(fp);
-  free(buf);
+  free(writer.buf);
+  *written = writer.size;
+
+#ifdef CONFIG_SYSTEM_INSTALL_MD5
+  MD5Final(digest, &writer.md5);
+  if (status >= 0 && md5 != NULL && memcmp(digest, md5, 16) != 0)
+    {
+      status = -EBADMSG;
+    }
+#endif
 
-  return totalsize;
+  return status < 0 ? status : writer.size;
 }
 
 static void install_getscriptname(char *scriptname, const char *progname, const char *destdir)
@@ -204,6 +673,22 @@ static void install_getscriptname(char *scriptname, const char *progname, const
 static int install_getprogsize(const char *progname)
 {
   struct stat fileinfo;
+#ifdef CONFIG_SYSTEM_INSTALL_LZ4
+  FILE *fp;
+  int   size;
+
+  /* A compressed image needs room for its uncompressed size */
+
+  if ((fp = fopen(progname, "r")) != NULL)
+    {
+      size = install_iscompressed(fp) ? install_lz4_size(fp) : -1;
+      fclose(fp);
+      if (size >= 0)
+        {
+          return size;
+        }
+    }
+#endif
 
   if (stat(progname, &fileinfo) < 0)
     {
@@ -226,12 +711,19 @@ static int install_alreadyexists(const char *scriptname)
     return 1;
 }
 
+/* The script is written under a temporary name and renamed into place, so
+ * that it always names either the old or the new program.
+ */
+
 static int install_createscript(int addr, int stacksize, int progsize,
                                 int priority, const char *scriptname)
 {
+  char tmpname[136];
   FILE *fp;
+  int  ret;
 
-  if ((fp = fopen(scriptname, "w+")) == NULL)
+  snprintf(tmpname, sizeof(tmpname), "%s.tmp", scriptname);
+  if ((fp = fopen(tmpname, "w+")) == NULL)
     {
       return -errno;
     }
@@ -239,10 +731,26 @@ static int install_createscript(int addr, int stacksize, int progsize,
   fprintf(fp, install_script_text, stacksize, priority, progsize);
   fprintf(fp, install_script_exec, addr);
 
-  fflush(fp);
+  ret = fflush(fp) == 0 ? 0 : -errno;
   fclose(fp);
 
-  return 0;
+  if (ret == 0 && rename(tmpname, scriptname) < 0)
+    {
+      /* Some file systems do not rename over an existing file */
+
+      if (errno != EEXIST || unlink(scriptname) < 0 ||
+          rename(tmpname, scriptname) < 0)
+        {
+          ret = -errno;
+        }
+    }
+
+  if (ret < 0)
+    {
+      unlink(tmpname);
+    }
+
+  return ret;
 }
 
 static int install_getlasthexvalue(FILE *fp, char delimiter)
@@ -261,56 +769,61 @@ static int install_getlasthexvalue(FILE *fp, char delimiter)
   return -1;
 }
 
-static int install_remove(const char *scriptname)
+static int install_parsescript(const char *scriptname, int *addr,
+                               int *progsize)
 {
-  FILE    *fp;
-  int      progsize, addr, freedsize;
-  ssize_t  page;
-  int      status = 0;
-
-  /* Parse script */
+  FILE *fp;
 
-  if ((fp = fopen(scriptname, "r")))
-    {
-      progsize  = install_getlasthexvalue(fp,'=');
-      addr      = install_getlasthexvalue(fp,' ');
-      freedsize = progsize;
-    }
-  else
+  if ((fp = fopen(scriptname, "r")) == NULL)
     {
       return -errno;
     }
 
+  *progsize = install_getlasthexvalue(fp,'=');
+  *addr     = install_getlasthexvalue(fp,' ');
   fclose(fp);
 
-  /* Remove pages */
+  return (*progsize <= 0 || *addr <= 0) ? -EIO : 0;
+}
 
-  if (progsize <= 0 || addr <= 0)
-    {
-      return -EIO;
-    }
+static int install_erase(int addr, int size)
+{
+  ssize_t page;
 
-  do
+  while (size > 0)
     {
       if ((page = up_progmem_getpage(addr)) < 0)
         {
-          status = -page;
-          break;
+          return page;
         }
 
       if (up_progmem_erasepage(page) < 0)
         {
-          status = -page;
-          break;
+          return -EIO;
         }
 
       addr += up_progmem_pagesize(page);
-      progsize -= up_progmem_pagesize(page);
+      size -= up_progmem_pagesize(page);
+    }
+
+  return 0;
+}
+
+static int install_remove(const char *scriptname)
+{
+  int progsize, addr;
+  int status;
 
+  /* Parse script */
+
+  if ((status = install_parsescript(scriptname, &addr, &progsize)) < 0)
+    {
+      return status;
     }
-  while (progsize > 0);
 
-  if (status < 0)
+  /* Remove pages */
+
+  if ((status = install_erase(addr, progsize)) < 0)
     {
       return status;
     }
@@ -322,7 +835,7 @@ static int install_remove(const char *scriptname)
       return -errno;
     }
 
-  return freedsize;
+  return progsize;
 }
 
 
@@ -338,7 +851,10 @@ int install_main(int argc, char *argv[])
 {
   int i;
   int progsize;
+  int written;
   int scrsta;
+  int oldaddr         = 0;
+  int oldsize         = 0;
   int stacksize       = 4096;
   int priority        = SCHED_PRIORITY_DEFAULT;
   int pagemargin      = 16;
@@ -346,6 +862,11 @@ int install_main(int argc, char *argv[])
   int startaddr       = 0;
   int action          = ACTION_INSTALL;
   char scriptname[128];
+  const uint8_t *md5  = NULL;
+#ifdef CONFIG_SYSTEM_INSTALL_MD5
+  uint8_t digest[16];
+  int j;
+#endif
 
   /* Supported? */
 
@@ -385,6 +906,20 @@ int install_main(int argc, char *argv[])
             {
               action = ACTION_REINSTALL;
             }
+#ifdef CONFIG_SYSTEM_INSTALL_MD5
+          else if (strcmp(argv[i]+2, "md5")==0 && i + 1 < argc &&
+                   strlen(argv[i + 1]) == 32)
+            {
+              i++;
+              for (j = 0; j < 16; j++)
+                {
+                  char hex[3] = { argv[i][2*j], argv[i][2*j + 1], '\0' };
+                  digest[j] = strtoul(hex, NULL, 16);
+                }
+
+              md5 = digest;
+            }
+#endif
           else fprintf(stderr, "Unknown option: %s\n", argv[i]);
         }
       else
@@ -432,9 +967,15 @@ int install_main(int argc, char *argv[])
                 return -EEXIST;
               }
 
-            if ((scrsta = install_remove(scriptname)) < 0)
+            /* The old program stays in place until the new one is
+             * written, verified and its script has replaced the old one.
+             */
+
+            if ((scrsta = install_parsescript(scriptname, &oldaddr,
+                                              &oldsize)) < 0)
               {
-                fprintf(stderr, "Could not remove program: %s\n", strerror(-scrsta));
+                fprintf(stderr, "Could not parse %s: %s\n", scriptname,
+                        strerror(-scrsta));
                 return -1;
               }
 
@@ -442,17 +983,19 @@ int install_main(int argc, char *argv[])
           }
 
         startaddr = install_getstartpage(startpage, pagemargin, install_getprogsize(argv[i]));
-        if (startpage < 0)
+        if (startaddr < 0)
           {
             fprintf(stderr, "Not enough memory\n");
             return -ENOMEM;
           }
 
-        if ((progsize = install_programflash(startaddr, argv[i])) <= 0)
+        if ((progsize = install_programflash(startaddr, argv[i], md5,
+                                             &written)) <= 0)
           {
-            fprintf(stderr, "Error writing program memory: %s\n"
-                    "Note: Flash pages are not released, so you may try again and program will be\n"
-                    "      written in other pages.\n", strerror(-progsize));
+            fprintf(stderr, "Error writing program memory: %s\n",
+                    progsize == -EBADMSG ? "MD5 mismatch" :
+                    strerror(-progsize));
+            install_erase(startaddr, written);
             return -EIO;
           }
 
@@ -461,9 +1004,15 @@ int install_main(int argc, char *argv[])
           {
             fprintf(stderr, "Error writing program script at %s: %s\n",
                     argv[i+1], strerror(-scrsta));
+            install_erase(startaddr, written);
             return -EIO;
           }
 
+        if (oldsize > 0 && install_erase(oldaddr, oldsize) < 0)
+          {
+            fprintf(stderr, "Could not free the pages of the old program\n");
+          }
+
         printf("Installed application of size %d bytes to program memory [%xh - %xh].\n",
                 progsize, startaddr, startaddr + progsize);
         return 0;
@@ -49,6 +49,10 @@
 #include <arpa/inet.h>
 #include <netinet/in.h>
 
+#ifdef CONFIG_NETUTILS_DNSCACHE
+#  include "netutils/dnscache.h"
+#endif
+
 #ifdef CONFIG_SYSTEM_NETDB
 
 /****************************************************************************
@@ -85,11 +89,79 @@ static void show_usage(FAR const char *progname, int exitcode)
 #ifdef HAVE_GETHOSTBYADDR
   fprintf(stderr, "       %s --ipv6 <ipv6-addr>\n", progname);
   fprintf(stderr, "       %s --host <host-name>\n", progname);
+#endif
+#ifdef CONFIG_NETUTILS_DNSCACHE
+  fprintf(stderr, "       %s --lookup <host-name>\n", progname);
+  fprintf(stderr, "       %s --cache\n", progname);
+  fprintf(stderr, "       %s --flush\n", progname);
 #endif
   fprintf(stderr, "       %s --help\n", progname);
   exit(exitcode);
 }
 
+#ifdef CONFIG_NETUTILS_DNSCACHE
+static void show_addr(FAR const struct dnscache_addr_s *addr)
+{
+  char buffer[48];
+
+  if (addr->have_ipv4)
+    {
+      inet_ntop(AF_INET, &addr->ipv4, buffer, sizeof(buffer));
+      printf("  IPv4 Addr: %s", buffer);
+    }
+
+  if (addr->have_ipv6)
+    {
+      inet_ntop(AF_INET6, &addr->ipv6, buffer, sizeof(buffer));
+      printf("  IPv6 Addr: %s", buffer);
+    }
+
+  putchar('\n');
+}
+
+static int show_entry(FAR void *arg, FAR const struct dnscache_info_s *info)
+{
+  if (info->ttl < 0)
+    {
+      printf("%-24s %6s %6lu", info->name, "hosts",
+             (unsigned long)info->hits);
+    }
+  else
+    {
+      printf("%-24s %6ld %6lu", info->name, (long)info->ttl,
+             (unsigned long)info->hits);
+    }
+
+  if (info->negative)
+    {
+      printf("  (not found)\n");
+    }
+  else
+    {
+      show_addr(info->addr);
+    }
+
+  return 0;
+}
+
+static int show_cache(void)
+{
+  struct dnscache_stats_s stats;
+
+  printf("%-24s %6s %6s\n", "Name", "TTL", "Hits");
+  (void)dnscache_foreach(show_entry, NULL);
+
+  dnscache_getstats(&stats);
+  printf("\nHits: %lu  Negative hits: %lu  Misses: %lu\n",
+         (unsigned long)stats.hits, (unsigned long)stats.neghits,
+         (unsigned long)stats.misses);
+  printf("Queries: %lu  Fallbacks: %lu  Evictions: %lu\n",
+         (unsigned long)stats.queries, (unsigned long)stats.fallbacks,
+         (unsigned long)stats.evictions);
+  return EXIT_SUCCESS;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -108,6 +180,20 @@ int netdb_main(int argc, char **argv)
       show_usage(argv[0], EXIT_SUCCESS);
     }
 
+#ifdef CONFIG_NETUTILS_DNSCACHE
+  /* Handle: netdb --cache and netdb --flush */
+
+  else if (argc == 2 && strcmp(argv[1], "--cache") == 0)
+    {
+      return show_cache();
+    }
+  else if (argc == 2 && strcmp(argv[1], "--flush") == 0)
+    {
+      dnscache_flush();
+      return EXIT_SUCCESS;
+    }
+#endif
+
   /* Otherwise there must be exactly two arguments following the program name */
 
   else if (argc < 3)
@@ -175,6 +261,25 @@ int netdb_main(int argc, char **argv)
     }
 #endif /* HAVE_GETHOSTBYADDR */
 
+#ifdef CONFIG_NETUTILS_DNSCACHE
+  /* Handle: netdb --lookup <host-name>  */
+
+  else if (strcmp(argv[1], "--lookup") == 0)
+    {
+      struct dnscache_addr_s addr;
+
+      if (dnscache_lookup(argv[2], &addr) < 0)
+        {
+          fprintf(stderr, "ERROR -- dnscache_lookup failed\n\n");
+          return EXIT_FAILURE;
+        }
+
+      printf("Host: %s", argv[2]);
+      show_addr(&addr);
+      return EXIT_SUCCESS;
+    }
+#endif
+
   /* Handle: netdb --host <host-name>  */
 
   else if (strcmp(argv[1], "--host") == 0)
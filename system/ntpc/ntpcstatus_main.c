@@ -0,0 +1,94 @@
+/****************************************************************************
+ * system/ntpc/ntpcstatus_main.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include <arpa/inet.h>
+
+#include "netutils/ntpclient.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * ntpcstatus_main
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int ntpcstatus_main(int argc, char *argv[])
+#endif
+{
+  struct ntpc_status_s status;
+  struct in_addr addr;
+  int ret;
+  int i;
+
+  ret = ntpc_status(&status);
+  if (ret < 0)
+    {
+      fprintf(stderr, "ERROR: ntpc_status() failed: %d\n", ret);
+      return EXIT_FAILURE;
+    }
+
+  printf("%s, offset %ld us, slewing %ld us, %lu updates, %lu steps\n",
+         status.synced ? "Synchronized" : "Not synchronized",
+         (long)status.offset, (long)status.pending,
+         (unsigned long)status.nupdates, (unsigned long)status.nsteps);
+
+  printf("  %-15s %5s %4s %10s %10s %10s\n",
+         "Server", "Reach", "Sel", "Offset", "Delay", "Jitter");
+
+  for (i = 0; i < status.nservers; i++)
+    {
+      addr.s_addr = status.server[i].addr;
+      printf("  %-15s %5o %4s %10ld %10ld %10ld\n",
+             inet_ntoa(addr), status.server[i].reach,
+             status.server[i].selected ? "*" : "",
+             (long)status.server[i].offset, (long)status.server[i].delay,
+             (long)status.server[i].jitter);
+    }
+
+  return EXIT_SUCCESS;
+}
@@ -48,6 +48,7 @@
 
 #include <sys/types.h>
 #include <sys/ioctl.h>
+#include <sys/stat.h>
 
 #ifdef CONFIG_NXPLAYER_HTTP_STREAMING_SUPPORT
 #  include <sys/time.h>
@@ -65,11 +66,13 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <dirent.h>
+#include <pthread.h>
 #include <debug.h>
 
 
 #include <nuttx/audio/audio.h>
 #include "system/nxplayer.h"
+#include "system/perfcount.h"
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -95,6 +98,41 @@
 #  define CONFIG_NXPLAYER_PLAYTHREAD_STACKSIZE    1500
 #endif
 
+#ifdef CONFIG_NXPLAYER_PREFETCH
+#  ifndef CONFIG_NXPLAYER_PREFETCH_NBLOCKS
+#    define CONFIG_NXPLAYER_PREFETCH_NBLOCKS   8
+#  endif
+
+#  ifndef CONFIG_NXPLAYER_PREFETCH_LOWATER
+#    define CONFIG_NXPLAYER_PREFETCH_LOWATER   2
+#  endif
+
+#  ifndef CONFIG_NXPLAYER_READTHREAD_STACKSIZE
+#    define CONFIG_NXPLAYER_READTHREAD_STACKSIZE  1024
+#  endif
+
+#  if CONFIG_NXPLAYER_PREFETCH_LOWATER >= CONFIG_NXPLAYER_PREFETCH_NBLOCKS
+#    error CONFIG_NXPLAYER_PREFETCH_LOWATER must be less than CONFIG_NXPLAYER_PREFETCH_NBLOCKS
+#  endif
+#endif
+
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+/* Longest path of a file in the media index, including the media directory */
+
+#  define NXPLAYER_INDEX_PATHMAX  128
+#endif
+
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+/* Size of a WAV header with only the "fmt " and "data" chunks */
+
+#  define NXPLAYER_WAVHDR_SIZE  44
+
+#  define NXPLAYER_GETLE16(p) \
+     ((uint16_t)(p)[0] | ((uint16_t)(p)[1] << 8))
+#  define NXPLAYER_GETLE32(p) \
+     ((uint32_t)NXPLAYER_GETLE16(p) | ((uint32_t)NXPLAYER_GETLE16(&(p)[2]) << 16))
+#endif
+
 /****************************************************************************
  * Private Type Declarations
  ****************************************************************************/
@@ -108,6 +146,74 @@ struct nxplayer_ext_fmt_s
 };
 #endif
 
+#ifdef CONFIG_NXPLAYER_PREFETCH
+/* One block of the read-ahead ring */
+
+struct nxplayer_block_s
+{
+  apb_samp_t  nbytes;         /* Number of bytes of media data in the block */
+  bool        final;          /* This is the last block of the file */
+};
+
+/* State shared by the play thread and the reader thread.  The reader
+ * fills the block at 'head' without holding the lock; every other field
+ * is protected by 'lock'.
+ */
+
+struct nxplayer_prefetch_s
+{
+  pthread_t        readId;    /* Thread ID of the reader thread */
+  pthread_mutex_t  lock;      /* Protects the ring */
+  pthread_cond_t   cond;      /* Signals a change in the ring */
+  FAR uint8_t     *data;      /* Block data, NBLOCKS * blksize bytes */
+  struct nxplayer_block_s blocks[CONFIG_NXPLAYER_PREFETCH_NBLOCKS];
+  FAR struct ap_buffer_s **parked; /* Buffers waiting for the reader */
+  size_t           blksize;   /* Size of each block */
+  uint8_t          head;      /* Next block to be read */
+  uint8_t          tail;      /* Next block to be played */
+  uint8_t          count;     /* Number of blocks read but not played */
+  uint8_t          nparked;   /* Number of entries in parked[] */
+  bool             refill;    /* The reader may read more blocks */
+  bool             eof;       /* The final block has been read */
+  bool             stop;      /* The reader thread should exit */
+};
+#endif
+
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+/* A file in the media index.  The format is determined the first time the
+ * file is played and remembered from then on.
+ */
+
+struct nxplayer_mediafile_s
+{
+  FAR char        *path;      /* Full path of the file */
+  FAR const char  *name;      /* File name, within path */
+  int              filefmt;   /* Audio format, once detected */
+  int              subfmt;    /* Audio sub-format, once detected */
+  bool             detected;  /* filefmt and subfmt are valid */
+};
+
+/* A directory in the media index */
+
+struct nxplayer_mediadir_s
+{
+  FAR char        *path;      /* Full path of the directory */
+  time_t           mtime;     /* Modification time when indexed */
+};
+
+/* The media index.  files[] is sorted by name. */
+
+struct nxplayer_mediaindex_s
+{
+  FAR struct nxplayer_mediafile_s *files;
+  FAR struct nxplayer_mediadir_s  *dirs;
+  int              nfiles;    /* Number of entries in files[] */
+  int              falloc;    /* Allocated size of files[] */
+  int              ndirs;     /* Number of entries in dirs[] */
+  int              dalloc;    /* Allocated size of dirs[] */
+};
+#endif
+
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
@@ -120,6 +226,13 @@ int nxplayer_getmidisubformat(int fd);
  * Private Data
  ****************************************************************************/
 
+/* Totals over all players in the performance counter registry */
+
+PERF_COUNTER(g_perf_buffers, "nxplayer.buffers");
+PERF_COUNTER(g_perf_bytes, "nxplayer.bytes");
+PERF_COUNTER(g_perf_underruns, "nxplayer.underruns");
+PERF_COUNTER(g_perf_errors, "nxplayer.errors");
+
 #ifdef CONFIG_NXPLAYER_FMT_FROM_EXT
 static const struct nxplayer_ext_fmt_s g_known_ext[] = {
 #ifdef CONFIG_AUDIO_FORMAT_AC3
@@ -537,8 +650,7 @@ int nxplayer_getmidisubformat(int fd)
  ****************************************************************************/
 
 #ifdef CONFIG_NXPLAYER_FMT_FROM_EXT
-static inline int nxplayer_fmtfromextension(FAR struct nxplayer_s *pPlayer,
-                                            FAR const char *pFilename,
+static inline int nxplayer_fmtfromextension(int fd, FAR const char *pFilename,
                                             FAR int *subfmt)
 {
   const char  *pExt;
@@ -567,7 +679,7 @@ static inline int nxplayer_fmtfromextension(FAR struct nxplayer_s *pPlayer,
 
                   if (subfmt && g_known_ext[c].getsubformat)
                     {
-                      *subfmt = g_known_ext[c].getsubformat(pPlayer->fd);
+                      *subfmt = g_known_ext[c].getsubformat(fd);
                     }
 
                   /* Return the format for this extension */
@@ -625,247 +737,1285 @@ static int nxplayer_mediasearch(FAR struct nxplayer_s *pPlayer,
 #endif
 
 /****************************************************************************
- * Name: nxplayer_readbuffer
+ * Name: nxplayer_indexgrow
  *
- *  Read the next block of data from the media file into the specified
- *  buffer.
+ *   nxplayer_indexgrow() returns a new, zeroed element at the end of one
+ *   of the growable arrays of the media index.
  *
  ****************************************************************************/
 
-static int nxplayer_readbuffer(FAR struct nxplayer_s *pPlayer,
-                               FAR struct ap_buffer_s *apb)
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+static FAR void *nxplayer_indexgrow(FAR void **array, FAR int *count,
+                                    FAR int *nalloc, size_t size)
 {
-  /* Validate the file is still open.  It will be closed automatically when
-   * we encounter the end of file (or, perhaps, a read error that we cannot
-   * handle.
-   */
+  FAR uint8_t *elem;
+  FAR void    *newarray;
+  int          newalloc;
 
-  if (pPlayer->fd == -1)
+  if (*count >= *nalloc)
     {
-      /* Return -ENODATA to indicate that there is nothing more to read from
-       * the file.
-       */
+      newalloc = *nalloc > 0 ? 2 * *nalloc : 16;
+      newarray = realloc(*array, newalloc * size);
+      if (newarray == NULL)
+        {
+          return NULL;
+        }
 
-      return -ENODATA;
+      *array  = newarray;
+      *nalloc = newalloc;
     }
 
-  /* Read data into the buffer. */
-
-  apb->nbytes  = read(pPlayer->fd, &apb->samp, apb->nmaxbytes);
-  apb->curbyte = 0;
-  apb->flags   = 0;
+  elem = (FAR uint8_t *)*array + (*count)++ * size;
+  memset(elem, 0, size);
+  return elem;
+}
+#endif
 
-#ifdef CONFIG_NXPLAYER_HTTP_STREAMING_SUPPORT
-  /* read data up to nmaxbytes from network */
+/****************************************************************************
+ * Name: nxplayer_indexdir
+ *
+ *   nxplayer_indexdir() adds the files in the directory 'path' to the media
+ *   index, and those in its subdirectories if recursive media search is
+ *   enabled.  'path' is a buffer of NXPLAYER_INDEX_PATHMAX bytes shared by
+ *   all levels of the recursion; it is restored before returning.
+ *
+ ****************************************************************************/
 
-  while (0 < apb->nbytes && apb->nbytes < apb->nmaxbytes)
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+static int nxplayer_indexdir(FAR struct nxplayer_mediaindex_s *idx,
+                             FAR char *path)
+{
+  FAR struct nxplayer_mediafile_s *file;
+  FAR struct nxplayer_mediadir_s  *dir;
+  FAR struct dirent               *entryp;
+  FAR DIR                         *dirp;
+  struct stat                      buf;
+  size_t                           len = strlen(path);
+  int                              ret = OK;
+
+  dirp = opendir(path);
+  if (dirp == NULL)
     {
-      int n   = apb->nmaxbytes - apb->nbytes;
-      int ret = read(pPlayer->fd, &apb->samp[apb->nbytes], n);
+      return -errno;
+    }
 
-      if (0 >= ret)
-        {
-          break;
-        }
+  /* Remember the modification time of each directory, so that we notice
+   * when files are added, removed or renamed.
+   */
 
-      apb->nbytes += ret;
-      usleep(10 * 1000);
+  dir = (FAR struct nxplayer_mediadir_s *)
+    nxplayer_indexgrow((FAR void **)&idx->dirs, &idx->ndirs, &idx->dalloc,
+                       sizeof(*dir));
+  if (dir == NULL || (dir->path = strdup(path)) == NULL)
+    {
+      closedir(dirp);
+      return -ENOMEM;
     }
-#endif
 
-  if (apb->nbytes < apb->nmaxbytes)
+  if (stat(path, &buf) == 0)
     {
-#ifdef CONFIG_DEBUG_AUDIO_INFO
-      int errcode   = errno;
-
-      audinfo("Closing audio file, nbytes=%d errcode=%d\n",
-              apb->nbytes, errorcode);
-#endif
-
-      /* End of file or read error.. We are finished with this file in any
-       * event.
-       */
-
-      close(pPlayer->fd);
-      pPlayer->fd = -1;
-
-      /* Set a flag to indicate that this is the final buffer in the stream */
+      dir->mtime = buf.st_mtime;
+    }
 
-      apb->flags |= AUDIO_APB_FINAL;
+  while (ret == OK && (entryp = readdir(dirp)) != NULL)
+    {
+      if (strcmp(entryp->d_name, ".") == 0 ||
+          strcmp(entryp->d_name, "..") == 0 ||
+          len + 1 + strlen(entryp->d_name) >= NXPLAYER_INDEX_PATHMAX)
+        {
+          continue;
+        }
 
-#ifdef CONFIG_DEBUG_AUDIO_ERROR
-      /* Was this a file read error */
+      path[len] = '/';
+      strcpy(&path[len + 1], entryp->d_name);
 
-      if (apb->nbytes == 0 && readerror)
+      if (DIRENT_ISDIRECTORY(entryp->d_type))
         {
-          DEBUGASSERT(errcode > 0);
-          auderr("ERROR: fread failed: %d\n", errcode);
-        }
+#ifdef CONFIG_NXPLAYER_RECURSIVE_MEDIA_SEARCH
+          ret = nxplayer_indexdir(idx, path);
 #endif
-    }
+        }
+      else
+        {
+          file = (FAR struct nxplayer_mediafile_s *)
+            nxplayer_indexgrow((FAR void **)&idx->files, &idx->nfiles,
+                               &idx->falloc, sizeof(*file));
+          if (file == NULL || (file->path = strdup(path)) == NULL)
+            {
+              ret = -ENOMEM;
+            }
+          else
+            {
+              file->name = &file->path[len + 1];
+            }
+        }
 
-  /* Return OK to indicate that the buffer should be passed through to the
-   * audio device.  This does not necessarily indicate that data was read
-   * correctly.
-   */
+      path[len] = '\0';
+    }
 
-  return OK;
+  closedir(dirp);
+  return ret;
 }
+#endif
 
 /****************************************************************************
- * Name: nxplayer_enqueuebuffer
+ * Name: nxplayer_indexcompare
  *
- * Description:
- *   Enqueue the audio buffer in the downstream device.  Normally we are
- *   called with a buffer of data to be enqueued in the audio stream.
- *
- *   Be we may also receive an empty length buffer (with only the
- *   AUDIO_APB_FINAL set) in the event of certin read error occurs or in the
- *   event that the file was an exact multiple of the nmaxbytes size of the
- *   audio buffer.  In that latter case, we have an end of file with no bytes
- *   read.
- *
- *   These infrequent zero length buffers have to be passed through because
- *   the include the AUDIO_APB_FINAL flag that is needed to terminate the
- *   audio stream.
+ *   Order media index entries by file name, then by path so that the
+ *   shallowest match of a name comes first.
  *
  ****************************************************************************/
 
-static int nxplayer_enqueuebuffer(FAR struct nxplayer_s *pPlayer,
-                                  FAR struct ap_buffer_s *apb)
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+static int nxplayer_indexcompare(FAR const void *a, FAR const void *b)
 {
-  struct audio_buf_desc_s bufdesc;
-  int ret;
-
-  /* Now enqueue the buffer with the audio device.  If the number of
-   * bytes in the file happens to be an exact multiple of the audio
-   * buffer size, then we will receive the last buffer size = 0.  We
-   * encode this buffer also so the audio system knows its the end of
-   * the file and can do proper clean-up.
-   */
+  FAR const struct nxplayer_mediafile_s *fa = a;
+  FAR const struct nxplayer_mediafile_s *fb = b;
+  int                                    ret;
 
-#ifdef CONFIG_AUDIO_MULTI_SESSION
-  bufdesc.session   = pPlayer->session;
-#endif
-  bufdesc.numbytes  = apb->nbytes;
-  bufdesc.u.pBuffer = apb;
-
-  ret = ioctl(pPlayer->devFd, AUDIOIOC_ENQUEUEBUFFER,
-              (unsigned long)&bufdesc);
-  if (ret < 0)
+  ret = strcmp(fa->name, fb->name);
+  if (ret == 0)
     {
-      int errcode = errno;
-      DEBUGASSERT(errcode > 0);
-
-      auderr("ERROR: AUDIOIOC_ENQUEUEBUFFER ioctl failed: %d\n", errcode);
-      return -errcode;
+      ret = (int)strlen(fa->path) - (int)strlen(fb->path);
     }
 
-  /* Return OK to indicate that we successfully read data from the file
-   * (and we are not yet at the end of file)
-   */
-
-  return OK;
+  return ret;
 }
+#endif
 
 /****************************************************************************
- * Name: nxplayer_thread_playthread
+ * Name: nxplayer_indexname
  *
- *  This is the thread that reads the audio file file and enqueues /
- *  dequeues buffers to the selected and opened audio device.
+ *   Compare a file name with the name of a media index entry.
  *
  ****************************************************************************/
 
-static void *nxplayer_playthread(pthread_addr_t pvarg)
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+static int nxplayer_indexname(FAR const void *name, FAR const void *entry)
 {
-  struct nxplayer_s           *pPlayer = (struct nxplayer_s *) pvarg;
-  struct audio_msg_s          msg;
-  struct audio_buf_desc_s     buf_desc;
-  ssize_t                     size;
-  bool                        running = true;
-  bool                        streaming = true;
-  bool                        failed = false;
-#ifdef CONFIG_AUDIO_DRIVER_SPECIFIC_BUFFERS
-  struct ap_buffer_info_s     buf_info;
-  FAR struct ap_buffer_s      **pBuffers;
-#else
-  FAR struct ap_buffer_s      *pBuffers[CONFIG_AUDIO_NUM_BUFFERS];
-#endif
-#ifdef CONFIG_DEBUG_FEATURES
-  int                         outstanding = 0;
+  return strcmp((FAR const char *)name,
+                ((FAR const struct nxplayer_mediafile_s *)entry)->name);
+}
 #endif
-  int                         prio;
-  int                         x;
-  int                         ret;
 
-  audinfo("Entry\n");
+/****************************************************************************
+ * Name: nxplayer_freeindex
+ *
+ *   nxplayer_freeindex() discards the media index.
+ *
+ ****************************************************************************/
 
-  /* Query the audio device for it's preferred buffer size / qty */
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+static void nxplayer_freeindex(FAR struct nxplayer_s *pPlayer)
+{
+  FAR struct nxplayer_mediaindex_s *idx = pPlayer->mindex;
+  int                               x;
 
-#ifdef CONFIG_AUDIO_DRIVER_SPECIFIC_BUFFERS
-  if ((ret = ioctl(pPlayer->devFd, AUDIOIOC_GETBUFFERINFO,
-          (unsigned long) &buf_info)) != OK)
+  if (idx == NULL)
     {
-      /* Driver doesn't report it's buffer size.  Use our default. */
-
-      buf_info.buffer_size = CONFIG_AUDIO_BUFFER_NUMBYTES;
-      buf_info.nbuffers = CONFIG_AUDIO_NUM_BUFFERS;
+      return;
     }
 
-  /* Create array of pointers to buffers */
-
-  pBuffers = (FAR struct ap_buffer_s **) malloc(buf_info.nbuffers * sizeof(FAR void *));
-  if (pBuffers == NULL)
+  for (x = 0; x < idx->nfiles; x++)
     {
-      /* Error allocating memory for buffer storage! */
+      free(idx->files[x].path);
+    }
 
-      ret = -ENOMEM;
-      running = false;
-      goto err_out;
+  for (x = 0; x < idx->ndirs; x++)
+    {
+      free(idx->dirs[x].path);
     }
 
-  /* Create our audio pipeline buffers to use for queueing up data */
+  free(idx->files);
+  free(idx->dirs);
+  free(idx);
+  pPlayer->mindex = NULL;
+}
+#endif
 
-  for (x = 0; x < buf_info.nbuffers; x++)
+/****************************************************************************
+ * Name: nxplayer_indexstale
+ *
+ *   nxplayer_indexstale() returns true if any directory of the media index
+ *   has been modified since it was indexed.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+static bool nxplayer_indexstale(FAR struct nxplayer_mediaindex_s *idx)
+{
+  struct stat buf;
+  int         x;
+
+  for (x = 0; x < idx->ndirs; x++)
     {
-      pBuffers[x] = NULL;
+      if (stat(idx->dirs[x].path, &buf) < 0 ||
+          buf.st_mtime != idx->dirs[x].mtime)
+        {
+          return true;
+        }
     }
 
-  for (x = 0; x < buf_info.nbuffers; x++)
-#else /* CONFIG_AUDIO_DRIVER_SPECIFIC_BUFFER */
+  return false;
+}
+#endif
 
-  for (x = 0; x < CONFIG_AUDIO_NUM_BUFFERS; x++)
+/****************************************************************************
+ * Name: nxplayer_indexlookup
+ *
+ *   nxplayer_indexlookup() finds a file by name in the media directory,
+ *   (re)building the index first if there is none yet or if the media
+ *   directory has changed.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+static FAR struct nxplayer_mediafile_s *
+nxplayer_indexlookup(FAR struct nxplayer_s *pPlayer, FAR const char *pFilename)
+{
+  FAR struct nxplayer_mediaindex_s *idx = pPlayer->mindex;
+  FAR struct nxplayer_mediafile_s  *file;
+  char                              path[NXPLAYER_INDEX_PATHMAX];
+  int                               ret;
+
+  if (idx != NULL && nxplayer_indexstale(idx))
     {
-      pBuffers[x] = NULL;
+      audinfo("Media directory changed\n");
+      nxplayer_freeindex(pPlayer);
+      idx = NULL;
     }
 
-  for (x = 0; x < CONFIG_AUDIO_NUM_BUFFERS; x++)
-#endif /* CONFIG_AUDIO_DRIVER_SPECIFIC_BUFFER */
+  if (idx == NULL)
     {
-      /* Fill in the buffer descriptor struct to issue an alloc request */
+      idx = (FAR struct nxplayer_mediaindex_s *)zalloc(sizeof(*idx));
+      if (idx == NULL)
+        {
+          return NULL;
+        }
 
-#ifdef CONFIG_AUDIO_MULTI_SESSION
-      buf_desc.session = pPlayer->session;
-#endif
-#ifdef CONFIG_AUDIO_DRIVER_SPECIFIC_BUFFERS
-      buf_desc.numbytes = buf_info.buffer_size;
-#else
-      buf_desc.numbytes = CONFIG_AUDIO_BUFFER_NUMBYTES;
-#endif
-      buf_desc.u.ppBuffer = &pBuffers[x];
+      pPlayer->mindex = idx;
 
-      ret = ioctl(pPlayer->devFd, AUDIOIOC_ALLOCBUFFER,
-                  (unsigned long) &buf_desc);
-      if (ret != sizeof(buf_desc))
-        {
-          /* Buffer alloc Operation not supported or error allocating! */
+      strncpy(path, pPlayer->mediadir, sizeof(path));
+      path[sizeof(path) - 1] = '\0';
 
-          auderr("ERROR: Could not allocate buffer %d\n", x);
-          running = false;
-          goto err_out;
+      ret = nxplayer_indexdir(idx, path);
+      if (ret < 0)
+        {
+          auderr("ERROR: Could not index %s: %d\n", path, ret);
+          nxplayer_freeindex(pPlayer);
+          return NULL;
         }
+
+      qsort(idx->files, idx->nfiles, sizeof(*idx->files),
+            nxplayer_indexcompare);
+      audinfo("Indexed %d media files\n", idx->nfiles);
     }
 
+  file = (FAR struct nxplayer_mediafile_s *)
+    bsearch(pFilename, idx->files, idx->nfiles, sizeof(*idx->files),
+            nxplayer_indexname);
+
+  /* bsearch() may land on any entry with the name.  Back up to the first */
+
+  while (file != NULL && file > idx->files &&
+         strcmp(file[-1].name, pFilename) == 0)
+    {
+      file--;
+    }
+
+  return file;
+}
+#endif
+
+/****************************************************************************
+ * Name: nxplayer_openmedia
+ *
+ *   nxplayer_openmedia() opens the specified media file, looking in the
+ *   media directory if it is not found as given, and determines its format
+ *   if the caller did not provide it.
+ *
+ * Return:
+ *    The open file descriptor, or
+ *    -ENOENT   if the media file was not found.
+ *    -ENOSYS   if the media file is an unsupported type.
+ *
+ ****************************************************************************/
+
+static int nxplayer_openmedia(FAR struct nxplayer_s *pPlayer,
+                              FAR const char *pFilename,
+                              FAR int *filefmt, FAR int *subfmt)
+{
+#ifdef CONFIG_NXPLAYER_INCLUDE_MEDIADIR
+  char                path[128];
+#endif
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+  FAR struct nxplayer_mediafile_s *file = NULL;
+  bool                detect = (*filefmt == AUDIO_FMT_UNDEF &&
+                                *subfmt == AUDIO_FMT_UNDEF);
+#endif
+  int                 tmpsubfmt = AUDIO_FMT_UNDEF;
+  int                 fd;
+
+  /* Test that the specified file exists */
+
+#ifdef CONFIG_NXPLAYER_HTTP_STREAMING_SUPPORT
+  if ((fd = _open_with_http(pFilename)) == -1)
+#else
+  if ((fd = open(pFilename, O_RDONLY)) == -1)
+#endif
+    {
+      /* File not found.  Test if its in the mediadir */
+
+#ifdef CONFIG_NXPLAYER_INCLUDE_MEDIADIR
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+      /* Look plain file names up in the media index rather than searching
+       * the media directory.
+       */
+
+      if (strchr(pFilename, '/') == NULL)
+        {
+          file = nxplayer_indexlookup(pPlayer, pFilename);
+        }
+
+      if (file != NULL)
+        {
+          strncpy(path, file->path, sizeof(path));
+          path[sizeof(path) - 1] = '\0';
+        }
+      else
+#endif
+        {
+          snprintf(path, sizeof(path), "%s/%s", pPlayer->mediadir, pFilename);
+        }
+
+      if ((fd = open(path, O_RDONLY)) == -1)
+        {
+#ifdef CONFIG_NXPLAYER_MEDIA_SEARCH
+          /* File not found in the media dir.  Do a search */
+
+          if (nxplayer_mediasearch(pPlayer, pFilename, path, sizeof(path)) != OK ||
+              (fd = open(path, O_RDONLY)) == -1)
+            {
+              auderr("ERROR: Could not find file\n");
+              return -ENOENT;
+            }
+#else
+          auderr("ERROR: Could not open %s or %s\n", pFilename, path);
+          return -ENOENT;
+#endif  /* CONFIG_NXPLAYER_MEDIA_SEARCH */
+        }
+
+#else   /* CONFIG_NXPLAYER_INCLUDE_MEDIADIR */
+
+        auderr("ERROR: Could not open %s\n", pFilename);
+        return -ENOENT;
+#endif  /* CONFIG_NXPLAYER_INCLUDE_MEDIADIR */
+    }
+
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+  /* Use the format found the last time this file was played */
+
+  if (file != NULL && file->detected && detect)
+    {
+      *filefmt = file->filefmt;
+      *subfmt  = file->subfmt;
+      return fd;
+    }
+#endif
+
+#ifdef CONFIG_NXPLAYER_FMT_FROM_EXT
+  /* Try to determine the format of audio file based on the extension */
+
+  if (*filefmt == AUDIO_FMT_UNDEF)
+    {
+      *filefmt = nxplayer_fmtfromextension(fd, pFilename, &tmpsubfmt);
+    }
+#endif
+
+#ifdef CONFIG_NXPLAYER_FMT_FROM_HEADER
+  /* If type not identified, then test for known header types */
+
+  if (*filefmt == AUDIO_FMT_UNDEF)
+    {
+      *filefmt = nxplayer_fmtfromheader(pPlayer, subfmt, &tmpsubfmt);
+    }
+#endif
+
+  /* Test if we determined the file format */
+
+  if (*filefmt == AUDIO_FMT_UNDEF)
+    {
+      /* Hmmm, it's some unknown / unsupported type */
+
+      auderr("ERROR: Unsupported format: %d \n", *filefmt);
+      close(fd);
+      return -ENOSYS;
+    }
+
+  /* Test if we have a sub format assignment from above */
+
+  if (*subfmt == AUDIO_FMT_UNDEF)
+    {
+      *subfmt = tmpsubfmt;
+    }
+
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+  if (file != NULL && detect)
+    {
+      file->filefmt  = *filefmt;
+      file->subfmt   = *subfmt;
+      file->detected = true;
+    }
+#endif
+
+  return fd;
+}
+
+/****************************************************************************
+ * Name: nxplayer_reservedevice
+ *
+ *   nxplayer_reservedevice() opens an audio device for the specified format
+ *   and reserves it for our use.  The device is closed again on failure.
+ *
+ ****************************************************************************/
+
+static int nxplayer_reservedevice(FAR struct nxplayer_s *pPlayer,
+                                  int filefmt, int subfmt)
+{
+  int ret;
+
+  /* Try to open the device */
+
+  ret = nxplayer_opendevice(pPlayer, filefmt, subfmt);
+  if (ret < 0)
+    {
+      /* Error opening the device */
+
+      auderr("ERROR: nxplayer_opendevice failed: %d\n", ret);
+      return ret;
+    }
+
+  /* Try to reserve the device */
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+  ret = ioctl(pPlayer->devFd, AUDIOIOC_RESERVE,
+              (unsigned long)&pPlayer->session);
+#else
+  ret = ioctl(pPlayer->devFd, AUDIOIOC_RESERVE, 0);
+#endif
+  if (ret < 0)
+    {
+      /* Device is busy or error */
+
+      ret = -errno;
+      auderr("ERROR: Failed to reserve device: %d\n", ret);
+      close(pPlayer->devFd);
+      pPlayer->devFd = -1;
+      return ret;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: nxplayer_readwavfmt
+ *
+ *   nxplayer_readwavfmt() records the layout of a PCM track if it is a
+ *   plain 44-byte-header WAV file, so that it can be compared with the
+ *   track before it.  The file is left at its beginning.  Streams that
+ *   cannot seek are not examined.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+static void nxplayer_readwavfmt(FAR struct nxplayer_track_s *track)
+{
+  uint8_t hdr[NXPLAYER_WAVHDR_SIZE];
+
+  track->samprate  = 0;
+  track->nchannels = 0;
+  track->bpsamp    = 0;
+
+  if (track->filefmt != AUDIO_FMT_PCM ||
+      lseek(track->fd, 0, SEEK_CUR) == (off_t)-1)
+    {
+      return;
+    }
+
+  if (read(track->fd, hdr, sizeof(hdr)) == sizeof(hdr) &&
+      memcmp(&hdr[0], "RIFF", 4) == 0 &&
+      memcmp(&hdr[8], "WAVEfmt ", 8) == 0 &&
+      NXPLAYER_GETLE32(&hdr[16]) == 16 &&
+      NXPLAYER_GETLE16(&hdr[20]) == 1 &&
+      memcmp(&hdr[36], "data", 4) == 0)
+    {
+      track->nchannels = NXPLAYER_GETLE16(&hdr[22]);
+      track->samprate  = NXPLAYER_GETLE32(&hdr[24]);
+      track->bpsamp    = NXPLAYER_GETLE16(&hdr[34]);
+    }
+
+  (void)lseek(track->fd, 0, SEEK_SET);
+}
+#endif
+
+/****************************************************************************
+ * Name: nxplayer_cancontinue
+ *
+ *   nxplayer_cancontinue() returns true if the data of the 'next' track can
+ *   follow that of the track playing in the same audio stream.  That is the
+ *   case for formats made of self-contained frames, and for WAV files with
+ *   the same layout, whose header is then skipped.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+static bool nxplayer_cancontinue(FAR const struct nxplayer_track_s *playing,
+                                 FAR const struct nxplayer_track_s *next)
+{
+  if (next->filefmt != playing->filefmt || next->subfmt != playing->subfmt)
+    {
+      return false;
+    }
+
+  switch (next->filefmt)
+    {
+      case AUDIO_FMT_AC3:
+      case AUDIO_FMT_MP3:
+      case AUDIO_FMT_DTS:
+        return true;
+
+      case AUDIO_FMT_PCM:
+        return next->samprate != 0 &&
+               next->samprate == playing->samprate &&
+               next->nchannels == playing->nchannels &&
+               next->bpsamp == playing->bpsamp &&
+               lseek(next->fd, NXPLAYER_WAVHDR_SIZE, SEEK_SET) ==
+                 NXPLAYER_WAVHDR_SIZE;
+
+      default:
+        return false;
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: nxplayer_nexttrack
+ *
+ *   nxplayer_nexttrack() is called when the file playing ends.  If the next
+ *   queued track can continue the same audio stream, it closes the file and
+ *   makes the queued one current, and returns true.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+static bool nxplayer_nexttrack(FAR struct nxplayer_s *pPlayer)
+{
+  FAR struct nxplayer_track_s *next;
+  bool                         ret = false;
+
+  while (sem_wait(&pPlayer->sem) < 0)
+    ;
+
+  next = &pPlayer->queue[pPlayer->qhead];
+  if (pPlayer->qcount > 0 && nxplayer_cancontinue(&pPlayer->playing, next))
+    {
+      audinfo("Continuing with the next track\n");
+
+      close(pPlayer->fd);
+      pPlayer->fd      = next->fd;
+      pPlayer->playing = *next;
+
+      pPlayer->qhead = (pPlayer->qhead + 1) % CONFIG_NXPLAYER_QUEUE_SIZE;
+      pPlayer->qcount--;
+      ret = true;
+    }
+
+  sem_post(&pPlayer->sem);
+  return ret;
+}
+#endif
+
+/****************************************************************************
+ * Name: nxplayer_opennext
+ *
+ *   nxplayer_opennext() is called by the playthread, with the semaphore
+ *   held, after the audio device has been closed.  It makes the next queued
+ *   track current and opens and reserves a device for it.  Tracks for which
+ *   no device can be opened are discarded.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+static int nxplayer_opennext(FAR struct nxplayer_s *pPlayer)
+{
+  FAR struct nxplayer_track_s *next;
+  int                          ret = -ENOENT;
+
+  while (pPlayer->qcount > 0)
+    {
+      next = &pPlayer->queue[pPlayer->qhead];
+      pPlayer->qhead = (pPlayer->qhead + 1) % CONFIG_NXPLAYER_QUEUE_SIZE;
+      pPlayer->qcount--;
+
+      pPlayer->fd      = next->fd;
+      pPlayer->playing = *next;
+
+      ret = nxplayer_reservedevice(pPlayer, next->filefmt, next->subfmt);
+      if (ret == OK)
+        {
+          ioctl(pPlayer->devFd, AUDIOIOC_REGISTERMQ,
+                (unsigned long)pPlayer->mq);
+          return OK;
+        }
+
+      close(pPlayer->fd);
+      pPlayer->fd = -1;
+    }
+
+  return ret;
+}
+#endif
+
+/****************************************************************************
+ * Name: nxplayer_flushqueue
+ *
+ *   nxplayer_flushqueue() closes and discards all queued tracks.  The
+ *   caller holds the semaphore.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+static void nxplayer_flushqueue(FAR struct nxplayer_s *pPlayer)
+{
+  while (pPlayer->qcount > 0)
+    {
+      close(pPlayer->queue[pPlayer->qhead].fd);
+      pPlayer->qhead = (pPlayer->qhead + 1) % CONFIG_NXPLAYER_QUEUE_SIZE;
+      pPlayer->qcount--;
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: nxplayer_readblock
+ *
+ *  Read up to 'size' bytes of media data.  Returns the number of bytes
+ *  read; fewer than 'size' means that the end of the file was reached or
+ *  that a read error occurred.
+ *
+ ****************************************************************************/
+
+static apb_samp_t nxplayer_readblock(int fd, FAR uint8_t *dest, size_t size)
+{
+  ssize_t nread;
+  size_t  nbytes = 0;
+
+  /* A short read ends the file, except on an HTTP stream where we read
+   * from the network until the block is full or the connection closes.
+   */
+
+  do
+    {
+      nread = read(fd, &dest[nbytes], size - nbytes);
+      if (nread <= 0)
+        {
+          if (nread < 0)
+            {
+              auderr("ERROR: read failed: %d\n", errno);
+            }
+
+          break;
+        }
+
+      nbytes += nread;
+    }
+#ifdef CONFIG_NXPLAYER_HTTP_STREAMING_SUPPORT
+  while (nbytes < size);
+#else
+  while (false);
+#endif
+
+  return (apb_samp_t)nbytes;
+}
+
+/****************************************************************************
+ * Name: nxplayer_readmedia
+ *
+ *  Read up to 'size' bytes of media data from the file playing.  When the
+ *  file ends and the next queued track continues the same stream, the rest
+ *  is read from that track.
+ *
+ ****************************************************************************/
+
+static apb_samp_t nxplayer_readmedia(FAR struct nxplayer_s *pPlayer,
+                                     FAR uint8_t *dest, size_t size)
+{
+  apb_samp_t nbytes;
+
+  nbytes = nxplayer_readblock(pPlayer->fd, dest, size);
+
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+  while (nbytes < size && nxplayer_nexttrack(pPlayer))
+    {
+      nbytes += nxplayer_readblock(pPlayer->fd, &dest[nbytes], size - nbytes);
+    }
+#endif
+
+  return nbytes;
+}
+
+/****************************************************************************
+ * Name: nxplayer_readthread
+ *
+ *  This is the thread that reads the media file into the read-ahead ring.
+ *  Once the ring is full, it waits for the play thread to drain the ring
+ *  to the low-watermark before reading again.  It exits after the final
+ *  block of the file has been read, or when asked to stop.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PREFETCH
+static void *nxplayer_readthread(pthread_addr_t pvarg)
+{
+  FAR struct nxplayer_s          *pPlayer = (FAR struct nxplayer_s *)pvarg;
+  FAR struct nxplayer_prefetch_s *pf = pPlayer->prefetch;
+  FAR struct nxplayer_block_s    *block;
+  FAR struct ap_buffer_s         *apb;
+  struct audio_msg_s              msg;
+  apb_samp_t                      nbytes;
+  uint8_t                         head;
+
+  pthread_mutex_lock(&pf->lock);
+  while (!pf->stop && !pf->eof)
+    {
+      /* Wait until there is room to read into */
+
+      while (!pf->stop && !pf->refill)
+        {
+          pthread_cond_wait(&pf->cond, &pf->lock);
+        }
+
+      if (pf->stop)
+        {
+          break;
+        }
+
+      /* The block at head belongs to us until it is counted */
+
+      head = pf->head;
+      pthread_mutex_unlock(&pf->lock);
+
+      nbytes = nxplayer_readmedia(pPlayer, &pf->data[head * pf->blksize],
+                                  pf->blksize);
+
+      pthread_mutex_lock(&pf->lock);
+
+      block         = &pf->blocks[head];
+      block->nbytes = nbytes;
+      block->final  = (nbytes < pf->blksize);
+
+      if (block->final)
+        {
+          /* We are finished with this file in any event */
+
+          audinfo("Closing audio file, nbytes=%d\n", nbytes);
+          close(pPlayer->fd);
+          pPlayer->fd = -1;
+          pf->eof = true;
+        }
+
+      if (++pf->head >= CONFIG_NXPLAYER_PREFETCH_NBLOCKS)
+        {
+          pf->head = 0;
+        }
+
+      if (++pf->count >= CONFIG_NXPLAYER_PREFETCH_NBLOCKS)
+        {
+          pf->refill = false;
+        }
+
+      pthread_cond_broadcast(&pf->cond);
+
+      /* For each block read, hand one buffer that the device returned while
+       * the ring was dry back to the play thread, as if it had just been
+       * dequeued.  At the end of the file all of them go back so that the
+       * play thread can account for them.  mq_send() may block, so don't
+       * hold the lock.
+       */
+
+      while (pf->nparked > 0)
+        {
+          apb = pf->parked[--pf->nparked];
+          pthread_mutex_unlock(&pf->lock);
+
+          msg.msgId  = AUDIO_MSG_DEQUEUE;
+          msg.u.pPtr = apb;
+          mq_send(pPlayer->mq, (FAR const char *)&msg, sizeof(msg),
+                  CONFIG_NXPLAYER_MSG_PRIO);
+
+          pthread_mutex_lock(&pf->lock);
+          if (!pf->eof)
+            {
+              break;
+            }
+        }
+    }
+
+  pthread_mutex_unlock(&pf->lock);
+  return NULL;
+}
+#endif
+
+/****************************************************************************
+ * Name: nxplayer_startreader
+ *
+ *  Allocate the read-ahead ring, start the reader thread, and wait for it
+ *  to fill the ring (or to reach the end of a short file) so that playback
+ *  starts with a full ring.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PREFETCH
+static int nxplayer_startreader(FAR struct nxplayer_s *pPlayer,
+                                size_t blksize, int nbuffers)
+{
+  FAR struct nxplayer_prefetch_s *pf;
+  struct sched_param              sparam;
+  pthread_attr_t                  tattr;
+  int                             ret;
+
+  pf = (FAR struct nxplayer_prefetch_s *)zalloc(sizeof(*pf));
+  if (pf == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  pf->data   = (FAR uint8_t *)malloc(CONFIG_NXPLAYER_PREFETCH_NBLOCKS * blksize);
+  pf->parked = (FAR struct ap_buffer_s **)malloc(nbuffers * sizeof(FAR void *));
+  if (pf->data == NULL || pf->parked == NULL)
+    {
+      ret = -ENOMEM;
+      goto errout;
+    }
+
+  pf->blksize = blksize;
+  pf->refill  = true;
+  pthread_mutex_init(&pf->lock, NULL);
+  pthread_cond_init(&pf->cond, NULL);
+
+  pPlayer->prefetch  = pf;
+  pPlayer->underruns = 0;
+
+  /* Run the reader just below the play thread so that feeding the device
+   * always wins.
+   */
+
+  pthread_attr_init(&tattr);
+  sparam.sched_priority = sched_get_priority_max(SCHED_FIFO) - 10;
+  (void)pthread_attr_setschedparam(&tattr, &sparam);
+  (void)pthread_attr_setstacksize(&tattr, CONFIG_NXPLAYER_READTHREAD_STACKSIZE);
+
+  ret = pthread_create(&pf->readId, &tattr, nxplayer_readthread,
+                       (pthread_addr_t)pPlayer);
+  if (ret != OK)
+    {
+      pPlayer->prefetch = NULL;
+      pthread_cond_destroy(&pf->cond);
+      pthread_mutex_destroy(&pf->lock);
+      ret = -ret;
+      goto errout;
+    }
+
+  pthread_setname_np(pf->readId, "readthread");
+
+  /* Pre-roll */
+
+  pthread_mutex_lock(&pf->lock);
+  while (pf->count < CONFIG_NXPLAYER_PREFETCH_NBLOCKS && !pf->eof)
+    {
+      pthread_cond_wait(&pf->cond, &pf->lock);
+    }
+
+  pthread_mutex_unlock(&pf->lock);
+  return OK;
+
+errout:
+  free(pf->parked);
+  free(pf->data);
+  free(pf);
+  return ret;
+}
+#endif
+
+/****************************************************************************
+ * Name: nxplayer_stopreader
+ *
+ *  Stop the reader thread and free the read-ahead ring.  Returns the number
+ *  of parked buffers that were not handed back to the play thread.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PREFETCH
+static int nxplayer_stopreader(FAR struct nxplayer_s *pPlayer)
+{
+  FAR struct nxplayer_prefetch_s *pf = pPlayer->prefetch;
+  FAR void                       *value;
+  int                             nparked;
+
+  if (pf == NULL)
+    {
+      return 0;
+    }
+
+  pthread_mutex_lock(&pf->lock);
+  pf->stop = true;
+  pthread_cond_broadcast(&pf->cond);
+  pthread_mutex_unlock(&pf->lock);
+
+  pthread_join(pf->readId, &value);
+
+  audinfo("Reader stopped, %lu underruns\n", pPlayer->underruns);
+
+  nparked           = pf->nparked;
+  pPlayer->prefetch = NULL;
+
+  pthread_cond_destroy(&pf->cond);
+  pthread_mutex_destroy(&pf->lock);
+  free(pf->parked);
+  free(pf->data);
+  free(pf);
+
+  return nparked;
+}
+#endif
+
+/****************************************************************************
+ * Name: nxplayer_fetchbuffer
+ *
+ *  Copy the next block from the read-ahead ring into the specified buffer.
+ *  Returns -ENODATA when the whole file has been played.  If the ring is
+ *  dry, the buffer is parked and -EAGAIN is returned; the reader thread
+ *  sends the buffer back as another AUDIO_MSG_DEQUEUE once it has data.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PREFETCH
+static int nxplayer_fetchbuffer(FAR struct nxplayer_s *pPlayer,
+                                FAR struct ap_buffer_s *apb)
+{
+  FAR struct nxplayer_prefetch_s *pf = pPlayer->prefetch;
+  FAR struct nxplayer_block_s    *block;
+  int                             ret = OK;
+
+  pthread_mutex_lock(&pf->lock);
+  if (pf->count == 0)
+    {
+      if (pf->eof)
+        {
+          ret = -ENODATA;
+        }
+      else
+        {
+          /* Count each time the ring runs dry, not each buffer that has
+           * to wait for it.
+           */
+
+          if (pf->nparked == 0 && pPlayer->state == NXPLAYER_STATE_PLAYING)
+            {
+              pPlayer->underruns++;
+              PERF_INC(g_perf_underruns);
+              audwarn("WARNING: Read-ahead underrun %lu\n",
+                      pPlayer->underruns);
+            }
+
+          pf->parked[pf->nparked++] = apb;
+          ret = -EAGAIN;
+        }
+
+      pthread_mutex_unlock(&pf->lock);
+      return ret;
+    }
+
+  block = &pf->blocks[pf->tail];
+  memcpy(apb->samp, &pf->data[pf->tail * pf->blksize], block->nbytes);
+
+  apb->nbytes  = block->nbytes;
+  apb->curbyte = 0;
+  apb->flags   = block->final ? AUDIO_APB_FINAL : 0;
+
+  if (++pf->tail >= CONFIG_NXPLAYER_PREFETCH_NBLOCKS)
+    {
+      pf->tail = 0;
+    }
+
+  /* Let the reader top the ring up once it reaches the low-watermark */
+
+  if (--pf->count <= CONFIG_NXPLAYER_PREFETCH_LOWATER && !pf->refill)
+    {
+      pf->refill = true;
+      pthread_cond_broadcast(&pf->cond);
+    }
+
+  pthread_mutex_unlock(&pf->lock);
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: nxplayer_readbuffer
+ *
+ *  Read the next block of data from the media file into the specified
+ *  buffer.
+ *
+ ****************************************************************************/
+
+static int nxplayer_readbuffer(FAR struct nxplayer_s *pPlayer,
+                               FAR struct ap_buffer_s *apb)
+{
+#ifdef CONFIG_NXPLAYER_PREFETCH
+  /* Take the data from the read-ahead ring if the reader thread is running */
+
+  if (pPlayer->prefetch != NULL)
+    {
+      return nxplayer_fetchbuffer(pPlayer, apb);
+    }
+
+#endif
+  /* Validate the file is still open.  It will be closed automatically when
+   * we encounter the end of file (or, perhaps, a read error that we cannot
+   * handle.
+   */
+
+  if (pPlayer->fd == -1)
+    {
+      /* Return -ENODATA to indicate that there is nothing more to read from
+       * the file.
+       */
+
+      return -ENODATA;
+    }
+
+  /* Read data into the buffer. */
+
+  apb->nbytes  = nxplayer_readmedia(pPlayer, apb->samp, apb->nmaxbytes);
+  apb->curbyte = 0;
+  apb->flags   = 0;
+
+  if (apb->nbytes < apb->nmaxbytes)
+    {
+      audinfo("Closing audio file, nbytes=%d\n", apb->nbytes);
+
+      /* End of file or read error.. We are finished with this file in any
+       * event.
+       */
+
+      close(pPlayer->fd);
+      pPlayer->fd = -1;
+
+      /* Set a flag to indicate that this is the final buffer in the stream */
+
+      apb->flags |= AUDIO_APB_FINAL;
+    }
+
+  /* Return OK to indicate that the buffer should be passed through to the
+   * audio device.  This does not necessarily indicate that data was read
+   * correctly.
+   */
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: nxplayer_enqueuebuffer
+ *
+ * Description:
+ *   Enqueue the audio buffer in the downstream device.  Normally we are
+ *   called with a buffer of data to be enqueued in the audio stream.
+ *
+ *   Be we may also receive an empty length buffer (with only the
+ *   AUDIO_APB_FINAL set) in the event of certin read error occurs or in the
+ *   event that the file was an exact multiple of the nmaxbytes size of the
+ *   audio buffer.  In that latter case, we have an end of file with no bytes
+ *   read.
+ *
+ *   These infrequent zero length buffers have to be passed through because
+ *   the include the AUDIO_APB_FINAL flag that is needed to terminate the
+ *   audio stream.
+ *
+ ****************************************************************************/
+
+static int nxplayer_enqueuebuffer(FAR struct nxplayer_s *pPlayer,
+                                  FAR struct ap_buffer_s *apb)
+{
+  struct audio_buf_desc_s bufdesc;
+  int ret;
+
+  /* Now enqueue the buffer with the audio device.  If the number of
+   * bytes in the file happens to be an exact multiple of the audio
+   * buffer size, then we will receive the last buffer size = 0.  We
+   * encode this buffer also so the audio system knows its the end of
+   * the file and can do proper clean-up.
+   */
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+  bufdesc.session   = pPlayer->session;
+#endif
+  bufdesc.numbytes  = apb->nbytes;
+  bufdesc.u.pBuffer = apb;
+
+  ret = ioctl(pPlayer->devFd, AUDIOIOC_ENQUEUEBUFFER,
+              (unsigned long)&bufdesc);
+  if (ret < 0)
+    {
+      int errcode = errno;
+      DEBUGASSERT(errcode > 0);
+
+      auderr("ERROR: AUDIOIOC_ENQUEUEBUFFER ioctl failed: %d\n", errcode);
+      PERF_INC(g_perf_errors);
+      return -errcode;
+    }
+
+  PERF_INC(g_perf_buffers);
+  PERF_ADD(g_perf_bytes, apb->nbytes);
+
+  /* Return OK to indicate that we successfully read data from the file
+   * (and we are not yet at the end of file)
+   */
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: nxplayer_thread_playthread
+ *
+ *  This is the thread that reads the audio file file and enqueues /
+ *  dequeues buffers to the selected and opened audio device.
+ *
+ ****************************************************************************/
+
+static void *nxplayer_playthread(pthread_addr_t pvarg)
+{
+  struct nxplayer_s           *pPlayer = (struct nxplayer_s *) pvarg;
+  struct audio_msg_s          msg;
+  struct audio_buf_desc_s     buf_desc;
+  ssize_t                     size;
+  bool                        running = true;
+  bool                        streaming = true;
+  bool                        failed = false;
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+  bool                        stopped = false;
+#endif
+#ifdef CONFIG_AUDIO_DRIVER_SPECIFIC_BUFFERS
+  struct ap_buffer_info_s     buf_info;
+  FAR struct ap_buffer_s      **pBuffers;
+#else
+  FAR struct ap_buffer_s      *pBuffers[CONFIG_AUDIO_NUM_BUFFERS];
+#endif
+#ifdef CONFIG_DEBUG_FEATURES
+  int                         outstanding = 0;
+#endif
+  int                         prio;
+  int                         x;
+  int                         ret;
+
+  audinfo("Entry\n");
+
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+  /* We come back here to play the next queued track on a new device */
+
+next_track:
+  running   = true;
+  streaming = true;
+  failed    = false;
+#ifdef CONFIG_DEBUG_FEATURES
+  outstanding = 0;
+#endif
+#endif
+
+  /* Query the audio device for it's preferred buffer size / qty */
+
+#ifdef CONFIG_AUDIO_DRIVER_SPECIFIC_BUFFERS
+  if ((ret = ioctl(pPlayer->devFd, AUDIOIOC_GETBUFFERINFO,
+          (unsigned long) &buf_info)) != OK)
+    {
+      /* Driver doesn't report it's buffer size.  Use our default. */
+
+      buf_info.buffer_size = CONFIG_AUDIO_BUFFER_NUMBYTES;
+      buf_info.nbuffers = CONFIG_AUDIO_NUM_BUFFERS;
+    }
+
+  /* Create array of pointers to buffers */
+
+  pBuffers = (FAR struct ap_buffer_s **) malloc(buf_info.nbuffers * sizeof(FAR void *));
+  if (pBuffers == NULL)
+    {
+      /* Error allocating memory for buffer storage! */
+
+      ret = -ENOMEM;
+      running = false;
+      goto err_out;
+    }
+
+  /* Create our audio pipeline buffers to use for queueing up data */
+
+  for (x = 0; x < buf_info.nbuffers; x++)
+    {
+      pBuffers[x] = NULL;
+    }
+
+  for (x = 0; x < buf_info.nbuffers; x++)
+#else /* CONFIG_AUDIO_DRIVER_SPECIFIC_BUFFER */
+
+  for (x = 0; x < CONFIG_AUDIO_NUM_BUFFERS; x++)
+    {
+      pBuffers[x] = NULL;
+    }
+
+  for (x = 0; x < CONFIG_AUDIO_NUM_BUFFERS; x++)
+#endif /* CONFIG_AUDIO_DRIVER_SPECIFIC_BUFFER */
+    {
+      /* Fill in the buffer descriptor struct to issue an alloc request */
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+      buf_desc.session = pPlayer->session;
+#endif
+#ifdef CONFIG_AUDIO_DRIVER_SPECIFIC_BUFFERS
+      buf_desc.numbytes = buf_info.buffer_size;
+#else
+      buf_desc.numbytes = CONFIG_AUDIO_BUFFER_NUMBYTES;
+#endif
+      buf_desc.u.ppBuffer = &pBuffers[x];
+
+      ret = ioctl(pPlayer->devFd, AUDIOIOC_ALLOCBUFFER,
+                  (unsigned long) &buf_desc);
+      if (ret != sizeof(buf_desc))
+        {
+          /* Buffer alloc Operation not supported or error allocating! */
+
+          auderr("ERROR: Could not allocate buffer %d\n", x);
+          running = false;
+          goto err_out;
+        }
+    }
+
+#ifdef CONFIG_NXPLAYER_PREFETCH
+  /* Start reading ahead of the device.  If we can't, fall back to reading
+   * each buffer as the device returns it.
+   */
+
+#ifdef CONFIG_AUDIO_DRIVER_SPECIFIC_BUFFERS
+  ret = nxplayer_startreader(pPlayer, pBuffers[0]->nmaxbytes,
+                             buf_info.nbuffers);
+#else
+  ret = nxplayer_startreader(pPlayer, pBuffers[0]->nmaxbytes,
+                             CONFIG_AUDIO_NUM_BUFFERS);
+#endif
+  if (ret < 0)
+    {
+      auderr("ERROR: Failed to start the reader thread: %d\n", ret);
+    }
+
+#endif
   /* Fill up the pipeline with enqueued buffers */
 
 #ifdef CONFIG_AUDIO_DRIVER_SPECIFIC_BUFFERS
@@ -877,6 +2027,21 @@ static void *nxplayer_playthread(pthread_addr_t pvarg)
       /* Read the next buffer of data */
 
       ret = nxplayer_readbuffer(pPlayer, pBuffers[x]);
+#ifdef CONFIG_NXPLAYER_PREFETCH
+      if (ret == -EAGAIN)
+        {
+          /* The read-ahead ring holds fewer blocks than the device has
+           * buffers.  The reader thread will send this one back to us
+           * when it has data for it.
+           */
+
+#ifdef CONFIG_DEBUG_FEATURES
+          outstanding++;
+#endif
+          continue;
+        }
+#endif
+
       if (ret != OK)
         {
           /* nxplayer_readbuffer will return an error if there is no further
@@ -918,6 +2083,14 @@ static void *nxplayer_playthread(pthread_addr_t pvarg)
                * file so that no further data is read.
                */
 
+#if defined(CONFIG_NXPLAYER_PREFETCH) && defined(CONFIG_DEBUG_FEATURES)
+              /* Buffers parked for the reader thread will not come back */
+
+              outstanding -= nxplayer_stopreader(pPlayer);
+#elif defined(CONFIG_NXPLAYER_PREFETCH)
+              (void)nxplayer_stopreader(pPlayer);
+#endif
+
               close(pPlayer->fd);
               pPlayer->fd = -1;
 
@@ -1053,6 +2226,20 @@ static void *nxplayer_playthread(pthread_addr_t pvarg)
                 /* Read the next buffer of data */
 
                 ret = nxplayer_readbuffer(pPlayer, msg.u.pPtr);
+#ifdef CONFIG_NXPLAYER_PREFETCH
+                if (ret == -EAGAIN)
+                  {
+                    /* The read-ahead ring is dry.  The buffer is parked
+                     * until the reader thread sends it back to us.
+                     */
+
+#ifdef CONFIG_DEBUG_FEATURES
+                    outstanding++;
+#endif
+                    break;
+                  }
+#endif
+
                 if (ret != OK)
                   {
                     /* Out of data.  Stay in the loop until the device sends
@@ -1077,6 +2264,14 @@ static void *nxplayer_playthread(pthread_addr_t pvarg)
                          * Close the file so that no further data is read.
                          */
 
+#if defined(CONFIG_NXPLAYER_PREFETCH) && defined(CONFIG_DEBUG_FEATURES)
+                        /* Buffers parked for the reader thread will not come back */
+
+                        outstanding -= nxplayer_stopreader(pPlayer);
+#elif defined(CONFIG_NXPLAYER_PREFETCH)
+                        (void)nxplayer_stopreader(pPlayer);
+#endif
+
                         close(pPlayer->fd);
                         pPlayer->fd = -1;
 
@@ -1107,6 +2302,14 @@ static void *nxplayer_playthread(pthread_addr_t pvarg)
 
             audinfo("Stopping! outstanding=%d\n", outstanding);
 
+#if defined(CONFIG_NXPLAYER_PREFETCH) && defined(CONFIG_DEBUG_FEATURES)
+            /* Buffers parked for the reader thread will not come back */
+
+            outstanding -= nxplayer_stopreader(pPlayer);
+#elif defined(CONFIG_NXPLAYER_PREFETCH)
+            (void)nxplayer_stopreader(pPlayer);
+#endif
+
 #ifdef CONFIG_AUDIO_MULTI_SESSION
             ioctl(pPlayer->devFd, AUDIOIOC_STOP,
                  (unsigned long) pPlayer->session);
@@ -1119,6 +2322,9 @@ static void *nxplayer_playthread(pthread_addr_t pvarg)
              */
 
             streaming = false;
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+            stopped   = true;
+#endif
             break;
 
           /* Message indicating the playback is complete */
@@ -1141,6 +2347,14 @@ static void *nxplayer_playthread(pthread_addr_t pvarg)
 err_out:
   audinfo("Clean-up and exit\n");
 
+#ifdef CONFIG_NXPLAYER_PREFETCH
+  /* Stop the reader thread before it can touch the file, the buffers, or
+   * the message queue again.
+   */
+
+  (void)nxplayer_stopreader(pPlayer);
+#endif
+
   /* Unregister the message queue and release the session */
 
   ioctl(pPlayer->devFd, AUDIOIOC_UNREGISTERMQ, (unsigned long) pPlayer->mq);
@@ -1172,48 +2386,175 @@ err_out:
 
       /* Free the pointers to the buffers */
 
-      free(pBuffers);
+      free(pBuffers);
+    }
+#else
+    audinfo("Freeing buffers\n");
+    for (x = 0; x < CONFIG_AUDIO_NUM_BUFFERS; x++)
+      {
+        /* Fill in the buffer descriptor struct to issue a free request */
+
+        if (pBuffers[x] != NULL)
+          {
+            buf_desc.u.pBuffer = pBuffers[x];
+            ioctl(pPlayer->devFd, AUDIOIOC_FREEBUFFER, (unsigned long) &buf_desc);
+          }
+      }
+#endif
+
+  /* Close the files */
+
+  if (0 < pPlayer->fd)
+    {
+      close(pPlayer->fd);                 /* Close the file */
+      pPlayer->fd = -1;                   /* Clear out the FD */
+    }
+
+  close(pPlayer->devFd);                  /* Close the device */
+  pPlayer->devFd = -1;                    /* Mark device as closed */
+
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+  /* Unless we were stopped, go on to the next queued track.  Its format
+   * differs from this one (or it would have been streamed already), so it
+   * needs a device of its own.  The message queue is kept.
+   */
+
+  if (!stopped && nxplayer_opennext(pPlayer) == OK)
+    {
+      sem_post(&pPlayer->sem);
+      goto next_track;
+    }
+#endif
+
+  mq_close(pPlayer->mq);                  /* Close the message queue */
+  mq_unlink(pPlayer->mqname);             /* Unlink the message queue */
+  pPlayer->state = NXPLAYER_STATE_IDLE;   /* Go to IDLE */
+
+  sem_post(&pPlayer->sem);                /* Release the semaphore */
+
+  /* The playthread is done with the context.  Release it, which may
+   * actually cause the context to be freed if the creator has already
+   * abandoned (released) the context too.
+   */
+
+  nxplayer_release(pPlayer);
+
+  audinfo("Exit\n");
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: nxplayer_startplay
+ *
+ *   nxplayer_startplay() starts playing an open media file of known
+ *   format:  it opens and reserves a device, creates the playthread's
+ *   message queue, and starts the playthread.  The file is closed on
+ *   failure.
+ *
+ ****************************************************************************/
+
+static int nxplayer_startplay(FAR struct nxplayer_s *pPlayer, int fd,
+                              int filefmt, int subfmt)
+{
+  struct mq_attr      attr;
+  struct sched_param  sparam;
+  pthread_attr_t      tattr;
+  void               *value;
+  int                 ret;
+
+  pPlayer->fd = fd;
+
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+  /* Remember the format so that queued tracks can be compared with it */
+
+  pPlayer->playing.fd      = fd;
+  pPlayer->playing.filefmt = filefmt;
+  pPlayer->playing.subfmt  = subfmt;
+  nxplayer_readwavfmt(&pPlayer->playing);
+#endif
+
+  /* Try to open and reserve the device */
+
+  ret = nxplayer_reservedevice(pPlayer, filefmt, subfmt);
+  if (ret < 0)
+    {
+      goto err_out_nodev;
+    }
+
+  /* Create a message queue for the playthread */
+
+  attr.mq_maxmsg  = 16;
+  attr.mq_msgsize = sizeof(struct audio_msg_s);
+  attr.mq_curmsgs = 0;
+  attr.mq_flags   = 0;
+
+  snprintf(pPlayer->mqname, sizeof(pPlayer->mqname), "/tmp/%0lx",
+           (unsigned long)((uintptr_t)pPlayer));
+
+  pPlayer->mq = mq_open(pPlayer->mqname, O_RDWR | O_CREAT, 0644, &attr);
+  if (pPlayer->mq == NULL)
+    {
+      /* Unable to open message queue! */
+
+      ret = -errno;
+      auderr("ERROR: mq_open failed: %d\n", ret);
+      goto err_out;
     }
-#else
-    audinfo("Freeing buffers\n");
-    for (x = 0; x < CONFIG_AUDIO_NUM_BUFFERS; x++)
-      {
-        /* Fill in the buffer descriptor struct to issue a free request */
 
-        if (pBuffers[x] != NULL)
-          {
-            buf_desc.u.pBuffer = pBuffers[x];
-            ioctl(pPlayer->devFd, AUDIOIOC_FREEBUFFER, (unsigned long) &buf_desc);
-          }
-      }
-#endif
+  /* Register our message queue with the audio device */
 
-  /* Close the files */
+  ioctl(pPlayer->devFd, AUDIOIOC_REGISTERMQ, (unsigned long) pPlayer->mq);
 
-  if (0 < pPlayer->fd)
+  /* Check if there was a previous thread and join it if there was
+   * to perform clean-up.
+   */
+
+  if (pPlayer->playId != 0)
     {
-      close(pPlayer->fd);                 /* Close the file */
-      pPlayer->fd = -1;                   /* Clear out the FD */
+      pthread_join(pPlayer->playId, &value);
     }
 
-  close(pPlayer->devFd);                  /* Close the device */
-  pPlayer->devFd = -1;                    /* Mark device as closed */
-  mq_close(pPlayer->mq);                  /* Close the message queue */
-  mq_unlink(pPlayer->mqname);             /* Unlink the message queue */
-  pPlayer->state = NXPLAYER_STATE_IDLE;   /* Go to IDLE */
+  /* Start the playfile thread to stream the media file to the
+   * audio device.
+   */
 
-  sem_post(&pPlayer->sem);                /* Release the semaphore */
+  pthread_attr_init(&tattr);
+  sparam.sched_priority = sched_get_priority_max(SCHED_FIFO) - 9;
+  (void)pthread_attr_setschedparam(&tattr, &sparam);
+  (void)pthread_attr_setstacksize(&tattr, CONFIG_NXPLAYER_PLAYTHREAD_STACKSIZE);
 
-  /* The playthread is done with the context.  Release it, which may
-   * actually cause the context to be freed if the creator has already
-   * abandoned (released) the context too.
+  /* Add a reference count to the player for the thread and start the
+   * thread.  We increment for the thread to avoid thread start-up
+   * race conditions.
    */
 
-  nxplayer_release(pPlayer);
+  nxplayer_reference(pPlayer);
+  ret = pthread_create(&pPlayer->playId, &tattr, nxplayer_playthread,
+                       (pthread_addr_t) pPlayer);
+  if (ret != OK)
+    {
+      auderr("ERROR: Failed to create playthread: %d\n", ret);
+      goto err_out;
+    }
 
-  audinfo("Exit\n");
+  /* Name the thread */
 
-  return NULL;
+  pthread_setname_np(pPlayer->playId, "playthread");
+  return OK;
+
+err_out:
+  close(pPlayer->devFd);
+  pPlayer->devFd = -1;
+
+err_out_nodev:
+  if (0 < pPlayer->fd)
+    {
+      close(pPlayer->fd);
+      pPlayer->fd = -1;
+    }
+
+  return ret;
 }
 
 /****************************************************************************
@@ -1752,6 +3093,9 @@ int nxplayer_stop(FAR struct nxplayer_s *pPlayer)
   /* Validate we are not in IDLE state */
 
   sem_wait(&pPlayer->sem);                      /* Get the semaphore */
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+  nxplayer_flushqueue(pPlayer);                 /* Nothing plays after this */
+#endif
   if (pPlayer->state == NXPLAYER_STATE_IDLE)
     {
       sem_post(&pPlayer->sem);                  /* Release the semaphore */
@@ -1802,15 +3146,7 @@ int nxplayer_stop(FAR struct nxplayer_s *pPlayer)
 int nxplayer_playfile(FAR struct nxplayer_s *pPlayer,
                       FAR const char *pFilename, int filefmt, int subfmt)
 {
-  struct mq_attr      attr;
-  struct sched_param  sparam;
-  pthread_attr_t      tattr;
-  void               *value;
-#ifdef CONFIG_NXPLAYER_INCLUDE_MEDIADIR
-  char                path[128];
-#endif
-  int                 tmpsubfmt = AUDIO_FMT_UNDEF;
-  int                 ret;
+  int fd;
 
   DEBUGASSERT(pPlayer != NULL);
   DEBUGASSERT(pFilename != NULL);
@@ -1824,180 +3160,79 @@ int nxplayer_playfile(FAR struct nxplayer_s *pPlayer,
   audinfo("Playing file %s\n", pFilename);
   audinfo("==============================\n");
 
-  /* Test that the specified file exists */
-
-#ifdef CONFIG_NXPLAYER_HTTP_STREAMING_SUPPORT
-  if ((pPlayer->fd = _open_with_http(pFilename)) == -1)
-#else
-  if ((pPlayer->fd = open(pFilename, O_RDONLY)) == -1)
-#endif
-    {
-      /* File not found.  Test if its in the mediadir */
-
-#ifdef CONFIG_NXPLAYER_INCLUDE_MEDIADIR
-      snprintf(path, sizeof(path), "%s/%s", pPlayer->mediadir, pFilename);
-
-      if ((pPlayer->fd = open(path, O_RDONLY)) == -1)
-        {
-#ifdef CONFIG_NXPLAYER_MEDIA_SEARCH
-          /* File not found in the media dir.  Do a search */
-
-          if (nxplayer_mediasearch(pPlayer, pFilename, path, sizeof(path)) != OK)
-            {
-              auderr("ERROR: Could not find file\n");
-              return -ENOENT;
-            }
-#else
-          auderr("ERROR: Could not open %s or %s\n", pFilename, path);
-          return -ENOENT;
-#endif  /* CONFIG_NXPLAYER_MEDIA_SEARCH */
-        }
-
-#else   /* CONFIG_NXPLAYER_INCLUDE_MEDIADIR */
-
-        auderr("ERROR: Could not open %s\n", pFilename);
-        return -ENOENT;
-#endif  /* CONFIG_NXPLAYER_INCLUDE_MEDIADIR */
-    }
-
-#ifdef CONFIG_NXPLAYER_FMT_FROM_EXT
-  /* Try to determine the format of audio file based on the extension */
-
-  if (filefmt == AUDIO_FMT_UNDEF)
-    {
-      filefmt = nxplayer_fmtfromextension(pPlayer, pFilename, &tmpsubfmt);
-    }
-#endif
-
-#ifdef CONFIG_NXPLAYER_FMT_FROM_HEADER
-  /* If type not identified, then test for known header types */
-
-  if (filefmt == AUDIO_FMT_UNDEF)
-    {
-      filefmt = nxplayer_fmtfromheader(pPlayer, &subfmt, &tmpsubfmt);
-    }
-#endif
-
-  /* Test if we determined the file format */
-
-  if (filefmt == AUDIO_FMT_UNDEF)
-    {
-      /* Hmmm, it's some unknown / unsupported type */
-
-      auderr("ERROR: Unsupported format: %d \n", filefmt);
-      ret = -ENOSYS;
-      goto err_out_nodev;
-    }
-
-  /* Test if we have a sub format assignment from above */
-
-  if (subfmt == AUDIO_FMT_UNDEF)
-    {
-      subfmt = tmpsubfmt;
-    }
-
-  /* Try to open the device */
-
-  ret = nxplayer_opendevice(pPlayer, filefmt, subfmt);
-  if (ret < 0)
+  fd = nxplayer_openmedia(pPlayer, pFilename, &filefmt, &subfmt);
+  if (fd < 0)
     {
-      /* Error opening the device */
-
-      auderr("ERROR: nxplayer_opendevice failed: %d\n", ret);
-      goto err_out_nodev;
+      return fd;
     }
 
-  /* Try to reserve the device */
-
-#ifdef CONFIG_AUDIO_MULTI_SESSION
-  ret = ioctl(pPlayer->devFd, AUDIOIOC_RESERVE,
-              (unsigned long)&pPlayer->session);
-#else
-  ret = ioctl(pPlayer->devFd, AUDIOIOC_RESERVE, 0);
-#endif
-  if (ret < 0)
-    {
-      /* Device is busy or error */
+  return nxplayer_startplay(pPlayer, fd, filefmt, subfmt);
+}
 
-      auderr("ERROR: Failed to reserve device: %d\n", ret);
-      ret = -errno;
-      goto err_out;
-    }
+/****************************************************************************
+ * Name: nxplayer_queuefile
+ *
+ *   nxplayer_queuefile() opens the specified file now and queues it to be
+ *   played when the current file ends, or plays it right away if nothing
+ *   is playing.
+ *
+ * Returns:
+ *   OK         File is queued or being played
+ *   -ENOSPC    The queue is full
+ *   Otherwise, the same values as nxplayer_playfile()
+ *
+ ****************************************************************************/
 
-  /* Create a message queue for the playthread */
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+int nxplayer_queuefile(FAR struct nxplayer_s *pPlayer,
+                       FAR const char *pFilename, int filefmt, int subfmt)
+{
+  FAR struct nxplayer_track_s *track;
+  int                          fd;
 
-  attr.mq_maxmsg  = 16;
-  attr.mq_msgsize = sizeof(struct audio_msg_s);
-  attr.mq_curmsgs = 0;
-  attr.mq_flags   = 0;
+  DEBUGASSERT(pPlayer != NULL);
+  DEBUGASSERT(pFilename != NULL);
 
-  snprintf(pPlayer->mqname, sizeof(pPlayer->mqname), "/tmp/%0lx",
-           (unsigned long)((uintptr_t)pPlayer));
+  audinfo("Queueing file %s\n", pFilename);
 
-  pPlayer->mq = mq_open(pPlayer->mqname, O_RDWR | O_CREAT, 0644, &attr);
-  if (pPlayer->mq == NULL)
+  fd = nxplayer_openmedia(pPlayer, pFilename, &filefmt, &subfmt);
+  if (fd < 0)
     {
-      /* Unable to open message queue! */
-
-      ret = -errno;
-      auderr("ERROR: mq_open failed: %d\n", ret);
-      goto err_out;
+      return fd;
     }
 
-  /* Register our message queue with the audio device */
-
-  ioctl(pPlayer->devFd, AUDIOIOC_REGISTERMQ, (unsigned long) pPlayer->mq);
-
-  /* Check if there was a previous thread and join it if there was
-   * to perform clean-up.
+  /* The playthread checks the queue with the semaphore held before it goes
+   * idle, so a track queued here while it is not idle will be played.
    */
 
-  if (pPlayer->playId != 0)
+  while (sem_wait(&pPlayer->sem) < 0)
+    ;
+
+  if (pPlayer->state == NXPLAYER_STATE_IDLE)
     {
-      pthread_join(pPlayer->playId, &value);
+      sem_post(&pPlayer->sem);
+      return nxplayer_startplay(pPlayer, fd, filefmt, subfmt);
     }
 
-  /* Start the playfile thread to stream the media file to the
-   * audio device.
-   */
-
-  pthread_attr_init(&tattr);
-  sparam.sched_priority = sched_get_priority_max(SCHED_FIFO) - 9;
-  (void)pthread_attr_setschedparam(&tattr, &sparam);
-  (void)pthread_attr_setstacksize(&tattr, CONFIG_NXPLAYER_PLAYTHREAD_STACKSIZE);
-
-  /* Add a reference count to the player for the thread and start the
-   * thread.  We increment for the thread to avoid thread start-up
-   * race conditions.
-   */
-
-  nxplayer_reference(pPlayer);
-  ret = pthread_create(&pPlayer->playId, &tattr, nxplayer_playthread,
-                       (pthread_addr_t) pPlayer);
-  if (ret != OK)
+  if (pPlayer->qcount >= CONFIG_NXPLAYER_QUEUE_SIZE)
     {
-      auderr("ERROR: Failed to create playthread: %d\n", ret);
-      goto err_out;
+      sem_post(&pPlayer->sem);
+      close(fd);
+      return -ENOSPC;
     }
 
-  /* Name the thread */
+  track = &pPlayer->queue[(pPlayer->qhead + pPlayer->qcount) %
+                          CONFIG_NXPLAYER_QUEUE_SIZE];
+  track->fd      = fd;
+  track->filefmt = filefmt;
+  track->subfmt  = subfmt;
+  nxplayer_readwavfmt(track);
 
-  pthread_setname_np(pPlayer->playId, "playthread");
+  pPlayer->qcount++;
+  sem_post(&pPlayer->sem);
   return OK;
-
-err_out:
-  close(pPlayer->devFd);
-  pPlayer->devFd = -1;
-
-err_out_nodev:
-  if (0 < pPlayer->fd)
-    {
-      close(pPlayer->fd);
-      pPlayer->fd = -1;
-    }
-
-  return ret;
 }
+#endif
 
 /****************************************************************************
  * Name: nxplayer_setmediadir
@@ -2011,6 +3246,24 @@ void nxplayer_setmediadir(FAR struct nxplayer_s *pPlayer,
      FAR const char *mediadir)
 {
   strncpy(pPlayer->mediadir, mediadir, sizeof(pPlayer->mediadir));
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+  nxplayer_freeindex(pPlayer);
+#endif
+}
+#endif
+
+/****************************************************************************
+ * Name: nxplayer_getunderruns
+ *
+ *   nxplayer_getunderruns() returns the number of times the read-ahead
+ *   ring ran dry during playback of the current or most recent file.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PREFETCH
+unsigned long nxplayer_getunderruns(FAR struct nxplayer_s *pPlayer)
+{
+  return pPlayer->underruns;
 }
 #endif
 
@@ -2032,6 +3285,11 @@ FAR struct nxplayer_s *nxplayer_create(void)
 {
   FAR struct nxplayer_s *pPlayer;
 
+  PERF_REGISTER(g_perf_buffers);
+  PERF_REGISTER(g_perf_bytes);
+  PERF_REGISTER(g_perf_underruns);
+  PERF_REGISTER(g_perf_errors);
+
   /* Allocate the memory */
 
   pPlayer = (FAR struct nxplayer_s *) malloc(sizeof(struct nxplayer_s));
@@ -2045,6 +3303,17 @@ FAR struct nxplayer_s *nxplayer_create(void)
   pPlayer->state = NXPLAYER_STATE_IDLE;
   pPlayer->devFd = -1;
   pPlayer->fd = -1;
+#ifdef CONFIG_NXPLAYER_PREFETCH
+  pPlayer->prefetch = NULL;
+  pPlayer->underruns = 0;
+#endif
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+  pPlayer->qhead = 0;
+  pPlayer->qcount = 0;
+#endif
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+  pPlayer->mindex = NULL;
+#endif
 #ifdef CONFIG_NXPLAYER_INCLUDE_PREFERRED_DEVICE
   pPlayer->prefdevice[0] = '\0';
   pPlayer->prefformat = 0;
@@ -2142,6 +3411,12 @@ void nxplayer_release(FAR struct nxplayer_s *pPlayer)
 
   if (refcount == 1)
     {
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+      nxplayer_flushqueue(pPlayer);
+#endif
+#ifdef CONFIG_NXPLAYER_MEDIA_INDEX
+      nxplayer_freeindex(pPlayer);
+#endif
       free(pPlayer);
     }
 }
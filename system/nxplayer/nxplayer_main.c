@@ -82,6 +82,10 @@ struct mp_cmd_s {
 static int nxplayer_cmd_quit(FAR struct nxplayer_s *pPlayer, char *parg);
 static int nxplayer_cmd_play(FAR struct nxplayer_s *pPlayer, char *parg);
 
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+static int nxplayer_cmd_queue(FAR struct nxplayer_s *pPlayer, char *parg);
+#endif
+
 #ifdef CONFIG_NXPLAYER_INCLUDE_SYSTEM_RESET
 static int nxplayer_cmd_reset(FAR struct nxplayer_s *pPlayer, char *parg);
 #endif
@@ -103,6 +107,10 @@ static int nxplayer_cmd_mediadir(FAR struct nxplayer_s *pPlayer, char *parg);
 static int nxplayer_cmd_stop(FAR struct nxplayer_s *pPlayer, char *parg);
 #endif
 
+#ifdef CONFIG_NXPLAYER_PREFETCH
+static int nxplayer_cmd_underruns(FAR struct nxplayer_s *pPlayer, char *parg);
+#endif
+
 #ifndef CONFIG_AUDIO_EXCLUDE_VOLUME
 static int nxplayer_cmd_volume(FAR struct nxplayer_s *pPlayer, char *parg);
 #ifndef CONFIG_AUDIO_EXCLUDE_BALANCE
@@ -159,9 +167,15 @@ static struct mp_cmd_s g_nxplayer_cmds[] =
   { "tone",     "freq secs", NULL,                  NXPLAYER_HELP_TEXT(Produce a pure tone) },
 #ifndef CONFIG_AUDIO_EXCLUDE_TONE
   { "treble",   "d%",       nxplayer_cmd_treble,    NXPLAYER_HELP_TEXT(Set treble level percentage) },
+#endif
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+  { "queue",    "filename", nxplayer_cmd_queue,     NXPLAYER_HELP_TEXT(Play a media file after the current one) },
 #endif
   { "q",        "",         nxplayer_cmd_quit,      NXPLAYER_HELP_TEXT(Exit NxPlayer) },
   { "quit",     "",         nxplayer_cmd_quit,      NXPLAYER_HELP_TEXT(Exit NxPlayer) },
+#ifdef CONFIG_NXPLAYER_PREFETCH
+  { "underruns", "",        nxplayer_cmd_underruns, NXPLAYER_HELP_TEXT(Show read-ahead underruns) },
+#endif
 #ifndef CONFIG_AUDIO_EXCLUDE_VOLUME
   { "volume",   "d%",       nxplayer_cmd_volume,    NXPLAYER_HELP_TEXT(Set volume to level specified) }
 #endif
@@ -227,6 +241,50 @@ static int nxplayer_cmd_play(FAR struct nxplayer_s *pPlayer, char *parg)
   return ret;
 }
 
+/****************************************************************************
+ * Name: nxplayer_cmd_queue
+ *
+ *   nxplayer_cmd_queue() queues the specified media file to be played
+ *   after the current one.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PLAYLIST
+static int nxplayer_cmd_queue(FAR struct nxplayer_s *pPlayer, char *parg)
+{
+  int     ret;
+
+  ret = nxplayer_queuefile(pPlayer, parg, AUDIO_FMT_UNDEF, AUDIO_FMT_UNDEF);
+  switch (-ret)
+    {
+      case OK:
+        break;
+
+      case ENOSPC:
+        printf("Queue full\n");
+        break;
+
+      case ENODEV:
+        printf("No suitable Audio Device found\n");
+        break;
+
+      case ENOENT:
+        printf("File %s not found\n", parg);
+        break;
+
+      case ENOSYS:
+        printf("Unknown audio format\n");
+        break;
+
+      default:
+        printf("Error queueing file: %d\n", -ret);
+        break;
+    }
+
+  return ret;
+}
+#endif
+
 /****************************************************************************
  * Name: nxplayer_cmd_volume
  *
@@ -406,6 +464,22 @@ static int nxplayer_cmd_stop(FAR struct nxplayer_s *pPlayer, char *parg)
 }
 #endif
 
+/****************************************************************************
+ * Name: nxplayer_cmd_underruns
+ *
+ *   nxplayer_cmd_underruns() displays the number of times the read-ahead
+ *   ring ran dry while playing the current or last file.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NXPLAYER_PREFETCH
+static int nxplayer_cmd_underruns(FAR struct nxplayer_s *pPlayer, char *parg)
+{
+  printf("%lu\n", nxplayer_getunderruns(pPlayer));
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Name: nxplayer_cmd_pause
  *
@@ -0,0 +1,363 @@
+/****************************************************************************
+ * apps/system/perfcount/perfcount.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <semaphore.h>
+#include <sched.h>
+#include <time.h>
+#include <assert.h>
+#include <errno.h>
+
+#include "system/perfcount.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define PERF_CLOCK CLOCK_MONOTONIC
+#else
+#  define PERF_CLOCK CLOCK_REALTIME
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct perf_exphdr_s
+{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t nentries;
+  uint64_t time;
+};
+
+struct perf_expentry_s
+{
+  uint8_t type;
+  uint8_t namelen;
+  uint16_t nvalues;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The registered entries, in the order of registration.  The lock protects
+ * the list only, never the values.
+ */
+
+static FAR struct perf_entry_s *g_head;
+static FAR struct perf_entry_s *g_tail;
+static sem_t g_lock = SEM_INITIALIZER(1);
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void perf_lock(void)
+{
+  while (sem_wait(&g_lock) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+}
+
+static inline void perf_unlock(void)
+{
+  sem_post(&g_lock);
+}
+
+static bool perf_match(FAR const struct perf_entry_s *entry,
+                       FAR const char *prefix)
+{
+  return prefix == NULL ||
+         strncmp(entry->name, prefix, strlen(prefix)) == 0;
+}
+
+static int perf_write(int fd, FAR const void *buffer, size_t len)
+{
+  FAR const uint8_t *ptr = (FAR const uint8_t *)buffer;
+  ssize_t nwritten;
+
+  while (len > 0)
+    {
+      nwritten = write(fd, ptr, len);
+      if (nwritten < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          return -errno;
+        }
+
+      ptr += nwritten;
+      len -= nwritten;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: perf_register
+ ****************************************************************************/
+
+void perf_register(FAR struct perf_entry_s *entry)
+{
+  perf_lock();
+
+  if (entry->flink == NULL && entry != g_tail)
+    {
+      if (g_tail == NULL)
+        {
+          g_head = entry;
+        }
+      else
+        {
+          g_tail->flink = entry;
+        }
+
+      g_tail = entry;
+    }
+
+  perf_unlock();
+}
+
+/****************************************************************************
+ * Name: perf_sample
+ ****************************************************************************/
+
+void perf_sample(FAR struct perf_hist_s *hist, uint32_t value)
+{
+  int b;
+
+  /* Find the bucket: the number of significant bits of the value */
+
+#ifdef __GNUC__
+  b = value == 0 ? 0 : 32 - __builtin_clz(value);
+#else
+  for (b = 0; b < 32 && (value >> b) != 0; b++);
+#endif
+
+  if (b > CONFIG_SYSTEM_PERFCOUNT_NBUCKETS - 1)
+    {
+      b = CONFIG_SYSTEM_PERFCOUNT_NBUCKETS - 1;
+    }
+
+  /* The maximum is updated without synchronization: a concurrent larger
+   * sample may occasionally be overwritten by a smaller one.
+   */
+
+#ifdef CONFIG_SYSTEM_PERFCOUNT_ATOMIC
+  (void)__atomic_fetch_add(&hist->bucket[b], 1, __ATOMIC_RELAXED);
+  if (value > hist->max)
+    {
+      hist->max = value;
+    }
+#else
+  sched_lock();
+  hist->bucket[b]++;
+  if (value > hist->max)
+    {
+      hist->max = value;
+    }
+
+  sched_unlock();
+#endif
+}
+
+/****************************************************************************
+ * Name: perf_foreach
+ ****************************************************************************/
+
+int perf_foreach(FAR const char *prefix, perf_visitor_t visitor,
+                 FAR void *arg)
+{
+  FAR struct perf_entry_s *entry;
+  int ret = 0;
+
+  perf_lock();
+
+  for (entry = g_head; entry != NULL && ret == 0; entry = entry->flink)
+    {
+      if (perf_match(entry, prefix))
+        {
+          ret = visitor(entry, arg);
+        }
+    }
+
+  perf_unlock();
+  return ret;
+}
+
+/****************************************************************************
+ * Name: perf_reset
+ ****************************************************************************/
+
+void perf_reset(FAR const char *prefix)
+{
+  FAR struct perf_entry_s *entry;
+  FAR struct perf_hist_s *hist;
+
+  perf_lock();
+
+  for (entry = g_head; entry != NULL; entry = entry->flink)
+    {
+      if (!perf_match(entry, prefix))
+        {
+          continue;
+        }
+
+      if (entry->type == PERF_TYPE_COUNTER)
+        {
+          ((FAR struct perf_counter_s *)entry)->value = 0;
+        }
+      else
+        {
+          hist = (FAR struct perf_hist_s *)entry;
+          hist->max = 0;
+          memset((FAR void *)hist->bucket, 0, sizeof(hist->bucket));
+        }
+    }
+
+  perf_unlock();
+}
+
+/****************************************************************************
+ * Name: perf_export
+ ****************************************************************************/
+
+ssize_t perf_export(int fd, FAR const char *prefix)
+{
+  FAR struct perf_entry_s *entry;
+  FAR struct perf_hist_s *hist;
+  struct perf_exphdr_s hdr;
+  struct perf_expentry_s exp;
+  struct timespec ts;
+  uint32_t value;
+  ssize_t total;
+  size_t namelen;
+  int ret = OK;
+  int i;
+
+  perf_lock();
+
+  (void)clock_gettime(PERF_CLOCK, &ts);
+
+  hdr.magic    = PERF_EXPORT_MAGIC;
+  hdr.version  = PERF_EXPORT_VERSION;
+  hdr.nentries = 0;
+  hdr.time     = (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+
+  for (entry = g_head; entry != NULL; entry = entry->flink)
+    {
+      if (perf_match(entry, prefix))
+        {
+          hdr.nentries++;
+        }
+    }
+
+  ret   = perf_write(fd, &hdr, sizeof(hdr));
+  total = sizeof(hdr);
+
+  for (entry = g_head; entry != NULL && ret == OK; entry = entry->flink)
+    {
+      if (!perf_match(entry, prefix))
+        {
+          continue;
+        }
+
+      namelen = strlen(entry->name);
+      if (namelen > UINT8_MAX)
+        {
+          namelen = UINT8_MAX;
+        }
+
+      exp.type    = entry->type;
+      exp.namelen = namelen;
+      exp.nvalues = entry->nvalues;
+
+      ret = perf_write(fd, &exp, sizeof(exp));
+      if (ret == OK)
+        {
+          ret = perf_write(fd, entry->name, namelen);
+        }
+
+      if (entry->type == PERF_TYPE_COUNTER)
+        {
+          value = ((FAR struct perf_counter_s *)entry)->value;
+          if (ret == OK)
+            {
+              ret = perf_write(fd, &value, sizeof(value));
+            }
+        }
+      else
+        {
+          hist  = (FAR struct perf_hist_s *)entry;
+          value = hist->max;
+          if (ret == OK)
+            {
+              ret = perf_write(fd, &value, sizeof(value));
+            }
+
+          for (i = 0; i < CONFIG_SYSTEM_PERFCOUNT_NBUCKETS && ret == OK; i++)
+            {
+              value = hist->bucket[i];
+              ret   = perf_write(fd, &value, sizeof(value));
+            }
+        }
+
+      total += sizeof(exp) + namelen + entry->nvalues * sizeof(uint32_t);
+    }
+
+  perf_unlock();
+  return ret < 0 ? ret : total;
+}
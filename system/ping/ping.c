@@ -58,6 +58,8 @@
 
 #include <nuttx/net/icmp.h>
 
+#include "netutils/icmp_ping.h"
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -410,6 +412,90 @@ static void icmp_ping(FAR struct ping_info_s *info)
     }
 }
 
+/****************************************************************************
+ * Name: ping_msec
+ *
+ * Description:
+ *   Print a time in microseconds as milliseconds with three decimals.
+ *
+ ****************************************************************************/
+
+static void ping_msec(uint32_t usec)
+{
+  printf(" %4lu.%03lu", (unsigned long)(usec / 1000),
+         (unsigned long)(usec % 1000));
+}
+
+/****************************************************************************
+ * Name: ping_hosts
+ *
+ * Description:
+ *   Ping several hosts in parallel and print a table of the loss and round
+ *   trip times to each, followed by a histogram of all round trips.
+ *
+ ****************************************************************************/
+
+static int ping_hosts(FAR struct icmp_pinghost_s *hosts, int nhosts,
+                      FAR struct ping_info_s *info)
+{
+  uint32_t hist[ICMP_PING_NBUCKETS];
+  unsigned int loss;
+  int ret;
+  int i;
+  int j;
+
+  printf("PING %d hosts, %u requests each, %d bytes of data\n",
+         nhosts, info->count, ICMP_PING_DATALEN);
+
+  ret = icmp_pinghosts(hosts, nhosts, info->count, info->delay,
+                       info->delay);
+  if (ret < 0)
+    {
+      fprintf(stderr, "ERROR: icmp_pinghosts failed: %d\n", ret);
+      return ret;
+    }
+
+  printf("%-15s  Sent  Recv  Loss      Min      Avg      Max   Stddev\n",
+         "Host");
+
+  memset(hist, 0, sizeof(hist));
+  for (i = 0; i < nhosts; i++)
+    {
+      FAR struct icmp_pinghost_s *host = &hosts[i];
+
+      loss = (100 * (host->nsent - host->nrecvd) + (host->nsent >> 1)) /
+             host->nsent;
+
+      printf("%-15s %5u %5u %4u%%", inet_ntoa(host->addr),
+             host->nsent, host->nrecvd, loss);
+
+      if (host->nrecvd > 0)
+        {
+          ping_msec(host->min);
+          ping_msec(icmp_pingavg(host));
+          ping_msec(host->max);
+          ping_msec(icmp_pingstddev(host));
+        }
+
+      putchar('\n');
+
+      for (j = 0; j < ICMP_PING_NBUCKETS; j++)
+        {
+          hist[j] += host->hist[j];
+        }
+    }
+
+  printf("Round trips (ms): <1:%lu", (unsigned long)hist[0]);
+  for (j = 1; j < ICMP_PING_NBUCKETS - 1; j++)
+    {
+      printf(" %u-%u:%lu", 1u << (j - 1), 1u << j, (unsigned long)hist[j]);
+    }
+
+  printf(" >=%u:%lu\n", 1u << (ICMP_PING_NBUCKETS - 2),
+         (unsigned long)hist[ICMP_PING_NBUCKETS - 1]);
+  return OK;
+}
+
 /****************************************************************************
  * Name: show_usage
  ****************************************************************************/
@@ -418,16 +504,20 @@ static void show_usage(FAR const char *progname, int exitcode) noreturn_function
 static void show_usage(FAR const char *progname, int exitcode)
 {
 #if defined(CONFIG_LIBC_NETDB) && defined(CONFIG_NETDB_DNSCLIENT)
-  printf("\nUsage: %s [-c <count>] [-i <interval>] <hostname>\n", progname);
+  printf("\nUsage: %s [-c <count>] [-i <interval>] <hostname> [<hostname>...]\n",
+         progname);
   printf("       %s -h\n", progname);
   printf("\nWhere:\n");
-  printf("  <hostname> is either an IPv6 address or the name of the remote host\n");
-  printf("   that is requested the ICMPv6 ECHO reply.\n");
+  printf("  <hostname> is either an IPv4 address or the name of the remote host\n");
+  printf("   that is requested the ICMP ECHO reply.  Several hosts are pinged\n");
+  printf("   in parallel and summarized in a table.\n");
 #else
-  printf("\nUsage: %s [-c <count>] [-i <interval>] <ip-address>\n", progname);
+  printf("\nUsage: %s [-c <count>] [-i <interval>] <ip-address> [<ip-address>...]\n",
+         progname);
   printf("       %s -h\n", progname);
   printf("\nWhere:\n");
   printf("  <ip-address> is the IPv4 address request the ICMP ECHO reply.\n");
+  printf("   Several addresses are pinged in parallel and summarized in a table.\n");
 #endif
   printf("  -c <count> determines the number of pings.  Default %u.\n",
          ICMP_NPINGS);
@@ -524,6 +614,42 @@ int ping_main(int argc, char **argv)
       show_usage(argv[0], EXIT_FAILURE);
     }
 
+  /* With several hosts, ping them all in parallel */
+
+  if (argc - optind > 1)
+    {
+      FAR struct icmp_pinghost_s *hosts;
+      int nhosts = argc - optind;
+      int ret;
+      int i;
+
+      hosts = (FAR struct icmp_pinghost_s *)
+        zalloc(nhosts * sizeof(struct icmp_pinghost_s));
+      if (hosts == NULL)
+        {
+          fprintf(stderr, "ERROR: Failed to allocate memory\n");
+          goto errout_with_info;
+        }
+
+      for (i = 0; i < nhosts; i++)
+        {
+          if (ping_gethostip(argv[optind + i], info) < 0)
+            {
+              fprintf(stderr, "ERROR: ping_gethostip(%s) failed\n",
+                      argv[optind + i]);
+              free(hosts);
+              goto errout_with_info;
+            }
+
+          hosts[i].addr = info->dest;
+        }
+
+      ret = ping_hosts(hosts, nhosts, info);
+      free(hosts);
+      free(info);
+      return ret < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
   if (ping_gethostip(argv[optind], info) < 0)
     {
       fprintf(stderr, "ERROR: ping_gethostip(%s) failed\n", argv[optind]);
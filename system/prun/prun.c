@@ -39,8 +39,10 @@
 
 #include <nuttx/config.h>
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 #include <errno.h>
 #include <debug.h>
 
@@ -75,12 +77,18 @@
 int prun(FAR char *exepath, size_t varsize, size_t strsize)
 {
   FAR struct pexec_s *st;
+#ifdef CONFIG_SYSTEM_PRUN_STATS
+  struct timespec start;
+  struct timespec end;
+  unsigned long ninsn = 0;
+  unsigned long usec;
+#endif
   int errcode;
   int ret = OK;
 
   /* Load the POFF file into memory */
 
-  st = pload(exepath, varsize, varsize);
+  st = pload(exepath, varsize, strsize);
   if (!st)
     {
       berr("ERROR: Could not load %s\n", exepath);
@@ -89,18 +97,34 @@ int prun(FAR char *exepath, size_t varsize, size_t strsize)
 
   binfo("Loaded %s\n", exepath);
 
-  /* Execute the P-Code program until a stopping condition occurs */
+  /* Execute the P-Code program until a stopping condition occurs.  This
+   * loop runs once per P-Code instruction, so it is kept as small as
+   * possible.
+   */
 
-  for (;;)
+#ifdef CONFIG_SYSTEM_PRUN_STATS
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  do
     {
-      /* Execute the instruction; Check for exceptional conditions */
-
       errcode = pexec(st);
-      if (errcode != eNOERROR)
-        {
-          break;
-        }
+      ninsn++;
     }
+  while (errcode == eNOERROR);
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  usec = (end.tv_sec - start.tv_sec) * 1000000 +
+         (end.tv_nsec - start.tv_nsec) / 1000;
+  printf("prun: %lu instructions in %lu us", ninsn, usec);
+  if (usec > 0)
+    {
+      printf(", %lu instructions/s",
+             (unsigned long)((uint64_t)ninsn * 1000000 / usec));
+    }
+
+  printf("\n");
+#else
+  while ((errcode = pexec(st)) == eNOERROR);
+#endif
 
   if (errcode != eEXIT)
     {
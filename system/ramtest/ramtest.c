@@ -46,7 +46,9 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
+#include <time.h>
 #include <sched.h>
 #include <syslog.h>
 #include <errno.h>
@@ -61,6 +63,37 @@
 
 #define RAMTEST_PREFIX "RAMTest: "
 
+#ifndef CONFIG_SYSTEM_RAMTEST_BENCHTIME
+#  define CONFIG_SYSTEM_RAMTEST_BENCHTIME 100
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define RAMTEST_CLOCK CLOCK_MONOTONIC
+#else
+#  define RAMTEST_CLOCK CLOCK_REALTIME
+#endif
+
+/* The stride of the random access latency test.  It should be at least
+ * the size of a cache line, so that every access misses the cache.
+ */
+
+#define RAMTEST_LINESIZE 32
+
+/* Benchmark access widths.  The burst width lets the compiler and the C
+ * library use the widest accesses they can (memset(), memcpy(), unrolled
+ * loops), which is what most buffers in the region will see.
+ */
+
+#define RAMTEST_BURST    0
+#define RAMTEST_NWIDTHS  4
+
+/* Benchmark operations */
+
+#define RAMTEST_READ     0
+#define RAMTEST_WRITE    1
+#define RAMTEST_COPY     2
+#define RAMTEST_NOPS     3
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -72,12 +105,36 @@ struct ramtest_s
   size_t size;
   size_t nxfrs;
   uint32_t mask;
+  bool bench;
+  bool compare;
+};
+
+/* Results of the benchmark of one region, bandwidths in 0.1 MB/s */
+
+struct ramtest_bench_s
+{
+  uint32_t bandwidth[RAMTEST_NWIDTHS][RAMTEST_NOPS];
+  uint32_t latency;    /* Nanoseconds per dependent random read */
 };
 
 /****************************************************************************
  * Private Data
  ****************************************************************************/
 
+static const uint8_t g_widths[RAMTEST_NWIDTHS] =
+{
+  8, 16, 32, RAMTEST_BURST
+};
+
+static FAR const char *g_opnames[RAMTEST_NOPS] =
+{
+  "read", "write", "copy"
+};
+
+/* Keeps the compiler from discarding the benchmark reads */
+
+static volatile uint32_t g_sink;
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -88,13 +145,17 @@ struct ramtest_s
 
 static void show_usage(FAR const char *progname, int exitcode)
 {
-  printf("\nUsage: %s [-w|h|b] <hex-address> <decimal-size>\n", progname);
+  printf("\nUsage: %s [-w|h|b] [-s [-c]] <hex-address> <decimal-size>\n",
+         progname);
   printf("\nWhere:\n");
   printf("  <hex-address> starting address of the test.\n");
   printf("  <decimal-size> number of memory locations (in bytes).\n");
   printf("  -w Sets the width of a memory location to 32-bits.\n");
   printf("  -h Sets the width of a memory location to 16-bits (default).\n");
   printf("  -b Sets the width of a memory location to 8-bits.\n");
+  printf("  -s Measure the read, write and copy bandwidth at every width "
+         "and the\n     random access latency instead of testing.\n");
+  printf("  -c With -s, measure a heap buffer of the same size as well.\n");
   exit(exitcode);
 }
 
@@ -108,9 +169,17 @@ static void parse_commandline(int argc, char **argv,
   FAR char *ptr;
   int option;
 
-  while ((option = getopt(argc, argv, "whb")) != ERROR)
+  while ((option = getopt(argc, argv, "whbsc")) != ERROR)
     {
-      if (option == 'w')
+      if (option == 's')
+        {
+          info->bench = true;
+        }
+      else if (option == 'c')
+        {
+          info->compare = true;
+        }
+      else if (option == 'w')
         {
           info->width = 32;
           info->mask  = 0xffffffff;
@@ -552,6 +621,360 @@ static void addr_in_addr(FAR struct ramtest_s *info)
   verify_addrinaddr(info);
 }
 
+/****************************************************************************
+ * Name: ramtest_nsec
+ ****************************************************************************/
+
+static uint64_t ramtest_nsec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(RAMTEST_CLOCK, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/****************************************************************************
+ * Name: ramtest_read
+ ****************************************************************************/
+
+static void ramtest_read(uintptr_t start, size_t size, int width)
+{
+  uint32_t sum = 0;
+  size_t i;
+
+  if (width == 32)
+    {
+      FAR volatile uint32_t *ptr = (FAR volatile uint32_t *)start;
+      for (i = 0; i < size >> 2; i++)
+        {
+          sum += ptr[i];
+        }
+    }
+  else if (width == 16)
+    {
+      FAR volatile uint16_t *ptr = (FAR volatile uint16_t *)start;
+      for (i = 0; i < size >> 1; i++)
+        {
+          sum += ptr[i];
+        }
+    }
+  else if (width == 8)
+    {
+      FAR volatile uint8_t *ptr = (FAR volatile uint8_t *)start;
+      for (i = 0; i < size; i++)
+        {
+          sum += ptr[i];
+        }
+    }
+  else
+    {
+      FAR const uint32_t *ptr = (FAR const uint32_t *)start;
+      for (i = 0; i + 8 <= size >> 2; i += 8)
+        {
+          sum += ptr[i]     + ptr[i + 1] + ptr[i + 2] + ptr[i + 3] +
+                 ptr[i + 4] + ptr[i + 5] + ptr[i + 6] + ptr[i + 7];
+        }
+    }
+
+  g_sink = sum;
+}
+
+/****************************************************************************
+ * Name: ramtest_write
+ ****************************************************************************/
+
+static void ramtest_write(uintptr_t start, size_t size, int width)
+{
+  size_t i;
+
+  if (width == 32)
+    {
+      FAR volatile uint32_t *ptr = (FAR volatile uint32_t *)start;
+      for (i = 0; i < size >> 2; i++)
+        {
+          ptr[i] = 0x5a5a5a5a;
+        }
+    }
+  else if (width == 16)
+    {
+      FAR volatile uint16_t *ptr = (FAR volatile uint16_t *)start;
+      for (i = 0; i < size >> 1; i++)
+        {
+          ptr[i] = 0x5a5a;
+        }
+    }
+  else if (width == 8)
+    {
+      FAR volatile uint8_t *ptr = (FAR volatile uint8_t *)start;
+      for (i = 0; i < size; i++)
+        {
+          ptr[i] = 0x5a;
+        }
+    }
+  else
+    {
+      memset((FAR void *)start, 0x5a, size);
+    }
+}
+
+/****************************************************************************
+ * Name: ramtest_copy
+ *
+ * Description:
+ *   Copy the lower half of the region to the upper half.
+ *
+ ****************************************************************************/
+
+static void ramtest_copy(uintptr_t start, size_t size, int width)
+{
+  size_t half = (size >> 1) & ~3;
+  size_t i;
+
+  if (width == 32)
+    {
+      FAR volatile uint32_t *src = (FAR volatile uint32_t *)start;
+      FAR volatile uint32_t *dest = (FAR volatile uint32_t *)(start + half);
+      for (i = 0; i < half >> 2; i++)
+        {
+          dest[i] = src[i];
+        }
+    }
+  else if (width == 16)
+    {
+      FAR volatile uint16_t *src = (FAR volatile uint16_t *)start;
+      FAR volatile uint16_t *dest = (FAR volatile uint16_t *)(start + half);
+      for (i = 0; i < half >> 1; i++)
+        {
+          dest[i] = src[i];
+        }
+    }
+  else if (width == 8)
+    {
+      FAR volatile uint8_t *src = (FAR volatile uint8_t *)start;
+      FAR volatile uint8_t *dest = (FAR volatile uint8_t *)(start + half);
+      for (i = 0; i < half; i++)
+        {
+          dest[i] = src[i];
+        }
+    }
+  else
+    {
+      memcpy((FAR void *)(start + half), (FAR const void *)start, half);
+    }
+}
+
+/****************************************************************************
+ * Name: ramtest_bandwidth
+ *
+ * Description:
+ *   Repeat an operation over the region for at least
+ *   CONFIG_SYSTEM_RAMTEST_BENCHTIME milliseconds and return the bandwidth
+ *   in units of 0.1 MB/s.
+ *
+ ****************************************************************************/
+
+static uint32_t ramtest_bandwidth(uintptr_t start, size_t size, int op,
+                                  int width)
+{
+  uint64_t nbytes = 0;
+  uint64_t begin;
+  uint64_t elapsed;
+
+  begin = ramtest_nsec();
+  do
+    {
+      switch (op)
+        {
+          case RAMTEST_READ:
+            ramtest_read(start, size, width);
+            nbytes += size;
+            break;
+
+          case RAMTEST_WRITE:
+            ramtest_write(start, size, width);
+            nbytes += size;
+            break;
+
+          default:
+            ramtest_copy(start, size, width);
+            nbytes += (size >> 1) & ~3;
+            break;
+        }
+
+      elapsed = ramtest_nsec() - begin;
+    }
+  while (elapsed < CONFIG_SYSTEM_RAMTEST_BENCHTIME * 1000000ull);
+
+  return (uint32_t)(nbytes * 10000 / elapsed);
+}
+
+/****************************************************************************
+ * Name: ramtest_latency
+ *
+ * Description:
+ *   Link one word of every line of the region into a single random cycle
+ *   (Sattolo's algorithm), and follow the links.  Every read depends on
+ *   the previous one, so the time per read is the access latency.
+ *
+ ****************************************************************************/
+
+static uint32_t ramtest_latency(uintptr_t start, size_t size)
+{
+  FAR volatile uint32_t *line = (FAR volatile uint32_t *)start;
+  uint32_t nlines = size / RAMTEST_LINESIZE;
+  uint32_t stride = RAMTEST_LINESIZE / sizeof(uint32_t);
+  uint32_t rand = 0x12345678;
+  uint32_t next;
+  uint32_t tmp;
+  uint32_t i;
+  uint32_t j;
+  uint64_t nreads = 0;
+  uint64_t begin;
+  uint64_t elapsed;
+
+  if (nlines < 2)
+    {
+      return 0;
+    }
+
+  for (i = 0; i < nlines; i++)
+    {
+      line[i * stride] = i;
+    }
+
+  for (i = nlines - 1; i > 0; i--)
+    {
+      rand ^= rand << 13;
+      rand ^= rand >> 17;
+      rand ^= rand << 5;
+      j = rand % i;
+
+      tmp                = line[i * stride];
+      line[i * stride]   = line[j * stride];
+      line[j * stride]   = tmp;
+    }
+
+  next  = 0;
+  begin = ramtest_nsec();
+  do
+    {
+      for (i = 0; i < nlines; i++)
+        {
+          next = line[next * stride];
+        }
+
+      nreads += nlines;
+      elapsed = ramtest_nsec() - begin;
+    }
+  while (elapsed < CONFIG_SYSTEM_RAMTEST_BENCHTIME * 1000000ull);
+
+  g_sink = next;
+  return (uint32_t)(elapsed / nreads);
+}
+
+/****************************************************************************
+ * Name: ramtest_bench
+ ****************************************************************************/
+
+static void ramtest_bench(uintptr_t start, size_t size,
+                          FAR struct ramtest_bench_s *result)
+{
+  int width;
+  int op;
+
+  for (width = 0; width < RAMTEST_NWIDTHS; width++)
+    {
+      for (op = 0; op < RAMTEST_NOPS; op++)
+        {
+          result->bandwidth[width][op] =
+            ramtest_bandwidth(start, size, op, g_widths[width]);
+        }
+    }
+
+  result->latency = ramtest_latency(start, size);
+}
+
+/****************************************************************************
+ * Name: speed_test
+ *
+ * Description:
+ *   Benchmark the region and, optionally, a heap buffer of the same size
+ *   for comparison.  A region that fits into the data cache measures the
+ *   cache.
+ *
+ ****************************************************************************/
+
+static void speed_test(FAR struct ramtest_s *info)
+{
+  struct ramtest_bench_s target;
+  struct ramtest_bench_s heap;
+  FAR void *buffer;
+  bool compared = false;
+  int width;
+  int op;
+
+  printf(RAMTEST_PREFIX "Speed test: %08lx %lu\n",
+         (unsigned long)info->start, (unsigned long)info->size);
+
+  ramtest_bench(info->start, info->size, &target);
+
+  if (info->compare)
+    {
+      buffer = malloc(info->size);
+      if (buffer == NULL)
+        {
+          printf(RAMTEST_PREFIX "ERROR: No heap buffer of %lu bytes\n",
+                 (unsigned long)info->size);
+        }
+      else
+        {
+          printf(RAMTEST_PREFIX "Heap buffer: %p\n", buffer);
+          ramtest_bench((uintptr_t)buffer, info->size, &heap);
+          free(buffer);
+          compared = true;
+        }
+    }
+
+  printf("%-6s %-6s %12s%s\n", "Width", "Op", "MB/s",
+         compared ? "    Heap MB/s" : "");
+
+  for (width = 0; width < RAMTEST_NWIDTHS; width++)
+    {
+      for (op = 0; op < RAMTEST_NOPS; op++)
+        {
+          if (g_widths[width] == RAMTEST_BURST)
+            {
+              printf("%-6s ", "burst");
+            }
+          else
+            {
+              printf("%-6d ", g_widths[width]);
+            }
+
+          printf("%-6s %10lu.%lu", g_opnames[op],
+                 (unsigned long)target.bandwidth[width][op] / 10,
+                 (unsigned long)target.bandwidth[width][op] % 10);
+
+          if (compared)
+            {
+              printf(" %10lu.%lu",
+                     (unsigned long)heap.bandwidth[width][op] / 10,
+                     (unsigned long)heap.bandwidth[width][op] % 10);
+            }
+
+          printf("\n");
+        }
+    }
+
+  printf("Random read latency: %lu ns", (unsigned long)target.latency);
+  if (compared)
+    {
+      printf(", heap %lu ns", (unsigned long)heap.latency);
+    }
+
+  printf("\n");
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -566,10 +989,18 @@ int ramtest_main(int argc, char **argv)
 
   /* Setup defaults and parse the command line */
 
-  info.width = 16;
-  info.mask  = 0x0000ffff;
+  info.width   = 16;
+  info.mask    = 0x0000ffff;
+  info.bench   = false;
+  info.compare = false;
   parse_commandline(argc, argv, &info);
 
+  if (info.bench)
+    {
+      speed_test(&info);
+      return 0;
+    }
+
   /* Perform the memory tests */
 
   marching_ones(&info);
@@ -42,6 +42,10 @@
 #include <stdbool.h>
 #include <string.h>
 #include <ctype.h>
+#include <limits.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
 #include <errno.h>
 #include <assert.h>
 #include <debug.h>
@@ -50,87 +54,904 @@
 #include <nuttx/vt100.h>
 #include <nuttx/binfmt/builtin.h>
 
+#ifdef CONFIG_BUILTIN
+#  include "builtin/builtin.h"
+#endif
+
 #include "system/readline.h"
 #include "readline.h"
 
 /****************************************************************************
- * Private Data
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_READLINE_CMD_HISTORY
+/* The size of the command line history in bytes.  Older configurations
+ * describe the history as a number of fixed size lines.
+ */
+
+#  ifndef CONFIG_READLINE_CMD_HISTORY_SIZE
+#    if defined(CONFIG_READLINE_CMD_HISTORY_LEN) && \
+        defined(CONFIG_READLINE_CMD_HISTORY_LINELEN)
+#      define CONFIG_READLINE_CMD_HISTORY_SIZE \
+         (CONFIG_READLINE_CMD_HISTORY_LEN * CONFIG_READLINE_CMD_HISTORY_LINELEN)
+#    else
+#      define CONFIG_READLINE_CMD_HISTORY_SIZE 1024
+#    endif
+#  endif
+
+#  if CONFIG_NFILE_DESCRIPTORS <= 0
+#    undef CONFIG_READLINE_CMD_HISTORY_PERSIST
+#  endif
+
+#  ifndef CONFIG_READLINE_CMD_HISTORY_PATH
+#    define CONFIG_READLINE_CMD_HISTORY_PATH "/mnt/.history"
+#  endif
+
+/* The longest string for the reverse search */
+
+#  define RL_SEARCH_MAX 32
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+#ifdef CONFIG_READLINE_TABCOMPLETION
+/* The state of one tab-completion */
+
+struct rl_tab_s
+{
+  FAR char *path;                /* Beginning of the word in the line */
+  FAR char *word;                /* Part of the word that is completed */
+  int wordlen;                   /* Number of characters typed in word */
+  int maxlen;                    /* Room for the completion in the line */
+  int complen;                   /* Length common to all matches */
+  int nmatches;                  /* Number of matches */
+  bool isdir;                    /* The first match is a directory */
+};
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+/* <esc>[K is the VT100 command erases to the end of the line. */
+
+static const char g_erasetoeol[] = VT100_CLEAREOL;
+
+#ifdef CONFIG_READLINE_TABCOMPLETION
+/* Prompt string to present at the beginning of the line */
+
+static FAR const char *g_readline_prompt = NULL;
+
+#ifdef CONFIG_READLINE_HAVE_EXTMATCH
+static FAR const struct extmatch_vtable_s *g_extmatch_vtbl = NULL;
+#endif
+#endif /* CONFIG_READLINE_TABCOMPLETION */
+
+#ifdef CONFIG_READLINE_CMD_HISTORY
+/* Nghia Ho: command history
+ *
+ * The history is a ring buffer of NUL-terminated lines, oldest first.  A
+ * line is never split at the end of the buffer:  If it does not fit, the
+ * lines at the end stop at g_hist_wrap and the new line is stored at the
+ * beginning of the buffer, replacing the oldest lines.
+ *
+ * g_hist_buf[]   The ring buffer
+ * g_hist_tail    Offset of the oldest line
+ * g_hist_head    Offset just past the most recent line
+ * g_hist_wrap    End of the lines at the end of the buffer while wrapped
+ * g_hist_wrapped True if the lines continue at the beginning of the buffer
+ * g_hist_count   Number of lines in the history
+ * g_hist_loaded  True if the persistent history has been read
+ */
+
+static char g_hist_buf[CONFIG_READLINE_CMD_HISTORY_SIZE];
+static int g_hist_tail;
+static int g_hist_head;
+static int g_hist_wrap;
+static bool g_hist_wrapped;
+static int g_hist_count;
+#ifdef CONFIG_READLINE_CMD_HISTORY_PERSIST
+static bool g_hist_loaded;
+#endif
+#endif /* CONFIG_READLINE_CMD_HISTORY */
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: rl_erase
+ *
+ * Description:
+ *   Move the cursor back over the last 'n' characters that were output on
+ *   the current line and erase them.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_READLINE_CMD_HISTORY
+static void rl_erase(FAR struct rl_common_s *vtbl, int n)
+{
+  char seq[16];
+  int len;
+
+  if (n > 0)
+    {
+      /* <esc>[<n>D moves the cursor <n> columns to the left */
+
+      len = snprintf(seq, sizeof(seq), "\033[%dD", n);
+      RL_WRITE(vtbl, seq, len);
+      RL_WRITE(vtbl, g_erasetoeol, sizeof(g_erasetoeol));
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: hist_start
+ *
+ * Description:
+ *   Return the offset of the history line that ends just before 'end'.  The
+ *   line does not begin before 'lower'.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_READLINE_CMD_HISTORY
+static int hist_start(int end, int lower)
+{
+  int i = end - 1;
+
+  while (i > lower && g_hist_buf[i - 1] != '\0')
+    {
+      i--;
+    }
+
+  return i;
+}
+#endif
+
+/****************************************************************************
+ * Name: hist_newest, hist_prev, and hist_next
+ *
+ * Description:
+ *   Navigate the history ring.  These return the offset of the most
+ *   recent line, of the line before or after the one at 'pos', or -1 if
+ *   there is no such line.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_READLINE_CMD_HISTORY
+static int hist_newest(void)
+{
+  if (g_hist_count == 0)
+    {
+      return -1;
+    }
+
+  /* While wrapped, the most recent line is always at the beginning of the
+   * buffer.
+   */
+
+  return hist_start(g_hist_head, g_hist_wrapped ? 0 : g_hist_tail);
+}
+
+static int hist_prev(int pos)
+{
+  if (pos < 0 || pos == g_hist_tail)
+    {
+      return -1;
+    }
+
+  if (g_hist_wrapped)
+    {
+      if (pos == 0)
+        {
+          return hist_start(g_hist_wrap, g_hist_tail);
+        }
+
+      return hist_start(pos, pos < g_hist_tail ? 0 : g_hist_tail);
+    }
+
+  return hist_start(pos, g_hist_tail);
+}
+
+static int hist_next(int pos)
+{
+  if (pos < 0)
+    {
+      return -1;
+    }
+
+  pos += strlen(&g_hist_buf[pos]) + 1;
+  if (g_hist_wrapped && pos == g_hist_wrap)
+    {
+      pos = 0;
+    }
+
+  return pos == g_hist_head ? -1 : pos;
+}
+#endif
+
+/****************************************************************************
+ * Name: hist_evict
+ *
+ * Description:
+ *   Discard the oldest line in the history.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_READLINE_CMD_HISTORY
+static void hist_evict(void)
+{
+  g_hist_tail += strlen(&g_hist_buf[g_hist_tail]) + 1;
+  g_hist_count--;
+
+  if (g_hist_wrapped && g_hist_tail >= g_hist_wrap)
+    {
+      g_hist_tail    = 0;
+      g_hist_wrapped = false;
+    }
+
+  if (g_hist_count == 0)
+    {
+      g_hist_head    = 0;
+      g_hist_tail    = 0;
+      g_hist_wrapped = false;
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: hist_add
+ *
+ * Description:
+ *   Add a line to the in-memory history, discarding the oldest lines as
+ *   necessary to make room for it.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_READLINE_CMD_HISTORY
+static void hist_add(FAR const char *line, int len)
+{
+  int need;
+
+  if (len > CONFIG_READLINE_CMD_HISTORY_SIZE - 1)
+    {
+      len = CONFIG_READLINE_CMD_HISTORY_SIZE - 1;
+    }
+
+  need = len + 1;
+
+  for (; ; )
+    {
+      if (!g_hist_wrapped)
+        {
+          if (g_hist_head + need <= CONFIG_READLINE_CMD_HISTORY_SIZE)
+            {
+              break;
+            }
+
+          /* The line does not fit at the end.  Continue at the beginning
+           * of the buffer.
+           */
+
+          g_hist_wrap    = g_hist_head;
+          g_hist_head    = 0;
+          g_hist_wrapped = true;
+        }
+
+      if (g_hist_head + need <= g_hist_tail)
+        {
+          break;
+        }
+
+      hist_evict();
+    }
+
+  memcpy(&g_hist_buf[g_hist_head], line, len);
+  g_hist_buf[g_hist_head + len] = '\0';
+  g_hist_head += need;
+  g_hist_count++;
+}
+#endif
+
+/****************************************************************************
+ * Name: hist_rewrite
+ *
+ * Description:
+ *   Replace the contents of the history file with the lines in the ring
+ *   buffer, oldest first.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_READLINE_CMD_HISTORY_PERSIST
+static void hist_rewrite(void)
+{
+  FAR const char *line;
+  int pos;
+  int fd;
+  int i;
+
+  fd = open(CONFIG_READLINE_CMD_HISTORY_PATH,
+            O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (fd < 0)
+    {
+      return;
+    }
+
+  pos = g_hist_tail;
+  for (i = 0; i < g_hist_count; i++)
+    {
+      if (g_hist_wrapped && pos >= g_hist_wrap)
+        {
+          pos = 0;
+        }
+
+      line = &g_hist_buf[pos];
+      (void)write(fd, line, strlen(line));
+      (void)write(fd, "\n", 1);
+      pos += strlen(line) + 1;
+    }
+
+  (void)close(fd);
+}
+#endif
+
+/****************************************************************************
+ * Name: hist_load
+ *
+ * Description:
+ *   Read the persistent history.  This is deferred until the history is
+ *   first used.  Only the end of the file that fits into the ring buffer
+ *   is read, directly into the ring buffer.  A file that has grown to
+ *   more than twice that size is rewritten with just those lines.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_READLINE_CMD_HISTORY_PERSIST
+static void hist_load(void)
+{
+  ssize_t nread;
+  off_t size;
+  int total;
+  int start;
+  int fd;
+  int i;
+
+  g_hist_loaded = true;
+
+  fd = open(CONFIG_READLINE_CMD_HISTORY_PATH, O_RDONLY);
+  if (fd < 0)
+    {
+      return;
+    }
+
+  size  = lseek(fd, 0, SEEK_END);
+  start = 0;
+
+  if (size > CONFIG_READLINE_CMD_HISTORY_SIZE)
+    {
+      (void)lseek(fd, size - CONFIG_READLINE_CMD_HISTORY_SIZE, SEEK_SET);
+    }
+  else
+    {
+      (void)lseek(fd, 0, SEEK_SET);
+    }
+
+  total = 0;
+  while (total < CONFIG_READLINE_CMD_HISTORY_SIZE)
+    {
+      nread = read(fd, &g_hist_buf[total],
+                   CONFIG_READLINE_CMD_HISTORY_SIZE - total);
+      if (nread < 0 && errno == EINTR)
+        {
+          continue;
+        }
+      else if (nread <= 0)
+        {
+          break;
+        }
+
+      total += nread;
+    }
+
+  (void)close(fd);
+
+  /* Drop an incomplete line at the end and, if the beginning of the file
+   * was skipped, the first (possibly partial) line.
+   */
+
+  while (total > 0 && g_hist_buf[total - 1] != '\n')
+    {
+      total--;
+    }
+
+  if (size > CONFIG_READLINE_CMD_HISTORY_SIZE)
+    {
+      while (start < total && g_hist_buf[start++] != '\n');
+    }
+
+  /* Each newline becomes the NUL terminator of a line */
+
+  g_hist_count = 0;
+  for (i = start; i < total; i++)
+    {
+      if (g_hist_buf[i] == '\n')
+        {
+          g_hist_buf[i] = '\0';
+          g_hist_count++;
+        }
+    }
+
+  g_hist_tail    = g_hist_count > 0 ? start : 0;
+  g_hist_head    = g_hist_count > 0 ? total : 0;
+  g_hist_wrapped = false;
+
+  if (size > 2 * CONFIG_READLINE_CMD_HISTORY_SIZE)
+    {
+      hist_rewrite();
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: hist_save
+ *
+ * Description:
+ *   Add a line that was entered to the history.  'line' includes the
+ *   terminating newline.  A line that repeats the most recent one is not
+ *   saved.  Like on loading, a history file that has grown to more than
+ *   twice the size of the ring buffer is rewritten with the lines that it
+ *   holds.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_READLINE_CMD_HISTORY
+static void hist_save(FAR const char *line, int len)
+{
+  int newest;
+#ifdef CONFIG_READLINE_CMD_HISTORY_PERSIST
+  off_t size;
+  int fd;
+
+  if (!g_hist_loaded)
+    {
+      hist_load();
+    }
+#endif
+
+  newest = hist_newest();
+  if (newest >= 0 && strncmp(&g_hist_buf[newest], line, len - 1) == 0 &&
+      g_hist_buf[newest + len - 1] == '\0')
+    {
+      return;
+    }
+
+  hist_add(line, len - 1);
+
+#ifdef CONFIG_READLINE_CMD_HISTORY_PERSIST
+  /* The line is appended to the history file.  Once in a while, when the
+   * file has grown too long, it is cut back to the lines in the ring.
+   */
+
+  fd = open(CONFIG_READLINE_CMD_HISTORY_PATH,
+            O_WRONLY | O_CREAT | O_APPEND, 0666);
+  if (fd >= 0)
+    {
+      (void)write(fd, line, len);
+      size = lseek(fd, 0, SEEK_END);
+      (void)close(fd);
+
+      if (size > 2 * CONFIG_READLINE_CMD_HISTORY_SIZE)
+        {
+          hist_rewrite();
+        }
+    }
+#endif
+}
+#endif
+
+/****************************************************************************
+ * Name: hist_setline
+ *
+ * Description:
+ *   Replace the line being edited with the history line at 'pos' or with
+ *   an empty line if 'pos' is negative.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_READLINE_CMD_HISTORY
+static void hist_setline(FAR struct rl_common_s *vtbl, FAR char *buf,
+                         int buflen, FAR int *nch, int pos)
+{
+  int len = 0;
+
+  rl_erase(vtbl, *nch);
+
+  if (pos >= 0)
+    {
+      len = strlen(&g_hist_buf[pos]);
+      if (len > buflen - 2)
+        {
+          len = buflen - 2;
+        }
+
+      memcpy(buf, &g_hist_buf[pos], len);
+      if (len > 0)
+        {
+          RL_WRITE(vtbl, buf, len);
+        }
+    }
+
+  *nch = len;
+}
+#endif
+
+/****************************************************************************
+ * Name: hist_find
+ *
+ * Description:
+ *   Search backward from the history line at 'pos' for a line that
+ *   contains 'query'.  The lines are searched in place.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_READLINE_CMD_HISTORY
+static int hist_find(int pos, FAR const char *query)
+{
+  for (; pos >= 0; pos = hist_prev(pos))
+    {
+      if (strstr(&g_hist_buf[pos], query) != NULL)
+        {
+          return pos;
+        }
+    }
+
+  return -1;
+}
+#endif
+
+/****************************************************************************
+ * Name: hist_search
+ *
+ * Description:
+ *   Incremental reverse search (Ctrl-R).  Each printable character extends
+ *   the search string, Ctrl-R finds the next older match, and backspace
+ *   shortens the search string.  The matching line is shown directly from
+ *   the history buffer and is only copied into the line when the search
+ *   ends.  Ctrl-G abandons the search.
+ *
+ * Returned Value:
+ *   The key that ended the search.  The caller handles it as usual so that,
+ *   for example, Enter runs the line that was found.  Zero is returned
+ *   if the key was consumed.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_READLINE_CMD_HISTORY
+static int hist_search(FAR struct rl_common_s *vtbl, FAR char *buf,
+                       int buflen, FAR int *nch, FAR int *pos)
+{
+  static const char label[]  = "(reverse-i-search)`";
+  static const char flabel[] = "(failed reverse-i-search)`";
+  char query[RL_SEARCH_MAX + 1];
+  bool failed = false;
+  int match = -1;
+  int nshown;
+  int qlen = 0;
+  int next;
+  int ch;
+
+#ifdef CONFIG_READLINE_CMD_HISTORY_PERSIST
+  if (!g_hist_loaded)
+    {
+      hist_load();
+    }
+#endif
+
+  query[0] = '\0';
+  rl_erase(vtbl, *nch);
+
+  for (; ; )
+    {
+      /* Show the search string and the current match */
+
+      if (failed)
+        {
+          RL_WRITE(vtbl, flabel, sizeof(flabel) - 1);
+          nshown = sizeof(flabel) - 1;
+        }
+      else
+        {
+          RL_WRITE(vtbl, label, sizeof(label) - 1);
+          nshown = sizeof(label) - 1;
+        }
+
+      if (qlen > 0)
+        {
+          RL_WRITE(vtbl, query, qlen);
+        }
+
+      RL_WRITE(vtbl, "': ", 3);
+      nshown += qlen + 3;
+
+      if (match >= 0)
+        {
+          int len = strlen(&g_hist_buf[match]);
+          if (len > 0)
+            {
+              RL_WRITE(vtbl, &g_hist_buf[match], len);
+            }
+
+          nshown += len;
+        }
+
+      ch = RL_GETC(vtbl);
+      if (ch == ASCII_DC2)
+        {
+          next = hist_find(hist_prev(match), query);
+        }
+      else if (ch == ASCII_BS || ch == ASCII_DEL)
+        {
+          if (qlen > 0)
+            {
+              query[--qlen] = '\0';
+            }
+
+          next = qlen > 0 ? hist_find(hist_newest(), query) : -1;
+          match = next;
+        }
+      else if (isprint(ch) && qlen < RL_SEARCH_MAX)
+        {
+          query[qlen++] = ch;
+          query[qlen]   = '\0';
+          next = hist_find(match >= 0 ? match : hist_newest(), query);
+        }
+      else if (isprint(ch))
+        {
+          next = match;
+        }
+      else
+        {
+          break;
+        }
+
+      failed = (qlen > 0 && next < 0);
+      if (next >= 0)
+        {
+          match = next;
+        }
+
+      rl_erase(vtbl, nshown);
+    }
+
+  rl_erase(vtbl, nshown);
+
+  /* Ctrl-G restores the original line */
+
+  if (ch != ASCII_BEL && ch != EOF && match >= 0)
+    {
+      *nch = 0;
+      hist_setline(vtbl, buf, buflen, nch, match);
+      *pos = match;
+    }
+  else if (*nch > 0)
+    {
+      RL_WRITE(vtbl, buf, *nch);
+    }
+
+  return ch == ASCII_BEL ? 0 : ch;
+}
+#endif
+
+/****************************************************************************
+ * Name: tab_addmatch
+ *
+ * Description:
+ *   Account for one more matching name.  The first match is copied into
+ *   the line buffer; each following match shortens the completion to the
+ *   part that is common to all of the matches.
+ *
  ****************************************************************************/
-/* <esc>[K is the VT100 command erases to the end of the line. */
-
-static const char g_erasetoeol[] = VT100_CLEAREOL;
 
 #ifdef CONFIG_READLINE_TABCOMPLETION
-/* Prompt string to present at the beginning of the line */
+static void tab_addmatch(FAR struct rl_tab_s *tab, FAR const char *name,
+                         bool isdir)
+{
+  int i;
 
-static FAR const char *g_readline_prompt = NULL;
+  if (tab->nmatches++ == 0)
+    {
+      for (i = 0; i < tab->maxlen && name[i] != '\0'; i++)
+        {
+          tab->word[i] = name[i];
+        }
 
-#ifdef CONFIG_READLINE_HAVE_EXTMATCH
-static FAR const struct extmatch_vtable_s *g_extmatch_vtbl = NULL;
+      tab->complen = i;
+      tab->isdir   = isdir;
+    }
+  else
+    {
+      for (i = 0; i < tab->complen && tab->word[i] == name[i]; i++);
+      tab->complen = i;
+    }
+}
 #endif
-#endif /* CONFIG_READLINE_TABCOMPLETION */
 
-#ifdef CONFIG_READLINE_CMD_HISTORY
-/* Nghia Ho: command history
+/****************************************************************************
+ * Name: tab_showmatch
  *
- * g_cmd_history[][]             Circular buffer
- * g_cmd_history_head            Head of the circular buffer, most recent command
- * g_cmd_history_steps_from_head Offset from head
- * g_cmd_history_len             Number of elements in the circular buffer
- */
+ * Description:
+ *   Show one of several matching names.  Returns false after the maximum
+ *   number of names has been shown.
+ *
+ ****************************************************************************/
 
-static char g_cmd_history[CONFIG_READLINE_CMD_HISTORY_LEN][CONFIG_READLINE_CMD_HISTORY_LINELEN];
-static int g_cmd_history_head = -1;
-static int g_cmd_history_steps_from_head = 1;
-static int g_cmd_history_len = 0;
-#endif /* CONFIG_READLINE_CMD_HISTORY */
+#ifdef CONFIG_READLINE_TABCOMPLETION
+static bool tab_showmatch(FAR struct rl_common_s *vtbl, FAR const char *name,
+                          int nshown, int maxshown)
+{
+  if (nshown >= maxshown)
+    {
+      RL_WRITE(vtbl, "  ...\n", 6);
+      return false;
+    }
 
-/****************************************************************************
- * Private Functions
- ****************************************************************************/
+  RL_WRITE(vtbl, "  ", 2);
+  RL_WRITE(vtbl, name, strlen(name));
+  RL_PUTC(vtbl, '\n');
+  return true;
+}
+#endif
 
 /****************************************************************************
- * Name: count_builtin_maches
+ * Name: tab_cmdmatches
  *
  * Description:
- *   Count the number of builtin commands
- *
- * Input Parameters:
- *   matches - Array to save builtin command index.
- *   len - The length of the matching name to try
- *
- * Returned Value:
- *   The number of matching names
+ *   Find the external and builtin command names that begin with the word
+ *   being completed.  Both tables are sorted, so the matches are found with
+ *   a binary search and then walked in order.  If 'show' is false, the
+ *   matches are accumulated in 'tab'; otherwise they are listed.
  *
  ****************************************************************************/
 
-#if defined(CONFIG_READLINE_TABCOMPLETION) && defined(CONFIG_BUILTIN)
-static int count_builtin_maches(FAR char *buf, FAR int *matches, int namelen)
+#ifdef CONFIG_READLINE_TABCOMPLETION
+static void tab_cmdmatches(FAR struct rl_common_s *vtbl,
+                           FAR struct rl_tab_s *tab, bool show)
 {
-#if CONFIG_READLINE_MAX_BUILTINS > 0
   FAR const char *name;
-  int nr_matches = 0;
-  int i;
+  int nshown;
+  int index;
+
+#ifdef CONFIG_READLINE_HAVE_EXTMATCH
+  /* Is there registered external handling logic? */
 
-  for (i = 0; (name = builtin_getname(i)) != NULL; i++)
+  if (g_extmatch_vtbl != NULL)
     {
-      if (strncmp(buf, name, namelen) == 0)
+      nshown = 0;
+      for (index = 0;
+           (index = g_extmatch_vtbl->next_match(tab->word, tab->wordlen,
+                                                index)) >= 0;
+           index++)
         {
-          matches[nr_matches] = i;
-          nr_matches++;
-
-          if (nr_matches >= CONFIG_READLINE_MAX_BUILTINS)
+          name = g_extmatch_vtbl->getname(index);
+          if (!show)
+            {
+              tab_addmatch(tab, name, false);
+            }
+          else if (!tab_showmatch(vtbl, name, nshown++,
+                                  CONFIG_READLINE_MAX_EXTCMDS))
             {
               break;
             }
         }
     }
+#endif
+
+#ifdef CONFIG_BUILTIN
+  nshown = 0;
+  for (index = 0;
+       (index = builtin_nextmatch(tab->word, tab->wordlen, index)) >= 0;
+       index++)
+    {
+      name = builtin_getname(index);
+      if (!show)
+        {
+          tab_addmatch(tab, name, false);
+        }
+      else if (!tab_showmatch(vtbl, name, nshown++,
+                              CONFIG_READLINE_MAX_BUILTINS))
+        {
+          break;
+        }
+    }
+#endif
+}
+#endif
+
+/****************************************************************************
+ * Name: tab_pathmatches
+ *
+ * Description:
+ *   Find the directory entries that begin with the last component of the
+ *   path being completed.  The directory is only read when a path is
+ *   completed and nothing is kept in memory afterward.
+ *
+ ****************************************************************************/
 
-  return nr_matches;
+#ifdef CONFIG_READLINE_TABCOMPLETION_PATHS
+static void tab_pathmatches(FAR struct rl_common_s *vtbl,
+                            FAR struct rl_tab_s *tab, bool show)
+{
+  char dirpath[PATH_MAX + 1];
+  FAR struct dirent *entryp;
+  FAR DIR *dirp;
+  int dirlen;
+  int len;
+  int nshown;
+
+  /* The directory part of the path is everything before the word being
+   * completed.  Relative paths are taken from the current working
+   * directory.
+   */
 
-#else
-  return 0;
+  dirlen = tab->word - tab->path;
+  len    = 0;
+
+  if (tab->path[0] != '/')
+    {
+#ifndef CONFIG_DISABLE_ENVIRON
+      if (getcwd(dirpath, sizeof(dirpath)) != NULL)
+        {
+          len = strlen(dirpath);
+        }
 #endif
+
+      if (len == 0 || dirpath[len - 1] != '/')
+        {
+          dirpath[len++] = '/';
+        }
+    }
+
+  if (len + dirlen > PATH_MAX)
+    {
+      return;
+    }
+
+  memcpy(&dirpath[len], tab->path, dirlen);
+  len += dirlen;
+  dirpath[len] = '\0';
+
+  dirp = opendir(dirpath);
+  if (dirp == NULL)
+    {
+      return;
+    }
+
+  nshown = 0;
+  while ((entryp = readdir(dirp)) != NULL)
+    {
+      /* Hidden entries only match if the word begins with a '.' */
+
+      if ((entryp->d_name[0] == '.' && tab->word[0] != '.') ||
+          strncmp(entryp->d_name, tab->word, tab->wordlen) != 0)
+        {
+          continue;
+        }
+
+      if (!show)
+        {
+          tab_addmatch(tab, entryp->d_name,
+                       DIRENT_ISDIRECTORY(entryp->d_type));
+        }
+      else if (!tab_showmatch(vtbl, entryp->d_name, nshown++,
+                              CONFIG_READLINE_MAX_PATHS))
+        {
+          break;
+        }
+    }
+
+  (void)closedir(dirp);
 }
 #endif
 
@@ -138,12 +959,14 @@ static int count_builtin_maches(FAR char *buf, FAR int *matches, int namelen)
  * Name: tab_completion
  *
  * Description:
- *   Nghia - Unix like tab completion, only for builtin apps
+ *   Nghia - Unix like tab completion of command names and, optionally,
+ *   of file paths.
  *
  * Input Parameters:
  *   vtbl   - vtbl used to access implementation specific interface
  *   buf     - The user allocated buffer to be filled.
  *   buflen  - the size of the buffer.
+ *   nch     - The number of characters in the buffer.
  *
  * Returned Value:
  *   None.
@@ -151,210 +974,117 @@ static int count_builtin_maches(FAR char *buf, FAR int *matches, int namelen)
  ****************************************************************************/
 
 #ifdef CONFIG_READLINE_TABCOMPLETION
-static void tab_completion(FAR struct rl_common_s *vtbl, char *buf,
-                           int *nch)
+static void tab_completion(FAR struct rl_common_s *vtbl, FAR char *buf,
+                           int buflen, FAR int *nch)
 {
-  FAR const char *name = NULL;
-  char tmp_name[CONFIG_TASK_NAME_SIZE + 1];
-#ifdef CONFIG_BUILTIN
-  int nr_builtin_matches = 0;
-  int builtin_matches[CONFIG_READLINE_MAX_BUILTINS];
-#endif
-#ifdef CONFIG_READLINE_HAVE_EXTMATCH
-  int nr_ext_matches = 0;
-  int ext_matches[CONFIG_READLINE_MAX_EXTCMDS];
-#endif
-  int nr_matches;
+  struct rl_tab_s tab;
+  bool iscmd;
   int len = *nch;
-  int name_len;
+  int start;
   int i;
-  int j;
 
-  if (len >= 1)
-    {
-#ifdef CONFIG_BUILTIN
-      /* Count the matching builtin commands */
+  /* Find the beginning of the word that is being completed */
 
-      nr_builtin_matches = count_builtin_maches(buf, builtin_matches, len);
-      nr_matches         = nr_builtin_matches;
-#else
-      nr_matches         = 0;
-#endif
+  for (start = len; start > 0 && buf[start - 1] != ' '; start--);
 
-#ifdef CONFIG_READLINE_HAVE_EXTMATCH
-      /* Is there registered external handling logic? */
+  tab.path = &buf[start];
+  tab.word = &buf[start];
 
-      nr_ext_matches     = 0;
-      if (g_extmatch_vtbl != NULL)
+  for (i = start; i < len; i++)
+    {
+      if (buf[i] == '/')
         {
-          /* Count the number of external commands */
-
-          nr_ext_matches = g_extmatch_vtbl->count_matches(buf, ext_matches, len);
-          nr_matches    += nr_ext_matches;
+          tab.word = &buf[i + 1];
         }
+    }
 
-#endif
+  /* The first word is a command name unless it looks like a path */
 
-      /* Is there only one matching name? */
+  iscmd       = (start == 0 && tab.word == tab.path);
+  tab.wordlen = &buf[len] - tab.word;
+  tab.maxlen  = &buf[buflen - 2] - tab.word;
+  tab.complen = 0;
+  tab.nmatches = 0;
+  tab.isdir   = false;
 
-      if (nr_matches == 1)
+  if (iscmd)
+    {
+      if (tab.wordlen < 1)
         {
-          /* Yes... that that is the one we want.  Was it a match with a
-           * builtin command?  Or with an external command.
-           */
-
-#ifdef CONFIG_BUILTIN
-#ifdef CONFIG_READLINE_HAVE_EXTMATCH
-          if (nr_builtin_matches ==  1)
-#endif
-            {
-              /* It is a match with a builtin command */
-
-              name = builtin_getname(builtin_matches[0]);
-            }
-#endif
+          return;
+        }
 
-#ifdef CONFIG_READLINE_HAVE_EXTMATCH
-#ifdef CONFIG_BUILTIN
-          else
+      tab_cmdmatches(vtbl, &tab, false);
+    }
+  else
+    {
+#ifdef CONFIG_READLINE_TABCOMPLETION_PATHS
+      tab_pathmatches(vtbl, &tab, false);
+#else
+      return;
 #endif
-            {
-              /* It is a match with an external command */
+    }
 
-              name = g_extmatch_vtbl->getname(ext_matches[0]);
-            }
-#endif
+  if (tab.nmatches == 0)
+    {
+      return;
+    }
 
-          /* Copy the name to the command buffer and to the display. */
+  /* The completion has been copied into the line buffer */
 
-          name_len = strlen(name);
+  len = (tab.word - buf) + tab.complen;
 
-          for (j = len; j < name_len; j++)
-            {
-              buf[j] = name[j];
-              RL_PUTC(vtbl, name[j]);
-            }
+  /* Is there only one matching name? */
 
-          /* Don't remove extra characters after the completed word, if any. */
+  if (tab.nmatches == 1)
+    {
+      /* Add a '/' to a completed directory name so that completion can
+       * continue inside of it.
+       */
 
-          if (len < name_len)
-            {
-              *nch = name_len;
-            }
+      if (tab.isdir && tab.complen < tab.maxlen)
+        {
+          buf[len++] = '/';
         }
 
-      /* Are there multiple matching names? */
-
-      else if (nr_matches > 1)
+      if (len > *nch)
         {
-          RL_PUTC(vtbl, '\n');
-
-          /* See how many characters we can auto complete for the user
-           * For example, if we have the following commands:
-           * - prog1
-           * - prog2
-           * - prog3
-           * then it should automatically complete up to prog.
-           * We do this in one pass using a temp.
-           */
-
-          memset(tmp_name, 0, sizeof(tmp_name));
-
-#ifdef CONFIG_READLINE_HAVE_EXTMATCH
-          /* Show the possible external completions */
-
-          for (i = 0; i < nr_ext_matches; i++)
-            {
-              name = g_extmatch_vtbl->getname(ext_matches[i]);
-
-              /* Initialize temp */
-
-              if (tmp_name[0] == '\0')
-                {
-                  strcpy(tmp_name, name);
-                }
-
-              RL_PUTC(vtbl, ' ');
-              RL_PUTC(vtbl, ' ');
-
-              for (j = 0; j < strlen(name); j++)
-                {
-                  /* Removing characters that aren't common to all the
-                   * matches.
-                   */
-
-                  if (name[j] != tmp_name[j])
-                    {
-                      tmp_name[j] = '\0';
-                    }
-
-                  RL_PUTC(vtbl, name[j]);
-                }
-
-              RL_PUTC(vtbl, '\n');
-            }
-#endif
-
-#ifdef CONFIG_BUILTIN
-          /* Show the possible builtin completions */
-
-          for (i = 0; i < nr_builtin_matches; i++)
-            {
-              name = builtin_getname(builtin_matches[i]);
-
-              /* Initialize temp */
-
-              if (tmp_name[0] == '\0')
-                {
-                  strcpy(tmp_name, name);
-                }
-
-              RL_PUTC(vtbl, ' ');
-              RL_PUTC(vtbl, ' ');
-
-              for (j = 0; j < strlen(name); j++)
-                {
-                  /* Removing characters that aren't common to all the
-                   * matches.
-                   */
+          RL_WRITE(vtbl, &buf[*nch], len - *nch);
+          *nch = len;
+        }
+    }
 
-                  if (name[j] != tmp_name[j])
-                    {
-                      tmp_name[j] = '\0';
-                    }
+  /* There are multiple matching names.  Show them, then the original
+   * prompt and the line which now includes all of the characters that are
+   * common to the matches.
+   */
 
-                  RL_PUTC(vtbl, name[j]);
-                }
+  else
+    {
+      RL_PUTC(vtbl, '\n');
 
-              RL_PUTC(vtbl, '\n');
-            }
+      if (iscmd)
+        {
+          tab_cmdmatches(vtbl, &tab, true);
+        }
+#ifdef CONFIG_READLINE_TABCOMPLETION_PATHS
+      else
+        {
+          tab_pathmatches(vtbl, &tab, true);
+        }
 #endif
-          strcpy(buf, tmp_name);
-
-          name_len = strlen(tmp_name);
-
-          /* Output the original prompt */
-
-          if (g_readline_prompt != NULL)
-            {
-              for (i = 0; i < strlen(g_readline_prompt); i++)
-                {
-                  RL_PUTC(vtbl, g_readline_prompt[i]);
-                }
-            }
-
-          for (i = 0; i < name_len; i++)
-            {
-              RL_PUTC(vtbl, buf[i]);
-            }
 
-          /* Don't remove extra characters after the completed word, if any. */
+      if (g_readline_prompt != NULL && g_readline_prompt[0] != '\0')
+        {
+          RL_WRITE(vtbl, g_readline_prompt, strlen(g_readline_prompt));
+        }
 
-          if (len < name_len)
-            {
-              *nch = name_len;
-            }
+      if (len > 0)
+        {
+          RL_WRITE(vtbl, buf, len);
         }
+
+      *nch = len;
     }
 }
 #endif
@@ -469,7 +1199,8 @@ ssize_t readline_common(FAR struct rl_common_s *vtbl, FAR char *buf, int buflen)
   int escape;
   int nch;
 #ifdef CONFIG_READLINE_CMD_HISTORY
-  int i;
+  int histpos = -1;
+  int pos;
 #endif
 
   /* Sanity checks */
@@ -504,6 +1235,17 @@ ssize_t readline_common(FAR struct rl_common_s *vtbl, FAR char *buf, int buflen)
 
       int ch = RL_GETC(vtbl);
 
+#ifdef CONFIG_READLINE_CMD_HISTORY
+      /* Ctrl-R starts an incremental reverse search of the history.  The
+       * key that ends the search is then handled as usual.
+       */
+
+      if (ch == ASCII_DC2 && !escape)
+        {
+          ch = hist_search(vtbl, buf, buflen, &nch, &histpos);
+        }
+#endif
+
       /* Check for end-of-file or read error */
 
       if (ch == EOF)
@@ -537,64 +1279,41 @@ ssize_t readline_common(FAR struct rl_common_s *vtbl, FAR char *buf, int buflen)
 #ifdef CONFIG_READLINE_CMD_HISTORY
               /* Nghia Ho: intercept up and down arrow keys */
 
-              if (g_cmd_history_len > 0)
+              if (ch == 'A' || ch == 'B')
                 {
-                  if (ch == 'A') /* up arrow */
+#ifdef CONFIG_READLINE_CMD_HISTORY_PERSIST
+                  if (!g_hist_loaded)
                     {
-                      /* Go to the past command in history */
+                      hist_load();
+                    }
+#endif
 
-                      g_cmd_history_steps_from_head--;
+                  if (ch == 'A') /* up arrow */
+                    {
+                      /* Go to the past command in history, stopping at the
+                       * oldest one.
+                       */
 
-                      if (-g_cmd_history_steps_from_head >= g_cmd_history_len)
+                      pos = histpos < 0 ? hist_newest() : hist_prev(histpos);
+                      if (pos < 0)
                         {
-                          g_cmd_history_steps_from_head = -(g_cmd_history_len - 1);
+                          pos = histpos;
                         }
                     }
-                  else if (ch == 'B') /* down arrow */
+                  else /* down arrow */
                     {
-                      /* Go to the recent command in history */
-
-                      g_cmd_history_steps_from_head++;
+                      /* Go to the recent command in history or, after the
+                       * most recent one, to an empty line.
+                       */
 
-                      if (g_cmd_history_steps_from_head > 1)
-                        {
-                          g_cmd_history_steps_from_head = 1;
-                        }
+                      pos = hist_next(histpos);
                     }
 
-                  /* Clear out current command from the prompt */
-
-                  while (nch > 0)
+                  if (pos >= 0 || ch == 'B')
                     {
-                      nch--;
-
-#ifdef CONFIG_READLINE_ECHO
-                      RL_PUTC(vtbl, ASCII_BS);
-                      RL_WRITE(vtbl, g_erasetoeol, sizeof(g_erasetoeol));
-#endif
+                      hist_setline(vtbl, buf, buflen, &nch, pos);
+                      histpos = pos;
                     }
-
-                    if (g_cmd_history_steps_from_head != 1)
-                      {
-                        int idx = g_cmd_history_head + g_cmd_history_steps_from_head;
-
-                        /* Circular buffer wrap around */
-
-                        if (idx < 0)
-                          {
-                            idx = idx + CONFIG_READLINE_CMD_HISTORY_LEN;
-                          }
-                        else if (idx >= CONFIG_READLINE_CMD_HISTORY_LEN)
-                          {
-                            idx = idx - CONFIG_READLINE_CMD_HISTORY_LEN;
-                          }
-
-                        for (i = 0; g_cmd_history[idx][i] != '\0'; i++)
-                          {
-                            buf[nch++] = g_cmd_history[idx][i];
-                            RL_PUTC(vtbl, g_cmd_history[idx][i]);
-                          }
-                     }
                 }
 #endif /* CONFIG_READLINE_CMD_HISTORY */
 
@@ -664,36 +1383,23 @@ ssize_t readline_common(FAR struct rl_common_s *vtbl, FAR char *buf, int buflen)
       else if (ch == '\n' || ch == '\r')
 #endif
         {
+          /* The newline is stored in the buffer along with the null
+           * terminator.
+           */
+
+          buf[nch++] = '\n';
+          buf[nch]   = '\0';
+
 #ifdef CONFIG_READLINE_CMD_HISTORY
           /* Nghia Ho: save history of command, only if there was something
            * typed besides return character.
            */
 
-          if (nch >= 1)
+          if (nch > 1)
             {
-              g_cmd_history_head = (g_cmd_history_head + 1) % CONFIG_READLINE_CMD_HISTORY_LEN;
-
-              for (i = 0; (i < nch) && i < (CONFIG_READLINE_CMD_HISTORY_LINELEN - 1); i++)
-                {
-                  g_cmd_history[g_cmd_history_head][i] = buf[i];
-                }
-
-              g_cmd_history[g_cmd_history_head][i] = '\0';
-              g_cmd_history_steps_from_head = 1;
-
-              if (g_cmd_history_len < CONFIG_READLINE_CMD_HISTORY_LEN)
-                {
-                  g_cmd_history_len++;
-                }
+              hist_save(buf, nch);
             }
-#endif /* CONFIG_READLINE_CMD_HISTORY */
-
-          /* The newline is stored in the buffer along with the null
-           * terminator.
-           */
-
-          buf[nch++] = '\n';
-          buf[nch]   = '\0';
+#endif
 
 #ifdef CONFIG_READLINE_ECHO
           /* Echo the newline to the console */
@@ -729,7 +1435,7 @@ ssize_t readline_common(FAR struct rl_common_s *vtbl, FAR char *buf, int buflen)
 #ifdef CONFIG_READLINE_TABCOMPLETION
      else if (ch == '\t') /* Nghia - TAB character */
         {
-          tab_completion(vtbl, buf, &nch);
+          tab_completion(vtbl, buf, buflen, &nch);
         }
 #endif
     }
@@ -0,0 +1,366 @@
+/****************************************************************************
+ * system/sched_note/host/note2trace.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/* Host side decoder for the binary note stream of 'note -o' / 'note -p'.
+ * It converts the stream into the JSON trace event format that
+ * chrome://tracing and Perfetto load, with one track per task showing
+ * when it was running and instant events for preemption and critical
+ * section changes.
+ *
+ * Build:  cc -o note2trace note2trace.c
+ * Usage:  note2trace [<capture>] > trace.json
+ */
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../note_stream.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define MAX_PAYLOAD 65535
+#define MAX_PIDS    65536
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static uint8_t g_info[NOTE_INFO_SIZE];
+static bool g_haveinfo;
+static bool g_running[MAX_PIDS];
+static bool g_first = true;
+
+static uint32_t g_lasttick;
+static uint64_t g_tickbase;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t get16(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* Return the note kind (NOTE_KIND_*) of a target note type */
+
+static int note_kind(uint8_t type)
+{
+  int i;
+
+  for (i = 0; i < NOTE_NKINDS && i < g_info[NOTE_INFO_NTYPES]; i++)
+    {
+      if (g_info[NOTE_INFO_TYPES + i] == type &&
+          g_info[NOTE_INFO_TYPES + i] != NOTE_KIND_NONE)
+        {
+          return i;
+        }
+    }
+
+  return -1;
+}
+
+static void emit(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+static void emit(const char *fmt, ...)
+{
+  va_list ap;
+
+  printf(g_first ? "\n  " : ",\n  ");
+  g_first = false;
+
+  va_start(ap, fmt);
+  vprintf(fmt, ap);
+  va_end(ap);
+}
+
+/* Time stamps are 32-bit tick counts; extend them across wraps */
+
+static double note_usec(uint32_t tick)
+{
+  if (tick < g_lasttick)
+    {
+      g_tickbase += (uint64_t)1 << 32;
+    }
+
+  g_lasttick = tick;
+  return (double)(g_tickbase + tick) * get32(&g_info[NOTE_INFO_USECPERTICK]);
+}
+
+static void decode_note(const uint8_t *note)
+{
+  unsigned int pid;
+  unsigned int cpu = 0;
+  char name[256];
+  double ts;
+  int namesize;
+  int kind;
+  int i;
+
+  kind = note_kind(note[1]);
+  if (kind < 0)
+    {
+      return;
+    }
+
+  pid = get16(&note[g_info[NOTE_INFO_OFFPID]]);
+  ts  = note_usec(get32(&note[g_info[NOTE_INFO_OFFTIME]]));
+  if (g_info[NOTE_INFO_OFFCPU] != 0xff)
+    {
+      cpu = note[g_info[NOTE_INFO_OFFCPU]];
+    }
+
+  switch (kind)
+    {
+      case NOTE_KIND_START:
+        namesize = g_info[NOTE_INFO_NAMESIZE];
+        if (namesize > 0 && note[0] > g_info[NOTE_INFO_OFFNAME])
+          {
+            if (namesize > note[0] - g_info[NOTE_INFO_OFFNAME])
+              {
+                namesize = note[0] - g_info[NOTE_INFO_OFFNAME];
+              }
+
+            memcpy(name, &note[g_info[NOTE_INFO_OFFNAME]], namesize);
+            name[namesize] = '\0';
+
+            /* Keep the JSON string valid */
+
+            for (i = 0; name[i] != '\0'; i++)
+              {
+                if (name[i] == '"' || name[i] == '\\' ||
+                    (unsigned char)name[i] < ' ')
+                  {
+                    name[i] = '_';
+                  }
+              }
+          }
+        else
+          {
+            snprintf(name, sizeof(name), "task %u", pid);
+          }
+
+        emit("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,"
+             "\"args\":{\"name\":\"%s (%u)\"}}", pid, name, pid);
+        emit("{\"name\":\"start\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.0f,"
+             "\"pid\":0,\"tid\":%u}", ts, pid);
+        break;
+
+      case NOTE_KIND_RESUME:
+        if (!g_running[pid])
+          {
+            emit("{\"name\":\"running\",\"ph\":\"B\",\"ts\":%.0f,\"pid\":0,"
+                 "\"tid\":%u,\"args\":{\"cpu\":%u,\"priority\":%u}}",
+                 ts, pid, cpu, note[2]);
+            g_running[pid] = true;
+          }
+        break;
+
+      case NOTE_KIND_SUSPEND:
+      case NOTE_KIND_STOP:
+        if (g_running[pid])
+          {
+            emit("{\"ph\":\"E\",\"ts\":%.0f,\"pid\":0,\"tid\":%u}",
+                 ts, pid);
+            g_running[pid] = false;
+          }
+
+        if (kind == NOTE_KIND_STOP)
+          {
+            emit("{\"name\":\"stop\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.0f,"
+                 "\"pid\":0,\"tid\":%u}", ts, pid);
+          }
+        break;
+
+      case NOTE_KIND_PREEMPT_LOCK:
+      case NOTE_KIND_PREEMPT_UNLOCK:
+      case NOTE_KIND_CSECTION_ENTER:
+      case NOTE_KIND_CSECTION_LEAVE:
+        {
+          static const char *names[] =
+          {
+            "preempt lock", "preempt unlock", "csection enter",
+            "csection leave"
+          };
+
+          emit("{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.0f,"
+               "\"pid\":0,\"tid\":%u,\"args\":{\"cpu\":%u}}",
+               names[kind - NOTE_KIND_PREEMPT_LOCK], ts, pid, cpu);
+        }
+        break;
+    }
+}
+
+static void decode_data(const uint8_t *data, size_t len)
+{
+  size_t offset = 0;
+
+  while (offset < len)
+    {
+      if (data[offset] < g_info[NOTE_INFO_COMMONSIZE] ||
+          offset + data[offset] > len)
+        {
+          fprintf(stderr, "note2trace: bad note length %u\n", data[offset]);
+          return;
+        }
+
+      decode_note(&data[offset]);
+      offset += data[offset];
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+int main(int argc, char **argv)
+{
+  static uint8_t payload[MAX_PAYLOAD];
+  uint8_t hdr[NOTE_FRAME_HDRSIZE];
+  uint16_t expect = 0;
+  bool synced = false;
+  unsigned long lost = 0;
+  unsigned long skipped = 0;
+  FILE *in = stdin;
+  size_t len;
+  int c;
+
+  if (argc > 1 && (in = fopen(argv[1], "rb")) == NULL)
+    {
+      perror(argv[1]);
+      return EXIT_FAILURE;
+    }
+
+  printf("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+  for (; ; )
+    {
+      /* Find the start of a frame */
+
+      if ((c = getc(in)) == EOF)
+        {
+          break;
+        }
+
+      if (c != NOTE_FRAME_MAGIC0)
+        {
+          skipped++;
+          continue;
+        }
+
+      if ((c = getc(in)) == EOF)
+        {
+          break;
+        }
+
+      if (c != NOTE_FRAME_MAGIC1)
+        {
+          skipped += 2;
+          if (c == NOTE_FRAME_MAGIC0)
+            {
+              ungetc(c, in);
+              skipped--;
+            }
+
+          continue;
+        }
+
+      hdr[0] = NOTE_FRAME_MAGIC0;
+      hdr[1] = NOTE_FRAME_MAGIC1;
+      if (fread(&hdr[2], 1, NOTE_FRAME_HDRSIZE - 2, in) !=
+          NOTE_FRAME_HDRSIZE - 2)
+        {
+          break;
+        }
+
+      len = get16(&hdr[6]);
+      if ((hdr[2] != NOTE_FRAME_INFO && hdr[2] != NOTE_FRAME_DATA) ||
+          hdr[3] != 0 || fread(payload, 1, len, in) != len)
+        {
+          skipped += NOTE_FRAME_HDRSIZE;
+          continue;
+        }
+
+      if (synced && get16(&hdr[4]) != expect)
+        {
+          lost += (uint16_t)(get16(&hdr[4]) - expect);
+        }
+
+      synced = true;
+      expect = get16(&hdr[4]) + 1;
+
+      if (hdr[2] == NOTE_FRAME_INFO)
+        {
+          if (len < NOTE_INFO_SIZE ||
+              payload[NOTE_INFO_VERSION] != NOTE_STREAM_VERSION)
+            {
+              fprintf(stderr, "note2trace: unsupported stream version\n");
+              return EXIT_FAILURE;
+            }
+
+          memcpy(g_info, payload, NOTE_INFO_SIZE);
+          g_haveinfo = true;
+        }
+      else if (g_haveinfo)
+        {
+          decode_data(payload, len);
+        }
+    }
+
+  printf("\n]}\n");
+
+  if (lost > 0 || skipped > 0)
+    {
+      fprintf(stderr, "note2trace: %lu frames lost, %lu bytes skipped\n",
+              lost, skipped);
+    }
+
+  return EXIT_SUCCESS;
+}
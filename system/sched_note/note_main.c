@@ -40,21 +40,92 @@
 #include <nuttx/config.h>
 
 #include <sys/types.h>
+#include <sys/prctl.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <unistd.h>
 #include <syslog.h>
 #include <fcntl.h>
 #include <errno.h>
 
+#ifdef CONFIG_NET_TCP
+#  include <sys/socket.h>
+#  include <netinet/in.h>
+#endif
+
+#include <nuttx/clock.h>
+#include <nuttx/sched.h>
 #include <nuttx/sched_note.h>
 
+#include "note_stream.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_SYSTEM_NOTE_STREAM_DELAY
+#  define CONFIG_SYSTEM_NOTE_STREAM_DELAY 10
+#endif
+
+#ifndef CONFIG_SYSTEM_NOTE_NTASKS
+#  define CONFIG_SYSTEM_NOTE_NTASKS 32
+#endif
+
+#ifdef CONFIG_SMP
+#  define NOTE_NCPUS CONFIG_SMP_NCPUS
+#else
+#  define NOTE_NCPUS 1
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Scheduling statistics of one task, accumulated over a reporting period.
+ * Times are in system clock ticks, like the note time stamps.
+ */
+
+struct note_taskstats_s
+{
+  bool     inuse;
+  bool     running;       /* Resumed and not suspended since */
+  bool     ready;         /* Preempted, waiting to run again */
+  bool     stopped;       /* Task exited in this period */
+  bool     seen;          /* 'priority' is valid */
+  uint8_t  priority;      /* Priority in the last note */
+  uint8_t  maxprio;       /* Highest priority in this period */
+  pid_t    pid;
+  uint32_t since;         /* Time of the last resume or preemption */
+  uint32_t runtime;       /* Time running */
+  uint32_t nswitches;     /* Number of times resumed */
+  uint32_t npreempt;      /* Number of times preempted */
+  uint32_t nprio;         /* Number of priority changes */
+  uint32_t nlatency;      /* Number of latency samples */
+  uint32_t latsum;        /* Sum of latencies from preemption to resume */
+  uint32_t latmax;        /* Worst latency */
+#if CONFIG_TASK_NAME_SIZE > 0
+  char     name[CONFIG_TASK_NAME_SIZE + 1];
+#endif
+};
+
+struct note_stats_s
+{
+  uint32_t start;         /* Start of the reporting period */
+  unsigned int ndropped;  /* Notes of tasks that did not fit in the table */
+  struct note_taskstats_s tasks[CONFIG_SYSTEM_NOTE_NTASKS];
+};
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
 
 static bool g_note_daemon_started;
 static uint8_t g_note_buffer[CONFIG_SYSTEM_NOTE_BUFFERSIZE];
+static uint16_t g_note_seq;
 
 /* Names of task/thread states */
 
@@ -587,13 +658,574 @@ static void dump_notes(size_t nread)
     }
 }
 
+/****************************************************************************
+ * Name: note_write
+ *
+ * Description:
+ *   Write a whole buffer, retrying after partial writes.
+ *
+ ****************************************************************************/
+
+static int note_write(int fd, FAR const uint8_t *buffer, size_t len)
+{
+  ssize_t nwritten;
+
+  while (len > 0)
+    {
+      nwritten = write(fd, buffer, len);
+      if (nwritten < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          return -errno;
+        }
+
+      buffer += nwritten;
+      len    -= nwritten;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: note_stream_frame
+ *
+ * Description:
+ *   Send one frame of the binary note stream (see note_stream.h).
+ *
+ ****************************************************************************/
+
+static int note_stream_frame(int fd, uint8_t type,
+                             FAR const uint8_t *payload, size_t len)
+{
+  uint8_t hdr[NOTE_FRAME_HDRSIZE];
+  int ret;
+
+  hdr[0] = NOTE_FRAME_MAGIC0;
+  hdr[1] = NOTE_FRAME_MAGIC1;
+  hdr[2] = type;
+  hdr[3] = 0;
+  hdr[4] = (uint8_t)g_note_seq;
+  hdr[5] = (uint8_t)(g_note_seq >> 8);
+  hdr[6] = (uint8_t)len;
+  hdr[7] = (uint8_t)(len >> 8);
+
+  g_note_seq++;
+
+  ret = note_write(fd, hdr, NOTE_FRAME_HDRSIZE);
+  if (ret >= 0)
+    {
+      ret = note_write(fd, payload, len);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: note_stream_info
+ *
+ * Description:
+ *   Send the description of the note layout of this configuration.
+ *
+ ****************************************************************************/
+
+static int note_stream_info(int fd)
+{
+  uint8_t info[NOTE_INFO_SIZE];
+  uint32_t usec = USEC_PER_TICK;
+
+  memset(&info[NOTE_INFO_TYPES], NOTE_KIND_NONE, NOTE_NKINDS);
+
+  info[NOTE_INFO_VERSION]         = NOTE_STREAM_VERSION;
+  info[NOTE_INFO_NCPUS]           = NOTE_NCPUS;
+  info[NOTE_INFO_USECPERTICK]     = (uint8_t)usec;
+  info[NOTE_INFO_USECPERTICK + 1] = (uint8_t)(usec >> 8);
+  info[NOTE_INFO_USECPERTICK + 2] = (uint8_t)(usec >> 16);
+  info[NOTE_INFO_USECPERTICK + 3] = (uint8_t)(usec >> 24);
+  info[NOTE_INFO_COMMONSIZE]      = sizeof(struct note_common_s);
+#ifdef CONFIG_SMP
+  info[NOTE_INFO_OFFCPU]          = offsetof(struct note_common_s, nc_cpu);
+#else
+  info[NOTE_INFO_OFFCPU]          = 0xff;
+#endif
+  info[NOTE_INFO_OFFPID]          = offsetof(struct note_common_s, nc_pid);
+  info[NOTE_INFO_OFFTIME]         = offsetof(struct note_common_s,
+                                             nc_systime);
+#if CONFIG_TASK_NAME_SIZE > 0
+  info[NOTE_INFO_OFFNAME]         = offsetof(struct note_start_s, nst_name);
+  info[NOTE_INFO_NAMESIZE]        = CONFIG_TASK_NAME_SIZE;
+#else
+  info[NOTE_INFO_OFFNAME]         = 0;
+  info[NOTE_INFO_NAMESIZE]        = 0;
+#endif
+  info[NOTE_INFO_NTYPES]          = NOTE_NKINDS;
+
+  info[NOTE_INFO_TYPES + NOTE_KIND_START]   = NOTE_START;
+  info[NOTE_INFO_TYPES + NOTE_KIND_STOP]    = NOTE_STOP;
+  info[NOTE_INFO_TYPES + NOTE_KIND_SUSPEND] = NOTE_SUSPEND;
+  info[NOTE_INFO_TYPES + NOTE_KIND_RESUME]  = NOTE_RESUME;
+#ifdef CONFIG_SCHED_INSTRUMENTATION_PREEMPTION
+  info[NOTE_INFO_TYPES + NOTE_KIND_PREEMPT_LOCK]   = NOTE_PREEMPT_LOCK;
+  info[NOTE_INFO_TYPES + NOTE_KIND_PREEMPT_UNLOCK] = NOTE_PREEMPT_UNLOCK;
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_CSECTION
+  info[NOTE_INFO_TYPES + NOTE_KIND_CSECTION_ENTER] = NOTE_CSECTION_ENTER;
+  info[NOTE_INFO_TYPES + NOTE_KIND_CSECTION_LEAVE] = NOTE_CSECTION_LEAVE;
+#endif
+
+  return note_stream_frame(fd, NOTE_FRAME_INFO, info, NOTE_INFO_SIZE);
+}
+
+/****************************************************************************
+ * Name: note_open_output
+ *
+ * Description:
+ *   Open the destination of the binary stream: a device or file, or the
+ *   first client that connects to the TCP port.
+ *
+ ****************************************************************************/
+
+static int note_open_output(FAR const char *path, int port)
+{
+  int fd;
+
+#ifdef CONFIG_NET_TCP
+  if (port > 0)
+    {
+      struct sockaddr_in addr;
+      int listensd;
+
+      listensd = socket(AF_INET, SOCK_STREAM, 0);
+      if (listensd < 0)
+        {
+          return -errno;
+        }
+
+      memset(&addr, 0, sizeof(addr));
+      addr.sin_family      = AF_INET;
+      addr.sin_port        = htons(port);
+      addr.sin_addr.s_addr = INADDR_ANY;
+
+      if (bind(listensd, (FAR struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+          listen(listensd, 1) < 0)
+        {
+          fd = -errno;
+          close(listensd);
+          return fd;
+        }
+
+      syslog(LOG_INFO, "note_daemon: Waiting for a client on port %d\n",
+             port);
+
+      fd = accept(listensd, NULL, NULL);
+      if (fd < 0)
+        {
+          fd = -errno;
+        }
+
+      close(listensd);
+      return fd;
+    }
+#endif
+
+  if (path == NULL)
+    {
+      return -EINVAL;
+    }
+
+  fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  return fd < 0 ? -errno : fd;
+}
+
+/****************************************************************************
+ * Name: note_stream
+ *
+ * Description:
+ *   Forward the note buffer unchanged, without decoding anything on the
+ *   target, so that the monitor disturbs the scheduling as little as
+ *   possible.
+ *
+ ****************************************************************************/
+
+static void note_stream(int fd, FAR const char *path, int port)
+{
+  ssize_t nread;
+  unsigned int nframes = 0;
+  int outfd;
+  int ret;
+
+  outfd = note_open_output(path, port);
+  if (outfd < 0)
+    {
+      syslog(LOG_INFO, "note_daemon: ERROR: Failed to open the output: %d\n",
+             outfd);
+      return;
+    }
+
+  ret = note_stream_info(outfd);
+  while (ret >= 0)
+    {
+      /* Drain the note buffer before sleeping again */
+
+      while (ret >= 0 &&
+             (nread = read(fd, g_note_buffer,
+                           CONFIG_SYSTEM_NOTE_BUFFERSIZE)) > 0)
+        {
+          ret = note_stream_frame(outfd, NOTE_FRAME_DATA, g_note_buffer,
+                                  nread);
+          if (ret >= 0 && (++nframes % NOTE_INFO_PERIOD) == 0)
+            {
+              ret = note_stream_info(outfd);
+            }
+        }
+
+      if (ret >= 0)
+        {
+          usleep(CONFIG_SYSTEM_NOTE_STREAM_DELAY * 1000L);
+        }
+    }
+
+  syslog(LOG_INFO, "note_daemon: ERROR: Write failed: %d\n", ret);
+  close(outfd);
+}
+
+/****************************************************************************
+ * Name: note_stats_task
+ *
+ * Description:
+ *   Find the statistics of a task, or allocate them on its first note.
+ *   Returns NULL if the table is full.
+ *
+ ****************************************************************************/
+
+static FAR struct note_taskstats_s *
+note_stats_task(FAR struct note_stats_s *stats, pid_t pid)
+{
+  FAR struct note_taskstats_s *unused = NULL;
+  FAR struct note_taskstats_s *ts;
+  int ndx;
+  int i;
+
+  /* Start looking at the hashed position, which is usually a hit */
+
+  ndx = (unsigned int)pid % CONFIG_SYSTEM_NOTE_NTASKS;
+  for (i = 0; i < CONFIG_SYSTEM_NOTE_NTASKS; i++)
+    {
+      ts = &stats->tasks[ndx];
+      if (!ts->inuse)
+        {
+          if (unused == NULL)
+            {
+              unused = ts;
+            }
+        }
+      else if (ts->pid == pid)
+        {
+          return ts;
+        }
+
+      if (++ndx >= CONFIG_SYSTEM_NOTE_NTASKS)
+        {
+          ndx = 0;
+        }
+    }
+
+  if (unused != NULL)
+    {
+      memset(unused, 0, sizeof(struct note_taskstats_s));
+      unused->inuse = true;
+      unused->pid   = pid;
+#if CONFIG_TASK_NAME_SIZE > 0
+      /* Tasks that started before the daemon have no start note */
+
+      (void)prctl(PR_GET_NAME, unused->name, pid);
+#endif
+    }
+
+  return unused;
+}
+
+/****************************************************************************
+ * Name: note_stats_update
+ *
+ * Description:
+ *   Account the notes just read from the note driver.
+ *
+ ****************************************************************************/
+
+static void note_stats_update(FAR struct note_stats_s *stats, size_t nread)
+{
+  FAR struct note_common_s *note;
+  FAR struct note_taskstats_s *ts;
+  uint32_t systime;
+  uint32_t latency;
+  pid_t pid;
+  off_t offset;
+
+  offset = 0;
+  while (offset + sizeof(struct note_common_s) <= nread)
+    {
+      note    = (FAR struct note_common_s *)&g_note_buffer[offset];
+      pid     =  (pid_t)note->nc_pid[0] +
+                ((pid_t)note->nc_pid[1] << 8);
+      systime = (uint32_t) note->nc_systime[0]        +
+                (uint32_t)(note->nc_systime[1] << 8)  +
+                (uint32_t)(note->nc_systime[2] << 16) +
+                (uint32_t)(note->nc_systime[3] << 24);
+
+      if (note->nc_length < sizeof(struct note_common_s))
+        {
+          syslog(LOG_INFO, "ERROR: note too small: %d\n", note->nc_length);
+          return;
+        }
+
+      offset += note->nc_length;
+
+      ts = note_stats_task(stats, pid);
+      if (ts == NULL)
+        {
+          stats->ndropped++;
+          continue;
+        }
+
+      /* A priority that differs from the last note of the same task is a
+       * priority change, usually priority inheritance: the scheduler does
+       * not note these separately.
+       */
+
+      if (ts->seen && note->nc_priority != ts->priority)
+        {
+          ts->nprio++;
+        }
+
+      ts->seen     = true;
+      ts->priority = note->nc_priority;
+      if (note->nc_priority > ts->maxprio)
+        {
+          ts->maxprio = note->nc_priority;
+        }
+
+      switch (note->nc_type)
+        {
+          case NOTE_START:
+#if CONFIG_TASK_NAME_SIZE > 0
+            if (note->nc_length > sizeof(struct note_common_s))
+              {
+                FAR struct note_start_s *note_start =
+                  (FAR struct note_start_s *)note;
+                size_t len = note->nc_length -
+                             offsetof(struct note_start_s, nst_name);
+
+                if (len > CONFIG_TASK_NAME_SIZE)
+                  {
+                    len = CONFIG_TASK_NAME_SIZE;
+                  }
+
+                strncpy(ts->name, note_start->nst_name, len);
+                ts->name[len] = '\0';
+              }
+#endif
+            break;
+
+          case NOTE_STOP:
+            if (ts->running)
+              {
+                ts->runtime += systime - ts->since;
+              }
+
+            ts->running = false;
+            ts->ready   = false;
+            ts->stopped = true;
+            break;
+
+          case NOTE_SUSPEND:
+            {
+              FAR struct note_suspend_s *note_suspend =
+                (FAR struct note_suspend_s *)note;
+
+              if (ts->running)
+                {
+                  ts->runtime += systime - ts->since;
+                }
+
+              ts->running = false;
+
+              /* A task that is suspended but still ready to run was
+               * preempted.  Otherwise it blocked by itself.
+               */
+
+              if (note_suspend->nsu_state == TSTATE_TASK_PENDING ||
+                  note_suspend->nsu_state == TSTATE_TASK_READYTORUN)
+                {
+                  ts->npreempt++;
+                  ts->ready = true;
+                  ts->since = systime;
+                }
+            }
+            break;
+
+          case NOTE_RESUME:
+            if (ts->ready)
+              {
+                latency = systime - ts->since;
+                ts->latsum += latency;
+                ts->nlatency++;
+                if (latency > ts->latmax)
+                  {
+                    ts->latmax = latency;
+                  }
+              }
+
+            ts->nswitches++;
+            ts->running = true;
+            ts->ready   = false;
+            ts->since   = systime;
+            break;
+
+          default:
+            break;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: note_stats_report
+ *
+ * Description:
+ *   Print the statistics of the period that ends now and start the next
+ *   one.
+ *
+ ****************************************************************************/
+
+static void note_stats_report(FAR struct note_stats_s *stats)
+{
+  FAR struct note_taskstats_s *ts;
+  uint32_t now = clock_systimer();
+  uint32_t period = now - stats->start;
+  uint64_t total;
+  unsigned long permille;
+  unsigned long latavg;
+  int i;
+
+  syslog(LOG_INFO, "note: %lu ms, %u notes dropped\n",
+         (unsigned long)TICK2MSEC(period), stats->ndropped);
+  syslog(LOG_INFO, "  PID PRI MAX  RUN(us)  CPU%%   SWITCH  PREEMPT  "
+         "LATAVG(us) LATMAX(us)   PRIO NAME\n");
+
+  total = (uint64_t)period * NOTE_NCPUS;
+  for (i = 0; i < CONFIG_SYSTEM_NOTE_NTASKS; i++)
+    {
+      ts = &stats->tasks[i];
+      if (!ts->inuse)
+        {
+          continue;
+        }
+
+      /* Split the time of a task that is still running at the period end */
+
+      if (ts->running)
+        {
+          ts->runtime += now - ts->since;
+          ts->since    = now;
+        }
+
+      permille = total > 0 ? (unsigned long)((ts->runtime * 1000ull) / total)
+                           : 0;
+      latavg   = ts->nlatency > 0 ? ts->latsum / ts->nlatency : 0;
+
+      syslog(LOG_INFO,
+             "%5u %3u %3u %8lu %3lu.%lu %8lu %8lu %11lu %10lu %6lu %s\n",
+             (unsigned int)ts->pid, (unsigned int)ts->priority,
+             (unsigned int)ts->maxprio,
+             (unsigned long)ts->runtime * USEC_PER_TICK,
+             permille / 10, permille % 10,
+             (unsigned long)ts->nswitches, (unsigned long)ts->npreempt,
+             latavg * USEC_PER_TICK,
+             (unsigned long)ts->latmax * USEC_PER_TICK,
+             (unsigned long)ts->nprio,
+#if CONFIG_TASK_NAME_SIZE > 0
+             ts->name
+#else
+             ""
+#endif
+             );
+
+      /* Forget the tasks that exited and restart the counters */
+
+      if (ts->stopped)
+        {
+          ts->inuse = false;
+          continue;
+        }
+
+      ts->runtime   = 0;
+      ts->nswitches = 0;
+      ts->npreempt  = 0;
+      ts->nprio     = 0;
+      ts->nlatency  = 0;
+      ts->latsum    = 0;
+      ts->latmax    = 0;
+      ts->maxprio   = ts->priority;
+    }
+
+  stats->start    = now;
+  stats->ndropped = 0;
+}
+
+/****************************************************************************
+ * Name: note_aggregate
+ *
+ * Description:
+ *   Keep per-task scheduling statistics instead of printing every note,
+ *   and print a summary every 'interval' seconds.
+ *
+ ****************************************************************************/
+
+static void note_aggregate(int fd, int interval)
+{
+  FAR struct note_stats_s *stats;
+  ssize_t nread;
+  uint32_t ticks = SEC2TICK(interval);
+
+  stats = (FAR struct note_stats_s *)zalloc(sizeof(struct note_stats_s));
+  if (stats == NULL)
+    {
+      syslog(LOG_INFO, "note_daemon: ERROR: Failed to allocate statistics\n");
+      return;
+    }
+
+  stats->start = clock_systimer();
+
+  for (; ; )
+    {
+      while ((nread = read(fd, g_note_buffer,
+                           CONFIG_SYSTEM_NOTE_BUFFERSIZE)) > 0)
+        {
+          note_stats_update(stats, nread);
+        }
+
+      if (clock_systimer() - stats->start >= ticks)
+        {
+          note_stats_report(stats);
+        }
+
+      usleep(CONFIG_SYSTEM_NOTE_STREAM_DELAY * 1000L);
+    }
+}
+
 /****************************************************************************
  * Name: note_daemon
  ****************************************************************************/
 
 static int note_daemon(int argc, char *argv[])
 {
+  FAR const char *path = NULL;
   ssize_t nread;
+  int interval = 0;
+  int port = 0;
   int fd;
 
   /* Indicate that we are running */
@@ -613,6 +1245,37 @@ static int note_daemon(int argc, char *argv[])
       goto errout;
     }
 
+  /* note_main passes "-o <path>" or "-p <port>" to stream the notes, or
+   * "-s <seconds>" to summarize them.
+   */
+
+  if (argc > 2 && strcmp(argv[1], "-o") == 0)
+    {
+      path = argv[2];
+    }
+  else if (argc > 2 && strcmp(argv[1], "-p") == 0)
+    {
+      port = atoi(argv[2]);
+    }
+  else if (argc > 2 && strcmp(argv[1], "-s") == 0)
+    {
+      interval = atoi(argv[2]);
+    }
+
+  if (interval > 0)
+    {
+      note_aggregate(fd, interval);
+      (void)close(fd);
+      goto errout;
+    }
+
+  if (path != NULL || port > 0)
+    {
+      note_stream(fd, path, port);
+      (void)close(fd);
+      goto errout;
+    }
+
   /* Now loop forever, dumping note data to the display */
 
   for (; ; )
@@ -649,18 +1312,70 @@ int main(int argc, FAR char *argv[])
 int note_main(int argc, FAR char *argv[])
 #endif
 {
+  FAR char *dargv[3];
+  int option;
   int ret;
 
-  printf("note_main: Starting the note_daemon\n");
   if (g_note_daemon_started)
     {
       printf("note_main: note_daemon already running\n");
       return EXIT_SUCCESS;
     }
 
+  /* -o and -p select binary streaming and -s the statistics summary
+   * instead of the decoded syslog dump.  They are handed on to the daemon,
+   * which gets its own copy.
+   */
+
+  dargv[0] = NULL;
+  while ((option = getopt(argc, argv, "o:p:s:h")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'o':
+            dargv[0] = "-o";
+            dargv[1] = optarg;
+            dargv[2] = NULL;
+            break;
+
+#ifdef CONFIG_NET_TCP
+          case 'p':
+            dargv[0] = "-p";
+            dargv[1] = optarg;
+            dargv[2] = NULL;
+            break;
+#endif
+
+          case 's':
+            dargv[0] = "-s";
+            dargv[1] = optarg;
+            dargv[2] = NULL;
+            break;
+
+          case 'h':
+          default:
+            fprintf(stderr, "USAGE: %s [-o <path>]"
+#ifdef CONFIG_NET_TCP
+                    " [-p <port>]"
+#endif
+                    " [-s <seconds>]\n", argv[0]);
+            fprintf(stderr, "  -o <path>  Stream raw notes to a device or "
+                    "file\n");
+#ifdef CONFIG_NET_TCP
+            fprintf(stderr, "  -p <port>  Stream raw notes to a TCP "
+                    "client\n");
+#endif
+            fprintf(stderr, "  -s <secs>  Print per-task scheduling "
+                    "statistics this often\n");
+            return option == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+  printf("note_main: Starting the note_daemon\n");
+
   ret = task_create("note_daemon", CONFIG_SYSTEM_NOTE_PRIORITY,
                     CONFIG_SYSTEM_NOTE_STACKSIZE, note_daemon,
-                    NULL);
+                    dargv[0] != NULL ? dargv : NULL);
   if (ret < 0)
     {
       int errcode = errno;
@@ -0,0 +1,110 @@
+/****************************************************************************
+ * system/sched_note/note_stream.h
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_SYSTEM_SCHED_NOTE_NOTE_STREAM_H
+#define __APPS_SYSTEM_SCHED_NOTE_NOTE_STREAM_H
+
+/* Framing of the binary note stream written by 'note -o' and 'note -p'.
+ * This header is shared with the host side decoder and so must not depend
+ * on the NuttX configuration.
+ *
+ * The stream is a sequence of frames, each made of an 8 byte header and
+ * a payload.  All multi-byte fields are little endian.
+ *
+ *   0  'N'
+ *   1  'T'
+ *   2  Frame type (NOTE_FRAME_*)
+ *   3  Reserved, zero
+ *   4  Sequence number, incremented per frame (2 bytes)
+ *   6  Payload length (2 bytes)
+ *
+ * A NOTE_FRAME_DATA payload is the raw content of one read() of /dev/note:
+ * whole notes, exactly as the scheduler recorded them.
+ *
+ * A NOTE_FRAME_INFO payload describes how to decode those notes on this
+ * target.  It is sent first and then periodically, so that a receiver can
+ * join a stream at any time.  The layout is given by the NOTE_INFO_*
+ * offsets below, followed by NOTE_INFO_NTYPES note type values indexed by
+ * NOTE_KIND_*, 0xff for types not recorded by this configuration.
+ */
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define NOTE_FRAME_MAGIC0        'N'
+#define NOTE_FRAME_MAGIC1        'T'
+#define NOTE_FRAME_HDRSIZE       8
+
+#define NOTE_FRAME_INFO          1
+#define NOTE_FRAME_DATA          2
+
+#define NOTE_STREAM_VERSION      1
+
+/* NOTE_FRAME_INFO payload */
+
+#define NOTE_INFO_VERSION        0   /* NOTE_STREAM_VERSION */
+#define NOTE_INFO_NCPUS          1   /* Number of CPUs */
+#define NOTE_INFO_USECPERTICK    2   /* Microseconds per tick (4) */
+#define NOTE_INFO_COMMONSIZE     6   /* Size of the common note header */
+#define NOTE_INFO_OFFCPU         7   /* Offset of the CPU, 0xff if not SMP */
+#define NOTE_INFO_OFFPID         8   /* Offset of the PID (2) */
+#define NOTE_INFO_OFFTIME        9   /* Offset of the time stamp (4) */
+#define NOTE_INFO_OFFNAME        10  /* Offset of the name in start notes */
+#define NOTE_INFO_NAMESIZE       11  /* Task name size, 0 if none */
+#define NOTE_INFO_NTYPES         12  /* Number of type values that follow */
+#define NOTE_INFO_TYPES          13
+
+/* Kinds of notes in the type table of NOTE_FRAME_INFO */
+
+#define NOTE_KIND_START          0
+#define NOTE_KIND_STOP           1
+#define NOTE_KIND_SUSPEND        2
+#define NOTE_KIND_RESUME         3
+#define NOTE_KIND_PREEMPT_LOCK   4
+#define NOTE_KIND_PREEMPT_UNLOCK 5
+#define NOTE_KIND_CSECTION_ENTER 6
+#define NOTE_KIND_CSECTION_LEAVE 7
+#define NOTE_NKINDS              8
+
+#define NOTE_KIND_NONE           0xff
+
+#define NOTE_INFO_SIZE           (NOTE_INFO_TYPES + NOTE_NKINDS)
+
+/* A new NOTE_FRAME_INFO every this many data frames */
+
+#define NOTE_INFO_PERIOD         64
+
+#endif /* __APPS_SYSTEM_SCHED_NOTE_NOTE_STREAM_H */
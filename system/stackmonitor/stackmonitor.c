@@ -41,9 +41,13 @@
 
 #include <sys/types.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <sched.h>
 #include <syslog.h>
+#include <fcntl.h>
 #include <errno.h>
 
 #include <nuttx/arch.h>
@@ -70,15 +74,71 @@
 #  define CONFIG_SYSTEM_STACKMONITOR_INTERVAL 2
 #endif
 
+#ifndef CONFIG_SYSTEM_STACKMONITOR_NTASKS
+#  define CONFIG_SYSTEM_STACKMONITOR_NTASKS 32
+#endif
+
+#ifndef CONFIG_SYSTEM_STACKMONITOR_BUDGET
+#  define CONFIG_SYSTEM_STACKMONITOR_BUDGET 64
+#endif
+
+#ifndef CONFIG_SYSTEM_STACKMONITOR_RESCAN
+#  define CONFIG_SYSTEM_STACKMONITOR_RESCAN 30
+#endif
+
+#ifndef CONFIG_SYSTEM_STACKMONITOR_THRESHOLD
+#  define CONFIG_SYSTEM_STACKMONITOR_THRESHOLD 0
+#endif
+
+#ifndef CONFIG_SYSTEM_STACKMONITOR_DEVPATH
+#  define CONFIG_SYSTEM_STACKMONITOR_DEVPATH ""
+#endif
+
+/* The incremental scan stops below the high-water mark after this many
+ * consecutive words that still hold the stack color.  Larger values
+ * tolerate larger untouched local variables at the cost of some more
+ * reads.
+ */
+
+#define STKMON_GAP 16
+
+#define STKMON_ALIGN_DOWN(a) ((uintptr_t)(a) & ~(uintptr_t)3)
+#define STKMON_ALIGN_UP(a)   (((uintptr_t)(a) + 3) & ~(uintptr_t)3)
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
+/* What is known about the stack of one task.  The words from the stack
+ * limit up to 'mark' held the stack color at the last scan.
+ */
+
+struct stkmon_task_s
+{
+  bool      inuse;
+  bool      report;       /* Usage to be reported after this pass */
+  uint8_t   pass;         /* Last pass that saw the task */
+  pid_t     pid;
+  FAR void *top;          /* Identifies the stack if the pid is reused */
+  size_t    size;
+  size_t    used;         /* High-water mark in bytes */
+  size_t    reported;     /* Usage reported last */
+  uintptr_t mark;         /* Lowest word found to be in use */
+  uintptr_t pos;          /* Where an interrupted scan continues */
+  uint32_t  color;
+#if CONFIG_TASK_NAME_SIZE > 0
+  char      name[CONFIG_TASK_NAME_SIZE + 1];
+#endif
+};
+
 struct stkmon_state_s
 {
   volatile bool started;
   volatile bool stop;
   pid_t pid;
+  uint8_t pass;           /* Number of the current pass */
+  unsigned int nlost;     /* Tasks with no entry in this pass */
+  struct stkmon_task_s tasks[CONFIG_SYSTEM_STACKMONITOR_NTASKS];
 };
 
 /****************************************************************************
@@ -91,36 +151,307 @@ static struct stkmon_state_s g_stackmonitor;
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: stkmon_fullscan
+ *
+ * Description:
+ *   Let the architecture measure the stack usage from the stack limit up,
+ *   and remember where the colored area ends.
+ *
+ ****************************************************************************/
+
+static void stkmon_fullscan(FAR struct tcb_s *tcb,
+                            FAR struct stkmon_task_s *task)
+{
+  uintptr_t top = STKMON_ALIGN_DOWN(tcb->adj_stack_ptr);
+
+  task->used = up_check_tcbstack(tcb);
+  if (task->used > task->size)
+    {
+      task->used = task->size;
+    }
+
+  task->mark = STKMON_ALIGN_DOWN(top - task->used);
+  task->pos  = task->mark;
+
+  /* The word below the mark still has the stack color, so that the
+   * incremental scan does not need to know the color used by the
+   * architecture.
+   */
+
+  if (task->used < task->size)
+    {
+      task->color = *(FAR uint32_t *)(task->mark - sizeof(uint32_t));
+    }
+}
+
+/****************************************************************************
+ * Name: stkmon_scan
+ *
+ * Description:
+ *   Continue below the last high-water mark: the stack only grows down, so
+ *   the used part above the mark need not be read again.  The scan ends
+ *   after STKMON_GAP words that are still colored, at the stack limit, or
+ *   when the per-task budget of words is spent, in which case the next
+ *   pass picks up where this one stopped.
+ *
+ ****************************************************************************/
+
+static void stkmon_scan(FAR struct tcb_s *tcb, FAR struct stkmon_task_s *task)
+{
+  uintptr_t limit;
+  uintptr_t addr;
+  uintptr_t top;
+  int budget = CONFIG_SYSTEM_STACKMONITOR_BUDGET;
+  int clean = 0;
+
+  if (task->used >= task->size)
+    {
+      return;
+    }
+
+  top   = STKMON_ALIGN_DOWN(tcb->adj_stack_ptr);
+  limit = STKMON_ALIGN_UP(top - task->size);
+
+  for (addr = task->pos; addr > limit && clean < STKMON_GAP; )
+    {
+      if (budget-- <= 0)
+        {
+          task->pos = addr;
+          break;
+        }
+
+      addr -= sizeof(uint32_t);
+      if (*(FAR uint32_t *)addr != task->color)
+        {
+          task->mark = addr;
+          clean = 0;
+        }
+      else
+        {
+          clean++;
+        }
+    }
+
+  if (budget >= 0)
+    {
+      task->pos = task->mark;
+    }
+
+  task->used = top - task->mark;
+}
+
+/****************************************************************************
+ * Name: stkmon_find
+ ****************************************************************************/
+
+static FAR struct stkmon_task_s *stkmon_find(FAR struct tcb_s *tcb)
+{
+  FAR struct stkmon_task_s *unused = NULL;
+  FAR struct stkmon_task_s *task;
+  int i;
+
+  for (i = 0; i < CONFIG_SYSTEM_STACKMONITOR_NTASKS; i++)
+    {
+      task = &g_stackmonitor.tasks[i];
+      if (!task->inuse)
+        {
+          if (unused == NULL)
+            {
+              unused = task;
+            }
+        }
+      else if (task->pid == tcb->pid)
+        {
+          if (task->top == tcb->adj_stack_ptr)
+            {
+              return task;
+            }
+
+          /* The pid was reused for a new task */
+
+          unused = task;
+          break;
+        }
+    }
+
+  if (unused != NULL)
+    {
+      memset(unused, 0, sizeof(struct stkmon_task_s));
+      unused->inuse = true;
+      unused->pid   = tcb->pid;
+      unused->top   = tcb->adj_stack_ptr;
+      unused->size  = tcb->adj_stack_size;
+#if CONFIG_TASK_NAME_SIZE > 0
+      strncpy(unused->name, tcb->name, CONFIG_TASK_NAME_SIZE);
+#endif
+    }
+
+  return unused;
+}
+
 /****************************************************************************
  * Name: stkmon_task
+ *
+ * Description:
+ *   Update the high-water mark of one task.  This runs inside of
+ *   sched_foreach() with interrupts disabled, so the output is left for
+ *   later.
+ *
  ****************************************************************************/
 
 static void stkmon_task(FAR struct tcb_s *tcb, FAR void *arg)
+{
+  FAR struct stkmon_task_s *task;
+  bool rescan = *(FAR bool *)arg;
+
+  task = stkmon_find(tcb);
+  if (task == NULL)
+    {
+      g_stackmonitor.nlost++;
+      return;
+    }
+
+  if (task->pass == 0 || rescan)
+    {
+      stkmon_fullscan(tcb, task);
+    }
+  else
+    {
+      stkmon_scan(tcb, task);
+    }
+
+  task->pass = g_stackmonitor.pass;
+
+#if CONFIG_SYSTEM_STACKMONITOR_THRESHOLD > 0
+  /* Report a task when it first crosses the threshold, then whenever it
+   * uses more.
+   */
+
+  if (task->used > task->reported &&
+      task->used * 100 >= task->size * CONFIG_SYSTEM_STACKMONITOR_THRESHOLD)
+    {
+      task->report = true;
+    }
+#else
+  task->report = true;
+#endif
+}
+
+/****************************************************************************
+ * Name: stkmon_report
+ ****************************************************************************/
+
+static void stkmon_report(int fd, FAR struct stkmon_task_s *task)
 {
 #if CONFIG_TASK_NAME_SIZE > 0
-  syslog(LOG_INFO, "%5d %6d %6d %s\n",
-         tcb->pid, tcb->adj_stack_size, up_check_tcbstack(tcb), tcb->name);
+  FAR const char *name = task->name;
 #else
-  syslog(LOG_INFO, "%5d %6d %6d\n",
-         tcb->pid, tcb->adj_stack_size, up_check_tcbstack(tcb));
+  FAR const char *name = "";
 #endif
+
+  if (fd >= 0)
+    {
+      /* One comma separated record per line: pid,size,used,name */
+
+      dprintf(fd, "%d,%lu,%lu,%s\n", (int)task->pid,
+              (unsigned long)task->size, (unsigned long)task->used, name);
+    }
+  else
+    {
+      syslog(LOG_INFO, "%5d %6lu %6lu %s\n", (int)task->pid,
+             (unsigned long)task->size, (unsigned long)task->used, name);
+    }
+
+  task->reported = task->used;
+  task->report   = false;
 }
 
 static int stackmonitor_daemon(int argc, char **argv)
 {
+  FAR struct stkmon_task_s *task;
+  unsigned int npasses = 0;
+  bool header;
+  bool rescan;
+  int fd = -1;
+  int i;
+
   syslog(LOG_INFO, STKMON_PREFIX "Running: %d\n", g_stackmonitor.pid);
 
+  if (CONFIG_SYSTEM_STACKMONITOR_DEVPATH[0] != '\0')
+    {
+      fd = open(CONFIG_SYSTEM_STACKMONITOR_DEVPATH,
+                O_WRONLY | O_CREAT | O_APPEND, 0666);
+      if (fd < 0)
+        {
+          syslog(LOG_INFO, STKMON_PREFIX "ERROR: Failed to open %s: %d\n",
+                 CONFIG_SYSTEM_STACKMONITOR_DEVPATH, errno);
+        }
+    }
+
   /* Loop until we detect that there is a request to stop. */
 
   while (!g_stackmonitor.stop)
     {
       sleep(CONFIG_SYSTEM_STACKMONITOR_INTERVAL);
-#if CONFIG_TASK_NAME_SIZE > 0
-      syslog(LOG_INFO, "%-5s %-6s %-6s %s\n", "PID", "SIZE", "USED", "THREAD NAME");
-#else
-      syslog(LOG_INFO, "%-5s %-6s %-6s\n", "PID", "SIZE", "USED");
-#endif
-      sched_foreach(stkmon_task, NULL);
+
+      /* Pass numbers are never 0, which marks a task not scanned yet */
+
+      if (++g_stackmonitor.pass == 0)
+        {
+          g_stackmonitor.pass = 1;
+        }
+
+      /* Let the architecture rescan every stack now and then, in case that
+       * a frame skipped more than STKMON_GAP words below the mark.
+       */
+
+      rescan = CONFIG_SYSTEM_STACKMONITOR_RESCAN > 0 &&
+               ++npasses % CONFIG_SYSTEM_STACKMONITOR_RESCAN == 0;
+
+      g_stackmonitor.nlost = 0;
+      sched_foreach(stkmon_task, &rescan);
+
+      header = false;
+      for (i = 0; i < CONFIG_SYSTEM_STACKMONITOR_NTASKS; i++)
+        {
+          task = &g_stackmonitor.tasks[i];
+          if (!task->inuse)
+            {
+              continue;
+            }
+
+          /* Forget the tasks that have exited */
+
+          if (task->pass != g_stackmonitor.pass)
+            {
+              task->inuse = false;
+              continue;
+            }
+
+          if (task->report)
+            {
+              if (!header && fd < 0)
+                {
+                  syslog(LOG_INFO, "%-5s %-6s %-6s %s\n",
+                         "PID", "SIZE", "USED", "THREAD NAME");
+                  header = true;
+                }
+
+              stkmon_report(fd, task);
+            }
+        }
+
+      if (g_stackmonitor.nlost > 0)
+        {
+          syslog(LOG_INFO, STKMON_PREFIX "%u tasks not monitored\n",
+                 g_stackmonitor.nlost);
+        }
+    }
+
+  if (fd >= 0)
+    {
+      close(fd);
     }
 
   /* Stopped */
@@ -43,10 +43,48 @@
 
 #include <nuttx/compiler.h>
 #include <sys/boardctl.h>
+#include <string.h>
+#include <syslog.h>
 #include "system/symtab.h"
 
 #include "symtab.inc"
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: symtab_checkorder
+ *
+ * Description:
+ *   With CONFIG_SYMTAB_ORDEREDBYNAME, the loaders look up symbols with a
+ *   binary search that silently misses symbols if the table is not in
+ *   strcmp() order.  That happens if symtab.csv was sorted in a locale
+ *   other than "C".
+ *
+ * Returned Value:
+ *   The index of the first entry that is out of order or zero if the table
+ *   is properly ordered.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYMTAB_ORDEREDBYNAME
+static int symtab_checkorder(void)
+{
+  int i;
+
+  for (i = 1; i < NSYMBOLS; i++)
+    {
+      if (strcmp(g_symtab[i - 1].sym_name, g_symtab[i].sym_name) >= 0)
+        {
+          return i;
+        }
+    }
+
+  return 0;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -71,6 +109,17 @@ void symtab_initialize(void)
 
   struct boardioc_symtab_s symdesc;
 
+#ifdef CONFIG_SYMTAB_ORDEREDBYNAME
+  int i = symtab_checkorder();
+  if (i > 0)
+    {
+      syslog(LOG_ERR, "symtab: %s is out of order, regenerate symtab.inc "
+             "from a symtab.csv sorted with LC_ALL=C\n",
+             g_symtab[i].sym_name);
+      return;
+    }
+#endif
+
   symdesc.symtab   = g_symtab;
   symdesc.nsymbols = NSYMBOLS;
   (void)boardctl(BOARDIOC_APP_SYMTAB, (uintptr_t)&symdesc);
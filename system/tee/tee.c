@@ -50,7 +50,9 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 
+#include <stdbool.h>
 #include <signal.h>
+#include <poll.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <unistd.h>
@@ -63,7 +65,11 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
-#define BSIZE         1024
+#ifndef CONFIG_SYSTEM_TEE_BUFSIZE
+#  define CONFIG_SYSTEM_TEE_BUFSIZE 4096
+#endif
+
+#define BSIZE         CONFIG_SYSTEM_TEE_BUFSIZE
 #define STDIN_FILENO  0
 #define STDOUT_FILENO 1
 
@@ -102,6 +108,23 @@ static int tee_add(int fd, FAR char *name,
   return OK;
 }
 
+/* Return true if more input can be read without waiting */
+
+static bool tee_pending(int fd)
+{
+#ifndef CONFIG_DISABLE_POLL
+  struct pollfd fds;
+
+  fds.fd      = fd;
+  fds.events  = POLLIN;
+  fds.revents = 0;
+
+  return poll(&fds, 1, 0) > 0 && (fds.revents & POLLIN) != 0;
+#else
+  return false;
+#endif
+}
+
 static void show_usage(FAR const char *progrname, int exitcode)
 {
   fprintf(stderr, "USAGE: tee [-a] [file ...]\n");
@@ -136,6 +159,7 @@ int tee_main(int argc, char *argv[])
   int exitcode = EXIT_FAILURE;
   int rval;
   int wval;
+  int len;
   int ret;
   int fd;
   int ch;
@@ -195,11 +219,34 @@ int tee_main(int argc, char *argv[])
         }
     }
 
-  while ((rval = read(STDIN_FILENO, buf, BSIZE)) > 0)
+  for (; ; )
     {
+      /* Gather input into the buffer until it is full or no more input is
+       * waiting, so that each output sees one large write instead of one
+       * small write per read.
+       */
+
+      len = 0;
+      do
+        {
+          rval = read(STDIN_FILENO, buf + len, BSIZE - len);
+          if (rval <= 0)
+            {
+              break;
+            }
+
+          len += rval;
+        }
+      while (len < BSIZE && tee_pending(STDIN_FILENO));
+
+      if (len == 0)
+        {
+          break;
+        }
+
       for (curr = head; curr; curr = curr->next)
         {
-          n  = rval;
+          n  = len;
           bp = buf;
 
           do
@@ -51,6 +51,8 @@ enum ubloxmodem_cmd
   UBLOXMODEM_CMD_RESET,
   UBLOXMODEM_CMD_STATUS,
   UBLOXMODEM_CMD_AT,
+  UBLOXMODEM_CMD_CMD,
+  UBLOXMODEM_CMD_URC,
 };
 
 /* App context */
@@ -52,6 +52,7 @@
 
 #include <nuttx/modem/u-blox.h>
 
+#include "system/ubxmdm.h"
 #include "ubloxmodem.h"
 
 /****************************************************************************
@@ -75,6 +76,10 @@
 #  define CONFIG_SYSTEM_UBLOXMODEM_TTY_DEVNODE  "/dev/ttyS1"
 #endif
 
+#define UBLOXMODEM_CMD_TIMEOUT   (5 * 1000)
+#define UBLOXMODEM_MAX_PIPELINE  8
+#define UBLOXMODEM_RESPSIZE      256
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -85,6 +90,8 @@ static int ubloxmodem_off   (FAR struct ubloxmodem_cxt* cxt);
 static int ubloxmodem_reset (FAR struct ubloxmodem_cxt* cxt);
 static int ubloxmodem_status(FAR struct ubloxmodem_cxt* cxt);
 static int ubloxmodem_at    (FAR struct ubloxmodem_cxt* cxt);
+static int ubloxmodem_cmd   (FAR struct ubloxmodem_cxt* cxt);
+static int ubloxmodem_urc   (FAR struct ubloxmodem_cxt* cxt);
 
 /* Mapping of command indices (@ubloxmodem_cmd@ implicit from the position in
  * the list) to tuples containing the command handler and descriptive
@@ -99,6 +106,10 @@ static const struct cmdinfo cmdmap[] =
   {ubloxmodem_reset,  "reset",  "Reset",       NULL},
   {ubloxmodem_status, "status", "Show status", NULL},
   {ubloxmodem_at,     "at",     "AT test",     "<AT cmd> <response>"},
+  {ubloxmodem_cmd,    "cmd",    "AT commands in one line",
+                                "<cmd> [<cmd>...], e.g. +CREG? +CSQ"},
+  {ubloxmodem_urc,    "urc",    "Wait for URCs",
+                                "<seconds> [<prefix>...]"},
 };
 
 /****************************************************************************
@@ -368,6 +379,85 @@ static int ubloxmodem_at(FAR struct ubloxmodem_cxt* cxt)
   return ret;
 }
 
+static int ubloxmodem_cmd(FAR struct ubloxmodem_cxt* cxt)
+{
+  struct ubxmdm_session_s session;
+  char resp[UBLOXMODEM_RESPSIZE];
+  int ncmds;
+  int ret;
+
+  ncmds = cxt->argc - 2;
+  if (ncmds < 1 || ncmds > UBLOXMODEM_MAX_PIPELINE)
+    {
+      fprintf(stderr, "ERROR: expected 1..%d commands\n",
+              UBLOXMODEM_MAX_PIPELINE);
+      return -EINVAL;
+    }
+
+  ret = ubxmdm_open(&session, NULL, NULL);
+  if (ret < 0)
+    {
+      fprintf(stderr, "ERROR: cannot open modem session: %d\n", ret);
+      return ret;
+    }
+
+  ret = ubxmdm_pipeline(&session, (FAR const char * const *)&cxt->argv[2],
+                        ncmds, resp, sizeof(resp), UBLOXMODEM_CMD_TIMEOUT);
+  printf("%s", resp);
+
+  ubxmdm_close(&session);
+  return ret;
+}
+
+static void ubloxmodem_urc_print(FAR void *arg, FAR const char *line)
+{
+  printf("%s\n", line);
+}
+
+static int ubloxmodem_urc(FAR struct ubloxmodem_cxt* cxt)
+{
+  struct ubxmdm_session_s session;
+  int seconds;
+  int ret;
+  int i;
+
+  if (cxt->argc < 3)
+    {
+      fprintf(stderr, "ERROR: missing arguments\n");
+      return -EINVAL;
+    }
+
+  seconds = atoi(cxt->argv[2]);
+
+  ret = ubxmdm_open(&session, NULL, NULL);
+  if (ret < 0)
+    {
+      fprintf(stderr, "ERROR: cannot open modem session: %d\n", ret);
+      return ret;
+    }
+
+  /* With no prefix given, every line that starts with '+' is shown */
+
+  if (cxt->argc == 3)
+    {
+      ubxmdm_urc_register(&session, "+", ubloxmodem_urc_print, NULL);
+    }
+
+  for (i = 3; i < cxt->argc && ret == OK; i++)
+    {
+      ret = ubxmdm_urc_register(&session, cxt->argv[i],
+                                ubloxmodem_urc_print, NULL);
+    }
+
+  if (ret == OK)
+    {
+      printf("%d URCs\n", ubxmdm_poll(&session, seconds * 1000));
+    }
+
+  ubxmdm_close(&session);
+  return ret;
+}
+
 static int ubloxmodem_parse(FAR struct ubloxmodem_cxt* cxt)
 {
   int i;
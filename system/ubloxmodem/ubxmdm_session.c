@@ -0,0 +1,635 @@
+/****************************************************************************
+ * apps/system/ubloxmodem/ubxmdm_session.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/ioctl.h>
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <nuttx/modem/u-blox.h>
+
+#ifdef CONFIG_NETUTILS_CHAT
+#  include "netutils/chat.h"
+#endif
+
+#include "system/ubxmdm.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_SYSTEM_UBLOXMODEM_TTY_DEVNODE
+#  define CONFIG_SYSTEM_UBLOXMODEM_TTY_DEVNODE  "/dev/ttyS1"
+#endif
+
+#ifndef CONFIG_SYSTEM_UBLOXMODEM_DEVNODE
+#  define CONFIG_SYSTEM_UBLOXMODEM_DEVNODE      "/dev/ubxmdm"
+#endif
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define UBXMDM_CLOCK  CLOCK_MONOTONIC
+#else
+#  define UBXMDM_CLOCK  CLOCK_REALTIME
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void ubxmdm_deadline(FAR struct timespec *deadline, int timeout_ms)
+{
+  clock_gettime(UBXMDM_CLOCK, deadline);
+  deadline->tv_sec  += timeout_ms / 1000;
+  deadline->tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+  if (deadline->tv_nsec >= 1000000000)
+    {
+      deadline->tv_sec++;
+      deadline->tv_nsec -= 1000000000;
+    }
+}
+
+static int ubxmdm_ms_left(FAR const struct timespec *deadline)
+{
+  struct timespec now;
+  long ms;
+
+  clock_gettime(UBXMDM_CLOCK, &now);
+  ms = (deadline->tv_sec - now.tv_sec) * 1000 +
+       (deadline->tv_nsec - now.tv_nsec) / 1000000;
+
+  return ms > 0 ? (int)ms : 0;
+}
+
+/* Write all of 'len' bytes to the non-blocking TTY */
+
+static int ubxmdm_write(FAR struct ubxmdm_session_s *session,
+                        FAR const char *buf, size_t len,
+                        FAR const struct timespec *deadline)
+{
+  struct pollfd fds;
+  ssize_t nwritten;
+
+  while (len > 0)
+    {
+      nwritten = write(session->ttyfd, buf, len);
+      if (nwritten < 0)
+        {
+          if (errno != EAGAIN)
+            {
+              return -errno;
+            }
+
+          fds.fd      = session->ttyfd;
+          fds.events  = POLLOUT;
+          fds.revents = 0;
+
+          if (poll(&fds, 1, ubxmdm_ms_left(deadline)) <= 0)
+            {
+              return -ETIMEDOUT;
+            }
+
+          continue;
+        }
+
+      buf += nwritten;
+      len -= nwritten;
+    }
+
+  return OK;
+}
+
+/* Refill the receive buffer with whatever the TTY has, waiting at most
+ * until the deadline for the first byte.
+ */
+
+static int ubxmdm_fill(FAR struct ubxmdm_session_s *session,
+                       FAR const struct timespec *deadline)
+{
+  struct pollfd fds;
+  ssize_t nread;
+
+  fds.fd      = session->ttyfd;
+  fds.events  = POLLIN;
+  fds.revents = 0;
+
+  if (poll(&fds, 1, ubxmdm_ms_left(deadline)) <= 0)
+    {
+      return -ETIMEDOUT;
+    }
+
+  nread = read(session->ttyfd, session->rxbuf, sizeof(session->rxbuf));
+  if (nread < 0)
+    {
+      return errno == EAGAIN ? -ETIMEDOUT : -errno;
+    }
+  else if (nread == 0)
+    {
+      return -ETIMEDOUT;
+    }
+
+  session->rxhead = 0;
+  session->rxtail = nread;
+  return OK;
+}
+
+/* Assemble the next non-empty line into session->line.  Lines longer than
+ * the line buffer are truncated.  Returns the line length or -ETIMEDOUT.
+ */
+
+static int ubxmdm_getline(FAR struct ubxmdm_session_s *session,
+                          FAR const struct timespec *deadline)
+{
+  int ret;
+  char c;
+
+  for (; ; )
+    {
+      if (session->rxhead >= session->rxtail)
+        {
+          ret = ubxmdm_fill(session, deadline);
+          if (ret < 0)
+            {
+              return ret;
+            }
+        }
+
+      c = session->rxbuf[session->rxhead++];
+      if (c == '\r' || c == '\n')
+        {
+          if (session->linelen > 0)
+            {
+              ret = session->linelen;
+              session->line[ret] = '\0';
+              session->linelen = 0;
+              return ret;
+            }
+        }
+      else if (session->linelen < sizeof(session->line) - 1)
+        {
+          session->line[session->linelen++] = c;
+        }
+    }
+}
+
+/* Hand a line to the URC handler registered for its prefix.  Returns true
+ * if there was one.
+ */
+
+static bool ubxmdm_dispatch(FAR struct ubxmdm_session_s *session,
+                            FAR const char *line)
+{
+  FAR struct ubxmdm_urc_s *urc;
+  int i;
+
+  for (i = 0; i < session->nurcs; i++)
+    {
+      urc = &session->urcs[i];
+      if (strncmp(line, urc->prefix, urc->len) == 0)
+        {
+          urc->handler(urc->arg, line);
+          return true;
+        }
+    }
+
+  return false;
+}
+
+/* Tell whether an information line such as "+CREG: 0,1" answers one of the
+ * commands on the command line, which is what separates it from a URC that
+ * has the same prefix.
+ */
+
+static bool ubxmdm_isresponse(FAR const char *cmdline, FAR const char *line)
+{
+  FAR const char *verb;
+  size_t len;
+
+  if (line[0] != '+')
+    {
+      return false;
+    }
+
+  len = strcspn(line, ":");
+  for (verb = strstr(cmdline, "+"); verb != NULL;
+       verb = strstr(verb + 1, "+"))
+    {
+      if (strncasecmp(verb, line, len) == 0 &&
+          !isalnum((unsigned char)verb[len]))
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
+
+static int ubxmdm_final(FAR const char *line)
+{
+  if (strcmp(line, "OK") == 0)
+    {
+      return OK;
+    }
+
+  if (strcmp(line, "ERROR") == 0 ||
+      strncmp(line, "+CME ERROR", 10) == 0 ||
+      strncmp(line, "+CMS ERROR", 10) == 0 ||
+      strcmp(line, "NO CARRIER") == 0)
+    {
+      return -EIO;
+    }
+
+  return 1;
+}
+
+static void ubxmdm_append(FAR char *resp, size_t resplen,
+                          FAR const char *line)
+{
+  size_t used;
+
+  if (resp == NULL || resplen == 0)
+    {
+      return;
+    }
+
+  used = strlen(resp);
+  if (used + 1 < resplen)
+    {
+      strncpy(resp + used, line, resplen - used - 1);
+      resp[resplen - 1] = '\0';
+      used = strlen(resp);
+      if (used + 1 < resplen)
+        {
+          resp[used]     = '\n';
+          resp[used + 1] = '\0';
+        }
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: ubxmdm_open
+ *
+ * Description:
+ *   Open a modem session on the AT command TTY and the power control
+ *   device.  Both stay open until ubxmdm_close().
+ *
+ ****************************************************************************/
+
+int ubxmdm_open(FAR struct ubxmdm_session_s *session,
+                FAR const char *ttydev, FAR const char *mdmdev)
+{
+  int ret;
+
+  memset(session, 0, sizeof(*session));
+
+  session->ttyfd = open(ttydev != NULL ? ttydev :
+                        CONFIG_SYSTEM_UBLOXMODEM_TTY_DEVNODE,
+                        O_RDWR | O_NONBLOCK);
+  if (session->ttyfd < 0)
+    {
+      return -errno;
+    }
+
+  session->mdmfd = open(mdmdev != NULL ? mdmdev :
+                        CONFIG_SYSTEM_UBLOXMODEM_DEVNODE, O_RDWR);
+  if (session->mdmfd < 0)
+    {
+      ret = -errno;
+      close(session->ttyfd);
+      return ret;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: ubxmdm_close
+ ****************************************************************************/
+
+void ubxmdm_close(FAR struct ubxmdm_session_s *session)
+{
+  close(session->ttyfd);
+  close(session->mdmfd);
+  session->ttyfd = -1;
+  session->mdmfd = -1;
+}
+
+/****************************************************************************
+ * Name: ubxmdm_urc_register
+ ****************************************************************************/
+
+int ubxmdm_urc_register(FAR struct ubxmdm_session_s *session,
+                        FAR const char *prefix, ubxmdm_urc_t handler,
+                        FAR void *arg)
+{
+  FAR struct ubxmdm_urc_s *urc;
+
+  if (prefix == NULL || handler == NULL)
+    {
+      return -EINVAL;
+    }
+
+  if (session->nurcs >= CONFIG_SYSTEM_UBLOXMODEM_MAXURCS)
+    {
+      return -ENOSPC;
+    }
+
+  urc          = &session->urcs[session->nurcs++];
+  urc->prefix  = prefix;
+  urc->len     = strlen(prefix);
+  urc->handler = handler;
+  urc->arg     = arg;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: ubxmdm_command
+ *
+ * Description:
+ *   Send one command line and collect its response up to the final result
+ *   code.  The echo of the command, if the modem has echo on, is skipped.
+ *
+ ****************************************************************************/
+
+int ubxmdm_command(FAR struct ubxmdm_session_s *session,
+                   FAR const char *cmd, FAR char *resp, size_t resplen,
+                   int timeout_ms)
+{
+  struct timespec deadline;
+  bool echoed = false;
+  int ret;
+
+  if (resp != NULL && resplen > 0)
+    {
+      resp[0] = '\0';
+    }
+
+  /* URCs already received belong before this command */
+
+  ubxmdm_poll(session, 0);
+
+  ubxmdm_deadline(&deadline, timeout_ms);
+  ret = ubxmdm_write(session, cmd, strlen(cmd), &deadline);
+  if (ret == OK)
+    {
+      ret = ubxmdm_write(session, "\r", 1, &deadline);
+    }
+
+  while (ret == OK)
+    {
+      ret = ubxmdm_getline(session, &deadline);
+      if (ret < 0)
+        {
+          break;
+        }
+
+      if (!echoed && strcmp(session->line, cmd) == 0)
+        {
+          echoed = true;
+          ret = OK;
+          continue;
+        }
+
+      ret = ubxmdm_final(session->line);
+      if (ret <= 0)
+        {
+          if (ret < 0)
+            {
+              ubxmdm_append(resp, resplen, session->line);
+            }
+
+          break;
+        }
+
+      if (ubxmdm_isresponse(cmd, session->line) ||
+          !ubxmdm_dispatch(session, session->line))
+        {
+          ubxmdm_append(resp, resplen, session->line);
+        }
+
+      ret = OK;
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: ubxmdm_pipeline
+ ****************************************************************************/
+
+int ubxmdm_pipeline(FAR struct ubxmdm_session_s *session,
+                    FAR const char * const *cmds, int ncmds,
+                    FAR char *resp, size_t resplen, int timeout_ms)
+{
+  char cmdline[CONFIG_SYSTEM_UBLOXMODEM_LINESIZE];
+  size_t used = 2;
+  size_t len;
+  int i;
+
+  memcpy(cmdline, "AT", 2);
+  for (i = 0; i < ncmds; i++)
+    {
+      len = strlen(cmds[i]);
+      if (used + len + 2 > sizeof(cmdline))
+        {
+          return -E2BIG;
+        }
+
+      if (i > 0)
+        {
+          cmdline[used++] = ';';
+        }
+
+      memcpy(cmdline + used, cmds[i], len);
+      used += len;
+    }
+
+  cmdline[used] = '\0';
+  return ubxmdm_command(session, cmdline, resp, resplen, timeout_ms);
+}
+
+/****************************************************************************
+ * Name: ubxmdm_poll
+ ****************************************************************************/
+
+int ubxmdm_poll(FAR struct ubxmdm_session_s *session, int timeout_ms)
+{
+  struct timespec deadline;
+  int nurcs = 0;
+
+  ubxmdm_deadline(&deadline, timeout_ms);
+  while (ubxmdm_getline(session, &deadline) >= 0)
+    {
+      if (ubxmdm_dispatch(session, session->line))
+        {
+          nurcs++;
+        }
+    }
+
+  return nurcs;
+}
+
+/****************************************************************************
+ * Name: ubxmdm_waitready
+ ****************************************************************************/
+
+int ubxmdm_waitready(FAR struct ubxmdm_session_s *session, int timeout_ms)
+{
+  struct timespec deadline;
+  int pollms;
+  int ret;
+
+  ubxmdm_deadline(&deadline, timeout_ms);
+  do
+    {
+      ret = ubxmdm_command(session, "AT", NULL, 0,
+                           CONFIG_SYSTEM_UBLOXMODEM_READYPOLL);
+      if (ret == OK)
+        {
+          return OK;
+        }
+
+      /* A quick error, e.g. from the start-up noise, does not count as a
+       * poll period.
+       */
+
+      if (ret != -ETIMEDOUT)
+        {
+          pollms = ubxmdm_ms_left(&deadline);
+          if (pollms > CONFIG_SYSTEM_UBLOXMODEM_READYPOLL)
+            {
+              pollms = CONFIG_SYSTEM_UBLOXMODEM_READYPOLL;
+            }
+
+          usleep(pollms * 1000);
+        }
+    }
+  while (ubxmdm_ms_left(&deadline) > 0);
+
+  return -ETIMEDOUT;
+}
+
+/****************************************************************************
+ * Name: ubxmdm_power
+ *
+ * Description:
+ *   Switch the modem power state without closing the session.  Power on
+ *   and reset return as soon as the modem accepts commands.
+ *
+ ****************************************************************************/
+
+int ubxmdm_power(FAR struct ubxmdm_session_s *session,
+                 enum ubxmdm_power_e state)
+{
+  int cmd;
+
+  switch (state)
+    {
+      case UBXMDM_POWER_OFF:
+        cmd = MODEM_IOC_POWEROFF;
+        break;
+
+      case UBXMDM_POWER_ON:
+        cmd = MODEM_IOC_POWERON;
+        break;
+
+      case UBXMDM_POWER_RESET:
+        cmd = MODEM_IOC_RESET;
+        break;
+
+      default:
+        return -EINVAL;
+    }
+
+  if (ioctl(session->mdmfd, cmd, 0) < 0)
+    {
+      return -errno;
+    }
+
+  /* Whatever was buffered came from the previous power cycle */
+
+  session->rxhead  = 0;
+  session->rxtail  = 0;
+  session->linelen = 0;
+
+  if (state == UBXMDM_POWER_OFF)
+    {
+      return OK;
+    }
+
+  return ubxmdm_waitready(session, CONFIG_SYSTEM_UBLOXMODEM_READYTIMEOUT);
+}
+
+#ifdef CONFIG_NETUTILS_CHAT
+/****************************************************************************
+ * Name: ubxmdm_chat
+ *
+ * Description:
+ *   Run a chat script on the session TTY.  URCs already received are
+ *   dispatched first; the chat engine discards pending input when it
+ *   starts.
+ *
+ ****************************************************************************/
+
+int ubxmdm_chat(FAR struct ubxmdm_session_s *session, FAR char *script,
+                int timeout_s)
+{
+  struct chat_ctl ctl;
+
+  ubxmdm_poll(session, 0);
+
+  ctl.fd      = session->ttyfd;
+  ctl.echo    = false;
+  ctl.verbose = false;
+  ctl.timeout = timeout_s;
+
+  return chat(&ctl, script);
+}
+#endif
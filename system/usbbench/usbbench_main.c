@@ -0,0 +1,762 @@
+/****************************************************************************
+ * apps/system/usbbench/usbbench_main.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/ioctl.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
+
+#include <nuttx/fs/fs.h>
+#include <nuttx/usb/usbdev_trace.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Configuration ************************************************************/
+
+#ifndef CONFIG_SYSTEM_USBBENCH_BLKDEV
+#  define CONFIG_SYSTEM_USBBENCH_BLKDEV "/dev/mmcsd0"
+#endif
+
+#ifndef CONFIG_SYSTEM_USBBENCH_TTYDEV
+#  define CONFIG_SYSTEM_USBBENCH_TTYDEV "/dev/ttyACM0"
+#endif
+
+#ifndef CONFIG_SYSTEM_USBBENCH_MAXREQ
+#  define CONFIG_SYSTEM_USBBENCH_MAXREQ 65536
+#endif
+
+#ifndef CONFIG_SYSTEM_USBBENCH_TOTAL
+#  define CONFIG_SYSTEM_USBBENCH_TOTAL 262144
+#endif
+
+#ifndef CONFIG_SYSTEM_USBBENCH_SAMPLEMS
+#  define CONFIG_SYSTEM_USBBENCH_SAMPLEMS 100
+#endif
+
+#if defined(CONFIG_USBDEV_TRACE) || \
+    (defined(CONFIG_DEBUG_FEATURES) && defined(CONFIG_DEBUG_USB))
+#  define HAVE_USBTRACE 1
+#endif
+
+#define USBBENCH_TRACE_BITS  (TRACE_READ_BIT | TRACE_WRITE_BIT)
+#define USBBENCH_NSIZES      17    /* Size classes 1 .. 64 KiB, powers of 2 */
+#define USBBENCH_CDCMIN      64    /* Full speed bulk packet size */
+#define USBBENCH_CDCIDLE     2000  /* End of the read test (ms idle) */
+#define USBBENCH_GOOD        90    /* "Good enough" percentage of the peak */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The block device read speed for each request size */
+
+struct usbbench_blk_s
+{
+  bool     valid;
+  uint32_t sectorsize;
+  uint32_t reqsize[USBBENCH_NSIZES];
+  uint32_t kbps[USBBENCH_NSIZES];
+  int      nsizes;
+};
+
+/* USB transfers seen in the trace, by direction and size class */
+
+struct usbbench_xfer_s
+{
+  uint32_t count[2][USBBENCH_NSIZES];
+  uint32_t nxfers[2];
+  uint64_t nbytes[2];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct usbbench_blk_s g_usbbench_blk;
+
+static FAR const char *g_usbbench_dir[2] =
+{
+  "OUT (host to device)", "IN (device to host)"
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t usbbench_usnow(void)
+{
+  struct timespec ts;
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+  clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static uint32_t usbbench_msnow(void)
+{
+  return (uint32_t)(usbbench_usnow() / 1000);
+}
+
+static uint32_t usbbench_kbps(uint64_t nbytes, uint32_t elapsed_ms)
+{
+  return elapsed_ms > 0 ? (uint32_t)(nbytes / elapsed_ms) : 0;
+}
+
+/* Fast transfers complete in well under a millisecond */
+
+static uint32_t usbbench_uskbps(uint64_t nbytes, uint64_t elapsed_us)
+{
+  return elapsed_us > 0 ? (uint32_t)(nbytes * 1000 / elapsed_us) : 0;
+}
+
+/* Index of the power-of-two size class of a transfer length */
+
+static int usbbench_sizeclass(uint32_t len)
+{
+  int i = 0;
+
+  while (i < USBBENCH_NSIZES - 1 && ((uint32_t)1 << i) < len)
+    {
+      i++;
+    }
+
+  return i;
+}
+
+/* The smallest size that reaches USBBENCH_GOOD percent of the best
+ * throughput in a table of sizes and speeds.
+ */
+
+static int usbbench_goodsize(FAR const uint32_t *reqsize,
+                             FAR const uint32_t *kbps, int nsizes)
+{
+  uint32_t peak = 0;
+  int i;
+
+  for (i = 0; i < nsizes; i++)
+    {
+      if (kbps[i] > peak)
+        {
+          peak = kbps[i];
+        }
+    }
+
+  for (i = 0; i < nsizes; i++)
+    {
+      if (kbps[i] * 100 >= peak * USBBENCH_GOOD)
+        {
+          return i;
+        }
+    }
+
+  return nsizes - 1;
+}
+
+/* Block device read speed for one request size.  Each size reads a
+ * different part of the device so that a cache does not skew the result.
+ */
+
+static int usbbench_blkread(int fd, FAR uint8_t *buffer, uint32_t reqsize,
+                            off_t start, off_t devsize)
+{
+  uint32_t total = CONFIG_SYSTEM_USBBENCH_TOTAL;
+  uint32_t done = 0;
+  uint64_t t0;
+  ssize_t  nread;
+
+  if (devsize > 0 && total > devsize)
+    {
+      total = devsize;
+    }
+
+  if (devsize > 0 && start + total > devsize)
+    {
+      start = 0;
+    }
+
+  if (lseek(fd, start, SEEK_SET) < 0)
+    {
+      return -errno;
+    }
+
+  t0 = usbbench_usnow();
+  while (done < total)
+    {
+      nread = read(fd, buffer, reqsize);
+      if (nread <= 0)
+        {
+          return nread < 0 ? -errno : -EIO;
+        }
+
+      done += nread;
+    }
+
+  return usbbench_uskbps(done, usbbench_usnow() - t0);
+}
+
+static void usbbench_blkadvice(FAR const struct usbbench_blk_s *blk)
+{
+  int good = usbbench_goodsize(blk->reqsize, blk->kbps, blk->nsizes);
+
+  printf("\nBlock reads of %lu bytes reach %d%% of the best speed.\n",
+         (unsigned long)blk->reqsize[good], USBBENCH_GOOD);
+  printf("The mass storage class reads and writes the media one request\n"
+         "buffer at a time, so set\n"
+         "  CONFIG_USBMSC_BULKINREQLEN=%lu\n"
+         "  CONFIG_USBMSC_BULKOUTREQLEN=%lu\n",
+         (unsigned long)blk->reqsize[good],
+         (unsigned long)blk->reqsize[good]);
+  printf("and at least two of each request (CONFIG_USBMSC_NRDREQS,\n"
+         "CONFIG_USBMSC_NWRREQS), so that the media and USB overlap.\n");
+
+#if defined(CONFIG_USBMSC_BULKINREQLEN) && defined(CONFIG_USBMSC_NRDREQS)
+  printf("Currently: BULKINREQLEN=%d NRDREQS=%d",
+         CONFIG_USBMSC_BULKINREQLEN, CONFIG_USBMSC_NRDREQS);
+#  if defined(CONFIG_USBMSC_BULKOUTREQLEN) && defined(CONFIG_USBMSC_NWRREQS)
+  printf(" BULKOUTREQLEN=%d NWRREQS=%d",
+         CONFIG_USBMSC_BULKOUTREQLEN, CONFIG_USBMSC_NWRREQS);
+#  endif
+  putchar('\n');
+#endif
+}
+
+static int usbbench_blk(FAR const char *devpath)
+{
+  FAR struct usbbench_blk_s *blk = &g_usbbench_blk;
+  struct geometry geo;
+  FAR uint8_t *buffer;
+  uint32_t reqsize;
+  off_t devsize = 0;
+  off_t start = 0;
+  int fd;
+  int ret;
+  int i;
+
+  fd = open(devpath, O_RDONLY);
+  if (fd < 0)
+    {
+      fprintf(stderr, "ERROR: Failed to open %s: %d\n", devpath, errno);
+      return EXIT_FAILURE;
+    }
+
+  blk->sectorsize = 512;
+  if (ioctl(fd, BIOC_GEOMETRY, (unsigned long)((uintptr_t)&geo)) >= 0 &&
+      geo.geo_available)
+    {
+      blk->sectorsize = geo.geo_sectorsize;
+      devsize = (off_t)geo.geo_nsectors * geo.geo_sectorsize;
+    }
+
+  buffer = malloc(CONFIG_SYSTEM_USBBENCH_MAXREQ);
+  if (buffer == NULL)
+    {
+      fprintf(stderr, "ERROR: Failed to allocate %d bytes\n",
+              CONFIG_SYSTEM_USBBENCH_MAXREQ);
+      close(fd);
+      return EXIT_FAILURE;
+    }
+
+  /* Reads only: the host may have the media mounted */
+
+  printf("%s: sector size %lu, %lu KiB\n", devpath,
+         (unsigned long)blk->sectorsize, (unsigned long)(devsize / 1024));
+  printf("%10s %10s %10s\n", "Request", "KB/s", "us/req");
+
+  blk->nsizes = 0;
+  for (reqsize = blk->sectorsize;
+       reqsize <= CONFIG_SYSTEM_USBBENCH_MAXREQ &&
+       blk->nsizes < USBBENCH_NSIZES;
+       reqsize <<= 1)
+    {
+      ret = usbbench_blkread(fd, buffer, reqsize, start, devsize);
+      if (ret < 0)
+        {
+          fprintf(stderr, "ERROR: Read of %lu bytes failed: %d\n",
+                  (unsigned long)reqsize, -ret);
+          break;
+        }
+
+      i = blk->nsizes++;
+      blk->reqsize[i] = reqsize;
+      blk->kbps[i]    = ret;
+      start          += CONFIG_SYSTEM_USBBENCH_TOTAL;
+
+      printf("%10lu %10lu %10lu\n", (unsigned long)reqsize,
+             (unsigned long)ret,
+             ret > 0 ? (unsigned long)(reqsize * 1000 / ret) : 0);
+    }
+
+  free(buffer);
+  close(fd);
+
+  blk->valid = blk->nsizes > 0;
+  if (!blk->valid)
+    {
+      return EXIT_FAILURE;
+    }
+
+  usbbench_blkadvice(blk);
+  return EXIT_SUCCESS;
+}
+
+#ifdef HAVE_USBTRACE
+static int usbbench_discard(FAR struct usbtrace_s *trace, FAR void *arg)
+{
+  return 0;
+}
+
+static int usbbench_tracecb(FAR struct usbtrace_s *trace, FAR void *arg)
+{
+  FAR struct usbbench_xfer_s *xfer = arg;
+  int dir;
+
+  switch (TRACE_ID(trace->event))
+    {
+      case TRACE_READ_ID:        /* OUT data received */
+        dir = 0;
+        break;
+
+      case TRACE_WRITE_ID:       /* IN data sent */
+        dir = 1;
+        break;
+
+      default:
+        return 0;
+    }
+
+  xfer->count[dir][usbbench_sizeclass(trace->value)]++;
+  xfer->nxfers[dir]++;
+  xfer->nbytes[dir] += trace->value;
+  return 0;
+}
+
+/* Estimated share of the elapsed time that the block device needed to
+ * move the traced bytes, from the block read speed at the mean request
+ * size.
+ */
+
+static void usbbench_share(FAR const struct usbbench_xfer_s *xfer,
+                           uint32_t elapsed)
+{
+  FAR const struct usbbench_blk_s *blk = &g_usbbench_blk;
+  uint64_t nbytes = xfer->nbytes[0] + xfer->nbytes[1];
+  uint32_t nxfers = xfer->nxfers[0] + xfer->nxfers[1];
+  uint32_t mean;
+  uint32_t kbps;
+  uint32_t blkms;
+  int i;
+
+  if (!blk->valid || nxfers == 0 || elapsed == 0)
+    {
+      return;
+    }
+
+  /* The class driver moves whole request buffers through the media, so
+   * the mean USB transfer size is the nearest measured block request.
+   */
+
+  mean = nbytes / nxfers;
+  kbps = blk->kbps[0];
+  for (i = 0; i < blk->nsizes && blk->reqsize[i] <= mean; i++)
+    {
+      kbps = blk->kbps[i];
+    }
+
+  if (kbps == 0)
+    {
+      return;
+    }
+
+  blkms = nbytes / kbps;
+  if (blkms > elapsed)
+    {
+      blkms = elapsed;
+    }
+
+  printf("\nEstimated time in the block device: %lu of %lu ms (%lu%%)\n",
+         (unsigned long)blkms, (unsigned long)elapsed,
+         (unsigned long)(blkms * 100 / elapsed));
+  printf("Time in USB and the class driver:   %lu ms\n",
+         (unsigned long)(elapsed - blkms));
+
+  if (blkms * 2 > elapsed)
+    {
+      printf("The media limits the throughput.\n");
+    }
+  else
+    {
+      printf("USB limits the throughput: larger or more requests help.\n");
+    }
+}
+
+static int usbbench_trace(int seconds)
+{
+  struct usbbench_xfer_s xfer;
+  uint32_t t0;
+  uint32_t tlast;
+  uint32_t now;
+  uint64_t lastbytes[2];
+  int dir;
+  int i;
+
+  memset(&xfer, 0, sizeof(xfer));
+  lastbytes[0] = 0;
+  lastbytes[1] = 0;
+
+  /* Drop older records, then trace the data transfers only */
+
+  (void)usbtrace_enumerate(usbbench_discard, NULL);
+  (void)usbtrace_enable(USBBENCH_TRACE_BITS);
+
+  printf("Tracing USB transfers for %d s; copy files on the host now\n",
+         seconds);
+  printf("%6s %12s %12s\n", "Time", "OUT KB/s", "IN KB/s");
+
+  t0 = tlast = usbbench_msnow();
+  do
+    {
+      usleep(CONFIG_SYSTEM_USBBENCH_SAMPLEMS * 1000);
+      (void)usbtrace_enumerate(usbbench_tracecb, &xfer);
+
+      now = usbbench_msnow();
+      if (now - tlast >= 1000)
+        {
+          printf("%6lu %12lu %12lu\n", (unsigned long)((now - t0) / 1000),
+                 (unsigned long)usbbench_kbps(xfer.nbytes[0] - lastbytes[0],
+                                              now - tlast),
+                 (unsigned long)usbbench_kbps(xfer.nbytes[1] - lastbytes[1],
+                                              now - tlast));
+          lastbytes[0] = xfer.nbytes[0];
+          lastbytes[1] = xfer.nbytes[1];
+          tlast = now;
+        }
+    }
+  while (now - t0 < (uint32_t)seconds * 1000);
+
+  (void)usbtrace_enable(0);
+
+  for (dir = 0; dir < 2; dir++)
+    {
+      printf("\n%s: %lu transfers, %lu KiB, %lu KB/s\n", g_usbbench_dir[dir],
+             (unsigned long)xfer.nxfers[dir],
+             (unsigned long)(xfer.nbytes[dir] / 1024),
+             (unsigned long)usbbench_kbps(xfer.nbytes[dir], now - t0));
+
+      for (i = 0; i < USBBENCH_NSIZES; i++)
+        {
+          if (xfer.count[dir][i] > 0)
+            {
+              printf("  <= %6lu bytes: %lu\n", (unsigned long)1 << i,
+                     (unsigned long)xfer.count[dir][i]);
+            }
+        }
+    }
+
+  if (xfer.nxfers[0] + xfer.nxfers[1] > 0 &&
+      (xfer.count[0][usbbench_sizeclass(USBBENCH_CDCMIN)] +
+       xfer.count[1][usbbench_sizeclass(USBBENCH_CDCMIN)]) * 2 >
+      xfer.nxfers[0] + xfer.nxfers[1])
+    {
+      printf("\nMost transfers are single packets.  The controller driver\n"
+             "may not support multi-packet requests, or the requests are\n"
+             "too short (CONFIG_*_BULKINREQLEN, CONFIG_*_BULKOUTREQLEN).\n");
+    }
+
+  usbbench_share(&xfer, now - t0);
+  return EXIT_SUCCESS;
+}
+#endif /* HAVE_USBTRACE */
+
+static int usbbench_cdcwrite(int fd, FAR uint8_t *buffer)
+{
+  uint32_t reqsize[USBBENCH_NSIZES];
+  uint32_t kbps[USBBENCH_NSIZES];
+  uint32_t reqlen;
+  uint32_t done;
+  uint64_t t0;
+  ssize_t  nwritten;
+  int nsizes = 0;
+  int good;
+
+  printf("CDC/ACM write, drain it on the host\n"
+         "(cat /dev/ttyACM0 > /dev/null)\n");
+  printf("%10s %10s\n", "Write", "KB/s");
+
+  for (reqlen = USBBENCH_CDCMIN;
+       reqlen <= CONFIG_SYSTEM_USBBENCH_MAXREQ && nsizes < USBBENCH_NSIZES;
+       reqlen <<= 1)
+    {
+      t0   = usbbench_usnow();
+      done = 0;
+      while (done < CONFIG_SYSTEM_USBBENCH_TOTAL)
+        {
+          nwritten = write(fd, buffer, reqlen);
+          if (nwritten <= 0)
+            {
+              fprintf(stderr, "ERROR: write failed: %d\n", errno);
+              return EXIT_FAILURE;
+            }
+
+          done += nwritten;
+        }
+
+      reqsize[nsizes] = reqlen;
+      kbps[nsizes]    = usbbench_uskbps(done, usbbench_usnow() - t0);
+      printf("%10lu %10lu\n", (unsigned long)reqlen,
+             (unsigned long)kbps[nsizes]);
+      nsizes++;
+    }
+
+  if (nsizes == 0)
+    {
+      return EXIT_FAILURE;
+    }
+
+  good = usbbench_goodsize(reqsize, kbps, nsizes);
+  printf("\nWrites of %lu bytes reach %d%% of the best speed.  Use at least\n"
+         "that for the application buffer (CONFIG_SYSTEM_COMPOSITE_BUFSIZE\n"
+         "in the composite configuration) and twice it for\n"
+         "CONFIG_CDCACM_TXBUFSIZE.\n",
+         (unsigned long)reqsize[good], USBBENCH_GOOD);
+#ifdef CONFIG_CDCACM_TXBUFSIZE
+  printf("Currently: CDCACM_TXBUFSIZE=%d\n", CONFIG_CDCACM_TXBUFSIZE);
+#endif
+
+  return EXIT_SUCCESS;
+}
+
+static int usbbench_cdcread(int fd, FAR uint8_t *buffer, int seconds)
+{
+  struct pollfd fds;
+  uint32_t reads[USBBENCH_NSIZES];
+  uint64_t nbytes = 0;
+  uint32_t nreads = 0;
+  uint32_t t0 = 0;
+  uint32_t tlast = 0;
+  uint32_t tend;
+  ssize_t  nread;
+  int i;
+
+  memset(reads, 0, sizeof(reads));
+
+  printf("\nCDC/ACM read, send data from the host within %d s\n"
+         "(dd if=/dev/zero of=/dev/ttyACM0 bs=4k count=256)\n", seconds);
+
+  tend = usbbench_msnow() + seconds * 1000;
+  for (; ; )
+    {
+      fds.fd      = fd;
+      fds.events  = POLLIN;
+      fds.revents = 0;
+
+      if (poll(&fds, 1, nreads > 0 ? USBBENCH_CDCIDLE :
+               (int)(tend - usbbench_msnow())) <= 0)
+        {
+          break;
+        }
+
+      nread = read(fd, buffer, CONFIG_SYSTEM_USBBENCH_MAXREQ);
+      if (nread <= 0)
+        {
+          break;
+        }
+
+      tlast = usbbench_msnow();
+      if (nreads == 0)
+        {
+          t0 = tlast;
+        }
+
+      reads[usbbench_sizeclass(nread)]++;
+      nreads++;
+      nbytes += nread;
+    }
+
+  if (nreads < 2)
+    {
+      printf("No data received\n");
+      return EXIT_SUCCESS;
+    }
+
+  printf("%lu KiB in %lu reads, %lu KB/s\n", (unsigned long)(nbytes / 1024),
+         (unsigned long)nreads,
+         (unsigned long)usbbench_kbps(nbytes, tlast - t0));
+
+  for (i = 0; i < USBBENCH_NSIZES; i++)
+    {
+      if (reads[i] > 0)
+        {
+          printf("  <= %6lu bytes: %lu\n", (unsigned long)1 << i,
+                 (unsigned long)reads[i]);
+        }
+    }
+
+  printf("\nThe mean read returns %lu bytes.  If that is close to\n"
+         "CONFIG_CDCACM_RXBUFSIZE, the receive buffer is the limit.\n",
+         (unsigned long)(nbytes / nreads));
+#ifdef CONFIG_CDCACM_RXBUFSIZE
+  printf("Currently: CDCACM_RXBUFSIZE=%d\n", CONFIG_CDCACM_RXBUFSIZE);
+#endif
+
+  return EXIT_SUCCESS;
+}
+
+static int usbbench_cdc(FAR const char *devpath, int seconds)
+{
+  FAR uint8_t *buffer;
+  int ret;
+  int fd;
+
+  fd = open(devpath, O_RDWR);
+  if (fd < 0)
+    {
+      fprintf(stderr, "ERROR: Failed to open %s: %d\n", devpath, errno);
+      return EXIT_FAILURE;
+    }
+
+  buffer = malloc(CONFIG_SYSTEM_USBBENCH_MAXREQ);
+  if (buffer == NULL)
+    {
+      close(fd);
+      return EXIT_FAILURE;
+    }
+
+  /* No newlines, so that no output conversion changes the byte count */
+
+  memset(buffer, 'U', CONFIG_SYSTEM_USBBENCH_MAXREQ);
+
+  ret = usbbench_cdcwrite(fd, buffer);
+  if (ret == EXIT_SUCCESS)
+    {
+      ret = usbbench_cdcread(fd, buffer, seconds);
+    }
+
+  free(buffer);
+  close(fd);
+  return ret;
+}
+
+static void usbbench_help(FAR const char *progname)
+{
+  fprintf(stderr, "USAGE: %s blk [<blockdev>]\n", progname);
+#ifdef HAVE_USBTRACE
+  fprintf(stderr, "       %s trace [<seconds>]\n", progname);
+  fprintf(stderr, "       %s all [<blockdev>] [<seconds>]\n", progname);
+#endif
+  fprintf(stderr, "       %s cdc [<ttydev>] [<seconds>]\n", progname);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: usbbench_main
+ *
+ * Description:
+ *   Measure the block device and USB sides of a connected mass storage or
+ *   CDC/ACM device and recommend request and buffer sizes.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int usbbench_main(int argc, char *argv[])
+#endif
+{
+  FAR const char *cmd = argc > 1 ? argv[1] : "help";
+  int seconds;
+#ifdef HAVE_USBTRACE
+  int ret;
+#endif
+
+  if (strcmp(cmd, "blk") == 0)
+    {
+      return usbbench_blk(argc > 2 ? argv[2] :
+                          CONFIG_SYSTEM_USBBENCH_BLKDEV);
+    }
+
+#ifdef HAVE_USBTRACE
+  if (strcmp(cmd, "trace") == 0)
+    {
+      seconds = argc > 2 ? atoi(argv[2]) : 10;
+      return usbbench_trace(seconds > 0 ? seconds : 10);
+    }
+
+  if (strcmp(cmd, "all") == 0)
+    {
+      ret = usbbench_blk(argc > 2 ? argv[2] : CONFIG_SYSTEM_USBBENCH_BLKDEV);
+      if (ret != EXIT_SUCCESS)
+        {
+          return ret;
+        }
+
+      putchar('\n');
+      seconds = argc > 3 ? atoi(argv[3]) : 10;
+      return usbbench_trace(seconds > 0 ? seconds : 10);
+    }
+#endif
+
+  if (strcmp(cmd, "cdc") == 0)
+    {
+      seconds = argc > 3 ? atoi(argv[3]) : 10;
+      return usbbench_cdc(argc > 2 ? argv[2] : CONFIG_SYSTEM_USBBENCH_TTYDEV,
+                          seconds > 0 ? seconds : 10);
+    }
+
+  usbbench_help(argv[0]);
+  return EXIT_FAILURE;
+}
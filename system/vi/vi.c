@@ -113,6 +113,14 @@
 #define TEXT_GULP_MASK  511  /* Mask for aligning buffer allocation sizes */
 #define ALIGN_GULP(x)   (((x) + TEXT_GULP_MASK) & ~TEXT_GULP_MASK)
 
+/* The text buffer is a gap buffer:  The text before the gap lies at the
+ * beginning of the allocation and the text after the gap lies at the end of
+ * the allocation.  VI_TEXT() maps a logical text offset to the byte in the
+ * buffer holding it.
+ */
+
+#define VI_TEXT(vi,p)   ((vi)->text[(p) < (vi)->gappos ? (p) : (p) + (vi)->gapsize])
+
 #define TABSIZE         8    /* A TAB is eight characters */
 #define TABMASK         7    /* Mask for TAB alignment */
 #define NEXT_TAB(p)     (((p) + TABSIZE) & ~TABMASK)
@@ -284,6 +292,10 @@ struct vi_s
 
   FAR char *text;           /* Dynamically allocated text buffer */
   size_t txtalloc;          /* Current allocated size of the text buffer */
+  off_t gappos;             /* Text offset of the gap in the text buffer */
+  size_t gapsize;           /* Size of the gap in the text buffer */
+  FAR char *shadow;         /* Text last written to each display row */
+  FAR bool *stale;          /* True: Display row content is unknown */
   FAR char *yank;           /* Dynamically allocated yank buffer */
   size_t yankalloc;         /* Current allocated size of the yank buffer */
 
@@ -316,9 +328,9 @@ static void     vi_cursorhome(FAR struct vi_s *vi);
 static void     vi_setcursor(FAR struct vi_s *vi, uint16_t row,
                   uint16_t column);
 static void     vi_clrtoeol(FAR struct vi_s *vi);
-#if 0 /* Not used */
 static void     vi_clrscreen(FAR struct vi_s *vi);
-#endif
+static void     vi_invalidate(FAR struct vi_s *vi, uint16_t row,
+                  uint16_t nrows);
 
 /* Error display */
 
@@ -333,6 +345,9 @@ static off_t    vi_nextline(FAR struct vi_s *vi, off_t pos);
 
 /* Text buffer management */
 
+static void     vi_movegap(FAR struct vi_s *vi, off_t pos);
+static void     vi_copytext(FAR struct vi_s *vi, FAR char *dest, off_t pos,
+                  size_t size);
 static bool     vi_extendtext(FAR struct vi_s *vi, off_t pos,
                   size_t increment);
 static void     vi_shrinkpos(off_t delpos, size_t delsize, FAR off_t *pos);
@@ -359,6 +374,7 @@ static void     vi_windowpos(FAR struct vi_s *vi, off_t start, off_t end,
                   uint16_t *pcolumn, off_t *ppos);
 static void     vi_scrollcheck(FAR struct vi_s *vi);
 static void     vi_showtext(FAR struct vi_s *vi);
+static void     vi_redraw(FAR struct vi_s *vi);
 
 /* Command mode */
 
@@ -417,9 +433,7 @@ static const char g_cursoroff[]     = VT100_CURSOROFF;
 static const char g_cursorhome[]    = VT100_CURSORHOME;
 #endif
 static const char g_erasetoeol[]    = VT100_CLEAREOL;
-#if 0 /* Not used */
 static const char g_clrscreen[]     = VT100_CLEARSCREEN;
-#endif
 static const char g_index[]         = VT100_INDEX;
 static const char g_revindex[]      = VT100_REVINDEX;
 static const char g_attriboff[]     = VT100_MODESOFF;
@@ -753,14 +767,40 @@ static void vi_clrtoeol(FAR struct vi_s *vi)
  *
  ****************************************************************************/
 
-#if 0 /* Not used */
 static void vi_clrscreen(FAR struct vi_s *vi)
 {
   /* Send the VT100 CLRSCREEN command */
 
   vi_write(vi, g_clrscreen, sizeof(g_clrscreen));
+
+  /* The display is now blank */
+
+  if (vi->shadow)
+    {
+      memset(vi->shadow, ' ', vi->display.row * vi->display.column);
+    }
+}
+
+/****************************************************************************
+ * Name: vi_invalidate
+ *
+ * Description:
+ *   Mark 'nrows' display rows beginning at 'row' as having unknown content
+ *   so that vi_showtext() will rewrite them.  This is necessary whenever
+ *   something other than vi_showtext() writes to the display.
+ *
+ ****************************************************************************/
+
+static void vi_invalidate(FAR struct vi_s *vi, uint16_t row, uint16_t nrows)
+{
+  if (vi->stale)
+    {
+      for (; nrows > 0 && row < vi->display.row; row++, nrows--)
+        {
+          vi->stale[row] = true;
+        }
+    }
 }
-#endif
 
 /****************************************************************************
  * Name: vi_scrollup
@@ -772,8 +812,15 @@ static void vi_clrscreen(FAR struct vi_s *vi)
 
 static void vi_scrollup(FAR struct vi_s *vi, uint16_t nlines)
 {
+  uint16_t nrows = vi->display.row;
+  uint16_t ncols = vi->display.column;
+
   viinfo("nlines=%d\n", nlines);
 
+  /* INDEX only scrolls the display when the cursor is on the bottom row */
+
+  vi_setcursor(vi, nrows - 1, 0);
+
   /* Scroll for the specified number of lines */
 
   for (; nlines; nlines--)
@@ -781,6 +828,15 @@ static void vi_scrollup(FAR struct vi_s *vi, uint16_t nlines)
       /* Send the VT100 INDEX command */
 
       vi_write(vi, g_index, sizeof(g_index));
+
+      /* The display rows moved up by one and a blank row appeared at the
+       * bottom.  Do the same to the record of the display content.
+       */
+
+      memmove(vi->shadow, vi->shadow + ncols, (nrows - 1) * ncols);
+      memset(vi->shadow + (nrows - 1) * ncols, ' ', ncols);
+      memmove(vi->stale, vi->stale + 1, (nrows - 1) * sizeof(bool));
+      vi->stale[nrows - 1] = false;
     }
 }
 
@@ -794,8 +850,15 @@ static void vi_scrollup(FAR struct vi_s *vi, uint16_t nlines)
 
 static void vi_scrolldown(FAR struct vi_s *vi, uint16_t nlines)
 {
+  uint16_t nrows = vi->display.row;
+  uint16_t ncols = vi->display.column;
+
   viinfo("nlines=%d\n", nlines);
 
+  /* REVINDEX only scrolls the display when the cursor is on the top row */
+
+  vi_setcursor(vi, 0, 0);
+
   /* Scroll for the specified number of lines */
 
   for (; nlines; nlines--)
@@ -803,6 +866,15 @@ static void vi_scrolldown(FAR struct vi_s *vi, uint16_t nlines)
       /* Send the VT100 REVINDEX command */
 
       vi_write(vi, g_revindex, sizeof(g_revindex));
+
+      /* The display rows moved down by one and a blank row appeared at the
+       * top.  Do the same to the record of the display content.
+       */
+
+      memmove(vi->shadow + ncols, vi->shadow, (nrows - 1) * ncols);
+      memset(vi->shadow, ' ', ncols);
+      memmove(vi->stale + 1, vi->stale, (nrows - 1) * sizeof(bool));
+      vi->stale[0] = false;
     }
 }
 
@@ -857,6 +929,7 @@ static void vi_error(FAR struct vi_s *vi, FAR const char *fmt, ...)
    */
 
   vi->error = true;
+  vi_invalidate(vi, vi->display.row - 1, 1);
   VI_BEL(vi);
 }
 
@@ -878,7 +951,7 @@ static off_t vi_linebegin(FAR struct vi_s *vi, off_t pos)
    * the beginning of the text buffer).
    */
 
-  while (pos && vi->text[pos - 1] != '\n')
+  while (pos && VI_TEXT(vi, pos - 1) != '\n')
     {
       pos--;
     }
@@ -928,7 +1001,7 @@ static off_t vi_lineend(FAR struct vi_s *vi, off_t pos)
    * the end of the text buffer).
    */
 
-  while (pos < vi->textsize && vi->text[pos] != '\n')
+  while (pos < vi->textsize && VI_TEXT(vi, pos) != '\n')
     {
       pos++;
     }
@@ -968,6 +1041,73 @@ static off_t vi_nextline(FAR struct vi_s *vi, off_t pos)
  * Text buffer management
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: vi_movegap
+ *
+ * Description:
+ *   Move the gap in the text buffer so that it begins at text offset 'pos'.
+ *   The cost is proportional to the distance moved so that a sequence of
+ *   edits at nearby positions does not keep moving the remainder of the
+ *   file.
+ *
+ ****************************************************************************/
+
+static void vi_movegap(FAR struct vi_s *vi, off_t pos)
+{
+  if (pos < vi->gappos)
+    {
+      /* Move the text between pos and the gap to the end of the gap */
+
+      memmove(vi->text + pos + vi->gapsize, vi->text + pos,
+              vi->gappos - pos);
+    }
+  else if (pos > vi->gappos)
+    {
+      /* Move the text between the gap and pos to the beginning of the gap */
+
+      memmove(vi->text + vi->gappos, vi->text + vi->gappos + vi->gapsize,
+              pos - vi->gappos);
+    }
+
+  vi->gappos = pos;
+}
+
+/****************************************************************************
+ * Name: vi_copytext
+ *
+ * Description:
+ *   Copy 'size' bytes of text beginning at text offset 'pos' into 'dest',
+ *   skipping over the gap in the text buffer.
+ *
+ ****************************************************************************/
+
+static void vi_copytext(FAR struct vi_s *vi, FAR char *dest, off_t pos,
+                        size_t size)
+{
+  size_t nbefore = 0;
+
+  /* Copy the part of the region that lies before the gap */
+
+  if (pos < vi->gappos)
+    {
+      nbefore = vi->gappos - pos;
+      if (nbefore > size)
+        {
+          nbefore = size;
+        }
+
+      memcpy(dest, vi->text + pos, nbefore);
+    }
+
+  /* Then the part that lies after the gap */
+
+  if (size > nbefore)
+    {
+      memcpy(dest + nbefore, vi->text + pos + nbefore + vi->gapsize,
+             size - nbefore);
+    }
+}
+
 /****************************************************************************
  * Name: vi_extendtext
  *
@@ -980,19 +1120,26 @@ static off_t vi_nextline(FAR struct vi_s *vi, off_t pos)
 static bool vi_extendtext(FAR struct vi_s *vi, off_t pos, size_t increment)
 {
   FAR char *alloc;
-  int i;
+  size_t allocsize;
+  size_t tailsize;
 
   viinfo("pos=%ld increment=%ld\n", (long)pos, (long)increment);
 
+  /* Move the gap to the insertion point.  Only the text between the old and
+   * the new gap positions is moved.
+   */
+
+  vi_movegap(vi, pos);
+
   /* Check if we need to reallocate */
 
-  if (!vi->text || vi->textsize + increment > vi->txtalloc)
+  if (!vi->text || increment > vi->gapsize)
     {
       /* Allocate in chunksize so that we do not have to reallocate so
        * often.
        */
 
-      size_t allocsize = ALIGN_GULP(vi->textsize + increment);
+      allocsize = ALIGN_GULP(vi->textsize + increment);
       alloc = realloc(vi->text, allocsize);
       if (!alloc)
         {
@@ -1002,20 +1149,26 @@ static bool vi_extendtext(FAR struct vi_s *vi, off_t pos, size_t increment)
           return false;
         }
 
+      /* Move the text after the gap to the end of the new allocation */
+
+      tailsize = vi->textsize - vi->gappos;
+      memmove(alloc + allocsize - tailsize,
+              alloc + vi->gappos + vi->gapsize, tailsize);
+
       /* Save the new buffer information */
 
-      vi->text    = alloc;
+      vi->text     = alloc;
       vi->txtalloc = allocsize;
+      vi->gapsize  = allocsize - vi->textsize;
     }
 
-  /* Move text to make space for new text of size 'increment' at the current
-   * cursor position
+  /* The space for the new text of size 'increment' is taken from the
+   * beginning of the gap.  The new text can then be written directly at
+   * vi->text[pos] through vi->text[pos + increment - 1].
    */
 
-  for (i = vi->textsize - 1; i >= pos; i--)
-    {
-      vi->text[i + increment] = vi->text[i];
-    }
+  vi->gappos   += increment;
+  vi->gapsize  -= increment;
 
   /* Adjust end of file position */
 
@@ -1077,16 +1230,15 @@ static void vi_shrinktext(FAR struct vi_s *vi, off_t pos, size_t size)
 {
   FAR char *alloc;
   size_t allocsize;
-  int i;
 
   viinfo("pos=%ld size=%ld\n", (long)pos, (long)size);
 
-  /* Close up the gap to remove 'size' characters at 'pos' */
+  /* Move the gap to the deleted region and extend the gap over the 'size'
+   * characters that follow it.
+   */
 
-  for (i = pos + size; i < vi->textsize; i++)
-    {
-      vi->text[i - size] = vi->text[i];
-    }
+  vi_movegap(vi, pos);
+  vi->gapsize += size;
 
   /* Adjust sizes and positions */
 
@@ -1096,11 +1248,16 @@ static void vi_shrinktext(FAR struct vi_s *vi, off_t pos, size_t size)
   vi_shrinkpos(pos, size, &vi->winpos);
   vi_shrinkpos(pos, size, &vi->prevpos);
 
-  /* Reallocate the buffer to free up memory no longer in use */
+  /* Reallocate the buffer to free up memory no longer in use.  The gap must
+   * be at the end of the text so that the memory released by realloc() is
+   * taken from the gap.
+   */
 
   allocsize = ALIGN_GULP(vi->textsize);
   if (allocsize < vi->txtalloc)
     {
+      vi_movegap(vi, vi->textsize);
+
       alloc = realloc(vi->text, allocsize);
       if (!alloc)
         {
@@ -1110,8 +1267,9 @@ static void vi_shrinktext(FAR struct vi_s *vi, off_t pos, size_t size)
 
       /* Save the new buffer information */
 
-      vi->text    = alloc;
+      vi->text     = alloc;
       vi->txtalloc = allocsize;
+      vi->gapsize  = allocsize - vi->textsize;
     }
 }
 
@@ -1207,6 +1365,7 @@ static bool vi_savetext(FAR struct vi_s *vi, FAR const char *filename,
 {
   FILE *stream;
   size_t nwritten;
+  size_t nbefore;
 
   viinfo("filename=\"%s\" pos=%ld size=%ld\n",
          filename, (long)pos, (long)size);
@@ -1221,10 +1380,27 @@ static bool vi_savetext(FAR struct vi_s *vi, FAR const char *filename,
     }
 
   /* Write the region of the text buffer beginning at pos and extending
-   * through pos + size -1.
+   * through pos + size -1.  The region may be split by the gap in the text
+   * buffer:  Write the part before the gap first, then the part after it.
    */
 
-  nwritten = fwrite(vi->text + pos, 1, size, stream);
+  nbefore = 0;
+  if (pos < vi->gappos)
+    {
+      nbefore = vi->gappos - pos;
+      if (nbefore > size)
+        {
+          nbefore = size;
+        }
+    }
+
+  nwritten = fwrite(vi->text + pos, 1, nbefore, stream);
+  if (nwritten == nbefore && size > nbefore)
+    {
+      nwritten += fwrite(vi->text + pos + nbefore + vi->gapsize, 1,
+                         size - nbefore, stream);
+    }
+
   if (nwritten < size)
     {
       /* Report the error (or partial write).  EINTR is not handled. */
@@ -1346,6 +1522,7 @@ static void vi_setsubmode(FAR struct vi_s *vi, uint8_t mode, char prompt,
   /* Clear to the end of the line */
 
   vi_clrtoeol(vi);
+  vi_invalidate(vi, vi->cursor.row, 1);
 
   /* Update the cursor position */
 
@@ -1413,7 +1590,7 @@ static void vi_windowpos(FAR struct vi_s *vi, off_t start, off_t end,
     {
       /* Is there a newline terminator at this position? */
 
-      if (vi->text[pos] == '\n')
+      if (VI_TEXT(vi, pos) == '\n')
         {
           /* Yes... break out of the loop return the cursor column */
 
@@ -1422,7 +1599,7 @@ static void vi_windowpos(FAR struct vi_s *vi, off_t start, off_t end,
 
       /* No... Is there a TAB at this position? */
 
-      else if (vi->text[pos] == '\t')
+      else if (VI_TEXT(vi, pos) == '\t')
         {
           /* Yes.. expand the TAB */
 
@@ -1604,12 +1781,17 @@ static void vi_scrollcheck(FAR struct vi_s *vi)
 
 static void vi_showtext(FAR struct vi_s *vi)
 {
+  FAR char *line;
+  FAR char *shadow;
   off_t pos;
   uint16_t row;
   uint16_t endrow;
   uint16_t column;
   uint16_t endcol;
   uint16_t tabcol;
+  uint16_t len;
+  bool cursoroff;
+  char ch;
 
   /* Check if any of the preceding operations will cause the display to
    * scroll.
@@ -1627,20 +1809,19 @@ static void vi_showtext(FAR struct vi_s *vi)
       endrow--;
     }
 
-  /* Make sure that all character attributes are disabled; Turn off the
-   * cursor during the update.
+  /* Each row is formatted into the line buffer following the shadow copy
+   * of the display.  The row is padded with spaces so that it can be
+   * compared with the shadow copy of what is already on the display.
    */
 
-  vi_attriboff(vi);
-  vi_cursoroff(vi);
+  line      = vi->shadow + vi->display.row * vi->display.column;
+  cursoroff = false;
 
-  /* Write each line to the display, handling horizontal scrolling and
-   * tab expansion.
+  /* Format each line, handling horizontal scrolling and tab expansion, and
+   * write only the rows that differ from the current display content.
    */
 
-  for (pos = vi->winpos, row = 0;
-       pos < vi->textsize && row < endrow;
-       row++)
+  for (pos = vi->winpos, row = 0; row < endrow; row++)
     {
       /* Get the last column on this row.  Avoid writing into the last byte
        * on the screen which may trigger a scroll.
@@ -1652,88 +1833,135 @@ static void vi_showtext(FAR struct vi_s *vi)
          endcol--;
         }
 
-      /* Get the position into this line corresponding to display column 0,
-       * accounting for horizontal scrolling and tab expansion.  Add that to
-       * the line start offset to get the first offset to consider for
-       * display.
-       */
-
-      vi_windowpos(vi, pos, pos + vi->hscroll, NULL, &pos);
+      column = 0;
+      if (pos < vi->textsize)
+        {
+          /* Get the position into this line corresponding to display
+           * column 0, accounting for horizontal scrolling and tab
+           * expansion.  Add that to the line start offset to get the first
+           * offset to consider for display.
+           */
 
-      /* Set the cursor position to the beginning of this row and clear to
-       * the end of the line.
-       */
+          vi_windowpos(vi, pos, pos + vi->hscroll, NULL, &pos);
 
-      vi_setcursor(vi, row, 0);
-      vi_clrtoeol(vi);
+          /* Loop for each column */
 
-      /* Loop for each column */
+          for (; pos < vi->textsize && column < endcol; pos++)
+            {
+              ch = VI_TEXT(vi, pos);
 
-      for (column = 0; pos < vi->textsize && column < endcol; pos++)
-        {
-          /* Break out of the loop if we encounter the newline before the
-           * last column is encountered.
-           */
+              /* Break out of the loop if we encounter the newline before
+               * the last column is encountered.
+               */
 
-          if (vi->text[pos] == '\n')
-            {
-              break;
-            }
+              if (ch == '\n')
+                {
+                  break;
+                }
 
-          /* Perform TAB expansion */
+              /* Perform TAB expansion */
 
-          else if (vi->text[pos] == '\t')
-            {
-              tabcol = NEXT_TAB(column);
-              if (tabcol < endcol)
+              else if (ch == '\t')
                 {
-                  for (; column < tabcol; column++)
+                  tabcol = NEXT_TAB(column);
+                  if (tabcol < endcol)
+                    {
+                      for (; column < tabcol; column++)
+                        {
+                          line[column] = ' ';
+                        }
+                    }
+                  else
                     {
-                      vi_putch(vi, ' ');
+                      /* Break out of the loop... there is nothing left on
+                       * the line but whitespace.
+                       */
+
+                      break;
                     }
                 }
-              else
-               {
-                 /* Break out of the loop... there is nothing left on the
-                  * line but whitespace.
-                  */
 
-                 break;
-               }
+              /* Add the normal character to the line */
+
+              else
+                {
+                  line[column++] = ch;
+                }
             }
 
-          /* Add the normal character to the display */
+          /* Skip to the beginning of the next line */
 
-          else
-            {
-              vi_putch(vi, vi->text[pos]);
-              column++;
-            }
+          pos = vi_nextline(vi, pos);
         }
 
-      /* Skip to the beginning of the next line */
+      /* Pad the rest of the row with spaces.  If there was not enough text
+       * to fill the display, the remaining rows are all spaces.
+       */
 
-      pos = vi_nextline(vi, pos);
-    }
+      memset(&line[column], ' ', vi->display.column - column);
 
-  /* If there was not enough text to fill the display, clear the
-   * remaining lines (except for any possible error line at the
-   * bottom of the display).
-   */
+      /* Skip the row if the display already shows this text */
 
-  for (; row < endrow; row++)
-    {
-      /* Set the cursor position to the beginning of the row and clear to
-       * the end of the line.
+      shadow = vi->shadow + row * vi->display.column;
+      if (!vi->stale[row] &&
+          memcmp(line, shadow, vi->display.column) == 0)
+        {
+          continue;
+        }
+
+      /* Make sure that all character attributes are disabled; Turn off the
+       * cursor during the update.
+       */
+
+      if (!cursoroff)
+        {
+          vi_attriboff(vi);
+          vi_cursoroff(vi);
+          cursoroff = true;
+        }
+
+      /* Write the row without its trailing spaces and clear to the end of
+       * the line.
        */
 
+      for (len = column; len > 0 && line[len - 1] == ' '; len--);
+
       vi_setcursor(vi, row, 0);
+      if (len > 0)
+        {
+          vi_write(vi, line, len);
+        }
+
       vi_clrtoeol(vi);
+
+      /* Remember what is on the display now */
+
+      memcpy(shadow, line, vi->display.column);
+      vi->stale[row] = false;
     }
 
   /* Turn the cursor back on */
 
-  vi_cursoron(vi);
+  if (cursoroff)
+    {
+      vi_cursoron(vi);
+    }
+}
+
+/****************************************************************************
+ * Name: vi_redraw
+ *
+ * Description:
+ *   Clear the display so that the next vi_showtext() rewrites every row.
+ *
+ ****************************************************************************/
+
+static void vi_redraw(FAR struct vi_s *vi)
+{
+  vi_attriboff(vi);
+  vi_clrscreen(vi);
+  vi_invalidate(vi, 0, vi->display.row);
+  vi->error = false;
 }
 
 /****************************************************************************
@@ -1844,7 +2072,7 @@ static off_t vi_cursorleft(FAR struct vi_s *vi, off_t curpos, int ncolumns)
    */
 
   for (remaining = (ncolumns < 1 ? 1 : ncolumns);
-       curpos > 0 && remaining > 0 && vi->text[curpos - 1] != '\n';
+       curpos > 0 && remaining > 0 && VI_TEXT(vi, curpos - 1) != '\n';
        curpos--, remaining--);
 
   return curpos;
@@ -1871,7 +2099,7 @@ static off_t vi_cursorright(FAR struct vi_s *vi, off_t curpos, int ncolumns)
    */
 
   for (remaining = (ncolumns < 1 ? 1 : ncolumns);
-       curpos < vi->textsize && remaining > 0 && vi->text[curpos] != '\n';
+       curpos < vi->textsize && remaining > 0 && VI_TEXT(vi, curpos) != '\n';
        curpos++, remaining--);
 
   return curpos;
@@ -2042,7 +2270,7 @@ static void vi_yank(FAR struct vi_s *vi)
 
   /* Copy the block from the text buffer to the yank buffer */
 
-  memcpy(vi->yank, &vi->text[start], vi->yankalloc);
+  vi_copytext(vi, vi->yank, start, vi->yankalloc);
 
   /* Remove the yanked text from the text buffer */
 
@@ -2082,7 +2310,8 @@ static void vi_paste(FAR struct vi_s *vi)
   if (vi_extendtext(vi, start, vi->yankalloc))
     {
       /* Copy the contents of the yank buffer into the text buffer at the
-       * position where the start of the next line was.
+       * position where the start of the next line was.  vi_extendtext()
+       * left this space contiguous, just before the gap.
        */
 
       memcpy(&vi->text[start], vi->yank, vi->yankalloc);
@@ -2421,10 +2650,15 @@ static void vi_cmd_mode(FAR struct vi_s *vi)
           }
           break;
 
-        /* Unimplemented and invalid commands */
-
         case KEY_CMDMODE_REDRAW:  /* Redraws the screen */
         case KEY_CMDMODE_REDRAW2: /* Redraws the screen, removing deleted lines */
+          {
+            vi_redraw(vi);
+          }
+          break;
+
+        /* Unimplemented and invalid commands */
+
         case KEY_CMDMODE_MARK:    /* Place a mark beginning at the current cursor position */
         default:
           {
@@ -2940,6 +3174,7 @@ static bool vi_findstring(FAR struct vi_s *vi)
 {
   off_t pos;
   int len;
+  int i;
 
   viinfo("findstr: \"%s\"\n", vi->findstr);
 
@@ -2959,9 +3194,13 @@ static bool vi_findstring(FAR struct vi_s *vi)
        pos + len <= vi->textsize;
        pos++)
     {
-      /* Check for the matching sub-string */
+      /* Check for the matching sub-string.  The text at pos may be split
+       * by the gap in the text buffer.
+       */
 
-      if (strncmp(vi->text + pos, vi->scratch, len) == 0)
+      for (i = 0; i < len && VI_TEXT(vi, pos + i) == vi->scratch[i]; i++);
+
+      if (i == len)
         {
           /* Found it... save the cursor position and
            * return success.
@@ -3137,7 +3376,7 @@ static void vi_replacech(FAR struct vi_s *vi, char ch)
 
   /* Is there a newline at the current cursor position? */
 
-  if (vi->text[vi->curpos] == '\n')
+  if (vi->curpos >= vi->textsize || VI_TEXT(vi, vi->curpos) == '\n')
     {
       /* Yes, then insert the new character before the newline */
 
@@ -3147,7 +3386,8 @@ static void vi_replacech(FAR struct vi_s *vi, char ch)
     {
       /* No, just replace the character and increment the cursor position */
 
-      vi->text[vi->curpos++] = ch;
+      VI_TEXT(vi, vi->curpos) = ch;
+      vi->curpos++;
     }
 }
 
@@ -3550,6 +3790,16 @@ static void vi_release(FAR struct vi_s *vi)
           free(vi->yank);
         }
 
+      if (vi->shadow)
+        {
+          free(vi->shadow);
+        }
+
+      if (vi->stale)
+        {
+          free(vi->stale);
+        }
+
       free(vi);
     }
 }
@@ -3631,7 +3881,7 @@ int vi_main(int argc, char **argv)
           case 'c': /* Display width in columns */
             {
               unsigned long value = strtoul(optarg, NULL, 10);
-              if (value <= UINT16_MAX)
+              if (value > 0 && value <= UINT16_MAX)
                 {
                   vi->display.column = (uint16_t)value;
                 }
@@ -3647,7 +3897,7 @@ int vi_main(int argc, char **argv)
           case 'r': /* Display width in columns */
             {
               unsigned long value = strtoul(optarg, NULL, 10);
-              if (value <= UINT16_MAX)
+              if (value > 0 && value <= UINT16_MAX)
                 {
                   vi->display.row = (uint16_t)value;
                 }
@@ -3683,6 +3933,24 @@ int vi_main(int argc, char **argv)
         }
     }
 
+  /* Allocate the record of the display content plus one more row in which
+   * vi_showtext() formats each line.  The initial content of the display is
+   * unknown so every row starts out stale.
+   */
+
+  vi->shadow = (FAR char *)
+    malloc((vi->display.row + 1) * vi->display.column);
+  vi->stale  = (FAR bool *)malloc(vi->display.row * sizeof(bool));
+
+  if (!vi->shadow || !vi->stale)
+    {
+      fprintf(stderr, "ERROR: %s\n", g_fmtallocfail);
+      vi_release(vi);
+      return EXIT_FAILURE;
+    }
+
+  vi_invalidate(vi, 0, vi->display.row);
+
   /* There may be one additional argument on the command line:  The filename */
 
   if (optind < argc)
@@ -40,6 +40,8 @@
  * Included Files
  ****************************************************************************/
 
+#define _GNU_SOURCE 1
+
 #include <stdlib.h>
 #include <string.h>
 
@@ -53,15 +55,25 @@
 #define FAR
 #define DEBUGASSERT assert
 
-#define _GNU_SOURCE 1
-
-/* Configuration */
+/* Configuration.  The buffer sizes may be overridden on the compiler
+ * command line (see host/zmbench.sh).
+ */
 
 #define CONFIG_SYSTEM_ZMODEM 1
 #define CONFIG_SYSTEM_ZMODEM_DEVNAME "/dev/ttyS0"
-#define CONFIG_SYSTEM_ZMODEM_RCVBUFSIZE 512
-#define CONFIG_SYSTEM_ZMODEM_PKTBUFSIZE 1024
-#define CONFIG_SYSTEM_ZMODEM_SNDBUFSIZE 512
+#ifndef CONFIG_SYSTEM_ZMODEM_RCVBUFSIZE
+#  define CONFIG_SYSTEM_ZMODEM_RCVBUFSIZE 512
+#endif
+#ifndef CONFIG_SYSTEM_ZMODEM_PKTBUFSIZE
+#  define CONFIG_SYSTEM_ZMODEM_PKTBUFSIZE 1024
+#endif
+#ifndef CONFIG_SYSTEM_ZMODEM_SNDBUFSIZE
+#  define CONFIG_SYSTEM_ZMODEM_SNDBUFSIZE 512
+#endif
+#ifndef CONFIG_SYSTEM_ZMODEM_SNDWINDOW
+#  define CONFIG_SYSTEM_ZMODEM_SNDWINDOW 16384
+#endif
+#define CONFIG_SYSTEM_ZMODEM_CRC32SLICE8 1
 #define CONFIG_SYSTEM_ZMODEM_MOUNTPOINT "/tmp"
 #undef  CONFIG_SYSTEM_ZMODEM_RCVSAMPLE
 #undef  CONFIG_SYSTEM_ZMODEM_SENDATTN
@@ -72,6 +84,10 @@
 #define CONFIG_SYSTEM_ZMODEM_SERIALNO 1
 #define CONFIG_SYSTEM_ZMODEM_MAXERRORS 20
 #define CONFIG_SYSTEM_ZMODEM_WRITESIZE 0
+#ifndef CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE
+#  define CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE 4096
+#endif
+#define CONFIG_SYSTEM_ZMODEM_ASYNCWRITE 1
 #define CONFIG_SYSTEM_ZMODEM_MOUNTPOINT "/tmp"
 
 /* Cannot control pre-emption from Linux (don't need to) */
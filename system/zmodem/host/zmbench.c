@@ -0,0 +1,832 @@
+/****************************************************************************
+ * system/zmodem/host/zmbench.c
+ * Zmodem throughput benchmark for the host build
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <limits.h>
+#include <poll.h>
+#include <pty.h>
+#include <termios.h>
+#include <libgen.h>
+#include <time.h>
+#include <errno.h>
+
+#include "zm.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define ZMB_BUFSIZE   4096           /* Relay buffer size */
+#define ZMB_POLLMS    10             /* Maximum poll time (milliseconds) */
+#define ZMB_TIMEOUT   600            /* Give up after this many seconds */
+
+/* Byte sequences counted in the data streams:  A ZRPOS hex header from the
+ * receiver and a ZFILE binary header (16- or 32-bit CRC) from the sender.
+ */
+
+#define ZMB_RPOSHDR   ((uint64_t)ZPAD << 32 | (uint64_t)ZDLE << 24 | \
+                       (uint64_t)ZHEX << 16 | '0' << 8 | ('0' + ZRPOS))
+#define ZMB_RPOSMASK  0xffffffffffull
+#define ZMB_FILEHDR16 ((uint32_t)ZPAD << 24 | ZDLE << 16 | ZBIN << 8 | ZFILE)
+#define ZMB_FILEHDR32 ((uint32_t)ZPAD << 24 | ZDLE << 16 | ZBIN32 << 8 | ZFILE)
+#define ZMB_FILEMASK  0xffffffffull
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One direction of the relayed link */
+
+struct zmb_dir_s
+{
+  int infd;                  /* Read data from here */
+  int outfd;                 /* ... and forward it to here */
+  size_t len;                /* Number of bytes in buf[] */
+  uint64_t ready;            /* Time when buf[] may be forwarded (usec) */
+  uint64_t hist;             /* Last bytes forwarded, for header matching */
+  unsigned long nbytes;      /* Total number of bytes forwarded */
+  unsigned long nrpos;       /* Number of ZRPOS headers forwarded */
+  unsigned long nfile;       /* Number of ZFILE headers forwarded */
+  unsigned long ncorrupt;    /* Number of bytes corrupted */
+  uint8_t buf[ZMB_BUFSIZE];  /* Data read but not yet forwarded */
+};
+
+/* One local sz or rz process */
+
+struct zmb_proc_s
+{
+  pid_t pid;                 /* Process ID; <= 0 if not running */
+  int status;                /* Exit status */
+  double cputime;            /* User + system CPU time (seconds) */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct zmb_dir_s g_fwd;      /* sz -> rz */
+static struct zmb_dir_s g_rev;      /* rz -> sz */
+
+static unsigned long g_baud;        /* Emulated link rate (0 = unlimited) */
+static unsigned long g_errintvl;    /* Corrupt a byte every this many bytes */
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void show_usage(FAR const char *progname, int errcode)
+{
+  fprintf(stderr, "USAGE: %s [OPTIONS] <file> [<file> ...]\n", progname);
+  fprintf(stderr, "       %s -H\n", progname);
+  fprintf(stderr, "\nWhere:\n");
+  fprintf(stderr, "\t<file> is a file to send.  With -R, it is a local copy of\n");
+  fprintf(stderr, "\t\ta file that the target sends, used for verification\n");
+  fprintf(stderr, "\nand OPTIONS include the following:\n");
+  fprintf(stderr, "\t-s <sz>: Host sz program.  Default: ./sz\n");
+  fprintf(stderr, "\t-r <rz>: Host rz program.  Default: ./rz\n");
+  fprintf(stderr, "\t-d <device>: Serial port connected to a target running rz\n");
+  fprintf(stderr, "\t\t(or sz with -R).  Default: Run both host programs over ptys\n");
+  fprintf(stderr, "\t-R: Receive files from the target with the host rz\n");
+  fprintf(stderr, "\t-b <baud>: Limit the link to this rate (8N1).  Default: unlimited\n");
+  fprintf(stderr, "\t-e <n>: Corrupt one byte in every <n> bytes from sz to rz\n");
+  fprintf(stderr, "\t-t <label>: Label of the result line.  Default: <file>\n");
+  fprintf(stderr, "\t-H: Show the heading of the result line and exit\n");
+  fprintf(stderr, "\t-h: Show this text and exit\n");
+  fprintf(stderr, "\nThe result line shows the file data rate, the protocol\n");
+  fprintf(stderr, "overhead, the number of retransmission requests (ZRPOS) and the\n");
+  fprintf(stderr, "CPU time used by the host sz and rz.\n");
+  exit(errcode);
+}
+
+static void show_heading(void)
+{
+  printf("%-24s %10s %8s %10s %7s %5s %8s %8s %s\n",
+         "# label", "bytes", "seconds", "bytes/s", "ovhd%", "retx",
+         "sz-cpu", "rz-cpu", "ok");
+}
+
+/****************************************************************************
+ * Name: zmb_now
+ *
+ * Description:
+ *   Return the current monotonic time in microseconds.
+ *
+ ****************************************************************************/
+
+static uint64_t zmb_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * Name: zmb_rawmode
+ *
+ * Description:
+ *   Put a terminal into raw mode.
+ *
+ ****************************************************************************/
+
+static int zmb_rawmode(int fd)
+{
+  struct termios term;
+
+  if (tcgetattr(fd, &term) < 0)
+    {
+      return -errno;
+    }
+
+  cfmakeraw(&term);
+  if (tcsetattr(fd, TCSANOW, &term) < 0)
+    {
+      return -errno;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: zmb_openpty
+ *
+ * Description:
+ *   Open a raw pty.  The master side is returned in *master and the name
+ *   of the slave in 'name'.  The slave is kept open in *slave so that no
+ *   data is lost before the local program opens it.
+ *
+ ****************************************************************************/
+
+static int zmb_openpty(FAR int *master, FAR int *slave, FAR char *name)
+{
+  if (openpty(master, slave, name, NULL, NULL) < 0)
+    {
+      return -errno;
+    }
+
+  (void)zmb_rawmode(*master);
+  return zmb_rawmode(*slave);
+}
+
+/****************************************************************************
+ * Name: zmb_spawn
+ *
+ * Description:
+ *   Start a local sz or rz on 'devname'.  'argv' holds any additional
+ *   arguments and is NULL terminated.
+ *
+ ****************************************************************************/
+
+static int zmb_spawn(FAR struct zmb_proc_s *proc, FAR const char *prog,
+                     FAR const char *devname, FAR char * const *argv,
+                     int argc)
+{
+  FAR char **args;
+  int fd;
+  int i;
+
+  args = (FAR char **)calloc(argc + 4, sizeof(FAR char *));
+  if (!args)
+    {
+      return -ENOMEM;
+    }
+
+  args[0] = (FAR char *)prog;
+  args[1] = "-d";
+  args[2] = (FAR char *)devname;
+  for (i = 0; i < argc; i++)
+    {
+      args[i + 3] = argv[i];
+    }
+
+  proc->pid = fork();
+  if (proc->pid == 0)
+    {
+      /* Keep the result line on stdout clean */
+
+      fd = open("/dev/null", O_WRONLY);
+      if (fd >= 0)
+        {
+          dup2(fd, STDOUT_FILENO);
+          close(fd);
+        }
+
+      execv(prog, args);
+      fprintf(stderr, "ERROR: Failed to start %s: %d\n", prog, errno);
+      _exit(127);
+    }
+
+  free(args);
+  return proc->pid < 0 ? -errno : OK;
+}
+
+/****************************************************************************
+ * Name: zmb_reap
+ *
+ * Description:
+ *   Collect the exit status and CPU time of a local program if it has
+ *   terminated.  Returns true if the program is no longer running.
+ *
+ ****************************************************************************/
+
+static bool zmb_reap(FAR struct zmb_proc_s *proc)
+{
+  struct rusage usage;
+
+  if (proc->pid <= 0)
+    {
+      return true;
+    }
+
+  if (wait4(proc->pid, &proc->status, WNOHANG, &usage) != proc->pid)
+    {
+      return false;
+    }
+
+  proc->cputime = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+                  (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+  proc->pid     = 0;
+  return true;
+}
+
+/****************************************************************************
+ * Name: zmb_forward
+ *
+ * Description:
+ *   Forward the buffered data of one direction of the link, counting (and
+ *   possibly corrupting) it on the way.
+ *
+ ****************************************************************************/
+
+static void zmb_forward(FAR struct zmb_dir_s *dir, bool corrupt)
+{
+  FAR uint8_t *ptr = dir->buf;
+  size_t remaining;
+  ssize_t nwritten;
+  size_t i;
+
+  for (i = 0; i < dir->len; i++)
+    {
+      dir->nbytes++;
+      if (corrupt && g_errintvl > 0 && dir->nbytes % g_errintvl == 0)
+        {
+          dir->buf[i] ^= 0x55;
+          dir->ncorrupt++;
+        }
+
+      dir->hist = dir->hist << 8 | dir->buf[i];
+      if ((dir->hist & ZMB_RPOSMASK) == ZMB_RPOSHDR)
+        {
+          dir->nrpos++;
+        }
+      else if ((dir->hist & ZMB_FILEMASK) == ZMB_FILEHDR16 ||
+               (dir->hist & ZMB_FILEMASK) == ZMB_FILEHDR32)
+        {
+          dir->nfile++;
+        }
+    }
+
+  for (remaining = dir->len; remaining > 0; )
+    {
+      nwritten = write(dir->outfd, ptr, remaining);
+      if (nwritten < 0)
+        {
+          if (errno == EINTR || errno == EAGAIN)
+            {
+              continue;
+            }
+
+          /* The other end is gone.  Drop the data. */
+
+          break;
+        }
+
+      ptr       += nwritten;
+      remaining -= nwritten;
+    }
+
+  /* Delay the next chunk by the time these bytes take on the emulated
+   * link.
+   */
+
+  if (g_baud > 0)
+    {
+      uint64_t now = zmb_now();
+
+      if (dir->ready < now)
+        {
+          dir->ready = now;
+        }
+
+      dir->ready += (uint64_t)dir->len * 10 * 1000000 / g_baud;
+    }
+
+  dir->len = 0;
+}
+
+/****************************************************************************
+ * Name: zmb_relay
+ *
+ * Description:
+ *   Relay data in both directions until the local program(s) terminate.
+ *
+ ****************************************************************************/
+
+static int zmb_relay(FAR struct zmb_proc_s *sz, FAR struct zmb_proc_s *rz)
+{
+  FAR struct zmb_dir_s *dirs[2];
+  struct pollfd fds[2];
+  uint64_t start = zmb_now();
+  uint64_t now;
+  ssize_t nread;
+  size_t maxread;
+  int timeout;
+  int i;
+
+  dirs[0] = &g_fwd;
+  dirs[1] = &g_rev;
+
+  /* Read no more than 10 milliseconds worth of data at a time */
+
+  maxread = ZMB_BUFSIZE;
+  if (g_baud > 0 && g_baud / 1000 < maxread)
+    {
+      maxread = g_baud / 1000 > 0 ? g_baud / 1000 : 1;
+    }
+
+  while (!zmb_reap(sz) | !zmb_reap(rz))
+    {
+      now     = zmb_now();
+      timeout = ZMB_POLLMS;
+
+      if (now - start > (uint64_t)ZMB_TIMEOUT * 1000000)
+        {
+          fprintf(stderr, "ERROR: Timed out\n");
+          return -ETIMEDOUT;
+        }
+
+      for (i = 0; i < 2; i++)
+        {
+          /* Forward the pending data when the link is ready for it */
+
+          if (dirs[i]->len > 0 && dirs[i]->ready <= now)
+            {
+              zmb_forward(dirs[i], i == 0);
+            }
+
+          fds[i].fd      = dirs[i]->infd;
+          fds[i].events  = 0;
+          fds[i].revents = 0;
+
+          if (dirs[i]->len == 0)
+            {
+              fds[i].events = POLLIN;
+            }
+          else if (dirs[i]->ready - now < (uint64_t)timeout * 1000)
+            {
+              timeout = (dirs[i]->ready - now) / 1000;
+            }
+        }
+
+      if (poll(fds, 2, timeout) < 0 && errno != EINTR)
+        {
+          return -errno;
+        }
+
+      for (i = 0; i < 2; i++)
+        {
+          if ((fds[i].revents & POLLIN) != 0)
+            {
+              nread = read(dirs[i]->infd, dirs[i]->buf, maxread);
+              if (nread > 0)
+                {
+                  dirs[i]->len = nread;
+                  if (dirs[i]->ready <= zmb_now())
+                    {
+                      zmb_forward(dirs[i], i == 0);
+                    }
+                }
+            }
+          else if ((fds[i].revents & (POLLHUP | POLLERR)) != 0)
+            {
+              /* Nothing is connected to this pty (yet or any more) */
+
+              usleep(ZMB_POLLMS * 1000);
+            }
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: zmb_rcvname
+ *
+ * Description:
+ *   Get the name under which rz stores the file in the Zmodem sandbox.
+ *
+ ****************************************************************************/
+
+static void zmb_rcvname(FAR const char *filename, FAR char *rcvname)
+{
+  char tmp[PATH_MAX];
+
+  strncpy(tmp, filename, PATH_MAX - 1);
+  tmp[PATH_MAX - 1] = '\0';
+  snprintf(rcvname, PATH_MAX, "%s/%s", CONFIG_SYSTEM_ZMODEM_MOUNTPOINT,
+           basename(tmp));
+}
+
+/****************************************************************************
+ * Name: zmb_verify
+ *
+ * Description:
+ *   Compare a received file in the Zmodem sandbox with the original.
+ *
+ ****************************************************************************/
+
+static bool zmb_verify(FAR const char *filename)
+{
+  char rcvname[PATH_MAX];
+  uint8_t buf1[ZMB_BUFSIZE];
+  uint8_t buf2[ZMB_BUFSIZE];
+  ssize_t nread1;
+  ssize_t nread2;
+  bool same = false;
+  int fd1;
+  int fd2;
+
+  zmb_rcvname(filename, rcvname);
+
+  fd1 = open(filename, O_RDONLY);
+  fd2 = open(rcvname, O_RDONLY);
+
+  if (fd1 >= 0 && fd2 >= 0)
+    {
+      do
+        {
+          nread1 = read(fd1, buf1, ZMB_BUFSIZE);
+          nread2 = read(fd2, buf2, ZMB_BUFSIZE);
+          same   = nread1 == nread2 && nread1 >= 0 &&
+                   memcmp(buf1, buf2, nread1) == 0;
+        }
+      while (same && nread1 > 0);
+    }
+
+  if (fd1 >= 0)
+    {
+      close(fd1);
+    }
+
+  if (fd2 >= 0)
+    {
+      close(fd2);
+    }
+
+  return same;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+int main(int argc, FAR char **argv)
+{
+  struct zmb_proc_s sz;
+  struct zmb_proc_s rz;
+  FAR const char *szprog = "./sz";
+  FAR const char *rzprog = "./rz";
+  FAR const char *devname = NULL;
+  FAR const char *label = NULL;
+  FAR char *endptr;
+  char rcvname[PATH_MAX];
+  char ptyname1[64];
+  char ptyname2[64];
+  struct stat buf;
+  unsigned long nbytes;
+  unsigned long retx;
+  uint64_t start;
+  double secs;
+  bool receive = false;
+  bool ok;
+  int slave1 = -1;
+  int slave2 = -1;
+  int master1;
+  int master2 = -1;
+  int option;
+  int ret;
+  int i;
+
+  while ((option = getopt(argc, argv, ":b:d:e:hHr:Rs:t:")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'b':
+            g_baud = strtoul(optarg, &endptr, 10);
+            break;
+
+          case 'd':
+            devname = optarg;
+            break;
+
+          case 'e':
+            g_errintvl = strtoul(optarg, &endptr, 10);
+            break;
+
+          case 'h':
+            show_usage(argv[0], EXIT_SUCCESS);
+            break;
+
+          case 'H':
+            show_heading();
+            return EXIT_SUCCESS;
+
+          case 'r':
+            rzprog = optarg;
+            break;
+
+          case 'R':
+            receive = true;
+            break;
+
+          case 's':
+            szprog = optarg;
+            break;
+
+          case 't':
+            label = optarg;
+            break;
+
+          case ':':
+            fprintf(stderr, "ERROR: Missing required argument\n");
+            show_usage(argv[0], EXIT_FAILURE);
+            break;
+
+          default:
+          case '?':
+            fprintf(stderr, "ERROR: Unrecognized option\n");
+            show_usage(argv[0], EXIT_FAILURE);
+            break;
+        }
+    }
+
+  if (optind >= argc)
+    {
+      fprintf(stderr, "ERROR: Missing required 'file' argument\n");
+      show_usage(argv[0], EXIT_FAILURE);
+    }
+
+  if (receive && !devname)
+    {
+      fprintf(stderr, "ERROR: -R requires a target device (-d)\n");
+      show_usage(argv[0], EXIT_FAILURE);
+    }
+
+  /* Get the total amount of file data and remove old received copies */
+
+  nbytes = 0;
+  for (i = optind; i < argc; i++)
+    {
+      if (stat(argv[i], &buf) < 0)
+        {
+          fprintf(stderr, "ERROR: Failed to stat %s: %d\n", argv[i], errno);
+          return EXIT_FAILURE;
+        }
+
+      nbytes += buf.st_size;
+
+      /* Make sure that the file is received again in full */
+
+      if (!devname || receive)
+        {
+          zmb_rcvname(argv[i], rcvname);
+          if (strcmp(argv[i], rcvname) == 0)
+            {
+              fprintf(stderr, "ERROR: %s is in the Zmodem sandbox %s\n",
+                      argv[i], CONFIG_SYSTEM_ZMODEM_MOUNTPOINT);
+              return EXIT_FAILURE;
+            }
+
+          (void)unlink(rcvname);
+        }
+    }
+
+  /* The local sz (or the local rz with -R) is on the first pty.  The other
+   * end is either a local rz on a second pty or the target on the serial
+   * port.
+   */
+
+  ret = zmb_openpty(&master1, &slave1, ptyname1);
+  if (ret < 0)
+    {
+      fprintf(stderr, "ERROR: Failed to open a pty: %d\n", ret);
+      return EXIT_FAILURE;
+    }
+
+  if (devname)
+    {
+      master2 = open(devname, O_RDWR | O_NOCTTY);
+      if (master2 < 0 || zmb_rawmode(master2) < 0)
+        {
+          fprintf(stderr, "ERROR: Failed to open %s: %d\n", devname, errno);
+          return EXIT_FAILURE;
+        }
+    }
+  else
+    {
+      ret = zmb_openpty(&master2, &slave2, ptyname2);
+      if (ret < 0)
+        {
+          fprintf(stderr, "ERROR: Failed to open a pty: %d\n", ret);
+          return EXIT_FAILURE;
+        }
+    }
+
+  memset(&sz, 0, sizeof(struct zmb_proc_s));
+  memset(&rz, 0, sizeof(struct zmb_proc_s));
+
+  if (receive)
+    {
+      g_fwd.infd  = master2;
+      g_fwd.outfd = master1;
+      g_rev.infd  = master1;
+      g_rev.outfd = master2;
+    }
+  else
+    {
+      g_fwd.infd  = master1;
+      g_fwd.outfd = master2;
+      g_rev.infd  = master2;
+      g_rev.outfd = master1;
+    }
+
+  start = zmb_now();
+
+  if (receive)
+    {
+      ret = zmb_spawn(&rz, rzprog, ptyname1, NULL, 0);
+      fprintf(stderr, "Start sz on the target now\n");
+    }
+  else
+    {
+      if (!devname)
+        {
+          ret = zmb_spawn(&rz, rzprog, ptyname2, NULL, 0);
+        }
+      else
+        {
+          ret = OK;
+        }
+
+      if (ret == OK)
+        {
+          ret = zmb_spawn(&sz, szprog, ptyname1, &argv[optind],
+                          argc - optind);
+        }
+    }
+
+  if (ret == OK)
+    {
+      ret = zmb_relay(&sz, &rz);
+    }
+
+  if (ret < 0)
+    {
+      fprintf(stderr, "ERROR: Transfer failed: %d\n", ret);
+      if (sz.pid > 0)
+        {
+          kill(sz.pid, SIGKILL);
+        }
+
+      if (rz.pid > 0)
+        {
+          kill(rz.pid, SIGKILL);
+        }
+
+      return EXIT_FAILURE;
+    }
+
+  secs = (zmb_now() - start) / 1e6;
+
+  /* Verify the received files */
+
+  ok = WIFEXITED(sz.status) && WEXITSTATUS(sz.status) == 0 &&
+       WIFEXITED(rz.status) && WEXITSTATUS(rz.status) == 0;
+
+  if (!devname || receive)
+    {
+      for (i = optind; i < argc && ok; i++)
+        {
+          ok = zmb_verify(argv[i]);
+        }
+    }
+
+  /* Each file transfer starts with a ZRPOS.  Any other ZRPOS asks for
+   * data to be sent again.
+   */
+
+  retx = g_rev.nrpos > g_fwd.nfile ? g_rev.nrpos - g_fwd.nfile : 0;
+
+  printf("%-24s %10lu %8.2f ", label ? label : argv[optind], nbytes, secs);
+
+  /* The rate and the overhead mean nothing if the files did not all
+   * arrive intact.
+   */
+
+  if (ok)
+    {
+      printf("%10.0f %7.2f ",
+             secs > 0 ? nbytes / secs : 0,
+             nbytes > 0 ?
+               100.0 * ((double)g_fwd.nbytes + g_rev.nbytes - nbytes) /
+               nbytes : 0);
+    }
+  else
+    {
+      printf("%10s %7s ", "FAIL", "-");
+    }
+
+  printf("%5lu ", retx);
+
+  if (!devname || !receive)
+    {
+      printf("%8.2f ", sz.cputime);
+    }
+  else
+    {
+      printf("%8s ", "-");
+    }
+
+  if (!devname || receive)
+    {
+      printf("%8.2f ", rz.cputime);
+    }
+  else
+    {
+      printf("%8s ", "-");
+    }
+
+  printf("%s\n", ok ? "yes" : "no");
+
+  close(master1);
+  close(slave1);
+  close(master2);
+  if (slave2 >= 0)
+    {
+      close(slave2);
+    }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
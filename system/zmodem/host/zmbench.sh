@@ -0,0 +1,83 @@
+#!/bin/bash
+############################################################################
+# system/zmodem/host/zmbench.sh
+#
+#   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+#   Author: Gregory Nutt <gnutt@nuttx.org>
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in
+#    the documentation and/or other materials provided with the
+#    distribution.
+# 3. Neither the name NuttX nor the names of its contributors may be
+#    used to endorse or promote products derived from this software
+#    without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+# COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+# BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+# OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+# AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+# ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+############################################################################
+
+# Sweep the Zmodem buffer sizes, CRC modes and receive modes through the
+# host build and report the throughput of each combination with zmbench.
+#
+# USAGE: host/zmbench.sh [zmbench options] <file> [<file> ...]
+#
+# Run from the apps/system/zmodem directory.  The zmbench options (-d, -R,
+# -b, -e) are passed on for every run; see "zmbench -h".  The sz and rz
+# programs are rebuilt for every combination, so make sure that no target
+# object files are present.  Set SIZES to change the buffer sizes swept.
+
+if [ ! -f Makefile.host ]; then
+  echo "ERROR: This script must be executed from the apps/system/zmodem directory"
+  exit 1
+fi
+
+topdir=${TOPDIR:-../../../nuttx}
+appdir=${APPDIR:-$(cd ../.. && pwd)}
+sizes=${SIZES:-"256 512 1024 2048"}
+
+make="make -f Makefile.host TOPDIR=${topdir} APPDIR=${appdir}"
+
+${make} clean >/dev/null && ${make} zmbench >/dev/null || exit 1
+./zmbench -H
+
+for size in ${sizes}; do
+  for crc in 16 32; do
+    for mode in ack stream; do
+      flags="-DCONFIG_SYSTEM_ZMODEM_PKTBUFSIZE=${size}"
+      flags="${flags} -DCONFIG_SYSTEM_ZMODEM_SNDBUFSIZE=${size}"
+      flags="${flags} -DCONFIG_SYSTEM_ZMODEM_RCVBUFSIZE=${size}"
+      if [ ${crc} = 32 ]; then
+        flags="${flags} -DCONFIG_SYSTEM_ZMODEM_RCVCRC32=1"
+      fi
+      if [ ${mode} = stream ]; then
+        flags="${flags} -DCONFIG_SYSTEM_ZMODEM_RCVSTREAM=1"
+      fi
+
+      rm -f *.o sz rz
+      if ! ${make} ZMCFLAGS="${flags}" all >/dev/null; then
+        echo "ERROR: Build failed: ${flags}"
+        exit 1
+      fi
+
+      ./zmbench -t "buf=${size},crc${crc},${mode}" "$@"
+    done
+  done
+done
@@ -39,6 +39,8 @@
 
 #include <nuttx/config.h>
 
+#include <sys/stat.h>
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -46,6 +48,7 @@
 #include <signal.h>
 #include <fcntl.h>
 #include <libgen.h>
+#include <dirent.h>
 #include <time.h>
 #include <errno.h>
 
@@ -60,7 +63,8 @@ static void show_usage(FAR const char *progname, int errcode)
   fprintf(stderr, "USAGE: %s [OPTIONS] <lname> [<lname> [<lname> ...]]\n",
                   progname);
   fprintf(stderr, "\nWhere:\n");
-  fprintf(stderr, "\t<lname> is the local file name\n");
+  fprintf(stderr, "\t<lname> is the local file name.  If <lname> is a directory,\n");
+  fprintf(stderr, "\t\tall of the files in the directory tree are sent\n");
   fprintf(stderr, "\nand OPTIONS include the following:\n");
   fprintf(stderr, "\t-d <device>: Communication device to use.  Default: %s\n",
                   CONFIG_SYSTEM_ZMODEM_DEVNAME);
@@ -81,10 +85,100 @@ static void show_usage(FAR const char *progname, int errcode)
   fprintf(stderr, "\t\t7: Protect: transfer only if dest doesn't exist\n");
   fprintf(stderr, "\t\t8: Change filename if destination exists\n");
   fprintf(stderr, "\t-s: Skip if file not present at receiving end\n");
+  fprintf(stderr, "\nWith -x 3, files that the receiver already has are skipped and\n");
+  fprintf(stderr, "partial files are resumed, both after verifying the file CRC.\n");
   fprintf(stderr, "\t-h: Show this text and exit\n");
   exit(errcode);
 }
 
+/****************************************************************************
+ * Name: sz_sendpath
+ *
+ * Description:
+ *   Send the file 'lname' as 'rname'.  If 'lname' is a directory, then
+ *   send every file in the directory tree instead, with remote names
+ *   relative to 'rname'.
+ *
+ ****************************************************************************/
+
+static int sz_sendpath(ZMSHANDLE handle, FAR const char *lname,
+                       FAR const char *rname, enum zm_xfertype_e xfrtype,
+                       enum zm_option_e xfroption, bool skip)
+{
+  FAR struct dirent *entry;
+  FAR char *nextlname;
+  FAR char *nextrname;
+  struct stat buf;
+  DIR *dirp;
+  int errcode;
+  int ret;
+
+  ret = stat(lname, &buf);
+  if (ret < 0)
+    {
+      errcode = errno;
+      fprintf(stderr, "ERROR: Failed to stat %s: %d\n", lname, errcode);
+      return -errcode;
+    }
+
+  /* Send a regular file */
+
+  if (!S_ISDIR(buf.st_mode))
+    {
+      ret = zms_send(handle, lname, rname, xfrtype, xfroption, skip);
+      if (ret < 0)
+        {
+          fprintf(stderr, "ERROR: Transfer of %s failed: %d\n", lname, ret);
+        }
+
+      return ret;
+    }
+
+  /* Send each entry in the directory */
+
+  dirp = opendir(lname);
+  if (!dirp)
+    {
+      errcode = errno;
+      fprintf(stderr, "ERROR: Failed to open directory %s: %d\n",
+              lname, errcode);
+      return -errcode;
+    }
+
+  while ((entry = readdir(dirp)) != NULL)
+    {
+      if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+        {
+          continue;
+        }
+
+      asprintf(&nextlname, "%s/%s", lname, entry->d_name);
+      asprintf(&nextrname, "%s/%s", rname, entry->d_name);
+      if (!nextlname || !nextrname)
+        {
+          fprintf(stderr, "ERROR: Out-of-memory\n");
+          free(nextlname);
+          free(nextrname);
+          ret = -ENOMEM;
+          break;
+        }
+
+      ret = sz_sendpath(handle, nextlname, nextrname, xfrtype, xfroption,
+                        skip);
+
+      free(nextlname);
+      free(nextrname);
+
+      if (ret < 0)
+        {
+          break;
+        }
+    }
+
+  closedir(dirp);
+  return ret;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -230,9 +324,10 @@ int sz_main(int argc, FAR char **argv)
           nextrname = basename(ralloc);
         }
 
-      /* Transfer the file */
+      /* Transfer the file or directory tree */
 
-      ret = zms_send(handle, nextlname, nextrname, xfrtype, xfroption, skip);
+      ret = sz_sendpath(handle, nextlname, nextrname, xfrtype, xfroption,
+                        skip);
 
       /* Free any allocations made for the remote file name */
 
@@ -245,10 +340,8 @@ int sz_main(int argc, FAR char **argv)
 
       if (ret < 0)
         {
-          fprintf(stderr, "ERROR: Transfer of %s failed: %d\n",
-                  nextlname, errno);
           goto errout_with_zmodem;
-       }
+        }
     }
 
   exitcode = EXIT_SUCCESS;
@@ -48,8 +48,14 @@
 #include <sys/types.h>
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <debug.h>
 
+#ifdef CONFIG_SYSTEM_ZMODEM_ASYNCWRITE
+#  include <pthread.h>
+#  include <semaphore.h>
+#endif
+
 #include <nuttx/compiler.h>
 #include <nuttx/ascii.h>
 
@@ -218,6 +224,21 @@
 
 #define ZM_PKTBUFSIZE (CONFIG_SYSTEM_ZMODEM_PKTBUFSIZE + 5)
 
+/* Receive file buffering.  With asynchronous writes, one buffer is written
+ * while the other is being filled.
+ */
+
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+#  if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE < CONFIG_SYSTEM_ZMODEM_PKTBUFSIZE
+#    error CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE must be at least CONFIG_SYSTEM_ZMODEM_PKTBUFSIZE
+#  endif
+#  ifdef CONFIG_SYSTEM_ZMODEM_ASYNCWRITE
+#    define ZM_NFILEBUFS 2
+#  else
+#    define ZM_NFILEBUFS 1
+#  endif
+#endif
+
 /* Debug Definitions ********************************************************/
 
 /* Non-standard debug selectable with CONFIG_DEBUG_ZMODEM.  Debug output goes
@@ -340,6 +361,7 @@ struct zm_state_s
   uint16_t rcvlen;           /* Number valid bytes in rcvbuf[] */
   uint16_t rcvndx;           /* Index to the next valid bytes in rcvbuf[] (1) */
   uint16_t pktlen;           /* Number valid bytes in pktbuf[] */
+  FAR uint8_t *pktptr;       /* Packet data goes here: pktbuf[] or a file buffer */
   uint16_t flags;            /* See ZM_FLAG_* definitions */
   uint16_t nerrors;          /* Number of data errors */
   timer_t  timer;            /* Watchdog timer */
@@ -359,6 +381,33 @@ struct zm_state_s
   uint8_t  scratch[CONFIG_SYSTEM_ZMODEM_SNDBUFSIZE];
 };
 
+/* Receive file buffer.  File data packets are unescaped directly into the
+ * current buffer and written out in whole blocks.
+ */
+
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+struct zm_filebuf_s
+{
+  size_t fill;               /* Number of good bytes in data[cur] */
+  size_t limit;              /* Number of bytes in data[cur] that make a block */
+  uint8_t cur;               /* Index of the buffer being filled */
+  int fd;                    /* Output file descriptor; -1 if not buffering */
+#ifdef CONFIG_SYSTEM_ZMODEM_ASYNCWRITE
+  pthread_t writer;          /* Writer thread */
+  sem_t wrsem;               /* Posted when a block is queued for the writer */
+  sem_t donesem;             /* Posted when the writer is done with a block */
+  FAR const uint8_t *wrbuf;  /* Block queued for the writer */
+  size_t wrlen;              /* Size of the queued block */
+  int errcode;               /* First write error (negated errno) */
+  bool stop;                 /* Tells the writer to exit */
+#endif
+
+  /* Room for a full block plus the packet that overflows it */
+
+  uint8_t data[ZM_NFILEBUFS][CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE + ZM_PKTBUFSIZE];
+};
+#endif
+
 /* Receive state information */
 
 struct zmr_state_s
@@ -378,15 +427,18 @@ struct zmr_state_s
   uint8_t f3;                /* Transfer flag F3 */
 #endif
   uint8_t ntimeouts;         /* Number of timeouts */
-  uint32_t crc;              /* Remove file CRC */
   FAR char *filename;        /* Local filename */
   FAR char *attn;            /* Attention string received from remote peer */
   off_t offset;              /* Current file offset */
   off_t filesize;            /* Remote file size */
+  off_t crclen;              /* Length of the local file to verify by CRC */
 #ifdef CONFIG_SYSTEM_ZMODEM_TIMESTAMPS
   time_t timestamp;          /* Remote time stamp */
 #endif
   int outfd;                 /* Local output file descriptor */
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+  struct zm_filebuf_s filebuf; /* Buffer for data written to outfd */
+#endif
 };
 
 /* Send state information */
@@ -413,7 +465,9 @@ struct zms_state_s
   off_t offset;              /* Current file offset */
   off_t lastoffs;            /* Last acknowledged file offset */
   off_t zrpos;               /* Last offset from ZRPOS */
+  off_t ackreq;              /* Offset of the last ZCRCQ subpacket */
   off_t filesize;            /* Size of the file to send */
+  off_t crclen;              /* File CRC length requested by the receiver */
   int infd;                  /* Local input file descriptor */
 };
 
@@ -568,14 +622,48 @@ int zm_writefile(int fd, FAR const uint8_t *buffer, size_t buflen, bool zcnl);
  * Name: zm_filecrc
  *
  * Description:
- *   Perform CRC32 calculation on a file.
+ *   Perform CRC32 calculation on the first 'length' bytes of a file.  If
+ *   'length' is zero, the CRC is calculated over the entire file.
  *
  * Assumptions:
  *   The allocated I/O buffer is available to buffer file data.
  *
  ****************************************************************************/
 
-uint32_t zm_filecrc(FAR struct zm_state_s *pzm, FAR const char *filename);
+uint32_t zm_filecrc(FAR struct zm_state_s *pzm, FAR const char *filename,
+                    off_t length);
+
+/****************************************************************************
+ * Name: zm_crc32part
+ *
+ * Description:
+ *   Continue a CRC32 calculation over a buffer.  Same as crc32part(), but
+ *   using slice-by-8 tables if CONFIG_SYSTEM_ZMODEM_CRC32SLICE8 is set.
+ *
+ ****************************************************************************/
+
+uint32_t zm_crc32part(FAR const uint8_t *src, size_t len, uint32_t crc);
+
+/****************************************************************************
+ * Name: zm_fbinitialize, zm_fbuninitialize, zm_fbopen, zm_fbptr,
+ *       zm_fbcommit, zm_fbclose
+ *
+ * Description:
+ *   Receive file buffering (see zm_filebuf.c).  File data packets are
+ *   unescaped at zm_fbptr(), accepted with zm_fbcommit() once their CRC
+ *   has been checked, and written to the file in blocks of
+ *   CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE bytes at aligned file offsets.
+ *
+ ****************************************************************************/
+
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+int zm_fbinitialize(FAR struct zm_filebuf_s *fb);
+void zm_fbuninitialize(FAR struct zm_filebuf_s *fb);
+void zm_fbopen(FAR struct zm_filebuf_s *fb, int fd, off_t offset);
+FAR uint8_t *zm_fbptr(FAR struct zm_filebuf_s *fb);
+int zm_fbcommit(FAR struct zm_filebuf_s *fb, size_t nbytes);
+int zm_fbclose(FAR struct zm_filebuf_s *fb, bool flush);
+#endif
 
 /****************************************************************************
  * Name: zm_putzdle
@@ -593,6 +681,27 @@ uint32_t zm_filecrc(FAR struct zm_state_s *pzm, FAR const char *filename);
 FAR uint8_t *zm_putzdle(FAR struct zm_state_s *pzm, FAR uint8_t *buffer,
                         uint8_t ch);
 
+/****************************************************************************
+ * Name: zm_putzdlebuf
+ *
+ * Description:
+ *   Transfer a block of data to a buffer performing ZDLE escaping, and
+ *   accumulate the CRC of the raw data in the same pass.
+ *
+ * Input Parameters:
+ *   pzm    - Zmodem session state
+ *   dest   - Buffer in which to add the escaped data (up to 2 * srclen)
+ *   src    - The raw data.  May lie in the dest buffer if it starts at
+ *            least srclen bytes after dest.
+ *   srclen - The number of bytes in src
+ *   crc    - The accumulated CRC, updated on return
+ *
+ ****************************************************************************/
+
+FAR uint8_t *zm_putzdlebuf(FAR struct zm_state_s *pzm, FAR uint8_t *dest,
+                           FAR const uint8_t *src, size_t srclen,
+                           FAR uint32_t *crc);
+
 /****************************************************************************
  * Name: zm_senddata
  *
@@ -725,6 +834,16 @@ void zm_readstate(FAR struct zm_state_s *pzm);
 
 int zm_timeout(FAR struct zm_state_s *pzm);
 
+/****************************************************************************
+ * Name: zm_perfregister
+ *
+ * Description:
+ *   Register the transfer counters in the performance counter registry.
+ *
+ ****************************************************************************/
+
+void zm_perfregister(void);
+
 /****************************************************************************
  * Name: zm_rcvpending
  *
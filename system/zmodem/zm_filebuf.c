@@ -0,0 +1,341 @@
+/****************************************************************************
+ * system/zmodem/zm_filebuf.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <assert.h>
+#include <errno.h>
+
+#include "zm.h"
+
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: zm_fbsemwait
+ *
+ * Description:
+ *   Take a semaphore, ignoring interruptions by the SIGALRM timeouts.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSTEM_ZMODEM_ASYNCWRITE
+static void zm_fbsemwait(FAR sem_t *sem)
+{
+  while (sem_wait(sem) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: zm_fbwriter
+ *
+ * Description:
+ *   The writer thread.  Writes each block queued by zm_fbwrite() to the
+ *   file and records the first error.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSTEM_ZMODEM_ASYNCWRITE
+static FAR void *zm_fbwriter(FAR void *arg)
+{
+  FAR struct zm_filebuf_s *fb = (FAR struct zm_filebuf_s *)arg;
+  ssize_t nwritten;
+  sigset_t set;
+
+  /* Leave the SIGALRM timeouts to the thread running the state machine */
+
+  (void)sigemptyset(&set);
+  (void)sigaddset(&set, SIGALRM);
+  (void)pthread_sigmask(SIG_BLOCK, &set, NULL);
+
+  for (; ; )
+    {
+      zm_fbsemwait(&fb->wrsem);
+      if (fb->stop)
+        {
+          break;
+        }
+
+      nwritten = zm_write(fb->fd, fb->wrbuf, fb->wrlen);
+      if (nwritten < 0 && fb->errcode == OK)
+        {
+          fb->errcode = (int)nwritten;
+        }
+
+      sem_post(&fb->donesem);
+    }
+
+  return NULL;
+}
+#endif
+
+/****************************************************************************
+ * Name: zm_fbwrite
+ *
+ * Description:
+ *   Write a block to the file.  With CONFIG_SYSTEM_ZMODEM_ASYNCWRITE, this
+ *   only waits for the previous block to complete and queues this one for
+ *   the writer thread.
+ *
+ ****************************************************************************/
+
+static int zm_fbwrite(FAR struct zm_filebuf_s *fb, FAR const uint8_t *buffer,
+                      size_t buflen)
+{
+#ifdef CONFIG_SYSTEM_ZMODEM_ASYNCWRITE
+  zm_fbsemwait(&fb->donesem);
+  if (fb->errcode < 0)
+    {
+      sem_post(&fb->donesem);
+      return fb->errcode;
+    }
+
+  fb->wrbuf = buffer;
+  fb->wrlen = buflen;
+  sem_post(&fb->wrsem);
+  return OK;
+#else
+  ssize_t nwritten;
+
+  nwritten = zm_write(fb->fd, buffer, buflen);
+  return nwritten < 0 ? (int)nwritten : OK;
+#endif
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: zm_fbinitialize
+ *
+ * Description:
+ *   Initialize a file buffer and, with CONFIG_SYSTEM_ZMODEM_ASYNCWRITE,
+ *   start its writer thread.
+ *
+ ****************************************************************************/
+
+int zm_fbinitialize(FAR struct zm_filebuf_s *fb)
+{
+#ifdef CONFIG_SYSTEM_ZMODEM_ASYNCWRITE
+  int ret;
+#endif
+
+  fb->fd = -1;
+
+#ifdef CONFIG_SYSTEM_ZMODEM_ASYNCWRITE
+  sem_init(&fb->wrsem, 0, 0);
+  sem_init(&fb->donesem, 0, 1);
+
+  ret = pthread_create(&fb->writer, NULL, zm_fbwriter, fb);
+  if (ret != 0)
+    {
+      zmdbg("ERROR: pthread_create failed: %d\n", ret);
+      sem_destroy(&fb->wrsem);
+      sem_destroy(&fb->donesem);
+      return -ret;
+    }
+#endif
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: zm_fbuninitialize
+ *
+ * Description:
+ *   Stop the writer thread, if any.  zm_fbclose() must have been called
+ *   for the last file.
+ *
+ ****************************************************************************/
+
+void zm_fbuninitialize(FAR struct zm_filebuf_s *fb)
+{
+#ifdef CONFIG_SYSTEM_ZMODEM_ASYNCWRITE
+  zm_fbsemwait(&fb->donesem);
+  fb->stop = true;
+  sem_post(&fb->wrsem);
+  (void)pthread_join(fb->writer, NULL);
+
+  sem_destroy(&fb->wrsem);
+  sem_destroy(&fb->donesem);
+#endif
+}
+
+/****************************************************************************
+ * Name: zm_fbopen
+ *
+ * Description:
+ *   Start buffering data for a file that is positioned at 'offset'.  The
+ *   first block is short if needed so that all later writes start at a
+ *   multiple of CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE.
+ *
+ ****************************************************************************/
+
+void zm_fbopen(FAR struct zm_filebuf_s *fb, int fd, off_t offset)
+{
+  fb->fd    = fd;
+  fb->cur   = 0;
+  fb->fill  = 0;
+  fb->limit = CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE -
+              offset % CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE;
+}
+
+/****************************************************************************
+ * Name: zm_fbptr
+ *
+ * Description:
+ *   Return where the next packet should be unescaped.  At least
+ *   ZM_PKTBUFSIZE bytes are available there.
+ *
+ ****************************************************************************/
+
+FAR uint8_t *zm_fbptr(FAR struct zm_filebuf_s *fb)
+{
+  return &fb->data[fb->cur][fb->fill];
+}
+
+/****************************************************************************
+ * Name: zm_fbcommit
+ *
+ * Description:
+ *   Accept 'nbytes' of good data at zm_fbptr().  If that completes a block,
+ *   write it out and carry the excess over to the next buffer.
+ *
+ * Returned Value:
+ *   Zero on success; a negated errno value if a write failed.
+ *
+ ****************************************************************************/
+
+int zm_fbcommit(FAR struct zm_filebuf_s *fb, size_t nbytes)
+{
+  FAR uint8_t *buffer;
+  size_t excess;
+  int ret;
+
+  DEBUGASSERT(fb->fd >= 0 && fb->fill + nbytes <= sizeof(fb->data[0]));
+
+  fb->fill += nbytes;
+  if (fb->fill < fb->limit)
+    {
+      return OK;
+    }
+
+  buffer = fb->data[fb->cur];
+  ret    = zm_fbwrite(fb, buffer, fb->limit);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  /* The excess is less than one packet */
+
+  excess = fb->fill - fb->limit;
+
+#if ZM_NFILEBUFS > 1
+  /* zm_fbwrite() waited for the writer to finish with the other buffer */
+
+  fb->cur = (fb->cur + 1) % ZM_NFILEBUFS;
+  memcpy(fb->data[fb->cur], buffer + fb->limit, excess);
+#else
+  memmove(buffer, buffer + fb->limit, excess);
+#endif
+
+  fb->fill  = excess;
+  fb->limit = CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: zm_fbclose
+ *
+ * Description:
+ *   Stop buffering data for the file.  If 'flush' is true, the partial
+ *   block is written out first; otherwise it is discarded.  In either case
+ *   all writes to the file have completed on return.
+ *
+ * Returned Value:
+ *   Zero on success; a negated errno value if a write failed.
+ *
+ ****************************************************************************/
+
+int zm_fbclose(FAR struct zm_filebuf_s *fb, bool flush)
+{
+  int ret = OK;
+
+  if (fb->fd < 0)
+    {
+      return OK;
+    }
+
+  if (flush && fb->fill > 0)
+    {
+      ret = zm_fbwrite(fb, fb->data[fb->cur], fb->fill);
+    }
+
+#ifdef CONFIG_SYSTEM_ZMODEM_ASYNCWRITE
+  zm_fbsemwait(&fb->donesem);
+  if (flush && ret == OK)
+    {
+      ret = fb->errcode;
+    }
+
+  fb->errcode = OK;
+  sem_post(&fb->donesem);
+#endif
+
+  fb->fd   = -1;
+  fb->fill = 0;
+  return ret;
+}
+
+#endif /* CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0 */
@@ -43,6 +43,7 @@
 
 #include <nuttx/config.h>
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <crc16.h>
 #include <crc32.h>
@@ -53,6 +54,74 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* ZDLE escape classes in g_zdlecls[] */
+
+#define ZE_A   0x01          /* Always escaped */
+#define ZE_C   0x02          /* Control character, escaped if ZM_FLAG_ESCCTRL */
+#define ZE_CR  0x04          /* CR, also escaped if it follows '@' */
+#define ZE_R   (ZE_C | ZE_CR)
+#define ZE_T   0x08          /* '@' (either parity), arms the CR escape */
+
+/* Polynomial of the Zmodem CRC32 (0x04c11db7 reflected) */
+
+#define ZM_CRC32_POLY 0xedb88320
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Escape class of every byte value.  The Zmodem protocol requires that
+ * ZDLE, DLE, XON, XOFF, GS, DEL and 0xff be escaped, with or without the
+ * high bit for all but ZDLE.  A CR following '@' is escaped as well and, if
+ * the remote asked for it, so is every control character.
+ */
+
+static const uint8_t g_zdlecls[256] =
+{
+  ZE_C, ZE_C, ZE_C, ZE_C, ZE_C, ZE_C, ZE_C, ZE_C,  /* 00-07 */
+  ZE_C, ZE_C, ZE_C, ZE_C, ZE_C, ZE_R, ZE_C, ZE_C,  /* 08-0f */
+  ZE_A, ZE_A, ZE_C, ZE_A, ZE_C, ZE_C, ZE_C, ZE_C,  /* 10-17 */
+  ZE_A, ZE_C, ZE_C, ZE_C, ZE_C, ZE_A, ZE_C, ZE_C,  /* 18-1f */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* 20-27 */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* 28-2f */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* 30-37 */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* 38-3f */
+  ZE_T,    0,    0,    0,    0,    0,    0,    0,  /* 40-47 */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* 48-4f */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* 50-57 */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* 58-5f */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* 60-67 */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* 68-6f */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* 70-77 */
+     0,    0,    0,    0,    0,    0,    0, ZE_A,  /* 78-7f */
+  ZE_C, ZE_C, ZE_C, ZE_C, ZE_C, ZE_C, ZE_C, ZE_C,  /* 80-87 */
+  ZE_C, ZE_C, ZE_C, ZE_C, ZE_C, ZE_R, ZE_C, ZE_C,  /* 88-8f */
+  ZE_A, ZE_A, ZE_C, ZE_A, ZE_C, ZE_C, ZE_C, ZE_C,  /* 90-97 */
+  ZE_C, ZE_C, ZE_C, ZE_C, ZE_C, ZE_A, ZE_C, ZE_C,  /* 98-9f */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* a0-a7 */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* a8-af */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* b0-b7 */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* b8-bf */
+  ZE_T,    0,    0,    0,    0,    0,    0,    0,  /* c0-c7 */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* c8-cf */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* d0-d7 */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* d8-df */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* e0-e7 */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* e8-ef */
+     0,    0,    0,    0,    0,    0,    0,    0,  /* f0-f7 */
+     0,    0,    0,    0,    0,    0,    0, ZE_A,  /* f8-ff */
+};
+
+#ifdef CONFIG_SYSTEM_ZMODEM_CRC32SLICE8
+/* Eight 256-entry tables for slice-by-8.  g_crc32tab[0] is the classic byte
+ * table; g_crc32tab[k][b] is the CRC of byte b followed by k zero bytes.
+ * They are built on first use to keep the 8 KiB out of the flash image.
+ */
+
+static uint32_t g_crc32tab[8][256];
+static volatile bool g_crc32valid;
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -85,9 +154,194 @@ const uint8_t g_canistr[CANISTR_SIZE] =
 };
 
 /****************************************************************************
- * Public Function Protypes
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: zm_crc32init
+ *
+ * Description:
+ *   Build the slice-by-8 CRC32 tables.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSTEM_ZMODEM_CRC32SLICE8
+static void zm_crc32init(void)
+{
+  uint32_t crc;
+  int i;
+  int j;
+
+  for (i = 0; i < 256; i++)
+    {
+      crc = i;
+      for (j = 0; j < 8; j++)
+        {
+          crc = (crc & 1) ? (crc >> 1) ^ ZM_CRC32_POLY : crc >> 1;
+        }
+
+      g_crc32tab[0][i] = crc;
+    }
+
+  for (i = 0; i < 256; i++)
+    {
+      for (j = 1; j < 8; j++)
+        {
+          crc = g_crc32tab[j - 1][i];
+          g_crc32tab[j][i] = (crc >> 8) ^ g_crc32tab[0][crc & 0xff];
+        }
+    }
+
+  g_crc32valid = true;
+}
+#endif
+
+/****************************************************************************
+ * Name: zm_crc32slice8
+ *
+ * Description:
+ *   Advance the CRC32 over exactly eight bytes.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSTEM_ZMODEM_CRC32SLICE8
+static inline uint32_t zm_crc32slice8(FAR const uint8_t *src, uint32_t crc)
+{
+  uint32_t lo;
+  uint32_t hi;
+
+  lo  = crc ^ ((uint32_t)src[0]       | (uint32_t)src[1] << 8 |
+               (uint32_t)src[2] << 16 | (uint32_t)src[3] << 24);
+  hi  =        (uint32_t)src[4]       | (uint32_t)src[5] << 8 |
+               (uint32_t)src[6] << 16 | (uint32_t)src[7] << 24;
+
+  return g_crc32tab[7][lo & 0xff] ^ g_crc32tab[6][(lo >> 8) & 0xff] ^
+         g_crc32tab[5][(lo >> 16) & 0xff] ^ g_crc32tab[4][lo >> 24] ^
+         g_crc32tab[3][hi & 0xff] ^ g_crc32tab[2][(hi >> 8) & 0xff] ^
+         g_crc32tab[1][(hi >> 16) & 0xff] ^ g_crc32tab[0][hi >> 24];
+}
+#endif
+
+/****************************************************************************
+ * Name: zm_zdlemask
+ *
+ * Description:
+ *   Return the escape classes that currently require a ZDLE.
+ *
+ ****************************************************************************/
+
+static inline uint8_t zm_zdlemask(uint16_t flags)
+{
+  uint8_t mask = ZE_A;
+
+  if ((flags & ZM_FLAG_ESCCTRL) != 0)
+    {
+      mask |= ZE_C;
+    }
+
+  if ((flags & ZM_FLAG_ATSIGN) != 0)
+    {
+      mask |= ZE_CR;
+    }
+
+  return mask;
+}
+
+/****************************************************************************
+ * Name: zm_escape
+ *
+ * Description:
+ *   Escape a block of data.  'mask' is the set of escape classes that
+ *   currently require a ZDLE; the CR class is switched on and off as '@'
+ *   characters come and go.  Returns the updated mask.
+ *
+ ****************************************************************************/
+
+static inline uint8_t zm_escape(FAR uint8_t **dest, FAR const uint8_t *src,
+                                size_t srclen, uint8_t mask)
+{
+  FAR uint8_t *ptr = *dest;
+  uint8_t cls;
+  uint8_t ch;
+
+  while (srclen-- > 0)
+    {
+      ch  = *src++;
+      cls = g_zdlecls[ch];
+
+      if ((cls & mask) != 0)
+        {
+          *ptr++ = ZDLE;
+
+          if (ch == ASCII_DEL)
+            {
+              ch = ZRUB0;
+            }
+          else if (ch == 0xff)
+            {
+              ch = ZRUB1;
+            }
+          else
+            {
+              ch ^= 0x40;
+            }
+        }
+
+      *ptr++ = ch;
+
+      if ((cls & ZE_T) != 0)
+        {
+          mask |= ZE_CR;
+        }
+      else
+        {
+          mask &= ~ZE_CR;
+        }
+    }
+
+  *dest = ptr;
+  return mask;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: zm_crc32part
+ *
+ * Description:
+ *   Continue a CRC32 calculation over a buffer.  Same as crc32part(), but
+ *   using slice-by-8 tables if CONFIG_SYSTEM_ZMODEM_CRC32SLICE8 is set.
+ *
  ****************************************************************************/
 
+uint32_t zm_crc32part(FAR const uint8_t *src, size_t len, uint32_t crc)
+{
+#ifdef CONFIG_SYSTEM_ZMODEM_CRC32SLICE8
+  if (!g_crc32valid)
+    {
+      zm_crc32init();
+    }
+
+  while (len >= 8)
+    {
+      crc  = zm_crc32slice8(src, crc);
+      src += 8;
+      len -= 8;
+    }
+
+  while (len-- > 0)
+    {
+      crc = (crc >> 8) ^ g_crc32tab[0][(crc ^ *src++) & 0xff];
+    }
+
+  return crc;
+#else
+  return crc32part(src, len, crc);
+#endif
+}
+
 /****************************************************************************
  * Name: zm_putzdle
  *
@@ -104,52 +358,84 @@ const uint8_t g_canistr[CANISTR_SIZE] =
 FAR uint8_t *zm_putzdle(FAR struct zm_state_s *pzm, FAR uint8_t *buffer,
                         uint8_t ch)
 {
-  uint8_t ch7 = ch & 0x7f;
-
-  /* Check if this character requires ZDLE escaping.
-   *
-   * The Zmodem protocol requires that CAN(ZDLE), DLE, XON, XOFF and a CR
-   * following '@' be escaped.
-   */
-
-  if (ch   == ZDLE ||
-      ch7  == ASCII_DLE ||
-      ch7  == ASCII_DC1 ||
-      ch7  == ASCII_DC3 ||
-      ch7  == ASCII_GS ||
-      (ch7 == '\r' && (pzm->flags & ZM_FLAG_ATSIGN)  != 0) ||
-      (ch7 <  ' '  && (pzm->flags & ZM_FLAG_ESCCTRL) != 0) ||
-      ch7  == ASCII_DEL ||
-      ch   == 0xff
-      )
+  uint8_t mask;
+
+  mask = zm_escape(&buffer, &ch, 1, zm_zdlemask(pzm->flags));
+  if ((mask & ZE_CR) != 0)
     {
-      /* Yes... save the data link escape the character */
+      pzm->flags |= ZM_FLAG_ATSIGN;
+    }
+  else
+    {
+      pzm->flags &= ~ZM_FLAG_ATSIGN;
+    }
 
-      *buffer++ = ZDLE;
+  return buffer;
+}
 
-      /* And modify the character itself as appropriate  */
+/****************************************************************************
+ * Name: zm_putzdlebuf
+ *
+ * Description:
+ *   Transfer a block of data to a buffer performing ZDLE escaping, and
+ *   accumulate the CRC of the raw data in the same pass.  The CRC is 32-bit
+ *   if ZM_FLAG_CRC32 is set and 16-bit otherwise.
+ *
+ * Input Parameters:
+ *   pzm    - Zmodem session state
+ *   dest   - Buffer in which to add the escaped data.  Worst case, this
+ *            is twice the size of the source data.
+ *   src    - The raw, unescaped data.  This may lie within the destination
+ *            buffer, provided that it starts at least srclen bytes after
+ *            dest.
+ *   srclen - The number of bytes in src
+ *   crc    - The accumulated CRC, updated on return
+ *
+ * Returned Value:
+ *   A pointer just past the last byte added to dest.
+ *
+ ****************************************************************************/
 
-      if (ch == ASCII_DEL)
-        {
-          ch = ZRUB0;
-        }
-      else if (ch == 0xff)
+FAR uint8_t *zm_putzdlebuf(FAR struct zm_state_s *pzm, FAR uint8_t *dest,
+                           FAR const uint8_t *src, size_t srclen,
+                           FAR uint32_t *crc)
+{
+  uint32_t newcrc = *crc;
+  uint8_t mask;
+
+  mask = zm_zdlemask(pzm->flags);
+
+  if ((pzm->flags & ZM_FLAG_CRC32) != 0)
+    {
+#ifdef CONFIG_SYSTEM_ZMODEM_CRC32SLICE8
+      if (!g_crc32valid)
         {
-          ch = ZRUB1;
+          zm_crc32init();
         }
-      else
+
+      /* Eight bytes at a time: fold them into the CRC and escape them while
+       * they are still in cache.
+       */
+
+      while (srclen >= 8)
         {
-          ch ^= 0x40;
+          newcrc  = zm_crc32slice8(src, newcrc);
+          mask    = zm_escape(&dest, src, 8, mask);
+          src    += 8;
+          srclen -= 8;
         }
-    }
-
-  /* Save the possibly escaped character */
+#endif
 
-  *buffer++ = ch;
+      newcrc = zm_crc32part(src, srclen, newcrc);
+    }
+  else
+    {
+      newcrc = (uint32_t)crc16part(src, srclen, (uint16_t)newcrc);
+    }
 
-  /* Check if the character is the AT sign */
+  mask = zm_escape(&dest, src, srclen, mask);
 
-  if (ch7 == '@')
+  if ((mask & ZE_CR) != 0)
     {
       pzm->flags |= ZM_FLAG_ATSIGN;
     }
@@ -158,7 +444,8 @@ FAR uint8_t *zm_putzdle(FAR struct zm_state_s *pzm, FAR uint8_t *buffer,
       pzm->flags &= ~ZM_FLAG_ATSIGN;
     }
 
-  return buffer;
+  *crc = newcrc;
+  return dest;
 }
 
 /****************************************************************************
@@ -204,19 +491,7 @@ int zm_senddata(FAR struct zm_state_s *pzm, FAR const uint8_t *buffer,
 
   /* Transfer the data to the I/O buffer, accumulating the CRC */
 
-  while (buflen-- > 0)
-    {
-      if (zbin == ZBIN)
-        {
-          crc = (uint32_t)crc16part(buffer, 1, (uint16_t)crc);
-        }
-      else /* zbin = ZBIN32 */
-        {
-          crc = crc32part(buffer, 1, crc);
-        }
-
-      ptr = zm_putzdle(pzm, ptr, *buffer++);
-    }
+  ptr = zm_putzdlebuf(pzm, ptr, buffer, buflen, &crc);
 
   /* Trasnfer the data link escape character (without updating the CRC) */
 
@@ -230,7 +505,7 @@ int zm_senddata(FAR struct zm_state_s *pzm, FAR const uint8_t *buffer,
     }
   else
     {
-      crc = crc32part((FAR const uint8_t *)&term, 1, crc);
+      crc = zm_crc32part((FAR const uint8_t *)&term, 1, crc);
     }
 
   *ptr++ = term;
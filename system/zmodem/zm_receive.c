@@ -146,7 +146,10 @@ static int zmr_error(FAR struct zm_state_s *pzm);
 
 static int zmr_parsefilename(FAR struct zmr_state_s *pzmr,
                              FAR const uint8_t *namptr);
-static int zmr_openfile(FAR struct zmr_state_s *pzmr, uint32_t crc);
+static bool zmr_badpath(FAR const char *path);
+static int zmr_mkparents(FAR char *path, FAR char *relpath);
+static int zmr_openfile(FAR struct zmr_state_s *pzmr, off_t offset);
+static void zmr_readdata(FAR struct zmr_state_s *pzmr);
 static int zmr_fileerror(FAR struct zmr_state_s *pzmr, uint8_t type,
                          uint32_t data);
 static void zmr_filecleanup(FAR struct zmr_state_s *pzmr);
@@ -245,7 +248,7 @@ static const struct zm_transition_s g_zmr_reading[] =
 static const struct zm_transition_s g_zmr_finish[] =
 {
   {ZME_RQINIT,   true,  ZMR_START,       zmr_zrinit},
-  {ZME_FILE,     true,  ZMR_FILEINFO,    zmr_zfile},
+  {ZME_FILE,     false, ZMR_FILEINFO,    zmr_zfile},
   {ZME_NAK,      true,  ZMR_FINISH,      zmr_zfin},
   {ZME_FIN,      true,  ZMR_FINISH,      zmr_zfin},
   {ZME_TIMEOUT,  false, ZMR_READING,     zmr_finto},
@@ -326,8 +329,13 @@ static int zmr_zrinit(FAR struct zm_state_s *pzm)
   /* Send ZRINIT */
 
   pzm->timeout = CONFIG_SYSTEM_ZMODEM_RESPTIME;
+#ifdef CONFIG_SYSTEM_ZMODEM_RCVSTREAM
+  buf[0]       = 0;
+  buf[1]       = 0;
+#else
   buf[0]       = CONFIG_SYSTEM_ZMODEM_PKTBUFSIZE & 0xff;
   buf[1]       = (CONFIG_SYSTEM_ZMODEM_PKTBUFSIZE >> 8) & 0xff;
+#endif
   buf[2]       = 0;
   buf[3]       = pzmr->rcaps;
   return zm_sendhexhdr(pzm, ZRINIT, buf);
@@ -463,22 +471,54 @@ static int zmr_freecnt(FAR struct zm_state_s *pzm)
  * Name: zmr_zcrc
  *
  * Description:
- *   Received file CRC.  Need to accept or reject it.
+ *   Received the CRC of the first pzmr->crclen bytes of the remote file.
+ *   Compare it with the CRC of the existing local file and skip the file
+ *   if we already have all of it, resume the transfer if we have the first
+ *   part of it, or receive the whole file otherwise.
  *
  ****************************************************************************/
 
 static int zmr_zcrc(FAR struct zm_state_s *pzm)
 {
   FAR struct zmr_state_s *pzmr = (FAR struct zmr_state_s *)pzm;
+  uint32_t rcrc;
+  uint32_t lcrc;
+
+  /* Get the remote file CRC and calculate the local CRC over the same
+   * number of bytes.
+   */
+
+  rcrc = zm_bytobe32(pzm->hdrdata + 1);
+  lcrc = zm_filecrc(pzm, pzmr->filename, pzmr->crclen);
+
+  zmdbg("ZMR_STATE %d: CRC=%08x vs. %08x length %ld\n",
+        pzm->state, rcrc, lcrc, (long)pzmr->crclen);
+
+  if (rcrc == lcrc)
+    {
+      if (pzmr->crclen == pzmr->filesize)
+        {
+          /* The local file is identical.  Skip it. */
+
+          zmdbg("ZMR_STATE %d->%d: File unchanged, send ZSKIP\n",
+                pzm->state, ZMR_START);
+
+          pzm->state = ZMR_START;
+          return zm_sendhexhdr(pzm, ZSKIP, g_zeroes);
+        }
 
-  /* Get the remote file CRC */
+      /* The local file holds the first part of the remote file.  Resume
+       * the transfer at the end of the local file.
+       */
 
-  pzmr->crc = zm_bytobe32(pzm->hdrdata);
+      pzm->flags |= ZM_FLAG_APPEND;
+      return zmr_openfile(pzmr, pzmr->crclen);
+    }
 
-  /* And create the local file */
+  /* The local file differs.  Replace it. */
 
-  zmdbg("ZMR_STATE %d: CRC=%08x call zmr_openfile\n", pzmr->crc, pzm->state);
-  return zmr_openfile(pzmr, zm_bytobe32(pzm->hdrdata + 1));
+  pzm->flags &= ~ZM_FLAG_APPEND;
+  return zmr_openfile(pzmr, 0);
 }
 
 /****************************************************************************
@@ -491,8 +531,13 @@ static int zmr_zcrc(FAR struct zm_state_s *pzm)
 
 static int zmr_nakcrc(FAR struct zm_state_s *pzm)
 {
+  FAR struct zmr_state_s *pzmr = (FAR struct zmr_state_s *)pzm;
+  uint8_t by[4];
+
   zmdbg("ZMR_STATE %d: Send ZCRC\n", pzm->state);
-  return zm_sendhexhdr(pzm, ZCRC, g_zeroes);
+
+  zm_be32toby(pzmr->crclen, by);
+  return zm_sendhexhdr(pzm, ZCRC, by);
 }
 
 /****************************************************************************
@@ -561,7 +606,7 @@ static int zmr_zdata(FAR struct zm_state_s *pzm)
 
   /* Setup to receive a data packet.  Enter PSTATE_DATA */
 
-  zm_readstate(pzm);
+  zmr_readdata(pzmr);
   return OK;
 }
 
@@ -637,24 +682,9 @@ static int zmr_filename(FAR struct zm_state_s *pzm)
       pzmr->filename = NULL;
     }
 
-  /* Parse the new file name from the beginning of the packet and verify
-   * that we can use it.
-   */
-
-  pktptr = pzmr->cmn.pktbuf;
-  ret    = zmr_parsefilename(pzmr, pktptr);
-
-  if (ret < 0)
-    {
-      zmdbg("ZMR_STATE %d->%d: ERROR: Failed to parse filename. Send ZSKIP: %d\n",
-            pzm->state, ZMR_START, ret);
-
-      pzmr->cmn.state = ZMR_START;
-      return zm_sendhexhdr(&pzmr->cmn, ZSKIP, g_zeroes);
-    }
-
   /* Skip over the file name (and its NUL termination) */
 
+  pktptr = pzmr->cmn.pktbuf;
   pktptr += (strlen((FAR const char *)pktptr) + 1);
 
   /* ZFILE: Following the file name are:
@@ -681,14 +711,34 @@ static int zmr_filename(FAR struct zm_state_s *pzm)
   pzmr->timestamp = (time_t)timestamp;
 #endif
 
-  /* Check if we need to send the CRC */
+  /* Now parse the new file name from the beginning of the packet and verify
+   * that we can use it.  This depends on the file information above.
+   */
 
-  if ((pzmr->f1 & ZMMASK) == ZMCRC)
+  ret = zmr_parsefilename(pzmr, pzmr->cmn.pktbuf);
+  if (ret < 0)
     {
-      zmdbg("ZMR_STATE %d->%d\n",  pzm->state, ZMR_CRCWAIT);
+      zmdbg("ZMR_STATE %d->%d: ERROR: Failed to parse filename. Send ZSKIP: %d\n",
+            pzm->state, ZMR_START, ret);
+
+      pzmr->cmn.state = ZMR_START;
+      return zm_sendhexhdr(&pzmr->cmn, ZSKIP, g_zeroes);
+    }
+
+  /* Check if we need to send the CRC.  ZP0-ZP3 of ZCRC hold the number of
+   * bytes of the existing local file that the CRC should cover.
+   */
+
+  if (pzmr->crclen > 0)
+    {
+      uint8_t by[4];
+
+      zmdbg("ZMR_STATE %d->%d: Send ZCRC(%ld)\n",
+            pzm->state, ZMR_CRCWAIT, (long)pzmr->crclen);
 
       pzm->state = ZMR_CRCWAIT;
-      return zm_sendhexhdr(pzm, ZCRC, g_zeroes);
+      zm_be32toby(pzmr->crclen, by);
+      return zm_sendhexhdr(pzm, ZCRC, by);
     }
 
   /* We are ready to receive file data packets */
@@ -760,13 +810,25 @@ static int zmr_filedata(FAR struct zm_state_s *pzm)
         }
     }
 
-  /* Write the packet of data to the file */
+  /* Write the packet of data to the file.  If the file is buffered, the
+   * data is already in place and only has to be accepted.
+   */
+
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+  if (pzmr->filebuf.fd >= 0)
+    {
+      ret = zm_fbcommit(&pzmr->filebuf, pzm->pktlen);
+    }
+  else
+#endif
+    {
+      ret = zm_writefile(pzmr->outfd, pzm->pktbuf, pzm->pktlen,
+                         pzmr->f0 == ZCNL);
+    }
 
-  ret = zm_writefile(pzmr->outfd, pzm->pktbuf, pzm->pktlen,
-                     pzmr->f0 == ZCNL);
   if (ret < 0)
     {
-      int errorcode = errno;
+      int errorcode = -ret;
 
       /* Could not write to the file. */
 
@@ -810,7 +872,7 @@ static int zmr_filedata(FAR struct zm_state_s *pzm)
     {
       /* Setup to receive a data packet.  Enter PSTATE_DATA */
 
-      zm_readstate(pzm);
+      zmr_readdata(pzmr);
     }
 
   /* Special handle for different packet types:
@@ -908,6 +970,9 @@ static int zmr_fileto(FAR struct zm_state_s *pzm)
 static int zmr_zeof(FAR struct zm_state_s *pzm)
 {
   FAR struct zmr_state_s *pzmr = (FAR struct zmr_state_s *)pzm;
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+  int ret;
+#endif
 
   zmdbg("ZMR_STATE %d: offset=%ld\n", pzm->state, (unsigned long)pzmr->offset);
 
@@ -922,6 +987,21 @@ static int zmr_zeof(FAR struct zm_state_s *pzm)
       return OK;         /* it was probably spurious */
     }
 
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+  /* Write out the last, partial block */
+
+  ret = zm_fbclose(&pzmr->filebuf, true);
+  if (ret < 0)
+    {
+      zmdbg("ERROR: Write to file failed: %d\n", ret);
+      zmdbg("ZMR_STATE %d->%d\n",  pzm->state, ZMR_FINISH);
+
+      pzm->state = ZMR_FINISH;
+      (void)zmr_fileerror(pzmr, ZFERR, (uint32_t)-ret);
+      return ret;
+    }
+#endif
+
   /* Close the output file.
    * TODO: if we can't close the file, send a ZFERR.
    */
@@ -1135,9 +1215,14 @@ static int zmr_parsefilename(FAR struct zmr_state_s *pzmr,
 
   DEBUGASSERT(pzmr && !pzmr->filename);
 
-  /* Don't allow absolute pathes */
+  pzmr->cmn.flags &= ~ZM_FLAG_APPEND;
+  pzmr->crclen     = 0;
 
-  if (*namptr == '/')
+  /* Don't allow absolute pathes or pathes that leave the file storage
+   * directory.
+   */
+
+  if (zmr_badpath((FAR const char *)namptr))
     {
       return -EINVAL;
     }
@@ -1187,25 +1272,20 @@ static int zmr_parsefilename(FAR struct zmr_state_s *pzmr,
         pzmr->filename, f0, f1, exists, (long)buf.st_size,
         (long)pzmr->filesize);
 
-  /* Are we appending to an existing file? */
+  /* Are we resuming an interrupted transfer? */
 
-  if (f0 == ZCRESUM)
+  if (f0 == ZCRESUM && exists && buf.st_size > 0 &&
+      buf.st_size <= pzmr->filesize)
     {
-      /* One corner case:  The file exists and is already the requested
-       * size.  We already have the file!
+      /* The existing file may be the first part of the remote file (or all
+       * of it).  Keep it and verify its content with the remote file CRC
+       * before resuming (or skipping) the transfer.  Otherwise, the file
+       * is replaced.
        */
 
-       if (exists && buf.st_size == pzmr->filesize)
-         {
-           zmdbg("ZCRESUM: Rejected\n");
-           ret = -EEXIST;
-           goto errout_with_filename;
-         }
-
-      /* Otherwise, indicate that we will append to the file (whether it
-       * exists yet or not.
-       */
+      zmdbg("ZCRESUM: Verify %ld bytes\n", (long)buf.st_size);
 
+      pzmr->crclen     = buf.st_size;
       pzmr->cmn.flags |= ZM_FLAG_APPEND;
     }
 
@@ -1246,18 +1326,16 @@ static int zmr_parsefilename(FAR struct zmr_state_s *pzmr,
 
     case ZMCRC:               /* Transfer if different CRC or length */
       {
-        uint32_t crc = zm_filecrc(&pzmr->cmn, pzmr->filename);
-        zmdbg("ZMCRC: crc=%08x vs. %08x\n", pzmr->crc, crc);
-        zmdbg("       filesize=%08lx st_size=%08lx\n",
+        zmdbg("ZMCRC: filesize=%08lx st_size=%08lx\n",
                (unsigned long)pzmr->filesize, (unsigned long)buf.st_size);
 
-        if (exists &&
-            pzmr->filesize == buf.st_size &&
-            pzmr->crc == crc)
+        /* If the lengths are the same, request the remote file CRC.  The
+         * CRCs are compared when it is received in zmr_zcrc().
+         */
+
+        if (exists && pzmr->filesize == buf.st_size)
           {
-            zmdbg("ZMCRC: Rejected\n");
-            ret = -EPERM;
-            goto errout_with_filename;
+            pzmr->crclen = buf.st_size;
           }
       }
       break;
@@ -1370,10 +1448,11 @@ static int zmr_parsefilename(FAR struct zmr_state_s *pzmr,
     }
 
   /* We have accepted pzmr->filename.  If the file exists and we are not
-   * appending to it, then unlink the old file now.
+   * appending to it or verifying it, then unlink the old file now.
    */
 
-  if (exists && (pzmr->cmn.flags & ZM_FLAG_APPEND) == 0)
+  if (exists && (pzmr->cmn.flags & ZM_FLAG_APPEND) == 0 &&
+      pzmr->crclen == 0)
     {
       ret = unlink(pzmr->filename);
       if (ret != OK)
@@ -1386,6 +1465,22 @@ static int zmr_parsefilename(FAR struct zmr_state_s *pzmr,
         }
     }
 
+  /* A batch transfer of a directory tree may name files in directories
+   * that do not exist yet.
+   */
+
+  if (!exists)
+    {
+      ret = zmr_mkparents(pzmr->filename, pzmr->filename +
+                          strlen(CONFIG_SYSTEM_ZMODEM_MOUNTPOINT) + 1);
+      if (ret < 0)
+        {
+          zmdbg("ERROR: Failed to create directories for %s: %d\n",
+                pzmr->filename, ret);
+          goto errout_with_filename;
+        }
+    }
+
   zmdbg("Accepted filename: %s\n", pzmr->filename);
   return OK;
 
@@ -1395,19 +1490,90 @@ errout_with_filename:
   return ret;
 }
 
+/****************************************************************************
+ * Name: zmr_badpath
+ *
+ * Description:
+ *   Return true if the remote file name is an absolute path or has a ".."
+ *   component that could refer to a file outside of the file storage
+ *   directory.
+ *
+ ****************************************************************************/
+
+static bool zmr_badpath(FAR const char *path)
+{
+  FAR const char *ptr = path;
+
+  if (*ptr == '/')
+    {
+      return true;
+    }
+
+  while (ptr != NULL)
+    {
+      if (ptr[0] == '.' && ptr[1] == '.' && (ptr[2] == '/' || ptr[2] == '\0'))
+        {
+          return true;
+        }
+
+      ptr = strchr(ptr, '/');
+      if (ptr != NULL)
+        {
+          ptr++;
+        }
+    }
+
+  return false;
+}
+
+/****************************************************************************
+ * Name: zmr_mkparents
+ *
+ * Description:
+ *   Create any missing directories in the part of 'path' that begins at
+ *   'relpath'.  The final path component is the file name and is not
+ *   created.
+ *
+ ****************************************************************************/
+
+static int zmr_mkparents(FAR char *path, FAR char *relpath)
+{
+  FAR char *ptr;
+  int errcode;
+  int ret;
+
+  for (ptr = strchr(relpath, '/'); ptr != NULL; ptr = strchr(ptr + 1, '/'))
+    {
+      /* Temporarily terminate the path at this directory */
+
+      *ptr    = '\0';
+      ret     = mkdir(path, 0755);
+      errcode = errno;
+      *ptr    = '/';
+
+      if (ret < 0 && errcode != EEXIST)
+        {
+          return -errcode;
+        }
+    }
+
+  return OK;
+}
+
 /****************************************************************************
  * Name: zmr_openfile
  *
  * Description:
  *   If no output file has been opened to receive the data, then open the
- *   file for output whose name is in pzm->pktbuf.
+ *   file for output whose name is in pzm->pktbuf.  'offset' is the number
+ *   of bytes of the file that we already have when resuming a transfer.
  *
  ****************************************************************************/
 
-static int zmr_openfile(FAR struct zmr_state_s *pzmr, uint32_t crc)
+static int zmr_openfile(FAR struct zmr_state_s *pzmr, off_t offset)
 {
-  off_t offset;
   uint8_t by[4];
+  int oflags;
 
   /* Has an output file already been opened?  Do we have a file name? */
 
@@ -1421,28 +1587,24 @@ static int zmr_openfile(FAR struct zmr_state_s *pzmr, uint32_t crc)
           goto skip;
         }
 
-      /* Yes.. then open this file for output */
+      /* Yes.. then open this file for output.  Keep the existing content
+       * if we are appending to the file or resuming a transfer.
+       */
 
-      pzmr->outfd = open((FAR char *)pzmr->filename,
-                         O_WRONLY | O_CREAT | O_TRUNC, 0644);
-      if (pzmr->outfd < 0)
+      oflags = O_WRONLY | O_CREAT;
+      if ((pzmr->cmn.flags & ZM_FLAG_APPEND) != 0)
         {
-          zmdbg("ERROR: Failed to open %s: %d\n", pzmr->filename, errno);
-          goto skip;
+          oflags |= O_APPEND;
+        }
+      else
+        {
+          oflags |= O_TRUNC;
         }
-    }
-
-  /* Are we appending/resuming a transfer? */
-
-  offset = 0;
-  if (pzmr->f0 == ZCRESUM)
-    {
-      /* Yes... get the current file position */
 
-      offset = lseek(pzmr->outfd, 0, SEEK_CUR);
-      if (offset == (off_t)-1)
+      pzmr->outfd = open((FAR char *)pzmr->filename, oflags, 0644);
+      if (pzmr->outfd < 0)
         {
-          zmdbg("ERROR: lseek failed: %d\n", errno);
+          zmdbg("ERROR: Failed to open %s: %d\n", pzmr->filename, errno);
           goto skip;
         }
     }
@@ -1452,6 +1614,16 @@ static int zmr_openfile(FAR struct zmr_state_s *pzmr, uint32_t crc)
 
   pzmr->offset = offset;
   pzmr->cmn.state = ZMR_READREADY;
+
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+  /* Buffer the file data unless newlines are to be converted */
+
+  if (pzmr->f0 != ZCNL)
+    {
+      zm_fbopen(&pzmr->filebuf, pzmr->outfd, offset);
+    }
+#endif
+
   zm_be32toby(pzmr->offset, by);
   return zm_sendhexhdr(&pzmr->cmn, ZRPOS, by);
 
@@ -1464,6 +1636,29 @@ skip:
   return zm_sendhexhdr(&pzmr->cmn, ZSKIP, g_zeroes);
 }
 
+/****************************************************************************
+ * Name: zmr_readdata
+ *
+ * Description:
+ *   Set up to receive a file data packet.  If the file is buffered, the
+ *   packet is unescaped straight into the file buffer.
+ *
+ ****************************************************************************/
+
+static void zmr_readdata(FAR struct zmr_state_s *pzmr)
+{
+  /* Enter PSTATE_DATA */
+
+  zm_readstate(&pzmr->cmn);
+
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+  if (pzmr->filebuf.fd >= 0)
+    {
+      pzmr->cmn.pktptr = zm_fbptr(&pzmr->filebuf);
+    }
+#endif
+}
+
 /****************************************************************************
  * Name: zmr_fileerror
  *
@@ -1555,7 +1750,14 @@ static int zmr_fileerror(FAR struct zmr_state_s *pzmr, uint8_t type,
 
 static void zmr_filecleanup(FAR struct zmr_state_s *pzmr)
 {
-  /* Make sure that the file is closed */
+  /* Make sure that the file is closed.  Buffered data of an incomplete
+   * file has passed its CRC check, so write it out too:  It is kept so that
+   * a later transfer with ZCRESUM can pick up where this one ended.
+   */
+
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+  (void)zm_fbclose(&pzmr->filebuf, true);
+#endif
 
   if (pzmr->outfd >= 0)
     {
@@ -1603,6 +1805,8 @@ ZMRHANDLE zmr_initialize(int remfd)
   FAR struct zm_state_s *pzm;
   int ret;
 
+  zm_perfregister();
+
   /* Allocate a new Zmodem receive state structure */
 
   pzmr = (FAR struct zmr_state_s*)zalloc(sizeof(struct zmr_state_s));
@@ -1618,12 +1822,36 @@ ZMRHANDLE zmr_initialize(int remfd)
       pzm->remfd     = remfd;
       pzmr->outfd    = -1;
 
+      /* Receiver capabilities advertised in ZRINIT */
+
+#ifdef CONFIG_SYSTEM_ZMODEM_RCVCRC32
+      pzmr->rcaps   |= CANFC32;
+#endif
+#ifdef CONFIG_SYSTEM_ZMODEM_RCVSTREAM
+      pzmr->rcaps   |= CANFDX | CANOVIO;
+#endif
+
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+      /* Set up the file buffer */
+
+      ret = zm_fbinitialize(&pzmr->filebuf);
+      if (ret < 0)
+        {
+          zmdbg("ERROR: zm_fbinitialize failed: %d\n", ret);
+          free(pzmr);
+          return (ZMRHANDLE)NULL;
+        }
+#endif
+
       /* Create a timer to handle timeout events */
 
       ret = zm_timerinit(pzm);
       if (ret < 0)
         {
           zmdbg("ERROR: zm_timerinit failed: %d\n", ret);
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+          zm_fbuninitialize(&pzmr->filebuf);
+#endif
           free(pzmr);
           return (ZMRHANDLE)NULL;
         }
@@ -1700,6 +1928,10 @@ int zmr_release(ZMRHANDLE handle)
 
   zmr_filecleanup(pzmr);
 
+#if CONFIG_SYSTEM_ZMODEM_FILEBUFSIZE > 0
+  zm_fbuninitialize(&pzmr->filebuf);
+#endif
+
   /* Then release the receive state structure itself */
 
   free(pzmr);
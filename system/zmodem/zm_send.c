@@ -277,7 +277,7 @@ static const struct zm_transition_s g_zms_sendwait[] =
   {ZME_ACK,       false, ZMS_SENDING,  zms_sendwaitack},
   {ZME_RPOS,      false, ZMS_SENDWAIT, zms_sendrpos},
   {ZME_SKIP,      true,  ZMS_FILEWAIT, zms_fileskip},
-  {ZME_NAK,       false, ZMS_SENDING,  zms_sendnak},
+  {ZME_NAK,       false, ZMS_SENDWAIT, zms_ignore},
   {ZME_RINIT,     true,  ZMS_FILEWAIT, zms_sendfilename},
   {ZME_ABORT,     true,  ZMS_FINISH,   zms_abort},
   {ZME_FERR,      true,  ZMS_FINISH,   zms_abort},
@@ -422,7 +422,7 @@ static int zms_zrinit(FAR struct zm_state_s *pzm)
 
   /* Set flags associated with the capabilities */
 
-  rcaps &= ~(ZM_FLAG_CRC32 | ZM_FLAG_ESCCTRL);
+  pzm->flags &= ~(ZM_FLAG_CRC32 | ZM_FLAG_ESCCTRL);
   if ((rcaps & CANFC32) != 0)
     {
       pzm->flags |= ZM_FLAG_CRC32;
@@ -448,35 +448,24 @@ static int zms_zrinit(FAR struct zm_state_s *pzm)
    *    follow immediately."
    *
    *
-   * In order to support ZCRCG, this logic must be able to sample the
-   * reverse channel while streaming to determine if the receiving wants
-   * interrupt the transfer (CONFIG_SYSTEM_ZMODEM_RCVSAMPLE).
-   *
    * ZCRCQ
    *   "ZCRCQ data subpackets expect a ZACK response with the
    *    receiver's file offset if no error, otherwise a ZRPOS response
    *    with the last good file offset.  Another data subpacket
    *    continues immediately.  ZCRCQ subpackets are not used if the
    *    receiver does not indicate FDX ability with the CANFDX bit.
+   *
+   * When streaming, ZCRCQ subpackets are mixed in to keep the window of
+   * unacknowledged data (CONFIG_SYSTEM_ZMODEM_SNDWINDOW) sliding.  The ZACKs
+   * and any ZRPOS are seen between subpackets if the reverse channel can be
+   * sampled (CONFIG_SYSTEM_ZMODEM_RCVSAMPLE), otherwise when the window is
+   * full.
    */
 
-#ifdef CONFIG_SYSTEM_ZMODEM_RCVSAMPLE
-  /* We support CANFDX.  We can do ZCRCG if the remote sender does too */
-
   if ((rcaps & (CANFDX | CANOVIO)) == (CANFDX | CANOVIO) && pzms->rcvmax == 0)
     {
       pzms->dpkttype = ZCRCG;
     }
-#else
-  /* We don't support CANFDX.  We can do ZCRCQ if the remote sender does  */
-
-  if ((rcaps & (CANFDX | CANOVIO)) == (CANFDX | CANOVIO) && pzms->rcvmax == 0)
-    {
-      /* For the local sender, this is just like ZCRCW */
-
-      pzms->dpkttype = ZCRCQ;
-    }
-#endif
 
   /* Otherwise, we have to to ZCRCW */
 
@@ -814,7 +803,8 @@ static int zms_endoftransfer(FAR struct zm_state_s *pzm)
  * Name: zms_fileskip
  *
  * Description:
- *   Received ZSKIP, receiver doesn't want this file.
+ *   Received ZSKIP, receiver doesn't want this file.  Finish up the same
+ *   way as after a file has been sent so that another file may follow.
  *
  ****************************************************************************/
 
@@ -825,7 +815,7 @@ static int zms_fileskip(FAR struct zm_state_s *pzm)
   zmdbg("ZMS_STATE %d\n", pzm->state);
   close(pzms->infd);
   pzms->infd = -1;
-  return ZM_XFRDONE;
+  return zms_endoftransfer(pzm);
 }
 
 /****************************************************************************
@@ -861,17 +851,21 @@ static int zms_sendfiledata(FAR struct zm_state_s *pzm)
 static int zms_sendpacket(FAR struct zm_state_s *pzm)
 {
   FAR struct zms_state_s *pzms = (FAR struct zms_state_s *)pzm;
+  FAR uint8_t *endptr;
+  FAR uint8_t *ptr;
   ssize_t nwritten;
+  ssize_t nread;
   int32_t unacked;
   bool bcrc32;
   uint32_t crc;
   uint8_t by[4];
-  uint8_t *ptr;
   uint8_t type;
   bool wait = false;
+  bool query;
+  bool eof;
   int sndsize;
   int pktsize;
-  int ret;
+  int nbytes;
   int i;
 
   /* Loop, sending packets while we can if the receiver supports streaming
@@ -887,6 +881,7 @@ static int zms_sendpacket(FAR struct zm_state_s *pzm)
       /* This is the nubmer of bytes that have been sent but not yet ackowledged. */
 
       unacked = pzms->offset - pzms->lastoffs;
+      query   = false;
 
       /* Can we still send?  If so, how much?   If rcvmax is zero, then the
        * remote can handle full streaming and we never have to wait.
@@ -906,7 +901,7 @@ static int zms_sendpacket(FAR struct zm_state_s *pzm)
               /* Yes... clip the maximum so that we stay within that limit */
 
               int maximum = pzms->rcvmax - unacked;
-              if (sndsize < maximum)
+              if (sndsize > maximum)
                 {
                   sndsize = maximum;
                 }
@@ -915,10 +910,32 @@ static int zms_sendpacket(FAR struct zm_state_s *pzm)
               zmdbg("Clipped sndsize: %d\n", sndsize);
             }
         }
+#if CONFIG_SYSTEM_ZMODEM_SNDWINDOW > 0
+      else if (pzms->dpkttype == ZCRCG)
+        {
+          /* Streaming.  If this packet would fill the window, end the frame
+           * with ZCRCW and wait for the receiver to catch up.  Otherwise ask
+           * for a ZACK every quarter window so that the window keeps sliding.
+           */
+
+          if (unacked + CONFIG_SYSTEM_ZMODEM_SNDBUFSIZE >=
+              CONFIG_SYSTEM_ZMODEM_SNDWINDOW)
+            {
+              wait = true;
+            }
+          else if (pzms->offset + CONFIG_SYSTEM_ZMODEM_SNDBUFSIZE -
+                   pzms->ackreq >= CONFIG_SYSTEM_ZMODEM_SNDWINDOW / 4)
+            {
+              query = true;
+            }
+        }
+#endif
 
-      /* Can we send anything? */
+      /* Can we send anything?  At the end of the file (or if the file is
+       * empty) we send one more, empty packet to detect the end of file.
+       */
 
-      if (sndsize <= 0)
+      if (sndsize <= 0 && pzms->offset < pzms->filesize)
         {
           /* No, not now. Keep waiting */
 
@@ -960,13 +977,18 @@ static int zms_sendpacket(FAR struct zm_state_s *pzm)
         {
           type = ZCRCW;
         }
+      else if (query)
+        {
+          type = ZCRCQ;
+        }
       else
         {
           type = pzms->dpkttype;
         }
 
-      /* Read characters from file and put into buffer until buffer is full
-       * or file is exhausted
+      /* Read blocks from file and put into buffer until buffer is full or
+       * file is exhausted.  Leave room for the ZDLE, the type and up to 4
+       * escaped CRC bytes at the end.
        */
 
       bcrc32      = ((pzm->flags & ZM_FLAG_CRC32) != 0);
@@ -974,38 +996,42 @@ static int zms_sendpacket(FAR struct zm_state_s *pzm)
       pzm->flags &= ~ZM_FLAG_ATSIGN;
 
       ptr         = pzm->scratch;
-      pktsize     = 0;
+      endptr      = pzm->scratch + CONFIG_SYSTEM_ZMODEM_SNDBUFSIZE - 10;
+      eof         = false;
 
-      while (pktsize <= (CONFIG_SYSTEM_ZMODEM_SNDBUFSIZE - 10) &&
-             (ret = zm_getc(pzms->infd)) != EOF)
-        {
-          /* Add the new value to the accumulated CRC */
+      /* Each block is read into the tail of the free space and escaped
+       * forward into place.  Half of the free space always fits, even if
+       * every byte has to be escaped.  Stop when the space left is too
+       * small to be worth another read.
+       */
 
-          uint8_t ch = (uint8_t)ret;
-          if (!bcrc32)
+      while ((nbytes = (endptr - ptr) / 2) >= 8)
+        {
+          nread = zm_read(pzms->infd, endptr - nbytes, nbytes);
+          if (nread < 0)
             {
-              crc = (uint32_t)crc16part(&ch, 1, (uint16_t)crc);
+              zmdbg("ERROR: zm_read failed: %d\n", (int)nread);
+              return (int)nread;
             }
-          else
+          else if (nread == 0)
             {
-              crc = crc32part(&ch, 1, crc);
+              eof = true;
+              break;
             }
 
-          /* Put the character into the buffer, escaping as necessary */
-
-          ptr = zm_putzdle(pzm, ptr, ch);
-
-          /* Recalculate the accumulated packet size to handle expansion due
-           * to escaping.
+          /* Add it to the accumulated CRC and put it into the buffer,
+           * escaping as necessary.
            */
 
-          pktsize = (int32_t)(ptr - pzm->scratch);
+          ptr = zm_putzdlebuf(pzm, ptr, endptr - nbytes, nread, &crc);
 
           /* And increment the file offset */
 
-          pzms->offset++;
+          pzms->offset += nread;
         }
 
+      pktsize = ptr - pzm->scratch;
+
       /* If we've reached file end, a ZEOF header will follow.  If there's
        * room in the outgoing buffer for it, end the packet with ZCRCE and
        * append the ZEOF header.  If there isn't room, we'll have to do a
@@ -1013,7 +1039,7 @@ static int zms_sendpacket(FAR struct zm_state_s *pzm)
        */
 
       pzm->flags &= ~ZM_FLAG_EOF;
-      if (ret == EOF)
+      if (eof)
         {
           pzm->flags |= ZM_FLAG_EOF;
           if (wait || (pzms->rcvmax != 0 && pktsize < 24))
@@ -1038,7 +1064,7 @@ static int zms_sendpacket(FAR struct zm_state_s *pzm)
         }
       else
         {
-          crc = crc32part(&type, 1, crc);
+          crc = zm_crc32part(&type, 1, crc);
         }
 
       *ptr++ = type;
@@ -1063,7 +1089,7 @@ static int zms_sendpacket(FAR struct zm_state_s *pzm)
       /* Get the final packet size */
 
       pktsize = ptr - pzm->scratch;
-      DEBUGASSERT(pktsize < CONFIG_SYSTEM_ZMODEM_SNDBUFSIZE);
+      DEBUGASSERT(pktsize <= CONFIG_SYSTEM_ZMODEM_SNDBUFSIZE);
 
       /* And send the packet */
 
@@ -1112,8 +1138,12 @@ static int zms_sendpacket(FAR struct zm_state_s *pzm)
 
        /* No response is expected -- we are streaming */
 
-        case ZCRCG:  /* Transfer continues non-stop */
         case ZCRCQ:  /* Expect ZACK, transfer may continues non-stop */
+          pzms->ackreq = pzms->offset;
+
+          /* Fall through */
+
+        case ZCRCG:  /* Transfer continues non-stop */
         default:
           zmdbg("ZMS_STATE %d->%d: Default\n", pzm->state, ZMS_SENDING);
 
@@ -1124,7 +1154,7 @@ static int zms_sendpacket(FAR struct zm_state_s *pzm)
 #ifdef CONFIG_SYSTEM_ZMODEM_RCVSAMPLE
   while (pzm->state == ZMS_SENDING && !zm_rcvpending(pzm));
 #else
-  while (0);
+  while (pzm->state == ZMS_SENDING);
 #endif
 
   return OK;
@@ -1134,7 +1164,9 @@ static int zms_sendpacket(FAR struct zm_state_s *pzm)
  * Name: zms_filecrc
  *
  * Description:
- *   ZFILE has been sent and waiting for ZCRC.  ZRPOS received.
+ *   ZFILE has been sent and the receiver requested the file CRC with ZCRC
+ *   (or NAKed the CRC that we sent).  ZP0-ZP3 of the ZCRC header hold the
+ *   number of bytes to include in the CRC, zero meaning the whole file.
  *
  ****************************************************************************/
 
@@ -1144,8 +1176,16 @@ static int zms_filecrc(FAR struct zm_state_s *pzm)
   uint8_t by[4];
   uint32_t crc;
 
-  crc = zm_filecrc(pzm, pzms->filename);
-  zmdbg("ZMS_STATE %d: CRC %08x\n", pzm->state, crc);
+  /* On a NAK, re-send the CRC over the length previously requested */
+
+  if (pzm->hdrdata[0] == ZCRC)
+    {
+      pzms->crclen = zm_bytobe32(pzm->hdrdata + 1);
+    }
+
+  crc = zm_filecrc(pzm, pzms->filename, pzms->crclen);
+  zmdbg("ZMS_STATE %d: CRC %08x length %ld\n",
+        pzm->state, crc, (long)pzms->crclen);
 
   zm_be32toby(crc, by);
   return zm_sendhexhdr(pzm, ZCRC, by);
@@ -1177,7 +1217,12 @@ static int zms_sendack(FAR struct zm_state_s *pzm)
     }
 
   zmdbg("ZMS_STATE %d: offset: %ld\n", pzm->state, (unsigned long)pzms->offset);
-  return OK;
+
+  /* The window has moved.  The frame is still open, so just continue with
+   * the next data subpacket.
+   */
+
+  return zms_sendpacket(pzm);
 }
 
 /****************************************************************************
@@ -1209,6 +1254,18 @@ static int zms_sendwaitack(FAR struct zm_state_s *pzm)
 
   zmdbg("ZMS_STATE %d: offset: %ld\n", pzm->state, (unsigned long)offset);
 
+  /* A ZACK for an earlier ZCRCQ may still arrive after the ZCRCW has been
+   * sent.  Keep waiting until the receiver has everything that was sent,
+   * otherwise the new ZDATA would not match its position after an error.
+   */
+
+  if (offset < pzms->offset)
+    {
+      zmdbg("ZMS_STATE %d->%d: Stale ZACK\n", pzm->state, ZMS_SENDWAIT);
+      pzm->state = ZMS_SENDWAIT;
+      return OK;
+    }
+
   /* Now send the next data packet */
 
   zm_be32toby(pzms->offset, by);
@@ -1225,18 +1282,25 @@ static int zms_sendwaitack(FAR struct zm_state_s *pzm)
  * Name: zms_sendnak
  *
  * Description:
- *   ZDATA header was corrupt.  Start from beginning
+ *   ZDATA header was corrupt.  Resume from the last offset acknowledged by
+ *   the receiver rather than from the start of the transfer.
  *
  ****************************************************************************/
 
 static int zms_sendnak(FAR struct zm_state_s *pzm)
 {
   FAR struct zms_state_s *pzms = (FAR struct zms_state_s *)pzm;
+  uint8_t by[4];
   off_t offset;
+  int ret;
 
-  /* Save the ZRPOS file offset */
+  /* Everything up to lastoffs has been acknowledged.  Stop streaming after
+   * the next subpacket until the receiver is back in sync.
+   */
 
-  pzms->offset = pzms->zrpos;
+  pzms->offset = pzms->lastoffs;
+  pzms->ackreq = pzms->lastoffs;
+  pzm->flags  |= ZM_FLAG_WAIT;
 
   /* TODO: What is the correct thing to do if lseek fails? Send ZEOF? */
 
@@ -1253,6 +1317,15 @@ static int zms_sendnak(FAR struct zm_state_s *pzm)
 
   zmdbg("ZMS_STATE %d: offset: %ld\n", pzm->state, (unsigned long)pzms->offset);
 
+  /* The receiver did not see the ZDATA, so send a new one */
+
+  zm_be32toby(pzms->offset, by);
+  ret = zm_sendbinhdr(pzm, ZDATA, by);
+  if (ret != OK)
+    {
+      return ret;
+    }
+
   return zms_sendpacket(pzm);
 }
 
@@ -1436,6 +1509,7 @@ static int zms_startfiledata(FAR struct zms_state_s *pzms)
   pzms->zrpos      = zm_bytobe32(pzms->cmn.hdrdata + 1);
   pzms->offset     = pzms->zrpos;
   pzms->lastoffs   = pzms->zrpos;
+  pzms->ackreq     = pzms->zrpos;
 
   /* See to the requested file position */
 
@@ -1534,6 +1608,7 @@ static int zms_sendfile(FAR struct zms_state_s *pzms, FAR const char *filename,
   pzms->lastoffs   = 0;
 
   pzms->filesize   = buf.st_size;
+  pzms->crclen     = 0;
 #ifdef CONFIG_SYSTEM_ZMODEM_TIMESTAMPS
   pzms->timestamp  = buf.st_mtime;
 #endif
@@ -1580,6 +1655,8 @@ ZMSHANDLE zms_initialize(int remfd)
 
   DEBUGASSERT(remfd >= 0);
 
+  zm_perfregister();
+
   /* Allocate the instance */
 
   pzms = (FAR struct zms_state_s *)zalloc(sizeof(struct zms_state_s));
@@ -62,10 +62,11 @@
 #include <assert.h>
 #include <errno.h>
 #include <crc16.h>
-#include <crc32.h>
 
 #include <nuttx/ascii.h>
 
+#include "system/perfcount.h"
+
 #include "zm.h"
 
 /****************************************************************************
@@ -90,6 +91,15 @@ static int zm_data(FAR struct zm_state_s *pzm, uint8_t ch);
  * Private Data
  ****************************************************************************/
 
+/* Counters in the performance counter registry, for all transfers */
+
+PERF_COUNTER(g_perf_bytesin, "zmodem.bytesin");
+PERF_COUNTER(g_perf_headers, "zmodem.headers");
+PERF_COUNTER(g_perf_hdrerrors, "zmodem.hdrerrors");
+PERF_COUNTER(g_perf_packets, "zmodem.packets");
+PERF_COUNTER(g_perf_pkterrors, "zmodem.pkterrors");
+PERF_COUNTER(g_perf_timeouts, "zmodem.timeouts");
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -197,10 +207,11 @@ static int zm_hdrevent(FAR struct zm_state_s *pzm)
 
       /* Checksum is over 9 bytes:  The header type, 4 data bytes, plus 4 CRC bytes */
 
-      crc = crc32part(pzm->hdrdata, 9, 0xffffffff);
+      crc = zm_crc32part(pzm->hdrdata, 9, 0xffffffff);
       if (crc != 0xdebb20e3)
         {
           zmdbg("ERROR: ZBIN32 CRC32 failure: %08x vs debb20e3\n", crc);
+          PERF_INC(g_perf_hdrerrors);
           return zm_nakhdr(pzm);
         }
     }
@@ -214,10 +225,12 @@ static int zm_hdrevent(FAR struct zm_state_s *pzm)
       if (crc != 0)
         {
           zmdbg("ERROR: ZBIN/ZHEX CRC16 failure: %04x vs 0000\n", crc);
+          PERF_INC(g_perf_hdrerrors);
           return zm_nakhdr(pzm);
         }
     }
 
+  PERF_INC(g_perf_headers);
   return zm_event(pzm, pzm->hdrdata[0]);
 }
 
@@ -246,7 +259,7 @@ static int zm_dataevent(FAR struct zm_state_s *pzm)
     {
       uint32_t crc;
 
-      crc = crc32part(pzm->pktbuf, pzm->pktlen, 0xffffffff);
+      crc = zm_crc32part(pzm->pktptr, pzm->pktlen, 0xffffffff);
       if (crc != 0xdebb20e3)
         {
           zmdbg("ERROR: ZBIN32 CRC32 failure: %08x vs debb20e3\n", crc);
@@ -267,7 +280,7 @@ static int zm_dataevent(FAR struct zm_state_s *pzm)
     {
       uint16_t crc;
 
-      crc = crc16part(pzm->pktbuf, pzm->pktlen, 0);
+      crc = crc16part(pzm->pktptr, pzm->pktlen, 0);
       if (crc != 0)
         {
           zmdbg("ERROR: ZBIN/ZHEX CRC16 failure: %04x vs 0000\n", crc);
@@ -285,6 +298,15 @@ static int zm_dataevent(FAR struct zm_state_s *pzm)
       pzm->pktlen -= 3;
     }
 
+  if ((pzm->flags & ZM_FLAG_CRKOK) != 0)
+    {
+      PERF_INC(g_perf_packets);
+    }
+  else
+    {
+      PERF_INC(g_perf_pkterrors);
+    }
+
   /* Then handle the data received event */
 
   return zm_event(pzm, ZME_DATARCVD);
@@ -710,7 +732,7 @@ static int zm_data(FAR struct zm_state_s *pzm, uint8_t ch)
    * payload plus the packet type code plus the CRC itself.
    */
 
-   pzm->pktbuf[pzm->pktlen++] = ch;
+   pzm->pktptr[pzm->pktlen++] = ch;
    if (pzm->ncrc == 1)
      {
        /* We are at the end of the packet.  Check the CRC and post the event */
@@ -755,7 +777,7 @@ static int zm_parse(FAR struct zm_state_s *pzm, size_t rcvlen)
   uint8_t ch;
   int ret;
 
-  DEBUGASSERT(pzm && rcvlen < CONFIG_SYSTEM_ZMODEM_RCVBUFSIZE);
+  DEBUGASSERT(pzm && rcvlen <= CONFIG_SYSTEM_ZMODEM_RCVBUFSIZE);
   zm_dumpbuffer("Received", pzm->rcvbuf, rcvlen);
 
   /* We keep a copy of the length and buffer index in the state structure.
@@ -924,6 +946,7 @@ int zm_datapump(FAR struct zm_state_s *pzm)
                 {
                   /* Yes... a timeout occurred */
 
+                  PERF_INC(g_perf_timeouts);
                   ret = zm_timeout(pzm);
                 }
 
@@ -947,6 +970,7 @@ int zm_datapump(FAR struct zm_state_s *pzm)
 
       else /* nread > 0 */
         {
+          PERF_ADD(g_perf_bytesin, nread);
           ret = zm_parse(pzm, nread);
           if (ret < 0)
             {
@@ -977,6 +1001,7 @@ void zm_readstate(FAR struct zm_state_s *pzm)
   pzm->psubstate = PDATA_READ;
   pzm->pktlen    = 0;
   pzm->ncrc      = 0;
+  pzm->pktptr    = pzm->pktbuf;
 }
 
 /****************************************************************************
@@ -991,3 +1016,21 @@ int zm_timeout(FAR struct zm_state_s *pzm)
 {
   return zm_event(pzm, ZME_TIMEOUT);
 }
+
+/****************************************************************************
+ * Name: zm_perfregister
+ *
+ * Description:
+ *   Register the transfer counters in the performance counter registry.
+ *
+ ****************************************************************************/
+
+void zm_perfregister(void)
+{
+  PERF_REGISTER(g_perf_bytesin);
+  PERF_REGISTER(g_perf_headers);
+  PERF_REGISTER(g_perf_hdrerrors);
+  PERF_REGISTER(g_perf_packets);
+  PERF_REGISTER(g_perf_pkterrors);
+  PERF_REGISTER(g_perf_timeouts);
+}
@@ -42,9 +42,9 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <assert.h>
 #include <errno.h>
-#include <crc32.h>
 
 #include "zm.h"
 
@@ -334,6 +334,29 @@ int zm_putc(int fd, uint8_t ch)
 }
 #endif
 
+/****************************************************************************
+ * Name: zm_rcvpending
+ *
+ * Description:
+ *   Return true if data from the remote receiver is pending.  In that case,
+ *   the local sender should stop data streaming operations and process the
+ *   incoming data.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSTEM_ZMODEM_RCVSAMPLE
+bool zm_rcvpending(FAR struct zm_state_s *pzm)
+{
+  struct pollfd fds;
+
+  fds.fd      = pzm->remfd;
+  fds.events  = POLLIN;
+  fds.revents = 0;
+
+  return poll(&fds, 1, 0) > 0 && (fds.revents & POLLIN) != 0;
+}
+#endif
+
 /****************************************************************************
  * Name: zm_writefile
  *
@@ -365,7 +388,7 @@ int zm_writefile(int fd, FAR const uint8_t *buffer, size_t buflen, bool zcnl)
 
       /* Loop for each character in the buffer */
 
-      for (; buflen > 0 && ret == OK; buflen--)
+      for (; buflen > 0 && ret >= 0; buflen--)
         {
           /* Get the next character in the buffer */
 
@@ -382,7 +405,7 @@ int zm_writefile(int fd, FAR const uint8_t *buffer, size_t buflen, bool zcnl)
                   nbytes  = 0;
                 }
 
-              if (ret == OK)
+              if (ret >= 0)
                 {
                   /* Skip one char of \r\n? */
 
@@ -415,7 +438,7 @@ int zm_writefile(int fd, FAR const uint8_t *buffer, size_t buflen, bool zcnl)
 
       /* Write any trailing data that does not end with a newline */
 
-      if (ret == OK && nbytes > 0)
+      if (ret >= 0 && nbytes > 0)
         {
           ret = zm_write(fd, start, nbytes);
         }
@@ -434,17 +457,20 @@ int zm_writefile(int fd, FAR const uint8_t *buffer, size_t buflen, bool zcnl)
  * Name: zm_filecrc
  *
  * Description:
- *   Perform CRC32 calculation on a file.
+ *   Perform CRC32 calculation on the first 'length' bytes of a file.  If
+ *   'length' is zero, the CRC is calculated over the entire file.
  *
  * Assumptions:
  *   The allocated I/O buffer is available to buffer file data.
  *
  ************************************************************************************************/
 
-uint32_t zm_filecrc(FAR struct zm_state_s *pzm, FAR const char *filename)
+uint32_t zm_filecrc(FAR struct zm_state_s *pzm, FAR const char *filename,
+                    off_t length)
 {
   uint32_t crc;
   ssize_t nread;
+  size_t nbytes;
   int fd;
 
   /* Open the file for reading */
@@ -460,10 +486,30 @@ uint32_t zm_filecrc(FAR struct zm_state_s *pzm, FAR const char *filename)
 
   /* Calculate the file CRC */
 
-  crc = 0xffffffff;
-  while ((nread = zm_read(fd, pzm->scratch, CONFIG_SYSTEM_ZMODEM_SNDBUFSIZE)) > 0)
+  crc    = 0xffffffff;
+  nbytes = CONFIG_SYSTEM_ZMODEM_SNDBUFSIZE;
+
+  for (; ; )
     {
-      crc = crc32part(pzm->scratch, nread, crc);
+      if (length > 0 && length < nbytes)
+        {
+          nbytes = (size_t)length;
+        }
+
+      nread = zm_read(fd, pzm->scratch, nbytes);
+      if (nread <= 0)
+        {
+          break;
+        }
+
+      crc = zm_crc32part(pzm->scratch, nread, crc);
+
+      /* Stop when the requested number of bytes have been included */
+
+      if (length > 0 && (length -= nread) <= 0)
+        {
+          break;
+        }
     }
 
   /* Close the file and return the CRC */
@@ -78,12 +78,25 @@
 #endif
 #endif
 
+#if !defined(CONFIG_IEEE802154_I8SAK_BLASTER_MAXWINDOW)
+#define CONFIG_IEEE802154_I8SAK_BLASTER_MAXWINDOW 8
+#endif
+
+#if (CONFIG_IEEE802154_I8SAK_BLASTER_MAXWINDOW & \
+     (CONFIG_IEEE802154_I8SAK_BLASTER_MAXWINDOW - 1)) != 0
+#  error CONFIG_IEEE802154_I8SAK_BLASTER_MAXWINDOW must be a power of two
+#endif
+
 #define I8SAK_MAX_IFNAME            12
 
 #define I8SAK_DAEMONNAME_FMT        "i8sak_%s"
 #define I8SAK_DAEMONNAME_PREFIX_LEN 6
 #define I8SAK_MAX_DAEMONNAME        I8SAK_DAEMONNAME_PREFIX_LEN + I8SAK_MAX_IFNAME
 
+/* Latency buckets of the blaster: < 1, 2, 4, ... 64 and >= 64 ms */
+
+#define I8SAK_BLASTER_NBUCKETS      8
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -106,6 +119,30 @@ enum i8sak_cmd_e
   I8_CMD_POLL,
 };
 
+/* A data request of the windowed blaster that awaits its confirmation */
+
+struct i8sak_blasterslot_s
+{
+  bool     pending;
+  uint8_t  handle;
+  uint32_t sent;                /* Microseconds */
+};
+
+struct i8sak_blasterstats_s
+{
+  uint32_t start;               /* Microseconds */
+  uint32_t elapsed;             /* Microseconds, set when the run ends */
+  uint32_t sent;                /* Data requests written to the MAC */
+  uint32_t success;             /* Confirmed as sent (and acknowledged) */
+  uint32_t noack;               /* No acknowledgment after the retries */
+  uint32_t chanfail;            /* Channel access failures */
+  uint32_t otherfail;           /* Any other failure */
+  uint32_t latmin;              /* Request to confirmation, microseconds */
+  uint32_t latmax;
+  uint64_t latsum;
+  uint32_t hist[I8SAK_BLASTER_NBUCKETS];
+};
+
 struct i8sak_s
 {
   /* Support singly linked list */
@@ -187,6 +224,11 @@ struct i8sak_s
   bool blasterenabled;
   pthread_t blaster_threadid;
   int blasterperiod;
+  int blasterwindow;            /* Outstanding requests, 0 to use the period */
+  uint32_t blastercount;        /* Frames to send, 0 for no limit */
+  sem_t blastersem;             /* Free places in the window */
+  struct i8sak_blasterslot_s blasterslots[CONFIG_IEEE802154_I8SAK_BLASTER_MAXWINDOW];
+  struct i8sak_blasterstats_s blasterstats;
 
   /* Sniffer command parameters */
 
@@ -48,7 +48,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <debug.h>
 #include <fcntl.h>
+#include <time.h>
 #include <sys/ioctl.h>
 #include <arpa/inet.h>
 
@@ -60,16 +62,304 @@
 
 #include "i8sak.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define I8SAK_BLASTER_CLOCK CLOCK_MONOTONIC
+#else
+#  define I8SAK_BLASTER_CLOCK CLOCK_REALTIME
+#endif
+
+/* PHY overhead of every frame: preamble, SFD and PHR */
+
+#define I8SAK_PHY_OVERHEAD 6
+
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
 
 static inline void i8sak_blaster_start(FAR struct i8sak_s *i8sak);
+static void i8sak_blaster_report(FAR struct i8sak_s *i8sak);
 
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name : i8sak_blaster_usec
+ ****************************************************************************/
+
+static uint32_t i8sak_blaster_usec(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(I8SAK_BLASTER_CLOCK, &ts);
+  return (uint32_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/****************************************************************************
+ * Name : i8sak_blaster_macoverhead
+ *
+ * Description :
+ *   The MAC header and FCS bytes of a data frame to the endpoint, with PAN
+ *   ID compression.
+ *
+ ****************************************************************************/
+
+static int i8sak_blaster_macoverhead(FAR struct i8sak_s *i8sak)
+{
+  int size = 2 + 1 + 2 + 2;     /* Frame control, DSN, PAN ID, FCS */
+
+  size += i8sak->ep_addr.mode == IEEE802154_ADDRMODE_EXTENDED ?
+          IEEE802154_EADDRSIZE : IEEE802154_SADDRSIZE;
+  size += i8sak->addrmode == IEEE802154_ADDRMODE_EXTENDED ?
+          IEEE802154_EADDRSIZE : IEEE802154_SADDRSIZE;
+  return size;
+}
+
+/****************************************************************************
+ * Name : i8sak_blaster_confcb
+ *
+ * Description :
+ *   Account for the confirmation of a data request of the windowed blaster
+ *   and open its place in the window.  Runs on the event listener thread.
+ *
+ ****************************************************************************/
+
+static void i8sak_blaster_confcb(FAR struct ieee802154_primitive_s *primitive,
+                                 FAR void *arg)
+{
+  FAR struct i8sak_s *i8sak = (FAR struct i8sak_s *)arg;
+  FAR struct i8sak_blasterstats_s *stats = &i8sak->blasterstats;
+  FAR struct i8sak_blasterslot_s *slot;
+  uint8_t handle = primitive->u.dataconf.handle;
+  uint32_t latency;
+  int bucket;
+
+  /* Ignore the confirmations of frames sent by other commands */
+
+  slot = &i8sak->blasterslots[handle &
+                              (CONFIG_IEEE802154_I8SAK_BLASTER_MAXWINDOW - 1)];
+  if (!slot->pending || slot->handle != handle)
+    {
+      return;
+    }
+
+  latency = i8sak_blaster_usec() - slot->sent;
+  slot->pending = false;
+
+  switch (primitive->u.dataconf.status)
+    {
+      case IEEE802154_STATUS_SUCCESS:
+        stats->success++;
+        break;
+
+      case IEEE802154_STATUS_NO_ACK:
+        stats->noack++;
+        break;
+
+      case IEEE802154_STATUS_CHANNEL_ACCESS_FAILURE:
+        stats->chanfail++;
+        break;
+
+      default:
+        stats->otherfail++;
+        break;
+    }
+
+  if (latency < stats->latmin)
+    {
+      stats->latmin = latency;
+    }
+
+  if (latency > stats->latmax)
+    {
+      stats->latmax = latency;
+    }
+
+  stats->latsum += latency;
+
+  for (bucket = 0, latency /= 1000;
+       latency > 0 && bucket < I8SAK_BLASTER_NBUCKETS - 1;
+       bucket++, latency >>= 1)
+    {
+    }
+
+  stats->hist[bucket]++;
+  sem_post(&i8sak->blastersem);
+}
+
+/****************************************************************************
+ * Name : i8sak_blaster_report
+ ****************************************************************************/
+
+static void i8sak_blaster_report(FAR struct i8sak_s *i8sak)
+{
+  FAR struct i8sak_blasterstats_s *stats = &i8sak->blasterstats;
+  uint32_t confirmed;
+  uint32_t failed;
+  uint32_t elapsed;
+  uint64_t macbits;
+  uint64_t phybits;
+  int i;
+
+  confirmed = stats->success + stats->noack + stats->chanfail +
+              stats->otherfail;
+  failed    = confirmed - stats->success;
+  elapsed   = i8sak->blasterenabled ?
+              i8sak_blaster_usec() - stats->start : stats->elapsed;
+
+  printf("i8sak: blaster %lu sent, %lu confirmed, %lu ok, %lu no ack, "
+         "%lu channel busy, %lu other
+",
+         (unsigned long)stats->sent, (unsigned long)confirmed,
+         (unsigned long)stats->success, (unsigned long)stats->noack,
+         (unsigned long)stats->chanfail, (unsigned long)stats->otherfail);
+
+  if (confirmed == 0 || elapsed == 0)
+    {
+      return;
+    }
+
+  /* Throughput of the delivered frames: MAC payload only, and everything
+   * that went over the air for them.
+   */
+
+  macbits = (uint64_t)stats->success * i8sak->payload_len * 8;
+  phybits = (uint64_t)stats->success *
+            (i8sak->payload_len + i8sak_blaster_macoverhead(i8sak) +
+             I8SAK_PHY_OVERHEAD) * 8;
+
+  printf("  %lu.%03lu s, MAC %lu bit/s, PHY %lu bit/s, PER %lu.%02lu%%
+",
+         (unsigned long)(elapsed / 1000000),
+         (unsigned long)(elapsed % 1000000) / 1000,
+         (unsigned long)(macbits * 1000000 / elapsed),
+         (unsigned long)(phybits * 1000000 / elapsed),
+         (unsigned long)(failed * 100 / confirmed),
+         (unsigned long)((failed * 10000 / confirmed) % 100));
+
+  printf("  latency us: min %lu avg %lu max %lu
+",
+         (unsigned long)stats->latmin,
+         (unsigned long)(stats->latsum / confirmed),
+         (unsigned long)stats->latmax);
+
+  printf("  latency ms:");
+  for (i = 0; i < I8SAK_BLASTER_NBUCKETS - 1; i++)
+    {
+      printf(" <%d:%lu", 1 << i, (unsigned long)stats->hist[i]);
+    }
+
+  printf(" >=%d:%lu
+", 1 << (I8SAK_BLASTER_NBUCKETS - 2),
+         (unsigned long)stats->hist[I8SAK_BLASTER_NBUCKETS - 1]);
+}
+
+/****************************************************************************
+ * Name : i8sak_blaster_windowed
+ *
+ * Description :
+ *   Keep up to 'blasterwindow' data requests outstanding at the MAC, so that
+ *   the radio never waits for the application, and account for each
+ *   confirmation as it arrives.
+ *
+ ****************************************************************************/
+
+static void i8sak_blaster_windowed(FAR struct i8sak_s *i8sak)
+{
+  FAR struct i8sak_blasterstats_s *stats = &i8sak->blasterstats;
+  FAR struct i8sak_blasterslot_s *slot;
+  struct i8sak_eventfilter_s eventfilter;
+  struct mac802154dev_txframe_s tx;
+  int timeout;
+  int i;
+
+  memset(stats, 0, sizeof(struct i8sak_blasterstats_s));
+  memset(i8sak->blasterslots, 0, sizeof(i8sak->blasterslots));
+  stats->latmin = UINT32_MAX;
+  sem_init(&i8sak->blastersem, 0, i8sak->blasterwindow);
+  sem_setprotocol(&i8sak->blastersem, SEM_PRIO_NONE);
+
+  memset(&eventfilter, 0, sizeof(struct i8sak_eventfilter_s));
+  eventfilter.confevents.data = true;
+
+  if (i8sak_eventlistener_addreceiver(i8sak, i8sak_blaster_confcb,
+                                      &eventfilter, false) < 0)
+    {
+      sem_destroy(&i8sak->blastersem);
+      return;
+    }
+
+  /* The request does not change between frames except for its handle */
+
+  memset(&tx, 0, sizeof(struct mac802154dev_txframe_s));
+  tx.meta.flags.ackreq = 1;
+  tx.meta.flags.usegts = 0;
+  tx.meta.ranging = IEEE802154_NON_RANGING;
+  tx.meta.srcmode = i8sak->addrmode;
+  memcpy(&tx.meta.destaddr, &i8sak->ep_addr, sizeof(struct ieee802154_addr_s));
+  tx.length = i8sak->payload_len;
+  tx.payload = &i8sak->payload[0];
+
+  stats->start = i8sak_blaster_usec();
+
+  while (i8sak->blasterenabled &&
+         (i8sak->blastercount == 0 || stats->sent < i8sak->blastercount))
+    {
+      while (sem_wait(&i8sak->blastersem) < 0)
+        {
+          DEBUGASSERT(errno == EINTR);
+        }
+
+      tx.meta.handle = i8sak->msdu_handle++;
+
+      slot = &i8sak->blasterslots[tx.meta.handle &
+                                  (CONFIG_IEEE802154_I8SAK_BLASTER_MAXWINDOW - 1)];
+      slot->handle  = tx.meta.handle;
+      slot->sent    = i8sak_blaster_usec();
+      slot->pending = true;
+
+      if (write(i8sak->fd, &tx, sizeof(struct mac802154dev_txframe_s)) < 0)
+        {
+          slot->pending = false;
+          stats->otherfail++;
+          sem_post(&i8sak->blastersem);
+        }
+
+      stats->sent++;
+    }
+
+  /* Wait up to a second for the outstanding confirmations */
+
+  for (timeout = 0; timeout < 100; timeout++)
+    {
+      for (i = 0; i < CONFIG_IEEE802154_I8SAK_BLASTER_MAXWINDOW; i++)
+        {
+          if (i8sak->blasterslots[i].pending)
+            {
+              break;
+            }
+        }
+
+      if (i == CONFIG_IEEE802154_I8SAK_BLASTER_MAXWINDOW)
+        {
+          break;
+        }
+
+      usleep(10000);
+    }
+
+  stats->elapsed = i8sak_blaster_usec() - stats->start;
+  i8sak_eventlistener_removereceiver(i8sak, i8sak_blaster_confcb);
+  sem_destroy(&i8sak->blastersem);
+
+  i8sak->blasterenabled = false;
+  i8sak_blaster_report(i8sak);
+}
+
 static inline void i8sak_blaster_start(FAR struct i8sak_s *i8sak)
 {
   if (!i8sak->blasterenabled)
@@ -96,24 +386,33 @@ static inline void i8sak_blaster_start(FAR struct i8sak_s *i8sak)
 
 void i8sak_blaster_cmd(FAR struct i8sak_s *i8sak, int argc, FAR char *argv[])
 {
+  bool start = false;
   int option;
+  int value;
 
   if (argc < 2)
     {
       i8sak_blaster_start(i8sak);
     }
 
-  while ((option = getopt(argc, argv, "hqp:f:")) != ERROR)
+  while ((option = getopt(argc, argv, "hqsp:f:w:n:")) != ERROR)
     {
       switch (option)
         {
           case 'h':
             fprintf(stderr, "Blasts frames\n"
-                    "Usage: %s [-h|q|f <hex-payload>|p <period_ms>]\n"
+                    "Usage: %s [-h|q|s|f <hex-payload>|p <period_ms>|"
+                    "w <window>|n <count>]\n"
                     "    -h = this help menu\n"
                     "    -q = quit blasting\n"
+                    "    -s = show the statistics of the windowed blaster\n"
                     "    -f = set frame (and starts blaster)\n"
                     "    -p = set period (and start blaster)\n"
+                    "    -w = keep up to <window> frames outstanding instead\n"
+                    "         of sending one per period, 0 for periodic\n"
+                    "         (and start blaster)\n"
+                    "    -n = stop the windowed blaster after <count> frames,\n"
+                    "         0 for no limit (and start blaster)\n"
                     "Note: No option starts blaster with defaults\n"
                     , argv[0]);
 
@@ -125,14 +424,39 @@ void i8sak_blaster_cmd(FAR struct i8sak_s *i8sak, int argc, FAR char *argv[])
             i8sak->blasterenabled = false;
             break;
 
+          case 's': /* Show the statistics */
+            i8sak_blaster_report(i8sak);
+            break;
+
           case 'p': /* Inline change blaster period */
             i8sak->blasterperiod = atoi(optarg);
-            i8sak_blaster_start(i8sak);
+            start = true;
             break;
 
           case 'f': /* Inline change blaster frame */
             i8sak->payload_len = i8sak_str2payload(optarg, &i8sak->payload[0]);
-            i8sak_blaster_start(i8sak);
+            start = true;
+            break;
+
+          case 'w': /* Inline change blaster window */
+            value = atoi(optarg);
+            if (value < 0 || value > CONFIG_IEEE802154_I8SAK_BLASTER_MAXWINDOW ||
+                (value > 0 && i8sak->mode != I8SAK_MODE_CHAR))
+              {
+                fprintf(stderr, "ERROR: window must be 0 to %d, and 0 "
+                        "unless using the MAC character driver\n",
+                        CONFIG_IEEE802154_I8SAK_BLASTER_MAXWINDOW);
+                optind = -1;
+                i8sak_cmd_error(i8sak); /* This exits for us */
+              }
+
+            i8sak->blasterwindow = value;
+            start = true;
+            break;
+
+          case 'n': /* Inline change blaster count */
+            i8sak->blastercount = strtoul(optarg, NULL, 0);
+            start = true;
             break;
 
           case ':':
@@ -153,6 +477,13 @@ void i8sak_blaster_cmd(FAR struct i8sak_s *i8sak, int argc, FAR char *argv[])
             i8sak_cmd_error(i8sak); /* This exits for us */
         }
     }
+
+  /* Start once all of the settings are in place */
+
+  if (start)
+    {
+      i8sak_blaster_start(i8sak);
+    }
 }
 
 /****************************************************************************
@@ -179,6 +510,12 @@ pthread_addr_t i8sak_blaster_thread(pthread_addr_t arg)
     }
 #endif
 
+  if (i8sak->blasterwindow > 0)
+    {
+      i8sak_blaster_windowed(i8sak);
+      return NULL;
+    }
+
   while (i8sak->blasterenabled)
     {
       usleep(i8sak->blasterperiod*1000);
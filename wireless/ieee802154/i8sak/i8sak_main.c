@@ -622,6 +622,8 @@ static int i8sak_setup(FAR struct i8sak_s *i8sak, FAR const char *ifname)
     }
 
   i8sak->blasterperiod = 1000;
+  i8sak->blasterwindow = 0;
+  i8sak->blastercount = 0;
 
   /* Create strings for task based on device. i.e. i8_ieee0 */
 
@@ -765,7 +767,7 @@ static int i8sak_showusage(FAR const char *progname, int exitcode)
   fprintf(stderr, "Usage (Use the -h option on any command to get more info): %s\n"
           "    acceptassoc [-h|e]\n"
           "    assoc [-h|p|e|s|w|r|t]\n"
-          "    blaster [-h|q|f|p]\n"
+          "    blaster [-h|q|s|f|p|w|n]\n"
           "    get [-h] parameter"
           "    poll [-h]\n"
           "    regdump [-h]\n"
@@ -42,11 +42,14 @@
 #include <sys/types.h>
 #include <sys/ioctl.h>
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <string.h>
 #include <fcntl.h>
+#include <pthread.h>
+#include <semaphore.h>
 #include <errno.h>
 #include <debug.h>
 
@@ -84,15 +87,64 @@
 #  define CONFIG_IEEE802154_I8SHARK_FORWARDING_IFNAME "eth0"
 #endif
 
+#ifndef CONFIG_IEEE802154_I8SHARK_NFRAMES
+#  define CONFIG_IEEE802154_I8SHARK_NFRAMES 8
+#endif
+
+#ifndef CONFIG_IEEE802154_I8SHARK_BATCH
+#  define CONFIG_IEEE802154_I8SHARK_BATCH 1
+#endif
+
+#if (CONFIG_IEEE802154_I8SHARK_NFRAMES & (CONFIG_IEEE802154_I8SHARK_NFRAMES - 1)) != 0
+#  error CONFIG_IEEE802154_I8SHARK_NFRAMES must be a power of two
+#endif
+
+#define I8SHARK_RINGMASK (CONFIG_IEEE802154_I8SHARK_NFRAMES - 1)
+
 #define I8SHARK_MAX_DEVPATH 15
 
 #define ZEP_MAX_HDRSIZE 32
-#define I8SHARK_MAX_ZEPFRAME IEEE802154_MAX_PHY_PACKET_SIZE + ZEP_MAX_HDRSIZE
+#define I8SHARK_MAX_ZEPFRAME (IEEE802154_MAX_PHY_PACKET_SIZE + ZEP_MAX_HDRSIZE)
+#define I8SHARK_MAX_DATAGRAM \
+  (CONFIG_IEEE802154_I8SHARK_BATCH * I8SHARK_MAX_ZEPFRAME)
 
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
+/* A received frame and the time it was received */
+
+struct i8shark_slot_s
+{
+  uint64_t systime;
+  struct mac802154dev_rxframe_s frame;
+};
+
+/* The capture thread only reads frames from the MAC into the ring, so that
+ * a slow network does not hold up the radio.  It is the only writer of
+ * 'head' and the daemon, which encapsulates and sends the frames, is the
+ * only writer of 'tail'.  A frame is complete before 'head' moves past it,
+ * so the ring needs no lock.
+ */
+
+struct i8shark_ring_s
+{
+  volatile uint32_t head;
+  volatile uint32_t tail;
+  sem_t ready;                      /* Posted when frames are added */
+  struct i8shark_slot_s slot[CONFIG_IEEE802154_I8SHARK_NFRAMES];
+};
+
+struct i8shark_stats_s
+{
+  uint32_t captured;                /* Frames read from the MAC */
+  uint32_t dropped;                 /* Frames lost to a full ring */
+  uint32_t sent;                    /* Frames sent to Wireshark */
+  uint32_t datagrams;               /* UDP datagrams sent */
+  uint32_t senderrors;              /* Failed sendto() calls */
+  uint32_t maxbacklog;              /* Most frames waiting in the ring */
+};
+
 struct i8shark_state_s
 {
   bool initialized      : 1;
@@ -100,11 +152,16 @@ struct i8shark_state_s
   bool daemon_shutdown  : 1;
 
   pid_t daemon_pid;
+  int fd;
 
   /* User exposed settings */
 
   uint8_t chan;
+  uint8_t batch;                    /* Frames per UDP datagram */
   FAR char devpath[I8SHARK_MAX_DEVPATH];
+
+  struct i8shark_stats_s stats;
+  struct i8shark_ring_s ring;
 };
 
 /****************************************************************************
@@ -112,6 +169,7 @@ struct i8shark_state_s
  ****************************************************************************/
 
 static int i8shark_init(FAR struct i8shark_state_s *i8shark);
+static void i8shark_showstats(FAR struct i8shark_state_s *i8shark);
 static int i8shark_daemon(int argc, FAR char *argv[]);
 
 /****************************************************************************
@@ -120,6 +178,8 @@ static int i8shark_daemon(int argc, FAR char *argv[]);
 
 static struct i8shark_state_s g_i8shark;
 
+static uint8_t g_datagram[I8SHARK_MAX_DATAGRAM];
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -140,6 +200,9 @@ static void i8shark_help(void)
   printf("\nInterface only needs to be specified the first time\n");
   printf("OPTIONS include:\n");
   printf("  [-h] shows this message and exits\n");
+  printf("  [-b <frames>] sends up to <frames> frames per UDP datagram "
+         "(1-%d)\n", CONFIG_IEEE802154_I8SHARK_BATCH);
+  printf("  [-s] shows the capture statistics and exits\n");
 }
 #endif
 
@@ -186,12 +249,13 @@ static int arg_decimal(FAR char **arg, FAR long *value)
  ****************************************************************************/
 
 #ifdef CONFIG_NSH_BUILTIN_APPS
-static void parse_args(FAR struct i8shark_state_s *i8shark, int argc, FAR char **argv)
+static void parse_args(FAR struct i8shark_state_s *i8shark, int index,
+                       int argc, FAR char **argv)
 {
   FAR char *ptr;
-  int index;
+  long value;
 
-  for (index = 1; index < argc; )
+  while (index < argc)
     {
       ptr = argv[index];
       if (ptr[0] != '-')
@@ -206,6 +270,22 @@ static void parse_args(FAR struct i8shark_state_s *i8shark, int argc, FAR char *
             i8shark_help();
             exit(0);
 
+          case 'b':
+            index += arg_decimal(&argv[index], &value);
+            if (value < 1 || value > CONFIG_IEEE802154_I8SHARK_BATCH)
+              {
+                printf("Batch must be 1 to %d\n",
+                       CONFIG_IEEE802154_I8SHARK_BATCH);
+                exit(1);
+              }
+
+            i8shark->batch = (uint8_t)value;
+            break;
+
+          case 's':
+            i8shark_showstats(i8shark);
+            exit(0);
+
           default:
             printf("Unsupported option: %s\n", ptr);
             i8shark_help();
@@ -228,7 +308,8 @@ static int i8shark_init(FAR struct i8shark_state_s *i8shark)
 
   /* Set the default settings using config options */
 
-  i8shark->chan = CONFIG_IEEE802154_I8SHARK_CHANNEL;
+  i8shark->chan  = CONFIG_IEEE802154_I8SHARK_CHANNEL;
+  i8shark->batch = CONFIG_IEEE802154_I8SHARK_BATCH;
   strcpy(i8shark->devpath, CONFIG_IEEE802154_I8SHARK_DEVPATH);
 
   /* Flags for synchronzing with daemon state */
@@ -240,6 +321,216 @@ static int i8shark_init(FAR struct i8shark_state_s *i8shark)
   return OK;
 }
 
+/****************************************************************************
+ * Name: i8shark_showstats
+ ****************************************************************************/
+
+static void i8shark_showstats(FAR struct i8shark_state_s *i8shark)
+{
+  FAR struct i8shark_stats_s *stats = &i8shark->stats;
+
+  printf("i8shark: daemon %s\n",
+         i8shark->daemon_started ? "running" : "not running");
+  printf("  captured:   %lu\n", (unsigned long)stats->captured);
+  printf("  dropped:    %lu\n", (unsigned long)stats->dropped);
+  printf("  sent:       %lu\n", (unsigned long)stats->sent);
+  printf("  datagrams:  %lu\n", (unsigned long)stats->datagrams);
+  printf("  senderrors: %lu\n", (unsigned long)stats->senderrors);
+  printf("  maxbacklog: %lu of %d\n", (unsigned long)stats->maxbacklog,
+         CONFIG_IEEE802154_I8SHARK_NFRAMES);
+}
+
+/****************************************************************************
+ * Name : i8shark_capture
+ *
+ * Description :
+ *   Read frames from the MAC character driver straight into the free slots
+ *   of the ring and time stamp them.  When the ring is full, frames are
+ *   still read, so that the MAC does not back up, but they are dropped and
+ *   counted.
+ *
+ ****************************************************************************/
+
+static pthread_addr_t i8shark_capture(pthread_addr_t arg)
+{
+  FAR struct i8shark_state_s *i8shark = (FAR struct i8shark_state_s *)arg;
+  FAR struct i8shark_ring_s *ring = &i8shark->ring;
+  FAR struct i8shark_slot_s *slot;
+  struct mac802154dev_rxframe_s overflow;
+  uint32_t backlog;
+  int ret;
+
+  while (!i8shark->daemon_shutdown)
+    {
+      backlog = ring->head - ring->tail;
+      if (backlog >= CONFIG_IEEE802154_I8SHARK_NFRAMES)
+        {
+          ret = read(i8shark->fd, &overflow,
+                     sizeof(struct mac802154dev_rxframe_s));
+          if (ret >= 0)
+            {
+              i8shark->stats.dropped++;
+            }
+
+          continue;
+        }
+
+      slot = &ring->slot[ring->head & I8SHARK_RINGMASK];
+      ret  = read(i8shark->fd, &slot->frame,
+                  sizeof(struct mac802154dev_rxframe_s));
+      if (ret < 0)
+        {
+          continue;
+        }
+
+      slot->systime = clock_systimer();
+      i8shark->stats.captured++;
+      if (backlog + 1 > i8shark->stats.maxbacklog)
+        {
+          i8shark->stats.maxbacklog = backlog + 1;
+        }
+
+      ring->head++;
+      sem_post(&ring->ready);
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name : i8shark_zepencode
+ *
+ * Description :
+ *   Encapsulate one frame as a Wireshark Zigbee Encapsulation Protocol
+ *   (ZEP) packet.  Returns the size of the packet.
+ *
+ ****************************************************************************/
+
+static int i8shark_zepencode(FAR const struct i8shark_slot_s *slot,
+                             uint8_t chan, FAR uint8_t *zepframe)
+{
+  FAR const struct mac802154dev_rxframe_s *frame = &slot->frame;
+  enum ieee802154_frametype_e ftype;
+  int ind = 0;
+
+  /* First 2 bytes of packet represent preamble. For ZEP, "EX" */
+
+  zepframe[ind++] = 'E';
+  zepframe[ind++] = 'X';
+
+  /* The next byte is the version. We are using V2 */
+
+  zepframe[ind++] = 2;
+
+  /* Next byte is type. ZEP only differentiates between ACK and Data. My
+   * assumption is that Data also includes MAC command frames and beacon
+   * frames. So we really only need to check if it's an ACK or not.
+   */
+
+  ftype = ((*(FAR const uint16_t *)frame->payload) &
+           IEEE802154_FRAMECTRL_FTYPE) >> IEEE802154_FRAMECTRL_SHIFT_FTYPE;
+
+  if (ftype == IEEE802154_FRAME_ACK)
+    {
+      zepframe[ind++] = 2;
+
+      /* Not sure why, but the ZEP header allows for a 4-byte sequence no.
+       * despite 802.15.4 sequence number only being 1-byte
+       */
+
+      zepframe[ind]   = frame->meta.dsn;
+      zepframe[ind+1] = 0;
+      zepframe[ind+2] = 0;
+      zepframe[ind+3] = 0;
+      ind += 4;
+    }
+  else
+    {
+      zepframe[ind++] = 1;
+
+      /* Next bytes is the Channel ID */
+
+      zepframe[ind++] = chan;
+
+      /* For now, just hard code the device ID to an arbitrary value */
+
+      zepframe[ind++] = 0xFA;
+      zepframe[ind++] = 0xDE;
+
+      /* Not completely sure what LQI mode is. My best guess as of now based
+       * on a few comments in the Wireshark code is that it determines whether
+       * the last 2 bytes of the frame portion of the packet is the CRC or the
+       * LQI.  I believe it is CRC = 1, LQI = 0. We will assume the CRC is the
+       * last few bytes as that is what the MAC layer expects. However, this
+       * may be a bad assumption for certain radios.
+       */
+
+      zepframe[ind++] = 1;
+
+      /* Next byte is the LQI value */
+
+      zepframe[ind++] = frame->meta.lqi;
+
+      /* Need to use NTP to get time, but for now, include the system time
+       * at which the frame was captured.
+       */
+
+      memcpy(&zepframe[ind], &slot->systime, 8);
+      ind += 8;
+
+      /* Not sure why, but the ZEP header allows for a 4-byte sequence no.
+       * despite 802.15.4 sequence number only being 1-byte
+       */
+
+      zepframe[ind]   = frame->meta.dsn;
+      zepframe[ind+1] = 0;
+      zepframe[ind+2] = 0;
+      zepframe[ind+3] = 0;
+      ind += 4;
+
+      /* Skip 10-bytes for reserved fields */
+
+      memset(&zepframe[ind], 0, 10);
+      ind += 10;
+
+      /* Last byte is the length */
+
+#ifdef CONFIG_IEEE802154_I8SHARK_XBEE_APPHDR
+      zepframe[ind++] = frame->length - 2;
+#else
+      zepframe[ind++] = frame->length;
+#endif
+    }
+
+  /* The ZEP header is filled, now copy the frame in */
+
+#ifdef CONFIG_IEEE802154_I8SHARK_XBEE_APPHDR
+  memcpy(&zepframe[ind], frame->payload, frame->offset);
+  ind += frame->offset;
+
+  /* XBee radios use a 2 byte "application header" to support duplicate packet
+   * detection.  Wireshark doesn't know how to handle this data, so we provide
+   * a configuration option that drops the first 2 bytes of the payload portion
+   * of the frame for all sniffed frames
+   *
+   * NOTE: Since we remove data from the frame, the FCS is no longer valid
+   * and Wireshark will fail to disect the frame.  Wireshark ignores a case
+   * where the FCS is not included in the actual frame.  Therefore, we
+   * subtract 4 rather than 2 to remove the FCS field so that the disector
+   * will not fail.
+   */
+
+  memcpy(&zepframe[ind], (frame->payload + frame->offset + 2),
+         (frame->length - frame->offset - 2));
+  ind += frame->length - frame->offset - 4;
+#else
+  memcpy(&zepframe[ind], frame->payload, frame->length);
+  ind += frame->length;
+#endif
+
+  return ind;
+}
+
 /****************************************************************************
  * Name : i8shark_daemon
  *
@@ -249,22 +540,33 @@ static int i8shark_init(FAR struct i8shark_state_s *i8shark)
  *   packet and sends it over Ethernet to the specified host machine running
  *   Wireshark.
  *
+ *   The frames are read by a capture thread at a higher priority.  The
+ *   daemon drains the frames that have accumulated each time it runs and
+ *   packs up to 'batch' ZEP packets into each UDP datagram.
+ *
  ****************************************************************************/
 
 static int i8shark_daemon(int argc, FAR char *argv[])
 {
-  int ret;
-  int fd;
+  FAR struct i8shark_ring_s *ring = &g_i8shark.ring;
+  struct sched_param param;
   struct sockaddr_in addr;
   struct sockaddr_in raddr;
+  pthread_attr_t attr;
+  pthread_t capture;
   socklen_t addrlen;
+  uint8_t chan;
+  int nframes;
+  int nbytes;
   int sockfd;
+  int ind;
+  int ret;
 
   fprintf(stderr, "i8shark: daemon started\n");
   g_i8shark.daemon_started = true;
 
-  fd = open(g_i8shark.devpath, O_RDWR);
-  if (fd < 0)
+  g_i8shark.fd = open(g_i8shark.devpath, O_RDWR);
+  if (g_i8shark.fd < 0)
     {
       fprintf(stderr, "ERROR: cannot open %s, errno=%d\n", g_i8shark.devpath, errno);
       g_i8shark.daemon_started = false;
@@ -274,11 +576,11 @@ static int i8shark_daemon(int argc, FAR char *argv[])
 
   /* Place the MAC into promiscuous mode */
 
-  ieee802154_setpromisc(fd, true);
+  ieee802154_setpromisc(g_i8shark.fd, true);
 
   /* Always listen */
 
-  ieee802154_setrxonidle(fd, true);
+  ieee802154_setrxonidle(g_i8shark.fd, true);
 
   /* Create a UDP socket to send the data to Wireshark */
 
@@ -286,8 +588,7 @@ static int i8shark_daemon(int argc, FAR char *argv[])
   if (sockfd < 0)
     {
       fprintf(stderr, "ERROR: socket failure %d\n", errno);
-      g_i8shark.daemon_started = false;
-      return -1;
+      goto errout_with_fd;
     }
 
   /* We bind to the IP address of the outbound interface so that the OS knows
@@ -302,7 +603,7 @@ static int i8shark_daemon(int argc, FAR char *argv[])
   if (bind(sockfd, (FAR struct sockaddr *)&addr, addrlen) < 0)
     {
       fprintf(stderr, "ERROR: Bind failure: %d\n", errno);
-      return -1;
+      goto errout_with_socket;
     }
 
   /* Setup our remote address. Wireshark expects ZEP packets over UDP on port 17754 */
@@ -311,151 +612,95 @@ static int i8shark_daemon(int argc, FAR char *argv[])
   raddr.sin_port        = HTONS(17754);
   raddr.sin_addr.s_addr = HTONL(CONFIG_IEEE802154_I8SHARK_HOST_IPADDR);
 
-  /* Loop until the daemon is shutdown reading incoming IEEE 802.15.4 frames,
-   * packing them into Wireshark "Zigbee Encapsulation Packets" (ZEP) and sending
-   * them over UDP to Wireshark.
-   */
+  /* Start capturing into an empty ring, one priority above the daemon */
 
-  while (!g_i8shark.daemon_shutdown)
-    {
-      struct mac802154dev_rxframe_s frame;
-      enum ieee802154_frametype_e ftype;
-      uint8_t zepframe[I8SHARK_MAX_ZEPFRAME];
-      systime_t systime;
-      int ind = 0;
-      int nbytes;
+  ring->head = 0;
+  ring->tail = 0;
+  sem_init(&ring->ready, 0, 0);
+  memset(&g_i8shark.stats, 0, sizeof(struct i8shark_stats_s));
 
-      /* Get an incoming frame from the MAC character driver */
+  pthread_attr_init(&attr);
+  (void)pthread_attr_getschedparam(&attr, &param);
+  param.sched_priority++;
+  (void)pthread_attr_setschedparam(&attr, &param);
 
-      ret = read(fd, &frame, sizeof(struct mac802154dev_rxframe_s));
-      if (ret < 0)
-        {
-          continue;
-        }
-
-      /* First 2 bytes of packet represent preamble. For ZEP, "EX" */
-
-      zepframe[ind++] = 'E';
-      zepframe[ind++] = 'X';
-
-      /* The next byte is the version. We are using V2 */
-
-      zepframe[ind++] = 2;
+  ret = pthread_create(&capture, &attr, i8shark_capture, &g_i8shark);
+  if (ret != 0)
+    {
+      fprintf(stderr, "ERROR: failed to start capture thread: %d\n", ret);
+      sem_destroy(&ring->ready);
+      goto errout_with_socket;
+    }
 
-      /* Next byte is type. ZEP only differentiates between ACK and Data. My
-       * assumption is that Data also includes MAC command frames and beacon
-       * frames. So we really only need to check if it's an ACK or not.
-       */
+  pthread_setname_np(capture, "i8shark capture");
 
-      ftype = ((*(uint16_t *)frame.payload) & IEEE802154_FRAMECTRL_FTYPE) >>
-              IEEE802154_FRAMECTRL_SHIFT_FTYPE;
+  /* Loop until the daemon is shutdown, packing the captured frames into
+   * Wireshark "Zigbee Encapsulation Packets" (ZEP) and sending them over
+   * UDP to Wireshark.
+   */
 
-      if (ftype == IEEE802154_FRAME_ACK)
+  while (!g_i8shark.daemon_shutdown)
+    {
+      while (sem_wait(&ring->ready) < 0)
         {
-          zepframe[ind++] = 2;
-
-          /* Not sure why, but the ZEP header allows for a 4-byte sequence no.
-           * despite 802.15.4 sequence number only being 1-byte
-           */
-
-          zepframe[ind] = frame.meta.dsn;
-          ind += 4;
+          DEBUGASSERT(errno == EINTR);
         }
-      else
-        {
-          zepframe[ind++] = 1;
-
-          /* Next bytes is the Channel ID */
-
-          ieee802154_getchan(fd, &zepframe[ind++]);
-
-          /* For now, just hard code the device ID to an arbitrary value */
-
-          zepframe[ind++] = 0xFA;
-          zepframe[ind++] = 0xDE;
-
-          /* Not completely sure what LQI mode is. My best guess as of now based
-           * on a few comments in the Wireshark code is that it determines whether
-           * the last 2 bytes of the frame portion of the packet is the CRC or the
-           * LQI.  I believe it is CRC = 1, LQI = 0. We will assume the CRC is the
-           * last few bytes as that is what the MAC layer expects. However, this
-           * may be a bad assumption for certain radios.
-           */
-
-          zepframe[ind++] = 1;
-
-          /* Next byte is the LQI value */
-
-          zepframe[ind++] = frame.meta.lqi;
 
-          /* Need to use NTP to get time, but for now, include the system time */
+      /* The channel is read once for all of the frames waiting */
 
-          systime = clock_systimer();
-          memcpy(&zepframe[ind], &systime, 8);
-          ind += 8;
+      chan = g_i8shark.chan;
+      ieee802154_getchan(g_i8shark.fd, &chan);
 
-          /* Not sure why, but the ZEP header allows for a 4-byte sequence no.
-           * despite 802.15.4 sequence number only being 1-byte
-           */
-
-          zepframe[ind]   = frame.meta.dsn;
-          zepframe[ind+1] = 0;
-          zepframe[ind+2] = 0;
-          zepframe[ind+3] = 0;
-          ind += 4;
-
-          /* Skip 10-bytes for reserved fields */
+      while (ring->tail != ring->head)
+        {
+          /* Fill a datagram with as many frames as the batch allows */
 
-          ind += 10;
+          for (ind = 0, nframes = 0;
+               nframes < g_i8shark.batch && ring->tail != ring->head;
+               nframes++)
+            {
+              ind += i8shark_zepencode(&ring->slot[ring->tail & I8SHARK_RINGMASK],
+                                       chan, &g_datagram[ind]);
+              ring->tail++;
+            }
 
-          /* Last byte is the length */
+          /* Send the encapsulated frames to Wireshark over UDP */
 
-#ifdef CONFIG_IEEE802154_I8SHARK_XBEE_APPHDR
-          zepframe[ind++] = frame.length - 2;
-#else
-          zepframe[ind++] = frame.length;
-#endif
+          nbytes = sendto(sockfd, g_datagram, ind, 0,
+                          (FAR struct sockaddr *)&raddr, addrlen);
+          if (nbytes < ind)
+            {
+              g_i8shark.stats.senderrors++;
+            }
+          else
+            {
+              g_i8shark.stats.datagrams++;
+              g_i8shark.stats.sent += nframes;
+            }
         }
+    }
 
-      /* The ZEP header is filled, now copy the frame in */
-
-#ifdef CONFIG_IEEE802154_I8SHARK_XBEE_APPHDR
-      memcpy(&zepframe[ind], frame.payload, frame.offset);
-      ind += frame.offset;
-
-      /* XBee radios use a 2 byte "application header" to support duplicate packet
-       * detection.  Wireshark doesn't know how to handle this data, so we provide
-       * a configuration option that drops the first 2 bytes of the payload portion
-       * of the frame for all sniffed frames
-       *
-       * NOTE: Since we remove data from the frame, the FCS is no longer valid
-       * and Wireshark will fail to disect the frame.  Wireshark ignores a case
-       * where the FCS is not included in the actual frame.  Therefore, we
-       * subtract 4 rather than 2 to remove the FCS field so that the disector
-       * will not fail.
-       */
-
-      memcpy(&zepframe[ind], (frame.payload + frame.offset + 2),
-             (frame.length - frame.offset - 2));
-      ind += frame.length - frame.offset - 4;
-#else
-      memcpy(&zepframe[ind], frame.payload, frame.length);
-      ind += frame.length;
-#endif
+  /* The capture thread is blocked in read(); cancel it rather than waiting
+   * for another frame.
+   */
 
-      /* Send the encapsulated frame to Wireshark over UDP */
-
-      nbytes = sendto(sockfd, zepframe, ind, 0, (struct sockaddr*)&raddr, addrlen);
-      if (nbytes < ind)
-        {
-          fprintf(stderr, "ERROR: sendto() did not send all bytes. %d\n", errno);
-        }
-    }
+  pthread_cancel(capture);
+  (void)pthread_join(capture, NULL);
+  sem_destroy(&ring->ready);
 
   g_i8shark.daemon_started = false;
-  close(fd);
+  close(sockfd);
+  close(g_i8shark.fd);
   printf("i8shark: daemon closing\n");
   return OK;
+
+errout_with_socket:
+  close(sockfd);
+
+errout_with_fd:
+  g_i8shark.daemon_started = false;
+  close(g_i8shark.fd);
+  return ERROR;
 }
 
 /****************************************************************************
@@ -506,8 +751,18 @@ int i8shark_main(int argc, char *argv[])
         }
     }
 
+#ifdef CONFIG_NSH_BUILTIN_APPS
+  parse_args(&g_i8shark, argind, argc, argv);
+#endif
+
   /* If the daemon is not running, start it. */
 
+  if (g_i8shark.daemon_started)
+    {
+      printf("i8shark: daemon already running\n");
+      return OK;
+    }
+
   g_i8shark.daemon_pid = task_create("i8shark",
                                      CONFIG_IEEE802154_I8SHARK_DAEMON_PRIORITY,
                                      CONFIG_IEEE802154_I8SHARK_DAEMON_STACKSIZE,
@@ -0,0 +1,561 @@
+/****************************************************************************
+ * apps/wireless/wapi/src/roam.c
+ *
+ *   Copyright (C) 2018 Gregory Nutt. All rights reserved.
+ *   Author: Gregory Nutt <gnutt@nuttx.org>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name NuttX nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/ioctl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+
+#include "wireless/wapi.h"
+#include "util.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Configuration ************************************************************/
+
+#ifndef CONFIG_WIRELESS_WAPI_ROAM_NAPS
+#  define CONFIG_WIRELESS_WAPI_ROAM_NAPS 8
+#endif
+
+#ifndef CONFIG_WIRELESS_WAPI_ROAM_POLLMS
+#  define CONFIG_WIRELESS_WAPI_ROAM_POLLMS 200
+#endif
+
+#ifndef CONFIG_WIRELESS_WAPI_ROAM_TIMEOUT
+#  define CONFIG_WIRELESS_WAPI_ROAM_TIMEOUT 2000
+#endif
+
+/* An AP that failed this many fast reconnects is not tried again until a
+ * scan sees it again.
+ */
+
+#define ROAM_MAXFAILS  2
+
+/* Give up waiting for a scan after this many polls */
+
+#define ROAM_SCANTRIES (5000 / CONFIG_WIRELESS_WAPI_ROAM_POLLMS)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The cached parameters of one AP of the ESSID */
+
+struct wapi_roam_ap_s
+{
+  bool inuse;                    /* The entry is valid */
+  uint8_t fails;                 /* Failed reconnects since last seen */
+  struct ether_addr bssid;       /* Address of the AP */
+  double freq;                   /* Channel frequency of the AP */
+  int rssi;                      /* Signal level at the last scan */
+  uint32_t seen;                 /* Time of the last scan that saw it (ms) */
+};
+
+/* The state of wapi_roam() */
+
+struct wapi_roam_s
+{
+  FAR const struct wapi_roam_config_s *config;
+  int sock;                      /* Socket for the wapi ioctls */
+  FAR char *buf;                 /* Scan buffer, kept between scans */
+  size_t buflen;                 /* Size of buf */
+  uint32_t scanned;              /* Time of the last scan (ms) */
+  struct wapi_roam_ap_s aps[CONFIG_WIRELESS_WAPI_ROAM_NAPS];
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wapi_roam_msec
+ ****************************************************************************/
+
+static uint32_t wapi_roam_msec(void)
+{
+  struct timespec ts;
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+  clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+
+  return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/****************************************************************************
+ * Name: wapi_roam_linked
+ *
+ * Description:
+ *   Return true if the interface is associated and, if so, the BSSID of the
+ *   AP.
+ *
+ ****************************************************************************/
+
+static bool wapi_roam_linked(FAR struct wapi_roam_s *roam,
+                             FAR struct ether_addr *bssid)
+{
+  struct ether_addr null;
+  struct ether_addr bcast;
+
+  if (wapi_get_ap(roam->sock, roam->config->ifname, bssid) < 0)
+    {
+      return false;
+    }
+
+  wapi_make_null_ether(&null);
+  wapi_make_broad_ether(&bcast);
+
+  return memcmp(bssid, &null, sizeof(struct ether_addr)) != 0 &&
+         memcmp(bssid, &bcast, sizeof(struct ether_addr)) != 0;
+}
+
+/****************************************************************************
+ * Name: wapi_roam_find
+ *
+ * Description:
+ *   Return the cache entry of an AP, or NULL.
+ *
+ ****************************************************************************/
+
+static FAR struct wapi_roam_ap_s *
+wapi_roam_find(FAR struct wapi_roam_s *roam,
+               FAR const struct ether_addr *bssid)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_WIRELESS_WAPI_ROAM_NAPS; i++)
+    {
+      FAR struct wapi_roam_ap_s *ap = &roam->aps[i];
+
+      if (ap->inuse &&
+          memcmp(&ap->bssid, bssid, sizeof(struct ether_addr)) == 0)
+        {
+          return ap;
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: wapi_roam_update
+ *
+ * Description:
+ *   Scan callback: cache the parameters of an AP of the ESSID.  When the
+ *   cache is full, the entry seen least recently, or the weakest among
+ *   those, is replaced.
+ *
+ ****************************************************************************/
+
+static int wapi_roam_update(FAR const struct wapi_scan_info_s *info,
+                            FAR void *arg)
+{
+  FAR struct wapi_roam_s *roam = (FAR struct wapi_roam_s *)arg;
+  FAR struct wapi_roam_ap_s *ap;
+  int i;
+
+  if (!info->has_freq)
+    {
+      return 0;
+    }
+
+  ap = wapi_roam_find(roam, &info->ap);
+  if (ap == NULL)
+    {
+      ap = &roam->aps[0];
+      for (i = 0; i < CONFIG_WIRELESS_WAPI_ROAM_NAPS; i++)
+        {
+          FAR struct wapi_roam_ap_s *tmp = &roam->aps[i];
+
+          if (!tmp->inuse)
+            {
+              ap = tmp;
+              break;
+            }
+
+          if ((int32_t)(tmp->seen - ap->seen) < 0 ||
+              (tmp->seen == ap->seen && tmp->rssi < ap->rssi))
+            {
+              ap = tmp;
+            }
+        }
+
+      ap->inuse = true;
+      memcpy(&ap->bssid, &info->ap, sizeof(struct ether_addr));
+    }
+
+  ap->fails = 0;
+  ap->freq  = info->freq;
+  ap->rssi  = info->has_rssi ? info->rssi : INT16_MIN;
+  ap->seen  = roam->scanned;
+  return 0;
+}
+
+/****************************************************************************
+ * Name: wapi_roam_scan
+ *
+ * Description:
+ *   Scan for the APs of the ESSID and update the cache.
+ *
+ ****************************************************************************/
+
+static int wapi_roam_scan(FAR struct wapi_roam_s *roam)
+{
+  FAR const char *ifname = roam->config->ifname;
+  struct wapi_scan_filter_s filter;
+  int tries;
+  int ret;
+
+  ret = wapi_scan_init(roam->sock, ifname);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  tries = ROAM_SCANTRIES;
+  while ((ret = wapi_scan_stat(roam->sock, ifname)) > 0 && --tries > 0)
+    {
+      usleep(CONFIG_WIRELESS_WAPI_ROAM_POLLMS * 1000);
+    }
+
+  if (ret != 0)
+    {
+      return ret < 0 ? ret : -ETIMEDOUT;
+    }
+
+  memset(&filter, 0, sizeof(struct wapi_scan_filter_s));
+  filter.essid = roam->config->essid;
+  roam->scanned = wapi_roam_msec();
+
+  /* The buffer is only grown when the results do not fit */
+
+  while ((ret = wapi_scan_process(roam->sock, ifname, roam->buf,
+                                  roam->buflen, &filter, wapi_roam_update,
+                                  roam)) == -E2BIG)
+    {
+      FAR char *tmp;
+
+      tmp = realloc(roam->buf, roam->buflen * 2);
+      if (tmp == NULL)
+        {
+          return -ENOMEM;
+        }
+
+      roam->buf     = tmp;
+      roam->buflen *= 2;
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: wapi_roam_select
+ *
+ * Description:
+ *   Return the strongest cached AP that may be tried, other than exclude,
+ *   or NULL.
+ *
+ ****************************************************************************/
+
+static FAR struct wapi_roam_ap_s *
+wapi_roam_select(FAR struct wapi_roam_s *roam,
+                 FAR const struct wapi_roam_ap_s *exclude)
+{
+  FAR struct wapi_roam_ap_s *best = NULL;
+  int i;
+
+  for (i = 0; i < CONFIG_WIRELESS_WAPI_ROAM_NAPS; i++)
+    {
+      FAR struct wapi_roam_ap_s *ap = &roam->aps[i];
+
+      if (ap->inuse && ap != exclude && ap->fails < ROAM_MAXFAILS &&
+          (best == NULL || ap->rssi > best->rssi))
+        {
+          best = ap;
+        }
+    }
+
+  return best;
+}
+
+/****************************************************************************
+ * Name: wapi_roam_connect
+ *
+ * Description:
+ *   Associate directly with a cached AP: the channel and BSSID are fixed so
+ *   that the driver need not scan, then the security parameters and ESSID
+ *   are set.  Wait until the link is up or the timeout expires.
+ *
+ ****************************************************************************/
+
+static int wapi_roam_connect(FAR struct wapi_roam_s *roam,
+                             FAR struct wapi_roam_ap_s *ap)
+{
+  FAR const struct wapi_roam_config_s *config = roam->config;
+  struct wpa_wconfig_s wconfig;
+  struct ether_addr bssid;
+  uint32_t start;
+  int ret;
+
+  printf("wapi: Connecting to %02x:%02x:%02x:%02x:%02x:%02x on %g MHz\n",
+         ap->bssid.ether_addr_octet[0], ap->bssid.ether_addr_octet[1],
+         ap->bssid.ether_addr_octet[2], ap->bssid.ether_addr_octet[3],
+         ap->bssid.ether_addr_octet[4], ap->bssid.ether_addr_octet[5],
+         ap->freq / 1e6);
+
+  ret = wapi_set_freq(roam->sock, config->ifname, ap->freq,
+                      WAPI_FREQ_FIXED);
+  if (ret < 0)
+    {
+      WAPI_ERROR("ERROR: wapi_set_freq() failed: %d\n", ret);
+    }
+
+  ret = wapi_set_ap(roam->sock, config->ifname, &ap->bssid);
+  if (ret < 0)
+    {
+      WAPI_ERROR("ERROR: wapi_set_ap() failed: %d\n", ret);
+    }
+
+  memset(&wconfig, 0, sizeof(struct wpa_wconfig_s));
+  wconfig.sta_mode    = WAPI_MODE_MANAGED;
+  wconfig.auth_wpa    = config->auth_wpa;
+  wconfig.cipher_mode = config->cipher_mode;
+  wconfig.alg         = config->alg;
+  wconfig.ifname      = config->ifname;
+  wconfig.ssid        = (FAR const uint8_t *)config->essid;
+  wconfig.ssidlen     = strlen(config->essid);
+  wconfig.passphrase  = (FAR const uint8_t *)config->passphrase;
+  wconfig.phraselen   = config->passphrase ? strlen(config->passphrase) : 0;
+
+  ret = wpa_driver_wext_associate(&wconfig);
+  if (ret >= 0)
+    {
+      start = wapi_roam_msec();
+      do
+        {
+          if (wapi_roam_linked(roam, &bssid) &&
+              memcmp(&bssid, &ap->bssid, sizeof(struct ether_addr)) == 0)
+            {
+              ap->fails = 0;
+              return OK;
+            }
+
+          usleep(CONFIG_WIRELESS_WAPI_ROAM_POLLMS * 1000);
+        }
+      while (wapi_roam_msec() - start < CONFIG_WIRELESS_WAPI_ROAM_TIMEOUT);
+
+      ret = -ETIMEDOUT;
+    }
+
+  ap->fails++;
+  return ret;
+}
+
+/****************************************************************************
+ * Name: wapi_roam_reconnect
+ *
+ * Description:
+ *   Restore a lost link.  The cached APs are tried first, strongest first,
+ *   and a scan is only needed when none of them answers.
+ *
+ ****************************************************************************/
+
+static int wapi_roam_reconnect(FAR struct wapi_roam_s *roam)
+{
+  FAR struct wapi_roam_ap_s *ap;
+  bool scanned = false;
+  int ret;
+
+  for (; ; )
+    {
+      while ((ap = wapi_roam_select(roam, NULL)) != NULL)
+        {
+          if (wapi_roam_connect(roam, ap) == OK)
+            {
+              return OK;
+            }
+        }
+
+      if (scanned)
+        {
+          return -ENETUNREACH;
+        }
+
+      /* Full scan.  Let the driver pick the channel again */
+
+      wapi_set_freq(roam->sock, roam->config->ifname, 0, WAPI_FREQ_AUTO);
+      ret = wapi_roam_scan(roam);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      scanned = true;
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wapi_roam
+ *
+ * Description:
+ *   Keep the interface associated with the ESSID.  The channel and BSSID of
+ *   each AP found by the background scans are cached so that a lost link is
+ *   restored by associating directly with the best known AP, without a
+ *   full scan.  The background scans also select a stronger AP to roam to
+ *   when the signal of the current one drops below the threshold.
+ *
+ * Input Parameters:
+ *   config - Describes the network.
+ *
+ * Returned Value:
+ *   Does not return unless a fatal error occurs, in which case a negated
+ *   errno is returned.
+ *
+ ****************************************************************************/
+
+int wapi_roam(FAR const struct wapi_roam_config_s *config)
+{
+  FAR struct wapi_roam_s *roam;
+  FAR struct wapi_roam_ap_s *cur;
+  FAR struct wapi_roam_ap_s *target;
+  struct ether_addr bssid;
+  int ret;
+
+  WAPI_VALIDATE_PTR(config);
+  WAPI_VALIDATE_PTR(config->ifname);
+  WAPI_VALIDATE_PTR(config->essid);
+
+  roam = (FAR struct wapi_roam_s *)zalloc(sizeof(struct wapi_roam_s));
+  if (roam == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  roam->config = config;
+  roam->buflen = IW_SCAN_MAX_DATA;
+  roam->buf    = malloc(roam->buflen);
+  if (roam->buf == NULL)
+    {
+      ret = -ENOMEM;
+      goto errout_with_roam;
+    }
+
+  roam->sock = wapi_make_socket();
+  if (roam->sock < 0)
+    {
+      ret = roam->sock;
+      goto errout_with_buf;
+    }
+
+  /* Force the first background scan */
+
+  roam->scanned = wapi_roam_msec() - config->scaninterval * 1000;
+
+  for (; ; )
+    {
+      if (!wapi_roam_linked(roam, &bssid))
+        {
+          ret = wapi_roam_reconnect(roam);
+          if (ret < 0)
+            {
+              WAPI_ERROR("ERROR: Reconnect failed: %d\n", ret);
+              sleep(1);
+            }
+
+          continue;
+        }
+
+      if (wapi_roam_msec() - roam->scanned >= config->scaninterval * 1000)
+        {
+          ret = wapi_roam_scan(roam);
+          if (ret < 0)
+            {
+              WAPI_ERROR("ERROR: Background scan failed: %d\n", ret);
+              roam->scanned = wapi_roam_msec();
+            }
+          else
+            {
+              /* Roam if the current AP is weak and another one is stronger
+               * by the hysteresis.
+               */
+
+              cur    = wapi_roam_find(roam, &bssid);
+              target = wapi_roam_select(roam, cur);
+
+              if (cur != NULL && target != NULL &&
+                  cur->rssi < config->threshold &&
+                  target->rssi >= cur->rssi + config->hysteresis)
+                {
+                  if (wapi_roam_connect(roam, target) < 0)
+                    {
+                      /* The link is restored on the next pass */
+
+                      WAPI_ERROR("ERROR: Roaming failed\n");
+                    }
+                }
+            }
+        }
+
+      usleep(CONFIG_WIRELESS_WAPI_ROAM_POLLMS * 1000);
+    }
+
+  close(roam->sock);
+
+errout_with_buf:
+  free(roam->buf);
+
+errout_with_roam:
+  free(roam);
+  return ret;
+}
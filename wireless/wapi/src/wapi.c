@@ -41,6 +41,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <errno.h>
 #include <strings.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
@@ -97,6 +98,10 @@ static void wapi_bitrate_cmd(int sock, FAR const char *ifname,
 static void wapi_txpower_cmd(int sock, FAR const char *ifname,
                              FAR const char *pwrstr, FAR const char *flagstr);
 static void wapi_scan_cmd(int sock, FAR const char *ifname);
+#ifdef CONFIG_WIRELESS_WAPI_ROAM
+static void wapi_roam_cmd(int sock, FAR const char *ifname,
+                          FAR const char *essid, FAR const char *passphrase);
+#endif
 
 static void wapi_showusage(FAR const char *progname, int exitcode);
 
@@ -117,6 +122,9 @@ static const struct wapi_command_s g_wapi_commands[] =
   {"ap",      2, (CODE void *)wapi_ap_cmd},
   {"bitrate", 3, (CODE void *)wapi_bitrate_cmd},
   {"txpower", 3, (CODE void *)wapi_txpower_cmd},
+#ifdef CONFIG_WIRELESS_WAPI_ROAM
+  {"roam",    3, (CODE void *)wapi_roam_cmd},
+#endif
 };
 
 #define NCOMMANDS (sizeof(g_wapi_commands) / sizeof(struct wapi_command_s))
@@ -628,6 +636,36 @@ static void wapi_txpower_cmd(int sock, FAR const char *ifname,
     }
 }
 
+/****************************************************************************
+ * Name: wapi_scan_print
+ *
+ * Description:
+ *   Scan callback that prints one AP.
+ *
+ ****************************************************************************/
+
+static int wapi_scan_print(FAR const struct wapi_scan_info_s *info,
+                           FAR void *arg)
+{
+  char rssi[8];
+
+  if (info->has_rssi)
+    {
+      snprintf(rssi, sizeof(rssi), "%d", info->rssi);
+    }
+  else
+    {
+      rssi[0] = '\0';
+    }
+
+  printf("    %02x:%02x:%02x:%02x:%02x:%02x %4s %s\n",
+         info->ap.ether_addr_octet[0], info->ap.ether_addr_octet[1],
+         info->ap.ether_addr_octet[2], info->ap.ether_addr_octet[3],
+         info->ap.ether_addr_octet[4], info->ap.ether_addr_octet[5],
+         rssi, (info->has_essid ? info->essid : ""));
+  return 0;
+}
+
 /****************************************************************************
  * Name: wapi_scan_cmd
  *
@@ -643,8 +681,8 @@ static void wapi_scan_cmd(int sock, FAR const char *ifname)
 {
   int sleepdur = 1;
   int sleeptries = 5;
-  struct wapi_list_s list;
-  FAR struct wapi_scan_info_s *info;
+  FAR char *buf;
+  size_t buflen;
   int ret;
 
   /* Start scan */
@@ -668,38 +706,75 @@ static void wapi_scan_cmd(int sock, FAR const char *ifname)
       return;
     }
 
-  /* Collect results */
+  /* Collect results, printing each AP as it is decoded.  The buffer is
+   * grown and the results read again only if they do not fit.
+   */
 
-  bzero(&list, sizeof(struct wapi_list_s));
-  ret = wapi_scan_coll(sock, ifname, &list);
-  if (ret < 0)
+  buflen = IW_SCAN_MAX_DATA;
+  buf = malloc(buflen);
+  if (buf == NULL)
     {
-      WAPI_ERROR("ERROR: wapi_scan_coll() failed: %d\n", ret);
+      WAPI_STRERROR("malloc()");
+      return;
     }
 
-  /* Print found aps */
+  while ((ret = wapi_scan_process(sock, ifname, buf, buflen, NULL,
+                                  wapi_scan_print, NULL)) == -E2BIG)
+    {
+      FAR char *tmp;
 
-  for (info = list.head.scan; info; info = info->next)
+      buflen *= 2;
+      tmp = realloc(buf, buflen);
+      if (tmp == NULL)
+        {
+          WAPI_STRERROR("realloc()");
+          break;
+        }
+
+      buf = tmp;
+    }
+
+  if (ret < 0)
     {
-      printf("    %02x:%02x:%02x:%02x:%02x:%02x %s\n",
-             info->ap.ether_addr_octet[0], info->ap.ether_addr_octet[1],
-             info->ap.ether_addr_octet[2], info->ap.ether_addr_octet[3],
-             info->ap.ether_addr_octet[4],  info->ap.ether_addr_octet[5],
-             (info->has_essid ? info->essid : ""));
+      WAPI_ERROR("ERROR: wapi_scan_process() failed: %d\n", ret);
     }
 
-  /* Free ap list */
+  free(buf);
+}
 
-  info = list.head.scan;
-  while (info)
-    {
-      FAR struct wapi_scan_info_s *temp;
+/****************************************************************************
+ * Name: wapi_roam_cmd
+ *
+ * Description:
+ *   Keep ifname associated with a WPA2 network, reconnecting quickly to the
+ *   known APs and roaming between them.  Runs until killed.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
 
-      temp = info->next;
-      free(info);
-      info = temp;
-    }
+#ifdef CONFIG_WIRELESS_WAPI_ROAM
+static void wapi_roam_cmd(int sock, FAR const char *ifname,
+                          FAR const char *essid, FAR const char *passphrase)
+{
+  struct wapi_roam_config_s config;
+  int ret;
+
+  config.ifname       = ifname;
+  config.essid        = essid;
+  config.passphrase   = passphrase;
+  config.auth_wpa     = IW_AUTH_WPA_VERSION_WPA2;
+  config.cipher_mode  = IW_AUTH_CIPHER_CCMP;
+  config.alg          = WPA_ALG_CCMP;
+  config.scaninterval = CONFIG_WIRELESS_WAPI_ROAM_SCANINTERVAL;
+  config.threshold    = CONFIG_WIRELESS_WAPI_ROAM_THRESHOLD;
+  config.hysteresis   = CONFIG_WIRELESS_WAPI_ROAM_HYSTERESIS;
+
+  ret = wapi_roam(&config);
+  WAPI_ERROR("ERROR: wapi_roam() failed: %d\n", ret);
 }
+#endif
 
 /****************************************************************************
  * Name: wapi_showusage
@@ -726,6 +801,10 @@ static void wapi_showusage(FAR const char *progname, int exitcode)
   fprintf(stderr, "       %s ap <ifname> <ifname> <MAC address>\n", progname);
   fprintf(stderr, "       %s bitrate <ifname> <bitrate> <flag>\n", progname);
   fprintf(stderr, "       %s txpower <ifname> <txpower> <flag>\n", progname);
+#ifdef CONFIG_WIRELESS_WAPI_ROAM
+  fprintf(stderr, "       %s roam <ifname> <essid> <passphrase>\n",
+          progname);
+#endif
   fprintf(stderr, "       %s help\n", progname);
 
   fprintf(stderr, "\nFrequency Flags:\n");
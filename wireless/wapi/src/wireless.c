@@ -38,8 +38,10 @@
  ****************************************************************************/
 
 #include <sys/ioctl.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <strings.h>
 #include <math.h>
 #include <errno.h>
@@ -281,50 +283,15 @@ static int wapi_event_stream_extract(FAR struct wapi_event_stream_s *stream,
  * Name: wapi_scan_event
  *
  * Description:
+ *   Decode an event of the current AP into its info.
  *
  ****************************************************************************/
 
-static int wapi_scan_event(FAR struct iw_event *event, FAR struct wapi_list_s *list)
+static int wapi_scan_event(FAR struct iw_event *event,
+                           FAR struct wapi_scan_info_s *info)
 {
-  FAR struct wapi_scan_info_s *info;
-
-  /* Get current "wapi_info_t". */
-
-  info = list->head.scan;
-
-  /* Decode the event. */
-
   switch (event->cmd)
     {
-    case SIOCGIWAP:
-      {
-        struct wapi_scan_info_s *temp;
-
-        /* Allocate a new cell. */
-
-        temp = malloc(sizeof(struct wapi_scan_info_s));
-        if (!temp)
-          {
-            WAPI_STRERROR("malloc()");
-            return -1;
-          }
-
-        /* Reset it. */
-
-        bzero(temp, sizeof(struct wapi_scan_info_s));
-
-        /* Save cell identifier. */
-
-        memcpy(&temp->ap, &event->u.ap_addr.sa_data, sizeof(struct ether_addr));
-
-        /* Push it to the head of the list. */
-
-        temp->next = info;
-        list->head.scan = temp;
-
-        break;
-      }
-
     case SIOCGIWFREQ:
       info->has_freq = 1;
       info->freq = wapi_freq2float(&(event->u.freq));
@@ -350,7 +317,9 @@ static int wapi_scan_event(FAR struct iw_event *event, FAR struct wapi_list_s *l
       memset(info->essid, 0, (WAPI_ESSID_MAX_SIZE + 1));
       if ((event->u.essid.pointer) && (event->u.essid.length))
         {
-          memcpy(info->essid, event->u.essid.pointer, event->u.essid.length);
+          memcpy(info->essid, event->u.essid.pointer,
+                 event->u.essid.length > WAPI_ESSID_MAX_SIZE ?
+                 WAPI_ESSID_MAX_SIZE : event->u.essid.length);
         }
       break;
 
@@ -365,8 +334,79 @@ static int wapi_scan_event(FAR struct iw_event *event, FAR struct wapi_list_s *l
           info->bitrate = event->u.bitrate.value;
         }
       break;
+
+    case IWEVQUAL:
+      if ((event->u.qual.updated & IW_QUAL_LEVEL_INVALID) == 0)
+        {
+          /* Levels in dBm are reported as signed 8-bit values */
+
+          info->has_rssi = 1;
+          info->rssi = (event->u.qual.updated & IW_QUAL_DBM) ?
+                       (int)(int8_t)event->u.qual.level :
+                       (int)event->u.qual.level;
+        }
+      break;
+    }
+
+  return 0;
+}
+
+/****************************************************************************
+ * Name: wapi_scan_match
+ *
+ * Description:
+ *   Check an AP against a scan filter.
+ *
+ ****************************************************************************/
+
+static bool wapi_scan_match(FAR const struct wapi_scan_info_s *info,
+                            FAR const struct wapi_scan_filter_s *filter)
+{
+  if (filter == NULL)
+    {
+      return true;
+    }
+
+  if (filter->essid != NULL &&
+      (!info->has_essid || strcmp(info->essid, filter->essid) != 0))
+    {
+      return false;
+    }
+
+  if (filter->has_minrssi &&
+      (!info->has_rssi || info->rssi < filter->minrssi))
+    {
+      return false;
+    }
+
+  return true;
+}
+
+/****************************************************************************
+ * Name: wapi_scan_push
+ *
+ * Description:
+ *   Scan callback of wapi_scan_coll(): push a copy of the AP to the head of
+ *   the list.
+ *
+ ****************************************************************************/
+
+static int wapi_scan_push(FAR const struct wapi_scan_info_s *info,
+                          FAR void *arg)
+{
+  FAR struct wapi_list_s *list = (FAR struct wapi_list_s *)arg;
+  FAR struct wapi_scan_info_s *temp;
+
+  temp = malloc(sizeof(struct wapi_scan_info_s));
+  if (!temp)
+    {
+      WAPI_STRERROR("malloc()");
+      return -ENOMEM;
     }
 
+  memcpy(temp, info, sizeof(struct wapi_scan_info_s));
+  temp->next = list->head.scan;
+  list->head.scan = temp;
   return 0;
 }
 
@@ -1112,7 +1152,6 @@ int wapi_scan_coll(int sock, FAR const char *ifname, FAR struct wapi_list_s *aps
 {
   FAR char *buf;
   int buflen;
-  struct iwreq wrq;
   int ret;
 
   WAPI_VALIDATE_PTR(aps);
@@ -1125,16 +1164,10 @@ int wapi_scan_coll(int sock, FAR const char *ifname, FAR struct wapi_list_s *aps
       return -1;
     }
 
-alloc:
-  /* Collect results. */
-
-  wrq.u.data.pointer = buf;
-  wrq.u.data.length  = buflen;
-  wrq.u.data.flags   = 0;
-  strncpy(wrq.ifr_name, ifname, IFNAMSIZ);
+  /* Grow the buffer until the results fit */
 
-  ret = ioctl(sock, SIOCGIWSCAN, (unsigned long)((uintptr_t)&wrq));
-  if (ret < 0 && errno == E2BIG)
+  while ((ret = wapi_scan_process(sock, ifname, buf, buflen, NULL,
+                                  wapi_scan_push, aps)) == -E2BIG)
     {
       FAR char *tmp;
 
@@ -1148,54 +1181,114 @@ alloc:
         }
 
       buf = tmp;
-      goto alloc;
     }
 
-  /* There is still something wrong. It's either EAGAIN or some other ioctl()
-   * failure. We don't bother, let the user deal with it.
-   */
+  /* Free request buffer. */
 
+  free(buf);
+  return ret < 0 ? ret : 0;
+}
+
+/****************************************************************************
+ * Name: wapi_scan_process
+ *
+ * Description:
+ *   Reads the results of a scan process into a buffer provided by the
+ *   caller and passes each AP that matches the filter to a callback while
+ *   the events are decoded, without building a list.
+ *
+ * Returned Value:
+ *   The number of APs passed to cb or a negated errno.
+ *
+ ****************************************************************************/
+
+int wapi_scan_process(int sock, FAR const char *ifname, FAR char *buf,
+                      size_t buflen, FAR const struct wapi_scan_filter_s *filter,
+                      wapi_scan_cb_t cb, FAR void *arg)
+{
+  struct wapi_event_stream_s stream;
+  struct wapi_scan_info_s info;
+  struct iw_event iwe;
+  struct iwreq wrq;
+  bool valid = false;
+  int count = 0;
+  int more;
+  int ret;
+
+  WAPI_VALIDATE_PTR(buf);
+  WAPI_VALIDATE_PTR(cb);
+
+  /* Collect results. */
+
+  wrq.u.data.pointer = buf;
+  wrq.u.data.length  = buflen;
+  wrq.u.data.flags   = 0;
+  strncpy(wrq.ifr_name, ifname, IFNAMSIZ);
+
+  ret = ioctl(sock, SIOCGIWSCAN, (unsigned long)((uintptr_t)&wrq));
   if (ret < 0)
     {
       int errcode = errno;
-      WAPI_IOCTL_STRERROR(SIOCGIWSCAN, errcode);
-      free(buf);
+
+      /* A too small buffer is left for the caller to deal with */
+
+      if (errcode != E2BIG)
+        {
+          WAPI_IOCTL_STRERROR(SIOCGIWSCAN, errcode);
+        }
+
       return -errcode;
     }
 
-  printf("got %d bytes\n", wrq.u.data.length);
-
-  /* We have the results, process them. */
+  /* Each AP starts with its address.  An AP is complete, and is passed to
+   * the callback, when the next one starts or the events end.
+   */
 
-  if (wrq.u.data.length)
+  wapi_event_stream_init(&stream, buf, wrq.u.data.length);
+  do
     {
-      struct iw_event iwe;
-      struct wapi_event_stream_s stream;
-
-      wapi_event_stream_init(&stream, buf, wrq.u.data.length);
-      do
+      more = wapi_event_stream_extract(&stream, &iwe);
+      if (more < 0)
         {
-          /* Get the next event from the stream */
+          WAPI_ERROR("ERROR: wapi_event_stream_extract() failed!\n");
+          return -EINVAL;
+        }
 
-          ret = wapi_event_stream_extract(&stream, &iwe);
-          if (ret > 0)
+      if (valid && (more == 0 || iwe.cmd == SIOCGIWAP))
+        {
+          valid = false;
+          if (wapi_scan_match(&info, filter))
             {
-              int eventret = wapi_scan_event(&iwe, aps);
-              if (eventret < 0)
+              count++;
+              ret = cb(&info, arg);
+              if (ret != 0)
                 {
-                  ret = eventret;
+                  return ret < 0 ? ret : count;
                 }
             }
-          else if (ret < 0)
+        }
+
+      if (more == 0)
+        {
+          break;
+        }
+
+      if (iwe.cmd == SIOCGIWAP)
+        {
+          memset(&info, 0, sizeof(struct wapi_scan_info_s));
+          memcpy(&info.ap, &iwe.u.ap_addr.sa_data, sizeof(struct ether_addr));
+          valid = true;
+        }
+      else if (valid)
+        {
+          ret = wapi_scan_event(&iwe, &info);
+          if (ret < 0)
             {
-              WAPI_ERROR("ERROR: wapi_event_stream_extract() failed!\n");
+              return ret;
             }
         }
-      while (ret > 0);
     }
+  while (more > 0);
 
-  /* Free request buffer. */
-
-  free(buf);
-  return ret;
+  return count;
 }